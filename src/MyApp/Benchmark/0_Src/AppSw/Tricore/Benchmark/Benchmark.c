@@ -0,0 +1,881 @@
+/**
+ * \file Benchmark.c
+ * \brief Cycle count benchmark of iLLD and SysSe routines
+ *
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "Benchmark.h"
+#include "Cpu0_Main.h"
+#include "SysSe/Bsp/Bsp.h"
+#include "SysSe/Comm/Ifx_Console.h"
+#include "SysSe/Math/Ifx_Cf32.h"
+#include "SysSe/Math/Ifx_FftF32.h"
+#include "SysSe/Math/Ifx_FftFxp.h"
+#include "SysSe/Math/Ifx_LutSincosF32.h"
+#include "SysSe/Math/Ifx_LutAtan2F32.h"
+#include "SysSe/Math/Ifx_SvmFxp.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+#define BENCHMARK_FLUSH_TIMEOUT (TimeConst_1s)      /**< \brief Maximal wait for the ASC output before a measurement */
+#define BENCHMARK_VEC_TOLERANCE (1.0e-5f)           /**< \brief Relative tolerance of the unrolled vector functions against the reference */
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+
+App_Benchmark g_Benchmark; /**< \brief Benchmark information */
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+
+static cfloat32 Benchmark_fftIn[BENCHMARK_FFT_MAX_SIZE];
+static cfloat32 Benchmark_fftOut[BENCHMARK_FFT_MAX_SIZE];
+static cfloat32 Benchmark_fftTwiddle[BENCHMARK_FFT_TWIDDLE_SIZE / 2];
+static float32  Benchmark_fftRealIn[BENCHMARK_FFT_TWIDDLE_SIZE];
+static sint16   Benchmark_fftQ15In[BENCHMARK_FFT_TWIDDLE_SIZE];
+static csint16  Benchmark_fftQ15Out[(BENCHMARK_FFT_TWIDDLE_SIZE / 2) + 1];
+static csint16  Benchmark_fftQ15Twiddle[BENCHMARK_FFT_TWIDDLE_SIZE / 2];
+static uint32   Benchmark_data[BENCHMARK_DATA_SIZE / 4];
+static uint8    Benchmark_fifoBuffer[BENCHMARK_FIFO_SIZE + sizeof(Ifx_Fifo) + 8];
+static uint8    Benchmark_spiTx[BENCHMARK_QSPI_MAX_SIZE];
+static uint8    Benchmark_spiRx[BENCHMARK_QSPI_MAX_SIZE];
+static cfloat32 Benchmark_svmIn[BENCHMARK_SVM_SIZE];
+static csint16  Benchmark_svmQ15In[BENCHMARK_SVM_SIZE];
+static Ifx_TimerValue Benchmark_svmOut[IFX_SVM_NUM_PHASES];
+static cfloat32 Benchmark_vecIn[BENCHMARK_VEC_SIZE];
+static cfloat32 Benchmark_vecWork[BENCHMARK_VEC_SIZE];
+static cfloat32 Benchmark_vecRef[BENCHMARK_VEC_SIZE];
+static float32  Benchmark_vecRealIn[BENCHMARK_VEC_SIZE];
+static float32  Benchmark_vecWindow[BENCHMARK_VEC_SIZE];
+static sint16   Benchmark_vecQ15In[BENCHMARK_VEC_SIZE];
+static const cfloat32 Benchmark_vecRotation = {0.6f, 0.8f};
+
+IFX_LUTSINCOSF32_TABLE(Benchmark_sincos10, 10);
+IFX_LUTSINCOSF32_TABLE(Benchmark_sincos8, 8);
+IFX_LUTATAN2F32_TABLE(Benchmark_atan2, 64);
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+
+static void Benchmark_empty(uint32 param);
+static void Benchmark_fft(uint32 param);
+static void Benchmark_fftRadix4(uint32 param);
+static void Benchmark_fftRadix4Twiddle(uint32 param);
+static void Benchmark_fftReal(uint32 param);
+static void Benchmark_fftRealQ15(uint32 param);
+static void Benchmark_crcTable(uint32 param);
+static void Benchmark_crcTableFast(uint32 param);
+#ifndef SIMULATION
+static void Benchmark_fceCrc16(uint32 param);
+static void Benchmark_fceCrc32(uint32 param);
+#endif
+static void Benchmark_fifo(uint32 param);
+static void Benchmark_lutSincos(uint32 param);
+static void Benchmark_lutSincosTable(uint32 param);
+static void Benchmark_lutSincosInterpolated(uint32 param);
+static void Benchmark_lutAtan2(uint32 param);
+static void Benchmark_lutAtan2Interpolated(uint32 param);
+static void Benchmark_svmMinMax(uint32 param);
+static void Benchmark_svmMinMaxCall(uint32 param);
+static void Benchmark_svmSector(uint32 param);
+static void Benchmark_svmMinMaxQ15(uint32 param);
+static void Benchmark_svmSectorQ15(uint32 param);
+#ifndef SIMULATION
+static void Benchmark_qspi(uint32 param);
+#endif
+static void Benchmark_cplxVecMag(uint32 param);
+static void Benchmark_cplxVecMagFast(uint32 param);
+static void Benchmark_cplxVecMul(uint32 param);
+static void Benchmark_cplxVecMulFast(uint32 param);
+static void Benchmark_vecWin(uint32 param);
+static void Benchmark_vecWinFast(uint32 param);
+static void Benchmark_vecSum(uint32 param);
+static void Benchmark_vecSumFast(uint32 param);
+static void Benchmark_vecSumQ15(uint32 param);
+static void Benchmark_vecMax(uint32 param);
+static void Benchmark_vecMaxFast(uint32 param);
+static void Benchmark_vecMaxQ15(uint32 param);
+
+/** \brief Benchmark table */
+static const Benchmark_Workload Benchmark_workloads[] = {
+    {"empty",         &Benchmark_empty,                 0                         },
+    {"fftRadix2",     &Benchmark_fft,                   64                        },
+    {"fftRadix2",     &Benchmark_fft,                   256                       },
+    {"fftRadix2",     &Benchmark_fft,                   1024                      },
+    {"fftRadix2",     &Benchmark_fft,                   4096                      },
+    {"fftRadix4",     &Benchmark_fftRadix4,             64                        },
+    {"fftRadix4",     &Benchmark_fftRadix4,             256                       },
+    {"fftRadix4",     &Benchmark_fftRadix4,             1024                      },
+    {"fftRadix4",     &Benchmark_fftRadix4,             4096                      },
+    {"fftRadix4Tw",   &Benchmark_fftRadix4Twiddle,      BENCHMARK_FFT_TWIDDLE_SIZE},
+    {"fftReal",       &Benchmark_fftReal,               BENCHMARK_FFT_TWIDDLE_SIZE},
+    {"fftRealQ15",    &Benchmark_fftRealQ15,            BENCHMARK_FFT_TWIDDLE_SIZE},
+    {"crcTable",      &Benchmark_crcTable,              BENCHMARK_DATA_SIZE       },
+    {"crcTableFast",  &Benchmark_crcTableFast,          BENCHMARK_DATA_SIZE       },
+#ifndef SIMULATION
+    {"fceCrc16",      &Benchmark_fceCrc16,              BENCHMARK_DATA_SIZE       },
+    {"fceCrc32",      &Benchmark_fceCrc32,              BENCHMARK_DATA_SIZE       },
+#endif
+    {"fifoWriteRead", &Benchmark_fifo,                  16                        },
+    {"fifoWriteRead", &Benchmark_fifo,                  BENCHMARK_FIFO_SIZE       },
+    {"lutSincos",     &Benchmark_lutSincos,             256                       },
+    {"lutSincos10",   &Benchmark_lutSincosTable,        256                       },
+    {"lutSincosInt8", &Benchmark_lutSincosInterpolated, 256                       },
+    {"lutAtan2",      &Benchmark_lutAtan2,              256                       },
+    {"lutAtan2Int64", &Benchmark_lutAtan2Interpolated,  256                       },
+    {"svmMinMax",     &Benchmark_svmMinMax,             BENCHMARK_SVM_SIZE        },
+    {"svmMinMaxCall", &Benchmark_svmMinMaxCall,         BENCHMARK_SVM_SIZE        },
+    {"svmSector",     &Benchmark_svmSector,             BENCHMARK_SVM_SIZE        },
+    {"svmMinMaxQ15",  &Benchmark_svmMinMaxQ15,          BENCHMARK_SVM_SIZE        },
+    {"svmSectorQ15",  &Benchmark_svmSectorQ15,          BENCHMARK_SVM_SIZE        },
+#ifndef SIMULATION
+    {"qspiExchange",  &Benchmark_qspi,                  8                         },
+    {"qspiExchange",  &Benchmark_qspi,                  BENCHMARK_QSPI_MAX_SIZE   },
+#endif
+    {"cplxVecMag",    &Benchmark_cplxVecMag,            BENCHMARK_VEC_SIZE        },
+    {"cplxVecMagFast", &Benchmark_cplxVecMagFast,       BENCHMARK_VEC_SIZE        },
+    {"cplxVecMul",    &Benchmark_cplxVecMul,            BENCHMARK_VEC_SIZE        },
+    {"cplxVecMulFast", &Benchmark_cplxVecMulFast,       BENCHMARK_VEC_SIZE        },
+    {"vecWin",        &Benchmark_vecWin,                BENCHMARK_VEC_SIZE        },
+    {"vecWinFast",    &Benchmark_vecWinFast,            BENCHMARK_VEC_SIZE        },
+    {"vecSum",        &Benchmark_vecSum,                BENCHMARK_VEC_SIZE        },
+    {"vecSumFast",    &Benchmark_vecSumFast,            BENCHMARK_VEC_SIZE        },
+    {"vecSumQ15",     &Benchmark_vecSumQ15,             BENCHMARK_VEC_SIZE        },
+    {"vecMax",        &Benchmark_vecMax,                BENCHMARK_VEC_SIZE        },
+    {"vecMaxFast",    &Benchmark_vecMaxFast,            BENCHMARK_VEC_SIZE        },
+    {"vecMaxQ15",     &Benchmark_vecMaxQ15,             BENCHMARK_VEC_SIZE        },
+};
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+/** \name Interrupts for the serial interface and the QSPI
+ * \{ */
+
+IFX_INTERRUPT(benchmarkAscTxISR, 0, ISR_PRIORITY_ASC_TX)
+{
+    IfxAsclin_Asc_isrTransmit(&g_Benchmark.drivers.asc);
+}
+
+
+IFX_INTERRUPT(benchmarkAscRxISR, 0, ISR_PRIORITY_ASC_RX)
+{
+    IfxAsclin_Asc_isrReceive(&g_Benchmark.drivers.asc);
+}
+
+
+IFX_INTERRUPT(benchmarkAscErISR, 0, ISR_PRIORITY_ASC_EX)
+{
+    IfxAsclin_Asc_isrError(&g_Benchmark.drivers.asc);
+}
+
+
+IFX_INTERRUPT(benchmarkQspiTxISR, 0, ISR_PRIORITY_QSPI0_TX)
+{
+    IfxQspi_SpiMaster_isrTransmit(&g_Benchmark.drivers.spi);
+}
+
+
+IFX_INTERRUPT(benchmarkQspiRxISR, 0, ISR_PRIORITY_QSPI0_RX)
+{
+    IfxQspi_SpiMaster_isrReceive(&g_Benchmark.drivers.spi);
+}
+
+
+IFX_INTERRUPT(benchmarkQspiErISR, 0, ISR_PRIORITY_QSPI0_ER)
+{
+    IfxQspi_SpiMaster_isrError(&g_Benchmark.drivers.spi);
+}
+
+
+/** \} */
+
+/** \name Workloads
+ * \{ */
+
+static void Benchmark_empty(uint32 param)
+{
+    (void)param;
+}
+
+
+static void Benchmark_fft(uint32 param)
+{
+    Ifx_FftF32_radix2(Benchmark_fftOut, Benchmark_fftIn, (uint16)param);
+}
+
+
+static void Benchmark_fftRadix4(uint32 param)
+{
+    Ifx_FftF32_radix4(Benchmark_fftOut, Benchmark_fftIn, (uint16)param, NULL_PTR);
+}
+
+
+static void Benchmark_fftRadix4Twiddle(uint32 param)
+{
+    Ifx_FftF32_radix4(Benchmark_fftOut, Benchmark_fftIn, (uint16)param, Benchmark_fftTwiddle);
+}
+
+
+static void Benchmark_fftReal(uint32 param)
+{
+    Ifx_FftF32_real(Benchmark_fftOut, Benchmark_fftRealIn, (uint16)param, Benchmark_fftTwiddle);
+}
+
+
+static void Benchmark_fftRealQ15(uint32 param)
+{
+    Ifx_FftFxp_realQ15(Benchmark_fftQ15Out, Benchmark_fftQ15In, (uint16)param, Benchmark_fftQ15Twiddle, 0x800, 4);
+}
+
+
+static void Benchmark_crcTable(uint32 param)
+{
+    g_Benchmark.sink = Ifx_Crc_table(&g_Benchmark.crc, (uint8 *)Benchmark_data, param);
+}
+
+
+static void Benchmark_crcTableFast(uint32 param)
+{
+    g_Benchmark.sink = Ifx_Crc_tableFast(&g_Benchmark.crc, (uint8 *)Benchmark_data, param);
+}
+
+
+#ifndef SIMULATION
+static void Benchmark_fceCrc16(uint32 param)
+{
+    g_Benchmark.sink = IfxFce_Crc_calculateCrc16(&g_Benchmark.drivers.fceCrc16, (const uint16 *)Benchmark_data, param / 2, 0xFFFF);
+}
+
+
+static void Benchmark_fceCrc32(uint32 param)
+{
+    g_Benchmark.sink = IfxFce_Crc_calculateCrc32(&g_Benchmark.drivers.fceCrc32, Benchmark_data, param / 4, 0xFFFFFFFF);
+}
+#endif
+
+
+static void Benchmark_fifo(uint32 param)
+{
+    Ifx_SizeT remaining;
+
+    remaining        = Ifx_Fifo_write(g_Benchmark.fifo, Benchmark_data, param, 0);
+    remaining       += Ifx_Fifo_read(g_Benchmark.fifo, Benchmark_spiRx, param, 0);
+    g_Benchmark.sink = remaining;
+}
+
+
+static void Benchmark_lutSincos(uint32 param)
+{
+    uint32  i;
+    float32 sum = 0.0;
+
+    for (i = 0; i < param; i++)
+    {
+        sum += Ifx_LutSincosF32_sin((Ifx_Lut_FxpAngle)(i * (IFX_LUT_ANGLE_RESOLUTION / param)));
+    }
+
+    g_Benchmark.sink = (uint32)sum;
+}
+
+
+static void Benchmark_lutSincosTable(uint32 param)
+{
+    uint32  i;
+    float32 sum = 0.0;
+
+    for (i = 0; i < param; i++)
+    {
+        sum += Ifx_LutSincosF32_sinTable(&Benchmark_sincos10, (Ifx_Lut_FxpAngle)(i * (IFX_LUT_ANGLE_RESOLUTION / param)));
+    }
+
+    g_Benchmark.sink = (uint32)sum;
+}
+
+
+static void Benchmark_lutSincosInterpolated(uint32 param)
+{
+    uint32  i;
+    float32 sum = 0.0;
+
+    for (i = 0; i < param; i++)
+    {
+        sum += Ifx_LutSincosF32_sinInterpolated(&Benchmark_sincos8, (Ifx_Lut_FxpAngle)(i * (IFX_LUT_ANGLE_RESOLUTION / param)));
+    }
+
+    g_Benchmark.sink = (uint32)sum;
+}
+
+
+static void Benchmark_lutAtan2(uint32 param)
+{
+    uint32  i;
+    float32 sum = 0.0;
+
+    for (i = 0; i < param; i++)
+    {
+        sum += Ifx_LutAtan2F32_float32((float32)i - (float32)(param / 2), 100.0);
+    }
+
+    g_Benchmark.sink = (uint32)sum;
+}
+
+
+static void Benchmark_lutAtan2Interpolated(uint32 param)
+{
+    uint32  i;
+    float32 sum = 0.0;
+
+    for (i = 0; i < param; i++)
+    {
+        sum += Ifx_LutAtan2F32_float32Interpolated(&Benchmark_atan2, (float32)i - (float32)(param / 2), 100.0);
+    }
+
+    g_Benchmark.sink = (uint32)sum;
+}
+
+
+static void Benchmark_svmMinMax(uint32 param)
+{
+    uint32 i;
+
+    for (i = 0; i < param; i++)
+    {
+        Ifx_SvmF32_minMaxInline(Benchmark_svmOut, Benchmark_svmIn[i], BENCHMARK_SVM_PERIOD);
+    }
+
+    g_Benchmark.sink = Benchmark_svmOut[0];
+}
+
+
+static void Benchmark_svmMinMaxCall(uint32 param)
+{
+    uint32 i;
+
+    for (i = 0; i < param; i++)
+    {
+        Ifx_SvmF32_minMax(Benchmark_svmOut, Benchmark_svmIn[i], BENCHMARK_SVM_PERIOD);
+    }
+
+    g_Benchmark.sink = Benchmark_svmOut[0];
+}
+
+
+static void Benchmark_svmSector(uint32 param)
+{
+    uint32 i;
+    uint32 sum = 0;
+
+    for (i = 0; i < param; i++)
+    {
+        sum += Ifx_SvmF32_sectorInline(Benchmark_svmOut, Benchmark_svmIn[i], BENCHMARK_SVM_PERIOD);
+    }
+
+    g_Benchmark.sink = sum + Benchmark_svmOut[0];
+}
+
+
+static void Benchmark_svmMinMaxQ15(uint32 param)
+{
+    uint32 i;
+
+    for (i = 0; i < param; i++)
+    {
+        Ifx_SvmFxp_minMaxQ15Inline(Benchmark_svmOut, Benchmark_svmQ15In[i], BENCHMARK_SVM_PERIOD);
+    }
+
+    g_Benchmark.sink = Benchmark_svmOut[0];
+}
+
+
+static void Benchmark_svmSectorQ15(uint32 param)
+{
+    uint32 i;
+    uint32 sum = 0;
+
+    for (i = 0; i < param; i++)
+    {
+        sum += Ifx_SvmFxp_sectorQ15Inline(Benchmark_svmOut, Benchmark_svmQ15In[i], BENCHMARK_SVM_PERIOD);
+    }
+
+    g_Benchmark.sink = sum + Benchmark_svmOut[0];
+}
+
+
+#ifndef SIMULATION
+/** The measurement includes the transfer on the bus and the QSPI interrupts */
+static void Benchmark_qspi(uint32 param)
+{
+    IfxQspi_SpiMaster_exchange(&g_Benchmark.drivers.spiChannel, Benchmark_spiTx, Benchmark_spiRx, param);
+
+    while (IfxQspi_SpiMaster_getStatus(&g_Benchmark.drivers.spiChannel) == SpiIf_Status_busy)
+    {}
+}
+#endif
+
+
+/** The magnitude is computed in place: the measurement includes the copy of the input vector */
+static void Benchmark_cplxVecMag(uint32 param)
+{
+    CplxVecCpy_f32(Benchmark_vecWork, Benchmark_vecIn, (short)param);
+    g_Benchmark.sink = (uint32)*CplxVecMag_f32(Benchmark_vecWork, (short)param);
+}
+
+
+/** The magnitude is computed in place: the measurement includes the copy of the input vector */
+static void Benchmark_cplxVecMagFast(uint32 param)
+{
+    CplxVecCpy_f32(Benchmark_vecWork, Benchmark_vecIn, (short)param);
+    g_Benchmark.sink = (uint32)*CplxVecMag_f32Fast(Benchmark_vecWork, (short)param);
+}
+
+
+static void Benchmark_cplxVecMul(uint32 param)
+{
+    CplxVecMul_f32(Benchmark_vecWork, &Benchmark_vecRotation, (short)param);
+}
+
+
+static void Benchmark_cplxVecMulFast(uint32 param)
+{
+    CplxVecMul_f32Fast(Benchmark_vecWork, &Benchmark_vecRotation, (short)param);
+}
+
+
+static void Benchmark_vecWin(uint32 param)
+{
+    VecWin_f32((float32 *)Benchmark_vecWork, Benchmark_vecWindow, (short)param, BENCHMARK_VEC_SIZE, 1, 1);
+}
+
+
+static void Benchmark_vecWinFast(uint32 param)
+{
+    VecWin_f32Fast((float32 *)Benchmark_vecWork, Benchmark_vecWindow, (short)param, BENCHMARK_VEC_SIZE, 1, 1);
+}
+
+
+static void Benchmark_vecSum(uint32 param)
+{
+    g_Benchmark.sink = (uint32)VecSum_f32(Benchmark_vecRealIn, (short)param);
+}
+
+
+static void Benchmark_vecSumFast(uint32 param)
+{
+    g_Benchmark.sink = (uint32)VecSum_f32Fast(Benchmark_vecRealIn, (short)param);
+}
+
+
+static void Benchmark_vecSumQ15(uint32 param)
+{
+    g_Benchmark.sink = (uint32)VecSum_q15(Benchmark_vecQ15In, (short)param);
+}
+
+
+static void Benchmark_vecMax(uint32 param)
+{
+    g_Benchmark.sink = (uint32)VecMax_f32(Benchmark_vecRealIn, (short)param);
+}
+
+
+static void Benchmark_vecMaxFast(uint32 param)
+{
+    g_Benchmark.sink = (uint32)VecMax_f32Fast(Benchmark_vecRealIn, (short)param);
+}
+
+
+static void Benchmark_vecMaxQ15(uint32 param)
+{
+    g_Benchmark.sink = (uint32)VecMax_q15(Benchmark_vecQ15In, (short)param);
+}
+
+
+/** \} */
+
+/** \brief Compare a result with its reference
+ * \return TRUE if the relative difference is within BENCHMARK_VEC_TOLERANCE
+ */
+static boolean Benchmark_isClose(float32 value, float32 reference)
+{
+    float32 error = __absf(value - reference);
+
+    return error <= (BENCHMARK_VEC_TOLERANCE * __maxf(__absf(reference), 1.0f)) ? TRUE : FALSE;
+}
+
+
+/** \brief Compare two vectors with \ref Benchmark_isClose() */
+static boolean Benchmark_isVectorClose(const float32 *value, const float32 *reference, uint32 count)
+{
+    boolean result = TRUE;
+    uint32  i;
+
+    for (i = 0; i < count; i++)
+    {
+        result &= Benchmark_isClose(value[i], reference[i]);
+    }
+
+    return result;
+}
+
+
+/** \brief Validate the unrolled and Q15 vector functions against the scalar reference functions
+ *
+ * Prints one line per function: BENCH_CHECK,<function>,<pass|fail>
+ */
+static void Benchmark_checkVector(IfxStdIf_DPipe *io)
+{
+    const short n = BENCHMARK_VEC_SIZE - 1;   /* odd length: the remainder loops are validated too */
+    boolean     pass[8];
+    pchar       name[8] = {"CplxVecMag_f32Fast", "CplxVecMul_f32Fast", "VecWin_f32Fast", "VecSum_f32Fast",
+                           "VecMax_f32Fast", "VecMin_f32Fast", "VecMax_q15", "VecSum_q15"};
+    sint32      sumQ15  = 0;
+    sint32      maxQ15  = -32768;
+    uint32      i;
+
+    CplxVecCpy_f32(Benchmark_vecRef, Benchmark_vecIn, n);
+    CplxVecCpy_f32(Benchmark_vecWork, Benchmark_vecIn, n);
+    pass[0] = Benchmark_isVectorClose(CplxVecMag_f32Fast(Benchmark_vecWork, n), CplxVecMag_f32(Benchmark_vecRef, n), n);
+
+    CplxVecCpy_f32(Benchmark_vecRef, Benchmark_vecIn, n);
+    CplxVecCpy_f32(Benchmark_vecWork, Benchmark_vecIn, n);
+    CplxVecMul_f32(Benchmark_vecRef, &Benchmark_vecRotation, n);
+    CplxVecMul_f32Fast(Benchmark_vecWork, &Benchmark_vecRotation, n);
+    pass[1] = Benchmark_isVectorClose((float32 *)Benchmark_vecWork, (float32 *)Benchmark_vecRef, 2 * n);
+
+    CplxVecCpy_f32(Benchmark_vecRef, Benchmark_vecIn, BENCHMARK_VEC_SIZE / 2);
+    CplxVecCpy_f32(Benchmark_vecWork, Benchmark_vecIn, BENCHMARK_VEC_SIZE / 2);
+    VecWin_f32((float32 *)Benchmark_vecRef, Benchmark_vecWindow, BENCHMARK_VEC_SIZE - 2, BENCHMARK_VEC_SIZE - 2, 1, 1);
+    VecWin_f32Fast((float32 *)Benchmark_vecWork, Benchmark_vecWindow, BENCHMARK_VEC_SIZE - 2, BENCHMARK_VEC_SIZE - 2, 1, 1);
+    pass[2] = Benchmark_isVectorClose((float32 *)Benchmark_vecWork, (float32 *)Benchmark_vecRef, BENCHMARK_VEC_SIZE - 2);
+
+    pass[3] = Benchmark_isClose(VecSum_f32Fast(Benchmark_vecRealIn, n), VecSum_f32(Benchmark_vecRealIn, n));
+    pass[4] = VecMax_f32Fast(Benchmark_vecRealIn, n) == VecMax_f32(Benchmark_vecRealIn, n);
+    pass[5] = VecMin_f32Fast(Benchmark_vecRealIn, n) == VecMin_f32(Benchmark_vecRealIn, n);
+
+    for (i = 0; i < (uint32)n; i++)
+    {
+        sumQ15 += Benchmark_vecQ15In[i];
+        maxQ15  = __max(maxQ15, Benchmark_vecQ15In[i]);
+    }
+
+    pass[6] = VecMax_q15(Benchmark_vecQ15In, n) == maxQ15;
+    pass[7] = VecSum_q15(Benchmark_vecQ15In, n) == sumQ15;
+
+    for (i = 0; i < 8; i++)
+    {
+        IfxStdIf_DPipe_print(io, "BENCH_CHECK,%s,%s"ENDL, name[i], pass[i] ? "pass" : "fail");
+    }
+}
+
+
+#ifdef SIMULATION
+/** \brief Initialise the simulated IO used for the report, blocking mode: the report is complete */
+static void Benchmark_initSimulatedIo(void)
+{
+    Ifx_SimioPipe_init(&g_Benchmark.drivers.simio, FALSE);
+    Ifx_SimioPipe_stdIfDPipeInit(&g_Benchmark.stdIf.simio, &g_Benchmark.drivers.simio);
+
+    Ifx_Console_init(&g_Benchmark.stdIf.simio);
+    Ifx_Assert_setStandardIo(&g_Benchmark.stdIf.simio);
+
+    g_Benchmark.report = &g_Benchmark.stdIf.simio;
+}
+
+
+#else
+/** \brief Initialise the serial interface used for the report */
+static void Benchmark_initSerialInterface(void)
+{
+    IfxAsclin_Asc_Config config;
+
+    IfxAsclin_Asc_initModuleConfig(&config, &SHELL_ASCLIN);
+    config.baudrate.baudrate             = CFG_ASC0_BAUDRATE;
+    config.baudrate.oversampling         = IfxAsclin_OversamplingFactor_16;
+    config.bitTiming.medianFilter        = IfxAsclin_SamplesPerBit_three;
+    config.bitTiming.samplePointPosition = IfxAsclin_SamplePointPosition_8;
+    /* ISR priorities and interrupt target */
+    config.interrupt.txPriority          = ISR_PRIORITY_ASC_TX;
+    config.interrupt.rxPriority          = ISR_PRIORITY_ASC_RX;
+    config.interrupt.erPriority          = ISR_PRIORITY_ASC_EX;
+    config.interrupt.typeOfService       = ISR_PROVIDER_ASC;
+    IfxAsclin_Asc_Pins ascPins = {
+        .cts       = NULL_PTR,
+        .ctsMode   = IfxPort_InputMode_noPullDevice,
+        .rx        = &SHELL_RX,
+        .rxMode    = IfxPort_InputMode_noPullDevice,
+        .rts       = NULL_PTR,
+        .rtsMode   = IfxPort_OutputMode_pushPull,
+        .tx        = &SHELL_TX,
+        .txMode    = IfxPort_OutputMode_pushPull,
+        .pinDriver = IfxPort_PadDriver_cmosAutomotiveSpeed1
+    };
+    config.pins         = &ascPins;
+    config.rxBuffer     = g_Benchmark.ascBuffer.rx;
+    config.txBuffer     = g_Benchmark.ascBuffer.tx;
+    config.txBufferSize = CFG_ASC0_TX_BUFFER_SIZE;
+    config.rxBufferSize = CFG_ASC0_RX_BUFFER_SIZE;
+    IfxAsclin_Asc_initModule(&g_Benchmark.drivers.asc, &config);
+
+    /* Connect the standard asc interface to the device driver*/
+    IfxAsclin_Asc_stdIfDPipeInit(&g_Benchmark.stdIf.asc, &g_Benchmark.drivers.asc);
+
+    /* Ifx_Console initialisation */
+    Ifx_Console_init(&g_Benchmark.stdIf.asc);
+
+    /* Assert initialisation */
+    Ifx_Assert_setStandardIo(&g_Benchmark.stdIf.asc);
+
+    g_Benchmark.report = &g_Benchmark.stdIf.asc;
+}
+
+
+/** \brief Initialise the QSPI master used by the qspiExchange workload */
+static void Benchmark_initQspi(void)
+{
+    IfxQspi_SpiMaster_Config spiMasterConfig;
+    IfxQspi_SpiMaster_initModuleConfig(&spiMasterConfig, &MODULE_QSPI0);
+
+    spiMasterConfig.base.mode            = SpiIf_Mode_master;
+    spiMasterConfig.base.maximumBaudrate = CFG_QSPI_BAUDRATE;
+    spiMasterConfig.base.txPriority      = ISR_PRIORITY_QSPI0_TX;
+    spiMasterConfig.base.rxPriority      = ISR_PRIORITY_QSPI0_RX;
+    spiMasterConfig.base.erPriority      = ISR_PRIORITY_QSPI0_ER;
+    spiMasterConfig.base.isrProvider     = ISR_PROVIDER_QSPI0;
+
+    const IfxQspi_SpiMaster_Pins pins = {
+        &BENCH_QSPI_SCLK, IfxPort_OutputMode_pushPull,  // SCLK
+        &BENCH_QSPI_MTSR, IfxPort_OutputMode_pushPull,  // MTSR
+        &BENCH_QSPI_MRST, IfxPort_InputMode_pullDown,   // MRST
+        IfxPort_PadDriver_cmosAutomotiveSpeed3          // pad driver mode
+    };
+    spiMasterConfig.pins = &pins;
+    IfxQspi_SpiMaster_initModule(&g_Benchmark.drivers.spi, &spiMasterConfig);
+
+    IfxQspi_SpiMaster_ChannelConfig spiMasterChannelConfig;
+    IfxQspi_SpiMaster_initChannelConfig(&spiMasterChannelConfig, &g_Benchmark.drivers.spi);
+    spiMasterChannelConfig.base.baudrate = CFG_QSPI_BAUDRATE;
+
+    const IfxQspi_SpiMaster_Output slsOutput = {
+        &BENCH_QSPI_SLSO,
+        IfxPort_OutputMode_pushPull,
+        IfxPort_PadDriver_cmosAutomotiveSpeed1
+    };
+    spiMasterChannelConfig.sls.output = slsOutput;
+    IfxQspi_SpiMaster_initChannel(&g_Benchmark.drivers.spiChannel, &spiMasterChannelConfig);
+}
+
+
+/** \brief Initialise the FCE CRC-16 and CRC-32 kernels */
+static void Benchmark_initFce(void)
+{
+    IfxFce_Crc_Config    fceConfig;
+    IfxFce_Crc_CrcConfig  crcConfig;
+
+    IfxFce_Crc_initModuleConfig(&fceConfig, &MODULE_FCE0);
+    IfxFce_Crc_initModule(&g_Benchmark.drivers.fce, &fceConfig);
+
+    IfxFce_Crc_initCrcConfig(&crcConfig, &g_Benchmark.drivers.fce);
+    crcConfig.crcMode = IfxFce_CrcMode_16;
+    IfxFce_Crc_initCrc(&g_Benchmark.drivers.fceCrc16, &crcConfig);
+
+    IfxFce_Crc_initCrcConfig(&crcConfig, &g_Benchmark.drivers.fce);
+    crcConfig.crcMode = IfxFce_CrcMode_32;
+    IfxFce_Crc_initCrc(&g_Benchmark.drivers.fceCrc32, &crcConfig);
+}
+#endif
+
+
+/** \brief Measure one workload
+ * \param workload Pointer to the workload
+ * \param cold If TRUE, the program cache is invalidated and the data cache bypassed for each execution
+ * \param result Pointer to the measurement result
+ */
+static void Benchmark_measure(const Benchmark_Workload *workload, boolean cold, Benchmark_Result *result)
+{
+    uint32              run;
+    IfxCpu_PerfCounters begin;
+    IfxCpu_PerfCounters end;
+    IfxCpu_PerfCounters delta;
+
+    result->min            = 0xFFFFFFFF;
+    result->max            = 0;
+    result->clockSum       = 0;
+    result->instructionSum = 0;
+
+    if (!cold)
+    {
+        workload->function(workload->param);
+    }
+
+    for (run = 0; run < BENCHMARK_RUNS; run++)
+    {
+        if (cold)
+        {
+            IfxCpu_invalidateProgramCache();
+            IfxCpu_setDataCache(FALSE);
+        }
+
+        IfxCpu_readPerfCounters(&begin);
+        workload->function(workload->param);
+        IfxCpu_readPerfCounters(&end);
+
+        if (cold)
+        {
+            IfxCpu_setDataCache(TRUE);
+        }
+
+        IfxCpu_getPerfCountersDelta(&begin, &end, &delta);
+        result->min             = __min(result->min, delta.clock);
+        result->max             = __max(result->max, delta.clock);
+        result->clockSum       += delta.clock;
+        result->instructionSum += delta.instruction;
+    }
+}
+
+
+void Benchmark_init(void)
+{
+    uint32 i;
+
+    /** - Initialise the time constants */
+    initTime();
+
+#ifdef SIMULATION
+    /** - Initialise the simulated IO and the console */
+    Benchmark_initSimulatedIo();
+#else
+    /** - Initialise the serial interface and the console */
+    Benchmark_initSerialInterface();
+
+    /** - Initialise the measured drivers */
+    Benchmark_initQspi();
+    Benchmark_initFce();
+#endif
+
+    /** - Initialise the measured library objects and their input data */
+    Ifx_Crc_createTable(&g_Benchmark.crcTable.data, 16, 0x1021, 0);
+    Ifx_Crc_init(&g_Benchmark.crc, &g_Benchmark.crcTable.data, 1, 0, 0xFFFF, 0);
+
+    g_Benchmark.fifo = Ifx_Fifo_init(Benchmark_fifoBuffer, BENCHMARK_FIFO_SIZE, 1);
+
+    Ifx_LutSincosF32_init();
+    Ifx_LutAtan2F32_init();
+    Ifx_LutSincosF32_initTable(&Benchmark_sincos10);
+    Ifx_LutSincosF32_initTable(&Benchmark_sincos8);
+    Ifx_LutAtan2F32_initTable(&Benchmark_atan2);
+
+    for (i = 0; i < BENCHMARK_FFT_MAX_SIZE; i++)
+    {
+        Benchmark_fftIn[i].real = Ifx_LutSincosF32_sin((Ifx_Lut_FxpAngle)(i * 3));
+        Benchmark_fftIn[i].imag = 0.0;
+    }
+
+    Ifx_FftF32_generateTwiddleFactor(Benchmark_fftTwiddle, BENCHMARK_FFT_TWIDDLE_SIZE);
+    Ifx_FftFxp_generateTwiddleFactorQ15(Benchmark_fftQ15Twiddle, BENCHMARK_FFT_TWIDDLE_SIZE);
+
+    for (i = 0; i < BENCHMARK_FFT_TWIDDLE_SIZE; i++)
+    {   /* 12-bit ADC results around 0x800 */
+        Benchmark_fftQ15In[i]  = (sint16)(0x800 + (sint32)(Benchmark_fftIn[i].real * 0x7FF));
+        Benchmark_fftRealIn[i] = Benchmark_fftIn[i].real;
+    }
+
+    for (i = 0; i < BENCHMARK_SVM_SIZE; i++)
+    {   /* One electrical revolution, the magnitude sweeps into the over-modulation range */
+        cfloat32 v = Ifx_LutSincosF32_cossin((Ifx_Lut_FxpAngle)(i * (IFX_LUT_ANGLE_RESOLUTION / BENCHMARK_SVM_SIZE)));
+        float32  r = 0.4f + ((0.3f * (float32)i) / BENCHMARK_SVM_SIZE);
+
+        Benchmark_svmIn[i].real    = r * v.real;
+        Benchmark_svmIn[i].imag    = r * v.imag;
+        Benchmark_svmQ15In[i].real = (sint16)(Benchmark_svmIn[i].real * 0x7FFF);
+        Benchmark_svmQ15In[i].imag = (sint16)(Benchmark_svmIn[i].imag * 0x7FFF);
+    }
+
+    for (i = 0; i < BENCHMARK_VEC_SIZE; i++)
+    {   /* Spectrum like input, the window is a Hann window */
+        Benchmark_vecIn[i]     = Benchmark_svmIn[(i * 7) % BENCHMARK_SVM_SIZE];
+        Benchmark_vecWork[i]   = Benchmark_vecIn[i];
+        Benchmark_vecRealIn[i] = Benchmark_vecIn[i].real;
+        Benchmark_vecQ15In[i]  = Benchmark_svmQ15In[(i * 7) % BENCHMARK_SVM_SIZE].real;
+        Benchmark_vecWindow[i] = 0.5f - (0.5f * Ifx_LutSincosF32_cos((Ifx_Lut_FxpAngle)(i * (IFX_LUT_ANGLE_RESOLUTION / BENCHMARK_VEC_SIZE))));
+    }
+
+    for (i = 0; i < (BENCHMARK_DATA_SIZE / 4); i++)
+    {
+        Benchmark_data[i] = i * 0x9E3779B9;
+    }
+
+    for (i = 0; i < BENCHMARK_QSPI_MAX_SIZE; i++)
+    {
+        Benchmark_spiTx[i] = (uint8)i;
+    }
+
+    /** - Start the performance counters of CPU0 */
+    IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+
+    g_Benchmark.runRequested = TRUE;
+}
+
+
+void Benchmark_run(void)
+{
+    IfxStdIf_DPipe  *io = g_Benchmark.report;
+    Benchmark_Result result;
+    uint32           i;
+    uint32           cold;
+
+    if (IfxStdIf_DPipe_getReadCount(io) > 0)
+    {
+        IfxStdIf_DPipe_clearRx(io);
+        g_Benchmark.runRequested = TRUE;
+    }
+
+    if (g_Benchmark.runRequested)
+    {
+        g_Benchmark.runRequested = FALSE;
+
+        IfxStdIf_DPipe_print(io, "BENCH_BEGIN,%u,%u"ENDL, (uint32)g_AppCpu0.info.cpuFreq, BENCHMARK_RUNS);
+        Benchmark_checkVector(io);
+
+        for (i = 0; i < sizeof(Benchmark_workloads) / sizeof(Benchmark_workloads[0]); i++)
+        {
+            for (cold = 0; cold < 2; cold++)
+            {
+                IfxStdIf_DPipe_flushTx(io, BENCHMARK_FLUSH_TIMEOUT);
+                Benchmark_measure(&Benchmark_workloads[i], cold != 0, &result);
+                IfxStdIf_DPipe_print(io, "BENCH,%s,%u,%s,%u,%u,%u,%u,%u"ENDL,
+                    Benchmark_workloads[i].name, Benchmark_workloads[i].param, cold ? "cold" : "warm",
+                    BENCHMARK_RUNS, result.min, result.max,
+                    (uint32)(result.clockSum / BENCHMARK_RUNS), (uint32)(result.instructionSum / BENCHMARK_RUNS));
+            }
+        }
+
+        IfxStdIf_DPipe_print(io, "BENCH_END"ENDL);
+    }
+}
@@ -0,0 +1,162 @@
+/**
+ * \file Benchmark.h
+ * \brief Cycle count benchmark of iLLD and SysSe routines
+ *
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup App_Benchmark_SrcDoc_Main Benchmark
+ * \ingroup App_Benchmark_SrcDoc
+ *
+ * Each workload of the benchmark table is executed BENCHMARK_RUNS times on CPU0 and measured
+ * with the CPU clock (CCNT) and instruction (ICNT) counters:
+ * - warm: after one unmeasured execution, program and data caches enabled
+ * - cold: program cache invalidated before each execution, data cache bypassed
+ *
+ * The ASC output is flushed before each measurement, no other interrupt than the one of the
+ * measured peripheral (QSPI) is active while measuring.
+ *
+ * The report is printed on the shell ASCLIN, one line per workload and cache state:
+ * \code
+ * BENCH_BEGIN,<cpu frequency Hz>,<runs>
+ * BENCH_CHECK,<function>,<pass|fail>
+ * BENCH,<workload>,<parameter>,<warm|cold>,<runs>,<min cycles>,<max cycles>,<mean cycles>,<mean instructions>
+ * BENCH_END
+ * \endcode
+ * The BENCH_CHECK lines compare the unrolled (xxxFast) and Q15 vector functions with the scalar
+ * reference functions of Ifx_Cf32 before the measurements.
+ * The "empty" workload is the measurement overhead. The report is printed again when a character
+ * is received.
+ *
+ * In the SIMULATION build, the report is written through the simulated IO (simio) of the instruction set
+ * simulator, and the workloads of the peripherals which are not simulated (FCE, QSPI) are not executed. The
+ * instruction counts of a simulator run do not depend on the memory timing model and are compared between two
+ * library versions without hardware.
+ *
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include <Ifx_Types.h>
+#include "Configuration.h"
+#include "Asclin/Asc/IfxAsclin_Asc.h"
+#include "Qspi/SpiMaster/IfxQspi_SpiMaster.h"
+#include "Fce/Crc/IfxFce_Crc.h"
+#include "SysSe/Math/Ifx_Crc.h"
+#include "StdIf/IfxStdIf_DPipe.h"
+#include "SysSe/Comm/Ifx_SimioPipe.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+#define BENCHMARK_RUNS             (16)             /**< \brief Number of measured executions per workload and cache state */
+#define BENCHMARK_FFT_MAX_SIZE     (4096)           /**< \brief Largest FFT length */
+#define BENCHMARK_FFT_TWIDDLE_SIZE (1024)           /**< \brief FFT length of the pre-computed twiddle factor table */
+#define BENCHMARK_DATA_SIZE        (1024)           /**< \brief Size in bytes of the CRC input data */
+#define BENCHMARK_FIFO_SIZE        (256)            /**< \brief Size in bytes of the FIFO */
+#define BENCHMARK_QSPI_MAX_SIZE    (256)            /**< \brief Largest QSPI exchange in bytes */
+#define BENCHMARK_SVM_SIZE         (256)            /**< \brief Number of voltage vectors per space vector modulation workload */
+#define BENCHMARK_SVM_PERIOD       (5000)           /**< \brief PWM period in ticks of the space vector modulation workloads */
+#define BENCHMARK_VEC_SIZE         (256)            /**< \brief Number of elements of the vector library workloads */
+
+/******************************************************************************/
+/*------------------------------Type Definitions------------------------------*/
+/******************************************************************************/
+
+/** \brief Workload function
+ * \param param workload parameter, e.g. FFT length or number of bytes
+ */
+typedef void (*Benchmark_Function)(uint32 param);
+
+/** \brief Benchmark table entry */
+typedef struct
+{
+    pchar              name;            /**< \brief workload name, printed in the report */
+    Benchmark_Function function;        /**< \brief workload function */
+    uint32             param;           /**< \brief workload parameter */
+} Benchmark_Workload;
+
+/** \brief Measurement result of one workload and cache state */
+typedef struct
+{
+    uint32 min;                         /**< \brief minimal cycles */
+    uint32 max;                         /**< \brief maximal cycles */
+    uint64 clockSum;                    /**< \brief sum of the cycles */
+    uint64 instructionSum;              /**< \brief sum of the instructions */
+} Benchmark_Result;
+
+/** \brief ASC interface buffers */
+typedef struct
+{
+    uint8 tx[CFG_ASC0_TX_BUFFER_SIZE + sizeof(Ifx_Fifo) + 8];
+    uint8 rx[CFG_ASC0_RX_BUFFER_SIZE + sizeof(Ifx_Fifo) + 8];
+} Benchmark_AscBuffer;
+
+/** \brief Benchmark application data */
+typedef struct
+{
+    Benchmark_AscBuffer ascBuffer;              /**< \brief ASC interface buffer */
+    struct
+    {
+        IfxAsclin_Asc             asc;          /**< \brief ASC interface */
+        IfxQspi_SpiMaster         spi;          /**< \brief QSPI master */
+        IfxQspi_SpiMaster_Channel spiChannel;   /**< \brief QSPI master channel */
+        IfxFce_Crc                fce;          /**< \brief FCE module */
+        IfxFce_Crc_Crc            fceCrc16;     /**< \brief FCE CRC-16 kernel */
+        IfxFce_Crc_Crc            fceCrc32;     /**< \brief FCE CRC-32 kernel */
+#ifdef SIMULATION
+        Ifx_SimioPipe             simio;        /**< \brief simulated IO */
+#endif
+    }                   drivers;
+    struct
+    {
+        IfxStdIf_DPipe asc;                     /**< \brief ASC standard interface */
+#ifdef SIMULATION
+        IfxStdIf_DPipe simio;                   /**< \brief simulated IO standard interface */
+#endif
+    }                   stdIf;
+    IfxStdIf_DPipe     *report;                 /**< \brief Standard interface of the report: ASC, simulated IO in the SIMULATION build */
+    Ifc_Crc_Table16     crcTable;               /**< \brief CRC-16 CCITT table */
+    Ifc_Crc             crc;                    /**< \brief CRC-16 CCITT driver */
+    Ifx_Fifo           *fifo;                   /**< \brief FIFO under test */
+    boolean             runRequested;           /**< \brief If TRUE, the report is printed by \ref Benchmark_run() */
+    volatile uint32     sink;                   /**< \brief Workload results, prevents the removal of the computations */
+} App_Benchmark;
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+
+IFX_EXTERN App_Benchmark g_Benchmark;
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+
+/** \brief Initialise the ASC output, the measured drivers and the performance counters */
+IFX_EXTERN void Benchmark_init(void);
+
+/** \brief Measure all workloads and print the report if requested */
+IFX_EXTERN void Benchmark_run(void);
+
+#endif
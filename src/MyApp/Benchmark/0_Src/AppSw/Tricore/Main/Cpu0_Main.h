@@ -0,0 +1,66 @@
+/**
+ * \file Cpu0_Main.h
+ * \brief System initialization and main program implementation.
+ *
+ * \version iLLD_Demos_1_0_1_4_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup App_Benchmark_SrcDoc Source code documentation
+ * \ingroup App_Benchmark
+ *
+ */
+
+#ifndef CPU0_MAIN_H
+#define CPU0_MAIN_H
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "Configuration.h"
+
+#include "Cpu/Std/Ifx_Types.h"
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*------------------------------Type Definitions------------------------------*/
+/******************************************************************************/
+
+typedef struct
+{
+    float32 sysFreq;                /**< \brief Actual SPB frequency */
+    float32 cpuFreq;                /**< \brief Actual CPU frequency */
+    float32 pllFreq;                /**< \brief Actual PLL frequency */
+    float32 stmFreq;                /**< \brief Actual STM frequency */
+} AppInfo;
+
+/** \brief Application information */
+typedef struct
+{
+    AppInfo info;                               /**< \brief Info object */
+} App_Cpu0;
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+
+IFX_EXTERN App_Cpu0 g_AppCpu0;
+
+#endif
@@ -0,0 +1,52 @@
+/**
+ * \file Ifx_Cfg.h
+ * \brief Configuration.
+ *
+ * \version iLLD_Demos_1_0_1_4_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ *
+ *
+ * \defgroup App_HostBench_SrcDoc_IlldConfig iLLD configuration
+ * \ingroup App_HostBench_SrcDoc
+ */
+
+#ifndef IFX_CFG_H
+#define IFX_CFG_H
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \addtogroup App_HostBench_SrcDoc_IlldConfig
+ * \{ */
+
+/*______________________________________________________________________________
+** Configuration for Ifx_Fifo.h
+**____________________________________________________________________________*/
+/**
+ * \name FIFO configuration
+ * \{
+ */
+#define CFG_LONG_SIZE_T (0)                                         /**< \brief Ifx_SizeT on 16 bit, as in the target build */
+
+/** \} */
+
+/** \} */
+
+#endif /* IFX_CFG_H */
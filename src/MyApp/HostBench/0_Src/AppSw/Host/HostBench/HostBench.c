@@ -0,0 +1,648 @@
+/**
+ * \file HostBench.c
+ * \brief Host benchmark and golden output test of the SysSe Math and DataHandling modules
+ *
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "HostBench.h"
+#include "SysSe/Bsp/Bsp.h"
+#include "SysSe/Math/Ifx_Cf32.h"
+#include "SysSe/Math/Ifx_FftF32.h"
+#include "SysSe/Math/Ifx_LutSincosF32.h"
+#include "SysSe/Math/Ifx_LutAtan2F32.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+#define HOSTBENCH_FFT_TOLERANCE  (1.0e-5)           /**< \brief Maximal FFT error against the DFT, relative to the largest bin */
+#define HOSTBENCH_LUT_TOLERANCE  (1.0e-6)           /**< \brief Maximal error of the full resolution sin table */
+#define HOSTBENCH_VEC_TOLERANCE  (1.0e-5)           /**< \brief Relative tolerance of the unrolled vector functions against the reference */
+#define HOSTBENCH_CHECK_STRING   "123456789"        /**< \brief Input of the CRC check values */
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+
+App_HostBench g_HostBench; /**< \brief Host benchmark information */
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+
+/* Static data only: the library casts pointers to uint32, see IfxLld_Platform_Host */
+static cfloat32 HostBench_fftIn[HOSTBENCH_FFT_MAX_SIZE];
+static cfloat32 HostBench_fftOut[HOSTBENCH_FFT_MAX_SIZE];
+static cfloat32 HostBench_fftTwiddle[HOSTBENCH_FFT_MAX_SIZE / 2];
+static float32  HostBench_fftRealIn[HOSTBENCH_FFT_MAX_SIZE];
+static uint32   HostBench_data[HOSTBENCH_DATA_SIZE / 4];
+static uint8    HostBench_fifoBuffer[HOSTBENCH_FIFO_SIZE + sizeof(Ifx_Fifo) + 8];
+static uint8    HostBench_fifoRx[HOSTBENCH_FIFO_SIZE];
+static cfloat32 HostBench_vecIn[HOSTBENCH_VEC_SIZE];
+static cfloat32 HostBench_vecWork[HOSTBENCH_VEC_SIZE];
+static float32  HostBench_vecRealIn[HOSTBENCH_VEC_SIZE];
+static float32  HostBench_vecRef[HOSTBENCH_VEC_SIZE];
+static const cfloat32 HostBench_vecRotation = {0.6f, 0.8f};
+
+IFX_LUTSINCOSF32_TABLE(HostBench_sincos10, 10);
+IFX_LUTSINCOSF32_TABLE(HostBench_sincos8, 8);
+IFX_LUTATAN2F32_TABLE(HostBench_atan2, 64);
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+
+static void HostBench_empty(uint32 param);
+static void HostBench_fftRadix2(uint32 param);
+static void HostBench_fftRadix4(uint32 param);
+static void HostBench_fftRadix4Twiddle(uint32 param);
+static void HostBench_fftReal(uint32 param);
+static void HostBench_crcBitByBit(uint32 param);
+static void HostBench_crcTable(uint32 param);
+static void HostBench_crcTableFast(uint32 param);
+static void HostBench_crc16Slicing4(uint32 param);
+static void HostBench_crc32Slicing8(uint32 param);
+static void HostBench_fifo(uint32 param);
+static void HostBench_lutSincos(uint32 param);
+static void HostBench_lutSincosTable(uint32 param);
+static void HostBench_lutSincosInterpolated(uint32 param);
+static void HostBench_lutAtan2(uint32 param);
+static void HostBench_lutAtan2Interpolated(uint32 param);
+static void HostBench_cplxVecMag(uint32 param);
+static void HostBench_cplxVecMagFast(uint32 param);
+static void HostBench_cplxVecMul(uint32 param);
+static void HostBench_cplxVecMulFast(uint32 param);
+static void HostBench_vecSum(uint32 param);
+static void HostBench_vecSumFast(uint32 param);
+
+/** \brief Benchmark table */
+static const HostBench_Workload HostBench_workloads[] = {
+    {"empty",          &HostBench_empty,                 0                     },
+    {"fftRadix2",      &HostBench_fftRadix2,             64                    },
+    {"fftRadix2",      &HostBench_fftRadix2,             256                   },
+    {"fftRadix2",      &HostBench_fftRadix2,             1024                  },
+    {"fftRadix2",      &HostBench_fftRadix2,             4096                  },
+    {"fftRadix4",      &HostBench_fftRadix4,             64                    },
+    {"fftRadix4",      &HostBench_fftRadix4,             256                   },
+    {"fftRadix4",      &HostBench_fftRadix4,             1024                  },
+    {"fftRadix4",      &HostBench_fftRadix4,             4096                  },
+    {"fftRadix4Tw",    &HostBench_fftRadix4Twiddle,      HOSTBENCH_FFT_MAX_SIZE},
+    {"fftReal",        &HostBench_fftReal,               HOSTBENCH_FFT_MAX_SIZE},
+    {"crcBitByBit",    &HostBench_crcBitByBit,           HOSTBENCH_DATA_SIZE   },
+    {"crcTable",       &HostBench_crcTable,              HOSTBENCH_DATA_SIZE   },
+    {"crcTableFast",   &HostBench_crcTableFast,          HOSTBENCH_DATA_SIZE   },
+    {"crc16Slicing4",  &HostBench_crc16Slicing4,         HOSTBENCH_DATA_SIZE   },
+    {"crc32Slicing8",  &HostBench_crc32Slicing8,         HOSTBENCH_DATA_SIZE   },
+    {"fifoWriteRead",  &HostBench_fifo,                  16                    },
+    {"fifoWriteRead",  &HostBench_fifo,                  HOSTBENCH_FIFO_SIZE   },
+    {"lutSincos",      &HostBench_lutSincos,             256                   },
+    {"lutSincos10",    &HostBench_lutSincosTable,        256                   },
+    {"lutSincosInt8",  &HostBench_lutSincosInterpolated, 256                   },
+    {"lutAtan2",       &HostBench_lutAtan2,              256                   },
+    {"lutAtan2Int64",  &HostBench_lutAtan2Interpolated,  256                   },
+    {"cplxVecMag",     &HostBench_cplxVecMag,            HOSTBENCH_VEC_SIZE    },
+    {"cplxVecMagFast", &HostBench_cplxVecMagFast,        HOSTBENCH_VEC_SIZE    },
+    {"cplxVecMul",     &HostBench_cplxVecMul,            HOSTBENCH_VEC_SIZE    },
+    {"cplxVecMulFast", &HostBench_cplxVecMulFast,        HOSTBENCH_VEC_SIZE    },
+    {"vecSum",         &HostBench_vecSum,                HOSTBENCH_VEC_SIZE    },
+    {"vecSumFast",     &HostBench_vecSumFast,            HOSTBENCH_VEC_SIZE    },
+};
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+/** \name Workloads
+ * \{ */
+
+static void HostBench_empty(uint32 param)
+{
+    (void)param;
+}
+
+
+static void HostBench_fftRadix2(uint32 param)
+{
+    Ifx_FftF32_radix2(HostBench_fftOut, HostBench_fftIn, (uint16)param);
+}
+
+
+static void HostBench_fftRadix4(uint32 param)
+{
+    Ifx_FftF32_radix4(HostBench_fftOut, HostBench_fftIn, (uint16)param, NULL_PTR);
+}
+
+
+static void HostBench_fftRadix4Twiddle(uint32 param)
+{
+    Ifx_FftF32_radix4(HostBench_fftOut, HostBench_fftIn, (uint16)param, HostBench_fftTwiddle);
+}
+
+
+static void HostBench_fftReal(uint32 param)
+{
+    Ifx_FftF32_real(HostBench_fftOut, HostBench_fftRealIn, (uint16)param, HostBench_fftTwiddle);
+}
+
+
+static void HostBench_crcBitByBit(uint32 param)
+{
+    g_HostBench.sink = Ifx_Crc_bitByBit(&g_HostBench.crc, (uint8 *)HostBench_data, param);
+}
+
+
+static void HostBench_crcTable(uint32 param)
+{
+    g_HostBench.sink = Ifx_Crc_table(&g_HostBench.crc, (uint8 *)HostBench_data, param);
+}
+
+
+static void HostBench_crcTableFast(uint32 param)
+{
+    g_HostBench.sink = Ifx_Crc_tableFast(&g_HostBench.crc, (uint8 *)HostBench_data, param);
+}
+
+
+static void HostBench_crc16Slicing4(uint32 param)
+{
+    g_HostBench.sink = Ifx_Crc_crc16Ccitt(IFX_CRC_CRC16CCITT_INIT, (const uint8 *)HostBench_data, param);
+}
+
+
+static void HostBench_crc32Slicing8(uint32 param)
+{
+    g_HostBench.sink = Ifx_Crc_crc32(IFX_CRC_CRC32_INIT, (const uint8 *)HostBench_data, param);
+}
+
+
+static void HostBench_fifo(uint32 param)
+{
+    Ifx_SizeT remaining;
+
+    remaining        = Ifx_Fifo_write(g_HostBench.fifo, HostBench_data, (Ifx_SizeT)param, 0);
+    remaining       += Ifx_Fifo_read(g_HostBench.fifo, HostBench_fifoRx, (Ifx_SizeT)param, 0);
+    g_HostBench.sink = (uint32)remaining;
+}
+
+
+static void HostBench_lutSincos(uint32 param)
+{
+    uint32  i;
+    float32 sum = 0.0;
+
+    for (i = 0; i < param; i++)
+    {
+        sum += Ifx_LutSincosF32_sin((Ifx_Lut_FxpAngle)(i * (IFX_LUT_ANGLE_RESOLUTION / param)));
+    }
+
+    g_HostBench.sink = (uint32)sum;
+}
+
+
+static void HostBench_lutSincosTable(uint32 param)
+{
+    uint32  i;
+    float32 sum = 0.0;
+
+    for (i = 0; i < param; i++)
+    {
+        sum += Ifx_LutSincosF32_sinTable(&HostBench_sincos10, (Ifx_Lut_FxpAngle)(i * (IFX_LUT_ANGLE_RESOLUTION / param)));
+    }
+
+    g_HostBench.sink = (uint32)sum;
+}
+
+
+static void HostBench_lutSincosInterpolated(uint32 param)
+{
+    uint32  i;
+    float32 sum = 0.0;
+
+    for (i = 0; i < param; i++)
+    {
+        sum += Ifx_LutSincosF32_sinInterpolated(&HostBench_sincos8, (Ifx_Lut_FxpAngle)(i * (IFX_LUT_ANGLE_RESOLUTION / param)));
+    }
+
+    g_HostBench.sink = (uint32)sum;
+}
+
+
+static void HostBench_lutAtan2(uint32 param)
+{
+    uint32  i;
+    float32 sum = 0.0;
+
+    for (i = 0; i < param; i++)
+    {
+        sum += Ifx_LutAtan2F32_float32((float32)i - (float32)(param / 2), 100.0);
+    }
+
+    g_HostBench.sink = (uint32)sum;
+}
+
+
+static void HostBench_lutAtan2Interpolated(uint32 param)
+{
+    uint32  i;
+    float32 sum = 0.0;
+
+    for (i = 0; i < param; i++)
+    {
+        sum += Ifx_LutAtan2F32_float32Interpolated(&HostBench_atan2, (float32)i - (float32)(param / 2), 100.0);
+    }
+
+    g_HostBench.sink = (uint32)sum;
+}
+
+
+static void HostBench_cplxVecMag(uint32 param)
+{
+    CplxVecCpy_f32(HostBench_vecWork, HostBench_vecIn, (short)param);
+    g_HostBench.sink = (uint32)CplxVecMag_f32(HostBench_vecWork, (short)param)[0];
+}
+
+
+static void HostBench_cplxVecMagFast(uint32 param)
+{
+    CplxVecCpy_f32(HostBench_vecWork, HostBench_vecIn, (short)param);
+    g_HostBench.sink = (uint32)CplxVecMag_f32Fast(HostBench_vecWork, (short)param)[0];
+}
+
+
+static void HostBench_cplxVecMul(uint32 param)
+{
+    CplxVecMul_f32(HostBench_vecWork, &HostBench_vecRotation, (short)param);
+}
+
+
+static void HostBench_cplxVecMulFast(uint32 param)
+{
+    CplxVecMul_f32Fast(HostBench_vecWork, &HostBench_vecRotation, (short)param);
+}
+
+
+static void HostBench_vecSum(uint32 param)
+{
+    g_HostBench.sink = (uint32)VecSum_f32(HostBench_vecRealIn, (short)param);
+}
+
+
+static void HostBench_vecSumFast(uint32 param)
+{
+    g_HostBench.sink = (uint32)VecSum_f32Fast(HostBench_vecRealIn, (short)param);
+}
+
+
+/** \} */
+
+/** \name Golden output checks
+ * \{ */
+
+/** \brief Print the result of a check and count the failures
+ * \param name checked function
+ * \param pass TRUE if the check passed
+ * \param error largest error found, 0 for the exact checks
+ */
+static void HostBench_report(pchar name, boolean pass, float64 error)
+{
+    printf("BENCH_CHECK,%s,%s,%.3g\n", name, pass ? "pass" : "fail", error);
+
+    if (!pass)
+    {
+        g_HostBench.failCount++;
+    }
+}
+
+
+/** \brief Largest error of the FFT output against the DFT of HostBench_fftIn, relative to the largest bin
+ * \param R FFT output
+ * \param nX transform length
+ * \param nR number of bins compared
+ * \param realInput If TRUE, the imaginary part of the input is ignored (real FFT)
+ */
+static float64 HostBench_fftError(const cfloat32 *R, uint32 nX, uint32 nR, boolean realInput)
+{
+    float64 maxError = 0.0;
+    float64 maxBin   = 0.0;
+    uint32  k;
+    uint32  n;
+
+    for (k = 0; k < nR; k++)
+    {
+        float64 re = 0.0;
+        float64 im = 0.0;
+
+        for (n = 0; n < nX; n++)
+        {
+            float64 a   = (-2.0 * M_PI * (float64)((k * n) % nX)) / (float64)nX;
+            float64 xRe = realInput ? HostBench_fftRealIn[n] : HostBench_fftIn[n].real;
+            float64 xIm = realInput ? 0.0 : HostBench_fftIn[n].imag;
+
+            re += (xRe * cos(a)) - (xIm * sin(a));
+            im += (xRe * sin(a)) + (xIm * cos(a));
+        }
+
+        maxBin   = fmax(maxBin, hypot(re, im));
+        maxError = fmax(maxError, hypot(re - R[k].real, im - R[k].imag));
+    }
+
+    return maxError / maxBin;
+}
+
+
+static void HostBench_checkFft(void)
+{
+    const uint32 n = HOSTBENCH_FFT_DFT_SIZE;
+    float64      error;
+
+    Ifx_FftF32_radix2(HostBench_fftOut, HostBench_fftIn, (uint16)n);
+    error = HostBench_fftError(HostBench_fftOut, n, n, FALSE);
+    HostBench_report("Ifx_FftF32_radix2", error < HOSTBENCH_FFT_TOLERANCE, error);
+
+    Ifx_FftF32_radix4(HostBench_fftOut, HostBench_fftIn, (uint16)n, NULL_PTR);
+    error = HostBench_fftError(HostBench_fftOut, n, n, FALSE);
+    HostBench_report("Ifx_FftF32_radix4", error < HOSTBENCH_FFT_TOLERANCE, error);
+
+    Ifx_FftF32_generateTwiddleFactor(HostBench_fftTwiddle, (sint16)n);
+    Ifx_FftF32_radix4(HostBench_fftOut, HostBench_fftIn, (uint16)n, HostBench_fftTwiddle);
+    error = HostBench_fftError(HostBench_fftOut, n, n, FALSE);
+    HostBench_report("Ifx_FftF32_radix4Tw", error < HOSTBENCH_FFT_TOLERANCE, error);
+
+    /* Radix-4 with a length which is not a power of 4 */
+    Ifx_FftF32_radix4(HostBench_fftOut, HostBench_fftIn, (uint16)(n / 2), NULL_PTR);
+    error = HostBench_fftError(HostBench_fftOut, n / 2, n / 2, FALSE);
+    HostBench_report("Ifx_FftF32_radix4Odd", error < HOSTBENCH_FFT_TOLERANCE, error);
+
+    Ifx_FftF32_real(HostBench_fftOut, HostBench_fftRealIn, (uint16)n, HostBench_fftTwiddle);
+    error = HostBench_fftError(HostBench_fftOut, n, (n / 2) + 1, TRUE);
+    HostBench_report("Ifx_FftF32_real", error < HOSTBENCH_FFT_TOLERANCE, error);
+
+    /* Restore the twiddle factors of the workloads */
+    Ifx_FftF32_generateTwiddleFactor(HostBench_fftTwiddle, HOSTBENCH_FFT_MAX_SIZE);
+}
+
+
+static void HostBench_checkCrc(void)
+{
+    const uint8 *check  = (const uint8 *)HOSTBENCH_CHECK_STRING;
+    uint32       length = (uint32)strlen(HOSTBENCH_CHECK_STRING);
+    uint8        copy[sizeof(HOSTBENCH_CHECK_STRING)];
+    uint32       split;
+    boolean      pass;
+
+    memcpy(copy, check, sizeof(copy));
+
+    /* Check values of the CRC catalogue */
+    HostBench_report("Ifx_Crc_crc32", Ifx_Crc_crc32(IFX_CRC_CRC32_INIT, check, length) == 0xCBF43926u, 0.0);
+    HostBench_report("Ifx_Crc_crc32c", Ifx_Crc_crc32c(IFX_CRC_CRC32_INIT, check, length) == 0xE3069283u, 0.0);
+    HostBench_report("Ifx_Crc_crc16Ccitt", Ifx_Crc_crc16Ccitt(IFX_CRC_CRC16CCITT_INIT, check, length) == 0x29B1u, 0.0);
+    HostBench_report("Ifx_Crc_crc8SaeJ1850", Ifx_Crc_crc8SaeJ1850(IFX_CRC_CRC8SAEJ1850_INIT, check, length) == 0x4Bu, 0.0);
+    HostBench_report("Ifx_Crc_bitByBit", Ifx_Crc_bitByBit(&g_HostBench.crc, copy, length) == 0x29B1u, 0.0);
+    HostBench_report("Ifx_Crc_table", Ifx_Crc_table(&g_HostBench.crc, copy, length) == 0x29B1u, 0.0);
+    HostBench_report("Ifx_Crc_tableFast", Ifx_Crc_tableFast(&g_HostBench.crc, copy, length) == 0x29B1u, 0.0);
+
+    /* Slicing kernels against the byte wise table on all alignments and tail lengths */
+    pass = TRUE;
+
+    for (split = 0; split < 16; split++)
+    {
+        const uint8 *data = (const uint8 *)HostBench_data + split;
+        uint32       size = HOSTBENCH_DATA_SIZE - 16 - split;
+        uint32       crc  = Ifx_Crc_crc32(IFX_CRC_CRC32_INIT, data, split);
+
+        pass &= Ifx_Crc_crc32(crc, data + split, size - split) == Ifx_Crc_crc32(IFX_CRC_CRC32_INIT, data, size);
+        pass &= Ifx_Crc_crc16Ccitt(IFX_CRC_CRC16CCITT_INIT, data, size) == Ifx_Crc_table(&g_HostBench.crc, (uint8 *)data, size);
+    }
+
+    HostBench_report("Ifx_Crc_slicing", pass, 0.0);
+}
+
+
+static void HostBench_checkLut(void)
+{
+    float64          sinError  = 0.0;
+    float64          sin8Error = 0.0;
+    float64          atanError = 0.0;
+    float64          atan64Error = 0.0;
+    Ifx_Lut_FxpAngle a;
+    sint32           i;
+
+    for (a = 0; a < IFX_LUT_ANGLE_RESOLUTION; a++)
+    {
+        float64 ref = sin((2.0 * M_PI * a) / IFX_LUT_ANGLE_RESOLUTION);
+
+        sinError  = fmax(sinError, fabs(Ifx_LutSincosF32_sin(a) - ref));
+        sin8Error = fmax(sin8Error, fabs(Ifx_LutSincosF32_sinInterpolated(&HostBench_sincos8, a) - ref));
+    }
+
+    for (i = -1000; i <= 1000; i++)
+    {   /* Circle of radius 100 crossed in all quadrants */
+        float64 y   = 100.0 * sin((M_PI * i) / 1000.0);
+        float64 x   = 100.0 * cos((M_PI * i) / 1000.0);
+        float64 ref = atan2(y, x);
+        float64 e   = fabs(remainder(Ifx_LutAtan2F32_float32((float32)y, (float32)x) - ref, 2.0 * M_PI));
+        float64 e64 = fabs(remainder(Ifx_LutAtan2F32_float32Interpolated(&HostBench_atan2, (float32)y, (float32)x) - ref, 2.0 * M_PI));
+
+        atanError   = fmax(atanError, e);
+        atan64Error = fmax(atan64Error, e64);
+    }
+
+    HostBench_report("Ifx_LutSincosF32_sin", sinError < HOSTBENCH_LUT_TOLERANCE, sinError);
+    /* Linear interpolation: (pi / 2^bits)^2 / 2 */
+    HostBench_report("Ifx_LutSincosF32_sinInterpolated", sin8Error < 8.0e-5, sin8Error);
+    /* Table of IFX_LUTATAN2F32_SIZE entries on atan(0 .. 1), rounded to the nearest entry */
+    HostBench_report("Ifx_LutAtan2F32_float32", atanError < (1.0 / IFX_LUTATAN2F32_SIZE), atanError);
+    HostBench_report("Ifx_LutAtan2F32_float32Interpolated", atan64Error < 1.0e-4, atan64Error);
+}
+
+
+static void HostBench_checkFifo(void)
+{
+    const uint8 *tx   = (const uint8 *)HostBench_data;
+    boolean      pass = TRUE;
+    uint32       offset;
+    uint32       chunk;
+
+    Ifx_Fifo_clear(g_HostBench.fifo);
+
+    /* Chunks of all sizes, the read and write indexes wrap around at all positions */
+    for (offset = 0, chunk = 1; chunk < HOSTBENCH_FIFO_SIZE; chunk += 7)
+    {
+        memset(HostBench_fifoRx, 0, sizeof(HostBench_fifoRx));
+        pass  &= Ifx_Fifo_write(g_HostBench.fifo, &tx[offset], (Ifx_SizeT)chunk, 0) == 0;
+        pass  &= Ifx_Fifo_read(g_HostBench.fifo, HostBench_fifoRx, (Ifx_SizeT)chunk, 0) == 0;
+        pass  &= memcmp(HostBench_fifoRx, &tx[offset], chunk) == 0;
+        offset = (offset + chunk) % (HOSTBENCH_DATA_SIZE - HOSTBENCH_FIFO_SIZE);
+    }
+
+    /* Full and empty FIFO: the elements which do not fit are returned */
+    pass &= Ifx_Fifo_write(g_HostBench.fifo, tx, HOSTBENCH_FIFO_SIZE + 1, 0) == 1;
+    pass &= Ifx_Fifo_read(g_HostBench.fifo, HostBench_fifoRx, HOSTBENCH_FIFO_SIZE + 1, 0) == 1;
+    pass &= memcmp(HostBench_fifoRx, tx, HOSTBENCH_FIFO_SIZE) == 0;
+
+    HostBench_report("Ifx_Fifo", pass, 0.0);
+}
+
+
+/** \brief Largest relative error of a vector against the reference */
+static float64 HostBench_vectorError(const float32 *x, const float32 *ref, uint32 n)
+{
+    float64 error = 0.0;
+    uint32  i;
+
+    for (i = 0; i < n; i++)
+    {
+        error = fmax(error, fabs(x[i] - ref[i]) / fmax(fabs(ref[i]), 1.0));
+    }
+
+    return error;
+}
+
+
+static void HostBench_checkVector(void)
+{
+    const short n = HOSTBENCH_VEC_SIZE;
+    float64     error;
+
+    CplxVecCpy_f32(HostBench_vecWork, HostBench_vecIn, n);
+    memcpy(HostBench_vecRef, CplxVecMag_f32(HostBench_vecWork, n), n * sizeof(float32));
+    CplxVecCpy_f32(HostBench_vecWork, HostBench_vecIn, n);
+    error = HostBench_vectorError(CplxVecMag_f32Fast(HostBench_vecWork, n), HostBench_vecRef, n);
+    HostBench_report("CplxVecMag_f32Fast", error < HOSTBENCH_VEC_TOLERANCE, error);
+
+    CplxVecCpy_f32((cfloat32 *)HostBench_vecRef, HostBench_vecIn, n / 2);
+    CplxVecMul_f32((cfloat32 *)HostBench_vecRef, &HostBench_vecRotation, n / 2);
+    CplxVecCpy_f32(HostBench_vecWork, HostBench_vecIn, n / 2);
+    CplxVecMul_f32Fast(HostBench_vecWork, &HostBench_vecRotation, n / 2);
+    error = HostBench_vectorError((float32 *)HostBench_vecWork, HostBench_vecRef, n);
+    HostBench_report("CplxVecMul_f32Fast", error < HOSTBENCH_VEC_TOLERANCE, error);
+
+    error = fabs(VecSum_f32Fast(HostBench_vecRealIn, n) - VecSum_f32(HostBench_vecRealIn, n));
+    HostBench_report("VecSum_f32Fast", error < HOSTBENCH_VEC_TOLERANCE, error);
+
+    CplxVecCpy_f32(HostBench_vecWork, HostBench_vecIn, n);
+}
+
+
+/** \} */
+
+/** \brief Measure one workload
+ * \param workload Pointer to the workload
+ * \param result Pointer to the measurement result
+ */
+static void HostBench_measure(const HostBench_Workload *workload, HostBench_Result *result)
+{
+    uint32 run;
+
+    result->min = TIME_INFINITE;
+    result->max = 0;
+    result->sum = 0;
+
+    /* Warm up the caches and the branch predictors */
+    workload->function(workload->param);
+
+    for (run = 0; run < HOSTBENCH_RUNS; run++)
+    {
+        Ifx_TickTime start = now();
+        Ifx_TickTime delta;
+
+        workload->function(workload->param);
+        delta = elapsed(start);
+
+        result->min  = (delta < result->min) ? delta : result->min;
+        result->max  = (delta > result->max) ? delta : result->max;
+        result->sum += delta;
+    }
+}
+
+
+void HostBench_init(void)
+{
+    uint32 i;
+
+    /** - Initialise the time constants */
+    initTime();
+
+    Ifx_Crc_createTable(&g_HostBench.crcTable.data, 16, 0x1021, 0);
+    Ifx_Crc_init(&g_HostBench.crc, &g_HostBench.crcTable.data, 1, 0, 0xFFFF, 0);
+
+    g_HostBench.fifo      = Ifx_Fifo_init(HostBench_fifoBuffer, HOSTBENCH_FIFO_SIZE, 1);
+    g_HostBench.failCount = 0;
+
+    Ifx_LutSincosF32_init();
+    Ifx_LutAtan2F32_init();
+    Ifx_LutSincosF32_initTable(&HostBench_sincos10);
+    Ifx_LutSincosF32_initTable(&HostBench_sincos8);
+    Ifx_LutAtan2F32_initTable(&HostBench_atan2);
+
+    for (i = 0; i < HOSTBENCH_FFT_MAX_SIZE; i++)
+    {   /* Two tones and a deterministic noise, complex input */
+        HostBench_fftIn[i].real  = Ifx_LutSincosF32_sin((Ifx_Lut_FxpAngle)(i * 3));
+        HostBench_fftIn[i].imag  = 0.25f * Ifx_LutSincosF32_cos((Ifx_Lut_FxpAngle)(i * 41));
+        HostBench_fftIn[i].real += (float32)((sint32)((i * 0x9E3779B9u) >> 20) - 2048) / 65536.0f;
+        HostBench_fftRealIn[i]   = HostBench_fftIn[i].real;
+    }
+
+    Ifx_FftF32_generateTwiddleFactor(HostBench_fftTwiddle, HOSTBENCH_FFT_MAX_SIZE);
+
+    for (i = 0; i < HOSTBENCH_VEC_SIZE; i++)
+    {
+        HostBench_vecIn[i]     = HostBench_fftIn[(i * 7) % HOSTBENCH_FFT_MAX_SIZE];
+        HostBench_vecRealIn[i] = HostBench_vecIn[i].real;
+    }
+
+    for (i = 0; i < (HOSTBENCH_DATA_SIZE / 4); i++)
+    {
+        HostBench_data[i] = i * 0x9E3779B9;
+    }
+}
+
+
+boolean HostBench_run(void)
+{
+    HostBench_Result result;
+    uint32           i;
+
+    printf("BENCH_BEGIN,host,%u\n", HOSTBENCH_RUNS);
+
+    HostBench_checkFft();
+    HostBench_checkCrc();
+    HostBench_checkLut();
+    HostBench_checkFifo();
+    HostBench_checkVector();
+
+    for (i = 0; i < sizeof(HostBench_workloads) / sizeof(HostBench_workloads[0]); i++)
+    {
+        HostBench_measure(&HostBench_workloads[i], &result);
+        printf("BENCH,%s,%u,%u,%lld,%lld,%lld\n",
+            HostBench_workloads[i].name, HostBench_workloads[i].param, HOSTBENCH_RUNS,
+            (long long)result.min, (long long)result.max, (long long)(result.sum / HOSTBENCH_RUNS));
+    }
+
+    printf("BENCH_END\n");
+
+    return g_HostBench.failCount == 0;
+}
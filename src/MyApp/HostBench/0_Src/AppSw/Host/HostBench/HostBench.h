@@ -0,0 +1,126 @@
+/**
+ * \file HostBench.h
+ * \brief Host benchmark and golden output test of the SysSe Math and DataHandling modules
+ *
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup App_HostBench_SrcDoc_Main Host benchmark
+ * \ingroup App_HostBench_SrcDoc
+ *
+ * The target independent modules Ifx_FftF32, Ifx_Cf32, Ifx_Lut*, Ifx_Crc and Ifx_Fifo are compiled unmodified
+ * by the PC compiler against the headers of Infra/Platform/Host (see \ref IfxLld_Platform_Host), so that
+ * algorithm variants (radix-2 / radix-4 FFT, byte wise / slicing CRC, table resolutions) are compared within
+ * seconds. The ranking shall be confirmed on the target with the CCNT measurements of the Benchmark demo.
+ *
+ * The golden output checks run first: FFT against a double precision DFT, CRC against the check values of the
+ * catalogued algorithms on "123456789", lookup tables against libm, FIFO write / read round trip, unrolled
+ * vector functions against the reference functions. Then each workload is executed HOSTBENCH_RUNS times and
+ * measured with the host monotonic clock.
+ *
+ * The report is printed on stdout in the format of the Benchmark demo, times in ns:
+ * \code
+ * BENCH_BEGIN,host,<runs>
+ * BENCH_CHECK,<function>,<pass|fail>,<max error>
+ * BENCH,<workload>,<parameter>,<runs>,<min ns>,<max ns>,<mean ns>
+ * BENCH_END
+ * \endcode
+ * The "empty" workload is the measurement overhead. The exit code is 1 if a check fails.
+ *
+ * Build and run on a PC (see the Makefile for the 64 bit toolchains without 32 bit libraries):
+ * \code
+ * make run
+ * \endcode
+ *
+ */
+
+#ifndef HOSTBENCH_H
+#define HOSTBENCH_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include <Ifx_Types.h>
+#include "SysSe/Math/Ifx_Crc.h"
+#include "Ifx_Fifo.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+#define HOSTBENCH_RUNS         (64)                 /**< \brief Number of measured executions per workload */
+#define HOSTBENCH_FFT_MAX_SIZE (4096)               /**< \brief Largest FFT length */
+#define HOSTBENCH_FFT_DFT_SIZE (1024)               /**< \brief FFT length checked against the DFT */
+#define HOSTBENCH_DATA_SIZE    (4096)               /**< \brief Size in bytes of the CRC input data */
+#define HOSTBENCH_FIFO_SIZE    (256)                /**< \brief Size in bytes of the FIFO */
+#define HOSTBENCH_VEC_SIZE     (256)                /**< \brief Number of elements of the vector library workloads */
+
+/******************************************************************************/
+/*------------------------------Type Definitions------------------------------*/
+/******************************************************************************/
+
+/** \brief Workload function
+ * \param param workload parameter, e.g. FFT length or number of bytes
+ */
+typedef void (*HostBench_Function)(uint32 param);
+
+/** \brief Benchmark table entry */
+typedef struct
+{
+    pchar              name;            /**< \brief workload name, printed in the report */
+    HostBench_Function function;        /**< \brief workload function */
+    uint32             param;           /**< \brief workload parameter */
+} HostBench_Workload;
+
+/** \brief Measurement result of one workload */
+typedef struct
+{
+    Ifx_TickTime min;                   /**< \brief minimal time */
+    Ifx_TickTime max;                   /**< \brief maximal time */
+    Ifx_TickTime sum;                   /**< \brief sum of the times */
+} HostBench_Result;
+
+/** \brief Host benchmark application data */
+typedef struct
+{
+    Ifc_Crc_Table16 crcTable;           /**< \brief CRC-16 CCITT table */
+    Ifc_Crc         crc;                /**< \brief CRC-16 CCITT driver */
+    Ifx_Fifo       *fifo;               /**< \brief FIFO under test */
+    uint32          failCount;          /**< \brief Number of failed checks */
+    volatile uint32 sink;               /**< \brief Workload results, prevents the removal of the computations */
+} App_HostBench;
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+
+IFX_EXTERN App_HostBench g_HostBench;
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+
+/** \brief Initialise the lookup tables, the CRC driver, the FIFO and the input data */
+IFX_EXTERN void HostBench_init(void);
+
+/** \brief Execute the golden output checks, measure all workloads and print the report
+ * \return TRUE if all checks passed
+ */
+IFX_EXTERN boolean HostBench_run(void);
+
+#endif
@@ -0,0 +1,85 @@
+/**
+ * \file Configuration.h
+ * \brief Global configuration
+ *
+ * \version iLLD_Demos_1_0_1_4_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup App_MemBenchmark_SrcDoc_Config Application configuration
+ * \ingroup App_MemBenchmark_SrcDoc
+ *
+ *
+ */
+
+#ifndef CONFIGURATION_H
+#define CONFIGURATION_H
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "Ifx_Cfg.h"
+#include "ConfigurationIsr.h"
+#include "_Impl/IfxGlobal_cfg.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+/* APPLICATION_KIT_TC237 Ȥ SHIELD_BUDDY ߿ Ѱ */
+#define APPLICATION_KIT_TC237 	1
+#define SHIELD_BUDDY 			2
+
+/** \addtogroup App_MemBenchmark_SrcDoc_Config
+ * \{ */
+
+#define CFG_ASC0_BAUDRATE        (115200.0)                   /**< \brief Define the Baudrate */
+#define CFG_ASC0_RX_BUFFER_SIZE  (512)                        /**< \brief Define the Rx buffer size in byte. */
+#define CFG_ASC0_TX_BUFFER_SIZE  (6 * 1024)                   /**< \brief Define the Tx buffer size in byte. */
+
+#define CFG_MEMBENCH_LMU         (1)                          /**< \brief If 1, the LMU is measured. Set to 0 for a derivative without LMU */
+#define CFG_MEMBENCH_EMEM        (0x00000000)                 /**< \brief Address of the EMEM buffer measured, 0 if none. The EMEM of an emulation device shall be enabled by the application, e.g. 0xBF000000 */
+#define CFG_MEMBENCH_DMA_CHANNEL (IfxDma_ChannelId_0)         /**< \brief DMA channel generating the DMA contention */
+
+#if BOARD == APPLICATION_KIT_TC237
+	#define SHELL_ASCLIN    MODULE_ASCLIN0
+	#define SHELL_RX        IfxAsclin0_RXA_P14_1_IN
+	#define SHELL_TX        IfxAsclin0_TX_P14_0_OUT
+
+#elif BOARD == SHIELD_BUDDY
+	#define SHELL_ASCLIN    MODULE_ASCLIN3
+	#define SHELL_RX        IfxAsclin3_RXD_P32_2_IN
+	#define SHELL_TX        IfxAsclin3_TX_P15_7_OUT
+
+#endif
+
+/*______________________________________________________________________________
+** Help Macros
+**____________________________________________________________________________*/
+/**
+ * \name Macros for Regression Runs
+ * \{
+ */
+#ifndef REGRESSION_RUN_STOP_PASS
+#define REGRESSION_RUN_STOP_PASS
+#endif
+
+#ifndef REGRESSION_RUN_STOP_FAIL
+#define REGRESSION_RUN_STOP_FAIL
+#endif
+/** \} */
+
+/** \} */
+#endif
@@ -0,0 +1,505 @@
+/**
+ * \file MemBench.c
+ * \brief Latency and bandwidth benchmark of the memories
+ *
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "MemBench.h"
+#include "Cpu0_Main.h"
+#include "SysSe/Bsp/Bsp.h"
+#include "SysSe/Comm/Ifx_Console.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+#define MEMBENCH_FLUSH_TIMEOUT  (TimeConst_1s)      /**< \brief Maximal wait for the ASC output before a measurement */
+#define MEMBENCH_DMA_TRANSFERS  (16383)             /**< \brief Transfers of 8 moves of one DMA contention transaction */
+
+/** \brief Global address of the PSPR of a CPU */
+#define MEMBENCH_PSPR_ADDR(cpu) (0x70100000 - ((cpu) * 0x10000000))
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+
+App_MemBench g_MemBench; /**< \brief Memory benchmark information */
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+
+/* Not zero: located in the PFlash, the content is not used */
+static const uint32 MemBench_flash[MEMBENCH_FLASH_SIZE / 4] = {1};
+
+IFX_FAST_DATA_CPU0 static MemBench_Core MemBench_cores[IFXCPU_NUM_MODULES];
+IFX_FAST_DATA_CPU0 static uint32        MemBench_dmaScratch[8];
+IFX_FAST_DATA_CPU0 static uint32        MemBench_dspr0[MEMBENCH_RAM_SIZE / 4];
+#if (IFXCPU_NUM_MODULES > 1)
+IFX_FAST_DATA_CPU1 static uint32        MemBench_dspr1[MEMBENCH_RAM_SIZE / 4];
+#endif
+#if (IFXCPU_NUM_MODULES > 2)
+IFX_FAST_DATA_CPU2 static uint32        MemBench_dspr2[MEMBENCH_RAM_SIZE / 4];
+#endif
+#if (CFG_MEMBENCH_LMU != 0)
+IFX_LMU_DATA static uint32              MemBench_lmu[MEMBENCH_RAM_SIZE / 4];
+#endif
+
+static const pchar MemBench_contentionNames[MemBench_Contention_count] = {"none", "cpus", "dma", "all"};
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+/** \brief Returns the command object of a CPU, through its global address
+ * \param cpu CPU index
+ */
+static MemBench_Core *MemBench_getCore(uint32 cpu)
+{
+    return (MemBench_Core *)IFXCPU_GLB_ADDR_DSPR(0, &MemBench_cores[cpu]);
+}
+
+
+/** \brief Add a region to the region table */
+static void MemBench_addRegion(pchar name, uint32 address, uint32 size, boolean writable)
+{
+    MemBench_Region *region = &g_MemBench.regions[g_MemBench.regionCount];
+
+    region->name     = name;
+    region->address  = address;
+    region->size     = size;
+    region->writable = writable;
+    g_MemBench.regionCount++;
+}
+
+
+/** \brief Execute MEMBENCH_LATENCY_LOADS dependent loads, each one MEMBENCH_LATENCY_STRIDE bytes after the previous one
+ * \param address region start address
+ * \param size size in bytes of the addressed area, power of 2
+ * \param stride distance in bytes between two loads
+ * \return Returns the last offset, to be used by the caller
+ */
+static uint32 MemBench_chase(uint32 address, uint32 size, uint32 stride)
+{
+    volatile uint32 zero   = 0;
+    uint32          mask   = zero; /* The next address depends on the loaded value, the compiler can not know it */
+    uint32          offset = 0;
+    uint32          i;
+
+    for (i = 0; i < MEMBENCH_LATENCY_LOADS; i++)
+    {
+        uint32 value = *(volatile uint32 *)(address + offset);
+        offset = (offset + stride + (value & mask)) & (size - 1);
+    }
+
+    return offset;
+}
+
+
+/** \brief Read a region with 32 bit sequential loads
+ * \return Returns the sum of the loaded values
+ */
+static uint32 MemBench_read(uint32 address, uint32 size)
+{
+    const volatile uint32 *data = (const volatile uint32 *)address;
+    uint32                 sum  = 0;
+    uint32                 i;
+
+    for (i = 0; i < (size / 16); i++)
+    {
+        sum  += data[0];
+        sum  += data[1];
+        sum  += data[2];
+        sum  += data[3];
+        data += 4;
+    }
+
+    return sum;
+}
+
+
+/** \brief Write a region with 32 bit sequential stores */
+static void MemBench_write(uint32 address, uint32 size)
+{
+    volatile uint32 *data = (volatile uint32 *)address;
+    uint32           i;
+
+    for (i = 0; i < (size / 16); i++)
+    {
+        data[0] = i;
+        data[1] = i;
+        data[2] = i;
+        data[3] = i;
+        data   += 4;
+    }
+}
+
+
+/** \brief Start a DMA contention transaction if the previous one is finished
+ * \param region region read by the DMA
+ */
+static void MemBench_serviceDma(const MemBench_Region *region)
+{
+    IfxDma_Dma_Channel *channel = &g_MemBench.drivers.dmaChannel;
+
+    if (IfxDma_Dma_isChannelTransactionPending(channel) == FALSE)
+    {
+        IfxDma_Dma_setChannelSourceAddress(channel, region->address);
+        IfxDma_Dma_setChannelTransferCount(channel, MEMBENCH_DMA_TRANSFERS);
+        IfxDma_setChannelSourceIncrementStep(channel->dma, channel->channelId, IfxDma_ChannelIncrementStep_1,
+            IfxDma_ChannelIncrementDirection_positive, (IfxDma_ChannelIncrementCircular)(31 - __clz(region->size)));
+        IfxDma_Dma_startChannelTransaction(channel);
+    }
+}
+
+
+/** \brief Measure a region on the calling CPU, interrupts disabled
+ * \param region Pointer to the region
+ * \param dma If TRUE, the DMA contention transaction is restarted before each execution (CPU0 only)
+ * \param result Pointer to the measurement result, sum of MEMBENCH_RUNS executions
+ */
+static void MemBench_measure(const MemBench_Region *region, boolean dma, MemBench_Result *result)
+{
+    uint32              run;
+    uint32              sink = 0;
+    IfxCpu_PerfCounters begin;
+    IfxCpu_PerfCounters end;
+    IfxCpu_PerfCounters delta;
+    boolean             interruptState = IfxCpu_disableInterrupts();
+
+    result->latencyCycles = 0;
+    result->hitCycles     = 0;
+    result->readCycles    = 0;
+    result->writeCycles   = 0;
+
+    for (run = 0; run < MEMBENCH_RUNS; run++)
+    {
+        if (dma)
+        {
+            MemBench_serviceDma(region);
+        }
+
+        IfxCpu_readPerfCounters(&begin);
+        sink += MemBench_chase(region->address, region->size, MEMBENCH_LATENCY_STRIDE);
+        IfxCpu_readPerfCounters(&end);
+        IfxCpu_getPerfCountersDelta(&begin, &end, &delta);
+        result->latencyCycles += delta.clock;
+
+        IfxCpu_readPerfCounters(&begin);
+        sink += MemBench_chase(region->address, MEMBENCH_HIT_SIZE, 32);
+        IfxCpu_readPerfCounters(&end);
+        IfxCpu_getPerfCountersDelta(&begin, &end, &delta);
+        result->hitCycles += delta.clock;
+
+        if (dma)
+        {
+            MemBench_serviceDma(region);
+        }
+
+        IfxCpu_readPerfCounters(&begin);
+        sink += MemBench_read(region->address, region->size);
+        IfxCpu_readPerfCounters(&end);
+        IfxCpu_getPerfCountersDelta(&begin, &end, &delta);
+        result->readCycles += delta.clock;
+
+        if (region->writable)
+        {
+            IfxCpu_readPerfCounters(&begin);
+            MemBench_write(region->address, region->size);
+            IfxCpu_readPerfCounters(&end);
+            IfxCpu_getPerfCountersDelta(&begin, &end, &delta);
+            result->writeCycles += delta.clock;
+        }
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+    g_MemBench.sink = sink;
+}
+
+
+/** \brief Measure a region on a CPU under contention and print the result line
+ * \param io Pointer to the report standard interface
+ * \param cpu measuring CPU
+ * \param region Pointer to the region
+ * \param contention load generated during the measurement
+ */
+static void MemBench_measureOnCpu(IfxStdIf_DPipe *io, uint32 cpu, const MemBench_Region *region, MemBench_Contention contention)
+{
+    boolean         cpus = (contention == MemBench_Contention_cpus) || (contention == MemBench_Contention_all);
+    boolean         dma  = (contention == MemBench_Contention_dma) || (contention == MemBench_Contention_all);
+    MemBench_Result result;
+    uint32          i;
+    float32         frequency = IfxScuCcu_getCpuFrequency((IfxCpu_ResourceCpu)cpu);
+    uint32          latency;
+    uint32          hit;
+
+    IfxStdIf_DPipe_flushTx(io, MEMBENCH_FLUSH_TIMEOUT);
+
+    /* Start the contention of the other CPUs */
+    for (i = 1; i < IFXCPU_NUM_MODULES; i++)
+    {
+        if ((i != cpu) && cpus)
+        {
+            MemBench_Core *core = MemBench_getCore(i);
+            core->region  = *region;
+            __dsync();
+            core->command = MemBench_Command_load;
+        }
+    }
+
+    if (cpu == 0)
+    {
+        MemBench_measure(region, dma, &result);
+    }
+    else
+    {
+        MemBench_Core *core = MemBench_getCore(cpu);
+        boolean        interruptState;
+        core->region  = *region;
+        core->command = MemBench_Command_measure;
+        __dsync();
+        core->sequence++;
+
+        /* CPU0 generates its part of the contention while waiting */
+        interruptState = IfxCpu_disableInterrupts();
+
+        while (core->done != core->sequence)
+        {
+            if (dma)
+            {
+                MemBench_serviceDma(region);
+            }
+
+            if (cpus)
+            {
+                g_MemBench.sink = MemBench_read(region->address, region->size);
+            }
+        }
+
+        IfxCpu_restoreInterrupts(interruptState);
+        result = core->result;
+    }
+
+    for (i = 1; i < IFXCPU_NUM_MODULES; i++)
+    {
+        MemBench_getCore(i)->command = MemBench_Command_idle;
+    }
+
+    latency = (result.latencyCycles * 100) / (MEMBENCH_RUNS * MEMBENCH_LATENCY_LOADS);
+    hit     = (result.hitCycles * 100) / (MEMBENCH_RUNS * MEMBENCH_LATENCY_LOADS);
+    IfxStdIf_DPipe_print(io, "MEMBENCH,%u,%s,%s,%u.%02u,%u.%02u,%u,%u"ENDL,
+        cpu, region->name, MemBench_contentionNames[contention], latency / 100, latency % 100, hit / 100, hit % 100,
+        (uint32)(((float32)region->size * MEMBENCH_RUNS * frequency) / ((float32)result.readCycles * 1.0e6)),
+        (result.writeCycles != 0) ? (uint32)(((float32)region->size * MEMBENCH_RUNS * frequency) / ((float32)result.writeCycles * 1.0e6)) : 0);
+}
+
+
+/** \brief Initialise the serial interface used for the report */
+static void MemBench_initSerialInterface(void)
+{
+    IfxAsclin_Asc_Config config;
+
+    IfxAsclin_Asc_initModuleConfig(&config, &SHELL_ASCLIN);
+    config.baudrate.baudrate             = CFG_ASC0_BAUDRATE;
+    config.baudrate.oversampling         = IfxAsclin_OversamplingFactor_16;
+    config.bitTiming.medianFilter        = IfxAsclin_SamplesPerBit_three;
+    config.bitTiming.samplePointPosition = IfxAsclin_SamplePointPosition_8;
+    /* ISR priorities and interrupt target */
+    config.interrupt.txPriority          = ISR_PRIORITY_ASC_TX;
+    config.interrupt.rxPriority          = ISR_PRIORITY_ASC_RX;
+    config.interrupt.erPriority          = ISR_PRIORITY_ASC_EX;
+    config.interrupt.typeOfService       = ISR_PROVIDER_ASC;
+    IfxAsclin_Asc_Pins ascPins = {
+        .cts       = NULL_PTR,
+        .ctsMode   = IfxPort_InputMode_noPullDevice,
+        .rx        = &SHELL_RX,
+        .rxMode    = IfxPort_InputMode_noPullDevice,
+        .rts       = NULL_PTR,
+        .rtsMode   = IfxPort_OutputMode_pushPull,
+        .tx        = &SHELL_TX,
+        .txMode    = IfxPort_OutputMode_pushPull,
+        .pinDriver = IfxPort_PadDriver_cmosAutomotiveSpeed1
+    };
+    config.pins         = &ascPins;
+    config.rxBuffer     = g_MemBench.ascBuffer.rx;
+    config.txBuffer     = g_MemBench.ascBuffer.tx;
+    config.txBufferSize = CFG_ASC0_TX_BUFFER_SIZE;
+    config.rxBufferSize = CFG_ASC0_RX_BUFFER_SIZE;
+    IfxAsclin_Asc_initModule(&g_MemBench.drivers.asc, &config);
+
+    /* Connect the standard asc interface to the device driver*/
+    IfxAsclin_Asc_stdIfDPipeInit(&g_MemBench.stdIf.asc, &g_MemBench.drivers.asc);
+
+    /* Ifx_Console initialisation */
+    Ifx_Console_init(&g_MemBench.stdIf.asc);
+
+    /* Assert initialisation */
+    Ifx_Assert_setStandardIo(&g_MemBench.stdIf.asc);
+}
+
+
+/** \brief Initialise the DMA channel which reads the measured region, started by software */
+static void MemBench_initDma(void)
+{
+    IfxDma_Dma_Config        dmaConfig;
+    IfxDma_Dma               dma;
+    IfxDma_Dma_ChannelConfig config;
+
+    IfxDma_Dma_initModuleConfig(&dmaConfig, &MODULE_DMA);
+    IfxDma_Dma_initModule(&dma, &dmaConfig);
+
+    IfxDma_Dma_initChannelConfig(&config, &dma);
+    config.channelId                        = CFG_MEMBENCH_DMA_CHANNEL;
+    config.sourceAddress                    = (uint32)&MemBench_flash[0];
+    config.destinationAddress               = IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), &MemBench_dmaScratch[0]);
+    config.transferCount                    = MEMBENCH_DMA_TRANSFERS;
+    config.blockMode                        = IfxDma_ChannelMove_8;
+    config.requestMode                      = IfxDma_ChannelRequestMode_completeTransactionPerRequest;
+    config.moveSize                         = IfxDma_ChannelMoveSize_32bit;
+    config.sourceCircularBufferEnabled      = TRUE;
+    config.sourceAddressCircularRange       = IfxDma_ChannelIncrementCircular_32768;
+    config.destinationCircularBufferEnabled = TRUE;
+    config.destinationAddressCircularRange  = IfxDma_ChannelIncrementCircular_32;
+    IfxDma_Dma_initChannel(&g_MemBench.drivers.dmaChannel, &config);
+}
+
+
+/** \brief Build the region table */
+static void MemBench_initRegions(void)
+{
+    g_MemBench.regionCount = 0;
+    MemBench_addRegion("pflash", (uint32)&MemBench_flash[0], MEMBENCH_FLASH_SIZE, FALSE);
+    MemBench_addRegion("pflashNc", IFXCPU_NON_CACHED_ADDR(&MemBench_flash[0]), MEMBENCH_FLASH_SIZE, FALSE);
+    MemBench_addRegion("dspr0", IFXCPU_GLB_ADDR_DSPR(0, &MemBench_dspr0[0]), MEMBENCH_RAM_SIZE, TRUE);
+#if (IFXCPU_NUM_MODULES > 1)
+    MemBench_addRegion("dspr1", IFXCPU_GLB_ADDR_DSPR(1, &MemBench_dspr1[0]), MEMBENCH_RAM_SIZE, TRUE);
+#endif
+#if (IFXCPU_NUM_MODULES > 2)
+    MemBench_addRegion("dspr2", IFXCPU_GLB_ADDR_DSPR(2, &MemBench_dspr2[0]), MEMBENCH_RAM_SIZE, TRUE);
+#endif
+    MemBench_addRegion("pspr0", MEMBENCH_PSPR_ADDR(0), MEMBENCH_PSPR_SIZE, FALSE);
+#if (IFXCPU_NUM_MODULES > 1)
+    MemBench_addRegion("pspr1", MEMBENCH_PSPR_ADDR(1), MEMBENCH_PSPR_SIZE, FALSE);
+#endif
+#if (IFXCPU_NUM_MODULES > 2)
+    MemBench_addRegion("pspr2", MEMBENCH_PSPR_ADDR(2), MEMBENCH_PSPR_SIZE, FALSE);
+#endif
+#if (CFG_MEMBENCH_LMU != 0)
+    MemBench_addRegion("lmu", (uint32)&MemBench_lmu[0], MEMBENCH_RAM_SIZE, TRUE);
+    MemBench_addRegion("lmuNc", IFXCPU_NON_CACHED_ADDR(&MemBench_lmu[0]), MEMBENCH_RAM_SIZE, TRUE);
+#endif
+#if (CFG_MEMBENCH_EMEM != 0)
+    MemBench_addRegion("emem", CFG_MEMBENCH_EMEM, MEMBENCH_RAM_SIZE, TRUE);
+#endif
+}
+
+
+void MemBench_init(void)
+{
+    /** - Initialise the time constants */
+    initTime();
+
+    /** - Initialise the serial interface and the console */
+    MemBench_initSerialInterface();
+
+    /** - Initialise the contention DMA channel and the regions */
+    MemBench_initDma();
+    MemBench_initRegions();
+
+    /** - Start the performance counters of CPU0 */
+    IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+
+    g_MemBench.runRequested = TRUE;
+}
+
+
+void MemBench_run(void)
+{
+    IfxStdIf_DPipe *io = &g_MemBench.stdIf.asc;
+    uint32          cpu;
+    uint32          i;
+    uint32          contention;
+
+    if (IfxStdIf_DPipe_getReadCount(io) > 0)
+    {
+        IfxStdIf_DPipe_clearRx(io);
+        g_MemBench.runRequested = TRUE;
+    }
+
+    if (g_MemBench.runRequested)
+    {
+        g_MemBench.runRequested = FALSE;
+
+        IfxStdIf_DPipe_print(io, "MEMBENCH_BEGIN,%u,%u"ENDL, (uint32)g_AppCpu0.info.cpuFreq, MEMBENCH_RUNS);
+
+        for (cpu = 0; cpu < IFXCPU_NUM_MODULES; cpu++)
+        {
+            for (i = 0; i < g_MemBench.regionCount; i++)
+            {
+                for (contention = 0; contention < MemBench_Contention_count; contention++)
+                {
+                    if ((IFXCPU_NUM_MODULES > 1) || (contention == MemBench_Contention_none) || (contention == MemBench_Contention_dma))
+                    {
+                        MemBench_measureOnCpu(io, cpu, &g_MemBench.regions[i], (MemBench_Contention)contention);
+                    }
+                }
+            }
+        }
+
+        IfxStdIf_DPipe_print(io, "MEMBENCH_END"ENDL);
+    }
+}
+
+
+void MemBench_runCore(void)
+{
+    MemBench_Core  *core = MemBench_getCore(IfxCpu_getCoreIndex());
+    MemBench_Region region;
+    MemBench_Result result;
+    uint32          sink = 0;
+
+    IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+
+    while (TRUE)
+    {
+        if (core->command == MemBench_Command_load)
+        {
+            region = core->region;
+            sink  += MemBench_read(region.address, region.size);
+        }
+        else if ((core->command == MemBench_Command_measure) && (core->done != core->sequence))
+        {
+            region = core->region;
+            MemBench_measure(&region, FALSE, &result);
+            core->result  = result;
+            core->command = MemBench_Command_idle;
+            __dsync();
+            core->done    = core->sequence;
+        }
+        else
+        {
+            /* wait on the local memories */
+        }
+    }
+}
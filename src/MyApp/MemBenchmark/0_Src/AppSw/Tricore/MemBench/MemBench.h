@@ -0,0 +1,178 @@
+/**
+ * \file MemBench.h
+ * \brief Latency and bandwidth benchmark of the memories
+ *
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup App_MemBenchmark_SrcDoc_Main Memory benchmark
+ * \ingroup App_MemBenchmark_SrcDoc
+ *
+ * Each CPU in turn measures each memory region with its clock counter (CCNT), interrupts disabled:
+ * - latency: mean cycles of a load which depends on the previous one, the addresses are MEMBENCH_LATENCY_STRIDE
+ * bytes apart over the whole region, i.e. a new cache line at each load.
+ * - hitLatency: the same dependent loads within MEMBENCH_HIT_SIZE bytes, which are served by the caches or the
+ * read buffers after the first pass.
+ * - read / write: bandwidth of 32 bit sequential loads / stores over the whole region, in MB/s. The PFlash is not
+ * written.
+ * The loop overhead is included, the local DSPR line is the reference.
+ *
+ * The regions are the PFlash through the cached (segment 8) and non cached (segment A) addresses, the DSPR and
+ * PSPR of each CPU through their global addresses (local when the CPU measures its own memories), the LMU cached
+ * and non cached (CFG_MEMBENCH_LMU) and the EMEM (CFG_MEMBENCH_EMEM). The PSPR regions are the first
+ * MEMBENCH_PSPR_SIZE bytes of each PSPR, they are only read not to overwrite the code located there. Each region
+ * is measured under contention:
+ * - none: the other CPUs wait on their local memory, the DMA is idle.
+ * - cpus: the other CPUs read the same region sequentially (multi-core derivatives only).
+ * - dma: the DMA channel CFG_MEMBENCH_DMA_CHANNEL reads the region in a loop.
+ * - all: both.
+ * The sequential PFlash loads are served by the prefetching read buffers of the program flash interface, which can
+ * not be disabled: the strided latency shows the flash access without prefetch benefit.
+ *
+ * The report is printed on the shell ASCLIN, one line per CPU, region and contention:
+ * \code
+ * MEMBENCH_BEGIN,<cpu frequency Hz>,<runs>
+ * MEMBENCH,<cpu>,<region>,<contention>,<latency cycles>,<hit latency cycles>,<read MB/s>,<write MB/s>
+ * MEMBENCH_END
+ * \endcode
+ * The XBAR priorities and the linker placement are those of the application, the report is printed again when a
+ * character is received.
+ *
+ */
+
+#ifndef MEMBENCH_H
+#define MEMBENCH_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include <Ifx_Types.h>
+#include "Configuration.h"
+#include "Asclin/Asc/IfxAsclin_Asc.h"
+#include "Dma/Dma/IfxDma_Dma.h"
+#include "StdIf/IfxStdIf_DPipe.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+#define MEMBENCH_RUNS           (8)                 /**< \brief Number of measured executions per region and contention */
+#define MEMBENCH_LATENCY_LOADS  (1024)              /**< \brief Number of dependent loads of a latency measurement */
+#define MEMBENCH_LATENCY_STRIDE (17 * 32)           /**< \brief Distance in bytes between two latency loads: 17 cache lines */
+#define MEMBENCH_HIT_SIZE       (128)               /**< \brief Size in bytes covered by the hit latency loads */
+#define MEMBENCH_FLASH_SIZE     (32 * 1024)         /**< \brief Size in bytes of the PFlash region */
+#define MEMBENCH_RAM_SIZE       (16 * 1024)         /**< \brief Size in bytes of the DSPR, LMU and EMEM regions */
+#define MEMBENCH_PSPR_SIZE      (4 * 1024)          /**< \brief Size in bytes of the PSPR regions, read only */
+#define MEMBENCH_MAX_REGIONS    (12)                /**< \brief Maximal number of regions */
+
+/******************************************************************************/
+/*------------------------------Type Definitions------------------------------*/
+/******************************************************************************/
+
+/** \brief Load generated while a region is measured */
+typedef enum
+{
+    MemBench_Contention_none = 0,   /**< \brief no other bus master */
+    MemBench_Contention_cpus,       /**< \brief the other CPUs read the region */
+    MemBench_Contention_dma,        /**< \brief the DMA reads the region */
+    MemBench_Contention_all,        /**< \brief the other CPUs and the DMA read the region */
+    MemBench_Contention_count       /**< \brief number of contention modes */
+} MemBench_Contention;
+
+/** \brief Command of a CPU, see \ref MemBench_Core */
+typedef enum
+{
+    MemBench_Command_idle = 0,      /**< \brief wait */
+    MemBench_Command_load,          /**< \brief read the region in a loop */
+    MemBench_Command_measure        /**< \brief measure the region once */
+} MemBench_Command;
+
+/** \brief Memory region */
+typedef struct
+{
+    pchar   name;                   /**< \brief region name, printed in the report */
+    uint32  address;                /**< \brief start address, global address for the scratch-pad memories */
+    uint32  size;                   /**< \brief size in bytes, power of 2 */
+    boolean writable;               /**< \brief FALSE for the PFlash and the PSPR */
+} MemBench_Region;
+
+/** \brief Measurement result of one region */
+typedef struct
+{
+    uint32 latencyCycles;           /**< \brief cycles of the MEMBENCH_LATENCY_LOADS strided loads */
+    uint32 hitCycles;               /**< \brief cycles of the MEMBENCH_LATENCY_LOADS hit loads */
+    uint32 readCycles;              /**< \brief cycles to read the region */
+    uint32 writeCycles;             /**< \brief cycles to write the region, 0 if not writable */
+} MemBench_Result;
+
+/** \brief Command and result of a CPU, located in the DSPR of CPU0 and accessed through its global address */
+typedef struct
+{
+    volatile uint32 command;        /**< \brief MemBench_Command */
+    volatile uint32 sequence;       /**< \brief incremented by CPU0 with each measure command */
+    volatile uint32 done;           /**< \brief sequence of the last finished measurement */
+    MemBench_Region region;         /**< \brief region of the command */
+    MemBench_Result result;         /**< \brief result of the last measurement */
+} MemBench_Core;
+
+/** \brief ASC interface buffers */
+typedef struct
+{
+    uint8 tx[CFG_ASC0_TX_BUFFER_SIZE + sizeof(Ifx_Fifo) + 8];
+    uint8 rx[CFG_ASC0_RX_BUFFER_SIZE + sizeof(Ifx_Fifo) + 8];
+} MemBench_AscBuffer;
+
+/** \brief Memory benchmark application data */
+typedef struct
+{
+    MemBench_AscBuffer ascBuffer;               /**< \brief ASC interface buffer */
+    struct
+    {
+        IfxAsclin_Asc      asc;                 /**< \brief ASC interface */
+        IfxDma_Dma_Channel dmaChannel;          /**< \brief DMA channel generating the DMA contention */
+    }                  drivers;
+    struct
+    {
+        IfxStdIf_DPipe asc;                     /**< \brief ASC standard interface */
+    }                  stdIf;
+    MemBench_Region    regions[MEMBENCH_MAX_REGIONS];   /**< \brief measured regions */
+    uint32             regionCount;             /**< \brief number of regions */
+    boolean            runRequested;            /**< \brief If TRUE, the report is printed by \ref MemBench_run() */
+    volatile uint32    sink;                    /**< \brief Loaded values, prevents the removal of the loads */
+} App_MemBench;
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+
+IFX_EXTERN App_MemBench g_MemBench;
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+
+/** \brief Initialise the ASC output, the DMA channel, the regions and the performance counters of CPU0 */
+IFX_EXTERN void MemBench_init(void);
+
+/** \brief Measure all CPUs, regions and contentions and print the report if requested, CPU0 only */
+IFX_EXTERN void MemBench_run(void);
+
+/** \brief Execute the commands of CPU0 in the background loop of the other CPUs, never returns */
+IFX_EXTERN void MemBench_runCore(void);
+
+#endif
@@ -63,5 +63,16 @@
 #endif
 /** \} */
 
+/**
+ * \name Bluetooth link.
+ * The HC-06 is negotiated at startup to the highest baudrate not above BT_MAX_BAUDRATE, see AsclinBtLink.h.
+ * \{
+ */
+#define BT_MAX_BAUDRATE           921600        /**< \brief Highest baudrate requested from the HC-06 */
+#define BT_NAME                   "MyRacer"     /**< \brief Bluetooth name */
+#define BT_PIN                    "6802"        /**< \brief Bluetooth PIN */
+#define BT_TELEMETRY_PERIOD_MS    10            /**< \brief Sampling period of the telemetry channels */
+/** \} */
+
 /** \} */
 #endif
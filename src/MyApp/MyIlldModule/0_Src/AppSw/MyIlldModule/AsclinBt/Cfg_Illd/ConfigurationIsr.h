@@ -61,6 +61,16 @@
 
 /** \} */
 
+/**
+ * \name DMA channel configuration.
+ * The DMA channel is also the priority of the service request routed to it.
+ * \{ */
+
+#define DMA_CHANNEL_ASC_0_RX  IfxDma_ChannelId_3      /**< \brief Define the DMA channel of the ASC0 reception.  */
+#define DMA_CHANNEL_ASC_0_TX  IfxDma_ChannelId_4      /**< \brief Define the DMA channel of the ASC0 transmission.  */
+
+/** \} */
+
 /**
  * \name Interrupt service provider configuration.
  * \{ */
@@ -50,10 +50,18 @@
 App_AsclinAsc g_AsclinAscUsb; /**< \brief Demo information */
 App_AsclinAsc g_AsclinAscBt; /**< \brief Demo information */
 
+AsclinBtLink  g_AsclinBtLink;      /**< \brief Link handle */
+Ifx_Telemetry g_AsclinBtTelemetry; /**< \brief Telemetry protocol run over the link */
+
+/** \brief Telemetry sample FIFO */
+uint8 g_AsclinBtSampleBuffer[BT_SAMPLE_BUFFER_SIZE + sizeof(Ifx_Fifo) + 8];
+
+/** \brief DMA receive ring of the ASC, aligned to its size */
+IFX_DMA_BUFFER IFX_ALIGN(ASC_RX_DMA_BUFFER_SIZE) uint8 g_AsclinBtRxDmaBuffer[ASC_RX_DMA_BUFFER_SIZE];
+
 /******************************************************************************/
 /*-------------------------Function Prototypes--------------------------------*/
 /******************************************************************************/
-boolean AsclinAscBtComm(char * tx_ptr, char * rx_ptr);
 
 /******************************************************************************/
 /*------------------------Private Variables/Constants-------------------------*/
@@ -104,7 +112,7 @@ IFX_INTERRUPT(asclin0ErISR, 0, ISR_PRIORITY_ASC_0_EX)
 
 IFX_INTERRUPT(asclin0TxISR, 0, ISR_PRIORITY_ASC_0_TX)
 {
-    IfxAsclin_Asc_isrTransmit(&g_AsclinAscBt.drivers.asc);
+    IfxAsclin_Asc_isrDmaTransmit(&g_AsclinAscBt.drivers.asc);
 }
 
 /** \} */
@@ -114,8 +122,7 @@ IFX_INTERRUPT(asclin0TxISR, 0, ISR_PRIORITY_ASC_0_TX)
 
 IFX_INTERRUPT(asclin0RxISR, 0, ISR_PRIORITY_ASC_0_RX)
 {
-    IfxAsclin_Asc_isrReceive(&g_AsclinAscBt.drivers.asc);
-
+    IfxAsclin_Asc_isrDmaReceive(&g_AsclinAscBt.drivers.asc);
 }
 
 /** \} */
@@ -139,6 +146,9 @@ IFX_INTERRUPT(asclin0ErISR, 0, ISR_PRIORITY_ASC_0_EX)
  */
 void AsclinAscBtDemo_init(void)
 {
+    /* time constants of the AT timeouts and of the telemetry period */
+    initTime();
+
     /* disable interrupts */
     boolean              interruptState = IfxCpu_disableInterrupts();
 
@@ -149,10 +159,9 @@ void AsclinAscBtDemo_init(void)
 #elif BOARD == SHIELD_BUDDY
     IfxAsclin_Asc_initModuleConfig(&ascConfig, &MODULE_ASCLIN0);
 #endif
-    /* set the desired baudrate */
+    /* set the desired baudrate, the link manager changes it during the negotiation */
     ascConfig.baudrate.prescaler    = 1;
     ascConfig.baudrate.baudrate     = 9600; /* FDR values will be calculated in initModule */
-//    ascConfig.baudrate.baudrate     = 115200; /* FDR values will be calculated in initModule */
     ascConfig.baudrate.oversampling = IfxAsclin_OversamplingFactor_4;
 #if BOARD == APPLICATION_KIT_TC237
 
@@ -163,6 +172,14 @@ void AsclinAscBtDemo_init(void)
 #endif
     ascConfig.interrupt.typeOfService = (IfxSrc_Tos)IfxCpu_getCoreIndex();
 
+    /* reception and transmission by DMA, one interrupt per 32 bytes received and per block sent */
+    ascConfig.dma.useRxDma        = TRUE;
+    ascConfig.dma.rxDmaChannelId  = DMA_CHANNEL_ASC_0_RX;
+    ascConfig.dma.rxBuffer        = g_AsclinBtRxDmaBuffer;
+    ascConfig.dma.rxBufferSize    = IfxDma_ChannelIncrementCircular_256;
+    ascConfig.dma.rxTransferCount = 32;
+    ascConfig.dma.useTxDma        = TRUE;
+    ascConfig.dma.txDmaChannelId  = DMA_CHANNEL_ASC_0_TX;
 
     /* FIFO configuration */
     ascConfig.txBuffer     = g_AsclinAscBt.ascBuffer.tx;
@@ -193,36 +210,46 @@ void AsclinAscBtDemo_init(void)
 
     printf("Asclin Asc is initialised\n");
 
-}
+    /* telemetry, without shell: started by the link manager once the link is ready */
+    {
+        Ifx_Telemetry_Config telemetryConfig;
+        Ifx_Telemetry_initConfig(&telemetryConfig);
+
+        telemetryConfig.sampleBufferSize = BT_SAMPLE_BUFFER_SIZE;
+        telemetryConfig.sampleBuffer     = g_AsclinBtSampleBuffer;
 
-boolean AsclinAscBtComm(char * tx_ptr, char * rx_ptr){
-	boolean success;
-	uint16 tx_count, rx_count;
-	tx_count = strlen(tx_ptr);
-	rx_count = strlen(rx_ptr);
+        if (Ifx_Telemetry_init(&g_AsclinBtTelemetry, &telemetryConfig) == FALSE)
+        {
+            printf("ERROR: BT telemetry initialisation failed\n");
+            REGRESSION_RUN_STOP_FAIL;
+            return;
+        }
 
-    memset(g_AsclinAscBt.txData, '\0', 16);
-    memset(g_AsclinAscBt.rxData, '\0', 16);
+        Ifx_Telemetry_addChannel(&g_AsclinBtTelemetry, "timestamp", &g_AsclinAscBt.timestamp, 4);
+        Ifx_Telemetry_addChannel(&g_AsclinBtTelemetry, "loops", &g_AsclinAscBt.loops, 4);
+        Ifx_Telemetry_addChannel(&g_AsclinBtTelemetry, "dropped", &g_AsclinBtTelemetry.dropCount, 4);
+    }
 
-    g_AsclinAscBt.count = tx_count;
-    memcpy(g_AsclinAscBt.txData, tx_ptr, g_AsclinAscBt.count);
-    IfxAsclin_Asc_write(&g_AsclinAscBt.drivers.asc, g_AsclinAscBt.txData, &g_AsclinAscBt.count, TIME_INFINITE);
-    while(rx_count == IfxAsclin_Asc_getReadCount(&g_AsclinAscBt.drivers.asc)){
-    	;
+    /* link manager, negotiates the baudrate from the background loop */
+    {
+        AsclinBtLink_Config linkConfig;
+        AsclinBtLink_initConfig(&linkConfig, &g_AsclinAscBt.drivers.asc, &ascConfig);
+
+        linkConfig.telemetry   = &g_AsclinBtTelemetry;
+        linkConfig.maxBaudrate = BT_MAX_BAUDRATE;
+        linkConfig.name        = BT_NAME;
+        linkConfig.pin         = BT_PIN;
+
+        if (AsclinBtLink_init(&g_AsclinBtLink, &linkConfig) == FALSE)
+        {
+            printf("ERROR: BT link configuration not supported\n");
+            REGRESSION_RUN_STOP_FAIL;
+            return;
+        }
     }
-    g_AsclinAscBt.count = rx_count;
-	IfxAsclin_Asc_read(&g_AsclinAscBt.drivers.asc, g_AsclinAscBt.rxData, &g_AsclinAscBt.count, TIME_INFINITE);
-
-	printf("tx: %s        rx(exp):%s 		rx:%s       ", tx_ptr, rx_ptr, g_AsclinAscBt.rxData );
-	if( 0 == memcmp(g_AsclinAscBt.rxData, rx_ptr, rx_count)){
-		success = TRUE;
-		printf("Success\n");
-	}
-	else{
-		success = FALSE;
-	    printf("Fail\n");
-	}
-	return(success);
+
+    g_AsclinAscBt.lastState     = g_AsclinBtLink.state;
+    g_AsclinAscBt.nextTelemetry = now();
 }
 
 
@@ -232,28 +259,25 @@ boolean AsclinAscBtComm(char * tx_ptr, char * rx_ptr){
  */
 void AsclinAscBtDemo_run(void)
 {
-	volatile boolean status = FALSE;
-	initTime();
-
-    do{
-    	status = AsclinAscBtComm("AT", "OK");
-    	wait(TimeConst_100ms);
-    }while(FALSE == status);
-
-    do{
-    	status = AsclinAscBtComm("AT+NAMEMyRacer", "OKsetname");
-    	wait(TimeConst_100ms);
-    }while(FALSE == status);
-
-    do{
-    	status = AsclinAscBtComm("AT+PIN6802", "OKsetPIN");
-    	wait(TimeConst_100ms);
-    }while(FALSE == status);
-
-    do{
-//    	status = AsclinAscBtComm("AT+BAUD4", "OK9600");
-    	status = AsclinAscBtComm("AT+BAUD8", "OK115200");
-    	wait(TimeConst_100ms);
-    }while(FALSE == status);
+    AsclinBtLink_process(&g_AsclinBtLink);
+    g_AsclinAscBt.loops++;
 
+    if (g_AsclinBtLink.state != g_AsclinAscBt.lastState)
+    {
+        g_AsclinAscBt.lastState = g_AsclinBtLink.state;
+
+        if (AsclinBtLink_isReady(&g_AsclinBtLink))
+        {
+            printf("BT link ready at %lu baud\n", AsclinBtLink_getBaudrate(&g_AsclinBtLink));
+        }
+    }
+
+    if (AsclinBtLink_isReady(&g_AsclinBtLink) && isDeadLine(g_AsclinAscBt.nextTelemetry))
+    {
+        /* the samples are encoded and written to the DMA fed tx FIFO by AsclinBtLink_process() */
+        g_AsclinAscBt.timestamp = (uint32)now();
+        Ifx_Telemetry_sample(&g_AsclinBtTelemetry);
+
+        g_AsclinAscBt.nextTelemetry = addTTime(g_AsclinAscBt.nextTelemetry, BT_TELEMETRY_PERIOD_MS * TimeConst_1ms);
+    }
 }
@@ -37,13 +37,16 @@
 #include "Configuration.h"
 
 #include <Asclin/Asc/IfxAsclin_Asc.h>
+#include "AsclinBtLink.h"
 
 /******************************************************************************/
 /*-----------------------------------Macros-----------------------------------*/
 /******************************************************************************/
 
-#define ASC_TX_BUFFER_SIZE 64
-#define ASC_RX_BUFFER_SIZE 64
+#define ASC_TX_BUFFER_SIZE     256     /**< \brief Holds at least one encoded telemetry frame */
+#define ASC_RX_BUFFER_SIZE     512
+#define ASC_RX_DMA_BUFFER_SIZE 256     /**< \brief DMA receive ring, see dma.rxBufferSize */
+#define BT_SAMPLE_BUFFER_SIZE  512     /**< \brief Telemetry sample FIFO */
 
 /******************************************************************************/
 /*--------------------------------Enumerations--------------------------------*/
@@ -68,9 +71,10 @@ typedef struct
         IfxAsclin_Asc asc;                     /**< \brief ASC interface */
     }         drivers;
 
-    uint8     txData[16];
-    uint8     rxData[16];
-    Ifx_SizeT count;
+    AsclinBtLink_State lastState;               /**< \brief Link state at the previous run */
+    Ifx_TickTime       nextTelemetry;           /**< \brief Time of the next telemetry sample */
+    uint32             loops;                   /**< \brief Background loop counter, telemetry channel */
+    uint32             timestamp;               /**< \brief STM time of the last sample in ticks, telemetry channel */
 } App_AsclinAsc;
 
 /******************************************************************************/
@@ -78,6 +82,8 @@ typedef struct
 /******************************************************************************/
 
 IFX_EXTERN App_AsclinAsc g_AsclinAscBt;
+IFX_EXTERN AsclinBtLink  g_AsclinBtLink;
+IFX_EXTERN Ifx_Telemetry g_AsclinBtTelemetry;
 
 /******************************************************************************/
 /*-------------------------Function Prototypes--------------------------------*/
@@ -0,0 +1,377 @@
+/**
+ * \file AsclinBtLink.c
+ * \brief HC-06 Bluetooth link manager: baudrate negotiation, telemetry over the Bluetooth link
+ *
+ * \version iLLD_Demos_1_0_0_11_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "AsclinBtLink.h"
+#include "SysSe/Bsp/Bsp.h"
+#include <string.h>
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+#define ASCLINBTLINK_BAUDRATE_COUNT (sizeof(AsclinBtLink_baudrates) / sizeof(AsclinBtLink_baudrates[0]))
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+
+/** \brief State of the pending AT command
+ */
+typedef enum
+{
+    AsclinBtLink_Answer_pending,       /**< \brief Waiting for the answer */
+    AsclinBtLink_Answer_ok,            /**< \brief Expected answer received */
+    AsclinBtLink_Answer_timeout        /**< \brief No or wrong answer within the AT timeout */
+} AsclinBtLink_Answer;
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+
+/** \brief HC-06 baudrate and its AT+BAUD command
+ */
+typedef struct
+{
+    uint32      baudrate;         /**< \brief Baudrate */
+    const char *command;          /**< \brief Command switching the module to the baudrate */
+    const char *answer;           /**< \brief Answer of the module, sent at the previous baudrate */
+} AsclinBtLink_Baudrate;
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+
+/** \brief Baudrates of the HC-06, in increasing order */
+static const AsclinBtLink_Baudrate AsclinBtLink_baudrates[] = {
+    {1200,    "AT+BAUD1", "OK1200"   },
+    {2400,    "AT+BAUD2", "OK2400"   },
+    {4800,    "AT+BAUD3", "OK4800"   },
+    {9600,    "AT+BAUD4", "OK9600"   },
+    {19200,   "AT+BAUD5", "OK19200"  },
+    {38400,   "AT+BAUD6", "OK38400"  },
+    {57600,   "AT+BAUD7", "OK57600"  },
+    {115200,  "AT+BAUD8", "OK115200" },
+    {230400,  "AT+BAUD9", "OK230400" },
+    {460800,  "AT+BAUDA", "OK460800" },
+    {921600,  "AT+BAUDB", "OK921600" },
+    {1382400, "AT+BAUDC", "OK1382400"},
+};
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+static AsclinBtLink_Answer AsclinBtLink_getAnswer(AsclinBtLink *link);
+static void                AsclinBtLink_sendCommand(AsclinBtLink *link, const char *command, const char *argument, const char *expected);
+static void                AsclinBtLink_setBaudrate(AsclinBtLink *link, uint32 baudrate);
+static void                AsclinBtLink_startProbe(AsclinBtLink *link);
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+/** \brief Collect the answer of the pending AT command, never waits
+ *
+ * The HC-06 answers without line termination, the answer is complete when it matches the expected one.
+ */
+static AsclinBtLink_Answer AsclinBtLink_getAnswer(AsclinBtLink *link)
+{
+    AsclinBtLink_Answer answer   = AsclinBtLink_Answer_pending;
+    uint8               expected = (uint8)strlen(link->expected);
+    Ifx_SizeT           count    = (Ifx_SizeT)IfxAsclin_Asc_getReadCount(link->asc);
+
+    count = (Ifx_SizeT)__min(count, ASCLINBTLINK_RESPONSE_SIZE - link->responseLength);
+
+    if (count > 0)
+    {
+        IfxAsclin_Asc_read(link->asc, &link->response[link->responseLength], &count, TIME_NULL);
+        link->responseLength += (uint8)count;
+    }
+
+    if ((link->responseLength >= expected) && (memcmp(link->response, link->expected, expected) == 0))
+    {
+        answer = AsclinBtLink_Answer_ok;
+    }
+    else if (isDeadLine(link->deadline))
+    {
+        answer = AsclinBtLink_Answer_timeout;
+    }
+
+    if (answer != AsclinBtLink_Answer_pending)
+    {
+        link->expected = NULL_PTR;
+    }
+
+    return answer;
+}
+
+
+/** \brief Send an AT command without waiting, the answer is collected by AsclinBtLink_getAnswer()
+ */
+static void AsclinBtLink_sendCommand(AsclinBtLink *link, const char *command, const char *argument, const char *expected)
+{
+    char     *text = link->command;
+    Ifx_SizeT count;
+
+    strncpy(text, command, ASCLINBTLINK_COMMAND_SIZE - 1);
+    text[ASCLINBTLINK_COMMAND_SIZE - 1] = '\0';
+
+    if (argument != NULL_PTR)
+    {
+        strncat(text, argument, ASCLINBTLINK_COMMAND_SIZE - strlen(text) - 1);
+    }
+
+    IfxAsclin_Asc_clearRx(link->asc);
+    link->responseLength = 0;
+    link->expected       = expected;
+    link->deadline       = getDeadLine(link->atTimeout);
+
+    count                = (Ifx_SizeT)strlen(text);
+    IfxAsclin_Asc_write(link->asc, text, &count, TIME_NULL);
+}
+
+
+/** \brief Reconfigure the ASC bit timing, with the same sequence as IfxAsclin_Asc_initModule()
+ */
+static void AsclinBtLink_setBaudrate(AsclinBtLink *link, uint32 baudrate)
+{
+    Ifx_ASCLIN *asclinSFR = link->asc->asclin;
+
+    IfxAsclin_setClockSource(asclinSFR, IfxAsclin_ClockSource_noClock);
+    IfxAsclin_setFrameMode(asclinSFR, IfxAsclin_FrameMode_initialise);
+    IfxAsclin_setClockSource(asclinSFR, link->clockSource);
+    IfxAsclin_setBitTiming(asclinSFR, (float32)baudrate, link->baudrate.oversampling, link->bitTiming.samplePointPosition, link->bitTiming.medianFilter);
+    IfxAsclin_setClockSource(asclinSFR, IfxAsclin_ClockSource_noClock);
+    IfxAsclin_setFrameMode(asclinSFR, IfxAsclin_FrameMode_asc);
+    IfxAsclin_setClockSource(asclinSFR, link->clockSource);
+
+    link->baudrate.baudrate = (float32)baudrate;
+    IfxAsclin_Asc_clearRx(link->asc);
+}
+
+
+/** \brief Start the search of the module baudrate from the highest one
+ */
+static void AsclinBtLink_startProbe(AsclinBtLink *link)
+{
+    link->state      = AsclinBtLink_State_probe;
+    link->probeIndex = ASCLINBTLINK_BAUDRATE_COUNT - 1;
+    AsclinBtLink_setBaudrate(link, AsclinBtLink_baudrates[link->probeIndex].baudrate);
+    AsclinBtLink_sendCommand(link, "AT", NULL_PTR, "OK");
+}
+
+
+uint32 AsclinBtLink_getBaudrate(AsclinBtLink *link)
+{
+    return (uint32)link->baudrate.baudrate;
+}
+
+
+boolean AsclinBtLink_init(AsclinBtLink *link, const AsclinBtLink_Config *config)
+{
+    uint8 index;
+
+    if ((config->asc == NULL_PTR) || (config->asc->dma.useTxDma == FALSE) || (config->ascConfig == NULL_PTR)
+        || (config->telemetry == NULL_PTR) || (config->maxBaudrate < AsclinBtLink_baudrates[0].baudrate))
+    {
+        return FALSE;
+    }
+
+    memset(link, 0, sizeof(*link));
+    link->asc         = config->asc;
+    link->telemetry   = config->telemetry;
+    link->baudrate    = config->ascConfig->baudrate;
+    link->bitTiming   = config->ascConfig->bitTiming;
+    link->clockSource = config->ascConfig->clockSource;
+    link->name        = config->name;
+    link->pin         = config->pin;
+    link->atTimeout   = config->atTimeout;
+
+    /* the telemetry frames are written to the tx FIFO, moved by the ASC DMA */
+    IfxAsclin_Asc_stdIfDPipeInit(&link->io, link->asc);
+
+    for (index = 0; index < ASCLINBTLINK_BAUDRATE_COUNT; index++)
+    {
+        if (AsclinBtLink_baudrates[index].baudrate <= config->maxBaudrate)
+        {
+            link->targetIndex = index;
+        }
+    }
+
+    AsclinBtLink_startProbe(link);
+
+    return TRUE;
+}
+
+
+void AsclinBtLink_initConfig(AsclinBtLink_Config *config, IfxAsclin_Asc *asc, const IfxAsclin_Asc_Config *ascConfig)
+{
+    config->asc         = asc;
+    config->ascConfig   = ascConfig;
+    config->telemetry   = NULL_PTR;
+    config->maxBaudrate = 921600;
+    config->name        = NULL_PTR;
+    config->pin         = NULL_PTR;
+    config->atTimeout   = 1500 * TimeConst_1ms;
+}
+
+
+boolean AsclinBtLink_isReady(AsclinBtLink *link)
+{
+    return link->state == AsclinBtLink_State_ready;
+}
+
+
+void AsclinBtLink_process(AsclinBtLink *link)
+{
+    AsclinBtLink_Answer answer = AsclinBtLink_Answer_pending;
+
+    if (link->expected != NULL_PTR)
+    {
+        answer = AsclinBtLink_getAnswer(link);
+
+        if (answer == AsclinBtLink_Answer_pending)
+        {
+            return;
+        }
+    }
+
+    switch (link->state)
+    {
+    case AsclinBtLink_State_probe:
+
+        if (answer == AsclinBtLink_Answer_ok)
+        {
+            link->baudIndex = link->probeIndex;
+            link->setupStep = 0;
+            link->state     = AsclinBtLink_State_setup;
+        }
+        else
+        {
+            /* try the next lower baudrate, restart from the highest one after the lowest */
+            link->probeIndex = (link->probeIndex == 0) ? (ASCLINBTLINK_BAUDRATE_COUNT - 1) : (link->probeIndex - 1);
+            AsclinBtLink_setBaudrate(link, AsclinBtLink_baudrates[link->probeIndex].baudrate);
+            AsclinBtLink_sendCommand(link, "AT", NULL_PTR, "OK");
+        }
+
+        break;
+
+    case AsclinBtLink_State_setup:
+
+        if (answer == AsclinBtLink_Answer_timeout)
+        {
+            /* the module does not answer anymore, search its baudrate again */
+            AsclinBtLink_startProbe(link);
+        }
+        else if ((link->setupStep == 0) && (link->name != NULL_PTR))
+        {
+            link->setupStep = 1;
+            AsclinBtLink_sendCommand(link, "AT+NAME", link->name, "OKsetname");
+        }
+        else if ((link->setupStep <= 1) && (link->pin != NULL_PTR))
+        {
+            link->setupStep = 2;
+            AsclinBtLink_sendCommand(link, "AT+PIN", link->pin, "OKsetPIN");
+        }
+        else
+        {
+            /* no command pending, the upgrade starts at the next call */
+            link->state = AsclinBtLink_State_upgrade;
+        }
+
+        break;
+
+    case AsclinBtLink_State_upgrade:
+
+        if (answer == AsclinBtLink_Answer_ok)
+        {
+            /* the answer is sent at the previous baudrate, the module switches after it */
+            AsclinBtLink_setBaudrate(link, AsclinBtLink_baudrates[link->targetIndex].baudrate);
+            link->deadline = getDeadLine(TimeConst_100ms);
+            link->state    = AsclinBtLink_State_settle;
+        }
+        else
+        {
+            if (answer == AsclinBtLink_Answer_timeout)
+            {
+                /* baudrate not supported by the module firmware */
+                link->targetIndex--;
+            }
+
+            if (link->targetIndex <= link->baudIndex)
+            {
+                link->state = AsclinBtLink_State_ready;
+            }
+            else
+            {
+                AsclinBtLink_sendCommand(link, AsclinBtLink_baudrates[link->targetIndex].command, NULL_PTR, AsclinBtLink_baudrates[link->targetIndex].answer);
+            }
+        }
+
+        break;
+
+    case AsclinBtLink_State_settle:
+
+        if (isDeadLine(link->deadline))
+        {
+            link->state = AsclinBtLink_State_verify;
+            AsclinBtLink_sendCommand(link, "AT", NULL_PTR, "OK");
+        }
+
+        break;
+
+    case AsclinBtLink_State_verify:
+
+        if (answer == AsclinBtLink_Answer_ok)
+        {
+            link->baudIndex = link->targetIndex;
+            link->state     = AsclinBtLink_State_ready;
+        }
+        else
+        {
+            /* the ASC or the module can't hold the baudrate, the module is at an unknown baudrate */
+            link->targetIndex--;
+            AsclinBtLink_startProbe(link);
+        }
+
+        break;
+
+    case AsclinBtLink_State_ready:
+
+        /* the host may stop the protocol, it is restarted for the next connection */
+        if (link->telemetry->started == FALSE)
+        {
+            Ifx_Telemetry_start(link->telemetry, &link->io);
+        }
+
+        Ifx_Telemetry_execute(link->telemetry);
+        break;
+
+    default:
+        break;
+    }
+}
+
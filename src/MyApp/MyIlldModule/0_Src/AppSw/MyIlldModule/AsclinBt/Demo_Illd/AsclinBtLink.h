@@ -0,0 +1,164 @@
+/**
+ * \file AsclinBtLink.h
+ * \brief HC-06 Bluetooth link manager: baudrate negotiation, telemetry over the Bluetooth link
+ *
+ * \version iLLD_Demos_1_0_0_11_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * The link manager is run from the background loop by AsclinBtLink_process(), no call waits for the module:
+ * - probe: "AT" is sent at each baudrate of the HC-06, from the highest one, until the module answers "OK". The HC-06
+ *   keeps its baudrate over power cycles, it is not necessarily the one of the previous run.
+ * - setup: the optional name and PIN are set ("AT+NAME", "AT+PIN").
+ * - upgrade: the module is switched to the highest baudrate not above maxBaudrate ("AT+BAUDx"), the ASCLIN bit timing
+ *   is reconfigured once the answer is received, then the link is verified with "AT". A baudrate which is not accepted
+ *   by the module or which fails the verification is skipped, the next lower one is tried.
+ * - ready: the binary telemetry protocol (\ref library_srvsw_sysse_comm_telemetry) runs over the standard interface
+ *   of the ASC. Its COBS frames are written to the tx FIFO without waiting and moved by the ASC DMA, the host frames
+ *   are collected from the DMA fed rx FIFO. The protocol is restarted when the host stops it.
+ *
+ * The HC-06 only answers the AT commands while no Bluetooth connection is established: the negotiation is done
+ * at startup, before the remote device connects.
+ *
+ * The ASC must be initialised with dma.useTxDma, dma.useRxDma is recommended at the upgraded baudrates, its tx FIFO
+ * shall hold at least one encoded telemetry frame.
+ *
+ * \defgroup IfxLld_Demo_AsclinBtLink_SrcDoc_Driver Bluetooth link manager
+ * \ingroup IfxLld_Demo_AsclinAsc_SrcDoc
+ */
+
+#ifndef ASCLINBTLINK_H
+#define ASCLINBTLINK_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include <Ifx_Types.h>
+#include <Asclin/Asc/IfxAsclin_Asc.h>
+#include "SysSe/Comm/Ifx_Telemetry.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+#define ASCLINBTLINK_COMMAND_SIZE  (32)     /**< \brief Maximum length of an AT command */
+#define ASCLINBTLINK_RESPONSE_SIZE (16)     /**< \brief Maximum length of an AT command answer */
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+/** \addtogroup IfxLld_Demo_AsclinBtLink_SrcDoc_Driver
+ * \{ */
+
+/** \brief Link state
+ */
+typedef enum
+{
+    AsclinBtLink_State_probe,        /**< \brief Searching the baudrate of the module */
+    AsclinBtLink_State_setup,        /**< \brief Setting the name and the PIN */
+    AsclinBtLink_State_upgrade,      /**< \brief Switching the module to a higher baudrate */
+    AsclinBtLink_State_settle,       /**< \brief Waiting for the module to switch its baudrate */
+    AsclinBtLink_State_verify,       /**< \brief Checking the link at the new baudrate */
+    AsclinBtLink_State_ready         /**< \brief The telemetry protocol runs */
+} AsclinBtLink_State;
+
+/** \} */
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+/** \addtogroup IfxLld_Demo_AsclinBtLink_SrcDoc_Driver
+ * \{ */
+
+/** \brief Link handle
+ */
+typedef struct
+{
+    char                           command[ASCLINBTLINK_COMMAND_SIZE];     /**< \brief Pending AT command */
+    char                           response[ASCLINBTLINK_RESPONSE_SIZE];   /**< \brief Answer of the pending AT command */
+    IfxAsclin_Asc                 *asc;                                    /**< \brief ASC connected to the module */
+    IfxStdIf_DPipe                 io;                                     /**< \brief Standard interface of the ASC, used by the telemetry */
+    Ifx_Telemetry                 *telemetry;                              /**< \brief Telemetry protocol run once the link is ready */
+    IfxAsclin_Asc_BaudRate         baudrate;                               /**< \brief ASC baudrate configuration, baudrate is the current one */
+    IfxAsclin_Asc_BitTimingControl bitTiming;                              /**< \brief ASC bit timing configuration */
+    IfxAsclin_ClockSource          clockSource;                            /**< \brief ASC clock source */
+    const char                    *name;                                   /**< \brief Bluetooth name, or NULL_PTR */
+    const char                    *pin;                                    /**< \brief Bluetooth PIN, or NULL_PTR */
+    Ifx_TickTime                   atTimeout;                              /**< \brief Time allowed to the module to answer an AT command */
+    Ifx_TickTime                   deadline;                               /**< \brief End of the pending AT command or of the settle time */
+    const char                    *expected;                               /**< \brief Expected answer of the pending AT command, NULL_PTR if none */
+    AsclinBtLink_State             state;                                  /**< \brief Link state */
+    uint8                          probeIndex;                             /**< \brief Baudrate table index being probed */
+    uint8                          baudIndex;                              /**< \brief Baudrate table index of the module */
+    uint8                          targetIndex;                            /**< \brief Baudrate table index of the upgrade */
+    uint8                          setupStep;                              /**< \brief Next setup command */
+    uint8                          responseLength;                         /**< \brief Bytes received in response */
+} AsclinBtLink;
+
+/** \brief Link configuration
+ */
+typedef struct
+{
+    IfxAsclin_Asc              *asc;               /**< \brief ASC initialised with dma.useTxDma */
+    const IfxAsclin_Asc_Config *ascConfig;         /**< \brief Configuration used for the ASC initialisation */
+    Ifx_Telemetry              *telemetry;         /**< \brief Initialised telemetry object, its channels are sampled by the application */
+    uint32                      maxBaudrate;       /**< \brief Highest baudrate requested from the module */
+    const char                 *name;              /**< \brief Bluetooth name, or NULL_PTR to keep the one of the module */
+    const char                 *pin;               /**< \brief Bluetooth PIN, or NULL_PTR to keep the one of the module */
+    Ifx_TickTime                atTimeout;         /**< \brief Time allowed to the module to answer an AT command */
+} AsclinBtLink_Config;
+
+/** \} */
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+/** \addtogroup IfxLld_Demo_AsclinBtLink_SrcDoc_Driver
+ * \{ */
+
+/** \brief Returns the baudrate of the link
+ * \param link Link handle
+ * \return Current ASC baudrate
+ */
+IFX_EXTERN uint32 AsclinBtLink_getBaudrate(AsclinBtLink *link);
+
+/** \brief Start the negotiation with the module at the highest baudrate
+ * \param link Link handle
+ * \param config Configuration structure
+ * \return TRUE on success, FALSE if the configuration is not supported
+ */
+IFX_EXTERN boolean AsclinBtLink_init(AsclinBtLink *link, const AsclinBtLink_Config *config);
+
+/** \brief Initialize the configuration with default values: up to 921600 baud, 1.5 s AT timeout
+ * \param config Configuration structure
+ * \param asc ASC initialised with dma.useTxDma
+ * \param ascConfig Configuration used for the ASC initialisation
+ */
+IFX_EXTERN void AsclinBtLink_initConfig(AsclinBtLink_Config *config, IfxAsclin_Asc *asc, const IfxAsclin_Asc_Config *ascConfig);
+
+/** \brief Returns TRUE when the negotiation is completed and the telemetry protocol runs
+ * \param link Link handle
+ */
+IFX_EXTERN boolean AsclinBtLink_isReady(AsclinBtLink *link);
+
+/** \brief Run the negotiation, then the telemetry protocol, never waits. To be called from the background loop
+ * \param link Link handle
+ */
+IFX_EXTERN void AsclinBtLink_process(AsclinBtLink *link);
+
+/** \} */
+
+#endif
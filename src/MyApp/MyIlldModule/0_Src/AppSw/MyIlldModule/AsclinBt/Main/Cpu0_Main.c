@@ -80,10 +80,13 @@ int core0_main(void)
     printf("Initialization started\n");
     AsclinAscBtDemo_init();
 
-    /* background endless loop */
+    /* background endless loop, the BT link never waits */
     printf("Background loop started\n");
-   	AsclinAscBtDemo_run();
-    printf("Background loop finished\n");
+
+    while (TRUE)
+    {
+        AsclinAscBtDemo_run();
+    }
 
     return 0;
 }
@@ -52,6 +52,11 @@
 #define CFG_ASC0_RX_BUFFER_SIZE (512)                        /**< \brief Define the Rx buffer size in byte. */
 #define CFG_ASC0_TX_BUFFER_SIZE (6 * 1024)                   /**< \brief Define the Tx buffer size in byte. */
 
+/** \brief CPU running the shell, its serial interface and their interrupts: 0, 1 or 2.
+ * A plain number, it also selects the interrupt vector table of the ASC interrupts */
+#define SHELL_CPU               1
+#define SHELL_CPU0_CALL_TIMEOUT (100)                        /**< \brief Time allowed to CPU0 to execute a command part in ms */
+
 /*______________________________________________________________________________
 ** Help Macros
 **____________________________________________________________________________*/
@@ -68,8 +68,8 @@
  * \name Interrupt service provider configuration.
  * \{ */
 
-#define ISR_PROVIDER_ASC_0    IfxSrc_Tos_cpu0         /**< \brief Define the ASC0 interrupt provider.  */
-#define ISR_PROVIDER_ASC_3    IfxSrc_Tos_cpu0         /**< \brief Define the ASC0 interrupt provider.  */
+#define ISR_PROVIDER_ASC_0    ((IfxSrc_Tos)SHELL_CPU) /**< \brief Define the ASC0 interrupt provider: the shell CPU.  */
+#define ISR_PROVIDER_ASC_3    ((IfxSrc_Tos)SHELL_CPU) /**< \brief Define the ASC3 interrupt provider: the shell CPU.  */
 
 /** \} */
 
@@ -35,6 +35,9 @@
 /*-----------------------------------Macros-----------------------------------*/
 /******************************************************************************/
 
+#define APPSHELL_MSG_CPU0_REQUEST (1)     /**< \brief IPC message: request to CPU0, param is the sequence number */
+#define APPSHELL_MSG_CPU0_REPLY   (2)     /**< \brief IPC message: reply of CPU0, param is the sequence number */
+
 //#define SHELL_HELP_DESCRIPTION_TEXT                                 \
 //    "     : Display command list."ENDL                              \
 //    "           A command followed by a question mark '?' will"ENDL \
@@ -54,6 +57,10 @@
 
 App_AsclinShellInterface g_AsclinShellInterface; /**< \brief Demo information */
 
+#if SHELL_CPU != 0
+IFX_LMU_DATA Ifx_Ipc     g_AsclinShellIpc;       /**< \brief IPC object shared by CPU0 and the shell CPU */
+#endif
+
 /******************************************************************************/
 /*-------------------------Function Prototypes--------------------------------*/
 /******************************************************************************/
@@ -62,6 +69,10 @@ boolean AppShell_status(pchar args, void *data, IfxStdIf_DPipe *io);
 boolean AppShell_info(pchar args, void *data, IfxStdIf_DPipe *io);
 boolean AppShell_led(pchar args, void *data, IfxStdIf_DPipe *io);
 
+static AppShell_Cpu0Data *AppShell_callCpu0(App_AsclinShellInterface *app, AppShell_Cpu0Function call, const AppShell_Cpu0Data *data, IfxStdIf_DPipe *io);
+static void               AppShell_getStatusCpu0(AppShell_Cpu0Data *data);
+static void               AppShell_setLedCpu0(AppShell_Cpu0Data *data);
+
 /******************************************************************************/
 /*------------------------Private Variables/Constants-------------------------*/
 /******************************************************************************/
@@ -95,7 +106,7 @@ const Ifx_Shell_Command AppShell_commands[] = {
 /** \name Interrupts for Transmit
  * \{ */
 
-IFX_INTERRUPT(asclin0TxISR, 0, ISR_PRIORITY_ASC_0_TX)
+IFX_INTERRUPT(asclin0TxISR, SHELL_CPU, ISR_PRIORITY_ASC_0_TX)
 {
     IfxAsclin_Asc_isrTransmit(&g_AsclinShellInterface.drivers.asc);
 }
@@ -105,7 +116,7 @@ IFX_INTERRUPT(asclin0TxISR, 0, ISR_PRIORITY_ASC_0_TX)
 /** \name Interrupts for Receive
  * \{ */
 
-IFX_INTERRUPT(asclin0RxISR, 0, ISR_PRIORITY_ASC_0_RX)
+IFX_INTERRUPT(asclin0RxISR, SHELL_CPU, ISR_PRIORITY_ASC_0_RX)
 {
     IfxAsclin_Asc_isrReceive(&g_AsclinShellInterface.drivers.asc);
 }
@@ -115,7 +126,7 @@ IFX_INTERRUPT(asclin0RxISR, 0, ISR_PRIORITY_ASC_0_RX)
 /** \name Interrupts for Error
  * \{ */
 
-IFX_INTERRUPT(asclin0ErISR, 0, ISR_PRIORITY_ASC_0_EX)
+IFX_INTERRUPT(asclin0ErISR, SHELL_CPU, ISR_PRIORITY_ASC_0_EX)
 {
     IfxAsclin_Asc_isrError(&g_AsclinShellInterface.drivers.asc);
 }
@@ -130,7 +141,7 @@ IFX_INTERRUPT(asclin0ErISR, 0, ISR_PRIORITY_ASC_0_EX)
 /** \name Interrupts for Transmit
  * \{ */
 
-IFX_INTERRUPT(asclin3TxISR, 0, ISR_PRIORITY_ASC_3_TX)
+IFX_INTERRUPT(asclin3TxISR, SHELL_CPU, ISR_PRIORITY_ASC_3_TX)
 {
     IfxAsclin_Asc_isrTransmit(&g_AsclinShellInterface.drivers.asc);
 }
@@ -140,7 +151,7 @@ IFX_INTERRUPT(asclin3TxISR, 0, ISR_PRIORITY_ASC_3_TX)
 /** \name Interrupts for Receive
  * \{ */
 
-IFX_INTERRUPT(asclin3RxISR, 0, ISR_PRIORITY_ASC_3_RX)
+IFX_INTERRUPT(asclin3RxISR, SHELL_CPU, ISR_PRIORITY_ASC_3_RX)
 {
     IfxAsclin_Asc_isrReceive(&g_AsclinShellInterface.drivers.asc);
 }
@@ -150,7 +161,7 @@ IFX_INTERRUPT(asclin3RxISR, 0, ISR_PRIORITY_ASC_3_RX)
 /** \name Interrupts for Error
  * \{ */
 
-IFX_INTERRUPT(asclin3ErISR, 0, ISR_PRIORITY_ASC_3_EX)
+IFX_INTERRUPT(asclin3ErISR, SHELL_CPU, ISR_PRIORITY_ASC_3_EX)
 {
     IfxAsclin_Asc_isrError(&g_AsclinShellInterface.drivers.asc);
 }
@@ -216,6 +227,120 @@ void welcomeScreen(App_AsclinShellInterface *app, IfxStdIf_DPipe *io)
 }
 
 
+/** \brief Execute a command part on CPU0 and return its result
+ *
+ * The request is sent to CPU0 with the IPC service, the function is executed by AsclinShellInterface_serveCpu0()
+ * from the CPU0 background loop. The call waits for the reply at most \ref SHELL_CPU0_CALL_TIMEOUT. After a timeout,
+ * the request stays owned by CPU0 and no new request is sent until its reply is received.
+ * \param app Demo information
+ * \param call Function executed by CPU0
+ * \param data Function parameters, NULL_PTR if none
+ * \param io Shell standard interface, for the error messages
+ * \return Returns the result, NULL_PTR if CPU0 did not execute the request
+ */
+static AppShell_Cpu0Data *AppShell_callCpu0(App_AsclinShellInterface *app, AppShell_Cpu0Function call, const AppShell_Cpu0Data *data, IfxStdIf_DPipe *io)
+{
+    AppShell_Cpu0Data *result = NULL_PTR;
+
+#if SHELL_CPU == 0
+    (void)io;
+    app->cpu0.request.call = call;
+
+    if (data != NULL_PTR)
+    {
+        app->cpu0.request.data = *data;
+    }
+
+    call(&app->cpu0.request.data);
+    result = &app->cpu0.request.data;
+#else
+    Ifx_Ipc_Message msg;
+    IfxCpu_Id       source;
+    Ifx_TickTime    deadline;
+
+    /* reply of a timed out request */
+    while ((app->cpu0.pending != FALSE) && (Ifx_Ipc_receive(app->cpu0.ipc, &source, &msg) != FALSE))
+    {
+        if ((msg.id == APPSHELL_MSG_CPU0_REPLY) && (msg.param == app->cpu0.sequence))
+        {
+            app->cpu0.pending = FALSE;
+        }
+    }
+
+    if (app->cpu0.pending != FALSE)
+    {
+        IfxStdIf_DPipe_print(io, "ERROR: CPU0 busy"ENDL);
+        return NULL_PTR;
+    }
+
+    app->cpu0.request.call = call;
+
+    if (data != NULL_PTR)
+    {
+        app->cpu0.request.data = *data;
+    }
+
+    app->cpu0.sequence++;
+    msg.id     = APPSHELL_MSG_CPU0_REQUEST;
+    msg.length = sizeof(app->cpu0.request);
+    msg.data   = &app->cpu0.request;
+    msg.param  = app->cpu0.sequence;
+
+    if (Ifx_Ipc_send(app->cpu0.ipc, IfxCpu_Id_0, &msg) == FALSE)
+    {
+        IfxStdIf_DPipe_print(io, "ERROR: CPU0 request queue full"ENDL);
+        return NULL_PTR;
+    }
+
+    app->cpu0.pending = TRUE;
+    deadline          = getDeadLine(SHELL_CPU0_CALL_TIMEOUT * TimeConst_1ms);
+
+    while ((app->cpu0.pending != FALSE) && (isDeadLine(deadline) == FALSE))
+    {
+        if ((Ifx_Ipc_receive(app->cpu0.ipc, &source, &msg) != FALSE)
+            && (msg.id == APPSHELL_MSG_CPU0_REPLY) && (msg.param == app->cpu0.sequence))
+        {
+            /* non cached address of the request, as written by CPU0 */
+            app->cpu0.pending = FALSE;
+            result            = &((AppShell_Cpu0Request *)msg.data)->data;
+        }
+    }
+
+    if (app->cpu0.pending != FALSE)
+    {
+        app->cpu0.timeouts++;
+        IfxStdIf_DPipe_print(io, "ERROR: CPU0 did not answer"ENDL);
+    }
+#endif
+
+    return result;
+}
+
+
+/** \brief Capture the state shown by the 'status' command. Executed by CPU0
+ */
+static void AppShell_getStatusCpu0(AppShell_Cpu0Data *data)
+{
+    DateTime_get(&data->status.time);
+    data->status.cpuFreq = g_AppCpu0.info.cpuFreq;
+    data->status.sysFreq = g_AppCpu0.info.sysFreq;
+    data->status.stmFreq = g_AppCpu0.info.stmFreq;
+}
+
+
+/** \brief Change and return the LED tick state of the 'led' command. Executed by CPU0
+ */
+static void AppShell_setLedCpu0(AppShell_Cpu0Data *data)
+{
+    if (data->led.tick >= 0)
+    {
+        IR_setLedTick((boolean)data->led.tick);
+    }
+
+    data->led.blink = Blink_flag;
+}
+
+
 /** \brief Handle the 'info' command.
  *
  * \par Syntax
@@ -230,17 +355,30 @@ boolean AppShell_info(pchar args, void *data, IfxStdIf_DPipe *io)
 
 boolean AppShell_led(pchar args, void *data, IfxStdIf_DPipe *io)
 {
-	sint32 led;
+	App_AsclinShellInterface *app = (App_AsclinShellInterface *)data;
+	AppShell_Cpu0Data         request;
+	AppShell_Cpu0Data        *result;
+	sint32                    led;
+
 	if (Ifx_Shell_matchToken(&args, "?") != FALSE)
     {
         IfxStdIf_DPipe_print(io, "  Syntax     : Led tick 0/1"ENDL);
     }
     else
     {
+        /* the LED tick is owned by the STM interrupt of CPU0 */
+        request.led.tick = -1;
+
     	if(Ifx_Shell_parseSInt32(&args, &led) != FALSE){
-    		IR_setLedTick((boolean)led);
+    		request.led.tick = (led != 0) ? 1 : 0;
     	}
-    	IfxStdIf_DPipe_print(io, "  Led tick: %4d "ENDL, Blink_flag);
+
+        result = AppShell_callCpu0(app, &AppShell_setLedCpu0, &request, io);
+
+        if (result != NULL_PTR)
+        {
+            IfxStdIf_DPipe_print(io, "  Led tick: %4d "ENDL, result->led.blink);
+        }
     }
 
     return TRUE;
@@ -261,12 +399,19 @@ boolean AppShell_status(pchar args, void *data, IfxStdIf_DPipe *io)
     }
     else
     {
-        Ifx_DateTime rt;
-        DateTime_get(&rt);
-        IfxStdIf_DPipe_print(io, "Real-time: %02d:%02d:%02d"ENDL, rt.hours, rt.minutes, rt.seconds);
-        IfxStdIf_DPipe_print(io, "CPU Frequency: %ld Hz"ENDL, (sint32)g_AppCpu0.info.cpuFreq);
-        IfxStdIf_DPipe_print(io, "SYS Frequency: %ld Hz"ENDL, (sint32)g_AppCpu0.info.sysFreq);
-        IfxStdIf_DPipe_print(io, "STM Frequency: %ld Hz"ENDL, (sint32)g_AppCpu0.info.stmFreq);
+        /* the state is captured by CPU0, the shell CPU prints it */
+        App_AsclinShellInterface *app = (App_AsclinShellInterface *)data;
+        AppShell_Cpu0Data        *rt  = AppShell_callCpu0(app, &AppShell_getStatusCpu0, NULL_PTR, io);
+
+        if (rt != NULL_PTR)
+        {
+            IfxStdIf_DPipe_print(io, "Real-time: %02d:%02d:%02d"ENDL, rt->status.time.hours, rt->status.time.minutes, rt->status.time.seconds);
+            IfxStdIf_DPipe_print(io, "CPU Frequency: %ld Hz"ENDL, (sint32)rt->status.cpuFreq);
+            IfxStdIf_DPipe_print(io, "SYS Frequency: %ld Hz"ENDL, (sint32)rt->status.sysFreq);
+            IfxStdIf_DPipe_print(io, "STM Frequency: %ld Hz"ENDL, (sint32)rt->status.stmFreq);
+        }
+
+        IfxStdIf_DPipe_print(io, "Shell CPU: %d, CPU0 timeouts: %lu"ENDL, SHELL_CPU, app->cpu0.timeouts);
     }
 
     return TRUE;
@@ -331,11 +476,21 @@ void initSerialInterface(void)
 }
 
 
+/** \brief Demo init API, called from the main function of \ref SHELL_CPU
+ *
+ * On a secondary CPU, it waits until AsclinShellInterface_initCpu0() is executed by CPU0.
+ */
 void AsclinShellInterface_init(void)
 {
     /** - Initialise the time constants */
     initTime();
 
+#if SHELL_CPU != 0
+    /** - Wait for the IPC object, initialised by CPU0 */
+    while (g_AsclinShellInterface.cpu0.ipc == NULL_PTR)
+    {}
+#endif
+
     /** - Initialise the serial interface and the console */
     initSerialInterface();
 
@@ -380,8 +535,52 @@ void AsclinShellInterface_init(void)
 }
 
 
+/** \brief CPU0 init API, called from the main function of CPU0 before AsclinShellInterface_init()
+ *
+ * Initialise the IPC object used to send the requests to CPU0. Both CPUs poll the messages.
+ */
+void AsclinShellInterface_initCpu0(void)
+{
+#if SHELL_CPU != 0
+    Ifx_Ipc_Config config;
+    Ifx_Ipc_initConfig(&config);
+
+    g_AsclinShellInterface.cpu0.ipc = Ifx_Ipc_init(&g_AsclinShellIpc, &config);
+#endif
+}
+
+
+/** \brief Demo run API, called from the background loop of \ref SHELL_CPU
+ */
 void AsclinShellInterface_run(void)
 {
     /** Handle the shell interface */
     Ifx_Shell_process(&g_AsclinShellInterface.shell);
 }
+
+
+/** \brief CPU0 run API, called from the background loop of CPU0 at a point where the CPU0 state is consistent
+ *
+ * Execute the requests of the shell CPU and reply. Returns at once if no request is pending.
+ */
+void AsclinShellInterface_serveCpu0(void)
+{
+#if SHELL_CPU != 0
+    Ifx_Ipc_Message msg;
+    IfxCpu_Id       source;
+
+    while (Ifx_Ipc_receive(g_AsclinShellInterface.cpu0.ipc, &source, &msg) != FALSE)
+    {
+        if (msg.id == APPSHELL_MSG_CPU0_REQUEST)
+        {
+            AppShell_Cpu0Request *request = (AppShell_Cpu0Request *)msg.data;
+
+            request->call(&request->data);
+
+            /* the request is handed back with the same sequence number */
+            msg.id = APPSHELL_MSG_CPU0_REPLY;
+            Ifx_Ipc_send(g_AsclinShellInterface.cpu0.ipc, source, &msg);
+        }
+    }
+#endif
+}
@@ -20,6 +20,12 @@
  * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
  * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
  *
+ * The shell, its serial interface and their interrupts run on \ref SHELL_CPU, so that a long command does not
+ * delay the background loop of CPU0. The commands which access the CPU0 state ('status', 'led') are split:
+ * the part accessing the state is sent as request to CPU0 with the IPC service and executed by
+ * AsclinShellInterface_serveCpu0() from the CPU0 background loop, the shell CPU waits for the reply and prints
+ * the result. CPU0 never prints nor waits for the serial interface.
+ *
  * \defgroup IfxLld_Demo_AsclinShellInterface_SrcDoc_Main Demo Source
  * \ingroup IfxLld_Demo_AsclinShellInterface_SrcDoc
  * \defgroup IfxLld_Demo_AsclinShellInterface_SrcDoc_Main_Interrupt Interrupts
@@ -37,7 +43,9 @@
 #include "SysSe/Bsp/Bsp.h"
 
 #include "SysSe/Comm/Ifx_Console.h"
+#include "SysSe/Comm/Ifx_Ipc.h"
 #include "SysSe/Comm/Ifx_Shell.h"
+#include "SysSe/Time/Ifx_DateTime.h"
 #include "Asclin/Asc/IfxAsclin_Asc.h"
 #include "BasicStm.h"
 
@@ -65,6 +73,33 @@ typedef struct
     uint8 rx[CFG_ASC0_TX_BUFFER_SIZE + sizeof(Ifx_Fifo) + 8];
 } AppAscBuffer;
 
+/** \brief Data exchanged with CPU0 by a command */
+typedef union
+{
+    struct
+    {
+        Ifx_DateTime time;              /**< \brief Real time */
+        float32      cpuFreq;           /**< \brief CPU0 frequency */
+        float32      sysFreq;           /**< \brief SPB frequency */
+        float32      stmFreq;           /**< \brief STM frequency */
+    }status;                            /**< \brief 'status' command: state captured by CPU0 */
+    struct
+    {
+        sint32  tick;                   /**< \brief New LED tick state, -1 to keep the current one */
+        boolean blink;                  /**< \brief LED tick state, returned by CPU0 */
+    }led;                               /**< \brief 'led' command */
+} AppShell_Cpu0Data;
+
+/** \brief Command part executed by CPU0 */
+typedef void (*AppShell_Cpu0Function)(AppShell_Cpu0Data *data);
+
+/** \brief Request to CPU0, handed over with the IPC message */
+typedef struct
+{
+    AppShell_Cpu0Function call;         /**< \brief Function executed by CPU0 */
+    AppShell_Cpu0Data     data;         /**< \brief Function parameters and results */
+} AppShell_Cpu0Request;
+
 /** \brief Application information */
 typedef struct
 {
@@ -84,6 +119,14 @@ typedef struct
     {
         IfxStdIf_DPipe asc;
     }stdIf;
+    struct
+    {
+        Ifx_Ipc *volatile    ipc;       /**< \brief IPC object, NULL_PTR until initialised by CPU0 */
+        AppShell_Cpu0Request request;   /**< \brief Request to CPU0, owned by CPU0 until its reply is received */
+        uint32               sequence;  /**< \brief Sequence number of the last request */
+        boolean              pending;   /**< \brief TRUE while the reply to the last request is not received */
+        uint32               timeouts;  /**< \brief Number of requests not executed by CPU0 in time */
+    }cpu0;
 } App_AsclinShellInterface;
 
 /******************************************************************************/
@@ -97,6 +140,8 @@ IFX_EXTERN App_AsclinShellInterface g_AsclinShellInterface;
 /******************************************************************************/
 
 IFX_EXTERN void AsclinShellInterface_init(void);
+IFX_EXTERN void AsclinShellInterface_initCpu0(void);
 IFX_EXTERN void AsclinShellInterface_run(void);
+IFX_EXTERN void AsclinShellInterface_serveCpu0(void);
 
 #endif
@@ -14,11 +14,31 @@
 #include "Configuration.h"
 #include "BasicStm.h"
 #include "Configuration.h"
+#include "SysSe/Time/Ifx_Profiler.h"
+#include "SysSe/Comm/Ifx_SimioPipe.h"
 
 /******************************************************************************/
 /*-----------------------------------Macros-----------------------------------*/
 /******************************************************************************/
 
+/** \brief Simulator benchmark mode, number of ticks of the simulator run
+ *
+ * In the SIMULATION build, the cycles (CCNT) and instructions (ICNT) of the STM tick are recorded by a
+ * profiler. After BASICSTM_SIM_TICKS ticks the comparator is not programmed again, and \ref BasicStm_run()
+ * writes the results through the simulated IO:
+ * \code
+ * SIMBENCH_BEGIN,BasicStm,<ticks>
+ * SIMBENCH,<cpu>,stmTick,<count>,<min cycles>,<max cycles>,<mean cycles>,<mean instructions>
+ * SIMBENCH_END
+ * \endcode
+ */
+#ifdef SIMULATION
+#ifndef BASICSTM_SIM_TICKS
+#define BASICSTM_SIM_TICKS     (2000)
+#endif
+#define BASICSTM_SIM_BIN_SHIFT (6)              /**< \brief Cycle histogram bin width is 2^6 cycles */
+#endif
+
 /******************************************************************************/
 /*--------------------------------Enumerations--------------------------------*/
 /******************************************************************************/
@@ -32,6 +52,14 @@ typedef struct
     IfxStm_CompareConfig stmConfig;         /**< \brief Stm Configuration structure */
     volatile uint8       LedBlink;          /**< \brief LED state variable */
     volatile uint32      counter;           /**< \brief interrupt counter */
+#ifdef SIMULATION
+    volatile uint32      tickCount;         /**< \brief number of ticks of the simulator run */
+    Ifx_Profiler         profiler;          /**< \brief tick cycles and instructions */
+    sint32               profilerId;        /**< \brief profiler entry ID of the tick */
+    Ifx_SimioPipe        simio;             /**< \brief simulated IO of the simulator benchmark report */
+    IfxStdIf_DPipe       simioStdIf;        /**< \brief simulated IO standard interface */
+    boolean              simReported;       /**< \brief TRUE when the simulator benchmark report is written */
+#endif
 } Basic_Stm;
 
 /******************************************************************************/
@@ -70,9 +98,20 @@ IFX_INTERRUPT(STM_Int0Handler, 0, ISR_PRIORITY_STM_INT0);
  */
 void STM_Int0Handler(void)
 {
+#ifdef SIMULATION
+    Ifx_Profiler_Mark mark;
+
+    Ifx_Profiler_start(&mark);
+#endif
     IfxStm_clearCompareFlag(g_Stm.stmSfr, g_Stm.stmConfig.comparator);
 #ifdef SIMULATION
-	IfxStm_increaseCompare(g_Stm.stmSfr, g_Stm.stmConfig.comparator, 1000);
+    g_Stm.tickCount++;
+
+    if (g_Stm.tickCount < BASICSTM_SIM_TICKS)
+    {
+        /* the last tick of the simulator run does not program the comparator again */
+        IfxStm_increaseCompare(g_Stm.stmSfr, g_Stm.stmConfig.comparator, 1000);
+    }
 #else
 	IfxStm_increaseCompare(g_Stm.stmSfr, g_Stm.stmConfig.comparator, TimeConst_1ms);
 #endif
@@ -95,6 +134,9 @@ void STM_Int0Handler(void)
 
     }
 
+#ifdef SIMULATION
+    Ifx_Profiler_stop(&g_Stm.profiler, g_Stm.profilerId, &mark);
+#endif
 }
 
 
@@ -159,10 +201,22 @@ void BasicStm_init(void)
     g_Stm.stmConfig.triggerPriority = ISR_PRIORITY_STM_INT0;
     g_Stm.stmConfig.typeOfService   = IfxSrc_Tos_cpu0;
 #ifdef SIMULATION
-    g_SrcSwInt.stmConfig.ticks      = 1000;
+    g_Stm.stmConfig.ticks           = 1000;
 #else
     g_Stm.stmConfig.ticks           = TimeConst_1ms;
 #endif
+
+#ifdef SIMULATION
+    /* simulator benchmark, blocking simulated IO: the report is complete */
+    g_Stm.tickCount   = 0;
+    g_Stm.simReported = FALSE;
+    Ifx_Profiler_init(&g_Stm.profiler, BASICSTM_SIM_BIN_SHIFT);
+    g_Stm.profilerId  = Ifx_Profiler_addEntry(&g_Stm.profiler, "stmTick", 0);
+    IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+    Ifx_SimioPipe_init(&g_Stm.simio, FALSE);
+    Ifx_SimioPipe_stdIfDPipeInit(&g_Stm.simioStdIf, &g_Stm.simio);
+#endif
+
     IfxStm_initCompare(g_Stm.stmSfr, &g_Stm.stmConfig);
 
     BlinkLed_init();
@@ -174,9 +228,24 @@ void BasicStm_init(void)
 
 /** \brief Demo run API
  *
- * This function is called from main, background loop
+ * This function is called from main, background loop. In the SIMULATION build, it writes the simulator
+ * benchmark report once the simulator run is finished.
  */
+void BasicStm_run(void)
+{
+#ifdef SIMULATION
+    if (!g_Stm.simReported && (g_Stm.tickCount >= BASICSTM_SIM_TICKS))
+    {
+        IfxStdIf_DPipe *io = &g_Stm.simioStdIf;
+
+        IfxStdIf_DPipe_print(io, "SIMBENCH_BEGIN,BasicStm,%u"ENDL, BASICSTM_SIM_TICKS);
+        Ifx_Profiler_printRecords(&g_Stm.profiler, "SIMBENCH", io);
+        IfxStdIf_DPipe_print(io, "SIMBENCH_END"ENDL);
 
+        g_Stm.simReported = TRUE;
+    }
+#endif
+}
 
 
 void IR_setLedTick(boolean led){
@@ -75,12 +75,22 @@ int core0_main(void)
 
     /* Demo init */
     BasicStm_init();
+    AsclinShellInterface_initCpu0();
+#if SHELL_CPU == 0
     AsclinShellInterface_init();
+#endif
 
     /* background endless loop */
     while (TRUE)
     {
+#if SHELL_CPU == 0
     	AsclinShellInterface_run();
+#endif
+
+        /* safe point: the shell requests accessing the CPU0 state are executed here */
+        AsclinShellInterface_serveCpu0();
+
+        BasicStm_run();
 
         REGRESSION_RUN_STOP_PASS;
     }
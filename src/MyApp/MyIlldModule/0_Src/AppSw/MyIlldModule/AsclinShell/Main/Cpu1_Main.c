@@ -26,6 +26,7 @@
 /******************************************************************************/
 
 #include "Cpu0_Main.h"
+#include "AsclinShellInterface.h"
 
 /** \brief Main entry point for CPU1  */
 void core1_main(void)
@@ -36,7 +37,16 @@ void core1_main(void)
      * */
     IfxScuWdt_disableCpuWatchdog(IfxScuWdt_getCpuWatchdogPassword());
 
+#if SHELL_CPU == 1
+    /** - Shell, once CPU0 has initialised the IPC */
+    AsclinShellInterface_init();
+#endif
+
     /** - Background loop */
     while (TRUE)
-    {}
+    {
+#if SHELL_CPU == 1
+        AsclinShellInterface_run();
+#endif
+    }
 }
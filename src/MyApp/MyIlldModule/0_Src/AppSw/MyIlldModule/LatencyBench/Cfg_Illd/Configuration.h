@@ -0,0 +1,105 @@
+/**
+ * \file Configuration.h
+ * \brief Global configuration
+ *
+ * \version iLLD_Demos_1_0_1_4_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup IfxLld_Demo_LatencyBenchDemo_SrcDoc_Config Application configuration
+ * \ingroup IfxLld_Demo_LatencyBenchDemo_SrcDoc
+ *
+ *
+ */
+
+#ifndef CONFIGURATION_H
+#define CONFIGURATION_H
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "Ifx_Cfg.h"
+#include "ConfigurationIsr.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/* APPLICATION_KIT_TC237 Ȥ SHIELD_BUDDY ߿ Ѱ */
+#define APPLICATION_KIT_TC237 1
+#define SHIELD_BUDDY 2
+
+/**
+ * \name Latency benchmark pins.
+ * The servo and the trigger outputs must be channels of the same TOM TGC. Each output pin is also read back by
+ * a TIM0 channel of the same pad, the marker pin is a GPIO read by TIM0 channel x (rising edges) and x + 1
+ * (falling edges, channel input control). The servo and the trigger TIM channels must not be x + 1.
+ * \{
+ */
+#if BOARD == APPLICATION_KIT_TC237
+#define LATENCY_SERVO             IfxGtm_TOM0_7_TOUT32_P33_10_OUT  /**< \brief Steering servo PWM output */
+#define LATENCY_SERVO_TIN         IfxGtm_TIM0_0_TIN32_P33_10_IN    /**< \brief TIM input reading back the servo PWM */
+#define LATENCY_TRIGGER           IfxGtm_TOM0_5_TOUT23_P33_1_OUT   /**< \brief Output triggering the conversion */
+#define LATENCY_TRIGGER_TIN       IfxGtm_TIM0_5_TIN23_P33_1_IN     /**< \brief TIM input reading back the trigger */
+#define LATENCY_TRIGGER_ADC       IfxGtm_Trig_AdcTrigChannel_5     /**< \brief GTM ADC trigger channel of LATENCY_TRIGGER */
+#define LATENCY_MARKER_TIN        IfxGtm_TIM0_6_TIN24_P33_2_IN     /**< \brief Marker GPIO, set while the control computation runs */
+#define LATENCY_SENSOR            9                                /**< \brief VADC group 0 channel of the sensor (camera analog output) */
+#elif BOARD == SHIELD_BUDDY
+#define LATENCY_SERVO             IfxGtm_TOM0_12_TOUT4_P02_4_OUT   /**< \brief Steering servo PWM output */
+#define LATENCY_SERVO_TIN         IfxGtm_TIM0_4_TIN4_P02_4_IN      /**< \brief TIM input reading back the servo PWM */
+#define LATENCY_TRIGGER           IfxGtm_TOM0_13_TOUT5_P02_5_OUT   /**< \brief Output triggering the conversion */
+#define LATENCY_TRIGGER_TIN       IfxGtm_TIM0_5_TIN5_P02_5_IN      /**< \brief TIM input reading back the trigger */
+#define LATENCY_TRIGGER_ADC       IfxGtm_Trig_AdcTrigChannel_13    /**< \brief GTM ADC trigger channel of LATENCY_TRIGGER */
+#define LATENCY_MARKER_TIN        IfxGtm_TIM0_6_TIN6_P02_6_IN      /**< \brief Marker GPIO, set while the control computation runs */
+#define LATENCY_SENSOR            0                                /**< \brief VADC group 0 channel of the sensor (camera analog output) */
+#endif
+/** \} */
+
+/**
+ * \name Background load pins.
+ * The CAN nodes and the ASCLIN run in loop back mode without pins. The TFT refresh is emulated on QSPI0 with the
+ * pins of the display.
+ * \{
+ */
+#define LOAD_QSPI_SCLK            IfxQspi0_SCLK_P20_11_OUT
+#define LOAD_QSPI_MTSR            IfxQspi0_MTSR_P20_14_OUT
+#define LOAD_QSPI_MRST            IfxQspi0_MRSTA_P20_12_IN
+#define LOAD_QSPI_SLSO            IfxQspi0_SLSO7_P33_5_OUT
+#define LOAD_ASCLIN               MODULE_ASCLIN1                   /**< \brief ASCLIN module loaded, ASCLIN0 is used by printf */
+/** \} */
+
+/** \addtogroup IfxLld_Demo_LatencyBenchDemo_SrcDoc_Config
+ * \{ */
+/*______________________________________________________________________________
+** Help Macros
+**____________________________________________________________________________*/
+/**
+ * \name Macros for Regression Runs
+ * \{
+ */
+#ifndef REGRESSION_RUN_STOP_PASS
+#define REGRESSION_RUN_STOP_PASS
+#endif
+
+#ifndef REGRESSION_RUN_STOP_FAIL
+#define REGRESSION_RUN_STOP_FAIL
+#endif
+
+/** \} */
+#define ADC_STARTUP_CALIBRATION 1  /**< \brief Enable Calibration for TC27xB,TC26x and TC29x Derivatives */
+
+/** \} */
+#endif
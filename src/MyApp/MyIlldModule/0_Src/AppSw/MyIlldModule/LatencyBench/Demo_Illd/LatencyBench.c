@@ -0,0 +1,468 @@
+/**
+ * \file LatencyBench.c
+ * \brief Sensor to actuator latency measurement: GTM triggered conversion, control computation, servo PWM update
+ *
+ * \version iLLD_Demos_1_0_1_4_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "LatencyBench.h"
+#include <Cpu/Std/IfxCpu.h>
+#include <string.h>
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+#define LATENCYBENCH_CAPTURE_TRIGGER     (0)            /**< \brief Capture of the trigger falling edges (T0) */
+#define LATENCYBENCH_CAPTURE_MARKER_RISE (1)            /**< \brief Capture of the marker rising edges (T1) */
+#define LATENCYBENCH_CAPTURE_MARKER_FALL (2)            /**< \brief Capture of the marker falling edges (T2) */
+#define LATENCYBENCH_CAPTURE_SERVO       (3)            /**< \brief Capture of the servo rising edges (T3) */
+#define LATENCYBENCH_TIME_MASK           (0xFFFFFFu)    /**< \brief TBU_TS0 and TIM counters are 24 bit */
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+static void   LatencyBench_initCapture(LatencyBench *bench, uint8 index, IfxGtm_Tim_TinMap *tin, IfxGtm_Tim_Ch channel, boolean risingEdge);
+static void   LatencyBench_initTrigger(Ifx_GTM_TOM *tom, Ifx_GTM_TOM_TGC *tgc, IfxGtm_Tom_Ch channel, IfxGtm_Tom_Ch_ClkSrc clock, uint32 period);
+static uint32 LatencyBench_compute(LatencyBench_Control *control, uint16 sample);
+static void   LatencyBench_record(LatencyBench_Histogram *histogram, uint32 latency);
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+/** \brief Configure a TIM0 channel in input event mode, GPR0 captures TBU_TS0 at each selected edge
+ *
+ * The pad is not reconfigured: the TIM reads the output pins through their input stage. The marker falling
+ * edges use the input of the previous channel (channel input control).
+ */
+static void LatencyBench_initCapture(LatencyBench *bench, uint8 index, IfxGtm_Tim_TinMap *tin, IfxGtm_Tim_Ch channel, boolean risingEdge)
+{
+    Ifx_GTM_TIM         *tim = &MODULE_GTM.TIM[tin->tim];
+    Ifx_GTM_TIM_CH      *ch  = IfxGtm_Tim_getChannel(tim, channel);
+    Ifx_GTM_TIM_CH_CTRL  ctrl;
+
+    IfxGtm_Tim_Ch_resetChannel(tim, channel);
+
+    if (channel == tin->channel)
+    {
+        IfxGtm_PinMap_setTimTin(tin, IfxPort_InputMode_undefined);
+    }
+
+    ctrl.U            = 0;
+    ctrl.B.TIM_MODE   = IfxGtm_Tim_Mode_inputEvent;
+    ctrl.B.CICTRL     = (channel != tin->channel) ? 1 : 0;
+    ctrl.B.GPR0_SEL   = IfxGtm_Tim_GprSel_tbuTs0;
+    ctrl.B.GPR1_SEL   = IfxGtm_Tim_GprSel_tbuTs0;
+    ctrl.B.DSL        = risingEdge ? 1 : 0;
+    ctrl.B.CLK_SEL    = IfxGtm_Cmu_Clk_0;
+    ctrl.B.TIM_EN     = 1;
+    ch->CTRL.U        = ctrl.U;
+
+    bench->capture[index]   = ch;
+    bench->edgeCount[index] = 0;
+}
+
+
+/** \brief Configure the trigger TOM channel, started by the next trigger of its TGC
+ *
+ * The output is high during the first half of the period, the falling edge in the middle of the period starts
+ * the conversion.
+ */
+static void LatencyBench_initTrigger(Ifx_GTM_TOM *tom, Ifx_GTM_TOM_TGC *tgc, IfxGtm_Tom_Ch channel, IfxGtm_Tom_Ch_ClkSrc clock, uint32 period)
+{
+    IfxGtm_Tom_Ch_setClockSource(tom, channel, clock);
+    IfxGtm_Tom_Ch_setSignalLevel(tom, channel, Ifx_ActiveState_high);
+    IfxGtm_Tom_Ch_setCompare(tom, channel, period, period / 2);
+    IfxGtm_Tom_Ch_setCompareShadow(tom, channel, period, period / 2);
+
+    IfxGtm_Tom_Tgc_setChannelForceUpdate(tgc, channel, TRUE, TRUE);
+    IfxGtm_Tom_Tgc_enableChannel(tgc, channel, TRUE, FALSE);
+    IfxGtm_Tom_Tgc_enableChannelOutput(tgc, channel, TRUE, FALSE);
+}
+
+
+/** \brief Reference control computation, returns the new servo pulse width in TOM ticks
+ *
+ * The sample replaces one pixel of the frame, then the frame is analysed as by the Racer: min, max, threshold
+ * and the longest run of dark pixels. The center of the run is the line position, the PD controller steers
+ * toward the frame center.
+ */
+static uint32 LatencyBench_compute(LatencyBench_Control *control, uint16 sample)
+{
+    uint16  min = 0xFFFF;
+    uint16  max = 0;
+    uint16  threshold;
+    uint8   runStart = 0;
+    uint8   bestStart = 0;
+    uint8   bestLength = 0;
+    uint8   length = 0;
+    uint8   pixel;
+    float32 error;
+    float32 pulse;
+
+    control->frame[control->pixel] = sample;
+    control->pixel                 = (uint8)((control->pixel + 1) % LATENCYBENCH_FRAME_PIXELS);
+
+    for (pixel = 0; pixel < LATENCYBENCH_FRAME_PIXELS; pixel++)
+    {
+        min = __min(min, control->frame[pixel]);
+        max = __max(max, control->frame[pixel]);
+    }
+
+    threshold = (uint16)((min + max) / 2);
+
+    for (pixel = 0; pixel < LATENCYBENCH_FRAME_PIXELS; pixel++)
+    {
+        if (control->frame[pixel] < threshold)
+        {
+            if (length == 0)
+            {
+                runStart = pixel;
+            }
+
+            length++;
+
+            if (length > bestLength)
+            {
+                bestLength = length;
+                bestStart  = runStart;
+            }
+        }
+        else
+        {
+            length = 0;
+        }
+    }
+
+    if (bestLength != 0)
+    {
+        error = (bestStart + (bestLength - 1) * 0.5f) - ((LATENCYBENCH_FRAME_PIXELS - 1) * 0.5f);
+    }
+    else
+    {
+        error = control->lastError;
+    }
+
+    pulse              = control->pulseCenter + (control->kp * error) + (control->kd * (error - control->lastError));
+    control->lastError = error;
+
+    pulse              = __maxf(pulse, (float32)control->pulseMin);
+    pulse              = __minf(pulse, (float32)control->pulseMax);
+
+    return (uint32)pulse;
+}
+
+
+/** \brief Add one latency to the distribution of a stage
+ */
+static void LatencyBench_record(LatencyBench_Histogram *histogram, uint32 latency)
+{
+    uint32 bin = latency / histogram->binWidth;
+
+    histogram->count++;
+    histogram->min  = __min(histogram->min, latency);
+    histogram->max  = __max(histogram->max, latency);
+    histogram->sum += latency;
+    histogram->bins[__min(bin, LATENCYBENCH_HISTOGRAM_BINS)]++;
+}
+
+
+void LatencyBench_initConfig(LatencyBench_Config *config, IfxVadc_Adc *vadc)
+{
+    config->servo                                     = NULL_PTR;
+    config->servoTin                                  = NULL_PTR;
+    config->trigger                                   = NULL_PTR;
+    config->triggerTin                                = NULL_PTR;
+    config->triggerAdcChannel                         = (IfxGtm_Trig_AdcTrigChannel)0;
+    config->markerTin                                 = NULL_PTR;
+    config->loopFrequency                             = 250;
+    config->pulseMin                                  = 1.0e-3;
+    config->pulseMax                                  = 2.0e-3;
+    config->vadc                                      = vadc;
+    config->groupId                                   = IfxVadc_GroupId_0;
+    config->triggerInput                              = IfxVadc_TriggerSource_2;
+    config->channel                                   = IfxVadc_ChannelId_0;
+    config->resultPriority                            = 0;
+    config->resultServProvider                        = IfxSrc_Tos_cpu0;
+    config->edgePriority                              = 0;
+    config->edgeServProvider                          = IfxSrc_Tos_cpu0;
+    config->binWidth[LatencyBench_Stage_adc]          = 0.5e-6;
+    config->binWidth[LatencyBench_Stage_control]      = 1.0e-6;
+    config->binWidth[LatencyBench_Stage_response]     = 1.0e-6;
+    config->binWidth[LatencyBench_Stage_output]       = 100.0e-6;
+}
+
+
+boolean LatencyBench_init(LatencyBench *bench, const LatencyBench_Config *config)
+{
+    Ifx_GTM             *gtm = &MODULE_GTM;
+    Ifx_GTM_TOM         *tom;
+    IfxGtm_Cmu_Fxclk     clock;
+    float32              frequency = 0;
+    uint8                stage;
+
+    if ((config->servo->tom != config->trigger->tom)
+        || ((config->servo->channel / 8) != (config->trigger->channel / 8))
+        || (config->markerTin->channel >= IfxGtm_Tim_Ch_7)
+        || (config->servoTin->channel == (config->markerTin->channel + 1))
+        || (config->triggerTin->channel == (config->markerTin->channel + 1))
+        || (config->resultPriority == 0) || (config->edgePriority == 0))
+    {
+        return FALSE;
+    }
+
+    memset(bench, 0, sizeof(*bench));
+
+    /* GTM clocks: the period must fit in the 16 bit TOM counter, CMU_CLK0 = GCLK clocks TBU_TS0 */
+    IfxGtm_enable(gtm);
+    IfxGtm_Cmu_setGclkFrequency(gtm, IfxGtm_Cmu_getModuleFrequency(gtm));
+    IfxGtm_Cmu_setClkFrequency(gtm, IfxGtm_Cmu_Clk_0, IfxGtm_Cmu_getGclkFrequency(gtm));
+    IfxGtm_Cmu_enableClocks(gtm, IFXGTM_CMU_CLKEN_FXCLK | IFXGTM_CMU_CLKEN_CLK0);
+    IfxGtm_Tbu_enableChannel(gtm, IfxGtm_Tbu_Ts_0);
+
+    for (clock = IfxGtm_Cmu_Fxclk_0; clock <= IfxGtm_Cmu_Fxclk_4; clock++)
+    {
+        frequency     = IfxGtm_Cmu_getFxClkFrequency(gtm, clock, TRUE);
+        bench->period = (uint32)(frequency / config->loopFrequency + 0.5);
+
+        if (bench->period <= 0xFFFF)
+        {
+            break;
+        }
+    }
+
+    bench->tbuFrequency  = IfxGtm_Tbu_getClockFrequency(gtm, IfxGtm_Tbu_Ts_0);
+    bench->periodTicks   = (uint32)(bench->tbuFrequency / config->loopFrequency + 0.5);
+
+    /* a sample must be evaluated before TBU_TS0 wraps */
+    if ((clock > IfxGtm_Cmu_Fxclk_4) || (bench->period < 100) || (bench->periodTicks > (LATENCYBENCH_TIME_MASK / 2)))
+    {
+        return FALSE;
+    }
+
+    bench->loopFrequency = frequency / bench->period;
+
+    for (stage = 0; stage < LatencyBench_Stage_count; stage++)
+    {
+        bench->histogram[stage].binWidth = __max(1, (uint32)(config->binWidth[stage] * bench->tbuFrequency + 0.5));
+    }
+
+    /* control computation: a dark line in the middle of the frame */
+    {
+        LatencyBench_Control *control = &bench->control;
+        uint8                 pixel;
+
+        for (pixel = 0; pixel < LATENCYBENCH_FRAME_PIXELS; pixel++)
+        {
+            control->frame[pixel] = ((pixel >= 56) && (pixel < 72)) ? 400 : 3000;
+        }
+
+        control->pulseMin    = (uint32)(config->pulseMin * frequency);
+        control->pulseMax    = (uint32)(config->pulseMax * frequency);
+        control->pulseCenter = (control->pulseMin + control->pulseMax) / 2;
+        control->kp          = (control->pulseMax - control->pulseMin) / (float32)LATENCYBENCH_FRAME_PIXELS;
+        control->kd          = control->kp * 0.5f;
+
+        if (control->pulseMax >= bench->period)
+        {
+            return FALSE;
+        }
+    }
+
+    /* VADC group: one conversion of the sensor per falling edge of the trigger */
+    {
+        IfxVadc_Adc_GroupConfig adcGroupConfig;
+        IfxVadc_Adc_initGroupConfig(&adcGroupConfig, config->vadc);
+
+        adcGroupConfig.groupId                                 = config->groupId;
+        adcGroupConfig.master                                  = config->groupId;
+        adcGroupConfig.arbiter.requestSlotScanEnabled          = TRUE;
+        adcGroupConfig.scanRequest.autoscanEnabled             = FALSE;
+        adcGroupConfig.scanRequest.triggerConfig.triggerMode   = IfxVadc_TriggerMode_uponFallingEdge;
+        adcGroupConfig.scanRequest.triggerConfig.triggerSource = config->triggerInput;
+        adcGroupConfig.scanRequest.triggerConfig.gatingMode    = IfxVadc_GatingMode_always;
+
+        IfxVadc_Adc_initGroup(&bench->adcGroup, &adcGroupConfig);
+    }
+
+    {
+        IfxVadc_Adc_ChannelConfig adcChannelConfig;
+        IfxVadc_Adc_initChannelConfig(&adcChannelConfig, &bench->adcGroup);
+
+        adcChannelConfig.channelId          = config->channel;
+        adcChannelConfig.resultRegister     = IfxVadc_ChannelResult_0;
+        adcChannelConfig.resultPriority     = config->resultPriority;
+        adcChannelConfig.resultServProvider = config->resultServProvider;
+
+        IfxVadc_Adc_initChannel(&bench->adcChannel, &adcChannelConfig);
+    }
+
+    IfxVadc_Adc_setScan(&bench->adcGroup, 1UL << config->channel, 1UL << config->channel);
+
+    if (IfxGtm_Trig_toVadc(gtm, (IfxGtm_Trig_AdcGroup)config->groupId, IfxGtm_Trig_AdcTrig_0,
+            (config->trigger->tom == IfxGtm_Tom_0) ? IfxGtm_Trig_AdcTrigSource_tom0 : IfxGtm_Trig_AdcTrigSource_tom1,
+            config->triggerAdcChannel) == FALSE)
+    {
+        return FALSE;
+    }
+
+    /* marker pin, low while idle */
+    bench->marker = config->markerTin->pin;
+    IfxPort_setPinLow(bench->marker.port, bench->marker.pinIndex);
+    IfxPort_setPinModeOutput(bench->marker.port, bench->marker.pinIndex, IfxPort_OutputMode_pushPull, IfxPort_OutputIdx_general);
+
+    /* capture channels, enabled before the TOM channels start */
+    LatencyBench_initCapture(bench, LATENCYBENCH_CAPTURE_TRIGGER, config->triggerTin, config->triggerTin->channel, FALSE);
+    LatencyBench_initCapture(bench, LATENCYBENCH_CAPTURE_MARKER_RISE, config->markerTin, config->markerTin->channel, TRUE);
+    LatencyBench_initCapture(bench, LATENCYBENCH_CAPTURE_MARKER_FALL, config->markerTin, (IfxGtm_Tim_Ch)(config->markerTin->channel + 1), FALSE);
+    LatencyBench_initCapture(bench, LATENCYBENCH_CAPTURE_SERVO, config->servoTin, config->servoTin->channel, TRUE);
+
+    {
+        volatile Ifx_SRC_SRCR *src = IfxGtm_Tim_Ch_getSrcPointer(gtm, config->servoTin->tim, config->servoTin->channel);
+
+        IfxGtm_Tim_Ch_setChannelNotification(bench->capture[LATENCYBENCH_CAPTURE_SERVO], TRUE, FALSE, FALSE, FALSE);
+        IfxSrc_init(src, config->edgeServProvider, config->edgePriority);
+        IfxSrc_enable(src);
+    }
+
+    /* servo PWM and trigger, started in phase by the TGC */
+    {
+        IfxGtm_Tom_Pwm_Config pwmConfig;
+        IfxGtm_Tom_Pwm_initConfig(&pwmConfig, gtm);
+
+        pwmConfig.tom                      = config->servo->tom;
+        pwmConfig.tomChannel               = config->servo->channel;
+        pwmConfig.clock                    = (IfxGtm_Tom_Ch_ClkSrc)clock;
+        pwmConfig.period                   = bench->period;
+        pwmConfig.dutyCycle                = bench->control.pulseCenter;
+        pwmConfig.signalLevel              = Ifx_ActiveState_high;
+        pwmConfig.synchronousUpdateEnabled = TRUE;
+        pwmConfig.immediateStartEnabled    = FALSE;
+        pwmConfig.pin.outputPin            = config->servo;
+        pwmConfig.pin.outputMode           = IfxPort_OutputMode_pushPull;
+        pwmConfig.pin.padDriver            = IfxPort_PadDriver_cmosAutomotiveSpeed1;
+
+        IfxGtm_Tom_Pwm_init(&bench->servo, &pwmConfig);
+    }
+
+    tom        = &gtm->TOM[config->trigger->tom];
+    bench->tgc = bench->servo.tgc[0];
+
+    LatencyBench_initTrigger(tom, bench->tgc, config->trigger->channel, (IfxGtm_Tom_Ch_ClkSrc)clock, bench->period);
+    IfxGtm_PinMap_setTomTout(config->trigger, IfxPort_OutputMode_pushPull, IfxPort_PadDriver_cmosAutomotiveSpeed1);
+
+    IfxGtm_Tom_Tgc_trigger(bench->tgc);
+
+    return TRUE;
+}
+
+
+void LatencyBench_isrResult(LatencyBench *bench)
+{
+    Ifx_VADC_RES result;
+    uint32       pulse;
+
+    IfxPort_setPinHigh(bench->marker.port, bench->marker.pinIndex);
+
+    result = IfxVadc_Adc_getResult(&bench->adcChannel);
+    pulse  = LatencyBench_compute(&bench->control, (uint16)result.B.RESULT);
+    IfxGtm_Tom_Ch_setCompareOneShadow(bench->servo.tom, bench->servo.tomChannel, pulse);
+
+    IfxPort_setPinLow(bench->marker.port, bench->marker.pinIndex);
+}
+
+
+void LatencyBench_isrEdge(LatencyBench *bench)
+{
+    uint32 time[4];
+    uint32 edges[4];
+    uint32 backlog;
+    uint8  index;
+
+    IfxGtm_Tim_Ch_clearNewValueEvent(bench->capture[LATENCYBENCH_CAPTURE_SERVO]);
+
+    for (index = 0; index < 4; index++)
+    {
+        uint32 count = bench->capture[index]->CNT.B.CNT;
+
+        time[index]             = bench->capture[index]->GPR0.B.GPR0;
+        edges[index]            = (count - bench->edgeCount[index]) & LATENCYBENCH_TIME_MASK;
+        bench->edgeCount[index] = count;
+    }
+
+    /* triggers whose update was not written before this servo period started */
+    backlog = (bench->edgeCount[LATENCYBENCH_CAPTURE_TRIGGER] - bench->edgeCount[LATENCYBENCH_CAPTURE_MARKER_FALL] - bench->backlogOffset) & LATENCYBENCH_TIME_MASK;
+
+    if ((bench->recording == FALSE) || (edges[LATENCYBENCH_CAPTURE_TRIGGER] == 0))
+    {
+        /* not recording, or first period: no trigger yet */
+    }
+    else if (backlog != 0)
+    {
+        bench->missed++;
+    }
+    else
+    {
+        uint32 t3   = time[LATENCYBENCH_CAPTURE_SERVO];
+        uint32 age0 = (t3 - time[LATENCYBENCH_CAPTURE_TRIGGER]) & LATENCYBENCH_TIME_MASK;
+        uint32 age1 = (t3 - time[LATENCYBENCH_CAPTURE_MARKER_RISE]) & LATENCYBENCH_TIME_MASK;
+        uint32 age2 = (t3 - time[LATENCYBENCH_CAPTURE_MARKER_FALL]) & LATENCYBENCH_TIME_MASK;
+
+        if ((edges[LATENCYBENCH_CAPTURE_TRIGGER] == 1) && (edges[LATENCYBENCH_CAPTURE_MARKER_RISE] == 1)
+            && (edges[LATENCYBENCH_CAPTURE_MARKER_FALL] == 1) && (age0 >= age1) && (age1 >= age2) && (age0 < bench->periodTicks))
+        {
+            LatencyBench_record(&bench->histogram[LatencyBench_Stage_adc], age0 - age1);
+            LatencyBench_record(&bench->histogram[LatencyBench_Stage_control], age1 - age2);
+            LatencyBench_record(&bench->histogram[LatencyBench_Stage_response], age0 - age2);
+            LatencyBench_record(&bench->histogram[LatencyBench_Stage_output], age0);
+        }
+        else
+        {
+            bench->lost++;
+        }
+    }
+}
+
+
+void LatencyBench_start(LatencyBench *bench)
+{
+    boolean interruptState = IfxCpu_disableInterrupts();
+    uint8   stage;
+
+    for (stage = 0; stage < LatencyBench_Stage_count; stage++)
+    {
+        LatencyBench_Histogram *histogram = &bench->histogram[stage];
+        uint32                  binWidth  = histogram->binWidth;
+
+        memset(histogram, 0, sizeof(*histogram));
+        histogram->binWidth = binWidth;
+        histogram->min      = 0xFFFFFFFF;
+    }
+
+    bench->backlogOffset = (bench->capture[LATENCYBENCH_CAPTURE_TRIGGER]->CNT.B.CNT - bench->capture[LATENCYBENCH_CAPTURE_MARKER_FALL]->CNT.B.CNT) & LATENCYBENCH_TIME_MASK;
+    bench->missed        = 0;
+    bench->lost          = 0;
+    bench->recording     = TRUE;
+
+    IfxCpu_restoreInterrupts(interruptState);
+}
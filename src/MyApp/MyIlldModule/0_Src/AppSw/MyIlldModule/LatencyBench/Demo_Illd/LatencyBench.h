@@ -0,0 +1,238 @@
+/**
+ * \file LatencyBench.h
+ * \brief Sensor to actuator latency measurement: GTM triggered conversion, control computation, servo PWM update
+ *
+ * \version iLLD_Demos_1_0_1_4_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * The control loop of the Racer, line scan camera to steering servo, is reduced to one sample per period:
+ * - servo: IfxGtm_Tom_Pwm with synchronous update, high from the period start for the pulse width. The pulse
+ *   width written during a period is output from the next period start.
+ * - trigger: channel of the same TGC, started in phase with the servo, falling in the middle of the period.
+ *   The falling edge starts the conversion of the sensor channel through the GTM ADC trigger 0.
+ * - the result interrupt sets the marker pin, runs the reference control computation (line position in a
+ *   camera frame, PD steering controller), writes the new pulse width and clears the marker pin.
+ *
+ * The stages are timestamped from the actual pin activity: each pin is read back by a TIM0 channel in input
+ * event mode, which captures the GTM time base TBU_TS0 (CMU_CLK0 = GCLK) at each edge.
+ *
+ * \code
+ * servo    --____________________________------______________  ...
+ * trigger  ---------------______________________________-------  ...
+ * marker   _________________________--________________________  ...
+ *                         T0       T1 T2                T3
+ * \endcode
+ *
+ * - adc: T0 trigger falling edge -> T1 marker rising edge (conversion and interrupt latency)
+ * - control: T1 -> T2 marker falling edge (computation and PWM write)
+ * - response: T0 -> T2, the new pulse width is ready
+ * - output: T0 -> T3 servo rising edge of the period carrying the new pulse width (sensor to actuator)
+ *
+ * A sample is evaluated at the servo rising edge T3 (TIM interrupt). A period started before the marker falling
+ * edge of the previous trigger is a missed deadline: the servo outputs the previous pulse width once more.
+ * The samples which cannot be attributed to one trigger (edge counts not 1, e.g. after a missed deadline) are
+ * counted as lost. Each stage is accumulated in a histogram of LATENCYBENCH_HISTOGRAM_BINS bins plus one
+ * overflow bin, with min, max and mean.
+ *
+ * \defgroup IfxLld_Demo_LatencyBenchDemo_SrcDoc_Driver Latency measurement
+ * \ingroup IfxLld_Demo_LatencyBenchDemo_SrcDoc
+ */
+
+#ifndef LATENCYBENCH_H
+#define LATENCYBENCH_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include <Vadc/Std/IfxVadc.h>
+#include <Vadc/Adc/IfxVadc_Adc.h>
+#include <Gtm/Std/IfxGtm_Tim.h>
+#include <Gtm/Std/IfxGtm_Tbu.h>
+#include <Gtm/Tom/Pwm/IfxGtm_Tom_Pwm.h>
+#include <Gtm/Trig/IfxGtm_Trig.h>
+#include <_PinMap/IfxGtm_PinMap.h>
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+#define LATENCYBENCH_HISTOGRAM_BINS (32)        /**< \brief Number of histogram bins, without the overflow bin */
+#define LATENCYBENCH_FRAME_PIXELS   (128)       /**< \brief Pixels of the frame analysed by the control computation */
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+/** \addtogroup IfxLld_Demo_LatencyBenchDemo_SrcDoc_Driver
+ * \{ */
+
+/** \brief Measured stages of the control loop
+ */
+typedef enum
+{
+    LatencyBench_Stage_adc = 0,     /**< \brief trigger -> conversion result interrupt */
+    LatencyBench_Stage_control,     /**< \brief control computation and PWM write */
+    LatencyBench_Stage_response,    /**< \brief trigger -> PWM write done */
+    LatencyBench_Stage_output,      /**< \brief trigger -> servo period carrying the new pulse width */
+    LatencyBench_Stage_count
+} LatencyBench_Stage;
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+
+/** \brief Latency distribution of one stage, in TBU_TS0 ticks
+ */
+typedef struct
+{
+    uint32 count;                                       /**< \brief Number of samples */
+    uint32 min;                                         /**< \brief Minimal latency */
+    uint32 max;                                         /**< \brief Maximal latency */
+    uint64 sum;                                         /**< \brief Sum of the latencies, for the mean */
+    uint32 binWidth;                                    /**< \brief Width of one bin */
+    uint32 bins[LATENCYBENCH_HISTOGRAM_BINS + 1];       /**< \brief Samples per bin, the last bin counts the latencies above the histogram */
+} LatencyBench_Histogram;
+
+/** \brief Reference control computation: PD steering controller on the line position
+ */
+typedef struct
+{
+    uint16  frame[LATENCYBENCH_FRAME_PIXELS];   /**< \brief Synthetic camera frame, one pixel replaced by each conversion */
+    uint8   pixel;                              /**< \brief Pixel replaced by the next conversion */
+    float32 kp;                                 /**< \brief Proportional gain, pulse width in ticks per pixel */
+    float32 kd;                                 /**< \brief Derivative gain, pulse width in ticks per pixel and sample */
+    float32 lastError;                          /**< \brief Line position error of the previous sample */
+    uint32  pulseCenter;                        /**< \brief Pulse width for a centered line, in TOM ticks */
+    uint32  pulseMin;                           /**< \brief Minimal pulse width, in TOM ticks */
+    uint32  pulseMax;                           /**< \brief Maximal pulse width, in TOM ticks */
+} LatencyBench_Control;
+
+/** \brief Latency measurement handle
+ */
+typedef struct
+{
+    IfxGtm_Tom_Pwm_Driver   servo;                                      /**< \brief Servo PWM */
+    Ifx_GTM_TOM_TGC        *tgc;                                        /**< \brief TGC starting the servo and the trigger */
+    IfxVadc_Adc_Group       adcGroup;                                   /**< \brief VADC group converting the sensor */
+    IfxVadc_Adc_Channel     adcChannel;                                 /**< \brief VADC channel of the sensor */
+    IfxPort_Pin             marker;                                     /**< \brief Marker pin */
+    Ifx_GTM_TIM_CH         *capture[4];                                 /**< \brief TIM channels: trigger, marker rising, marker falling, servo */
+    uint32                  edgeCount[4];                               /**< \brief Edge counts of the capture channels at the previous servo edge */
+    uint32                  backlogOffset;                              /**< \brief Trigger edges - marker falling edges at LatencyBench_start(), spurious edges of the pin setup */
+    LatencyBench_Control    control;                                    /**< \brief Reference control computation */
+    LatencyBench_Histogram  histogram[LatencyBench_Stage_count];        /**< \brief Latency distribution of each stage */
+    uint32                  period;                                     /**< \brief PWM period in TOM ticks */
+    uint32                  periodTicks;                                /**< \brief PWM period in TBU_TS0 ticks */
+    float32                 tbuFrequency;                               /**< \brief TBU_TS0 frequency in Hz */
+    float32                 loopFrequency;                              /**< \brief Actual loop frequency in Hz */
+    volatile boolean        recording;                                  /**< \brief TRUE while the samples are accumulated */
+    volatile uint32         missed;                                     /**< \brief Servo periods started before the update of the previous trigger */
+    volatile uint32         lost;                                       /**< \brief Servo periods whose sample could not be attributed */
+} LatencyBench;
+
+/** \brief Latency measurement configuration
+ */
+typedef struct
+{
+    IfxGtm_Tom_ToutMap        *servo;                                   /**< \brief Servo PWM pin */
+    IfxGtm_Tim_TinMap         *servoTin;                                /**< \brief TIM0 input of the servo pin */
+    IfxGtm_Tom_ToutMap        *trigger;                                 /**< \brief Trigger pin, same TOM and TGC as the servo */
+    IfxGtm_Tim_TinMap         *triggerTin;                              /**< \brief TIM0 input of the trigger pin */
+    IfxGtm_Trig_AdcTrigChannel triggerAdcChannel;                       /**< \brief GTM ADC trigger channel of the trigger */
+    IfxGtm_Tim_TinMap         *markerTin;                               /**< \brief Marker pin and its TIM0 input, channel 0..6 */
+    float32                    loopFrequency;                           /**< \brief Loop (servo PWM) frequency in Hz */
+    float32                    pulseMin;                                /**< \brief Minimal servo pulse width in s */
+    float32                    pulseMax;                                /**< \brief Maximal servo pulse width in s */
+    IfxVadc_Adc               *vadc;                                    /**< \brief Initialized VADC module handle */
+    IfxVadc_GroupId            groupId;                                 /**< \brief VADC group of the sensor */
+    IfxVadc_TriggerSource      triggerInput;                            /**< \brief Scan request trigger input connected to the GTM ADC trigger 0 of the group */
+    IfxVadc_ChannelId          channel;                                 /**< \brief VADC channel of the sensor */
+    Ifx_Priority               resultPriority;                          /**< \brief Interrupt priority of the conversion result (control computation) */
+    IfxSrc_Tos                 resultServProvider;                      /**< \brief Interrupt service provider of the conversion result */
+    Ifx_Priority               edgePriority;                            /**< \brief Interrupt priority of the servo edge capture, lower than resultPriority */
+    IfxSrc_Tos                 edgeServProvider;                        /**< \brief Interrupt service provider of the servo edge capture */
+    float32                    binWidth[LatencyBench_Stage_count];      /**< \brief Histogram bin width of each stage in s */
+} LatencyBench_Config;
+
+/** \} */
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+/** \addtogroup IfxLld_Demo_LatencyBenchDemo_SrcDoc_Driver
+ * \{ */
+
+/** \brief Initialize the configuration with default values: 250 Hz loop, 1 .. 2 ms pulse, channel 0 of group 0
+ * \param config Configuration structure
+ * \param vadc Initialized VADC module handle
+ */
+IFX_EXTERN void LatencyBench_initConfig(LatencyBench_Config *config, IfxVadc_Adc *vadc);
+
+/** \brief Initialize the time base, the capture channels, the VADC group and the TOM channels, then start the loop
+ * \param bench Measurement handle
+ * \param config Configuration structure
+ * \return TRUE on success, FALSE if the configuration is not supported
+ */
+IFX_EXTERN boolean LatencyBench_init(LatencyBench *bench, const LatencyBench_Config *config);
+
+/** \brief Handle the conversion result: control computation and servo update, to be called from the interrupt of LatencyBench_Config.resultPriority
+ * \param bench Measurement handle
+ */
+IFX_EXTERN void LatencyBench_isrResult(LatencyBench *bench);
+
+/** \brief Handle the servo rising edge: evaluate the sample of the previous trigger, to be called from the interrupt of LatencyBench_Config.edgePriority
+ * \param bench Measurement handle
+ */
+IFX_EXTERN void LatencyBench_isrEdge(LatencyBench *bench);
+
+/** \brief Clear the histograms and the counters, then accumulate the samples
+ * \param bench Measurement handle
+ */
+IFX_EXTERN void LatencyBench_start(LatencyBench *bench);
+
+/** \brief Stop accumulating the samples, the histograms are kept for the report
+ * \param bench Measurement handle
+ */
+IFX_INLINE void LatencyBench_stop(LatencyBench *bench)
+{
+    bench->recording = FALSE;
+}
+
+
+/** \brief Return the number of samples accumulated since LatencyBench_start()
+ * \param bench Measurement handle
+ * \return Number of samples
+ */
+IFX_INLINE uint32 LatencyBench_getSampleCount(const LatencyBench *bench)
+{
+    return bench->histogram[LatencyBench_Stage_output].count;
+}
+
+
+/** \brief Convert TBU_TS0 ticks to ns
+ * \param bench Measurement handle
+ * \param ticks Ticks
+ * \return Time in ns
+ */
+IFX_INLINE uint32 LatencyBench_toNs(const LatencyBench *bench, uint32 ticks)
+{
+    return (uint32)(((float32)ticks * 1.0e9f) / bench->tbuFrequency);
+}
+
+
+/** \} */
+
+#endif
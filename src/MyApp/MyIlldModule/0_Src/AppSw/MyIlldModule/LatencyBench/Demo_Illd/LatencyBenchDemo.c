@@ -0,0 +1,365 @@
+/**
+ * \file LatencyBenchDemo.c
+ * \brief Demo LatencyBenchDemo
+ *
+ * \version iLLD_Demos_1_0_1_4_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include <stdio.h>
+#include "LatencyBenchDemo.h"
+#include "Configuration.h"
+#include "ConfigurationIsr.h"
+#include "SysSe/Bsp/Bsp.h"
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+App_LatencyBench g_LatencyBench; /**< \brief Demo information */
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+static boolean LatencyBenchDemo_report(uint32 sources);
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+/** \brief Loads measured one after the other */
+static const uint32 LatencyBenchDemo_loads[] = {
+    LatencyLoad_Source_none,
+    LatencyLoad_Source_can,
+    LatencyLoad_Source_asclin,
+    LatencyLoad_Source_tft,
+    LatencyLoad_Source_all
+};
+
+/** \brief Stage names of the report */
+static const char *const LatencyBenchDemo_stageNames[LatencyBench_Stage_count] = {
+    "adc", "control", "response", "output"
+};
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+/** \addtogroup IfxLld_Demo_LatencyBenchDemo_SrcDoc_Main_Interrupt
+ * \{ */
+
+/** \name Interrupts of the measurement and of the load.
+ * \{ */
+IFX_INTERRUPT(LatencyBenchDemo_resultIsr, 0, ISR_PRIORITY_LATENCY_RESULT);
+IFX_INTERRUPT(LatencyBenchDemo_edgeIsr, 0, ISR_PRIORITY_LATENCY_EDGE);
+IFX_INTERRUPT(LatencyBenchDemo_canIsr, 0, ISR_PRIORITY_LOAD_CAN);
+IFX_INTERRUPT(LatencyBenchDemo_ascTxIsr, 0, ISR_PRIORITY_LOAD_ASC_TX);
+IFX_INTERRUPT(LatencyBenchDemo_ascRxIsr, 0, ISR_PRIORITY_LOAD_ASC_RX);
+IFX_INTERRUPT(LatencyBenchDemo_ascErIsr, 0, ISR_PRIORITY_LOAD_ASC_EX);
+IFX_INTERRUPT(LatencyBenchDemo_qspiTxIsr, 0, ISR_PRIORITY_LOAD_QSPI_TX);
+IFX_INTERRUPT(LatencyBenchDemo_qspiRxIsr, 0, ISR_PRIORITY_LOAD_QSPI_RX);
+IFX_INTERRUPT(LatencyBenchDemo_qspiErIsr, 0, ISR_PRIORITY_LOAD_QSPI_ER);
+/** \} */
+
+/** \} */
+
+/** \brief Handle the sensor conversion result: control computation and servo update
+ *
+ * \isrProvider \ref ISR_PROVIDER_LATENCY_RESULT
+ * \isrPriority \ref ISR_PRIORITY_LATENCY_RESULT
+ *
+ */
+void LatencyBenchDemo_resultIsr(void)
+{
+    LatencyBench_isrResult(&g_LatencyBench.bench);
+}
+
+
+/** \brief Handle the servo edge capture: latency sample evaluation
+ *
+ * \isrProvider \ref ISR_PROVIDER_LATENCY_EDGE
+ * \isrPriority \ref ISR_PRIORITY_LATENCY_EDGE
+ *
+ */
+void LatencyBenchDemo_edgeIsr(void)
+{
+    LatencyBench_isrEdge(&g_LatencyBench.bench);
+}
+
+
+/** \brief Handle the CAN load receive interrupt
+ *
+ * \isrProvider \ref ISR_PROVIDER_LOAD
+ * \isrPriority \ref ISR_PRIORITY_LOAD_CAN
+ *
+ */
+void LatencyBenchDemo_canIsr(void)
+{
+    LatencyLoad_isrCan(&g_LatencyBench.load);
+}
+
+
+/** \brief Handle the ASCLIN load transmit interrupt
+ *
+ * \isrProvider \ref ISR_PROVIDER_LOAD
+ * \isrPriority \ref ISR_PRIORITY_LOAD_ASC_TX
+ *
+ */
+void LatencyBenchDemo_ascTxIsr(void)
+{
+    IfxAsclin_Asc_isrTransmit(&g_LatencyBench.load.asc);
+}
+
+
+/** \brief Handle the ASCLIN load receive interrupt
+ *
+ * \isrProvider \ref ISR_PROVIDER_LOAD
+ * \isrPriority \ref ISR_PRIORITY_LOAD_ASC_RX
+ *
+ */
+void LatencyBenchDemo_ascRxIsr(void)
+{
+    IfxAsclin_Asc_isrReceive(&g_LatencyBench.load.asc);
+}
+
+
+/** \brief Handle the ASCLIN load error interrupt
+ *
+ * \isrProvider \ref ISR_PROVIDER_LOAD
+ * \isrPriority \ref ISR_PRIORITY_LOAD_ASC_EX
+ *
+ */
+void LatencyBenchDemo_ascErIsr(void)
+{
+    IfxAsclin_Asc_isrError(&g_LatencyBench.load.asc);
+}
+
+
+/** \brief Handle the TFT load transmit interrupt
+ *
+ * \isrProvider \ref ISR_PROVIDER_LOAD
+ * \isrPriority \ref ISR_PRIORITY_LOAD_QSPI_TX
+ *
+ */
+void LatencyBenchDemo_qspiTxIsr(void)
+{
+    IfxQspi_SpiMaster_isrTransmit(&g_LatencyBench.load.spi);
+}
+
+
+/** \brief Handle the TFT load receive interrupt
+ *
+ * \isrProvider \ref ISR_PROVIDER_LOAD
+ * \isrPriority \ref ISR_PRIORITY_LOAD_QSPI_RX
+ *
+ */
+void LatencyBenchDemo_qspiRxIsr(void)
+{
+    IfxQspi_SpiMaster_isrReceive(&g_LatencyBench.load.spi);
+}
+
+
+/** \brief Handle the TFT load error interrupt
+ *
+ * \isrProvider \ref ISR_PROVIDER_LOAD
+ * \isrPriority \ref ISR_PRIORITY_LOAD_QSPI_ER
+ *
+ */
+void LatencyBenchDemo_qspiErIsr(void)
+{
+    IfxQspi_SpiMaster_isrError(&g_LatencyBench.load.spi);
+}
+
+
+/** \brief Print the records of one load and evaluate the regression gate
+ * \param sources Load sources of the measurement
+ * \return TRUE if all stages are within their limit and no sample was missed or lost
+ */
+static boolean LatencyBenchDemo_report(uint32 sources)
+{
+    LatencyBench *bench = &g_LatencyBench.bench;
+    LatencyLoad  *load  = &g_LatencyBench.load;
+    const char   *name  = LatencyLoad_getName(sources);
+    boolean       pass  = (bench->missed == 0) && (bench->lost == 0);
+    uint32        limits[LatencyBench_Stage_count];
+    uint32        stage;
+
+    limits[LatencyBench_Stage_adc]      = LATENCYBENCHDEMO_LIMIT_ADC_US * 1000;
+    limits[LatencyBench_Stage_control]  = LATENCYBENCHDEMO_LIMIT_CONTROL_US * 1000;
+    limits[LatencyBench_Stage_response] = LATENCYBENCHDEMO_LIMIT_RESPONSE_US * 1000;
+    limits[LatencyBench_Stage_output]   = (uint32)(0.5e9f / bench->loopFrequency) + (LATENCYBENCHDEMO_LIMIT_RESPONSE_US * 1000);
+
+    for (stage = 0; stage < LatencyBench_Stage_count; stage++)
+    {
+        const LatencyBench_Histogram *histogram = &bench->histogram[stage];
+        uint32                        max       = LatencyBench_toNs(bench, histogram->max);
+        boolean                       ok        = (histogram->count > 0) && (max <= limits[stage]);
+        uint32                        bin;
+
+        if (histogram->count > 0)
+        {
+            printf("LAT,%s,%s,%u,%u,%u,%u,%u,%s\n", name, LatencyBenchDemo_stageNames[stage],
+                (unsigned)histogram->count,
+                (unsigned)LatencyBench_toNs(bench, histogram->min),
+                (unsigned)max,
+                (unsigned)LatencyBench_toNs(bench, (uint32)(histogram->sum / histogram->count)),
+                (unsigned)limits[stage], ok ? "pass" : "fail");
+        }
+        else
+        {
+            printf("LAT,%s,%s,0,0,0,0,%u,fail\n", name, LatencyBenchDemo_stageNames[stage], (unsigned)limits[stage]);
+        }
+
+        printf("LAT_HIST,%s,%s,%u", name, LatencyBenchDemo_stageNames[stage], (unsigned)LatencyBench_toNs(bench, histogram->binWidth));
+
+        for (bin = 0; bin <= LATENCYBENCH_HISTOGRAM_BINS; bin++)
+        {
+            printf(",%u", (unsigned)histogram->bins[bin]);
+        }
+
+        printf("\n");
+
+        pass = pass && ok;
+    }
+
+    printf("LAT_LOST,%s,%u,%u,%u,%u,%u\n", name, (unsigned)bench->missed, (unsigned)bench->lost,
+        (unsigned)load->canFrames, (unsigned)load->ascBytes, (unsigned)load->tftBands);
+
+    return pass;
+}
+
+
+/** \brief Demo init API
+ *
+ * This function is called from main during initialization phase
+ */
+void LatencyBenchDemo_init(void)
+{
+    /* VADC Configuration */
+
+    /* create configuration */
+    IfxVadc_Adc_Config adcConfig;
+    IfxVadc_Adc_initModuleConfig(&adcConfig, &MODULE_VADC);
+
+    /* initialize module */
+    IfxVadc_Adc_initModule(&g_LatencyBench.vadc, &adcConfig);
+
+    /* measurement configuration, see Configuration.h for the pins */
+    LatencyBench_Config config;
+    LatencyBench_initConfig(&config, &g_LatencyBench.vadc);
+
+    config.servo              = &LATENCY_SERVO;
+    config.servoTin           = &LATENCY_SERVO_TIN;
+    config.trigger            = &LATENCY_TRIGGER;
+    config.triggerTin         = &LATENCY_TRIGGER_TIN;
+    config.triggerAdcChannel  = LATENCY_TRIGGER_ADC;
+    config.markerTin          = &LATENCY_MARKER_TIN;
+    config.loopFrequency      = LATENCYBENCHDEMO_LOOP_FREQUENCY;
+    config.groupId            = IfxVadc_GroupId_0;
+    config.triggerInput       = LATENCYBENCHDEMO_TRIGGER_INPUT;
+    config.channel            = (IfxVadc_ChannelId)LATENCY_SENSOR;
+    config.resultPriority     = ISR_PRIORITY_LATENCY_RESULT;
+    config.resultServProvider = ISR_PROVIDER_LATENCY_RESULT;
+    config.edgePriority       = ISR_PRIORITY_LATENCY_EDGE;
+    config.edgeServProvider   = ISR_PROVIDER_LATENCY_EDGE;
+
+    g_LatencyBench.initialized = LatencyBench_init(&g_LatencyBench.bench, &config);
+
+    if (g_LatencyBench.initialized == FALSE)
+    {
+        printf("Latency measurement configuration not supported\n");
+    }
+    else
+    {
+        printf("Latency measurement: loop %d Hz, TBU_TS0 %d Hz\n", (int)g_LatencyBench.bench.loopFrequency, (int)g_LatencyBench.bench.tbuFrequency);
+    }
+
+    LatencyLoad_init(&g_LatencyBench.load);
+}
+
+
+/** \brief Demo run API
+ *
+ * This function is called once from main.
+ * The latency is measured under each load and the report is printed.
+ *
+ * \return TRUE if the regression gate passed for all loads
+ */
+boolean LatencyBenchDemo_run(void)
+{
+    LatencyBench *bench = &g_LatencyBench.bench;
+    LatencyLoad  *load  = &g_LatencyBench.load;
+    boolean       pass  = g_LatencyBench.initialized;
+    uint32        i;
+
+    if (pass == FALSE)
+    {
+        printf("LAT_END,fail\n");
+        return FALSE;
+    }
+
+    printf("LAT_BEGIN,%u,%u,%u\n", (unsigned)bench->tbuFrequency, (unsigned)LATENCYBENCHDEMO_SAMPLES, (unsigned)bench->loopFrequency);
+
+    for (i = 0; i < (sizeof(LatencyBenchDemo_loads) / sizeof(LatencyBenchDemo_loads[0])); i++)
+    {
+        Ifx_TickTime deadLine;
+        Ifx_TickTime warmUp;
+
+        LatencyLoad_start(load, LatencyBenchDemo_loads[i]);
+
+        warmUp = getDeadLine(TimeConst_1ms * LATENCYBENCHDEMO_WARMUP_MS);
+
+        while (isDeadLine(warmUp) == FALSE)
+        {
+            LatencyLoad_run(load);
+        }
+
+        /* twice the time of the samples: the missed and lost periods do not produce samples */
+        LatencyBench_start(bench);
+        deadLine = getDeadLine(TimeConst_1s * (1 + (uint32)((2 * LATENCYBENCHDEMO_SAMPLES) / bench->loopFrequency)));
+
+        while ((LatencyBench_getSampleCount(bench) < LATENCYBENCHDEMO_SAMPLES) && (isDeadLine(deadLine) == FALSE))
+        {
+            LatencyLoad_run(load);
+        }
+
+        LatencyBench_stop(bench);
+        LatencyLoad_stop(load);
+
+        if (LatencyBenchDemo_report(LatencyBenchDemo_loads[i]) == FALSE)
+        {
+            pass = FALSE;
+        }
+    }
+
+    printf("LAT_END,%s\n", pass ? "pass" : "fail");
+
+    return pass;
+}
@@ -0,0 +1,90 @@
+/**
+ * \file LatencyBenchDemo.h
+ * \brief Demo LatencyBenchDemo
+ *
+ * \version iLLD_Demos_1_0_1_4_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * The sensor to actuator latency (see \ref LatencyBench.h) is measured without load, then under each load
+ * source and all of them together (see \ref LatencyLoad.h). LATENCYBENCHDEMO_SAMPLES samples are accumulated
+ * per load, after a warm up of LATENCYBENCHDEMO_WARMUP_MS.
+ *
+ * The report is printed on the standard output, one line per record, for the regression scripts:
+ * \code
+ * LAT_BEGIN,<TBU_TS0 Hz>,<samples>,<loop Hz>
+ * LAT,<load>,<stage>,<count>,<min ns>,<max ns>,<mean ns>,<limit ns>,<pass|fail>
+ * LAT_HIST,<load>,<stage>,<bin width ns>,<bin 0>,...,<bin 31>,<overflow>
+ * LAT_LOST,<load>,<missed>,<lost>,<can frames>,<asclin bytes>,<tft bands>
+ * LAT_END,<pass|fail>
+ * \endcode
+ *
+ * The regression gate fails when the max of a stage exceeds its limit, or when a sample was missed or lost.
+ *
+ * \defgroup IfxLld_Demo_LatencyBenchDemo_SrcDoc_Main Demo Source
+ * \ingroup IfxLld_Demo_LatencyBenchDemo_SrcDoc
+ * \defgroup IfxLld_Demo_LatencyBenchDemo_SrcDoc_Main_Interrupt Interrupts
+ * \ingroup IfxLld_Demo_LatencyBenchDemo_SrcDoc_Main
+ */
+
+#ifndef LATENCYBENCHDEMO_H
+#define LATENCYBENCHDEMO_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "LatencyBench.h"
+#include "LatencyLoad.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+#define LATENCYBENCHDEMO_LOOP_FREQUENCY    (250)                     /**< \brief Control loop frequency in Hz */
+#define LATENCYBENCHDEMO_SAMPLES           (1000)                    /**< \brief Samples per load */
+#define LATENCYBENCHDEMO_WARMUP_MS         (100)                     /**< \brief Load running before the samples are accumulated */
+#define LATENCYBENCHDEMO_LIMIT_ADC_US      (10)                      /**< \brief Limit of the adc stage */
+#define LATENCYBENCHDEMO_LIMIT_CONTROL_US  (20)                      /**< \brief Limit of the control stage */
+#define LATENCYBENCHDEMO_LIMIT_RESPONSE_US (30)                      /**< \brief Limit of the response stage; the output stage limit is half a period more */
+#define LATENCYBENCHDEMO_TRIGGER_INPUT     IfxVadc_TriggerSource_2   /**< \brief Request trigger input connected to the GTM ADC0 trigger 0 (REQTR0C) */
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+typedef struct
+{
+    IfxVadc_Adc vadc; /* VADC handle */
+    LatencyBench bench; /* latency measurement */
+    LatencyLoad load; /* background load */
+    boolean initialized; /* TRUE if the measurement configuration is supported */
+} App_LatencyBench;
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+IFX_EXTERN App_LatencyBench g_LatencyBench;
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+IFX_EXTERN void    LatencyBenchDemo_init(void);
+IFX_EXTERN boolean LatencyBenchDemo_run(void);
+
+#endif
@@ -0,0 +1,279 @@
+/**
+ * \file LatencyLoad.c
+ * \brief Synthetic background load of the latency benchmark: CAN, ASCLIN and TFT refresh
+ *
+ * \version iLLD_Demos_1_0_1_4_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "LatencyLoad.h"
+#include "Configuration.h"
+#include "ConfigurationIsr.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+#define LATENCYLOAD_CAN_ID (0x100)      /**< \brief Identifier of the CAN frames */
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+static void LatencyLoad_initCan(LatencyLoad *load);
+static void LatencyLoad_initAsclin(LatencyLoad *load);
+static void LatencyLoad_initTft(LatencyLoad *load);
+static void LatencyLoad_sendCan(LatencyLoad *load);
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+/** \brief Initialize node 0 (transmit) and node 1 (receive) on the loop back bus
+ */
+static void LatencyLoad_initCan(LatencyLoad *load)
+{
+    IfxMultican_Can_Config       canConfig;
+    IfxMultican_Can_NodeConfig   nodeConfig;
+    IfxMultican_Can_MsgObjConfig msgObjConfig;
+
+    IfxMultican_Can_initModuleConfig(&canConfig, &MODULE_CAN);
+    canConfig.nodePointer[IfxMultican_SrcId_0].priority      = ISR_PRIORITY_LOAD_CAN;
+    canConfig.nodePointer[IfxMultican_SrcId_0].typeOfService = ISR_PROVIDER_LOAD;
+    IfxMultican_Can_initModule(&load->can, &canConfig);
+
+    IfxMultican_Can_Node_initConfig(&nodeConfig, &load->can);
+    nodeConfig.baudrate     = LATENCYLOAD_CAN_BAUDRATE;
+    nodeConfig.loopBackMode = TRUE;
+
+    nodeConfig.nodeId       = IfxMultican_NodeId_0;
+    IfxMultican_Can_Node_init(&load->canNode[0], &nodeConfig);
+
+    nodeConfig.nodeId       = IfxMultican_NodeId_1;
+    IfxMultican_Can_Node_init(&load->canNode[1], &nodeConfig);
+
+    IfxMultican_Can_MsgObj_initConfig(&msgObjConfig, &load->canNode[0]);
+    msgObjConfig.msgObjId              = 0;
+    msgObjConfig.messageId             = LATENCYLOAD_CAN_ID;
+    msgObjConfig.acceptanceMask        = 0x7FFFFFFFUL;
+    msgObjConfig.frame                 = IfxMultican_Frame_transmit;
+    msgObjConfig.control.messageLen    = IfxMultican_DataLengthCode_8;
+    msgObjConfig.control.extendedFrame = FALSE;
+    msgObjConfig.control.matchingId    = TRUE;
+    IfxMultican_Can_MsgObj_init(&load->canTx, &msgObjConfig);
+
+    IfxMultican_Can_MsgObj_initConfig(&msgObjConfig, &load->canNode[1]);
+    msgObjConfig.msgObjId              = 1;
+    msgObjConfig.messageId             = LATENCYLOAD_CAN_ID;
+    msgObjConfig.acceptanceMask        = 0x7FFFFFFFUL;
+    msgObjConfig.frame                 = IfxMultican_Frame_receive;
+    msgObjConfig.control.messageLen    = IfxMultican_DataLengthCode_8;
+    msgObjConfig.control.extendedFrame = FALSE;
+    msgObjConfig.control.matchingId    = TRUE;
+    msgObjConfig.rxInterrupt.enabled   = TRUE;
+    msgObjConfig.rxInterrupt.srcId     = IfxMultican_SrcId_0;
+    IfxMultican_Can_MsgObj_init(&load->canRx, &msgObjConfig);
+}
+
+
+/** \brief Initialize the ASCLIN in loop back mode, without pins
+ */
+static void LatencyLoad_initAsclin(LatencyLoad *load)
+{
+    IfxAsclin_Asc_Config config;
+
+    IfxAsclin_Asc_initModuleConfig(&config, &LOAD_ASCLIN);
+    config.baudrate.baudrate       = LATENCYLOAD_ASC_BAUDRATE;
+    config.baudrate.oversampling   = IfxAsclin_OversamplingFactor_16;
+    config.loopBack                = TRUE;
+    config.interrupt.txPriority    = ISR_PRIORITY_LOAD_ASC_TX;
+    config.interrupt.rxPriority    = ISR_PRIORITY_LOAD_ASC_RX;
+    config.interrupt.erPriority    = ISR_PRIORITY_LOAD_ASC_EX;
+    config.interrupt.typeOfService = ISR_PROVIDER_LOAD;
+    config.pins                    = NULL_PTR;
+    config.txBuffer                = load->ascTx;
+    config.txBufferSize            = LATENCYLOAD_ASC_BUFFER_SIZE;
+    config.rxBuffer                = load->ascRx;
+    config.rxBufferSize            = LATENCYLOAD_ASC_BUFFER_SIZE;
+    IfxAsclin_Asc_initModule(&load->asc, &config);
+}
+
+
+/** \brief Initialize QSPI0 as the TFT driver: 50 MHz, 16 bit per pixel, chip select of the display
+ */
+static void LatencyLoad_initTft(LatencyLoad *load)
+{
+    IfxQspi_SpiMaster_Config        spiMasterConfig;
+    IfxQspi_SpiMaster_ChannelConfig spiMasterChannelConfig;
+    uint32                          i;
+
+    IfxQspi_SpiMaster_initModuleConfig(&spiMasterConfig, &MODULE_QSPI0);
+    spiMasterConfig.base.mode            = SpiIf_Mode_master;
+    spiMasterConfig.base.maximumBaudrate = LATENCYLOAD_TFT_BAUDRATE;
+    spiMasterConfig.base.txPriority      = ISR_PRIORITY_LOAD_QSPI_TX;
+    spiMasterConfig.base.rxPriority      = ISR_PRIORITY_LOAD_QSPI_RX;
+    spiMasterConfig.base.erPriority      = ISR_PRIORITY_LOAD_QSPI_ER;
+    spiMasterConfig.base.isrProvider     = ISR_PROVIDER_LOAD;
+
+    const IfxQspi_SpiMaster_Pins pins = {
+        &LOAD_QSPI_SCLK, IfxPort_OutputMode_pushPull,   // SCLK
+        &LOAD_QSPI_MTSR, IfxPort_OutputMode_pushPull,   // MTSR
+        &LOAD_QSPI_MRST, IfxPort_InputMode_pullDown,    // MRST
+        IfxPort_PadDriver_cmosAutomotiveSpeed3          // pad driver mode
+    };
+    spiMasterConfig.pins = &pins;
+    IfxQspi_SpiMaster_initModule(&load->spi, &spiMasterConfig);
+
+    IfxQspi_SpiMaster_initChannelConfig(&spiMasterChannelConfig, &load->spi);
+    spiMasterChannelConfig.base.baudrate       = LATENCYLOAD_TFT_BAUDRATE;
+    spiMasterChannelConfig.base.mode.dataWidth = 16;
+
+    const IfxQspi_SpiMaster_Output slsOutput = {
+        &LOAD_QSPI_SLSO,
+        IfxPort_OutputMode_pushPull,
+        IfxPort_PadDriver_cmosAutomotiveSpeed1
+    };
+    spiMasterChannelConfig.sls.output = slsOutput;
+    IfxQspi_SpiMaster_initChannel(&load->spiChannel, &spiMasterChannelConfig);
+
+    for (i = 0; i < LATENCYLOAD_TFT_BAND_PIXELS; i++)
+    {
+        load->band[i] = (uint16)(i * 0x0841);
+    }
+}
+
+
+/** \brief Send the next CAN frame, the counter of received frames is the payload
+ */
+static void LatencyLoad_sendCan(LatencyLoad *load)
+{
+    IfxMultican_Message msg;
+
+    IfxMultican_Message_init(&msg, LATENCYLOAD_CAN_ID, load->canFrames, ~load->canFrames, IfxMultican_DataLengthCode_8);
+    IfxMultican_Can_MsgObj_sendMessage(&load->canTx, &msg);
+}
+
+
+const char *LatencyLoad_getName(uint32 sources)
+{
+    switch (sources)
+    {
+    case LatencyLoad_Source_none:
+        return "idle";
+    case LatencyLoad_Source_can:
+        return "can";
+    case LatencyLoad_Source_asclin:
+        return "asclin";
+    case LatencyLoad_Source_tft:
+        return "tft";
+    case LatencyLoad_Source_all:
+        return "all";
+    default:
+        return "mixed";
+    }
+}
+
+
+void LatencyLoad_init(LatencyLoad *load)
+{
+    load->active    = LatencyLoad_Source_none;
+    load->canFrames = 0;
+    load->ascBytes  = 0;
+    load->tftBands  = 0;
+
+    LatencyLoad_initCan(load);
+    LatencyLoad_initAsclin(load);
+    LatencyLoad_initTft(load);
+}
+
+
+void LatencyLoad_isrCan(LatencyLoad *load)
+{
+    IfxMultican_Message msg;
+
+    IfxMultican_Can_MsgObj_readMessage(&load->canRx, &msg);
+    load->canFrames++;
+
+    if ((load->active & LatencyLoad_Source_can) != 0)
+    {
+        LatencyLoad_sendCan(load);
+    }
+}
+
+
+void LatencyLoad_run(LatencyLoad *load)
+{
+    uint32 active = load->active;
+
+    if ((active & LatencyLoad_Source_asclin) != 0)
+    {
+        uint8     data[LATENCYLOAD_ASC_BUFFER_SIZE];
+        Ifx_SizeT count;
+        Ifx_SizeT i;
+
+        count = (Ifx_SizeT)IfxAsclin_Asc_getReadCount(&load->asc);
+
+        if (count > 0)
+        {
+            count           = (Ifx_SizeT)__min(count, LATENCYLOAD_ASC_BUFFER_SIZE);
+            IfxAsclin_Asc_read(&load->asc, data, &count, TIME_NULL);
+            load->ascBytes += count;
+        }
+
+        for (i = 0; i < LATENCYLOAD_ASC_BUFFER_SIZE; i++)
+        {
+            data[i] = (uint8)i;
+        }
+
+        count = LATENCYLOAD_ASC_BUFFER_SIZE / 2;
+        IfxAsclin_Asc_write(&load->asc, data, &count, TIME_NULL);
+    }
+
+    if (((active & LatencyLoad_Source_tft) != 0) && (IfxQspi_SpiMaster_getStatus(&load->spiChannel) != SpiIf_Status_busy))
+    {
+        IfxQspi_SpiMaster_exchange(&load->spiChannel, load->band, NULL_PTR, LATENCYLOAD_TFT_BAND_PIXELS);
+        load->tftBands++;
+    }
+}
+
+
+void LatencyLoad_start(LatencyLoad *load, uint32 sources)
+{
+    load->canFrames = 0;
+    load->ascBytes  = 0;
+    load->tftBands  = 0;
+    load->active    = sources;
+
+    if ((sources & LatencyLoad_Source_can) != 0)
+    {
+        LatencyLoad_sendCan(load);
+    }
+
+    LatencyLoad_run(load);
+}
+
+
+void LatencyLoad_stop(LatencyLoad *load)
+{
+    load->active = LatencyLoad_Source_none;
+
+    while (IfxQspi_SpiMaster_getStatus(&load->spiChannel) == SpiIf_Status_busy)
+    {}
+}
@@ -0,0 +1,137 @@
+/**
+ * \file LatencyLoad.h
+ * \brief Synthetic background load of the latency benchmark: CAN, ASCLIN and TFT refresh
+ *
+ * \version iLLD_Demos_1_0_1_4_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * Each load source keeps its peripheral busy with the interrupt pattern of the Racer application:
+ * - CAN: node 0 sends to node 1 through the loop back bus, 1 Mbit/s. The receive interrupt sends the next frame,
+ *   the bus is busy all the time.
+ * - ASCLIN: loop back at LATENCYLOAD_ASC_BAUDRATE, one transmit and one receive interrupt per byte. The background
+ *   loop keeps the transmit buffer filled and empties the receive buffer.
+ * - TFT: the refresh of the AppKit display (320 x 240, 16 bit per pixel) is emulated on QSPI0 with the traffic of
+ *   the TFT driver: bands of 12 rows sent at 50 MHz, one after the other, by the background loop.
+ *
+ * \defgroup IfxLld_Demo_LatencyBenchDemo_SrcDoc_Load Background load
+ * \ingroup IfxLld_Demo_LatencyBenchDemo_SrcDoc
+ */
+
+#ifndef LATENCYLOAD_H
+#define LATENCYLOAD_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include <Multican/Can/IfxMultican_Can.h>
+#include <Asclin/Asc/IfxAsclin_Asc.h>
+#include <Qspi/SpiMaster/IfxQspi_SpiMaster.h>
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+#define LATENCYLOAD_CAN_BAUDRATE    (1000000)           /**< \brief CAN baudrate */
+#define LATENCYLOAD_ASC_BAUDRATE    (1000000)           /**< \brief ASCLIN baudrate */
+#define LATENCYLOAD_ASC_BUFFER_SIZE (64)                /**< \brief ASCLIN software FIFO size */
+#define LATENCYLOAD_TFT_BAUDRATE    (50000000)          /**< \brief QSPI baudrate of the TFT driver */
+#define LATENCYLOAD_TFT_BAND_PIXELS (320 * 12)          /**< \brief Pixels of one band: 12 rows (font height) of 320 pixels */
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+/** \addtogroup IfxLld_Demo_LatencyBenchDemo_SrcDoc_Load
+ * \{ */
+
+/** \brief Load sources, can be combined
+ */
+typedef enum
+{
+    LatencyLoad_Source_none   = 0,
+    LatencyLoad_Source_can    = 1,
+    LatencyLoad_Source_asclin = 2,
+    LatencyLoad_Source_tft    = 4,
+    LatencyLoad_Source_all    = 7
+} LatencyLoad_Source;
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+
+/** \brief Background load handle
+ */
+typedef struct
+{
+    IfxMultican_Can           can;                                                      /**< \brief CAN module */
+    IfxMultican_Can_Node      canNode[2];                                               /**< \brief Sending and receiving nodes */
+    IfxMultican_Can_MsgObj    canTx;                                                    /**< \brief Transmit message object of node 0 */
+    IfxMultican_Can_MsgObj    canRx;                                                    /**< \brief Receive message object of node 1 */
+    IfxAsclin_Asc             asc;                                                      /**< \brief ASCLIN in loop back mode */
+    uint8                     ascTx[LATENCYLOAD_ASC_BUFFER_SIZE + sizeof(Ifx_Fifo) + 8]; /**< \brief ASCLIN transmit buffer */
+    uint8                     ascRx[LATENCYLOAD_ASC_BUFFER_SIZE + sizeof(Ifx_Fifo) + 8]; /**< \brief ASCLIN receive buffer */
+    IfxQspi_SpiMaster         spi;                                                      /**< \brief QSPI of the TFT */
+    IfxQspi_SpiMaster_Channel spiChannel;                                               /**< \brief QSPI channel of the TFT */
+    uint16                    band[LATENCYLOAD_TFT_BAND_PIXELS];                        /**< \brief Pixels of one band */
+    volatile uint32           active;                                                   /**< \brief Active sources, see \ref LatencyLoad_Source */
+    volatile uint32           canFrames;                                                /**< \brief Received CAN frames */
+    uint32                    ascBytes;                                                 /**< \brief Received ASCLIN bytes */
+    uint32                    tftBands;                                                 /**< \brief Sent TFT bands */
+} LatencyLoad;
+
+/** \} */
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+/** \addtogroup IfxLld_Demo_LatencyBenchDemo_SrcDoc_Load
+ * \{ */
+
+/** \brief Initialize the CAN nodes, the ASCLIN and the QSPI, no load is active
+ * \param load Load handle
+ */
+IFX_EXTERN void LatencyLoad_init(LatencyLoad *load);
+
+/** \brief Start the load sources and clear the statistics
+ * \param load Load handle
+ * \param sources Sources to start, see \ref LatencyLoad_Source
+ */
+IFX_EXTERN void LatencyLoad_start(LatencyLoad *load, uint32 sources);
+
+/** \brief Stop all load sources, the transfers in progress are finished
+ * \param load Load handle
+ */
+IFX_EXTERN void LatencyLoad_stop(LatencyLoad *load);
+
+/** \brief Keep the ASCLIN and the TFT load running, to be called from the background loop
+ * \param load Load handle
+ */
+IFX_EXTERN void LatencyLoad_run(LatencyLoad *load);
+
+/** \brief Handle the CAN receive interrupt: read the frame and send the next one
+ * \param load Load handle
+ */
+IFX_EXTERN void LatencyLoad_isrCan(LatencyLoad *load);
+
+/** \brief Return the name of a load source combination for the report
+ * \param sources Sources, see \ref LatencyLoad_Source
+ * \return Name
+ */
+IFX_EXTERN const char *LatencyLoad_getName(uint32 sources);
+
+/** \} */
+
+#endif
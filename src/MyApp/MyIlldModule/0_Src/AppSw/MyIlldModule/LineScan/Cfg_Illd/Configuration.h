@@ -0,0 +1,89 @@
+/**
+ * \file Configuration.h
+ * \brief Global configuration
+ *
+ * \version iLLD_Demos_1_0_1_4_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup IfxLld_Demo_LineScanDemo_SrcDoc_Config Application configuration
+ * \ingroup IfxLld_Demo_LineScanDemo_SrcDoc
+ *
+ *
+ */
+
+#ifndef CONFIGURATION_H
+#define CONFIGURATION_H
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "Ifx_Cfg.h"
+#include "ConfigurationIsr.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/* APPLICATION_KIT_TC237 Ȥ SHIELD_BUDDY ߿ Ѱ */
+#define APPLICATION_KIT_TC237 1
+#define SHIELD_BUDDY 2
+
+/**
+ * \name Line scan camera TSL1401 pins.
+ * SI, CLK and the ADC trigger channel must be channels 0..7 of the same TOM. The CLK pins cannot trigger
+ * the VADC: a copy of CLK without pin is generated on the trigger channel.
+ * \{
+ */
+#if BOARD == APPLICATION_KIT_TC237
+#define TSL1401_SI               IfxGtm_TOM0_1_TOUT86_P14_6_OUT   /**< \brief SI output */
+#define TSL1401_CLK              IfxGtm_TOM0_0_TOUT87_P14_7_OUT   /**< \brief CLK output */
+#define TSL1401_TRIGGER          IfxGtm_Tom_Ch_2                  /**< \brief TOM channel triggering the conversions */
+#define TSL1401_TRIGGER_ADC      IfxGtm_Trig_AdcTrigChannel_2     /**< \brief GTM ADC trigger channel of TSL1401_TRIGGER */
+#define TSL1401_AO_1             9                                /**< \brief VADC group 0 channel of the camera 1 analog output */
+#define TSL1401_AO_2             10                               /**< \brief VADC group 0 channel of the camera 2 analog output */
+#elif BOARD == SHIELD_BUDDY
+#define TSL1401_SI               IfxGtm_TOM0_3_TOUT80_P14_0_OUT   /**< \brief SI output */
+#define TSL1401_CLK              IfxGtm_TOM0_4_TOUT81_P14_1_OUT   /**< \brief CLK output */
+#define TSL1401_TRIGGER          IfxGtm_Tom_Ch_6                  /**< \brief TOM channel triggering the conversions */
+#define TSL1401_TRIGGER_ADC      IfxGtm_Trig_AdcTrigChannel_6     /**< \brief GTM ADC trigger channel of TSL1401_TRIGGER */
+#define TSL1401_AO_1             0                                /**< \brief VADC group 0 channel of the camera 1 analog output */
+#define TSL1401_AO_2             1                                /**< \brief VADC group 0 channel of the camera 2 analog output */
+#endif
+/** \} */
+
+/** \addtogroup IfxLld_Demo_LineScanDemo_SrcDoc_Config
+ * \{ */
+/*______________________________________________________________________________
+** Help Macros
+**____________________________________________________________________________*/
+/**
+ * \name Macros for Regression Runs
+ * \{
+ */
+#ifndef REGRESSION_RUN_STOP_PASS
+#define REGRESSION_RUN_STOP_PASS
+#endif
+
+#ifndef REGRESSION_RUN_STOP_FAIL
+#define REGRESSION_RUN_STOP_FAIL
+#endif
+
+/** \} */
+#define ADC_STARTUP_CALIBRATION 1  /**< \brief Enable Calibration for TC27xB,TC26x and TC29x Derivatives */
+
+/** \} */
+#endif
@@ -0,0 +1,180 @@
+/**
+ * \file LineScanDemo.c
+ * \brief Demo LineScanDemo
+ *
+ * \version iLLD_Demos_1_0_0_11_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include <stdio.h>
+#include "LineScanDemo.h"
+#include "Configuration.h"
+#include "ConfigurationIsr.h"
+#include <Cpu/Std/IfxCpu.h>
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+App_LineScan g_LineScan; /**< \brief Demo information */
+
+/* Frame double buffer. Must be located in a non cached memory (DSPR) */
+IFX_ALIGN(LINESCAN_BUFFER_SIZE(LINESCANDEMO_CAMERAS) * 4) Ifx_VADC_RES g_LineScanBuffer[LINESCAN_BUFFER_SIZE(LINESCANDEMO_CAMERAS)];
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+/** \addtogroup IfxLld_Demo_LineScanDemo_SrcDoc_Main_Interrupt
+ * \{ */
+
+/** \name Interrupts for the line scan camera.
+ * \{ */
+IFX_INTERRUPT(LineScanDemo_frameIsr, 0, ISR_PRIORITY_LINESCAN_FRAME);
+/** \} */
+
+/** \} */
+
+/** \brief Handle the frame interrupt and analyse the frame of each camera
+ *
+ * \isrProvider \ref ISR_PROVIDER_LINESCAN_FRAME
+ * \isrPriority \ref ISR_PRIORITY_LINESCAN_FRAME
+ *
+ */
+void LineScanDemo_frameIsr(void)
+{
+    const Ifx_VADC_RES *frame;
+    uint8               camera;
+
+    LineScan_isrFrame(&g_LineScan.camera);
+    frame = LineScan_getFrame(&g_LineScan.camera);
+
+    if (frame != NULL_PTR)
+    {
+        for (camera = 0; camera < LINESCANDEMO_CAMERAS; camera++)
+        {
+            LineScan_analyse(&g_LineScan.camera, frame, camera, LINESCANDEMO_MIN_CONTRAST, &g_LineScan.analysis[camera]);
+        }
+
+        g_LineScan.analysisCount++;
+    }
+}
+
+
+/** \brief Demo init API
+ *
+ * This function is called from main during initialization phase
+ */
+void LineScanDemo_init(void)
+{
+    /* VADC Configuration */
+
+    /* create configuration */
+    IfxVadc_Adc_Config adcConfig;
+    IfxVadc_Adc_initModuleConfig(&adcConfig, &MODULE_VADC);
+
+    /* initialize module */
+    IfxVadc_Adc_initModule(&g_LineScan.vadc, &adcConfig);
+
+    IfxDma_Dma_createModuleHandle(&g_LineScan.dma, &MODULE_DMA);
+
+    /* camera configuration, see Configuration.h for the pins */
+    LineScan_Config config;
+    LineScan_initConfig(&config, &g_LineScan.vadc);
+
+    config.si                = &TSL1401_SI;
+    config.clk               = &TSL1401_CLK;
+    config.triggerChannel    = TSL1401_TRIGGER;
+    config.triggerAdcChannel = TSL1401_TRIGGER_ADC;
+    config.clockFrequency    = LINESCANDEMO_CLOCK_FREQUENCY;
+    config.groupId           = IfxVadc_GroupId_0;
+    config.triggerInput      = LINESCANDEMO_TRIGGER_INPUT;
+    config.channels[0]       = (IfxVadc_ChannelId)TSL1401_AO_1;
+    config.channels[1]       = (IfxVadc_ChannelId)TSL1401_AO_2;
+    config.cameraCount       = LINESCANDEMO_CAMERAS;
+    config.dma               = &g_LineScan.dma;
+    config.dmaChannelId      = DMA_CHANNEL_LINESCAN_FRAME;
+    config.buffer            = g_LineScanBuffer;
+    config.framePriority     = ISR_PRIORITY_LINESCAN_FRAME;
+    config.frameServProvider = ISR_PROVIDER_LINESCAN_FRAME;
+
+    if (LineScan_init(&g_LineScan.camera, &config) == FALSE)
+    {
+        printf("Line scan camera configuration not supported\n");
+    }
+    else
+    {
+        printf("Line scan camera: CLK %d Hz, %d frames/s\n", (int)g_LineScan.camera.clockFrequency, (int)g_LineScan.camera.frameRate);
+    }
+}
+
+
+/** \brief Demo run API
+ *
+ * This function is called from main, background loop
+ * The analysis of the last frame is printed. The frames analysed while printing are not printed.
+ */
+void LineScanDemo_run(void)
+{
+    static uint32 lastCount = 0;
+    uint32        count     = g_LineScan.analysisCount;
+
+    if (count != lastCount)
+    {
+        uint8 camera;
+
+        lastCount = count;
+
+        for (camera = 0; camera < LINESCANDEMO_CAMERAS; camera++)
+        {
+            LineScan_Analysis analysis = g_LineScan.analysis[camera];
+
+            if (analysis.lineFound != FALSE)
+            {
+                printf("Camera %d : line at %d .. %d, min %u, max %u\n", camera, analysis.leftEdge, analysis.rightEdge, analysis.min, analysis.max);
+            }
+            else
+            {
+                printf("Camera %d : no line, min %u, max %u\n", camera, analysis.min, analysis.max);
+            }
+        }
+
+        printf("frames %lu, overrun %lu\n", g_LineScan.camera.stream.blockCount, g_LineScan.camera.stream.overrunCount);
+    }
+}
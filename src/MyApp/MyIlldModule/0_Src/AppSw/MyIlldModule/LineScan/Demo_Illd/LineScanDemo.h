@@ -0,0 +1,76 @@
+/**
+ * \file LineScanDemo.h
+ * \brief Demo LineScanDemo
+ *
+ * \version iLLD_Demos_1_0_0_11_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * Two TSL1401 line scan cameras share the SI and CLK signals and are read by the VADC, see \ref LineScan.h.
+ * Each finished frame is analysed in the frame interrupt, the background loop prints the line position
+ * found by each camera.
+ *
+ * \defgroup IfxLld_Demo_LineScanDemo_SrcDoc_Main Demo Source
+ * \ingroup IfxLld_Demo_LineScanDemo_SrcDoc
+ * \defgroup IfxLld_Demo_LineScanDemo_SrcDoc_Main_Interrupt Interrupts
+ * \ingroup IfxLld_Demo_LineScanDemo_SrcDoc_Main
+ */
+
+#ifndef LINESCANDEMO_H
+#define LINESCANDEMO_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "LineScan.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+#define LINESCANDEMO_CAMERAS         (2)                       /**< \brief Number of cameras */
+#define LINESCANDEMO_CLOCK_FREQUENCY (200000)                  /**< \brief CLK frequency in Hz */
+#define LINESCANDEMO_MIN_CONTRAST    (400)                     /**< \brief Minimal max - min of a frame for a line to be detected */
+#define LINESCANDEMO_TRIGGER_INPUT   IfxVadc_TriggerSource_2   /**< \brief Request trigger input connected to the GTM ADC0 trigger 0 (REQTR0C) */
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+typedef struct
+{
+    IfxVadc_Adc vadc; /* VADC handle */
+    IfxDma_Dma dma; /* DMA handle */
+    LineScan camera; /* line scan camera driver */
+    LineScan_Analysis analysis[LINESCANDEMO_CAMERAS]; /* analysis of the last frame */
+    volatile uint32 analysisCount; /* number of analysed frames */
+} App_LineScan;
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+IFX_EXTERN App_LineScan g_LineScan;
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+IFX_EXTERN void LineScanDemo_init(void);
+IFX_EXTERN void LineScanDemo_run(void);
+
+#endif
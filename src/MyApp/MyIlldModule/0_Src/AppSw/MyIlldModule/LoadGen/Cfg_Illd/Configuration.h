@@ -0,0 +1,78 @@
+/**
+ * \file Configuration.h
+ * \brief Global configuration
+ *
+ * \version iLLD_Demos_1_0_1_4_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup IfxLld_Demo_LoadGenDemo_SrcDoc_Config Application configuration
+ * \ingroup IfxLld_Demo_LoadGenDemo_SrcDoc
+ *
+ *
+ */
+
+#ifndef CONFIGURATION_H
+#define CONFIGURATION_H
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "Ifx_Cfg.h"
+#include "ConfigurationIsr.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/* APPLICATION_KIT_TC237 Ȥ SHIELD_BUDDY ߿ Ѱ */
+#define APPLICATION_KIT_TC237 1
+#define SHIELD_BUDDY 2
+
+/**
+ * \name Load generator resources.
+ * The CAN nodes and the ASCLIN run in loop back mode without pins. The STM storm uses the comparator 1 of STM0,
+ * the comparator 0 runs the measured control task.
+ * \{
+ */
+#define LOAD_ASCLIN               MODULE_ASCLIN1                   /**< \brief ASCLIN module loaded, ASCLIN0 is used by printf */
+#define LOAD_TOM                  IfxGtm_Tom_1                     /**< \brief TOM of the GTM interrupt storm */
+#define LOAD_TOM_CHANNEL          IfxGtm_Tom_Ch_0                  /**< \brief TOM channel of the GTM interrupt storm */
+#define LOAD_DMA_CHANNEL          IfxDma_ChannelId_1               /**< \brief DMA channel of the memory traffic */
+/** \} */
+
+/** \addtogroup IfxLld_Demo_LoadGenDemo_SrcDoc_Config
+ * \{ */
+/*______________________________________________________________________________
+** Help Macros
+**____________________________________________________________________________*/
+/**
+ * \name Macros for Regression Runs
+ * \{
+ */
+#ifndef REGRESSION_RUN_STOP_PASS
+#define REGRESSION_RUN_STOP_PASS
+#endif
+
+#ifndef REGRESSION_RUN_STOP_FAIL
+#define REGRESSION_RUN_STOP_FAIL
+#endif
+
+/** \} */
+#define ADC_STARTUP_CALIBRATION 1  /**< \brief Enable Calibration for TC27xB,TC26x and TC29x Derivatives */
+
+/** \} */
+#endif
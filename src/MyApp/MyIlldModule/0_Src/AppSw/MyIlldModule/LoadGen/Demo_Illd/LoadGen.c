@@ -0,0 +1,483 @@
+/**
+ * \file LoadGen.c
+ * \brief Synthetic production load generator
+ *
+ * \version iLLD_Demos_1_0_1_4_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "LoadGen.h"
+#include "Configuration.h"
+#include "ConfigurationIsr.h"
+#include "SysSe/Bsp/Bsp.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+#define LOADGEN_CAN_ID (0x100)      /**< \brief Identifier of the CAN frames */
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+static void LoadGen_initStm(LoadGen *load, const LoadGen_Config *config);
+static void LoadGen_initGtm(LoadGen *load, const LoadGen_Config *config);
+static void LoadGen_initAsclin(LoadGen *load, const LoadGen_Config *config);
+static void LoadGen_initCan(LoadGen *load, const LoadGen_Config *config);
+static void LoadGen_initDma(LoadGen *load);
+static void LoadGen_hogWindow(LoadGen_Hog *hog, uint32 cpu);
+static void LoadGen_sendCan(LoadGen *load);
+static void LoadGen_startDma(LoadGen *load);
+static void LoadGen_work(uint32 cycles);
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+/** \brief PFlash data read by the hogs and copied by the DMA. Not zero: located in the PFlash */
+static const uint32 LoadGen_flashData[LOADGEN_HOG_SIZE / 4] = {1};
+
+/** \brief Destination of the DMA traffic */
+IFX_FAST_DATA_CPU0 static uint32 LoadGen_dmaBuffer[LOADGEN_DMA_SIZE / 4];
+
+/** \brief Hog state, accessed by all CPUs through its global address */
+IFX_FAST_DATA_CPU0 static LoadGen_Hog LoadGen_hog;
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+/** \brief Initialize the comparator 1 of STM0, its interrupt is disabled until the STM source is started
+ */
+static void LoadGen_initStm(LoadGen *load, const LoadGen_Config *config)
+{
+    IfxStm_CompareConfig stmConfig;
+
+    load->stmTicks                = (uint32)(IfxStm_getFrequency(&MODULE_STM0) / config->stmFrequency);
+
+    IfxStm_initCompareConfig(&stmConfig);
+    stmConfig.comparator          = IfxStm_Comparator_1;
+    stmConfig.comparatorInterrupt = IfxStm_ComparatorInterrupt_ir1;
+    stmConfig.ticks               = load->stmTicks;
+    stmConfig.triggerPriority     = ISR_PRIORITY_LOAD_STM;
+    stmConfig.typeOfService       = ISR_PROVIDER_LOAD;
+    IfxStm_initCompare(&MODULE_STM0, &stmConfig);
+    IfxStm_disableComparatorInterrupt(&MODULE_STM0, IfxStm_Comparator_1);
+}
+
+
+/** \brief Initialize the TOM timer of the GTM storm, stopped
+ */
+static void LoadGen_initGtm(LoadGen *load, const LoadGen_Config *config)
+{
+    IfxGtm_Tom_Timer_Config timerConfig;
+
+    IfxGtm_enable(&MODULE_GTM);
+    IfxGtm_Cmu_enableClocks(&MODULE_GTM, IFXGTM_CMU_CLKEN_FXCLK);
+
+    IfxGtm_Tom_Timer_initConfig(&timerConfig, &MODULE_GTM);
+    timerConfig.base.frequency       = config->gtmFrequency;
+    timerConfig.base.isrPriority     = ISR_PRIORITY_LOAD_GTM;
+    timerConfig.base.isrProvider     = ISR_PROVIDER_LOAD;
+    timerConfig.base.minResolution   = (1.0 / timerConfig.base.frequency) / 1000;
+    timerConfig.base.trigger.enabled = FALSE;
+    timerConfig.tom                  = LOAD_TOM;
+    timerConfig.timerChannel         = LOAD_TOM_CHANNEL;
+    timerConfig.clock                = IfxGtm_Tom_Ch_ClkSrc_cmuFxclk0;
+    IfxGtm_Tom_Timer_init(&load->timer, &timerConfig);
+}
+
+
+/** \brief Initialize the ASCLIN in loop back mode, without pins
+ */
+static void LoadGen_initAsclin(LoadGen *load, const LoadGen_Config *config)
+{
+    IfxAsclin_Asc_Config ascConfig;
+
+    IfxAsclin_Asc_initModuleConfig(&ascConfig, &LOAD_ASCLIN);
+    ascConfig.baudrate.baudrate       = config->ascBaudrate;
+    ascConfig.baudrate.oversampling   = IfxAsclin_OversamplingFactor_16;
+    ascConfig.loopBack                = TRUE;
+    ascConfig.interrupt.txPriority    = ISR_PRIORITY_LOAD_ASC_TX;
+    ascConfig.interrupt.rxPriority    = ISR_PRIORITY_LOAD_ASC_RX;
+    ascConfig.interrupt.erPriority    = ISR_PRIORITY_LOAD_ASC_EX;
+    ascConfig.interrupt.typeOfService = ISR_PROVIDER_LOAD;
+    ascConfig.pins                    = NULL_PTR;
+    ascConfig.txBuffer                = load->ascTx;
+    ascConfig.txBufferSize            = LOADGEN_ASC_BUFFER_SIZE;
+    ascConfig.rxBuffer                = load->ascRx;
+    ascConfig.rxBufferSize            = LOADGEN_ASC_BUFFER_SIZE;
+    IfxAsclin_Asc_initModule(&load->asc, &ascConfig);
+}
+
+
+/** \brief Initialize node 0 (transmit) and node 1 (receive) on the loop back bus
+ */
+static void LoadGen_initCan(LoadGen *load, const LoadGen_Config *config)
+{
+    IfxMultican_Can_Config       canConfig;
+    IfxMultican_Can_NodeConfig   nodeConfig;
+    IfxMultican_Can_MsgObjConfig msgObjConfig;
+
+    IfxMultican_Can_initModuleConfig(&canConfig, &MODULE_CAN);
+    canConfig.nodePointer[IfxMultican_SrcId_0].priority      = ISR_PRIORITY_LOAD_CAN;
+    canConfig.nodePointer[IfxMultican_SrcId_0].typeOfService = ISR_PROVIDER_LOAD;
+    IfxMultican_Can_initModule(&load->can, &canConfig);
+
+    IfxMultican_Can_Node_initConfig(&nodeConfig, &load->can);
+    nodeConfig.baudrate     = config->canBaudrate;
+    nodeConfig.loopBackMode = TRUE;
+
+    nodeConfig.nodeId       = IfxMultican_NodeId_0;
+    IfxMultican_Can_Node_init(&load->canNode[0], &nodeConfig);
+
+    nodeConfig.nodeId       = IfxMultican_NodeId_1;
+    IfxMultican_Can_Node_init(&load->canNode[1], &nodeConfig);
+
+    IfxMultican_Can_MsgObj_initConfig(&msgObjConfig, &load->canNode[0]);
+    msgObjConfig.msgObjId              = 0;
+    msgObjConfig.messageId             = LOADGEN_CAN_ID;
+    msgObjConfig.acceptanceMask        = 0x7FFFFFFFUL;
+    msgObjConfig.frame                 = IfxMultican_Frame_transmit;
+    msgObjConfig.control.messageLen    = IfxMultican_DataLengthCode_8;
+    msgObjConfig.control.extendedFrame = FALSE;
+    msgObjConfig.control.matchingId    = TRUE;
+    IfxMultican_Can_MsgObj_init(&load->canTx, &msgObjConfig);
+
+    IfxMultican_Can_MsgObj_initConfig(&msgObjConfig, &load->canNode[1]);
+    msgObjConfig.msgObjId              = 1;
+    msgObjConfig.messageId             = LOADGEN_CAN_ID;
+    msgObjConfig.acceptanceMask        = 0x7FFFFFFFUL;
+    msgObjConfig.frame                 = IfxMultican_Frame_receive;
+    msgObjConfig.control.messageLen    = IfxMultican_DataLengthCode_8;
+    msgObjConfig.control.extendedFrame = FALSE;
+    msgObjConfig.control.matchingId    = TRUE;
+    msgObjConfig.rxInterrupt.enabled   = TRUE;
+    msgObjConfig.rxInterrupt.srcId     = IfxMultican_SrcId_0;
+    IfxMultican_Can_MsgObj_init(&load->canRx, &msgObjConfig);
+}
+
+
+/** \brief Initialize the DMA channel: LOADGEN_DMA_SIZE bytes from the non cached PFlash to the DSPR of CPU0,
+ * transaction interrupt at the end of each transaction
+ */
+static void LoadGen_initDma(LoadGen *load)
+{
+    IfxDma_Dma_Config        dmaConfig;
+    IfxDma_Dma               dma;
+    IfxDma_Dma_ChannelConfig channelConfig;
+
+    IfxDma_Dma_initModuleConfig(&dmaConfig, &MODULE_DMA);
+    IfxDma_Dma_initModule(&dma, &dmaConfig);
+
+    IfxDma_Dma_initChannelConfig(&channelConfig, &dma);
+    channelConfig.channelId                     = LOAD_DMA_CHANNEL;
+    channelConfig.sourceAddress                 = IFXCPU_NON_CACHED_ADDR(&LoadGen_flashData[0]);
+    channelConfig.destinationAddress            = IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), &LoadGen_dmaBuffer[0]);
+    channelConfig.transferCount                 = LOADGEN_DMA_SIZE / 32;
+    channelConfig.blockMode                     = IfxDma_ChannelMove_8;
+    channelConfig.requestMode                   = IfxDma_ChannelRequestMode_completeTransactionPerRequest;
+    channelConfig.moveSize                      = IfxDma_ChannelMoveSize_32bit;
+    channelConfig.channelInterruptEnabled       = TRUE;
+    channelConfig.channelInterruptPriority      = ISR_PRIORITY_LOAD_DMA;
+    channelConfig.channelInterruptTypeOfService = ISR_PROVIDER_LOAD;
+    IfxDma_Dma_initChannel(&load->dmaChannel, &channelConfig);
+}
+
+
+/** \brief Run one hog window: busy for the hog share of the CPU, reading the non cached PFlash, then idle
+ * \param hog Hog state, global address
+ * \param cpu Calling CPU
+ */
+static void LoadGen_hogWindow(LoadGen_Hog *hog, uint32 cpu)
+{
+    const volatile uint32 *data  = (const volatile uint32 *)IFXCPU_NON_CACHED_ADDR(&LoadGen_flashData[0]);
+    uint32                 start = IfxStm_getLower(&MODULE_STM0);
+    uint32                 sum   = 0;
+    uint32                 index = 0;
+
+    while ((IfxStm_getLower(&MODULE_STM0) - start) < hog->busyTicks[cpu])
+    {
+        sum  += data[index];
+        index = (index + 8) & ((LOADGEN_HOG_SIZE / 4) - 1);
+    }
+
+    hog->sink = sum;
+    hog->windows[cpu]++;
+
+    while ((IfxStm_getLower(&MODULE_STM0) - start) < hog->windowTicks)
+    {}
+}
+
+
+/** \brief Send the next CAN frame, the counter of received frames is the payload
+ */
+static void LoadGen_sendCan(LoadGen *load)
+{
+    IfxMultican_Message msg;
+
+    IfxMultican_Message_init(&msg, LOADGEN_CAN_ID, load->canFrames, ~load->canFrames, IfxMultican_DataLengthCode_8);
+    IfxMultican_Can_MsgObj_sendMessage(&load->canTx, &msg);
+}
+
+
+/** \brief Start the next DMA transaction from the start of the buffers
+ */
+static void LoadGen_startDma(LoadGen *load)
+{
+    IfxDma_Dma_setChannelSourceAddress(&load->dmaChannel, IFXCPU_NON_CACHED_ADDR(&LoadGen_flashData[0]));
+    IfxDma_Dma_setChannelDestinationAddress(&load->dmaChannel, IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), &LoadGen_dmaBuffer[0]));
+    IfxDma_Dma_setChannelTransferCount(&load->dmaChannel, LOADGEN_DMA_SIZE / 32);
+    IfxDma_Dma_startChannelTransaction(&load->dmaChannel);
+}
+
+
+/** \brief Spend CPU cycles, the work of a production interrupt handler
+ * \param cycles CPU cycles
+ */
+static void LoadGen_work(uint32 cycles)
+{
+    uint32 start = IfxCpu_getClockCounter();
+
+    while ((IfxCpu_getClockCounter() - start) < cycles)
+    {}
+}
+
+
+const char *LoadGen_getName(uint32 sources)
+{
+    switch (sources)
+    {
+    case LoadGen_Source_none:
+        return "idle";
+    case LoadGen_Source_stm:
+        return "stm";
+    case LoadGen_Source_gtm:
+        return "gtm";
+    case LoadGen_Source_asclin:
+        return "asclin";
+    case LoadGen_Source_can:
+        return "can";
+    case LoadGen_Source_dma:
+        return "dma";
+    case LoadGen_Source_hog:
+        return "hog";
+    case LoadGen_Source_all:
+        return "all";
+    default:
+        return "mixed";
+    }
+}
+
+
+void LoadGen_initConfig(LoadGen_Config *config)
+{
+    uint32 cpu;
+
+    config->stmFrequency  = 20000;
+    config->gtmFrequency  = 50000;
+    config->ascBaudrate   = 1000000;
+    config->canBaudrate   = 1000000;
+    config->isrWorkCycles = 200;
+
+    for (cpu = 0; cpu < IFXCPU_NUM_MODULES; cpu++)
+    {
+        config->hogPercent[cpu] = 50;
+    }
+}
+
+
+void LoadGen_init(LoadGen *load, const LoadGen_Config *config)
+{
+    uint32 cpu;
+
+    load->active          = LoadGen_Source_none;
+    load->isrWorkCycles   = config->isrWorkCycles;
+    load->stmCount        = 0;
+    load->gtmCount        = 0;
+    load->canFrames       = 0;
+    load->dmaTransactions = 0;
+    load->ascBytes        = 0;
+
+    load->hog              = (LoadGen_Hog *)IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), &LoadGen_hog);
+    load->hog->active      = FALSE;
+    load->hog->windowTicks = (uint32)((IfxStm_getFrequency(&MODULE_STM0) * LOADGEN_HOG_WINDOW_US) / 1000000);
+
+    for (cpu = 0; cpu < IFXCPU_NUM_MODULES; cpu++)
+    {
+        load->hogPercent[cpu]      = (uint8)__min(config->hogPercent[cpu], 100);
+        load->hog->busyTicks[cpu]  = (load->hog->windowTicks * load->hogPercent[cpu]) / 100;
+        load->hog->windows[cpu]    = 0;
+    }
+
+    LoadGen_initStm(load, config);
+    LoadGen_initGtm(load, config);
+    LoadGen_initAsclin(load, config);
+    LoadGen_initCan(load, config);
+    LoadGen_initDma(load);
+}
+
+
+void LoadGen_isrStm(LoadGen *load)
+{
+    IfxStm_clearCompareFlag(&MODULE_STM0, IfxStm_Comparator_1);
+    IfxStm_increaseCompare(&MODULE_STM0, IfxStm_Comparator_1, load->stmTicks);
+    load->stmCount++;
+    LoadGen_work(load->isrWorkCycles);
+}
+
+
+void LoadGen_isrGtm(LoadGen *load)
+{
+    IfxGtm_Tom_Timer_acknowledgeTimerIrq(&load->timer);
+    load->gtmCount++;
+    LoadGen_work(load->isrWorkCycles);
+}
+
+
+void LoadGen_isrCan(LoadGen *load)
+{
+    IfxMultican_Message msg;
+
+    IfxMultican_Can_MsgObj_readMessage(&load->canRx, &msg);
+    load->canFrames++;
+
+    if ((load->active & LoadGen_Source_can) != 0)
+    {
+        LoadGen_sendCan(load);
+    }
+}
+
+
+void LoadGen_isrDma(LoadGen *load)
+{
+    load->dmaTransactions++;
+
+    if ((load->active & LoadGen_Source_dma) != 0)
+    {
+        LoadGen_startDma(load);
+    }
+}
+
+
+void LoadGen_run(LoadGen *load)
+{
+    uint32 active = load->active;
+
+    if ((active & LoadGen_Source_asclin) != 0)
+    {
+        uint8     data[LOADGEN_ASC_BUFFER_SIZE];
+        Ifx_SizeT count;
+        Ifx_SizeT i;
+
+        count = (Ifx_SizeT)IfxAsclin_Asc_getReadCount(&load->asc);
+
+        if (count > 0)
+        {
+            count           = (Ifx_SizeT)__min(count, LOADGEN_ASC_BUFFER_SIZE);
+            IfxAsclin_Asc_read(&load->asc, data, &count, TIME_NULL);
+            load->ascBytes += count;
+        }
+
+        for (i = 0; i < LOADGEN_ASC_BUFFER_SIZE; i++)
+        {
+            data[i] = (uint8)i;
+        }
+
+        count = (Ifx_SizeT)IfxAsclin_Asc_getWriteCount(&load->asc);
+        count = (Ifx_SizeT)__min(count, LOADGEN_ASC_BUFFER_SIZE);
+
+        if (count > 0)
+        {
+            IfxAsclin_Asc_write(&load->asc, data, &count, TIME_NULL);
+        }
+    }
+
+    if ((active & LoadGen_Source_hog) != 0)
+    {
+        LoadGen_hogWindow(load->hog, 0);
+    }
+}
+
+
+void LoadGen_runHog(void)
+{
+    LoadGen_Hog *hog = (LoadGen_Hog *)IFXCPU_GLB_ADDR_DSPR(IfxCpu_Id_0, &LoadGen_hog);
+
+    if (hog->active != FALSE)
+    {
+        LoadGen_hogWindow(hog, IfxCpu_getCoreIndex());
+    }
+}
+
+
+void LoadGen_start(LoadGen *load, uint32 sources)
+{
+    uint32 cpu;
+
+    load->stmCount        = 0;
+    load->gtmCount        = 0;
+    load->canFrames       = 0;
+    load->dmaTransactions = 0;
+    load->ascBytes        = 0;
+
+    for (cpu = 0; cpu < IFXCPU_NUM_MODULES; cpu++)
+    {
+        load->hog->windows[cpu] = 0;
+    }
+
+    load->active      = sources;
+    load->hog->active = (sources & LoadGen_Source_hog) != 0;
+
+    if ((sources & LoadGen_Source_stm) != 0)
+    {
+        IfxStm_updateCompare(&MODULE_STM0, IfxStm_Comparator_1, IfxStm_getLower(&MODULE_STM0) + load->stmTicks);
+        IfxStm_clearCompareFlag(&MODULE_STM0, IfxStm_Comparator_1);
+        IfxStm_enableComparatorInterrupt(&MODULE_STM0, IfxStm_Comparator_1);
+    }
+
+    if ((sources & LoadGen_Source_gtm) != 0)
+    {
+        IfxGtm_Tom_Timer_run(&load->timer);
+    }
+
+    if ((sources & LoadGen_Source_can) != 0)
+    {
+        LoadGen_sendCan(load);
+    }
+
+    if ((sources & LoadGen_Source_dma) != 0)
+    {
+        LoadGen_startDma(load);
+    }
+}
+
+
+void LoadGen_stop(LoadGen *load)
+{
+    load->active      = LoadGen_Source_none;
+    load->hog->active = FALSE;
+
+    IfxStm_disableComparatorInterrupt(&MODULE_STM0, IfxStm_Comparator_1);
+    IfxGtm_Tom_Timer_stop(&load->timer);
+
+    while (IfxDma_Dma_isChannelTransactionPending(&load->dmaChannel) != FALSE)
+    {}
+}
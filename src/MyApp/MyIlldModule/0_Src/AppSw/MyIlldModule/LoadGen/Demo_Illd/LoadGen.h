@@ -0,0 +1,208 @@
+/**
+ * \file LoadGen.h
+ * \brief Synthetic production load: interrupt storms, communication at line rate, DMA traffic and CPU hogs
+ *
+ * \version iLLD_Demos_1_0_1_4_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * Each load source reproduces a part of the production load, the sources can be combined:
+ * - STM: STM0 comparator 1 interrupt at LoadGen_Config::stmFrequency.
+ * - GTM: TOM timer interrupt at LoadGen_Config::gtmFrequency.
+ * - ASCLIN: loop back at LoadGen_Config::ascBaudrate, one transmit and one receive interrupt per byte. The
+ *   background loop keeps the transmit buffer filled and empties the receive buffer.
+ * - CAN: node 0 sends to node 1 through the loop back bus at LoadGen_Config::canBaudrate. The receive interrupt
+ *   sends the next frame, the bus load is 100%.
+ * - DMA: a DMA channel copies LOADGEN_DMA_SIZE bytes from the non cached PFlash to the DSPR of CPU0. The
+ *   transaction interrupt starts the next transaction, the DMA is busy all the time.
+ * - hog: the background loop of each CPU is busy for LoadGen_Config::hogPercent of each LOADGEN_HOG_WINDOW_US
+ *   window, reading the non cached PFlash. CPU0 runs its hog in \ref LoadGen_run(), the other CPUs call
+ *   \ref LoadGen_runHog() from their background loop.
+ *
+ * The STM and GTM interrupts spend LoadGen_Config::isrWorkCycles CPU cycles, the work of a production handler.
+ * The CPU clock counter shall be running (\ref IfxCpu_resetAndStartCounters()).
+ *
+ * The interrupts are serviced by CPU0 (ISR_PROVIDER_LOAD): the application defines them with the interrupt
+ * priorities of ConfigurationIsr.h and calls the LoadGen_isr*() functions.
+ *
+ * \defgroup IfxLld_Demo_LoadGenDemo_SrcDoc_Load Load generator
+ * \ingroup IfxLld_Demo_LoadGenDemo_SrcDoc
+ */
+
+#ifndef LOADGEN_H
+#define LOADGEN_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include <Multican/Can/IfxMultican_Can.h>
+#include <Asclin/Asc/IfxAsclin_Asc.h>
+#include <Gtm/Tom/Timer/IfxGtm_Tom_Timer.h>
+#include <Dma/Dma/IfxDma_Dma.h>
+#include <Stm/Std/IfxStm.h>
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+#define LOADGEN_ASC_BUFFER_SIZE (256)               /**< \brief ASCLIN software FIFO size, covers one hog window of CPU0 */
+#define LOADGEN_DMA_SIZE        (4096)              /**< \brief Bytes copied by one DMA transaction */
+#define LOADGEN_HOG_SIZE        (8192)              /**< \brief Bytes of PFlash read by the hogs */
+#define LOADGEN_HOG_WINDOW_US   (1000)              /**< \brief Hog window, the CPU is busy for hogPercent of each window */
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+/** \addtogroup IfxLld_Demo_LoadGenDemo_SrcDoc_Load
+ * \{ */
+
+/** \brief Load sources, can be combined
+ */
+typedef enum
+{
+    LoadGen_Source_none   = 0,
+    LoadGen_Source_stm    = 1,
+    LoadGen_Source_gtm    = 2,
+    LoadGen_Source_asclin = 4,
+    LoadGen_Source_can    = 8,
+    LoadGen_Source_dma    = 16,
+    LoadGen_Source_hog    = 32,
+    LoadGen_Source_all    = 63
+} LoadGen_Source;
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+
+/** \brief Load generator configuration
+ */
+typedef struct
+{
+    float32 stmFrequency;                       /**< \brief STM storm interrupt frequency in Hz */
+    float32 gtmFrequency;                       /**< \brief GTM storm interrupt frequency in Hz */
+    uint32  ascBaudrate;                        /**< \brief ASCLIN baudrate */
+    uint32  canBaudrate;                        /**< \brief CAN baudrate */
+    uint32  isrWorkCycles;                      /**< \brief CPU cycles spent in each STM and GTM storm interrupt */
+    uint8   hogPercent[IFXCPU_NUM_MODULES];     /**< \brief Busy share of the background loop of each CPU in percent */
+} LoadGen_Config;
+
+/** \brief State shared with the hogs of the other CPUs, located in the DSPR of CPU0
+ */
+typedef struct
+{
+    volatile boolean active;                        /**< \brief TRUE while the hogs run */
+    uint32           windowTicks;                   /**< \brief Hog window in STM ticks */
+    uint32           busyTicks[IFXCPU_NUM_MODULES]; /**< \brief Busy part of the window of each CPU in STM ticks */
+    volatile uint32  windows[IFXCPU_NUM_MODULES];   /**< \brief Busy windows executed by each CPU */
+    volatile uint32  sink;                          /**< \brief Sum of the data read by the hogs, not used */
+} LoadGen_Hog;
+
+/** \brief Load generator handle
+ */
+typedef struct
+{
+    IfxMultican_Can        can;                                                     /**< \brief CAN module */
+    IfxMultican_Can_Node   canNode[2];                                              /**< \brief Sending and receiving nodes */
+    IfxMultican_Can_MsgObj canTx;                                                   /**< \brief Transmit message object of node 0 */
+    IfxMultican_Can_MsgObj canRx;                                                   /**< \brief Receive message object of node 1 */
+    IfxAsclin_Asc          asc;                                                     /**< \brief ASCLIN in loop back mode */
+    uint8                  ascTx[LOADGEN_ASC_BUFFER_SIZE + sizeof(Ifx_Fifo) + 8];   /**< \brief ASCLIN transmit buffer */
+    uint8                  ascRx[LOADGEN_ASC_BUFFER_SIZE + sizeof(Ifx_Fifo) + 8];   /**< \brief ASCLIN receive buffer */
+    IfxGtm_Tom_Timer       timer;                                                   /**< \brief TOM timer of the GTM storm */
+    IfxDma_Dma_Channel     dmaChannel;                                              /**< \brief DMA channel of the memory traffic */
+    uint32                 stmTicks;                                                /**< \brief STM storm period in STM ticks */
+    uint32                 isrWorkCycles;                                           /**< \brief CPU cycles spent in each storm interrupt */
+    uint8                  hogPercent[IFXCPU_NUM_MODULES];                          /**< \brief Busy share of each CPU in percent */
+    LoadGen_Hog           *hog;                                                     /**< \brief Hog state, global address */
+    volatile uint32        active;                                                  /**< \brief Active sources, see \ref LoadGen_Source */
+    volatile uint32        stmCount;                                                /**< \brief STM storm interrupts */
+    volatile uint32        gtmCount;                                                /**< \brief GTM storm interrupts */
+    volatile uint32        canFrames;                                               /**< \brief Received CAN frames */
+    volatile uint32        dmaTransactions;                                         /**< \brief Completed DMA transactions */
+    uint32                 ascBytes;                                                /**< \brief Received ASCLIN bytes */
+} LoadGen;
+
+/** \} */
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+/** \addtogroup IfxLld_Demo_LoadGenDemo_SrcDoc_Load
+ * \{ */
+
+/** \brief Initialize the configuration with default values: 20 kHz STM storm, 50 kHz GTM storm, ASCLIN at 1 Mbit/s,
+ * CAN at 1 Mbit/s, 200 cycles per storm interrupt, hogs busy for 50% of the time
+ * \param config Configuration structure
+ */
+IFX_EXTERN void LoadGen_initConfig(LoadGen_Config *config);
+
+/** \brief Initialize the STM comparator, the TOM timer, the ASCLIN, the CAN nodes and the DMA channel, no load is active
+ * \param load Load handle
+ * \param config Configuration structure
+ */
+IFX_EXTERN void LoadGen_init(LoadGen *load, const LoadGen_Config *config);
+
+/** \brief Start the load sources and clear the counters
+ * \param load Load handle
+ * \param sources Sources to start, see \ref LoadGen_Source
+ */
+IFX_EXTERN void LoadGen_start(LoadGen *load, uint32 sources);
+
+/** \brief Stop all load sources, the DMA transaction in progress is finished
+ * \param load Load handle
+ */
+IFX_EXTERN void LoadGen_stop(LoadGen *load);
+
+/** \brief Keep the ASCLIN load running and run one hog window of CPU0, to be called from the background loop of CPU0
+ * \param load Load handle
+ */
+IFX_EXTERN void LoadGen_run(LoadGen *load);
+
+/** \brief Run one hog window of the calling CPU, to be called from the background loop of CPU1 and CPU2
+ *
+ * Returns at once when the hogs are not active.
+ */
+IFX_EXTERN void LoadGen_runHog(void);
+
+/** \brief Handle the STM storm interrupt
+ * \param load Load handle
+ */
+IFX_EXTERN void LoadGen_isrStm(LoadGen *load);
+
+/** \brief Handle the GTM storm interrupt
+ * \param load Load handle
+ */
+IFX_EXTERN void LoadGen_isrGtm(LoadGen *load);
+
+/** \brief Handle the CAN receive interrupt: read the frame and send the next one
+ * \param load Load handle
+ */
+IFX_EXTERN void LoadGen_isrCan(LoadGen *load);
+
+/** \brief Handle the DMA transaction interrupt: start the next transaction
+ * \param load Load handle
+ */
+IFX_EXTERN void LoadGen_isrDma(LoadGen *load);
+
+/** \brief Return the name of a load source combination for the report
+ * \param sources Sources, see \ref LoadGen_Source
+ * \return Name
+ */
+IFX_EXTERN const char *LoadGen_getName(uint32 sources);
+
+/** \} */
+
+#endif
@@ -0,0 +1,390 @@
+/**
+ * \file LoadGenDemo.c
+ * \brief Demo LoadGenDemo
+ *
+ * \version iLLD_Demos_1_0_1_4_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include <stdio.h>
+#include "LoadGenDemo.h"
+#include "Configuration.h"
+#include "ConfigurationIsr.h"
+#include "SysSe/Bsp/Bsp.h"
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+#define LOADGENDEMO_CONTROL_STEPS (16)     /**< \brief Sub-steps of the control computation */
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+App_LoadGen g_LoadGen; /**< \brief Demo information */
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+static void    LoadGenDemo_control(App_LoadGen *app);
+static boolean LoadGenDemo_report(uint32 sources);
+static void    LoadGenDemo_resetStatistics(void);
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+/** \brief Scenarios run one after the other, the last one is the worst case */
+static const uint32 LoadGenDemo_loads[] = {
+    LoadGen_Source_none,
+    LoadGen_Source_stm,
+    LoadGen_Source_gtm,
+    LoadGen_Source_asclin,
+    LoadGen_Source_can,
+    LoadGen_Source_dma,
+    LoadGen_Source_hog,
+    LoadGen_Source_all
+};
+
+/** \brief Interrupt names of the report and of the profiler */
+static const char *const LoadGenDemo_isrNames[LoadGenDemo_Isr_count] = {
+    "control", "stm", "gtm", "ascTx", "ascRx", "can", "dma"
+};
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+/** \addtogroup IfxLld_Demo_LoadGenDemo_SrcDoc_Main_Interrupt
+ * \{ */
+
+/** \name Interrupts of the control task and of the load, measured by the profiler.
+ * \{ */
+
+/** \brief Handle the control task: latency measurement and control computation
+ *
+ * \isrProvider \ref ISR_PROVIDER_CONTROL
+ * \isrPriority \ref ISR_PRIORITY_CONTROL
+ *
+ */
+IFX_PROFILER_INTERRUPT(LoadGenDemo_controlIsr, 0, ISR_PRIORITY_CONTROL, &g_LoadGen.profiler, g_LoadGen.profilerIds[LoadGenDemo_Isr_control])
+{
+    Ifx_IsrLatency_measureStm(&g_LoadGen.latency, g_LoadGen.latencyId, &MODULE_STM0, IfxStm_Comparator_0);
+    IfxStm_clearCompareFlag(&MODULE_STM0, IfxStm_Comparator_0);
+    IfxStm_increaseCompare(&MODULE_STM0, IfxStm_Comparator_0, g_LoadGen.controlTicks);
+    LoadGenDemo_control(&g_LoadGen);
+}
+
+
+/** \brief Handle the STM storm interrupt
+ *
+ * \isrProvider \ref ISR_PROVIDER_LOAD
+ * \isrPriority \ref ISR_PRIORITY_LOAD_STM
+ *
+ */
+IFX_PROFILER_INTERRUPT(LoadGenDemo_stmIsr, 0, ISR_PRIORITY_LOAD_STM, &g_LoadGen.profiler, g_LoadGen.profilerIds[LoadGenDemo_Isr_stm])
+{
+    LoadGen_isrStm(&g_LoadGen.load);
+}
+
+
+/** \brief Handle the GTM storm interrupt
+ *
+ * \isrProvider \ref ISR_PROVIDER_LOAD
+ * \isrPriority \ref ISR_PRIORITY_LOAD_GTM
+ *
+ */
+IFX_PROFILER_INTERRUPT(LoadGenDemo_gtmIsr, 0, ISR_PRIORITY_LOAD_GTM, &g_LoadGen.profiler, g_LoadGen.profilerIds[LoadGenDemo_Isr_gtm])
+{
+    LoadGen_isrGtm(&g_LoadGen.load);
+}
+
+
+/** \brief Handle the ASCLIN load transmit interrupt
+ *
+ * \isrProvider \ref ISR_PROVIDER_LOAD
+ * \isrPriority \ref ISR_PRIORITY_LOAD_ASC_TX
+ *
+ */
+IFX_PROFILER_INTERRUPT(LoadGenDemo_ascTxIsr, 0, ISR_PRIORITY_LOAD_ASC_TX, &g_LoadGen.profiler, g_LoadGen.profilerIds[LoadGenDemo_Isr_ascTx])
+{
+    IfxAsclin_Asc_isrTransmit(&g_LoadGen.load.asc);
+}
+
+
+/** \brief Handle the ASCLIN load receive interrupt
+ *
+ * \isrProvider \ref ISR_PROVIDER_LOAD
+ * \isrPriority \ref ISR_PRIORITY_LOAD_ASC_RX
+ *
+ */
+IFX_PROFILER_INTERRUPT(LoadGenDemo_ascRxIsr, 0, ISR_PRIORITY_LOAD_ASC_RX, &g_LoadGen.profiler, g_LoadGen.profilerIds[LoadGenDemo_Isr_ascRx])
+{
+    IfxAsclin_Asc_isrReceive(&g_LoadGen.load.asc);
+}
+
+
+/** \brief Handle the CAN load receive interrupt
+ *
+ * \isrProvider \ref ISR_PROVIDER_LOAD
+ * \isrPriority \ref ISR_PRIORITY_LOAD_CAN
+ *
+ */
+IFX_PROFILER_INTERRUPT(LoadGenDemo_canIsr, 0, ISR_PRIORITY_LOAD_CAN, &g_LoadGen.profiler, g_LoadGen.profilerIds[LoadGenDemo_Isr_can])
+{
+    LoadGen_isrCan(&g_LoadGen.load);
+}
+
+
+/** \brief Handle the DMA load transaction interrupt
+ *
+ * \isrProvider \ref ISR_PROVIDER_LOAD
+ * \isrPriority \ref ISR_PRIORITY_LOAD_DMA
+ *
+ */
+IFX_PROFILER_INTERRUPT(LoadGenDemo_dmaIsr, 0, ISR_PRIORITY_LOAD_DMA, &g_LoadGen.profiler, g_LoadGen.profilerIds[LoadGenDemo_Isr_dma])
+{
+    LoadGen_isrDma(&g_LoadGen.load);
+}
+
+/** \} */
+
+/** \name Interrupts of the load, not measured.
+ * \{ */
+IFX_INTERRUPT(LoadGenDemo_ascErIsr, 0, ISR_PRIORITY_LOAD_ASC_EX);
+/** \} */
+
+/** \} */
+
+/** \brief Handle the ASCLIN load error interrupt
+ *
+ * \isrProvider \ref ISR_PROVIDER_LOAD
+ * \isrPriority \ref ISR_PRIORITY_LOAD_ASC_EX
+ *
+ */
+void LoadGenDemo_ascErIsr(void)
+{
+    IfxAsclin_Asc_isrError(&g_LoadGen.load.asc);
+}
+
+
+/** \brief Reference control computation: PI controller of a first order plant, LOADGENDEMO_CONTROL_STEPS sub-steps
+ */
+static void LoadGenDemo_control(App_LoadGen *app)
+{
+    float32 plant    = app->controlState[0];
+    float32 integral = app->controlState[1];
+    uint32  step;
+
+    for (step = 0; step < LOADGENDEMO_CONTROL_STEPS; step++)
+    {
+        float32 error   = 1.0f - plant;
+        float32 command;
+
+        integral += 0.01f * error;
+        command   = (0.5f * error) + integral;
+        plant    += 0.05f * (command - plant);
+    }
+
+    /* restart from the initial state once settled, the execution time stays the same */
+    if (plant > 0.999f)
+    {
+        plant    = 0.0f;
+        integral = 0.0f;
+    }
+
+    app->controlState[0] = plant;
+    app->controlState[1] = integral;
+}
+
+
+/** \brief Clear the profiler and the latency statistics
+ */
+static void LoadGenDemo_resetStatistics(void)
+{
+    boolean interruptState = IfxCpu_disableInterrupts();
+
+    Ifx_Profiler_reset(&g_LoadGen.profiler);
+    Ifx_IsrLatency_reset(&g_LoadGen.latency);
+
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+
+/** \brief Print the records of one scenario and evaluate the regression gate
+ * \param sources Load sources of the scenario
+ * \return TRUE if the control task latency is within its limit and the control task within its budget
+ */
+static boolean LoadGenDemo_report(uint32 sources)
+{
+    LoadGen                    *load      = &g_LoadGen.load;
+    const char                 *name      = LoadGen_getName(sources);
+    const Ifx_IsrLatency_Entry *latency   = &g_LoadGen.latency.entries[g_LoadGen.latencyId];
+    const Ifx_Profiler_Entry   *control   = &g_LoadGen.profiler.entries[g_LoadGen.profilerIds[LoadGenDemo_Isr_control]];
+    float32                     nsPerTick = 1.0e9f / IfxStm_getFrequency(&MODULE_STM0);
+    uint32                      limit     = LOADGENDEMO_LIMIT_LATENCY_US * 1000;
+    boolean                     pass;
+    uint32                      i;
+
+    if (latency->count > 0)
+    {
+        uint32 max = (uint32)(latency->max * nsPerTick);
+
+        pass = (max <= limit) && (control->overrunCount == 0);
+        printf("LOADGEN_LAT,%s,%u,%u,%u,%u,%u,%u,%s\n", name, (unsigned)latency->count,
+            (unsigned)(latency->min * nsPerTick),
+            (unsigned)max,
+            (unsigned)((latency->sum / latency->count) * nsPerTick),
+            (unsigned)((latency->max - latency->min) * nsPerTick),
+            (unsigned)limit, pass ? "pass" : "fail");
+    }
+    else
+    {
+        pass = FALSE;
+        printf("LOADGEN_LAT,%s,0,0,0,0,0,%u,fail\n", name, (unsigned)limit);
+    }
+
+    for (i = 0; i < LoadGenDemo_Isr_count; i++)
+    {
+        const Ifx_Profiler_Entry *entry = &g_LoadGen.profiler.entries[g_LoadGen.profilerIds[i]];
+
+        if (entry->count > 0)
+        {
+            printf("LOADGEN_ISR,%s,%s,%u,%u,%u,%u,%u\n", name, LoadGenDemo_isrNames[i], (unsigned)entry->count,
+                (unsigned)entry->min, (unsigned)entry->max, (unsigned)Ifx_Profiler_getMean(entry),
+                (unsigned)entry->overrunCount);
+        }
+    }
+
+    printf("LOADGEN_COUNT,%s,%u,%u,%u,%u,%u", name, (unsigned)load->stmCount, (unsigned)load->gtmCount,
+        (unsigned)load->ascBytes, (unsigned)load->canFrames, (unsigned)load->dmaTransactions);
+
+    for (i = 0; i < IFXCPU_NUM_MODULES; i++)
+    {
+        printf(",%u", (unsigned)load->hog->windows[i]);
+    }
+
+    printf("\n");
+
+    return pass;
+}
+
+
+/** \brief Demo init API
+ *
+ * This function is called from main during initialization phase
+ */
+void LoadGenDemo_init(void)
+{
+    uint32 i;
+
+    /* CPU0 performance counters, used by the profiler and the storm interrupts */
+    IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+
+    /* profiler and latency measurement, the entries exist before the interrupts are enabled */
+    Ifx_Profiler_init(&g_LoadGen.profiler, 6);
+
+    for (i = 0; i < LoadGenDemo_Isr_count; i++)
+    {
+        g_LoadGen.profilerIds[i] = Ifx_Profiler_addEntry(&g_LoadGen.profiler, LoadGenDemo_isrNames[i],
+            (i == LoadGenDemo_Isr_control) ? LOADGENDEMO_CONTROL_BUDGET : 0);
+    }
+
+    Ifx_IsrLatency_init(&g_LoadGen.latency, 2);
+    g_LoadGen.latencyId = Ifx_IsrLatency_addEntry(&g_LoadGen.latency, "control", ISR_PRIORITY_CONTROL);
+
+    /* load generator, see LoadGen_initConfig() for the default load */
+    LoadGen_Config config;
+    LoadGen_initConfig(&config);
+    LoadGen_init(&g_LoadGen.load, &config);
+
+    /* control task on STM0 comparator 0 */
+    IfxStm_CompareConfig stmConfig;
+    g_LoadGen.controlTicks    = (uint32)(IfxStm_getFrequency(&MODULE_STM0) / LOADGENDEMO_CONTROL_FREQUENCY);
+    g_LoadGen.controlState[0] = 0.0f;
+    g_LoadGen.controlState[1] = 0.0f;
+
+    IfxStm_initCompareConfig(&stmConfig);
+    stmConfig.comparator      = IfxStm_Comparator_0;
+    stmConfig.ticks           = g_LoadGen.controlTicks;
+    stmConfig.triggerPriority = ISR_PRIORITY_CONTROL;
+    stmConfig.typeOfService   = ISR_PROVIDER_CONTROL;
+    IfxStm_initCompare(&MODULE_STM0, &stmConfig);
+
+    printf("Load generator: STM storm %d Hz, GTM storm %d Hz, control task %d Hz\n", (int)config.stmFrequency,
+        (int)config.gtmFrequency, (int)LOADGENDEMO_CONTROL_FREQUENCY);
+}
+
+
+/** \brief Demo run API
+ *
+ * This function is called once from main.
+ * The control task is measured under each scenario and the report is printed.
+ *
+ * \return TRUE if the regression gate passed for all scenarios
+ */
+boolean LoadGenDemo_run(void)
+{
+    LoadGen *load = &g_LoadGen.load;
+    boolean  pass = TRUE;
+    uint32   i;
+
+    printf("LOADGEN_BEGIN,%u,%u,%u,%u\n", (unsigned)IfxScuCcu_getCpuFrequency(IfxCpu_ResourceCpu_0),
+        (unsigned)IfxStm_getFrequency(&MODULE_STM0), (unsigned)LOADGENDEMO_CONTROL_FREQUENCY, (unsigned)LOADGENDEMO_DURATION_MS);
+
+    for (i = 0; i < (sizeof(LoadGenDemo_loads) / sizeof(LoadGenDemo_loads[0])); i++)
+    {
+        Ifx_TickTime deadLine;
+
+        LoadGen_start(load, LoadGenDemo_loads[i]);
+
+        deadLine = getDeadLine(TimeConst_1ms * LOADGENDEMO_WARMUP_MS);
+
+        while (isDeadLine(deadLine) == FALSE)
+        {
+            LoadGen_run(load);
+        }
+
+        LoadGenDemo_resetStatistics();
+        deadLine = getDeadLine(TimeConst_1ms * LOADGENDEMO_DURATION_MS);
+
+        while (isDeadLine(deadLine) == FALSE)
+        {
+            LoadGen_run(load);
+        }
+
+        LoadGen_stop(load);
+
+        if (LoadGenDemo_report(LoadGenDemo_loads[i]) == FALSE)
+        {
+            pass = FALSE;
+        }
+    }
+
+    printf("LOADGEN_END,%s\n", pass ? "pass" : "fail");
+
+    return pass;
+}
@@ -0,0 +1,109 @@
+/**
+ * \file LoadGenDemo.h
+ * \brief Demo LoadGenDemo
+ *
+ * \version iLLD_Demos_1_0_1_4_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * The load generator (see \ref LoadGen.h) runs the production load one source after the other, then all sources
+ * together ("worst case" scenario). A control task, STM0 comparator 0 interrupt at LOADGENDEMO_CONTROL_FREQUENCY,
+ * is the victim: its latency is recorded with \ref library_srvsw_sysse_time_isrlatency and its execution time,
+ * as the one of the load interrupts, with \ref library_srvsw_sysse_time_profiler. Each scenario runs for
+ * LOADGENDEMO_DURATION_MS, after a warm up of LOADGENDEMO_WARMUP_MS.
+ *
+ * The report is printed on the standard output, one line per record, for the regression scripts:
+ * \code
+ * LOADGEN_BEGIN,<CPU Hz>,<STM Hz>,<control Hz>,<duration ms>
+ * LOADGEN_LAT,<load>,<count>,<min ns>,<max ns>,<mean ns>,<jitter ns>,<limit ns>,<pass|fail>
+ * LOADGEN_ISR,<load>,<interrupt>,<count>,<min cycles>,<max cycles>,<mean cycles>,<overruns>
+ * LOADGEN_COUNT,<load>,<stm>,<gtm>,<asclin bytes>,<can frames>,<dma transactions>,<hog windows CPU0>,...
+ * LOADGEN_END,<pass|fail>
+ * \endcode
+ *
+ * The regression gate fails when the maximal latency of the control task exceeds LOADGENDEMO_LIMIT_LATENCY_US,
+ * or when its execution exceeds its budget, LOADGENDEMO_CONTROL_BUDGET cycles.
+ *
+ * \defgroup IfxLld_Demo_LoadGenDemo_SrcDoc_Main Demo Source
+ * \ingroup IfxLld_Demo_LoadGenDemo_SrcDoc
+ * \defgroup IfxLld_Demo_LoadGenDemo_SrcDoc_Main_Interrupt Interrupts
+ * \ingroup IfxLld_Demo_LoadGenDemo_SrcDoc_Main
+ */
+
+#ifndef LOADGENDEMO_H
+#define LOADGENDEMO_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "LoadGen.h"
+#include "SysSe/Time/Ifx_IsrLatency.h"
+#include "SysSe/Time/Ifx_Profiler.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+#define LOADGENDEMO_CONTROL_FREQUENCY (1000)                  /**< \brief Control task frequency in Hz */
+#define LOADGENDEMO_CONTROL_BUDGET    (20000)                 /**< \brief Control task budget in CPU cycles */
+#define LOADGENDEMO_DURATION_MS       (1000)                  /**< \brief Duration of each scenario */
+#define LOADGENDEMO_WARMUP_MS         (100)                   /**< \brief Load running before the figures are recorded */
+#define LOADGENDEMO_LIMIT_LATENCY_US  (20)                    /**< \brief Limit of the control task latency */
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+
+/** \brief Profiled interrupts
+ */
+typedef enum
+{
+    LoadGenDemo_Isr_control = 0,
+    LoadGenDemo_Isr_stm,
+    LoadGenDemo_Isr_gtm,
+    LoadGenDemo_Isr_ascTx,
+    LoadGenDemo_Isr_ascRx,
+    LoadGenDemo_Isr_can,
+    LoadGenDemo_Isr_dma,
+    LoadGenDemo_Isr_count
+} LoadGenDemo_Isr;
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+typedef struct
+{
+    LoadGen        load;                               /* load generator */
+    Ifx_Profiler   profiler;                           /* execution time of the interrupts of CPU0 */
+    Ifx_IsrLatency latency;                            /* latency of the control task */
+    sint32         profilerIds[LoadGenDemo_Isr_count]; /* profiler entries of the interrupts */
+    sint32         latencyId;                          /* latency entry of the control task */
+    uint32         controlTicks;                       /* control task period in STM ticks */
+    float32        controlState[2];                    /* state of the control computation */
+} App_LoadGen;
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+IFX_EXTERN App_LoadGen g_LoadGen;
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+IFX_EXTERN void    LoadGenDemo_init(void);
+IFX_EXTERN boolean LoadGenDemo_run(void);
+
+#endif
@@ -0,0 +1,294 @@
+/**
+ * \file LineScan.c
+ * \brief Line scan camera (TSL1401) acquisition driver
+ *
+ * \version iLLD_Demos_1_0_0_11_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "LineScan.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+#define LINESCAN_FIFO_SIZE (4)  /**< \brief Result registers RES3..RES0 absorbing the DMA latency */
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+static void LineScan_initTomChannel(Ifx_GTM_TOM *tom, Ifx_GTM_TOM_TGC *tgc, IfxGtm_Tom_Ch channel, IfxGtm_Tom_Ch_ClkSrc clock, Ifx_ActiveState signalLevel, uint32 period, uint32 dutyCycle);
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+/** \brief Configure a TOM channel as PWM, started by the next trigger of its TGC
+ *
+ * The output is signalLevel from the counter reset until the counter reaches dutyCycle. The counter is
+ * reset by the TGC trigger, the channels of the TGC start in phase.
+ */
+static void LineScan_initTomChannel(Ifx_GTM_TOM *tom, Ifx_GTM_TOM_TGC *tgc, IfxGtm_Tom_Ch channel, IfxGtm_Tom_Ch_ClkSrc clock, Ifx_ActiveState signalLevel, uint32 period, uint32 dutyCycle)
+{
+    IfxGtm_Tom_Ch_setClockSource(tom, channel, clock);
+    IfxGtm_Tom_Ch_setSignalLevel(tom, channel, signalLevel);
+    IfxGtm_Tom_Ch_setCompare(tom, channel, period, dutyCycle);
+    IfxGtm_Tom_Ch_setCompareShadow(tom, channel, period, dutyCycle);
+
+    IfxGtm_Tom_Tgc_setChannelForceUpdate(tgc, channel, TRUE, TRUE);
+    IfxGtm_Tom_Tgc_enableChannel(tgc, channel, TRUE, FALSE);
+    IfxGtm_Tom_Tgc_enableChannelOutput(tgc, channel, TRUE, FALSE);
+}
+
+
+void LineScan_initConfig(LineScan_Config *config, IfxVadc_Adc *vadc)
+{
+    uint8 camera;
+
+    config->si                = NULL_PTR;
+    config->clk               = NULL_PTR;
+    config->triggerChannel    = IfxGtm_Tom_Ch_0;
+    config->triggerAdcChannel = (IfxGtm_Trig_AdcTrigChannel)0;
+    config->clockFrequency    = 200000.0;
+    config->vadc              = vadc;
+    config->groupId           = IfxVadc_GroupId_0;
+    config->triggerInput      = IfxVadc_TriggerSource_2;
+
+    for (camera = 0; camera < LINESCAN_MAX_CAMERAS; camera++)
+    {
+        config->channels[camera] = (IfxVadc_ChannelId)camera;
+    }
+
+    config->cameraCount       = 1;
+    config->dma               = NULL_PTR;
+    config->dmaChannelId      = IfxDma_ChannelId_1;
+    config->buffer            = NULL_PTR;
+    config->framePriority     = 0;
+    config->frameServProvider = IfxSrc_Tos_cpu0;
+}
+
+
+boolean LineScan_init(LineScan *driver, const LineScan_Config *config)
+{
+    Ifx_GTM                *gtm = &MODULE_GTM;
+    Ifx_GTM_TOM            *tom;
+    IfxGtm_Cmu_Fxclk        clock;
+    uint32                  period = 0;
+    uint8                   camera;
+    uint8                   other;
+    uint32                  channels;
+    float32                 frequency = 0;
+
+    if ((config->cameraCount == 0) || (config->cameraCount > LINESCAN_MAX_CAMERAS)
+        || (config->si->tom != config->clk->tom)
+        || ((config->si->channel / 8) != (config->clk->channel / 8))
+        || ((config->triggerChannel / 8) != (config->clk->channel / 8))
+        || (config->triggerChannel == config->clk->channel) || (config->triggerChannel == config->si->channel))
+    {
+        return FALSE;
+    }
+
+    /* GTM clocks: the longest frame must fit in the 16 bit counter of the SI channel */
+    IfxGtm_enable(gtm);
+    IfxGtm_Cmu_setGclkFrequency(gtm, IfxGtm_Cmu_getModuleFrequency(gtm));
+    IfxGtm_Cmu_enableClocks(gtm, IFXGTM_CMU_CLKEN_FXCLK);
+
+    for (clock = IfxGtm_Cmu_Fxclk_0; clock <= IfxGtm_Cmu_Fxclk_4; clock++)
+    {
+        frequency = IfxGtm_Cmu_getFxClkFrequency(gtm, clock, TRUE);
+        period    = (uint32)(frequency / config->clockFrequency + 0.5);
+
+        if ((period * LINESCAN_FRAME_CLOCKS) <= 0xFFFF)
+        {
+            break;
+        }
+    }
+
+    if ((clock > IfxGtm_Cmu_Fxclk_4) || (period < 4))
+    {
+        return FALSE;
+    }
+
+    driver->cameraCount    = config->cameraCount;
+    driver->clockFrequency = frequency / period;
+    driver->frameRate      = driver->clockFrequency / LINESCAN_FRAME_CLOCKS;
+
+    /* VADC group: one scan of the camera channels per falling edge of the trigger */
+    {
+        IfxVadc_Adc_GroupConfig adcGroupConfig;
+        IfxVadc_Adc_initGroupConfig(&adcGroupConfig, config->vadc);
+
+        adcGroupConfig.groupId                                 = config->groupId;
+        adcGroupConfig.master                                  = config->groupId;
+        adcGroupConfig.arbiter.requestSlotScanEnabled          = TRUE;
+        adcGroupConfig.scanRequest.autoscanEnabled             = FALSE;
+        adcGroupConfig.scanRequest.triggerConfig.triggerMode   = IfxVadc_TriggerMode_uponFallingEdge;
+        adcGroupConfig.scanRequest.triggerConfig.triggerSource = config->triggerInput;
+        adcGroupConfig.scanRequest.triggerConfig.gatingMode    = IfxVadc_GatingMode_always;
+
+        IfxVadc_Adc_initGroup(&driver->adcGroup, &adcGroupConfig);
+    }
+
+    channels = 0;
+
+    for (camera = 0; camera < config->cameraCount; camera++)
+    {
+        IfxVadc_Adc_ChannelConfig adcChannelConfig;
+        IfxVadc_Adc_initChannelConfig(&adcChannelConfig, &driver->adcGroup);
+
+        adcChannelConfig.channelId      = config->channels[camera];
+        adcChannelConfig.resultRegister = (IfxVadc_ChannelResult)(IfxVadc_ChannelResult_0 + LINESCAN_FIFO_SIZE - 1); /* input stage of the FIFO */
+
+        IfxVadc_Adc_initChannel(&driver->adcChannel[camera], &adcChannelConfig);
+
+        channels |= 1UL << config->channels[camera];
+
+        /* the scan converts the highest channel number first */
+        driver->slot[camera] = 0;
+
+        for (other = 0; other < config->cameraCount; other++)
+        {
+            if (config->channels[other] > config->channels[camera])
+            {
+                driver->slot[camera]++;
+            }
+        }
+    }
+
+    IfxVadc_Adc_setScan(&driver->adcGroup, channels, channels);
+
+    /* DMA stream: one block per frame */
+    {
+        IfxVadc_Adc_StreamConfig streamConfig;
+        IfxVadc_Adc_initStreamConfig(&streamConfig, &driver->adcGroup);
+
+        streamConfig.outputRegister    = IfxVadc_ChannelResult_0;
+        streamConfig.fifoSize          = LINESCAN_FIFO_SIZE;
+        streamConfig.dma               = config->dma;
+        streamConfig.dmaChannelId      = config->dmaChannelId;
+        streamConfig.buffer            = config->buffer;
+        streamConfig.blockSize         = LINESCAN_FRAME_CLOCKS * config->cameraCount;
+        streamConfig.blockPriority     = config->framePriority;
+        streamConfig.blockServProvider = config->frameServProvider;
+
+        IfxVadc_Adc_initStream(&driver->stream, &streamConfig);
+    }
+
+    if (IfxGtm_Trig_toVadc(gtm, (IfxGtm_Trig_AdcGroup)config->groupId, IfxGtm_Trig_AdcTrig_0,
+            (config->clk->tom == IfxGtm_Tom_0) ? IfxGtm_Trig_AdcTrigSource_tom0 : IfxGtm_Trig_AdcTrigSource_tom1,
+            config->triggerAdcChannel) == FALSE)
+    {
+        return FALSE;
+    }
+
+    /* TOM channels, started in phase by the TGC */
+    tom         = &gtm->TOM[config->clk->tom];
+    driver->tgc = IfxGtm_Tom_Ch_getTgcPointer(tom, config->clk->channel / 8);
+
+    LineScan_initTomChannel(tom, driver->tgc, config->clk->channel, (IfxGtm_Tom_Ch_ClkSrc)clock, Ifx_ActiveState_low, period, period / 2);
+    LineScan_initTomChannel(tom, driver->tgc, config->triggerChannel, (IfxGtm_Tom_Ch_ClkSrc)clock, Ifx_ActiveState_high, period, (period * 3) / 4);
+    LineScan_initTomChannel(tom, driver->tgc, config->si->channel, (IfxGtm_Tom_Ch_ClkSrc)clock, Ifx_ActiveState_high, period * LINESCAN_FRAME_CLOCKS, period);
+
+    IfxGtm_PinMap_setTomTout(config->clk, IfxPort_OutputMode_pushPull, IfxPort_PadDriver_cmosAutomotiveSpeed1);
+    IfxGtm_PinMap_setTomTout(config->si, IfxPort_OutputMode_pushPull, IfxPort_PadDriver_cmosAutomotiveSpeed1);
+
+    IfxGtm_Tom_Tgc_trigger(driver->tgc);
+
+    return TRUE;
+}
+
+
+void LineScan_copyLine(const LineScan *driver, const Ifx_VADC_RES *frame, uint8 camera, uint16 *line)
+{
+    const Ifx_VADC_RES *result = &frame[driver->slot[camera]];
+    uint8               pixel;
+
+    for (pixel = 0; pixel < LINESCAN_PIXELS; pixel++)
+    {
+        line[pixel] = (uint16)result->B.RESULT;
+        result      = &result[driver->cameraCount];
+    }
+}
+
+
+void LineScan_analyse(const LineScan *driver, const Ifx_VADC_RES *frame, uint8 camera, uint16 minContrast, LineScan_Analysis *analysis)
+{
+    uint32            lineWords[LINESCAN_PIXELS / 2];   /* uint16 line aligned on 4 bytes */
+    uint16           *line = (uint16 *)lineWords;
+    Ifx_ImgU16_MinMax minMax;
+    uint8             pixel;
+    uint8             runStart   = 0;
+    uint8             runLength  = 0;
+    uint8             bestStart  = 0;
+    uint8             bestLength = 0;
+
+    LineScan_copyLine(driver, frame, camera, line);
+    Ifx_ImgU16_findMinMax(line, LINESCAN_PIXELS, &minMax);
+
+    analysis->min      = minMax.min;
+    analysis->max      = minMax.max;
+    analysis->minIndex = (uint8)minMax.minIndex;
+    analysis->maxIndex = (uint8)minMax.maxIndex;
+
+    analysis->threshold = (uint16)((analysis->min + analysis->max) / 2);
+
+    /* longest run of pixels below the threshold */
+    if ((analysis->max - analysis->min) >= minContrast)
+    {
+        for (pixel = 0; pixel < LINESCAN_PIXELS; pixel++)
+        {
+            if (line[pixel] < analysis->threshold)
+            {
+                if (runLength == 0)
+                {
+                    runStart = pixel;
+                }
+
+                runLength++;
+
+                if (runLength > bestLength)
+                {
+                    bestStart  = runStart;
+                    bestLength = runLength;
+                }
+            }
+            else
+            {
+                runLength = 0;
+            }
+        }
+    }
+
+    if (bestLength > 0)
+    {
+        analysis->lineFound = TRUE;
+        analysis->leftEdge  = bestStart;
+        analysis->rightEdge = (uint8)(bestStart + bestLength - 1);
+        analysis->position  = (analysis->leftEdge + analysis->rightEdge) / 2.0;
+    }
+    else
+    {
+        analysis->lineFound = FALSE;
+        analysis->leftEdge  = 0;
+        analysis->rightEdge = 0;
+        analysis->position  = -1.0;
+    }
+}
@@ -0,0 +1,210 @@
+/**
+ * \file LineScan.h
+ * \brief Line scan camera (TSL1401) acquisition driver
+ *
+ * \version iLLD_Demos_1_0_0_11_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * The camera signals are generated by three channels of the same TOM (TGC 0 or 1), started together:
+ * - CLK: pixel clock, low during the first half of the period, high during the second half
+ * - trigger: internal signal without pin, falling at 3/4 of each CLK period. Each falling edge starts one scan
+ *   of the camera channels of the VADC group, through the GTM ADC trigger 0. The output settles after the
+ *   CLK rising edge, the trigger never falls when the TOM channels are started
+ * - SI: one pulse per frame of LINESCAN_FRAME_CLOCKS CLK periods, high during the first CLK period.
+ *   The CLK rising edge in the middle of the pulse starts the output of the pixels
+ *
+ * \code
+ * CLK      __--__--__--__--   ...   __--__--__--
+ * trigger  ---_---_---_---_   ...   ---_---_---_
+ * SI       ----____________   ...   ________----
+ * scan        ^   ^   ^   ^            ^   ^   ^
+ *       pixel 0   1   2   3         idle idle  pixel 0
+ * \endcode
+ *
+ * The results are streamed by the DMA into a double buffer (IfxVadc_Adc_Stream), one block per frame: the
+ * CPU is interrupted once per frame and reads the pixels from the last frame with LineScan_getPixel(),
+ * while the DMA fills the other half. The scan k of a frame converts the pixel k, the scans
+ * LINESCAN_PIXELS .. LINESCAN_FRAME_CLOCKS - 1 convert the idle output.
+ *
+ * The integration time is the frame period: LINESCAN_FRAME_CLOCKS / clockFrequency. The first frame
+ * after the start is not exposed for the full integration time.
+ *
+ * LineScan_analyse() is an optional pass on a finished frame: min, max, threshold and the longest run
+ * of dark pixels (the line) with its edges and center position.
+ *
+ * LineScan_copyLine() copies the pixels of one camera into a uint16 line, which the image kernels of
+ * \ref Ifx_ImgU16.h (smoothing, gradient, adaptive threshold, centroid) process in place, two pixels per
+ * packed halfword instruction. The results are 32 bit words interleaved by camera in the frame, they
+ * cannot be processed as packed pixels directly.
+ *
+ * \defgroup IfxLld_Demo_LineScanDemo_SrcDoc_Driver Line scan camera driver
+ * \ingroup IfxLld_Demo_LineScanDemo_SrcDoc
+ */
+
+#ifndef LINESCAN_H
+#define LINESCAN_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include <Vadc/Std/IfxVadc.h>
+#include <Vadc/Adc/IfxVadc_Adc.h>
+#include <Gtm/Std/IfxGtm_Tom.h>
+#include <Gtm/Trig/IfxGtm_Trig.h>
+#include <_PinMap/IfxGtm_PinMap.h>
+#include "SysSe/Math/Ifx_ImgU16.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+#define LINESCAN_PIXELS       (128)     /**< \brief Number of pixels of the TSL1401 */
+#define LINESCAN_MAX_CAMERAS  (2)       /**< \brief Maximal number of cameras sharing the SI and CLK signals */
+#define LINESCAN_FRAME_CLOCKS (256)     /**< \brief CLK periods per frame: power of 2, more than LINESCAN_PIXELS */
+
+/** \brief Size of the frame double buffer in results */
+#define LINESCAN_BUFFER_SIZE(cameraCount) (2 * LINESCAN_FRAME_CLOCKS * (cameraCount))
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+/** \addtogroup IfxLld_Demo_LineScanDemo_SrcDoc_Driver
+ * \{ */
+
+/** \brief Line scan camera driver handle
+ */
+typedef struct
+{
+    IfxVadc_Adc_Group   adcGroup;                           /**< \brief VADC group converting the camera outputs */
+    IfxVadc_Adc_Channel adcChannel[LINESCAN_MAX_CAMERAS];   /**< \brief VADC channel of each camera */
+    IfxVadc_Adc_Stream  stream;                             /**< \brief Frames moved by the DMA */
+    Ifx_GTM_TOM_TGC    *tgc;                                /**< \brief TGC starting the TOM channels */
+    uint8               cameraCount;                        /**< \brief Number of cameras */
+    uint8               slot[LINESCAN_MAX_CAMERAS];         /**< \brief Position of the result of each camera in a scan */
+    float32             clockFrequency;                     /**< \brief Actual CLK frequency in Hz */
+    float32             frameRate;                          /**< \brief Frames per second */
+} LineScan;
+
+/** \brief Line scan camera driver configuration
+ */
+typedef struct
+{
+    IfxGtm_Tom_ToutMap        *si;                                  /**< \brief SI pin */
+    IfxGtm_Tom_ToutMap        *clk;                                 /**< \brief CLK pin, same TOM and TGC as SI */
+    IfxGtm_Tom_Ch              triggerChannel;                      /**< \brief TOM channel triggering the conversions, same TGC as SI, without pin */
+    IfxGtm_Trig_AdcTrigChannel triggerAdcChannel;                   /**< \brief GTM ADC trigger channel of triggerChannel */
+    float32                    clockFrequency;                      /**< \brief CLK frequency in Hz. A period must be longer than the conversion of all cameras */
+    IfxVadc_Adc               *vadc;                                /**< \brief Initialized VADC module handle */
+    IfxVadc_GroupId            groupId;                             /**< \brief VADC group of the camera outputs */
+    IfxVadc_TriggerSource      triggerInput;                        /**< \brief Scan request trigger input connected to the GTM ADC trigger 0 of the group */
+    IfxVadc_ChannelId          channels[LINESCAN_MAX_CAMERAS];      /**< \brief VADC channel of each camera output */
+    uint8                      cameraCount;                         /**< \brief Number of cameras: 1 or 2 */
+    IfxDma_Dma                *dma;                                 /**< \brief DMA module handle */
+    IfxDma_ChannelId           dmaChannelId;                        /**< \brief DMA channel of the stream, must not be 0 */
+    Ifx_VADC_RES              *buffer;                              /**< \brief Double buffer of LINESCAN_BUFFER_SIZE(cameraCount) results, aligned to its size in bytes, in a non cached memory */
+    Ifx_Priority               framePriority;                       /**< \brief Interrupt priority of the frame ready interrupt, if 0 the frame end is polled by LineScan_getFrame() */
+    IfxSrc_Tos                 frameServProvider;                   /**< \brief Interrupt service provider of the frame ready interrupt */
+} LineScan_Config;
+
+/** \brief Result of the analysis of one camera frame
+ */
+typedef struct
+{
+    uint16  min;            /**< \brief Minimal pixel value */
+    uint16  max;            /**< \brief Maximal pixel value */
+    uint8   minIndex;       /**< \brief Index of the first minimal pixel */
+    uint8   maxIndex;       /**< \brief Index of the first maximal pixel */
+    uint16  threshold;      /**< \brief Dark pixel threshold: (min + max) / 2 */
+    boolean lineFound;      /**< \brief TRUE if max - min is at least the minimal contrast and a dark run was found */
+    uint8   leftEdge;       /**< \brief First pixel of the longest dark run (falling edge) */
+    uint8   rightEdge;      /**< \brief Last pixel of the longest dark run (rising edge) */
+    float32 position;       /**< \brief Line position: center of the run in pixels, 0 .. LINESCAN_PIXELS - 1, -1 if no line is found */
+} LineScan_Analysis;
+
+/** \} */
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+/** \addtogroup IfxLld_Demo_LineScanDemo_SrcDoc_Driver
+ * \{ */
+
+/** \brief Initialize the configuration with default values: one camera on channel 0 of group 0, 200 kHz
+ * \param config Configuration structure
+ * \param vadc Initialized VADC module handle
+ */
+IFX_EXTERN void LineScan_initConfig(LineScan_Config *config, IfxVadc_Adc *vadc);
+
+/** \brief Initialize the VADC group, the DMA stream and the TOM channels, then start the camera
+ * \param driver Driver handle
+ * \param config Configuration structure
+ * \return TRUE on success, FALSE if the configuration is not supported
+ */
+IFX_EXTERN boolean LineScan_init(LineScan *driver, const LineScan_Config *config);
+
+/** \brief Handle the frame ready interrupt, to be called from the interrupt of LineScan_Config.framePriority
+ * \param driver Driver handle
+ */
+IFX_INLINE void LineScan_isrFrame(LineScan *driver)
+{
+    IfxVadc_Adc_isrStream(&driver->stream);
+}
+
+
+/** \brief Return the last finished frame, see IfxVadc_Adc_getStreamBlock()
+ * \param driver Driver handle
+ * \return Pointer to the frame, valid until the DMA fills this half again (one frame period), or NULL_PTR if no new frame
+ */
+IFX_INLINE const Ifx_VADC_RES *LineScan_getFrame(LineScan *driver)
+{
+    return IfxVadc_Adc_getStreamBlock(&driver->stream);
+}
+
+
+/** \brief Return a pixel value of a frame
+ * \param driver Driver handle
+ * \param frame Frame returned by LineScan_getFrame()
+ * \param camera Camera index, 0 .. cameraCount - 1
+ * \param pixel Pixel index, 0 .. LINESCAN_PIXELS - 1
+ * \return Conversion result of the pixel
+ */
+IFX_INLINE uint16 LineScan_getPixel(const LineScan *driver, const Ifx_VADC_RES *frame, uint8 camera, uint8 pixel)
+{
+    return (uint16)frame[pixel * driver->cameraCount + driver->slot[camera]].B.RESULT;
+}
+
+
+/** \brief Copy the pixels of one camera into a line
+ * \param driver Driver handle
+ * \param frame Frame returned by LineScan_getFrame()
+ * \param camera Camera index, 0 .. cameraCount - 1
+ * \param line Line of LINESCAN_PIXELS pixels, aligned on 4 bytes for the image kernels
+ */
+IFX_EXTERN void LineScan_copyLine(const LineScan *driver, const Ifx_VADC_RES *frame, uint8 camera, uint16 *line);
+
+/** \brief Analyse the frame of one camera: min, max, threshold and the longest run of dark pixels
+ * \param driver Driver handle
+ * \param frame Frame returned by LineScan_getFrame()
+ * \param camera Camera index, 0 .. cameraCount - 1
+ * \param minContrast Minimal max - min for a line to be detected
+ * \param analysis Result of the analysis
+ */
+IFX_EXTERN void LineScan_analyse(const LineScan *driver, const Ifx_VADC_RES *frame, uint8 camera, uint16 minContrast, LineScan_Analysis *analysis);
+
+/** \} */
+
+#endif
@@ -0,0 +1,443 @@
+/**
+ * \file RacerPipelineDemo.c
+ * \brief Demo RacerPipelineDemo
+ *
+ * \version iLLD_Demos_1_0_0_11_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include <stdio.h>
+#include "RacerPipelineDemo.h"
+#include "Configuration.h"
+#include "ConfigurationIsr.h"
+#include <Cpu/Std/IfxCpu.h>
+#include "SysSe/Bsp/Bsp.h"
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+App_RacerPipeline g_RacerPipeline; /**< \brief Demo information */
+
+/* Pipeline object and stage buffers, shared by the CPUs, accessed through their non cached addresses */
+IFX_LMU_DATA App_RacerPipelineShared g_RacerPipelineShared;
+
+/* Frame double buffer. Must be located in a non cached memory (DSPR) */
+IFX_ALIGN(LINESCAN_BUFFER_SIZE(RACERPIPELINEDEMO_CAMERAS) * 4) Ifx_VADC_RES g_RacerPipelineBuffer[LINESCAN_BUFFER_SIZE(RACERPIPELINEDEMO_CAMERAS)];
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+static boolean RacerPipelineDemo_acquire(void *data, const void *input, void *output);
+static boolean RacerPipelineDemo_detect(void *data, const void *input, void *output);
+static boolean RacerPipelineDemo_control(void *data, const void *input, void *output);
+static boolean RacerPipelineDemo_actuate(void *data, const void *input, void *output);
+static void    RacerPipelineDemo_initActuators(void);
+static void    RacerPipelineDemo_initPipeline(void);
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+/** \addtogroup IfxLld_Demo_RacerPipelineDemo_SrcDoc_Main_Interrupt
+ * \{ */
+
+/** \name Interrupts of the pipeline triggers.
+ * \{ */
+IFX_INTERRUPT(RacerPipelineDemo_frameIsr, 0, ISR_PRIORITY_LINESCAN_FRAME);
+IFX_INTERRUPT(RacerPipelineDemo_actuateIsr, 0, ISR_PRIORITY_ACTUATE);
+/** \} */
+
+/** \} */
+
+/** \brief Handle the frame interrupt: trigger the acquire stage
+ *
+ * \isrProvider \ref ISR_PROVIDER_LINESCAN_FRAME
+ * \isrPriority \ref ISR_PRIORITY_LINESCAN_FRAME
+ *
+ */
+void RacerPipelineDemo_frameIsr(void)
+{
+    LineScan_isrFrame(&g_RacerPipeline.camera);
+    Ifx_Pipeline_trigger(g_RacerPipeline.pipeline, RacerPipelineDemo_Stage_acquire);
+}
+
+
+/** \brief Handle the servo period interrupt: trigger the actuate stage
+ *
+ * \isrProvider \ref ISR_PROVIDER_ACTUATE
+ * \isrPriority \ref ISR_PRIORITY_ACTUATE
+ *
+ */
+void RacerPipelineDemo_actuateIsr(void)
+{
+    IfxGtm_Tom_Timer_acknowledgeTimerIrq(&g_RacerPipeline.servo);
+    Ifx_Pipeline_trigger(g_RacerPipeline.pipeline, RacerPipelineDemo_Stage_actuate);
+}
+
+
+/** \brief Acquire stage: copy the line of each camera from the last frame
+ *
+ * The frame is valid until the DMA fills this half of the buffer again, the stage shall run within one frame period.
+ */
+static boolean RacerPipelineDemo_acquire(void *data, const void *input, void *output)
+{
+    App_RacerPipeline       *app   = (App_RacerPipeline *)data;
+    RacerPipelineDemo_Frame *frame = (RacerPipelineDemo_Frame *)output;
+    const Ifx_VADC_RES      *pixels;
+    uint8                    camera;
+
+    (void)input;
+    pixels = LineScan_getFrame(&app->camera);
+
+    if (pixels == NULL_PTR)
+    {
+        return FALSE;
+    }
+
+    for (camera = 0; camera < RACERPIPELINEDEMO_CAMERAS; camera++)
+    {
+        LineScan_copyLine(&app->camera, pixels, camera, frame->lines[camera]);
+    }
+
+    return TRUE;
+}
+
+
+/** \brief Detect stage: find the dark line in the line of each camera, with sub-pixel resolution */
+static boolean RacerPipelineDemo_detect(void *data, const void *input, void *output)
+{
+    App_RacerPipeline             *app       = (App_RacerPipeline *)data;
+    const RacerPipelineDemo_Frame *frame     = (const RacerPipelineDemo_Frame *)input;
+    RacerPipelineDemo_Detection   *detection = (RacerPipelineDemo_Detection *)output;
+    uint8                          camera;
+
+    for (camera = 0; camera < RACERPIPELINEDEMO_CAMERAS; camera++)
+    {
+        Ifx_ImgU16_smoothGauss3(app->work, frame->lines[camera], LINESCAN_PIXELS, 1);
+        Ifx_ImgU16_thresholdAdaptive(app->work, app->work, LINESCAN_PIXELS, 1, RACERPIPELINEDEMO_WINDOW_SHIFT,
+            RACERPIPELINEDEMO_THRESHOLD_OFFSET, Ifx_ImgU16_Polarity_dark);
+        detection->found[camera] = Ifx_ImgU16_centroid(app->work, LINESCAN_PIXELS, &detection->position[camera]);
+    }
+
+    return TRUE;
+}
+
+
+/** \brief Control stage: PD steering on the mean line position, speed reduced with the steering
+ *
+ * Without line, the steering is kept and the racer slows down.
+ */
+static boolean RacerPipelineDemo_control(void *data, const void *input, void *output)
+{
+    App_RacerPipeline                 *app       = (App_RacerPipeline *)data;
+    const RacerPipelineDemo_Detection *detection = (const RacerPipelineDemo_Detection *)input;
+    RacerPipelineDemo_Command         *command   = (RacerPipelineDemo_Command *)output;
+    const float32                      center    = (LINESCAN_PIXELS - 1) / 2.0;
+    float32                            sum       = 0.0;
+    uint8                              count     = 0;
+    uint8                              camera;
+
+    for (camera = 0; camera < RACERPIPELINEDEMO_CAMERAS; camera++)
+    {
+        if (detection->found[camera] != FALSE)
+        {
+            sum += detection->position[camera];
+            count++;
+        }
+    }
+
+    if (count != 0)
+    {
+        float32 error    = (sum / count - center) / center;
+        float32 steering = (RACERPIPELINEDEMO_STEERING_KP * error) + (RACERPIPELINEDEMO_STEERING_KD * (error - app->previousError));
+
+        steering           = __saturatef(steering, -1.0, 1.0);
+        app->previousError = error;
+        command->steering  = steering;
+        command->speed     = RACERPIPELINEDEMO_SPEED_MAX - ((RACERPIPELINEDEMO_SPEED_MAX - RACERPIPELINEDEMO_SPEED_MIN) * __absf(steering));
+    }
+    else
+    {
+        command->steering = __saturatef(RACERPIPELINEDEMO_STEERING_KP * app->previousError, -1.0, 1.0);
+        command->speed    = RACERPIPELINEDEMO_SPEED_MIN;
+    }
+
+    return TRUE;
+}
+
+
+/** \brief Actuate stage: apply the newest command to the servo and the motor, hold the last one without new command */
+static boolean RacerPipelineDemo_actuate(void *data, const void *input, void *output)
+{
+    App_RacerPipeline *app = (App_RacerPipeline *)data;
+    Ifx_TimerValue     servoPulse;
+    Ifx_TimerValue     motorOnTime[1];
+
+    (void)output;
+
+    if (input == NULL_PTR)
+    {
+        return TRUE;
+    }
+
+    app->command = *(const RacerPipelineDemo_Command *)input;
+
+    servoPulse     = (Ifx_TimerValue)((RACERPIPELINEDEMO_SERVO_CENTER + (RACERPIPELINEDEMO_SERVO_RANGE * app->command.steering))
+                                      * IfxGtm_Tom_Timer_getInputFrequency(&app->servo));
+    motorOnTime[0] = (Ifx_TimerValue)(app->command.speed * IfxGtm_Tom_Timer_getPeriod(&app->motorTimer));
+
+    IfxGtm_Tom_Timer_disableUpdate(&app->servo);
+    IfxGtm_Tom_Timer_setTrigger(&app->servo, servoPulse);
+    IfxGtm_Tom_Timer_applyUpdate(&app->servo);
+
+    IfxGtm_Tom_Timer_disableUpdate(&app->motorTimer);
+    IfxGtm_Tom_PwmHl_setOnTime(&app->motor, motorOnTime);
+    IfxGtm_Tom_Timer_applyUpdate(&app->motorTimer);
+
+    return TRUE;
+}
+
+
+/** \brief Initialise the servo timer and the motor half bridge, steering straight ahead and motor stopped */
+static void RacerPipelineDemo_initActuators(void)
+{
+    IfxGtm_Tom_Timer_Config timerConfig;
+    IfxGtm_Tom_PwmHl_Config pwmHlConfig;
+    IfxGtm_Tom_ToutMapP     ccx[1], coutx[1];
+    Ifx_TimerValue          motorOnTime[1] = {0};
+
+    /* Servo: 100 Hz period interrupt, pulse on the trigger output */
+    IfxGtm_Tom_Timer_initConfig(&timerConfig, &MODULE_GTM);
+    timerConfig.base.frequency                  = RACERPIPELINEDEMO_SERVO_FREQUENCY;
+    timerConfig.base.isrPriority                = ISR_PRIORITY_ACTUATE;
+    timerConfig.base.isrProvider                = ISR_PROVIDER_ACTUATE;
+    timerConfig.base.minResolution              = (1.0 / timerConfig.base.frequency) / 1000;
+    timerConfig.clock                           = IfxGtm_Tom_Ch_ClkSrc_cmuFxclk2;
+    timerConfig.tom                             = RACER_SERVO_TOM;
+    timerConfig.timerChannel                    = RACER_SERVO_CHANNEL;
+    timerConfig.triggerOut                      = &RACER_SERVO_OUT;
+    timerConfig.base.trigger.outputEnabled      = TRUE;
+    timerConfig.base.trigger.enabled            = TRUE;
+    timerConfig.base.trigger.triggerPoint       = 0;
+    timerConfig.base.trigger.risingEdgeAtPeriod = TRUE;
+    IfxGtm_Tom_Timer_init(&g_RacerPipeline.servo, &timerConfig);
+    IfxGtm_Tom_Timer_setTrigger(&g_RacerPipeline.servo,
+        (Ifx_TimerValue)(RACERPIPELINEDEMO_SERVO_CENTER * IfxGtm_Tom_Timer_getInputFrequency(&g_RacerPipeline.servo)));
+
+    /* Motor: center aligned half bridge, without interrupt */
+    IfxGtm_Tom_Timer_initConfig(&timerConfig, &MODULE_GTM);
+    timerConfig.base.frequency       = RACERPIPELINEDEMO_MOTOR_FREQUENCY;
+    timerConfig.base.isrPriority     = 0;
+    timerConfig.base.minResolution   = (1.0 / timerConfig.base.frequency) / 1000;
+    timerConfig.base.trigger.enabled = FALSE;
+    timerConfig.clock                = IfxGtm_Tom_Ch_ClkSrc_cmuFxclk0;
+    timerConfig.tom                  = RACER_MOTOR_TOM;
+    timerConfig.timerChannel         = RACER_MOTOR_CHANNEL;
+    IfxGtm_Tom_Timer_init(&g_RacerPipeline.motorTimer, &timerConfig);
+
+    ccx[0]   = &RACER_MOTOR_HIGH_OUT;
+    coutx[0] = &RACER_MOTOR_LOW_OUT;
+
+    IfxGtm_Tom_PwmHl_initConfig(&pwmHlConfig);
+    pwmHlConfig.timer                 = &g_RacerPipeline.motorTimer;
+    pwmHlConfig.tom                   = timerConfig.tom;
+    pwmHlConfig.base.deadtime         = 2e-6;
+    pwmHlConfig.base.minPulse         = 1e-6;
+    pwmHlConfig.base.channelCount     = 1;
+    pwmHlConfig.base.emergencyEnabled = FALSE;
+    pwmHlConfig.base.outputMode       = IfxPort_OutputMode_pushPull;
+    pwmHlConfig.base.outputDriver     = IfxPort_PadDriver_cmosAutomotiveSpeed1;
+    pwmHlConfig.base.ccxActiveState   = Ifx_ActiveState_high;
+    pwmHlConfig.base.coutxActiveState = Ifx_ActiveState_high;
+    pwmHlConfig.ccx                   = ccx;
+    pwmHlConfig.coutx                 = coutx;
+    IfxGtm_Tom_PwmHl_init(&g_RacerPipeline.motor, &pwmHlConfig);
+
+    IfxGtm_Tom_PwmHl_setMode(&g_RacerPipeline.motor, Ifx_Pwm_Mode_centerAligned);
+    IfxGtm_Tom_Timer_disableUpdate(&g_RacerPipeline.motorTimer);
+    IfxGtm_Tom_PwmHl_setOnTime(&g_RacerPipeline.motor, motorOnTime);
+    IfxGtm_Tom_Timer_applyUpdate(&g_RacerPipeline.motorTimer);
+
+    IfxGtm_Cmu_enableClocks(&MODULE_GTM, IFXGTM_CMU_CLKEN_FXCLK);
+    IfxGtm_Tom_Timer_run(&g_RacerPipeline.motorTimer);
+    IfxGtm_Tom_Timer_run(&g_RacerPipeline.servo);
+}
+
+
+/** \brief Build the pipeline: acquire -> detect -> control -> actuate */
+static void RacerPipelineDemo_initPipeline(void)
+{
+    Ifx_Pipeline            *pipeline = Ifx_Pipeline_init(&g_RacerPipelineShared.pipeline);
+    Ifx_Pipeline_StageConfig config;
+
+    Ifx_Pipeline_initStageConfig(&config);
+    config.name         = "acquire";
+    config.cpu          = IfxCpu_Id_0;
+    config.trigger      = Ifx_Pipeline_Trigger_dma;
+    config.process      = &RacerPipelineDemo_acquire;
+    config.data         = &g_RacerPipeline;
+    config.outputMemory = g_RacerPipelineShared.frames;
+    config.outputSize   = sizeof(RacerPipelineDemo_Frame);
+    Ifx_Pipeline_addStage(pipeline, &config);
+
+    Ifx_Pipeline_initStageConfig(&config);
+    config.name         = "detect";
+    config.cpu          = RACER_CPU_DETECT;
+    config.process      = &RacerPipelineDemo_detect;
+    config.data         = &g_RacerPipeline;
+    config.outputMemory = g_RacerPipelineShared.detections;
+    config.outputSize   = sizeof(RacerPipelineDemo_Detection);
+    Ifx_Pipeline_addStage(pipeline, &config);
+
+    Ifx_Pipeline_initStageConfig(&config);
+    config.name         = "control";
+    config.cpu          = RACER_CPU_CONTROL;
+    config.process      = &RacerPipelineDemo_control;
+    config.data         = &g_RacerPipeline;
+    config.outputMemory = g_RacerPipelineShared.commands;
+    config.outputSize   = sizeof(RacerPipelineDemo_Command);
+    Ifx_Pipeline_addStage(pipeline, &config);
+
+    Ifx_Pipeline_initStageConfig(&config);
+    config.name         = "actuate";
+    config.cpu          = IfxCpu_Id_0;
+    config.trigger      = Ifx_Pipeline_Trigger_timer;
+    config.process      = &RacerPipelineDemo_actuate;
+    config.data         = &g_RacerPipeline;
+    Ifx_Pipeline_addStage(pipeline, &config);
+
+    /* Release the other CPUs, see RacerPipelineDemo_process() */
+    g_RacerPipeline.pipeline = pipeline;
+}
+
+
+/** \brief Demo init API
+ *
+ * This function is called from main during initialization phase
+ */
+void RacerPipelineDemo_init(void)
+{
+    /* The pipeline is ready before the first trigger interrupt */
+    RacerPipelineDemo_initPipeline();
+
+    /* VADC Configuration */
+
+    /* create configuration */
+    IfxVadc_Adc_Config adcConfig;
+    IfxVadc_Adc_initModuleConfig(&adcConfig, &MODULE_VADC);
+
+    /* initialize module */
+    IfxVadc_Adc_initModule(&g_RacerPipeline.vadc, &adcConfig);
+
+    IfxDma_Dma_createModuleHandle(&g_RacerPipeline.dma, &MODULE_DMA);
+
+    /* camera configuration, see Configuration.h for the pins */
+    LineScan_Config config;
+    LineScan_initConfig(&config, &g_RacerPipeline.vadc);
+
+    config.si                = &TSL1401_SI;
+    config.clk               = &TSL1401_CLK;
+    config.triggerChannel    = TSL1401_TRIGGER;
+    config.triggerAdcChannel = TSL1401_TRIGGER_ADC;
+    config.clockFrequency    = RACERPIPELINEDEMO_CLOCK_FREQUENCY;
+    config.groupId           = IfxVadc_GroupId_0;
+    config.triggerInput      = RACERPIPELINEDEMO_TRIGGER_INPUT;
+    config.channels[0]       = (IfxVadc_ChannelId)TSL1401_AO_1;
+    config.channels[1]       = (IfxVadc_ChannelId)TSL1401_AO_2;
+    config.cameraCount       = RACERPIPELINEDEMO_CAMERAS;
+    config.dma               = &g_RacerPipeline.dma;
+    config.dmaChannelId      = DMA_CHANNEL_LINESCAN_FRAME;
+    config.buffer            = g_RacerPipelineBuffer;
+    config.framePriority     = ISR_PRIORITY_LINESCAN_FRAME;
+    config.frameServProvider = ISR_PROVIDER_LINESCAN_FRAME;
+
+    if (LineScan_init(&g_RacerPipeline.camera, &config) == FALSE)
+    {
+        printf("Line scan camera configuration not supported\n");
+    }
+    else
+    {
+        printf("Line scan camera: CLK %d Hz, %d frames/s\n", (int)g_RacerPipeline.camera.clockFrequency, (int)g_RacerPipeline.camera.frameRate);
+    }
+
+    /* The camera enabled the GTM */
+    RacerPipelineDemo_initActuators();
+    printf("Servo %d Hz, motor PWM %d Hz\n", RACERPIPELINEDEMO_SERVO_FREQUENCY, RACERPIPELINEDEMO_MOTOR_FREQUENCY);
+}
+
+
+/** \brief Demo process API
+ *
+ * This function is called from the background loop of each CPU: it runs the stages of the calling CPU.
+ */
+void RacerPipelineDemo_process(void)
+{
+    Ifx_Pipeline *pipeline = g_RacerPipeline.pipeline;
+
+    if (pipeline != NULL_PTR)
+    {
+        Ifx_Pipeline_process(pipeline);
+    }
+}
+
+
+/** \brief Demo run API
+ *
+ * This function is called from main, background loop, once per second
+ * The command and the statistics of each stage are printed, times in us.
+ */
+void RacerPipelineDemo_run(void)
+{
+    Ifx_Pipeline *pipeline   = g_RacerPipeline.pipeline;
+    uint32        ticksPerUs = (uint32)TimeConst_1us;
+    uint32        stage;
+
+    printf("steering %d %%, speed %d %%\n", (int)(g_RacerPipeline.command.steering * 100), (int)(g_RacerPipeline.command.speed * 100));
+
+    for (stage = 0; stage < RacerPipelineDemo_Stage_count; stage++)
+    {
+        Ifx_Pipeline_Statistics statistics;
+
+        Ifx_Pipeline_getStatistics(pipeline, stage, &statistics);
+
+        printf("%-8s CPU%u: %lu frames/s, hold %lu, drop %lu, skip %lu, exec max %lu us, latency %lu..%lu us\n",
+            pipeline->stages[stage].name, pipeline->stages[stage].cpu, (uint32)statistics.throughput,
+            statistics.holdCount, statistics.dropCount, statistics.skipCount, statistics.executionMax / ticksPerUs,
+            (statistics.latencyCount != 0) ? statistics.latencyMin / ticksPerUs : 0, statistics.latencyMax / ticksPerUs);
+    }
+
+    Ifx_Pipeline_resetStatistics(pipeline);
+}
@@ -0,0 +1,143 @@
+/**
+ * \file RacerPipelineDemo.h
+ * \brief Demo RacerPipelineDemo
+ *
+ * \version iLLD_Demos_1_0_0_11_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * The line following chain of a racer (camera, line detection, steering and speed control, servo and motor
+ * outputs) runs as a pipeline of four stages (\ref Ifx_Pipeline.h) spread over the CPUs:
+ * - acquire (CPU0, DMA trigger): the frame interrupt of the line scan cameras (\ref LineScan.h) triggers the
+ *   stage, which copies the line of each camera into the output frame.
+ * - detect (RACER_CPU_DETECT, upstream trigger): smoothing, adaptive threshold and centroid of each line
+ *   (\ref Ifx_ImgU16.h), the output is the line position seen by each camera.
+ * - control (RACER_CPU_CONTROL, upstream trigger): PD steering on the mean line position, speed reduced in the
+ *   curves.
+ * - actuate (CPU0, timer trigger): the period interrupt of the 100 Hz servo timer triggers the stage, which
+ *   writes the newest command to the servo and the motor PWM, or holds the last command.
+ *
+ * While the DMA acquires the frame N+1, the detection processes the frame N and the actuation applies the
+ * command of the frame N-1. The background loop of CPU0 prints the latency and the throughput of each stage
+ * every second.
+ *
+ * \defgroup IfxLld_Demo_RacerPipelineDemo_SrcDoc_Main Demo Source
+ * \ingroup IfxLld_Demo_RacerPipelineDemo_SrcDoc
+ * \defgroup IfxLld_Demo_RacerPipelineDemo_SrcDoc_Main_Interrupt Interrupts
+ * \ingroup IfxLld_Demo_RacerPipelineDemo_SrcDoc_Main
+ */
+
+#ifndef RACERPIPELINEDEMO_H
+#define RACERPIPELINEDEMO_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "LineScan.h"
+#include <Gtm/Tom/Timer/IfxGtm_Tom_Timer.h>
+#include <Gtm/Tom/PwmHl/IfxGtm_Tom_PwmHl.h>
+#include "SysSe/General/Ifx_Pipeline.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+#define RACERPIPELINEDEMO_CAMERAS          (2)                       /**< \brief Number of cameras */
+#define RACERPIPELINEDEMO_CLOCK_FREQUENCY  (200000)                  /**< \brief CLK frequency in Hz */
+#define RACERPIPELINEDEMO_TRIGGER_INPUT    IfxVadc_TriggerSource_2   /**< \brief Request trigger input connected to the GTM ADC0 trigger 0 (REQTR0C) */
+#define RACERPIPELINEDEMO_WINDOW_SHIFT     (4)                       /**< \brief Adaptive threshold window: 16 pixels */
+#define RACERPIPELINEDEMO_THRESHOLD_OFFSET (100)                     /**< \brief Minimal darkness of the line below the local mean */
+#define RACERPIPELINEDEMO_SERVO_FREQUENCY  (100)                     /**< \brief Servo period in Hz, actuation rate */
+#define RACERPIPELINEDEMO_SERVO_CENTER     (1.5e-3)                  /**< \brief Servo pulse for straight ahead in s */
+#define RACERPIPELINEDEMO_SERVO_RANGE      (0.4e-3)                  /**< \brief Servo pulse deviation at full steering in s */
+#define RACERPIPELINEDEMO_MOTOR_FREQUENCY  (20000)                   /**< \brief Motor PWM frequency in Hz */
+#define RACERPIPELINEDEMO_STEERING_KP      (1.2)                     /**< \brief Steering proportional gain, per half image width */
+#define RACERPIPELINEDEMO_STEERING_KD      (0.4)                     /**< \brief Steering derivative gain, per half image width and frame */
+#define RACERPIPELINEDEMO_SPEED_MAX        (0.6)                     /**< \brief Motor duty cycle straight ahead */
+#define RACERPIPELINEDEMO_SPEED_MIN        (0.2)                     /**< \brief Motor duty cycle at full steering or without line */
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+/** \brief Pipeline stages, in the chain order */
+typedef enum
+{
+    RacerPipelineDemo_Stage_acquire = 0,  /**< \brief copy the camera lines, triggered by the frame interrupt */
+    RacerPipelineDemo_Stage_detect,       /**< \brief find the line position of each camera */
+    RacerPipelineDemo_Stage_control,      /**< \brief compute the steering and the speed */
+    RacerPipelineDemo_Stage_actuate,      /**< \brief write the servo and motor outputs, triggered by the servo period */
+    RacerPipelineDemo_Stage_count
+} RacerPipelineDemo_Stage;
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+/** \brief Output of the acquire stage */
+typedef struct
+{
+    uint16 lines[RACERPIPELINEDEMO_CAMERAS][LINESCAN_PIXELS]; /**< \brief pixels of each camera */
+} RacerPipelineDemo_Frame;
+
+/** \brief Output of the detect stage */
+typedef struct
+{
+    float32 position[RACERPIPELINEDEMO_CAMERAS];  /**< \brief line position of each camera in pixels */
+    boolean found[RACERPIPELINEDEMO_CAMERAS];     /**< \brief TRUE if the camera sees the line */
+} RacerPipelineDemo_Detection;
+
+/** \brief Output of the control stage */
+typedef struct
+{
+    float32 steering;  /**< \brief steering, -1 (left) .. 1 (right) */
+    float32 speed;     /**< \brief motor duty cycle, 0 .. 1 */
+} RacerPipelineDemo_Command;
+
+/** \brief Objects shared by the CPUs, located in the LMU */
+typedef struct
+{
+    Ifx_Pipeline                pipeline;       /**< \brief pipeline object */
+    RacerPipelineDemo_Frame     frames[2];      /**< \brief double buffer acquire -> detect */
+    RacerPipelineDemo_Detection detections[2];  /**< \brief double buffer detect -> control */
+    RacerPipelineDemo_Command   commands[2];    /**< \brief double buffer control -> actuate */
+} App_RacerPipelineShared;
+
+typedef struct
+{
+    IfxVadc_Adc               vadc;                                   /* VADC handle */
+    IfxDma_Dma                dma;                                    /* DMA handle */
+    LineScan                  camera;                                 /* line scan camera driver */
+    IfxGtm_Tom_Timer          servo;                                  /* servo timer, its trigger output is the servo PWM */
+    IfxGtm_Tom_Timer          motorTimer;                             /* motor PWM timer */
+    IfxGtm_Tom_PwmHl          motor;                                  /* motor half bridge */
+    Ifx_Pipeline *volatile    pipeline;                               /* pipeline, NULL_PTR until initialised by CPU0 */
+    uint16                    work[LINESCAN_PIXELS];                  /* line processed by the detect stage */
+    float32                   previousError;                          /* steering error of the previous frame, control stage */
+    RacerPipelineDemo_Command command;                                /* command applied by the actuate stage */
+} App_RacerPipeline;
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+IFX_EXTERN App_RacerPipeline g_RacerPipeline;
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+IFX_EXTERN void RacerPipelineDemo_init(void);
+IFX_EXTERN void RacerPipelineDemo_process(void);
+IFX_EXTERN void RacerPipelineDemo_run(void);
+
+#endif
@@ -56,6 +56,10 @@
 #define ISR_PRIORITY_PRINTF_ASC0_EX 6  /**< \brief Define the ASC0 error interrupt priority used by printf.c */
 
 #define ISR_PRIORITY_STM_INT0       40 /**< \brief Define the System Timer Interrupt priority.  */
+#define ISR_PRIORITY_STM_INT1       40 /**< \brief Define the System Timer 1 Interrupt priority, scheduler tick of CPU1.  */
+#define ISR_PRIORITY_STM_INT2       40 /**< \brief Define the System Timer 2 Interrupt priority, scheduler tick of CPU2.  */
+#define ISR_PRIORITY_ERAY_INT1      42 /**< \brief Define the ERAY interrupt line 1 priority, cycle start of the FlexRay time base.  */
+#define ISR_PRIORITY_ERAY_TINT0     41 /**< \brief Define the ERAY timer 0 interrupt priority, task macroticks of the FlexRay time base.  */
 /** \} */
 
 /**
@@ -65,6 +69,10 @@
 #define ISR_PROVIDER_PRINTF_ASC0_TX IfxSrc_Tos_cpu0         /**< \brief Define the ASC0 transmit interrupt provider used by printf.c   */
 #define ISR_PROVIDER_PRINTF_ASC0_EX IfxSrc_Tos_cpu0         /**< \brief Define the ASC0 error interrupt provider used by printf.c */
 #define ISR_PROVIDER_STM_INT0       IfxSrc_Tos_cpu0         /**< \brief Define the System Timer interrupt provider.  */
+#define ISR_PROVIDER_STM_INT1       IfxSrc_Tos_cpu1         /**< \brief Define the System Timer 1 interrupt provider.  */
+#define ISR_PROVIDER_STM_INT2       IfxSrc_Tos_cpu2         /**< \brief Define the System Timer 2 interrupt provider.  */
+#define ISR_PROVIDER_ERAY_INT1      IfxSrc_Tos_cpu0         /**< \brief Define the ERAY interrupt line 1 provider.  */
+#define ISR_PROVIDER_ERAY_TINT0     IfxSrc_Tos_cpu0         /**< \brief Define the ERAY timer 0 interrupt provider.  */
 /** \} */
 
 /**
@@ -75,6 +83,10 @@
 #define INTERRUPT_PRINTF_ASC0_EX    ISR_ASSIGN(ISR_PRIORITY_PRINTF_ASC0_EX, ISR_PROVIDER_PRINTF_ASC0_EX)                /**< \brief Define the ASC0 error interrupt priority used by printf.c */
 
 #define INTERRUPT_STM_INT0          ISR_ASSIGN(ISR_PRIORITY_STM_INT0, ISR_PROVIDER_STM_INT0)                            /**< \brief Define the System Timer interrupt priority.  */
+#define INTERRUPT_STM_INT1          ISR_ASSIGN(ISR_PRIORITY_STM_INT1, ISR_PROVIDER_STM_INT1)                            /**< \brief Define the System Timer 1 interrupt priority.  */
+#define INTERRUPT_STM_INT2          ISR_ASSIGN(ISR_PRIORITY_STM_INT2, ISR_PROVIDER_STM_INT2)                            /**< \brief Define the System Timer 2 interrupt priority.  */
+#define INTERRUPT_ERAY_INT1         ISR_ASSIGN(ISR_PRIORITY_ERAY_INT1, ISR_PROVIDER_ERAY_INT1)                          /**< \brief Define the ERAY interrupt line 1 priority.  */
+#define INTERRUPT_ERAY_TINT0        ISR_ASSIGN(ISR_PRIORITY_ERAY_TINT0, ISR_PROVIDER_ERAY_TINT0)                        /**< \brief Define the ERAY timer 0 interrupt priority.  */
 /** \} */
 
 /** \} */
@@ -52,9 +52,75 @@ App_Stm g_Stm; /**< \brief Stm global data */
 /*-------------------------Function Prototypes--------------------------------*/
 /******************************************************************************/
 static void IfxBlinkLed_Init(void);
+static void StmStaticCycle_start(StmStaticCycle_Core *core, IfxCpu_ResourceCpu cpu);
+static void StmStaticCycle_tick(StmStaticCycle_Core *core, IfxCpu_ResourceCpu cpu);
+static uint32 StmStaticCycle_getNextRelease(IfxCpu_ResourceCpu cpu, uint32 tick);
+static void StmStaticCycle_execute(StmStaticCycle_Core *core, StmStaticCycle_Task *task);
+static void StmStaticCycle_release(StmStaticCycle_Task *task);
+#ifdef STMSTATICCYCLE_SIM_HYPERPERIODS
+static void StmStaticCycle_reportSimulation(void);
+#endif
+#if STMSTATICCYCLE_TIMEBASE_ERAY
+static void StmStaticCycle_initEray(void);
+static uint16 StmStaticCycle_getNextSlot(uint16 macrotick);
+static void StmStaticCycle_releaseSlots(uint16 slot);
+#endif
 /******************************************************************************/
 /*------------------------Private Variables/Constants-------------------------*/
 /******************************************************************************/
+/** \brief Task table, in priority order
+ *
+ * The 1ms and 10ms tasks run on CPU1 and CPU2, in parallel with the slow tasks on CPU0.
+ * The offsets place the 10ms, 100ms and 1000ms releases in different ticks:
+ * 10ms at ticks 1, 11, 21..., 100ms at ticks 3, 103..., 1000ms at tick 7.
+ */
+#if STMSTATICCYCLE_TIMEBASE_ERAY
+/** \brief Task table of the FlexRay time base, in priority order
+ *
+ * The periods and offsets are in FlexRay cycles and divide the 64 cycles of the cycle counter, so
+ * that the releases are aligned on all nodes. The tasks run every cycle, every 2, 16 and 64 cycles,
+ * at macrotick 1000 and 2500. The macroticks shall match the cluster configuration, for example just
+ * after the static slots carrying the task inputs.
+ */
+static const StmStaticCycle_TaskConfig StmStaticCycle_taskConfig[] = {
+    {&appTaskfu_1ms,    "1ms",    STMSTATICCYCLE_CPU(1), 1,  0, 1000, 200},
+    {&appTaskfu_10ms,   "10ms",   STMSTATICCYCLE_CPU(2), 2,  1, 1000, 500},
+    {&appTaskfu_100ms,  "100ms",  STMSTATICCYCLE_CPU(0), 16, 3, 2500, 800},
+    {&appTaskfu_1000ms, "1000ms", STMSTATICCYCLE_CPU(0), 64, 7, 2500, 800},
+};
+#else
+static const StmStaticCycle_TaskConfig StmStaticCycle_taskConfig[] = {
+    {&appTaskfu_1ms,    "1ms",    STMSTATICCYCLE_CPU(1), 1,    0, 0, 200},
+    {&appTaskfu_10ms,   "10ms",   STMSTATICCYCLE_CPU(2), 10,   1, 0, 500},
+    {&appTaskfu_100ms,  "100ms",  STMSTATICCYCLE_CPU(0), 100,  3, 0, 800},
+    {&appTaskfu_1000ms, "1000ms", STMSTATICCYCLE_CPU(0), 1000, 7, 0, 800},
+};
+#endif
+
+#define STMSTATICCYCLE_TASK_COUNT (sizeof(StmStaticCycle_taskConfig) / sizeof(StmStaticCycle_taskConfig[0]))
+
+static StmStaticCycle_Task StmStaticCycle_tasks[STMSTATICCYCLE_TASK_COUNT];
+
+/** \brief STM interrupt priority and service provider of each core */
+static const uint16 StmStaticCycle_isrPriority[STMSTATICCYCLE_CORE_COUNT] = {
+    ISR_PRIORITY_STM_INT0,
+#if STMSTATICCYCLE_CORE_COUNT > 1
+    ISR_PRIORITY_STM_INT1,
+#endif
+#if STMSTATICCYCLE_CORE_COUNT > 2
+    ISR_PRIORITY_STM_INT2,
+#endif
+};
+
+static const IfxSrc_Tos StmStaticCycle_isrProvider[STMSTATICCYCLE_CORE_COUNT] = {
+    ISR_PROVIDER_STM_INT0,
+#if STMSTATICCYCLE_CORE_COUNT > 1
+    ISR_PROVIDER_STM_INT1,
+#endif
+#if STMSTATICCYCLE_CORE_COUNT > 2
+    ISR_PROVIDER_STM_INT2,
+#endif
+};
 
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
@@ -65,6 +131,16 @@ static void IfxBlinkLed_Init(void);
 /** \name Interrupts for SystemTimer(STM) driver.
  * \{ */
 IFX_INTERRUPT(STM_Int0Handler, 0, ISR_PRIORITY_STM_INT0);
+#if STMSTATICCYCLE_CORE_COUNT > 1
+IFX_INTERRUPT(STM_Int1Handler, 1, ISR_PRIORITY_STM_INT1);
+#endif
+#if STMSTATICCYCLE_CORE_COUNT > 2
+IFX_INTERRUPT(STM_Int2Handler, 2, ISR_PRIORITY_STM_INT2);
+#endif
+#if STMSTATICCYCLE_TIMEBASE_ERAY
+IFX_INTERRUPT(ERAY_Int1Handler, 0, ISR_PRIORITY_ERAY_INT1);
+IFX_INTERRUPT(ERAY_Tint0Handler, 0, ISR_PRIORITY_ERAY_TINT0);
+#endif
 /** \} */
 
 /** \} */
@@ -76,32 +152,437 @@ IFX_INTERRUPT(STM_Int0Handler, 0, ISR_PRIORITY_STM_INT0);
  */
 void STM_Int0Handler(void)
 {
-    IfxStm_clearCompareFlag(g_Stm.stmSfr, g_Stm.stmConfig.comparator);
+    StmStaticCycle_tick(&g_Stm.core[0], IfxCpu_ResourceCpu_0);
+
+    appIsrCb_1ms();
+}
+
+
+#if STMSTATICCYCLE_CORE_COUNT > 1
+/** \brief Handle the STM1 interrupt, scheduler tick of CPU1
+ *
+ * \isrProvider \ref ISR_PROVIDER_STM_INT1
+ * \isrPriority \ref ISR_PRIORITY_STM_INT1
+ *
+ */
+void STM_Int1Handler(void)
+{
+    StmStaticCycle_tick(&g_Stm.core[1], IfxCpu_ResourceCpu_1);
+}
+#endif
+
+
+#if STMSTATICCYCLE_CORE_COUNT > 2
+/** \brief Handle the STM2 interrupt, scheduler tick of CPU2
+ *
+ * \isrProvider \ref ISR_PROVIDER_STM_INT2
+ * \isrPriority \ref ISR_PRIORITY_STM_INT2
+ *
+ */
+void STM_Int2Handler(void)
+{
+    StmStaticCycle_tick(&g_Stm.core[2], IfxCpu_ResourceCpu_2);
+}
+#endif
+
+
+#if STMSTATICCYCLE_TIMEBASE_ERAY
+/** \brief Handle the ERAY interrupt line 1, cycle start of the FlexRay time base
+ *
+ * The tick of all cores is set to the cycle counter, then the tasks of macrotick 0 are released.
+ *
+ * \isrProvider \ref ISR_PROVIDER_ERAY_INT1
+ * \isrPriority \ref ISR_PRIORITY_ERAY_INT1
+ *
+ */
+void ERAY_Int1Handler(void)
+{
+    Ifx_ERAY *eraySfr = g_Stm.eray.eraySfr;
+
+    if (IfxEray_getStatusInterrupts(eraySfr).B.CYCS)
+    {
+        uint8  i;
+        uint32 tick = IfxEray_getCycleCount(eraySfr);
+
+        IfxEray_clearStatusFlag(eraySfr, IfxEray_ClearStatusFlag_cycs);
+
+        for (i = 0; i < STMSTATICCYCLE_CORE_COUNT; i++)
+        {
+            g_Stm.core[i].tick = tick;
+        }
+
+        g_Stm.eray.cycleCount++;
+
+        StmStaticCycle_releaseSlots(0);
+
+        appIsrCb_1ms();
+    }
+}
+
+
+/** \brief Handle the ERAY timer 0 interrupt, task macrotick of the FlexRay time base
+ *
+ * \isrProvider \ref ISR_PROVIDER_ERAY_TINT0
+ * \isrPriority \ref ISR_PRIORITY_ERAY_TINT0
+ *
+ */
+void ERAY_Tint0Handler(void)
+{
+    IfxEray_clearStatusFlag(g_Stm.eray.eraySfr, IfxEray_ClearStatusFlag_ti0);
+
+    StmStaticCycle_releaseSlots(g_Stm.eray.slot);
+}
+
+
+/** \brief Returns the first task macrotick after macrotick, STMSTATICCYCLE_ERAY_NO_SLOT if none
+ */
+static uint16 StmStaticCycle_getNextSlot(uint16 macrotick)
+{
+    uint8  i;
+    uint16 next = STMSTATICCYCLE_ERAY_NO_SLOT;
+
+    for (i = 0; i < g_Stm.taskCount; i++)
+    {
+        uint16 slot = g_Stm.tasks[i].config->macrotick;
+
+        if ((slot > macrotick) && (slot < next))
+        {
+            next = slot;
+        }
+    }
+
+    return next;
+}
+
+
+/** \brief Release the tasks of all cores due at the macrotick slot of the current tick
+ *
+ * The timer 0 is then programmed in single shot mode to the next task macrotick of the cycle. A
+ * macrotick which is already passed, because the interrupt was delayed, is released immediately
+ * and counted in StmStaticCycle_Eray::lateCount. After the last task macrotick of the cycle, the
+ * timer stays halted until the next cycle start.
+ */
+static void StmStaticCycle_releaseSlots(uint16 slot)
+{
+    Ifx_ERAY *eraySfr = g_Stm.eray.eraySfr;
+    uint32    tick    = g_Stm.core[0].tick;
+
+    while (slot != STMSTATICCYCLE_ERAY_NO_SLOT)
+    {
+        uint8 i;
+
+        for (i = 0; i < g_Stm.taskCount; i++)
+        {
+            StmStaticCycle_Task *task = &g_Stm.tasks[i];
+
+            if ((task->config->macrotick == slot) && ((tick % task->config->period) == task->config->offset))
+            {
+                StmStaticCycle_release(task);
+            }
+        }
+
+        slot = StmStaticCycle_getNextSlot(slot);
+
+        if (slot != STMSTATICCYCLE_ERAY_NO_SLOT)
+        {
+            if (slot > IfxEray_getMacrotick(eraySfr))
+            {
+                /* cycle code 1: every cycle, the timer elapses in the current one */
+                IfxEray_startTimer0(eraySfr, 1, slot, FALSE);
+                break;
+            }
+
+            g_Stm.eray.lateCount++;
+        }
+    }
+
+    g_Stm.eray.slot = slot;
+}
+
+
+/** \brief Route the cycle start to the interrupt line 1 and enable the FlexRay time base interrupts
+ *
+ * The status interrupts and the interrupt lines are enabled by IfxEray_Eray_initModule().
+ */
+static void StmStaticCycle_initEray(void)
+{
+    Ifx_ERAY              *eraySfr = &STMSTATICCYCLE_ERAY;
+    volatile Ifx_SRC_SRCR *src;
+
+    g_Stm.eray.eraySfr    = eraySfr;
+    g_Stm.eray.slot       = STMSTATICCYCLE_ERAY_NO_SLOT;
+    g_Stm.eray.cycleCount = 0;
+    g_Stm.eray.lateCount  = 0;
+
+    IfxEray_stopTimer0(eraySfr);
+    IfxEray_setStatusInterruptLine(eraySfr, IfxEray_ClearStatusFlag_cycs, 1);
+
+    src = IfxEray_getInterruptLine1SrcPtr(eraySfr);
+    IfxSrc_init(src, ISR_PROVIDER_ERAY_INT1, ISR_PRIORITY_ERAY_INT1);
+    IfxSrc_enable(src);
+
+    src = IfxEray_getTimerInterrupt0SrcPtr(eraySfr);
+    IfxSrc_init(src, ISR_PROVIDER_ERAY_TINT0, ISR_PRIORITY_ERAY_TINT0);
+    IfxSrc_enable(src);
+}
+#endif
+
+
+/** \brief Returns the number of ticks from tick to the next release of a task of the core
+ *
+ * Returns STMSTATICCYCLE_HYPERPERIOD if no task is assigned to the core.
+ */
+static uint32 StmStaticCycle_getNextRelease(IfxCpu_ResourceCpu cpu, uint32 tick)
+{
+    uint8  i;
+    uint32 next = STMSTATICCYCLE_HYPERPERIOD;
+
+    for (i = 0; i < g_Stm.taskCount; i++)
+    {
+        const StmStaticCycle_TaskConfig *config = g_Stm.tasks[i].config;
+
+        if (config->cpu == cpu)
+        {
+            uint32 delta = (config->offset + config->period - (tick % config->period)) % config->period;
+
+            if (delta == 0)
+            {
+                delta = config->period;
+            }
+
+            if (delta < next)
+            {
+                next = delta;
+            }
+        }
+    }
+
+    return next;
+}
+
+
+/** \brief Release a task
+ *
+ * A task released while its previous release is still pending has missed its deadline:
+ * the release is dropped and counted in StmStaticCycle_Task::missCount.
+ */
+static void StmStaticCycle_release(StmStaticCycle_Task *task)
+{
+    task->releaseCount++;
+
+    if (task->pending)
+    {
+        task->missCount++;
+        Ifx_Os_activationLost(task->os.id);
+    }
+    else
+    {
+        task->pending = TRUE;
+    }
+}
+
+
+/** \brief Advance the tick of a core and release its tasks due in this tick
+ *
+ * In tickless mode the comparator is then programmed to the next release of the core instead
+ * of the next tick.
+ */
+static void StmStaticCycle_tick(StmStaticCycle_Core *core, IfxCpu_ResourceCpu cpu)
+{
+    uint8  i;
+    uint32 tick;
+
+#if STMSTATICCYCLE_LATENCY
+    Ifx_IsrLatency_measureStm(&g_Stm.latency, cpu, core->stmSfr, core->stmConfig.comparator);
+#endif
+
+    IfxStm_clearCompareFlag(core->stmSfr, core->stmConfig.comparator);
+
+    if ((core->tick + core->step) >= STMSTATICCYCLE_HYPERPERIOD)
+    {
+        core->hyperperiodCount++;
+    }
+
+    tick = (core->tick + core->step) % STMSTATICCYCLE_HYPERPERIOD;
+
+    core->tick = tick;
+    core->interruptCount++;
+
+#ifdef STMSTATICCYCLE_SIM_HYPERPERIODS
+    if (core->hyperperiodCount > STMSTATICCYCLE_SIM_HYPERPERIODS)
+    {
+        /* end of the simulator run: no release, the comparator is not programmed again */
+        return;
+    }
+#endif
+
+    for (i = 0; i < g_Stm.taskCount; i++)
+    {
+        StmStaticCycle_Task *task = &g_Stm.tasks[i];
+
+        if ((task->config->cpu == cpu) && ((tick % task->config->period) == task->config->offset))
+        {
+            StmStaticCycle_release(task);
+        }
+    }
+
+#if STMSTATICCYCLE_TICKLESS
+    core->step = StmStaticCycle_getNextRelease(cpu, tick);
+#endif
+
 #ifdef SIMULATION
-	IfxStm_increaseCompare(g_Stm.stmSfr, g_Stm.stmConfig.comparator, 1000);
+	IfxStm_increaseCompare(core->stmSfr, core->stmConfig.comparator, core->step * 1000);
 #else
-	IfxStm_increaseCompare(g_Stm.stmSfr, g_Stm.stmConfig.comparator, TimeConst_1ms);
+	IfxStm_increaseCompare(core->stmSfr, core->stmConfig.comparator, core->step * TimeConst_1ms);
 #endif
     IfxCpu_enableInterrupts();
+}
 
-    g_Stm.counter++;
-    if(g_Stm.counter == 1000){
-    	g_Stm.counter = 0;
+
+/** \brief Execute a task and update its statistics
+ *
+ * The execution is also reported to \ref library_srvsw_sysse_general_os, as a task of an OS would be.
+ */
+static void StmStaticCycle_execute(StmStaticCycle_Core *core, StmStaticCycle_Task *task)
+{
+    uint32 start = IfxStm_getLower(core->stmSfr);
+    uint32 runtime;
+
+    Ifx_Os_preTask(task->os.id);
+    task->config->task();
+    Ifx_Os_taskEnd();
+    Ifx_Os_postTask(task->os.id);
+
+    runtime       = IfxStm_getLower(core->stmSfr) - start;
+    task->pending = FALSE;
+
+    task->runCount++;
+    task->lastRuntime   = runtime;
+    task->totalRuntime += runtime;
+
+    if (runtime > task->maxRuntime)
+    {
+        task->maxRuntime = runtime;
+    }
+
+    if (runtime > task->budgetTicks)
+    {
+        task->overrunCount++;
     }
+}
+
+
+#ifdef STMSTATICCYCLE_SIM_HYPERPERIODS
+/** \brief Write the simulator benchmark report, see \ref STMSTATICCYCLE_SIM_HYPERPERIODS
+ *
+ * Called by CPU0 once all cores finished the simulator run, the profilers are then not updated anymore.
+ */
+static void StmStaticCycle_reportSimulation(void)
+{
+    IfxStdIf_DPipe *io = &g_Stm.simioStdIf;
+    uint8           i;
 
-    task_flag_1m = TRUE;
+    IfxStdIf_DPipe_print(io, "SIMBENCH_BEGIN,StmStaticCycle,%u"ENDL, STMSTATICCYCLE_SIM_HYPERPERIODS);
 
-    if(g_Stm.counter % 10 == 0){
-    	task_flag_10m = TRUE;
+    for (i = 0; i < STMSTATICCYCLE_CORE_COUNT; i++)
+    {
+        Ifx_Profiler_printRecords(&g_Stm.profiler[i], "SIMBENCH", io);
     }
-    if(g_Stm.counter % 100 == 0){
-        task_flag_100m = TRUE;
+
+    for (i = 0; i < g_Stm.taskCount; i++)
+    {
+        IfxStdIf_DPipe_print(io, "SIMBENCH_TASK,%s,%u,%u"ENDL, g_Stm.tasks[i].config->name,
+            g_Stm.tasks[i].releaseCount, g_Stm.tasks[i].missCount);
     }
-    if(g_Stm.counter % 1000 == 0){
-        task_flag_1000m = TRUE;
+
+    IfxStdIf_DPipe_print(io, "SIMBENCH_END"ENDL);
+
+    g_Stm.simReported = TRUE;
+}
+
+
+#endif
+/** \brief Synchronize the start of the cores and start the tick of the calling core
+ *
+ * All cores wait for each other, then CPU0 sets the time of the first tick, 1ms later.
+ * STMn counts in lock step with STM0, so the comparators of all cores fire in the same tick.
+ * A core which does not get the start time within STMSTATICCYCLE_START_TIMEOUT starts on its
+ * own time base, unsynchronized.
+ * With the FlexRay time base, the STM is only used for the runtime measurement, the ticks
+ * are the cycle start interrupts.
+ */
+static void StmStaticCycle_start(StmStaticCycle_Core *core, IfxCpu_ResourceCpu cpu)
+{
+    IfxCpu_emitEvent(&g_Stm.startEvent);
+    IfxCpu_waitEvent(&g_Stm.startEvent, STMSTATICCYCLE_START_TIMEOUT);
+
+    core->stmSfr = IfxStm_getAddress((IfxStm_Index)cpu);
+
+    if (cpu == IfxCpu_ResourceCpu_0)
+    {
+        g_Stm.startTime = IfxStm_getLower(core->stmSfr) + TimeConst_1ms;
+        __dsync();
+        g_Stm.startValid = TRUE;
     }
 
-    appIsrCb_1ms();
+    IfxCpu_emitEvent(&g_Stm.startTimeEvent);
+    IfxCpu_waitEvent(&g_Stm.startTimeEvent, STMSTATICCYCLE_START_TIMEOUT);
+
+    if (g_Stm.startValid != FALSE)
+    {
+        core->startTime = g_Stm.startTime;
+    }
+    else
+    {
+        core->startTime = IfxStm_getLower(core->stmSfr) + TimeConst_1ms;
+    }
+
+    {
+        uint8         i;
+#ifdef STMSTATICCYCLE_SIM_HYPERPERIODS
+        Ifx_Profiler *profiler = &g_Stm.profiler[cpu];
+
+        Ifx_Profiler_init(profiler, STMSTATICCYCLE_SIM_BIN_SHIFT);
+        IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+#else
+        Ifx_Profiler *profiler = NULL_PTR;
+#endif
+
+        /* registered by the executing core, deadline is the period */
+        for (i = 0; i < g_Stm.taskCount; i++)
+        {
+            const StmStaticCycle_TaskConfig *config = g_Stm.tasks[i].config;
+
+            if (config->cpu == cpu)
+            {
+#if STMSTATICCYCLE_TIMEBASE_ERAY
+                Ifx_Os_addTask(&g_Stm.tasks[i].os, i, config->name, 0, profiler);
+#else
+                Ifx_Os_addTask(&g_Stm.tasks[i].os, i, config->name, config->period * 1000U, profiler);
+#endif
+            }
+        }
+    }
+
+    /* the first interrupt releases tick 0 */
+    core->tick             = STMSTATICCYCLE_HYPERPERIOD - 1;
+    core->step             = 1;
+    core->interruptCount   = 0;
+    core->hyperperiodCount = 0;
+
+#if STMSTATICCYCLE_TIMEBASE_ERAY
+    if (cpu == IfxCpu_ResourceCpu_0)
+    {
+        StmStaticCycle_initEray();
+    }
+#else
+    IfxStm_initCompareConfig(&core->stmConfig);
+
+    core->stmConfig.triggerPriority = StmStaticCycle_isrPriority[cpu];
+    core->stmConfig.typeOfService   = StmStaticCycle_isrProvider[cpu];
+    core->stmConfig.ticks           = core->startTime - IfxStm_getLower(core->stmSfr);
+    IfxStm_initCompare(core->stmSfr, &core->stmConfig);
+#endif
 }
 
 
@@ -171,51 +652,151 @@ void StmStaticCycleScheduler_init(void)
 
     initTime();
 
-    g_Stm.stmSfr = &MODULE_STM0;
-    IfxStm_initCompareConfig(&g_Stm.stmConfig);
+    {
+        uint8 i;
+
+        for (i = 0; i < STMSTATICCYCLE_TASK_COUNT; i++)
+        {
+            StmStaticCycle_Task *task = &StmStaticCycle_tasks[i];
+
+            IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (STMSTATICCYCLE_HYPERPERIOD % StmStaticCycle_taskConfig[i].period) == 0);
+            IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, StmStaticCycle_taskConfig[i].offset < StmStaticCycle_taskConfig[i].period);
+
+            task->config       = &StmStaticCycle_taskConfig[i];
+            task->budgetTicks  = StmStaticCycle_taskConfig[i].budget * TimeConst_1us;
+            task->pending      = FALSE;
+            task->releaseCount = 0;
+            task->missCount    = 0;
+            task->runCount     = 0;
+            task->overrunCount = 0;
+            task->lastRuntime  = 0;
+            task->maxRuntime   = 0;
+            task->totalRuntime = 0;
+        }
+
+        g_Stm.tasks     = StmStaticCycle_tasks;
+        g_Stm.taskCount = STMSTATICCYCLE_TASK_COUNT;
+    }
 
-    g_Stm.stmConfig.triggerPriority = ISR_PRIORITY_STM_INT0;
-    g_Stm.stmConfig.typeOfService   = IfxSrc_Tos_cpu0;
-#ifdef SIMULATION
-    g_SrcSwInt.stmConfig.ticks      = 1000;
-#else
-    g_Stm.stmConfig.ticks           = TimeConst_1ms;
+#ifdef STMSTATICCYCLE_SIM_HYPERPERIODS
+    /* blocking mode, the report is complete */
+    Ifx_SimioPipe_init(&g_Stm.simio, FALSE);
+    Ifx_SimioPipe_stdIfDPipeInit(&g_Stm.simioStdIf, &g_Stm.simio);
+    g_Stm.simReported = FALSE;
 #endif
-    IfxStm_initCompare(g_Stm.stmSfr, &g_Stm.stmConfig);
+
+    {
+        static const pchar latencyName[3] = {"stm0", "stm1", "stm2"};
+        uint8              i;
+
+        /* registered before the start of the cores, in CPU order */
+        Ifx_IsrLatency_init(&g_Stm.latency, STMSTATICCYCLE_LATENCY_BIN_SHIFT);
+
+        for (i = 0; i < STMSTATICCYCLE_CORE_COUNT; i++)
+        {
+            Ifx_IsrLatency_addEntry(&g_Stm.latency, latencyName[i], StmStaticCycle_isrPriority[i]);
+        }
+    }
+
+    StmStaticCycle_start(&g_Stm.core[0], IfxCpu_ResourceCpu_0);
 
     IfxBlinkLed_Init();
 
+    appTaskfu_init();
+
     /* enable interrupts again */
     IfxCpu_restoreInterrupts(interruptState);
 
 }
 
 
+/** \brief Core init API
+ *
+ * This function is called from the main function of CPU1 and CPU2 during initialization phase.
+ * It returns when all cores have been synchronized by \ref StmStaticCycleScheduler_init().
+ */
+void StmStaticCycleScheduler_initCore(void)
+{
+    IfxCpu_ResourceCpu cpu = IfxCpu_getCoreIndex();
+
+    StmStaticCycle_start(&g_Stm.core[cpu], cpu);
+
+    IfxCpu_enableInterrupts();
+}
+
+
 /** \brief Demo run API
  *
- * This function is called from main, background loop
+ * This function is called from the background loop of each core. It executes the highest priority
+ * pending task of the calling core. On CPU0, the idle task is executed if no task is pending.
+ * In tickless mode, the core is then set to idle mode until the next STM interrupt.
  */
 void StmStaticCycleScheduler_run(void)
 {
-	if(task_flag_1m == TRUE){
-		appTaskfu_1ms();
-		task_flag_1m = FALSE;
-	}
+    uint8              i;
+    IfxCpu_ResourceCpu cpu = IfxCpu_getCoreIndex();
 
-	if(task_flag_10m == TRUE){
-		appTaskfu_10ms();
-		task_flag_10m = FALSE;
-	}
+    /* highest priority pending task of this core first, then restart from the table top */
+    for (i = 0; i < g_Stm.taskCount; i++)
+    {
+        StmStaticCycle_Task *task = &g_Stm.tasks[i];
 
-	if(task_flag_100m == TRUE){
-		appTaskfu_100ms();
-		task_flag_100m = FALSE;
-	}
+        if ((task->config->cpu == cpu) && task->pending)
+        {
+            StmStaticCycle_execute(&g_Stm.core[cpu], task);
+            return;
+        }
+    }
 
-	if(task_flag_1000m == TRUE){
-		appTaskfu_1000ms();
-		task_flag_1000m = FALSE;
-	}
+    if (cpu == IfxCpu_ResourceCpu_0)
+    {
+        appTaskfu_idle();
+
+#ifdef STMSTATICCYCLE_SIM_HYPERPERIODS
+        if (!g_Stm.simReported)
+        {
+            boolean done = TRUE;
+
+            /* no task of any core is pending after the end of the simulator run */
+            for (i = 0; i < STMSTATICCYCLE_CORE_COUNT; i++)
+            {
+                done = done && (g_Stm.core[i].hyperperiodCount > STMSTATICCYCLE_SIM_HYPERPERIODS);
+            }
+
+            for (i = 0; i < g_Stm.taskCount; i++)
+            {
+                done = done && !g_Stm.tasks[i].pending;
+            }
+
+            if (done)
+            {
+                StmStaticCycle_reportSimulation();
+            }
+        }
+#endif
+    }
 
-	appTaskfu_idle();
+#if STMSTATICCYCLE_TICKLESS
+    {
+        /* The core is woken by the next STM interrupt. The check and the idle request are done
+         * with interrupts disabled, so that a release between them wakes the core immediately */
+        boolean interruptState = IfxCpu_disableInterrupts();
+        boolean pending        = FALSE;
+
+        for (i = 0; i < g_Stm.taskCount; i++)
+        {
+            if ((g_Stm.tasks[i].config->cpu == cpu) && g_Stm.tasks[i].pending)
+            {
+                pending = TRUE;
+            }
+        }
+
+        if (!pending)
+        {
+            IfxCpu_setCoreMode(IfxCpu_getAddress(cpu), IfxCpu_CoreMode_idle);
+        }
+
+        IfxCpu_restoreInterrupts(interruptState);
+    }
+#endif
 }
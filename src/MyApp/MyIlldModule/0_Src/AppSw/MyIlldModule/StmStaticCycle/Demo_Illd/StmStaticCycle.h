@@ -39,10 +39,95 @@
 #include <Src/Std/IfxSrc.h>
 #include "Cpu0_Main.h"
 #include "Cpu/Irq/IfxCpu_Irq.h"
+#include "SysSe/Time/Ifx_IsrLatency.h"
+#include "SysSe/General/Ifx_Os.h"
+#include "SysSe/Comm/Ifx_SimioPipe.h"
+#include "Eray/Std/IfxEray.h"
 
 /******************************************************************************/
 /*-----------------------------------Macros-----------------------------------*/
 /******************************************************************************/
+/** \brief FlexRay time base
+ *
+ * When 0, each core is ticked every 1ms by its STM. When 1, the tasks are aligned to the FlexRay cycle
+ * of STMSTATICCYCLE_ERAY: a tick is a FlexRay cycle, numbered by the cycle counter (0..63), and each
+ * task is released at the macrotick StmStaticCycle_TaskConfig::macrotick of its cycles. All nodes of
+ * the cluster then release their tasks in the same cycles and macroticks.
+ *
+ * The cycle start interrupt (INT1) releases the tasks of macrotick 0 and programs the absolute timer 0
+ * (TINT0) to the next task macrotick of the cycle, the timer interrupt does the same for the following
+ * ones. The releases of all cores are done by CPU0. The tasks are only released while the controller,
+ * initialised and started by the application, is synchronized to the cluster.
+ */
+#ifndef STMSTATICCYCLE_TIMEBASE_ERAY
+#define STMSTATICCYCLE_TIMEBASE_ERAY (0)
+#endif
+
+#ifndef STMSTATICCYCLE_ERAY
+#define STMSTATICCYCLE_ERAY          (MODULE_ERAY0)         /**< \brief ERAY module of the FlexRay time base */
+#endif
+
+#if STMSTATICCYCLE_TIMEBASE_ERAY
+#define STMSTATICCYCLE_HYPERPERIOD   (64)                   /**< \brief Scheduler cycle in ticks (FlexRay cycles), multiple of all task periods */
+#else
+#define STMSTATICCYCLE_HYPERPERIOD   (1000)                 /**< \brief Scheduler cycle in ticks (1ms), multiple of all task periods */
+#endif
+#define STMSTATICCYCLE_CORE_COUNT    (IFXCPU_NUM_MODULES)   /**< \brief Number of cores running the scheduler, each one with its own STM */
+#define STMSTATICCYCLE_START_TIMEOUT (100)                  /**< \brief Timeout of the start synchronization in ms */
+#define STMSTATICCYCLE_ERAY_NO_SLOT  (0xFFFFU)              /**< \brief No further task macrotick in the FlexRay cycle */
+
+/** \brief Tickless mode
+ *
+ * When 1, the STM comparator is programmed to the next release of a task of the core instead of
+ * every tick, and the core is set to idle mode when no task is pending. appIsrCb_1ms() is then
+ * only called on the CPU0 release ticks.
+ */
+#ifndef STMSTATICCYCLE_TICKLESS
+#define STMSTATICCYCLE_TICKLESS      (0)
+#endif
+
+/** \brief Interrupt latency measurement mode
+ *
+ * When 1, each STM interrupt measures the delay from the compare match to the start of the tick
+ * into App_Stm::latency (one entry per core). With IFX_CFG_BSP_CRITICAL_SECTION_MONITOR = 1, the
+ * longest critical sections delaying the tick are recorded too.
+ */
+#ifndef STMSTATICCYCLE_LATENCY
+#define STMSTATICCYCLE_LATENCY       (0)
+#endif
+
+#define STMSTATICCYCLE_LATENCY_BIN_SHIFT (3)                /**< \brief Latency histogram bin width is 2^3 STM ticks */
+
+/** \brief Simulator benchmark mode, number of hyperperiods of the simulator run
+ *
+ * In the SIMULATION build, the cycles (CCNT) and instructions (ICNT) of each task are recorded by the
+ * profiler of its core (App_Stm::profiler). At the end of the hyperperiod STMSTATICCYCLE_SIM_HYPERPERIODS the
+ * cores are not ticked anymore, and CPU0 writes the results through the simulated IO:
+ * \code
+ * SIMBENCH_BEGIN,StmStaticCycle,<hyperperiods>
+ * SIMBENCH,<cpu>,<task>,<count>,<min cycles>,<max cycles>,<mean cycles>,<mean instructions>
+ * SIMBENCH_TASK,<task>,<releases>,<misses>
+ * SIMBENCH_END
+ * \endcode
+ * The instruction counts do not depend on the simulated timing, they are compared between two driver versions.
+ */
+#ifdef SIMULATION
+#ifndef STMSTATICCYCLE_SIM_HYPERPERIODS
+#define STMSTATICCYCLE_SIM_HYPERPERIODS  (2)
+#endif
+#define STMSTATICCYCLE_SIM_BIN_SHIFT     (8)                /**< \brief Cycle histogram bin width is 2^8 cycles */
+#endif
+
+#if STMSTATICCYCLE_TIMEBASE_ERAY && (STMSTATICCYCLE_TICKLESS || STMSTATICCYCLE_LATENCY)
+#error "The FlexRay time base does not support the tickless and interrupt latency measurement modes"
+#endif
+
+#if STMSTATICCYCLE_TIMEBASE_ERAY && defined(STMSTATICCYCLE_SIM_HYPERPERIODS)
+#error "The FlexRay time base is not supported in the SIMULATION build"
+#endif
+
+/** \brief CPU assigned to a task, CPU0 on derivatives without CPU n */
+#define STMSTATICCYCLE_CPU(n)        ((IfxCpu_ResourceCpu)(((n) < STMSTATICCYCLE_CORE_COUNT) ? (n) : 0))
 
 /******************************************************************************/
 /*--------------------------------Enumerations--------------------------------*/
@@ -51,12 +136,86 @@
 /*-----------------------------Data Structures--------------------------------*/
 /******************************************************************************/
 
+/** \brief Static task description
+ *
+ * The task is released at each tick where (tick % period) == offset. The offsets are chosen
+ * so that the tasks with a period > 1ms are released in different ticks. With the FlexRay
+ * time base, the task is released at the macrotick macrotick of these ticks.
+ */
+typedef struct
+{
+    void (*task)(void);                     /**< \brief Task function */
+    pchar              name;                /**< \brief Task name */
+    IfxCpu_ResourceCpu cpu;                 /**< \brief CPU executing the task, see STMSTATICCYCLE_CPU() */
+    uint16             period;              /**< \brief Period in ticks (1ms), divisor of STMSTATICCYCLE_HYPERPERIOD */
+    uint16             offset;              /**< \brief Release offset in ticks, lower than period */
+    uint16             macrotick;           /**< \brief Release macrotick in the FlexRay cycle, FlexRay time base only */
+    uint32             budget;              /**< \brief Worst case execution time budget in us */
+} StmStaticCycle_TaskConfig;
+
+/** \brief Task runtime state and statistics
+ *
+ * The runtimes are measured in STM ticks and include the time spent in interrupts.
+ */
+typedef struct
+{
+    const StmStaticCycle_TaskConfig *config;    /**< \brief Static task description */
+    uint32           budgetTicks;               /**< \brief budget converted to STM ticks */
+    volatile boolean pending;                   /**< \brief TRUE from the release until the end of the execution */
+    volatile uint32  releaseCount;              /**< \brief number of releases */
+    volatile uint32  missCount;                 /**< \brief number of releases lost because the previous one was still pending (deadline miss) */
+    uint32           runCount;                  /**< \brief number of executions */
+    uint32           overrunCount;              /**< \brief number of executions longer than the budget */
+    uint32           lastRuntime;               /**< \brief runtime of the last execution */
+    uint32           maxRuntime;                /**< \brief maximal runtime */
+    uint64           totalRuntime;              /**< \brief sum of the runtimes */
+    Ifx_Os_Task      os;                        /**< \brief task instrumentation, task ID is the index in the table */
+} StmStaticCycle_Task;
+
+/** \brief Scheduler state of one core
+ *
+ * CPUn is ticked by the comparator 0 of STMn.
+ */
 typedef struct
 {
     Ifx_STM             *stmSfr;            /**< \brief Pointer to Stm register base */
     IfxStm_CompareConfig stmConfig;         /**< \brief Stm Configuration structure */
-    volatile uint8       LedBlink;          /**< \brief LED state variable */
-    volatile uint32      counter;           /**< \brief interrupt counter */
+    volatile uint32      tick;              /**< \brief scheduler tick, 0..STMSTATICCYCLE_HYPERPERIOD-1 */
+    uint32               step;              /**< \brief ticks until the next interrupt, always 1 if not tickless */
+    volatile uint32      interruptCount;    /**< \brief number of STM interrupts */
+    volatile uint32      hyperperiodCount;  /**< \brief number of hyperperiods started */
+    uint32               startTime;         /**< \brief STM time of the first tick of this core */
+} StmStaticCycle_Core;
+
+/** \brief FlexRay time base state
+ */
+typedef struct
+{
+    Ifx_ERAY       *eraySfr;                /**< \brief Pointer to Eray register base */
+    uint16          slot;                   /**< \brief macrotick programmed into the timer 0, STMSTATICCYCLE_ERAY_NO_SLOT if none */
+    volatile uint32 cycleCount;             /**< \brief number of cycle start interrupts */
+    volatile uint32 lateCount;              /**< \brief number of macroticks already passed when programming the timer 0, released late */
+} StmStaticCycle_Eray;
+
+typedef struct
+{
+    volatile uint8       LedBlink;                              /**< \brief LED state variable */
+    volatile uint32      counter;                               /**< \brief interrupt counter */
+    StmStaticCycle_Core  core[STMSTATICCYCLE_CORE_COUNT];       /**< \brief per core scheduler state */
+    StmStaticCycle_Task *tasks;                                 /**< \brief task table, shared by all cores */
+    uint8                taskCount;                             /**< \brief number of tasks in the table */
+    IfxCpu_syncEvent     startEvent;                            /**< \brief start synchronization of the cores */
+    IfxCpu_syncEvent     startTimeEvent;                        /**< \brief synchronization of the cores on the start time */
+    volatile uint32      startTime;                             /**< \brief STM time of the first tick of all cores, set by CPU0 */
+    volatile boolean     startValid;                            /**< \brief TRUE once CPU0 has set startTime */
+    Ifx_IsrLatency       latency;                               /**< \brief STM interrupt latency of each core, entry ID is the CPU index */
+    StmStaticCycle_Eray  eray;                                  /**< \brief FlexRay time base state */
+#ifdef STMSTATICCYCLE_SIM_HYPERPERIODS
+    Ifx_Profiler         profiler[STMSTATICCYCLE_CORE_COUNT];   /**< \brief task cycles and instructions of each core, simulator benchmark mode */
+    Ifx_SimioPipe        simio;                                 /**< \brief simulated IO of the simulator benchmark report */
+    IfxStdIf_DPipe       simioStdIf;                            /**< \brief simulated IO standard interface */
+    boolean              simReported;                           /**< \brief TRUE when the simulator benchmark report is written */
+#endif
 } App_Stm;
 /******************************************************************************/
 /*------------------------------Global variables------------------------------*/
@@ -66,6 +225,7 @@ IFX_EXTERN App_Stm g_Stm;
 /*-------------------------Function Prototypes--------------------------------*/
 /******************************************************************************/
 IFX_EXTERN void StmStaticCycleScheduler_init(void);
+IFX_EXTERN void StmStaticCycleScheduler_initCore(void);
 IFX_EXTERN void StmStaticCycleScheduler_run(void);
 IFX_EXTERN void IfxBlinkLed_Task(void);
 #endif
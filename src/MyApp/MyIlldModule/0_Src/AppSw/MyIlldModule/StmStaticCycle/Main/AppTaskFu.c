@@ -6,13 +6,25 @@ static sint32 task_cnt_10m = 0;
 static sint32 task_cnt_100m = 0;
 static sint32 task_cnt_1000m = 0;
 
-boolean task_flag_1m = FALSE;
-boolean task_flag_10m = FALSE;
-boolean task_flag_100m = FALSE;
-boolean task_flag_1000m = FALSE;
+Ifx_Coroutine_Scheduler g_AppCoroutines;
+
+Ifx_Xcp g_AppXcp;
+
+static const Ifx_Xcp_EventConfig appXcpEvents[3] = {
+	{"1ms",   1,   Ifx_Xcp_TimeUnit_1ms, 2},
+	{"10ms",  10,  Ifx_Xcp_TimeUnit_1ms, 1},
+	{"100ms", 100, Ifx_Xcp_TimeUnit_1ms, 0}
+};
 
 void appTaskfu_init(void){
+	Ifx_Xcp_Config xcpConfig;
 
+	Ifx_Coroutine_initScheduler(&g_AppCoroutines);
+
+	Ifx_Xcp_initConfig(&xcpConfig);
+	xcpConfig.events     = appXcpEvents;
+	xcpConfig.eventCount = 3;
+	Ifx_Xcp_init(&g_AppXcp, &xcpConfig);
 }
 
 void appTaskfu_1ms(void)
@@ -22,6 +34,8 @@ void appTaskfu_1ms(void)
 		task_cnt_1m = 0;
 	}
 
+	Ifx_Xcp_event(&g_AppXcp, APP_XCP_EVENT_1MS);
+
 }
 
 
@@ -32,6 +46,8 @@ void appTaskfu_10ms(void)
 		task_cnt_10m = 0;
 	}
 
+	Ifx_Xcp_event(&g_AppXcp, APP_XCP_EVENT_10MS);
+
 }
 
 void appTaskfu_100ms(void)
@@ -42,6 +58,8 @@ void appTaskfu_100ms(void)
 		task_cnt_100m = 0;
 	}
 
+	Ifx_Xcp_event(&g_AppXcp, APP_XCP_EVENT_100MS);
+
 }
 
 void appTaskfu_1000ms(void)
@@ -55,8 +73,8 @@ void appTaskfu_1000ms(void)
 }
 
 void appTaskfu_idle(void){
-
-
+	/* the coroutines wait with IFX_COROUTINE_AWAIT... instead of blocking the cyclic tasks */
+	Ifx_Coroutine_run(&g_AppCoroutines);
 }
 
 void appIsrCb_1ms(void){
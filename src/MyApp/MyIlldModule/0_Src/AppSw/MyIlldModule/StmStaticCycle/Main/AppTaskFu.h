@@ -2,11 +2,20 @@
 #define APPTASKFU_H_
 
 #include <Ifx_Types.h>
+#include "SysSe/General/Ifx_Coroutine.h"
+#include "SysSe/Comm/Ifx_Xcp.h"
 
-IFX_EXTERN boolean task_flag_1m;
-IFX_EXTERN boolean task_flag_10m;
-IFX_EXTERN boolean task_flag_100m;
-IFX_EXTERN boolean task_flag_1000m;
+/* coroutines of the application, executed by appTaskfu_idle */
+extern Ifx_Coroutine_Scheduler g_AppCoroutines;
+
+/* XCP event channels of the cyclic tasks */
+#define APP_XCP_EVENT_1MS   (0)
+#define APP_XCP_EVENT_10MS  (1)
+#define APP_XCP_EVENT_100MS (2)
+
+/* XCP slave, the DAQ lists are sampled by the cyclic tasks. A transport layer
+ * (Ifx_XcpCan_init() or Ifx_XcpUdp_init()) is set once the bus is initialised */
+extern Ifx_Xcp g_AppXcp;
 
 void appTaskfu_init(void);
 void appTaskfu_1ms(void);
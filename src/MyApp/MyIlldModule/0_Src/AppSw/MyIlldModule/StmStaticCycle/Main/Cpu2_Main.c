@@ -26,6 +26,7 @@
 /******************************************************************************/
 
 #include "Cpu0_Main.h"
+#include "StmStaticCycle.h"
 
 /** \brief Main entry point for CPU1 */
 void core2_main(void)
@@ -36,7 +37,12 @@ void core2_main(void)
      * */
     IfxScuWdt_disableCpuWatchdog(IfxScuWdt_getCpuWatchdogPassword());
 
+    /* Scheduler tick of this core, synchronized with CPU0 */
+    StmStaticCycleScheduler_initCore();
+
     /** - Background loop */
     while (TRUE)
-    {}
+    {
+        StmStaticCycleScheduler_run();
+    }
 }
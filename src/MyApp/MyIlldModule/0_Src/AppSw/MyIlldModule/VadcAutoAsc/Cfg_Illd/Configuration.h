@@ -62,5 +62,18 @@
 /** \} */
 #define ADC_STARTUP_CALIBRATION 1  /**< \brief Enable Calibration for TC27xB,TC26x and TC29x Derivatives */
 
+/**
+ * \name VADC to ASCLIN streaming.
+ * With VADCAUTOASC_STREAM set, the channels are streamed by DMA (VadcAscStream) instead of being read by the CPU
+ * and written to the ASC software FIFO.
+ * \{
+ */
+#define VADCAUTOASC_STREAM        0             /**< \brief 1: DMA streaming pipeline, 0: CPU read of 2 channels every ms */
+#define STREAM_CHANNELS           0x00FF        /**< \brief Channels of VADC group 0 in the stream */
+#define STREAM_SCAN_FREQUENCY     20000         /**< \brief Scans per second */
+#define STREAM_BLOCK_SIZE         256           /**< \brief Samples per frame */
+#define STREAM_BAUDRATE           4000000       /**< \brief ASC baudrate of the stream */
+/** \} */
+
 /** \} */
 #endif
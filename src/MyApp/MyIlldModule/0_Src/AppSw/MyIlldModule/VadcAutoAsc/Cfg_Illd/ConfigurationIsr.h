@@ -59,6 +59,18 @@
 #define ISR_PRIORITY_ASC_3_TX 11         /**< \brief Define the ASC3 transmit interrupt priority.  */
 #define ISR_PRIORITY_ASC_3_EX 12        /**< \brief Define the ASC3 error interrupt priority.  */
 
+#define ISR_PRIORITY_ADC_STREAM 20      /**< \brief Define the VADC stream block ready (framing) interrupt priority.  */
+
+/** \} */
+
+/**
+ * \name DMA channel configuration.
+ * The DMA channel is also the priority of the service request routed to it.
+ * \{ */
+
+#define DMA_CHANNEL_ADC_STREAM IfxDma_ChannelId_1     /**< \brief Define the DMA channel moving the VADC results.  */
+#define DMA_CHANNEL_ASC_TX     IfxDma_ChannelId_2     /**< \brief Define the DMA channel of the ASC transmission.  */
+
 /** \} */
 
 /**
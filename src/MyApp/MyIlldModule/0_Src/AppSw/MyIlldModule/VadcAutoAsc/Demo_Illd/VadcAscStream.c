@@ -0,0 +1,285 @@
+/**
+ * \file VadcAscStream.c
+ * \brief VADC to ASCLIN streaming pipeline: DMA result blocks, in place framing, DMA transmission
+ *
+ * \version iLLD_Demos_1_0_0_11_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "VadcAscStream.h"
+#include <Cpu/Std/IfxCpu.h>
+#include <Gtm/Std/IfxGtm_Cmu.h>
+#include "SysSe/Math/Ifx_Crc.h"
+#include <string.h>
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+static void   VadcAscStream_initTrigger(Ifx_GTM_TOM *tom, Ifx_GTM_TOM_TGC *tgc, IfxGtm_Tom_Ch channel, IfxGtm_Tom_Ch_ClkSrc clock, uint32 period);
+static void   VadcAscStream_pack(Ifx_VADC_RES *block, uint16 count);
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+/** \brief Configure the trigger TOM channel, started by the next trigger of its TGC
+ *
+ * The output is high during the first half of the period, the falling edge starts the scan.
+ */
+static void VadcAscStream_initTrigger(Ifx_GTM_TOM *tom, Ifx_GTM_TOM_TGC *tgc, IfxGtm_Tom_Ch channel, IfxGtm_Tom_Ch_ClkSrc clock, uint32 period)
+{
+    IfxGtm_Tom_Ch_setClockSource(tom, channel, clock);
+    IfxGtm_Tom_Ch_setSignalLevel(tom, channel, Ifx_ActiveState_high);
+    IfxGtm_Tom_Ch_setCompare(tom, channel, period, period / 2);
+    IfxGtm_Tom_Ch_setCompareShadow(tom, channel, period, period / 2);
+
+    IfxGtm_Tom_Tgc_setChannelForceUpdate(tgc, channel, TRUE, TRUE);
+    IfxGtm_Tom_Tgc_enableChannel(tgc, channel, TRUE, FALSE);
+}
+
+
+/** \brief Pack the 12-bit results of a block in place, 3 bytes per 2 results
+ *
+ * The 2 results of a pair are read before the 3 bytes are written; the bytes of pair k end before the
+ * results of pair k + 1 start (3k + 2 < 8k + 8), no result is overwritten before it is read.
+ */
+static void VadcAscStream_pack(Ifx_VADC_RES *block, uint16 count)
+{
+    uint8 *packed = (uint8 *)block;
+    uint16 index;
+
+    for (index = 0; index < count; index += 2)
+    {
+        uint32 a = block[index].B.RESULT & 0xFFFU;
+        uint32 b = block[index + 1].B.RESULT & 0xFFFU;
+
+        packed[0] = (uint8)a;
+        packed[1] = (uint8)((a >> 8) | (b << 4));
+        packed[2] = (uint8)(b >> 4);
+        packed   += 3;
+    }
+}
+
+
+void VadcAscStream_initConfig(VadcAscStream_Config *config, IfxVadc_Adc *vadc)
+{
+    config->vadc               = vadc;
+    config->groupId            = IfxVadc_GroupId_0;
+    config->triggerInput       = IfxVadc_TriggerSource_2;
+    config->channels           = 0x00FF;
+    config->triggerTom         = IfxGtm_Tom_0;
+    config->triggerChannel     = IfxGtm_Tom_Ch_5;
+    config->scanFrequency      = 20000;
+    config->dma                = NULL_PTR;
+    config->resultDmaChannelId = IfxDma_ChannelId_none;
+    config->buffer             = NULL_PTR;
+    config->blockSize          = 256;
+    config->blockPriority      = 0;
+    config->blockServProvider  = IfxSrc_Tos_cpu0;
+    config->asc                = NULL_PTR;
+    config->blockFramed        = NULL_PTR;
+}
+
+
+boolean VadcAscStream_init(VadcAscStream *stream, const VadcAscStream_Config *config)
+{
+    Ifx_GTM         *gtm = &MODULE_GTM;
+    Ifx_GTM_TOM     *tom;
+    Ifx_GTM_TOM_TGC *tgc;
+    IfxGtm_Cmu_Fxclk clock;
+    float32          frequency = 0;
+    uint32           period    = 0;
+    uint8            half;
+
+    if ((config->asc == NULL_PTR) || (config->asc->dma.useTxDma == FALSE)
+        || (config->dma == NULL_PTR) || (config->buffer == NULL_PTR)
+        || (config->channels == 0) || (config->blockSize < 2) || (config->blockPriority == 0)
+        || (config->resultDmaChannelId == config->asc->dma.txDmaChannelId)
+        || (config->triggerTom > IfxGtm_Tom_1))
+    {
+        return FALSE;
+    }
+
+    /* the DMA loads the descriptors and the headers from memory, bypassing the data cache */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, IfxCpu_isAddressCachable(stream) == FALSE);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((uint32)stream->descriptors & 0x1FU) == 0);
+
+    memset(stream, 0, sizeof(*stream));
+    stream->asc           = config->asc;
+    stream->blockFramed   = config->blockFramed;
+    stream->payloadLength = (uint32)config->blockSize * 3 / 2;
+
+    /* GTM clocks: the period must fit in the 16 bit TOM counter */
+    IfxGtm_enable(gtm);
+    IfxGtm_Cmu_setGclkFrequency(gtm, IfxGtm_Cmu_getModuleFrequency(gtm));
+    IfxGtm_Cmu_enableClocks(gtm, IFXGTM_CMU_CLKEN_FXCLK);
+
+    for (clock = IfxGtm_Cmu_Fxclk_0; clock <= IfxGtm_Cmu_Fxclk_4; clock++)
+    {
+        frequency = IfxGtm_Cmu_getFxClkFrequency(gtm, clock, TRUE);
+        period    = (uint32)(frequency / config->scanFrequency + 0.5);
+
+        if (period <= 0xFFFF)
+        {
+            break;
+        }
+    }
+
+    if ((clock > IfxGtm_Cmu_Fxclk_4) || (period < 100))
+    {
+        return FALSE;
+    }
+
+    stream->scanFrequency = frequency / period;
+
+    /* VADC group: one scan of the channels per falling edge of the trigger, into the FIFO input stage RES3 */
+    {
+        IfxVadc_Adc_GroupConfig adcGroupConfig;
+        IfxVadc_Adc_initGroupConfig(&adcGroupConfig, config->vadc);
+
+        adcGroupConfig.groupId                                 = config->groupId;
+        adcGroupConfig.master                                  = config->groupId;
+        adcGroupConfig.arbiter.requestSlotScanEnabled          = TRUE;
+        adcGroupConfig.scanRequest.autoscanEnabled             = FALSE;
+        adcGroupConfig.scanRequest.triggerConfig.triggerMode   = IfxVadc_TriggerMode_uponFallingEdge;
+        adcGroupConfig.scanRequest.triggerConfig.triggerSource = config->triggerInput;
+        adcGroupConfig.scanRequest.triggerConfig.gatingMode    = IfxVadc_GatingMode_always;
+
+        IfxVadc_Adc_initGroup(&stream->adcGroup, &adcGroupConfig);
+    }
+
+    {
+        IfxVadc_Adc_ChannelConfig adcChannelConfig;
+        IfxVadc_Adc_Channel       adcChannel;
+        uint32                    chnIx;
+
+        for (chnIx = 0; chnIx < 16; chnIx++)
+        {
+            if ((config->channels & (1U << chnIx)) != 0)
+            {
+                IfxVadc_Adc_initChannelConfig(&adcChannelConfig, &stream->adcGroup);
+
+                adcChannelConfig.channelId      = (IfxVadc_ChannelId)chnIx;
+                adcChannelConfig.resultRegister = IfxVadc_ChannelResult_3;
+
+                IfxVadc_Adc_initChannel(&adcChannel, &adcChannelConfig);
+            }
+        }
+    }
+
+    /* result stream: RES0..RES3 FIFO, read by the DMA into the double buffer */
+    {
+        IfxVadc_Adc_StreamConfig streamConfig;
+        IfxVadc_Adc_initStreamConfig(&streamConfig, &stream->adcGroup);
+
+        streamConfig.outputRegister    = IfxVadc_ChannelResult_0;
+        streamConfig.fifoSize          = 4;
+        streamConfig.dma               = config->dma;
+        streamConfig.dmaChannelId      = config->resultDmaChannelId;
+        streamConfig.buffer            = config->buffer;
+        streamConfig.blockSize         = config->blockSize;
+        streamConfig.blockPriority     = config->blockPriority;
+        streamConfig.blockServProvider = config->blockServProvider;
+
+        if (IfxVadc_Adc_initStream(&stream->adcStream, &streamConfig) != IfxVadc_Status_noError)
+        {
+            return FALSE;
+        }
+    }
+
+    /* frame of each half: header, then the packed samples and the CRC where the block was captured */
+    for (half = 0; half < 2; half++)
+    {
+        VadcAscStream_Header *header = &stream->header[half];
+
+        header->sync     = VADCASCSTREAM_SYNC;
+        header->channels = config->channels;
+        header->samples  = config->blockSize;
+
+        IfxAsclin_Asc_initDmaTxDescriptor(stream->asc, &stream->descriptors[half][0], header, sizeof(*header), &stream->descriptors[half][1]);
+        IfxAsclin_Asc_initDmaTxDescriptor(stream->asc, &stream->descriptors[half][1], &config->buffer[half * config->blockSize],
+            (Ifx_SizeT)(stream->payloadLength + VADCASCSTREAM_CRC_SIZE), NULL_PTR);
+    }
+
+    IfxVadc_Adc_setScan(&stream->adcGroup, config->channels, config->channels);
+
+    if (IfxGtm_Trig_toVadc(gtm, (IfxGtm_Trig_AdcGroup)config->groupId, IfxGtm_Trig_AdcTrig_0,
+            (config->triggerTom == IfxGtm_Tom_0) ? IfxGtm_Trig_AdcTrigSource_tom0 : IfxGtm_Trig_AdcTrigSource_tom1,
+            (IfxGtm_Trig_AdcTrigChannel)config->triggerChannel) == FALSE)
+    {
+        return FALSE;
+    }
+
+    /* trigger, the scans start with the first falling edge */
+    tom = &gtm->TOM[config->triggerTom];
+    tgc = IfxGtm_Tom_Ch_getTgcPointer(tom, config->triggerChannel / 8);
+
+    VadcAscStream_initTrigger(tom, tgc, config->triggerChannel, (IfxGtm_Tom_Ch_ClkSrc)clock, period);
+    IfxGtm_Tom_Tgc_trigger(tgc);
+
+    return TRUE;
+}
+
+
+void VadcAscStream_isrBlock(VadcAscStream *stream)
+{
+    Ifx_VADC_RES *block;
+
+    IfxVadc_Adc_isrStream(&stream->adcStream);
+
+    /* the block is framed in place, it is not written by the DMA before blockSize further conversions */
+    block = (Ifx_VADC_RES *)IfxVadc_Adc_getStreamBlock(&stream->adcStream);
+
+    if (block != NULL_PTR)
+    {
+        uint8                 half    = (block == stream->adcStream.buffer) ? 0 : 1;
+        VadcAscStream_Header *header  = &stream->header[half];
+        uint8                *payload = (uint8 *)block;
+        uint32                crc;
+
+        header->firstChannel = (uint8)block[0].B.CHNR;
+        header->sequence     = stream->sequence++;
+
+        VadcAscStream_pack(block, stream->adcStream.blockSize);
+
+        crc                                 = Ifx_Crc_crc32(IFX_CRC_CRC32_INIT, (const uint8 *)header, sizeof(*header));
+        crc                                 = Ifx_Crc_crc32(crc, payload, stream->payloadLength);
+        payload[stream->payloadLength]      = (uint8)crc;
+        payload[stream->payloadLength + 1U] = (uint8)(crc >> 8);
+        payload[stream->payloadLength + 2U] = (uint8)(crc >> 16);
+        payload[stream->payloadLength + 3U] = (uint8)(crc >> 24);
+
+        if (IfxAsclin_Asc_writeDma(stream->asc, &stream->descriptors[half][0]) != FALSE)
+        {
+            stream->frames++;
+        }
+        else
+        {
+            stream->dropped++;
+        }
+
+        if (stream->blockFramed != NULL_PTR)
+        {
+            stream->blockFramed(header, payload, stream->payloadLength);
+        }
+    }
+}
@@ -0,0 +1,161 @@
+/**
+ * \file VadcAscStream.h
+ * \brief VADC to ASCLIN streaming pipeline: DMA result blocks, in place framing, DMA transmission
+ *
+ * \version iLLD_Demos_1_0_0_11_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * Data logger path, the samples are never copied by the CPU:
+ * - scan: a TOM channel triggers the scan of the selected channels at scanFrequency through the GTM ADC trigger 0
+ *   of the group. The channels store into a 4 stage result FIFO.
+ * - capture: the VADC DMA result stream (IfxVadc_Adc_Stream) moves each result into one half of a double buffer
+ *   and raises the block ready interrupt every blockSize results.
+ * - framing: the block ready interrupt packs the 12-bit results in place, 3 bytes per 2 samples, and appends the
+ *   CRC-32 after them. The frame header is kept in a separate 8 byte buffer per half.
+ * - transmission: a chain of 2 ASC DMA descriptors (header, packed samples + CRC) sends the frame from where
+ *   it was captured (IfxAsclin_Asc_writeDma()). The ASC must be initialised with dma.useTxDma.
+ *
+ * The block ready interrupt is the only CPU involvement, it ends with the blockFramed callback. The frame of a half
+ * must be sent before the DMA stream writes this half again, i.e. within blockSize conversions: the baudrate shall be
+ * above 15 bit times per sample (3 / 2 bytes of 10 bits), e.g. 8 channels at 20 kHz: 2.4 Mbaud, 4 Mbaud with margin.
+ *
+ * Frame format, little endian:
+ * | Bytes          | Content                                                                           |
+ * |----------------|-----------------------------------------------------------------------------------|
+ * | 0              | VADCASCSTREAM_SYNC                                                                |
+ * | 1              | Channel of the first sample, the next ones follow the scan order of channels       |
+ * | 2..3           | Sequence counter, a gap indicates a lost frame                                    |
+ * | 4..5           | Channel mask                                                                      |
+ * | 6..7           | Number of samples n                                                               |
+ * | 8..8+3n/2-1    | Samples a, b: a[7:0], b[3:0] a[11:8], b[11:4]                                     |
+ * | 4 bytes        | CRC-32 IEEE 802.3 of the header and the samples                                   |
+ *
+ * \defgroup IfxLld_Demo_VadcAscStream_SrcDoc_Driver VADC to ASCLIN streaming
+ * \ingroup IfxLld_Demo_VadcAutoScanDemo_SrcDoc
+ */
+
+#ifndef VADCASCSTREAM_H
+#define VADCASCSTREAM_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include <Vadc/Std/IfxVadc.h>
+#include <Vadc/Adc/IfxVadc_Adc.h>
+#include <Asclin/Asc/IfxAsclin_Asc.h>
+#include <Gtm/Std/IfxGtm_Tom.h>
+#include <Gtm/Trig/IfxGtm_Trig.h>
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+#define VADCASCSTREAM_SYNC     (0xA5U)      /**< \brief First byte of a frame */
+#define VADCASCSTREAM_CRC_SIZE (4)          /**< \brief Size of the CRC appended to the samples */
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+/** \addtogroup IfxLld_Demo_VadcAscStream_SrcDoc_Driver
+ * \{ */
+
+/** \brief Frame header, 8 bytes
+ */
+typedef struct
+{
+    uint8  sync;                /**< \brief VADCASCSTREAM_SYNC */
+    uint8  firstChannel;        /**< \brief Channel of the first sample */
+    uint16 sequence;            /**< \brief Frame sequence counter */
+    uint16 channels;            /**< \brief Channel mask of the scan */
+    uint16 samples;             /**< \brief Number of samples in the frame */
+} VadcAscStream_Header;
+
+/** \brief Called from the block ready interrupt once the frame is framed and its transmission started
+ * \param header Frame header
+ * \param payload Packed samples followed by the CRC
+ * \param length Length of the packed samples in bytes, without the CRC
+ */
+typedef void (*VadcAscStream_BlockFramed)(const VadcAscStream_Header *header, const uint8 *payload, uint32 length);
+
+/** \brief Streaming pipeline handle, must not be located in a data cached segment and be aligned on 32 bytes
+ * (IFX_DMA_BUFFER, IFX_ALIGN(32))
+ */
+typedef struct
+{
+    Ifx_DMA_CH                descriptors[2][2];    /**< \brief ASC DMA descriptors of each half: header, payload. First member for the alignment */
+    VadcAscStream_Header      header[2];            /**< \brief Frame header of each half */
+    IfxVadc_Adc_Group         adcGroup;             /**< \brief VADC group scanning the channels */
+    IfxVadc_Adc_Stream        adcStream;            /**< \brief DMA result stream of the group */
+    IfxAsclin_Asc            *asc;                  /**< \brief ASC sending the frames */
+    VadcAscStream_BlockFramed blockFramed;          /**< \brief Callback of the block ready interrupt, or NULL_PTR */
+    uint32                    payloadLength;        /**< \brief Length of the packed samples of a block in bytes */
+    uint16                    sequence;             /**< \brief Sequence counter of the next frame */
+    float32                   scanFrequency;        /**< \brief Actual scan frequency in Hz */
+    volatile uint32           frames;               /**< \brief Number of frames sent */
+    volatile uint32           dropped;              /**< \brief Number of frames not sent, the previous frame was still being sent */
+} VadcAscStream;
+
+/** \brief Streaming pipeline configuration
+ */
+typedef struct
+{
+    IfxVadc_Adc              *vadc;                 /**< \brief Initialized VADC module handle */
+    IfxVadc_GroupId           groupId;              /**< \brief VADC group of the channels */
+    IfxVadc_TriggerSource     triggerInput;         /**< \brief Scan request trigger input connected to the GTM ADC trigger 0 of the group */
+    uint16                    channels;             /**< \brief Mask of the channels of the group to scan */
+    IfxGtm_Tom                triggerTom;           /**< \brief TOM of the trigger channel, TOM0 or TOM1 */
+    IfxGtm_Tom_Ch             triggerChannel;       /**< \brief TOM channel triggering the scan, also its GTM ADC trigger channel */
+    float32                   scanFrequency;        /**< \brief Scan frequency in Hz */
+    IfxDma_Dma               *dma;                  /**< \brief DMA module handle */
+    IfxDma_ChannelId          resultDmaChannelId;   /**< \brief DMA channel of the result stream, must not be the one of the ASC */
+    Ifx_VADC_RES             *buffer;               /**< \brief Double buffer of 2 * blockSize results, aligned to its size, not data cached */
+    uint16                    blockSize;            /**< \brief Number of samples per frame: power of 2, 2 .. 4096 */
+    Ifx_Priority              blockPriority;        /**< \brief Interrupt priority of the block ready interrupt (framing) */
+    IfxSrc_Tos                blockServProvider;    /**< \brief Interrupt service provider of the block ready interrupt */
+    IfxAsclin_Asc            *asc;                  /**< \brief ASC initialised with dma.useTxDma */
+    VadcAscStream_BlockFramed blockFramed;          /**< \brief Callback of the block ready interrupt, or NULL_PTR */
+} VadcAscStream_Config;
+
+/** \} */
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+/** \addtogroup IfxLld_Demo_VadcAscStream_SrcDoc_Driver
+ * \{ */
+
+/** \brief Initialize the configuration with default values: channels 0..7 of group 0 at 20 kHz, 256 samples per frame
+ * \param config Configuration structure
+ * \param vadc Initialized VADC module handle
+ */
+IFX_EXTERN void VadcAscStream_initConfig(VadcAscStream_Config *config, IfxVadc_Adc *vadc);
+
+/** \brief Initialize the VADC group, the result stream, the ASC descriptors and the trigger, then start the scans
+ * \param stream Pipeline handle
+ * \param config Configuration structure
+ * \return TRUE on success, FALSE if the configuration is not supported
+ */
+IFX_EXTERN boolean VadcAscStream_init(VadcAscStream *stream, const VadcAscStream_Config *config);
+
+/** \brief Frame and send the filled block, to be called from the interrupt of VadcAscStream_Config.blockPriority
+ * \param stream Pipeline handle
+ */
+IFX_EXTERN void VadcAscStream_isrBlock(VadcAscStream *stream);
+
+/** \} */
+
+#endif
@@ -0,0 +1,142 @@
+/**
+ * \file VadcAscStreamDemo.c
+ * \brief Demo VadcAscStreamDemo
+ *
+ * \version iLLD_Demos_1_0_0_11_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "VadcAscStreamDemo.h"
+#include "VadcAsclinAscDemo.h"
+
+#include <stdio.h>
+#include <Cpu/Std/IfxCpu.h>
+
+#if VADCAUTOASC_STREAM
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+App_VadcAscStream g_VadcAscStreamDemo; /**< \brief Demo information */
+
+/** \brief Pipeline handle, read by the DMA: not data cached, aligned for the descriptors */
+IFX_DMA_BUFFER IFX_ALIGN(32) VadcAscStream g_VadcAscStream;
+
+/** \brief Double buffer of the results, aligned to its size */
+IFX_DMA_BUFFER IFX_ALIGN(2 * STREAM_BLOCK_SIZE * 4) Ifx_VADC_RES g_VadcAscStreamBuffer[2 * STREAM_BLOCK_SIZE];
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+static void VadcAscStreamDemo_blockFramed(const VadcAscStream_Header *header, const uint8 *payload, uint32 length);
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+/** \addtogroup IfxLld_Demo_VadcAscStreamDemo_SrcDoc_Main_Interrupt
+ * \{ */
+
+/** \name Interrupt for the block ready (framing)
+ * \{ */
+
+IFX_INTERRUPT(adcStreamISR, 0, ISR_PRIORITY_ADC_STREAM)
+{
+    VadcAscStream_isrBlock(&g_VadcAscStream);
+}
+
+/** \} */
+
+/** \} */
+
+/** \brief Block framed callback, the only processing of the samples by the CPU
+ */
+static void VadcAscStreamDemo_blockFramed(const VadcAscStream_Header *header, const uint8 *payload, uint32 length)
+{
+    (void)header;
+    (void)payload;
+    (void)length;
+    g_VadcAscStreamDemo.framedBlocks++;
+}
+
+
+/** \brief Demo init API
+ *
+ * This function is called from main during initialization phase, after AsclinAscDemo_init()
+ */
+void VadcAscStreamDemo_init(void)
+{
+    /* VADC module */
+    {
+        IfxVadc_Adc_Config adcConfig;
+        IfxVadc_Adc_initModuleConfig(&adcConfig, &MODULE_VADC);
+        IfxVadc_Adc_initModule(&g_VadcAscStreamDemo.vadc, &adcConfig);
+    }
+
+    IfxDma_Dma_createModuleHandle(&g_VadcAscStreamDemo.dma, &MODULE_DMA);
+
+    /* pipeline */
+    {
+        VadcAscStream_Config config;
+        VadcAscStream_initConfig(&config, &g_VadcAscStreamDemo.vadc);
+
+        config.channels           = STREAM_CHANNELS;
+        config.scanFrequency      = STREAM_SCAN_FREQUENCY;
+        config.dma                = &g_VadcAscStreamDemo.dma;
+        config.resultDmaChannelId = DMA_CHANNEL_ADC_STREAM;
+        config.buffer             = g_VadcAscStreamBuffer;
+        config.blockSize          = STREAM_BLOCK_SIZE;
+        config.blockPriority      = ISR_PRIORITY_ADC_STREAM;
+        config.blockServProvider  = (IfxSrc_Tos)IfxCpu_getCoreIndex();
+        config.asc                = &g_AsclinAsc.drivers.asc;
+        config.blockFramed        = &VadcAscStreamDemo_blockFramed;
+
+        if (VadcAscStream_init(&g_VadcAscStream, &config) == FALSE)
+        {
+            printf("ERROR: VADC stream configuration not supported\n");
+            REGRESSION_RUN_STOP_FAIL;
+            return;
+        }
+    }
+
+    printf("VADC stream started: %u Hz scans, %u samples per frame\n", (unsigned)g_VadcAscStream.scanFrequency, STREAM_BLOCK_SIZE);
+}
+
+
+/** \brief Demo run API
+ *
+ * This function is called from main, background loop
+ */
+void VadcAscStreamDemo_run(void)
+{
+    uint32 frames = g_VadcAscStream.frames;
+
+    if (frames == g_VadcAscStreamDemo.lastFrames)
+    {
+        printf("ERROR: VADC stream stalled\n");
+    }
+
+    g_VadcAscStreamDemo.lastFrames = frames;
+    printf("VADC stream: %lu frames, %lu dropped, %lu overruns\n", frames, g_VadcAscStream.dropped, g_VadcAscStream.adcStream.overrunCount);
+}
+
+
+#endif
@@ -0,0 +1,63 @@
+/**
+ * \file VadcAscStreamDemo.h
+ * \brief Demo VadcAscStreamDemo
+ *
+ * \version iLLD_Demos_1_0_0_11_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * Field data logger variant of the demo, selected with VADCAUTOASC_STREAM: STREAM_CHANNELS of VADC group 0 are
+ * scanned at STREAM_SCAN_FREQUENCY and streamed over the ASC of the demo at STREAM_BAUDRATE, see VadcAscStream.h.
+ *
+ * \defgroup IfxLld_Demo_VadcAscStreamDemo_SrcDoc_Main Demo Source
+ * \ingroup IfxLld_Demo_VadcAutoScanDemo_SrcDoc
+ * \defgroup IfxLld_Demo_VadcAscStreamDemo_SrcDoc_Main_Interrupt Interrupts
+ * \ingroup IfxLld_Demo_VadcAscStreamDemo_SrcDoc_Main
+ */
+
+#ifndef VADCASCSTREAMDEMO_H
+#define VADCASCSTREAMDEMO_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "Configuration.h"
+#include "VadcAscStream.h"
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+typedef struct
+{
+    IfxVadc_Adc vadc;               /**< \brief VADC handle */
+    IfxDma_Dma  dma;                /**< \brief DMA handle */
+    uint32      framedBlocks;       /**< \brief Blocks framed, counted by the callback */
+    uint32      lastFrames;         /**< \brief Frames sent at the previous run */
+} App_VadcAscStream;
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+IFX_EXTERN App_VadcAscStream g_VadcAscStreamDemo;
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+IFX_EXTERN void VadcAscStreamDemo_init(void);
+IFX_EXTERN void VadcAscStreamDemo_run(void);
+
+#endif
@@ -67,7 +67,11 @@ App_AsclinAsc g_AsclinAsc; /**< \brief Demo information */
 
 IFX_INTERRUPT(asclin0TxISR, 0, ISR_PRIORITY_ASC_0_TX)
 {
+#if VADCAUTOASC_STREAM
+    IfxAsclin_Asc_isrDmaTransmit(&g_AsclinAsc.drivers.asc);
+#else
     IfxAsclin_Asc_isrTransmit(&g_AsclinAsc.drivers.asc);
+#endif
 }
 
 /** \} */
@@ -102,7 +106,11 @@ IFX_INTERRUPT(asclin0ErISR, 0, ISR_PRIORITY_ASC_0_EX)
 
 IFX_INTERRUPT(asclin3TxISR, 0, ISR_PRIORITY_ASC_3_TX)
 {
+#if VADCAUTOASC_STREAM
+    IfxAsclin_Asc_isrDmaTransmit(&g_AsclinAsc.drivers.asc);
+#else
     IfxAsclin_Asc_isrTransmit(&g_AsclinAsc.drivers.asc);
+#endif
 }
 
 /** \} */
@@ -148,7 +156,11 @@ void AsclinAscDemo_init(void)
 #endif
     /* set the desired baudrate */
     ascConfig.baudrate.prescaler    = 1;
+#if VADCAUTOASC_STREAM
+    ascConfig.baudrate.baudrate     = STREAM_BAUDRATE; /* FDR values will be calculated in initModule */
+#else
     ascConfig.baudrate.baudrate     = 115200; /* FDR values will be calculated in initModule */
+#endif
     ascConfig.baudrate.oversampling = IfxAsclin_OversamplingFactor_4;
 #if BOARD == APPLICATION_KIT_TC237
     /* ISR priorities and interrupt target */
@@ -162,6 +174,12 @@ void AsclinAscDemo_init(void)
 #endif
     ascConfig.interrupt.typeOfService = (IfxSrc_Tos)IfxCpu_getCoreIndex();
 
+#if VADCAUTOASC_STREAM
+    /* transmission by DMA, the transmit interrupt is raised by the DMA channel at the end of a frame */
+    ascConfig.dma.useTxDma       = TRUE;
+    ascConfig.dma.txDmaChannelId = DMA_CHANNEL_ASC_TX;
+#endif
+
 
     /* FIFO configuration */
     ascConfig.txBuffer     = g_AsclinAsc.ascBuffer.tx;
@@ -29,6 +29,7 @@
 
 #include "VadcAsclinAscDemo.h"
 #include "VadcAutoAscDemo.h"
+#include "VadcAscStreamDemo.h"
 #include "SysSe/Bsp/Bsp.h"
 
 /******************************************************************************/
@@ -76,6 +77,19 @@ int core0_main(void)
 
     /* Demo init */
     AsclinAscDemo_init();
+#if VADCAUTOASC_STREAM
+    VadcAscStreamDemo_init();
+
+    initTime(); // Initialize time constants
+
+    /* background endless loop: the samples are streamed by DMA */
+    while (TRUE)
+    {
+        VadcAscStreamDemo_run();
+
+        wait(TimeConst_1s);
+    }
+#else
     VadcAutoScanDemo_init();
 
     initTime(); // Initialize time constants
@@ -96,6 +110,7 @@ int core0_main(void)
 
         wait(TimeConst_1ms);
     }
+#endif
 
     return 0;
 }
@@ -53,6 +53,7 @@
  */
 #define ISR_PRIORITY_PRINTF_ASC0_TX 5   /**< \brief Define the ASC0 transmit interrupt priority used by printf.c */
 #define ISR_PRIORITY_PRINTF_ASC0_EX 6   /**< \brief Define the ASC0 error interrupt priority used by printf.c */
+#define ISR_PRIORITY_ADC_STREAM     10  /**< \brief Define the VADC stream block ready interrupt priority */
 
 /** \} */
 
@@ -61,6 +62,7 @@
  * \{ */
 #define ISR_PROVIDER_PRINTF_ASC0_TX IfxSrc_Tos_cpu0             /**< \brief Define the ASC0 transmit interrupt provider used by printf.c   */
 #define ISR_PROVIDER_PRINTF_ASC0_EX IfxSrc_Tos_cpu0             /**< \brief Define the ASC0 error interrupt provider used by printf.c */
+#define ISR_PROVIDER_ADC_STREAM     IfxSrc_Tos_cpu0             /**< \brief Define the VADC stream block ready interrupt provider */
 /** \} */
 
 /**
@@ -71,6 +73,13 @@
 
 /** \} */
 
+/**
+ * \name DMA channel configuration.
+ * The DMA channel is also the priority of the service request routed to the DMA, range [1,63]
+ * \{ */
+#define DMA_CHANNEL_ADC_STREAM      IfxDma_ChannelId_1          /**< \brief Define the DMA channel moving the VADC results */
+/** \} */
+
 /** \} */
 //------------------------------------------------------------------------------
 
@@ -27,6 +27,7 @@
 
 #include <stdio.h>
 #include "VadcAutoScanDemo.h"
+#include "ConfigurationIsr.h"
 #include <Cpu/Std/IfxCpu.h>
 /******************************************************************************/
 /*-----------------------------------Macros-----------------------------------*/
@@ -45,7 +46,10 @@
 /******************************************************************************/
 App_VadcAutoScan g_VadcAutoScan; /**< \brief Demo information */
 
-IfxVadc_Adc_Channel       adcChannel[4];
+IfxVadc_Adc_Channel       adcChannel[VADCAUTOSCAN_CHANNELS];
+
+/* double buffer filled by the DMA, aligned to its size. Must be located in a non cached memory (DSPR) */
+IFX_ALIGN(2 * VADCAUTOSCAN_BLOCK_SIZE * 4) Ifx_VADC_RES g_VadcAutoScanBuffer[2 * VADCAUTOSCAN_BLOCK_SIZE];
 
 /******************************************************************************/
 /*-------------------------Function Prototypes--------------------------------*/
@@ -58,6 +62,52 @@ IfxVadc_Adc_Channel       adcChannel[4];
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
+/** \addtogroup IfxLld_Demo_VadcAutoScanDemo_SrcDoc_Main_Interrupt
+ * \{ */
+
+/** \name Interrupts for the VADC result stream.
+ * \{ */
+IFX_INTERRUPT(VadcAutoScanDemo_streamIsr, 0, ISR_PRIORITY_ADC_STREAM);
+/** \} */
+
+/** \} */
+
+/** \brief Handle the block ready interrupt of the result stream
+ *
+ * Each block is passed to the decimation filter of its channels, the CPU is interrupted once per
+ * block and the application only reads the decimated results.
+ *
+ * \isrProvider \ref ISR_PROVIDER_ADC_STREAM
+ * \isrPriority \ref ISR_PRIORITY_ADC_STREAM
+ *
+ */
+void VadcAutoScanDemo_streamIsr(void)
+{
+    const Ifx_VADC_RES *block;
+
+    IfxVadc_Adc_isrStream(&g_VadcAutoScan.stream);
+
+    block = IfxVadc_Adc_getStreamBlock(&g_VadcAutoScan.stream);
+
+    if (block != NULL_PTR)
+    {
+        uint32 i;
+        uint32 chnIx;
+        uint32 output;
+
+        for (i = 0; i < VADCAUTOSCAN_BLOCK_SIZE; ++i)
+        {
+            chnIx = block[i].B.CHNR;
+
+            if ((chnIx < VADCAUTOSCAN_CHANNELS) && Ifx_Cic_do(&g_VadcAutoScan.cic[chnIx], block[i].B.RESULT, &output))
+            {
+                g_VadcAutoScan.decimated[chnIx] = output;
+                g_VadcAutoScan.decimatedCount[chnIx]++;
+            }
+        }
+    }
+}
+
 
 /** \brief Demo init API
  *
@@ -96,15 +146,25 @@ void VadcAutoScanDemo_init(void)
     IfxVadc_Adc_initGroup(&g_VadcAutoScan.adcGroup, &adcGroupConfig);
 
     uint32                    chnIx;
+    /* decimation filter of each channel */
+    Ifx_Cic_Config            cicConfig;
+    cicConfig.order = VADCAUTOSCAN_CIC_ORDER;
+    cicConfig.ratio = VADCAUTOSCAN_CIC_RATIO;
+
+    for (chnIx = 0; chnIx < VADCAUTOSCAN_CHANNELS; ++chnIx)
+    {
+        Ifx_Cic_init(&g_VadcAutoScan.cic[chnIx], &cicConfig);
+    }
+
     /* create channel config */
-    IfxVadc_Adc_ChannelConfig adcChannelConfig[4];
+    IfxVadc_Adc_ChannelConfig adcChannelConfig[VADCAUTOSCAN_CHANNELS];
 
-    for (chnIx = 0; chnIx < 4; ++chnIx)
+    for (chnIx = 0; chnIx < VADCAUTOSCAN_CHANNELS; ++chnIx)
     {
         IfxVadc_Adc_initChannelConfig(&adcChannelConfig[chnIx], &g_VadcAutoScan.adcGroup);
 
         adcChannelConfig[chnIx].channelId      = (IfxVadc_ChannelId)(chnIx);
-        adcChannelConfig[chnIx].resultRegister = (IfxVadc_ChannelResult)(chnIx);  /* use dedicated result register */
+        adcChannelConfig[chnIx].resultRegister = IfxVadc_ChannelResult_3;  /* input stage of the FIFO RES3..RES0 */
 
         /* initialize the channel */
         IfxVadc_Adc_initChannel(&adcChannel[chnIx], &adcChannelConfig[chnIx]);
@@ -115,6 +175,23 @@ void VadcAutoScanDemo_init(void)
         IfxVadc_Adc_setScan(&g_VadcAutoScan.adcGroup, channels, mask);
     }
 
+    /* stream the results with the DMA: RES0 is read by the DMA, one interrupt per block */
+    IfxDma_Dma_createModuleHandle(&g_VadcAutoScan.dma, &MODULE_DMA);
+
+    IfxVadc_Adc_StreamConfig streamConfig;
+    IfxVadc_Adc_initStreamConfig(&streamConfig, &g_VadcAutoScan.adcGroup);
+
+    streamConfig.outputRegister    = IfxVadc_ChannelResult_0;
+    streamConfig.fifoSize          = 4;
+    streamConfig.dma               = &g_VadcAutoScan.dma;
+    streamConfig.dmaChannelId      = DMA_CHANNEL_ADC_STREAM;
+    streamConfig.buffer            = g_VadcAutoScanBuffer;
+    streamConfig.blockSize         = VADCAUTOSCAN_BLOCK_SIZE;
+    streamConfig.blockPriority     = ISR_PRIORITY_ADC_STREAM;
+    streamConfig.blockServProvider = ISR_PROVIDER_ADC_STREAM;
+
+    IfxVadc_Adc_initStream(&g_VadcAutoScan.stream, &streamConfig);
+
     /* start autoscan */
     IfxVadc_Adc_startScan(&g_VadcAutoScan.adcGroup);
 
@@ -124,31 +201,20 @@ void VadcAutoScanDemo_init(void)
 /** \brief Demo run API
  *
  * This function is called from main, background loop
+ * The last decimated result of each channel is printed. The blocks are filtered in the stream
+ * interrupt, printf does not cause any overrun.
  */
 void VadcAutoScanDemo_run(void)
 {
-//    printf("VadcAutoScanDemo_run() called\n");
+    uint32 chnIx;
 
-    uint32                    chnIx;
+    for (chnIx = 0; chnIx < VADCAUTOSCAN_CHANNELS; ++chnIx)
+    {
+        if (g_VadcAutoScan.decimatedCount[chnIx] > 0)
+        {
+            printf("Group %d Channel %d : %lu (%lu decimated results)\n", g_VadcAutoScan.adcGroup.groupId, adcChannel[chnIx].channel, g_VadcAutoScan.decimated[chnIx], g_VadcAutoScan.decimatedCount[chnIx]);
+        }
+    }
 
-	/* check results */
-	for (chnIx = 0; chnIx < 4; ++chnIx)
-	{
-		volatile unsigned     group   = adcChannel[chnIx].group->groupId;
-		volatile unsigned     channel = adcChannel[chnIx].channel;
-
-		/* wait for valid result */
-		Ifx_VADC_RES conversionResult;
-
-		do
-		{
-			conversionResult = IfxVadc_Adc_getResult(&adcChannel[chnIx]);
-		} while (!conversionResult.B.VF);
-
-		volatile uint32 actual = conversionResult.B.RESULT;
-		/* print result, check with expected value */
-		{
-			printf("Group %d Channel %d : %u\n", group, channel, actual);
-		}
-	}
+    printf("blocks %lu, overrun %lu\n", g_VadcAutoScan.stream.blockCount, g_VadcAutoScan.stream.overrunCount);
 }
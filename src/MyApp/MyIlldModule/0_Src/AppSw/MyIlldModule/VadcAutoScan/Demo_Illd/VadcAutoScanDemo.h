@@ -34,10 +34,15 @@
 /******************************************************************************/
 #include <Vadc/Std/IfxVadc.h>
 #include <Vadc/Adc/IfxVadc_Adc.h>
+#include "SysSe/Math/Ifx_Cic.h"
 
 /******************************************************************************/
 /*-----------------------------------Macros-----------------------------------*/
 /******************************************************************************/
+#define VADCAUTOSCAN_CHANNELS   (4)     /**< \brief Number of scanned channels */
+#define VADCAUTOSCAN_BLOCK_SIZE (256)   /**< \brief Number of results per stream block */
+#define VADCAUTOSCAN_CIC_ORDER  (2)     /**< \brief Order of the decimation filter */
+#define VADCAUTOSCAN_CIC_RATIO  (64)    /**< \brief Decimation ratio, number of results per decimated result */
 
 /******************************************************************************/
 /*--------------------------------Enumerations--------------------------------*/
@@ -50,6 +55,11 @@ typedef struct
 {
     IfxVadc_Adc vadc; /* VADC handle */
     IfxVadc_Adc_Group adcGroup;
+    IfxDma_Dma dma; /* DMA handle */
+    IfxVadc_Adc_Stream stream; /* results moved by the DMA */
+    Ifx_Cic cic[VADCAUTOSCAN_CHANNELS]; /* decimation filter of each channel */
+    volatile uint32 decimated[VADCAUTOSCAN_CHANNELS]; /* last decimated result of each channel */
+    volatile uint32 decimatedCount[VADCAUTOSCAN_CHANNELS]; /* number of decimated results of each channel */
 } App_VadcAutoScan;
 
 /******************************************************************************/
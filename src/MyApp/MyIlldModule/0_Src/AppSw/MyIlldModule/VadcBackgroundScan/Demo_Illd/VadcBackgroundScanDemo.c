@@ -152,6 +152,10 @@ void VadcBackgroundScanDemo_init(void)
 //		adcChannelConfig[chnIx].resultRegister    = (IfxVadc_ChannelResult)(4 + chnIx); // use register #0 and 1 for results
 		adcChannelConfig[chnIx].backgroundChannel = TRUE;
 
+		/* the result register accumulates the conversions, the result is valid after the last one */
+		adcChannelConfig[chnIx].dataModificationMode = IfxVadc_DataModificationMode_standardDataReduction;
+		adcChannelConfig[chnIx].dataReductionControl = VADCBACKGROUNDSCAN_ACCUMULATION - 1;
+
 		/* initialize the channel */
 		IfxVadc_Adc_initChannel(&adcChannel[chnIx], &adcChannelConfig[chnIx]);
 
@@ -196,10 +200,10 @@ void VadcBackgroundScanDemo_run(void)
 
 		/* print result, check with expected value */
 		{
-			uint32 actual = conversionResult.B.RESULT;
+			uint32 actual = conversionResult.B.RESULT / VADCBACKGROUNDSCAN_ACCUMULATION;
 
 			/* FIXME result verification pending ?? */
-			printf("Group %d Channel %d : %u\n", group, channel, actual);
+			printf("Group %d Channel %d : %lu\n", group, channel, actual);
 		}
 	}
 
@@ -39,6 +39,7 @@
 /******************************************************************************/
 /*-----------------------------------Macros-----------------------------------*/
 /******************************************************************************/
+#define VADCBACKGROUNDSCAN_ACCUMULATION (16)    /**< \brief Number of conversions accumulated by the result register (1 to 16) */
 
 /******************************************************************************/
 /*--------------------------------Enumerations--------------------------------*/
@@ -0,0 +1,229 @@
+/**
+ * \file VadcSyncScanDemo.c
+ * \brief Demo VadcSyncScanDemo
+ *
+ * \version iLLD_Demos_1_0_0_11_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include <stdio.h>
+#include "VadcSyncScanDemo.h"
+#include "ConfigurationIsr.h"
+#include <Cpu/Std/IfxCpu.h>
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+App_VadcSyncScan g_VadcSyncScan; /**< \brief Demo information */
+
+IfxVadc_Adc_Channel adcChannel[VADCSYNCSCAN_GROUPS][VADCSYNCSCAN_CHANNELS];
+
+/* DMA transaction sets (one per group) and frame. Must be located in a non cached memory (DSPR) */
+IFX_ALIGN(32) Ifx_DMA_CH g_VadcSyncScanLinkedList[VADCSYNCSCAN_GROUPS];
+Ifx_VADC_RES             g_VadcSyncScanFrame[VADCSYNCSCAN_GROUPS * VADCSYNCSCAN_CHANNELS];
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+/** \addtogroup IfxLld_Demo_VadcSyncScanDemo_SrcDoc_Main_Interrupt
+ * \{ */
+
+/** \name Interrupts for the VADC synchronized scan.
+ * \{ */
+IFX_INTERRUPT(VadcSyncScanDemo_frameIsr, 0, ISR_PRIORITY_ADC_FRAME);
+/** \} */
+
+/** \} */
+
+/** \brief Handle the frame interrupt of the synchronized scan, once per PWM period
+ *
+ * \isrProvider \ref ISR_PROVIDER_ADC_FRAME
+ * \isrPriority \ref ISR_PRIORITY_ADC_FRAME
+ *
+ */
+void VadcSyncScanDemo_frameIsr(void)
+{
+    IfxVadc_Adc_isrSyncScan(&g_VadcSyncScan.syncScan);
+}
+
+
+/** \brief Start the PWM of TOM0 channel 7 and route it to the trigger of the master group */
+static void VadcSyncScanDemo_initPwm(void)
+{
+    Ifx_GTM *gtm = &MODULE_GTM;
+
+    IfxGtm_enable(gtm);
+    IfxGtm_Cmu_setGclkFrequency(gtm, IfxGtm_Cmu_getModuleFrequency(gtm));
+    IfxGtm_Cmu_enableClocks(gtm, IFXGTM_CMU_CLKEN_FXCLK);
+
+    IfxGtm_Tom_Pwm_Config pwmConfig;
+    IfxGtm_Tom_Pwm_initConfig(&pwmConfig, gtm);
+
+    pwmConfig.tom        = IfxGtm_Tom_0;
+    pwmConfig.tomChannel = IfxGtm_Tom_Ch_7;
+    pwmConfig.clock      = IfxGtm_Tom_Ch_ClkSrc_cmuFxclk0;
+    pwmConfig.period     = (uint32)(IfxGtm_Cmu_getFxClkFrequency(gtm, IfxGtm_Cmu_Fxclk_0, TRUE) / VADCSYNCSCAN_PWM_FREQUENCY);
+    pwmConfig.dutyCycle  = pwmConfig.period / 2;
+
+    /* the rising edge of the PWM triggers the scan of the master group */
+    IfxGtm_Trig_toVadc(gtm, IfxGtm_Trig_AdcGroup_0, IfxGtm_Trig_AdcTrig_0, IfxGtm_Trig_AdcTrigSource_tom0, IfxGtm_Trig_AdcTrigChannel_7);
+
+    IfxGtm_Tom_Pwm_init(&g_VadcSyncScan.pwm, &pwmConfig);
+}
+
+
+/** \brief Demo init API
+ *
+ * This function is called from main during initialization phase
+ */
+void VadcSyncScanDemo_init(void)
+{
+    /* VADC Configuration */
+
+    /* create configuration */
+    IfxVadc_Adc_Config adcConfig;
+    IfxVadc_Adc_initModuleConfig(&adcConfig, &MODULE_VADC);
+
+    /* initialize module */
+    IfxVadc_Adc_initModule(&g_VadcSyncScan.vadc, &adcConfig);
+
+    /* create group config */
+    IfxVadc_Adc_GroupConfig adcGroupConfig;
+    sint32                  grpIx;
+    uint32                  chnIx;
+
+    /* slaves first: the master turns the converters on */
+    for (grpIx = VADCSYNCSCAN_GROUPS - 1; grpIx >= 0; --grpIx)
+    {
+        IfxVadc_Adc_initGroupConfig(&adcGroupConfig, &g_VadcSyncScan.vadc);
+
+        adcGroupConfig.groupId = (IfxVadc_GroupId)grpIx;
+        adcGroupConfig.master  = IfxVadc_GroupId_0;
+
+        if (grpIx == 0)
+        {
+            /* enable scan source, one scan per rising edge of the trigger input */
+            adcGroupConfig.arbiter.requestSlotScanEnabled          = TRUE;
+            adcGroupConfig.scanRequest.autoscanEnabled             = FALSE;
+            adcGroupConfig.scanRequest.triggerConfig.triggerMode   = IfxVadc_TriggerMode_uponRisingEdge;
+            adcGroupConfig.scanRequest.triggerConfig.triggerSource = VADCSYNCSCAN_TRIGGER_INPUT;
+            adcGroupConfig.scanRequest.triggerConfig.gatingMode    = IfxVadc_GatingMode_always;
+        }
+
+        /* initialize the group */
+        IfxVadc_Adc_initGroup(&g_VadcSyncScan.adcGroup[grpIx], &adcGroupConfig);
+
+        /* create channel config */
+        IfxVadc_Adc_ChannelConfig adcChannelConfig;
+
+        for (chnIx = 0; chnIx < VADCSYNCSCAN_CHANNELS; ++chnIx)
+        {
+            IfxVadc_Adc_initChannelConfig(&adcChannelConfig, &g_VadcSyncScan.adcGroup[grpIx]);
+
+            adcChannelConfig.channelId      = (IfxVadc_ChannelId)(chnIx);
+            adcChannelConfig.resultRegister = (IfxVadc_ChannelResult)(chnIx);
+            adcChannelConfig.synchonize     = (grpIx == 0) ? TRUE : FALSE; /* the master channel starts the slave channels */
+
+            /* initialize the channel */
+            IfxVadc_Adc_initChannel(&adcChannel[grpIx][chnIx], &adcChannelConfig);
+        }
+    }
+
+    /* add to scan */
+    unsigned channels = (1 << VADCSYNCSCAN_CHANNELS) - 1;
+    unsigned mask     = channels;
+    IfxVadc_Adc_setScan(&g_VadcSyncScan.adcGroup[0], channels, mask);
+
+    /* copy the results of all groups with the DMA, one interrupt per PWM period */
+    IfxDma_Dma_createModuleHandle(&g_VadcSyncScan.dma, &MODULE_DMA);
+
+    IfxVadc_Adc_SyncScanConfig syncConfig;
+    IfxVadc_Adc_initSyncScanConfig(&syncConfig, &g_VadcSyncScan.adcGroup[0]);
+
+    for (grpIx = 1; grpIx < VADCSYNCSCAN_GROUPS; ++grpIx)
+    {
+        syncConfig.slaves[grpIx - 1] = &g_VadcSyncScan.adcGroup[grpIx];
+    }
+
+    syncConfig.slaveCount         = VADCSYNCSCAN_GROUPS - 1;
+    syncConfig.resultCount        = VADCSYNCSCAN_CHANNELS;
+    syncConfig.lastResultRegister = IfxVadc_ChannelResult_0; /* the scan converts the channel 0 last */
+    syncConfig.dma                = &g_VadcSyncScan.dma;
+    syncConfig.dmaChannelId       = DMA_CHANNEL_ADC_FRAME;
+    syncConfig.linkedList         = g_VadcSyncScanLinkedList;
+    syncConfig.buffer             = g_VadcSyncScanFrame;
+    syncConfig.framePriority      = ISR_PRIORITY_ADC_FRAME;
+    syncConfig.frameServProvider  = ISR_PROVIDER_ADC_FRAME;
+
+    IfxVadc_Adc_initSyncScan(&g_VadcSyncScan.syncScan, &syncConfig);
+
+    /* start the trigger */
+    VadcSyncScanDemo_initPwm();
+}
+
+
+/** \brief Demo run API
+ *
+ * This function is called from main, background loop
+ * The last frame is printed. printf is slower than the PWM: the frames copied while printing are
+ * counted as overrun.
+ */
+void VadcSyncScanDemo_run(void)
+{
+    const Ifx_VADC_RES *frame = IfxVadc_Adc_getSyncScanFrame(&g_VadcSyncScan.syncScan);
+
+    if (frame != NULL_PTR)
+    {
+        uint32 grpIx;
+        uint32 chnIx;
+
+        for (grpIx = 0; grpIx < VADCSYNCSCAN_GROUPS; ++grpIx)
+        {
+            for (chnIx = 0; chnIx < VADCSYNCSCAN_CHANNELS; ++chnIx)
+            {
+                Ifx_VADC_RES result = frame[grpIx * VADCSYNCSCAN_CHANNELS + chnIx];
+                printf("Group %d Channel %d : %u\n", g_VadcSyncScan.adcGroup[grpIx].groupId, result.B.CHNR, result.B.RESULT);
+            }
+        }
+
+        printf("frames %lu, overrun %lu\n", g_VadcSyncScan.syncScan.frameCount, g_VadcSyncScan.syncScan.overrunCount);
+    }
+}
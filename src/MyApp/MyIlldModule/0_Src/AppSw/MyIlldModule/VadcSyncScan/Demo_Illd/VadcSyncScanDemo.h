@@ -0,0 +1,79 @@
+/**
+ * \file VadcSyncScanDemo.h
+ * \brief Demo VadcSyncScanDemo
+ *
+ * \version iLLD_Demos_1_0_0_11_0
+ * \copyright Copyright (c) 2014 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * The groups 0 (master), 1 and 2 convert the channels 0 and 1 at the same instant, at each rising edge of a
+ * PWM generated by TOM0 channel 7. The DMA copies the results of the three groups into one frame, the CPU is
+ * interrupted once per PWM period.
+ *
+ * \defgroup IfxLld_Demo_VadcSyncScanDemo_SrcDoc_Main Demo Source
+ * \ingroup IfxLld_Demo_VadcSyncScanDemo_SrcDoc
+ * \defgroup IfxLld_Demo_VadcSyncScanDemo_SrcDoc_Main_Interrupt Interrupts
+ * \ingroup IfxLld_Demo_VadcSyncScanDemo_SrcDoc_Main
+ */
+
+#ifndef VADCSYNCSCANDEMO_H
+#define VADCSYNCSCANDEMO_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include <Vadc/Std/IfxVadc.h>
+#include <Vadc/Adc/IfxVadc_Adc.h>
+#include <Gtm/Tom/Pwm/IfxGtm_Tom_Pwm.h>
+#include <Gtm/Trig/IfxGtm_Trig.h>
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+#define VADCSYNCSCAN_GROUPS        (3)                       /**< \brief Number of synchronized groups, master included */
+#define VADCSYNCSCAN_CHANNELS      (2)                       /**< \brief Number of channels converted per group */
+#define VADCSYNCSCAN_PWM_FREQUENCY (20000)                   /**< \brief PWM and sampling frequency in Hz */
+#define VADCSYNCSCAN_TRIGGER_INPUT IfxVadc_TriggerSource_2   /**< \brief Master request trigger input connected to the GTM ADC0 trigger 0 (REQTR0C) */
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+typedef struct
+{
+    IfxVadc_Adc vadc; /* VADC handle */
+    IfxVadc_Adc_Group adcGroup[VADCSYNCSCAN_GROUPS]; /* [0]: master */
+    IfxDma_Dma dma; /* DMA handle */
+    IfxVadc_Adc_SyncScan syncScan; /* results of all groups copied by the DMA */
+    IfxGtm_Tom_Pwm_Driver pwm; /* conversion trigger */
+} App_VadcSyncScan;
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+IFX_EXTERN App_VadcSyncScan g_VadcSyncScan;
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+IFX_EXTERN void VadcSyncScanDemo_init(void);
+IFX_EXTERN void VadcSyncScanDemo_run(void);
+
+#endif
@@ -13,8 +13,11 @@
 #include "Perf_Meas.h"
 #include <Gtm/Tom/Timer/IfxGtm_Tom_Timer.h>
 #include <IfxCpu.h>
+#include <Stm/Std/IfxStm.h>
+#include <Scu/Std/IfxScuCcu.h>
 #include "Cpu0_Main.h"
 #include "conio_cfg.h"
+#include "SysSe/General/Ifx_Format.h"
 
 
 /******************************************************************************/
@@ -25,6 +28,25 @@
 /*-----------------------------------Macros-----------------------------------*/
 /******************************************************************************/
 
+
+/******************************************************************************/
+/*------------------------------Type Definitions------------------------------*/
+/******************************************************************************/
+
+// busy cycle accounting of one cpu, only accessed by this cpu
+typedef struct{
+    boolean idle;                           // TRUE between perf_meas_idle_enter and perf_meas_idle_exit
+    uint32 busy_start;                      // CCNT at the last idle exit or update
+    uint32 busy_cycles;                     // busy cycles of the current slot
+    uint32 slot_start;                      // STM0 lower value at the start of the current slot
+    uint32 slot_ticks;                      // STM0 ticks of one slot
+    uint32 slot_cycles;                     // cpu cycles of one slot
+    uint32 slot_index;                      // index of the current slot
+    uint32 slot_busy[PERF_LOAD_SLOTS];      // busy cycles of the last closed slots
+    uint32 window_busy;                     // sum of slot_busy
+    CpuLoad_t *load;                        // published load of this cpu
+}PerfLoad_t;
+
 /******************************************************************************/
 /*------------------------Private Variables/Constants-------------------------*/
 /******************************************************************************/
@@ -44,9 +66,8 @@
     #pragma section DATA ".data_cpu2" ".bss_cpu2" far-absolute RW
     #endif
 
-volatile uint32 cpu2_idle_counter;
-volatile uint32 cpu2_last_count_value;
-volatile uint32 cpu2_ccnt_diff_min;
+PerfLoad_t perf_load2;
+Ifx_Profiler perf_profiler2;
 
 #endif
 
@@ -63,9 +84,8 @@ volatile uint32 cpu2_ccnt_diff_min;
     #pragma section DATA ".data_cpu1" ".bss_cpu1" far-absolute RW
     #endif
 
-volatile uint32 cpu1_idle_counter;
-volatile uint32 cpu1_last_count_value;
-volatile uint32 cpu1_ccnt_diff_min;
+PerfLoad_t perf_load1;
+Ifx_Profiler perf_profiler1;
 
 #endif
 
@@ -81,9 +101,10 @@ volatile uint32 cpu1_ccnt_diff_min;
 #pragma section DATA ".data_cpu0" ".bss_cpu0" far-absolute RW
 #endif
 
-volatile uint32 cpu0_idle_counter;
-volatile uint32 cpu0_last_count_value;
-volatile uint32 cpu0_ccnt_diff_min;
+PerfLoad_t perf_load0;
+Ifx_Profiler perf_profiler0;
+// set by ISR_perf_meas_call, cleared by perf_meas_display
+volatile boolean perf_display_pending;
 
 CpuLoad_t CpuLoad0;
 #if IFXCPU_NUM_MODULES > 1
@@ -106,9 +127,6 @@ CpuLoad_t CpuLoad2;
 
 /* this is defined in Cpu0_Main.h */
 extern volatile boolean tft_ready;
-extern App_Cpu g_AppCpu0; /* CPU 0 global data */
-extern App_Cpu g_AppCpu1; /* CPU 1 global data if available */
-extern App_Cpu g_AppCpu2; /* CPU 2 global data if available */
 
 
 /******************************************************************************/
@@ -121,23 +139,8 @@ extern App_Cpu g_AppCpu2; /* CPU 2 global data if available */
 
 void perf_meas_init(void)
 {
-    // set the start values
-#if IFXCPU_NUM_MODULES > 2
-    cpu2_idle_counter = 0;
-    cpu2_last_count_value = 0;
-    // we set the cpu2_ccnt difference to maximum value
-    cpu2_ccnt_diff_min = 0xFFFFFFFF;
-#endif
-#if IFXCPU_NUM_MODULES > 1
-    cpu1_idle_counter = 0;
-    cpu1_last_count_value = 0;
-    // we set the cpu1_ccnt difference to maximum value
-    cpu1_ccnt_diff_min = 0xFFFFFFFF;
-#endif
-    cpu0_idle_counter = 0;
-    cpu0_last_count_value = 0;
-    // we set the cpu0_ccnt difference to maximum value
-    cpu0_ccnt_diff_min = 0xFFFFFFFF;
+    // the profiler of cpu0, the other cpus call perf_meas_profiler_init on their own
+    perf_meas_profiler_init();
     // if the CDC is not enabled, then we enable it to use the performance counter
     // performance counter will be switched on in main...
     if (!(__mfcr(CPU_DBGSR) & 0x1))
@@ -155,101 +158,293 @@ void perf_meas_init(void)
     driverConfig.tom = PERFORMANCE_MEASURE.tom;
     driverConfig.timerChannel = PERFORMANCE_MEASURE.channel;
     driverConfig.irqModeTimer   = IfxGtm_IrqMode_pulse;
-    driverConfig.triggerOut = &BACKGROUND_LIGHT;
-    driverConfig.irqModeTrigger = IfxGtm_IrqMode_pulse;
     driverConfig.clock = IfxGtm_Tom_Ch_ClkSrc_cmuFxclk3; // used clock is 100MHz/256
     driverConfig.base.frequency = 1.0f; // we make 1 Hz
     driverConfig.base.minResolution = 0;
-    driverConfig.base.trigger.enabled = TRUE;
-    driverConfig.base.trigger.outputEnabled = FALSE;
-    driverConfig.base.trigger.outputMode = IfxPort_OutputMode_pushPull;
-    driverConfig.base.trigger.outputDriver = IfxPort_PadDriver_cmosAutomotiveSpeed1;
-    driverConfig.base.trigger.triggerPoint = 1;
-    driverConfig.base.trigger.risingEdgeAtPeriod = TRUE;
+    // no trigger channel, the backlight PWM has its own timer (background_light.c)
+    driverConfig.base.trigger.enabled = FALSE;
     driverConfig.base.isrPriority = ISR_PRIORITY_PERF_MEAS;
     driverConfig.base.isrProvider = ISR_PROVIDER_PERF_MEAS;
     IfxGtm_Tom_Timer_init (&driverPerformanceMeasure, &driverConfig);
     IfxGtm_Tom_Timer_run(&driverPerformanceMeasure);
 
     IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+    // the load is displayed by the display refresh task with perf_meas_display
+    perf_display_pending = FALSE;
+    // the load accounting of cpu0, the other cpus call perf_meas_load_init on their own
+    perf_meas_load_init();
+}
 
+// the profiler is cpu local, it has to be initialized on the cpu which is measured
+Ifx_Profiler *perf_meas_profiler_init(void)
+{
+    Ifx_Profiler *profiler;
+
+    switch (IfxCpu_getCoreIndex())
+    {
+#if IFXCPU_NUM_MODULES > 1
+    case IfxCpu_ResourceCpu_1:
+        profiler = &perf_profiler1;
+        break;
+#endif
+#if IFXCPU_NUM_MODULES > 2
+    case IfxCpu_ResourceCpu_2:
+        profiler = &perf_profiler2;
+        break;
+#endif
+    default:
+        profiler = &perf_profiler0;
+        break;
+    }
+    Ifx_Profiler_init(profiler, PERF_PROFILER_BIN_SHIFT);
+    return profiler;
+}
+
+static PerfLoad_t *perf_meas_local_load(void)
+{
+    switch (IfxCpu_getCoreIndex())
+    {
+#if IFXCPU_NUM_MODULES > 1
+    case IfxCpu_ResourceCpu_1:
+        return &perf_load1;
+#endif
+#if IFXCPU_NUM_MODULES > 2
+    case IfxCpu_ResourceCpu_2:
+        return &perf_load2;
+#endif
+    default:
+        return &perf_load0;
+    }
 }
 
-void perf_meas_idle(void){
-	uint32 cpu0_ccnt_actual;
-	static uint32 cpu0_ccnt_last = 0x7FFFFFFF;
+// the load accounting is cpu local, it has to be initialized on the cpu which is measured
+void perf_meas_load_init(void)
+{
+    IfxCpu_ResourceCpu cpu = IfxCpu_getCoreIndex();
+    PerfLoad_t *perf = perf_meas_local_load();
+    CpuLoad_t *load;
+    Ifx_CPU_CCTRL cctrl;
+    uint32 i;
+    boolean interrupt_state;
 
-	cpu0_ccnt_actual = __mfcr(CPU_CCNT);
-	// we ignore the overflow bit, not important for us
-	cpu0_ccnt_diff_min = __minu(cpu0_ccnt_diff_min, cpu0_ccnt_actual-cpu0_ccnt_last);
-	cpu0_ccnt_last = cpu0_ccnt_actual;
-	//Idle_counter for cpu load measurement
-	cpu0_idle_counter++;
+    switch (cpu)
+    {
+#if IFXCPU_NUM_MODULES > 1
+    case IfxCpu_ResourceCpu_1:
+        load = &CpuLoad1;
+        break;
+#endif
+#if IFXCPU_NUM_MODULES > 2
+    case IfxCpu_ResourceCpu_2:
+        load = &CpuLoad2;
+        break;
+#endif
+    default:
+        load = &CpuLoad0;
+        break;
+    }
+    // the busy cycles are counted with CCNT, we start it if it is not running yet
+    cctrl.U = __mfcr(CPU_CCTRL);
+    if (cctrl.B.CE == 0)
+    {
+        IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+    }
+
+    interrupt_state = IfxCpu_disableInterrupts();
+    perf->idle = FALSE;
+    perf->busy_cycles = 0;
+    perf->slot_ticks = (uint32)(IfxStm_getFrequency(&MODULE_STM0) * PERF_LOAD_SLOT_MS / 1000.0f);
+    perf->slot_cycles = (uint32)(IfxScuCcu_getCpuFrequency(cpu) * PERF_LOAD_SLOT_MS / 1000.0f);
+    perf->slot_index = 0;
+    for (i = 0; i < PERF_LOAD_SLOTS; i++)
+    {
+        perf->slot_busy[i] = 0;
+    }
+    perf->window_busy = 0;
+    perf->load = load;
+    load->lock.sequence = 0;
+    perf->busy_start = __mfcr(CPU_CCNT);
+    perf->slot_start = IfxStm_getLower(&MODULE_STM0);
+    IfxCpu_restoreInterrupts(interrupt_state);
 }
 
-IFX_INTERRUPT(ISR_perf_meas_call, 0, ISR_PRIORITY_PERF_MEAS);
+// publish the window, the readers retry while the sequence is odd or has changed
+static void perf_meas_publish(PerfLoad_t *perf, uint32 now)
+{
+    CpuLoad_t *load = perf->load;
+    uint32 window_cycles = perf->slot_cycles * PERF_LOAD_SLOTS;
+    float32 cpu_load = (float32)perf->window_busy * 100.0f / (float32)window_cycles;
 
-void ISR_perf_meas_call(void)
+    Ifx_SeqLock_writeBegin(&load->lock);
+    load->busy_cycles = perf->window_busy;
+    load->window_cycles = window_cycles;
+    load->update_time = now;
+    load->cpu_load = (cpu_load > 100.0f) ? 100.0f : cpu_load;
+    Ifx_SeqLock_writeEnd(&load->lock);
+}
+
+// accumulate the busy cycles and close the elapsed slots, called with disabled interrupts
+static void perf_meas_update(PerfLoad_t *perf)
 {
-    uint32 act_cpu0_idle_counter=cpu0_idle_counter;
+    uint32 ccnt = __mfcr(CPU_CCNT);
+    uint32 now = IfxStm_getLower(&MODULE_STM0);
+    uint32 closed = 0;
+
+    if (perf->load == NULL_PTR)
+    {
+        // not initialized on this cpu
+        return;
+    }
+    if (perf->idle == FALSE)
+    {
+        // CCNT is 31 bit, bit 31 is the overflow flag
+        perf->busy_cycles += (ccnt - perf->busy_start) & 0x7FFFFFFF;
+    }
+    perf->busy_start = ccnt;
+    // CCNT may stop in idle mode, so the slots are timed with STM0
+    while ((uint32)(now - perf->slot_start) >= perf->slot_ticks)
+    {
+        uint32 busy = __minu(perf->busy_cycles, perf->slot_cycles);
+
+        perf->window_busy -= perf->slot_busy[perf->slot_index];
+        perf->slot_busy[perf->slot_index] = busy;
+        perf->window_busy += busy;
+        perf->busy_cycles = 0;
+        perf->slot_index = (perf->slot_index + 1) % PERF_LOAD_SLOTS;
+        perf->slot_start += perf->slot_ticks;
+        closed++;
+        if (closed >= PERF_LOAD_SLOTS)
+        {
+            // the whole window has been rewritten, we restart the slot timing now
+            perf->slot_start = now;
+            break;
+        }
+    }
+    if (closed > 0)
+    {
+        perf_meas_publish(perf, now);
+    }
+}
+
+// called out of the idle loop of each cpu before waiting
+void perf_meas_idle_enter(void)
+{
+    PerfLoad_t *perf = perf_meas_local_load();
+    boolean interrupt_state = IfxCpu_disableInterrupts();
+
+    perf_meas_update(perf);
+    perf->idle = TRUE;
+    IfxCpu_restoreInterrupts(interrupt_state);
+}
+
+// called out of the idle loop of each cpu after waiting
+void perf_meas_idle_exit(void)
+{
+    PerfLoad_t *perf = perf_meas_local_load();
+    boolean interrupt_state = IfxCpu_disableInterrupts();
+
+    if (perf->idle == TRUE)
+    {
+        perf_meas_update(perf);
+        perf->idle = FALSE;
+    }
+    IfxCpu_restoreInterrupts(interrupt_state);
+}
+
+void perf_meas_sample(void)
+{
+    PerfLoad_t *perf = perf_meas_local_load();
+    boolean interrupt_state = IfxCpu_disableInterrupts();
+
+    perf_meas_update(perf);
+    IfxCpu_restoreInterrupts(interrupt_state);
+}
+
+boolean perf_meas_get_load(IfxCpu_ResourceCpu cpu, CpuLoad_t *load)
+{
+    CpuLoad_t *source;
+    uint32 sequence;
+
+    switch (cpu)
+    {
 #if IFXCPU_NUM_MODULES > 1
-    uint32 act_cpu1_idle_counter=cpu1_idle_counter;
+    case IfxCpu_ResourceCpu_1:
+        source = &CpuLoad1;
+        break;
 #endif
 #if IFXCPU_NUM_MODULES > 2
-    uint32 act_cpu2_idle_counter=cpu2_idle_counter;
+    case IfxCpu_ResourceCpu_2:
+        source = &CpuLoad2;
+        break;
 #endif
-    uint32 counter_diff;
-    float32 cpu_load;
+    default:
+        source = &CpuLoad0;
+        break;
+    }
+    do
+    {
+        sequence = Ifx_SeqLock_readBegin(&source->lock);
+        load->busy_cycles = source->busy_cycles;
+        load->window_cycles = source->window_cycles;
+        load->update_time = source->update_time;
+        load->cpu_load = source->cpu_load;
+    } while (Ifx_SeqLock_readRetry(&source->lock, sequence) != FALSE);
+    load->lock.sequence = sequence;
+
+    return sequence != 0;
+}
+
+// called by the display refresh task, shows the load once per second
+// the text is queued to the display fifo, it is written into DISPLAY_IO1 by conio_periodic
+// same text as "CPUn Load %.3f %% ", without vsprintf and its float64 conversion
+static void perf_meas_display_load(uint32 cpu, sint32 y, float32 cpu_load)
+{
+    char       text[24];
+    Ifx_Format fmt;
+
+    Ifx_Format_init(&fmt, text, sizeof(text));
+    Ifx_Format_string(&fmt, "CPU");
+    Ifx_Format_uint32(&fmt, cpu, 0);
+    Ifx_Format_string(&fmt, " Load ");
+    Ifx_Format_float32(&fmt, cpu_load, 0, 3);
+    Ifx_Format_string(&fmt, " % ");
+    display_ascii_putsxy (DISPLAY_IO1, 1, y, (const uint8 *)Ifx_Format_getText(&fmt));
+}
 
-    /* now we go to a lower priotity than our OS_TICK that we don't have an overflow */
-    __bisr(ISR_PRIORITY_OS_TICK-1);
+void perf_meas_display(void)
+{
+    CpuLoad_t load;
 
-    counter_diff = act_cpu0_idle_counter-cpu0_last_count_value;
-    cpu0_last_count_value = act_cpu0_idle_counter;
-    cpu_load = 100.0f - (float32)counter_diff/(g_AppCpu0.info.cpuFreq/100.0f/(float32)cpu0_ccnt_diff_min);
     // we printout if TFT is ready and conio initialized
-    if (tft_ready == TRUE)
+    if ((perf_display_pending == FALSE) || (tft_ready != TRUE))
+    {
+        return;
+    }
+    perf_display_pending = FALSE;
+    if (perf_meas_get_load(IfxCpu_ResourceCpu_0, &load) == TRUE)
     {
-        if (cpu_load < 0.0f) cpu_load = 0.0f;
-    	conio_ascii_printfxy (DISPLAY_IO1, 1,  2, (uint8 *)"CPU0 Load %.3f %c ", cpu_load, 0x25);
-//        conio_ascii_printfxy (DISPLAY_IO1, 1,  3, (uint8 *)"CPU0 Idle Counter-Diff %.10u ", counter_diff);
-//        conio_ascii_printfxy (DISPLAY_IO1, 1,  4, (uint8 *)"CPU0 in use for %.3e Cycles/s ", g_AppCpu0.info.cpuFreq/100.0f*cpu_load);
-        CpuLoad0.counter_diff = counter_diff;
-        CpuLoad0.cpu_load = cpu_load;
+        perf_meas_display_load(0, 2, load.cpu_load);
     }
 #if IFXCPU_NUM_MODULES > 1
-    counter_diff = act_cpu1_idle_counter-cpu1_last_count_value;
-    cpu1_last_count_value = act_cpu1_idle_counter;
-    cpu_load = 100.0f - (float32)counter_diff/(g_AppCpu1.info.cpuFreq/100.0f/(float32)cpu1_ccnt_diff_min);
-    // we printout if TFT is ready and conio initialized
-    if (tft_ready == TRUE)
+    if (perf_meas_get_load(IfxCpu_ResourceCpu_1, &load) == TRUE)
     {
-    	if (cpu_load < 0.0f) cpu_load = 0.0f;
-        conio_ascii_printfxy (DISPLAY_IO1, 1,  6, (uint8 *)"CPU1 Load %.3f %c ", cpu_load, 0x25);
-//        conio_ascii_printfxy (DISPLAY_IO1, 1,  7, (uint8 *)"CPU1 Idle Counter-Diff %.10u ", counter_diff);
-//        conio_ascii_printfxy (DISPLAY_IO1, 1,  8, (uint8 *)"CPU1 in use for %.3e Cycles/s ", g_AppCpu1.info.cpuFreq/100.0f*cpu_load);
-        CpuLoad1.counter_diff = counter_diff;
-        CpuLoad1.cpu_load = cpu_load;
+        perf_meas_display_load(1, 6, load.cpu_load);
     }
 #endif
 #if IFXCPU_NUM_MODULES > 2
-    counter_diff = act_cpu2_idle_counter-cpu2_last_count_value;
-    cpu2_last_count_value = act_cpu2_idle_counter;
-    cpu_load = 100.0f - (float32)counter_diff/(g_AppCpu2.info.cpuFreq/100.0f/(float32)cpu2_ccnt_diff_min);
-    // we printout if TFT is ready and conio initialized
-    if (tft_ready == TRUE)
+    if (perf_meas_get_load(IfxCpu_ResourceCpu_2, &load) == TRUE)
     {
-    	if (cpu_load < 0.0f) cpu_load = 0.0f;
-        conio_ascii_printfxy (DISPLAY_IO1, 1, 10, (uint8 *)"CPU2 Load %.3f %c ", cpu_load, 0x25);
-//        conio_ascii_printfxy (DISPLAY_IO1, 1, 11, (uint8 *)"CPU2 Idle Counter-Diff %.10u ", counter_diff);
-//        conio_ascii_printfxy (DISPLAY_IO1, 1, 12, (uint8 *)"CPU2 in use for %.3e Cycles/s ", g_AppCpu2.info.cpuFreq/100.0f*cpu_load);
-        CpuLoad2.counter_diff = counter_diff;
-        CpuLoad2.cpu_load = cpu_load;
+        perf_meas_display_load(2, 10, load.cpu_load);
     }
 #endif
-#if !defined(__DCC__)
-    // we need this restore here because we add a bisr instruction manually, Windriver add this automatically
-    __rslcx();
-#endif
 }
 
+IFX_INTERRUPT(ISR_perf_meas_call, 0, ISR_PRIORITY_PERF_MEAS);
+
+void ISR_perf_meas_call(void)
+{
+    // cpu0 may not reach its idle loop for a whole slot
+    perf_meas_sample();
+    // no text formatting at this priority, the display refresh task shows the load
+    perf_display_pending = TRUE;
+}
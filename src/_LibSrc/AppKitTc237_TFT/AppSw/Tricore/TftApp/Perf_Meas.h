@@ -8,9 +8,25 @@
 #ifndef PERF_MEAS_H_
 #define PERF_MEAS_H_
 
+#include "SysSe/Time/Ifx_Profiler.h"
+#include "_Lib/DataHandling/Ifx_SeqLock.h"
+
+// number of slots of the sliding load window and duration of one slot
+#ifndef PERF_LOAD_SLOTS
+#define PERF_LOAD_SLOTS 8
+#endif
+#ifndef PERF_LOAD_SLOT_MS
+#define PERF_LOAD_SLOT_MS 125
+#endif
+
+// load of one cpu over the last PERF_LOAD_SLOTS * PERF_LOAD_SLOT_MS
+// written only by the measured cpu, read by any cpu with perf_meas_get_load()
 typedef struct{
-    uint32 counter_diff;
-    float32 cpu_load;
+    Ifx_SeqLock lock;               // sequence odd while the writer updates the values
+    volatile uint32 busy_cycles;    // busy cycles in the window
+    volatile uint32 window_cycles;  // cpu cycles of the window
+    volatile uint32 update_time;    // STM0 lower value of the last update
+    volatile float32 cpu_load;      // busy_cycles / window_cycles in %
 }CpuLoad_t;
 
 IFX_EXTERN CpuLoad_t CpuLoad0;
@@ -21,11 +37,37 @@ IFX_EXTERN CpuLoad_t CpuLoad1;
 IFX_EXTERN CpuLoad_t CpuLoad2;
 #endif
 
-extern volatile uint32 cpu0_idle_counter;
-extern volatile uint32 cpu0_last_count_value;
-extern volatile uint32 cpu0_ccnt_diff_min;
+// task and interrupt profiler of each cpu, see Ifx_Profiler.h
+IFX_EXTERN Ifx_Profiler perf_profiler0;
+#if IFXCPU_NUM_MODULES > 1
+IFX_EXTERN Ifx_Profiler perf_profiler1;
+#endif
+#if IFXCPU_NUM_MODULES > 2
+IFX_EXTERN Ifx_Profiler perf_profiler2;
+#endif
+
+// histogram bins of the profilers are 2^PERF_PROFILER_BIN_SHIFT cycles
+#ifndef PERF_PROFILER_BIN_SHIFT
+#define PERF_PROFILER_BIN_SHIFT 12
+#endif
 
 void perf_meas_init(void);
-void perf_meas_idle(void);
+// the load accounting is cpu local: perf_meas_load_init, the idle hooks and perf_meas_sample
+// are called on the measured cpu. perf_meas_init calls perf_meas_load_init for cpu0.
+// busy time is counted with CCNT from perf_meas_idle_exit to perf_meas_idle_enter, so the idle
+// loop may wait with the idle mode (IfxCpu_setCoreMode) or a polling loop.
+// An interrupt waking the cpu may call perf_meas_idle_exit first to be counted as busy,
+// the call does nothing if the cpu is not idle.
+void perf_meas_load_init(void);
+void perf_meas_idle_enter(void);
+void perf_meas_idle_exit(void);
+// closes the elapsed slots without idle transition, to be called periodically (at least once
+// per slot) on a cpu which may not enter the idle loop for longer than one slot
+void perf_meas_sample(void);
+// consistent copy of the load of a cpu, returns FALSE if no value has been published yet
+boolean perf_meas_get_load(IfxCpu_ResourceCpu cpu, CpuLoad_t *load);
+Ifx_Profiler *perf_meas_profiler_init(void);
+// shows the load of the cpus on DISPLAY_IO1 once per second, called by the display refresh task
+void perf_meas_display(void);
 
 #endif /* PERF_MEAS_H_ */
@@ -33,7 +33,8 @@ typedef enum
     DISPLAY_IO0=2,             //!< DISPLAY_STDIO0 is a standard text output window
     DISPLAY_IO1=3,             //!< DISPLAY_STDIO1 is a standard text output window
     DISPLAY_GRAPH=4,            //!< DISPLAY_GRAPH first graphics window
-    DISPLAY_RSVD=5            //!< DISPLAY_RSVD is a standard text output window
+    DISPLAY_RSVD=5,           //!< DISPLAY_RSVD is a standard text output window
+    DISPLAY_POPUP=6           //!< DISPLAY_POPUP is the dialog layer laid over the text displays (e.g. keyboard)
 } TDISPLAYMODE;
 
 /*!< \enum Mode of TFT */
@@ -61,7 +62,7 @@ typedef struct DISPLAY_INFO
     sint32 y;                   //needed to remember where we are for text display scroll, remember x=0,y=0 is upper left
 } TDISPLAY_INFO;
 
-#define CONIO_MAXDISPLAYS 6
+#define CONIO_MAXDISPLAYS 7
 
 typedef struct CONIO_DISPLAYMODE_ENTRY
 {
@@ -143,8 +143,8 @@ void keyboard_display (sint32 ind, TDISPLAYENTRY * pdisplayentry)
     sint32 j;
     for (j = keyboardlist[ind].xmin; j <= keyboardlist[ind].xmax; j += 1)
     {
-        conio_ascii_gotoxy (conio_driver.displaymode, j, keyboardlist[ind].y);
-        conio_ascii_textchangecolor (conio_driver.displaymode, keyboardlist[ind].color_display);
+        conio_ascii_gotoxy (DISPLAY_POPUP, j, keyboardlist[ind].y);
+        conio_ascii_textchangecolor (DISPLAY_POPUP, keyboardlist[ind].color_display);
     }
 }
 
@@ -159,8 +159,8 @@ void keyboard_select (sint32 ind, TDISPLAYENTRY * pdisplayentry)
     sint32 j;
     for (j = keyboardlist[ind].xmin; j <= keyboardlist[ind].xmax; j += 1)
     {
-        conio_ascii_gotoxy (conio_driver.displaymode, j, keyboardlist[ind].y);
-        conio_ascii_textchangecolor (conio_driver.displaymode, keyboardlist[ind].color_select);
+        conio_ascii_gotoxy (DISPLAY_POPUP, j, keyboardlist[ind].y);
+        conio_ascii_textchangecolor (DISPLAY_POPUP, keyboardlist[ind].color_select);
     }
     if ((touch_driver.touchmode & MASK_TOUCH_UP) != 0)
     {
@@ -190,8 +190,8 @@ void keyboard_select_enter (sint32 ind, TDISPLAYENTRY * pdisplayentry)
     uint32 j;
     for (j = keyboardlist[ind].xmin; j <= keyboardlist[ind].xmax; j += 1)
     {
-        conio_ascii_gotoxy (conio_driver.displaymode, j, keyboardlist[ind].y);
-        conio_ascii_textchangecolor (conio_driver.displaymode, keyboardlist[ind].color_select);
+        conio_ascii_gotoxy (DISPLAY_POPUP, j, keyboardlist[ind].y);
+        conio_ascii_textchangecolor (DISPLAY_POPUP, keyboardlist[ind].color_select);
     }
     if ((touch_driver.touchmode & MASK_TOUCH_UP) != 0)
     {
@@ -209,8 +209,8 @@ void keyboard_select_back (sint32 ind, TDISPLAYENTRY * pdisplayentry)
     uint32 i, j;
     for (j = keyboardlist[ind].xmin; j <= keyboardlist[ind].xmax; j += 1)
     {
-        conio_ascii_gotoxy (conio_driver.displaymode, j, keyboardlist[ind].y);
-        conio_ascii_textchangecolor (conio_driver.displaymode, keyboardlist[ind].color_select);
+        conio_ascii_gotoxy (DISPLAY_POPUP, j, keyboardlist[ind].y);
+        conio_ascii_textchangecolor (DISPLAY_POPUP, keyboardlist[ind].color_select);
     }
     if ((touch_driver.touchmode & MASK_TOUCH_UP) != 0)
     {
@@ -232,8 +232,8 @@ void keyboard_select_left (sint32 ind, TDISPLAYENTRY * pdisplayentry)
     uint32 j;
     for (j = pdisplayentry->xmin; j <= pdisplayentry->xmax; j += 1)
     {
-        conio_ascii_gotoxy (conio_driver.displaymode, j, pdisplayentry->y);
-        conio_ascii_textchangecolor (conio_driver.displaymode, pdisplayentry->color_select);
+        conio_ascii_gotoxy (DISPLAY_POPUP, j, pdisplayentry->y);
+        conio_ascii_textchangecolor (DISPLAY_POPUP, pdisplayentry->color_select);
     }
     if ((touch_driver.touchmode & MASK_TOUCH_UP) != 0)
     {
@@ -248,8 +248,8 @@ void keyboard_select_right (sint32 ind, TDISPLAYENTRY * pdisplayentry)
     uint32 j;
     for (j = pdisplayentry->xmin; j <= pdisplayentry->xmax; j += 1)
     {
-        conio_ascii_gotoxy (conio_driver.displaymode, j, pdisplayentry->y);
-        conio_ascii_textchangecolor (conio_driver.displaymode, pdisplayentry->color_select);
+        conio_ascii_gotoxy (DISPLAY_POPUP, j, pdisplayentry->y);
+        conio_ascii_textchangecolor (DISPLAY_POPUP, pdisplayentry->color_select);
     }
     if ((touch_driver.touchmode & MASK_TOUCH_UP) != 0)
     {
@@ -261,19 +261,19 @@ void keyboard_select_right (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 
 void keyboard_display_descr (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
-    conio_ascii_textattr (conio_driver.displaymode, pdisplayentry->color_display);
-    conio_ascii_gotoxy (conio_driver.displaymode, pdisplayentry->xmin, pdisplayentry->y);
-    conio_ascii_cputs (conio_driver.displaymode, conio_driver.scanfdescr);
+    conio_ascii_textattr (DISPLAY_POPUP, pdisplayentry->color_display);
+    conio_ascii_gotoxy (DISPLAY_POPUP, pdisplayentry->xmin, pdisplayentry->y);
+    conio_ascii_cputs (DISPLAY_POPUP, conio_driver.scanfdescr);
 }
 
 void keyboard_display_text (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
-    conio_ascii_textattr (conio_driver.displaymode, pdisplayentry->color_display);
-    conio_ascii_gotoxy (conio_driver.displaymode, pdisplayentry->xmin, pdisplayentry->y);
-    conio_ascii_cputs (conio_driver.displaymode, conio_driver.scanftext);
-    conio_ascii_gotoxy (conio_driver.displaymode, conio_driver.scanfx + pdisplayentry->xmin, pdisplayentry->y);
+    conio_ascii_textattr (DISPLAY_POPUP, pdisplayentry->color_display);
+    conio_ascii_gotoxy (DISPLAY_POPUP, pdisplayentry->xmin, pdisplayentry->y);
+    conio_ascii_cputs (DISPLAY_POPUP, conio_driver.scanftext);
+    conio_ascii_gotoxy (DISPLAY_POPUP, conio_driver.scanfx + pdisplayentry->xmin, pdisplayentry->y);
     if ((conio_driver.blinky & 1) == 0)
-        conio_ascii_textchangecolor (conio_driver.displaymode, pdisplayentry->color_select);
+        conio_ascii_textchangecolor (DISPLAY_POPUP, pdisplayentry->color_select);
 }
 
 
@@ -288,39 +288,39 @@ void keyboard (sint16 x, sint16 y)
     if (y > 17)
         y = 17;
 
-    conio_ascii_textcolor (DISPLAY_MENU, BLACK);
-    conio_ascii_textbackground (DISPLAY_MENU, CYAN);
+    conio_ascii_textcolor (DISPLAY_POPUP, BLACK);
+    conio_ascii_textbackground (DISPLAY_POPUP, CYAN);
 
-    conio_ascii_gotoxy (conio_driver.displaymode, 0, 6);
+    conio_ascii_gotoxy (DISPLAY_POPUP, 0, 6);
     for (j = 0; j < 13; j += 1)
         for (i = 0; i < 40; i += 1)
         {
-            conio_ascii_putch (conio_driver.displaymode, keyboard_outline[j][i]);
+            conio_ascii_putch (DISPLAY_POPUP, keyboard_outline[j][i]);
         }
-    conio_ascii_gotoxy (conio_driver.displaymode, 1, 7);
+    conio_ascii_gotoxy (DISPLAY_POPUP, 1, 7);
     eofstr = 0;
     for (j = 0; j < 18; j += 1)
     {
         if (conio_driver.scanfdescr[j] == 0)
             eofstr = 1;
         if (eofstr == 0)
-            conio_ascii_putch (conio_driver.displaymode, conio_driver.scanfdescr[0]);
+            conio_ascii_putch (DISPLAY_POPUP, conio_driver.scanfdescr[0]);
         else
-            conio_ascii_putch (conio_driver.displaymode, 0x20);
+            conio_ascii_putch (DISPLAY_POPUP, 0x20);
     }
-    conio_ascii_gotoxy (conio_driver.displaymode, 21, 7);
+    conio_ascii_gotoxy (DISPLAY_POPUP, 21, 7);
     eofstr = 0;
     for (j = 0; j < 18; j += 1)
     {
         if (conio_driver.scanftext[j] == 0)
             eofstr = 1;
         if (eofstr == 0)
-            conio_ascii_putch (conio_driver.displaymode, conio_driver.scanftext[0]);
+            conio_ascii_putch (DISPLAY_POPUP, conio_driver.scanftext[0]);
         else
-            conio_ascii_putch (conio_driver.displaymode, 0x20);
+            conio_ascii_putch (DISPLAY_POPUP, 0x20);
     }
-    conio_ascii_gotoxy (DISPLAY_MENU, x, y);
-    conio_ascii_textchangebackground (DISPLAY_MENU, RED);
+    conio_ascii_gotoxy (DISPLAY_POPUP, x, y);
+    conio_ascii_textchangebackground (DISPLAY_POPUP, RED);
     for (i = 0; i < MAX_DISPLAYKEYBENTRY; i += 1)
     {
         if ((x >= keyboardlist[i].xmin) && (x <= keyboardlist[i].xmax) && (y == keyboardlist[i].y))
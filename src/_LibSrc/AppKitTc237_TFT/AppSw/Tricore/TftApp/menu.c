@@ -8,8 +8,8 @@
 /*----------------------------------Includes----------------------------------*/
 /******************************************************************************/
 #include <Cpu/Std/Ifx_Types.h>
-#include <stdio.h>
 #include <string.h>
+#include "SysSe/General/Ifx_Format.h"
 #include <Tft/conio_tft.h>
 #include <Tft/touch.h>
 #include "tft_app.h"
@@ -33,6 +33,10 @@ void menu_display (sint32 ind, TDISPLAYENTRY * pdisplayentry);
 void menu_select (sint32 ind, TDISPLAYENTRY * pdisplayentry);
 sint32 menu_input (sint32 ind, TDISPLAYENTRY * pdisplayentry);
 
+static void menu_printfloat (TDISPLAYENTRY * pdisplayentry, const char *label, float32 value, uint8 width, uint8 precision, const char *unit);
+static void menu_printuint (TDISPLAYENTRY * pdisplayentry, const char *label, uint32 value);
+static void menu_scanftext_float (float32 value, uint8 width, uint8 precision);
+
 void menu_select_title (sint32 ind, TDISPLAYENTRY * pdisplayentry);
 
 void menu_select_cpusec (sint32 ind, TDISPLAYENTRY * pdisplayentry);
@@ -119,6 +123,37 @@ extern TCONTROLMENU controlmenu;
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
+// "<label>%<width>.<precision>f<unit>" at the entry position, formatted without vsprintf
+static void menu_printfloat (TDISPLAYENTRY * pdisplayentry, const char *label, float32 value, uint8 width, uint8 precision, const char *unit)
+{
+    char text[TERMINAL_MAXX + 1];
+    Ifx_Format fmt;
+    Ifx_Format_init (&fmt, text, sizeof (text));
+    Ifx_Format_string (&fmt, label);
+    Ifx_Format_float32 (&fmt, value, width, precision);
+    Ifx_Format_string (&fmt, unit);
+    conio_ascii_putsxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)text);
+}
+
+// "<label>%u" at the entry position, formatted without vsprintf
+static void menu_printuint (TDISPLAYENTRY * pdisplayentry, const char *label, uint32 value)
+{
+    char text[TERMINAL_MAXX + 1];
+    Ifx_Format fmt;
+    Ifx_Format_init (&fmt, text, sizeof (text));
+    Ifx_Format_string (&fmt, label);
+    Ifx_Format_uint32 (&fmt, value, 0);
+    conio_ascii_putsxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)text);
+}
+
+// initial text of the keyboard entry
+static void menu_scanftext_float (float32 value, uint8 width, uint8 precision)
+{
+    Ifx_Format fmt;
+    Ifx_Format_init (&fmt, (char *) &conio_driver.scanftext[0], sizeof (conio_driver.scanftext));
+    Ifx_Format_float32 (&fmt, value, width, precision);
+}
+
 void menu_display (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
     conio_ascii_textattr (DISPLAY_MENU, pdisplayentry->color_display);
@@ -156,7 +191,7 @@ void menu_select_title (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 void menu_display_cpusec (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
     conio_ascii_textattr (DISPLAY_MENU, pdisplayentry->color_display);
-    conio_ascii_printfxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"%7.1f", controlmenu.cpuseconds);
+    menu_printfloat (pdisplayentry, "", controlmenu.cpuseconds, 7, 1, "");
 }
 
 void menu_select_cpusec (sint32 ind, TDISPLAYENTRY * pdisplayentry)
@@ -175,10 +210,10 @@ void menu_display_testbasic (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
     conio_ascii_textattr (DISPLAY_MENU, pdisplayentry->color_display);
     if(IR_Ctrl.basicTest == FALSE){
-    	conio_ascii_printfxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"TEST BASIC: OFF");
+    	conio_ascii_putsxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"TEST BASIC: OFF");
     }
     else {
-    	conio_ascii_printfxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"TEST BASIC:  ON");
+    	conio_ascii_putsxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"TEST BASIC:  ON");
     }
 }
 
@@ -208,10 +243,10 @@ void menu_display_beeper (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
     conio_ascii_textattr (DISPLAY_MENU, pdisplayentry->color_display);
     if(IR_getBeeperOn() == FALSE){
-    	conio_ascii_printfxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"Beep OFF");
+    	conio_ascii_putsxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"Beep OFF");
     }
     else {
-    	conio_ascii_printfxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"Beep  ON");
+    	conio_ascii_putsxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"Beep  ON");
     }
 }
 
@@ -240,15 +275,13 @@ void menu_select_beeper (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 void menu_display_cpusecdelta (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
     conio_ascii_textattr (DISPLAY_MENU, pdisplayentry->color_display);
-    conio_ascii_printfxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"Delta %1.3f [msec]", controlmenu.cpusecondsdelta);
+    menu_printfloat (pdisplayentry, "Delta ", controlmenu.cpusecondsdelta, 1, 3, " [msec]");
 }
 
 sint32 menu_input_cpusecdelta (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
     float32 temp;
-    sint32 result;
-    result = sscanf ((char *) &conio_driver.scanftext[0], "%f", &temp);
-    if (result != 1)
+    if (Ifx_Format_parseFloat32 ((pchar) &conio_driver.scanftext[0], &temp) == NULL_PTR)
         return (-1);
     	controlmenu.cpusecondsdelta = temp;
     return (0);
@@ -257,11 +290,11 @@ sint32 menu_input_cpusecdelta (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 void menu_select_cpusecdelta (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
     conio_ascii_textattr (DISPLAY_MENU, pdisplayentry->color_select);
-    conio_ascii_printfxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"Delta %f", controlmenu.cpusecondsdelta);
+    menu_printfloat (pdisplayentry, "Delta ", controlmenu.cpusecondsdelta, 0, 6, "");
     if ((touch_driver.touchmode & MASK_TOUCH_UP) != 0)
     {
         strcpy ((char *) &conio_driver.scanfdescr[0], "Delta ");
-        sprintf ((char *) &conio_driver.scanftext[0], "%f", controlmenu.cpusecondsdelta);
+        menu_scanftext_float (controlmenu.cpusecondsdelta, 0, 6);
         //                     control.cpuseconds=0.0f;
         conio_driver.scanfx = 0;    //actual cursor
         conio_driver.dialogmode = KEYBOARDON; //Keyboard input mode
@@ -275,10 +308,10 @@ void menu_display_motor0en (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
     conio_ascii_textattr (DISPLAY_MENU, pdisplayentry->color_display);
     if(IR_getMotor0En() == FALSE){
-    	conio_ascii_printfxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"M0En OFF");
+    	conio_ascii_putsxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"M0En OFF");
     }
     else {
-    	conio_ascii_printfxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"M0En  ON");
+    	conio_ascii_putsxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"M0En  ON");
     }
 }
 
@@ -307,15 +340,13 @@ void menu_select_motor0en (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 void menu_display_motor0 (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
     conio_ascii_textattr (DISPLAY_MENU, pdisplayentry->color_display);
-    conio_ascii_printfxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"M0Vol:  %3.2f", IR_getMotor0Vol());
+    menu_printfloat (pdisplayentry, "M0Vol:  ", IR_getMotor0Vol(), 3, 2, "");
 }
 
 sint32 menu_input_motor0 (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
     float32 temp;
-    sint32 result;
-    result = sscanf ((char *) &conio_driver.scanftext[0], "%f", (float32 *) &temp);
-    if (result != 1)
+    if (Ifx_Format_parseFloat32 ((pchar) &conio_driver.scanftext[0], &temp) == NULL_PTR)
         return (-1);
     IR_setMotor0Vol(temp);
 
@@ -325,11 +356,11 @@ sint32 menu_input_motor0 (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 void menu_select_motor0 (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
     conio_ascii_textattr (DISPLAY_MENU, pdisplayentry->color_select);    //MENUE
-    conio_ascii_printfxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"M0Vol:  %3.2f", IR_getMotor0Vol());   //MENUE
+    menu_printfloat (pdisplayentry, "M0Vol:  ", IR_getMotor0Vol(), 3, 2, "");   //MENUE
     if ((touch_driver.touchmode & MASK_TOUCH_UP) != 0)
     {
         strcpy ((char *) &conio_driver.scanfdescr[0], "M0Vol:  ");    //PREP of Keyboard Mode
-        sprintf ((char *) &conio_driver.scanftext[0], "%3.2f", IR_getMotor0Vol()); //right upper value
+        menu_scanftext_float (IR_getMotor0Vol(), 3, 2); //right upper value
         conio_driver.scanfx = 0;    //actual cursor
         conio_driver.dialogmode = KEYBOARDON; //Keyboard input mode
         conio_driver.input = pdisplayentry->input;
@@ -366,10 +397,10 @@ void menu_display_motor1en (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
     conio_ascii_textattr (DISPLAY_MENU, pdisplayentry->color_display);
     if(IR_getMotor1En() == FALSE){
-    	conio_ascii_printfxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"M1En OFF");
+    	conio_ascii_putsxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"M1En OFF");
     }
     else {
-    	conio_ascii_printfxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"M1En  ON");
+    	conio_ascii_putsxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"M1En  ON");
     }
 }
 
@@ -398,15 +429,13 @@ void menu_select_motor1en (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 void menu_display_motor1 (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
     conio_ascii_textattr (DISPLAY_MENU, pdisplayentry->color_display);
-    conio_ascii_printfxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"M1Vol:  %3.2f", IR_getMotor1Vol());
+    menu_printfloat (pdisplayentry, "M1Vol:  ", IR_getMotor1Vol(), 3, 2, "");
 }
 
 sint32 menu_input_motor1 (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
     float32 temp;
-    sint32 result;
-    result = sscanf ((char *) &conio_driver.scanftext[0], "%f", (float32 *) &temp);
-    if (result != 1)
+    if (Ifx_Format_parseFloat32 ((pchar) &conio_driver.scanftext[0], &temp) == NULL_PTR)
         return (-1);
     IR_setMotor1Vol(temp);
 
@@ -416,11 +445,11 @@ sint32 menu_input_motor1 (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 void menu_select_motor1 (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
     conio_ascii_textattr (DISPLAY_MENU, pdisplayentry->color_select);    //MENUE
-    conio_ascii_printfxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"M1Vol:  %3.2f", IR_getMotor1Vol());   //MENUE
+    menu_printfloat (pdisplayentry, "M1Vol:  ", IR_getMotor1Vol(), 3, 2, "");   //MENUE
     if ((touch_driver.touchmode & MASK_TOUCH_UP) != 0)
     {
         strcpy ((char *) &conio_driver.scanfdescr[0], "M1Vol:  ");    //PREP of Keyboard Mode
-        sprintf ((char *) &conio_driver.scanftext[0], "%3.2f", IR_getMotor1Vol()); //right upper value
+        menu_scanftext_float (IR_getMotor1Vol(), 3, 2); //right upper value
         conio_driver.scanfx = 0;    //actual cursor
         conio_driver.dialogmode = KEYBOARDON; //Keyboard input mode
         conio_driver.input = pdisplayentry->input;
@@ -456,15 +485,13 @@ void menu_select_motor1_minus (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 void menu_display_srv (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
     conio_ascii_textattr (DISPLAY_MENU, pdisplayentry->color_display);
-    conio_ascii_printfxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"Servo:  %3.2f", IR_getSrvAngle());
+    menu_printfloat (pdisplayentry, "Servo:  ", IR_getSrvAngle(), 3, 2, "");
 }
 
 sint32 menu_input_srv (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
     float32 temp;
-    sint32 result;
-    result = sscanf ((char *) &conio_driver.scanftext[0], "%f", (float32 *) &temp);
-    if (result != 1)
+    if (Ifx_Format_parseFloat32 ((pchar) &conio_driver.scanftext[0], &temp) == NULL_PTR)
         return (-1);
     IR_setSrvAngle(temp);
 
@@ -474,11 +501,11 @@ sint32 menu_input_srv (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 void menu_select_srv (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
     conio_ascii_textattr (DISPLAY_MENU, pdisplayentry->color_select);    //MENUE
-    conio_ascii_printfxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"Servo:  %3.2f", IR_getSrvAngle());   //MENUE
+    menu_printfloat (pdisplayentry, "Servo:  ", IR_getSrvAngle(), 3, 2, "");   //MENUE
     if ((touch_driver.touchmode & MASK_TOUCH_UP) != 0)
     {
         strcpy ((char *) &conio_driver.scanfdescr[0], "Servo:  ");    //PREP of Keyboard Mode
-        sprintf ((char *) &conio_driver.scanftext[0], "%3.2f", IR_getSrvAngle()); //right upper value
+        menu_scanftext_float (IR_getSrvAngle(), 3, 2); //right upper value
         conio_driver.scanfx = 0;    //actual cursor
         conio_driver.dialogmode = KEYBOARDON; //Keyboard input mode
         conio_driver.input = pdisplayentry->input;
@@ -514,34 +541,34 @@ void menu_select_srv_minus (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 void menu_display_background_light (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
     conio_ascii_textattr (DISPLAY_MENU, pdisplayentry->color_display);
-    conio_ascii_printfxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"Background Light: %u", (unsigned int) backgroundlightsize);
+    menu_printuint (pdisplayentry, "Background Light: ", backgroundlightsize);
 }
 
 sint32 menu_input_background_light (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
-    uint32 temp;
-    sint32 result;
-    result = sscanf ((char *) &conio_driver.scanftext[0], "%u", (unsigned int *) &temp);
-    if (result != 1)
+    uint64 temp;
+    if (Ifx_Format_parseUInt64 ((pchar) &conio_driver.scanftext[0], &temp, FALSE) == NULL_PTR)
         return (-1);
     if (temp < backgroundlightmin)
         temp = backgroundlightmin;
     if (temp > backgroundlightmax)
         temp = backgroundlightmax;
 
-    backgroundlightsize = temp;
+    backgroundlightsize = (uint32)temp;
 
     return (0);
 }
 
 void menu_select_background_light (sint32 ind, TDISPLAYENTRY * pdisplayentry)
 {
+    Ifx_Format fmt;
     conio_ascii_textattr (DISPLAY_MENU, pdisplayentry->color_select);    //MENUE
-    conio_ascii_printfxy (DISPLAY_MENU, pdisplayentry->xmin, pdisplayentry->y, (const uint8 *)"Change Light: %u", (unsigned int) backgroundlightsize);   //MENUE
+    menu_printuint (pdisplayentry, "Change Light: ", backgroundlightsize);   //MENUE
     if ((touch_driver.touchmode & MASK_TOUCH_UP) != 0)
     {
         strcpy ((char *) &conio_driver.scanfdescr[0], "Light: ");    //PREP of Keyboard Mode
-        sprintf ((char *) &conio_driver.scanftext[0], "%u", (unsigned int) backgroundlightsize); //right upper value
+        Ifx_Format_init (&fmt, (char *) &conio_driver.scanftext[0], sizeof (conio_driver.scanftext));
+        Ifx_Format_uint32 (&fmt, backgroundlightsize, 0);   //right upper value
         conio_driver.scanfx = 0;    //actual cursor
         conio_driver.dialogmode = KEYBOARDON; //Keyboard input mode
         conio_driver.input = pdisplayentry->input;
@@ -107,6 +107,8 @@ TDISPLAY display_stdio1;
 TDISPLAYCOLOR displaycolor_stdio1;
 TDISPLAY display_rsvd;
 TDISPLAYCOLOR displaycolor_rsvd;
+TDISPLAY display_popup;
+TDISPLAYCOLOR displaycolor_popup;
 
 #if defined(__GNUC__)
 #pragma section
@@ -135,7 +137,8 @@ const TCONIODMENTRY conio_displaymode_list[CONIO_MAXDISPLAYS] =
     { DISPLAY_IO0, {(uint8 *) & display_stdio0, (uint8 *) & displaycolor_stdio0, TEXTMODE, WHITE, TERMINAL_MAXX, TERMINAL_MAXY-1, 0, 0} },
     { DISPLAY_IO1, {(uint8 *) & display_stdio1, (uint8 *) & displaycolor_stdio1, TEXTMODE, WHITE, TERMINAL_MAXX, TERMINAL_MAXY-1, 0, 0} },
     { DISPLAY_GRAPH, {(uint8 *) & display_graph, 0, GRAPHICMODE_16COLOR, WHITE, TERMINAL_MAXX, TERMINAL_MAXY, 0, 0} },
-    { DISPLAY_RSVD, {(uint8 *) & display_rsvd, (uint8 *) & displaycolor_rsvd, TEXTMODE, WHITE, TERMINAL_MAXX, TERMINAL_MAXY-1, 0, 0} }
+    { DISPLAY_RSVD, {(uint8 *) & display_rsvd, (uint8 *) & displaycolor_rsvd, TEXTMODE, WHITE, TERMINAL_MAXX, TERMINAL_MAXY-1, 0, 0} },
+    { DISPLAY_POPUP, {(uint8 *) & display_popup, (uint8 *) & displaycolor_popup, TEXTMODE, WHITE, TERMINAL_MAXX, TERMINAL_MAXY-1, 0, 0} }
 };
 
 
@@ -160,6 +163,7 @@ void tft_app_init (uint8 RtcRunning)
     conio_init ((const pTCONIODMENTRY)conio_displaymode_list);
 #ifdef TFT_OVER_DAS
     conio_driver.pdasmirror = &das_buffer[0];   //a buffer is available for PC sharing
+    conio_driver.dasmirrorsize = DAS_BUFFER_LEN >> 2;
     conio_driver.dasstatus = 0; //we can update
 #endif
 
@@ -172,8 +176,14 @@ void tft_app_init (uint8 RtcRunning)
 
 }
 
+/** \brief display refresh task
+ *
+ * This function is called periodically from the background loop. It formats the text of the
+ * displays and triggers the tft lib, no text is formatted in a timer interrupt.
+ */
 extern void tft_app_run(void){
 	display_io_run();
+	perf_meas_display();
 	controlmenu.cpuseconds = controlmenu.cpuseconds + REFRESH_TFT*0.1;
 	IfxSrc_setRequest(&TFT_UPDATE_IRQ);    //trigger the tft lib
 }
@@ -0,0 +1,296 @@
+/*
+ * conio_das.c
+ *
+ *  Export of the display changes to the host (TFT_OVER_DAS)
+ *
+ */
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include <Cpu/Std/Ifx_Types.h>
+#include "Configuration.h"
+#include "conio_tft.h"
+#include <string.h>
+
+#ifdef TFT_OVER_DAS
+/******************************************************************************/
+/*------------------------Inline Function Prototypes--------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+//the bytes of one tile line and of one tile in the graphic display buffer, bits is the bits per pixel
+#define DAS_TILE_LINE_BYTES(bits) ((FONT_XSIZE * (bits)) >> 3)
+#define DAS_TILE_WORDS(bits) ((DAS_TILE_LINE_BYTES(bits) * FONT_YSIZE + 3) >> 2)
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+extern TCOLORTABLEASCII colortable_ascii;
+extern TCOLORTABLE colortable_graphics;
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+#if TFT_DISPLAY_VAR_LOCATION == 0
+	#if defined(__GNUC__)
+	#pragma section ".bss_cpu0" awc0
+	#endif
+	#if defined(__TASKING__)
+	#pragma section farbss "bss_cpu0"
+	#pragma section fardata "data_cpu0"
+	#endif
+	#if defined(__DCC__)
+	#pragma section DATA ".data_cpu0" ".bss_cpu0" far-absolute RW
+	#endif
+#elif TFT_DISPLAY_VAR_LOCATION == 1
+	#if defined(__GNUC__)
+	#pragma section ".bss_cpu1" awc1
+	#endif
+	#if defined(__TASKING__)
+	#pragma section farbss "bss_cpu1"
+	#pragma section fardata "data_cpu1"
+	#endif
+	#if defined(__DCC__)
+	#pragma section DATA ".data_cpu1" ".bss_cpu1" far-absolute RW
+	#endif
+#elif TFT_DISPLAY_VAR_LOCATION == 2
+	#if defined(__GNUC__)
+	#pragma section ".bss_cpu2" awc2
+	#endif
+	#if defined(__TASKING__)
+	#pragma section farbss "bss_cpu2"
+	#pragma section fardata "data_cpu2"
+	#endif
+	#if defined(__DCC__)
+	#pragma section DATA ".data_cpu2" ".bss_cpu2" far-absolute RW
+	#endif
+#else
+#error "Set TFT_DISPLAY_VAR_LOCATION to a valid value!"
+#endif
+
+	//the text as the host has it, row 0 is the bar
+	static uint8 das_display[TERMINAL_MAXY][TERMINAL_MAXX];
+	static uint8 das_displaycolor[TERMINAL_MAXY][TERMINAL_MAXX];
+
+#if defined(__GNUC__)
+#pragma section
+#endif
+#if defined(__TASKING__)
+#pragma section farbss restore
+#pragma section fardata restore
+#endif
+#if defined(__DCC__)
+#pragma section DATA RW
+#endif
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+static uint32 das_pack (uint32 * pdst, const uint8 * psrc, sint32 cnt);
+static uint32 das_text_row (uint32 pos, sint32 row, const uint8 * pdisplay, const uint8 * pdisplaycolor,
+                            const uint8 * ppopup, const uint8 * ppopupcolor, uint8 full);
+static uint32 das_graphic_row (uint32 pos, sint32 row, uint8 * pdisplay, sint32 bits);
+static sint32 das_tile_fill (const uint8 * pdisplay, sint32 row, sint32 col, sint32 bits);
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+// the bytes are packed 4 per word, the first byte in the lowest byte, the last word is filled with 0
+// returns the number of written words
+static uint32 das_pack (uint32 * pdst, const uint8 * psrc, sint32 cnt)
+{
+    uint32 words = (cnt + 3) >> 2;
+    uint32 i;
+
+    for (i = 0; i < words; i++)
+        pdst[i] = 0;
+    for (i = 0; i < (uint32) cnt; i++)
+        pdst[i >> 2] |= (uint32) psrc[i] << ((i & 0x3) << 3);
+    return words;
+}
+
+// the changed characters of a row are exported as one record from the first to the last change
+// the popup layer is laid over the text like on the tft, a popup cell with character 0 and color 0 is transparent
+// returns the new position in the mirror, the row stays changed if the record does not fit
+static uint32 das_text_row (uint32 pos, sint32 row, const uint8 * pdisplay, const uint8 * pdisplaycolor,
+                            const uint8 * ppopup, const uint8 * ppopupcolor, uint8 full)
+{
+    uint8 ch[TERMINAL_MAXX];
+    uint8 color[TERMINAL_MAXX];
+    sint32 x, xmin, xmax, cnt;
+
+    xmin = TERMINAL_MAXX;
+    xmax = -1;
+    for (x = 0; x < TERMINAL_MAXX; x++)
+    {
+        ch[x] = pdisplay[x];
+        color[x] = pdisplaycolor[x];
+        if ((ppopup != 0) && ((ppopup[x] != 0) || (ppopupcolor[x] != 0)))
+        {
+            ch[x] = ppopup[x];
+            color[x] = ppopupcolor[x];
+        }
+        if ((full != 0) || (ch[x] != das_display[row][x]) || (color[x] != das_displaycolor[row][x]))
+        {
+            if (x < xmin) xmin = x;
+            xmax = x;
+        }
+    }
+    if (xmax < 0) return pos;
+    cnt = xmax - xmin + 1;
+    if ((pos + 1 + (((cnt + 3) >> 2) << 1)) > conio_driver.dasmirrorsize) return pos;
+    conio_driver.pdasmirror[pos++] = DAS_RECORD (DAS_RECORD_TEXT, row, xmin, cnt);
+    pos += das_pack (&conio_driver.pdasmirror[pos], &ch[xmin], cnt);
+    pos += das_pack (&conio_driver.pdasmirror[pos], &color[xmin], cnt);
+    for (x = xmin; x <= xmax; x++)
+    {
+        das_display[row][x] = ch[x];
+        das_displaycolor[row][x] = color[x];
+    }
+    return pos;
+}
+
+// returns the byte value if all bytes of the tile have the same value, otherwise -1
+static sint32 das_tile_fill (const uint8 * pdisplay, sint32 row, sint32 col, sint32 bits)
+{
+    const uint8 *pline = &pdisplay[((row * FONT_YSIZE * TFT_XSIZE + col * FONT_XSIZE) * bits) >> 3];
+    uint8 value = pline[0];
+    sint32 l, i;
+
+    for (l = 0; l < FONT_YSIZE; l++)
+    {
+        for (i = 0; i < DAS_TILE_LINE_BYTES (bits); i++)
+        {
+            if (pline[i] != value) return -1;
+        }
+        pline += (TFT_XSIZE * bits) >> 3;
+    }
+    return value;
+}
+
+// the changed tiles of a graphic row are exported as runs of filled tiles and runs of raw tiles
+// returns the new position in the mirror, the tiles which do not fit stay changed for the next export
+static uint32 das_graphic_row (uint32 pos, sint32 row, uint8 * pdisplay, sint32 bits)
+{
+    TDIRTYROW *pdirty = &conio_driver.dasgraphicsdirty[row];
+    uint8 tile[DAS_TILE_WORDS (8) << 2];
+    sint32 x, cnt, fill, l;
+    uint32 head;
+
+    x = pdirty->xmin;
+    while (x <= pdirty->xmax)
+    {
+        fill = das_tile_fill (pdisplay, row, x, bits);
+        head = pos;
+        cnt = 0;
+        if (fill >= 0)
+        {
+            if ((pos + 2) > conio_driver.dasmirrorsize) break;
+            pos += 2;
+            conio_driver.pdasmirror[head + 1] = (uint32) fill;
+            while (((x + cnt) <= pdirty->xmax) && (das_tile_fill (pdisplay, row, x + cnt, bits) == fill))
+                cnt++;
+            conio_driver.pdasmirror[head] = DAS_RECORD (DAS_RECORD_FILL, row, x, cnt);
+        }
+        else
+        {
+            pos += 1;
+            while (((x + cnt) <= pdirty->xmax) && (das_tile_fill (pdisplay, row, x + cnt, bits) < 0)
+                   && ((pos + DAS_TILE_WORDS (bits)) <= conio_driver.dasmirrorsize))
+            {
+                const uint8 *pline = &pdisplay[((row * FONT_YSIZE * TFT_XSIZE + (x + cnt) * FONT_XSIZE) * bits) >> 3];
+                for (l = 0; l < FONT_YSIZE; l++)
+                {
+                    memcpy (&tile[l * DAS_TILE_LINE_BYTES (bits)], pline, DAS_TILE_LINE_BYTES (bits));
+                    pline += (TFT_XSIZE * bits) >> 3;
+                }
+                pos += das_pack (&conio_driver.pdasmirror[pos], tile, DAS_TILE_LINE_BYTES (bits) * FONT_YSIZE);
+                cnt++;
+            }
+            if (cnt == 0)
+            {
+                pos = head;
+                break;
+            }
+            conio_driver.pdasmirror[head] = DAS_RECORD (DAS_RECORD_TILES, row, x, cnt);
+        }
+        x += cnt;
+    }
+    pdirty->xmin = x;
+    if (x > pdirty->xmax)
+    {
+        pdirty->xmin = TERMINAL_MAXX;
+        pdirty->xmax = -1;
+    }
+    return pos;
+}
+
+// called out of conio_periodic, the mirror is only written if the host has read the last export (dasstatus 0)
+// or requests a whole frame (dasstatus 2), nothing is published if nothing changed
+void conio_das_export (void)
+{
+    TDISPLAY_INFO *pinfo = &conio_driver.display[conio_driver.displaymode];
+    uint8 *ppopup = 0;
+    uint8 *ppopupcolor = 0;
+    uint8 full;
+    uint32 pos;
+    sint32 row, bits;
+
+    if ((conio_driver.pdasmirror == 0) || (conio_driver.dasmirrorsize <= DAS_HEADER_SIZE)) return;
+    if ((conio_driver.dasstatus != 0) && (conio_driver.dasstatus != 2)) return;
+    full = (conio_driver.dasstatus == 2) || (conio_driver.dasrefresh != 0) || (conio_driver.dasdisplaymode != conio_driver.displaymode);
+    pos = DAS_HEADER_SIZE;
+    if (full != 0)
+    {
+        if ((pos + 1 + (sizeof (TCOLORTABLEASCII) >> 2)) <= conio_driver.dasmirrorsize)
+        {
+            conio_driver.pdasmirror[pos++] = DAS_RECORD (DAS_RECORD_COLORTABLE, 0, 0, sizeof (TCOLORTABLEASCII) >> 2);
+            memcpy (&conio_driver.pdasmirror[pos], &colortable_ascii, sizeof (TCOLORTABLEASCII));
+            pos += sizeof (TCOLORTABLEASCII) >> 2;
+        }
+        if ((pinfo->mode > TEXTMODE) && ((pos + 1 + (sizeof (TCOLORTABLE) >> 2)) <= conio_driver.dasmirrorsize))
+        {
+            conio_driver.pdasmirror[pos++] = DAS_RECORD (DAS_RECORD_COLORTABLE, 0, 1, sizeof (TCOLORTABLE) >> 2);
+            memcpy (&conio_driver.pdasmirror[pos], &colortable_graphics, sizeof (TCOLORTABLE));
+            pos += sizeof (TCOLORTABLE) >> 2;
+        }
+        for (row = 0; row < (TERMINAL_MAXY - 1); row++)
+        {
+            conio_driver.dasgraphicsdirty[row].xmin = 0;
+            conio_driver.dasgraphicsdirty[row].xmax = TERMINAL_MAXX - 1;
+        }
+    }
+    pos = das_text_row (pos, 0, conio_driver.display[DISPLAY_BAR].pdisplay, conio_driver.display[DISPLAY_BAR].pdisplaycolor, 0, 0, full);
+    if (pinfo->mode == TEXTMODE)
+    {
+        if (conio_driver.popupactive != 0)
+        {
+            ppopup = conio_driver.display[DISPLAY_POPUP].pdisplay;
+            ppopupcolor = conio_driver.display[DISPLAY_POPUP].pdisplaycolor;
+        }
+        for (row = 0; row < (TERMINAL_MAXY - 1); row++)
+        {
+            sint32 offs = row * TERMINAL_MAXX;
+            pos = das_text_row (pos, row + 1, &pinfo->pdisplay[offs], &pinfo->pdisplaycolor[offs],
+                                (ppopup != 0) ? &ppopup[offs] : 0, (ppopupcolor != 0) ? &ppopupcolor[offs] : 0, full);
+        }
+    }
+    else if (pinfo->mode >= GRAPHICMODE_2COLOR)
+    {
+        bits = 1 << (pinfo->mode - GRAPHICMODE_2COLOR);
+        for (row = 0; row < (TERMINAL_MAXY - 1); row++)
+            pos = das_graphic_row (pos, row, pinfo->pdisplay, bits);
+    }
+    if ((full == 0) && (pos == DAS_HEADER_SIZE)) return;
+    conio_driver.dassequence += 1;
+    conio_driver.pdasmirror[0] = conio_driver.dassequence;
+    conio_driver.pdasmirror[1] = (uint32) conio_driver.displaymode | ((uint32) pinfo->mode << 8) | (((full != 0) ? DAS_FLAG_FULL : 0) << 16);
+    conio_driver.pdasmirror[2] = pos - DAS_HEADER_SIZE;
+    conio_driver.dasdisplaymode = conio_driver.displaymode;
+    conio_driver.dasrefresh = 0;
+    conio_driver.dasstatus = 1;
+}
+#endif
@@ -61,6 +61,9 @@ extern TCOLORTABLEASCII colortable_ascii;
 	TCONIO_DRIVER conio_driver;
 	TCONTROL control;
 	uint32 fifo_display[0x800];
+	//the text display with the popup layer laid over it, as it is sent to the tft
+	static TDISPLAY compose_display;
+	static TDISPLAYCOLOR compose_displaycolor;
 
 
 #if defined(__GNUC__)
@@ -80,6 +83,7 @@ extern TCOLORTABLEASCII colortable_ascii;
 void bar_display (sint32 ind, TDISPLAYENTRY * pdisplayentry);
 
 extern void showmenu (sint16 x, sint16 y, TDISPLAYENTRY * pmenulist);
+static void conio_compose (uint8 * pdisplay, uint8 * pdisplaycolor);
 
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
@@ -95,44 +99,7 @@ void conio_periodic (sint16 x, sint16 y, TDISPLAYENTRY * pmenulist, TDISPLAYENTR
 {
     sint32 i;
 #ifdef TFT_OVER_DAS
-    if ((conio_driver.dasstatus == 0) && (conio_driver.pdasmirror != 0))    //make a copy
-    {
-        i = 0;
-        memcpy32 (&conio_driver.pdasmirror[i], (uint32 *) &colortable_ascii, sizeof (TCOLORTABLEASCII) >> 2);
-        i += sizeof (TCOLORTABLEASCII) >> 2;
-        memcpy32 (&conio_driver.pdasmirror[i], (uint32 *) conio_driver.display[DISPLAY_BAR].pdisplay, sizeof (TDISPLAYBAR) >> 2);
-        i += sizeof (TDISPLAYBAR) >> 2;
-        memcpy32 (&conio_driver.pdasmirror[i], (uint32 *) conio_driver.display[DISPLAY_BAR].pdisplaycolor, sizeof (TDISPLAYBARCOLOR) >> 2);
-        i += sizeof (TDISPLAYBARCOLOR) >> 2;
-        memcpy32 (&conio_driver.pdasmirror[i], (uint32 *) conio_driver.display[conio_driver.displaymode].pdisplay, sizeof (TDISPLAY) >> 2);
-        i += sizeof (TDISPLAY) >> 2;
-        if (conio_driver.display[conio_driver.displaymode].mode == TEXTMODE)
-        {
-        	memcpy32 (&conio_driver.pdasmirror[i], (uint32 *) conio_driver.display[conio_driver.displaymode].pdisplaycolor, sizeof (TDISPLAYCOLOR) >> 2);
-        	i += sizeof (TDISPLAYCOLOR) >> 2;
-        }
-        else
-        {
-            if (conio_driver.display[conio_driver.displaymode].mode == GRAPHICMODE_4COLOR)
-            {
-                memcpy32 (&conio_driver.pdasmirror[i], (uint32 *) &conio_driver.display[conio_driver.displaymode].pdisplay[0],
-                          (GRAPHICSWIDTH / 4) >> 2);
-            }
-            if (conio_driver.display[conio_driver.displaymode].mode == GRAPHICMODE_16COLOR)
-            {
-                memcpy32 (&conio_driver.pdasmirror[i], (uint32 *) &conio_driver.display[conio_driver.displaymode].pdisplay[0],
-                          (GRAPHICSWIDTH / 2) >> 2);
-            }
-            if (conio_driver.display[conio_driver.displaymode].mode == GRAPHICMODE_256COLOR)
-            {
-                memcpy32 (&conio_driver.pdasmirror[i], (uint32 *) &conio_driver.display[conio_driver.displaymode].pdisplay[0],
-                          (GRAPHICSWIDTH / 1) >> 2);
-            }
-        }
-
-        conio_driver.dasdisplaymode = conio_driver.displaymode;
-        conio_driver.dasstatus = 1;
-    }
+    conio_das_export ();
 #endif
 
     control.timebeg[0] = __mfcr (CPU_CCNT);
@@ -169,10 +136,19 @@ void conio_periodic (sint16 x, sint16 y, TDISPLAYENTRY * pmenulist, TDISPLAYENTR
     }
 
     //All CONIO entries, dialogs etc
+    //the dialogs draw into the popup layer, the display below is kept
     //***********************************************************
+    if ((conio_driver.dialogmode == DIALOGOFF) && (conio_driver.popupactive != 0))
+    {
+        conio_popup_clear ();
+    }
     for (i=0; i<CONIO_DLG_ENTRIES; i++)
     {
-    	if (conio_dialog_list[i].dialogMode == conio_driver.dialogmode) conio_dialog_list[i].function(x, y);
+    	if (conio_dialog_list[i].dialogMode == conio_driver.dialogmode)
+    	{
+    	    conio_dialog_list[i].function(x, y);
+    	    conio_driver.popupactive = 1;
+    	}
     }
 
     //MENU
@@ -516,38 +492,51 @@ void conio_periodic (sint16 x, sint16 y, TDISPLAYENTRY * pmenulist, TDISPLAYENTR
 
     control.timeend[6] = __mfcr (CPU_CCNT);
     control.timebeg[1] = __mfcr (CPU_CCNT);
+    if ((tft_status == 0) && (conio_driver.tftdisplaymode != conio_driver.displaymode))
+    {
+        /* another display is shown, nothing of it is on the tft */
+        conio_driver.tftdisplaymode = conio_driver.displaymode;
+        conio_invalidate ();
+    }
     if (conio_driver.display[conio_driver.displaymode].mode == TEXTMODE)
     {
     	/* this is a text display */
         if (tft_status == 0)
         {
             /* we send new data to the display only when the last transfer to display is finished */
-        	tft_display_setxy (0, 0);
+            /* only the changed characters are sent, each function sets its own window */
             tft_ascii_bar (conio_driver.display[DISPLAY_BAR].pdisplay,
             		    conio_driver.display[DISPLAY_BAR].pdisplaycolor);
-            /* we wait here until our the bar is transfered to display */
-            while (tft_status != 0);
-            tft_display_setxy (0, FONT_YSIZE);
-            tft_ascii (conio_driver.display[conio_driver.displaymode].mode,
-            		    conio_driver.display[conio_driver.displaymode].pdisplay,
-                        conio_driver.display[conio_driver.displaymode].pdisplaycolor);
+            /* the bar is transfered while the first row is prepared in the second buffer */
+            if (conio_driver.popupactive != 0)
+            {
+                conio_compose (conio_driver.display[conio_driver.displaymode].pdisplay,
+                               conio_driver.display[conio_driver.displaymode].pdisplaycolor);
+                tft_ascii (conio_driver.display[conio_driver.displaymode].mode, &compose_display[0], &compose_displaycolor[0]);
+            }
+            else
+            {
+                tft_ascii (conio_driver.display[conio_driver.displaymode].mode,
+                           conio_driver.display[conio_driver.displaymode].pdisplay,
+                           conio_driver.display[conio_driver.displaymode].pdisplaycolor);
+            }
+            conio_driver.tftrefresh = 0;
         }
     }
     else
     {
-      	/* this is a graphic display */
+      	/* this is a graphic display, the popup layer is only laid over text displays */
         if (tft_status == 0)
         {
             /* we send new data to the display only when the last transfer to display is finished */
-            tft_display_setxy (0, 0);
+            /* only the changed tiles are sent, each function sets its own window */
             tft_ascii_bar (conio_driver.display[DISPLAY_BAR].pdisplay,
            		           conio_driver.display[DISPLAY_BAR].pdisplaycolor);
-            /* we wait here until our the bar is transfered to display */
-            while (tft_status != 0);
-            tft_display_setxy (0, FONT_YSIZE);
+            /* the bar is transfered while the first row is prepared in the second buffer */
             tft_graphic (conio_driver.display[conio_driver.displaymode].mode,
                          conio_driver.display[conio_driver.displaymode].pdisplay,
                          conio_driver.display[conio_driver.displaymode].pdisplaycolor);
+            conio_driver.tftrefresh = 0;
         }
     }
 
@@ -587,6 +576,8 @@ void conio_init (const pTCONIODMENTRY dm_list)
     }
     conio_driver.dasstatus = 0;
     conio_driver.pdasmirror = 0;
+    conio_driver.dasmirrorsize = 0;
+    conio_driver.dassequence = 0;
     //The first 16 entries of the colortable are preinitialized
     //Generate 128 Gray Entries
     {
@@ -600,6 +591,57 @@ void conio_init (const pTCONIODMENTRY dm_list)
     conio_driver.displaymode = DISPLAY_MENU;
     conio_driver.dasdisplaymode = DISPLAY_MENU;
     conio_driver.blinky = 0;
+    conio_driver.tftdisplaymode = DISPLAY_MENU;
+    conio_popup_clear ();
+    for (i = 0; i < (TERMINAL_MAXY - 1); i++)
+    {
+        conio_driver.graphicsdirty[i].xmin = TERMINAL_MAXX;
+        conio_driver.graphicsdirty[i].xmax = -1;
+        conio_driver.dasgraphicsdirty[i].xmin = TERMINAL_MAXX;
+        conio_driver.dasgraphicsdirty[i].xmax = -1;
+    }
+    conio_invalidate ();
+}
+
+void conio_invalidate (void)
+{
+    conio_driver.tftrefresh = 1;
+    conio_driver.dasrefresh = 1;
+}
+
+// the popup layer is laid over the text display
+// a popup cell with character 0 and color 0 is transparent
+static void conio_compose (uint8 * pdisplay, uint8 * pdisplaycolor)
+{
+    uint8 *ppopup = conio_driver.display[DISPLAY_POPUP].pdisplay;
+    uint8 *ppopupcolor = conio_driver.display[DISPLAY_POPUP].pdisplaycolor;
+    sint32 i;
+
+    for (i = 0; i < (TERMINAL_MAXX * (TERMINAL_MAXY - 1)); i += 1)
+    {
+        if ((ppopup[i] | ppopupcolor[i]) != 0)
+        {
+            compose_display[i] = ppopup[i];
+            compose_displaycolor[i] = ppopupcolor[i];
+        }
+        else
+        {
+            compose_display[i] = pdisplay[i];
+            compose_displaycolor[i] = pdisplaycolor[i];
+        }
+    }
 }
 
+void conio_popup_clear (void)
+{
+    uint32 *ppopup = (uint32 *) conio_driver.display[DISPLAY_POPUP].pdisplay;
+    uint32 *ppopupcolor = (uint32 *) conio_driver.display[DISPLAY_POPUP].pdisplaycolor;
+    uint32 i;
 
+    for (i = 0; i < ((TERMINAL_MAXX * (TERMINAL_MAXY - 1)) / 4); i += 1)
+    {
+        *ppopup++ = 0;
+        *ppopupcolor++ = 0;
+    }
+    conio_driver.popupactive = 0;
+}
@@ -135,6 +135,14 @@ typedef uint8 TDISPLAYCOLOR[TERMINAL_MAXX * (TERMINAL_MAXY - 1)];   //the colors
 typedef uint8 TDISPLAYBAR[TERMINAL_MAXX];   //the characters of the bar
 typedef uint8 TDISPLAYBARCOLOR[TERMINAL_MAXX];  //the colors of the bar
 
+//dirty tracking, the display is divided in tiles of one character (FONT_XSIZE x FONT_YSIZE pixel)
+//only the changed tiles of a character row are sent to the tft
+typedef struct DIRTYROW
+{
+    sint8 xmin;                 //first changed tile of the row, TERMINAL_MAXX if nothing changed
+    sint8 xmax;                 //last changed tile of the row, -1 if nothing changed
+} TDIRTYROW;
+
 //this structure is very important to understand the menu handling
 typedef struct DISPLAYENTRY
 {
@@ -153,6 +161,37 @@ typedef struct DISPLAYENTRY
 
 /* TDISPLAY_INFO is in conio_cfg.h */
 
+//a scrolling trend chart on a graphic display, each new sample moves the chart one pixel to the left
+//x and w are multiples of FONT_XSIZE, so that the chart lines start and end on whole bytes in all modes
+typedef struct TRENDCHART
+{
+    TDISPLAYMODE displaymode;
+    sint16 x, y;                //upper left corner of the chart
+    sint16 w, h;                //size of the chart in pixel
+    sint32 min;                 //sample value shown at the bottom line
+    sint32 scale;               //pixel per sample unit in 16.16 fixed point
+    sint16 lasty;               //line of the last sample, -1 before the first sample
+    uint8 color;                //color of the trend
+    uint8 background;           //color of the chart background
+} TTRENDCHART;
+
+//the mirror for the host (TFT_OVER_DAS) holds only the changes since the last export, all values are words
+//header: [0] sequence number, [1] displaymode | mode << 8 | DAS_FLAG_xxx << 16, [2] number of record words
+//a record starts with DAS_RECORD(type,row,x,cnt), then the data of the type:
+//DAS_RECORD_TEXT: cnt characters from column x of row (0 is the bar, 1.. the text rows), then their cnt colors,
+//  both packed 4 per word (first in the lowest byte)
+//DAS_RECORD_TILES: cnt tiles from tile x of graphic tile row, each tile FONT_YSIZE lines of FONT_XSIZE pixel
+//  as in the display buffer, the lines of one tile packed in bytes
+//DAS_RECORD_FILL: cnt tiles from tile x of graphic tile row, all bytes of the tiles have the value of the next word
+//DAS_RECORD_COLORTABLE: cnt words of the ascii (x == 0) or graphics (x == 1) colortable
+#define DAS_HEADER_SIZE 3
+#define DAS_FLAG_FULL 0x1           //the mirror starts a whole frame, the host discards its copy
+#define DAS_RECORD_TEXT 1
+#define DAS_RECORD_TILES 2
+#define DAS_RECORD_FILL 3
+#define DAS_RECORD_COLORTABLE 4
+#define DAS_RECORD(type,row,x,cnt) (((uint32)(type) << 24) | ((uint32)(row) << 16) | ((uint32)(x) << 8) | (uint32)(cnt))
+
 //the conio driver structure
 typedef struct CONIO_DRIVER
 {
@@ -160,8 +199,12 @@ typedef struct CONIO_DRIVER
     TDISPLAYENTRY *pstdlist;
     TDISPLAY_INFO display[CONIO_MAXDISPLAYS]; //contains the infos for the different displays, and pointers to buffers
     uint32 *pdasmirror;
-    uint32 dasstatus;
+    uint32 dasmirrorsize;       //size of the mirror buffer in words
+    volatile uint32 dasstatus;  //0 the host has read the mirror, 1 new data in the mirror, 2 the host requests a whole frame
+    uint32 dassequence;         //sequence number of the last export
+    uint8 dasrefresh;           //if 1 the next export sends the whole display
     TDISPLAYMODE dasdisplaymode;   //Bits 0...6 is id for mode
+    TDIRTYROW dasgraphicsdirty[TERMINAL_MAXY - 1];  //tiles of the graphic display changed since the last export
     sint32 cursorstatus;        //cursorstatus information, can be also off
     TDISPLAYMODE displaymode;   //Bits 0...6 is id for mode
     TDIALOGMODE dialogmode;     //set to the dialog to show
@@ -171,6 +214,10 @@ typedef struct CONIO_DRIVER
     sint32 inputid;             //in keyboard mode this id contains the entry selected for input
     sint8 scanfx;               //actual position for keyboard entry
     uint8 blinky;               //blinky cursor, to show where the input marker is
+    TDISPLAYMODE tftdisplaymode;    //the display last sent to the tft
+    uint8 tftrefresh;           //if 1 the next transfer sends the whole display, not only the changed tiles
+    TDIRTYROW graphicsdirty[TERMINAL_MAXY - 1]; //changed tiles of the graphic displays
+    uint8 popupactive;          //if 1 the popup layer is laid over the text display
 } TCONIO_DRIVER;
 
 
@@ -205,6 +252,11 @@ extern TCONTROL control;
 //the output to the TFT
 void conio_init (const pTCONIODMENTRY dm_list);
 void conio_periodic (sint16 x, sint16 y, TDISPLAYENTRY * pmenulist, TDISPLAYENTRY * pstdlist);  //this function is called out of the timer tick
+void conio_invalidate (void);   //the whole display is sent with the next conio_periodic (e.g. after a colortable change)
+void conio_popup_clear (void);  //the popup layer gets transparent, the displays below are visible again
+#ifdef TFT_OVER_DAS
+void conio_das_export (void);   //the changes since the last export are written to the mirror, if the host has read it
+#endif
 //specific entries libtft.c
 void conio_ascii_putch (TDISPLAYMODE displaymode, uint8 ch);    /* Writes a character directly to the console. */
 int conio_ascii_getch (TDISPLAYMODE displaymode);   /* Reads a character directly from the console, without echo. */
@@ -221,6 +273,7 @@ void conio_ascii_textchangebackground (TDISPLAYMODE displaymode, sint32 color);
 void conio_ascii_textchangeforeground (TDISPLAYMODE displaymode, sint32 color);
 void conio_ascii_textchangecolor (TDISPLAYMODE displaymode, sint32 color);
 void conio_ascii_printfxy (TDISPLAYMODE displaymode, sint32 x, sint32 y, const uint8 * format, ...);
+void conio_ascii_putsxy (TDISPLAYMODE displaymode, sint32 x, sint32 y, const uint8 * s);    //printfxy without format, e.g. for Ifx_Format texts
 void conio_ascii_printf (TDISPLAYMODE displaymode, const uint8 * format, ...);
 void conio_ascii_char (TDISPLAYMODE displaymode, sint32 x, sint32 y, uint8 ch, uint8 color);
 void conio_ascii_setcolortable (uint32 ind, uint32 r, uint32 g, uint32 b);
@@ -238,6 +291,15 @@ void conio_graphics_set (TDISPLAYMODE displaymode, sint32 x, sint32 y, uint8 col
 void conio_graphics_line (TDISPLAYMODE displaymode, sint32 x1, sint32 y1, sint32 x2, sint32 y2, uint8 color);
 void conio_graphics_setcolortable (uint32 ind, uint32 r, uint32 g, uint32 b);
 void conio_graphics_char (TDISPLAYMODE displaymode, sint32 x, sint32 y, uint8 ch, uint8 color);
+void conio_graphics_dirty (TDISPLAYMODE displaymode, sint32 x, sint32 y);    //mark the tile of the pixel x,y as changed
+//the primitives below clip once per primitive and write whole bytes where possible
+void conio_graphics_hline (TDISPLAYMODE displaymode, sint32 x1, sint32 x2, sint32 y, uint8 color);
+void conio_graphics_fillrect (TDISPLAYMODE displaymode, sint32 x, sint32 y, sint32 w, sint32 h, uint8 color);
+void conio_graphics_polyline (TDISPLAYMODE displaymode, const sint16 * ppoints, sint32 cnt, uint8 color);  //cnt points as x,y pairs
+void conio_graphics_arc (TDISPLAYMODE displaymode, sint32 xc, sint32 yc, sint32 r, uint8 octants, uint8 color);  //bit n of octants draws 45*n..45*(n+1) degree
+void conio_graphics_trend_init (TTRENDCHART * pchart, TDISPLAYMODE displaymode, sint32 x, sint32 y, sint32 w, sint32 h,
+                                sint32 min, sint32 max, uint8 color, uint8 background);
+void conio_graphics_trend_append (TTRENDCHART * pchart, sint32 value);
 
 #define TOKEN_DISPLAY_GRAPHICS_LINE 0x0000FFE1
 #define TOKEN_DISPLAY_ASCII_CLRSCR 0x0000FFE2
@@ -264,6 +326,7 @@ void conio_graphics_char (TDISPLAYMODE displaymode, sint32 x, sint32 y, uint8 ch
 
 void display_ascii_clrscr (TDISPLAYMODE displaymode);
 void display_ascii_printfxy (TDISPLAYMODE displaymode, sint32 x, sint32 y, const uint8 * format, ...);
+void display_ascii_putsxy (TDISPLAYMODE displaymode, sint32 x, sint32 y, const uint8 * s);
 void display_ascii_printf (TDISPLAYMODE displaymode, const uint8 * format, ...);
 void display_ascii_clreol (TDISPLAYMODE displaymode);
 void display_ascii_textattr (TDISPLAYMODE displaymode, sint32 color);
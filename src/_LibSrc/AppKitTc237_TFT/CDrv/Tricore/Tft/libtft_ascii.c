@@ -22,6 +22,21 @@
 /******************************************************************************/
 /*-----------------------------------Macros-----------------------------------*/
 /******************************************************************************/
+// the glyph cache has GLYPH_SETS sets of GLYPH_WAYS glyphs, the set is selected by character and color
+#define GLYPH_SETS 8
+#define GLYPH_WAYS 4
+
+/******************************************************************************/
+/*------------------------------Type Definitions------------------------------*/
+/******************************************************************************/
+// one character in one color pair, expanded to the pixel pairs of Row_Buff
+typedef struct
+{
+    uint32 pixels[FONT_YSIZE][FONT_XSIZE / 2];  //rows in Row_Buff order (last font row first)
+    uint16 key;                                 //character | color << 8
+    uint16 valid;
+    uint32 used;                                //time of the last use, the least recently used glyph is replaced
+} TGLYPH;
 
 /******************************************************************************/
 /*------------------------Private Variables/Constants-------------------------*/
@@ -69,10 +84,23 @@ TCOLORTABLEASCII colortable_ascii =
 };
 
 static TMODE cpy_mode;
-static uint8 *cpy_pdisplay;
-static uint8 *cpy_pdisplaycolor;
 
-static uint32 YROW_cnt;
+//characters and colors last sent to the tft, row 0 is the bar
+//the transfer is prepared from this copy, the displays may be redrawn meanwhile without flicker
+static uint8 sent_display[TERMINAL_MAXY * TERMINAL_MAXX];
+static uint8 sent_displaycolor[TERMINAL_MAXY * TERMINAL_MAXX];
+
+//dirty rectangles of the actual transfer, in transfer order
+static sint8 dirty_row[TERMINAL_MAXY];      //text row
+static sint8 dirty_xmin[TERMINAL_MAXY];     //first character
+static sint8 dirty_xcnt[TERMINAL_MAXY];     //number of characters
+static sint8 dirty_nrows[TERMINAL_MAXY];    //number of rows of the window, 0 if the row continues the window of the previous one
+static uint32 dirty_cnt;
+static uint32 dirty_ind;
+
+//expanded glyphs of the characters displayed last
+static TGLYPH glyph_cache[GLYPH_SETS][GLYPH_WAYS];
+static uint32 glyph_time;
 
 #if defined(__GNUC__)
 #pragma section
@@ -90,6 +118,7 @@ static uint32 YROW_cnt;
 /******************************************************************************/
 /*-------------------------Function Prototypes--------------------------------*/
 /******************************************************************************/
+static void tft_glyph_invalidate (void);
 
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
@@ -223,19 +252,29 @@ void display_ascii_cputs (TDISPLAYMODE displaymode, uint8 * s)
 
 void display_ascii_printfxy (TDISPLAYMODE displaymode, sint32 x, sint32 y, const uint8 * format, ...)
 {
-    sint32 result, len;
+    sint32 result;
     uint8 buffer[80];
-    sint32 i;
-    uint32 *pbuf;
     va_list ap;
     va_start (ap, format);
     result = vsprintf ((char *)buffer, (char *)format, ap);
     va_end (ap);
     if (result < 0)
         return;
-    len = strlen ((char *)buffer) + 1;
+    display_ascii_putsxy (displaymode, x, y, &buffer[0]);
+}
+
+// same as display_ascii_printfxy for a text already formatted, e.g. with Ifx_Format: no vsprintf
+void display_ascii_putsxy (TDISPLAYMODE displaymode, sint32 x, sint32 y, const uint8 * s)
+{
+    sint32 len;
+    uint32 buffer[(TERMINAL_MAXX + 3) / 4];    //word aligned copy, the fifo is written by words
+    sint32 i;
+    uint32 *pbuf;
+    len = strlen ((char *)s) + 1;
     if (len > TERMINAL_MAXX)
         len = TERMINAL_MAXX;               //cut it down
+    memcpy (&buffer[0], s, len - 1);
+    ((uint8 *) & buffer[0])[len - 1] = 0;
     if ((len & 0x03) != 0)
         len = (len | 0x3) + 1;  //always 4byte granaluraty
     len = len >> 2;
@@ -246,7 +285,7 @@ void display_ascii_printfxy (TDISPLAYMODE displaymode, sint32 x, sint32 y, const
         PUT_FIFO_DISPLAY ((len << 16) + TOKEN_DISPLAY_ASCII_PRINTFXY);
         PUT_FIFO_DISPLAY (displaymode);
         PUT_FIFO_DISPLAY ((x << 16) + y);
-        pbuf = (uint32 *) & buffer[0];
+        pbuf = &buffer[0];
         for (i = 0; i < (len - 3); i += 1)
         {
             PUT_FIFO_DISPLAY (pbuf[i]);
@@ -296,6 +335,9 @@ void conio_ascii_setcolortable (uint32 ind, uint32 r, uint32 g, uint32 b)
     b = b >> 3;                 //b has only 5bit
 
     colortable_ascii[ind] = (r << 11) | (g << 5) | b;
+    // the expanded glyphs and the characters already on the display have the old color
+    tft_glyph_invalidate ();
+    conio_invalidate ();
 }
 
 void conio_ascii_clrscr (TDISPLAYMODE displaymode)
@@ -512,6 +554,13 @@ void conio_ascii_printfxy (TDISPLAYMODE displaymode, sint32 x, sint32 y, const u
     conio_ascii_cputs (displaymode, &buffer[0]);
 }
 
+// same as conio_ascii_printfxy for a text already formatted, e.g. with Ifx_Format: no vsprintf
+void conio_ascii_putsxy (TDISPLAYMODE displaymode, sint32 x, sint32 y, const uint8 * s)
+{
+    conio_ascii_gotoxy (displaymode, x, y);
+    conio_ascii_cputs (displaymode, (uint8 *)s);
+}
+
 // based on ascii
 void conio_ascii_printf (TDISPLAYMODE displaymode, const uint8 * format, ...)
 {
@@ -529,83 +578,183 @@ void conio_ascii_printf (TDISPLAYMODE displaymode, const uint8 * format, ...)
     conio_ascii_cputs (displaymode, &buffer[0]);
 }
 
-static void tft_prepare_ascii_line (uint8 * pdisplay, uint8 * pdisplaycolor)
+static void tft_glyph_invalidate (void)
 {
-    sint32 j, k, l, ind;
-    uint32 buffer_cnt;
-//    uint16 *pRowBuff;
-    uint8 mask;
-    uint8 color_bgnd, color_fgnd;
+    sint32 i, j;
 
-    buffer_cnt = 1;
-//    pRowBuff = &Row_Buff[0];
+    for (i = 0; i < GLYPH_SETS; i += 1)
+        for (j = 0; j < GLYPH_WAYS; j += 1)
+            glyph_cache[i][j].valid = 0;
+}
 
-    for (k = FONT_YSIZE - 1; k >= 0; k -= 1)    //Height of FONT-1
+// returns the pixel pairs of the character ch in the color pair color
+// the glyph is expanded once in the cache, the pairs are swapped like the pixels of Row_Buff
+static const uint32 *tft_glyph (uint8 ch, uint8 color)
+{
+    TGLYPH *pset = &glyph_cache[(ch ^ color) & (GLYPH_SETS - 1)][0];
+    TGLYPH *pglyph = &pset[0];
+    uint16 key = ch | (color << 8);
+    uint32 color_bgnd, color_fgnd;
+    sint32 j, k;
+
+    glyph_time++;
+    for (j = 0; j < GLYPH_WAYS; j += 1)
     {
-        for (j = 0; j < TERMINAL_MAXX; j += 1)  //40 characters for 320 Pixel
+        if ((pset[j].valid != 0) && (pset[j].key == key))
         {
-            ind = pdisplay[j];
-            color_bgnd = (pdisplaycolor[j] >> 4) & 0x0F;
-            color_fgnd = pdisplaycolor[j] & 0x0F;
-            mask = 0x80;
-            for (l = 0; l < FONT_XSIZE; l += 1) //each character has 8 x values
-            {
-                if ((__font_bitmap__8_12[(ind * FONT_YSIZE) + k] & mask) != 0)
-                {
-                    Row_Buff[buffer_cnt] = colortable_ascii[color_fgnd];
-                    if (buffer_cnt & 0x1) buffer_cnt--;
-                    else buffer_cnt += 3;
-                }
-                else
-                {
-                	Row_Buff[buffer_cnt] = colortable_ascii[color_bgnd];
-                    if (buffer_cnt & 0x1) buffer_cnt--;
-                    else buffer_cnt += 3;
-                }
-                mask = mask >> 1;
-            }
+            pset[j].used = glyph_time;
+            return &pset[j].pixels[0][0];
         }
+        // invalid glyphs first, then the least recently used one
+        if ((pglyph->valid != 0) && ((pset[j].valid == 0) || (pset[j].used < pglyph->used)))
+            pglyph = &pset[j];
     }
+
+    color_bgnd = colortable_ascii[(color >> 4) & 0x0F];
+    color_fgnd = colortable_ascii[color & 0x0F];
+    for (k = 0; k < FONT_YSIZE; k += 1)
+    {
+        uint8 bits = __font_bitmap__8_12[(ch * FONT_YSIZE) + FONT_YSIZE - 1 - k];
+        for (j = 0; j < (FONT_XSIZE / 2); j += 1)
+        {
+            uint32 first = ((bits & 0x80) != 0) ? color_fgnd : color_bgnd;
+            uint32 second = ((bits & 0x40) != 0) ? color_fgnd : color_bgnd;
+            pglyph->pixels[k][j] = second | (first << 16);
+            bits = bits << 2;
+        }
+    }
+    pglyph->key = key;
+    pglyph->valid = 1;
+    pglyph->used = glyph_time;
+    return &pglyph->pixels[0][0];
+}
+
+// we prepare xcnt characters starting with character xmin
+// each pixel row of a character is copied from the glyph cache with FONT_XSIZE/2 word stores
+static void tft_prepare_ascii_line (uint8 * pdisplay, uint8 * pdisplaycolor, sint32 xmin, sint32 xcnt)
+{
+    sint32 j, k;
+    const uint32 *pglyph;
+    uint32 *pdst;
+
+    for (j = 0; j < xcnt; j += 1)  //up to 40 characters for 320 Pixel
+    {
+        pglyph = tft_glyph (pdisplay[xmin + j], pdisplaycolor[xmin + j]);
+        pdst = (uint32 *) &Row_Buff[j * FONT_XSIZE];
+        for (k = 0; k < FONT_YSIZE; k += 1)    //Height of FONT
+        {
+            pdst[0] = pglyph[0];
+            pdst[1] = pglyph[1];
+            pdst[2] = pglyph[2];
+            pdst[3] = pglyph[3];
+            pglyph += FONT_XSIZE / 2;
+            pdst += (xcnt * FONT_XSIZE) / 2;
+        }
+    }
+}
+
+// we compare the row with the characters last sent to the tft (row 0 is the bar)
+// returns the number of changed characters, *pxmin is the first changed character
+static sint32 tft_ascii_dirty (uint8 * pdisplay, uint8 * pdisplaycolor, sint32 row, sint32 * pxmin)
+{
+    sint32 j, xmin, xmax;
+    uint8 *psent = &sent_display[row*TERMINAL_MAXX];
+    uint8 *psentcolor = &sent_displaycolor[row*TERMINAL_MAXX];
+
+    xmin = TERMINAL_MAXX;
+    xmax = -1;
+    for (j = 0; j < TERMINAL_MAXX; j += 1)
+    {
+        if ((conio_driver.tftrefresh != 0) || (pdisplay[j] != psent[j]) || (pdisplaycolor[j] != psentcolor[j]))
+        {
+            if (xmin == TERMINAL_MAXX) xmin = j;
+            xmax = j;
+            psent[j] = pdisplay[j];
+            psentcolor[j] = pdisplaycolor[j];
+        }
+    }
+    *pxmin = xmin;
+    return xmax - xmin + 1;
 }
 
 static uint32 tft_ascii_line_written(void)
 {
+    sint32 row = dirty_row[dirty_ind];
+    sint32 xmin = dirty_xmin[dirty_ind];
+    sint32 xcnt = dirty_xcnt[dirty_ind];
+    sint32 nrows = dirty_nrows[dirty_ind];
+    uint32 y;
+
+    if (nrows != 0)
+    {
+        // this row starts a new window
+        // the last text row is displayed first below the bar
+        y = (TERMINAL_MAXY - 1 - row) * FONT_YSIZE;
+        tft_window_row_buff (xmin*FONT_XSIZE, y, (xmin + xcnt)*FONT_XSIZE - 1, y + nrows*FONT_YSIZE - 1);
+    }
     // we prepare the ascii line
-	tft_prepare_ascii_line (&cpy_pdisplay[YROW_cnt*TERMINAL_MAXX], &cpy_pdisplaycolor[YROW_cnt*TERMINAL_MAXX]);
+	tft_prepare_ascii_line (&sent_display[(row + 1)*TERMINAL_MAXX], &sent_displaycolor[(row + 1)*TERMINAL_MAXX], xmin, xcnt);
 
-	if (YROW_cnt == 0)
+    dirty_ind++;
+	if (dirty_ind == dirty_cnt)
 	{
-		// this is our last/first ascii line
+		// this is our last changed ascii line
 		// we send the Row_Buff to the display without callback function
-	    tft_flush_row_buff( (void *)0, FONT_YSIZE*TERMINAL_MAXX*FONT_XSIZE);
+	    tft_flush_row_buff( (void *)0, FONT_YSIZE*xcnt*FONT_XSIZE);
 	}
 	else
 	{
-		// this is not our last/first ascii line
+		// this is not our last changed ascii line
 		// we send the Row_Buff to the display with callback function
-	    YROW_cnt--;
-	    tft_flush_row_buff( &tft_ascii_line_written, FONT_YSIZE*TERMINAL_MAXX*FONT_XSIZE);
+	    tft_flush_row_buff( &tft_ascii_line_written, FONT_YSIZE*xcnt*FONT_XSIZE);
 	}
 	return 0;
 }
 
 void tft_ascii_bar (uint8 * pdisplay, uint8 * pdisplaycolor)
 {
+    sint32 xmin, xcnt;
+
+    xcnt = tft_ascii_dirty (pdisplay, pdisplaycolor, 0, &xmin);
+    if (xcnt <= 0) return;      //the bar has not changed
+    tft_window_row_buff (xmin*FONT_XSIZE, 0, (xmin + xcnt)*FONT_XSIZE - 1, FONT_YSIZE - 1);
     // we prepare the ascii line
-	tft_prepare_ascii_line (pdisplay, pdisplaycolor);
+	tft_prepare_ascii_line (&sent_display[0], &sent_displaycolor[0], xmin, xcnt);
     // we send the Row_Buff to the display
-    tft_flush_row_buff( (void *)0, FONT_YSIZE*TERMINAL_MAXX*FONT_XSIZE);
+    tft_flush_row_buff( (void *)0, FONT_YSIZE*xcnt*FONT_XSIZE);
 }
 
 void tft_ascii (TMODE mode, uint8 * pdisplay, uint8 * pdisplaycolor)
 {
-    //copy values in global variables for tft_prepare_ascii_line
+    sint32 row, xmin, xcnt, start;
+
     cpy_mode = mode;
-    cpy_pdisplay = pdisplay;
-    cpy_pdisplaycolor = pdisplaycolor;
 	// we remove one line from display which is used by bar
-	YROW_cnt = TERMINAL_MAXY-2;
-	// send the
-	tft_ascii_line_written();
+    // and collect the changed characters from the last to the first row
+    dirty_cnt = 0;
+    start = 0;
+    for (row = TERMINAL_MAXY - 2; row >= 0; row--)
+    {
+        xcnt = tft_ascii_dirty (&pdisplay[row*TERMINAL_MAXX], &pdisplaycolor[row*TERMINAL_MAXX], row + 1, &xmin);
+        if (xcnt <= 0) continue;
+        dirty_row[dirty_cnt] = row;
+        dirty_xmin[dirty_cnt] = xmin;
+        dirty_xcnt[dirty_cnt] = xcnt;
+        // rows with the same characters below each other on the display are sent in one window
+        if ((dirty_cnt != 0) && (dirty_row[dirty_cnt - 1] == (row + 1))
+            && (dirty_xmin[start] == xmin) && (dirty_xcnt[start] == xcnt))
+        {
+            dirty_nrows[dirty_cnt] = 0;
+            dirty_nrows[start] += 1;
+        }
+        else
+        {
+            dirty_nrows[dirty_cnt] = 1;
+            start = dirty_cnt;
+        }
+        dirty_cnt++;
+    }
+    dirty_ind = 0;
+	// send the changed characters
+    if (dirty_cnt != 0) tft_ascii_line_written();
 }
-
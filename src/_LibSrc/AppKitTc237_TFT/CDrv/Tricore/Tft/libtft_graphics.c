@@ -22,6 +22,16 @@
 /******************************************************************************/
 /*-----------------------------------Macros-----------------------------------*/
 /******************************************************************************/
+#define GRAPHICS_YSIZE (TFT_YSIZE - FONT_YSIZE)   //lines of the graphic display, the last character line is the bar
+
+//the layout of a graphic display, the primitives write the pixels without the mode switch
+typedef struct GRAPHICS_TARGET
+{
+    uint8 *pdata;               //the display buffer
+    uint32 bits;                //bits per pixel
+    uint32 mask;                //mask of one pixel
+    uint8 fill;                 //the color repeated in a whole byte
+} TGRAPHICS_TARGET;
 
 /******************************************************************************/
 /*------------------------Private Variables/Constants-------------------------*/
@@ -88,6 +98,21 @@ static uint8 *cpy_pdisplaycolor;
 
 static uint32 YSIZE_cnt;
 
+//expansion of one source byte into pixel pairs of the Row_Buff, for the palette and mode of expand_mode:
+//2 colors 4 pairs, 4 colors 2 pairs, 16 colors 1 pair per byte (the 256 colors use the palette directly)
+//each pair is one 32bit word with the two pixels swapped for the 32bit transfer
+static uint32 expand_table[256*4];
+static TMODE expand_mode;
+static boolean expand_valid;
+
+//dirty rectangles of the actual transfer, in transfer order
+static sint8 dirty_row[TERMINAL_MAXY];      //graphic row of FONT_YSIZE lines
+static sint8 dirty_xmin[TERMINAL_MAXY];     //first tile
+static sint8 dirty_xcnt[TERMINAL_MAXY];     //number of tiles
+static sint8 dirty_nrows[TERMINAL_MAXY];    //number of rows of the window, 0 if the row continues the window of the previous one
+static uint32 dirty_cnt;
+static uint32 dirty_ind;
+
 #if defined(__GNUC__)
 #pragma section
 #endif
@@ -275,12 +300,51 @@ void conio_graphics_setcolortable (uint32 ind, uint32 r, uint32 g, uint32 b)
     b = b >> 3;                 //b has only 5bit
 
     colortable_graphics[ind] = (r << 11) | (g << 5) | b;
+    // the expansion table is rebuilt with the new palette at the next refresh
+    expand_valid = FALSE;
+    // the pixels already on the display have the old color
+    conio_invalidate ();
+}
+
+// mark the tile of the pixel x,y as changed, only the shown display is tracked
+void conio_graphics_dirty (TDISPLAYMODE displaymode, sint32 x, sint32 y)
+{
+    TDIRTYROW *pdirty;
+    sint32 row, col;
+
+    if (displaymode != conio_driver.displaymode) return;
+    row = y / FONT_YSIZE;
+    col = x / FONT_XSIZE;
+    if (row > (TERMINAL_MAXY - 2)) row = TERMINAL_MAXY - 2;
+    if (col > (TERMINAL_MAXX - 1)) col = TERMINAL_MAXX - 1;
+    pdirty = &conio_driver.graphicsdirty[row];
+    if (col < pdirty->xmin) pdirty->xmin = col;
+    if (col > pdirty->xmax) pdirty->xmax = col;
+#ifdef TFT_OVER_DAS
+    pdirty = &conio_driver.dasgraphicsdirty[row];
+    if (col < pdirty->xmin) pdirty->xmin = col;
+    if (col > pdirty->xmax) pdirty->xmax = col;
+#endif
+}
+
+// mark the whole graphic display as changed
+static void conio_graphics_dirty_all (TDISPLAYMODE displaymode)
+{
+    sint32 row;
+
+    if (displaymode != conio_driver.displaymode) return;
+    for (row = 0; row < (TERMINAL_MAXY - 1); row += 1)
+    {
+        conio_graphics_dirty (displaymode, 0, row * FONT_YSIZE);
+        conio_graphics_dirty (displaymode, TFT_XSIZE - 1, row * FONT_YSIZE);
+    }
 }
 
 void conio_graphics_clrscr (TDISPLAYMODE displaymode)
 {
     sint32 i;
 
+    conio_graphics_dirty_all (displaymode);
     switch (conio_driver.display[displaymode].mode)
     {
 
@@ -421,14 +485,15 @@ inline void conio_graphics_set_opt (TDISPLAYMODE displaymode, sint32 x, sint32 y
         if (0 > y || y > (TFT_YSIZE - FONT_YSIZE)) ;
         else
         {
+            conio_graphics_dirty (displaymode, x, y);
             switch (conio_driver.display[displaymode].mode)
             {
             case GRAPHICMODE_2COLOR:
                 offs = x + y * TFT_XSIZE;
                 if (color == 0)
-                    video_data[offs >> 3] &= ~(1 << (offs & 0xF));
+                    video_data[offs >> 3] &= ~(1 << (offs & 0x7));
                 else
-                    video_data[offs >> 3] |= (1 << (offs & 0xF));
+                    video_data[offs >> 3] |= (1 << (offs & 0x7));
                 break;
             case GRAPHICMODE_4COLOR:
                 offs = x + y * TFT_XSIZE;
@@ -461,84 +526,358 @@ inline void conio_graphics_set_opt (TDISPLAYMODE displaymode, sint32 x, sint32 y
     }
 }
 
-void conio_graphics_line (TDISPLAYMODE displaymode, sint32 x1, sint32 y1, sint32 x2, sint32 y2, uint8 color)
+// returns the layout of a graphic display and the color repeated in a whole byte
+static boolean graphics_target (TDISPLAYMODE displaymode, uint8 color, TGRAPHICS_TARGET * ptarget)
 {
-    int xofs, yofs, dx,         //deltas
-    dy, dx2,                   //scaled deltas
-    dy2, ix,                   //increase rate on the x axis
-    iy,                        //increase rate on the y axis
-    err,                       //the error term
-    i;                         //looping variable
+    TMODE mode = conio_driver.display[displaymode].mode;
+    uint32 i;
 
+    if ((mode < GRAPHICMODE_2COLOR) || (mode > GRAPHICMODE_256COLOR))
+    {
+        /* This is not a valid graphic display */
+        __debug ();
+        return FALSE;
+    }
+    ptarget->pdata = conio_driver.display[displaymode].pdisplay;
+    ptarget->bits = 1 << (mode - GRAPHICMODE_2COLOR);
+    ptarget->mask = (1 << ptarget->bits) - 1;
+    ptarget->fill = color & ptarget->mask;
+    for (i = ptarget->bits; i < 8; i <<= 1)
+        ptarget->fill |= ptarget->fill << i;
+    return TRUE;
+}
 
-    // difference between starting and ending points
-    dx = x2 - x1;
-    dy = y2 - y1;
+// set the pixel offs = x + y * TFT_XSIZE, the pixel must be inside the display
+static inline void graphics_plot (const TGRAPHICS_TARGET * ptarget, sint32 offs)
+{
+    uint32 bit = offs * ptarget->bits;
+    uint8 *p = &ptarget->pdata[bit >> 3];
+    uint8 mask = (uint8) (ptarget->mask << (bit & 0x7));
 
-    // calculate direction of the vector and store in ix and iy
-    if (dx >= 0)
-        ix = 1;
+    *p = (*p & ~mask) | (ptarget->fill & mask);
+}
 
-    if (dx < 0)
+// set the pixels x1..x2 of line y, the span must be inside the display
+// only the first and the last byte are written pixel by pixel, the bytes between get the repeated color
+static void graphics_span (const TGRAPHICS_TARGET * ptarget, sint32 x1, sint32 x2, sint32 y)
+{
+    uint32 bit1 = (y * TFT_XSIZE + x1) * ptarget->bits;
+    uint32 bit2 = (y * TFT_XSIZE + x2 + 1) * ptarget->bits;
+    uint8 *p = &ptarget->pdata[bit1 >> 3];
+    uint8 *pend = &ptarget->pdata[bit2 >> 3];
+    uint8 mask;
+
+    if ((bit1 & 0x7) != 0)
     {
-        ix = -1;
-        dx = -dx;
+        mask = (uint8) (0xFF << (bit1 & 0x7));
+        if (p == pend) mask &= (uint8) ~(0xFF << (bit2 & 0x7));
+        *p = (*p & ~mask) | (ptarget->fill & mask);
+        if (p == pend) return;
+        p++;
     }
+    memset (p, ptarget->fill, pend - p);
+    if ((bit2 & 0x7) != 0)
+    {
+        mask = (uint8) ~(0xFF << (bit2 & 0x7));
+        *pend = (*pend & ~mask) | (ptarget->fill & mask);
+    }
+}
 
-    if (dy >= 0)
-        //        iy = (pitch >> 1);
-        iy = 1;
+// mark the tiles of the rectangle as changed, the rectangle must be inside the display
+static void graphics_dirty_rect (TDISPLAYMODE displaymode, sint32 x1, sint32 y1, sint32 x2, sint32 y2)
+{
+    sint32 row;
 
+    for (row = y1 / FONT_YSIZE; row <= (y2 / FONT_YSIZE); row++)
+    {
+        conio_graphics_dirty (displaymode, x1, row * FONT_YSIZE);
+        conio_graphics_dirty (displaymode, x2, row * FONT_YSIZE);
+    }
+}
+
+// Cohen-Sutherland outcode of a point
+static uint32 graphics_outcode (sint32 x, sint32 y)
+{
+    uint32 code = 0;
+
+    if (x < 0) code |= 0x1;
+    else if (x >= TFT_XSIZE) code |= 0x2;
+    if (y < 0) code |= 0x4;
+    else if (y >= GRAPHICS_YSIZE) code |= 0x8;
+    return code;
+}
+
+// clip the line to the display, returns FALSE if nothing is visible
+static boolean graphics_clip_line (sint32 * px1, sint32 * py1, sint32 * px2, sint32 * py2)
+{
+    uint32 code1 = graphics_outcode (*px1, *py1);
+    uint32 code2 = graphics_outcode (*px2, *py2);
+    uint32 code;
+    sint32 x, y;
+
+    while ((code1 | code2) != 0)
+    {
+        if ((code1 & code2) != 0) return FALSE;
+        code = (code1 != 0) ? code1 : code2;
+        if ((code & 0x1) != 0)
+        {
+            x = 0;
+            y = *py1 + ((*py2 - *py1) * (x - *px1)) / (*px2 - *px1);
+        }
+        else if ((code & 0x2) != 0)
+        {
+            x = TFT_XSIZE - 1;
+            y = *py1 + ((*py2 - *py1) * (x - *px1)) / (*px2 - *px1);
+        }
+        else if ((code & 0x4) != 0)
+        {
+            y = 0;
+            x = *px1 + ((*px2 - *px1) * (y - *py1)) / (*py2 - *py1);
+        }
+        else
+        {
+            y = GRAPHICS_YSIZE - 1;
+            x = *px1 + ((*px2 - *px1) * (y - *py1)) / (*py2 - *py1);
+        }
+        if (code == code1)
+        {
+            *px1 = x;
+            *py1 = y;
+            code1 = graphics_outcode (x, y);
+        }
+        else
+        {
+            *px2 = x;
+            *py2 = y;
+            code2 = graphics_outcode (x, y);
+        }
+    }
+    return TRUE;
+}
+
+// Bresenham line, clipped once, the pixel offset is stepped instead of computed for each pixel
+static void graphics_segment (TDISPLAYMODE displaymode, const TGRAPHICS_TARGET * ptarget, sint32 x1, sint32 y1, sint32 x2, sint32 y2)
+{
+    sint32 dx, dy, sx, sy, err, i, offs;
+
+    if (graphics_clip_line (&x1, &y1, &x2, &y2) == FALSE) return;
+    graphics_dirty_rect (displaymode, (x1 < x2) ? x1 : x2, (y1 < y2) ? y1 : y2, (x1 < x2) ? x2 : x1, (y1 < y2) ? y2 : y1);
+    dx = x2 - x1;
+    dy = y2 - y1;
+    sx = 1;
+    sy = TFT_XSIZE;
+    if (dx < 0)
+    {
+        dx = -dx;
+        sx = -1;
+    }
     if (dy < 0)
     {
-        //        iy = -(pitch >> 1);
-        iy = -1;
         dy = -dy;
+        sy = -TFT_XSIZE;
     }
-
-    // scale deltas and store in dx2 and dy2
-    dx2 = dx * 2;
-    dy2 = dy * 2;
-    xofs = 0;
-    yofs = 0;
+    offs = x1 + y1 * TFT_XSIZE;
     if (dx > dy)
     {                           // dx is the major axis
-        // initialize the error term
-        err = dy2 - dx;
-
+        err = 2 * dy - dx;
         for (i = 0; i <= dx; i++)
         {
-            conio_graphics_set_opt (displaymode, x1 + xofs, y1 + yofs, color);
+            graphics_plot (ptarget, offs);
             if (err >= 0)
             {
-                err -= dx2;
-                //ptr_vid += iy;
-                yofs += iy;
+                err -= 2 * dx;
+                offs += sy;
             }
-            err += dy2;
-            //ptr_vid += ix;
-            xofs += ix;
+            err += 2 * dy;
+            offs += sx;
         }
     }
     else
     {                           // dy is the major axis
-        // initialize the error term
-        err = dx2 - dy;
-
+        err = 2 * dx - dy;
         for (i = 0; i <= dy; i++)
         {
-            conio_graphics_set_opt (displaymode, x1 + xofs, y1 + yofs, color);
+            graphics_plot (ptarget, offs);
             if (err >= 0)
             {
-                err -= dy2;
-                xofs += ix;
+                err -= 2 * dy;
+                offs += sx;
             }
-            err += dx2;
-            //ptr_vid += iy;
-            yofs += iy;
+            err += 2 * dx;
+            offs += sy;
+        }
+    }
+}
+
+void conio_graphics_line (TDISPLAYMODE displaymode, sint32 x1, sint32 y1, sint32 x2, sint32 y2, uint8 color)
+{
+    TGRAPHICS_TARGET target;
+
+    if (graphics_target (displaymode, color, &target) == FALSE) return;
+    graphics_segment (displaymode, &target, x1, y1, x2, y2);
+}
+
+void conio_graphics_polyline (TDISPLAYMODE displaymode, const sint16 * ppoints, sint32 cnt, uint8 color)
+{
+    TGRAPHICS_TARGET target;
+    sint32 i;
+
+    if (graphics_target (displaymode, color, &target) == FALSE) return;
+    for (i = 1; i < cnt; i++)
+    {
+        graphics_segment (displaymode, &target, ppoints[2 * i - 2], ppoints[2 * i - 1], ppoints[2 * i], ppoints[2 * i + 1]);
+    }
+}
+
+void conio_graphics_hline (TDISPLAYMODE displaymode, sint32 x1, sint32 x2, sint32 y, uint8 color)
+{
+    TGRAPHICS_TARGET target;
+    sint32 x;
+
+    if (x1 > x2)
+    {
+        x = x1;
+        x1 = x2;
+        x2 = x;
+    }
+    if (x1 < 0) x1 = 0;
+    if (x2 > (TFT_XSIZE - 1)) x2 = TFT_XSIZE - 1;
+    if ((x1 > x2) || (y < 0) || (y >= GRAPHICS_YSIZE)) return;
+    if (graphics_target (displaymode, color, &target) == FALSE) return;
+    graphics_dirty_rect (displaymode, x1, y, x2, y);
+    graphics_span (&target, x1, x2, y);
+}
+
+void conio_graphics_fillrect (TDISPLAYMODE displaymode, sint32 x, sint32 y, sint32 w, sint32 h, uint8 color)
+{
+    TGRAPHICS_TARGET target;
+    sint32 x1, y1, x2, y2;
+
+    x1 = (x < 0) ? 0 : x;
+    y1 = (y < 0) ? 0 : y;
+    x2 = ((x + w) > TFT_XSIZE) ? (TFT_XSIZE - 1) : (x + w - 1);
+    y2 = ((y + h) > GRAPHICS_YSIZE) ? (GRAPHICS_YSIZE - 1) : (y + h - 1);
+    if ((x1 > x2) || (y1 > y2)) return;
+    if (graphics_target (displaymode, color, &target) == FALSE) return;
+    graphics_dirty_rect (displaymode, x1, y1, x2, y2);
+    for (y = y1; y <= y2; y++)
+        graphics_span (&target, x1, x2, y);
+}
+
+// midpoint circle, the points of the first octant are mirrored into the selected octants
+// the clipping is only done for each pixel if the circle is not completely inside the display
+void conio_graphics_arc (TDISPLAYMODE displaymode, sint32 xc, sint32 yc, sint32 r, uint8 octants, uint8 color)
+{
+    TGRAPHICS_TARGET target;
+    sint32 mx[8], my[8];
+    sint32 x, y, d, i, px, py;
+    boolean inside;
+
+    if ((r < 0) || (octants == 0)) return;
+    if (((xc + r) < 0) || ((xc - r) >= TFT_XSIZE) || ((yc + r) < 0) || ((yc - r) >= GRAPHICS_YSIZE)) return;
+    if (graphics_target (displaymode, color, &target) == FALSE) return;
+    graphics_dirty_rect (displaymode, ((xc - r) < 0) ? 0 : (xc - r), ((yc - r) < 0) ? 0 : (yc - r),
+                         ((xc + r) >= TFT_XSIZE) ? (TFT_XSIZE - 1) : (xc + r),
+                         ((yc + r) >= GRAPHICS_YSIZE) ? (GRAPHICS_YSIZE - 1) : (yc + r));
+    inside = ((xc - r) >= 0) && ((xc + r) < TFT_XSIZE) && ((yc - r) >= 0) && ((yc + r) < GRAPHICS_YSIZE);
+    x = 0;
+    y = r;
+    d = 1 - r;
+    while (x <= y)
+    {
+        // octant n covers 45*n..45*(n+1) degree counterclockwise, the display y axis points down
+        mx[0] = y;  my[0] = x;
+        mx[1] = x;  my[1] = y;
+        mx[2] = -x; my[2] = y;
+        mx[3] = -y; my[3] = x;
+        mx[4] = -y; my[4] = -x;
+        mx[5] = -x; my[5] = -y;
+        mx[6] = x;  my[6] = -y;
+        mx[7] = y;  my[7] = -x;
+        for (i = 0; i < 8; i++)
+        {
+            if ((octants & (1 << i)) == 0) continue;
+            px = xc + mx[i];
+            py = yc - my[i];
+            if ((inside != FALSE) || ((px >= 0) && (px < TFT_XSIZE) && (py >= 0) && (py < GRAPHICS_YSIZE)))
+                graphics_plot (&target, px + py * TFT_XSIZE);
+        }
+        if (d < 0)
+        {
+            d += 2 * x + 3;
         }
+        else
+        {
+            d += 2 * (x - y) + 5;
+            y--;
+        }
+        x++;
     }
-}                               // end of Line(...
+}
+
+void conio_graphics_trend_init (TTRENDCHART * pchart, TDISPLAYMODE displaymode, sint32 x, sint32 y, sint32 w, sint32 h,
+                                sint32 min, sint32 max, uint8 color, uint8 background)
+{
+    // the chart lines start and end on whole bytes
+    x &= ~(FONT_XSIZE - 1);
+    if (x < 0) x = 0;
+    if (y < 0) y = 0;
+    if ((x + w) > TFT_XSIZE) w = TFT_XSIZE - x;
+    if ((y + h) > GRAPHICS_YSIZE) h = GRAPHICS_YSIZE - y;
+    w &= ~(FONT_XSIZE - 1);
+    if (h < 0) h = 0;
+    pchart->displaymode = displaymode;
+    pchart->x = x;
+    pchart->y = y;
+    pchart->w = w;
+    pchart->h = h;
+    pchart->min = min;
+    pchart->scale = ((max > min) && (h > 0)) ? (((h - 1) << 16) / (max - min)) : 0;
+    pchart->lasty = -1;
+    pchart->color = color;
+    pchart->background = background;
+    conio_graphics_fillrect (displaymode, x, y, w, h, background);
+}
+
+// the chart is moved one pixel to the left, the new column is filled with the background
+// and the trend is drawn from the last sample to the new one
+void conio_graphics_trend_append (TTRENDCHART * pchart, sint32 value)
+{
+    TGRAPHICS_TARGET target;
+    uint8 *p;
+    sint32 line, i, n, ny, y1, y2, column;
+    uint8 high;
+
+    if ((pchart->w <= 0) || (pchart->h <= 0)) return;
+    if (graphics_target (pchart->displaymode, pchart->background, &target) == FALSE) return;
+    n = (pchart->w * target.bits) >> 3;
+    high = (uint8) (target.fill & (target.mask << (8 - target.bits)));
+    for (line = pchart->y; line < (pchart->y + pchart->h); line++)
+    {
+        p = &target.pdata[((line * TFT_XSIZE + pchart->x) * target.bits) >> 3];
+        for (i = 0; i < (n - 1); i++)
+            p[i] = (uint8) ((p[i] >> target.bits) | (p[i + 1] << (8 - target.bits)));
+        p[n - 1] = (uint8) ((p[n - 1] >> target.bits) | high);
+    }
+    // fixed point scaling of the sample to the chart line
+    value -= pchart->min;
+    if (value < 0) value = 0;
+    ny = pchart->y + pchart->h - 1 - ((value * pchart->scale) >> 16);
+    if (ny < pchart->y) ny = pchart->y;
+    y1 = (pchart->lasty < 0) ? ny : pchart->lasty;
+    y2 = ny;
+    if (y1 > y2)
+    {
+        y2 = y1;
+        y1 = ny;
+    }
+    graphics_target (pchart->displaymode, pchart->color, &target);
+    column = pchart->x + pchart->w - 1;
+    for (line = y1; line <= y2; line++)
+        graphics_plot (&target, column + line * TFT_XSIZE);
+    pchart->lasty = ny;
+    graphics_dirty_rect (pchart->displaymode, pchart->x, pchart->y, pchart->x + pchart->w - 1, pchart->y + pchart->h - 1);
+}
 
 
 void conio_graphics_set (TDISPLAYMODE displaymode, sint32 x, sint32 y, uint8 color)
@@ -552,14 +891,15 @@ void conio_graphics_set (TDISPLAYMODE displaymode, sint32 x, sint32 y, uint8 col
         if (0 > y || y > (TFT_YSIZE - FONT_YSIZE)) ;
         else
         {
+            conio_graphics_dirty (displaymode, x, y);
             switch (conio_driver.display[displaymode].mode)
             {
             case GRAPHICMODE_2COLOR:
                 offs = x + y * TFT_XSIZE;
                 if (color == 0)
-                    video_data[offs >> 3] &= ~(1 << (offs & 0xF));
+                    video_data[offs >> 3] &= ~(1 << (offs & 0x7));
                 else
-                    video_data[offs >> 3] |= (1 << (offs & 0xF));
+                    video_data[offs >> 3] |= (1 << (offs & 0x7));
                 break;
             case GRAPHICMODE_4COLOR:
                 offs = x + y * TFT_XSIZE;
@@ -618,123 +958,189 @@ void conio_graphics_char (TDISPLAYMODE displaymode, sint32 x, sint32 y, uint8 ch
     }
 }
 
-static void tft_prepare_graphics_lines (TMODE mode, uint8 * pdisplay, uint8 * pdisplaycolor)
+// build the expansion table of the mode with the actual palette
+static void tft_build_expand_table (TMODE mode)
 {
-    sint32 i, cnt;
-
-    cnt = YSIZE_cnt*TFT_XSIZE;
+    uint32 *ptable = &expand_table[0];
+    uint32 bits, mask, b, j;
 
     switch (mode)
     {
     case GRAPHICMODE_2COLOR:
-
-        for (i = 0; i < TFT_XSIZE * FONT_YSIZE; i++)
-        {
-            uint8 temp = 0;
-            if ((i & 0xF) == 0)
-                temp = (pdisplay[cnt >> 1] & 0x01) >> 0;
-            else if ((i & 0xF) == 1)
-                temp = (pdisplay[cnt >> 1] & 0x02) >> 1;
-            else if ((i & 0xF) == 2)
-                temp = (pdisplay[cnt >> 1] & 0x04) >> 2;
-            else if ((i & 0xF) == 3)
-                temp = (pdisplay[cnt >> 1] & 0x08) >> 3;
-            else if ((i & 0xF) == 4)
-                temp = (pdisplay[cnt >> 1] & 0x10) >> 4;
-            else if ((i & 0xF) == 5)
-                temp = (pdisplay[cnt >> 1] & 0x20) >> 5;
-            else if ((i & 0xF) == 6)
-                temp = (pdisplay[cnt >> 1] & 0x40) >> 6;
-            else if ((i & 0xF) == 7)
-                temp = (pdisplay[cnt >> 1] & 0x80) >> 7;
-
-            Row_Buff[i] = colortable_graphics[temp];
-            cnt += 1;
-        }
+        bits = 1;
         break;
-
     case GRAPHICMODE_4COLOR:
-
-        for (i = 0; i < TFT_XSIZE * FONT_YSIZE; i++)
-        {
-            uint8 temp = 0;
-            if ((i & 3) == 0)
-                temp = (pdisplay[cnt >> 2] & 0x03) >> 0;
-            else if ((i & 3) == 1)
-                temp = (pdisplay[cnt >> 2] & 0x0C) >> 2;
-            else if ((i & 3) == 2)
-                temp = (pdisplay[cnt >> 2] & 0x30) >> 4;
-            else if ((i & 3) == 3)
-                temp = (pdisplay[cnt >> 2] & 0xC0) >> 6;
-
-            Row_Buff[i] = colortable_graphics[temp];
-            cnt += 1;
-        }
+        bits = 2;
         break;
-
     case GRAPHICMODE_16COLOR:
-        for (i = 0; i < TFT_XSIZE * FONT_YSIZE; i++)
+        bits = 4;
+        break;
+    default:
+        // the 256 colors don't need a table
+        bits = 8;
+        break;
+    }
+    mask = (1 << bits) - 1;
+    if (bits < 8)
+    {
+        // the first pixel of a byte is in the lowest bits, it is the second one of the pair
+        for (b = 0; b < 256; b++)
         {
-            uint8 temp = 0;
-            if ((i & 1) == 1)
-                temp = pdisplay[cnt >> 1] & 0xF;
-            else
-                temp = (pdisplay[cnt >> 1] & 0xF0) >> 4;
-
-            Row_Buff[i] = colortable_graphics[temp];
-            cnt += 1;
+            for (j = 0; j < 8; j += 2*bits)
+            {
+                *ptable++ = colortable_graphics[(b >> (j + bits)) & mask] | ((uint32)colortable_graphics[(b >> j) & mask] << 16);
+            }
         }
+    }
+    expand_mode = mode;
+    expand_valid = TRUE;
+}
 
-        break;
+// we prepare xcnt tiles starting with tile xmin of the graphic row YSIZE_cnt/FONT_YSIZE
+// each source byte is read once and expanded into pixel pairs, written as 32bit words
+static void tft_prepare_graphics_lines (TMODE mode, uint8 * pdisplay, uint8 * pdisplaycolor, sint32 xmin, sint32 xcnt)
+{
+    uint32 *pdst = (uint32 *)&Row_Buff[0];
+    uint8 *psrc, *pend;
+    const uint32 *pexp;
+    sint32 k, cnt;
+
+    if ((expand_valid == FALSE) || (expand_mode != mode))
+        tft_build_expand_table (mode);
+    for (k = 0; k < FONT_YSIZE; k++)
+    {
+        // the tiles start at a multiple of 8 pixels, a byte never holds pixels of two rows
+        cnt = (YSIZE_cnt + k)*TFT_XSIZE + xmin*FONT_XSIZE;
+        switch (mode)
+        {
+        case GRAPHICMODE_2COLOR:
+            psrc = &pdisplay[cnt >> 3];
+            pend = psrc + xcnt*FONT_XSIZE/8;
+            while (psrc < pend)
+            {
+                pexp = &expand_table[*psrc++ << 2];
+                pdst[0] = pexp[0];
+                pdst[1] = pexp[1];
+                pdst[2] = pexp[2];
+                pdst[3] = pexp[3];
+                pdst += 4;
+            }
+            break;
 
-    case GRAPHICMODE_256COLOR:
+        case GRAPHICMODE_4COLOR:
+            psrc = &pdisplay[cnt >> 2];
+            pend = psrc + xcnt*FONT_XSIZE/4;
+            while (psrc < pend)
+            {
+                pexp = &expand_table[*psrc++ << 1];
+                pdst[0] = pexp[0];
+                pdst[1] = pexp[1];
+                pdst += 2;
+            }
+            break;
 
-        for (i = 0; i < TFT_XSIZE * FONT_YSIZE; i++)
-        {
-            uint8 temp = 0;
-            temp = pdisplay[cnt];
-            if ((i & 1) == 1)
-            	Row_Buff[i-1] = colortable_graphics[temp];
-            else
-            	Row_Buff[i+1] = colortable_graphics[temp];
-            cnt += 1;
+        case GRAPHICMODE_16COLOR:
+            psrc = &pdisplay[cnt >> 1];
+            pend = psrc + xcnt*FONT_XSIZE/2;
+            while (psrc < pend)
+            {
+                *pdst++ = expand_table[*psrc++];
+            }
+            break;
+
+        case GRAPHICMODE_256COLOR:
+            psrc = &pdisplay[cnt];
+            pend = psrc + xcnt*FONT_XSIZE;
+            while (psrc < pend)
+            {
+                *pdst++ = colortable_graphics[psrc[1]] | ((uint32)colortable_graphics[psrc[0]] << 16);
+                psrc += 2;
+            }
+            break;
+        default:
+            break;
         }
-        break;
-    default:
-        break;
     }
 }
 
 static uint32 tft_graphics_lines_written(void)
 {
-    // we prepare the ascii line
-	tft_prepare_graphics_lines (cpy_mode, cpy_pdisplay, cpy_pdisplaycolor);
+    sint32 row = dirty_row[dirty_ind];
+    sint32 xmin = dirty_xmin[dirty_ind];
+    sint32 xcnt = dirty_xcnt[dirty_ind];
+    sint32 nrows = dirty_nrows[dirty_ind];
 
-    YSIZE_cnt += FONT_YSIZE;             //ROW counter
+    if (nrows != 0)
+    {
+        // this row starts a new window
+        tft_window_row_buff (xmin*FONT_XSIZE, (row + 1)*FONT_YSIZE,
+                             (xmin + xcnt)*FONT_XSIZE - 1, (row + 1 + nrows)*FONT_YSIZE - 1);
+    }
+    // we prepare the graphics lines
+    YSIZE_cnt = row*FONT_YSIZE;
+	tft_prepare_graphics_lines (cpy_mode, cpy_pdisplay, cpy_pdisplaycolor, xmin, xcnt);
 
-    if (YSIZE_cnt > (TFT_YSIZE - 2*FONT_YSIZE))
+    dirty_ind++;
+    if (dirty_ind == dirty_cnt)
 	{
 		// this are our last graphics lines
 		// we send the Row_Buff to the display without callback function
-	    tft_flush_row_buff( (void *)0, FONT_YSIZE*TERMINAL_MAXX*FONT_XSIZE);
+	    tft_flush_row_buff( (void *)0, FONT_YSIZE*xcnt*FONT_XSIZE);
 	}
 	else
 	{
 		// this are not our last graphics lines
 		// we send the Row_Buff to the display with callback function
-	    tft_flush_row_buff( &tft_graphics_lines_written, FONT_YSIZE*TERMINAL_MAXX*FONT_XSIZE);
+	    tft_flush_row_buff( &tft_graphics_lines_written, FONT_YSIZE*xcnt*FONT_XSIZE);
 	}
 	return 0;
 }
 
 void tft_graphic (TMODE mode, uint8 * pdisplay, uint8 * pdisplaycolor)
 {
+    sint32 row, xmin, xcnt, start;
+
     //copy values in global variables for tft_prepare_graphics_lines
     cpy_mode = mode;
     cpy_pdisplay = pdisplay;
     cpy_pdisplaycolor = pdisplaycolor;
-	// we remove one line from display which is used by bar
-	YSIZE_cnt = 0;
-	// send the
-	tft_graphics_lines_written();
+    // we collect the changed tiles of each row, the bar row is not used
+    dirty_cnt = 0;
+    start = 0;
+    for (row = 0; row < (TERMINAL_MAXY - 1); row++)
+    {
+        TDIRTYROW *pdirty = &conio_driver.graphicsdirty[row];
+        if (conio_driver.tftrefresh != 0)
+        {
+            xmin = 0;
+            xcnt = TERMINAL_MAXX;
+        }
+        else
+        {
+            xmin = pdirty->xmin;
+            xcnt = pdirty->xmax - pdirty->xmin + 1;
+        }
+        pdirty->xmin = TERMINAL_MAXX;
+        pdirty->xmax = -1;
+        if (xcnt <= 0) continue;
+        dirty_row[dirty_cnt] = row;
+        dirty_xmin[dirty_cnt] = xmin;
+        dirty_xcnt[dirty_cnt] = xcnt;
+        // rows with the same tiles below each other are sent in one window
+        if ((dirty_cnt != 0) && (dirty_row[dirty_cnt - 1] == (row - 1))
+            && (dirty_xmin[start] == xmin) && (dirty_xcnt[start] == xcnt))
+        {
+            dirty_nrows[dirty_cnt] = 0;
+            dirty_nrows[start] += 1;
+        }
+        else
+        {
+            dirty_nrows[dirty_cnt] = 1;
+            start = dirty_cnt;
+        }
+        dirty_cnt++;
+    }
+    dirty_ind = 0;
+	// send the changed tiles
+    if (dirty_cnt != 0) tft_graphics_lines_written();
 }
@@ -0,0 +1,183 @@
+/*
+ * scope.c
+ *
+ *  Scrolling waveform plot
+ *  The display is rotated (MV=1), the vertical scroll of the ILI9341 moves the columns of our display.
+ *  A new column is written at the next memory column of the scroll area and the scroll start is moved by one,
+ *  the plot is not drawn again.
+ *
+ */
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include <Cpu/Std/Ifx_Types.h>
+#include "Configuration.h"
+#include "conio_tft.h"
+#include "scope.h"
+
+/******************************************************************************/
+/*------------------------Inline Function Prototypes--------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+//columns of the whole display height in one row buffer
+#define SCOPE_BAND_COLUMNS ((FONT_YSIZE * TFT_XSIZE) / TFT_YSIZE)
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+extern TCOLORTABLEASCII colortable_ascii;
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+static sint32 scope_line (TSCOPE * pscope, uint16 value);
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+void scope_init (TSCOPE * pscope, sint32 x, sint32 w, sint32 y, sint32 h, uint16 min, uint16 max,
+                 uint16 samplespercolumn, uint8 color, uint8 background)
+{
+    if (x < 0) x = 0;
+    if ((x + w) > TFT_XSIZE) w = TFT_XSIZE - x;
+    if (y < 0) y = 0;
+    if ((y + h) > TFT_YSIZE) h = TFT_YSIZE - y;
+    pscope->x = x;
+    pscope->w = w;
+    pscope->y = y;
+    pscope->h = h;
+    pscope->min = min;
+    pscope->max = max;
+    pscope->scale = ((max > min) && (h > 0)) ? (((h - 1) << 16) / (max - min)) : 0;
+    pscope->samplespercolumn = (samplespercolumn != 0) ? samplespercolumn : 1;
+    pscope->cnt = 0;
+    pscope->in = 0;
+    pscope->out = 0;
+    pscope->lost = 0;
+    pscope->clear = 0;
+    pscope->head = 0;
+    pscope->lasttop = -1;
+    pscope->lastbottom = -1;
+    pscope->color = color;
+    pscope->background = background;
+    pscope->active = 0;
+}
+
+// fixed point scaling of a sample value to a display line
+static sint32 scope_line (TSCOPE * pscope, uint16 value)
+{
+    if (value < pscope->min) value = pscope->min;
+    if (value > pscope->max) value = pscope->max;
+    return pscope->y + pscope->h - 1 - (((sint32) (value - pscope->min) * pscope->scale) >> 16);
+}
+
+boolean scope_start (TSCOPE * pscope)
+{
+    if ((pscope->w <= 0) || (pscope->h <= 0)) return FALSE;
+    if (tft_display_scrollarea (pscope->x, pscope->w, TFT_XSIZE - pscope->x - pscope->w) == FALSE) return FALSE;
+    tft_display_scroll (pscope->x);
+    pscope->head = 0;
+    pscope->clear = pscope->w;
+    pscope->lasttop = -1;
+    pscope->lastbottom = -1;
+    pscope->out = pscope->in;
+    pscope->active = 1;
+    return TRUE;
+}
+
+void scope_stop (TSCOPE * pscope)
+{
+    pscope->active = 0;
+    // the memory columns are shown at their own position again
+    tft_display_scrollarea (0, TFT_XSIZE, 0);
+    tft_display_scroll (0);
+    conio_invalidate ();
+}
+
+void scope_feed (TSCOPE * pscope, const Ifx_VADC_RES * pblock, uint32 count)
+{
+    uint32 i;
+    uint16 value;
+
+    for (i = 0; i < count; i++)
+    {
+        value = pblock[i].B.RESULT;
+        if (pscope->cnt == 0)
+        {
+            pscope->colmin = value;
+            pscope->colmax = value;
+        }
+        else
+        {
+            if (value < pscope->colmin) pscope->colmin = value;
+            if (value > pscope->colmax) pscope->colmax = value;
+        }
+        pscope->cnt++;
+        if (pscope->cnt >= pscope->samplespercolumn)
+        {
+            pscope->cnt = 0;
+            if ((pscope->in - pscope->out) >= SCOPE_FIFO_SIZE)
+            {
+                pscope->lost++;
+            }
+            else
+            {
+                pscope->fifomin[pscope->in & (SCOPE_FIFO_SIZE - 1)] = pscope->colmin;
+                pscope->fifomax[pscope->in & (SCOPE_FIFO_SIZE - 1)] = pscope->colmax;
+                pscope->in++;
+            }
+        }
+    }
+}
+
+// the waiting columns up to the end of the scroll area are sent in one band,
+// the pixel of the window are in lines, pixel p is at p^1 because the pixel pairs are swapped in the words
+void scope_periodic (TSCOPE * pscope)
+{
+    uint16 *pbuff = Row_Buff;
+    uint16 color = colortable_ascii[pscope->color];
+    uint16 background = colortable_ascii[pscope->background];
+    sint32 n, c, line, top, bottom, prevtop, prevbottom, clear;
+
+    if ((pscope->active == 0) || (tft_status != 0)) return;
+    clear = pscope->clear;
+    n = (clear != 0) ? clear : (sint32) (pscope->in - pscope->out);
+    if (n == 0) return;
+    if (n > SCOPE_BAND_COLUMNS) n = SCOPE_BAND_COLUMNS;
+    if (n > (pscope->w - pscope->head)) n = pscope->w - pscope->head;
+    for (line = 0; line < (n * TFT_YSIZE); line++)
+        pbuff[line] = background;
+    for (c = 0; (clear == 0) && (c < n); c++)
+    {
+        top = scope_line (pscope, pscope->fifomax[pscope->out & (SCOPE_FIFO_SIZE - 1)]);
+        bottom = scope_line (pscope, pscope->fifomin[pscope->out & (SCOPE_FIFO_SIZE - 1)]);
+        pscope->out++;
+        // the column is connected to the last one
+        prevtop = pscope->lasttop;
+        prevbottom = pscope->lastbottom;
+        pscope->lasttop = top;
+        pscope->lastbottom = bottom;
+        if (prevtop >= 0)
+        {
+            if (top > prevbottom) top = prevbottom;
+            if (bottom < prevtop) bottom = prevtop;
+        }
+        for (line = top; line <= bottom; line++)
+            pbuff[(line * n + c) ^ 1] = color;
+    }
+    if (clear != 0) pscope->clear -= n;
+    tft_window_row_buff (pscope->x + pscope->head, 0, pscope->x + pscope->head + n - 1, TFT_YSIZE - 1);
+    pscope->head += n;
+    if (pscope->head >= pscope->w) pscope->head = 0;
+    // the newest column is shown at the right end of the scroll area
+    tft_scroll_row_buff (pscope->x + pscope->head);
+    tft_flush_row_buff (0, n * TFT_YSIZE);
+}
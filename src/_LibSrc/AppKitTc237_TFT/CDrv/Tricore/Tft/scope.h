@@ -0,0 +1,51 @@
+/*
+ * scope.h
+ *
+ *  Scrolling waveform plot, each new column is one band with the vertical scroll of the ILI9341
+ *
+ */
+#ifndef SCOPE_H
+#define SCOPE_H
+
+#include <Cpu/Std/Ifx_Types.h>
+#include <Vadc/Adc/IfxVadc_Adc.h>
+
+#define SCOPE_FIFO_SIZE 32          //decimated columns waiting for the display, power of 2
+
+//the scope uses the columns x..x+w-1 over the whole display height, the columns scroll on the display
+//the conio displays must not change these columns (also not the bar) while the scope runs
+typedef struct SCOPE
+{
+    sint16 x, w;                    //columns of the scroll area
+    sint16 y, h;                    //lines of the plot inside the columns
+    uint16 min;                     //sample value at the bottom line
+    uint16 max;                     //sample value at the top line
+    sint32 scale;                   //lines per sample unit in 16.16 fixed point
+    uint16 samplespercolumn;        //the samples of one column are decimated to their minimum and maximum
+    uint16 cnt;                     //samples of the actual column
+    uint16 colmin, colmax;          //minimum and maximum of the actual column
+    uint16 fifomin[SCOPE_FIFO_SIZE];    //decimated columns
+    uint16 fifomax[SCOPE_FIFO_SIZE];
+    volatile uint32 in;             //written by scope_feed
+    volatile uint32 out;            //read by scope_periodic
+    uint32 lost;                    //columns lost because the display was too slow
+    sint16 clear;                   //columns still to clear after the start
+    sint16 head;                    //next column of the scroll area
+    sint16 lasttop, lastbottom;     //lines of the last column, to connect the columns
+    uint8 color;                    //color of the waveform, index of the ascii colortable
+    uint8 background;               //color of the background, index of the ascii colortable
+    uint8 active;                   //1 between scope_start and scope_stop
+} TSCOPE;
+
+void scope_init (TSCOPE * pscope, sint32 x, sint32 w, sint32 y, sint32 h, uint16 min, uint16 max,
+                 uint16 samplespercolumn, uint8 color, uint8 background);
+//the scroll area is set, returns FALSE if the display has no vertical scroll, the tft must be idle
+boolean scope_start (TSCOPE * pscope);
+//the display scroll is reset and the conio display is sent again, the tft must be idle
+void scope_stop (TSCOPE * pscope);
+//a block of results from the VADC stream (IfxVadc_Adc_getStreamBlock), can be called from the block interrupt
+void scope_feed (TSCOPE * pscope, const Ifx_VADC_RES * pblock, uint32 count);
+//the decimated columns are sent to the display, called out of the display task if the tft is idle
+void scope_periodic (TSCOPE * pscope);
+
+#endif /* SCOPE_H */
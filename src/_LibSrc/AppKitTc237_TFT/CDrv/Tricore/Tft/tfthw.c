@@ -11,6 +11,7 @@
 #include "font_8_12.h"
 #include "tfthw.h"
 #include "Configuration.h"
+#include <Cpu/Std/IfxCpu.h>
 
 /******************************************************************************/
 /*------------------------Inline Function Prototypes--------------------------*/
@@ -27,6 +28,18 @@
 /******************************************************************************/
 /*-----------------------------Data Structures--------------------------------*/
 /******************************************************************************/
+/** \brief one prepared band of pixel */
+typedef struct
+{
+    uint16 *pbuff;                  /**< \brief pixel of the band, one of the row buffers */
+    uint32 numberOfPixel;           /**< \brief number of pixel, 0 if no band is waiting */
+    uint32 (*pFunc) (void);         /**< \brief prepares the next band, 0 if this is the last band */
+    uint8 newwindow;                /**< \brief 1 if the window is set before the band is sent */
+    uint16 x0, y0, x1, y1;          /**< \brief window of the band */
+    uint8 newscroll;                /**< \brief 1 if the scroll start is set before the band is sent */
+    uint16 scroll;                  /**< \brief scroll start of the band */
+} TTFT_BAND;
+
 /** \brief QspiCpu global data */
 typedef struct
 {
@@ -79,11 +92,19 @@ typedef struct
 #endif
 
 // the iLLD don't use cirular buffering, we need an align to 4 for DMA (32 bit access)
-uint16 Row_Buff[FONT_YSIZE*TFT_XSIZE] IFX_ALIGN(4);
+// two row buffers, the next band is prepared in Row_Buff while the other one is transfered
+static uint16 Row_Buff_Pool[2][FONT_YSIZE*TFT_XSIZE] IFX_ALIGN(4);
+uint16 *Row_Buff;
 volatile uint32 tft_status = 0;
 volatile uint16 tft_id = 0;
 
-volatile uint32 (*pCallbackFunction) (void) = (void *)0;
+static TTFT_BAND tft_band_next;             // window for the next flushed band
+static volatile TTFT_BAND tft_band_pending; // prepared band, waits until the actual band is finished
+static volatile uint8 tft_band_active = 0;  // 1 while a band is transfered
+static volatile uint8 tft_band_started = 0; // 1 when the pixel of the active band are sent (not the commands)
+static volatile uint8 tft_band_last = 0;    // 1 if no band is prepared after the active one
+static uint8 tft_pipeline_active = 0;       // 1 while the bands are started, protects against reentrance
+static uint8 tft_stream = 0;                // 1 while the memory write command is active
 
 App_Qspi_Tft g_Qspi_Tft;
 
@@ -105,14 +126,27 @@ App_Qspi_Tft g_Qspi_Tft;
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
+static uint32 tft_terminate_endless_transfer (void);
+static void tft_pipeline (void);
+
 void tft_transmit_callback(void)
 {
     // check that we are ready (no remaining bytes) in case that we are not using the DMA
 	if (g_Qspi_Tft.drivers.spiMaster->dma.useDma == 0)
         if (g_Qspi_Tft.drivers.spiMasterChannel.base.tx.remaining) return;
-	// if our pCallbackFunction is valid then we call it
-	if (pCallbackFunction != (void *)0)
-		pCallbackFunction();
+	// the transfer of the commands are not our bands
+	if (tft_band_started == 0) return;
+	tft_band_started = 0;
+	tft_band_active = 0;
+	if ((tft_band_last != 0) && (tft_band_pending.numberOfPixel == 0))
+	{
+		// this was our last band
+		tft_terminate_endless_transfer ();
+	    /* we reset the tft status, no longer busy */
+		tft_status = 0;
+	}
+	// the next band is already prepared, we start it
+	tft_pipeline ();
 }
 
 static void delay_us (uint32 time)
@@ -273,8 +307,8 @@ static uint32 tft_terminate_endless_transfer (void)
 {
     // all our values was send
     uint16 tx_data;
-	// first we reset the callback function to 0
-    pCallbackFunction = (void *)0;
+	// the memory write command is finished with this transfer
+    tft_stream = 0;
     /* wait until Spi is no longer busy (wait until receive is finished) */
     while (IfxQspi_SpiMaster_getStatus(&g_Qspi_Tft.drivers.spiMasterChannel) == SpiIf_Status_busy) {};
     /* we send other 16 bit to write the last value */
@@ -300,8 +334,6 @@ static uint32 tft_terminate_endless_transfer (void)
     /* set back to 32 bit transfer */
     g_Qspi_Tft.drivers.spiMasterChannel.bacon.B.DL = 31;
     g_Qspi_Tft.drivers.spiMasterChannel.dataWidth = 32;
-    /* we reset the tft status, no longer busy */
-	tft_status = 0;
 	return 0;
 }
 
@@ -311,6 +343,8 @@ void tft_init (void)
     boolean interruptState = IfxCpu_disableInterrupts();
 
     g_Qspi_Tft.drivers.spiMaster = TFT_QSPI_INIT();
+    /* the first band is prepared in the first row buffer */
+    Row_Buff = &Row_Buff_Pool[0][0];
     IfxQspi_SpiMaster_ChannelConfig spiMasterChannelConfig;
 
     {
@@ -349,7 +383,7 @@ void tft_init (void)
     IfxCpu_restoreInterrupts(interruptState);
 
     tft_id = 0;
-    pCallbackFunction = (void *)0;
+    tft_band_started = 0;
 
     tft_id = tft_read_data (0x0);
 
@@ -621,42 +655,104 @@ void tft_init (void)
     }
 }
 
-void tft_display_setxy (uint32 x, uint32 y)
+void tft_display_setwindow (uint32 x0, uint32 y0, uint32 x1, uint32 y1)
 {
     if (tft_id == 0x9341)
     {
-    	uint16 uwData[3];
+    	uint16 uwData[5];
 
-    	uwData[0] = (uint16) (x >> 8);
-    	uwData[1] = (uint16) x;
-    	uwData[2] = 0x0000;
-    	tft_write_data_ili9341(0x2A, &uwData[0], 3);  // Column Address Set, we change only the start (2 Parameters)
+    	uwData[0] = (uint16) (x0 >> 8);
+    	uwData[1] = (uint16) x0;
+    	uwData[2] = (uint16) (x1 >> 8);
+    	uwData[3] = (uint16) x1;
+    	uwData[4] = 0x0000;
+    	tft_write_data_ili9341(0x2A, &uwData[0], 5);  // Column Address Set, start and end
 
-    	uwData[0] = (uint16) (y >> 8);
-    	uwData[1] = (uint16) y;
-    	uwData[2] = 0x0000;
-    	tft_write_data_ili9341(0x2B, &uwData[0], 3);  // Page Address Set, we change only the start (2 Parameters)
+    	uwData[0] = (uint16) (y0 >> 8);
+    	uwData[1] = (uint16) y0;
+    	uwData[2] = (uint16) (y1 >> 8);
+    	uwData[3] = (uint16) y1;
+    	uwData[4] = 0x0000;
+    	tft_write_data_ili9341(0x2B, &uwData[0], 5);  // Page Address Set, start and end
     }
     else
     {
         if (tft_id == 0x47)
         {
-            tft_write_data (0x0002, (uint16) (x >> 8));
-            tft_write_data (0x0003, (uint16) x);    //Column Start
-            tft_write_data (0x0006, (uint16) (y >> 8));
-            tft_write_data (0x0007, (uint16) y);    //Row Start
+            tft_write_data (0x0002, (uint16) (x0 >> 8));
+            tft_write_data (0x0003, (uint16) x0);   //Column Start
+            tft_write_data (0x0004, (uint16) (x1 >> 8));
+            tft_write_data (0x0005, (uint16) x1);   //Column End
+            tft_write_data (0x0006, (uint16) (y0 >> 8));
+            tft_write_data (0x0007, (uint16) y0);   //Row Start
+            tft_write_data (0x0008, (uint16) (y1 >> 8));
+            tft_write_data (0x0009, (uint16) y1);   //Row End
         }
         else
         {
-            tft_write_data (0x0020, (uint16) y);
-            tft_write_data (0x0021, (uint16) x);
+            // the display is rotated, the horizontal GRAM address is our y
+            tft_write_data (0x0050, (uint16) y0);   // Horizontal GRAM Start Address
+            tft_write_data (0x0051, (uint16) y1);   // Horizontal GRAM End Address
+            tft_write_data (0x0052, (uint16) x0);   // Vertical GRAM Start Address
+            tft_write_data (0x0053, (uint16) x1);   // Vertical GRAM End Address
+            tft_write_data (0x0020, (uint16) y0);
+            tft_write_data (0x0021, (uint16) x0);
         }
     }
 }
 
-void tft_flush_row_buff(void *pFunc, uint32 numberOfPixel)
+// only the ILI9341 has the vertical scroll, it moves our x axis because the display is rotated (MV=1)
+boolean tft_display_scrollarea (uint32 tfa, uint32 vsa, uint32 bfa)
+{
+    uint16 uwData[7];
+
+    if (tft_id != 0x9341) return FALSE;
+    uwData[0] = (uint16) (tfa >> 8);
+    uwData[1] = (uint16) (tfa & 0xFF);
+    uwData[2] = (uint16) (vsa >> 8);
+    uwData[3] = (uint16) (vsa & 0xFF);
+    uwData[4] = (uint16) (bfa >> 8);
+    uwData[5] = (uint16) (bfa & 0xFF);
+    uwData[6] = 0x0000;
+    tft_write_data_ili9341(0x33, &uwData[0], 7);  // Vertical Scrolling Definition
+    return TRUE;
+}
+
+void tft_display_scroll (uint32 line)
+{
+    uint16 uwData[3];
+
+    if (tft_id != 0x9341) return;
+    uwData[0] = (uint16) (line >> 8);
+    uwData[1] = (uint16) (line & 0xFF);
+    uwData[2] = 0x0000;
+    tft_write_data_ili9341(0x37, &uwData[0], 3);  // Vertical Scrolling Start Address
+}
+
+void tft_display_setxy (uint32 x, uint32 y)
+{
+    // the window is reset to the end of the display, a partial update may have reduced it
+    tft_display_setwindow (x, y, TFT_XSIZE - 1, TFT_YSIZE - 1);
+}
+
+// the window commands and the SPI requests of them are finished, we send the pixel of the band
+static void tft_band_start (TTFT_BAND *pband)
 {
-    if (tft_status == 0)
+    IfxQspi_SpiMaster *spiMaster = g_Qspi_Tft.drivers.spiMaster;
+
+    if ((pband->newwindow != 0) || (pband->newscroll != 0))
+    {
+        if (tft_stream != 0)
+        {
+            // the window of the last band is finished
+            tft_terminate_endless_transfer ();
+        }
+        if (pband->newwindow != 0)
+            tft_display_setwindow (pband->x0, pband->y0, pband->x1, pband->y1);
+        if (pband->newscroll != 0)
+            tft_display_scroll (pband->scroll);
+    }
+    if (tft_stream == 0)
     {
         uint16 tx_data;
 
@@ -674,19 +770,95 @@ void tft_flush_row_buff(void *pFunc, uint32 numberOfPixel)
         while (IfxQspi_SpiMaster_getStatus(&g_Qspi_Tft.drivers.spiMasterChannel) == SpiIf_Status_busy) {};
         /* send the address to the display */
         IfxQspi_SpiMaster_exchange(&g_Qspi_Tft.drivers.spiMasterChannel, &tx_data, 0, 1);
+        /* wait until the command is send, tx_data is on the stack */
+        while (IfxQspi_SpiMaster_getStatus(&g_Qspi_Tft.drivers.spiMasterChannel) == SpiIf_Status_busy) {};
         /* set back to 32 bit transfer */
         g_Qspi_Tft.drivers.spiMasterChannel.bacon.B.DL = 31;
         g_Qspi_Tft.drivers.spiMasterChannel.dataWidth = 32;
+        tft_stream = 1;
     }
+    else
+    {
+        /* only the last words of the previous band are in the fifo */
+        while (IfxQspi_SpiMaster_getStatus(&g_Qspi_Tft.drivers.spiMasterChannel) == SpiIf_Status_busy) {};
+    }
+    /* the transmit requests of the commands are not for our band */
+    if (spiMaster->dma.useDma != 0)
+        IfxSrc_clearRequest (IfxDma_getSrcPointer (spiMaster->dma.txDmaChannel.dma, spiMaster->dma.txDmaChannelId));
+    else
+        IfxSrc_clearRequest (IfxQspi_getTransmitSrc (spiMaster->qspi));
+
+    tft_band_last = (pband->pFunc == (void *)0);
+    tft_band_started = 1;
+    /* send the values to the display */
+    IfxQspi_SpiMaster_exchange(&g_Qspi_Tft.drivers.spiMasterChannel, pband->pbuff, 0, pband->numberOfPixel/2);
+}
+
+// start the pending band when the active one is finished, then prepare the next one into the free buffer
+static void tft_pipeline (void)
+{
+    boolean interruptState = IfxCpu_disableInterrupts ();
+
+    if (tft_pipeline_active == 0)
+    {
+        tft_pipeline_active = 1;
+        while ((tft_band_active == 0) && (tft_band_pending.numberOfPixel != 0))
+        {
+            TTFT_BAND band;
+
+            band = *((TTFT_BAND *)&tft_band_pending);
+            tft_band_pending.numberOfPixel = 0;
+            tft_band_active = 1;
+            IfxCpu_restoreInterrupts (interruptState);
+
+            tft_band_start (&band);
+            // Row_Buff is free, the callback prepares the next band while this one is transfered
+            if (band.pFunc != (void *)0)
+                band.pFunc ();
+
+            interruptState = IfxCpu_disableInterrupts ();
+        }
+        tft_pipeline_active = 0;
+    }
+    IfxCpu_restoreInterrupts (interruptState);
+}
+
+void tft_window_row_buff (uint32 x0, uint32 y0, uint32 x1, uint32 y1)
+{
+    tft_band_next.newwindow = 1;
+    tft_band_next.x0 = (uint16) x0;
+    tft_band_next.y0 = (uint16) y0;
+    tft_band_next.x1 = (uint16) x1;
+    tft_band_next.y1 = (uint16) y1;
+}
+
+void tft_scroll_row_buff (uint32 line)
+{
+    tft_band_next.newscroll = 1;
+    tft_band_next.scroll = (uint16) line;
+}
+
+void tft_flush_row_buff(void *pFunc, uint32 numberOfPixel)
+{
+    boolean interruptState = IfxCpu_disableInterrupts ();
 
 	tft_status = 1; // TFT Busy
 
-	pCallbackFunction = pFunc;
-	if (pCallbackFunction == (void *)0)
-		pCallbackFunction = (void *)&tft_terminate_endless_transfer;
+    // only one band is waiting, the next one is prepared by pFunc when this one is started
+    tft_band_next.pbuff = Row_Buff;
+    tft_band_next.numberOfPixel = numberOfPixel;
+    tft_band_next.pFunc = pFunc;
+    *((TTFT_BAND *)&tft_band_pending) = tft_band_next;
+    tft_band_next.newwindow = 0;
+    tft_band_next.newscroll = 0;
+
+    // the next band is prepared in the other buffer, it is free before pFunc is called
+    if (Row_Buff == &Row_Buff_Pool[0][0])
+        Row_Buff = &Row_Buff_Pool[1][0];
+    else
+        Row_Buff = &Row_Buff_Pool[0][0];
+    IfxCpu_restoreInterrupts (interruptState);
 
-    /* wait until Spi is no longer busy (should not busy here) */
-    while (IfxQspi_SpiMaster_getStatus(&g_Qspi_Tft.drivers.spiMasterChannel) == SpiIf_Status_busy) {};
-    /* send the values to the display */
-    IfxQspi_SpiMaster_exchange(&g_Qspi_Tft.drivers.spiMasterChannel, &Row_Buff[0], 0, numberOfPixel/2);
+    // we start the band if the previous one is finished
+    tft_pipeline ();
 }
@@ -20,15 +20,25 @@
 	#endif
 #endif
 
-extern uint16 Row_Buff[];
+extern uint16 *Row_Buff;       // the band is prepared here, it changes with each tft_flush_row_buff
 extern volatile uint32 tft_status;
 
 //specific entries tfthw.c
 void tft_drvinit (void);
 void tft_init (void);
-// flush the actual row buff and callback pFunc if finished
+// queue the actual row buff, pFunc is called to prepare the next one when this one is started
 void tft_flush_row_buff(void *pFunc, uint32 numberOfPixel);
+// the next flushed row buff starts the pixel window x0..x1, y0..y1
+void tft_window_row_buff (uint32 x0, uint32 y0, uint32 x1, uint32 y1);
 // set the pixel datapointer to x,y location
 void tft_display_setxy (uint32 x, uint32 y);
+// set the pixel window x0..x1, y0..y1 and the datapointer to x0,y0 location
+void tft_display_setwindow (uint32 x0, uint32 y0, uint32 x1, uint32 y1);
+// the columns tfa..tfa+vsa-1 scroll (ILI9341 only, returns FALSE on other displays), tfa+vsa+bfa is TFT_XSIZE
+boolean tft_display_scrollarea (uint32 tfa, uint32 vsa, uint32 bfa);
+// the column line of the memory is shown at the first column of the scroll area
+void tft_display_scroll (uint32 line);
+// the next flushed row buff sets the scroll start before its pixel are sent
+void tft_scroll_row_buff (uint32 line);
 
 #endif /* TFTHW_H */
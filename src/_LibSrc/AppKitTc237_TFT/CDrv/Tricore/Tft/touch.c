@@ -31,7 +31,8 @@
 /******************************************************************************/
 /*-----------------------------------Macros-----------------------------------*/
 /******************************************************************************/
-#define TOUCH_BUFFER_SIZE 5    /**< \brief Tx/Rx Buffer size */
+#define TOUCH_SAMPLES 5        /**< \brief Number of X/Y samples of one burst, the median is used */
+#define TOUCH_BUFFER_SIZE (4*TOUCH_SAMPLES + 1)    /**< \brief Tx/Rx Buffer size */
 
 #define XMAX_TOUCH   3700.0f		//maybe a option is needed to trim the values
 #define XMIN_TOUCH   240.0f
@@ -64,6 +65,12 @@ typedef struct
 typedef struct
 {
     AppQspi_Touch_Buffer qspiBuffer;                       /**< \brief Qspi buffer */
+    IfxQspi_SpiMaster_Job job;                             /**< \brief queued burst conversion */
+    volatile boolean busy;                                 /**< \brief TRUE while the burst is queued or filtered */
+    volatile boolean ready;                                /**< \brief TRUE when x and y hold a new filtered position */
+    boolean filtered;                                      /**< \brief TRUE when x and y hold a position of the actual touch */
+    sint16 x;                                              /**< \brief filtered x position */
+    sint16 y;                                              /**< \brief filtered y position */
     struct
     {
         IfxQspi_SpiMaster         *spiMaster;            /**< \brief Pointer to spi Master handle */
@@ -133,6 +140,8 @@ TTOUCH_DASINFO touch_dasinfo;
 /******************************************************************************/
 /*-------------------------Function Prototypes--------------------------------*/
 /******************************************************************************/
+static void touch_burst_done (IfxQspi_SpiMaster_Job *job);
+static sint16 touch_median (uint8 *prx);
 
 /******************************************************************************/
 /*------------------------Private Variables/Constants-------------------------*/
@@ -185,10 +194,27 @@ void touch_init (void)
             &spiMasterChannelConfig);
     }
 
-    /* init tx buffer area */
-	g_Qspi_Touch.qspiBuffer.spiTxBuffer[0] = 0;
+    /* init tx buffer area, the next command is sent with the low byte of the previous result */
+    {
+        sint32 i;
+        for (i = 0; i < TOUCH_BUFFER_SIZE; i += 1)
+            g_Qspi_Touch.qspiBuffer.spiTxBuffer[i] = 0x00;
+        for (i = 0; i < TOUCH_SAMPLES; i += 1)
+        {
+            g_Qspi_Touch.qspiBuffer.spiTxBuffer[4*i] = 0x90;
+            g_Qspi_Touch.qspiBuffer.spiTxBuffer[4*i + 2] = 0xD0;
+        }
+    }
     g_Qspi_Touch.qspiBuffer.spiRxBuffer[0] = 0;
 
+    /* one job converts the burst, the samples are filtered in the completion interrupt */
+    IfxQspi_SpiMaster_initJob(&g_Qspi_Touch.job, &g_Qspi_Touch.drivers.spiMasterChannel,
+        &g_Qspi_Touch.qspiBuffer.spiTxBuffer[0], &g_Qspi_Touch.qspiBuffer.spiRxBuffer[0], TOUCH_BUFFER_SIZE);
+    IfxQspi_SpiMaster_setJobCallback(&g_Qspi_Touch.job, &touch_burst_done, NULL_PTR);
+    g_Qspi_Touch.busy = FALSE;
+    g_Qspi_Touch.ready = FALSE;
+    g_Qspi_Touch.filtered = FALSE;
+
     /* enable interrupts again */
     IfxCpu_restoreInterrupts(interruptState);
 
@@ -217,6 +243,44 @@ void touch_init (void)
 
 }
 
+// returns the median of the TOUCH_SAMPLES results starting at prx, the results are 4 bytes apart
+static sint16 touch_median (uint8 *prx)
+{
+    sint16 value[TOUCH_SAMPLES];
+    sint16 tmp;
+    sint32 i, j;
+
+    for (i = 0; i < TOUCH_SAMPLES; i += 1)
+    {
+        tmp = ((prx[4*i]<<8) | (prx[4*i + 1])) >> 3;
+        // insertion sort, the burst is short
+        for (j = i; (j > 0) && (value[j - 1] > tmp); j -= 1)
+            value[j] = value[j - 1];
+        value[j] = tmp;
+    }
+    return value[TOUCH_SAMPLES / 2];
+}
+
+// completion of the burst in the QSPI interrupt
+// the medians of the burst are smoothed with the previous position of the same touch
+static void touch_burst_done (IfxQspi_SpiMaster_Job *job)
+{
+    sint16 x, y;
+
+    x = touch_median (&g_Qspi_Touch.qspiBuffer.spiRxBuffer[1]);
+    y = touch_median (&g_Qspi_Touch.qspiBuffer.spiRxBuffer[3]);
+    if (g_Qspi_Touch.filtered != FALSE)
+    {
+        x = (3*g_Qspi_Touch.x + x + 2) >> 2;
+        y = (3*g_Qspi_Touch.y + y + 2) >> 2;
+    }
+    g_Qspi_Touch.x = x;
+    g_Qspi_Touch.y = y;
+    g_Qspi_Touch.filtered = TRUE;
+    g_Qspi_Touch.ready = TRUE;
+    g_Qspi_Touch.busy = FALSE;
+}
+
 inline void touch_calcdisp (void)
 {
     touch_event.xdisp =
@@ -237,42 +301,62 @@ inline void touch_calcdisp (void)
 
 void touch_periodic (void)
 {
+    boolean pendown;
+    sint16 x = -1, y = -1;
+
     touch_driver.bounce_cnt += 1;
     if (touch_driver.bounce_cnt < touch_driver.bounce_limit)
         return;
     touch_driver.bounce_cnt = 0;
+    pendown = (IfxPort_getPinState(TOUCH_USE_INT.port, TOUCH_USE_INT.pinIndex) == FALSE);
+#ifdef TFT_OVER_DAS
+    if (touch_dasinfo.event != 0)
+        pendown = FALSE;
+#endif
+    if (pendown != FALSE)
+    {
+        // the pen interrupt line starts the next burst, we never wait for the QSPI
+        boolean ready = g_Qspi_Touch.ready;
+        if (ready != FALSE)
+        {
+            // the position is copied before the next burst overwrites it
+            x = g_Qspi_Touch.x;
+            y = g_Qspi_Touch.y;
+        }
+        if (g_Qspi_Touch.busy == FALSE)
+        {
+            g_Qspi_Touch.ready = FALSE;
+            g_Qspi_Touch.busy = TRUE;
+            IfxQspi_SpiMaster_queueJob(&g_Qspi_Touch.job);
+        }
+        if (ready == FALSE)
+            return;     //no new position yet, the state is kept
+    }
+    else if (g_Qspi_Touch.busy == FALSE)
+    {
+        // the next touch starts a new filter
+        g_Qspi_Touch.filtered = FALSE;
+        g_Qspi_Touch.ready = FALSE;
+    }
     //the touch is selected
     touch_driver.touchmode = 0;
 #ifdef TFT_OVER_DAS
     if (touch_dasinfo.event == 0)
 #endif
     {
-        if (IfxPort_getPinState(TOUCH_USE_INT.port, TOUCH_USE_INT.pinIndex) == FALSE)
+        if (pendown != FALSE)
         {
             touch_driver.xmax = XMAX_TOUCH;
             touch_driver.xmin = XMIN_TOUCH;
             touch_driver.ymax = YMIN_TOUCH;
             touch_driver.ymin = YMAX_TOUCH;
-            g_Qspi_Touch.qspiBuffer.spiTxBuffer[0] = 0x90;
-            g_Qspi_Touch.qspiBuffer.spiTxBuffer[1] = 0x00;
-            g_Qspi_Touch.qspiBuffer.spiTxBuffer[2] = 0xD0;
-            g_Qspi_Touch.qspiBuffer.spiTxBuffer[3] = 0x00;
-            g_Qspi_Touch.qspiBuffer.spiTxBuffer[4] = 0x00;
-
-            while (IfxQspi_SpiMaster_getStatus(&g_Qspi_Touch.drivers.spiMasterChannel) == SpiIf_Status_busy) {};
-
-            IfxQspi_SpiMaster_exchange(&g_Qspi_Touch.drivers.spiMasterChannel, &g_Qspi_Touch.qspiBuffer.spiTxBuffer[0],
-                &g_Qspi_Touch.qspiBuffer.spiRxBuffer[0], TOUCH_BUFFER_SIZE);
-
-            /* wait until our datas are valid */
-            while (IfxQspi_SpiMaster_getStatus(&g_Qspi_Touch.drivers.spiMasterChannel) == SpiIf_Status_busy) {};
             touch_driver.prev_time = touch_driver.time;
             touch_driver.time = (__mfcr (0xFC04) & 0x7FFFFFFF) >> 8;
             touch_driver.prev_x = touch_driver.x;
-            // here we get the touch position
-            touch_driver.x = ((g_Qspi_Touch.qspiBuffer.spiRxBuffer[1]<<8) | (g_Qspi_Touch.qspiBuffer.spiRxBuffer[2])) >> 3;
+            // here we get the filtered touch position of the last burst
+            touch_driver.x = x;
             touch_driver.prev_y = touch_driver.y;
-            touch_driver.y = ((g_Qspi_Touch.qspiBuffer.spiRxBuffer[3]<<8) | (g_Qspi_Touch.qspiBuffer.spiRxBuffer[4])) >> 3;
+            touch_driver.y = y;
 
             touch_driver.prev_status = touch_driver.status;
             touch_driver.status = TOUCH_DOWN;
@@ -0,0 +1,132 @@
+/**
+ * \file IfxCpu.h
+ * \brief CPU driver subset, host build
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \ingroup IfxLld_Platform_Host
+ *
+ * The host is seen as CPU0 of a single core device: the functions used by the portable modules (interrupt lock,
+ * core index, spinlocks) are provided, the core mode requests have no effect.
+ */
+#ifndef IFXCPU_H
+#define IFXCPU_H 1
+
+/******************************************************************************/
+#include "Ifx_Types.h"
+#include "IfxCpu_Intrinsics.h"
+
+/******************************************************************************/
+#define IFXCPU_NUM_MODULES                 (1)
+#define IFX_CFG_CPU_SINGLE_CORE            (1)
+
+/** \brief Global address of a DSPR variable, the host has one address space */
+#define IFXCPU_GLB_ADDR_DSPR(cpu, address) ((unsigned)(address))
+
+/** \brief Global address of a PSPR function, the host has one address space */
+#define IFXCPU_GLB_ADDR_PSPR(cpu, address) ((unsigned)(address))
+
+/******************************************************************************/
+typedef enum
+{
+    IfxCpu_ResourceCpu_0    = 0,    /**< \brief CPU 0, the host */
+    IfxCpu_ResourceCpu_none         /**< \brief None of the CPU */
+} IfxCpu_ResourceCpu;
+
+typedef enum
+{
+    IfxCpu_CoreMode_halt,
+    IfxCpu_CoreMode_run,
+    IfxCpu_CoreMode_idle,
+    IfxCpu_CoreMode_sleep,
+    IfxCpu_CoreMode_stby,
+    IfxCpu_CoreMode_unknown
+} IfxCpu_CoreMode;
+
+/** \brief CPU register block, not accessible on the host */
+typedef struct
+{
+    uint32 reserved;
+} Ifx_CPU;
+
+typedef unsigned int IfxCpu_spinLock;
+
+typedef unsigned int IfxCpu_mutexLock;
+
+/******************************************************************************/
+IFX_INLINE boolean IfxCpu_disableInterrupts(void)
+{
+    return (boolean)(__disable_and_save() != 0);
+}
+
+
+IFX_INLINE void IfxCpu_enableInterrupts(void)
+{
+    __enable();
+}
+
+
+IFX_INLINE Ifx_CPU *IfxCpu_getAddress(IfxCpu_ResourceCpu cpu)
+{
+    (void)cpu;
+    return NULL_PTR;
+}
+
+
+IFX_INLINE IfxCpu_ResourceCpu IfxCpu_getCoreIndex(void)
+{
+    return IfxCpu_ResourceCpu_0;
+}
+
+
+IFX_INLINE void IfxCpu_restoreInterrupts(boolean enabled)
+{
+    __restore(enabled);
+}
+
+
+IFX_INLINE boolean IfxCpu_setCoreMode(Ifx_CPU *cpu, IfxCpu_CoreMode mode)
+{
+    (void)cpu;
+    (void)mode;
+    return TRUE;
+}
+
+
+IFX_INLINE void IfxCpu_resetSpinLock(IfxCpu_spinLock *lock)
+{
+    __atomic_store_n(lock, 0, __ATOMIC_SEQ_CST);
+}
+
+
+IFX_INLINE boolean IfxCpu_setSpinLock(IfxCpu_spinLock *lock, uint32 timeoutCount)
+{
+    boolean acquired;
+
+    do
+    {
+        acquired = (boolean)(__cmpAndSwap(lock, 1, 0) == 0);
+    } while ((acquired == FALSE) && (timeoutCount-- != 0));
+
+    return acquired;
+}
+
+
+/******************************************************************************/
+#endif /* IFXCPU_H */
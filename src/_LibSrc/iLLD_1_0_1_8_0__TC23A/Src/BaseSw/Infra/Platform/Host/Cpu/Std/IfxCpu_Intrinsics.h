@@ -0,0 +1,218 @@
+/**
+ * \file IfxCpu_Intrinsics.h
+ * \brief Intrinsics written in C, host build
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \ingroup IfxLld_Platform_Host
+ *
+ * Same results as the TriCore instructions, e.g. __clz(0) returns 32. The instructions without effect on the
+ * host (barriers, cache, debug) are empty, the interrupt state is a variable. The core special function registers
+ * (__mfcr(), __mtcr()) are not available.
+ */
+#ifndef IFXCPU_INTRINSICS_H
+#define IFXCPU_INTRINSICS_H
+/******************************************************************************/
+/* Before the macros below, which would otherwise replace the libm declarations of __roundf() etc. */
+#include <math.h>
+#include "Ifx_Types.h"
+
+/** \brief Interrupt enable state emulated by __disable(), __enable(), __disable_and_save() and __restore() */
+IFX_EXTERN volatile sint32 IfxCpu_g_HostInterruptEnable;
+
+/* Cross type arithmetic operation */
+#define __minX(X, Y)                    (((X) < (Y)) ? (X) : (Y))
+#define __maxX(X, Y)                    (((X) > (Y)) ? (X) : (Y))
+#define __saturateX(X, Min, Max)        (__minX(__maxX(X, Min), Max))
+#define __checkrangeX(X, Min, Max)      (((X) >= (Min)) && ((X) <= (Max)))
+
+#define __saturate(X, Min, Max)         (__min(__max(X, Min), Max))
+#define __saturateu(X, Min, Max)        (__minu(__maxu(X, Min), Max))
+
+IFX_INLINE sint32 __max(sint32 a, sint32 b)
+{
+    return (a > b) ? a : b;
+}
+
+
+IFX_INLINE sint32 __maxs(sint16 a, sint16 b)
+{
+    return (a > b) ? a : b;
+}
+
+
+IFX_INLINE uint32 __maxu(uint32 a, uint32 b)
+{
+    return (a > b) ? a : b;
+}
+
+
+IFX_INLINE sint32 __min(sint32 a, sint32 b)
+{
+    return (a < b) ? a : b;
+}
+
+
+IFX_INLINE sint16 __mins(sint16 a, sint16 b)
+{
+    return (a < b) ? a : b;
+}
+
+
+IFX_INLINE uint32 __minu(uint32 a, uint32 b)
+{
+    return (a < b) ? a : b;
+}
+
+
+/* Floating point operation */
+#define __sqrf(X)                       ((X) * (X))
+#define __sqrtf(X)                      sqrtf(X)
+#define __checkrange(X, Min, Max)       (((X) >= (Min)) && ((X) <= (Max)))
+#define __roundf(X)                     ((((X) - (sint32)(X)) > 0.5) ? (1 + (sint32)(X)) : ((sint32)(X)))
+#define __absf(X)                       (((X) < 0.0) ? -(X) : (X))
+#define __minf(X, Y)                    (((X) < (Y)) ? (X) : (Y))
+#define __maxf(X, Y)                    (((X) > (Y)) ? (X) : (Y))
+#define __saturatef(X, Min, Max)        (__minf(__maxf(X, Min), Max))
+#define __checkrangef(X, Min, Max)      (((X) >= (Min)) && ((X) <= (Max)))
+#define __abs_stdreal(X)                (((X) > 0.0) ? (X) : -(X))
+#define __min_stdreal(X, Y)             (((X) < (Y)) ? (X) : (Y))
+#define __max_stdreal(X, Y)             (((X) > (Y)) ? (X) : (Y))
+#define __saturate_stdreal(X, Min, Max) (__min_stdreal(__max_stdreal(X, Min), Max))
+#define __neqf(X, Y)                    (((X) > (Y)) || ((X) < (Y)))
+#define __leqf(X, Y)                    (!((X) > (Y)))
+#define __geqf(X, Y)                    (!((X) < (Y)))
+
+#define __abs(X)                        (((X) < 0) ? -(X) : (X))
+
+/* Bit-fields */
+IFX_INLINE sint32 __extr(sint32 a, uint32 p, uint32 w)
+{
+    return (w == 0) ? 0 : (sint32)((uint32)a << (32 - p - w)) >> (32 - w);
+}
+
+
+IFX_INLINE uint32 __extru(uint32 a, uint32 p, uint32 w)
+{
+    return (w == 0) ? 0 : (a << (32 - p - w)) >> (32 - w);
+}
+
+
+IFX_INLINE sint32 __insert(sint32 a, sint32 b, sint32 p, const sint32 w)
+{
+    uint32 mask = ((w >= 32) ? 0xFFFFFFFFU : ((1U << w) - 1)) << p;
+
+    return (sint32)(((uint32)a & ~mask) | (((uint32)b << p) & mask));
+}
+
+
+#define __getbit(address, bitoffset) ((*(address) & (1U << (bitoffset))) != 0)
+
+IFX_INLINE uint32 __rol(uint32 operand, uint32 count)
+{
+    count &= 31;
+    return (count == 0) ? operand : ((operand << count) | (operand >> (32 - count)));
+}
+
+
+IFX_INLINE uint32 __ror(uint32 operand, uint32 count)
+{
+    count &= 31;
+    return (count == 0) ? operand : ((operand >> count) | (operand << (32 - count)));
+}
+
+
+/** \brief Count leading zeros, 32 for 0 as the TriCore CLZ instruction */
+IFX_INLINE sint32 __clz(uint32 a)
+{
+    return (a == 0) ? 32 : __builtin_clz(a);
+}
+
+
+/* Interrupts */
+#define __disable()                     (IfxCpu_g_HostInterruptEnable = 0)
+#define __enable()                      (IfxCpu_g_HostInterruptEnable = 1)
+
+IFX_INLINE sint32 __disable_and_save(void)
+{
+    sint32 enabled = IfxCpu_g_HostInterruptEnable;
+
+    IfxCpu_g_HostInterruptEnable = 0;
+    return enabled;
+}
+
+
+IFX_INLINE void __restore(sint32 ie)
+{
+    IfxCpu_g_HostInterruptEnable = ie;
+}
+
+
+/* Barriers and instructions without effect on the host */
+IFX_INLINE void __debug(void)
+{}
+
+
+IFX_INLINE void __dsync(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+
+IFX_INLINE void __isync(void)
+{}
+
+
+IFX_INLINE void __nop(void)
+{}
+
+
+IFX_INLINE uint32 __swap(void *place, uint32 value)
+{
+    return __atomic_exchange_n((uint32 *)place, value, __ATOMIC_SEQ_CST);
+}
+
+
+IFX_INLINE unsigned int __cmpAndSwap(unsigned int volatile *address, unsigned int value, unsigned int condition)
+{
+    unsigned int expected = condition;
+
+    __atomic_compare_exchange_n(address, &expected, value, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    return expected;
+}
+
+
+#define IFX_ALIGN_8   (1)            // Align on 8 bit Boundary
+#define IFX_ALIGN_16  (2)            // Align on 16 bit Boundary
+#define IFX_ALIGN_32  (4)            // Align on 32 bit Boundary
+#define IFX_ALIGN_64  (8)            // Align on 64 bit Boundary
+#define IFX_ALIGN_128 (16)           // Align on 128 bit Boundary
+#define IFX_ALIGN_256 (32)           // Align on 256 bit Boundary
+
+#define Ifx_AlignOn256(Size) ((((Size) + (IFX_ALIGN_256 - 1)) & (~(IFX_ALIGN_256 - 1))))
+#define Ifx_AlignOn128(Size) ((((Size) + (IFX_ALIGN_128 - 1)) & (~(IFX_ALIGN_128 - 1))))
+#define Ifx_AlignOn64(Size)  ((((Size) + (IFX_ALIGN_64 - 1)) & (~(IFX_ALIGN_64 - 1))))
+#define Ifx_AlignOn32(Size)  ((((Size) + (IFX_ALIGN_32 - 1)) & (~(IFX_ALIGN_32 - 1))))
+#define Ifx_AlignOn16(Size)  ((((Size) + (IFX_ALIGN_16 - 1)) & (~(IFX_ALIGN_16 - 1))))
+#define Ifx_AlignOn8(Size)   ((((Size) + (IFX_ALIGN_8 - 1)) & (~(IFX_ALIGN_8 - 1))))
+
+#define Ifx_COUNTOF(x)       (sizeof(x) / sizeof(x[0]))
+
+/******************************************************************************/
+#endif /* IFXCPU_INTRINSICS_H */
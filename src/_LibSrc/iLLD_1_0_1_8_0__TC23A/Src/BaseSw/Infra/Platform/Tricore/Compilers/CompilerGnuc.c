@@ -40,15 +40,26 @@ typedef volatile union
 } IfxStart_CTablePtr;
 
 /*!
- * \brief Initializes C variables.
+ * \brief Returns the core owning a section.
  *
- * This function is called in the startup. This function initialize the all variables in .data section
- * and clears the .bss section
+ * Sections located in the global scratchpad segment of core n (0x70000000 - n * 0x10000000) belong to core n if
+ * it is set in coreMask, all other sections belong to core 0.
+ */
+static unsigned int Ifx_C_getOwner(uint32 address, unsigned int coreMask)
+{
+    unsigned int segment = address >> 28;
+    unsigned int core    = ((segment >= 5) && (segment <= 7)) ? (7 - segment) : 0;
+
+    return ((coreMask & (1U << core)) != 0) ? core : 0;
+}
+
+
+/*!
+ * \brief Initializes the C variables of the sections owned by a core.
  *
- * Parameters: Nil
- * Return: Nil
+ * Clears the sections listed in the clear table and copies the sections listed in the copy table
  */
-void Ifx_C_Init(void)
+static void Ifx_C_InitSections(unsigned int core, unsigned int coreMask)
 {
     IfxStart_CTablePtr pBlockDest, pBlockSrc;
     uint32             uiLength, uiCnt;
@@ -67,6 +78,11 @@ void Ifx_C_Init(void)
             break;
         }
 
+        if (Ifx_C_getOwner((uint32)pBlockDest.uiPtr, coreMask) != core)
+        {
+            continue;
+        }
+
         uiCnt = uiLength / 8;
 
         while (uiCnt--)
@@ -105,6 +121,11 @@ void Ifx_C_Init(void)
             break;
         }
 
+        if (Ifx_C_getOwner((uint32)pBlockDest.uiPtr, coreMask) != core)
+        {
+            continue;
+        }
+
         uiCnt = uiLength / 8;
 
         while (uiCnt--)
@@ -130,4 +151,33 @@ void Ifx_C_Init(void)
 }
 
 
+/*!
+ * \brief Initializes C variables.
+ *
+ * This function is called in the startup. This function initialize the all variables in .data section
+ * and clears the .bss section
+ *
+ * Parameters: Nil
+ * Return: Nil
+ */
+void Ifx_C_Init(void)
+{
+    Ifx_C_InitSections(0, 0x1);
+}
+
+
+/*!
+ * \brief Initializes the C variables located in the scratchpad of one core.
+ *
+ * This function is called in the startup of each core when the C initialization is done in parallel.
+ *
+ * Parameters: core: index of the calling core, coreMask: cores initializing their own variables
+ * Return: Nil
+ */
+void Ifx_C_InitCore(unsigned int core, unsigned int coreMask)
+{
+    Ifx_C_InitSections(core, coreMask | 0x1);
+}
+
+
 #endif
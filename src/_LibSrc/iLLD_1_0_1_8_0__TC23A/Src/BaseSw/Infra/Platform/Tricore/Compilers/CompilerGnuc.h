@@ -162,5 +162,20 @@ void isr (void)
 #define IFX_REL_A9
 #endif
 /******************************************************************************/
+/*Memory placement: PSPR code copied and DSPR data initialised by Ifx_C_Init() */
+#define IFX_HOT_CODE_CPU0  __attribute__ ((section(".psram_cpu0")))
+#define IFX_HOT_CODE_CPU1  __attribute__ ((section(".psram_cpu1")))
+#define IFX_HOT_CODE_CPU2  __attribute__ ((section(".psram_cpu2")))
+
+#define IFX_FAST_DATA_CPU0 __attribute__ ((section(".data_cpu0")))
+#define IFX_FAST_DATA_CPU1 __attribute__ ((section(".data_cpu1")))
+#define IFX_FAST_DATA_CPU2 __attribute__ ((section(".data_cpu2")))
+
+/*LMU data initialised by Ifx_C_Init(), cached: shared data is accessed through IFXCPU_NON_CACHED_ADDR() */
+#define IFX_LMU_DATA       __attribute__ ((section(".data_lmu")))
+
+/*Data not initialised by Ifx_C_Init(), kept over a reset: the linker file shall not list the .noinit sections in the C initialisation tables */
+#define IFX_NO_INIT_DATA   __attribute__ ((section(".noinit")))
+/******************************************************************************/
 
 #endif /* COMPILERGNUC_H */
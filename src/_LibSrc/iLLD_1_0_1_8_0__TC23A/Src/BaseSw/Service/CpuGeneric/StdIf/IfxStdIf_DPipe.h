@@ -235,54 +235,80 @@ struct IfxStdIf_DPipe_
     IfxStdIf_DPipe_GetTxTimeStamp getTxTimeStamp; /**< \brief \see IfxStdIf_DPipe_GetTxTimeStamp    */
     IfxStdIf_DPipe_ResetSendCount resetSendCount; /**< \brief \see IfxStdIf_DPipe_ResetSendCount    */
 };
+/** \brief Binds the time critical functions to the driver functions \<prefix\>_\<function\>() at compile time
+ *
+ * Bound functions: IfxStdIf_DPipe_write(), IfxStdIf_DPipe_read(), IfxStdIf_DPipe_getReadCount(), IfxStdIf_DPipe_getWriteCount(), IfxStdIf_DPipe_canReadCount(), IfxStdIf_DPipe_canWriteCount()
+ *
+ * See \ref library_srvsw_stdif "compile-time binding", example: IFXSTDIF_DPIPE_BIND(IfxAsclin_Asc)
+ */
+#define IFXSTDIF_DPIPE_BIND(prefix)                                                                                                                                                    \
+    IFX_INLINE boolean IfxStdIf_DPipe_write(IfxStdIf_DPipe *stdif, void *data, Ifx_SizeT *count, Ifx_TickTime timeout) { return prefix##_write(stdif->driver, data, count, timeout); } \
+    IFX_INLINE boolean IfxStdIf_DPipe_read(IfxStdIf_DPipe *stdif, void *data, Ifx_SizeT *count, Ifx_TickTime timeout) { return prefix##_read(stdif->driver, data, count, timeout); }   \
+    IFX_INLINE sint32 IfxStdIf_DPipe_getReadCount(IfxStdIf_DPipe *stdif) { return prefix##_getReadCount(stdif->driver); }                                                              \
+    IFX_INLINE sint32 IfxStdIf_DPipe_getWriteCount(IfxStdIf_DPipe *stdif) { return prefix##_getWriteCount(stdif->driver); }                                                            \
+    IFX_INLINE boolean IfxStdIf_DPipe_canReadCount(IfxStdIf_DPipe *stdif, Ifx_SizeT count, Ifx_TickTime timeout) { return prefix##_canReadCount(stdif->driver, count, timeout); }      \
+    IFX_INLINE boolean IfxStdIf_DPipe_canWriteCount(IfxStdIf_DPipe *stdif, Ifx_SizeT count, Ifx_TickTime timeout) { return prefix##_canWriteCount(stdif->driver, count, timeout); }
+
 /** \addtogroup library_srvsw_stdif_dpipe
  * \{ */
+#ifndef IFXSTDIF_DPIPE_BOUND
 /** \copydoc IfxStdIf_DPipe_Write
  */
 IFX_INLINE boolean IfxStdIf_DPipe_write(IfxStdIf_DPipe *stdif, void *data, Ifx_SizeT *count, Ifx_TickTime timeout)
 {
     return stdif->write(stdif->driver, data, count, timeout);
 }
+#endif
 
 
+#ifndef IFXSTDIF_DPIPE_BOUND
 /** \copydoc IfxStdIf_DPipe_Read
  */
 IFX_INLINE boolean IfxStdIf_DPipe_read(IfxStdIf_DPipe *stdif, void *data, Ifx_SizeT *count, Ifx_TickTime timeout)
 {
     return stdif->read(stdif->driver, data, count, timeout);
 }
+#endif
 
 
+#ifndef IFXSTDIF_DPIPE_BOUND
 /** \copydoc IfxStdIf_DPipe_GetReadCount
  */
 IFX_INLINE sint32 IfxStdIf_DPipe_getReadCount(IfxStdIf_DPipe *stdif)
 {
     return stdif->getReadCount(stdif->driver);
 }
+#endif
 
 
+#ifndef IFXSTDIF_DPIPE_BOUND
 /** \copydoc IfxStdIf_DPipe_GetWriteCount
  */
 IFX_INLINE sint32 IfxStdIf_DPipe_getWriteCount(IfxStdIf_DPipe *stdif)
 {
     return stdif->getWriteCount(stdif->driver);
 }
+#endif
 
 
+#ifndef IFXSTDIF_DPIPE_BOUND
 /** \copydoc IfxStdIf_DPipe_CanReadCount
  */
 IFX_INLINE boolean IfxStdIf_DPipe_canReadCount(IfxStdIf_DPipe *stdif, Ifx_SizeT count, Ifx_TickTime timeout)
 {
     return stdif->canReadCount(stdif->driver, count, timeout);
 }
+#endif
 
 
+#ifndef IFXSTDIF_DPIPE_BOUND
 /** \copydoc IfxStdIf_DPipe_CanWriteCount
  */
 IFX_INLINE boolean IfxStdIf_DPipe_canWriteCount(IfxStdIf_DPipe *stdif, Ifx_SizeT count, Ifx_TickTime timeout)
 {
     return stdif->canWriteCount(stdif->driver, count, timeout);
 }
+#endif
 
 
 /** \copydoc IfxStdIf_DPipe_GetReadEvent
@@ -306,6 +306,20 @@ typedef struct
     float32                       speedFilerCutOffFrequency; /**< \brief Speed low pass filter cut off frequency */
 } IfxStdIf_Pos_Config;
 
+/** \brief Binds the time critical functions to the driver functions \<prefix\>_\<function\>() at compile time
+ *
+ * Bound functions: IfxStdIf_Pos_update(), IfxStdIf_Pos_getPosition(), IfxStdIf_Pos_getRawPosition(), IfxStdIf_Pos_getSpeed(), IfxStdIf_Pos_getDirection(), IfxStdIf_Pos_getTurn()
+ *
+ * See \ref library_srvsw_stdif "compile-time binding", example: IFXSTDIF_POS_BIND(IfxGpt12_IncrEnc)
+ */
+#define IFXSTDIF_POS_BIND(prefix)                                                                                               \
+    IFX_INLINE void IfxStdIf_Pos_update(IfxStdIf_Pos *stdIf) { prefix##_update(stdIf->driver); }                                \
+    IFX_INLINE float32 IfxStdIf_Pos_getPosition(IfxStdIf_Pos *stdIf) { return prefix##_getPosition(stdIf->driver); }            \
+    IFX_INLINE sint32 IfxStdIf_Pos_getRawPosition(IfxStdIf_Pos *stdIf) { return prefix##_getRawPosition(stdIf->driver); }       \
+    IFX_INLINE float32 IfxStdIf_Pos_getSpeed(IfxStdIf_Pos *stdIf) { return prefix##_getSpeed(stdIf->driver); }                  \
+    IFX_INLINE IfxStdIf_Pos_Dir IfxStdIf_Pos_getDirection(IfxStdIf_Pos *stdIf) { return prefix##_getDirection(stdIf->driver); } \
+    IFX_INLINE sint32 IfxStdIf_Pos_getTurn(IfxStdIf_Pos *stdIf) { return prefix##_getTurn(stdIf->driver); }
+
 /** \addtogroup library_srvsw_stdif_posif
  *  \{
  */
@@ -345,6 +359,7 @@ IFX_INLINE sint32 IfxStdIf_Pos_getOffset(IfxStdIf_Pos *stdIf)
 }
 
 
+#ifndef IFXSTDIF_POS_BOUND
 /** \copydoc IfxStdIf_Pos_GetPosition
  * \param stdIf Standard interface pointer
  */
@@ -352,8 +367,10 @@ IFX_INLINE float32 IfxStdIf_Pos_getPosition(IfxStdIf_Pos *stdIf)
 {
     return stdIf->getPosition(stdIf->driver);
 }
+#endif
 
 
+#ifndef IFXSTDIF_POS_BOUND
 /** \copydoc IfxStdIf_Pos_GetDirection
  * \param stdIf Standard interface pointer
  */
@@ -361,6 +378,7 @@ IFX_INLINE IfxStdIf_Pos_Dir IfxStdIf_Pos_getDirection(IfxStdIf_Pos *stdIf)
 {
     return stdIf->getDirection(stdIf->driver);
 }
+#endif
 
 
 /** \copydoc IfxStdIf_Pos_GetPeriodPerRotation
@@ -372,6 +390,7 @@ IFX_INLINE uint16 IfxStdIf_Pos_getPeriodPerRotation(IfxStdIf_Pos *stdIf)
 }
 
 
+#ifndef IFXSTDIF_POS_BOUND
 /** \copydoc IfxStdIf_Pos_GetRawPosition
  * \param stdIf Standard interface pointer
  */
@@ -379,6 +398,7 @@ IFX_INLINE sint32 IfxStdIf_Pos_getRawPosition(IfxStdIf_Pos *stdIf)
 {
     return stdIf->getRawPosition(stdIf->driver);
 }
+#endif
 
 
 /** \copydoc IfxStdIf_Pos_GetRefreshPeriod
@@ -399,6 +419,7 @@ IFX_INLINE sint32 IfxStdIf_Pos_getResolution(IfxStdIf_Pos *stdIf)
 }
 
 
+#ifndef IFXSTDIF_POS_BOUND
 /** \copydoc IfxStdIf_Pos_GetTurn
  * \param stdIf Standard interface pointer
  */
@@ -406,6 +427,7 @@ IFX_INLINE sint32 IfxStdIf_Pos_getTurn(IfxStdIf_Pos *stdIf)
 {
     return stdIf->getTurn(stdIf->driver);
 }
+#endif
 
 
 /** \copydoc IfxStdIf_Pos_GetSensorType
@@ -417,6 +439,7 @@ IFX_INLINE IfxStdIf_Pos_SensorType IfxStdIf_Pos_getSensorType(IfxStdIf_Pos *stdI
 }
 
 
+#ifndef IFXSTDIF_POS_BOUND
 /** \copydoc IfxStdIf_Pos_GetSpeed
  * \param stdIf Standard interface pointer
  */
@@ -424,6 +447,7 @@ IFX_INLINE float32 IfxStdIf_Pos_getSpeed(IfxStdIf_Pos *stdIf)
 {
     return stdIf->getSpeed(stdIf->driver);
 }
+#endif
 
 
 /** Check whether the sensor is faulty
@@ -444,6 +468,7 @@ IFX_INLINE void IfxStdIf_Pos_onEventA(IfxStdIf_Pos *stdIf)
 }
 
 
+#ifndef IFXSTDIF_POS_BOUND
 /** \copydoc IfxStdIf_Pos_Update
  * \param stdIf Standard interface pointer
  */
@@ -451,6 +476,7 @@ IFX_INLINE void IfxStdIf_Pos_update(IfxStdIf_Pos *stdIf)
 {
     stdIf->update(stdIf->driver);
 }
+#endif
 
 
 /** \copydoc IfxStdIf_Pos_Reset
@@ -186,6 +186,15 @@ typedef struct
     Ifx_ActiveState    coutxActiveState;    /**< \brief Bottom PWM active state */
 } IfxStdIf_PwmHl_Config;
 
+/** \brief Binds the time critical functions to the driver functions \<prefix\>_\<function\>() at compile time
+ *
+ * Bound functions: IfxStdIf_PwmHl_setOnTime(). The timer of the PWM is bound with \ref IFXSTDIF_TIMER_BIND
+ *
+ * See \ref library_srvsw_stdif "compile-time binding", example: IFXSTDIF_PWMHL_BIND(IfxGtm_Tom_PwmHl)
+ */
+#define IFXSTDIF_PWMHL_BIND(prefix) \
+    IFX_INLINE void IfxStdIf_PwmHl_setOnTime(IfxStdIf_PwmHl *stdIf, Ifx_TimerValue *tOn) { prefix##_setOnTime(stdIf->driver, tOn); }
+
 /** \addtogroup library_srvsw_stdif_pwmhl
  *  \{
  */
@@ -244,6 +253,7 @@ IFX_INLINE boolean IfxStdIf_PwmHl_setMode(IfxStdIf_PwmHl *stdIf, Ifx_Pwm_Mode mo
 }
 
 
+#ifndef IFXSTDIF_PWMHL_BOUND
 /** \copydoc IfxStdIf_PwmHl_SetOnTime
  * \param stdIf Standard interface pointer
  */
@@ -251,6 +261,7 @@ IFX_INLINE void IfxStdIf_PwmHl_setOnTime(IfxStdIf_PwmHl *stdIf, Ifx_TimerValue *
 {
     stdIf->setOnTime(stdIf->driver, tOn);
 }
+#endif
 
 
 /** \copydoc IfxStdIf_PwmHl_SetOnTimeAndShift 
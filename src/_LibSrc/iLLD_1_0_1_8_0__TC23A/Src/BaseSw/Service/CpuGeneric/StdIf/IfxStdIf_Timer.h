@@ -263,6 +263,21 @@ typedef struct
     float32                   startOffset;   /**< \brief FIXME make startOffset as Ifx_TimerValue. Timer initial offset in % of the period */
 } IfxStdIf_Timer_Config;
 
+/** \brief Binds the time critical functions to the driver functions \<prefix\>_\<function\>() at compile time
+ *
+ * Bound functions: IfxStdIf_Timer_run(), IfxStdIf_Timer_stop(), IfxStdIf_Timer_applyUpdate(), IfxStdIf_Timer_disableUpdate(), IfxStdIf_Timer_setPeriod(), IfxStdIf_Timer_setTrigger(), IfxStdIf_Timer_ackTimerIrq()
+ *
+ * See \ref library_srvsw_stdif "compile-time binding", example: IFXSTDIF_TIMER_BIND(IfxGtm_Tom_Timer)
+ */
+#define IFXSTDIF_TIMER_BIND(prefix)                                                                                                                     \
+    IFX_INLINE void IfxStdIf_Timer_run(IfxStdIf_Timer *stdIf) { prefix##_run(stdIf->driver); }                                                          \
+    IFX_INLINE void IfxStdIf_Timer_stop(IfxStdIf_Timer *stdIf) { prefix##_stop(stdIf->driver); }                                                        \
+    IFX_INLINE void IfxStdIf_Timer_applyUpdate(IfxStdIf_Timer *stdIf) { prefix##_applyUpdate(stdIf->driver); }                                          \
+    IFX_INLINE void IfxStdIf_Timer_disableUpdate(IfxStdIf_Timer *stdIf) { prefix##_disableUpdate(stdIf->driver); }                                      \
+    IFX_INLINE boolean IfxStdIf_Timer_setPeriod(IfxStdIf_Timer *stdIf, Ifx_TimerValue period) { return prefix##_setPeriod(stdIf->driver, period); }     \
+    IFX_INLINE void IfxStdIf_Timer_setTrigger(IfxStdIf_Timer *stdIf, Ifx_TimerValue triggerPoint) { prefix##_setTrigger(stdIf->driver, triggerPoint); } \
+    IFX_INLINE boolean IfxStdIf_Timer_ackTimerIrq(IfxStdIf_Timer *stdIf) { return prefix##_acknowledgeTimerIrq(stdIf->driver); }
+
 /** \addtogroup library_srvsw_stdif_timer
  *  \{
  */
@@ -320,6 +335,7 @@ IFX_INLINE void IfxStdIf_Timer_updateInputFrequency(IfxStdIf_Timer *stdIf)
 }
 
 
+#ifndef IFXSTDIF_TIMER_BOUND
 /** \copydoc IfxStdIf_Timer_ApplyUpdate
  * \param stdIf Standard interface pointer
  */
@@ -327,8 +343,10 @@ IFX_INLINE void IfxStdIf_Timer_applyUpdate(IfxStdIf_Timer *stdIf)
 {
     stdIf->applyUpdate(stdIf->driver);
 }
+#endif
 
 
+#ifndef IFXSTDIF_TIMER_BOUND
 /** \copydoc IfxStdIf_Timer_DisableUpdate
  * \param stdIf Standard interface pointer
  */
@@ -336,6 +354,7 @@ IFX_INLINE void IfxStdIf_Timer_disableUpdate(IfxStdIf_Timer *stdIf)
 {
     stdIf->disableUpdate(stdIf->driver);
 }
+#endif
 
 
 /** \copydoc IfxStdIf_Timer_GetInputFrequency
@@ -347,6 +366,7 @@ IFX_INLINE float32 IfxStdIf_Timer_getInputFrequency(IfxStdIf_Timer *stdIf)
 }
 
 
+#ifndef IFXSTDIF_TIMER_BOUND
 /** \copydoc IfxStdIf_Timer_Run
  * \param stdIf Standard interface pointer
  */
@@ -354,8 +374,10 @@ IFX_INLINE void IfxStdIf_Timer_run(IfxStdIf_Timer *stdIf)
 {
     stdIf->run(stdIf->driver);
 }
+#endif
 
 
+#ifndef IFXSTDIF_TIMER_BOUND
 /** \copydoc IfxStdIf_Timer_SetPeriod
  * \param stdIf Standard interface pointer
  */
@@ -363,6 +385,7 @@ IFX_INLINE boolean IfxStdIf_Timer_setPeriod(IfxStdIf_Timer *stdIf, Ifx_TimerValu
 {
     return stdIf->setPeriod(stdIf->driver, period);
 }
+#endif
 
 
 /** \copydoc IfxStdIf_Timer_SetSingleMode
@@ -374,6 +397,7 @@ IFX_INLINE void IfxStdIf_Timer_setSingleMode(IfxStdIf_Timer *stdIf, boolean enab
 }
 
 
+#ifndef IFXSTDIF_TIMER_BOUND
 /** \copydoc IfxStdIf_Timer_SetTrigger
  * \param stdIf Standard interface pointer
  */
@@ -381,8 +405,10 @@ IFX_INLINE void IfxStdIf_Timer_setTrigger(IfxStdIf_Timer *stdIf, Ifx_TimerValue
 {
     stdIf->setTrigger(stdIf->driver, triggerPoint);
 }
+#endif
 
 
+#ifndef IFXSTDIF_TIMER_BOUND
 /** \copydoc IfxStdIf_Timer_Stop
  * \param stdIf Standard interface pointer
  */
@@ -390,8 +416,10 @@ IFX_INLINE void IfxStdIf_Timer_stop(IfxStdIf_Timer *stdIf)
 {
     stdIf->stop(stdIf->driver);
 }
+#endif
 
 
+#ifndef IFXSTDIF_TIMER_BOUND
 /** \copydoc IfxStdIf_Timer_AckTimerIrq
  * \param stdIf Standard interface pointer
  */
@@ -399,6 +427,7 @@ IFX_INLINE boolean IfxStdIf_Timer_ackTimerIrq(IfxStdIf_Timer *stdIf)
 {
     return stdIf->ackTimerIrq(stdIf->driver);
 }
+#endif
 
 
 /** \copydoc IfxStdIf_Timer_AckTriggerIrq
@@ -48,6 +48,13 @@
  *       \ref IFX_VERBOSE_LEVEL_ERROR, \ref IFX_VERBOSE_LEVEL_WARNING, \ref IFX_VERBOSE_LEVEL_INFO,
  *       \ref IFX_VERBOSE_LEVEL_DEBUG]
  *       Default is IFX_CFG_ASSERT_VERBOSE_LEVEL_DEFAULT=\ref IFX_VERBOSE_LEVEL_INFO.
+ *     - IFX_CFG_ASSERT_LEVEL_<module>: highest level compiled in the translation units of the module, see
+ *       \ref IFX_ASSERT_IS_COMPILED(). Default is \ref IFX_VERBOSE_LEVEL_DEBUG (no filtering).
+ *     - IFX_CFG_ASSERT_LOG: if IFX_CFG_ASSERT_LOG=1, a failed assertion is stored as compact record
+ *       (PC, module, line, level) in the ring \ref Assert_log instead of being output as text: the
+ *       assertion text, file and function names are not compiled in. IFX_CFG_ASSERT_STDIO is ignored.
+ *       Default is IFX_CFG_ASSERT_LOG=0.
+ *     - IFX_CFG_ASSERT_LOG_SIZE: number of records of the ring, power of 2. Default is 16.
  *
  * Do not include this file but use # include "_Utilities/Ifx_Assert.h" instead
  * \{ */
@@ -56,6 +63,19 @@
 #    define IFX_CFG_ASSERT_STDIO (0) /**<  \brief If set to 1, the assert message is send to the Assert_io interface */
 #endif
 
+#ifndef IFX_CFG_ASSERT_LOG
+#    define IFX_CFG_ASSERT_LOG (0) /**<  \brief If set to 1, the failed assertions are stored in \ref Assert_log */
+#endif
+
+#ifndef IFX_CFG_ASSERT_LOG_SIZE
+#    define IFX_CFG_ASSERT_LOG_SIZE (16) /**<  \brief Number of records of \ref Assert_log, power of 2 */
+#endif
+
+#if IFX_CFG_ASSERT_LOG == 1
+#    undef IFX_CFG_ASSERT_STDIO
+#    define IFX_CFG_ASSERT_STDIO (0)
+#endif
+
 #if IFX_CFG_ASSERT_STDIO == 1
 #    include "StdIf/IfxStdIf_DPipe.h"
 #endif
@@ -72,6 +92,22 @@
 #define IFX_CFG_ASSERT_VERBOSE_LEVEL_DEFAULT (IFX_VERBOSE_LEVEL_INFO)
 #endif
 
+/** \brief Record of a failed assertion */
+typedef struct
+{
+    uint32 pc;          /**< \brief return address of the assertion call, points into the function of the assertion */
+    uint16 line;        /**< \brief line of the assertion */
+    uint8  module;      /**< \brief module identifier IFX_ASSERT_MODULE_ID_xxx */
+    uint8  level;       /**< \brief assertion level */
+} Ifx_Assert_Record;
+
+/** \brief Ring of the last failed assertions */
+typedef struct
+{
+    Ifx_Assert_Record records[IFX_CFG_ASSERT_LOG_SIZE]; /**< \brief records, the oldest one is overwritten */
+    uint32            count;                            /**< \brief total number of failed assertions, the last record is records[(count - 1) % IFX_CFG_ASSERT_LOG_SIZE] */
+} Ifx_Assert_Log;
+
 /** \brief Set the standard output used for \ref IFX_ASSERT and \ref IFX_VALIDATE
  *
  * For example the standard IO could redirect the output to a serial interface, CAN interface, ...
@@ -117,6 +153,35 @@ IFX_EXTERN void Ifx_Assert_doLevel(uint8 level, pchar __assertion, pchar __file,
  */
 IFX_EXTERN boolean Ifx_Assert_doValidate(boolean expr, uint8 level, pchar __assertion, pchar __file, unsigned int __line, pchar __function);
 
+/** \internal
+ * \brief Store the record of a failed assertion in \ref Assert_log
+ *
+ * Do not call this function directly, use IFX_ASSERT() instead
+ *
+ * \param level assertion level
+ * \param module module identifier
+ * \param line line number where the assertion occurred
+ * \return void
+ */
+IFX_EXTERN void Ifx_Assert_doLog(uint8 level, uint8 module, uint16 line);
+
+/** \internal
+ * \brief Store the record of a failed validation in \ref Assert_log
+ *
+ * Do not call this function directly, use IFX_VALIDATE() instead
+ *
+ * \param expr expression value, assertion occurs if FALSE
+ * \param level assertion level
+ * \param module module identifier
+ * \param line line number where the assertion occurred
+ * \return expr
+ */
+IFX_EXTERN boolean Ifx_Assert_doValidateLog(boolean expr, uint8 level, uint8 module, uint16 line);
+
+#if IFX_CFG_ASSERT_LOG == 1
+IFX_EXTERN Ifx_Assert_Log Assert_log; /**< \brief Last failed assertions */
+#endif
+
 #if IFX_CFG_ASSERT_VERBOSE_LEVEL_DEFAULT > IFX_VERBOSE_LEVEL_OFF
 IFX_EXTERN uint32 Assert_verboseLevel; /**< \bri-ef Current verbose level, this value is initialised to IFX_CFG_ASSERT_VERBOSE_LEVEL_DEFAULT */
 
@@ -150,8 +215,10 @@ IFX_EXTERN uint32 Assert_verboseLevel; /**< \bri-ef Current verbose level, this
  *
  * \return void
  */
-#if IFX_CFG_ASSERT_VERBOSE_LEVEL_DEFAULT > IFX_VERBOSE_LEVEL_OFF
-#    define IFX_ASSERT(level, expr)   (((expr) || (level > Assert_verboseLevel)) ? ((void)0) : Ifx_Assert_doLevel(level,#expr, __FILE__, __LINE__, __func__))
+#if (IFX_CFG_ASSERT_VERBOSE_LEVEL_DEFAULT > IFX_VERBOSE_LEVEL_OFF) && (IFX_CFG_ASSERT_LOG == 1)
+#    define IFX_ASSERT(level, expr)   ((!IFX_ASSERT_IS_COMPILED(level) || (expr) || (level > Assert_verboseLevel)) ? ((void)0) : Ifx_Assert_doLog(level, IFX_ASSERT_MODULE_ID, __LINE__))
+#elif IFX_CFG_ASSERT_VERBOSE_LEVEL_DEFAULT > IFX_VERBOSE_LEVEL_OFF
+#    define IFX_ASSERT(level, expr)   ((!IFX_ASSERT_IS_COMPILED(level) || (expr) || (level > Assert_verboseLevel)) ? ((void)0) : Ifx_Assert_doLevel(level,#expr, __FILE__, __LINE__, __func__))
 #else
 #    define IFX_ASSERT(level, expr)   ((void)0)
 #endif
@@ -176,8 +243,10 @@ IFX_EXTERN uint32 Assert_verboseLevel; /**< \bri-ef Current verbose level, this
  *
  * \return void
  */
-#if IFX_CFG_ASSERT_VERBOSE_LEVEL_DEFAULT > IFX_VERBOSE_LEVEL_OFF
-#    define IFX_VALIDATE(level, expr) (Ifx_Assert_doValidate(expr, level,#expr, __FILE__, __LINE__, __func__))
+#if (IFX_CFG_ASSERT_VERBOSE_LEVEL_DEFAULT > IFX_VERBOSE_LEVEL_OFF) && (IFX_CFG_ASSERT_LOG == 1)
+#    define IFX_VALIDATE(level, expr) (IFX_ASSERT_IS_COMPILED(level) ? Ifx_Assert_doValidateLog(expr, level, IFX_ASSERT_MODULE_ID, __LINE__) : (expr))
+#elif IFX_CFG_ASSERT_VERBOSE_LEVEL_DEFAULT > IFX_VERBOSE_LEVEL_OFF
+#    define IFX_VALIDATE(level, expr) (IFX_ASSERT_IS_COMPILED(level) ? Ifx_Assert_doValidate(expr, level,#expr, __FILE__, __LINE__, __func__) : (expr))
 #else
 #    define IFX_VALIDATE(level, expr) (expr)
 #endif
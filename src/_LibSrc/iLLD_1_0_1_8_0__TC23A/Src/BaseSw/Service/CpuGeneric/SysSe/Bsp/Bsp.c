@@ -27,6 +27,27 @@
 
 Ifx_TickTime TimeConst[TIMER_COUNT];
 
+Bsp_CriticalSection Bsp_g_criticalSection[IFXCPU_NUM_MODULES];
+
+/** \brief Clear the critical section statistics of all CPUs
+ *
+ * \return None.
+ */
+void resetCriticalSections(void)
+{
+    uint32 i;
+
+    for (i = 0; i < IFXCPU_NUM_MODULES; i++)
+    {
+        boolean interruptState = IfxCpu_disableInterrupts();
+        Bsp_g_criticalSection[i].count     = 0;
+        Bsp_g_criticalSection[i].max       = 0;
+        Bsp_g_criticalSection[i].maxCaller = NULL_PTR;
+        IfxCpu_restoreInterrupts(interruptState);
+    }
+}
+
+
 /** \brief Initialize the time constants.
  *
  * Initialize the time constants TimeConst_0s, TimeConst_100ns, TimeConst_1us,
@@ -45,6 +45,32 @@
 #define BSP_DEFAULT_TIMER (&MODULE_STM0)
 #endif
 
+#ifndef IFX_CFG_BSP_CRITICAL_SECTION_MONITOR
+/** If 1, disableInterrupts() and restoreInterrupts() measure the critical sections, see \ref Bsp_CriticalSection */
+#define IFX_CFG_BSP_CRITICAL_SECTION_MONITOR (0)
+#endif
+
+/** \brief Critical section statistics of one CPU
+ *
+ * A critical section lasts from the disableInterrupts() call which disables the interrupts to the
+ * restoreInterrupts(TRUE) call which enables them again, nested sections are part of the outer one.
+ * The duration is measured with CCNT, the CPU clock counter must be running, see
+ * IfxCpu_resetAndStartCounters(). The caller is the name of the function which called disableInterrupts().
+ *
+ * Only the critical sections using the Bsp APIs are measured, not direct calls to IfxCpu_disableInterrupts().
+ */
+typedef struct
+{
+    uint32 start;           /**< \brief CCNT value at the start of the current section */
+    pchar  caller;          /**< \brief caller of the current section */
+    uint32 count;           /**< \brief number of sections */
+    uint32 max;             /**< \brief longest section in CPU cycles */
+    pchar  maxCaller;       /**< \brief caller of the longest section */
+} Bsp_CriticalSection;
+
+/** \brief Critical section statistics, indexed by the CPU index */
+IFX_EXTERN Bsp_CriticalSection Bsp_g_criticalSection[IFXCPU_NUM_MODULES];
+
 /******************************************************************************/
 /*                           Function prototypes                              */
 /******************************************************************************/
@@ -58,6 +84,9 @@ IFX_INLINE boolean disableInterrupts(void);
 IFX_INLINE void    enableInterrupts(void);
 IFX_INLINE void    restoreInterrupts(boolean enabled);
 IFX_INLINE void    forceDisableInterrupts(void);
+IFX_INLINE boolean disableInterruptsTagged(pchar caller);
+IFX_INLINE void    restoreInterruptsTagged(boolean enabled);
+IFX_EXTERN void    resetCriticalSections(void);
 /** \} */
 /** \} */
 
@@ -125,6 +154,64 @@ IFX_INLINE void restoreInterrupts(boolean enabled)
 }
 
 
+/** \brief Disable the global interrupts and start the measurement of the critical section
+ *
+ * \param caller Name of the calling function
+ *
+ * \retval TRUE if the global interrupts were enabled before the call to the function.
+ * \retval FALSE if the global interrupts are disabled before the call to the function.
+ *
+ * \see Bsp_CriticalSection, restoreInterruptsTagged()
+ */
+IFX_INLINE boolean disableInterruptsTagged(pchar caller)
+{
+    boolean enabled = IfxCpu_disableInterrupts();
+
+    if (enabled)
+    {
+        Bsp_CriticalSection *section = &Bsp_g_criticalSection[IfxCpu_getCoreIndex()];
+        section->caller = caller;
+        section->start  = IfxCpu_getClockCounter();
+    }
+
+    return enabled;
+}
+
+
+/** \brief End the measurement of the critical section and restore the state of the global interrupts
+ *
+ * \param enabled if TRUE, end the critical section and re-enable the global interrupts, else do nothing.
+ *
+ * \return None.
+ *
+ * \see Bsp_CriticalSection, disableInterruptsTagged()
+ */
+IFX_INLINE void restoreInterruptsTagged(boolean enabled)
+{
+    if (enabled)
+    {
+        Bsp_CriticalSection *section  = &Bsp_g_criticalSection[IfxCpu_getCoreIndex()];
+        uint32               duration = (IfxCpu_getClockCounter() - section->start) & 0x7FFFFFFFU;
+
+        section->count++;
+
+        if (duration > section->max)
+        {
+            section->max       = duration;
+            section->maxCaller = section->caller;
+        }
+    }
+
+    IfxCpu_restoreInterrupts(enabled);
+}
+
+
+#if IFX_CFG_BSP_CRITICAL_SECTION_MONITOR
+#define disableInterrupts()        disableInterruptsTagged(__func__)
+#define restoreInterrupts(enabled) restoreInterruptsTagged(enabled)
+#endif
+
+
 /******************************************************************************/
 /*                           Macros                                           */
 /******************************************************************************/
@@ -156,11 +243,13 @@ IFX_EXTERN Ifx_TickTime TimeConst[TIMER_COUNT];
  * \{ */
 IFX_INLINE Ifx_TickTime addTTime(Ifx_TickTime a, Ifx_TickTime b);
 IFX_INLINE Ifx_TickTime elapsed(Ifx_TickTime since);
+IFX_INLINE uint32       elapsedFast32(uint32 since);
 IFX_INLINE Ifx_TickTime getDeadLine(Ifx_TickTime timeout);
 IFX_INLINE Ifx_TickTime getTimeout(Ifx_TickTime deadline);
 IFX_EXTERN void         initTime(void);
 IFX_INLINE boolean      isDeadLine(Ifx_TickTime deadLine);
 IFX_INLINE Ifx_TickTime now(void);
+IFX_INLINE uint32       nowFast32(void);
 IFX_INLINE Ifx_TickTime nowWithoutCriticalSection(void);
 IFX_INLINE boolean      poll(volatile boolean *test, Ifx_TickTime timeout);
 IFX_INLINE Ifx_TickTime timingNoInterruptEnd(Ifx_TickTime since, boolean interruptEnabled);
@@ -191,39 +280,45 @@ typedef void (*WaitTimeFunction)(Ifx_TickTime timeout);
 /*                           Functions                                        */
 /******************************************************************************/
 
-/** \brief Return system timer value (critical section).
+/** \brief Return system timer value.
  *
- * The function IfxStm_get() is called in a critical section, disabling
- * the interrupts. The system timer value is limited to TIME_INFINITE.
+ * The function IfxStm_getLockFree() is called, the interrupts are not disabled: the function can be
+ * called in polling loops and from any interrupt. The system timer value is limited to TIME_INFINITE.
  *
  * \return Returns system timer value.
  */
 IFX_INLINE Ifx_TickTime now(void)
 {
     Ifx_TickTime stmNow;
-    boolean      interruptState;
 
-    interruptState = disableInterrupts();
-    stmNow         = (Ifx_TickTime)IfxStm_get(BSP_DEFAULT_TIMER) & TIME_INFINITE;
-    restoreInterrupts(interruptState);
+    stmNow = (Ifx_TickTime)IfxStm_getLockFree(BSP_DEFAULT_TIMER) & TIME_INFINITE;
 
     return stmNow;
 }
 
 
-/** \brief Return system timer value (without critical section).
+/** \brief Return the lower 32 bits of the system timer value.
  *
- * The function IfxStm_get() is called. The system timer value is limited to TIME_INFINITE.
+ * Single register read, for the measurement of durations shorter than 2^32 ticks (about 42s with a
+ * 100MHz system timer), see elapsedFast32().
  *
- * \return Returns system timer value.
+ * \return Returns the lower 32 bits of the system timer value.
  */
-IFX_INLINE Ifx_TickTime nowWithoutCriticalSection(void)
+IFX_INLINE uint32 nowFast32(void)
 {
-    Ifx_TickTime stmNow;
+    return IfxStm_getLower(BSP_DEFAULT_TIMER);
+}
 
-    stmNow = (Ifx_TickTime)IfxStm_get(BSP_DEFAULT_TIMER) & TIME_INFINITE;
 
-    return stmNow;
+/** \brief Return system timer value.
+ *
+ * Same as now(), kept for compatibility.
+ *
+ * \return Returns system timer value.
+ */
+IFX_INLINE Ifx_TickTime nowWithoutCriticalSection(void)
+{
+    return now();
 }
 
 
@@ -263,6 +358,18 @@ IFX_INLINE Ifx_TickTime elapsed(Ifx_TickTime since)
 }
 
 
+/** \brief Return the elapsed time in ticks, 32-bit version.
+ *
+ * \param since Start time returned by nowFast32()
+ *
+ * \return Returns the elapsed time, valid if shorter than 2^32 ticks.
+ */
+IFX_INLINE uint32 elapsedFast32(uint32 since)
+{
+    return nowFast32() - since;
+}
+
+
 /** \brief Return the time dead line.
  *
  * \param timeout Specifies the dead line from now: Deadline = Now + Timeout
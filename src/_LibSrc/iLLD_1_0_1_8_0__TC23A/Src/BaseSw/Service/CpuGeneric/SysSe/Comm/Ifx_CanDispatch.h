@@ -0,0 +1,202 @@
+/**
+ * \file Ifx_CanDispatch.h
+ * \brief CAN frame dispatch table
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_comm_candispatch CAN dispatch
+ * \ingroup library_srvsw_sysse_comm
+ *
+ * When many CAN IDs are received through one receive FIFO, the dispatcher routes each frame to its
+ * entry of a constant frame table. The frame table lists for each ID the minimal data length, the
+ * signals to be decoded and an optional handler. The signals are decoded in place into their
+ * variables, as described by the signal table (start bit, length, byte order, sign, factor and offset).
+ *
+ * The ID lookup uses an open addressing hash index, built by \ref Ifx_CanDispatch_init() from the frame
+ * table. The length of the longest probe sequence is known after the initialisation
+ * (Ifx_CanDispatch::maxProbes) and can be limited with Ifx_CanDispatch_Config::maxProbes, so that the
+ * dispatch time of a frame is bounded and does not depend on the number of IDs. With an index of at
+ * least 4 times the number of frames, the probe length is typically 1 or 2.
+ *
+ * \ref Ifx_CanDispatch_process() drains the receive FIFO with \ref IfxMultican_Can_MsgObj_readMessages()
+ * in batches of \ref IFX_CFG_CANDISPATCH_BATCH_SIZE frames and dispatches them. It is called from the
+ * FIFO receive interrupt or from a periodic task.
+ *
+ * Usage example:
+ * \code
+ * static float32 engineSpeed, engineTorque;
+ * static uint32  gear;
+ *
+ * static const Ifx_CanDispatch_Signal engineSignals[] = {
+ *     // startBit, length, byteOrder,                     isSigned, type,                                factor, offset, value
+ *     {0,         16,     Ifx_CanDispatch_ByteOrder_intel, FALSE,    Ifx_CanDispatch_SignalType_float32, 0.25F,  0.0F,   &engineSpeed },
+ *     {16,        12,     Ifx_CanDispatch_ByteOrder_intel, TRUE,     Ifx_CanDispatch_SignalType_float32, 0.5F,   0.0F,   &engineTorque},
+ *     {32,        4,      Ifx_CanDispatch_ByteOrder_intel, FALSE,    Ifx_CanDispatch_SignalType_raw,     1.0F,   0.0F,   &gear        },
+ * };
+ *
+ * static const Ifx_CanDispatch_Frame canFrames[] = {
+ *     // id,   minLength, signals,       signalCount,                  handler,      data
+ *     {0x123, 5,         engineSignals, Ifx_COUNTOF(engineSignals), NULL_PTR,     NULL_PTR},
+ *     {0x7DF, 8,         NULL_PTR,      0,                            &onDiagnose, &diag   },
+ * };
+ *
+ * static Ifx_CanDispatch_IndexEntry canIndex[1024];
+ * static Ifx_CanDispatch            canDispatch;
+ *
+ * // initialisation, canRxFifo is a receive FIFO accepting all IDs of the table
+ * Ifx_CanDispatch_Config config;
+ * Ifx_CanDispatch_initConfig(&config);
+ * config.msgObj     = &canRxFifo;
+ * config.frames     = canFrames;
+ * config.frameCount = Ifx_COUNTOF(canFrames);
+ * config.index      = canIndex;
+ * config.indexSize  = Ifx_COUNTOF(canIndex);
+ * config.maxProbes  = 2;
+ * Ifx_CanDispatch_init(&canDispatch, &config);
+ *
+ * // FIFO receive interrupt
+ * Ifx_CanDispatch_process(&canDispatch);
+ * \endcode
+ *
+ */
+#ifndef IFX_CANDISPATCH_H
+#define IFX_CANDISPATCH_H 1
+
+#include "Multican/Can/IfxMultican_Can.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_CANDISPATCH_BATCH_SIZE)
+#define IFX_CFG_CANDISPATCH_BATCH_SIZE (8)  /**<\brief Number of frames read from the FIFO at once by \ref Ifx_CanDispatch_process() */
+#endif
+
+/** \addtogroup library_srvsw_sysse_comm_candispatch
+ * \{ */
+
+/** \brief Signal byte order */
+typedef enum
+{
+    Ifx_CanDispatch_ByteOrder_intel    = 0, /**<\brief little endian, the start bit is the LSB */
+    Ifx_CanDispatch_ByteOrder_motorola = 1  /**<\brief big endian, the start bit is the MSB (DBC bit numbering) */
+} Ifx_CanDispatch_ByteOrder;
+
+/** \brief Signal variable type */
+typedef enum
+{
+    Ifx_CanDispatch_SignalType_raw     = 0, /**<\brief uint32 variable, raw value. Signed signals are sign extended (sint32) */
+    Ifx_CanDispatch_SignalType_float32 = 1  /**<\brief float32 variable, value = raw * factor + offset */
+} Ifx_CanDispatch_SignalType;
+
+/** \brief Signal description */
+typedef struct
+{
+    uint8                      startBit;   /**<\brief start bit, 0 .. 63 */
+    uint8                      length;     /**<\brief length in bits, 1 .. 32 */
+    Ifx_CanDispatch_ByteOrder  byteOrder;  /**<\brief byte order */
+    boolean                    isSigned;   /**<\brief TRUE if the raw value is a two's complement value */
+    Ifx_CanDispatch_SignalType type;       /**<\brief type of the variable */
+    float32                    factor;     /**<\brief scaling factor, Ifx_CanDispatch_SignalType_float32 only */
+    float32                    offset;     /**<\brief offset, Ifx_CanDispatch_SignalType_float32 only */
+    void                      *value;      /**<\brief variable updated with the signal value */
+} Ifx_CanDispatch_Signal;
+
+typedef struct Ifx_CanDispatch_Frame_s Ifx_CanDispatch_Frame;
+
+/** \brief Frame handler, called after the signals of the frame have been updated
+ * \param frame Pointer to the frame description
+ * \param msg Pointer to the received message
+ */
+typedef void (*Ifx_CanDispatch_Handler)(const Ifx_CanDispatch_Frame *frame, const IfxMultican_Message *msg);
+
+/** \brief Frame description */
+struct Ifx_CanDispatch_Frame_s
+{
+    uint32                        id;          /**<\brief CAN ID */
+    uint8                         minLength;   /**<\brief minimal number of data bytes, shorter frames are counted and ignored */
+    const Ifx_CanDispatch_Signal *signals;     /**<\brief signals of the frame, NULL_PTR if none */
+    uint8                         signalCount; /**<\brief number of signals */
+    Ifx_CanDispatch_Handler       handler;     /**<\brief frame handler, NULL_PTR if none */
+    void                         *data;        /**<\brief handler data */
+};
+
+/** \brief Index entry */
+typedef struct
+{
+    uint32                       id;     /**<\brief CAN ID */
+    const Ifx_CanDispatch_Frame *frame;  /**<\brief frame with this ID, NULL_PTR if the entry is free */
+} Ifx_CanDispatch_IndexEntry;
+
+/** \brief Dispatcher configuration */
+typedef struct
+{
+    IfxMultican_Can_MsgObj      *msgObj;      /**<\brief receive FIFO read by \ref Ifx_CanDispatch_process() */
+    const Ifx_CanDispatch_Frame *frames;      /**<\brief frame table */
+    uint32                       frameCount;  /**<\brief number of frames */
+    Ifx_CanDispatch_IndexEntry  *index;       /**<\brief index buffer */
+    uint32                       indexSize;   /**<\brief number of index entries, power of 2, greater than frameCount */
+    uint32                       maxProbes;   /**<\brief maximal accepted probe length, 0 for no limit */
+} Ifx_CanDispatch_Config;
+
+/** \brief Dispatcher object */
+typedef struct
+{
+    IfxMultican_Can_MsgObj     *msgObj;        /**<\brief receive FIFO */
+    Ifx_CanDispatch_IndexEntry *index;         /**<\brief index */
+    uint32                      indexMask;     /**<\brief number of index entries - 1 */
+    uint32                      indexShift;    /**<\brief hash shift, 32 - log2(number of index entries) */
+    uint32                      maxProbes;     /**<\brief length of the longest probe sequence */
+    uint32                      frames;        /**<\brief number of dispatched frames */
+    uint32                      unknownFrames; /**<\brief number of frames with an ID not in the table */
+    uint32                      shortFrames;   /**<\brief number of frames shorter than Ifx_CanDispatch_Frame::minLength */
+} Ifx_CanDispatch;
+
+/** \brief Dispatch one received message
+ * \param dispatch Pointer to the dispatcher object
+ * \param msg Pointer to the received message
+ * \return Returns TRUE if the frame was in the table and long enough
+ */
+IFX_EXTERN boolean Ifx_CanDispatch_dispatch(Ifx_CanDispatch *dispatch, const IfxMultican_Message *msg);
+
+/** \brief Find the frame description of a CAN ID
+ * \param dispatch Pointer to the dispatcher object
+ * \param id CAN ID
+ * \return Returns the frame description, NULL_PTR if the ID is not in the table
+ */
+IFX_EXTERN const Ifx_CanDispatch_Frame *Ifx_CanDispatch_find(Ifx_CanDispatch *dispatch, uint32 id);
+
+/** \brief Initialize the dispatcher and build the index
+ * \param dispatch Pointer to the dispatcher object
+ * \param config Pointer to the configuration
+ * \return Returns FALSE if the index is too small, an ID is duplicated or the probe length exceeds
+ * Ifx_CanDispatch_Config::maxProbes
+ */
+IFX_EXTERN boolean Ifx_CanDispatch_init(Ifx_CanDispatch *dispatch, const Ifx_CanDispatch_Config *config);
+
+/** \brief Initialize the configuration with default values
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_CanDispatch_initConfig(Ifx_CanDispatch_Config *config);
+
+/** \brief Read all received frames from the receive FIFO and dispatch them
+ * \param dispatch Pointer to the dispatcher object
+ * \return Returns the number of frames read
+ */
+IFX_EXTERN uint32 Ifx_CanDispatch_process(Ifx_CanDispatch *dispatch);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -0,0 +1,370 @@
+/**
+ * \file Ifx_CanTimeSync.c
+ * \brief Time synchronisation over CAN
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include <string.h>
+
+#include "Ifx_CanTimeSync.h"
+#include "Cpu/Std/IfxCpu.h"
+
+/** Measured rates beyond this limit in ppb are discarded, e.g. after the master time was set */
+#define IFX_CANTIMESYNC_MAX_RATE (1000000LL)
+
+/** Byte swap of a 32 bit word, the time fields are big endian
+ */
+IFX_INLINE uint32 Ifx_CanTimeSync_swap(uint32 value)
+{
+    return (value << 24) | ((value & 0xFF00U) << 8) | ((value >> 8) & 0xFF00U) | (value >> 24);
+}
+
+
+/** STM ticks to ns, without overflow
+ */
+static uint64 Ifx_CanTimeSync_ticksToNs(uint64 ticks, uint32 frequency)
+{
+    return ((ticks / frequency) * IFX_CANTIMESYNC_NANOSECONDS_PER_SECOND)
+           + (((ticks % frequency) * IFX_CANTIMESYNC_NANOSECONDS_PER_SECOND) / frequency);
+}
+
+
+/** ns to STM ticks, without overflow
+ */
+static uint64 Ifx_CanTimeSync_nsToTicks(uint64 ns, uint32 frequency)
+{
+    return ((ns / IFX_CANTIMESYNC_NANOSECONDS_PER_SECOND) * frequency)
+           + (((ns % IFX_CANTIMESYNC_NANOSECONDS_PER_SECOND) * frequency) / IFX_CANTIMESYNC_NANOSECONDS_PER_SECOND);
+}
+
+
+/** Converts the frame counter value captured with a frame into the STM value of the frame.
+ * The frame counter and the STM are read together, the frame counter wraps around after 65536 bit times
+ */
+static uint64 Ifx_CanTimeSync_getFrameTicks(Ifx_CanTimeSync *timeSync, uint16 frameCounter)
+{
+    uint64  now;
+    uint16  counter;
+    uint32  age;
+    boolean interruptState = IfxCpu_disableInterrupts();
+
+    now     = IfxStm_get(timeSync->config.stm);
+    counter = IfxMultican_Node_getFrameCounter(timeSync->node);
+    IfxCpu_restoreInterrupts(interruptState);
+
+    age     = (uint16)(counter - frameCounter);
+
+    return now - (((uint64)age * timeSync->stmFrequency) / timeSync->config.baudrate);
+}
+
+
+/** Sends a SYNC or FUP frame with the current sequence counter
+ */
+static IfxMultican_Status Ifx_CanTimeSync_send(Ifx_CanTimeSync *timeSync, uint8 type, uint8 overflow, uint32 value)
+{
+    IfxMultican_Message msg;
+    uint32              header = ((uint32)timeSync->config.domain << 4) | timeSync->sequence;
+
+    IfxMultican_Message_init(&msg, IfxMultican_MsgObj_getMessageId(timeSync->hwObj),
+        type | (header << 16) | ((uint32)overflow << 24), Ifx_CanTimeSync_swap(value), IfxMultican_DataLengthCode_8);
+
+    IfxMultican_MsgObj_clearTxPending(timeSync->hwObj);
+
+    return IfxMultican_Can_MsgObj_sendMessage(timeSync->config.msgObj, &msg);
+}
+
+
+/** Master: sends the SYNC every syncPeriod calls, then the FUP once the SYNC is transmitted
+ */
+static void Ifx_CanTimeSync_processMaster(Ifx_CanTimeSync *timeSync)
+{
+    if (timeSync->age < 0xFFFFU)
+    {
+        timeSync->age++;
+    }
+
+    if ((timeSync->state == Ifx_CanTimeSync_State_idle) && (timeSync->age >= timeSync->config.syncPeriod))
+    {
+        sint64 now      = Ifx_CanTimeSync_getTime(timeSync, IfxStm_get(timeSync->config.stm));
+        uint8  sequence = timeSync->sequence;
+
+        timeSync->sequence    = (uint8)((sequence + 1) & 0xFU);
+        timeSync->syncSeconds = (uint32)(now / IFX_CANTIMESYNC_NANOSECONDS_PER_SECOND);
+
+        if (Ifx_CanTimeSync_send(timeSync, IFX_CANTIMESYNC_TYPE_SYNC, 0, timeSync->syncSeconds) == IfxMultican_Status_ok)
+        {
+            timeSync->state = Ifx_CanTimeSync_State_syncPending;
+            timeSync->age   = 0;
+        }
+        else
+        {
+            timeSync->sequence = sequence;
+        }
+    }
+
+    if (timeSync->state == Ifx_CanTimeSync_State_syncPending)
+    {
+        if (IfxMultican_MsgObj_isTxPending(timeSync->hwObj) != FALSE)
+        {
+            timeSync->syncTicks = Ifx_CanTimeSync_getFrameTicks(timeSync, IfxMultican_MsgObj_getFrameCounterValue(timeSync->hwObj));
+            timeSync->state     = Ifx_CanTimeSync_State_fupPending;
+        }
+        else if (timeSync->age >= timeSync->config.syncTimeout)
+        {
+            /* bus off or bus saturated: next SYNC at the next period */
+            IfxMultican_MsgObj_cancelSend(timeSync->hwObj);
+            timeSync->state = Ifx_CanTimeSync_State_idle;
+            timeSync->errors++;
+        }
+    }
+
+    if (timeSync->state == Ifx_CanTimeSync_State_fupPending)
+    {
+        /* SYNC time relative to the seconds of the SYNC frame, at least 0 */
+        sint64 ns       = Ifx_CanTimeSync_getTime(timeSync, timeSync->syncTicks) - ((sint64)timeSync->syncSeconds * IFX_CANTIMESYNC_NANOSECONDS_PER_SECOND);
+        uint8  overflow = (uint8)(ns / IFX_CANTIMESYNC_NANOSECONDS_PER_SECOND);
+
+        ns = ns % IFX_CANTIMESYNC_NANOSECONDS_PER_SECOND;
+
+        if (Ifx_CanTimeSync_send(timeSync, IFX_CANTIMESYNC_TYPE_FUP, overflow, (uint32)ns) == IfxMultican_Status_ok)
+        {
+            timeSync->state = Ifx_CanTimeSync_State_idle;
+            timeSync->syncs++;
+        }
+    }
+}
+
+
+/** Slave: maps the STM to the master time with the SYNC / FUP pair
+ */
+static void Ifx_CanTimeSync_sample(Ifx_CanTimeSync *timeSync, uint64 ticks, sint64 time)
+{
+    sint64 nominal = (ticks > timeSync->ticks) ? (sint64)Ifx_CanTimeSync_ticksToNs(ticks - timeSync->ticks, timeSync->stmFrequency) : 0;
+
+    if ((timeSync->synchronised != FALSE) && (nominal > 0))
+    {
+        sint64 rate = (((time - timeSync->time) - nominal) * IFX_CANTIMESYNC_NANOSECONDS_PER_SECOND) / nominal;
+
+        if ((rate > IFX_CANTIMESYNC_MAX_RATE) || (rate < -IFX_CANTIMESYNC_MAX_RATE))
+        {
+            timeSync->samples = 1;
+        }
+        else if (timeSync->samples == 1)
+        {
+            timeSync->rate = (sint32)rate;
+            timeSync->samples++;
+        }
+        else
+        {
+            timeSync->rate += (sint32)((rate - timeSync->rate) / IFX_CFG_CANTIMESYNC_RATE_FILTER);
+            timeSync->samples++;
+        }
+    }
+    else
+    {
+        timeSync->samples = 1;
+    }
+
+    timeSync->ticks        = ticks;
+    timeSync->time         = time;
+    timeSync->synchronised = TRUE;
+    timeSync->syncs++;
+}
+
+
+/** Slave: reads the SYNC and FUP frames
+ */
+static void Ifx_CanTimeSync_processSlave(Ifx_CanTimeSync *timeSync)
+{
+    IfxMultican_Message msg;
+    IfxMultican_Status  status;
+    uint16              frameCounter;
+
+    if (timeSync->age < 0xFFFFU)
+    {
+        timeSync->age++;
+    }
+
+    if (timeSync->age > timeSync->config.syncTimeout)
+    {
+        /* master lost: the STM keeps being converted with the last mapping */
+        timeSync->synchronised = FALSE;
+    }
+
+    /* the frame counter value belongs to the frame if it did not change during the read */
+    frameCounter = IfxMultican_MsgObj_getFrameCounterValue(timeSync->hwObj);
+    status       = IfxMultican_Can_MsgObj_readMessage(timeSync->config.msgObj, &msg);
+
+    if ((status == IfxMultican_Status_newData) && (frameCounter == IfxMultican_MsgObj_getFrameCounterValue(timeSync->hwObj))
+        && (msg.lengthCode >= IfxMultican_DataLengthCode_8))
+    {
+        uint8  type     = (uint8)msg.data[0];
+        uint8  header   = (uint8)(msg.data[0] >> 16);
+        uint32 overflow = (msg.data[0] >> 24) & 0x3U;
+
+        if ((header >> 4) != timeSync->config.domain)
+        {
+            /* other time domain */
+        }
+        else if (type == IFX_CANTIMESYNC_TYPE_SYNC)
+        {
+            timeSync->sequence    = header & 0xFU;
+            timeSync->syncSeconds = Ifx_CanTimeSync_swap(msg.data[1]);
+            timeSync->syncTicks   = Ifx_CanTimeSync_getFrameTicks(timeSync, frameCounter);
+            timeSync->state       = Ifx_CanTimeSync_State_fupPending;
+        }
+        else if (type == IFX_CANTIMESYNC_TYPE_FUP)
+        {
+            if ((timeSync->state == Ifx_CanTimeSync_State_fupPending) && ((header & 0xFU) == timeSync->sequence))
+            {
+                sint64 time = ((sint64)(timeSync->syncSeconds + overflow) * IFX_CANTIMESYNC_NANOSECONDS_PER_SECOND)
+                              + Ifx_CanTimeSync_swap(msg.data[1]) + timeSync->config.delayCompensation;
+
+                Ifx_CanTimeSync_sample(timeSync, timeSync->syncTicks, time);
+                timeSync->age = 0;
+            }
+            else
+            {
+                timeSync->errors++;
+            }
+
+            timeSync->state = Ifx_CanTimeSync_State_idle;
+        }
+        else
+        {}
+    }
+    else if (status != IfxMultican_Status_receiveEmpty)
+    {
+        /* frame lost or time stamp not consistent: wait for the next SYNC */
+        timeSync->state = Ifx_CanTimeSync_State_idle;
+    }
+    else
+    {}
+}
+
+
+uint64 Ifx_CanTimeSync_getTicks(const Ifx_CanTimeSync *timeSync, sint64 time)
+{
+    sint64 elapsed = time - timeSync->time;
+    uint64 ticks;
+
+    /* inverse rate correction, first order */
+    elapsed -= (elapsed * timeSync->rate) / IFX_CANTIMESYNC_NANOSECONDS_PER_SECOND;
+
+    if (elapsed >= 0)
+    {
+        ticks = timeSync->ticks + Ifx_CanTimeSync_nsToTicks((uint64)elapsed, timeSync->stmFrequency);
+    }
+    else
+    {
+        ticks = timeSync->ticks - Ifx_CanTimeSync_nsToTicks((uint64)(-elapsed), timeSync->stmFrequency);
+    }
+
+    return ticks;
+}
+
+
+sint64 Ifx_CanTimeSync_getTime(const Ifx_CanTimeSync *timeSync, uint64 ticks)
+{
+    sint64 elapsed;
+
+    if (ticks >= timeSync->ticks)
+    {
+        elapsed = (sint64)Ifx_CanTimeSync_ticksToNs(ticks - timeSync->ticks, timeSync->stmFrequency);
+    }
+    else
+    {
+        elapsed = -(sint64)Ifx_CanTimeSync_ticksToNs(timeSync->ticks - ticks, timeSync->stmFrequency);
+    }
+
+    return timeSync->time + elapsed + ((elapsed * timeSync->rate) / IFX_CANTIMESYNC_NANOSECONDS_PER_SECOND);
+}
+
+
+boolean Ifx_CanTimeSync_init(Ifx_CanTimeSync *timeSync, const Ifx_CanTimeSync_Config *config)
+{
+    boolean result = (config->msgObj != NULL_PTR) && (config->stm != NULL_PTR) && (config->baudrate != 0)
+                     && (config->domain <= 0xFU) && (config->syncPeriod != 0);
+
+    memset(timeSync, 0, sizeof(Ifx_CanTimeSync));
+
+    if (result != FALSE)
+    {
+        timeSync->config       = *config;
+        timeSync->node         = config->msgObj->node->node;
+        timeSync->hwObj        = IfxMultican_MsgObj_getPointer(config->msgObj->node->mcan, config->msgObj->msgObjId);
+        timeSync->stmFrequency = (uint32)IfxStm_getFrequency(config->stm);
+        timeSync->state        = Ifx_CanTimeSync_State_idle;
+
+        if (config->role == Ifx_CanTimeSync_Role_master)
+        {
+            /* the master time is its STM time, first SYNC at the first process call */
+            timeSync->synchronised = TRUE;
+            timeSync->age          = config->syncPeriod;
+        }
+
+        /* the frame counter counts bit times and is captured into MOIPR.CFCVAL with each frame */
+        IfxMultican_Node_setFrameCounterMode(timeSync->node, IfxMultican_FrameCounterMode_timeStampMode);
+    }
+
+    return result;
+}
+
+
+void Ifx_CanTimeSync_initConfig(Ifx_CanTimeSync_Config *config)
+{
+    config->msgObj            = NULL_PTR;
+    config->role              = Ifx_CanTimeSync_Role_slave;
+    config->domain            = 0;
+    config->stm               = NULL_PTR;
+    config->baudrate          = 500000;
+    config->syncPeriod        = 100;
+    config->syncTimeout       = 300;
+    config->delayCompensation = 0;
+}
+
+
+boolean Ifx_CanTimeSync_isSynchronised(const Ifx_CanTimeSync *timeSync)
+{
+    return timeSync->synchronised;
+}
+
+
+void Ifx_CanTimeSync_process(Ifx_CanTimeSync *timeSync)
+{
+    if (timeSync->config.role == Ifx_CanTimeSync_Role_master)
+    {
+        Ifx_CanTimeSync_processMaster(timeSync);
+    }
+    else
+    {
+        Ifx_CanTimeSync_processSlave(timeSync);
+    }
+}
+
+
+void Ifx_CanTimeSync_setTime(Ifx_CanTimeSync *timeSync, sint64 time)
+{
+    if (timeSync->config.role == Ifx_CanTimeSync_Role_master)
+    {
+        timeSync->ticks = IfxStm_get(timeSync->config.stm);
+        timeSync->time  = time;
+    }
+}
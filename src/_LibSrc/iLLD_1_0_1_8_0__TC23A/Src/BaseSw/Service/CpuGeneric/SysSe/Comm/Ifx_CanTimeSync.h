@@ -0,0 +1,200 @@
+/**
+ * \file Ifx_CanTimeSync.h
+ * \brief Time synchronisation over CAN
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_comm_cantimesync CAN time synchronisation
+ * \ingroup library_srvsw_sysse_comm
+ *
+ * Synchronises the STM based time of nodes without ethernet (see \ref library_srvsw_sysse_comm_ptp) to a
+ * time master over CAN, with the two step SYNC / FUP protocol of the AUTOSAR CAN time synchronisation
+ * (CanTSyn, classic CAN, no CRC):
+ *
+ * | Byte | SYNC                          | FUP                                            |
+ * |------|-------------------------------|------------------------------------------------|
+ * | 0    | type 0x10                     | type 0x18                                      |
+ * | 1    | 0                             | 0                                              |
+ * | 2    | domain (7:4), sequence (3:0)  | domain (7:4), sequence (3:0)                   |
+ * | 3    | 0                             | overflow of the seconds (1:0)                  |
+ * | 4..7 | seconds, big endian           | nanoseconds, big endian                        |
+ *
+ * Both frames use the same ID. The SYNC time is the time at which the SYNC frame was on the bus: the
+ * master sends the seconds of its time before the transmission in the SYNC, and the nanoseconds relative
+ * to these seconds of the actual transmission time in the FUP.
+ *
+ * The transmission time is given by the frame counter of the node, used in time stamp mode: the counter
+ * counts bit times and is captured into the message object (MOIPR.CFCVAL) with each transmitted or received
+ * frame. The master and the slaves capture the same frame at the same point, a bit time resolution (1 us at
+ * 1 Mbit/s) is reached without additional wiring. The captured value is converted into an STM value by
+ * reading the frame counter and the STM together, the frame shall be processed within 65536 bit times.
+ *
+ * The STM cannot be adjusted: the slave maps its STM to the master time instead. On each SYNC / FUP pair,
+ * the STM value and the master time of the SYNC frame are stored, and the STM rate to the master is estimated
+ * from the previous pair and filtered. \ref Ifx_CanTimeSync_getTicks() then converts a master time into an
+ * STM value, e.g. to program an STM compare at the same master time on all nodes, and
+ * \ref Ifx_CanTimeSync_getTime() the reverse. The master uses the same functions, its time is its STM time,
+ * optionally set with \ref Ifx_CanTimeSync_setTime().
+ *
+ * \ref Ifx_CanTimeSync_process() is called periodically, e.g. every 1 ms. The master sends a SYNC every
+ * \ref Ifx_CanTimeSync_Config::syncPeriod calls, and the FUP at the first call after the SYNC transmission.
+ * The slave reads the message object; it shall be called at least once between the SYNC and the FUP,
+ * e.g. from the receive interrupt of the message object.
+ *
+ * Usage example:
+ * \code
+ * static IfxMultican_Can_MsgObj timeSyncMsgObj;   // transmit (master) or receive (slave), ID 0x100
+ * static Ifx_CanTimeSync        timeSync;
+ *
+ * // initialisation, after IfxMultican_Can_MsgObj_init()
+ * Ifx_CanTimeSync_Config config;
+ * Ifx_CanTimeSync_initConfig(&config);
+ * config.msgObj   = &timeSyncMsgObj;
+ * config.role     = Ifx_CanTimeSync_Role_slave;
+ * config.stm      = &MODULE_STM0;
+ * config.baudrate = 500000;
+ * Ifx_CanTimeSync_init(&timeSync, &config);
+ *
+ * // 1 ms task
+ * Ifx_CanTimeSync_process(&timeSync);
+ *
+ * // sample at the next full second of the master time, on all nodes
+ * if (Ifx_CanTimeSync_isSynchronised(&timeSync) != FALSE)
+ * {
+ *     sint64 now = Ifx_CanTimeSync_getTime(&timeSync, IfxStm_get(&MODULE_STM0));
+ *     uint64 ticks = Ifx_CanTimeSync_getTicks(&timeSync, ((now / IFX_CANTIMESYNC_NANOSECONDS_PER_SECOND) + 1) * IFX_CANTIMESYNC_NANOSECONDS_PER_SECOND);
+ *     IfxStm_updateCompare(&MODULE_STM0, IfxStm_Comparator_0, (uint32)ticks);
+ * }
+ * \endcode
+ *
+ */
+#ifndef IFX_CANTIMESYNC_H
+#define IFX_CANTIMESYNC_H 1
+
+#include "Multican/Can/IfxMultican_Can.h"
+#include "Stm/Std/IfxStm.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_CANTIMESYNC_RATE_FILTER)
+#define IFX_CFG_CANTIMESYNC_RATE_FILTER (8)  /**<\brief Time constant of the rate filter, in SYNC / FUP pairs */
+#endif
+
+#define IFX_CANTIMESYNC_TYPE_SYNC              (0x10U)        /**<\brief Type of the SYNC frame (byte 0) */
+#define IFX_CANTIMESYNC_TYPE_FUP               (0x18U)        /**<\brief Type of the FUP frame (byte 0) */
+#define IFX_CANTIMESYNC_NANOSECONDS_PER_SECOND (1000000000LL) /**<\brief Nanoseconds per second */
+
+/** \addtogroup library_srvsw_sysse_comm_cantimesync
+ * \{ */
+
+/** \brief Role of the node */
+typedef enum
+{
+    Ifx_CanTimeSync_Role_master,  /**<\brief Sends SYNC and FUP, its STM defines the time */
+    Ifx_CanTimeSync_Role_slave    /**<\brief Receives SYNC and FUP, its STM is mapped to the master time */
+} Ifx_CanTimeSync_Role;
+
+/** \brief State of the SYNC / FUP exchange */
+typedef enum
+{
+    Ifx_CanTimeSync_State_idle,         /**<\brief No SYNC pending */
+    Ifx_CanTimeSync_State_syncPending,  /**<\brief Master: SYNC requested, not yet transmitted */
+    Ifx_CanTimeSync_State_fupPending    /**<\brief Master: SYNC transmitted, FUP not yet sent. Slave: SYNC received, FUP expected */
+} Ifx_CanTimeSync_State;
+
+/** \brief Configuration */
+typedef struct
+{
+    IfxMultican_Can_MsgObj *msgObj;              /**<\brief Initialised standard message object, transmit (master) or receive (slave), 8 data bytes */
+    Ifx_CanTimeSync_Role    role;                /**<\brief Role of the node */
+    uint8                   domain;              /**<\brief Time domain, 0 .. 15 */
+    Ifx_STM                *stm;                 /**<\brief STM used as local time */
+    uint32                  baudrate;            /**<\brief Nominal baudrate of the node */
+    uint16                  syncPeriod;          /**<\brief Master: number of Ifx_CanTimeSync_process() calls between 2 SYNC */
+    uint16                  syncTimeout;         /**<\brief Master: calls after which a SYNC not transmitted is cancelled. Slave: calls without FUP after which the slave is not synchronised */
+    sint32                  delayCompensation;   /**<\brief Slave: time in ns added to the master time, compensation of the transceiver and capture delays */
+} Ifx_CanTimeSync_Config;
+
+/** \brief Time synchronisation object */
+typedef struct
+{
+    Ifx_CanTimeSync_Config config;          /**<\brief Copy of the configuration */
+    Ifx_CAN_N             *node;            /**<\brief Node registers */
+    Ifx_CAN_MO            *hwObj;           /**<\brief Message object registers */
+    uint32                 stmFrequency;    /**<\brief STM frequency in Hz */
+    Ifx_CanTimeSync_State  state;           /**<\brief State of the SYNC / FUP exchange */
+    uint16                 age;             /**<\brief Number of Ifx_CanTimeSync_process() calls since the last SYNC sent (master) or FUP received (slave) */
+    uint8                  sequence;        /**<\brief Sequence counter of the last SYNC */
+    uint32                 syncSeconds;     /**<\brief Seconds of the last SYNC */
+    uint64                 syncTicks;       /**<\brief STM value at the last SYNC frame */
+    boolean                synchronised;    /**<\brief TRUE if the time base follows the master */
+    uint32                 samples;         /**<\brief Number of SYNC / FUP pairs since the slave is synchronised */
+    uint64                 ticks;           /**<\brief STM value of the last SYNC / FUP pair */
+    sint64                 time;            /**<\brief Master time of the last SYNC / FUP pair in ns */
+    sint32                 rate;            /**<\brief STM rate deviation from the master in ppb, filtered */
+    uint32                 syncs;           /**<\brief Number of SYNC / FUP pairs sent or used */
+    uint32                 errors;          /**<\brief Number of SYNC cancelled (master) or FUP not matching the SYNC (slave) */
+} Ifx_CanTimeSync;
+
+/** \brief Converts a master time into an STM value
+ * \param timeSync Pointer to the time synchronisation object
+ * \param time Master time in ns
+ * \return Returns the STM value at the master time
+ */
+IFX_EXTERN uint64 Ifx_CanTimeSync_getTicks(const Ifx_CanTimeSync *timeSync, sint64 time);
+
+/** \brief Converts an STM value into a master time
+ * \param timeSync Pointer to the time synchronisation object
+ * \param ticks STM value
+ * \return Returns the master time in ns
+ */
+IFX_EXTERN sint64 Ifx_CanTimeSync_getTime(const Ifx_CanTimeSync *timeSync, uint64 ticks);
+
+/** \brief Initialize the time synchronisation, the frame counter of the node is set to time stamp mode
+ * \param timeSync Pointer to the time synchronisation object
+ * \param config Pointer to the configuration
+ * \return Returns FALSE if the configuration is invalid
+ */
+IFX_EXTERN boolean Ifx_CanTimeSync_init(Ifx_CanTimeSync *timeSync, const Ifx_CanTimeSync_Config *config);
+
+/** \brief Initialize the configuration with default values: slave, domain 0, 500 kbit/s, SYNC every 100 calls, timeout 300 calls
+ * \param config Pointer to the configuration
+ * \return None
+ */
+IFX_EXTERN void Ifx_CanTimeSync_initConfig(Ifx_CanTimeSync_Config *config);
+
+/** \brief Returns TRUE if the time base follows the master, always TRUE for the master
+ * \param timeSync Pointer to the time synchronisation object
+ */
+IFX_EXTERN boolean Ifx_CanTimeSync_isSynchronised(const Ifx_CanTimeSync *timeSync);
+
+/** \brief Sends the SYNC and FUP (master) or reads them (slave)
+ * \param timeSync Pointer to the time synchronisation object
+ * \return None
+ */
+IFX_EXTERN void Ifx_CanTimeSync_process(Ifx_CanTimeSync *timeSync);
+
+/** \brief Sets the master time, master only
+ * \param timeSync Pointer to the time synchronisation object
+ * \param time Current time in ns
+ * \return None
+ */
+IFX_EXTERN void Ifx_CanTimeSync_setTime(Ifx_CanTimeSync *timeSync, sint64 time);
+
+/** \} */
+
+#endif /* IFX_CANTIMESYNC_H */
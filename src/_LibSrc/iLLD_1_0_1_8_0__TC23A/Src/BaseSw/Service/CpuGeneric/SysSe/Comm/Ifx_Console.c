@@ -40,6 +40,17 @@ void Ifx_Console_init(IfxStdIf_DPipe *standardIo)
 {
     Ifx_g_console.standardIo = standardIo;
     Ifx_g_console.align      = 0;
+    Ifx_g_console.log        = NULL_PTR;
+}
+
+
+/**
+ * \brief Attach a deferred log to the \ref Ifx_g_console object.
+ * \param log Pointer to the log object, already initialised with \ref Ifx_Log_init().
+ */
+void Ifx_Console_initLog(Ifx_Log *log)
+{
+    Ifx_g_console.log = log;
 }
 
 
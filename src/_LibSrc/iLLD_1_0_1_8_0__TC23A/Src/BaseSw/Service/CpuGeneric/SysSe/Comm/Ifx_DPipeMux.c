@@ -0,0 +1,446 @@
+/**
+ * \file Ifx_DPipeMux.c
+ * \brief Standard interface multiplexer: one shared message ring, several sinks
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include <string.h>
+
+#include "Ifx_DPipeMux.h"
+#include "_Utilities/Ifx_Assert.h"
+#include "Cpu/Std/IfxCpu.h"
+#include "SysSe/Bsp/Bsp.h"
+
+/** \brief Copy bytes from the ring, the ring position may wrap */
+static void Ifx_DPipeMux_copyFromRing(const Ifx_DPipeMux *mux, uint32 position, uint8 *data, uint32 count)
+{
+    uint32 index = position % mux->size;
+    uint32 first = mux->size - index;
+
+    if (first > count)
+    {
+        first = count;
+    }
+
+    memcpy(data, &mux->buffer[index], first);
+    memcpy(&data[first], &mux->buffer[0], count - first);
+}
+
+
+/** \brief Copy bytes to the ring, the ring position may wrap */
+static void Ifx_DPipeMux_copyToRing(Ifx_DPipeMux *mux, uint32 position, const uint8 *data, uint32 count)
+{
+    uint32 index = position % mux->size;
+    uint32 first = mux->size - index;
+
+    if (first > count)
+    {
+        first = count;
+    }
+
+    memcpy(&mux->buffer[index], data, first);
+    memcpy(&mux->buffer[0], &data[first], count - first);
+}
+
+
+/** \brief Refill the token bucket of the sink
+ * \return Returns TRUE if the message of count bytes can be sent within the rate
+ */
+static boolean Ifx_DPipeMux_takeTokens(Ifx_DPipeMux_Sink *sink, Ifx_SizeT count)
+{
+    Ifx_TickTime time    = now();
+    Ifx_TickTime elapsed = time - sink->refillTime;
+    Ifx_TickTime added   = (elapsed * sink->rate) / TimeConst_1s;
+
+    if ((sink->tokens + added) >= sink->burst)
+    {
+        sink->tokens     = sink->burst;
+        sink->refillTime = time;
+    }
+    else if (added > 0)
+    {
+        /* Only the time of the added tokens is consumed, the rest is kept for the next refill */
+        sink->tokens     += (uint32)added;
+        sink->refillTime += (added * TimeConst_1s) / sink->rate;
+    }
+
+    if (sink->tokens >= count)
+    {
+        sink->tokens -= count;
+        return TRUE;
+    }
+    else
+    {
+        return FALSE;
+    }
+}
+
+
+/** \brief Move the sink to the next message for it
+ * \return Returns FALSE if no message is available
+ */
+static boolean Ifx_DPipeMux_readMessage(Ifx_DPipeMux *mux, Ifx_DPipeMux_Sink *sink)
+{
+    while (sink->readTotal != mux->writeTotal)
+    {
+        uint8     header[IFX_DPIPEMUX_HEADER_SIZE];
+        Ifx_SizeT count;
+        uint8     source;
+
+        if ((sint32)(mux->tailTotal - sink->readTotal) > 0)
+        {
+            /* The messages were overwritten before being read */
+            sink->overrunCount++;
+            sink->readTotal = mux->tailTotal;
+            continue;
+        }
+
+        Ifx_DPipeMux_copyFromRing(mux, sink->readTotal, header, IFX_DPIPEMUX_HEADER_SIZE);
+        count  = (Ifx_SizeT)(header[0] | ((uint32)header[1] << 8));
+        source = header[2];
+
+        if ((count == 0) || (count > IFX_CFG_DPIPEMUX_MAX_MESSAGE))
+        {
+            /* Header overwritten while being read, checked below */
+            count = 0;
+        }
+
+        Ifx_DPipeMux_copyFromRing(mux, sink->readTotal + IFX_DPIPEMUX_HEADER_SIZE, sink->message, count);
+        __dsync();  /* The message must be read before its validity is checked */
+
+        if (((sint32)(mux->tailTotal - sink->readTotal) > 0) || (count == 0))
+        {
+            sink->overrunCount++;
+            sink->readTotal = mux->tailTotal;
+            continue;
+        }
+
+        sink->readTotal += IFX_DPIPEMUX_HEADER_SIZE + count;
+
+        if ((source >= 32) || ((sink->sourceMask & (1U << source)) == 0))
+        {
+            continue;
+        }
+
+        if ((sink->rate != 0) && (Ifx_DPipeMux_takeTokens(sink, count) == FALSE))
+        {
+            sink->rateDropCount++;
+            continue;
+        }
+
+        sink->pendingIndex = 0;
+        sink->pendingCount = count;
+        sink->sentCount++;
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+
+static boolean Ifx_DPipeMux_Input_canReadCount(Ifx_DPipeMux_Input *input, Ifx_SizeT count, Ifx_TickTime timeout)
+{
+    return (input->rx != NULL_PTR) ? IfxStdIf_DPipe_canReadCount(input->rx, count, timeout) : FALSE;
+}
+
+
+static boolean Ifx_DPipeMux_Input_canWriteCount(Ifx_DPipeMux_Input *input, Ifx_SizeT count, Ifx_TickTime timeout)
+{
+    (void)input;
+    (void)count;
+    (void)timeout;
+    return TRUE;
+}
+
+
+static void Ifx_DPipeMux_Input_clearRx(Ifx_DPipeMux_Input *input)
+{
+    if (input->rx != NULL_PTR)
+    {
+        IfxStdIf_DPipe_clearRx(input->rx);
+    }
+}
+
+
+static void Ifx_DPipeMux_Input_clearTx(Ifx_DPipeMux_Input *input)
+{
+    (void)input;
+}
+
+
+static boolean Ifx_DPipeMux_Input_flushTx(Ifx_DPipeMux_Input *input, Ifx_TickTime timeout)
+{
+    (void)input;
+    (void)timeout;
+    return TRUE;
+}
+
+
+static sint32 Ifx_DPipeMux_Input_getReadCount(Ifx_DPipeMux_Input *input)
+{
+    return (input->rx != NULL_PTR) ? IfxStdIf_DPipe_getReadCount(input->rx) : 0;
+}
+
+
+static IfxStdIf_DPipe_ReadEvent Ifx_DPipeMux_Input_getReadEvent(Ifx_DPipeMux_Input *input)
+{
+    return (input->rx != NULL_PTR) ? IfxStdIf_DPipe_getReadEvent(input->rx) : NULL_PTR;
+}
+
+
+static uint32 Ifx_DPipeMux_Input_getSendCount(Ifx_DPipeMux_Input *input)
+{
+    return input->sendCount;
+}
+
+
+static Ifx_TickTime Ifx_DPipeMux_Input_getTxTimeStamp(Ifx_DPipeMux_Input *input)
+{
+    (void)input;
+    return 0;
+}
+
+
+static sint32 Ifx_DPipeMux_Input_getWriteCount(Ifx_DPipeMux_Input *input)
+{
+    return (sint32)input->mux->size;
+}
+
+
+static IfxStdIf_DPipe_WriteEvent Ifx_DPipeMux_Input_getWriteEvent(Ifx_DPipeMux_Input *input)
+{
+    (void)input;
+    return NULL_PTR;
+}
+
+
+static void Ifx_DPipeMux_Input_onEvent(Ifx_DPipeMux_Input *input)
+{
+    (void)input;
+}
+
+
+static boolean Ifx_DPipeMux_Input_read(Ifx_DPipeMux_Input *input, void *data, Ifx_SizeT *count, Ifx_TickTime timeout)
+{
+    if (input->rx != NULL_PTR)
+    {
+        return IfxStdIf_DPipe_read(input->rx, data, count, timeout);
+    }
+    else
+    {
+        *count = 0;
+        return FALSE;
+    }
+}
+
+
+static void Ifx_DPipeMux_Input_resetSendCount(Ifx_DPipeMux_Input *input)
+{
+    input->sendCount = 0;
+}
+
+
+static boolean Ifx_DPipeMux_Input_write(Ifx_DPipeMux_Input *input, void *data, Ifx_SizeT *count, Ifx_TickTime timeout)
+{
+    const uint8 *bytes = (const uint8 *)data;
+    Ifx_SizeT    left  = *count;
+
+    (void)timeout;
+
+    while (left > 0)
+    {
+        Ifx_SizeT length = (left > IFX_CFG_DPIPEMUX_MAX_MESSAGE) ? IFX_CFG_DPIPEMUX_MAX_MESSAGE : left;
+        Ifx_DPipeMux_write(input->mux, input->source, bytes, length);
+        bytes += length;
+        left  -= length;
+    }
+
+    input->sendCount += *count;
+    return TRUE;
+}
+
+
+sint32 Ifx_DPipeMux_addSink(Ifx_DPipeMux *mux, const Ifx_DPipeMux_SinkConfig *config)
+{
+    Ifx_DPipeMux_Sink *sink;
+
+    if ((mux->sinkCount >= IFX_CFG_DPIPEMUX_MAX_SINKS) || (config->pipe == NULL_PTR))
+    {
+        return -1;
+    }
+
+    sink                = &mux->sinks[mux->sinkCount];
+    sink->pipe          = config->pipe;
+    sink->sourceMask    = config->sourceMask;
+    sink->rate          = config->rate;
+    sink->burst         = (config->burst < IFX_CFG_DPIPEMUX_MAX_MESSAGE) ? IFX_CFG_DPIPEMUX_MAX_MESSAGE : config->burst;
+    sink->tokens        = sink->burst;
+    sink->refillTime    = now();
+    sink->readTotal     = mux->writeTotal;
+    sink->sentCount     = 0;
+    sink->rateDropCount = 0;
+    sink->overrunCount  = 0;
+    sink->pendingIndex  = 0;
+    sink->pendingCount  = 0;
+    __dsync();  /* The sink must be initialised before it is processed */
+    mux->sinkCount++;
+
+    return mux->sinkCount - 1;
+}
+
+
+boolean Ifx_DPipeMux_init(Ifx_DPipeMux *mux, const Ifx_DPipeMux_Config *config)
+{
+    /* A power of 2 size keeps the ring index continuous when the positions wrap around */
+    if ((config->buffer == NULL_PTR) || (config->bufferSize < (IFX_CFG_DPIPEMUX_MAX_MESSAGE + IFX_DPIPEMUX_HEADER_SIZE))
+        || ((config->bufferSize & (config->bufferSize - 1)) != 0))
+    {
+        return FALSE;
+    }
+
+    mux->buffer       = config->buffer;
+    mux->size         = config->bufferSize;
+    mux->writeTotal   = 0;
+    mux->tailTotal    = 0;
+    mux->messageCount = 0;
+    mux->sinkCount    = 0;
+
+    return TRUE;
+}
+
+
+void Ifx_DPipeMux_initConfig(Ifx_DPipeMux_Config *config)
+{
+    config->buffer     = NULL_PTR;
+    config->bufferSize = 0;
+}
+
+
+void Ifx_DPipeMux_initInput(Ifx_DPipeMux_Input *input, Ifx_DPipeMux *mux, uint8 source, IfxStdIf_DPipe *rx)
+{
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, source < 32);
+
+    input->mux       = mux;
+    input->source    = source;
+    input->rx        = rx;
+    input->sendCount = 0;
+}
+
+
+void Ifx_DPipeMux_initSinkConfig(Ifx_DPipeMux_SinkConfig *config)
+{
+    config->pipe       = NULL_PTR;
+    config->sourceMask = IFX_DPIPEMUX_ALL_SOURCES;
+    config->rate       = 0;
+    config->burst      = 0;
+}
+
+
+void Ifx_DPipeMux_process(Ifx_DPipeMux *mux)
+{
+    uint8 index;
+
+    for (index = 0; index < mux->sinkCount; index++)
+    {
+        Ifx_DPipeMux_Sink *sink = &mux->sinks[index];
+
+        do
+        {
+            if ((sink->pendingCount == 0) && (Ifx_DPipeMux_readMessage(mux, sink) == FALSE))
+            {
+                break;
+            }
+
+            {
+                Ifx_SizeT count = sink->pendingCount;
+
+                if (sink->pipe->txDisabled == FALSE)
+                {
+                    IfxStdIf_DPipe_write(sink->pipe, &sink->message[sink->pendingIndex], &count, TIME_NULL);
+                }
+
+                sink->pendingIndex += count;
+                sink->pendingCount -= count;
+            }
+        } while (sink->pendingCount == 0);
+    }
+}
+
+
+boolean Ifx_DPipeMux_stdIfDPipeInit(IfxStdIf_DPipe *stdif, Ifx_DPipeMux_Input *input)
+{
+    /* Ensure the stdif is reset to zeros */
+    memset(stdif, 0, sizeof(IfxStdIf_DPipe));
+
+    /* Set the API link */
+    stdif->driver         = input;
+    stdif->write          = (IfxStdIf_DPipe_Write) & Ifx_DPipeMux_Input_write;
+    stdif->read           = (IfxStdIf_DPipe_Read) & Ifx_DPipeMux_Input_read;
+    stdif->getReadCount   = (IfxStdIf_DPipe_GetReadCount) & Ifx_DPipeMux_Input_getReadCount;
+    stdif->getReadEvent   = (IfxStdIf_DPipe_GetReadEvent) & Ifx_DPipeMux_Input_getReadEvent;
+    stdif->getWriteCount  = (IfxStdIf_DPipe_GetWriteCount) & Ifx_DPipeMux_Input_getWriteCount;
+    stdif->getWriteEvent  = (IfxStdIf_DPipe_GetWriteEvent) & Ifx_DPipeMux_Input_getWriteEvent;
+    stdif->canReadCount   = (IfxStdIf_DPipe_CanReadCount) & Ifx_DPipeMux_Input_canReadCount;
+    stdif->canWriteCount  = (IfxStdIf_DPipe_CanWriteCount) & Ifx_DPipeMux_Input_canWriteCount;
+    stdif->flushTx        = (IfxStdIf_DPipe_FlushTx) & Ifx_DPipeMux_Input_flushTx;
+    stdif->clearTx        = (IfxStdIf_DPipe_ClearTx) & Ifx_DPipeMux_Input_clearTx;
+    stdif->clearRx        = (IfxStdIf_DPipe_ClearRx) & Ifx_DPipeMux_Input_clearRx;
+    stdif->onReceive      = (IfxStdIf_DPipe_OnReceive) & Ifx_DPipeMux_Input_onEvent;
+    stdif->onTransmit     = (IfxStdIf_DPipe_OnTransmit) & Ifx_DPipeMux_Input_onEvent;
+    stdif->onError        = (IfxStdIf_DPipe_OnError) & Ifx_DPipeMux_Input_onEvent;
+    stdif->getSendCount   = (IfxStdIf_DPipe_GetSendCount) & Ifx_DPipeMux_Input_getSendCount;
+    stdif->getTxTimeStamp = (IfxStdIf_DPipe_GetTxTimeStamp) & Ifx_DPipeMux_Input_getTxTimeStamp;
+    stdif->resetSendCount = (IfxStdIf_DPipe_ResetSendCount) & Ifx_DPipeMux_Input_resetSendCount;
+    stdif->txDisabled     = FALSE;
+    return TRUE;
+}
+
+
+void Ifx_DPipeMux_write(Ifx_DPipeMux *mux, uint8 source, const void *data, Ifx_SizeT count)
+{
+    uint8   header[IFX_DPIPEMUX_HEADER_SIZE];
+    uint32  recordSize = IFX_DPIPEMUX_HEADER_SIZE + count;
+    boolean interruptState;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (count > 0) && (count <= IFX_CFG_DPIPEMUX_MAX_MESSAGE));
+
+    header[0]      = (uint8)count;
+    header[1]      = (uint8)(count >> 8);
+    header[2]      = source;
+
+    interruptState = IfxCpu_disableInterrupts();
+
+    /* Release the oldest messages, the sinks which did not read them yet are overrun */
+    while ((mux->writeTotal + recordSize - mux->tailTotal) > mux->size)
+    {
+        uint8 tail[2];
+        Ifx_DPipeMux_copyFromRing(mux, mux->tailTotal, tail, 2);
+        mux->tailTotal += IFX_DPIPEMUX_HEADER_SIZE + (tail[0] | ((uint32)tail[1] << 8));
+    }
+
+    __dsync();  /* The messages must be released before they are overwritten */
+    Ifx_DPipeMux_copyToRing(mux, mux->writeTotal, header, IFX_DPIPEMUX_HEADER_SIZE);
+    Ifx_DPipeMux_copyToRing(mux, mux->writeTotal + IFX_DPIPEMUX_HEADER_SIZE, (const uint8 *)data, count);
+    __dsync();  /* The message must be visible before it is published */
+    mux->writeTotal += recordSize;
+    mux->messageCount++;
+
+    IfxCpu_restoreInterrupts(interruptState);
+}
@@ -0,0 +1,470 @@
+/**
+ * \file Ifx_IsoTp.c
+ * \brief ISO 15765-2 (ISO-TP) transport layer on CAN
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include <string.h>
+
+#include "Ifx_IsoTp.h"
+#include "SysSe/Bsp/Bsp.h"
+
+//----------------------------------------------------------------------------------------
+#define IFX_ISOTP_PCI_SF        (0x00U)   /**<\brief Frame type of the single frame */
+#define IFX_ISOTP_PCI_FF        (0x10U)   /**<\brief Frame type of the first frame */
+#define IFX_ISOTP_PCI_CF        (0x20U)   /**<\brief Frame type of the consecutive frame */
+#define IFX_ISOTP_PCI_FC        (0x30U)   /**<\brief Frame type of the flow control */
+
+#define IFX_ISOTP_FS_CTS        (0x0U)    /**<\brief Flow status continue to send */
+#define IFX_ISOTP_FS_WAIT       (0x1U)    /**<\brief Flow status wait */
+#define IFX_ISOTP_FS_OVFLW      (0x2U)    /**<\brief Flow status overflow */
+
+/** Send one frame: PCI bytes followed by length data bytes, padded if configured
+ * \return Returns FALSE if the transmit message object is busy
+ */
+static boolean Ifx_IsoTp_sendFrame(Ifx_IsoTp *isoTp, const uint8 *pci, uint8 pciLength, const uint8 *data, uint8 length)
+{
+    IfxMultican_Message msg;
+    uint8              *frame       = (uint8 *)msg.data;
+    uint8               frameLength = pciLength + length;
+
+    if (isoTp->padding != FALSE)
+    {
+        frameLength = IFX_ISOTP_FRAME_SIZE;
+    }
+
+    IfxMultican_Message_init(&msg, isoTp->txId, 0, 0, (IfxMultican_DataLengthCode)frameLength);
+    memset(frame, isoTp->paddingByte, IFX_ISOTP_FRAME_SIZE);
+    memcpy(frame, pci, pciLength);
+
+    if (length != 0)
+    {
+        /* straight from the buffer of the application */
+        memcpy(&frame[pciLength], data, length);
+    }
+
+    return IfxMultican_Can_MsgObj_sendMessage(isoTp->txMsgObj, &msg) == IfxMultican_Status_ok;
+}
+
+
+/** Convert the STmin of a FC into ticks: 0 to 127 ms, 100 to 900 us. Reserved values are handled as 127 ms
+ */
+static Ifx_TickTime Ifx_IsoTp_decodeStMin(uint8 stMin)
+{
+    if (stMin <= 0x7FU)
+    {
+        return stMin * TimeConst_1ms;
+    }
+    else if ((stMin >= 0xF1U) && (stMin <= 0xF9U))
+    {
+        return (stMin - 0xF0U) * TimeConst_100us;
+    }
+    else
+    {
+        return 0x7F * TimeConst_1ms;
+    }
+}
+
+
+/** Complete the reception and pass the message to the handler
+ */
+static void Ifx_IsoTp_completeRx(Ifx_IsoTp *isoTp)
+{
+    isoTp->rxStatus = Ifx_IsoTp_Status_done;
+    isoTp->rxMessages++;
+
+    if (isoTp->rxHandler != NULL_PTR)
+    {
+        isoTp->rxHandler(isoTp->rxHandlerData, isoTp->rxBuffer, isoTp->rxLength);
+    }
+}
+
+
+/** Handle a received SF
+ */
+static void Ifx_IsoTp_receiveSf(Ifx_IsoTp *isoTp, const uint8 *frame, uint8 length)
+{
+    uint8 sfLength = frame[0] & 0x0FU;
+
+    if ((sfLength == 0) || (sfLength >= length))
+    {
+        return;
+    }
+
+    /* a SF aborts the reception in progress */
+    isoTp->rxFcPci = 0;
+
+    if ((isoTp->rxBuffer == NULL_PTR) || (sfLength > isoTp->rxBufferSize))
+    {
+        isoTp->rxStatus = Ifx_IsoTp_Status_overflow;
+        return;
+    }
+
+    memcpy(isoTp->rxBuffer, &frame[1], sfLength);
+    isoTp->rxLength = sfLength;
+    isoTp->rxIndex  = sfLength;
+    Ifx_IsoTp_completeRx(isoTp);
+}
+
+
+/** Handle a received FF: start the reception and request the FC
+ */
+static void Ifx_IsoTp_receiveFf(Ifx_IsoTp *isoTp, const uint8 *frame, uint8 length)
+{
+    uint32 ffLength  = ((uint32)(frame[0] & 0x0FU) << 8) | frame[1];
+    uint8  pciLength = 2;
+
+    if (length != IFX_ISOTP_FRAME_SIZE)
+    {
+        return;
+    }
+
+    if (ffLength == 0)
+    {
+        ffLength  = ((uint32)frame[2] << 24) | ((uint32)frame[3] << 16) | ((uint32)frame[4] << 8) | frame[5];
+        pciLength = 6;
+
+        if (ffLength <= IFX_ISOTP_MAX_FF_LENGTH)
+        {
+            return;
+        }
+    }
+    else if (ffLength <= IFX_ISOTP_MAX_SF_LENGTH)
+    {
+        return;
+    }
+
+    if ((isoTp->rxBuffer == NULL_PTR) || (ffLength > isoTp->rxBufferSize))
+    {
+        isoTp->rxStatus = Ifx_IsoTp_Status_overflow;
+        isoTp->rxFcPci  = IFX_ISOTP_PCI_FC | IFX_ISOTP_FS_OVFLW;
+        return;
+    }
+
+    /* reassembled directly into the buffer of the application */
+    memcpy(isoTp->rxBuffer, &frame[pciLength], IFX_ISOTP_FRAME_SIZE - pciLength);
+    isoTp->rxLength     = ffLength;
+    isoTp->rxIndex      = IFX_ISOTP_FRAME_SIZE - pciLength;
+    isoTp->rxSequence   = 1;
+    isoTp->rxBlockCount = 0;
+    isoTp->rxStatus     = Ifx_IsoTp_Status_busy;
+    isoTp->rxFcPci      = IFX_ISOTP_PCI_FC | IFX_ISOTP_FS_CTS;
+}
+
+
+/** Handle a received CF
+ */
+static void Ifx_IsoTp_receiveCf(Ifx_IsoTp *isoTp, const uint8 *frame, uint8 length)
+{
+    uint32 count = __min(isoTp->rxLength - isoTp->rxIndex, (uint32)length - 1);
+
+    if ((isoTp->rxStatus != Ifx_IsoTp_Status_busy) || (isoTp->rxFcPci != 0))
+    {
+        return;
+    }
+
+    if ((frame[0] & 0x0FU) != isoTp->rxSequence)
+    {
+        isoTp->rxStatus = Ifx_IsoTp_Status_sequenceError;
+        return;
+    }
+
+    memcpy(&isoTp->rxBuffer[isoTp->rxIndex], &frame[1], count);
+    isoTp->rxIndex   += count;
+    isoTp->rxSequence = (isoTp->rxSequence + 1) & 0x0FU;
+
+    if (isoTp->rxIndex >= isoTp->rxLength)
+    {
+        Ifx_IsoTp_completeRx(isoTp);
+    }
+    else
+    {
+        isoTp->rxDeadline = now() + isoTp->timeout;
+
+        if (isoTp->blockSize != 0)
+        {
+            isoTp->rxBlockCount++;
+
+            if (isoTp->rxBlockCount >= isoTp->blockSize)
+            {
+                isoTp->rxBlockCount = 0;
+                isoTp->rxFcPci      = IFX_ISOTP_PCI_FC | IFX_ISOTP_FS_CTS;
+            }
+        }
+    }
+}
+
+
+/** Handle a received FC
+ */
+static void Ifx_IsoTp_receiveFc(Ifx_IsoTp *isoTp, const uint8 *frame, uint8 length)
+{
+    if ((isoTp->txStatus != Ifx_IsoTp_Status_busy) || (isoTp->txWaitFc == FALSE) || (length < 3))
+    {
+        return;
+    }
+
+    switch (frame[0] & 0x0FU)
+    {
+    case IFX_ISOTP_FS_CTS:
+        isoTp->txBlockSize  = frame[1];
+        isoTp->txStMin      = Ifx_IsoTp_decodeStMin(frame[2]);
+        isoTp->txBlockCount = 0;
+        isoTp->txWaitFc     = FALSE;
+        isoTp->txNextTime   = now();
+        break;
+    case IFX_ISOTP_FS_WAIT:
+        isoTp->txDeadline = now() + isoTp->timeout;
+        break;
+    case IFX_ISOTP_FS_OVFLW:
+        isoTp->txStatus = Ifx_IsoTp_Status_overflow;
+        break;
+    default:
+        /* reserved flow status: ignored, N_Bs expires */
+        break;
+    }
+}
+
+
+/** Send the CFs which are due, as long as the transmit message object accepts them
+ */
+static void Ifx_IsoTp_sendCf(Ifx_IsoTp *isoTp)
+{
+    Ifx_TickTime time = now();
+
+    while ((isoTp->txStatus == Ifx_IsoTp_Status_busy) && (isoTp->txWaitFc == FALSE) && (time >= isoTp->txNextTime))
+    {
+        uint8 pci   = IFX_ISOTP_PCI_CF | isoTp->txSequence;
+        uint8 count = (uint8)__min(isoTp->txLength - isoTp->txIndex, (uint32)(IFX_ISOTP_FRAME_SIZE - 1));
+
+        if (Ifx_IsoTp_sendFrame(isoTp, &pci, 1, &isoTp->txData[isoTp->txIndex], count) == FALSE)
+        {
+            /* transmit FIFO full, retried by the next call */
+            break;
+        }
+
+        isoTp->txIndex   += count;
+        isoTp->txSequence = (isoTp->txSequence + 1) & 0x0FU;
+        isoTp->txNextTime = time + isoTp->txStMin;
+
+        if (isoTp->txIndex >= isoTp->txLength)
+        {
+            isoTp->txStatus = Ifx_IsoTp_Status_done;
+            isoTp->txMessages++;
+        }
+        else if (isoTp->txBlockSize != 0)
+        {
+            isoTp->txBlockCount++;
+
+            if (isoTp->txBlockCount >= isoTp->txBlockSize)
+            {
+                isoTp->txWaitFc   = TRUE;
+                isoTp->txDeadline = time + isoTp->timeout;
+            }
+        }
+    }
+}
+
+
+Ifx_IsoTp_Status Ifx_IsoTp_getRxStatus(const Ifx_IsoTp *isoTp, uint32 *length)
+{
+    if ((length != NULL_PTR) && (isoTp->rxStatus == Ifx_IsoTp_Status_done))
+    {
+        *length = isoTp->rxLength;
+    }
+
+    return isoTp->rxStatus;
+}
+
+
+Ifx_IsoTp_Status Ifx_IsoTp_getTxStatus(const Ifx_IsoTp *isoTp)
+{
+    return isoTp->txStatus;
+}
+
+
+boolean Ifx_IsoTp_init(Ifx_IsoTp *isoTp, const Ifx_IsoTp_Config *config)
+{
+    Ifx_CAN_MO *hwObj;
+
+    if ((config->rxMsgObj == NULL_PTR) || (config->txMsgObj == NULL_PTR))
+    {
+        return FALSE;
+    }
+
+    memset(isoTp, 0, sizeof(*isoTp));
+
+    hwObj                = IfxMultican_MsgObj_getPointer(config->txMsgObj->node->mcan, config->txMsgObj->msgObjId);
+    isoTp->rxMsgObj      = config->rxMsgObj;
+    isoTp->txMsgObj      = config->txMsgObj;
+    isoTp->txId          = IfxMultican_MsgObj_getMessageId(hwObj);
+    isoTp->blockSize     = config->blockSize;
+    isoTp->stMin         = config->stMin;
+    isoTp->padding       = config->padding;
+    isoTp->paddingByte   = config->paddingByte;
+    isoTp->timeout       = config->timeout * TimeConst_1ms;
+    isoTp->rxHandler     = config->rxHandler;
+    isoTp->rxHandlerData = config->rxHandlerData;
+    isoTp->rxBuffer      = config->rxBuffer;
+    isoTp->rxBufferSize  = config->rxBufferSize;
+    isoTp->txStatus      = Ifx_IsoTp_Status_idle;
+    isoTp->rxStatus      = Ifx_IsoTp_Status_idle;
+
+    return TRUE;
+}
+
+
+void Ifx_IsoTp_initConfig(Ifx_IsoTp_Config *config)
+{
+    config->rxMsgObj      = NULL_PTR;
+    config->txMsgObj      = NULL_PTR;
+    config->rxBuffer      = NULL_PTR;
+    config->rxBufferSize  = 0;
+    config->rxHandler     = NULL_PTR;
+    config->rxHandlerData = NULL_PTR;
+    config->blockSize     = 0;
+    config->stMin         = 0;
+    config->padding       = TRUE;
+    config->paddingByte   = 0xCC;
+    config->timeout       = 1000;
+}
+
+
+void Ifx_IsoTp_process(Ifx_IsoTp *isoTp)
+{
+    IfxMultican_Message msg;
+    Ifx_TickTime        time;
+
+    while ((IfxMultican_Can_MsgObj_readMessage(isoTp->rxMsgObj, &msg) & IfxMultican_Status_newData) != 0)
+    {
+        const uint8 *frame  = (const uint8 *)msg.data;
+        uint8        length = (uint8)__min((uint32)msg.lengthCode, (uint32)IFX_ISOTP_FRAME_SIZE);
+
+        if (length == 0)
+        {
+            continue;
+        }
+
+        switch (frame[0] & 0xF0U)
+        {
+        case IFX_ISOTP_PCI_SF:
+            Ifx_IsoTp_receiveSf(isoTp, frame, length);
+            break;
+        case IFX_ISOTP_PCI_FF:
+            Ifx_IsoTp_receiveFf(isoTp, frame, length);
+            break;
+        case IFX_ISOTP_PCI_CF:
+            Ifx_IsoTp_receiveCf(isoTp, frame, length);
+            break;
+        case IFX_ISOTP_PCI_FC:
+            Ifx_IsoTp_receiveFc(isoTp, frame, length);
+            break;
+        default:
+            break;
+        }
+    }
+
+    time = now();
+
+    if (isoTp->rxFcPci != 0)
+    {
+        uint8 fc[3];
+
+        fc[0] = isoTp->rxFcPci;
+        fc[1] = isoTp->blockSize;
+        fc[2] = isoTp->stMin;
+
+        if (Ifx_IsoTp_sendFrame(isoTp, fc, 3, NULL_PTR, 0) != FALSE)
+        {
+            isoTp->rxFcPci    = 0;
+            isoTp->rxDeadline = time + isoTp->timeout;
+        }
+    }
+    else if ((isoTp->rxStatus == Ifx_IsoTp_Status_busy) && (time > isoTp->rxDeadline))
+    {
+        isoTp->rxStatus = Ifx_IsoTp_Status_timeout;
+    }
+
+    if ((isoTp->txStatus == Ifx_IsoTp_Status_busy) && (isoTp->txWaitFc != FALSE) && (time > isoTp->txDeadline))
+    {
+        isoTp->txStatus = Ifx_IsoTp_Status_timeout;
+    }
+
+    Ifx_IsoTp_sendCf(isoTp);
+}
+
+
+boolean Ifx_IsoTp_send(Ifx_IsoTp *isoTp, const uint8 *data, uint32 length)
+{
+    uint8 pci[6];
+    uint8 pciLength;
+
+    if ((isoTp->txStatus == Ifx_IsoTp_Status_busy) || (length == 0))
+    {
+        return FALSE;
+    }
+
+    if (length <= IFX_ISOTP_MAX_SF_LENGTH)
+    {
+        pci[0] = IFX_ISOTP_PCI_SF | (uint8)length;
+
+        if (Ifx_IsoTp_sendFrame(isoTp, pci, 1, data, (uint8)length) == FALSE)
+        {
+            return FALSE;
+        }
+
+        isoTp->txStatus = Ifx_IsoTp_Status_done;
+        isoTp->txMessages++;
+
+        return TRUE;
+    }
+
+    if (length <= IFX_ISOTP_MAX_FF_LENGTH)
+    {
+        pci[0]    = IFX_ISOTP_PCI_FF | (uint8)(length >> 8);
+        pci[1]    = (uint8)length;
+        pciLength = 2;
+    }
+    else
+    {
+        pci[0]    = IFX_ISOTP_PCI_FF;
+        pci[1]    = 0;
+        pci[2]    = (uint8)(length >> 24);
+        pci[3]    = (uint8)(length >> 16);
+        pci[4]    = (uint8)(length >> 8);
+        pci[5]    = (uint8)length;
+        pciLength = 6;
+    }
+
+    if (Ifx_IsoTp_sendFrame(isoTp, pci, pciLength, data, IFX_ISOTP_FRAME_SIZE - pciLength) == FALSE)
+    {
+        return FALSE;
+    }
+
+    isoTp->txData     = data;
+    isoTp->txLength   = length;
+    isoTp->txIndex    = IFX_ISOTP_FRAME_SIZE - pciLength;
+    isoTp->txSequence = 1;
+    isoTp->txWaitFc   = TRUE;
+    isoTp->txDeadline = now() + isoTp->timeout;
+    isoTp->txStatus   = Ifx_IsoTp_Status_busy;
+
+    return TRUE;
+}
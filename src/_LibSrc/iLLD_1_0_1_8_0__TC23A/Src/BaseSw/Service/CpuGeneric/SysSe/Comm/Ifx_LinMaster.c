@@ -0,0 +1,316 @@
+/**
+ * \file Ifx_LinMaster.c
+ * \brief Interrupt driven LIN master schedule table
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+
+#include "Ifx_LinMaster.h"
+#include "Cpu/Std/IfxCpu.h"
+#include "IfxAsclin_bf.h"
+#include "Src/Std/IfxSrc.h"
+#include "_Utilities/Ifx_Assert.h"
+#include <string.h>
+
+/** Flags advancing the frame state machine: transmit header end, transmit response end, receive response end */
+#define IFX_LINMASTER_EVENT_FLAGS ((1u << IFX_ASCLIN_FLAGS_TH_OFF) | (1u << IFX_ASCLIN_FLAGS_TR_OFF) | (1u << IFX_ASCLIN_FLAGS_RR_OFF))
+
+/** Flags completing the frame with an error */
+#define IFX_LINMASTER_ERROR_FLAGS ((1u << IFX_ASCLIN_FLAGS_HT_OFF) | (1u << IFX_ASCLIN_FLAGS_RT_OFF) | (1u << IFX_ASCLIN_FLAGS_LC_OFF) \
+                                   | (1u << IFX_ASCLIN_FLAGS_FE_OFF) | (1u << IFX_ASCLIN_FLAGS_CE_OFF) | (1u << IFX_ASCLIN_FLAGS_LP_OFF)  \
+                                   | (1u << IFX_ASCLIN_FLAGS_RFO_OFF))
+
+/** Complete the frame in progress, the bus is idle afterwards
+ */
+static void Ifx_LinMaster_complete(Ifx_LinMaster *master, Ifx_LinMaster_Status status)
+{
+    Ifx_LinMaster_Frame *frame = master->frame;
+
+    IfxAsclin_enableRxFifoInlet(master->asclin, FALSE);
+
+    frame->status = status;
+
+    if (status == Ifx_LinMaster_Status_ok)
+    {
+        frame->okCount++;
+    }
+    else
+    {
+        frame->errorCount++;
+    }
+
+    master->frame = NULL_PTR;
+}
+
+
+/** Returns the protected ID: frame ID with the parity bits P0 (bit 6) and P1 (bit 7)
+ */
+static uint8 Ifx_LinMaster_getProtectedId(uint8 id)
+{
+    uint32 p0 = ((id >> 0) ^ (id >> 1) ^ (id >> 2) ^ (id >> 4)) & 1u;
+    uint32 p1 = ~((id >> 1) ^ (id >> 3) ^ (id >> 4) ^ (id >> 5)) & 1u;
+
+    return (uint8)((id & 0x3Fu) | (p0 << 6) | (p1 << 7));
+}
+
+
+/** Send the header of a frame, the response is handled by Ifx_LinMaster_onInterrupt()
+ */
+static void Ifx_LinMaster_sendHeader(Ifx_LinMaster *master, Ifx_LinMaster_Frame *frame)
+{
+    Ifx_ASCLIN *asclin = master->asclin;
+    uint8       pid    = Ifx_LinMaster_getProtectedId(frame->id);
+
+    IfxAsclin_enableRxFifoInlet(asclin, FALSE);
+    IfxAsclin_flushRxFifo(asclin);
+    IfxAsclin_flushTxFifo(asclin);
+    asclin->FLAGSCLEAR.U = IFX_LINMASTER_EVENT_FLAGS | IFX_LINMASTER_ERROR_FLAGS;
+
+    IfxAsclin_setDataLength(asclin, (IfxAsclin_DataLength)(frame->length - 1));
+    IfxAsclin_setChecksumMode(asclin, frame->checksum);
+
+    /* the frame is in progress before the first ASCLIN interrupt can occur */
+    frame->status = Ifx_LinMaster_Status_busy;
+    master->frame = frame;
+
+    IfxAsclin_write8(asclin, &pid, 1);
+    IfxAsclin_setTransmitHeaderRequestFlag(asclin);
+}
+
+
+void Ifx_LinMaster_init(Ifx_LinMaster *master, const Ifx_LinMaster_Config *config)
+{
+    Ifx_ASCLIN *asclin = config->lin->asclin;
+    uint16      i;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, config->lin->linMode == IfxAsclin_LinMode_master);
+
+    for (i = 0; i < config->slotCount; i++)
+    {
+        const Ifx_LinMaster_Frame *frame = config->schedule[i].frame;
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (frame == NULL_PTR) || ((frame->length >= 1) && (frame->length <= IFX_LINMASTER_MAX_LENGTH) && (frame->id < 64)));
+    }
+
+    memset(master, 0, sizeof(*master));
+    master->asclin              = asclin;
+    master->stm                 = config->stm;
+    master->comparator          = config->comparator;
+    master->slotPriority        = config->slotPriority;
+    master->isrProvider         = config->isrProvider;
+    master->ticksPerMicrosecond = (uint32)IfxStm_getTicksFromMicroseconds(config->stm, 1);
+    master->schedule            = config->schedule;
+    master->slotCount           = config->slotCount;
+
+    IfxAsclin_disableAllFlags(asclin);
+    IfxAsclin_clearAllFlags(asclin);
+    IfxAsclin_enableTxFifoOutlet(asclin, TRUE);
+
+    IfxAsclin_enableTxHeaderEndFlag(asclin, TRUE);
+    IfxAsclin_enableTxResponseEndFlag(asclin, TRUE);
+    IfxAsclin_enableRxResponseEndFlag(asclin, TRUE);
+    IfxAsclin_enableHeaderTimeoutFlag(asclin, TRUE);
+    IfxAsclin_enableResponseTimeoutFlag(asclin, TRUE);
+    IfxAsclin_enableLinChecksumErrorFlag(asclin, TRUE);
+    IfxAsclin_enableFrameErrorFlag(asclin, TRUE);
+    IfxAsclin_enableCollisionDetectionErrorFlag(asclin, TRUE);
+    IfxAsclin_enableLinParityErrorFlag(asclin, TRUE);
+    IfxAsclin_enableRxFifoOverflowFlag(asclin, TRUE);
+
+    if (config->txPriority != 0)
+    {
+        volatile Ifx_SRC_SRCR *src = IfxAsclin_getSrcPointerTx(asclin);
+        IfxSrc_init(src, config->isrProvider, config->txPriority);
+        IfxSrc_enable(src);
+    }
+
+    if (config->rxPriority != 0)
+    {
+        volatile Ifx_SRC_SRCR *src = IfxAsclin_getSrcPointerRx(asclin);
+        IfxSrc_init(src, config->isrProvider, config->rxPriority);
+        IfxSrc_enable(src);
+    }
+
+    if (config->erPriority != 0)
+    {
+        volatile Ifx_SRC_SRCR *src = IfxAsclin_getSrcPointerEr(asclin);
+        IfxSrc_init(src, config->isrProvider, config->erPriority);
+        IfxSrc_enable(src);
+    }
+}
+
+
+void Ifx_LinMaster_initConfig(Ifx_LinMaster_Config *config)
+{
+    config->lin          = NULL_PTR;
+    config->schedule     = NULL_PTR;
+    config->slotCount    = 0;
+    config->stm          = &MODULE_STM0;
+    config->comparator   = IfxStm_Comparator_0;
+    config->txPriority   = 0;
+    config->rxPriority   = 0;
+    config->erPriority   = 0;
+    config->slotPriority = 0;
+    config->isrProvider  = IfxSrc_Tos_cpu0;
+}
+
+
+void Ifx_LinMaster_onInterrupt(Ifx_LinMaster *master)
+{
+    Ifx_ASCLIN          *asclin = master->asclin;
+    Ifx_LinMaster_Frame *frame  = master->frame;
+    uint32               flags  = asclin->FLAGS.U & (IFX_LINMASTER_EVENT_FLAGS | IFX_LINMASTER_ERROR_FLAGS);
+
+    asclin->FLAGSCLEAR.U = flags;
+
+    if (frame == NULL_PTR)
+    {
+        /* late event of an aborted frame */
+    }
+    else if ((flags & IFX_LINMASTER_ERROR_FLAGS) != 0)
+    {
+        if ((flags & (1u << IFX_ASCLIN_FLAGS_RT_OFF)) != 0)
+        {
+            Ifx_LinMaster_complete(master, Ifx_LinMaster_Status_noResponse);
+        }
+        else if ((flags & (1u << IFX_ASCLIN_FLAGS_LC_OFF)) != 0)
+        {
+            Ifx_LinMaster_complete(master, Ifx_LinMaster_Status_checksumError);
+        }
+        else
+        {
+            Ifx_LinMaster_complete(master, Ifx_LinMaster_Status_error);
+        }
+    }
+    else if ((flags & (1u << IFX_ASCLIN_FLAGS_RR_OFF)) != 0)
+    {
+        IfxAsclin_read8(asclin, frame->data, frame->length);
+        Ifx_LinMaster_complete(master, Ifx_LinMaster_Status_ok);
+    }
+    else if ((flags & (1u << IFX_ASCLIN_FLAGS_TR_OFF)) != 0)
+    {
+        Ifx_LinMaster_complete(master, Ifx_LinMaster_Status_ok);
+    }
+    else if ((flags & (1u << IFX_ASCLIN_FLAGS_TH_OFF)) != 0)
+    {
+        if (frame->direction == Ifx_LinMaster_Direction_publish)
+        {
+            IfxAsclin_write8(asclin, frame->data, frame->length);
+            IfxAsclin_setTransmitResponseRequestFlag(asclin);
+        }
+        else
+        {
+            IfxAsclin_enableRxFifoInlet(asclin, TRUE);
+        }
+    }
+    else
+    {
+        /* no event of the frame */
+    }
+}
+
+
+void Ifx_LinMaster_onSlot(Ifx_LinMaster *master)
+{
+    const Ifx_LinMaster_Slot *slot = &master->schedule[master->slotIndex];
+
+    /* the next slot starts relative to the compare value, not to the interrupt latency */
+    IfxStm_clearCompareFlag(master->stm, master->comparator);
+    IfxStm_increaseCompare(master->stm, master->comparator, slot->time * master->ticksPerMicrosecond);
+
+    if (master->frame != NULL_PTR)
+    {
+        master->slotOverruns++;
+        Ifx_LinMaster_complete(master, Ifx_LinMaster_Status_slotOverrun);
+    }
+
+    master->slotIndex++;
+
+    if (master->slotIndex >= master->slotCount)
+    {
+        master->slotIndex = 0;
+        master->cycles++;
+    }
+
+    if (slot->frame != NULL_PTR)
+    {
+        Ifx_LinMaster_sendHeader(master, slot->frame);
+    }
+}
+
+
+Ifx_LinMaster_Status Ifx_LinMaster_readFrame(const Ifx_LinMaster_Frame *frame, uint8 *data)
+{
+    boolean              interruptState = IfxCpu_disableInterrupts();
+    Ifx_LinMaster_Status status         = frame->status;
+
+    memcpy(data, frame->data, frame->length);
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return status;
+}
+
+
+void Ifx_LinMaster_setSchedule(Ifx_LinMaster *master, const Ifx_LinMaster_Slot *schedule, uint16 slotCount)
+{
+    boolean interruptState = IfxCpu_disableInterrupts();
+
+    master->schedule  = schedule;
+    master->slotCount = slotCount;
+    master->slotIndex = 0;
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+
+void Ifx_LinMaster_start(Ifx_LinMaster *master)
+{
+    IfxStm_CompareConfig compareConfig;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (master->schedule != NULL_PTR) && (master->slotCount != 0));
+
+    master->slotIndex = 0;
+
+    /* the first slot starts one microsecond after the start */
+    IfxStm_initCompareConfig(&compareConfig);
+    compareConfig.comparator          = master->comparator;
+    compareConfig.comparatorInterrupt = (IfxStm_ComparatorInterrupt)master->comparator;
+    compareConfig.ticks               = master->ticksPerMicrosecond;
+    compareConfig.triggerPriority     = master->slotPriority;
+    compareConfig.typeOfService       = master->isrProvider;
+    IfxStm_initCompare(master->stm, &compareConfig);
+}
+
+
+void Ifx_LinMaster_stop(Ifx_LinMaster *master)
+{
+    IfxStm_disableComparatorInterrupt(master->stm, master->comparator);
+    IfxStm_clearCompareFlag(master->stm, master->comparator);
+}
+
+
+void Ifx_LinMaster_writeFrame(Ifx_LinMaster_Frame *frame, const uint8 *data, uint8 length)
+{
+    boolean interruptState;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, length <= frame->length);
+
+    interruptState = IfxCpu_disableInterrupts();
+    memcpy(frame->data, data, length);
+    IfxCpu_restoreInterrupts(interruptState);
+}
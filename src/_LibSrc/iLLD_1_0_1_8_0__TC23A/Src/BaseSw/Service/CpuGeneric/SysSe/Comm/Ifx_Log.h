@@ -0,0 +1,165 @@
+/**
+ * \file Ifx_Log.h
+ * \brief Deferred formatted output
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_comm_log Deferred log
+ * \ingroup library_srvsw_sysse_comm
+ *
+ * \ref IfxStdIf_DPipe_print() formats the message on the caller stack and waits until the
+ * message fits into the transmit buffer. The deferred log moves this cost out of the caller:
+ * \ref IFX_LOG_PRINT() only stores the format string pointer and up to \ref IFX_LOG_MAX_ARGS
+ * argument words into a ring of entries. \ref Ifx_Log_process(), called from a low priority task or
+ * from the idle loop, formats the entries and writes them into the \ref IfxStdIf_DPipe without waiting.
+ *
+ * When the ring is full the entry is dropped and Ifx_Log::dropCount is incremented, the caller is
+ * never blocked.
+ *
+ * Restrictions:
+ * - the format string and the strings passed as %s argument must stay valid until the entry is
+ * processed, typically they are constant strings
+ * - only integer, character and pointer arguments of up to 32 bits are supported, each one is stored as
+ * one uint32 word. float32, float64 and 64 bit integer values must be converted by the caller, e.g. to a
+ * fixed point integer. More than \ref IFX_LOG_MAX_ARGS arguments, 64 bit arguments and, with the GNU C
+ * compiler, floating point arguments are refused at compile time
+ * - Entries can be pushed from any task or interrupt of one CPU. When several CPUs log, one
+ * Ifx_Log object is used per CPU. \ref Ifx_Log_process() can run on any CPU if the object and the
+ * entries are located in a non cached memory.
+ *
+ * Usage example:
+ * \code
+ * static Ifx_Log_Entry logEntries[64];
+ * static Ifx_Log       log;
+ *
+ * // initialisation
+ * Ifx_Log_init(&log, &ascStdIf, logEntries, 64);
+ *
+ * // control loop, constant execution time
+ * IFX_LOG_PRINT(&log, "speed=%d current=%d"ENDL, speed, current);
+ *
+ * // background loop
+ * Ifx_Log_process(&log);
+ * \endcode
+ *
+ */
+#ifndef IFX_LOG_H
+#define IFX_LOG_H 1
+
+#include "StdIf/IfxStdIf_DPipe.h"
+
+//----------------------------------------------------------------------------------------
+#define IFX_LOG_MAX_ARGS (4) /**<\brief Maximal number of argument words stored per entry */
+
+/** \addtogroup library_srvsw_sysse_comm_log
+ * \{ */
+
+/** \brief Log entry, as stored in the ring */
+typedef struct
+{
+    pchar  format;                          /**<\brief printf-compatible format string */
+    uint32 args[IFX_LOG_MAX_ARGS];          /**<\brief raw argument words */
+} Ifx_Log_Entry;
+
+/** \brief Log object */
+typedef struct
+{
+    IfxStdIf_DPipe  *standardIo;                              /**<\brief Pointer to the \ref IfxStdIf_DPipe object the entries are written to */
+    Ifx_Log_Entry   *entries;                                 /**<\brief ring of entries */
+    uint32           size;                                    /**<\brief number of entries in the ring */
+    volatile uint32  writeTotal;                              /**<\brief number of entries pushed, modified by the producers only */
+    volatile uint32  readTotal;                               /**<\brief number of entries formatted, modified by \ref Ifx_Log_process() only */
+    volatile uint32  dropCount;                               /**<\brief number of entries dropped because the ring was full */
+    Ifx_SizeT        pendingIndex;                            /**<\brief index of the first byte of message not yet written */
+    Ifx_SizeT        pendingCount;                            /**<\brief number of bytes of message not yet written */
+    char             message[STDIF_DPIPE_MAX_PRINT_SIZE + 1]; /**<\brief formatted message */
+} Ifx_Log;
+
+/** \brief Push a formatted message into the log
+ *
+ * Up to \ref IFX_LOG_MAX_ARGS integer, character or pointer arguments can be given after the format
+ * string, they are converted to uint32. Too many arguments or an argument which does not fit into an
+ * uint32 word fail to compile (negative array size).
+ * \param log Pointer to the log object
+ * \return TRUE if the entry is stored, FALSE if it has been dropped
+ */
+#define IFX_LOG_PRINT(log, ...)                                                                       \
+    ((void)sizeof(char[(IFX_LOG_COUNT_(__VA_ARGS__) <= (IFX_LOG_MAX_ARGS + 1)) ? 1 : -1]), \
+     IFX_LOG_PRINT_((log), __VA_ARGS__, 0, 0, 0, 0, 0))
+
+/** \internal Number of macro arguments, format string included, up to 16 */
+#define IFX_LOG_COUNT_(...)                                                                  \
+    IFX_LOG_COUNT_SELECT_(__VA_ARGS__, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+
+/** \internal */
+#define IFX_LOG_COUNT_SELECT_(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, n, ...) n
+
+/** \internal The argument has 32 bits at most and is not floating point, which is detected by GNU C only */
+#if defined(__GNUC__) && !defined(__DCC__)
+#define IFX_LOG_IS_WORD_(a)                 ((sizeof((a) + 0) <= 4) && (__builtin_classify_type((a) + 0) != 8))
+#else
+#define IFX_LOG_IS_WORD_(a)                 (sizeof((a) + 0) <= 4)
+#endif
+
+/** \internal */
+#define IFX_LOG_ARG_(a)                     ((void)sizeof(char[IFX_LOG_IS_WORD_(a) ? 1 : -1]), (uint32)(a))
+
+/** \internal */
+#define IFX_LOG_PRINT_(log, format, a0, a1, a2, a3, ...) \
+    Ifx_Log_push(log, format, IFX_LOG_ARG_(a0), IFX_LOG_ARG_(a1), IFX_LOG_ARG_(a2), IFX_LOG_ARG_(a3))
+
+/** \brief Initialize the log object
+ * \param log Pointer to the log object
+ * \param standardIo Pointer to the \ref IfxStdIf_DPipe object the entries are written to
+ * \param entries Pointer to the entry ring
+ * \param size Number of entries of the ring
+ */
+IFX_EXTERN void Ifx_Log_init(Ifx_Log *log, IfxStdIf_DPipe *standardIo, Ifx_Log_Entry *entries, uint32 size);
+
+/** \brief Store an entry into the log. Use \ref IFX_LOG_PRINT() instead of calling this function directly
+ * \param log Pointer to the log object
+ * \param format printf-compatible format string
+ * \param a0 first argument word
+ * \param a1 second argument word
+ * \param a2 third argument word
+ * \param a3 fourth argument word
+ * \return TRUE if the entry is stored, FALSE if it has been dropped
+ */
+IFX_EXTERN boolean Ifx_Log_push(Ifx_Log *log, pchar format, uint32 a0, uint32 a1, uint32 a2, uint32 a3);
+
+/** \brief Format the pending entries and write them to the \ref IfxStdIf_DPipe object
+ *
+ * The function never waits: it returns as soon as the transmit buffer is full, the rest of
+ * the message is written by the next call.
+ * \param log Pointer to the log object
+ * \return Returns the number of entries still pending
+ */
+IFX_EXTERN uint32 Ifx_Log_process(Ifx_Log *log);
+
+/** \brief Returns the number of entries not yet formatted
+ * \param log Pointer to the log object
+ */
+IFX_INLINE uint32 Ifx_Log_getPendingCount(Ifx_Log *log)
+{
+    return log->writeTotal - log->readTotal;
+}
+
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
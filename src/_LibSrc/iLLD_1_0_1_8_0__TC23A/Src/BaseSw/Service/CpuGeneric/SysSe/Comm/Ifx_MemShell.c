@@ -0,0 +1,350 @@
+/**
+ * \file Ifx_MemShell.c
+ * \brief Memory access shell commands: binary DMA dump, read, write and telemetry watch
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+
+#include "Ifx_MemShell.h"
+#include "Cpu/Std/IfxCpu.h"
+#include "SysSe/Bsp/Bsp.h"
+#include "SysSe/Math/Ifx_Crc.h"
+#include "_Utilities/Ifx_Assert.h"
+#include <stdio.h>
+
+/** Words shown per line by the 'mread' command */
+#define IFX_MEMSHELL_WORDS_PER_LINE (4)
+
+/** Command list, the data pointer is set to the memory shell object by Ifx_MemShell_init() */
+static const Ifx_Shell_Command Ifx_MemShell_commandTemplate[] = {
+    {"mdump", "    : Binary dump of a memory area by DMA"ENDL
+     "/s mdump <address> <length>"ENDL
+     "/p <address>: start address, hexadecimal"ENDL
+     "/p <length>: length in bytes", NULL_PTR, &Ifx_MemShell_dump },
+    {"mread", "    : Show 32 bit words"ENDL
+     "/s mread <address> [<count>]"ENDL
+     "/p <address>: start address, hexadecimal"ENDL
+     "/p <count>: number of words, 1 by default", NULL_PTR, &Ifx_MemShell_read },
+    {"mwrite", "   : Write consecutive values"ENDL
+     "/s mwrite <address> <size> <value> [<value> ...]"ENDL
+     "/p <address>: start address, hexadecimal, aligned on size"ENDL
+     "/p <size>: size of the values in bytes: 1, 2 or 4"ENDL
+     "/p <value>: value, hexadecimal", NULL_PTR, &Ifx_MemShell_write },
+    {"watch", "    : Sample a variable into the telemetry"ENDL
+     "/s watch [<address> <size> [<divider>]]"ENDL
+     "/p <address>: variable address, hexadecimal, aligned on size"ENDL
+     "/p <size>: variable size in bytes: 1, 2 or 4"ENDL
+     "/p <divider>: sampled every divider calls of Ifx_Telemetry_sample(), 1 by default"ENDL
+     "/p no parameter: show the watch list", NULL_PTR, &Ifx_MemShell_watch },
+    IFX_SHELL_COMMAND_LIST_END
+};
+
+/** Write a 32 bit value, little endian */
+static void Ifx_MemShell_setUInt32(uint8 *dest, uint32 value)
+{
+    dest[0] = (uint8)value;
+    dest[1] = (uint8)(value >> 8);
+    dest[2] = (uint8)(value >> 16);
+    dest[3] = (uint8)(value >> 24);
+}
+
+
+boolean Ifx_MemShell_dump(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    Ifx_MemShell *memShell = (Ifx_MemShell *)data;
+    void         *address;
+    uint32        length;
+
+    if (Ifx_Shell_matchToken(&args, "?") != FALSE)
+    {
+        IfxStdIf_DPipe_print(io, "Syntax     : mdump <address> <length>"ENDL);
+        IfxStdIf_DPipe_print(io, "           > Binary frame: \"MD\", address, length, memory, CRC-32"ENDL);
+    }
+    else if ((Ifx_Shell_parseAddress(&args, &address) == FALSE)
+             || (Ifx_Shell_parseUInt32(&args, &length, FALSE) == FALSE)
+             || (length == 0) || (length > IFX_MEMSHELL_MAX_DUMP_LENGTH))
+    {
+        IfxStdIf_DPipe_print(io, "Syntax error: mdump <address> <length>, length up to %d"ENDL, IFX_MEMSHELL_MAX_DUMP_LENGTH);
+    }
+    else if (memShell->asc == NULL_PTR)
+    {
+        IfxStdIf_DPipe_print(io, "Error: binary dump not available"ENDL);
+    }
+    else if (Ifx_MemShell_dumpMemory(memShell, address, length) == FALSE)
+    {
+        IfxStdIf_DPipe_print(io, "Error: transmission busy"ENDL);
+    }
+
+    return TRUE;
+}
+
+
+boolean Ifx_MemShell_dumpMemory(Ifx_MemShell *memShell, const void *address, uint32 length)
+{
+    IfxAsclin_Asc *asc = memShell->asc;
+    const uint8   *block;
+    uint32         remaining;
+    uint32         crc;
+    uint32         i;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (length > 0) && (length <= IFX_MEMSHELL_MAX_DUMP_LENGTH));
+
+    /* The descriptors, the header and the CRC of the previous dump are read by the DMA until its end */
+    if (IfxAsclin_Asc_flushTx(asc, memShell->dumpTimeout) == FALSE)
+    {
+        return FALSE;
+    }
+
+    memShell->header[0] = 'M';
+    memShell->header[1] = 'D';
+    Ifx_MemShell_setUInt32(&memShell->header[2], (uint32)address);
+    Ifx_MemShell_setUInt32(&memShell->header[6], length);
+
+    crc = Ifx_Crc_crc32(IFX_CRC_CRC32_INIT, &memShell->header[2], IFX_MEMSHELL_DUMP_HEADER_SIZE - 2);
+    crc = Ifx_Crc_crc32(crc, (const uint8 *)address, length);
+    Ifx_MemShell_setUInt32(memShell->trailer, crc);
+
+    /* header, memory blocks sent from their location, CRC */
+    IfxAsclin_Asc_initDmaTxDescriptor(asc, &memShell->descriptors[0], memShell->header, IFX_MEMSHELL_DUMP_HEADER_SIZE, &memShell->descriptors[1]);
+
+    block     = (const uint8 *)address;
+    remaining = length;
+
+    for (i = 1; remaining > 0; i++)
+    {
+        Ifx_SizeT count = (Ifx_SizeT)__min(remaining, IFX_MEMSHELL_DUMP_BLOCK_SIZE);
+
+        IfxAsclin_Asc_initDmaTxDescriptor(asc, &memShell->descriptors[i], block, count, &memShell->descriptors[i + 1]);
+        block     += count;
+        remaining -= count;
+    }
+
+    IfxAsclin_Asc_initDmaTxDescriptor(asc, &memShell->descriptors[i], memShell->trailer, sizeof(memShell->trailer), NULL_PTR);
+
+    /* the transmit FIFO may have been refilled by an interrupt since the flush */
+    {
+        Ifx_TickTime deadline = getDeadLine(memShell->dumpTimeout);
+
+        while (IfxAsclin_Asc_writeDma(asc, &memShell->descriptors[0]) == FALSE)
+        {
+            if (isDeadLine(deadline) != FALSE)
+            {
+                return FALSE;
+            }
+        }
+    }
+
+    memShell->dumpCount++;
+
+    return TRUE;
+}
+
+
+boolean Ifx_MemShell_init(Ifx_MemShell *memShell, const Ifx_MemShell_Config *config)
+{
+    uint32 i;
+
+    if ((config->asc != NULL_PTR) && (config->asc->dma.useTxDma == FALSE))
+    {
+        return FALSE;
+    }
+
+    /* The DMA loads the descriptors, the header and the CRC from memory, bypassing the data cache */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->asc == NULL_PTR) || (IfxCpu_isAddressCachable(memShell) == FALSE));
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((uint32)&memShell->descriptors[0] & 0x1FU) == 0);
+
+    memShell->asc         = config->asc;
+    memShell->telemetry   = config->telemetry;
+    memShell->dumpTimeout = config->dumpTimeout;
+    memShell->dumpCount   = 0;
+    memShell->watchCount  = 0;
+
+    for (i = 0; i < Ifx_COUNTOF(Ifx_MemShell_commandTemplate); i++)
+    {
+        memShell->commands[i] = Ifx_MemShell_commandTemplate[i];
+
+        if (memShell->commands[i].call != NULL_PTR)
+        {
+            memShell->commands[i].data = memShell;
+        }
+    }
+
+    return TRUE;
+}
+
+
+void Ifx_MemShell_initConfig(Ifx_MemShell_Config *config)
+{
+    config->asc         = NULL_PTR;
+    config->telemetry   = NULL_PTR;
+    config->dumpTimeout = 100 * TimeConst_1ms;
+}
+
+
+boolean Ifx_MemShell_read(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    void  *address;
+    uint32 count = 1;
+    uint32 i;
+
+    (void)data;
+
+    if (Ifx_Shell_matchToken(&args, "?") != FALSE)
+    {
+        IfxStdIf_DPipe_print(io, "Syntax     : mread <address> [<count>]"ENDL);
+    }
+    else if ((Ifx_Shell_parseAddress(&args, &address) == FALSE) || (((uint32)address & 3U) != 0))
+    {
+        IfxStdIf_DPipe_print(io, "Syntax error: mread <address> [<count>], address aligned on 4"ENDL);
+    }
+    else
+    {
+        const volatile uint32 *word = (const volatile uint32 *)address;
+
+        Ifx_Shell_parseUInt32(&args, &count, FALSE);
+
+        for (i = 0; i < count; i++)
+        {
+            if ((i % IFX_MEMSHELL_WORDS_PER_LINE) == 0)
+            {
+                IfxStdIf_DPipe_print(io, "%s0x%08lX:", (i != 0) ? ENDL : "", (uint32)&word[i]);
+            }
+
+            IfxStdIf_DPipe_print(io, " %08lX", word[i]);
+        }
+
+        IfxStdIf_DPipe_print(io, ENDL);
+    }
+
+    return TRUE;
+}
+
+
+boolean Ifx_MemShell_watch(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    Ifx_MemShell *memShell = (Ifx_MemShell *)data;
+    void         *address;
+    uint32        size;
+    uint32        divider  = 1;
+
+    if (Ifx_Shell_matchToken(&args, "?") != FALSE)
+    {
+        IfxStdIf_DPipe_print(io, "Syntax     : watch [<address> <size> [<divider>]]"ENDL);
+    }
+    else if (memShell->telemetry == NULL_PTR)
+    {
+        IfxStdIf_DPipe_print(io, "Error: telemetry not available"ENDL);
+    }
+    else if (*Ifx_Shell_skipWhitespace(args) == IFX_SHELL_NULL_CHAR)
+    {
+        uint8 i;
+
+        for (i = 0; i < memShell->watchCount; i++)
+        {
+            const Ifx_Telemetry_Channel *channel = &memShell->telemetry->channels[memShell->watchIds[i]];
+
+            IfxStdIf_DPipe_print(io, "Channel %d: %s, %d bytes, divider %d"ENDL, memShell->watchIds[i], channel->name, channel->size, channel->startDivider);
+        }
+    }
+    else if ((Ifx_Shell_parseAddress(&args, &address) == FALSE)
+             || (Ifx_Shell_parseUInt32(&args, &size, FALSE) == FALSE)
+             || ((size != 1) && (size != 2) && (size != 4)) || (((uint32)address & (size - 1)) != 0))
+    {
+        IfxStdIf_DPipe_print(io, "Syntax error: watch <address> <size> [<divider>], size 1, 2 or 4"ENDL);
+    }
+    else if (memShell->watchCount >= IFX_CFG_MEMSHELL_MAX_WATCHES)
+    {
+        IfxStdIf_DPipe_print(io, "Error: watch list full"ENDL);
+    }
+    else
+    {
+        char  *name = memShell->watchNames[memShell->watchCount];
+        sint32 id;
+
+        Ifx_Shell_parseUInt32(&args, &divider, FALSE);
+        sprintf(name, "0x%08lX", (uint32)address);
+
+        /* the channels can not be added while the protocol runs */
+        id = Ifx_Telemetry_addChannel(memShell->telemetry, name, address, (uint8)size);
+
+        if (id < 0)
+        {
+            IfxStdIf_DPipe_print(io, "Error: telemetry channel not available"ENDL);
+        }
+        else
+        {
+            Ifx_Telemetry_setStartDivider(memShell->telemetry, id, (uint16)__min(divider, 0xFFFFU));
+            memShell->watchIds[memShell->watchCount] = (uint8)id;
+            memShell->watchCount++;
+            IfxStdIf_DPipe_print(io, "Channel %ld: %s"ENDL, id, name);
+        }
+    }
+
+    return TRUE;
+}
+
+
+boolean Ifx_MemShell_write(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    void  *address;
+    uint32 size;
+    uint32 value;
+    uint32 count = 0;
+
+    (void)data;
+
+    if (Ifx_Shell_matchToken(&args, "?") != FALSE)
+    {
+        IfxStdIf_DPipe_print(io, "Syntax     : mwrite <address> <size> <value> [<value> ...]"ENDL);
+    }
+    else if ((Ifx_Shell_parseAddress(&args, &address) == FALSE)
+             || (Ifx_Shell_parseUInt32(&args, &size, FALSE) == FALSE)
+             || ((size != 1) && (size != 2) && (size != 4)) || (((uint32)address & (size - 1)) != 0))
+    {
+        IfxStdIf_DPipe_print(io, "Syntax error: mwrite <address> <size> <value> [<value> ...], size 1, 2 or 4"ENDL);
+    }
+    else
+    {
+        uint8 *dest = (uint8 *)address;
+
+        while (Ifx_Shell_parseUInt32(&args, &value, TRUE) != FALSE)
+        {
+            switch (size)
+            {
+            case 1:
+                *(volatile uint8 *)dest = (uint8)value;
+                break;
+            case 2:
+                *(volatile uint16 *)dest = (uint16)value;
+                break;
+            default:
+                *(volatile uint32 *)dest = value;
+                break;
+            }
+
+            dest += size;
+            count++;
+        }
+
+        IfxStdIf_DPipe_print(io, "%lu values written"ENDL, count);
+    }
+
+    return TRUE;
+}
@@ -0,0 +1,482 @@
+/**
+ * \file Ifx_Ptp.c
+ * \brief Lightweight IEEE 1588 (PTP) slave on top of the ETH timestamps
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include <string.h>
+
+#include "Ifx_Ptp.h"
+#include "_Utilities/Ifx_Assert.h"
+
+#define IFX_PTP_SYNC           (0x0U)
+#define IFX_PTP_DELAY_REQ      (0x1U)
+#define IFX_PTP_FOLLOW_UP      (0x8U)
+#define IFX_PTP_DELAY_RESP     (0x9U)
+#define IFX_PTP_VERSION        (2U)
+#define IFX_PTP_TWO_STEP       (0x02U)  /**< flagField[0] */
+#define IFX_PTP_DELAY_REQ_SIZE (44U)    /**< header and origin timestamp */
+#define IFX_PTP_DELAY_FILTER   (8)      /**< mean path delay low pass, in samples */
+#define IFX_PTP_RATE_FILTER    (4)      /**< time base rate low pass, in samples */
+
+/* Byte offsets in the frame */
+#define IFX_PTP_ETH_DESTINATION (0U)
+#define IFX_PTP_ETH_SOURCE      (6U)
+#define IFX_PTP_ETH_TYPE        (12U)
+#define IFX_PTP_MESSAGE         (14U)
+#define IFX_PTP_VERSION_PTP     (15U)
+#define IFX_PTP_LENGTH          (16U)
+#define IFX_PTP_DOMAIN          (18U)
+#define IFX_PTP_FLAGS           (20U)
+#define IFX_PTP_CORRECTION      (22U)
+#define IFX_PTP_SOURCE_PORT     (34U)
+#define IFX_PTP_SEQUENCE        (44U)
+#define IFX_PTP_CONTROL         (46U)
+#define IFX_PTP_LOG_INTERVAL    (47U)
+#define IFX_PTP_TIMESTAMP       (48U)   /**< origin / precise origin / receive timestamp */
+#define IFX_PTP_REQUESTING_PORT (58U)   /**< Delay_Resp */
+
+static const uint8 Ifx_Ptp_multicastMac[6] = {0x01, 0x1B, 0x19, 0x00, 0x00, 0x00};
+
+/** Big endian 16 bit read
+ */
+IFX_INLINE uint16 Ifx_Ptp_read16(const uint8 *data)
+{
+    return (uint16)(((uint16)data[0] << 8) | data[1]);
+}
+
+
+/** Big endian 32 bit read
+ */
+IFX_INLINE uint32 Ifx_Ptp_read32(const uint8 *data)
+{
+    return ((uint32)data[0] << 24) | ((uint32)data[1] << 16) | ((uint32)data[2] << 8) | data[3];
+}
+
+
+/** Big endian 16 bit write
+ */
+IFX_INLINE void Ifx_Ptp_write16(uint8 *data, uint16 value)
+{
+    data[0] = (uint8)(value >> 8);
+    data[1] = (uint8)value;
+}
+
+
+/** Time in ns
+ */
+IFX_INLINE sint64 Ifx_Ptp_toNs(const IfxEth_Timestamp *timestamp)
+{
+    return ((sint64)timestamp->seconds * (sint64)IFXETH_NANOSECONDS_PER_SECOND) + (sint64)timestamp->nanoseconds;
+}
+
+
+/** Timestamp of a message in ns. The upper 16 bit of the 48 bit seconds are ignored, as by the ETH system time
+ */
+IFX_INLINE sint64 Ifx_Ptp_readTimestamp(const uint8 *data)
+{
+    IfxEth_Timestamp timestamp;
+
+    timestamp.seconds     = Ifx_Ptp_read32(&data[2]);
+    timestamp.nanoseconds = Ifx_Ptp_read32(&data[6]);
+
+    return Ifx_Ptp_toNs(&timestamp);
+}
+
+
+/** Correction field in ns, the sub-nanoseconds are dropped
+ */
+IFX_INLINE sint64 Ifx_Ptp_readCorrection(const uint8 *data)
+{
+    uint64 correction = ((uint64)Ifx_Ptp_read32(&data[0]) << 32) | Ifx_Ptp_read32(&data[4]);
+
+    return ((sint64)correction) >> 16;
+}
+
+
+/** Counter ticks to ns at the nominal frequency, without overflow
+ */
+static uint64 Ifx_Ptp_ticksToNs(uint64 ticks, uint32 frequency)
+{
+    return ((ticks / frequency) * IFXETH_NANOSECONDS_PER_SECOND)
+           + (((ticks % frequency) * IFXETH_NANOSECONDS_PER_SECOND) / frequency);
+}
+
+
+/** ns to counter ticks at the nominal frequency, without overflow
+ */
+static uint64 Ifx_Ptp_nsToTicks(uint64 ns, uint32 frequency)
+{
+    return ((ns / IFXETH_NANOSECONDS_PER_SECOND) * frequency)
+           + (((ns % IFXETH_NANOSECONDS_PER_SECOND) * frequency) / IFXETH_NANOSECONDS_PER_SECOND);
+}
+
+
+/** Send a Delay_Req, its transmit timestamp is read by Ifx_Ptp_process()
+ */
+static void Ifx_Ptp_sendDelayRequest(Ifx_Ptp *ptp)
+{
+    uint8           *frame   = (uint8 *)ptp->frame;
+    IfxEth_TxSegment segment = {frame, IFX_PTP_MESSAGE + IFX_PTP_DELAY_REQ_SIZE, NULL_PTR};
+
+    memset(frame, 0, sizeof(ptp->frame));
+    memcpy(&frame[IFX_PTP_ETH_DESTINATION], Ifx_Ptp_multicastMac, 6);
+    IfxEth_readMacAddress(ptp->eth, &frame[IFX_PTP_ETH_SOURCE]);
+    Ifx_Ptp_write16(&frame[IFX_PTP_ETH_TYPE], IFX_PTP_ETHERTYPE);
+
+    ptp->delaySequence++;
+    frame[IFX_PTP_MESSAGE]      = IFX_PTP_DELAY_REQ;
+    frame[IFX_PTP_VERSION_PTP]  = IFX_PTP_VERSION;
+    Ifx_Ptp_write16(&frame[IFX_PTP_LENGTH], IFX_PTP_DELAY_REQ_SIZE);
+    frame[IFX_PTP_DOMAIN]       = ptp->config.domain;
+    memcpy(&frame[IFX_PTP_SOURCE_PORT], ptp->portIdentity, IFX_PTP_PORT_IDENTITY_SIZE);
+    Ifx_Ptp_write16(&frame[IFX_PTP_SEQUENCE], ptp->delaySequence);
+    frame[IFX_PTP_CONTROL]      = 1;
+    frame[IFX_PTP_LOG_INTERVAL] = 0x7F;
+
+    ptp->syncCount              = 0;
+    ptp->delaySentValid         = FALSE;
+    ptp->delayReceivedValid     = FALSE;
+
+    IfxEth_requestTransmitTimestamp(ptp->eth);
+
+    if (IfxEth_sendTransmitPacket(ptp->eth, &segment, 1) != FALSE)
+    {
+        ptp->delayPending = TRUE;
+        ptp->delayAge     = 0;
+        ptp->delayRequests++;
+    }
+    else
+    {
+        ptp->eth->txTimestampRequest = FALSE;
+    }
+}
+
+
+/** Update the mean path delay once both Delay_Req times are known
+ */
+static void Ifx_Ptp_updateDelay(Ifx_Ptp *ptp)
+{
+    if ((ptp->delaySentValid != FALSE) && (ptp->delayReceivedValid != FALSE))
+    {
+        /* the clock offset cancels out */
+        sint64 delay = (ptp->masterToSlave + (ptp->delayReceived - ptp->delaySent)) / 2;
+
+        delay                   = (delay < 0) ? 0 : delay;
+        ptp->delaySentValid     = FALSE;
+        ptp->delayReceivedValid = FALSE;
+        ptp->delayResponses++;
+
+        if (ptp->meanPathDelay < 0)
+        {
+            ptp->meanPathDelay = delay;
+        }
+        else
+        {
+            ptp->meanPathDelay += (delay - ptp->meanPathDelay) / IFX_PTP_DELAY_FILTER;
+        }
+    }
+}
+
+
+/** Correct the clock with the times of a Sync: t1 = origin, t2 = ptp->syncReceived
+ */
+static void Ifx_Ptp_updateOffset(Ifx_Ptp *ptp, sint64 origin)
+{
+    sint64 offset;
+
+    ptp->masterToSlave = ptp->syncReceived - origin;
+    offset             = ptp->masterToSlave - ((ptp->meanPathDelay < 0) ? 0 : ptp->meanPathDelay);
+    ptp->offset        = offset;
+    ptp->syncs++;
+
+    if ((offset > ptp->config.stepThreshold) || (offset < -(sint64)ptp->config.stepThreshold))
+    {
+        IfxEth_adjustTime(ptp->eth, -offset);
+
+        /* the pending delay measurement was taken before the step */
+        ptp->delaySequence++;
+        ptp->delaySentValid     = FALSE;
+        ptp->delayReceivedValid = FALSE;
+        ptp->integral           = 0;
+        ptp->state              = Ifx_Ptp_State_uncalibrated;
+        ptp->steps++;
+    }
+    else if (ptp->meanPathDelay >= 0)
+    {
+        float32 maxFrequency = (float32)ptp->config.maxFrequency;
+        float32 frequency;
+
+        /* slave ahead (positive offset): slow down */
+        ptp->integral  = __saturatef(ptp->integral + (ptp->config.ki * (float32)offset), -maxFrequency, maxFrequency);
+        frequency      = __saturatef(-((ptp->config.kp * (float32)offset) + ptp->integral), -maxFrequency, maxFrequency);
+        ptp->frequency = (sint32)frequency;
+        IfxEth_adjustFrequency(ptp->eth, ptp->frequency);
+        ptp->state     = Ifx_Ptp_State_slave;
+    }
+    else
+    {}
+
+    ptp->syncCount++;
+
+    if ((ptp->syncCount >= ptp->config.delayRequestRate) && (ptp->delayPending == FALSE))
+    {
+        Ifx_Ptp_sendDelayRequest(ptp);
+    }
+}
+
+
+uint64 Ifx_Ptp_getTimeBaseTicks(const Ifx_Ptp_TimeBase *timeBase, sint64 time)
+{
+    sint64 elapsed = time - timeBase->time;
+    uint64 ticks;
+
+    /* inverse rate correction, first order */
+    elapsed -= (elapsed * timeBase->rate) / (sint64)IFXETH_NANOSECONDS_PER_SECOND;
+
+    if (elapsed >= 0)
+    {
+        ticks = timeBase->ticks + Ifx_Ptp_nsToTicks((uint64)elapsed, timeBase->frequency);
+    }
+    else
+    {
+        ticks = timeBase->ticks - Ifx_Ptp_nsToTicks((uint64)(-elapsed), timeBase->frequency);
+    }
+
+    return ticks;
+}
+
+
+sint64 Ifx_Ptp_getTimeBaseTime(const Ifx_Ptp_TimeBase *timeBase, uint64 ticks)
+{
+    sint64 elapsed;
+
+    if (ticks >= timeBase->ticks)
+    {
+        elapsed = (sint64)Ifx_Ptp_ticksToNs(ticks - timeBase->ticks, timeBase->frequency);
+    }
+    else
+    {
+        elapsed = -(sint64)Ifx_Ptp_ticksToNs(timeBase->ticks - ticks, timeBase->frequency);
+    }
+
+    return timeBase->time + elapsed + ((elapsed * timeBase->rate) / (sint64)IFXETH_NANOSECONDS_PER_SECOND);
+}
+
+
+boolean Ifx_Ptp_init(Ifx_Ptp *ptp, const Ifx_Ptp_Config *config)
+{
+    boolean result = (config->eth != NULL_PTR) && (config->eth->timestampAddend != 0) && (config->delayRequestRate != 0);
+
+    memset(ptp, 0, sizeof(Ifx_Ptp));
+
+    if (result != FALSE)
+    {
+        uint8 macAddress[6];
+
+        ptp->eth           = config->eth;
+        ptp->config        = *config;
+        ptp->state         = Ifx_Ptp_State_listening;
+        ptp->meanPathDelay = -1;
+
+        /* clock identity EUI-64 from the MAC address, port 1 */
+        IfxEth_readMacAddress(ptp->eth, macAddress);
+        ptp->portIdentity[0] = macAddress[0];
+        ptp->portIdentity[1] = macAddress[1];
+        ptp->portIdentity[2] = macAddress[2];
+        ptp->portIdentity[3] = 0xFF;
+        ptp->portIdentity[4] = 0xFE;
+        ptp->portIdentity[5] = macAddress[3];
+        ptp->portIdentity[6] = macAddress[4];
+        ptp->portIdentity[7] = macAddress[5];
+        Ifx_Ptp_write16(&ptp->portIdentity[8], 1);
+    }
+    else
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+    }
+
+    return result;
+}
+
+
+void Ifx_Ptp_initConfig(Ifx_Ptp_Config *config)
+{
+    config->eth              = NULL_PTR;
+    config->domain           = 0;
+    config->delayRequestRate = 1;
+    config->syncTimeout      = 300;
+    config->stepThreshold    = 100000;
+    config->kp               = 0.7f;
+    config->ki               = 0.3f;
+    config->maxFrequency     = 500000;
+}
+
+
+void Ifx_Ptp_initTimeBase(Ifx_Ptp_TimeBase *timeBase, Ifx_Ptp_GetTicks getTicks, void *data, float32 frequency)
+{
+    timeBase->getTicks  = getTicks;
+    timeBase->data      = data;
+    timeBase->frequency = (uint32)frequency;
+    timeBase->samples   = 0;
+    timeBase->steps     = 0;
+    timeBase->ticks     = 0;
+    timeBase->time      = 0;
+    timeBase->rate      = 0;
+}
+
+
+void Ifx_Ptp_process(Ifx_Ptp *ptp)
+{
+    if (ptp->delayPending != FALSE)
+    {
+        IfxEth_Timestamp sent;
+
+        if (IfxEth_getTransmitTimestamp(ptp->eth, &sent) != FALSE)
+        {
+            ptp->delaySent      = Ifx_Ptp_toNs(&sent);
+            ptp->delaySentValid = TRUE;
+            ptp->delayPending   = FALSE;
+            Ifx_Ptp_updateDelay(ptp);
+        }
+        else if (++ptp->delayAge > ptp->config.syncTimeout)
+        {
+            /* not sent, the frame buffer is reused */
+            ptp->delayPending = FALSE;
+        }
+        else
+        {}
+    }
+
+    if ((ptp->state != Ifx_Ptp_State_listening) && (++ptp->syncAge > ptp->config.syncTimeout))
+    {
+        /* master lost, the next Sync selects a master */
+        ptp->state           = Ifx_Ptp_State_listening;
+        ptp->followUpPending = FALSE;
+    }
+}
+
+
+boolean Ifx_Ptp_receive(Ifx_Ptp *ptp, const uint8 *frame, uint16 length, const IfxEth_Timestamp *timestamp)
+{
+    boolean result = (length >= (IFX_PTP_TIMESTAMP + 10U)) && (Ifx_Ptp_read16(&frame[IFX_PTP_ETH_TYPE]) == IFX_PTP_ETHERTYPE);
+
+    if ((result != FALSE)
+        && ((frame[IFX_PTP_VERSION_PTP] & 0x0FU) == IFX_PTP_VERSION)
+        && (frame[IFX_PTP_DOMAIN] == ptp->config.domain))
+    {
+        uint8   message    = frame[IFX_PTP_MESSAGE] & 0x0FU;
+        uint16  sequence   = Ifx_Ptp_read16(&frame[IFX_PTP_SEQUENCE]);
+        sint64  correction = Ifx_Ptp_readCorrection(&frame[IFX_PTP_CORRECTION]);
+        boolean fromMaster = (memcmp(&frame[IFX_PTP_SOURCE_PORT], ptp->master, IFX_PTP_PORT_IDENTITY_SIZE) == 0) ? TRUE : FALSE;
+
+        if ((message == IFX_PTP_SYNC) && (timestamp != NULL_PTR))
+        {
+            if (ptp->state == Ifx_Ptp_State_listening)
+            {
+                memcpy(ptp->master, &frame[IFX_PTP_SOURCE_PORT], IFX_PTP_PORT_IDENTITY_SIZE);
+                ptp->state = Ifx_Ptp_State_uncalibrated;
+                fromMaster = TRUE;
+            }
+
+            if (fromMaster != FALSE)
+            {
+                ptp->syncAge        = 0;
+                ptp->syncSequence   = sequence;
+                ptp->syncReceived   = Ifx_Ptp_toNs(timestamp);
+                ptp->syncCorrection = correction;
+
+                if ((frame[IFX_PTP_FLAGS] & IFX_PTP_TWO_STEP) != 0)
+                {
+                    ptp->followUpPending = TRUE;
+                }
+                else
+                {
+                    ptp->followUpPending = FALSE;
+                    Ifx_Ptp_updateOffset(ptp, Ifx_Ptp_readTimestamp(&frame[IFX_PTP_TIMESTAMP]) + correction);
+                }
+            }
+        }
+        else if ((message == IFX_PTP_FOLLOW_UP) && (fromMaster != FALSE)
+                 && (ptp->followUpPending != FALSE) && (sequence == ptp->syncSequence))
+        {
+            ptp->followUpPending = FALSE;
+            Ifx_Ptp_updateOffset(ptp, Ifx_Ptp_readTimestamp(&frame[IFX_PTP_TIMESTAMP]) + ptp->syncCorrection + correction);
+        }
+        else if ((message == IFX_PTP_DELAY_RESP) && (fromMaster != FALSE)
+                 && (length >= (IFX_PTP_REQUESTING_PORT + IFX_PTP_PORT_IDENTITY_SIZE)) && (sequence == ptp->delaySequence)
+                 && (memcmp(&frame[IFX_PTP_REQUESTING_PORT], ptp->portIdentity, IFX_PTP_PORT_IDENTITY_SIZE) == 0))
+        {
+            ptp->delayReceived      = Ifx_Ptp_readTimestamp(&frame[IFX_PTP_TIMESTAMP]) - correction;
+            ptp->delayReceivedValid = TRUE;
+            Ifx_Ptp_updateDelay(ptp);
+        }
+        else
+        {
+            /* Announce, other slaves Delay_Req... */
+        }
+    }
+
+    return result;
+}
+
+
+void Ifx_Ptp_syncTimeBase(Ifx_Ptp *ptp, Ifx_Ptp_TimeBase *timeBase)
+{
+    IfxEth_Timestamp now;
+    uint64           before, after, ticks;
+    sint64           time, nominal;
+    boolean          interruptState = IfxCpu_disableInterrupts();
+
+    /* counter sampled in the middle of the system time read */
+    before = timeBase->getTicks(timeBase->data);
+    IfxEth_getTime(ptp->eth, &now);
+    after  = timeBase->getTicks(timeBase->data);
+    IfxCpu_restoreInterrupts(interruptState);
+
+    ticks  = before + ((after - before) / 2);
+    time   = Ifx_Ptp_toNs(&now);
+
+    nominal = (ticks > timeBase->ticks) ? (sint64)Ifx_Ptp_ticksToNs(ticks - timeBase->ticks, timeBase->frequency) : 0;
+
+    if ((timeBase->samples != 0) && (timeBase->steps == ptp->steps) && (nominal > 0))
+    {
+        sint64 rate = (((time - timeBase->time) - nominal) * (sint64)IFXETH_NANOSECONDS_PER_SECOND) / nominal;
+
+        if (timeBase->samples == 1)
+        {
+            timeBase->rate = (sint32)rate;
+        }
+        else
+        {
+            timeBase->rate += (sint32)((rate - timeBase->rate) / IFX_PTP_RATE_FILTER);
+        }
+
+        timeBase->samples++;
+    }
+    else
+    {
+        timeBase->samples = 1;
+    }
+
+    timeBase->steps = ptp->steps;
+    timeBase->ticks = ticks;
+    timeBase->time  = time;
+}
@@ -26,14 +26,10 @@
 #include "Ifx_Shell.h"
 #include "_Utilities/Ifx_Assert.h"
 #include "Cpu/Std/IfxCpu_Intrinsics.h"
+#include "SysSe/General/Ifx_Format.h"
 
 #include <string.h>
 #include <stdlib.h>
-#include <stdio.h>
-
-#define IFX_SHELL_LLD              "%lld "
-#define IFX_SHELL_LLX              "%llx "
-#define IFX_SHELL_LLU              "%llu "
 
 //---------------------------------------------------------------------------
 #define IFX_SHELL_MAX_MESSAGE_SIZE 255
@@ -60,6 +56,7 @@ void                     Ifx_Shell_execute(Ifx_Shell *shell, pchar commandLine);
 void                     Ifx_Shell_cmdEscapeProcess(Ifx_Shell *shell, char EscapeChar1, char EscapeChar2);
 const Ifx_Shell_Command *Ifx_Shell_commandListFind(Ifx_Shell *shell, pchar commandLine, pchar *args, Ifx_Shell_CommandListConst *commandList);
 static boolean           Ifx_Shell_matchCommand(pchar *argsPtr, pchar *match);
+static void              Ifx_Shell_indexBuild(Ifx_Shell *shell);
 
 //---------------------------------------------------------------------------
 /**
@@ -305,6 +302,8 @@ void Ifx_Shell_initConfig(Ifx_Shell_Config *config)
     config->protocol.onStartData = NULL_PTR;
     config->protocol.start       = NULL_PTR;
     config->protocol.started     = FALSE;
+    config->commandIndex         = NULL_PTR;
+    config->commandIndexSize     = 0;
     config->sendResultCode       = FALSE;
     config->showPrompt           = TRUE;
     config->standardIo           = NULL_PTR;
@@ -344,6 +343,10 @@ boolean Ifx_Shell_init(Ifx_Shell *shell, const Ifx_Shell_Config *config)
         shell->commandList[i] = config->commandList[i];
     }
 
+    shell->commandIndex     = config->commandIndex;
+    shell->commandIndexSize = config->commandIndexSize;
+    Ifx_Shell_indexBuild(shell);
+
     /* Initialize command history pointers */
     CmdHistory = shell->cmdHistory;
 
@@ -771,6 +774,7 @@ boolean Ifx_Shell_parseToken(pchar *argsPtr, char *tokenBuffer, int bufferLength
 boolean Ifx_Shell_parseAddress(pchar *argsPtr, void **address)
 {
     char    buffer[32];
+    uint64  value;
     boolean result;
 
     *address = 0;
@@ -781,7 +785,12 @@ boolean Ifx_Shell_parseAddress(pchar *argsPtr, void **address)
     }
     else
     {
-        result = (buffer[0] != IFX_SHELL_NULL_CHAR) && (sscanf(buffer, "%x ", (uint32 *)address) == 1);
+        result = (Ifx_Format_parseUInt64(buffer, &value, TRUE) != NULL_PTR) && (value <= 0xFFFFFFFFU);
+
+        if (result != FALSE)
+        {
+            *address = (void *)(uint32)value;
+        }
     }
 
     return result;
@@ -843,7 +852,7 @@ boolean Ifx_Shell_parseSInt64(pchar *argsPtr, sint64 *value)
     }
     else
     {
-        result = (buffer[0] != IFX_SHELL_NULL_CHAR) && (sscanf(buffer, IFX_SHELL_LLD, value) == 1);
+        result = Ifx_Format_parseSInt64(buffer, value) != NULL_PTR;
     }
 
     return result;
@@ -863,22 +872,8 @@ boolean Ifx_Shell_parseUInt64(pchar *argsPtr, uint64 *value, boolean hex)
     }
     else
     {
-        char *bufferPointer = buffer;
-
-        if ((buffer[0] == '0') && (buffer[1] == 'x'))
-        {
-            bufferPointer = &bufferPointer[2];
-            hex           = TRUE;
-        }
-
-        if (hex != FALSE)
-        {
-            result = (bufferPointer[0] != IFX_SHELL_NULL_CHAR) && (sscanf(bufferPointer, IFX_SHELL_LLX, value) == 1);
-        }
-        else
-        {
-            result = (bufferPointer[0] != IFX_SHELL_NULL_CHAR) && (sscanf(bufferPointer, IFX_SHELL_LLU, value) == 1);
-        }
+        /* The prefix "0x" selects the hexadecimal base */
+        result = Ifx_Format_parseUInt64(buffer, value, hex) != NULL_PTR;
     }
 
     return result;
@@ -898,7 +893,7 @@ boolean Ifx_Shell_parseFloat64(pchar *argsPtr, float64 *value)
     }
     else
     {
-        result = (buffer[0] != IFX_SHELL_NULL_CHAR) && (sscanf(buffer, "%lf ", value) == 1);
+        result = Ifx_Format_parseFloat64(buffer, value) != NULL_PTR;
     }
 
     return result;
@@ -918,7 +913,7 @@ boolean Ifx_Shell_parseFloat32(pchar *argsPtr, float32 *value)
     }
     else
     {
-        result = (buffer[0] != IFX_SHELL_NULL_CHAR) && (sscanf(buffer, "%f ", value) == 1);
+        result = Ifx_Format_parseFloat32(buffer, value) != NULL_PTR;
     }
 
     return result;
@@ -980,6 +975,192 @@ const Ifx_Shell_Command *Ifx_Shell_commandFind(Ifx_Shell_CommandListConst comman
 }
 
 
+/** FNV-1a hash of the token, continued from hash. Tokens are separated by a space
+ */
+static uint32 Ifx_Shell_hashToken(uint32 hash, pchar token, boolean first)
+{
+    if (first == FALSE)
+    {
+        hash = (hash ^ (uint32)' ') * 16777619UL;
+    }
+
+    while (*token != IFX_SHELL_NULL_CHAR)
+    {
+        hash  = (hash ^ (uint32)(uint8)*token) * 16777619UL;
+        token = &token[1];
+    }
+
+    return hash;
+}
+
+
+/** Hash all tokens of text, continued from hash and tokenCount
+ */
+static void Ifx_Shell_hashTokens(pchar text, uint32 *hash, uint32 *tokenCount)
+{
+    char buffer[256];
+
+    while (Ifx_Shell_parseToken(&text, buffer, Ifx_COUNTOF(buffer)) != FALSE)
+    {
+        *hash = Ifx_Shell_hashToken(*hash, buffer, *tokenCount == 0);
+        (*tokenCount)++;
+    }
+}
+
+
+/** Build the command index from the command lists. The index is disabled if a command can not be indexed
+ *
+ * The commands are inserted in the order of the linear search, so that the lookup returns the same
+ * command as \ref Ifx_Shell_commandFind() when several commands have the same name.
+ */
+static void Ifx_Shell_indexBuild(Ifx_Shell *shell)
+{
+    uint32  i;
+    uint32  used   = 0;
+    boolean result = (shell->commandIndex != NULL_PTR) && (shell->commandIndexSize != 0)
+                     && ((shell->commandIndexSize & (shell->commandIndexSize - 1)) == 0);
+
+    if (result != FALSE)
+    {
+        memset(shell->commandIndex, 0, shell->commandIndexSize * sizeof(Ifx_Shell_CommandIndexEntry));
+    }
+
+    for (i = 0; (i < IFX_CFG_SHELL_COMMAND_LISTS) && (result != FALSE); i++)
+    {
+        Ifx_Shell_CommandListConst commandList = shell->commandList[i];
+        const Ifx_Shell_Command   *command     = commandList;
+        uint32                     prefixHash  = 2166136261UL;
+        uint32                     prefixCount = 0;
+
+        if (commandList == NULL_PTR)
+        {
+            continue;
+        }
+
+        if ((command->commandLine != NULL_PTR) && (command->call == NULL_PTR))
+        {   /* List has a prefix, which is part of the name of all other commands of the list */
+            Ifx_Shell_hashTokens(command->commandLine, &prefixHash, &prefixCount);
+        }
+
+        while ((command->commandLine != NULL_PTR) && (result != FALSE))
+        {
+            uint32 hash       = prefixHash;
+            uint32 tokenCount = prefixCount;
+
+            if ((command != commandList) || (prefixCount == 0))
+            {
+                Ifx_Shell_hashTokens(command->commandLine, &hash, &tokenCount);
+            }
+
+            /* Keep at least one free entry to terminate the lookup */
+            result = (tokenCount != 0) && (tokenCount <= IFX_CFG_SHELL_INDEX_MAX_TOKENS) && (used < (shell->commandIndexSize - 1));
+
+            if (result != FALSE)
+            {
+                uint32 slot = hash & (shell->commandIndexSize - 1);
+
+                while (shell->commandIndex[slot].command != NULL_PTR)
+                {
+                    slot = (slot + 1) & (shell->commandIndexSize - 1);
+                }
+
+                shell->commandIndex[slot].command     = command;
+                shell->commandIndex[slot].commandList = commandList;
+                shell->commandIndex[slot].hash        = hash;
+                shell->commandIndex[slot].tokenCount  = tokenCount;
+                used++;
+            }
+
+            command = &command[1];
+        }
+    }
+
+    if (result == FALSE)
+    {
+        shell->commandIndex = NULL_PTR;
+    }
+}
+
+
+/** Check that the command line starts with the complete name of the indexed command
+ * \return Pointer to the arguments, NULL_PTR if the command does not match
+ */
+static pchar Ifx_Shell_indexMatch(const Ifx_Shell_CommandIndexEntry *entry, pchar commandLine)
+{
+    const Ifx_Shell_Command *prefix = entry->commandList;
+    pchar                    args   = commandLine;
+    pchar                    name;
+    char                     buffer[256];
+
+    if ((entry->command != prefix) && (prefix->call == NULL_PTR))
+    {
+        name = prefix->commandLine;
+
+        while (Ifx_Shell_matchCommand(&args, &name) != FALSE)
+        {}
+
+        if (Ifx_Shell_parseToken(&name, buffer, Ifx_COUNTOF(buffer)) != FALSE)
+        {
+            return NULL_PTR;
+        }
+    }
+
+    name = entry->command->commandLine;
+
+    while (Ifx_Shell_matchCommand(&args, &name) != FALSE)
+    {}
+
+    return (Ifx_Shell_parseToken(&name, buffer, Ifx_COUNTOF(buffer)) == FALSE) ? args : NULL_PTR;
+}
+
+
+/** Find the command with the longest match using the command index
+ */
+static const Ifx_Shell_Command *Ifx_Shell_indexFind(Ifx_Shell *shell, pchar commandLine, pchar *args, Ifx_Shell_CommandListConst *commandList)
+{
+    const Ifx_Shell_Command *result = NULL_PTR;
+    uint32                   hash[IFX_CFG_SHELL_INDEX_MAX_TOKENS];
+    uint32                   tokenCount = 0;
+    pchar                    text       = commandLine;
+    char                     buffer[256];
+
+    while ((tokenCount < IFX_CFG_SHELL_INDEX_MAX_TOKENS) && (Ifx_Shell_parseToken(&text, buffer, Ifx_COUNTOF(buffer)) != FALSE))
+    {
+        hash[tokenCount] = Ifx_Shell_hashToken((tokenCount == 0) ? 2166136261UL : hash[tokenCount - 1], buffer, tokenCount == 0);
+        tokenCount++;
+    }
+
+    /* Longest match first */
+    while ((tokenCount != 0) && (result == NULL_PTR))
+    {
+        uint32 slot = hash[tokenCount - 1] & (shell->commandIndexSize - 1);
+
+        while ((shell->commandIndex[slot].command != NULL_PTR) && (result == NULL_PTR))
+        {
+            const Ifx_Shell_CommandIndexEntry *entry = &shell->commandIndex[slot];
+
+            if ((entry->hash == hash[tokenCount - 1]) && (entry->tokenCount == tokenCount))
+            {
+                pchar commandArgs = Ifx_Shell_indexMatch(entry, commandLine);
+
+                if (commandArgs != NULL_PTR)
+                {
+                    result       = entry->command;
+                    *args        = commandArgs;
+                    *commandList = entry->commandList;
+                }
+            }
+
+            slot = (slot + 1) & (shell->commandIndexSize - 1);
+        }
+
+        tokenCount--;
+    }
+
+    return result;
+}
+
+
 const Ifx_Shell_Command *Ifx_Shell_commandListFind(Ifx_Shell *shell, pchar commandLine, pchar *args, Ifx_Shell_CommandListConst *commandList)
 {
     int                      i;
@@ -988,6 +1169,11 @@ const Ifx_Shell_Command *Ifx_Shell_commandListFind(Ifx_Shell *shell, pchar comma
     uint32                   matchMax     = 0;
     uint32                   match;
 
+    if (shell->commandIndex != NULL_PTR)
+    {
+        return Ifx_Shell_indexFind(shell, commandLine, args, commandList);
+    }
+
     for (i = 0; i < IFX_CFG_SHELL_COMMAND_LISTS; i++)
     {
         if (shell->commandList[i] != NULL_PTR)
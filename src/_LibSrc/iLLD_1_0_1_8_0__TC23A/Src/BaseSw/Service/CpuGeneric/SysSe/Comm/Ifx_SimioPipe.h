@@ -0,0 +1,77 @@
+/**
+ * \file Ifx_SimioPipe.h
+ * \brief Standard interface on the simulated IO (simio) of the instruction set simulator
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_comm_simiopipe Simulated IO standard interface
+ * \ingroup library_srvsw_sysse_comm
+ *
+ * The simulated IO buffers of simio_pls (SIMIO_Write(), SIMIO_Read()) are exchanged with the host by the
+ * simulator (TSIM) or by the debugger over JTAG. This module provides them as \ref IfxStdIf_DPipe, so that the
+ * console, the shell and the reports of the demos run unchanged in the SIMULATION build, where the ASCLIN is not
+ * simulated.
+ *
+ * In blocking mode the writes wait until the host has read enough data, no byte is lost and the output of a
+ * simulator run is complete. In non blocking mode the oldest bytes not yet read are overwritten.
+ *
+ * The reads never wait: the host input is available immediately in the simulator.
+ *
+ * Usage example:
+ * \code
+ * static Ifx_SimioPipe  simio;
+ * static IfxStdIf_DPipe simioStdIf;
+ *
+ * Ifx_SimioPipe_init(&simio, FALSE);
+ * Ifx_SimioPipe_stdIfDPipeInit(&simioStdIf, &simio);
+ * Ifx_Console_init(&simioStdIf);
+ * \endcode
+ *
+ */
+#ifndef IFX_SIMIOPIPE_H
+#define IFX_SIMIOPIPE_H 1
+
+#include "Cpu/Std/Ifx_Types.h"
+#include "StdIf/IfxStdIf_DPipe.h"
+
+/** \addtogroup library_srvsw_sysse_comm_simiopipe
+ * \{ */
+
+/** \brief Simulated IO object */
+typedef struct
+{
+    uint32       sendCount;     /**<\brief Number of bytes written */
+    Ifx_TickTime txTimestamp;   /**<\brief Time of the last write */
+} Ifx_SimioPipe;
+
+/** \brief Initialize the simulated IO
+ * \param pipe Pointer to the simulated IO object
+ * \param nonBlocking If TRUE, the writes never wait and overwrite the oldest bytes not yet read by the host
+ */
+IFX_EXTERN void Ifx_SimioPipe_init(Ifx_SimioPipe *pipe, boolean nonBlocking);
+
+/** \brief Initialize the standard interface of the simulated IO
+ * \param stdif Standard interface object, will be initialized by the function
+ * \param pipe Pointer to the simulated IO object
+ * \return Returns TRUE if the interface is initialized
+ */
+IFX_EXTERN boolean Ifx_SimioPipe_stdIfDPipeInit(IfxStdIf_DPipe *stdif, Ifx_SimioPipe *pipe);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -0,0 +1,554 @@
+/**
+ * \file Ifx_Telemetry.c
+ * \brief Binary telemetry protocol
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include <string.h>
+
+#include "Ifx_Telemetry.h"
+#include "_Utilities/Ifx_Assert.h"
+#include "SysSe/Bsp/Bsp.h"
+
+/** \brief Frame overhead: type, sequence and CRC */
+#define IFX_TELEMETRY_FRAME_OVERHEAD (4)
+
+/** \brief Maximal payload size */
+#define IFX_TELEMETRY_PAYLOAD_SIZE   (IFX_CFG_TELEMETRY_FRAME_SIZE - IFX_TELEMETRY_FRAME_OVERHEAD)
+
+/** \brief Size of the sample record header: record length and time stamp */
+#define IFX_TELEMETRY_RECORD_HEADER  (5)
+
+/** COBS encoding of length bytes followed by the 0x00 delimiter
+ * \return Returns the number of bytes written to dest
+ */
+static Ifx_SizeT Ifx_Telemetry_encode(const uint8 *source, Ifx_SizeT length, uint8 *dest)
+{
+    Ifx_SizeT codeIndex = 0;
+    Ifx_SizeT out       = 1;
+    uint8     code      = 1;
+    Ifx_SizeT in;
+
+    for (in = 0; in < length; in++)
+    {
+        if (source[in] == 0)
+        {
+            dest[codeIndex] = code;
+            codeIndex       = out++;
+            code            = 1;
+        }
+        else
+        {
+            dest[out++] = source[in];
+            code++;
+
+            if (code == 0xFF)
+            {
+                dest[codeIndex] = code;
+                codeIndex       = out++;
+                code            = 1;
+            }
+        }
+    }
+
+    dest[codeIndex] = code;
+    dest[out++]     = 0;
+
+    return out;
+}
+
+
+/** In place COBS decoding, the delimiter is not part of the data
+ * \return Returns the decoded length, or -1 if the data is not a valid COBS sequence
+ */
+static Ifx_SizeT Ifx_Telemetry_decode(uint8 *data, Ifx_SizeT length)
+{
+    Ifx_SizeT in  = 0;
+    Ifx_SizeT out = 0;
+
+    while ((in < length) && (out >= 0))
+    {
+        uint8 code = data[in++];
+        uint8 i;
+
+        if ((code == 0) || ((in + code - 1) > length))
+        {
+            out = -1;
+        }
+        else
+        {
+            for (i = 1; i < code; i++)
+            {
+                data[out++] = data[in++];
+            }
+
+            if ((code != 0xFF) && (in < length))
+            {
+                data[out++] = 0;
+            }
+        }
+    }
+
+    return out;
+}
+
+
+/** Build the frame type | sequence | payload | CRC and encode it into txFrame
+ */
+static void Ifx_Telemetry_sendFrame(Ifx_Telemetry *telemetry, Ifx_Telemetry_FrameType type, const uint8 *payload, Ifx_SizeT length)
+{
+    uint8  frame[IFX_CFG_TELEMETRY_FRAME_SIZE];
+    uint32 crc;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (length >= 0) && (length <= IFX_TELEMETRY_PAYLOAD_SIZE));
+
+    frame[0] = (uint8)type;
+    frame[1] = telemetry->sequence++;
+    memcpy(&frame[2], payload, (size_t)length);
+    length           += 2;
+    crc               = Ifx_Crc_tableFast(&telemetry->crc, frame, (uint32)length);
+    frame[length]     = (uint8)crc;
+    frame[length + 1] = (uint8)(crc >> 8);
+    length           += 2;
+
+    telemetry->txIndex = 0;
+    telemetry->txCount = Ifx_Telemetry_encode(frame, length, telemetry->txFrame);
+}
+
+
+/** Write the pending frame without waiting
+ * \return TRUE if the frame is completely written
+ */
+static boolean Ifx_Telemetry_flushFrame(Ifx_Telemetry *telemetry)
+{
+    if (telemetry->txCount != 0)
+    {
+        Ifx_SizeT count = telemetry->txCount;
+
+        IfxStdIf_DPipe_write(telemetry->io, &telemetry->txFrame[telemetry->txIndex], &count, TIME_NULL);
+        telemetry->txIndex += count;
+        telemetry->txCount -= count;
+    }
+
+    return telemetry->txCount == 0;
+}
+
+
+/** Execute a decoded host frame and prepare the answer
+ */
+static void Ifx_Telemetry_handleFrame(Ifx_Telemetry *telemetry, uint8 *frame, Ifx_SizeT length)
+{
+    uint32 crc;
+    uint8  ack[2];
+
+    if (length < IFX_TELEMETRY_FRAME_OVERHEAD)
+    {
+        return;
+    }
+
+    crc = Ifx_Crc_tableFast(&telemetry->crc, frame, (uint32)(length - 2));
+
+    if ((frame[length - 2] != (uint8)crc) || (frame[length - 1] != (uint8)(crc >> 8)))
+    {                           /* Corrupted frame, the host repeats it after a timeout */
+        return;
+    }
+
+    length -= IFX_TELEMETRY_FRAME_OVERHEAD;
+    ack[0]  = frame[0];
+    ack[1]  = Ifx_Telemetry_Status_ok;
+
+    switch (frame[0])
+    {
+    case Ifx_Telemetry_FrameType_subscribe:
+
+        if ((length == 3) && (frame[2] < telemetry->channelCount))
+        {
+            Ifx_Telemetry_Channel *channel = &telemetry->channels[frame[2]];
+            uint16                 divider = (uint16)(frame[3] | (frame[4] << 8));
+
+            /* Ifx_Telemetry_sample() ignores the counter while the divider is 0 */
+            channel->divider = 0;
+            channel->counter = 1;
+            channel->divider = divider;
+        }
+        else
+        {
+            ack[1] = Ifx_Telemetry_Status_invalidParameter;
+        }
+
+        break;
+    case Ifx_Telemetry_FrameType_list:
+        telemetry->listIndex = 0;
+        break;
+    case Ifx_Telemetry_FrameType_stop:
+    {
+        uint8 id;
+
+        for (id = 0; id < telemetry->channelCount; id++)
+        {
+            telemetry->channels[id].divider = 0;
+        }
+
+        /* The protocol is stopped once the acknowledge is transmitted */
+        telemetry->started = FALSE;
+    }
+    break;
+    default:
+        ack[1] = Ifx_Telemetry_Status_unknownCommand;
+        break;
+    }
+
+    Ifx_Telemetry_sendFrame(telemetry, Ifx_Telemetry_FrameType_ack, ack, 2);
+}
+
+
+/** Read the received bytes until a complete frame has been handled
+ * \return TRUE if a frame has been handled
+ */
+static boolean Ifx_Telemetry_receive(Ifx_Telemetry *telemetry)
+{
+    boolean   handled = FALSE;
+    uint8     data;
+    Ifx_SizeT count   = 1;
+
+    while ((handled == FALSE) && (IfxStdIf_DPipe_getReadCount(telemetry->io) > 0))
+    {
+        count = 1;
+        IfxStdIf_DPipe_read(telemetry->io, &data, &count, TIME_NULL);
+
+        if (count == 0)
+        {
+            break;
+        }
+
+        if (data == 0)
+        {
+            if ((telemetry->rxCount > 0) && (telemetry->rxCount <= (Ifx_SizeT)sizeof(telemetry->rxFrame)))
+            {
+                Ifx_SizeT length = Ifx_Telemetry_decode(telemetry->rxFrame, telemetry->rxCount);
+
+                if (length > 0)
+                {
+                    Ifx_Telemetry_handleFrame(telemetry, telemetry->rxFrame, length);
+                    handled = telemetry->txCount != 0;
+                }
+            }
+
+            telemetry->rxCount = 0;
+        }
+        else if (telemetry->rxCount < (Ifx_SizeT)sizeof(telemetry->rxFrame))
+        {
+            telemetry->rxFrame[telemetry->rxCount++] = data;
+        }
+        else
+        {                       /* Frame too long, dropped up to the next delimiter */
+            telemetry->rxCount = (Ifx_SizeT)sizeof(telemetry->rxFrame) + 1;
+        }
+    }
+
+    return handled;
+}
+
+
+/** Prepare the next channel description frame
+ * \return TRUE if a frame has been prepared
+ */
+static boolean Ifx_Telemetry_sendChannel(Ifx_Telemetry *telemetry)
+{
+    boolean result = telemetry->listIndex < telemetry->channelCount;
+
+    if (result != FALSE)
+    {
+        uint8                  payload[IFX_TELEMETRY_PAYLOAD_SIZE];
+        Ifx_Telemetry_Channel *channel = &telemetry->channels[telemetry->listIndex];
+        Ifx_SizeT              length  = (Ifx_SizeT)__min(strlen(channel->name), IFX_TELEMETRY_PAYLOAD_SIZE - 2);
+
+        payload[0] = telemetry->listIndex;
+        payload[1] = channel->size;
+        memcpy(&payload[2], channel->name, (size_t)length);
+        Ifx_Telemetry_sendFrame(telemetry, Ifx_Telemetry_FrameType_channel, payload, length + 2);
+        telemetry->listIndex++;
+    }
+
+    return result;
+}
+
+
+/** Prepare the data frame of the next sample record
+ * \return TRUE if a frame has been prepared
+ */
+static boolean Ifx_Telemetry_sendSamples(Ifx_Telemetry *telemetry)
+{
+    boolean result = Ifx_Fifo_isEmpty(telemetry->samples) == FALSE;
+
+    if (result != FALSE)
+    {
+        uint8     record[IFX_TELEMETRY_PAYLOAD_SIZE + 1];
+        Ifx_SizeT remaining;
+
+        /* Ifx_Telemetry_sample() writes each record with a single call, the record is complete */
+        Ifx_Fifo_read(telemetry->samples, record, 1, TIME_NULL);
+        remaining = Ifx_Fifo_read(telemetry->samples, &record[1], record[0] - 1, TIME_NULL);
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, remaining == 0);
+        Ifx_Telemetry_sendFrame(telemetry, Ifx_Telemetry_FrameType_data, &record[1], record[0] - 1 - remaining);
+    }
+
+    return result;
+}
+
+
+void Ifx_Telemetry_initConfig(Ifx_Telemetry_Config *config)
+{
+    config->shell            = NULL_PTR;
+    config->sampleBufferSize = 1024;
+    config->sampleBuffer     = NULL_PTR;
+}
+
+
+boolean Ifx_Telemetry_init(Ifx_Telemetry *telemetry, const Ifx_Telemetry_Config *config)
+{
+    boolean result = TRUE;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, config->sampleBufferSize > IFX_CFG_TELEMETRY_FRAME_SIZE);
+
+    telemetry->io           = NULL_PTR;
+    telemetry->shell        = config->shell;
+    telemetry->started      = FALSE;
+    telemetry->dropCount    = 0;
+    telemetry->channelCount = 0;
+    telemetry->listIndex    = 0;
+    telemetry->sequence     = 0;
+    telemetry->rxCount      = 0;
+    telemetry->txIndex      = 0;
+    telemetry->txCount      = 0;
+
+    if (config->sampleBuffer != NULL_PTR)
+    {
+        telemetry->samples = Ifx_Fifo_initSpsc(config->sampleBuffer, config->sampleBufferSize, 1);
+    }
+    else
+    {
+        telemetry->samples = Ifx_Fifo_createSpsc(config->sampleBufferSize, 1);
+    }
+
+    result &= telemetry->samples != NULL_PTR;
+
+    /* CRC-16/CCITT-FALSE */
+    result &= Ifx_Crc_createTable(&telemetry->crcTable.data, 16, 0x1021, 0);
+    result &= Ifx_Crc_init(&telemetry->crc, &telemetry->crcTable.data, 1, 0, 0xFFFF, 0);
+
+    return result;
+}
+
+
+sint32 Ifx_Telemetry_addChannel(Ifx_Telemetry *telemetry, pchar name, const volatile void *address, uint8 size)
+{
+    sint32 id = -1;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (size == 1) || (size == 2) || (size == 4));
+
+    if ((telemetry->channelCount < IFX_CFG_TELEMETRY_MAX_CHANNELS) && (telemetry->started == FALSE))
+    {
+        Ifx_Telemetry_Channel *channel = &telemetry->channels[telemetry->channelCount];
+
+        channel->name    = name;
+        channel->address = address;
+        channel->size    = size;
+        channel->divider      = 0;
+        channel->counter      = 0;
+        channel->startDivider = 0;
+        id                    = telemetry->channelCount++;
+    }
+
+    return id;
+}
+
+
+void Ifx_Telemetry_initProtocol(Ifx_Telemetry *telemetry, Ifx_Shell_Protocol *protocol)
+{
+    protocol->object  = telemetry;
+    protocol->start   = &Ifx_Telemetry_start;
+    protocol->execute = &Ifx_Telemetry_execute;
+}
+
+
+boolean Ifx_Telemetry_start(void *telemetry, IfxStdIf_DPipe *io)
+{
+    Ifx_Telemetry *tm = (Ifx_Telemetry *)telemetry;
+    uint8          id;
+
+    for (id = 0; id < tm->channelCount; id++)
+    {
+        tm->channels[id].counter = 1;
+        tm->channels[id].divider = tm->channels[id].startDivider;
+    }
+
+    tm->io        = io;
+    tm->rxCount   = 0;
+    tm->txIndex   = 0;
+    tm->txCount   = 0;
+    tm->listIndex = tm->channelCount;
+    tm->sequence  = 0;
+    tm->dropCount = 0;
+    Ifx_Fifo_clear(tm->samples);
+    tm->started   = TRUE;
+
+    return TRUE;
+}
+
+
+void Ifx_Telemetry_execute(void *telemetry)
+{
+    Ifx_Telemetry *tm    = (Ifx_Telemetry *)telemetry;
+    boolean        ready = Ifx_Telemetry_flushFrame(tm);
+
+    /* Host commands first, then channel descriptions, then the sampled values */
+    while (ready != FALSE)
+    {
+        if ((tm->started == FALSE)
+            || ((Ifx_Telemetry_receive(tm) == FALSE)
+                && (Ifx_Telemetry_sendChannel(tm) == FALSE)
+                && (Ifx_Telemetry_sendSamples(tm) == FALSE)))
+        {
+            break;
+        }
+
+        ready = Ifx_Telemetry_flushFrame(tm);
+    }
+
+    if ((tm->started == FALSE) && (tm->txCount == 0))
+    {
+        Ifx_Telemetry_stop(tm);
+    }
+}
+
+
+void Ifx_Telemetry_sample(Ifx_Telemetry *telemetry)
+{
+    uint8     record[IFX_TELEMETRY_PAYLOAD_SIZE + 1];
+    Ifx_SizeT length = IFX_TELEMETRY_RECORD_HEADER;
+    uint8     id;
+
+    if (telemetry->started == FALSE)
+    {
+        return;
+    }
+
+    for (id = 0; id < telemetry->channelCount; id++)
+    {
+        Ifx_Telemetry_Channel *channel = &telemetry->channels[id];
+        uint16                 divider = channel->divider;
+
+        if (divider != 0)
+        {
+            channel->counter--;
+
+            if (channel->counter == 0)
+            {
+                channel->counter = divider;
+
+                if ((length + 1 + channel->size) <= (Ifx_SizeT)sizeof(record))
+                {
+                    uint32 value;
+
+                    switch (channel->size)
+                    {
+                    case 1:
+                        value = *(const volatile uint8 *)channel->address;
+                        break;
+                    case 2:
+                        value = *(const volatile uint16 *)channel->address;
+                        break;
+                    default:
+                        value = *(const volatile uint32 *)channel->address;
+                        break;
+                    }
+
+                    record[length++] = id;
+                    record[length++] = (uint8)value;
+
+                    if (channel->size > 1)
+                    {
+                        record[length++] = (uint8)(value >> 8);
+                    }
+
+                    if (channel->size > 2)
+                    {
+                        record[length++] = (uint8)(value >> 16);
+                        record[length++] = (uint8)(value >> 24);
+                    }
+                }
+            }
+        }
+    }
+
+    if (length > IFX_TELEMETRY_RECORD_HEADER)
+    {
+        uint32 timestamp = nowFast32();
+
+        record[0] = (uint8)length;
+        record[1] = (uint8)timestamp;
+        record[2] = (uint8)(timestamp >> 8);
+        record[3] = (uint8)(timestamp >> 16);
+        record[4] = (uint8)(timestamp >> 24);
+
+        if (Ifx_Fifo_writeCount(telemetry->samples) >= length)
+        {
+            Ifx_Fifo_write(telemetry->samples, record, length, TIME_NULL);
+        }
+        else
+        {
+            telemetry->dropCount++;
+        }
+    }
+}
+
+
+boolean Ifx_Telemetry_setStartDivider(Ifx_Telemetry *telemetry, sint32 id, uint16 divider)
+{
+    boolean result = (id >= 0) && (id < telemetry->channelCount);
+
+    if (result != FALSE)
+    {
+        telemetry->channels[id].startDivider = divider;
+    }
+
+    return result;
+}
+
+
+void Ifx_Telemetry_stop(Ifx_Telemetry *telemetry)
+{
+    uint8 id;
+
+    for (id = 0; id < telemetry->channelCount; id++)
+    {
+        telemetry->channels[id].divider = 0;
+    }
+
+    telemetry->started   = FALSE;
+    telemetry->txCount   = 0;
+    telemetry->listIndex = telemetry->channelCount;
+
+    if (telemetry->shell != NULL_PTR)
+    {
+        telemetry->shell->protocol.started = FALSE;
+    }
+}
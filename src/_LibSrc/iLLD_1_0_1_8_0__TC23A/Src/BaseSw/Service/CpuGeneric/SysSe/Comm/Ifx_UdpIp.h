@@ -0,0 +1,220 @@
+/**
+ * \file Ifx_UdpIp.h
+ * \brief Minimal ARP / IPv4 / UDP stack on top of the ETH driver
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_comm_udpip UDP/IP
+ * \ingroup library_srvsw_sysse_comm
+ *
+ * The UDP/IP stack sends and receives UDP datagrams over the ETH module, e.g. to stream measurement data
+ * to a PC. It supports:
+ * - ARP: answers the requests for the own address, resolves the destination addresses with a small cache
+ * (\ref IFX_CFG_UDPIP_ARP_ENTRIES entries)
+ * - IPv4 without options on transmission, without fragmentation. Datagrams are limited to
+ * \ref IFX_UDPIP_MAX_PAYLOAD bytes
+ * - ICMP echo (ping)
+ * - UDP sockets bound to a local port
+ *
+ * The stack uses no dynamic memory. It builds on the zero-copy buffer pool of the ETH driver
+ * (\ref IfxLld_Eth_Std_BufferPool): received frames are processed in their receive buffer, ARP and ICMP
+ * replies are built in place and sent from the same buffer. Transmitted datagrams consist of a header buffer
+ * of the stack followed by the payload buffer of the caller, which is not copied.
+ *
+ * The IP header checksum and the UDP / ICMP checksums are computed by the checksum engine of the ETH module
+ * (\ref IfxEth_setupChecksumEngine()), the stack writes 0 in the checksum fields. Received frames with a
+ * wrong checksum are dropped by the ETH module.
+ *
+ * \ref Ifx_UdpIp_process() is called from the ETH interrupt or from a polling task. The socket handlers are
+ * called from it, the received data is only valid during the handler call.
+ *
+ * Usage example:
+ * \code
+ * static uint8             rxPoolMemory[24][IFXETH_RTX_BUFFER_SIZE];
+ * static uint8             txPoolMemory[16][IFXETH_RTX_BUFFER_SIZE];
+ * static IfxEth_BufferPool rxPool, txPool;
+ * static Ifx_UdpIp         udpIp;
+ * static Ifx_UdpIp_Socket  commandSocket = {5000, &onCommand, NULL_PTR};
+ *
+ * // initialisation, ethConfig.phyInit = &IfxEth_Phy_Pef7071_init
+ * IfxEth_init(&eth, &ethConfig);
+ * IfxEth_initBufferPool(&rxPool, rxPoolMemory, IFXETH_RTX_BUFFER_SIZE, 24);
+ * IfxEth_initBufferPool(&txPool, txPoolMemory, IFXETH_RTX_BUFFER_SIZE, 16);
+ * IfxEth_initReceiveDescriptorsWithPool(&eth, &rxPool);
+ *
+ * Ifx_UdpIp_Config config;
+ * Ifx_UdpIp_initConfig(&config);
+ * config.eth       = &eth;
+ * config.ipAddress = IFX_UDPIP_ADDRESS(192, 168, 0, 20);
+ * config.netmask   = IFX_UDPIP_ADDRESS(255, 255, 255, 0);
+ * Ifx_UdpIp_init(&udpIp, &config);
+ * Ifx_UdpIp_bind(&udpIp, &commandSocket);
+ * IfxEth_startTransmitter(&eth);
+ * IfxEth_startReceiver(&eth);
+ *
+ * // streaming, the buffer returns to txPool once sent
+ * uint8 *buffer = IfxEth_allocBuffer(&txPool);
+ * if (buffer != NULL_PTR)
+ * {
+ *     uint16 length = fillSamples(buffer, IFX_UDPIP_MAX_PAYLOAD);
+ *     if (Ifx_UdpIp_send(&udpIp, IFX_UDPIP_ADDRESS(192, 168, 0, 1), 6000, 6000, buffer, length, &txPool) == FALSE)
+ *     {
+ *         IfxEth_freeBuffer(&txPool, buffer);
+ *     }
+ * }
+ *
+ * // ETH interrupt or polling task
+ * Ifx_UdpIp_process(&udpIp);
+ *
+ * // 10 ms task, link management
+ * IfxEth_Phy_Pef7071_process(&eth);
+ * \endcode
+ *
+ */
+#ifndef IFX_UDPIP_H
+#define IFX_UDPIP_H 1
+
+#include "Eth/Std/IfxEth.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_UDPIP_ARP_ENTRIES)
+#define IFX_CFG_UDPIP_ARP_ENTRIES  (4)  /**<\brief Number of ARP cache entries */
+#endif
+
+#if !defined(IFX_CFG_UDPIP_MAX_SOCKETS)
+#define IFX_CFG_UDPIP_MAX_SOCKETS  (4)  /**<\brief Maximal number of bound sockets */
+#endif
+
+#define IFX_UDPIP_HEADER_SIZE      (42)                               /**<\brief Size of the ethernet, IPv4 and UDP headers in bytes */
+#define IFX_UDPIP_MAX_PAYLOAD      (1472)                             /**<\brief Maximal UDP payload in bytes (MTU 1500) */
+#define IFX_UDPIP_HEADER_WORDS     ((IFX_UDPIP_HEADER_SIZE + 3) / 4)  /**<\brief Size of a header buffer in words */
+
+/** \brief IPv4 address from its dotted decimal notation a.b.c.d */
+#define IFX_UDPIP_ADDRESS(a, b, c, d) (((uint32)(a) << 24) | ((uint32)(b) << 16) | ((uint32)(c) << 8) | (uint32)(d))
+
+/** \addtogroup library_srvsw_sysse_comm_udpip
+ * \{ */
+
+typedef struct Ifx_UdpIp_Socket_s Ifx_UdpIp_Socket;
+
+/** \brief Datagram handler
+ * \param socket Pointer to the socket
+ * \param address IPv4 address of the sender
+ * \param port UDP port of the sender
+ * \param data Pointer to the datagram payload, valid only during the call
+ * \param length Payload length in bytes
+ */
+typedef void (*Ifx_UdpIp_Handler)(Ifx_UdpIp_Socket *socket, uint32 address, uint16 port, const uint8 *data, uint16 length);
+
+/** \brief UDP socket */
+struct Ifx_UdpIp_Socket_s
+{
+    uint16            port;     /**<\brief local UDP port */
+    Ifx_UdpIp_Handler handler;  /**<\brief handler of the received datagrams */
+    void             *data;     /**<\brief handler data */
+};
+
+/** \brief ARP cache entry */
+typedef struct
+{
+    uint32 address;         /**<\brief IPv4 address, 0 if the entry is free */
+    uint8  macAddress[6];   /**<\brief MAC address */
+} Ifx_UdpIp_ArpEntry;
+
+/** \brief Stack configuration */
+typedef struct
+{
+    IfxEth *eth;        /**<\brief ETH driver, with receive descriptors initialised by IfxEth_initReceiveDescriptorsWithPool() */
+    uint32  ipAddress;  /**<\brief own IPv4 address */
+    uint32  netmask;    /**<\brief subnet mask */
+    uint32  gateway;    /**<\brief default gateway, 0 if none */
+} Ifx_UdpIp_Config;
+
+/** \brief Stack object */
+typedef struct
+{
+    IfxEth            *eth;                                                    /**<\brief ETH driver */
+    uint8              macAddress[6];                                          /**<\brief own MAC address */
+    uint32             ipAddress;                                              /**<\brief own IPv4 address */
+    uint32             netmask;                                                /**<\brief subnet mask */
+    uint32             gateway;                                                /**<\brief default gateway */
+    uint16             identification;                                         /**<\brief IPv4 identification of the next datagram */
+    Ifx_UdpIp_ArpEntry arpCache[IFX_CFG_UDPIP_ARP_ENTRIES];                    /**<\brief ARP cache */
+    uint8              arpNext;                                                /**<\brief next ARP cache entry to be replaced */
+    Ifx_UdpIp_Socket  *sockets[IFX_CFG_UDPIP_MAX_SOCKETS];                     /**<\brief bound sockets */
+    uint8              socketCount;                                            /**<\brief number of bound sockets */
+    IfxEth_BufferPool  headerPool;                                             /**<\brief pool of the header buffers */
+    uint32             headers[IFXETH_MAX_TX_BUFFERS][IFX_UDPIP_HEADER_WORDS]; /**<\brief header buffers, one per TX descriptor */
+    uint32             rxFrames;                                               /**<\brief number of received frames */
+    uint32             rxDropped;                                              /**<\brief number of received frames not addressed to a socket or not supported */
+    uint32             txFrames;                                               /**<\brief number of sent frames */
+    uint32             txFailed;                                               /**<\brief number of frames not sent because no TX descriptor or header buffer was free */
+    uint32             arpMisses;                                              /**<\brief number of datagrams not sent because the destination was not resolved */
+} Ifx_UdpIp;
+
+/** \brief Bind a socket to its local port
+ * \param stack Pointer to the stack object
+ * \param socket Pointer to the socket, must stay valid
+ * \return Returns FALSE if the port is already bound or no socket is free
+ */
+IFX_EXTERN boolean Ifx_UdpIp_bind(Ifx_UdpIp *stack, Ifx_UdpIp_Socket *socket);
+
+/** \brief Initialize the stack and enable the checksum engine of the ETH module
+ * \param stack Pointer to the stack object
+ * \param config Pointer to the configuration
+ * \return Returns FALSE if the ETH receive descriptors do not use a buffer pool
+ */
+IFX_EXTERN boolean Ifx_UdpIp_init(Ifx_UdpIp *stack, const Ifx_UdpIp_Config *config);
+
+/** \brief Initialize the configuration with default values
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_UdpIp_initConfig(Ifx_UdpIp_Config *config);
+
+/** \brief Process the received frames and reclaim the sent buffers
+ * \param stack Pointer to the stack object
+ * \return Returns the number of received frames
+ */
+IFX_EXTERN uint32 Ifx_UdpIp_process(Ifx_UdpIp *stack);
+
+/** \brief Resolve the MAC address of the next hop to an IPv4 address
+ *
+ * If the address is not in the ARP cache, an ARP request is sent. The cache is updated by
+ * \ref Ifx_UdpIp_process() when the reply is received.
+ * \param stack Pointer to the stack object
+ * \param address IPv4 address
+ * \return Returns TRUE if the MAC address is known
+ */
+IFX_EXTERN boolean Ifx_UdpIp_resolve(Ifx_UdpIp *stack, uint32 address);
+
+/** \brief Send a UDP datagram without copying the payload
+ * \param stack Pointer to the stack object
+ * \param address IPv4 address of the destination
+ * \param port UDP port of the destination
+ * \param sourcePort local UDP port
+ * \param data Pointer to the payload, read by the ETH DMA after the call
+ * \param length Payload length in bytes, up to \ref IFX_UDPIP_MAX_PAYLOAD
+ * \param pool Pool to which the payload buffer is returned once sent. If NULL_PTR, the payload shall stay
+ * unchanged until it is sent
+ * \return Returns TRUE if the datagram was queued. Else the payload buffer stays with the caller
+ */
+IFX_EXTERN boolean Ifx_UdpIp_send(Ifx_UdpIp *stack, uint32 address, uint16 port, uint16 sourcePort, void *data, uint16 length, IfxEth_BufferPool *pool);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
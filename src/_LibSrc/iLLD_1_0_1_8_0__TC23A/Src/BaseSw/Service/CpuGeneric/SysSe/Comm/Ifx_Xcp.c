@@ -0,0 +1,1048 @@
+/**
+ * \file Ifx_Xcp.c
+ * \brief XCP slave: measurement with task synchronous DAQ lists, memory upload and download
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include <string.h>
+
+#include "Ifx_Xcp.h"
+#include "_Utilities/Ifx_Assert.h"
+
+#define IFX_XCP_PID_RES                     (0xFFU)
+#define IFX_XCP_PID_ERR                     (0xFEU)
+
+/* Commands */
+#define IFX_XCP_CMD_CONNECT                 (0xFFU)
+#define IFX_XCP_CMD_DISCONNECT              (0xFEU)
+#define IFX_XCP_CMD_GET_STATUS              (0xFDU)
+#define IFX_XCP_CMD_SYNCH                   (0xFCU)
+#define IFX_XCP_CMD_SET_MTA                 (0xF6U)
+#define IFX_XCP_CMD_UPLOAD                  (0xF5U)
+#define IFX_XCP_CMD_SHORT_UPLOAD            (0xF4U)
+#define IFX_XCP_CMD_DOWNLOAD                (0xF0U)
+#define IFX_XCP_CMD_SHORT_DOWNLOAD          (0xEDU)
+#define IFX_XCP_CMD_CLEAR_DAQ_LIST          (0xE3U)
+#define IFX_XCP_CMD_SET_DAQ_PTR             (0xE2U)
+#define IFX_XCP_CMD_WRITE_DAQ               (0xE1U)
+#define IFX_XCP_CMD_SET_DAQ_LIST_MODE       (0xE0U)
+#define IFX_XCP_CMD_GET_DAQ_LIST_MODE       (0xDFU)
+#define IFX_XCP_CMD_START_STOP_DAQ_LIST     (0xDEU)
+#define IFX_XCP_CMD_START_STOP_SYNCH        (0xDDU)
+#define IFX_XCP_CMD_GET_DAQ_CLOCK           (0xDCU)
+#define IFX_XCP_CMD_GET_DAQ_PROCESSOR_INFO  (0xDAU)
+#define IFX_XCP_CMD_GET_DAQ_RESOLUTION_INFO (0xD9U)
+#define IFX_XCP_CMD_GET_DAQ_EVENT_INFO      (0xD7U)
+#define IFX_XCP_CMD_FREE_DAQ                (0xD6U)
+#define IFX_XCP_CMD_ALLOC_DAQ               (0xD5U)
+#define IFX_XCP_CMD_ALLOC_ODT               (0xD4U)
+#define IFX_XCP_CMD_ALLOC_ODT_ENTRY         (0xD3U)
+
+/* Error codes, IFX_XCP_OK is not sent */
+#define IFX_XCP_OK                          (0xFFU)
+#define IFX_XCP_ERR_CMD_SYNCH               (0x00U)
+#define IFX_XCP_ERR_DAQ_ACTIVE              (0x11U)
+#define IFX_XCP_ERR_CMD_UNKNOWN             (0x20U)
+#define IFX_XCP_ERR_CMD_SYNTAX              (0x21U)
+#define IFX_XCP_ERR_OUT_OF_RANGE            (0x22U)
+#define IFX_XCP_ERR_MODE_NOT_VALID          (0x27U)
+#define IFX_XCP_ERR_SEQUENCE                (0x29U)
+#define IFX_XCP_ERR_DAQ_CONFIG              (0x2AU)
+#define IFX_XCP_ERR_MEMORY_OVERFLOW         (0x30U)
+
+/* DAQ list mode bits */
+#define IFX_XCP_MODE_SELECTED               (0x01U)
+#define IFX_XCP_MODE_DIRECTION              (0x02U)
+#define IFX_XCP_MODE_TIMESTAMP              (0x10U)
+#define IFX_XCP_MODE_PID_OFF                (0x20U)
+#define IFX_XCP_MODE_RUNNING                (0x40U)
+
+#define IFX_XCP_RESOURCE                    (0x05U)  /**< CAL/PAG and DAQ */
+#define IFX_XCP_DAQ_PROPERTIES              (0x13U)  /**< dynamic configuration, prescaler, time stamp */
+#define IFX_XCP_TIMESTAMP_MODE              (0x04U)  /**< 4 bytes, unit 1 ns, not fixed */
+#define IFX_XCP_EVENT_PROPERTIES            (0x04U)  /**< DAQ direction */
+#define IFX_XCP_MAX_PID                     (0xFBU)  /**< last PID usable for a DTO */
+#define IFX_XCP_NO_POINTER                  (0xFFFFU)
+
+/** Little endian 16 bit read
+ */
+IFX_INLINE uint16 Ifx_Xcp_read16(const uint8 *data)
+{
+    return (uint16)(data[0] | ((uint16)data[1] << 8));
+}
+
+
+/** Little endian 32 bit read
+ */
+IFX_INLINE uint32 Ifx_Xcp_read32(const uint8 *data)
+{
+    return data[0] | ((uint32)data[1] << 8) | ((uint32)data[2] << 16) | ((uint32)data[3] << 24);
+}
+
+
+/** Little endian 16 bit write
+ */
+IFX_INLINE void Ifx_Xcp_write16(uint8 *data, uint16 value)
+{
+    data[0] = (uint8)value;
+    data[1] = (uint8)(value >> 8);
+}
+
+
+/** Little endian 32 bit write
+ */
+IFX_INLINE void Ifx_Xcp_write32(uint8 *data, uint32 value)
+{
+    data[0] = (uint8)value;
+    data[1] = (uint8)(value >> 8);
+    data[2] = (uint8)(value >> 16);
+    data[3] = (uint8)(value >> 24);
+}
+
+
+/** Copy a value into a DTO. Aligned 16 and 32 bit values are read with a single access, so that they are consistent
+ */
+IFX_INLINE uint8 *Ifx_Xcp_copy(uint8 *dst, const volatile uint8 *src, uint16 size)
+{
+    if ((size == 4) && (((uint32)src & 3U) == 0))
+    {
+        Ifx_Xcp_write32(dst, *(const volatile uint32 *)src);
+        dst = &dst[4];
+    }
+    else if ((size == 2) && (((uint32)src & 1U) == 0))
+    {
+        Ifx_Xcp_write16(dst, *(const volatile uint16 *)src);
+        dst = &dst[2];
+    }
+    else
+    {
+        while (size > 0)
+        {
+            *dst++ = *src++;
+            size--;
+        }
+    }
+
+    return dst;
+}
+
+
+/** Compile the copy lists of the event channels from the running DAQ lists.
+ * The event channels are disabled while the lists are built, the events are not sampled meanwhile.
+ * Returns FALSE if an ODT does not fit into a DTO, the event channels stay then disabled
+ */
+static boolean Ifx_Xcp_compile(Ifx_Xcp *xcp)
+{
+    uint16 daqCounts[IFX_CFG_XCP_MAX_EVENTS];
+    uint16 daqIndex  = 0;
+    uint16 dtoIndex  = 0;
+    uint16 copyIndex = 0;
+    uint16 event;
+    uint16 daq;
+
+    for (event = 0; event < xcp->eventCount; event++)
+    {
+        xcp->events[event].daqCount = 0;
+    }
+
+    for (event = 0; event < xcp->eventCount; event++)
+    {
+        uint16 firstDaq = daqIndex;
+
+        for (daq = 0; daq < xcp->daqCount; daq++)
+        {
+            Ifx_Xcp_Daq *daqList = &xcp->daqs[daq];
+            uint8        odt;
+
+            if (((daqList->mode & IFX_XCP_MODE_RUNNING) == 0) || (daqList->event != event))
+            {
+                continue;
+            }
+
+            daqList->firstDto = dtoIndex;
+            daqList->counter  = 1;
+
+            for (odt = 0; odt < daqList->odtCount; odt++)
+            {
+                const Ifx_Xcp_Odt *odtEntry = &xcp->odts[daqList->firstOdt + odt];
+                Ifx_Xcp_Dto       *dto      = &xcp->dtos[dtoIndex];
+                uint32             length;
+                uint16             entry;
+
+                dto->pid        = (uint8)(daqList->firstOdt + odt);
+                dto->timestamp  = ((odt == 0) && ((daqList->mode & IFX_XCP_MODE_TIMESTAMP) != 0)) ? TRUE : FALSE;
+                dto->firstEntry = copyIndex;
+                dto->entryCount = 0;
+                length          = (dto->timestamp != FALSE) ? (1 + IFX_XCP_TIMESTAMP_SIZE) : 1;
+
+                for (entry = odtEntry->firstEntry; entry < (odtEntry->firstEntry + odtEntry->entryCount); entry++)
+                {
+                    const Ifx_Xcp_Entry *odtEntryValue = &xcp->entries[entry];
+
+                    if (odtEntryValue->size == 0)
+                    {
+                        continue;
+                    }
+
+                    if ((dto->entryCount != 0)
+                        && ((xcp->copyList[copyIndex - 1].address + xcp->copyList[copyIndex - 1].size) == odtEntryValue->address))
+                    {
+                        /* adjacent to the previous entry: one copy */
+                        xcp->copyList[copyIndex - 1].size += odtEntryValue->size;
+                    }
+                    else
+                    {
+                        xcp->copyList[copyIndex] = *odtEntryValue;
+                        copyIndex++;
+                        dto->entryCount++;
+                    }
+
+                    length += odtEntryValue->size;
+                }
+
+                if (length > xcp->transport.maxDto)
+                {
+                    return FALSE;
+                }
+
+                dto->length = (uint16)length;
+                dtoIndex++;
+            }
+
+            xcp->eventDaqs[daqIndex] = daq;
+            daqIndex++;
+        }
+
+        xcp->events[event].firstDaq = firstDaq;
+        daqCounts[event]            = daqIndex - firstDaq;
+    }
+
+    for (event = 0; event < xcp->eventCount; event++)
+    {
+        xcp->events[event].daqCount = daqCounts[event];
+    }
+
+    xcp->daqRunning = (daqIndex != 0) ? TRUE : FALSE;
+
+    return TRUE;
+}
+
+
+/** Stop the DAQ lists which have all the bits of mask set in their mode
+ */
+static void Ifx_Xcp_stopDaqLists(Ifx_Xcp *xcp, uint8 mask)
+{
+    uint16 daq;
+
+    for (daq = 0; daq < xcp->daqCount; daq++)
+    {
+        if ((xcp->daqs[daq].mode & mask) == mask)
+        {
+            xcp->daqs[daq].mode &= (uint8) ~(IFX_XCP_MODE_RUNNING | IFX_XCP_MODE_SELECTED);
+        }
+    }
+
+    /* Less running lists always fit */
+    (void)Ifx_Xcp_compile(xcp);
+}
+
+
+/** Start the DAQ lists which have all the bits of mask set in their mode, rolled back if the lists do not fit into the DTOs
+ */
+static uint8 Ifx_Xcp_startDaqLists(Ifx_Xcp *xcp, uint8 mask)
+{
+    uint16 daq;
+
+    for (daq = 0; daq < xcp->daqCount; daq++)
+    {
+        if ((xcp->daqs[daq].mode & mask) == mask)
+        {
+            xcp->daqs[daq].mode |= IFX_XCP_MODE_RUNNING;
+        }
+    }
+
+    if (Ifx_Xcp_compile(xcp) == FALSE)
+    {
+        for (daq = 0; daq < xcp->daqCount; daq++)
+        {
+            if ((xcp->daqs[daq].mode & mask) == mask)
+            {
+                xcp->daqs[daq].mode &= (uint8) ~IFX_XCP_MODE_RUNNING;
+            }
+        }
+
+        (void)Ifx_Xcp_compile(xcp);
+        return IFX_XCP_ERR_DAQ_CONFIG;
+    }
+
+    for (daq = 0; daq < xcp->daqCount; daq++)
+    {
+        if ((xcp->daqs[daq].mode & mask) == mask)
+        {
+            xcp->daqs[daq].mode &= (uint8) ~IFX_XCP_MODE_SELECTED;
+        }
+    }
+
+    return IFX_XCP_OK;
+}
+
+
+/** Release all the DAQ lists
+ */
+static void Ifx_Xcp_freeDaq(Ifx_Xcp *xcp)
+{
+    xcp->daqCount     = 0;
+    xcp->odtCount     = 0;
+    xcp->entryCount   = 0;
+    xcp->entryPointer = IFX_XCP_NO_POINTER;
+    (void)Ifx_Xcp_compile(xcp);
+}
+
+
+/** Execute the memory access commands
+ */
+static uint8 Ifx_Xcp_executeMemory(Ifx_Xcp *xcp, const uint8 *data, uint16 length)
+{
+    uint8 *res   = xcp->cto;
+    uint8  count = data[1];
+
+    switch (data[0])
+    {
+    case IFX_XCP_CMD_SET_MTA:
+
+        if (length < 8)
+        {
+            return IFX_XCP_ERR_CMD_SYNTAX;
+        }
+
+        xcp->mta = Ifx_Xcp_read32(&data[4]);
+        break;
+
+    case IFX_XCP_CMD_SHORT_UPLOAD:
+    case IFX_XCP_CMD_UPLOAD:
+
+        if ((data[0] == IFX_XCP_CMD_SHORT_UPLOAD) && (length < 8))
+        {
+            return IFX_XCP_ERR_CMD_SYNTAX;
+        }
+
+        if ((count == 0) || (count > (xcp->transport.maxCto - 1)))
+        {
+            return IFX_XCP_ERR_OUT_OF_RANGE;
+        }
+
+        if (data[0] == IFX_XCP_CMD_SHORT_UPLOAD)
+        {
+            xcp->mta = Ifx_Xcp_read32(&data[4]);
+        }
+
+        memcpy(&res[1], (const void *)xcp->mta, count);
+        xcp->mta      += count;
+        xcp->ctoLength = (uint16)(1 + count);
+        break;
+
+    case IFX_XCP_CMD_DOWNLOAD:
+
+        if ((count == 0) || (count > (xcp->transport.maxCto - 2)))
+        {
+            return IFX_XCP_ERR_OUT_OF_RANGE;
+        }
+
+        if (length < (2 + count))
+        {
+            return IFX_XCP_ERR_CMD_SYNTAX;
+        }
+
+        memcpy((void *)xcp->mta, &data[2], count);
+        xcp->mta += count;
+        break;
+
+    case IFX_XCP_CMD_SHORT_DOWNLOAD:
+
+        if ((count == 0) || (count > (xcp->transport.maxCto - 8)))
+        {
+            return IFX_XCP_ERR_OUT_OF_RANGE;
+        }
+
+        if (length < (8 + count))
+        {
+            return IFX_XCP_ERR_CMD_SYNTAX;
+        }
+
+        xcp->mta = Ifx_Xcp_read32(&data[4]);
+        memcpy((void *)xcp->mta, &data[8], count);
+        xcp->mta += count;
+        break;
+
+    default:
+        return IFX_XCP_ERR_CMD_UNKNOWN;
+    }
+
+    return IFX_XCP_OK;
+}
+
+
+/** Execute the DAQ configuration commands
+ */
+static uint8 Ifx_Xcp_executeDaqConfig(Ifx_Xcp *xcp, const uint8 *data, uint16 length)
+{
+    uint16       daq     = (length >= 4) ? Ifx_Xcp_read16(&data[2]) : 0;
+    Ifx_Xcp_Daq *daqList = &xcp->daqs[(daq < xcp->daqCount) ? daq : 0];
+    uint16       index;
+
+    switch (data[0])
+    {
+    case IFX_XCP_CMD_FREE_DAQ:
+        Ifx_Xcp_freeDaq(xcp);
+        break;
+
+    case IFX_XCP_CMD_ALLOC_DAQ:
+
+        if (length < 4)
+        {
+            return IFX_XCP_ERR_CMD_SYNTAX;
+        }
+
+        if ((xcp->daqCount != 0) || (xcp->odtCount != 0))
+        {
+            return IFX_XCP_ERR_SEQUENCE;
+        }
+
+        if (daq > IFX_CFG_XCP_MAX_DAQ)
+        {
+            return IFX_XCP_ERR_MEMORY_OVERFLOW;
+        }
+
+        for (index = 0; index < daq; index++)
+        {
+            xcp->daqs[index].firstOdt  = 0;
+            xcp->daqs[index].odtCount  = 0;
+            xcp->daqs[index].mode      = 0;
+            xcp->daqs[index].event     = 0;
+            xcp->daqs[index].prescaler = 1;
+            xcp->daqs[index].priority  = 0;
+        }
+
+        xcp->daqCount = daq;
+        break;
+
+    case IFX_XCP_CMD_ALLOC_ODT:
+
+        if (length < 5)
+        {
+            return IFX_XCP_ERR_CMD_SYNTAX;
+        }
+
+        if (daq >= xcp->daqCount)
+        {
+            return IFX_XCP_ERR_OUT_OF_RANGE;
+        }
+
+        if ((xcp->entryCount != 0) || (daqList->odtCount != 0))
+        {
+            return IFX_XCP_ERR_SEQUENCE;
+        }
+
+        if (((xcp->odtCount + data[4]) > IFX_CFG_XCP_MAX_ODT) || ((xcp->odtCount + data[4]) > (IFX_XCP_MAX_PID + 1)))
+        {
+            return IFX_XCP_ERR_MEMORY_OVERFLOW;
+        }
+
+        for (index = xcp->odtCount; index < (xcp->odtCount + data[4]); index++)
+        {
+            xcp->odts[index].firstEntry = 0;
+            xcp->odts[index].entryCount = 0;
+        }
+
+        daqList->firstOdt = xcp->odtCount;
+        daqList->odtCount = data[4];
+        xcp->odtCount    += data[4];
+        break;
+
+    case IFX_XCP_CMD_ALLOC_ODT_ENTRY:
+
+        if (length < 6)
+        {
+            return IFX_XCP_ERR_CMD_SYNTAX;
+        }
+
+        if ((daq >= xcp->daqCount) || (data[4] >= daqList->odtCount))
+        {
+            return IFX_XCP_ERR_OUT_OF_RANGE;
+        }
+
+        {
+            Ifx_Xcp_Odt *odt = &xcp->odts[daqList->firstOdt + data[4]];
+
+            if (odt->entryCount != 0)
+            {
+                return IFX_XCP_ERR_SEQUENCE;
+            }
+
+            if ((xcp->entryCount + data[5]) > IFX_CFG_XCP_MAX_ODT_ENTRIES)
+            {
+                return IFX_XCP_ERR_MEMORY_OVERFLOW;
+            }
+
+            for (index = xcp->entryCount; index < (xcp->entryCount + data[5]); index++)
+            {
+                xcp->entries[index].address = NULL_PTR;
+                xcp->entries[index].size    = 0;
+            }
+
+            odt->firstEntry  = xcp->entryCount;
+            odt->entryCount  = data[5];
+            xcp->entryCount += data[5];
+        }
+        break;
+
+    case IFX_XCP_CMD_SET_DAQ_PTR:
+
+        if (length < 6)
+        {
+            return IFX_XCP_ERR_CMD_SYNTAX;
+        }
+
+        if ((daq >= xcp->daqCount) || (data[4] >= daqList->odtCount)
+            || (data[5] >= xcp->odts[daqList->firstOdt + data[4]].entryCount))
+        {
+            return IFX_XCP_ERR_OUT_OF_RANGE;
+        }
+
+        if ((daqList->mode & IFX_XCP_MODE_RUNNING) != 0)
+        {
+            return IFX_XCP_ERR_DAQ_ACTIVE;
+        }
+
+        {
+            const Ifx_Xcp_Odt *odt = &xcp->odts[daqList->firstOdt + data[4]];
+
+            xcp->daqPointer      = daq;
+            xcp->entryPointer    = odt->firstEntry + data[5];
+            xcp->entryPointerEnd = odt->firstEntry + odt->entryCount;
+        }
+        break;
+
+    case IFX_XCP_CMD_WRITE_DAQ:
+
+        if (length < 8)
+        {
+            return IFX_XCP_ERR_CMD_SYNTAX;
+        }
+
+        if (xcp->entryPointer == IFX_XCP_NO_POINTER)
+        {
+            return IFX_XCP_ERR_SEQUENCE;
+        }
+
+        if ((xcp->entryPointer >= xcp->entryPointerEnd) || (data[1] != 0xFF)
+            || (data[2] > (xcp->transport.maxDto - 1)))
+        {
+            return IFX_XCP_ERR_OUT_OF_RANGE;
+        }
+
+        if ((xcp->daqs[xcp->daqPointer].mode & IFX_XCP_MODE_RUNNING) != 0)
+        {
+            return IFX_XCP_ERR_DAQ_ACTIVE;
+        }
+
+        xcp->entries[xcp->entryPointer].address = (const volatile uint8 *)Ifx_Xcp_read32(&data[4]);
+        xcp->entries[xcp->entryPointer].size    = data[2];
+        xcp->entryPointer++;
+        break;
+
+    case IFX_XCP_CMD_CLEAR_DAQ_LIST:
+
+        if (length < 4)
+        {
+            return IFX_XCP_ERR_CMD_SYNTAX;
+        }
+
+        if (daq >= xcp->daqCount)
+        {
+            return IFX_XCP_ERR_OUT_OF_RANGE;
+        }
+
+        if ((daqList->mode & IFX_XCP_MODE_RUNNING) != 0)
+        {
+            daqList->mode &= (uint8) ~IFX_XCP_MODE_SELECTED;
+            daqList->mode &= (uint8) ~IFX_XCP_MODE_RUNNING;
+            (void)Ifx_Xcp_compile(xcp);
+        }
+
+        for (index = daqList->firstOdt; index < (daqList->firstOdt + daqList->odtCount); index++)
+        {
+            uint16 entry;
+
+            for (entry = xcp->odts[index].firstEntry; entry < (xcp->odts[index].firstEntry + xcp->odts[index].entryCount); entry++)
+            {
+                xcp->entries[entry].size = 0;
+            }
+        }
+
+        break;
+
+    case IFX_XCP_CMD_SET_DAQ_LIST_MODE:
+
+        if (length < 8)
+        {
+            return IFX_XCP_ERR_CMD_SYNTAX;
+        }
+
+        if ((daq >= xcp->daqCount) || (Ifx_Xcp_read16(&data[4]) >= xcp->eventCount))
+        {
+            return IFX_XCP_ERR_OUT_OF_RANGE;
+        }
+
+        if ((data[1] & (IFX_XCP_MODE_DIRECTION | IFX_XCP_MODE_PID_OFF)) != 0)
+        {
+            return IFX_XCP_ERR_MODE_NOT_VALID;
+        }
+
+        if ((daqList->mode & IFX_XCP_MODE_RUNNING) != 0)
+        {
+            return IFX_XCP_ERR_DAQ_ACTIVE;
+        }
+
+        daqList->mode      = (uint8)((daqList->mode & IFX_XCP_MODE_SELECTED) | (data[1] & IFX_XCP_MODE_TIMESTAMP));
+        daqList->event     = Ifx_Xcp_read16(&data[4]);
+        daqList->prescaler = (data[6] != 0) ? data[6] : 1;
+        daqList->priority  = data[7];
+        break;
+
+    case IFX_XCP_CMD_GET_DAQ_LIST_MODE:
+
+        if (length < 4)
+        {
+            return IFX_XCP_ERR_CMD_SYNTAX;
+        }
+
+        if (daq >= xcp->daqCount)
+        {
+            return IFX_XCP_ERR_OUT_OF_RANGE;
+        }
+
+        xcp->cto[1] = daqList->mode;
+        xcp->cto[2] = 0;
+        xcp->cto[3] = 0;
+        Ifx_Xcp_write16(&xcp->cto[4], daqList->event);
+        xcp->cto[6]    = daqList->prescaler;
+        xcp->cto[7]    = daqList->priority;
+        xcp->ctoLength = 8;
+        break;
+
+    default:
+        return IFX_XCP_ERR_CMD_UNKNOWN;
+    }
+
+    return IFX_XCP_OK;
+}
+
+
+/** Execute the DAQ control and information commands
+ */
+static uint8 Ifx_Xcp_executeDaqControl(Ifx_Xcp *xcp, const uint8 *data, uint16 length)
+{
+    uint8 *res    = xcp->cto;
+    uint8  result = IFX_XCP_OK;
+    uint16 daq    = (length >= 4) ? Ifx_Xcp_read16(&data[2]) : 0;
+
+    switch (data[0])
+    {
+    case IFX_XCP_CMD_START_STOP_DAQ_LIST:
+
+        if (length < 4)
+        {
+            return IFX_XCP_ERR_CMD_SYNTAX;
+        }
+
+        if (daq >= xcp->daqCount)
+        {
+            return IFX_XCP_ERR_OUT_OF_RANGE;
+        }
+
+        {
+            Ifx_Xcp_Daq *daqList = &xcp->daqs[daq];
+
+            switch (data[1])
+            {
+            case 0:
+                daqList->mode &= (uint8) ~IFX_XCP_MODE_RUNNING;
+                (void)Ifx_Xcp_compile(xcp);
+                break;
+            case 1:
+
+                if ((daqList->mode & IFX_XCP_MODE_RUNNING) == 0)
+                {
+                    daqList->mode |= IFX_XCP_MODE_RUNNING;
+
+                    if (Ifx_Xcp_compile(xcp) == FALSE)
+                    {
+                        daqList->mode &= (uint8) ~IFX_XCP_MODE_RUNNING;
+                        (void)Ifx_Xcp_compile(xcp);
+                        return IFX_XCP_ERR_DAQ_CONFIG;
+                    }
+                }
+
+                break;
+            case 2:
+                daqList->mode |= IFX_XCP_MODE_SELECTED;
+                break;
+            default:
+                return IFX_XCP_ERR_MODE_NOT_VALID;
+            }
+
+            res[1]         = (uint8)daqList->firstOdt;
+            xcp->ctoLength = 2;
+        }
+        break;
+
+    case IFX_XCP_CMD_START_STOP_SYNCH:
+
+        switch (data[1])
+        {
+        case 0:
+            Ifx_Xcp_stopDaqLists(xcp, 0);
+            break;
+        case 1:
+            result = Ifx_Xcp_startDaqLists(xcp, IFX_XCP_MODE_SELECTED);
+            break;
+        case 2:
+            Ifx_Xcp_stopDaqLists(xcp, IFX_XCP_MODE_SELECTED);
+            break;
+        default:
+            result = IFX_XCP_ERR_MODE_NOT_VALID;
+            break;
+        }
+
+        break;
+
+    case IFX_XCP_CMD_GET_DAQ_CLOCK:
+        res[1] = 0;
+        res[2] = 0;
+        res[3] = 0;
+        Ifx_Xcp_write32(&res[4], IfxStm_getLower(xcp->stm));
+        xcp->ctoLength = 8;
+        break;
+
+    case IFX_XCP_CMD_GET_DAQ_PROCESSOR_INFO:
+        res[1] = IFX_XCP_DAQ_PROPERTIES;
+        Ifx_Xcp_write16(&res[2], IFX_CFG_XCP_MAX_DAQ);
+        Ifx_Xcp_write16(&res[4], xcp->eventCount);
+        res[6]         = 0; /* MIN_DAQ */
+        res[7]         = 0; /* absolute ODT number */
+        xcp->ctoLength = 8;
+        break;
+
+    case IFX_XCP_CMD_GET_DAQ_RESOLUTION_INFO:
+        res[1] = 1;
+        res[2] = (uint8)__min(xcp->transport.maxDto - 1, 0xFF);
+        res[3] = 1;
+        res[4] = 0;
+        res[5] = IFX_XCP_TIMESTAMP_MODE;
+        Ifx_Xcp_write16(&res[6], xcp->timestampTicks);
+        xcp->ctoLength = 8;
+        break;
+
+    case IFX_XCP_CMD_GET_DAQ_EVENT_INFO:
+
+        if (length < 4)
+        {
+            return IFX_XCP_ERR_CMD_SYNTAX;
+        }
+
+        if (daq >= xcp->eventCount)
+        {
+            return IFX_XCP_ERR_OUT_OF_RANGE;
+        }
+
+        {
+            const Ifx_Xcp_EventConfig *config = &xcp->events[daq].config;
+
+            res[1]         = IFX_XCP_EVENT_PROPERTIES;
+            res[2]         = 0xFF;
+            res[3]         = (uint8)strlen(config->name);
+            res[4]         = config->cycle;
+            res[5]         = (uint8)config->unit;
+            res[6]         = config->priority;
+            xcp->ctoLength = 7;
+            xcp->mta       = (uint32)config->name;
+        }
+        break;
+
+    default:
+        result = IFX_XCP_ERR_CMD_UNKNOWN;
+        break;
+    }
+
+    return result;
+}
+
+
+void Ifx_Xcp_event(Ifx_Xcp *xcp, uint8 channel)
+{
+    Ifx_Xcp_Event *event    = &xcp->events[channel];
+    uint16         daqCount = event->daqCount;
+
+    if (daqCount != 0)
+    {
+        const uint16 *eventDaq   = &xcp->eventDaqs[event->firstDaq];
+        uint32        writeTotal = event->writeTotal;
+        uint32        timestamp  = IfxStm_getLower(xcp->stm);
+        uint16        index;
+
+        for (index = 0; index < daqCount; index++)
+        {
+            Ifx_Xcp_Daq *daqList = &xcp->daqs[eventDaq[index]];
+
+            daqList->counter--;
+
+            if (daqList->counter != 0)
+            {
+                continue;
+            }
+
+            daqList->counter = daqList->prescaler;
+
+            if ((IFX_CFG_XCP_QUEUE_DEPTH - (writeTotal - event->readTotal)) < daqList->odtCount)
+            {
+                /* all or none of the DTOs of a sample are sent */
+                event->overloadCount++;
+            }
+            else
+            {
+                const Ifx_Xcp_Dto *dto = &xcp->dtos[daqList->firstDto];
+                uint8              odt;
+
+                for (odt = 0; odt < daqList->odtCount; odt++)
+                {
+                    uint32               slot  = writeTotal & (IFX_CFG_XCP_QUEUE_DEPTH - 1);
+                    uint8               *dst   = &event->queue[slot][0];
+                    const Ifx_Xcp_Entry *entry = &xcp->copyList[dto->firstEntry];
+                    uint16               count;
+
+                    *dst++ = dto->pid;
+
+                    if (dto->timestamp != FALSE)
+                    {
+                        Ifx_Xcp_write32(dst, timestamp);
+                        dst = &dst[IFX_XCP_TIMESTAMP_SIZE];
+                    }
+
+                    for (count = dto->entryCount; count > 0; count--)
+                    {
+                        dst = Ifx_Xcp_copy(dst, entry->address, entry->size);
+                        entry++;
+                    }
+
+                    event->lengths[slot] = dto->length;
+                    writeTotal++;
+                    dto++;
+                }
+            }
+        }
+
+        __dsync();      /* The DTOs must be visible before they are published */
+        event->writeTotal = writeTotal;
+    }
+}
+
+
+boolean Ifx_Xcp_init(Ifx_Xcp *xcp, const Ifx_Xcp_Config *config)
+{
+    uint8   event;
+    float32 stmFrequency;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (IFX_CFG_XCP_QUEUE_DEPTH & (IFX_CFG_XCP_QUEUE_DEPTH - 1)) == 0);
+
+    if (config->eventCount > IFX_CFG_XCP_MAX_EVENTS)
+    {
+        return FALSE;
+    }
+
+    memset(xcp, 0, sizeof(Ifx_Xcp));
+    xcp->transport.maxCto = IFX_CFG_XCP_MAX_CTO;
+    xcp->transport.maxDto = IFX_CFG_XCP_MAX_DTO;
+    xcp->stm              = config->stm;
+    stmFrequency          = IfxStm_getFrequency(config->stm);
+    xcp->timestampTicks   = (uint16)((1.0e9F / stmFrequency) + 0.5F);
+    xcp->entryPointer     = IFX_XCP_NO_POINTER;
+    xcp->eventCount       = config->eventCount;
+
+    for (event = 0; event < config->eventCount; event++)
+    {
+        xcp->events[event].config = config->events[event];
+    }
+
+    return TRUE;
+}
+
+
+void Ifx_Xcp_initConfig(Ifx_Xcp_Config *config)
+{
+    config->events     = NULL_PTR;
+    config->eventCount = 0;
+    config->stm        = &MODULE_STM0;
+}
+
+
+void Ifx_Xcp_process(Ifx_Xcp *xcp)
+{
+    Ifx_Xcp_Transport *transport = &xcp->transport;
+    boolean            busy      = FALSE;
+    uint8              idleCount = 0;
+    uint8              event     = xcp->nextEvent;
+
+    if (transport->send == NULL_PTR)
+    {
+        return;
+    }
+
+    if (xcp->ctoLength != 0)
+    {
+        if (transport->send(transport->object, xcp->cto, xcp->ctoLength) != FALSE)
+        {
+            xcp->ctoLength = 0;
+        }
+        else
+        {
+            busy = TRUE;
+        }
+    }
+
+    /* one DTO per event channel in turn, until all the queues are empty */
+    while ((busy == FALSE) && (idleCount < xcp->eventCount))
+    {
+        Ifx_Xcp_Event *eventChannel = &xcp->events[event];
+        uint32         readTotal    = eventChannel->readTotal;
+
+        if (readTotal != eventChannel->writeTotal)
+        {
+            uint32 slot = readTotal & (IFX_CFG_XCP_QUEUE_DEPTH - 1);
+
+            if (transport->send(transport->object, eventChannel->queue[slot], eventChannel->lengths[slot]) == FALSE)
+            {
+                /* retried first by the next call */
+                break;
+            }
+
+            eventChannel->readTotal = readTotal + 1;
+            idleCount               = 0;
+        }
+        else
+        {
+            idleCount++;
+        }
+
+        event = ((event + 1) < xcp->eventCount) ? (event + 1) : 0;
+    }
+
+    xcp->nextEvent = event;
+
+    if (transport->flush != NULL_PTR)
+    {
+        transport->flush(transport->object);
+    }
+}
+
+
+void Ifx_Xcp_receive(Ifx_Xcp *xcp, const uint8 *data, uint16 length)
+{
+    uint8 result = IFX_XCP_OK;
+
+    if ((length == 0) || ((xcp->connected == FALSE) && (data[0] != IFX_XCP_CMD_CONNECT)))
+    {
+        /* commands are ignored until CONNECT */
+        return;
+    }
+
+    xcp->cto[0]    = IFX_XCP_PID_RES;
+    xcp->ctoLength = 1;
+
+    switch (data[0])
+    {
+    case IFX_XCP_CMD_CONNECT:
+        xcp->connected = TRUE;
+        xcp->cto[1]    = IFX_XCP_RESOURCE;
+        xcp->cto[2]    = 0; /* Intel byte order, byte granularity */
+        xcp->cto[3]    = (uint8)xcp->transport.maxCto;
+        Ifx_Xcp_write16(&xcp->cto[4], xcp->transport.maxDto);
+        xcp->cto[6]    = 1; /* protocol layer version */
+        xcp->cto[7]    = 1; /* transport layer version */
+        xcp->ctoLength = 8;
+        break;
+
+    case IFX_XCP_CMD_DISCONNECT:
+        Ifx_Xcp_stopDaqLists(xcp, 0);
+        xcp->connected = FALSE;
+        break;
+
+    case IFX_XCP_CMD_GET_STATUS:
+        xcp->cto[1] = (xcp->daqRunning != FALSE) ? IFX_XCP_MODE_RUNNING : 0;
+        xcp->cto[2] = 0;
+        xcp->cto[3] = 0;
+        Ifx_Xcp_write16(&xcp->cto[4], 0);
+        xcp->ctoLength = 6;
+        break;
+
+    case IFX_XCP_CMD_SYNCH:
+        result = IFX_XCP_ERR_CMD_SYNCH;
+        break;
+
+    case IFX_XCP_CMD_SET_MTA:
+    case IFX_XCP_CMD_UPLOAD:
+    case IFX_XCP_CMD_SHORT_UPLOAD:
+    case IFX_XCP_CMD_DOWNLOAD:
+    case IFX_XCP_CMD_SHORT_DOWNLOAD:
+        result = Ifx_Xcp_executeMemory(xcp, data, length);
+        break;
+
+    case IFX_XCP_CMD_FREE_DAQ:
+    case IFX_XCP_CMD_ALLOC_DAQ:
+    case IFX_XCP_CMD_ALLOC_ODT:
+    case IFX_XCP_CMD_ALLOC_ODT_ENTRY:
+    case IFX_XCP_CMD_SET_DAQ_PTR:
+    case IFX_XCP_CMD_WRITE_DAQ:
+    case IFX_XCP_CMD_CLEAR_DAQ_LIST:
+    case IFX_XCP_CMD_SET_DAQ_LIST_MODE:
+    case IFX_XCP_CMD_GET_DAQ_LIST_MODE:
+        result = Ifx_Xcp_executeDaqConfig(xcp, data, length);
+        break;
+
+    default:
+        result = Ifx_Xcp_executeDaqControl(xcp, data, length);
+        break;
+    }
+
+    if (result != IFX_XCP_OK)
+    {
+        xcp->cto[0]    = IFX_XCP_PID_ERR;
+        xcp->cto[1]    = result;
+        xcp->ctoLength = 2;
+    }
+}
+
+
+void Ifx_Xcp_setTransport(Ifx_Xcp *xcp, const Ifx_Xcp_Transport *transport)
+{
+    xcp->transport        = *transport;
+    xcp->transport.maxCto = __min(transport->maxCto, IFX_CFG_XCP_MAX_CTO);
+    xcp->transport.maxDto = __min(transport->maxDto, IFX_CFG_XCP_MAX_DTO);
+}
@@ -0,0 +1,104 @@
+/**
+ * \file Ifx_XcpCan.c
+ * \brief XCP on CAN transport layer
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include <string.h>
+
+#include "Ifx_XcpCan.h"
+
+/** Implementation of Ifx_Xcp_Transport::send
+ */
+static boolean Ifx_XcpCan_send(void *object, const uint8 *data, uint16 length)
+{
+    Ifx_XcpCan         *xcpCan = (Ifx_XcpCan *)object;
+    IfxMultican_Message msg;
+
+    IfxMultican_Message_init(&msg, xcpCan->txId, 0, 0, (IfxMultican_DataLengthCode)length);
+    memcpy(msg.data, data, length);
+
+    if (IfxMultican_Can_MsgObj_sendMessage(xcpCan->txMsgObj, &msg) != IfxMultican_Status_ok)
+    {
+        return FALSE;
+    }
+
+    xcpCan->txCount++;
+
+    return TRUE;
+}
+
+
+boolean Ifx_XcpCan_init(Ifx_XcpCan *xcpCan, const Ifx_XcpCan_Config *config)
+{
+    Ifx_Xcp_Transport transport;
+    Ifx_CAN_MO       *hwObj;
+
+    if ((config->xcp == NULL_PTR) || (config->rxMsgObj == NULL_PTR) || (config->txMsgObj == NULL_PTR))
+    {
+        return FALSE;
+    }
+
+    hwObj            = IfxMultican_MsgObj_getPointer(config->txMsgObj->node->mcan, config->txMsgObj->msgObjId);
+    xcpCan->xcp      = config->xcp;
+    xcpCan->rxMsgObj = config->rxMsgObj;
+    xcpCan->txMsgObj = config->txMsgObj;
+    xcpCan->txId     = IfxMultican_MsgObj_getMessageId(hwObj);
+    xcpCan->rxCount  = 0;
+    xcpCan->txCount  = 0;
+
+    transport.object = xcpCan;
+    transport.send   = &Ifx_XcpCan_send;
+    transport.flush  = NULL_PTR;
+    transport.maxCto = IFX_XCPCAN_MAX_PACKET;
+    transport.maxDto = IFX_XCPCAN_MAX_PACKET;
+    Ifx_Xcp_setTransport(config->xcp, &transport);
+
+    return TRUE;
+}
+
+
+void Ifx_XcpCan_initConfig(Ifx_XcpCan_Config *config)
+{
+    config->xcp      = NULL_PTR;
+    config->rxMsgObj = NULL_PTR;
+    config->txMsgObj = NULL_PTR;
+}
+
+
+void Ifx_XcpCan_process(Ifx_XcpCan *xcpCan)
+{
+    IfxMultican_Message msg;
+
+    while ((IfxMultican_Can_MsgObj_readMessage(xcpCan->rxMsgObj, &msg) & IfxMultican_Status_newData) != 0)
+    {
+        uint8  data[IFX_XCPCAN_MAX_PACKET];
+        uint16 length = __min((uint16)msg.lengthCode, IFX_XCPCAN_MAX_PACKET);
+
+        memcpy(data, msg.data, length);
+        xcpCan->rxCount++;
+        Ifx_Xcp_receive(xcpCan->xcp, data, length);
+
+        /* the response is sent before the next command is executed */
+        Ifx_Xcp_process(xcpCan->xcp);
+    }
+
+    Ifx_Xcp_process(xcpCan->xcp);
+}
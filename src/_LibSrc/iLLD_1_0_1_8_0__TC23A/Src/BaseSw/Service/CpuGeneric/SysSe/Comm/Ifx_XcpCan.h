@@ -0,0 +1,99 @@
+/**
+ * \file Ifx_XcpCan.h
+ * \brief XCP on CAN transport layer
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_comm_xcpcan XCP on CAN
+ * \ingroup library_srvsw_sysse_comm
+ *
+ * Transport layer of the \ref library_srvsw_sysse_comm_xcp over \ref IfxLld_Multican_Can, classic CAN:
+ * the commands (CRO) are received with one message object, the responses and the DTOs are sent with the ID of
+ * the transmit message object, without padding (MAX_DLC not required). The transmit message object may be a
+ * transmit FIFO, so that several DTOs are sent per \ref Ifx_XcpCan_process() call.
+ *
+ * Usage example:
+ * \code
+ * static IfxMultican_Can_MsgObj xcpRxMsgObj;   // receive, CRO ID e.g. 0x7E0
+ * static IfxMultican_Can_MsgObj xcpTxMsgObj;   // transmit, DTO ID e.g. 0x7E1, standard or FIFO message object
+ * static Ifx_XcpCan             xcpCan;
+ *
+ * // initialisation, after Ifx_Xcp_init() and IfxMultican_Can_MsgObj_init()
+ * Ifx_XcpCan_Config config;
+ * Ifx_XcpCan_initConfig(&config);
+ * config.xcp      = &xcp;
+ * config.rxMsgObj = &xcpRxMsgObj;
+ * config.txMsgObj = &xcpTxMsgObj;
+ * Ifx_XcpCan_init(&xcpCan, &config);
+ *
+ * // background loop or 1 ms task with the lowest priority of the event channels
+ * Ifx_XcpCan_process(&xcpCan);
+ * \endcode
+ *
+ */
+#ifndef IFX_XCPCAN_H
+#define IFX_XCPCAN_H 1
+
+#include "Ifx_Xcp.h"
+#include "Multican/Can/IfxMultican_Can.h"
+
+//----------------------------------------------------------------------------------------
+#define IFX_XCPCAN_MAX_PACKET (8)    /**<\brief Maximal size of a command, a response or a DTO on classic CAN */
+
+/** \addtogroup library_srvsw_sysse_comm_xcpcan
+ * \{ */
+
+/** \brief Configuration */
+typedef struct
+{
+    Ifx_Xcp                *xcp;       /**<\brief XCP slave object, initialised */
+    IfxMultican_Can_MsgObj *rxMsgObj;  /**<\brief Initialised receive message object of the commands */
+    IfxMultican_Can_MsgObj *txMsgObj;  /**<\brief Initialised transmit message object of the responses and DTOs, standard or FIFO */
+} Ifx_XcpCan_Config;
+
+/** \brief Transport layer object */
+typedef struct
+{
+    Ifx_Xcp                *xcp;       /**<\brief XCP slave object */
+    IfxMultican_Can_MsgObj *rxMsgObj;  /**<\brief Receive message object of the commands */
+    IfxMultican_Can_MsgObj *txMsgObj;  /**<\brief Transmit message object of the responses and DTOs */
+    uint32                  txId;      /**<\brief ID of the responses and DTOs */
+    uint32                  rxCount;   /**<\brief Number of received commands */
+    uint32                  txCount;   /**<\brief Number of sent packets */
+} Ifx_XcpCan;
+
+/** \brief Initialize the transport layer and set it to the XCP slave
+ * \param xcpCan Pointer to the transport layer object
+ * \param config Pointer to the configuration
+ * \return Returns FALSE if a message object is missing
+ */
+IFX_EXTERN boolean Ifx_XcpCan_init(Ifx_XcpCan *xcpCan, const Ifx_XcpCan_Config *config);
+
+/** \brief Initialize the configuration with default values
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_XcpCan_initConfig(Ifx_XcpCan_Config *config);
+
+/** \brief Execute the received commands, then send the response and the queued DTOs. Never waits
+ * \param xcpCan Pointer to the transport layer object
+ */
+IFX_EXTERN void Ifx_XcpCan_process(Ifx_XcpCan *xcpCan);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -0,0 +1,327 @@
+/**
+ * \file Ifx_DmaMonitor.c
+ * \brief DMA transaction statistics and bus load monitor
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_DmaMonitor.h"
+#include "SysSe/Comm/Ifx_Shell.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/** \brief Channel event flags, rising edges are counted */
+#define IFX_DMAMONITOR_FLAG_PATTERN          (1U << 0)
+#define IFX_DMAMONITOR_FLAG_WRAP_SOURCE      (1U << 1)
+#define IFX_DMAMONITOR_FLAG_WRAP_DESTINATION (1U << 2)
+#define IFX_DMAMONITOR_FLAG_REQUEST_LOST     (1U << 3)
+
+/** \brief Mask of SBCU_ECON.ERRCNT */
+#define IFX_DMAMONITOR_SPB_ERRCNT_MASK       (0x3FFFU)
+
+/** \brief Number of moves per transfer for each block mode (CHCFGR.BLKM) */
+static const uint8 Ifx_DmaMonitor_movesPerTransfer[8] = {1, 2, 4, 8, 16, 3, 5, 9};
+
+/** \brief Telemetry channel names of the move engine loads */
+static const pchar Ifx_DmaMonitor_loadNames[2] = {"dmaMe0Load", "dmaMe1Load"};
+
+static Ifx_DMA_BLK *Ifx_DmaMonitor_getBlock(Ifx_DMA *dma, uint32 moveEngine)
+{
+    return (moveEngine == 0) ? &dma->BLK0 : &dma->BLK1;
+}
+
+
+static void Ifx_DmaMonitor_clearChannel(Ifx_DmaMonitor_Channel *channel)
+{
+    channel->transfers             = 0;
+    channel->moves                 = 0;
+    channel->bytes                 = 0;
+    channel->activeSamples         = 0;
+    channel->patternEvents         = 0;
+    channel->wrapSourceEvents      = 0;
+    channel->wrapDestinationEvents = 0;
+    channel->requestLostEvents     = 0;
+    channel->movesAtUpdate         = 0;
+    channel->bytesAtUpdate         = 0;
+    channel->movesPerSecond        = 0.0F;
+    channel->bytesPerSecond        = 0.0F;
+}
+
+
+static void Ifx_DmaMonitor_sampleChannel(Ifx_DmaMonitor *monitor, Ifx_DmaMonitor_Channel *channel)
+{
+    Ifx_DMA_CH       *ch     = &monitor->dma->CH[channel->channelId];
+    Ifx_DMA_CH_CHCSR  chcsr;
+    Ifx_DMA_CH_CHCFGR chcfgr;
+    uint16            count;
+    uint32            transfers;
+    uint32            flags = 0;
+    uint32            rising;
+
+    chcsr.U  = ch->CHCSR.U;
+    chcfgr.U = ch->CHCFGR.U;
+    count    = (uint16)chcsr.B.TCOUNT;
+
+    /* TCOUNT counts down, a reload ends the previous transaction */
+    if (count <= channel->transferCount)
+    {
+        transfers = channel->transferCount - count;
+    }
+    else
+    {
+        transfers = channel->transferCount + (chcfgr.B.TREL - count);
+    }
+
+    channel->transferCount = count;
+    channel->transfers    += transfers;
+    channel->moves        += transfers * Ifx_DmaMonitor_movesPerTransfer[chcfgr.B.BLKM];
+    channel->bytes        += (transfers * Ifx_DmaMonitor_movesPerTransfer[chcfgr.B.BLKM]) << chcfgr.B.CHDW;
+
+    flags |= (chcsr.B.IPM != 0) ? IFX_DMAMONITOR_FLAG_PATTERN : 0;
+    flags |= (chcsr.B.WRPS != 0) ? IFX_DMAMONITOR_FLAG_WRAP_SOURCE : 0;
+    flags |= (chcsr.B.WRPD != 0) ? IFX_DMAMONITOR_FLAG_WRAP_DESTINATION : 0;
+    flags |= (monitor->dma->TSR[channel->channelId].B.TRL != 0) ? IFX_DMAMONITOR_FLAG_REQUEST_LOST : 0;
+    rising = flags & ~channel->flags;
+
+    channel->patternEvents         += (rising & IFX_DMAMONITOR_FLAG_PATTERN) != 0;
+    channel->wrapSourceEvents      += (rising & IFX_DMAMONITOR_FLAG_WRAP_SOURCE) != 0;
+    channel->wrapDestinationEvents += (rising & IFX_DMAMONITOR_FLAG_WRAP_DESTINATION) != 0;
+    channel->requestLostEvents     += (rising & IFX_DMAMONITOR_FLAG_REQUEST_LOST) != 0;
+    channel->flags                  = flags;
+}
+
+
+static void Ifx_DmaMonitor_sampleMoveEngine(Ifx_DmaMonitor *monitor, uint32 index)
+{
+    Ifx_DMA_BLK               *block      = Ifx_DmaMonitor_getBlock(monitor->dma, index);
+    Ifx_DmaMonitor_MoveEngine *moveEngine = &monitor->moveEngines[index];
+    Ifx_DMA_BLK_ME_SR          sr;
+    Ifx_DMA_BLK_ERRSR          errsr;
+    Ifx_DMA_BLK_ERRSR          rising;
+    uint32                     i;
+
+    sr.U    = block->ME.SR.U;
+    errsr.U = block->ERRSR.U;
+
+    if ((sr.B.RS != 0) || (sr.B.WS != 0))
+    {
+        moveEngine->busySamples++;
+
+        for (i = 0; i < monitor->channelCount; i++)
+        {
+            if (monitor->channels[i].channelId == (IfxDma_ChannelId)sr.B.CH)
+            {
+                monitor->channels[i].activeSamples++;
+            }
+        }
+    }
+
+    rising.U                       = errsr.U & ~moveEngine->errorFlags;
+    moveEngine->sourceErrors      += rising.B.SER;
+    moveEngine->destinationErrors += rising.B.DER;
+    moveEngine->spbErrors         += rising.B.SPBER;
+    moveEngine->sriErrors         += rising.B.SRIER;
+    moveEngine->ramErrors         += rising.B.RAMER;
+    moveEngine->linkedListErrors  += rising.B.SLLER + rising.B.DLLER;
+    moveEngine->errorFlags         = errsr.U;
+
+    if (rising.U != 0)
+    {
+        moveEngine->lastErrorChannel = (uint8)errsr.B.LEC;
+    }
+}
+
+
+sint32 Ifx_DmaMonitor_addChannel(Ifx_DmaMonitor *monitor, pchar name, IfxDma_ChannelId channelId)
+{
+    sint32 id = -1;
+
+    if (monitor->channelCount < IFX_CFG_DMAMONITOR_MAX_CHANNELS)
+    {
+        Ifx_DmaMonitor_Channel *channel = &monitor->channels[monitor->channelCount];
+
+        channel->name          = name;
+        channel->channelId     = channelId;
+        channel->transferCount = (uint16)monitor->dma->CH[channelId].CHCSR.B.TCOUNT;
+        channel->flags         = 0;
+        Ifx_DmaMonitor_clearChannel(channel);
+        id                     = monitor->channelCount;
+        monitor->channelCount++;
+    }
+
+    return id;
+}
+
+
+void Ifx_DmaMonitor_addTelemetryChannels(Ifx_DmaMonitor *monitor, Ifx_Telemetry *telemetry)
+{
+    uint32 i;
+
+    for (i = 0; i < IFX_DMAMONITOR_NUM_MOVE_ENGINES; i++)
+    {
+        Ifx_Telemetry_addChannel(telemetry, Ifx_DmaMonitor_loadNames[i], &monitor->moveEngines[i].load, sizeof(float32));
+    }
+
+    for (i = 0; i < monitor->channelCount; i++)
+    {
+        Ifx_Telemetry_addChannel(telemetry, monitor->channels[i].name, &monitor->channels[i].bytesPerSecond, sizeof(float32));
+    }
+
+    Ifx_Telemetry_addChannel(telemetry, "spbBusErrors", &monitor->spbBusErrors, sizeof(uint32));
+}
+
+
+void Ifx_DmaMonitor_init(Ifx_DmaMonitor *monitor, Ifx_DMA *dma)
+{
+    monitor->dma          = dma;
+    monitor->channelCount = 0;
+    Ifx_DmaMonitor_reset(monitor);
+}
+
+
+void Ifx_DmaMonitor_reset(Ifx_DmaMonitor *monitor)
+{
+    boolean interruptState = IfxCpu_disableInterrupts();
+    uint32  i;
+
+    for (i = 0; i < monitor->channelCount; i++)
+    {
+        Ifx_DmaMonitor_clearChannel(&monitor->channels[i]);
+    }
+
+    for (i = 0; i < IFX_DMAMONITOR_NUM_MOVE_ENGINES; i++)
+    {
+        Ifx_DmaMonitor_MoveEngine *moveEngine = &monitor->moveEngines[i];
+
+        moveEngine->errorFlags          = Ifx_DmaMonitor_getBlock(monitor->dma, i)->ERRSR.U;
+        moveEngine->busySamples         = 0;
+        moveEngine->busySamplesAtUpdate = 0;
+        moveEngine->sourceErrors        = 0;
+        moveEngine->destinationErrors   = 0;
+        moveEngine->spbErrors           = 0;
+        moveEngine->sriErrors           = 0;
+        moveEngine->ramErrors           = 0;
+        moveEngine->linkedListErrors    = 0;
+        moveEngine->lastErrorChannel    = 0;
+        moveEngine->load                = 0.0F;
+    }
+
+    monitor->samples         = 0;
+    monitor->samplesAtUpdate = 0;
+    monitor->spbErrorCount   = (uint16)MODULE_SBCU0.ECON.B.ERRCNT;
+    monitor->spbBusErrors    = 0;
+    monitor->updateTime      = now();
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+
+void Ifx_DmaMonitor_sample(Ifx_DmaMonitor *monitor)
+{
+    uint16 spbErrorCount = (uint16)MODULE_SBCU0.ECON.B.ERRCNT;
+    uint32 i;
+
+    monitor->samples++;
+
+    for (i = 0; i < IFX_DMAMONITOR_NUM_MOVE_ENGINES; i++)
+    {
+        Ifx_DmaMonitor_sampleMoveEngine(monitor, i);
+    }
+
+    for (i = 0; i < monitor->channelCount; i++)
+    {
+        Ifx_DmaMonitor_sampleChannel(monitor, &monitor->channels[i]);
+    }
+
+    monitor->spbBusErrors += (spbErrorCount - monitor->spbErrorCount) & IFX_DMAMONITOR_SPB_ERRCNT_MASK;
+    monitor->spbErrorCount = spbErrorCount;
+}
+
+
+boolean Ifx_DmaMonitor_show(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    Ifx_DmaMonitor *monitor = (Ifx_DmaMonitor *)data;
+    uint32          i;
+
+    IfxStdIf_DPipe_print(io, "%u samples, %u SPB bus errors"ENDL, monitor->samples, monitor->spbBusErrors);
+    IfxStdIf_DPipe_print(io, "%-4s %6s %6s %6s %6s %6s %6s %6s %4s"ENDL, "ME", "load%", "src", "dst", "spb", "sri", "ram", "list", "lec");
+
+    for (i = 0; i < IFX_DMAMONITOR_NUM_MOVE_ENGINES; i++)
+    {
+        Ifx_DmaMonitor_MoveEngine *moveEngine = &monitor->moveEngines[i];
+
+        IfxStdIf_DPipe_print(io, "%-4u %6.1f %6u %6u %6u %6u %6u %6u %4u"ENDL, i, moveEngine->load * 100.0F,
+            moveEngine->sourceErrors, moveEngine->destinationErrors, moveEngine->spbErrors, moveEngine->sriErrors,
+            moveEngine->ramErrors, moveEngine->linkedListErrors, moveEngine->lastErrorChannel);
+    }
+
+    IfxStdIf_DPipe_print(io, "%-16s %4s %10s %10s %12s %12s %8s %6s %6s %6s %6s"ENDL,
+        "name", "ch", "transfers", "moves", "moves/s", "bytes/s", "active", "patt", "wrapS", "wrapD", "lost");
+
+    for (i = 0; i < monitor->channelCount; i++)
+    {
+        Ifx_DmaMonitor_Channel *channel = &monitor->channels[i];
+
+        IfxStdIf_DPipe_print(io, "%-16s %4u %10u %10u %12.0f %12.0f %8u %6u %6u %6u %6u"ENDL,
+            channel->name, channel->channelId, channel->transfers, channel->moves,
+            channel->movesPerSecond, channel->bytesPerSecond, channel->activeSamples,
+            channel->patternEvents, channel->wrapSourceEvents, channel->wrapDestinationEvents, channel->requestLostEvents);
+    }
+
+    if (Ifx_Shell_matchToken(&args, "reset") != FALSE)
+    {
+        Ifx_DmaMonitor_reset(monitor);
+    }
+
+    return TRUE;
+}
+
+
+void Ifx_DmaMonitor_update(Ifx_DmaMonitor *monitor)
+{
+    Ifx_TickTime time    = now();
+    float32      seconds = (float32)(time - monitor->updateTime) / (float32)TimeConst_1s;
+    uint32       samples = monitor->samples;
+    uint32       i;
+
+    if ((seconds > 0.0F) && (samples != monitor->samplesAtUpdate))
+    {
+        for (i = 0; i < IFX_DMAMONITOR_NUM_MOVE_ENGINES; i++)
+        {
+            Ifx_DmaMonitor_MoveEngine *moveEngine  = &monitor->moveEngines[i];
+            uint32                     busySamples = moveEngine->busySamples;
+
+            moveEngine->load                = (float32)(busySamples - moveEngine->busySamplesAtUpdate) / (float32)(samples - monitor->samplesAtUpdate);
+            moveEngine->busySamplesAtUpdate = busySamples;
+        }
+
+        for (i = 0; i < monitor->channelCount; i++)
+        {
+            Ifx_DmaMonitor_Channel *channel = &monitor->channels[i];
+            uint32                  moves   = channel->moves;
+            uint32                  bytes   = channel->bytes;
+
+            channel->movesPerSecond = (float32)(moves - channel->movesAtUpdate) / seconds;
+            channel->bytesPerSecond = (float32)(bytes - channel->bytesAtUpdate) / seconds;
+            channel->movesAtUpdate  = moves;
+            channel->bytesAtUpdate  = bytes;
+        }
+
+        monitor->samplesAtUpdate = samples;
+        monitor->updateTime      = time;
+    }
+}
@@ -0,0 +1,336 @@
+/**
+ * \file Ifx_FlashUpdate.c
+ * \brief Background program flash update
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_FlashUpdate.h"
+#include "IfxFlash_bf.h"
+#include "Cpu/Std/IfxCpu.h"
+#include "Scu/Std/IfxScuWdt.h"
+#include <string.h>
+
+#define IFX_FLASHUPDATE_BANK_SIZE  (IFXFLASH_PFLASH_SIZE / IFXFLASH_PFLASH_BANKS)
+#define IFX_FLASHUPDATE_FSR_ERRORS ((1u << IFX_FLASH_FSR_OPER_OFF) | (1u << IFX_FLASH_FSR_SQER_OFF) | (1u << IFX_FLASH_FSR_PROER_OFF) \
+                                    | (1u << IFX_FLASH_FSR_PVER_OFF) | (1u << IFX_FLASH_FSR_EVER_OFF))
+
+/** Returns FALSE and clears the status if the last flash command failed
+ */
+static boolean Ifx_FlashUpdate_checkStatus(void)
+{
+    boolean result = (FLASH0_FSR.U & IFX_FLASHUPDATE_FSR_ERRORS) == 0;
+
+    if (result == FALSE)
+    {
+        IfxFlash_clearStatus(0);
+    }
+
+    return result;
+}
+
+
+/** Erase a logical sector. Executed from the PSPR, waits for the end of the erase if requested
+ */
+IFX_CFG_FLASHUPDATE_CODE static void Ifx_FlashUpdate_eraseSector(uint32 sectorAddress, IfxFlash_FlashType flashType, boolean wait)
+{
+    uint16 password = IfxScuWdt_getSafetyWatchdogPasswordInline();
+
+    IfxScuWdt_clearSafetyEndinitInline(password);
+    IfxFlash_eraseSector(sectorAddress);
+    IfxScuWdt_setSafetyEndinitInline(password);
+
+    if (wait != FALSE)
+    {
+        IfxFlash_waitUnbusy(0, flashType);
+    }
+}
+
+
+/** Returns the bank of a PFlash address (segment 0x8 or 0xA), IFXFLASH_PFLASH_BANKS if the address is not in the PFlash
+ */
+static uint32 Ifx_FlashUpdate_getBank(uint32 address)
+{
+    uint32 segment = address >> 28;
+    uint32 offset  = (address & 0x0FFFFFFFu) - (IFXFLASH_PFLASH_START & 0x0FFFFFFFu);
+    uint32 bank    = IFXFLASH_PFLASH_BANKS;
+
+    if (((segment == 0x8u) || (segment == 0xAu)) && (offset < IFXFLASH_PFLASH_SIZE))
+    {
+        bank = offset / IFX_FLASHUPDATE_BANK_SIZE;
+    }
+
+    return bank;
+}
+
+
+/** Returns the logical sector containing the address, NULL_PTR if none
+ */
+static const IfxFlash_flashSector *Ifx_FlashUpdate_getSector(uint32 address)
+{
+    const IfxFlash_flashSector *result = NULL_PTR;
+    uint32                      i;
+
+    for (i = 0; i < IFXFLASH_PFLASH_NUM_LOG_SECTORS; i++)
+    {
+        if ((address >= IfxFlash_pFlashTableLog[i].start) && (address <= IfxFlash_pFlashTableLog[i].end))
+        {
+            result = &IfxFlash_pFlashTableLog[i];
+            break;
+        }
+    }
+
+    return result;
+}
+
+
+static boolean Ifx_FlashUpdate_isFlashBusy(const Ifx_FlashUpdate *update)
+{
+    return (FLASH0_FSR.U & (1u << update->flashType)) != 0;
+}
+
+
+/** Program a burst of 8 pages. Executed from the PSPR, waits for the end of the program if requested
+ */
+IFX_CFG_FLASHUPDATE_CODE static void Ifx_FlashUpdate_programBurst(uint32 address, const uint32 *data, IfxFlash_FlashType flashType, boolean wait)
+{
+    uint16 password = IfxScuWdt_getSafetyWatchdogPasswordInline();
+    uint32 i;
+
+    IfxFlash_enterPageMode(address);
+    IfxFlash_waitUnbusy(0, flashType);  /* short, only the assembly buffer is cleared */
+
+    for (i = 0; i < (IFXFLASH_PFLASH_BURST_LENGTH / 4); i += 2)
+    {
+        IfxFlash_loadPage2X32(address, data[i], data[i + 1]);
+    }
+
+    IfxScuWdt_clearSafetyEndinitInline(password);
+    IfxFlash_writeBurst(address);
+    IfxScuWdt_setSafetyEndinitInline(password);
+
+    if (wait != FALSE)
+    {
+        IfxFlash_waitUnbusy(0, flashType);
+    }
+}
+
+
+/** Compare the programmed burst with the burst buffer
+ */
+static boolean Ifx_FlashUpdate_verifyBurst(const Ifx_FlashUpdate *update)
+{
+    const volatile uint32 *flash  = (const volatile uint32 *)update->programAddress;
+    const uint32          *buffer = update->buffer[update->bufferHead];
+    boolean                result = TRUE;
+    uint32                 i;
+
+    for (i = 0; i < (IFXFLASH_PFLASH_BURST_LENGTH / 4); i++)
+    {
+        if (flash[i] != buffer[i])
+        {
+            result = FALSE;
+            break;
+        }
+    }
+
+    return result;
+}
+
+
+void Ifx_FlashUpdate_finish(Ifx_FlashUpdate *update)
+{
+    if (update->bufferFill != 0)
+    {
+        uint8 *burst = (uint8 *)update->buffer[(update->bufferHead + update->bufferCount) % IFX_CFG_FLASHUPDATE_BURST_COUNT];
+
+        memset(&burst[update->bufferFill], 0, IFXFLASH_PFLASH_BURST_LENGTH - update->bufferFill);
+        update->bufferCount++;
+        update->bufferFill = 0;
+    }
+
+    update->lastChunk = TRUE;
+}
+
+
+void Ifx_FlashUpdate_process(Ifx_FlashUpdate *update)
+{
+    boolean interruptState;
+
+    if (update->commandIssued != FALSE)
+    {
+        if (Ifx_FlashUpdate_isFlashBusy(update) != FALSE)
+        {
+            return;
+        }
+
+        update->commandIssued = FALSE;
+
+        if (Ifx_FlashUpdate_checkStatus() == FALSE)
+        {
+            update->errorCount++;
+            update->state = Ifx_FlashUpdate_State_failed;
+            return;
+        }
+
+        if (update->state == Ifx_FlashUpdate_State_program)
+        {
+            if (Ifx_FlashUpdate_verifyBurst(update) == FALSE)
+            {
+                update->state = Ifx_FlashUpdate_State_failed;
+                return;
+            }
+
+            update->programAddress += IFXFLASH_PFLASH_BURST_LENGTH;
+            update->bufferHead      = (update->bufferHead + 1) % IFX_CFG_FLASHUPDATE_BURST_COUNT;
+            update->bufferCount--;
+        }
+    }
+
+    switch (update->state)
+    {
+    case Ifx_FlashUpdate_State_erase:
+
+        if (update->eraseAddress >= (update->config.startAddress + update->config.size))
+        {
+            update->state = Ifx_FlashUpdate_State_program;
+        }
+        else
+        {
+            const IfxFlash_flashSector *sector = Ifx_FlashUpdate_getSector(update->eraseAddress);
+
+            /* The interrupts are disabled during the command sequence, and until the end of the erase
+             * if the interrupt handlers are in the same bank */
+            interruptState = IfxCpu_disableInterrupts();
+            Ifx_FlashUpdate_eraseSector(sector->start, update->flashType, update->sameBank);
+            IfxCpu_restoreInterrupts(interruptState);
+
+            update->eraseAddress  = sector->end + 1;
+            update->commandIssued = TRUE;
+        }
+
+        break;
+
+    case Ifx_FlashUpdate_State_program:
+
+        if (update->bufferCount != 0)
+        {
+            interruptState = IfxCpu_disableInterrupts();
+            Ifx_FlashUpdate_programBurst(update->programAddress, update->buffer[update->bufferHead], update->flashType, update->sameBank);
+            IfxCpu_restoreInterrupts(interruptState);
+
+            update->commandIssued = TRUE;
+        }
+        else if ((update->lastChunk != FALSE) && (update->bufferFill == 0))
+        {
+            update->state = Ifx_FlashUpdate_State_finished;
+        }
+
+        break;
+
+    default:
+        break;
+    }
+}
+
+
+boolean Ifx_FlashUpdate_start(Ifx_FlashUpdate *update, const Ifx_FlashUpdate_Config *config)
+{
+    uint32                      lastAddress = config->startAddress + config->size - 1;
+    uint32                      codeAddress = (uint32)&Ifx_FlashUpdate_process;
+    uint32                      bank        = Ifx_FlashUpdate_getBank(config->startAddress);
+    const IfxFlash_flashSector *sector      = Ifx_FlashUpdate_getSector(config->startAddress);
+
+    if ((update->state != Ifx_FlashUpdate_State_idle) && (update->commandIssued != FALSE))
+    {
+        return FALSE;   /* the previous command is still running */
+    }
+
+    if ((config->size == 0) || (sector == NULL_PTR) || (sector->start != config->startAddress)
+        || (Ifx_FlashUpdate_getSector(lastAddress) == NULL_PTR) || (Ifx_FlashUpdate_getBank(lastAddress) != bank))
+    {
+        return FALSE;   /* not a PFlash area of one bank starting at a logical sector */
+    }
+
+    codeAddress = (codeAddress & 0x0FFFFFFFu) | 0xA0000000u;
+
+    if ((codeAddress >= config->startAddress) && (codeAddress <= lastAddress))
+    {
+        return FALSE;   /* the update would erase this service */
+    }
+
+    update->config         = *config;
+    update->flashType      = (IfxFlash_FlashType)(IfxFlash_FlashType_P0 + bank);
+    update->sameBank       = Ifx_FlashUpdate_getBank((uint32)&Ifx_FlashUpdate_process) == bank;
+    update->commandIssued  = FALSE;
+    update->lastChunk      = FALSE;
+    update->eraseAddress   = config->startAddress;
+    update->programAddress = config->startAddress;
+    update->receivedSize   = 0;
+    update->bufferHead     = 0;
+    update->bufferCount    = 0;
+    update->bufferFill     = 0;
+    update->errorCount     = 0;
+    update->state          = Ifx_FlashUpdate_State_erase;
+
+    return TRUE;
+}
+
+
+uint32 Ifx_FlashUpdate_write(Ifx_FlashUpdate *update, const void *data, uint32 length)
+{
+    const uint8 *source   = (const uint8 *)data;
+    uint32       accepted = 0;
+
+    if (((update->state != Ifx_FlashUpdate_State_erase) && (update->state != Ifx_FlashUpdate_State_program))
+        || (update->lastChunk != FALSE))
+    {
+        return 0;
+    }
+
+    if (length > (update->config.size - update->receivedSize))
+    {
+        length = update->config.size - update->receivedSize;
+    }
+
+    while ((accepted < length) && (update->bufferCount < IFX_CFG_FLASHUPDATE_BURST_COUNT))
+    {
+        uint8 *burst = (uint8 *)update->buffer[(update->bufferHead + update->bufferCount) % IFX_CFG_FLASHUPDATE_BURST_COUNT];
+        uint32 count = IFXFLASH_PFLASH_BURST_LENGTH - update->bufferFill;
+
+        if (count > (length - accepted))
+        {
+            count = length - accepted;
+        }
+
+        memcpy(&burst[update->bufferFill], &source[accepted], count);
+        update->bufferFill = (uint16)(update->bufferFill + count);
+        accepted          += count;
+
+        if (update->bufferFill == IFXFLASH_PFLASH_BURST_LENGTH)
+        {
+            update->bufferCount++;
+            update->bufferFill = 0;
+        }
+    }
+
+    update->receivedSize += accepted;
+
+    return accepted;
+}
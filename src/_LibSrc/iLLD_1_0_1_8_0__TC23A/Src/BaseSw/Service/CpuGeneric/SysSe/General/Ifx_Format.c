@@ -0,0 +1,567 @@
+/**
+ * \file Ifx_Format.c
+ * \brief Number formatting and parsing without printf / scanf
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_Format.h"
+#include "_Utilities/Ifx_Assert.h"
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+
+/** \brief Size of the digit buffer: 20 digits of an uint64, or sign, 10 integer digits, point and 9 fraction digits */
+#define IFX_FORMAT_DIGITS_SIZE (24)
+
+/** \brief Significant digits taken into account by the float parsers, the mantissa fits in an uint64 / uint32 */
+#define IFX_FORMAT_FLOAT64_DIGITS (19)
+#define IFX_FORMAT_FLOAT32_DIGITS (9)
+
+/** \brief Returned by Ifx_Format_digitValue() for the characters which are not digits */
+#define IFX_FORMAT_NOT_A_DIGIT (16)
+
+static const uint32  Ifx_Format_pow10[IFX_FORMAT_MAX_PRECISION + 1] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+/* 10^(2^i), the decimal exponent is applied bit by bit */
+static const float64 Ifx_Format_pow10Float64[] = {1e1, 1e2, 1e4, 1e8, 1e16, 1e32, 1e64, 1e128, 1e256};
+static const float32 Ifx_Format_pow10Float32[] = {1e1f, 1e2f, 1e4f, 1e8f, 1e16f, 1e32f};
+
+static const char    Ifx_Format_hexDigits[16] = "0123456789ABCDEF";
+
+/** \brief Append count characters, the characters which do not fit are dropped */
+static void Ifx_Format_put(Ifx_Format *fmt, const char *text, Ifx_SizeT count)
+{
+    Ifx_SizeT free = fmt->size - 1 - fmt->length;
+    Ifx_SizeT i;
+
+    if (count > free)
+    {
+        count         = free;
+        fmt->overflow = TRUE;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        fmt->buffer[fmt->length + i] = text[i];
+    }
+
+    fmt->length             += count;
+    fmt->buffer[fmt->length] = '\0';
+}
+
+
+/** \brief Append the digits right aligned in a field of width characters */
+static void Ifx_Format_field(Ifx_Format *fmt, const char *digits, Ifx_SizeT count, uint8 width)
+{
+    static const char spaces[8] = {' ', ' ', ' ', ' ', ' ', ' ', ' ', ' '};
+    Ifx_SizeT         pad       = (width > count) ? (Ifx_SizeT)(width - count) : 0;
+
+    while (pad > 0)
+    {
+        Ifx_SizeT chunk = (pad > (Ifx_SizeT)sizeof(spaces)) ? (Ifx_SizeT)sizeof(spaces) : pad;
+        Ifx_Format_put(fmt, spaces, chunk);
+        pad = pad - chunk;
+    }
+
+    Ifx_Format_put(fmt, digits, count);
+}
+
+
+/** \brief Write the decimal digits of value backwards before end, at least minDigits digits
+ * \return Returns the number of digits written
+ */
+static Ifx_SizeT Ifx_Format_decimal(char *end, uint32 value, uint8 minDigits)
+{
+    Ifx_SizeT count = 0;
+
+    do
+    {
+        count++;
+        end[-(sint32)count] = (char)('0' + (value % 10));
+        value               = value / 10;
+    } while ((value != 0) || (count < minDigits));
+
+    return count;
+}
+
+
+/** \brief Write a float value as [-]integer[.fraction] backwards before end
+ * \return Returns the number of characters written
+ */
+static Ifx_SizeT Ifx_Format_fixedDigits(char *end, boolean negative, uint32 integer, uint32 fraction, uint8 precision)
+{
+    Ifx_SizeT count = 0;
+
+    if (precision > 0)
+    {
+        count = Ifx_Format_decimal(end, fraction, precision);
+        count++;
+        end[-(sint32)count] = '.';
+    }
+
+    count += Ifx_Format_decimal(&end[-(sint32)count], integer, 1);
+
+    if (negative != FALSE)
+    {
+        count++;
+        end[-(sint32)count] = '-';
+    }
+
+    return count;
+}
+
+
+static uint32 Ifx_Format_digitValue(char c)
+{
+    uint32 result;
+
+    if ((c >= '0') && (c <= '9'))
+    {
+        result = (uint32)(c - '0');
+    }
+    else if ((c >= 'a') && (c <= 'f'))
+    {
+        result = (uint32)(c - 'a' + 10);
+    }
+    else if ((c >= 'A') && (c <= 'F'))
+    {
+        result = (uint32)(c - 'A' + 10);
+    }
+    else
+    {
+        result = IFX_FORMAT_NOT_A_DIGIT;
+    }
+
+    return result;
+}
+
+
+/** \brief Convert the digits of an unsigned integer in base 10 or 16
+ * \return Returns the pointer after the digits, NULL_PTR if there is no digit or the value overflows
+ */
+static pchar Ifx_Format_parseDigits(pchar text, uint64 *value, uint32 base)
+{
+    uint64  result   = 0;
+    boolean overflow = FALSE;
+    pchar   p        = text;
+    uint32  digit    = Ifx_Format_digitValue(*p);
+
+    while (digit < base)
+    {
+        if (result > ((0xFFFFFFFFFFFFFFFFULL - digit) / base))
+        {
+            overflow = TRUE;
+        }
+
+        result = (result * base) + digit;
+        p++;
+        digit  = Ifx_Format_digitValue(*p);
+    }
+
+    *value = result;
+
+    return ((p == text) || (overflow != FALSE)) ? NULL_PTR : p;
+}
+
+
+/** \brief Split a decimal floating point number in sign, mantissa and decimal exponent
+ * \return Returns the pointer after the number, NULL_PTR if there is no digit
+ */
+static pchar Ifx_Format_parseDecimal(pchar text, boolean *negative, uint64 *mantissa, sint32 *exponent, uint32 maxDigits)
+{
+    pchar   p         = text;
+    uint64  result    = 0;
+    uint32  digits    = 0;
+    sint32  exp       = 0;
+    boolean hasDigits = FALSE;
+
+    *negative = (*p == '-');
+
+    if ((*p == '-') || (*p == '+'))
+    {
+        p++;
+    }
+
+    while ((*p >= '0') && (*p <= '9'))
+    {
+        if (digits < maxDigits)
+        {
+            result = (result * 10) + (uint64)(*p - '0');
+            digits = (result != 0) ? digits + 1 : 0;
+        }
+        else
+        {
+            exp++;
+        }
+
+        hasDigits = TRUE;
+        p++;
+    }
+
+    if (*p == '.')
+    {
+        p++;
+
+        while ((*p >= '0') && (*p <= '9'))
+        {
+            if (digits < maxDigits)
+            {
+                result = (result * 10) + (uint64)(*p - '0');
+                digits = (result != 0) ? digits + 1 : 0;
+                exp--;
+            }
+
+            hasDigits = TRUE;
+            p++;
+        }
+    }
+
+    if ((hasDigits != FALSE) && ((*p == 'e') || (*p == 'E')))
+    {
+        /* The exponent is taken only if it has digits, as with strtod() */
+        pchar   q           = &p[1];
+        boolean expNegative = (*q == '-');
+        sint32  expValue    = 0;
+
+        if ((*q == '-') || (*q == '+'))
+        {
+            q++;
+        }
+
+        if ((*q >= '0') && (*q <= '9'))
+        {
+            while ((*q >= '0') && (*q <= '9'))
+            {
+                /* Clamped, the result is then 0 or infinite anyway */
+                expValue = (expValue < 10000) ? ((expValue * 10) + (*q - '0')) : expValue;
+                q++;
+            }
+
+            exp = (expNegative != FALSE) ? (exp - expValue) : (exp + expValue);
+            p   = q;
+        }
+    }
+
+    *mantissa = result;
+    *exponent = exp;
+
+    return (hasDigits != FALSE) ? p : NULL_PTR;
+}
+
+
+void Ifx_Format_init(Ifx_Format *fmt, char *buffer, Ifx_SizeT size)
+{
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, size > 0);
+    fmt->buffer = buffer;
+    fmt->size   = size;
+    Ifx_Format_clear(fmt);
+}
+
+
+void Ifx_Format_char(Ifx_Format *fmt, char c)
+{
+    Ifx_Format_put(fmt, &c, 1);
+}
+
+
+void Ifx_Format_string(Ifx_Format *fmt, pchar text)
+{
+    Ifx_SizeT count = 0;
+
+    while (text[count] != '\0')
+    {
+        count++;
+    }
+
+    Ifx_Format_put(fmt, text, count);
+}
+
+
+void Ifx_Format_uint32(Ifx_Format *fmt, uint32 value, uint8 width)
+{
+    char      digits[IFX_FORMAT_DIGITS_SIZE];
+    Ifx_SizeT count = Ifx_Format_decimal(&digits[IFX_FORMAT_DIGITS_SIZE], value, 1);
+
+    Ifx_Format_field(fmt, &digits[IFX_FORMAT_DIGITS_SIZE - count], count, width);
+}
+
+
+void Ifx_Format_sint32(Ifx_Format *fmt, sint32 value, uint8 width)
+{
+    char      digits[IFX_FORMAT_DIGITS_SIZE];
+    uint32    magnitude = (value < 0) ? (0U - (uint32)value) : (uint32)value;
+    Ifx_SizeT count     = Ifx_Format_decimal(&digits[IFX_FORMAT_DIGITS_SIZE], magnitude, 1);
+
+    if (value < 0)
+    {
+        count++;
+        digits[IFX_FORMAT_DIGITS_SIZE - count] = '-';
+    }
+
+    Ifx_Format_field(fmt, &digits[IFX_FORMAT_DIGITS_SIZE - count], count, width);
+}
+
+
+void Ifx_Format_uint64(Ifx_Format *fmt, uint64 value, uint8 width)
+{
+    char      digits[IFX_FORMAT_DIGITS_SIZE];
+    Ifx_SizeT count = 0;
+
+    /* Blocks of 9 digits, only the block split needs the 64 bit division */
+    while (value > 0xFFFFFFFFULL)
+    {
+        uint32 low = (uint32)(value % 1000000000ULL);
+        value  = value / 1000000000ULL;
+        count += Ifx_Format_decimal(&digits[IFX_FORMAT_DIGITS_SIZE - count], low, 9);
+    }
+
+    count += Ifx_Format_decimal(&digits[IFX_FORMAT_DIGITS_SIZE - count], (uint32)value, 1);
+
+    Ifx_Format_field(fmt, &digits[IFX_FORMAT_DIGITS_SIZE - count], count, width);
+}
+
+
+void Ifx_Format_hex32(Ifx_Format *fmt, uint32 value, uint8 digits)
+{
+    char      text[8];
+    Ifx_SizeT count = 0;
+
+    digits = (digits > 8) ? 8 : digits;
+
+    do
+    {
+        count++;
+        text[8 - count] = Ifx_Format_hexDigits[value & 0xFU];
+        value           = value >> 4;
+    } while ((value != 0) || (count < digits));
+
+    Ifx_Format_put(fmt, &text[8 - count], count);
+}
+
+
+void Ifx_Format_float32(Ifx_Format *fmt, float32 value, uint8 width, uint8 precision)
+{
+    char      digits[IFX_FORMAT_DIGITS_SIZE];
+    Ifx_SizeT count;
+    boolean   negative  = (value < 0.0f);
+    float32   magnitude = (negative != FALSE) ? -value : value;
+
+    if (value != value)
+    {
+        Ifx_Format_field(fmt, "nan", 3, width);
+    }
+    else if (magnitude >= 4294967296.0f)
+    {
+        if (magnitude > 3.402823466e+38f)
+        {
+            Ifx_Format_field(fmt, (negative != FALSE) ? "-inf" : "inf", (negative != FALSE) ? 4 : 3, width);
+        }
+        else
+        {
+            Ifx_Format_field(fmt, "ovf", 3, width);
+        }
+    }
+    else
+    {
+        uint32 scale;
+        uint32 integer;
+        uint32 fraction;
+
+        precision = (precision > IFX_FORMAT_MAX_PRECISION) ? IFX_FORMAT_MAX_PRECISION : precision;
+        scale     = Ifx_Format_pow10[precision];
+        integer   = (uint32)magnitude;
+        /* magnitude - integer is exact, the fraction is below 1 */
+        fraction  = (uint32)(((magnitude - (float32)integer) * (float32)scale) + 0.5f);
+
+        if (fraction >= scale)
+        {
+            fraction = fraction - scale;
+            integer++;
+        }
+
+        count = Ifx_Format_fixedDigits(&digits[IFX_FORMAT_DIGITS_SIZE], negative, integer, fraction, precision);
+        Ifx_Format_field(fmt, &digits[IFX_FORMAT_DIGITS_SIZE - count], count, width);
+    }
+}
+
+
+void Ifx_Format_fixed(Ifx_Format *fmt, sint32 value, uint8 fractionBits, uint8 width, uint8 precision)
+{
+    char      digits[IFX_FORMAT_DIGITS_SIZE];
+    Ifx_SizeT count;
+    boolean   negative  = (value < 0);
+    uint32    magnitude = (negative != FALSE) ? (0U - (uint32)value) : (uint32)value;
+    uint32    integer;
+    uint32    fraction;
+    uint32    scale;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fractionBits < 32);
+
+    precision = (precision > IFX_FORMAT_MAX_PRECISION) ? IFX_FORMAT_MAX_PRECISION : precision;
+    scale     = Ifx_Format_pow10[precision];
+    integer   = magnitude >> fractionBits;
+
+    if (fractionBits > 0)
+    {
+        uint64 bits = magnitude & ((1UL << fractionBits) - 1);
+        fraction = (uint32)(((bits * scale) + (1ULL << (fractionBits - 1))) >> fractionBits);
+    }
+    else
+    {
+        fraction = 0;
+    }
+
+    if (fraction >= scale)
+    {
+        fraction = fraction - scale;
+        integer++;
+    }
+
+    count = Ifx_Format_fixedDigits(&digits[IFX_FORMAT_DIGITS_SIZE], negative, integer, fraction, precision);
+    Ifx_Format_field(fmt, &digits[IFX_FORMAT_DIGITS_SIZE - count], count, width);
+}
+
+
+boolean Ifx_Format_write(const Ifx_Format *fmt, IfxStdIf_DPipe *io)
+{
+    Ifx_SizeT count = fmt->length;
+    boolean   result;
+
+    if ((io->txDisabled != FALSE) || (count == 0))
+    {
+        result = TRUE;
+    }
+    else
+    {
+        result = IfxStdIf_DPipe_write(io, (void *)fmt->buffer, &count, TIME_INFINITE);
+    }
+
+    return result;
+}
+
+
+pchar Ifx_Format_parseUInt64(pchar text, uint64 *value, boolean hex)
+{
+    if ((text[0] == '0') && ((text[1] == 'x') || (text[1] == 'X')))
+    {
+        text = &text[2];
+        hex  = TRUE;
+    }
+
+    return Ifx_Format_parseDigits(text, value, (hex != FALSE) ? 16 : 10);
+}
+
+
+pchar Ifx_Format_parseSInt64(pchar text, sint64 *value)
+{
+    boolean negative = (text[0] == '-');
+    uint64  magnitude;
+    pchar   end;
+
+    if ((text[0] == '-') || (text[0] == '+'))
+    {
+        text++;
+    }
+
+    end = Ifx_Format_parseDigits(text, &magnitude, 10);
+
+    if ((end != NULL_PTR) && (magnitude > ((negative != FALSE) ? 0x8000000000000000ULL : 0x7FFFFFFFFFFFFFFFULL)))
+    {
+        end = NULL_PTR;
+    }
+
+    *value = (negative != FALSE) ? (sint64)(0ULL - magnitude) : (sint64)magnitude;
+
+    return end;
+}
+
+
+pchar Ifx_Format_parseFloat64(pchar text, float64 *value)
+{
+    boolean negative;
+    uint64  mantissa;
+    sint32  exponent;
+    pchar   end    = Ifx_Format_parseDecimal(text, &negative, &mantissa, &exponent, IFX_FORMAT_FLOAT64_DIGITS);
+    float64 result = (float64)mantissa;
+
+    if (mantissa != 0)
+    {
+        uint32  n     = (uint32)((exponent < 0) ? -exponent : exponent);
+        float64 scale = 1.0;
+        uint32  i;
+
+        for (i = 0; (i < Ifx_COUNTOF(Ifx_Format_pow10Float64)) && (n != 0); i++)
+        {
+            scale = ((n & 1U) != 0) ? (scale * Ifx_Format_pow10Float64[i]) : scale;
+            n     = n >> 1;
+        }
+
+        if (n != 0)
+        {
+            /* |exponent| >= 512: out of the float64 range, 10^512 is the infinity */
+            result = (exponent < 0) ? 0.0 : (Ifx_Format_pow10Float64[8] * Ifx_Format_pow10Float64[8]);
+        }
+        else
+        {
+            result = (exponent < 0) ? (result / scale) : (result * scale);
+        }
+    }
+
+    *value = (negative != FALSE) ? -result : result;
+
+    return end;
+}
+
+
+pchar Ifx_Format_parseFloat32(pchar text, float32 *value)
+{
+    boolean negative;
+    uint64  mantissa;
+    sint32  exponent;
+    pchar   end    = Ifx_Format_parseDecimal(text, &negative, &mantissa, &exponent, IFX_FORMAT_FLOAT32_DIGITS);
+    float32 result = (float32)(uint32)mantissa;
+
+    if (mantissa != 0)
+    {
+        uint32  n     = (uint32)((exponent < 0) ? -exponent : exponent);
+        float32 scale = 1.0f;
+        uint32  i;
+
+        for (i = 0; (i < Ifx_COUNTOF(Ifx_Format_pow10Float32)) && (n != 0); i++)
+        {
+            scale = ((n & 1U) != 0) ? (scale * Ifx_Format_pow10Float32[i]) : scale;
+            n     = n >> 1;
+        }
+
+        if (n != 0)
+        {
+            /* |exponent| >= 64: out of the float32 range, 10^64 is the infinity */
+            result = (exponent < 0) ? 0.0f : (Ifx_Format_pow10Float32[5] * Ifx_Format_pow10Float32[5]);
+        }
+        else
+        {
+            result = (exponent < 0) ? (result / scale) : (result * scale);
+        }
+    }
+
+    *value = (negative != FALSE) ? -result : result;
+
+    return end;
+}
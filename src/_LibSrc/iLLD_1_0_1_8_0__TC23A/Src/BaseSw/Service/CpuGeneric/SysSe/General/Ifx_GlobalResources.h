@@ -23,6 +23,43 @@
  * \defgroup library_srvsw_sysse_general_globalresources Global resources
  * This module implements the global resources handling
  * \ingroup library_srvsw_sysse_general
+ *
+ * \section dma DMA channels and interrupt priorities
+ * The DMA channels and the interrupt priorities of all drivers are listed in one table of
+ * Ifx_GlobalResources_DmaItem, which is checked by \ref Ifx_GlobalResources_initDma() before the drivers are
+ * initialised. A channel or priority is either fixed, or IFX_GLOBALRESOURCES_AUTO to let the allocator choose it,
+ * or IFX_GLOBALRESOURCES_NONE if the item does not use it (e.g. an interrupt only item).
+ *
+ * The item class selects the channel and priority range. Within a DMA move engine the channel with the higher
+ * number wins the arbitration, so the real time class gets the upper channels and priorities, the background
+ * class the lower ones:
+ * - background: channels 0 .. IFX_CFG_GLOBAL_RESOURCES_DMA_NORMAL_CHANNEL - 1, priorities 1 .. IFX_CFG_GLOBAL_RESOURCES_NORMAL_PRIORITY - 1
+ * - normal: channels up to IFX_CFG_GLOBAL_RESOURCES_DMA_REALTIME_CHANNEL - 1, priorities up to IFX_CFG_GLOBAL_RESOURCES_REALTIME_PRIORITY - 1
+ * - real time: the remaining channels and priorities
+ *
+ * The check fails (and asserts) when a channel is used twice, when a priority is used twice for the same
+ * service provider, when a fixed value is outside of its class range, or when a class range is exhausted.
+ * Automatic values are allocated from the top of the class range.
+ *
+ * With the transaction hooks in the DMA interrupt, the transaction count, the transfer count and the busy time
+ * of each item are available with \ref Ifx_GlobalResources_getDmaEntry() and the shell command
+ * \ref Ifx_GlobalResources_showDma().
+ * \code
+ * enum {DMA_ID_QSPI0_TX, DMA_ID_QSPI0_RX, DMA_ID_ASC0_RX, DMA_ID_COUNT};
+ *
+ * static const Ifx_GlobalResources_DmaItem dmaTable[DMA_ID_COUNT] = {
+ *     {"qspi0Tx", Ifx_GlobalResources_DmaClass_normal,   IFX_GLOBALRESOURCES_AUTO, IFX_GLOBALRESOURCES_AUTO, IfxSrc_Tos_cpu0},
+ *     {"qspi0Rx", Ifx_GlobalResources_DmaClass_normal,   IFX_GLOBALRESOURCES_AUTO, IFX_GLOBALRESOURCES_AUTO, IfxSrc_Tos_cpu0},
+ *     {"asc0Rx",  Ifx_GlobalResources_DmaClass_realTime, 60,                       IFX_GLOBALRESOURCES_NONE, IfxSrc_Tos_cpu0},
+ * };
+ *
+ * Ifx_GlobalResources_initDma(dmaTable, DMA_ID_COUNT);
+ * spiMasterConfig.dma.txDmaChannelId = (IfxDma_ChannelId)Ifx_GlobalResources_getDmaChannel(DMA_ID_QSPI0_TX);
+ * spiMasterConfig.txPriority         = Ifx_GlobalResources_getDmaPriority(DMA_ID_QSPI0_TX);
+ *
+ * // DMA channel interrupt
+ * Ifx_GlobalResources_dmaTransactionFinished(DMA_ID_QSPI0_TX, transferCount);
+ * \endcode
  */
 
 #ifndef IFX_GLOBALRESOURCES_H
@@ -30,11 +67,68 @@
 
 #include "Ifx_Cfg.h"
 #include "Cpu/Std/Ifx_Types.h"
+#include "_Impl/IfxDma_cfg.h"
+#include "Src/Std/IfxSrc.h"
+#include "StdIf/IfxStdIf_DPipe.h"
 
 #ifndef IFX_CFG_GLOBAL_RESOURCES_ENABLED
 #define IFX_CFG_GLOBAL_RESOURCES_ENABLED (0)
 #endif
 
+#ifndef IFX_CFG_GLOBAL_RESOURCES_DMA_MAX_ITEMS
+#define IFX_CFG_GLOBAL_RESOURCES_DMA_MAX_ITEMS    (16)                          /**< \brief Maximal number of items in the DMA table */
+#endif
+
+#ifndef IFX_CFG_GLOBAL_RESOURCES_DMA_NORMAL_CHANNEL
+#define IFX_CFG_GLOBAL_RESOURCES_DMA_NORMAL_CHANNEL   (IFXDMA_NUM_CHANNELS / 4)     /**< \brief First channel of the normal class */
+#endif
+
+#ifndef IFX_CFG_GLOBAL_RESOURCES_DMA_REALTIME_CHANNEL
+#define IFX_CFG_GLOBAL_RESOURCES_DMA_REALTIME_CHANNEL (IFXDMA_NUM_CHANNELS / 2)     /**< \brief First channel of the real time class */
+#endif
+
+#ifndef IFX_CFG_GLOBAL_RESOURCES_NORMAL_PRIORITY
+#define IFX_CFG_GLOBAL_RESOURCES_NORMAL_PRIORITY      (64)                          /**< \brief First interrupt priority of the normal class */
+#endif
+
+#ifndef IFX_CFG_GLOBAL_RESOURCES_REALTIME_PRIORITY
+#define IFX_CFG_GLOBAL_RESOURCES_REALTIME_PRIORITY    (128)                         /**< \brief First interrupt priority of the real time class */
+#endif
+
+#define IFX_GLOBALRESOURCES_AUTO (-1)   /**< \brief Channel or priority chosen by the allocator */
+#define IFX_GLOBALRESOURCES_NONE (-2)   /**< \brief Channel or priority not used by the item */
+
+/** \brief Priority class of a DMA item */
+typedef enum
+{
+    Ifx_GlobalResources_DmaClass_background = 0,  /**< \brief lowest channels and priorities, e.g. memory copies */
+    Ifx_GlobalResources_DmaClass_normal,          /**< \brief communication, e.g. QSPI, ASCLIN */
+    Ifx_GlobalResources_DmaClass_realTime         /**< \brief highest channels and priorities, e.g. ADC results in the control loop */
+} Ifx_GlobalResources_DmaClass;
+
+/** \brief DMA table item, requested resources of one driver channel */
+typedef struct
+{
+    pchar                        name;            /**< \brief Item name */
+    Ifx_GlobalResources_DmaClass dmaClass;        /**< \brief Priority class */
+    sint16                       channel;         /**< \brief DMA channel, IFX_GLOBALRESOURCES_AUTO or IFX_GLOBALRESOURCES_NONE */
+    sint16                       priority;        /**< \brief Interrupt priority, IFX_GLOBALRESOURCES_AUTO or IFX_GLOBALRESOURCES_NONE */
+    IfxSrc_Tos                   typeOfService;   /**< \brief Service provider of the interrupt */
+} Ifx_GlobalResources_DmaItem;
+
+/** \brief Allocated resources and statistics of one DMA table item */
+typedef struct
+{
+    const Ifx_GlobalResources_DmaItem *item;              /**< \brief Table item */
+    sint16                             channel;           /**< \brief Allocated DMA channel, IFX_GLOBALRESOURCES_NONE if not used */
+    sint16                             priority;          /**< \brief Allocated interrupt priority, IFX_GLOBALRESOURCES_NONE if not used */
+    uint32                             transactions;      /**< \brief Number of finished transactions */
+    uint32                             transfers;         /**< \brief Number of transfers of the finished transactions */
+    Ifx_TickTime                       busyTime;          /**< \brief Sum of the transaction durations in STM ticks */
+    Ifx_TickTime                       maxBusyTime;       /**< \brief Longest transaction in STM ticks */
+    Ifx_TickTime                       startTime;         /**< \brief Start of the running transaction, 0 if none */
+} Ifx_GlobalResources_DmaEntry;
+
 typedef struct
 {
     void *resource;
@@ -82,6 +176,63 @@ IFX_EXTERN pchar Ifx_GlobalResources_getName(sint32 id);
  *
  */
 IFX_EXTERN boolean Ifx_GlobalResources_init(const Ifx_GlobalResources_Item *table, uint32 size);
+
+/** \brief Check the DMA table and allocate the automatic channels and priorities
+ *
+ * \param table pointer to an array of Ifx_GlobalResources_DmaItem, must stay valid
+ * \param size number of items in the table
+ *
+ * \return returns TRUE if there is no conflict, else FALSE
+ */
+IFX_EXTERN boolean Ifx_GlobalResources_initDma(const Ifx_GlobalResources_DmaItem *table, uint32 size);
+
+/** \brief Return the DMA channel of an item
+ *
+ * \param id index of the item in the DMA table
+ *
+ * \return DMA channel, IFX_GLOBALRESOURCES_NONE if the item has no channel
+ */
+IFX_EXTERN sint16 Ifx_GlobalResources_getDmaChannel(sint32 id);
+
+/** \brief Return the allocated resources and the statistics of an item
+ *
+ * \param id index of the item in the DMA table
+ *
+ * \return pointer to the entry, NULL_PTR if id is invalid
+ */
+IFX_EXTERN const Ifx_GlobalResources_DmaEntry *Ifx_GlobalResources_getDmaEntry(sint32 id);
+
+/** \brief Return the interrupt priority of an item
+ *
+ * \param id index of the item in the DMA table
+ *
+ * \return interrupt priority, 0 if the item has no interrupt
+ */
+IFX_EXTERN Ifx_Priority Ifx_GlobalResources_getDmaPriority(sint32 id);
+
+/** \brief Record the start of a transaction, for the busy time
+ *
+ * \param id index of the item in the DMA table
+ */
+IFX_EXTERN void Ifx_GlobalResources_dmaTransactionStarted(sint32 id);
+
+/** \brief Record the end of a transaction, typically called by the DMA channel interrupt
+ *
+ * \param id index of the item in the DMA table
+ * \param transfers number of transfers of the transaction
+ */
+IFX_EXTERN void Ifx_GlobalResources_dmaTransactionFinished(sint32 id, uint32 transfers);
+
+/** \brief Clear the DMA statistics of all items */
+IFX_EXTERN void Ifx_GlobalResources_resetDmaStatistics(void);
+
+/** \brief Shell command: print the DMA table with the statistics. With the argument "reset", the statistics are cleared afterwards
+ * \param args command arguments
+ * \param data not used
+ * \param io Pointer to the IfxStdIf_DPipe object
+ * \return TRUE
+ */
+IFX_EXTERN boolean Ifx_GlobalResources_showDma(pchar args, void *data, IfxStdIf_DPipe *io);
 /** \} */
 
 #endif /* IFX_GLOBALRESOURCES_H */
@@ -0,0 +1,152 @@
+/**
+ * \file Ifx_InitTable.c
+ * \brief Initialization table with dependencies and deferred steps
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_InitTable.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/** Returns the mask of all the entries
+ */
+IFX_INLINE uint32 Ifx_InitTable_getAllMask(Ifx_InitTable *table)
+{
+    return (table->count >= 32) ? 0xFFFFFFFFUL : ((1UL << table->count) - 1);
+}
+
+
+/** Call once each pending entry of the given kind whose dependencies are done.
+ * Returns TRUE if an entry was called or failed
+ */
+static boolean Ifx_InitTable_step(Ifx_InitTable *table, boolean deferred)
+{
+    boolean progress = FALSE;
+    uint32  i;
+
+    for (i = 0; i < table->count; i++)
+    {
+        const Ifx_InitTable_Entry *entry = &table->entries[i];
+        uint32                     mask  = 1UL << i;
+
+        if ((((table->doneMask | table->failedMask) & mask) != 0) || ((entry->deferred != FALSE) != deferred))
+        {
+            /* finished or not of the given kind */
+        }
+        else if ((entry->dependencies & table->failedMask) != 0)
+        {
+            table->failedMask |= mask;
+            progress           = TRUE;
+        }
+        else if ((entry->dependencies & ~table->doneMask) == 0)
+        {
+            Ifx_InitTable_Status status = entry->function(entry->data);
+
+            if (status == Ifx_InitTable_Status_done)
+            {
+                table->doneMask   |= mask;
+                table->doneTime[i] = elapsed(table->start);
+            }
+            else if (status == Ifx_InitTable_Status_failed)
+            {
+                table->failedMask |= mask;
+            }
+
+            progress = TRUE;
+        }
+    }
+
+    return progress;
+}
+
+
+boolean Ifx_InitTable_init(Ifx_InitTable *table, const Ifx_InitTable_Entry *entries, uint8 count)
+{
+    boolean result = (count <= IFX_INITTABLE_MAX_ENTRIES) ? TRUE : FALSE;
+    uint32  i;
+
+    table->entries    = entries;
+    table->count      = (result != FALSE) ? count : 0;
+    table->doneMask   = 0;
+    table->failedMask = 0;
+    table->start      = now();
+
+    for (i = 0; i < table->count; i++)
+    {
+        uint32 dependencies = entries[i].dependencies;
+        uint32 j;
+
+        table->doneTime[i] = 0;
+
+        if (((dependencies & (1UL << i)) != 0) || ((dependencies & ~Ifx_InitTable_getAllMask(table)) != 0))
+        {
+            result = FALSE;
+        }
+
+        for (j = 0; (j < table->count) && (entries[i].deferred == FALSE); j++)
+        {
+            if (((dependencies & (1UL << j)) != 0) && (entries[j].deferred != FALSE))
+            {
+                result = FALSE;
+            }
+        }
+    }
+
+    if (result == FALSE)
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+        table->count = 0;
+    }
+
+    return result;
+}
+
+
+boolean Ifx_InitTable_isDone(Ifx_InitTable *table)
+{
+    return ((table->doneMask | table->failedMask) == Ifx_InitTable_getAllMask(table)) ? TRUE : FALSE;
+}
+
+
+boolean Ifx_InitTable_process(Ifx_InitTable *table)
+{
+    Ifx_InitTable_step(table, TRUE);
+
+    return Ifx_InitTable_isDone(table);
+}
+
+
+boolean Ifx_InitTable_runCritical(Ifx_InitTable *table)
+{
+    boolean result = TRUE;
+    uint32  i;
+
+    while (Ifx_InitTable_step(table, FALSE) != FALSE)
+    {}
+
+    for (i = 0; i < table->count; i++)
+    {
+        if ((table->entries[i].deferred == FALSE) && ((table->doneMask & (1UL << i)) == 0))
+        {
+            result = FALSE;
+        }
+    }
+
+    return result;
+}
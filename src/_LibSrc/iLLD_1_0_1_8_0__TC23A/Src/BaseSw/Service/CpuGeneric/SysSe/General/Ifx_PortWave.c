@@ -0,0 +1,124 @@
+/**
+ * \file Ifx_PortWave.c
+ * \brief DMA driven parallel port pattern output
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_PortWave.h"
+#include "Cpu/Std/IfxCpu.h"
+#include "Src/Std/IfxSrc.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/** Returns the circular buffer range of a table in continuous mode, IfxDma_ChannelIncrementCircular_none if the
+ * length is not a power of 2 or the table is not aligned on its size
+ */
+static IfxDma_ChannelIncrementCircular Ifx_PortWave_getCircularRange(uint32 address, uint16 length)
+{
+    uint32 size  = (uint32)length * 4;
+    uint32 range = IfxDma_ChannelIncrementCircular_4;
+
+    if (((size & (size - 1)) != 0) || ((address & (size - 1)) != 0))
+    {
+        return IfxDma_ChannelIncrementCircular_none;
+    }
+
+    while ((range < IfxDma_ChannelIncrementCircular_32768) && ((1u << range) < size))
+    {
+        range++;
+    }
+
+    return ((1u << range) == size) ? (IfxDma_ChannelIncrementCircular)range : IfxDma_ChannelIncrementCircular_none;
+}
+
+
+boolean Ifx_PortWave_init(Ifx_PortWave *wave, const Ifx_PortWave_Config *config)
+{
+    IfxDma_Dma                      dma;
+    IfxDma_Dma_ChannelConfig        dmaCfg;
+    IfxDma_ChannelIncrementCircular range = IfxDma_ChannelIncrementCircular_none;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->port != NULL_PTR) && (config->pattern != NULL_PTR) && (config->length != 0));
+
+    wave->sourceAddress = IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), config->pattern);
+    wave->length        = config->length;
+    wave->continuous    = config->continuous;
+
+    if (config->continuous != FALSE)
+    {
+        range = Ifx_PortWave_getCircularRange(wave->sourceAddress, config->length);
+
+        if (range == IfxDma_ChannelIncrementCircular_none)
+        {
+            return FALSE;
+        }
+    }
+
+    IfxDma_Dma_createModuleHandle(&dma, &MODULE_DMA);
+    IfxDma_Dma_initChannelConfig(&dmaCfg, &dma);
+
+    dmaCfg.channelId                        = config->dmaChannelId;
+    dmaCfg.hardwareRequestEnabled           = FALSE;                                          // enabled by Ifx_PortWave_start()
+    dmaCfg.requestMode                      = IfxDma_ChannelRequestMode_oneTransferPerRequest;
+    dmaCfg.operationMode                    = (config->continuous != FALSE) ? IfxDma_ChannelOperationMode_continuous : IfxDma_ChannelOperationMode_single;
+    dmaCfg.moveSize                         = IfxDma_ChannelMoveSize_32bit;
+    dmaCfg.blockMode                        = IfxDma_ChannelMove_1;
+    dmaCfg.transferCount                    = config->length;
+    dmaCfg.sourceAddress                    = wave->sourceAddress;
+    dmaCfg.sourceCircularBufferEnabled      = config->continuous;                             // the source wraps at the end of the table
+    dmaCfg.sourceAddressCircularRange       = range;
+    dmaCfg.destinationAddress               = (uint32)&config->port->OMR.U;
+    dmaCfg.destinationCircularBufferEnabled = TRUE;                                           // fixed destination
+    dmaCfg.destinationAddressCircularRange  = IfxDma_ChannelIncrementCircular_none;
+    IfxDma_Dma_initChannel(&wave->dmaChannel, &dmaCfg);
+
+    /* each trigger event requests one transfer of the DMA channel with the same number */
+    IfxSrc_init(config->trigger, IfxSrc_Tos_dma, (Ifx_Priority)config->dmaChannelId);
+    IfxSrc_enable(config->trigger);
+
+    return TRUE;
+}
+
+
+void Ifx_PortWave_initConfig(Ifx_PortWave_Config *config)
+{
+    config->port         = NULL_PTR;
+    config->pattern      = NULL_PTR;
+    config->length       = 0;
+    config->continuous   = FALSE;
+    config->dmaChannelId = IfxDma_ChannelId_0;
+    config->trigger      = NULL_PTR;
+}
+
+
+void Ifx_PortWave_start(Ifx_PortWave *wave)
+{
+    Ifx_PortWave_stop(wave);
+
+    IfxDma_Dma_setChannelSourceAddress(&wave->dmaChannel, wave->sourceAddress);
+    IfxDma_Dma_setChannelTransferCount(&wave->dmaChannel, wave->length);
+    IfxDma_clearChannelTransactionRequestLost(wave->dmaChannel.dma, wave->dmaChannel.channelId);
+    IfxDma_enableChannelTransaction(wave->dmaChannel.dma, wave->dmaChannel.channelId);
+}
+
+
+void Ifx_PortWave_stop(Ifx_PortWave *wave)
+{
+    IfxDma_disableChannelTransaction(wave->dmaChannel.dma, wave->dmaChannel.channelId);
+}
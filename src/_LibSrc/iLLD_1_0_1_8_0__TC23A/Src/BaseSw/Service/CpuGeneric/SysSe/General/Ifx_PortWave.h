@@ -0,0 +1,145 @@
+/**
+ * \file Ifx_PortWave.h
+ * \brief DMA driven parallel port pattern output
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_general_portwave Port pattern output
+ * \ingroup library_srvsw_sysse_general
+ *
+ * The pattern output writes a table of precomputed values to the output modification register (OMR) of a port,
+ * one value per trigger, with a DMA channel. Each value sets and clears any pins of the port at the same time
+ * (\ref Ifx_PortWave_getOmr()), the pins not selected by the value keep their state. The CPU is not involved in
+ * the edges: the timing is given only by the trigger, the jitter by the DMA latency.
+ *
+ * The trigger is a periodic event of a timer configured by the application, for example an STM compare or a
+ * GTM TOM channel. Its service request node is routed to the DMA channel by \ref Ifx_PortWave_init(), the timer
+ * interrupt shall not be used for anything else.
+ *
+ * - single mode: the table is output once per \ref Ifx_PortWave_start(), \ref Ifx_PortWave_isBusy() returns FALSE
+ * after the last value.
+ * - continuous mode: the table is repeated until \ref Ifx_PortWave_stop(). The DMA wraps the source address in a
+ * circular buffer, the table length shall be a power of 2 and the table aligned on its size in bytes (up to
+ * 8192 values).
+ *
+ * The pins shall be configured as general purpose outputs. The table shall not be in a data cached segment if it
+ * is modified at run time, see IFX_DMA_BUFFER.
+ *
+ * Usage example:
+ * \code
+ * // 4 phase stepper on P02.0..P02.3, full step
+ * #define STEPPER_MASK (0x000Fu)
+ * static uint32 stepperTable[4] __attribute__ ((aligned(16)));
+ * static Ifx_PortWave stepper;
+ *
+ * stepperTable[0] = Ifx_PortWave_getOmr(STEPPER_MASK, 0x3);
+ * stepperTable[1] = Ifx_PortWave_getOmr(STEPPER_MASK, 0x6);
+ * stepperTable[2] = Ifx_PortWave_getOmr(STEPPER_MASK, 0xC);
+ * stepperTable[3] = Ifx_PortWave_getOmr(STEPPER_MASK, 0x9);
+ *
+ * Ifx_PortWave_Config config;
+ * Ifx_PortWave_initConfig(&config);
+ * config.port         = &MODULE_P02;
+ * config.pattern      = stepperTable;
+ * config.length       = 4;
+ * config.continuous   = TRUE;
+ * config.dmaChannelId = IfxDma_ChannelId_10;
+ * config.trigger      = &SRC_STM0SR0;  // STM0 compare 0, reloaded by the application at the step rate
+ * Ifx_PortWave_init(&stepper, &config);
+ *
+ * Ifx_PortWave_start(&stepper);
+ * \endcode
+ *
+ */
+#ifndef IFX_PORTWAVE_H
+#define IFX_PORTWAVE_H 1
+
+#include "Cpu/Std/Ifx_Types.h"
+#include "Dma/Dma/IfxDma_Dma.h"
+#include "Port/Std/IfxPort.h"
+
+/** \addtogroup library_srvsw_sysse_general_portwave
+ * \{ */
+
+/** \brief Configuration of the pattern output */
+typedef struct
+{
+    Ifx_P                 *port;          /**< \brief port written by the pattern */
+    const uint32          *pattern;       /**< \brief table of OMR values, see \ref Ifx_PortWave_getOmr() */
+    uint16                 length;        /**< \brief number of values in the table */
+    boolean                continuous;    /**< \brief TRUE to repeat the table until \ref Ifx_PortWave_stop() */
+    IfxDma_ChannelId       dmaChannelId;  /**< \brief DMA channel writing the values */
+    volatile Ifx_SRC_SRCR *trigger;       /**< \brief service request node of the timer pacing the output */
+} Ifx_PortWave_Config;
+
+/** \brief Pattern output object */
+typedef struct
+{
+    IfxDma_Dma_Channel     dmaChannel;     /**< \brief DMA channel writing the values */
+    uint32                 sourceAddress;  /**< \brief global address of the table */
+    uint16                 length;         /**< \brief number of values in the table */
+    boolean                continuous;     /**< \brief TRUE if the table is repeated */
+} Ifx_PortWave;
+
+/** \brief Returns the OMR value driving the pins of a mask to the given levels
+ * \param mask Pins modified by the value, bit n for pin n
+ * \param levels Levels of the pins, bit n for pin n. Only the bits of the mask are used
+ * \return Returns the OMR value
+ */
+IFX_INLINE uint32 Ifx_PortWave_getOmr(uint16 mask, uint16 levels)
+{
+    return (uint32)(levels & mask) | ((uint32)(~levels & mask) << 16);
+}
+
+
+/** \brief Initialize the pattern output, the output is stopped
+ * \param wave Pointer to the pattern output object
+ * \param config Configuration
+ * \return Returns FALSE if the table is not usable in continuous mode (length or alignment)
+ */
+IFX_EXTERN boolean Ifx_PortWave_init(Ifx_PortWave *wave, const Ifx_PortWave_Config *config);
+
+/** \brief Initialize the configuration: single mode, no port, no table
+ * \param config Configuration
+ */
+IFX_EXTERN void Ifx_PortWave_initConfig(Ifx_PortWave_Config *config);
+
+/** \brief Indicates if the output is running
+ * \param wave Pointer to the pattern output object
+ * \return Returns TRUE until the last value is written in single mode, until \ref Ifx_PortWave_stop() in
+ * continuous mode
+ */
+IFX_INLINE boolean Ifx_PortWave_isBusy(Ifx_PortWave *wave)
+{
+    return IfxDma_isChannelTransactionEnabled(wave->dmaChannel.dma, wave->dmaChannel.channelId);
+}
+
+
+/** \brief Start the output from the first value of the table, at the next trigger
+ * \param wave Pointer to the pattern output object
+ */
+IFX_EXTERN void Ifx_PortWave_start(Ifx_PortWave *wave);
+
+/** \brief Stop the output, the pins keep the last written levels
+ * \param wave Pointer to the pattern output object
+ */
+IFX_EXTERN void Ifx_PortWave_stop(Ifx_PortWave *wave);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
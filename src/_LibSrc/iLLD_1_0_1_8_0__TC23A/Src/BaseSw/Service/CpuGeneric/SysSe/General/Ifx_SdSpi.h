@@ -0,0 +1,224 @@
+/**
+ * \file Ifx_SdSpi.h
+ * \brief SD card block driver over QSPI
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_general_sdspi SD card over QSPI
+ * \ingroup library_srvsw_sysse_general
+ *
+ * The driver accesses a SD card (SDSC, SDHC, SDXC) in SPI mode through an \ref IfxQspi_SpiMaster module. It
+ * is made for streaming: the data are written with one open ended multi-block write (CMD25), the card erases
+ * the area in advance (ACMD23) and programs the blocks while the next ones are transferred.
+ * - \ref Ifx_SdSpi_init() and \ref Ifx_SdSpi_startWrite() are blocking: card identification at 400 kHz,
+ * then switch to the configured baudrate; start of the multi-block write.
+ * - \ref Ifx_SdSpi_writeBlock() only queues the address of a 512 byte block.
+ * - \ref Ifx_SdSpi_process() is called from a background task and never waits. Each block is sent by queued
+ * QSPI jobs: start token, 512 data bytes moved by the DMA directly from the block (XXL mode, no copy), CRC and
+ * data response, then the busy state of the card is polled by short jobs until the block is programmed.
+ *
+ * The chip select is driven by the driver as general purpose output: it stays active for the whole command,
+ * respectively for the whole multi-block write. The QSPI module shall be initialized with DMA, the two channels
+ * (commands, blocks) use the SLSO pin given in the configuration and shall not be shared with other devices
+ * selected by this pin. Other devices on other chip selects can share the module through the job queue.
+ *
+ * Restrictions:
+ * - the object and the blocks shall be located in the DSPR of the CPU servicing the QSPI interrupts, or in
+ * a non cached memory.
+ * - a block shall not be modified until it is released (\ref Ifx_SdSpi_getReleasedTotal()).
+ * - the functions shall be called by one context, outside of interrupts.
+ *
+ * Usage example:
+ * \code
+ * static Ifx_SdSpi sd;
+ * static uint32    block[IFX_SDSPI_BLOCK_SIZE / 4];
+ *
+ * // initialization, the QSPI module is initialized with DMA
+ * Ifx_SdSpi_Config config;
+ * Ifx_SdSpi_initConfig(&config, &spiMaster);
+ * config.cs = &IfxQspi2_SLSO1_P14_2_OUT;
+ *
+ * if (Ifx_SdSpi_init(&sd, &config) != FALSE)
+ * {
+ *     Ifx_SdSpi_startWrite(&sd, 0x1000, 2048);   // 1 MByte pre-erased from block 0x1000
+ * }
+ *
+ * // background loop
+ * if (Ifx_SdSpi_getReleasedTotal(&sd) == blockTotal)
+ * {
+ *     fillBlock(block);                            // previous block programmed, the buffer is free
+ *     Ifx_SdSpi_writeBlock(&sd, block);
+ *     blockTotal++;
+ * }
+ *
+ * Ifx_SdSpi_process(&sd);
+ * \endcode
+ *
+ * Records of different sizes are batched into full blocks by \ref library_srvsw_sysse_general_sdlog.
+ *
+ */
+#ifndef IFX_SDSPI_H
+#define IFX_SDSPI_H 1
+
+#include "Cpu/Std/Ifx_Types.h"
+#include "Qspi/SpiMaster/IfxQspi_SpiMaster.h"
+#include "SysSe/Bsp/Bsp.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_SDSPI_QUEUE_LENGTH)
+#define IFX_CFG_SDSPI_QUEUE_LENGTH    (4)            /**<\brief Number of blocks which can wait to be written, power of 2 */
+#endif
+
+#if !defined(IFX_CFG_SDSPI_BUSY_POLL_SIZE)
+#define IFX_CFG_SDSPI_BUSY_POLL_SIZE  (16)           /**<\brief Number of bytes read by each busy poll job */
+#endif
+
+#define IFX_SDSPI_BLOCK_SIZE          (512)          /**<\brief Size of a block in bytes */
+#define IFX_SDSPI_INIT_BAUDRATE       (400000.0f)    /**<\brief Baudrate during the card identification */
+
+/** \addtogroup library_srvsw_sysse_general_sdspi
+ * \{ */
+
+/** \brief State of the driver */
+typedef enum
+{
+    Ifx_SdSpi_State_error,     /**< \brief card not initialized, or the last multi-block write failed */
+    Ifx_SdSpi_State_idle,      /**< \brief card deselected, ready for a command */
+    Ifx_SdSpi_State_write,     /**< \brief multi-block write open, waiting for a block */
+    Ifx_SdSpi_State_block,     /**< \brief block on transfer or being programmed by the card */
+    Ifx_SdSpi_State_stop       /**< \brief stop token sent, end of the multi-block write being programmed */
+} Ifx_SdSpi_State;
+
+/** \brief Driver configuration */
+typedef struct
+{
+    IfxQspi_SpiMaster          *spi;          /**<\brief QSPI module, initialized with DMA */
+    IFX_CONST IfxQspi_Slso_Out *cs;           /**<\brief Chip select pin of the card */
+    IfxPort_PadDriver           csDriver;     /**<\brief Pad driver of the chip select pin */
+    float32                     baudrate;     /**<\brief Baudrate after the card identification, at most 25 MHz */
+} Ifx_SdSpi_Config;
+
+/** \brief Driver object */
+typedef struct
+{
+    IfxQspi_SpiMaster_Channel command;                                   /**<\brief 8 bit channel: commands, responses and tokens */
+    IfxQspi_SpiMaster_Channel data;                                      /**<\brief XXL channel: blocks moved by the DMA */
+    IfxQspi_SpiMaster_Job     tokenJob;                                  /**<\brief start token of a block, or stop token */
+    IfxQspi_SpiMaster_Job     blockJob;                                  /**<\brief 512 data bytes of a block */
+    IfxQspi_SpiMaster_Job     responseJob;                               /**<\brief CRC and data response of a block */
+    IfxQspi_SpiMaster_Job     busyJob;                                   /**<\brief busy poll */
+    uint8                     token[4];                                  /**<\brief start token and stop token, each preceded by one idle byte */
+    uint8                     response[3];                               /**<\brief bytes received during the CRC, then the data response */
+    uint8                     busy[IFX_CFG_SDSPI_BUSY_POLL_SIZE];        /**<\brief bytes received by the busy poll */
+    uint8                     frame[18];                                 /**<\brief command frame, register read by the blocking functions */
+    Ifx_SdSpi_State           state;                                     /**<\brief state of the driver */
+    boolean                   highCapacity;                              /**<\brief TRUE for SDHC / SDXC (block addresses), FALSE for SDSC (byte addresses) */
+    boolean                   stopRequest;                               /**<\brief TRUE if the multi-block write shall be ended after the queued blocks */
+    boolean                   failed;                                    /**<\brief TRUE if a block of the current multi-block write was rejected */
+    uint32                    capacity;                                  /**<\brief card capacity in blocks */
+    float32                   baudrate;                                  /**<\brief baudrate after the card identification */
+    const uint32             *queue[IFX_CFG_SDSPI_QUEUE_LENGTH];         /**<\brief blocks waiting to be written */
+    uint32                    writeTotal;                                /**<\brief blocks queued since the initialization */
+    volatile uint32           readTotal;                                 /**<\brief blocks released since the initialization */
+    Ifx_TickTime              deadLine;                                  /**<\brief end of the programming time of the current block */
+    uint32                    busyStart;                                 /**<\brief start of the transfer of the current block, \ref nowFast32() */
+    uint32                    busyTimeMax;                               /**<\brief longest transfer and programming time of a block in ticks */
+    uint32                    blockCount;                                /**<\brief blocks written since the initialization */
+    uint32                    errorCount;                                /**<\brief blocks rejected or timed out since the initialization */
+} Ifx_SdSpi;
+
+/** \brief Return the number of blocks released since the initialization
+ *
+ * A block queued by \ref Ifx_SdSpi_writeBlock() is released when it is programmed, or when it is discarded after
+ * an error. The buffer can then be reused.
+ * \param sd Pointer to the driver object
+ * \return Returns the number of blocks released
+ */
+IFX_INLINE uint32 Ifx_SdSpi_getReleasedTotal(const Ifx_SdSpi *sd)
+{
+    return sd->readTotal;
+}
+
+
+/** \brief Return the state of the driver
+ * \param sd Pointer to the driver object
+ * \return Returns the state
+ */
+IFX_INLINE Ifx_SdSpi_State Ifx_SdSpi_getState(const Ifx_SdSpi *sd)
+{
+    return sd->state;
+}
+
+
+/** \brief Initialize the channels and the card, blocking
+ *
+ * Takes typically 10 ms to 1 s, depending on the card.
+ * \param sd Pointer to the driver object
+ * \param config Pointer to the configuration
+ * \return Returns FALSE if no card answered or the card is not supported
+ */
+IFX_EXTERN boolean Ifx_SdSpi_init(Ifx_SdSpi *sd, const Ifx_SdSpi_Config *config);
+
+/** \brief Initialize the configuration: 25 MHz
+ * \param config Pointer to the configuration
+ * \param spi QSPI module, initialized with DMA
+ */
+IFX_EXTERN void Ifx_SdSpi_initConfig(Ifx_SdSpi_Config *config, IfxQspi_SpiMaster *spi);
+
+/** \brief Execute the next step of the multi-block write
+ *
+ * Called periodically from a background task. Returns immediately while a block is transferred or programmed.
+ * \param sd Pointer to the driver object
+ */
+IFX_EXTERN void Ifx_SdSpi_process(Ifx_SdSpi *sd);
+
+/** \brief Read one block, blocking
+ * \param sd Pointer to the driver object
+ * \param address Block address
+ * \param block Buffer receiving the block, IFX_SDSPI_BLOCK_SIZE bytes
+ * \return Returns FALSE if the driver is not idle or the read failed
+ */
+IFX_EXTERN boolean Ifx_SdSpi_read(Ifx_SdSpi *sd, uint32 address, uint32 *block);
+
+/** \brief Start a multi-block write, blocking
+ *
+ * The card is selected until the end of the multi-block write.
+ * \param sd Pointer to the driver object
+ * \param address Block address of the first block
+ * \param preEraseCount Number of blocks the card may erase in advance (ACMD23), 0 for none
+ * \return Returns FALSE if the driver is not idle or the card rejected the command
+ */
+IFX_EXTERN boolean Ifx_SdSpi_startWrite(Ifx_SdSpi *sd, uint32 address, uint32 preEraseCount);
+
+/** \brief End the multi-block write once the queued blocks are written
+ *
+ * The driver is idle again when the card has programmed the last block.
+ * \param sd Pointer to the driver object
+ */
+IFX_EXTERN void Ifx_SdSpi_stopWrite(Ifx_SdSpi *sd);
+
+/** \brief Queue a block to be written at the next address
+ * \param sd Pointer to the driver object
+ * \param block Block of IFX_SDSPI_BLOCK_SIZE bytes, aligned on 4 bytes. Not copied, see \ref Ifx_SdSpi_getReleasedTotal()
+ * \return Returns FALSE if the queue is full or no multi-block write is open
+ */
+IFX_EXTERN boolean Ifx_SdSpi_writeBlock(Ifx_SdSpi *sd, const uint32 *block);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
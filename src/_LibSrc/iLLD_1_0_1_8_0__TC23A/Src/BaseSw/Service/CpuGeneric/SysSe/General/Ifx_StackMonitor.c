@@ -0,0 +1,216 @@
+/**
+ * \file Ifx_StackMonitor.c
+ * \brief Stack and context save area high-water marks
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_StackMonitor.h"
+
+/** \brief Linker symbols of the areas of a CPU */
+#define IFX_STACKMONITOR_LINKER_SYMBOLS(cpu)  \
+    extern unsigned int __USTACK##cpu[];      \
+    extern unsigned int __USTACK##cpu##_END[]; \
+    extern unsigned int __ISTACK##cpu[];      \
+    extern unsigned int __ISTACK##cpu##_END[]; \
+    extern unsigned int __CSA##cpu[];         \
+    extern unsigned int __CSA##cpu##_END[];
+
+/** \brief Areas of a CPU, lowest and highest address + 1 */
+#define IFX_STACKMONITOR_AREAS(cpu)                                                                      \
+    {{(uint32 *)__USTACK##cpu##_END, (uint32 *)__USTACK##cpu}, {(uint32 *)__ISTACK##cpu##_END, (uint32 *)__ISTACK##cpu}, \
+     {(uint32 *)__CSA##cpu, (uint32 *)__CSA##cpu##_END}}
+
+/** \brief Number of words of a CSA */
+#define IFX_STACKMONITOR_CSA_WORDS (16)
+
+IFX_STACKMONITOR_LINKER_SYMBOLS(0)
+#if IFXCPU_NUM_MODULES > 1
+IFX_STACKMONITOR_LINKER_SYMBOLS(1)
+#endif
+#if IFXCPU_NUM_MODULES > 2
+IFX_STACKMONITOR_LINKER_SYMBOLS(2)
+#endif
+
+/** \brief Memory range, begin is the lowest address */
+typedef struct
+{
+    uint32 *begin;
+    uint32 *end;
+} Ifx_StackMonitor_Range;
+
+static const Ifx_StackMonitor_Range Ifx_StackMonitor_ranges[IFXCPU_NUM_MODULES][IFX_STACKMONITOR_NUM_AREAS] = {
+    IFX_STACKMONITOR_AREAS(0),
+#if IFXCPU_NUM_MODULES > 1
+    IFX_STACKMONITOR_AREAS(1),
+#endif
+#if IFXCPU_NUM_MODULES > 2
+    IFX_STACKMONITOR_AREAS(2),
+#endif
+};
+
+/** \brief TRUE when the areas of the CPU are filled with the pattern */
+static boolean Ifx_StackMonitor_initialized[IFXCPU_NUM_MODULES];
+
+static void Ifx_StackMonitor_fill(uint32 *begin, uint32 *end)
+{
+    while (begin < end)
+    {
+        *begin++ = IFX_STACKMONITOR_PATTERN;
+    }
+}
+
+
+/** \brief Returns the used bytes of a stack, the stack grows down to begin */
+static uint32 Ifx_StackMonitor_getStackPeak(const Ifx_StackMonitor_Range *range)
+{
+    const uint32 *p = range->begin;
+
+    while ((p < range->end) && (*p == IFX_STACKMONITOR_PATTERN))
+    {
+        p++;
+    }
+
+    return (uint32)range->end - (uint32)p;
+}
+
+
+/** \brief Returns the used bytes of the CSA area */
+static uint32 Ifx_StackMonitor_getCsaPeak(const Ifx_StackMonitor_Range *range)
+{
+    const uint32 *csa  = range->begin;
+    uint32        used = 0;
+
+    while ((csa + IFX_STACKMONITOR_CSA_WORDS) <= range->end)
+    {
+        if (csa[1] != IFX_STACKMONITOR_PATTERN)
+        {
+            used++;
+        }
+
+        csa += IFX_STACKMONITOR_CSA_WORDS;
+    }
+
+    return used * IFX_STACKMONITOR_CSA_WORDS * 4;
+}
+
+
+boolean Ifx_StackMonitor_getUsage(IfxCpu_ResourceCpu cpu, Ifx_StackMonitor_Area area, Ifx_StackMonitor_Usage *usage)
+{
+    const Ifx_StackMonitor_Range *range;
+    uint32                        alignment;
+    uint32                        reserve = 0;
+
+    if ((cpu >= IFXCPU_NUM_MODULES) || (Ifx_StackMonitor_initialized[cpu] == FALSE))
+    {
+        return FALSE;
+    }
+
+    range       = &Ifx_StackMonitor_ranges[cpu][area];
+    usage->size = (uint32)range->end - (uint32)range->begin;
+
+    if (area == Ifx_StackMonitor_Area_csa)
+    {
+        usage->peak = Ifx_StackMonitor_getCsaPeak(range);
+        alignment   = IFX_STACKMONITOR_CSA_WORDS * 4;
+        reserve     = 3 * alignment; /* CSAs after LCX, see IfxCpu_initCSA() */
+    }
+    else
+    {
+        usage->peak = Ifx_StackMonitor_getStackPeak(range);
+        alignment   = 8;
+    }
+
+    usage->suggested = usage->peak + ((usage->peak * IFX_CFG_STACKMONITOR_MARGIN) / 100) + reserve;
+    usage->suggested = (usage->suggested + alignment - 1) & ~(alignment - 1);
+
+    return TRUE;
+}
+
+
+void Ifx_StackMonitor_init(void)
+{
+    IfxCpu_ResourceCpu            cpu    = IfxCpu_getCoreIndex();
+    const Ifx_StackMonitor_Range *ranges = Ifx_StackMonitor_ranges[cpu];
+    uint32                        stackPointer;
+    uint32                        link;
+    boolean                       interruptState;
+
+    /* Current stack pointer, with a margin for this function and the fill function */
+    stackPointer = ((uint32)&stackPointer - 64) & ~3UL;
+    Ifx_StackMonitor_fill(ranges[Ifx_StackMonitor_Area_userStack].begin, (uint32 *)stackPointer);
+
+    interruptState = IfxCpu_disableInterrupts();
+
+    Ifx_StackMonitor_fill(ranges[Ifx_StackMonitor_Area_interruptStack].begin, ranges[Ifx_StackMonitor_Area_interruptStack].end);
+
+    /* Free CSAs: follow the free list from FCX */
+    link = __mfcr(CPU_FCX);
+
+    while (link != 0)
+    {
+        uint32 *csa = (uint32 *)(((link & 0x000F0000UL) << 12) | ((link & 0x0000FFFFUL) << 6));
+
+        csa[1] = IFX_STACKMONITOR_PATTERN;
+        link   = csa[0] & 0x000FFFFFUL;
+    }
+
+    Ifx_StackMonitor_initialized[cpu] = TRUE;
+
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+
+boolean Ifx_StackMonitor_show(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    static const pchar areaName[IFX_STACKMONITOR_NUM_AREAS] = {"ustack", "istack", "csa"};
+    uint32             cpu, area;
+    uint32             reclaim = 0;
+
+    (void)args;
+    (void)data;
+
+    IfxStdIf_DPipe_print(io, "%-6s %-6s %8s %8s %5s %9s %8s"ENDL, "CPU", "area", "size", "peak", "%", "suggested", "reclaim");
+
+    for (cpu = 0; cpu < IFXCPU_NUM_MODULES; cpu++)
+    {
+        for (area = 0; area < IFX_STACKMONITOR_NUM_AREAS; area++)
+        {
+            Ifx_StackMonitor_Usage usage;
+
+            if (Ifx_StackMonitor_getUsage((IfxCpu_ResourceCpu)cpu, (Ifx_StackMonitor_Area)area, &usage) == FALSE)
+            {
+                IfxStdIf_DPipe_print(io, "CPU%-3u not monitored (Ifx_StackMonitor_init)"ENDL, cpu);
+                break;
+            }
+            else
+            {
+                uint32 free = (usage.size > usage.suggested) ? (usage.size - usage.suggested) : 0;
+
+                IfxStdIf_DPipe_print(io, "CPU%-3u %-6s %8u %8u %5u %9u %8u"ENDL, cpu, areaName[area], usage.size, usage.peak,
+                    (usage.size != 0) ? ((usage.peak * 100) / usage.size) : 0, usage.suggested, free);
+                reclaim += free;
+            }
+        }
+    }
+
+    IfxStdIf_DPipe_print(io, "%u bytes of DSPR can be reclaimed with a margin of %u%%"ENDL, reclaim, IFX_CFG_STACKMONITOR_MARGIN);
+
+    return TRUE;
+}
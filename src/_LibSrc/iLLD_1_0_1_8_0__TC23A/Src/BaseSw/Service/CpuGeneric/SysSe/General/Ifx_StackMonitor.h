@@ -0,0 +1,113 @@
+/**
+ * \file Ifx_StackMonitor.h
+ * \brief Stack and context save area high-water marks
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_general_stackmonitor Stack monitor
+ * \ingroup library_srvsw_sysse_general
+ *
+ * High-water marks of the user stack, interrupt stack and context save area (CSA) of each CPU, to size these
+ * areas in the linker file from measurements.
+ *
+ * \ref Ifx_StackMonitor_init() fills the unused part of the areas of the calling CPU with a pattern:
+ * - user stack: from its end up to the current stack pointer
+ * - interrupt stack: the whole area, the function shall not be called from an interrupt
+ * - CSA: the second word of each free CSA, the first word is the link of the free list
+ *
+ * The peaks are computed on request by searching the pattern, the monitored CPUs are not slowed down:
+ * - stack: from the end of the stack up to the first overwritten word
+ * - CSA: number of used CSAs. The free list is a LIFO initialised in address order by IfxCpu_initCSA(), the used
+ * CSAs are therefore always the first ones of the area, the count is the peak of the nesting.
+ *
+ * \ref Ifx_StackMonitor_show() prints the size and peak of each area with a suggested size (peak plus
+ * IFX_CFG_STACKMONITOR_MARGIN percent, plus the 3 CSAs reserved for the depletion trap) and the memory which could
+ * be given back.
+ *
+ * The areas are located with the linker symbols __USTACKx, __USTACKx_END, __ISTACKx, __ISTACKx_END, __CSAx
+ * and __CSAx_END of the framework linker files.
+ *
+ * Usage example:
+ * \code
+ * // main of each CPU, before the interrupts are enabled
+ * Ifx_StackMonitor_init();
+ *
+ * // shell command list entry
+ * {"stack", "    : Show the stack and CSA high-water marks", NULL_PTR, &Ifx_StackMonitor_show},
+ * \endcode
+ *
+ */
+#ifndef IFX_STACKMONITOR_H
+#define IFX_STACKMONITOR_H 1
+
+#include "Cpu/Std/IfxCpu.h"
+#include "StdIf/IfxStdIf_DPipe.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_STACKMONITOR_MARGIN)
+#define IFX_CFG_STACKMONITOR_MARGIN (25)                 /**<\brief Margin in percent of the peak added to the suggested size */
+#endif
+
+#define IFX_STACKMONITOR_PATTERN    (0xC5A0C5A0UL)       /**<\brief Pattern of the unused words, neither a PSW nor a code address */
+
+/** \addtogroup library_srvsw_sysse_general_stackmonitor
+ * \{ */
+
+/** \brief Monitored area */
+typedef enum
+{
+    Ifx_StackMonitor_Area_userStack      = 0,  /**<\brief user stack (A10 in task context) */
+    Ifx_StackMonitor_Area_interruptStack = 1,  /**<\brief interrupt stack (ISP) */
+    Ifx_StackMonitor_Area_csa            = 2   /**<\brief context save area */
+} Ifx_StackMonitor_Area;
+
+#define IFX_STACKMONITOR_NUM_AREAS  (3)          /**<\brief Number of areas per CPU */
+
+/** \brief High-water mark of one area, in bytes */
+typedef struct
+{
+    uint32 size;        /**<\brief size of the area */
+    uint32 peak;        /**<\brief maximal usage since \ref Ifx_StackMonitor_init() */
+    uint32 suggested;   /**<\brief peak plus margin (and CSA reserve), aligned on 8 bytes (stacks) or 64 bytes (CSA) */
+} Ifx_StackMonitor_Usage;
+
+/** \brief Returns the high-water mark of an area
+ * \param cpu CPU index
+ * \param area Area
+ * \param usage Result
+ * \return Returns FALSE if \ref Ifx_StackMonitor_init() was not called on the CPU
+ */
+IFX_EXTERN boolean Ifx_StackMonitor_getUsage(IfxCpu_ResourceCpu cpu, Ifx_StackMonitor_Area area, Ifx_StackMonitor_Usage *usage);
+
+/** \brief Fill the unused part of the stacks and CSA of the calling CPU with \ref IFX_STACKMONITOR_PATTERN
+ *
+ * Called once on each monitored CPU, from the task context
+ */
+IFX_EXTERN void Ifx_StackMonitor_init(void);
+
+/** \brief Shell command: print the high-water marks of all monitored CPUs and the memory which can be reclaimed
+ * \param args command arguments, not used
+ * \param data Not used
+ * \param io Pointer to the IfxStdIf_DPipe object
+ * \return TRUE
+ */
+IFX_EXTERN boolean Ifx_StackMonitor_show(pchar args, void *data, IfxStdIf_DPipe *io);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
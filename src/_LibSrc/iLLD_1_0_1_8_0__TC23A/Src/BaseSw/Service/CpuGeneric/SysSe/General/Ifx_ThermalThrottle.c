@@ -0,0 +1,118 @@
+/**
+ * \file Ifx_ThermalThrottle.c
+ * \brief Die temperature driven clock throttling
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_ThermalThrottle.h"
+#include "_Utilities/Ifx_Assert.h"
+
+void Ifx_ThermalThrottle_init(Ifx_ThermalThrottle *throttle, const Ifx_ThermalThrottle_Config *config)
+{
+    IfxDts_Dts_Config dtsConfig;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->levels != NULL_PTR) && (config->numLevels != 0));
+
+    throttle->levels         = config->levels;
+    throttle->numLevels      = config->numLevels;
+    throttle->level          = 0;
+    throttle->hysteresis     = config->hysteresis;
+    throttle->notify         = config->notify;
+    throttle->notifyData     = config->notifyData;
+    throttle->temperature    = 0.0;
+    throttle->temperatureMax = -273.0;
+    throttle->throttleCount  = 0;
+
+    IfxDts_Dts_initModuleConfig(&dtsConfig);
+    dtsConfig.lowerTemperatureLimit = config->lowerAlarmLimit;
+    dtsConfig.upperTemperatureLimit = config->upperAlarmLimit;
+    dtsConfig.isrPriority           = config->isrPriority;
+    dtsConfig.isrTypeOfService      = config->isrProvider;
+    IfxDts_Dts_initModule(&dtsConfig);
+
+    throttle->temperature    = IfxDts_Dts_getTemperatureCelsius();
+    throttle->temperatureMax = throttle->temperature;
+
+    Ifx_ThermalThrottle_setLevel(throttle, 0);
+}
+
+
+void Ifx_ThermalThrottle_initConfig(Ifx_ThermalThrottle_Config *config)
+{
+    config->levels          = NULL_PTR;
+    config->numLevels       = 0;
+    config->hysteresis      = 5.0;
+    config->lowerAlarmLimit = -40.0;
+    config->upperAlarmLimit = 170.0;
+    config->isrPriority     = 0;
+    config->isrProvider     = IfxSrc_Tos_cpu0;
+    config->notify          = NULL_PTR;
+    config->notifyData      = NULL_PTR;
+}
+
+
+void Ifx_ThermalThrottle_onMeasurement(Ifx_ThermalThrottle *throttle)
+{
+    float32 temperature = IfxDts_Dts_getTemperatureCelsius();
+    uint8   level       = throttle->level;
+
+    throttle->temperature = temperature;
+
+    if (temperature > throttle->temperatureMax)
+    {
+        throttle->temperatureMax = temperature;
+    }
+
+    if (((level + 1) < throttle->numLevels) && (temperature >= throttle->levels[level + 1].enterTemperature))
+    {
+        throttle->throttleCount++;
+        Ifx_ThermalThrottle_setLevel(throttle, level + 1);
+    }
+    else if ((level > 0) && (temperature < (throttle->levels[level].enterTemperature - throttle->hysteresis)))
+    {
+        Ifx_ThermalThrottle_setLevel(throttle, level - 1);
+    }
+    else
+    {
+        /* level unchanged */
+    }
+}
+
+
+void Ifx_ThermalThrottle_setLevel(Ifx_ThermalThrottle *throttle, uint8 level)
+{
+    const Ifx_ThermalThrottle_Level *config = &throttle->levels[level];
+    uint32                           cpu;
+
+    /* the CPU dividers are relative to fSRI, they are set after the SRI divider */
+    IfxScuCcu_setSriFrequency(config->sriFrequency);
+
+    for (cpu = 0; cpu < IFXCPU_NUM_MODULES; cpu++)
+    {
+        IfxScuCcu_setCpuFrequency((IfxCpu_ResourceCpu)cpu, config->cpuFrequency);
+    }
+
+    throttle->level = level;
+
+    if (throttle->notify != NULL_PTR)
+    {
+        throttle->notify(throttle->notifyData, level, throttle->temperature);
+    }
+}
@@ -0,0 +1,174 @@
+/**
+ * \file Ifx_ThermalThrottle.h
+ * \brief Die temperature driven clock throttling
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_general_thermalthrottle Thermal throttling
+ * \ingroup library_srvsw_sysse_general
+ *
+ * The thermal throttling lowers the CPU and SRI clocks when the die temperature rises, so that the application
+ * degrades its throughput instead of reaching the DTS limits (SMU alarm), and restores the full speed when the
+ * die cools down:
+ * - the measurements are started periodically, e.g. from a timer interrupt, and are handled in the DTS
+ * interrupt (measurement done): no CPU time is spent waiting for the result.
+ * - the throttling levels are ordered by temperature. Level 0 is the full speed, level i is entered when the
+ * temperature reaches levels[i].enterTemperature, and left when the temperature falls below
+ * levels[i].enterTemperature - hysteresis. At most one level is stepped per measurement.
+ * - on each level change, the SRI divider and then the CPU dividers are set with \ref IfxScuCcu_setSriFrequency()
+ * and \ref IfxScuCcu_setCpuFrequency(), then the notify callback informs the application (scheduler) of the new
+ * level, e.g. to shed low priority tasks.
+ *
+ * The STM clock is not derived from the SRI clock, the system time \ref now() is not affected by the throttling.
+ * The peripherals clocked by fSRI (DMA, ...) are slowed down with the SRI clock.
+ *
+ * Usage example:
+ * \code
+ * static const Ifx_ThermalThrottle_Level levels[] = {
+ *     {0.0,   200000000, 200000000},  // full speed
+ *     {125.0, 200000000, 100000000},  // CPU clocks halved
+ *     {135.0, 100000000, 50000000},   // SRI and CPU clocks divided by 4
+ * };
+ * static Ifx_ThermalThrottle throttle;
+ *
+ * // initialisation
+ * Ifx_ThermalThrottle_Config config;
+ * Ifx_ThermalThrottle_initConfig(&config);
+ * config.levels      = levels;
+ * config.numLevels   = 3;
+ * config.isrPriority = ISR_PRIORITY_DTS;
+ * config.notify      = &scheduler_onThermalLevel;
+ * Ifx_ThermalThrottle_init(&throttle, &config);
+ *
+ * // timer interrupt, e.g. every 10ms
+ * Ifx_ThermalThrottle_startMeasurement(&throttle);
+ *
+ * // DTS interrupt
+ * IFX_INTERRUPT(ISR_dts, 0, ISR_PRIORITY_DTS)
+ * {
+ *     Ifx_ThermalThrottle_onMeasurement(&throttle);
+ * }
+ * \endcode
+ *
+ */
+#ifndef IFX_THERMALTHROTTLE_H
+#define IFX_THERMALTHROTTLE_H 1
+
+#include "Cpu/Std/Ifx_Types.h"
+#include "Dts/Dts/IfxDts_Dts.h"
+#include "Scu/Std/IfxScuCcu.h"
+
+//----------------------------------------------------------------------------------------
+
+/** \addtogroup library_srvsw_sysse_general_thermalthrottle
+ * \{ */
+
+/** \brief Notification of a level change
+ * \param data Data given in the configuration
+ * \param level New throttling level
+ * \param temperature Die temperature in Celsius which caused the level change
+ */
+typedef void (*Ifx_ThermalThrottle_Notify)(void *data, uint8 level, float32 temperature);
+
+/** \brief Throttling level */
+typedef struct
+{
+    float32 enterTemperature;  /**<\brief die temperature in Celsius from which the level is active, ignored for level 0 */
+    float32 sriFrequency;      /**<\brief SRI frequency in Hz */
+    float32 cpuFrequency;      /**<\brief frequency of all CPUs in Hz, at most sriFrequency */
+} Ifx_ThermalThrottle_Level;
+
+/** \brief Configuration */
+typedef struct
+{
+    const Ifx_ThermalThrottle_Level *levels;            /**<\brief levels ordered by increasing temperature, level 0 is the full speed */
+    uint8                            numLevels;         /**<\brief number of levels */
+    float32                          hysteresis;        /**<\brief hysteresis in Celsius to leave a level */
+    float32                          lowerAlarmLimit;   /**<\brief DTS lower limit in Celsius (SMU alarm) */
+    float32                          upperAlarmLimit;   /**<\brief DTS upper limit in Celsius (SMU alarm) */
+    uint16                           isrPriority;       /**<\brief DTS interrupt priority */
+    IfxSrc_Tos                       isrProvider;       /**<\brief DTS interrupt service provider */
+    Ifx_ThermalThrottle_Notify       notify;            /**<\brief level change notification, NULL_PTR for none */
+    void                            *notifyData;        /**<\brief data given to the notification */
+} Ifx_ThermalThrottle_Config;
+
+/** \brief Thermal throttling object */
+typedef struct
+{
+    const Ifx_ThermalThrottle_Level *levels;          /**<\brief levels */
+    uint8                            numLevels;       /**<\brief number of levels */
+    uint8                            level;           /**<\brief active level */
+    float32                          hysteresis;      /**<\brief hysteresis in Celsius to leave a level */
+    Ifx_ThermalThrottle_Notify       notify;          /**<\brief level change notification */
+    void                            *notifyData;      /**<\brief data given to the notification */
+    float32                          temperature;     /**<\brief last measured die temperature in Celsius */
+    float32                          temperatureMax;  /**<\brief maximal measured die temperature in Celsius */
+    uint32                           throttleCount;   /**<\brief number of steps to a higher level */
+} Ifx_ThermalThrottle;
+
+/** \brief Returns the active throttling level
+ * \param throttle Pointer to the thermal throttling object
+ * \return Returns the level, 0 for full speed
+ */
+IFX_INLINE uint8 Ifx_ThermalThrottle_getLevel(const Ifx_ThermalThrottle *throttle)
+{
+    return throttle->level;
+}
+
+
+/** \brief Start a measurement, the result is handled by \ref Ifx_ThermalThrottle_onMeasurement() in the DTS interrupt
+ * \param throttle Pointer to the thermal throttling object
+ */
+IFX_INLINE void Ifx_ThermalThrottle_startMeasurement(Ifx_ThermalThrottle *throttle)
+{
+    (void)throttle;
+
+    if (IfxDts_Dts_isBusy() == FALSE)
+    {
+        IfxDts_Dts_startSensor();
+    }
+}
+
+
+/** \brief Initialize the DTS and the DTS interrupt, and apply level 0
+ * \param throttle Pointer to the thermal throttling object
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_ThermalThrottle_init(Ifx_ThermalThrottle *throttle, const Ifx_ThermalThrottle_Config *config);
+
+/** \brief Initialize the configuration: no level, 5 Celsius hysteresis, DTS limits -40 .. 170 Celsius, CPU0 interrupt
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_ThermalThrottle_initConfig(Ifx_ThermalThrottle_Config *config);
+
+/** \brief Handle the measurement result, to be called from the DTS interrupt
+ *
+ * Steps the level by one when the temperature crosses a level boundary, sets the clocks and notifies the application.
+ * \param throttle Pointer to the thermal throttling object
+ */
+IFX_EXTERN void Ifx_ThermalThrottle_onMeasurement(Ifx_ThermalThrottle *throttle);
+
+/** \brief Set the clocks of a level and notify the application
+ * \param throttle Pointer to the thermal throttling object
+ * \param level Level
+ */
+IFX_EXTERN void Ifx_ThermalThrottle_setLevel(Ifx_ThermalThrottle *throttle, uint8 level);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -0,0 +1,79 @@
+/**
+ * \file Ifx_TrapMonitor.c
+ * \brief Trap statistics shell command
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_TrapMonitor.h"
+#include "SysSe/Comm/Ifx_Shell.h"
+
+/** \brief Short names of the trap classes */
+static const pchar Ifx_TrapMonitor_className[8] = {"MME", "IPE", "IE", "CME", "BE", "ASSERT", "SYSCALL", "NMI"};
+
+boolean Ifx_TrapMonitor_show(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    uint32 cpu, i;
+
+    (void)data;
+
+    for (cpu = 0; cpu < IFXCPU_NUM_MODULES; cpu++)
+    {
+        IfxCpu_Trap_Statistics statistics = IfxCpu_Trap_statistics[cpu];
+        uint32                 count;
+
+        if (statistics.valid != IFXCPU_TRAP_STATISTICS_VALID)
+        {
+            IfxStdIf_DPipe_print(io, "CPU%u: no statistics (IfxCpu_Trap_initStatistics)"ENDL, cpu);
+            continue;
+        }
+
+        IfxStdIf_DPipe_print(io, "CPU%u: %u traps"ENDL, cpu, statistics.total);
+
+        for (i = 0; i < 8; i++)
+        {
+            IfxStdIf_DPipe_print(io, " %s=%u", Ifx_TrapMonitor_className[i], statistics.count[i]);
+        }
+
+        IfxStdIf_DPipe_print(io, ENDL);
+
+        count = __min(statistics.total, IFX_CFG_CPU_TRAP_LOG_SIZE);
+
+        if (count != 0)
+        {
+            IfxStdIf_DPipe_print(io, "  %-8s %4s %10s %10s"ENDL, "class", "tin", "pc", "stm0");
+        }
+
+        /* Last trap first */
+        for (i = 1; i <= count; i++)
+        {
+            IfxCpu_Trap_Record record = statistics.records[(statistics.total - i) & (IFX_CFG_CPU_TRAP_LOG_SIZE - 1)];
+
+            IfxStdIf_DPipe_print(io, "  %-8s %4u 0x%08X %10u"ENDL, Ifx_TrapMonitor_className[record.tClass & 7],
+                record.tId, record.pc, record.timestamp);
+        }
+    }
+
+    if (Ifx_Shell_matchToken(&args, "reset") != FALSE)
+    {
+        IfxCpu_Trap_resetStatistics();
+    }
+
+    return TRUE;
+}
@@ -0,0 +1,109 @@
+/**
+ * \file Ifx_WorkQueue.c
+ * \brief Deferred work queue serviced by a software interrupt
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_WorkQueue.h"
+#include "_Utilities/Ifx_Assert.h"
+
+void Ifx_WorkQueue_init(Ifx_WorkQueue *queue, Ifx_Priority priority)
+{
+    IfxCpu_ResourceCpu cpu = IfxCpu_getCoreIndex();
+
+    queue->head     = 0;
+    queue->count    = 0;
+    queue->maxCount = 0;
+    queue->dropped  = 0;
+    queue->src      = &MODULE_SRC.GPSR.GPSR[cpu].SR1;
+
+    IfxSrc_init(queue->src, (IfxSrc_Tos)cpu, priority);
+    IfxSrc_enable(queue->src);
+}
+
+
+boolean Ifx_WorkQueue_post(Ifx_WorkQueue *queue, Ifx_WorkQueue_Function function, void *data)
+{
+    boolean result;
+    boolean interruptState = IfxCpu_disableInterrupts();
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, function != NULL_PTR);
+
+    if (queue->count < IFX_CFG_WORKQUEUE_SIZE)
+    {
+        Ifx_WorkQueue_Item *item = &queue->items[(queue->head + queue->count) % IFX_CFG_WORKQUEUE_SIZE];
+
+        item->function  = function;
+        item->data      = data;
+        queue->count++;
+
+        if (queue->count > queue->maxCount)
+        {
+            queue->maxCount = queue->count;
+        }
+
+        result = TRUE;
+    }
+    else
+    {
+        queue->dropped++;
+        result = FALSE;
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+
+    if (result != FALSE)
+    {
+        IfxSrc_setRequest(queue->src);
+    }
+
+    return result;
+}
+
+
+uint32 Ifx_WorkQueue_process(Ifx_WorkQueue *queue)
+{
+    uint32 executed = 0;
+
+    while (TRUE)
+    {
+        Ifx_WorkQueue_Item item;
+
+        IfxCpu_disableInterrupts();
+
+        if (queue->count == 0)
+        {
+            break;
+        }
+
+        item        = queue->items[queue->head];
+        queue->head = (queue->head + 1) % IFX_CFG_WORKQUEUE_SIZE;
+        queue->count--;
+
+        /* The item is executed with the interrupts enabled, at the priority of the software interrupt */
+        IfxCpu_enableInterrupts();
+        item.function(item.data);
+        executed++;
+    }
+
+    IfxCpu_enableInterrupts();
+
+    return executed;
+}
@@ -246,6 +246,114 @@ float32 Ifx_AngleTrkF32_step(Ifx_AngleTrkF32 *aObsv, sint16 sinIn, sint16 cosIn,
 }
 
 
+/** \brief Initialize a batch of Angle Tracking Observers
+ * \param batch Pointer to the Ifx_AngleTrkF32_Batch object
+ * \param buffer Buffer of \ref IFX_ANGLETRKF32_BATCH_BUFFER_SIZE(count) elements for the states
+ * \param count Number of channels
+ * \param config Pointer to the configuration data, shared by all channels
+ * \param Ts sampling period in seconds
+ */
+void Ifx_AngleTrkF32_initBatch(Ifx_AngleTrkF32_Batch *batch, float32 *buffer, uint16 count, const Ifx_AngleTrkF32_Config *config, float32 Ts)
+{
+    batch->cfgData.kd             = config->kd;
+    batch->cfgData.ki             = config->ki;
+    batch->cfgData.kp             = config->kp;
+    batch->cfgData.errorThreshold = config->errorThreshold;
+    batch->cfgData.sqrAmplMax     = config->sqrAmplMax;
+    batch->cfgData.sqrAmplMin     = config->sqrAmplMin;
+    batch->Ts                     = Ts;
+    batch->halfTs                 = Ts / 2.0F;
+    batch->reversed               = config->reversed;
+    batch->count                  = count;
+    batch->angleEst               = &buffer[0];
+    batch->angleErr               = &buffer[count];
+    batch->speedEstA              = &buffer[2 * count];
+    batch->speedEstB              = &buffer[3 * count];
+    batch->accelEst               = &buffer[4 * count];
+
+    if (!__neqf(config->kp, 0) && !__neqf(config->ki, 0) && !__neqf(config->kp, 0))
+    {   /* all gains are zero, use default */
+        Ifx_AngleTrkF32_setControlGains(&batch->cfgData, ATO_K, ATO_T, ATO_PSI);
+    }
+
+    {
+        Ifx_LowPassPt1F32_Config lpfConfig;
+        lpfConfig.gain            = 1.0F;
+        lpfConfig.cutOffFrequency = (2 * IFX_PI * config->speedLpfFc);
+        lpfConfig.samplingTime    = Ts;
+        Ifx_LowPassPt1F32_initBatch(&batch->speedLpf, &buffer[5 * count], count, &lpfConfig);
+    }
+
+    Ifx_AngleTrkF32_resetBatch(batch);
+}
+
+
+/** \brief Reset the states of a batch of Angle Tracking Observers
+ * \param batch Pointer to the Ifx_AngleTrkF32_Batch object
+ */
+void Ifx_AngleTrkF32_resetBatch(Ifx_AngleTrkF32_Batch *batch)
+{
+    uint16 channel;
+
+    for (channel = 0; channel < batch->count; channel++)
+    {
+        batch->angleErr[channel]  = 0.0F;
+        batch->angleEst[channel]  = 0.0F;
+        batch->accelEst[channel]  = 0.0F;
+        batch->speedEstA[channel] = 0.0F;
+        batch->speedEstB[channel] = 0.0F;
+    }
+
+    Ifx_LowPassPt1F32_resetBatch(&batch->speedLpf);
+}
+
+
+/** \brief Step function of a batch of Angle Tracking Observers, same algorithm as Ifx_AngleTrkF32_step() with a zero phase
+ * \param batch Pointer to the Ifx_AngleTrkF32_Batch object. The angles are stored in batch->angleEst[]
+ * \param sinIn sine input signals, one per channel. The offset shall be zero.
+ * \param cosIn cosine input signals, one per channel. The offset shall be zero.
+ */
+void Ifx_AngleTrkF32_stepBatch(Ifx_AngleTrkF32_Batch *batch, const sint16 *sinIn, const sint16 *cosIn)
+{
+    float32 kp     = batch->cfgData.kp;
+    float32 ki     = batch->cfgData.ki;
+    float32 kd     = batch->cfgData.kd;
+    float32 Ts     = batch->Ts;
+    float32 halfTs = batch->halfTs;
+    uint16  channel;
+
+    for (channel = 0; channel < batch->count; channel++)
+    {
+        float32 angleRef, angleErr, accelEst, speedEstA, dAngle, angleEst;
+
+        if (batch->reversed != FALSE)
+        {
+            angleRef = IFX_ANGLETRKF32_ATAN2F((float32)cosIn[channel], (float32)sinIn[channel]);
+        }
+        else
+        {
+            angleRef = IFX_ANGLETRKF32_ATAN2F((float32)sinIn[channel], (float32)cosIn[channel]);
+        }
+
+        angleErr                   = batch->angleErr[channel];
+        accelEst                   = batch->accelEst[channel] + (ki * angleErr * Ts);
+        speedEstA                  = batch->speedEstA[channel] + (((kp * angleErr) + accelEst) * Ts);
+        dAngle                     = (kd * angleErr) + speedEstA;
+        angleEst                   = Ifx_AngleTrkF32_boundInput(batch->angleEst[channel] + ((dAngle + batch->speedEstB[channel]) * halfTs));
+
+        batch->accelEst[channel]   = accelEst;
+        batch->speedEstA[channel]  = speedEstA;
+        batch->speedEstB[channel]  = dAngle;
+        batch->angleEst[channel]   = angleEst;
+        batch->angleErr[channel]   = Ifx_AngleTrkF32_boundInput(angleRef - angleEst);
+    }
+
+#if IFX_CFG_ANGLETRKF32_SPEED_FILTER
+    Ifx_LowPassPt1F32_doBatch(&batch->speedLpf, batch->speedEstB);
+#endif
+}
+
+
 /** \brief Set the position offset (in ticks)
  * \param aObsv Pointer to the Ifx_AngleTrkF32 object
  * \param offset Position offset in ticks 
@@ -44,6 +44,9 @@
 #define IFX_CFG_ANGLETRKF32_SPEED_FILTER (1)
 #endif
 
+/** \brief Number of float32 elements of the \ref Ifx_AngleTrkF32_Batch buffer */
+#define IFX_ANGLETRKF32_BATCH_BUFFER_SIZE(count) ((5 * (count)) + IFX_LOWPASSPT1F32_BATCH_BUFFER_SIZE(count))
+
 //________________________________________________________________________________________
 // DATA STRUCTURES
 
@@ -108,6 +111,22 @@ typedef struct
     Ifx_LowPassPt1F32       speedLpf; /**< Only used if IFX_CFG_ANGLETRKF32_SPEED_FILTER is set */
 } Ifx_AngleTrkF32;
 
+/** \brief Batch of Angle Tracking Observers with the same configuration, states as structure of arrays */
+typedef struct
+{
+    Ifx_AngleTrkF32_CfgData cfgData;
+    float32                 Ts;        /**< \brief update period in seconds */
+    float32                 halfTs;
+    boolean                 reversed;  /**< \brief TRUE: reversed direction, FALSE: straight direction */
+    uint16                  count;     /**< \brief number of channels */
+    float32                *angleEst;  /**< \brief estimated angle of each channel in radians */
+    float32                *angleErr;
+    float32                *speedEstA;
+    float32                *speedEstB; /**< \brief loop speed of each channel in rad/s */
+    float32                *accelEst;
+    Ifx_LowPassPt1F32_Batch speedLpf;  /**< \brief filtered speed in speedLpf.out[]. Only used if IFX_CFG_ANGLETRKF32_SPEED_FILTER is set */
+} Ifx_AngleTrkF32_Batch;
+
 /** \addtogroup library_srvsw_sysse_math_f32_angletrk
  * \{ */
 
@@ -145,6 +164,29 @@ IFX_EXTERN void    Ifx_AngleTrkF32_updateStatus(Ifx_AngleTrkF32 *aObsv, sint16 s
 IFX_INLINE float32 Ifx_AngleTrkF32_getLoopSpeed(Ifx_AngleTrkF32 *aObsv);
 /** \} */
 
+/** \name Batch functions
+ * Several observers with the same configuration, e.g. one per motor, updated by one call.
+ * The sensor and position interface fields of the configuration are not used.
+ * Example use:
+ * \code
+ * #define RESOLVER_COUNT (4)
+ * sint16                       g_SinInputs[RESOLVER_COUNT], g_CosInputs[RESOLVER_COUNT];
+ * static float32               atoBuffer[IFX_ANGLETRKF32_BATCH_BUFFER_SIZE(RESOLVER_COUNT)];
+ * static Ifx_AngleTrkF32_Batch atoBatch;
+ * Ifx_AngleTrkF32_Config       atoConfig;
+ * Ifx_AngleTrkF32_initConfig(&atoConfig, NULL_PTR, NULL_PTR);
+ * Ifx_AngleTrkF32_initBatch(&atoBatch, atoBuffer, RESOLVER_COUNT, &atoConfig, 100e-6);
+ *
+ * // every period
+ * Ifx_AngleTrkF32_stepBatch(&atoBatch, g_SinInputs, g_CosInputs); // angles in atoBatch.angleEst[]
+ * \endcode
+ * Prototypes:
+ * \{ */
+IFX_EXTERN void Ifx_AngleTrkF32_initBatch(Ifx_AngleTrkF32_Batch *batch, float32 *buffer, uint16 count, const Ifx_AngleTrkF32_Config *config, float32 Ts);
+IFX_EXTERN void Ifx_AngleTrkF32_resetBatch(Ifx_AngleTrkF32_Batch *batch);
+IFX_EXTERN void Ifx_AngleTrkF32_stepBatch(Ifx_AngleTrkF32_Batch *batch, const sint16 *sinIn, const sint16 *cosIn);
+/** \} */
+
 /** \} */
 
 /** \brief get the speed.
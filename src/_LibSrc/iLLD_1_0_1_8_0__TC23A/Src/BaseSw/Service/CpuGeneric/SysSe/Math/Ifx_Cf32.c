@@ -99,6 +99,85 @@ void CplxVecMul_f32(cfloat32 *X, const cfloat32 *mul, short nX)
 }
 
 
+float32 *CplxVecPwr_f32Fast(cfloat32 *X, short nX)
+{
+    float32 *r = (float32 *)X;
+    short    i;
+
+    /* in place: the 4 elements are read before their results are written */
+    for (i = 0; i < (nX - 3); i += 4)
+    {
+        cfloat32 x0 = X[i];
+        cfloat32 x1 = X[i + 1];
+        cfloat32 x2 = X[i + 2];
+        cfloat32 x3 = X[i + 3];
+        r[i]     = IFX_Cf32_dot(&x0);
+        r[i + 1] = IFX_Cf32_dot(&x1);
+        r[i + 2] = IFX_Cf32_dot(&x2);
+        r[i + 3] = IFX_Cf32_dot(&x3);
+    }
+
+    for ( ; i < nX; i++)
+    {
+        cfloat32 x0 = X[i];
+        r[i] = IFX_Cf32_dot(&x0);
+    }
+
+    return r;
+}
+
+
+float32 *CplxVecMag_f32Fast(cfloat32 *X, short nX)
+{
+    float32 *r = CplxVecPwr_f32Fast(X, nX);
+    short    i;
+
+    for (i = 0; i < (nX - 3); i += 4)
+    {
+        float32 p0 = r[i];
+        float32 p1 = r[i + 1];
+        float32 p2 = r[i + 2];
+        float32 p3 = r[i + 3];
+        r[i]     = sqrtf(p0);
+        r[i + 1] = sqrtf(p1);
+        r[i + 2] = sqrtf(p2);
+        r[i + 3] = sqrtf(p3);
+    }
+
+    for ( ; i < nX; i++)
+    {
+        r[i] = sqrtf(r[i]);
+    }
+
+    return r;
+}
+
+
+void CplxVecMul_f32Fast(cfloat32 *restrict X, const cfloat32 *restrict mul, short nX)
+{
+    cfloat32 m = *mul;
+    short    i;
+
+    for (i = 0; i < (nX - 3); i += 4)
+    {
+        cfloat32 x0 = X[i];
+        cfloat32 x1 = X[i + 1];
+        cfloat32 x2 = X[i + 2];
+        cfloat32 x3 = X[i + 3];
+        X[i]     = IFX_Cf32_mul(&x0, &m);
+        X[i + 1] = IFX_Cf32_mul(&x1, &m);
+        X[i + 2] = IFX_Cf32_mul(&x2, &m);
+        X[i + 3] = IFX_Cf32_mul(&x3, &m);
+    }
+
+    for ( ; i < nX; i++)
+    {
+        cfloat32 x0 = X[i];
+        X[i] = IFX_Cf32_mul(&x0, &m);
+    }
+}
+
+
 void VecPwrdB_f32(float32 *X, short nX)
 {
     unsigned short i;
@@ -212,6 +291,50 @@ float32 VecSum_f32(float32 *X, short nX)
 }
 
 
+float32 VecSum_f32Fast(const float32 *X, short nX)
+{
+    float32 s0 = 0.0f, s1 = 0.0f, s2 = 0.0f, s3 = 0.0f;
+    short   i;
+
+    for (i = 0; i < (nX - 3); i += 4)
+    {
+        s0 += X[i];
+        s1 += X[i + 1];
+        s2 += X[i + 2];
+        s3 += X[i + 3];
+    }
+
+    for ( ; i < nX; i++)
+    {
+        s0 += X[i];
+    }
+
+    return (s0 + s1) + (s2 + s3);
+}
+
+
+sint32 VecSum_q15(const sint16 *X, short nX)
+{
+    sint32 s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    short  i;
+
+    for (i = 0; i < (nX - 3); i += 4)
+    {
+        s0 += X[i];
+        s1 += X[i + 1];
+        s2 += X[i + 2];
+        s3 += X[i + 3];
+    }
+
+    for ( ; i < nX; i++)
+    {
+        s0 += X[i];
+    }
+
+    return (s0 + s1) + (s2 + s3);
+}
+
+
 float32 VecAvg_f32(float32 *X, short nX)
 {
     return VecSum_f32(X, nX) / nX;
@@ -248,6 +371,98 @@ float32 VecMin_f32(float32 *X, short nX)
 }
 
 
+float32 VecMax_f32Fast(const float32 *X, short nX)
+{
+    float32 r0 = FLT_MIN, r1 = FLT_MIN, r2 = FLT_MIN, r3 = FLT_MIN;
+    short   i;
+
+    for (i = 0; i < (nX - 3); i += 4)
+    {
+        r0 = __maxf(r0, X[i]);
+        r1 = __maxf(r1, X[i + 1]);
+        r2 = __maxf(r2, X[i + 2]);
+        r3 = __maxf(r3, X[i + 3]);
+    }
+
+    for ( ; i < nX; i++)
+    {
+        r0 = __maxf(r0, X[i]);
+    }
+
+    r0 = __maxf(r0, r1);
+    r2 = __maxf(r2, r3);
+    return __maxf(r0, r2);
+}
+
+
+float32 VecMin_f32Fast(const float32 *X, short nX)
+{
+    float32 r0 = FLT_MAX, r1 = FLT_MAX, r2 = FLT_MAX, r3 = FLT_MAX;
+    short   i;
+
+    for (i = 0; i < (nX - 3); i += 4)
+    {
+        r0 = __minf(r0, X[i]);
+        r1 = __minf(r1, X[i + 1]);
+        r2 = __minf(r2, X[i + 2]);
+        r3 = __minf(r3, X[i + 3]);
+    }
+
+    for ( ; i < nX; i++)
+    {
+        r0 = __minf(r0, X[i]);
+    }
+
+    r0 = __minf(r0, r1);
+    r2 = __minf(r2, r3);
+    return __minf(r0, r2);
+}
+
+
+sint16 VecMax_q15(const sint16 *X, short nX)
+{
+    sint32 r0 = -32768, r1 = -32768, r2 = -32768, r3 = -32768;
+    short  i;
+
+    for (i = 0; i < (nX - 3); i += 4)
+    {
+        r0 = __max(r0, X[i]);
+        r1 = __max(r1, X[i + 1]);
+        r2 = __max(r2, X[i + 2]);
+        r3 = __max(r3, X[i + 3]);
+    }
+
+    for ( ; i < nX; i++)
+    {
+        r0 = __max(r0, X[i]);
+    }
+
+    return (sint16)__max(__max(r0, r1), __max(r2, r3));
+}
+
+
+sint16 VecMin_q15(const sint16 *X, short nX)
+{
+    sint32 r0 = 32767, r1 = 32767, r2 = 32767, r3 = 32767;
+    short  i;
+
+    for (i = 0; i < (nX - 3); i += 4)
+    {
+        r0 = __min(r0, X[i]);
+        r1 = __min(r1, X[i + 1]);
+        r2 = __min(r2, X[i + 2]);
+        r3 = __min(r3, X[i + 3]);
+    }
+
+    for ( ; i < nX; i++)
+    {
+        r0 = __min(r0, X[i]);
+    }
+
+    return (sint16)__min(__min(r0, r1), __min(r2, r3));
+}
+
+
 void VecHalfSwap_f32(float32 *X, short nX)
 {
     unsigned short i;
@@ -293,6 +508,42 @@ void VecWin_f32(float32 *X, const float32 *W, short nX, short nW, short incrX, s
 }
 
 
+/* Same NOTE as VecWin_f32() */
+void VecWin_f32Fast(float32 *restrict X, const float32 *restrict W, short nX, short nW, short incrX, short symW)
+{
+    short step = nW / nX;
+    short half = nX / 2;
+    short i;
+
+    if (symW != 0)
+    {   /* symmetrical window: the 2 halves are processed together, the element i of the first half
+         * and the element (nX - 1 - i) of the second half use the same window coefficient */
+        float32 *Y = &X[(nX - 1) * incrX];
+
+        for (i = 0; i < (half - 1); i += 2)
+        {
+            float32 w0 = W[i * step];
+            float32 w1 = W[(i + 1) * step];
+            float32 x0 = X[i * incrX];
+            float32 x1 = X[(i + 1) * incrX];
+            float32 y0 = Y[-i * incrX];
+            float32 y1 = Y[-(i + 1) * incrX];
+            X[i * incrX]        = x0 * w0;
+            X[(i + 1) * incrX]  = x1 * w1;
+            Y[-i * incrX]       = y0 * w0;
+            Y[-(i + 1) * incrX] = y1 * w1;
+        }
+
+        for ( ; i < half; i++)
+        {
+            float32 w0 = W[i * step];
+            X[i * incrX]  = X[i * incrX] * w0;
+            Y[-i * incrX] = Y[-i * incrX] * w0;
+        }
+    }
+}
+
+
 #ifdef __WIN32__
 
 void DataF_printf(FILE *fp, pchar fileName, float32 *data, long nX, int enclosed)
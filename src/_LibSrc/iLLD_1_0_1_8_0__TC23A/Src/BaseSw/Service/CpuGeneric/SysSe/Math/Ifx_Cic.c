@@ -0,0 +1,84 @@
+/**
+ * \file Ifx_Cic.c
+ * \brief CIC decimation filter
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+//------------------------------------------------------------------------------
+#include "SysSe/Math/Ifx_Cic.h"
+//------------------------------------------------------------------------------
+
+/** \brief Set the CIC filter configuration
+ *
+ * This function sets the CIC filter configuration and resets the filter stages.
+ *
+ * \param filter Specifies CIC filter.
+ * \param config Specifies the CIC filter configuration.
+ *
+ * \return Returns TRUE if the configuration is valid, else FALSE
+ */
+boolean Ifx_Cic_init(Ifx_Cic *filter, const Ifx_Cic_Config *config)
+{
+    uint8 stage;
+
+    if ((config->order == 0) || (config->order > IFX_CFG_CIC_MAX_ORDER) || (config->ratio == 0))
+    {
+        return FALSE;
+    }
+
+    filter->order = config->order;
+    filter->ratio = config->ratio;
+    filter->gain  = 1;
+
+    for (stage = 0; stage < filter->order; stage++)
+    {
+        if ((filter->gain * (uint64)filter->ratio) > 0xFFFFFFFFU)
+        {
+            return FALSE;
+        }
+
+        filter->gain *= filter->ratio;
+    }
+
+    Ifx_Cic_reset(filter);
+    return TRUE;
+}
+
+
+/** \brief Reset the filter stages
+ *
+ * The next output is available after R inputs. The first N outputs are part of the settling.
+ *
+ * \param filter Specifies CIC filter.
+ *
+ * \return None
+ */
+void Ifx_Cic_reset(Ifx_Cic *filter)
+{
+    uint8 stage;
+
+    for (stage = 0; stage < IFX_CFG_CIC_MAX_ORDER; stage++)
+    {
+        filter->integrator[stage] = 0;
+        filter->comb[stage]       = 0;
+    }
+
+    filter->phase = 0;
+}
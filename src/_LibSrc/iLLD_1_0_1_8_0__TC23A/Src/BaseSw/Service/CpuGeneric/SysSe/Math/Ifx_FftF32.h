@@ -25,6 +25,29 @@
  *
  * \defgroup library_srvsw_sysse_math_f32_fft Floating-point FFT
  * This module implements the Fast Fourier Transform in single precision floating-point
+ *
+ * \ref Ifx_FftF32_radix4() computes the same transform as \ref Ifx_FftF32_radix2() with radix-4
+ * butterflies: 3 instead of 4 complex multiplications per 4 points and half the passes over the data.
+ * Lengths which are not a power of 4 start with one radix-2 pass.
+ * The twiddle factors are read from a table generated for the transform length by
+ * \ref Ifx_FftF32_generateTwiddleFactor(), which is nX / 2 entries long, instead of walking
+ * \ref Ifx_g_FftF32_twiddleTable with a stride of \ref IFX_FFTF32_MAX_LENGTH / nX:
+ * \code
+ * static cfloat32 twiddle[1024 / 2];
+ * static cfloat32 spectrum[1024];
+ *
+ * // initialisation
+ * Ifx_FftF32_generateTwiddleFactor(twiddle, 1024);
+ *
+ * // transform
+ * Ifx_FftF32_radix4(spectrum, samples, 1024, twiddle);
+ * \endcode
+ *
+ * \ref Ifx_FftF32_real() transforms nX real samples with a complex FFT of nX / 2 points: the even
+ * samples are the real part, the odd samples the imaginary part of its input, the spectrum is then
+ * split by a post-twiddle pass. It returns the nX / 2 + 1 bins from DC to half of the sampling
+ * frequency, the other bins are the complex conjugates. For fixed-point input see
+ * \ref library_srvsw_sysse_math_fxp_fft.
  * \ingroup library_srvsw_sysse_math_f32
  *
  */
@@ -64,6 +87,32 @@ IFX_EXTERN cfloat32 *Ifx_FftF32_radix2(cfloat32 *R, const cfloat32 *X, uint16 nX
 /** \brief Radix-2 Inverse Fast-Fourier Transform */
 IFX_EXTERN cfloat32 *Ifx_FftF32_radix2I(cfloat32 *R, const cfloat32 *X, uint16 nX);
 
+/** \brief Radix-4 Fast-Fourier Transform
+ * \param R Result, nX elements
+ * \param X Input, nX elements
+ * \param nX Transform length, power of 2, up to \ref IFX_FFTF32_MAX_LENGTH
+ * \param TF Twiddle factors for nX generated by \ref Ifx_FftF32_generateTwiddleFactor(). If NULL_PTR, \ref Ifx_g_FftF32_twiddleTable is used
+ * \return R */
+IFX_EXTERN cfloat32 *Ifx_FftF32_radix4(cfloat32 *R, const cfloat32 *X, uint16 nX, const cfloat32 *TF);
+
+/** \brief Radix-4 Inverse Fast-Fourier Transform, see \ref Ifx_FftF32_radix4() */
+IFX_EXTERN cfloat32 *Ifx_FftF32_radix4I(cfloat32 *R, const cfloat32 *X, uint16 nX, const cfloat32 *TF);
+
+/** \brief Radix-4 passes of \ref Ifx_FftF32_radix4() on bit-reversed data, in place
+ * \param R Data, 2^p elements, in bit-reversed order
+ * \param p Number of radix-2 stages
+ * \param TF Twiddle factor table of the first nTF / 2 factors W_nTF^i
+ * \param nTF Twiddle factor table length, 2^p or a multiple of it */
+IFX_EXTERN void Ifx_FftF32_radix4DecimationInTime(cfloat32 *R, uint32 p, const cfloat32 *TF, uint32 nTF);
+
+/** \brief Fast-Fourier Transform of real samples
+ * \param R Result, nX / 2 + 1 elements: bins 0 .. nX / 2
+ * \param X Real input, nX elements
+ * \param nX Transform length, power of 2, from 2 up to \ref IFX_FFTF32_MAX_LENGTH
+ * \param TF Twiddle factors for nX generated by \ref Ifx_FftF32_generateTwiddleFactor(). If NULL_PTR, \ref Ifx_g_FftF32_twiddleTable is used
+ * \return R */
+IFX_EXTERN cfloat32 *Ifx_FftF32_real(cfloat32 *R, const float32 *X, uint16 nX, const cfloat32 *TF);
+
 /** \} */
 //----------------------------------------------------------------------------------------
 /** \name Utility functions
@@ -85,6 +134,25 @@ IFX_INLINE cfloat32 Ifx_FftF32_lookUpTwiddleFactor(sint32 N, sint32 k)
 }
 
 
+/** \brief Twiddle factor W_N^i for 0 <= i < N from a table TF of the first N / 2 factors, e.g. generated by \ref Ifx_FftF32_generateTwiddleFactor() */
+IFX_INLINE cfloat32 Ifx_FftF32_getTwiddleFactor(const cfloat32 *TF, unsigned long N, unsigned long i)
+{
+    cfloat32 w;
+
+    if (i < (N / 2))
+    {
+        w = TF[i];
+    }
+    else
+    {   /* W_N^i = -W_N^(i - N/2) */
+        w.real = -TF[i - (N / 2)].real;
+        w.imag = -TF[i - (N / 2)].imag;
+    }
+
+    return w;
+}
+
+
 /** \brief Calculate the bit-reversed \<n\> with \<bits\> as number of bits */
 IFX_EXTERN uint16 Ifx_FftF32_reverseBits(uint16 n, unsigned bits);
 
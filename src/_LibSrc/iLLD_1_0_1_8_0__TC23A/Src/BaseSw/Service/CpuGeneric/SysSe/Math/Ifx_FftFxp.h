@@ -0,0 +1,112 @@
+/**
+ * \file Ifx_FftFxp.h
+ * \brief Fixed-point Fast Fourier Transform
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_math_fxp_fft Fixed-point FFT
+ * This module implements the Fast Fourier Transform in Q15 and Q31 fixed-point, e.g. directly on
+ * ADC result blocks without a conversion to float32.
+ *
+ * The transforms are radix-2 decimation in time, the bit reversal uses
+ * \ref Ifx_g_FftF32_bitReverseTable. Each pass halves its result to avoid overflows: the results
+ * are the spectrum divided by nX, the input magnitude must not exceed 1.
+ * The complex multiplications are written as 16 x 16 bit (Q15) and 32 x 32 bit (Q31) integer
+ * multiply-accumulates, which the compilers map to the MADD / MUL DSP instructions.
+ *
+ * \ref Ifx_FftFxp_realQ15() transforms nX real samples with a complex transform of nX / 2 points
+ * and a post-twiddle pass, see \ref Ifx_FftF32_real(). It removes an offset from the samples and
+ * shifts them to Q15 while arranging them in bit-reversed order, e.g. for 12-bit VADC results:
+ * \code
+ * static csint16 twiddle[1024 / 2];
+ * static csint16 spectrum[1024 / 2 + 1];
+ *
+ * // initialisation
+ * Ifx_FftFxp_generateTwiddleFactorQ15(twiddle, 1024);
+ *
+ * // transform of a DMA block of 1024 results, 0x800 is the zero, shifted from 12 to 16 bits
+ * Ifx_FftFxp_realQ15(spectrum, (const sint16 *)resultBlock, 1024, twiddle, 0x800, 4);
+ * \endcode
+ *
+ * The twiddle factor tables are nX / 2 elements long and generated once per transform length from
+ * \ref Ifx_g_FftF32_twiddleTable.
+ *
+ * \ingroup library_srvsw_sysse_math
+ *
+ */
+
+#ifndef IFX_FFTFXP_H
+#define IFX_FFTFXP_H
+
+#include "Ifx_FftF32.h"
+
+//----------------------------------------------------------------------------------------
+/** \addtogroup library_srvsw_sysse_math_fxp_fft
+ * \{ */
+
+/** \name Twiddle factor functions
+ * \{ */
+
+/** \brief Generate the Q15 twiddle factors for nX
+ * \param TF Twiddle factors, nX / 2 elements
+ * \param nX Transform length, power of 2, up to \ref IFX_FFTF32_MAX_LENGTH
+ * \return TF */
+IFX_EXTERN csint16 *Ifx_FftFxp_generateTwiddleFactorQ15(csint16 *TF, uint16 nX);
+
+/** \brief Generate the Q31 twiddle factors for nX
+ * \param TF Twiddle factors, nX / 2 elements
+ * \param nX Transform length, power of 2, up to \ref IFX_FFTF32_MAX_LENGTH
+ * \return TF */
+IFX_EXTERN csint32 *Ifx_FftFxp_generateTwiddleFactorQ31(csint32 *TF, uint16 nX);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+/** \name Transform functions
+ * \{ */
+
+/** \brief Radix-2 Fast-Fourier Transform in Q15
+ * \param R Result divided by nX, nX elements
+ * \param X Input, nX elements
+ * \param nX Transform length, power of 2, up to \ref IFX_FFTF32_MAX_LENGTH
+ * \param TF Twiddle factors generated by \ref Ifx_FftFxp_generateTwiddleFactorQ15()
+ * \return R */
+IFX_EXTERN csint16 *Ifx_FftFxp_radix2Q15(csint16 *R, const csint16 *X, uint16 nX, const csint16 *TF);
+
+/** \brief Radix-2 Fast-Fourier Transform in Q31
+ * \param R Result divided by nX, nX elements
+ * \param X Input, nX elements
+ * \param nX Transform length, power of 2, up to \ref IFX_FFTF32_MAX_LENGTH
+ * \param TF Twiddle factors generated by \ref Ifx_FftFxp_generateTwiddleFactorQ31()
+ * \return R */
+IFX_EXTERN csint32 *Ifx_FftFxp_radix2Q31(csint32 *R, const csint32 *X, uint16 nX, const csint32 *TF);
+
+/** \brief Fast-Fourier Transform of real samples in Q15
+ * \param R Result divided by nX, nX / 2 + 1 elements: bins 0 .. nX / 2
+ * \param X Real input, nX elements. The Q15 sample is (X[n] - offset) << shift, saturated
+ * \param nX Transform length, power of 2, from 2 up to \ref IFX_FFTF32_MAX_LENGTH
+ * \param TF Twiddle factors for nX generated by \ref Ifx_FftFxp_generateTwiddleFactorQ15()
+ * \param offset Offset removed from the samples, e.g. the ADC result at zero input
+ * \param shift Left shift of the samples to Q15, e.g. 4 for 12-bit ADC results
+ * \return R */
+IFX_EXTERN csint16 *Ifx_FftFxp_realQ15(csint16 *R, const sint16 *X, uint16 nX, const csint16 *TF, sint16 offset, uint8 shift);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+/** \} */
+
+#endif /* IFX_FFTFXP_H */
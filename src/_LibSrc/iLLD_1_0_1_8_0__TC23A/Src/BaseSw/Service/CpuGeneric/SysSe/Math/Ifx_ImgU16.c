@@ -0,0 +1,397 @@
+/**
+ * \file Ifx_ImgU16.c
+ * \brief Image kernels for line scan and small uint16 frames
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+//------------------------------------------------------------------------------
+#include "SysSe/Math/Ifx_ImgU16.h"
+//------------------------------------------------------------------------------
+
+/** Pixel pair with the same value in both halfwords */
+#define IFX_IMGU16_PAIR(value) (((uint32)(value) & 0xFFFFU) * 0x00010001U)
+
+/** 1/3 in Q15, both halfwords */
+#define IFX_IMGU16_ONE_THIRD   (0x2AAB2AABU)
+
+/** Kernels of \ref Ifx_ImgU16_filterRow() */
+typedef enum
+{
+    Ifx_ImgU16_Kernel_box3,
+    Ifx_ImgU16_Kernel_gauss3,
+    Ifx_ImgU16_Kernel_gradient
+} Ifx_ImgU16_Kernel;
+
+/******************************************************************************/
+/** Return the word index of a row, the words outside of the row repeat the first, respectively last pixel */
+IFX_INLINE uint32 Ifx_ImgU16_getWord(const uint32 *row, sint32 index, uint16 words)
+{
+    uint32 word;
+
+    if (index < 0)
+    {
+        word = IFX_IMGU16_PAIR(row[0]);
+    }
+    else if (index >= words)
+    {
+        word = IFX_IMGU16_PAIR(row[words - 1] >> 16);
+    }
+    else
+    {
+        word = row[index];
+    }
+
+    return word;
+}
+
+
+/** Return the pixel pair between two consecutive words: upper pixel of left, lower pixel of right */
+IFX_INLINE uint32 Ifx_ImgU16_getMiddlePair(uint32 left, uint32 right)
+{
+    return (left >> 16) | (right << 16);
+}
+
+
+/** [1 2 1] / 4 with rounding on pixel pairs */
+IFX_INLINE uint32 Ifx_ImgU16_gauss3(uint32 left, uint32 center, uint32 right)
+{
+    uint32 sum = __addh(__addh(left, right), __addh(center, center));
+
+    return (__addh(sum, 0x00020002U) >> 2) & 0x3FFF3FFFU;
+}
+
+
+/** Apply a 3 taps kernel to one row, in place if dst == src
+ *
+ * Called with a constant kernel, the switch is resolved at compile time.
+ */
+IFX_INLINE void Ifx_ImgU16_filterRow(uint32 *dst, const uint32 *src, uint16 words, Ifx_ImgU16_Kernel kernel)
+{
+    uint32 left   = IFX_IMGU16_PAIR(src[0]);
+    uint32 center = src[0];
+    uint16 index;
+
+    for (index = 0; index < words; index++)
+    {
+        uint32 right = Ifx_ImgU16_getWord(src, index + 1, words);
+        uint32 prev  = Ifx_ImgU16_getMiddlePair(left, center);    /* pixels 2 * index - 1, 2 * index */
+        uint32 next  = Ifx_ImgU16_getMiddlePair(center, right);   /* pixels 2 * index + 1, 2 * index + 2 */
+
+        switch (kernel)
+        {
+        case Ifx_ImgU16_Kernel_box3:
+            dst[index] = __mulrh(__addh(__addh(prev, center), next), IFX_IMGU16_ONE_THIRD);
+            break;
+        case Ifx_ImgU16_Kernel_gauss3:
+            dst[index] = Ifx_ImgU16_gauss3(prev, center, next);
+            break;
+        default:
+            dst[index] = __subh(next, prev);
+            break;
+        }
+
+        left   = center;
+        center = right;
+    }
+}
+
+
+/** Apply the 3 taps kernel to each row of the frame */
+static void Ifx_ImgU16_filter(uint32 *dst, const uint32 *src, uint16 width, uint16 rows, Ifx_ImgU16_Kernel kernel)
+{
+    uint16 words = width / 2;
+    uint16 row;
+
+    for (row = 0; row < rows; row++)
+    {
+        switch (kernel)
+        {
+        case Ifx_ImgU16_Kernel_box3:
+            Ifx_ImgU16_filterRow(&dst[row * words], &src[row * words], words, Ifx_ImgU16_Kernel_box3);
+            break;
+        case Ifx_ImgU16_Kernel_gauss3:
+            Ifx_ImgU16_filterRow(&dst[row * words], &src[row * words], words, Ifx_ImgU16_Kernel_gauss3);
+            break;
+        default:
+            Ifx_ImgU16_filterRow(&dst[row * words], &src[row * words], words, Ifx_ImgU16_Kernel_gradient);
+            break;
+        }
+    }
+}
+
+
+/******************************************************************************/
+
+/** \brief Smooth each row with a box filter of 3 pixels
+ *
+ * dst[i] = (src[i - 1] + src[i] + src[i + 1]) / 3, rounded.
+ *
+ * \param dst Specifies the output frame, may be src.
+ * \param src Specifies the input frame.
+ * \param width Specifies the number of pixels per row, even.
+ * \param rows Specifies the number of rows, 1 for a line scan frame.
+ *
+ * \return None
+ */
+void Ifx_ImgU16_smoothBox3(uint16 *dst, const uint16 *src, uint16 width, uint16 rows)
+{
+    Ifx_ImgU16_filter((uint32 *)dst, (const uint32 *)src, width, rows, Ifx_ImgU16_Kernel_box3);
+}
+
+
+/** \brief Smooth each row with a Gaussian filter of 3 pixels
+ *
+ * dst[i] = (src[i - 1] + 2 * src[i] + src[i + 1]) / 4, rounded.
+ *
+ * \param dst Specifies the output frame, may be src.
+ * \param src Specifies the input frame.
+ * \param width Specifies the number of pixels per row, even.
+ * \param rows Specifies the number of rows, 1 for a line scan frame.
+ *
+ * \return None
+ */
+void Ifx_ImgU16_smoothGauss3(uint16 *dst, const uint16 *src, uint16 width, uint16 rows)
+{
+    Ifx_ImgU16_filter((uint32 *)dst, (const uint32 *)src, width, rows, Ifx_ImgU16_Kernel_gauss3);
+}
+
+
+/** \brief Smooth a 2-D frame with a Gaussian filter of 3 x 3 pixels
+ *
+ * The rows are filtered by \ref Ifx_ImgU16_smoothGauss3(), then the columns with the same
+ * kernel. The columns are processed as pairs of adjacent columns, they need no pixel shuffling.
+ *
+ * \param dst Specifies the output frame, may be src.
+ * \param src Specifies the input frame.
+ * \param width Specifies the number of pixels per row, even.
+ * \param rows Specifies the number of rows.
+ *
+ * \return None
+ */
+void Ifx_ImgU16_smoothGauss3x3(uint16 *dst, const uint16 *src, uint16 width, uint16 rows)
+{
+    uint32 *frame = (uint32 *)dst;
+    uint16  words = width / 2;
+    uint16  column;
+    uint16  row;
+
+    Ifx_ImgU16_smoothGauss3(dst, src, width, rows);
+
+    for (column = 0; column < words; column++)
+    {
+        uint32 above = frame[column];
+
+        for (row = 0; row < rows; row++)
+        {
+            uint32 center = frame[(row * words) + column];
+            uint32 below  = (row < (rows - 1)) ? frame[((row + 1) * words) + column] : center;
+
+            frame[(row * words) + column] = Ifx_ImgU16_gauss3(above, center, below);
+            above                         = center;
+        }
+    }
+}
+
+
+/** \brief Compute the gradient of each row
+ *
+ * dst[i] = src[i + 1] - src[i - 1]. A falling edge (bright to dark) gives a
+ * negative gradient, a rising edge a positive one.
+ *
+ * \param dst Specifies the output frame, may be src.
+ * \param src Specifies the input frame.
+ * \param width Specifies the number of pixels per row, even.
+ * \param rows Specifies the number of rows, 1 for a line scan frame.
+ *
+ * \return None
+ */
+void Ifx_ImgU16_gradient(sint16 *dst, const uint16 *src, uint16 width, uint16 rows)
+{
+    Ifx_ImgU16_filter((uint32 *)dst, (const uint32 *)src, width, rows, Ifx_ImgU16_Kernel_gradient);
+}
+
+
+/** \brief Keep the pixels which differ from their local mean by more than offset
+ *
+ * The local mean of pixel i is the mean of the window src[i - 2^(windowShift - 1)] ..
+ * src[i + 2^(windowShift - 1) - 1], so that the threshold follows an uneven illumination.
+ * - Ifx_ImgU16_Polarity_dark: dst[i] = max(mean - offset - src[i], 0)
+ * - Ifx_ImgU16_Polarity_bright: dst[i] = max(src[i] - mean - offset, 0)
+ *
+ * The non zero pixels are the features, their values weight the position in
+ * \ref Ifx_ImgU16_centroid(). The window sum is updated with one packed addition and one packed
+ * subtraction per pixel pair, whatever the window size.
+ *
+ * The pixel values shall be lower than 2^(16 - windowShift) (12 bit ADC results fit with the
+ * window of 16 pixels), the pixel values plus offset lower than 2^16.
+ *
+ * \param dst Specifies the output frame, may be src.
+ * \param src Specifies the input frame.
+ * \param width Specifies the number of pixels per row, even.
+ * \param rows Specifies the number of rows, 1 for a line scan frame.
+ * \param windowShift Specifies the window size: 2^windowShift pixels,
+ * \ref IFX_IMGU16_MIN_WINDOW_SHIFT .. \ref IFX_IMGU16_MAX_WINDOW_SHIFT.
+ * \param offset Specifies the minimal difference to the local mean.
+ * \param polarity Specifies the features kept.
+ *
+ * \return Returns FALSE if windowShift is not supported, else TRUE
+ */
+boolean Ifx_ImgU16_thresholdAdaptive(uint16 *dst, const uint16 *src, uint16 width, uint16 rows, uint8 windowShift, uint16 offset, Ifx_ImgU16_Polarity polarity)
+{
+    uint32 history[1 << (IFX_IMGU16_MAX_WINDOW_SHIFT - 1)];
+    uint32 offsetPair = IFX_IMGU16_PAIR(offset);
+    uint32 meanMask   = IFX_IMGU16_PAIR(0xFFFFU >> windowShift);
+    sint32 halfWords  = 1 << (windowShift - 2);    /* half window in words */
+    sint32 ringMask   = (2 * halfWords) - 1;
+    uint16 words      = width / 2;
+    uint16 row;
+    sint32 index;
+
+    if ((windowShift < IFX_IMGU16_MIN_WINDOW_SHIFT) || (windowShift > IFX_IMGU16_MAX_WINDOW_SHIFT))
+    {
+        return FALSE;
+    }
+
+    for (row = 0; row < rows; row++)
+    {
+        const uint32 *in  = &((const uint32 *)src)[row * words];
+        uint32       *out = &((uint32 *)dst)[row * words];
+        uint32        sum = 0;
+
+        /* history[] holds the sums of two consecutive pixel pairs of the window: the pixels 2 * i .. 2 * i + 1
+         * in the lower halfword, 2 * i + 1 .. 2 * i + 2 in the upper halfword */
+        for (index = -halfWords; index < halfWords; index++)
+        {
+            uint32 word = Ifx_ImgU16_getWord(in, index, words);
+            uint32 pair = __addh(word, Ifx_ImgU16_getMiddlePair(word, Ifx_ImgU16_getWord(in, index + 1, words)));
+
+            history[index & ringMask] = pair;
+            sum                       = __addh(sum, pair);
+        }
+
+        for (index = 0; index < words; index++)
+        {
+            /* the words ahead of index are read before out[index] is written */
+            uint32 word  = Ifx_ImgU16_getWord(in, index + halfWords, words);
+            uint32 pair  = __addh(word, Ifx_ImgU16_getMiddlePair(word, Ifx_ImgU16_getWord(in, index + halfWords + 1, words)));
+            uint32 pixel = in[index];
+            uint32 mean  = (sum >> windowShift) & meanMask;
+
+            if (polarity == Ifx_ImgU16_Polarity_dark)
+            {
+                out[index] = __subh(mean, __minhu(__addh(pixel, offsetPair), mean));
+            }
+            else
+            {
+                uint32 threshold = __addh(mean, offsetPair);
+                out[index] = __subh(pixel, __minhu(pixel, threshold));
+            }
+
+            sum                                       = __addh(__subh(sum, history[(index - halfWords) & ringMask]), pair);
+            history[(index + halfWords) & ringMask]   = pair;
+        }
+    }
+
+    return TRUE;
+}
+
+
+/** \brief Find the minimal and maximal pixels
+ *
+ * The extremes are searched on pixel pairs with __minhu() (the maximum as minimum of the
+ * complemented pixels), then the first index of each extreme is searched.
+ *
+ * \param src Specifies the pixels.
+ * \param count Specifies the number of pixels, at least 1.
+ * \param result Returns the extremes and their index.
+ *
+ * \return None
+ */
+void Ifx_ImgU16_findMinMax(const uint16 *src, uint16 count, Ifx_ImgU16_MinMax *result)
+{
+    const uint32 *words        = (const uint32 *)src;
+    uint32        minPair      = 0xFFFFFFFFU;
+    uint32        invMaxPair   = 0xFFFFFFFFU;   /* minimum of the complemented pixels */
+    uint16        index;
+
+    for (index = 0; index < (count / 2); index++)
+    {
+        minPair    = __minhu(minPair, words[index]);
+        invMaxPair = __minhu(invMaxPair, ~words[index]);
+    }
+
+    if ((count & 1) != 0)
+    {
+        minPair    = __minhu(minPair, IFX_IMGU16_PAIR(src[count - 1]));
+        invMaxPair = __minhu(invMaxPair, IFX_IMGU16_PAIR(~src[count - 1]));
+    }
+
+    result->min = (uint16)__minu(minPair & 0xFFFFU, minPair >> 16);
+    result->max = (uint16)~__minu(invMaxPair & 0xFFFFU, invMaxPair >> 16);
+
+    for (index = 0; src[index] != result->min; index++)
+    {}
+
+    result->minIndex = index;
+
+    for (index = 0; src[index] != result->max; index++)
+    {}
+
+    result->maxIndex = index;
+}
+
+
+/** \brief Compute the centroid of the pixels
+ *
+ * position = sum(i * src[i]) / sum(src[i]), typically on the output of
+ * \ref Ifx_ImgU16_thresholdAdaptive() to get the position of a line with sub-pixel resolution.
+ *
+ * \param src Specifies the pixels, aligned on 4 bytes.
+ * \param count Specifies the number of pixels, even.
+ * \param position Returns the centroid in pixels, 0 .. count - 1. Only written if TRUE is returned
+ *
+ * \return Returns FALSE if all pixels are 0, else TRUE
+ */
+boolean Ifx_ImgU16_centroid(const uint16 *src, uint16 count, float32 *position)
+{
+    const uint32 *words  = (const uint32 *)src;
+    uint32        sum    = 0;
+    uint64        moment = 0;
+    uint16        index;
+
+    for (index = 0; index < (count / 2); index++)
+    {
+        uint32 lower = words[index] & 0xFFFFU;
+        uint32 upper = words[index] >> 16;
+        uint32 pixel = 2 * (uint32)index;
+
+        sum    += lower + upper;
+        moment += pixel * lower;
+        moment += (pixel + 1) * upper;
+    }
+
+    if (sum == 0)
+    {
+        return FALSE;
+    }
+
+    *position = (float32)moment / (float32)sum;
+    return TRUE;
+}
@@ -0,0 +1,102 @@
+/**
+ * \file Ifx_ImgU16.h
+ * \brief Image kernels for line scan and small uint16 frames
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_math_imgu16 Image kernels uint16
+ * This module implements image kernels on frames of uint16 pixels, e.g. ADC results of a line
+ * scan camera (1-D frame, one row) or of a small sensor array (2-D frame, rows of width pixels
+ * stored one after the other).
+ *
+ * The filter kernels work on pixel pairs: one 32 bit load, one packed halfword instruction
+ * (__addh(), __subh(), __mulrh(), __minhu()) and one 32 bit store process two pixels. The
+ * neighbour pairs are built from the loaded words, each pixel is read once. The pixels
+ * outside of a row are replaced by the first, respectively last pixel of the row.
+ *
+ * The kernels can work in place (dst == src): each word is read before its result is stored,
+ * so that the frame can be processed in the buffer it was acquired in.
+ *
+ * Restrictions:
+ * - the frames shall be aligned on 4 bytes and the width shall be even (not checked).
+ * - the pixel values shall be lower than 2^13 for the box filter, 2^14 for the Gaussian filter
+ * and 2^15 for the gradient (12 bit ADC results fit), see \ref Ifx_ImgU16_thresholdAdaptive()
+ * for the threshold. There is no saturation, larger values wrap around in the halfword.
+ *
+ * Usage example:
+ * \code
+ * static uint16            line[128];
+ * Ifx_ImgU16_MinMax        minMax;
+ * float32                  position;
+ *
+ * // every frame, after the pixels are copied into line[]
+ * Ifx_ImgU16_smoothGauss3(line, line, 128, 1);
+ * Ifx_ImgU16_findMinMax(line, 128, &minMax);
+ * Ifx_ImgU16_thresholdAdaptive(line, line, 128, 1, 4, 100, Ifx_ImgU16_Polarity_dark);
+ *
+ * if (Ifx_ImgU16_centroid(line, 128, &position) != FALSE)
+ * {
+ *     // dark line found at position (pixels)
+ * }
+ * \endcode
+ *
+ * \ingroup library_srvsw_sysse_math
+ *
+ */
+
+#if !defined(IFX_IMGU16_H)
+#define IFX_IMGU16_H
+//------------------------------------------------------------------------------
+#include "Cpu/Std/Ifx_Types.h"
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+//------------------------------------------------------------------------------
+
+#define IFX_IMGU16_MIN_WINDOW_SHIFT (2)     /**< \brief Minimal window of \ref Ifx_ImgU16_thresholdAdaptive(): 4 pixels */
+#define IFX_IMGU16_MAX_WINDOW_SHIFT (4)     /**< \brief Maximal window of \ref Ifx_ImgU16_thresholdAdaptive(): 16 pixels */
+
+/** \brief Polarity of the features kept by \ref Ifx_ImgU16_thresholdAdaptive() */
+typedef enum
+{
+    Ifx_ImgU16_Polarity_dark   = 0,  /**< \brief pixels darker than the local mean, e.g. a black line on a white track */
+    Ifx_ImgU16_Polarity_bright = 1   /**< \brief pixels brighter than the local mean */
+} Ifx_ImgU16_Polarity;
+
+/** \brief Result of \ref Ifx_ImgU16_findMinMax() */
+typedef struct
+{
+    uint16 min;              /**< \brief minimal pixel value */
+    uint16 max;              /**< \brief maximal pixel value */
+    uint16 minIndex;         /**< \brief index of the first minimal pixel */
+    uint16 maxIndex;         /**< \brief index of the first maximal pixel */
+} Ifx_ImgU16_MinMax;
+
+//------------------------------------------------------------------------------
+
+/** \addtogroup  library_srvsw_sysse_math_imgu16
+ * \{ */
+IFX_EXTERN void    Ifx_ImgU16_smoothBox3(uint16 *dst, const uint16 *src, uint16 width, uint16 rows);
+IFX_EXTERN void    Ifx_ImgU16_smoothGauss3(uint16 *dst, const uint16 *src, uint16 width, uint16 rows);
+IFX_EXTERN void    Ifx_ImgU16_smoothGauss3x3(uint16 *dst, const uint16 *src, uint16 width, uint16 rows);
+IFX_EXTERN void    Ifx_ImgU16_gradient(sint16 *dst, const uint16 *src, uint16 width, uint16 rows);
+IFX_EXTERN boolean Ifx_ImgU16_thresholdAdaptive(uint16 *dst, const uint16 *src, uint16 width, uint16 rows, uint8 windowShift, uint16 offset, Ifx_ImgU16_Polarity polarity);
+IFX_EXTERN void    Ifx_ImgU16_findMinMax(const uint16 *src, uint16 count, Ifx_ImgU16_MinMax *result);
+IFX_EXTERN boolean Ifx_ImgU16_centroid(const uint16 *src, uint16 count, float32 *position);
+/** \} */
+
+//------------------------------------------------------------------------------
+#endif
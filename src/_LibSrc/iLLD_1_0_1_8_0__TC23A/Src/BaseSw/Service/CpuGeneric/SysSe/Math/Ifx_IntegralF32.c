@@ -46,6 +46,42 @@ float32 Ifx_IntegralF32_step(Ifx_IntegralF32 *ci, float32 ik)
 }
 
 
+void Ifx_IntegralQ31_reset(Ifx_IntegralQ31 *ci)
+{
+    ci->uk = 0;
+    ci->ik = 0;
+}
+
+
+void Ifx_IntegralQ31_init(Ifx_IntegralQ31 *ci, float32 gain, float32 Ts)
+{
+    float32 delta = gain * Ts / 2 * 2147483648.0f;
+
+    if (delta >= 2147483647.0f)
+    {
+        ci->delta = 0x7FFFFFFF;
+    }
+    else if (delta <= -2147483648.0f)
+    {
+        ci->delta = (sint32)0x80000000;
+    }
+    else
+    {
+        ci->delta = (sint32)delta;
+    }
+}
+
+
+sint32 Ifx_IntegralQ31_step(Ifx_IntegralQ31 *ci, sint32 ik)
+{
+    /* (ik + ikOld) * delta as two products: the input sum would overflow Q31 */
+    ci->uk = __adds(ci->uk, __adds(__mulfractlong(ci->delta, ik), __mulfractlong(ci->delta, ci->ik)));
+    ci->ik = ik;
+
+    return ci->uk;
+}
+
+
 void Ifx_ClpxFloat32_Integral_reset(Ifx_ClpxFloat32_Integral *ci)
 {
     ci->uk.real = 0;
@@ -70,3 +106,132 @@ cfloat32 Ifx_ClpxFloat32_Integral_step(Ifx_ClpxFloat32_Integral *ci, cfloat32 ik
 
     return ci->uk;
 }
+
+
+void Ifx_IntegralF32_resetBatch(Ifx_IntegralF32_Batch *batch)
+{
+    uint16 channel;
+
+    for (channel = 0; channel < batch->count; channel++)
+    {
+        batch->uk[channel] = 0;
+        batch->ik[channel] = 0;
+    }
+}
+
+
+void Ifx_IntegralF32_setBatchChannel(Ifx_IntegralF32_Batch *batch, uint16 channel, float32 gain, float32 Ts)
+{
+    batch->delta[channel] = gain * Ts / 2;
+}
+
+
+void Ifx_IntegralF32_initBatch(Ifx_IntegralF32_Batch *batch, float32 *buffer, uint16 count, float32 gain, float32 Ts)
+{
+    uint16 channel;
+
+    batch->uk    = &buffer[0];
+    batch->ik    = &buffer[count];
+    batch->delta = &buffer[2 * count];
+    batch->count = count;
+
+    for (channel = 0; channel < count; channel++)
+    {
+        Ifx_IntegralF32_setBatchChannel(batch, channel, gain, Ts);
+    }
+
+    Ifx_IntegralF32_resetBatch(batch);
+}
+
+
+void Ifx_IntegralF32_stepBatch(Ifx_IntegralF32_Batch *batch, const float32 *ik)
+{
+    float32       *uk    = batch->uk;
+    float32       *ikOld = batch->ik;
+    const float32 *delta = batch->delta;
+    uint16         count = batch->count;
+    uint16         i;
+
+    for (i = 0; (i + 4) <= count; i += 4)
+    {
+        uk[i]        = uk[i] + (ik[i] + ikOld[i]) * delta[i];
+        uk[i + 1]    = uk[i + 1] + (ik[i + 1] + ikOld[i + 1]) * delta[i + 1];
+        uk[i + 2]    = uk[i + 2] + (ik[i + 2] + ikOld[i + 2]) * delta[i + 2];
+        uk[i + 3]    = uk[i + 3] + (ik[i + 3] + ikOld[i + 3]) * delta[i + 3];
+        ikOld[i]     = ik[i];
+        ikOld[i + 1] = ik[i + 1];
+        ikOld[i + 2] = ik[i + 2];
+        ikOld[i + 3] = ik[i + 3];
+    }
+
+    for ( ; i < count; i++)
+    {
+        uk[i]    = uk[i] + (ik[i] + ikOld[i]) * delta[i];
+        ikOld[i] = ik[i];
+    }
+}
+
+
+void Ifx_IntegralQ15_resetBatch(Ifx_IntegralQ15_Batch *batch)
+{
+    uint16 pair;
+
+    for (pair = 0; pair < ((batch->count + 1) / 2); pair++)
+    {
+        batch->uk[pair] = 0;
+        batch->ik[pair] = 0;
+    }
+}
+
+
+void Ifx_IntegralQ15_setBatchChannel(Ifx_IntegralQ15_Batch *batch, uint16 channel, float32 gain, float32 Ts)
+{
+    float32 delta = gain * Ts / 2 * 32768.0f;
+
+    if (delta > 32767.0f)
+    {
+        delta = 32767.0f;
+    }
+    else if (delta < -32768.0f)
+    {
+        delta = -32768.0f;
+    }
+
+    ((sint16 *)batch->delta)[channel] = (sint16)delta;
+}
+
+
+void Ifx_IntegralQ15_initBatch(Ifx_IntegralQ15_Batch *batch, __packhw *buffer, uint16 count, float32 gain, float32 Ts)
+{
+    uint16 pairCount = (count + 1) / 2;
+    uint16 channel;
+
+    batch->uk    = &buffer[0];
+    batch->ik    = &buffer[pairCount];
+    batch->delta = &buffer[2 * pairCount];
+    batch->count = count;
+
+    for (channel = 0; channel < (2 * pairCount); channel++)
+    {
+        Ifx_IntegralQ15_setBatchChannel(batch, channel, gain, Ts);
+    }
+
+    Ifx_IntegralQ15_resetBatch(batch);
+}
+
+
+void Ifx_IntegralQ15_stepBatch(Ifx_IntegralQ15_Batch *batch, const __packhw *ik)
+{
+    __packhw       *uk        = batch->uk;
+    __packhw       *ikOld     = batch->ik;
+    const __packhw *delta     = batch->delta;
+    uint16          pairCount = (batch->count + 1) / 2;
+    uint16          pair;
+
+    for (pair = 0; pair < pairCount; pair++)
+    {
+        /* (ik + ikOld) * delta as two products: the input sum would overflow Q15 */
+        uk[pair]    = __maddrsh(__maddrsh(uk[pair], ik[pair], delta[pair]), ikOld[pair], delta[pair]);
+        ikOld[pair] = ik[pair];
+    }
+}
@@ -26,6 +26,14 @@
  * \defgroup library_srvsw_sysse_math_f32_integral Discrete Integral Approximation
  * \ingroup library_srvsw_sysse_math_f32
  *
+ * The batch variants integrate many channels per call, the states are stored as structure of
+ * arrays in a buffer provided by the caller. \ref Ifx_IntegralF32_stepBatch() processes 4 float32
+ * channels per loop iteration, \ref Ifx_IntegralQ15_stepBatch() 2 Q15 channels per packed
+ * halfword instruction. The Q15 integrator output saturates at [-1, 1[.
+ *
+ * \ref Ifx_IntegralQ31 is the fixed point counterpart of \ref Ifx_IntegralF32, with saturating
+ * Q31 arithmetic: the integrator output saturates at [-1, 1[.
+ *
  */
 
 #ifndef INTEGRAL_H
@@ -33,6 +41,12 @@
 
 #include "Ifx_Cf32.h"
 
+/** \brief Number of float32 elements of the \ref Ifx_IntegralF32_Batch buffer */
+#define IFX_INTEGRALF32_BATCH_BUFFER_SIZE(count) (3 * (count))
+
+/** \brief Number of __packhw elements of the \ref Ifx_IntegralQ15_Batch buffer */
+#define IFX_INTEGRALQ15_BATCH_BUFFER_SIZE(count) (3 * (((count) + 1) / 2))
+
 /** \brief Integrator object for float32 data type */
 typedef struct
 {
@@ -41,6 +55,14 @@ typedef struct
     float32 delta;
 } Ifx_IntegralF32;
 
+/** \brief Integrator object for Q31 data type */
+typedef struct
+{
+    sint32 uk;
+    sint32 ik;
+    sint32 delta;       /**< \brief gain * Ts / 2 in Q31 */
+} Ifx_IntegralQ31;
+
 /** \brief Integrator object for cfloat32 data type */
 typedef struct
 {
@@ -49,6 +71,25 @@ typedef struct
     float32  delta;
 } Ifx_ClpxFloat32_Integral;
 
+/** \brief Integrator batch object, float32 channels as structure of arrays */
+typedef struct
+{
+    float32 *uk;
+    float32 *ik;
+    float32 *delta;
+    uint16   count;     /**< \brief number of channels */
+} Ifx_IntegralF32_Batch;
+
+/** \brief Integrator batch object, Q15 channels as structure of arrays.
+ * Channel 2 * i is the lower and channel 2 * i + 1 the upper halfword of element i */
+typedef struct
+{
+    __packhw *uk;
+    __packhw *ik;
+    __packhw *delta;
+    uint16    count;    /**< \brief number of channels */
+} Ifx_IntegralQ15_Batch;
+
 /** \addtogroup library_srvsw_sysse_math_f32_integral
  * \{ */
 
@@ -68,6 +109,22 @@ float32 Ifx_IntegralF32_step(Ifx_IntegralF32 *ci, float32 ik);
  * \param ci Pointer to the integrator object */
 void Ifx_IntegralF32_reset(Ifx_IntegralF32 *ci);
 
+/** \brief Initialize the integrator object
+ * \param ci Pointer to the integrator object
+ * \param gain Integrator gain, gain * Ts / 2 must be lower than 1
+ * \param Ts Sampling period */
+void Ifx_IntegralQ31_init(Ifx_IntegralQ31 *ci, float32 gain, float32 Ts);
+
+/** \brief Step function of the integrator object
+ * \param ci Pointer to the integrator object
+ * \param ik input value in Q31
+ * \return most actual integrator value in Q31 */
+sint32 Ifx_IntegralQ31_step(Ifx_IntegralQ31 *ci, sint32 ik);
+
+/** \brief Reset the integrator object
+ * \param ci Pointer to the integrator object */
+void Ifx_IntegralQ31_reset(Ifx_IntegralQ31 *ci);
+
 /** \brief Initialize the integrator object
  * \param ci Pointer to the integrator object
  * \param gain Integrator gain
@@ -84,6 +141,54 @@ cfloat32 Ifx_ClpxFloat32_Integral_step(Ifx_ClpxFloat32_Integral *ci, cfloat32 ik
  * \param ci Pointer to the integrator object */
 void Ifx_ClpxFloat32_Integral_reset(Ifx_ClpxFloat32_Integral *ci);
 
+/** \brief Initialize the integrator batch object, all channels with the same gain
+ * \param batch Pointer to the integrator batch object
+ * \param buffer Buffer of \ref IFX_INTEGRALF32_BATCH_BUFFER_SIZE(count) elements
+ * \param count Number of channels
+ * \param gain Integrator gain
+ * \param Ts Sampling period */
+void Ifx_IntegralF32_initBatch(Ifx_IntegralF32_Batch *batch, float32 *buffer, uint16 count, float32 gain, float32 Ts);
+
+/** \brief Set the gain of one channel of the integrator batch object
+ * \param batch Pointer to the integrator batch object
+ * \param channel Channel index
+ * \param gain Integrator gain
+ * \param Ts Sampling period */
+void Ifx_IntegralF32_setBatchChannel(Ifx_IntegralF32_Batch *batch, uint16 channel, float32 gain, float32 Ts);
+
+/** \brief Step function of the integrator batch object
+ * \param batch Pointer to the integrator batch object, the integrator values are stored in batch->uk[]
+ * \param ik input values, one per channel */
+void Ifx_IntegralF32_stepBatch(Ifx_IntegralF32_Batch *batch, const float32 *ik);
+
+/** \brief Reset the integrator batch object
+ * \param batch Pointer to the integrator batch object */
+void Ifx_IntegralF32_resetBatch(Ifx_IntegralF32_Batch *batch);
+
+/** \brief Initialize the integrator batch object, all channels with the same gain
+ * \param batch Pointer to the integrator batch object
+ * \param buffer Buffer of \ref IFX_INTEGRALQ15_BATCH_BUFFER_SIZE(count) elements
+ * \param count Number of channels
+ * \param gain Integrator gain, gain * Ts / 2 must be lower than 1
+ * \param Ts Sampling period */
+void Ifx_IntegralQ15_initBatch(Ifx_IntegralQ15_Batch *batch, __packhw *buffer, uint16 count, float32 gain, float32 Ts);
+
+/** \brief Set the gain of one channel of the integrator batch object
+ * \param batch Pointer to the integrator batch object
+ * \param channel Channel index
+ * \param gain Integrator gain, gain * Ts / 2 must be lower than 1
+ * \param Ts Sampling period */
+void Ifx_IntegralQ15_setBatchChannel(Ifx_IntegralQ15_Batch *batch, uint16 channel, float32 gain, float32 Ts);
+
+/** \brief Step function of the integrator batch object
+ * \param batch Pointer to the integrator batch object, the integrator values are stored in batch->uk[]
+ * \param ik input values, one channel pair per element */
+void Ifx_IntegralQ15_stepBatch(Ifx_IntegralQ15_Batch *batch, const __packhw *ik);
+
+/** \brief Reset the integrator batch object
+ * \param batch Pointer to the integrator batch object */
+void Ifx_IntegralQ15_resetBatch(Ifx_IntegralQ15_Batch *batch);
+
 /**\}*/
 
 #endif /* INTEGRAL_H */
@@ -29,6 +29,30 @@
  * with \f$(T^* = \frac{T_s}{T+T_s})\f$, \f$(a = K*T^*)\f$, \f$(b = T^*)\f$
  * with \f$(T_s: Sample time)\f$, \f$(K: Gain)\f$, \f$(T = \frac{1}{\omega_0})\f$
  *
+ * Batch variants filter many channels per call. The parameters and outputs are stored as
+ * structure of arrays in a buffer provided by the caller:
+ * - \ref Ifx_LowPassPt1F32_doBatch() processes 4 float32 channels per loop iteration
+ * - \ref Ifx_LowPassPt1Q15_doBatch() processes 2 Q15 channels per packed halfword instruction.
+ * a and b must be lower than 1, i.e. \f$(K < \frac{T+T_s}{T_s})\f$. Because of the rounding,
+ * the output of the Q15 filter may differ from K * input by up to \f$(\frac{0.5}{b})\f$ LSB in steady state.
+ *
+ * \ref Ifx_LowPassPt1Q31 is the fixed point counterpart of \ref Ifx_LowPassPt1F32 for one channel, with
+ * saturating Q31 arithmetic and the same restriction on a and b.
+ *
+ * Usage example:
+ * \code
+ * #define CHANNEL_COUNT (16)
+ * static float32                 lpfBuffer[IFX_LOWPASSPT1F32_BATCH_BUFFER_SIZE(CHANNEL_COUNT)];
+ * static Ifx_LowPassPt1F32_Batch lpf;
+ * Ifx_LowPassPt1F32_Config       lpfConfig = {100.0, 1.0, 100e-6};
+ *
+ * // initialisation, all channels with the same configuration
+ * Ifx_LowPassPt1F32_initBatch(&lpf, lpfBuffer, CHANNEL_COUNT, &lpfConfig);
+ *
+ * // every period
+ * Ifx_LowPassPt1F32_doBatch(&lpf, inputs); // filtered values in lpf.out[0 .. CHANNEL_COUNT - 1]
+ * \endcode
+ *
  * \ingroup library_srvsw_sysse_math_f32
  *
  */
@@ -37,6 +61,15 @@
 #define IFX_LOWPASSPT1F32
 //------------------------------------------------------------------------------
 #include "Cpu/Std/Ifx_Types.h"
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+//------------------------------------------------------------------------------
+
+/** \brief Number of float32 elements of the \ref Ifx_LowPassPt1F32_Batch buffer */
+#define IFX_LOWPASSPT1F32_BATCH_BUFFER_SIZE(count) (3 * (count))
+
+/** \brief Number of __packhw elements of the \ref Ifx_LowPassPt1Q15_Batch buffer */
+#define IFX_LOWPASSPT1Q15_BATCH_BUFFER_SIZE(count) (3 * (((count) + 1) / 2))
+
 //------------------------------------------------------------------------------
 
 /** \brief PT1 object definition.
@@ -48,6 +81,15 @@ typedef struct
     float32 out;            /**< \brief last output */
 } Ifx_LowPassPt1F32;
 
+/** \brief PT1 object definition, Q31 data type.
+ */
+typedef struct
+{
+    sint32 a;               /**< \brief a parameter in Q31 */
+    sint32 b;               /**< \brief b parameter in Q31 */
+    sint32 out;             /**< \brief last output in Q31 */
+} Ifx_LowPassPt1Q31;
+
 /** \brief PT1 configuration */
 typedef struct
 {
@@ -56,6 +98,27 @@ typedef struct
     float32 samplingTime;    /**< \brief Sampling time */
 } Ifx_LowPassPt1F32_Config;
 
+/** \brief PT1 batch object definition, float32 channels as structure of arrays.
+ */
+typedef struct
+{
+    float32 *a;             /**< \brief a parameter of each channel */
+    float32 *b;             /**< \brief b parameter of each channel */
+    float32 *out;           /**< \brief last output of each channel */
+    uint16   count;         /**< \brief number of channels */
+} Ifx_LowPassPt1F32_Batch;
+
+/** \brief PT1 batch object definition, Q15 channels as structure of arrays.
+ * Channel 2 * i is the lower and channel 2 * i + 1 the upper halfword of element i
+ */
+typedef struct
+{
+    __packhw *a;            /**< \brief a parameter of each channel pair */
+    __packhw *b;            /**< \brief b parameter of each channel pair */
+    __packhw *out;          /**< \brief last output of each channel pair */
+    uint16    count;        /**< \brief number of channels */
+} Ifx_LowPassPt1Q15_Batch;
+
 //------------------------------------------------------------------------------
 
 /** \addtogroup  library_srvsw_sysse_math_f32_lowpasspt1
@@ -63,6 +126,21 @@ typedef struct
 IFX_EXTERN void    Ifx_LowPassPt1F32_init(Ifx_LowPassPt1F32 *filter, const Ifx_LowPassPt1F32_Config *config);
 IFX_INLINE void    Ifx_LowPassPt1F32_reset(Ifx_LowPassPt1F32 *filter);
 IFX_EXTERN float32 Ifx_LowPassPt1F32_do(Ifx_LowPassPt1F32 *filter, float32 input);
+IFX_EXTERN void    Ifx_LowPassPt1Q31_init(Ifx_LowPassPt1Q31 *filter, const Ifx_LowPassPt1F32_Config *config);
+IFX_INLINE void    Ifx_LowPassPt1Q31_reset(Ifx_LowPassPt1Q31 *filter);
+IFX_EXTERN sint32  Ifx_LowPassPt1Q31_do(Ifx_LowPassPt1Q31 *filter, sint32 input);
+/** \} */
+
+/** \name Batch functions
+ * \{ */
+IFX_EXTERN void Ifx_LowPassPt1F32_initBatch(Ifx_LowPassPt1F32_Batch *batch, float32 *buffer, uint16 count, const Ifx_LowPassPt1F32_Config *config);
+IFX_EXTERN void Ifx_LowPassPt1F32_setBatchChannel(Ifx_LowPassPt1F32_Batch *batch, uint16 channel, const Ifx_LowPassPt1F32_Config *config);
+IFX_EXTERN void Ifx_LowPassPt1F32_resetBatch(Ifx_LowPassPt1F32_Batch *batch);
+IFX_EXTERN void Ifx_LowPassPt1F32_doBatch(Ifx_LowPassPt1F32_Batch *batch, const float32 *input);
+IFX_EXTERN void Ifx_LowPassPt1Q15_initBatch(Ifx_LowPassPt1Q15_Batch *batch, __packhw *buffer, uint16 count, const Ifx_LowPassPt1F32_Config *config);
+IFX_EXTERN void Ifx_LowPassPt1Q15_setBatchChannel(Ifx_LowPassPt1Q15_Batch *batch, uint16 channel, const Ifx_LowPassPt1F32_Config *config);
+IFX_EXTERN void Ifx_LowPassPt1Q15_resetBatch(Ifx_LowPassPt1Q15_Batch *batch);
+IFX_EXTERN void Ifx_LowPassPt1Q15_doBatch(Ifx_LowPassPt1Q15_Batch *batch, const __packhw *input);
 /** \} */
 
 //------------------------------------------------------------------------------
@@ -76,5 +154,14 @@ IFX_INLINE void Ifx_LowPassPt1F32_reset(Ifx_LowPassPt1F32 *filter)
 }
 
 
+/** \brief Reset the internal filter variable
+ * \param filter Specifies PT1 filter.
+ */
+IFX_INLINE void Ifx_LowPassPt1Q31_reset(Ifx_LowPassPt1Q31 *filter)
+{
+    filter->out = 0;
+}
+
+
 //------------------------------------------------------------------------------
 #endif
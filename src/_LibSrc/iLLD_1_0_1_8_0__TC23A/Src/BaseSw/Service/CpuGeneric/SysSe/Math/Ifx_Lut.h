@@ -48,6 +48,13 @@
 #   define IFX_LUT_TABLE
 #endif
 
+#ifndef IFX_CFG_LUT_TABLE_SECTION
+/** \brief Placement of the tables defined with \ref IFX_LUTSINCOSF32_TABLE() and \ref IFX_LUTATAN2F32_TABLE(),
+ * e.g. __attribute__ ((section(".bss_cpu0"))) to locate them in the DSPR of CPU0 with the Gnuc linker file.
+ * Empty: default data section */
+#define IFX_CFG_LUT_TABLE_SECTION
+#endif
+
 /** \brief Define the resolution (in bits) of cosinus and sinus table \ingroup library_srvsw_sysse_math_lut */
 #define IFX_LUT_ANGLE_BITS       (12)
 
@@ -53,6 +53,7 @@ typedef struct
 /** \addtogroup library_srvsw_sysse_math_f32_lut_linear
  * \{ */
 IFX_EXTERN float32 Ifx_LutLinearF32_searchBin(const Ifx_LutLinearF32 *ml, float32 index);
+IFX_EXTERN float32 Ifx_LutLinearF32_searchHint(const Ifx_LutLinearF32 *ml, float32 index, sint16 *hint);
 IFX_INLINE float32 Ifx_LutLinearF32_searchNegSeq(const Ifx_LutLinearF32 *ml, float32 index);
 IFX_INLINE float32 Ifx_LutLinearF32_searchPosSeq(const Ifx_LutLinearF32 *ml, float32 index);
 /** \} */
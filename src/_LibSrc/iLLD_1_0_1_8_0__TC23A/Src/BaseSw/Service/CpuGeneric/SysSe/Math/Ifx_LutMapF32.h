@@ -0,0 +1,199 @@
+/**
+ * \file Ifx_LutMapF32.h
+ * \brief Curve and map look-up with prelookup of the axes
+ *
+ *
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_math_f32_lut_map Curve and map look-up (with linear interpolation)
+ * \ingroup library_srvsw_sysse_math_f32_lut
+ *
+ * Calibration curves (1-D) and maps (2-D) defined on breakpoint axes, with linear (bilinear) interpolation.
+ * The input is clamped to the axis range, there is no extrapolation.
+ *
+ * The look-up is split in 2 steps:
+ * - the axis search (\ref Ifx_LutMapF32_searchAxis(), \ref Ifx_LutMapF32_searchAxisHint()) gives the bin of the
+ * input and the fraction inside the bin (\ref Ifx_LutMapF32_AxisIndex).
+ * - the interpolation (\ref Ifx_LutMapF32_interpolateCurve(), \ref Ifx_LutMapF32_interpolateMap()) reads the
+ * table values of the bin.
+ *
+ * The maps sharing the same axes (e.g. engine speed and load) are evaluated with one search per axis, see
+ * \ref Ifx_LutMapF32_interpolateMaps(). The hint search starts from the bin of the previous call and is the
+ * fastest one when the operating point moves slowly: it walks from bin to bin instead of a full binary search.
+ *
+ * The tables should be aligned on the cache line with \ref IFX_LUTMAPF32_ALIGN: the 4 values used by one
+ * bilinear interpolation are then read with at most 2 cache line fills when a row fits into a cache line.
+ *
+ * Usage example:
+ * \code
+ * static const float32 speedPoints[8] = {500, 1000, 1500, 2000, 3000, 4000, 5000, 6000};
+ * static const float32 loadPoints[4]  = {0.2f, 0.4f, 0.7f, 1.0f};
+ * IFX_LUTMAPF32_ALIGN static const float32 sparkTable[4][8] = {...};
+ * IFX_LUTMAPF32_ALIGN static const float32 injectionTable[4][8] = {...};
+ *
+ * static const Ifx_LutMapF32_Axis speedAxis = {speedPoints, 8};
+ * static const Ifx_LutMapF32_Axis loadAxis  = {loadPoints, 4};
+ * static const Ifx_LutMapF32_Map  sparkMap     = {&loadAxis, &speedAxis, &sparkTable[0][0]};
+ * static const Ifx_LutMapF32_Map  injectionMap = {&loadAxis, &speedAxis, &injectionTable[0][0]};
+ * static const Ifx_LutMapF32_Map *const engineMaps[2] = {&sparkMap, &injectionMap};
+ *
+ * static Ifx_LutMapF32_AxisIndex speedIndex; // keeps the bin between the calls
+ * static Ifx_LutMapF32_AxisIndex loadIndex;
+ * float32 results[2];
+ *
+ * Ifx_LutMapF32_searchAxisHint(&speedAxis, speed, &speedIndex);
+ * Ifx_LutMapF32_searchAxisHint(&loadAxis, load, &loadIndex);
+ * Ifx_LutMapF32_interpolateMaps(engineMaps, 2, &loadIndex, &speedIndex, results);
+ * \endcode
+ *
+ */
+
+#ifndef IFX_LUTMAPF32_H
+#define IFX_LUTMAPF32_H
+
+//________________________________________________________________________________________
+// INCLUDES
+#include "Cpu/Std/Ifx_Types.h"
+
+//________________________________________________________________________________________
+// CONFIGURATION
+
+/** \brief Size in bytes of the CPU data cache line */
+#define IFX_LUTMAPF32_CACHE_LINE (32)
+
+/** \brief Alignment of the curve and map tables on the data cache line */
+#define IFX_LUTMAPF32_ALIGN      IFX_ALIGN(IFX_LUTMAPF32_CACHE_LINE)
+
+//________________________________________________________________________________________
+// DATA STRUCTURES
+
+/** \brief Breakpoint axis */
+typedef struct
+{
+    const float32 *points;      /**< \brief breakpoints, strictly increasing */
+    uint16         count;       /**< \brief number of breakpoints, at least 2 */
+} Ifx_LutMapF32_Axis;
+
+/** \brief Result of the axis search */
+typedef struct
+{
+    uint16  index;              /**< \brief bin: index of the breakpoint below the input, 0 .. count - 2 */
+    float32 fraction;           /**< \brief position of the input inside the bin, 0.0 .. 1.0 */
+} Ifx_LutMapF32_AxisIndex;
+
+/** \brief Curve: one value per breakpoint */
+typedef struct
+{
+    const Ifx_LutMapF32_Axis *axis;     /**< \brief axis */
+    const float32            *values;   /**< \brief axis->count values */
+} Ifx_LutMapF32_Curve;
+
+/** \brief Map: one value per row and column breakpoint */
+typedef struct
+{
+    const Ifx_LutMapF32_Axis *rowAxis;      /**< \brief row axis */
+    const Ifx_LutMapF32_Axis *columnAxis;   /**< \brief column axis */
+    const float32            *values;       /**< \brief rowAxis->count x columnAxis->count values, row after row */
+} Ifx_LutMapF32_Map;
+
+//________________________________________________________________________________________
+// FUNCTION PROTOTYPES
+
+/** \addtogroup library_srvsw_sysse_math_f32_lut_map
+ * \{ */
+
+/** \brief Curve look-up: axis search and interpolation
+ * \param curve pointer to the curve
+ * \param x input
+ * \return interpolated value */
+IFX_EXTERN float32 Ifx_LutMapF32_curve(const Ifx_LutMapF32_Curve *curve, float32 x);
+
+/** \brief Linear interpolation of a curve at a searched axis position
+ * \param curve pointer to the curve
+ * \param x axis position returned by the axis search
+ * \return interpolated value */
+IFX_INLINE float32 Ifx_LutMapF32_interpolateCurve(const Ifx_LutMapF32_Curve *curve, const Ifx_LutMapF32_AxisIndex *x);
+
+/** \brief Bilinear interpolation of a map at searched axis positions
+ * \param map pointer to the map
+ * \param row row axis position returned by the axis search
+ * \param column column axis position returned by the axis search
+ * \return interpolated value */
+IFX_INLINE float32 Ifx_LutMapF32_interpolateMap(const Ifx_LutMapF32_Map *map, const Ifx_LutMapF32_AxisIndex *row, const Ifx_LutMapF32_AxisIndex *column);
+
+/** \brief Bilinear interpolation of several maps sharing the same axes
+ *
+ * The interpolation weights are computed once for all maps.
+ * \param maps table of pointers to the maps, all defined on the axes searched for row and column
+ * \param count number of maps
+ * \param row row axis position returned by the axis search
+ * \param column column axis position returned by the axis search
+ * \param results count interpolated values, in the order of the maps */
+IFX_EXTERN void Ifx_LutMapF32_interpolateMaps(const Ifx_LutMapF32_Map *const *maps, uint16 count, const Ifx_LutMapF32_AxisIndex *row, const Ifx_LutMapF32_AxisIndex *column, float32 *results);
+
+/** \brief Map look-up: axis searches and interpolation
+ * \param map pointer to the map
+ * \param x row axis input
+ * \param y column axis input
+ * \return interpolated value */
+IFX_EXTERN float32 Ifx_LutMapF32_map(const Ifx_LutMapF32_Map *map, float32 x, float32 y);
+
+/** \brief Axis search with binary search
+ * \param axis pointer to the axis
+ * \param x input, clamped to the axis range
+ * \param result axis position of the input */
+IFX_EXTERN void Ifx_LutMapF32_searchAxis(const Ifx_LutMapF32_Axis *axis, float32 x, Ifx_LutMapF32_AxisIndex *result);
+
+/** \brief Axis search starting from the previous bin
+ *
+ * The search walks from the bin of the previous result to the bin of the input: 1 or 2 comparisons when the
+ * input stays in the same or in the next bin. The result shall be initialised once, e.g. to 0 or with
+ * \ref Ifx_LutMapF32_searchAxis().
+ * \param axis pointer to the axis
+ * \param x input, clamped to the axis range
+ * \param result in: axis position of the previous input, out: axis position of the input */
+IFX_EXTERN void Ifx_LutMapF32_searchAxisHint(const Ifx_LutMapF32_Axis *axis, float32 x, Ifx_LutMapF32_AxisIndex *result);
+
+/** \} */
+
+//________________________________________________________________________________________
+// INLINE FUNCTION IMPLEMENTATION
+
+IFX_INLINE float32 Ifx_LutMapF32_interpolateCurve(const Ifx_LutMapF32_Curve *curve, const Ifx_LutMapF32_AxisIndex *x)
+{
+    const float32 *v = &curve->values[x->index];
+
+    return v[0] + ((v[1] - v[0]) * x->fraction);
+}
+
+
+IFX_INLINE float32 Ifx_LutMapF32_interpolateMap(const Ifx_LutMapF32_Map *map, const Ifx_LutMapF32_AxisIndex *row, const Ifx_LutMapF32_AxisIndex *column)
+{
+    uint16         columns = map->columnAxis->count;
+    const float32 *v0      = &map->values[(row->index * columns) + column->index];
+    const float32 *v1      = &v0[columns];
+    float32        r0      = v0[0] + ((v0[1] - v0[0]) * column->fraction);
+    float32        r1      = v1[0] + ((v1[1] - v1[0]) * column->fraction);
+
+    return r0 + ((r1 - r0) * row->fraction);
+}
+
+
+#endif /* IFX_LUTMAPF32_H */
@@ -83,5 +83,88 @@ IFX_INLINE cfloat32 Ifx_LutSincosF32_cossin(Ifx_Lut_FxpAngle fxpAngle)
 }
 
 
+//________________________________________________________________________________________
+/** \addtogroup library_srvsw_sysse_math_lut_sincos
+ * \{ */
+
+/** \brief Number of entries of a table with a resolution of bits: a quarter wave plus one guard entry for the interpolation */
+#define IFX_LUTSINCOSF32_TABLE_SIZE(bits) ((1 << ((bits) - 2)) + 2)
+
+/** \brief Define a sin / cos table object with a resolution of bits (3 .. \ref IFX_LUT_ANGLE_BITS)
+ *
+ * The table data is located with \ref IFX_CFG_LUT_TABLE_SECTION and generated by \ref Ifx_LutSincosF32_initTable().
+ * Usage: IFX_LUTSINCOSF32_TABLE(g_focSincos, 10);
+ * \param name name of the \ref Ifx_LutSincosF32_Table object
+ * \param bits angle resolution in bits, the table divides 2*IFX_PI into 2^bits steps
+ */
+#define IFX_LUTSINCOSF32_TABLE(name, bits)                                                 \
+    static float32 name##Data[IFX_LUTSINCOSF32_TABLE_SIZE(bits)] IFX_CFG_LUT_TABLE_SECTION; \
+    Ifx_LutSincosF32_Table name = {name##Data, (bits)}
+
+/** \brief Sin / cos table with a resolution selected per instance
+ *
+ * The angles are \ref Ifx_Lut_FxpAngle with \ref IFX_LUT_ANGLE_RESOLUTION as for the global table:
+ * - Ifx_LutSincosF32_sinTable() rounds the angle to the nearest table entry, max error about IFX_PI / 2^bits
+ * - Ifx_LutSincosF32_sinInterpolated() interpolates linearly between two entries, max error about (IFX_PI / 2^bits)^2 / 2,
+ * e.g. 7.5e-5 with 8 bits (66 entries)
+ */
+typedef struct
+{
+    float32 *table;         /**< \brief sin(IFX_PI / 2 * k / 2^(bits - 2)), k = 0 .. 2^(bits - 2) + 1 */
+    uint8    bits;          /**< \brief angle resolution in bits */
+    float32  fractionScale; /**< \brief 2^(bits - IFX_LUT_ANGLE_BITS), set by \ref Ifx_LutSincosF32_initTable() */
+} Ifx_LutSincosF32_Table;
+
+/** \brief Generate the table data
+ * \param table Pointer to the table object defined with \ref IFX_LUTSINCOSF32_TABLE()
+ * \return FALSE if the resolution is out of range
+ */
+IFX_EXTERN boolean Ifx_LutSincosF32_initTable(Ifx_LutSincosF32_Table *table);
+
+/** \brief Sine lookup with rounding to the nearest table entry
+ * \param table Pointer to the table object
+ * \param fxpAngle 0 .. (IFX_LUT_ANGLE_RESOLUTION - 1), which represents 0 .. 2*IFX_PI
+ * \return sin(2*IFX_PI*fxpAngle/IFX_LUT_ANGLE_RESOLUTION)
+ */
+IFX_EXTERN float32 Ifx_LutSincosF32_sinTable(const Ifx_LutSincosF32_Table *table, Ifx_Lut_FxpAngle fxpAngle);
+
+/** \brief Sine lookup with linear interpolation between two table entries
+ * \param table Pointer to the table object
+ * \param fxpAngle 0 .. (IFX_LUT_ANGLE_RESOLUTION - 1), which represents 0 .. 2*IFX_PI
+ * \return sin(2*IFX_PI*fxpAngle/IFX_LUT_ANGLE_RESOLUTION)
+ */
+IFX_EXTERN float32 Ifx_LutSincosF32_sinInterpolated(const Ifx_LutSincosF32_Table *table, Ifx_Lut_FxpAngle fxpAngle);
+
+/** \brief Sine and cosine lookup with rounding to the nearest table entry
+ * \param table Pointer to the table object
+ * \param fxpAngle 0 .. (IFX_LUT_ANGLE_RESOLUTION - 1), which represents 0 .. 2*IFX_PI
+ * \retval real = cos(2*IFX_PI*fxpAngle/IFX_LUT_ANGLE_RESOLUTION)
+ * \retval imag = sin(2*IFX_PI*fxpAngle/IFX_LUT_ANGLE_RESOLUTION)
+ */
+IFX_INLINE cfloat32 Ifx_LutSincosF32_cossinTable(const Ifx_LutSincosF32_Table *table, Ifx_Lut_FxpAngle fxpAngle)
+{
+    cfloat32 result;
+    result.imag = Ifx_LutSincosF32_sinTable(table, fxpAngle);
+    result.real = Ifx_LutSincosF32_sinTable(table, (IFX_LUT_ANGLE_PI / 2) - fxpAngle);
+    return result;
+}
+
+
+/** \brief Sine and cosine lookup with linear interpolation between two table entries
+ * \param table Pointer to the table object
+ * \param fxpAngle 0 .. (IFX_LUT_ANGLE_RESOLUTION - 1), which represents 0 .. 2*IFX_PI
+ * \retval real = cos(2*IFX_PI*fxpAngle/IFX_LUT_ANGLE_RESOLUTION)
+ * \retval imag = sin(2*IFX_PI*fxpAngle/IFX_LUT_ANGLE_RESOLUTION)
+ */
+IFX_INLINE cfloat32 Ifx_LutSincosF32_cossinInterpolated(const Ifx_LutSincosF32_Table *table, Ifx_Lut_FxpAngle fxpAngle)
+{
+    cfloat32 result;
+    result.imag = Ifx_LutSincosF32_sinInterpolated(table, fxpAngle);
+    result.real = Ifx_LutSincosF32_sinInterpolated(table, (IFX_LUT_ANGLE_PI / 2) - fxpAngle);
+    return result;
+}
+
+
+/** \} */
 //________________________________________________________________________________________
 #endif
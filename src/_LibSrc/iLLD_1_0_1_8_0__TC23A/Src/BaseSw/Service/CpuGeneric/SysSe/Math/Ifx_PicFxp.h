@@ -0,0 +1,124 @@
+/**
+ * \file Ifx_PicFxp.h
+ * \brief PI controller in fixed point
+ *
+ *
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_math_fxp_pic PI controller Q31
+ * \ingroup library_srvsw_sysse_math
+ *
+ * Fused PI controller with saturating Q31 arithmetic: the proportional and integral parts are computed from
+ * the same error sample in one step, the output is limited to [min, max].
+ *
+ * The gains are stored as Q31 mantissa and a common left shift, so that gains above 1 are possible:
+ * kp = kpMantissa * 2^shift, ki * Ts = kiMantissa * 2^shift.
+ *
+ * Anti-windup by conditional integration: while the output is limited, the integral part is not
+ * updated with an error driving the output further into the limit. The integral part is itself
+ * limited to [min, max].
+ *
+ * Usage example:
+ * \code
+ * static Ifx_PicQ31 idController;
+ * Ifx_PicQ31_Config  config = {2.5, 800.0, 100e-6, -0.9, 0.9};
+ *
+ * Ifx_PicQ31_init(&idController, &config);
+ *
+ * // every 100us, values in Q31 normalised to the full scale
+ * udQ31 = Ifx_PicQ31_step(&idController, __subs(idRefQ31, idQ31));
+ * \endcode
+ *
+ */
+
+#ifndef IFX_PICFXP_H
+#define IFX_PICFXP_H
+//________________________________________________________________________________________
+
+#include "Cpu/Std/Ifx_Types.h"
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+//________________________________________________________________________________________
+/** \addtogroup library_srvsw_sysse_math_fxp_pic
+ * \{ */
+
+/** \brief PI controller configuration */
+typedef struct
+{
+    float32 kp;             /**< \brief proportional gain */
+    float32 ki;             /**< \brief integral gain, per second */
+    float32 samplingTime;   /**< \brief sampling time in seconds */
+    float32 min;            /**< \brief lower output limit, full scale -1.0 .. 1.0 */
+    float32 max;            /**< \brief upper output limit, full scale -1.0 .. 1.0 */
+} Ifx_PicQ31_Config;
+
+/** \brief PI controller object */
+typedef struct
+{
+    sint32 kp;              /**< \brief proportional gain mantissa in Q31 */
+    sint32 ki;              /**< \brief ki * samplingTime mantissa in Q31 */
+    uint8  shift;           /**< \brief left shift of the gain mantissas */
+    sint32 integral;        /**< \brief integral part in Q31 */
+    sint32 min;             /**< \brief lower output limit in Q31 */
+    sint32 max;             /**< \brief upper output limit in Q31 */
+} Ifx_PicQ31;
+
+/** \brief Initialize the PI controller, the integral part is reset
+ * \param pic Pointer to the PI controller object
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_PicQ31_init(Ifx_PicQ31 *pic, const Ifx_PicQ31_Config *config);
+
+/** \brief Reset the integral part
+ * \param pic Pointer to the PI controller object
+ */
+IFX_INLINE void Ifx_PicQ31_reset(Ifx_PicQ31 *pic);
+
+/** \brief Set the integral part, e.g. to start from the actual output without step
+ * \param pic Pointer to the PI controller object
+ * \param integral Integral part in Q31, limited to [min, max]
+ */
+IFX_INLINE void Ifx_PicQ31_setIntegral(Ifx_PicQ31 *pic, sint32 integral);
+
+/** \brief Step function of the PI controller
+ *
+ * NOTE: shall be called every samplingTime.
+ * \param pic Pointer to the PI controller object
+ * \param error Error (reference - actual value) in Q31
+ * \return Controller output in Q31, limited to [min, max]
+ */
+IFX_EXTERN sint32 Ifx_PicQ31_step(Ifx_PicQ31 *pic, sint32 error);
+
+/** \} */
+//________________________________________________________________________________________
+// INLINE FUNCTION IMPLEMENTATION
+
+IFX_INLINE void Ifx_PicQ31_reset(Ifx_PicQ31 *pic)
+{
+    pic->integral = 0;
+}
+
+
+IFX_INLINE void Ifx_PicQ31_setIntegral(Ifx_PicQ31 *pic, sint32 integral)
+{
+    pic->integral = __saturate(integral, pic->min, pic->max);
+}
+
+
+#endif /* IFX_PICFXP_H */
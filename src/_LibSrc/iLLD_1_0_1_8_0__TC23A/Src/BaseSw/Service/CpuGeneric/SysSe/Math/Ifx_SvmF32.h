@@ -0,0 +1,176 @@
+/**
+ * \file Ifx_SvmF32.h
+ * \brief Space vector modulation
+ *
+ *
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_math_svm Space vector modulation
+ * \ingroup library_srvsw_sysse_math
+ *
+ * \defgroup library_srvsw_sysse_math_f32_svm Space vector modulation float32
+ * \ingroup library_srvsw_sysse_math_svm
+ *
+ * The modulation converts the voltage vector in the stator reference frame (alpha, beta), normalised to the
+ * DC link voltage, into the on-times of the 3 high side switches expected by \ref IfxStdIf_PwmHl_setOnTime().
+ * The linear range is |m| <= 1 / sqrt(3).
+ * - min-max injection: the phase voltages are centered with -(max + min) / 2, outside of the linear range each
+ *   on-time saturates at 0 or period, the angle of the vector is not kept.
+ * - sector based: the active vector times T1, T2 are computed in the sector of the vector, outside of the linear
+ *   range they are scaled down to the period, the angle of the vector is kept. The sector is returned, e.g.
+ *   for the current sampling. In the linear range both variants give the same on-times.
+ *
+ * The *Inline() functions are the fast path to be used in the control loop, the other functions are their out of
+ * line version. Usage:
+ * \code
+ * Ifx_TimerValue tOn[IFX_SVM_NUM_PHASES];
+ * cfloat32       m;
+ *
+ * m.real = uAlpha / vdc;
+ * m.imag = uBeta / vdc;
+ * Ifx_SvmF32_minMaxInline(tOn, m, IfxStdIf_PwmHl_getPeriod(&pwm));
+ * IfxStdIf_PwmHl_setOnTime(&pwm, tOn);
+ * \endcode
+ *
+ */
+
+#ifndef IFX_SVMF32_H
+#define IFX_SVMF32_H
+//________________________________________________________________________________________
+
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+//________________________________________________________________________________________
+/** \addtogroup library_srvsw_sysse_math_f32_svm
+ * \{ */
+
+/** \brief Number of phases, size of the on-time arrays */
+#define IFX_SVM_NUM_PHASES (3)
+
+/** \brief Phase with the longest, middle and shortest on-time for each sector,
+ * sector n covers the angles n * 60 .. (n + 1) * 60 degree */
+IFX_EXTERN IFX_CONST uint8 Ifx_g_Svm_phaseOrder[6][IFX_SVM_NUM_PHASES];
+
+/** \brief Space vector modulation with min-max injection
+ * \param tOn On-times of the phases A, B, C in ticks, 0 .. period
+ * \param m Voltage vector normalised to the DC link voltage, real = alpha, imag = beta
+ * \param period PWM period in ticks
+ */
+IFX_EXTERN void Ifx_SvmF32_minMax(Ifx_TimerValue *tOn, cfloat32 m, Ifx_TimerValue period);
+
+/** \brief Sector based space vector modulation
+ * \param tOn On-times of the phases A, B, C in ticks, 0 .. period
+ * \param m Voltage vector normalised to the DC link voltage, real = alpha, imag = beta
+ * \param period PWM period in ticks
+ * \return Sector 0 .. 5
+ */
+IFX_EXTERN uint8 Ifx_SvmF32_sector(Ifx_TimerValue *tOn, cfloat32 m, Ifx_TimerValue period);
+
+/** \copydoc Ifx_SvmF32_minMax() */
+IFX_INLINE void Ifx_SvmF32_minMaxInline(Ifx_TimerValue *tOn, cfloat32 m, Ifx_TimerValue period)
+{
+    float32 fPeriod = (float32)period;
+    float32 a       = m.real;
+    float32 k       = (IFX_SQRT_THREE / 2) * m.imag;
+    float32 b       = (-0.5f * a) + k;
+    float32 c       = (-0.5f * a) - k;
+    float32 offset  = 0.5f - (0.5f * (__maxf(a, __maxf(b, c)) + __minf(a, __minf(b, c))));
+
+    tOn[0] = (Ifx_TimerValue)(__saturatef(a + offset, 0.0f, 1.0f) * fPeriod);
+    tOn[1] = (Ifx_TimerValue)(__saturatef(b + offset, 0.0f, 1.0f) * fPeriod);
+    tOn[2] = (Ifx_TimerValue)(__saturatef(c + offset, 0.0f, 1.0f) * fPeriod);
+}
+
+
+/** \copydoc Ifx_SvmF32_sector() */
+IFX_INLINE uint8 Ifx_SvmF32_sectorInline(Ifx_TimerValue *tOn, cfloat32 m, Ifx_TimerValue period)
+{
+    float32      fPeriod = (float32)period;
+    float32      k       = (IFX_SQRT_THREE / 2) * m.imag;
+    float32      x       = 2.0f * k;
+    float32      y       = (1.5f * m.real) + k;
+    float32      z       = (-1.5f * m.real) + k;
+    float32      t1, t2, tZero, tMiddle;
+    uint8        sector;
+    const uint8 *order;
+
+    if (x >= 0.0f)
+    {
+        if (z <= 0.0f)
+        {
+            sector = 0;
+            t1     = -z;
+            t2     = x;
+        }
+        else if (y > 0.0f)
+        {
+            sector = 1;
+            t1     = y;
+            t2     = z;
+        }
+        else
+        {
+            sector = 2;
+            t1     = x;
+            t2     = -y;
+        }
+    }
+    else
+    {
+        if (z > 0.0f)
+        {
+            sector = 3;
+            t1     = z;
+            t2     = -x;
+        }
+        else if (y <= 0.0f)
+        {
+            sector = 4;
+            t1     = -y;
+            t2     = -z;
+        }
+        else
+        {
+            sector = 5;
+            t1     = -x;
+            t2     = y;
+        }
+    }
+
+    if ((t1 + t2) > 1.0f)
+    {   /* Over-modulation: keep the angle */
+        t1 = t1 / (t1 + t2);
+        t2 = 1.0f - t1;
+    }
+
+    tZero   = 0.5f * (1.0f - t1 - t2);
+    tMiddle = tZero + (((sector & 1) != 0) ? t1 : t2);
+    order   = Ifx_g_Svm_phaseOrder[sector];
+
+    tOn[order[0]] = (Ifx_TimerValue)((tZero + t1 + t2) * fPeriod);
+    tOn[order[1]] = (Ifx_TimerValue)(tMiddle * fPeriod);
+    tOn[order[2]] = (Ifx_TimerValue)(tZero * fPeriod);
+
+    return sector;
+}
+
+
+/** \} */
+//________________________________________________________________________________________
+#endif /* IFX_SVMF32_H */
@@ -0,0 +1,36 @@
+/**
+ * \file Ifx_SvmFxp.c
+ * \brief Space vector modulation in fixed point
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_SvmFxp.h"
+
+/******************************************************************************/
+void Ifx_SvmFxp_minMaxQ15(Ifx_TimerValue *tOn, csint16 m, Ifx_TimerValue period)
+{
+    Ifx_SvmFxp_minMaxQ15Inline(tOn, m, period);
+}
+
+
+uint8 Ifx_SvmFxp_sectorQ15(Ifx_TimerValue *tOn, csint16 m, Ifx_TimerValue period)
+{
+    return Ifx_SvmFxp_sectorQ15Inline(tOn, m, period);
+}
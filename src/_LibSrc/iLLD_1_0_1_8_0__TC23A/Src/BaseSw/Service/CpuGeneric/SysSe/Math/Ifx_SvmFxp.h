@@ -0,0 +1,165 @@
+/**
+ * \file Ifx_SvmFxp.h
+ * \brief Space vector modulation in fixed point
+ *
+ *
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_math_fxp_svm Space vector modulation Q15
+ * \ingroup library_srvsw_sysse_math_svm
+ *
+ * Q15 version of \ref library_srvsw_sysse_math_f32_svm: the voltage vector is given in Q15
+ * (0x7FFF = DC link voltage), e.g. directly from a fixed point current controller. The intermediate
+ * values are computed in 32 bit, the duty cycles are scaled to the period with one 32 bit
+ * multiplication, the period must not exceed 0xFFFF ticks (16 bit TOM / ATOM timers).
+ * \code
+ * Ifx_TimerValue tOn[IFX_SVM_NUM_PHASES];
+ * csint16        m = {uAlphaQ15, uBetaQ15};
+ *
+ * Ifx_SvmFxp_sectorQ15Inline(tOn, m, IfxStdIf_PwmHl_getPeriod(&pwm));
+ * IfxStdIf_PwmHl_setOnTime(&pwm, tOn);
+ * \endcode
+ *
+ */
+
+#ifndef IFX_SVMFXP_H
+#define IFX_SVMFXP_H
+//________________________________________________________________________________________
+
+#include "Ifx_SvmF32.h"
+//________________________________________________________________________________________
+/** \addtogroup library_srvsw_sysse_math_fxp_svm
+ * \{ */
+
+#define IFX_SVMFXP_Q15_ONE          (0x8000)    /**< \brief 1.0 in Q15, in 32 bit arithmetic */
+#define IFX_SVMFXP_Q15_SQRT3_BY_2   (28378)     /**< \brief sqrt(3) / 2 in Q15 */
+
+/** \brief Space vector modulation with min-max injection in Q15
+ * \param tOn On-times of the phases A, B, C in ticks, 0 .. period
+ * \param m Voltage vector in Q15 normalised to the DC link voltage, real = alpha, imag = beta
+ * \param period PWM period in ticks, up to 0xFFFF
+ */
+IFX_EXTERN void Ifx_SvmFxp_minMaxQ15(Ifx_TimerValue *tOn, csint16 m, Ifx_TimerValue period);
+
+/** \brief Sector based space vector modulation in Q15
+ * \param tOn On-times of the phases A, B, C in ticks, 0 .. period
+ * \param m Voltage vector in Q15 normalised to the DC link voltage, real = alpha, imag = beta
+ * \param period PWM period in ticks, up to 0xFFFF
+ * \return Sector 0 .. 5
+ */
+IFX_EXTERN uint8 Ifx_SvmFxp_sectorQ15(Ifx_TimerValue *tOn, csint16 m, Ifx_TimerValue period);
+
+/** \brief Scale a Q15 duty cycle 0 .. \ref IFX_SVMFXP_Q15_ONE to the period */
+IFX_INLINE Ifx_TimerValue Ifx_SvmFxp_toTicks(sint32 duty, Ifx_TimerValue period)
+{
+    return (Ifx_TimerValue)(((uint32)duty * period) >> 15);
+}
+
+
+/** \copydoc Ifx_SvmFxp_minMaxQ15() */
+IFX_INLINE void Ifx_SvmFxp_minMaxQ15Inline(Ifx_TimerValue *tOn, csint16 m, Ifx_TimerValue period)
+{
+    sint32 a      = m.real;
+    sint32 k      = (IFX_SVMFXP_Q15_SQRT3_BY_2 * (sint32)m.imag) >> 15;
+    sint32 b      = -(a >> 1) + k;
+    sint32 c      = -(a >> 1) - k;
+    sint32 offset = (IFX_SVMFXP_Q15_ONE >> 1) - ((__max(a, __max(b, c)) + __min(a, __min(b, c))) >> 1);
+
+    tOn[0] = Ifx_SvmFxp_toTicks(__saturate(a + offset, 0, IFX_SVMFXP_Q15_ONE), period);
+    tOn[1] = Ifx_SvmFxp_toTicks(__saturate(b + offset, 0, IFX_SVMFXP_Q15_ONE), period);
+    tOn[2] = Ifx_SvmFxp_toTicks(__saturate(c + offset, 0, IFX_SVMFXP_Q15_ONE), period);
+}
+
+
+/** \copydoc Ifx_SvmFxp_sectorQ15() */
+IFX_INLINE uint8 Ifx_SvmFxp_sectorQ15Inline(Ifx_TimerValue *tOn, csint16 m, Ifx_TimerValue period)
+{
+    sint32       k = (IFX_SVMFXP_Q15_SQRT3_BY_2 * (sint32)m.imag) >> 15;
+    sint32       x = 2 * k;
+    sint32       y = ((3 * (sint32)m.real) >> 1) + k;
+    sint32       z = -((3 * (sint32)m.real) >> 1) + k;
+    sint32       t1, t2, tZero, tMiddle;
+    uint8        sector;
+    const uint8 *order;
+
+    if (x >= 0)
+    {
+        if (z <= 0)
+        {
+            sector = 0;
+            t1     = -z;
+            t2     = x;
+        }
+        else if (y > 0)
+        {
+            sector = 1;
+            t1     = y;
+            t2     = z;
+        }
+        else
+        {
+            sector = 2;
+            t1     = x;
+            t2     = -y;
+        }
+    }
+    else
+    {
+        if (z > 0)
+        {
+            sector = 3;
+            t1     = z;
+            t2     = -x;
+        }
+        else if (y <= 0)
+        {
+            sector = 4;
+            t1     = -y;
+            t2     = -z;
+        }
+        else
+        {
+            sector = 5;
+            t1     = -x;
+            t2     = y;
+        }
+    }
+
+    if ((t1 + t2) > IFX_SVMFXP_Q15_ONE)
+    {   /* Over-modulation: keep the angle, t1 + t2 < 2^17 */
+        t1 = (t1 << 15) / (t1 + t2);
+        t2 = IFX_SVMFXP_Q15_ONE - t1;
+    }
+
+    tZero   = (IFX_SVMFXP_Q15_ONE - t1 - t2) >> 1;
+    tMiddle = tZero + (((sector & 1) != 0) ? t1 : t2);
+    order   = Ifx_g_Svm_phaseOrder[sector];
+
+    tOn[order[0]] = Ifx_SvmFxp_toTicks(tZero + t1 + t2, period);
+    tOn[order[1]] = Ifx_SvmFxp_toTicks(tMiddle, period);
+    tOn[order[2]] = Ifx_SvmFxp_toTicks(tZero, period);
+
+    return sector;
+}
+
+
+/** \} */
+//________________________________________________________________________________________
+#endif /* IFX_SVMFXP_H */
@@ -0,0 +1,141 @@
+/**
+ * \file Ifx_BootProfile.c
+ * \brief Startup time profiler
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_BootProfile.h"
+#include "Cpu/CStart/IfxCpu_CStart.h"
+#include "Cpu/Std/IfxCpu.h"
+#include "Stm/Std/IfxStm.h"
+
+/** \brief Add a record, the records are not full */
+static void Ifx_BootProfile_add(Ifx_BootProfile *profile, pchar name, uint32 stm)
+{
+    profile->records[profile->count].name = name;
+    profile->records[profile->count].stm  = stm;
+    profile->count++;
+}
+
+
+void Ifx_BootProfile_finish(Ifx_BootProfile *profile)
+{
+    profile->finished = TRUE;
+}
+
+
+float32 Ifx_BootProfile_getTime(const Ifx_BootProfile *profile, uint8 index)
+{
+    uint32  stm = profile->records[index].stm;
+    float32 time;
+
+    if (stm <= profile->clockInit)
+    {
+        time = (float32)stm / profile->resetFrequency;
+    }
+    else
+    {
+        time = ((float32)profile->clockInit / profile->resetFrequency)
+               + ((float32)(stm - profile->clockInit) / profile->frequency);
+    }
+
+    return time;
+}
+
+
+void Ifx_BootProfile_init(Ifx_BootProfile *profile)
+{
+    /* The object is kept over a reset: report the previous boot if it did not finish */
+    if ((profile->magic == IFX_BOOTPROFILE_MAGIC) && (profile->finished == FALSE)
+        && (profile->count > 0) && (profile->count <= IFX_CFG_BOOTPROFILE_MAX_RECORDS))
+    {
+        profile->hungStep = profile->records[profile->count - 1].name;
+    }
+    else
+    {
+        profile->hungStep = NULL_PTR;
+    }
+
+    profile->magic     = IFX_BOOTPROFILE_MAGIC;
+    profile->finished  = FALSE;
+    profile->count     = 0;
+    profile->lostCount = 0;
+    profile->frequency = IfxStm_getFrequency(&MODULE_STM0);
+
+#if (IFX_CFG_CPU_CSTART_BOOT_TIMES != 0)
+    profile->resetFrequency = IfxCpu_CStart0_bootTimes.resetFrequency;
+    profile->clockInit      = IfxCpu_CStart0_bootTimes.clockInit;
+    Ifx_BootProfile_add(profile, "boot software", IfxCpu_CStart0_bootTimes.start);
+    Ifx_BootProfile_add(profile, "Ifx_C_Init", IfxCpu_CStart0_bootTimes.cInit);
+    Ifx_BootProfile_add(profile, "clock init", IfxCpu_CStart0_bootTimes.clockInit);
+    Ifx_BootProfile_add(profile, "core0_main", IfxCpu_CStart0_bootTimes.main);
+#else
+    profile->resetFrequency = profile->frequency;
+    profile->clockInit      = 0;
+    Ifx_BootProfile_add(profile, "core0_main", IfxStm_getLower(&MODULE_STM0));
+#endif
+}
+
+
+void Ifx_BootProfile_mark(Ifx_BootProfile *profile, pchar name)
+{
+    uint32  stm            = IfxStm_getLower(&MODULE_STM0);
+    boolean interruptState = IfxCpu_disableInterrupts();
+
+    if (profile->count < IFX_CFG_BOOTPROFILE_MAX_RECORDS)
+    {
+        Ifx_BootProfile_add(profile, name, stm);
+    }
+    else
+    {
+        profile->lostCount++;
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+
+boolean Ifx_BootProfile_show(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    Ifx_BootProfile *profile = (Ifx_BootProfile *)data;
+    float32          previous = 0;
+    uint8            i;
+
+    (void)args;
+
+    if (profile->hungStep != NULL_PTR)
+    {
+        IfxStdIf_DPipe_print(io, "Previous boot did not finish, last step: %s"ENDL, profile->hungStep);
+    }
+
+    IfxStdIf_DPipe_print(io, "%-32s %10s %10s"ENDL, "step", "end ms", "step ms");
+
+    for (i = 0; i < profile->count; i++)
+    {
+        float32 time = Ifx_BootProfile_getTime(profile, i);
+
+        IfxStdIf_DPipe_print(io, "%-32s %10.3f %10.3f"ENDL, profile->records[i].name, time * 1000.0, (time - previous) * 1000.0);
+        previous = time;
+    }
+
+    IfxStdIf_DPipe_print(io, "%s, %u marks lost"ENDL, (profile->finished != FALSE) ? "finished" : "in progress", profile->lostCount);
+
+    return TRUE;
+}
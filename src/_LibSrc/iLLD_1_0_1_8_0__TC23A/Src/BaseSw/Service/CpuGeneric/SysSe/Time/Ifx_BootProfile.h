@@ -0,0 +1,132 @@
+/**
+ * \file Ifx_BootProfile.h
+ * \brief Startup time profiler
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_time_bootprofile Boot profile
+ * \ingroup library_srvsw_sysse_time
+ *
+ * The boot profile records the time since reset at the end of each startup step, to find the initializations
+ * which dominate the boot time (clock system, VADC calibration, CAN, display, ...) and to check the startup time
+ * budget. The time base is the STM0, which counts from the reset:
+ * - with IFX_CFG_CPU_CSTART_BOOT_TIMES = 1 in Ifx_Cfg.h, the first records are the steps of the CPU0 startup before
+ * core0_main(), see \ref IfxLld_Cpu_CStart_ConfigBootTimes: boot software (reset to _Core0_start()), C variables
+ * initialization (Ifx_C_Init()), clock system initialization and start of the other CPUs. The ticks before the end
+ * of the clock system initialization are converted with the STM frequency after reset; the frequency changes
+ * during the clock system initialization, its duration is approximate.
+ * - \ref Ifx_BootProfile_mark() records the end of each application step.
+ *
+ * The object should be located in a RAM area which is not initialized by the C startup nor cleared by a reset
+ * (\ref IFX_NO_INIT_DATA): when the previous boot did not reach \ref Ifx_BootProfile_finish(), e.g. after a
+ * watchdog reset, \ref Ifx_BootProfile_init() keeps the name of its last completed step in hungStep.
+ *
+ * The marks shall be done by one CPU. The STM0 lower 32 bits wrap around after 42s at 100 MHz.
+ *
+ * Usage example:
+ * \code
+ * IFX_NO_INIT_DATA static Ifx_BootProfile bootProfile;
+ *
+ * // core0_main()
+ * Ifx_BootProfile_init(&bootProfile);
+ * IfxVadc_Adc_initModule(&vadc, &vadcConfig);
+ * Ifx_BootProfile_mark(&bootProfile, "IfxVadc_Adc_initModule");
+ * IfxMultican_Can_initModule(&can, &canConfig);
+ * Ifx_BootProfile_mark(&bootProfile, "IfxMultican_Can_initModule");
+ * tft_init();
+ * Ifx_BootProfile_mark(&bootProfile, "tft_init");
+ * Ifx_BootProfile_finish(&bootProfile);
+ *
+ * // shell command list entry
+ * {"boot", "   : Show the boot profile", &bootProfile, &Ifx_BootProfile_show},
+ * \endcode
+ *
+ */
+#ifndef IFX_BOOTPROFILE_H
+#define IFX_BOOTPROFILE_H 1
+
+#include "Cpu/Std/Ifx_Types.h"
+#include "StdIf/IfxStdIf_DPipe.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_BOOTPROFILE_MAX_RECORDS)
+#define IFX_CFG_BOOTPROFILE_MAX_RECORDS (32)           /**<\brief Maximal number of records */
+#endif
+
+#define IFX_BOOTPROFILE_MAGIC           (0x424F4F54U)  /**<\brief Marks a valid object in the not initialized RAM */
+
+/** \addtogroup library_srvsw_sysse_time_bootprofile
+ * \{ */
+
+/** \brief End of a startup step */
+typedef struct
+{
+    pchar  name;    /**<\brief step name, constant string */
+    uint32 stm;     /**<\brief STM0 lower 32 bits at the end of the step */
+} Ifx_BootProfile_Record;
+
+/** \brief Boot profile object */
+typedef struct
+{
+    uint32                 magic;                                       /**<\brief IFX_BOOTPROFILE_MAGIC once initialized */
+    boolean                finished;                                    /**<\brief TRUE once Ifx_BootProfile_finish() is called */
+    pchar                  hungStep;                                    /**<\brief last step of the previous boot if it did not finish, NULL_PTR else */
+    uint8                  count;                                       /**<\brief number of records */
+    uint32                 lostCount;                                   /**<\brief number of marks not recorded, the records being full */
+    float32                resetFrequency;                              /**<\brief STM frequency before the clock system initialization */
+    float32                frequency;                                   /**<\brief STM frequency after the clock system initialization */
+    uint32                 clockInit;                                   /**<\brief STM0 value at the end of the clock system initialization, 0 if not recorded */
+    Ifx_BootProfile_Record records[IFX_CFG_BOOTPROFILE_MAX_RECORDS];    /**<\brief records, in time order */
+} Ifx_BootProfile;
+
+/** \brief Mark the end of the startup: the next boot does not report this one as hung
+ * \param profile Pointer to the boot profile object
+ */
+IFX_EXTERN void Ifx_BootProfile_finish(Ifx_BootProfile *profile);
+
+/** \brief Returns the time of a record since reset in seconds
+ * \param profile Pointer to the boot profile object
+ * \param index record index
+ */
+IFX_EXTERN float32 Ifx_BootProfile_getTime(const Ifx_BootProfile *profile, uint8 index);
+
+/** \brief Initialize the boot profile object, first in core0_main()
+ *
+ * Checks whether the previous boot finished, clears the records and adds the CPU0 startup time stamps when
+ * IFX_CFG_CPU_CSTART_BOOT_TIMES is set.
+ * \param profile Pointer to the boot profile object
+ */
+IFX_EXTERN void Ifx_BootProfile_init(Ifx_BootProfile *profile);
+
+/** \brief Record the end of a startup step
+ * \param profile Pointer to the boot profile object
+ * \param name step name, must be a constant string
+ */
+IFX_EXTERN void Ifx_BootProfile_mark(Ifx_BootProfile *profile, pchar name);
+
+/** \brief Shell command: print the records, their time since reset and the duration of each step
+ * \param args command arguments
+ * \param data Pointer to the boot profile object
+ * \param io Pointer to the IfxStdIf_DPipe object
+ * \return TRUE
+ */
+IFX_EXTERN boolean Ifx_BootProfile_show(pchar args, void *data, IfxStdIf_DPipe *io);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -51,3 +51,103 @@ void DateTime_set(Ifx_DateTime *dt)
     seconds          = seconds + (60 * dt->minutes);
     g_DateTimeOffset = seconds;
 }
+
+
+void DateTime_initClock(Ifx_DateTimeClock *clock)
+{
+    Ifx_TickTime t       = now();
+    sint32       seconds = (sint32)(t / TimeConst_1s);
+    Ifx_TickTime rest    = t - ((Ifx_TickTime)seconds * TimeConst_1s);
+
+    clock->milliseconds = (sint32)(rest / TimeConst_1ms);
+    clock->last         = t - (rest - (clock->milliseconds * TimeConst_1ms));
+
+    seconds             = seconds + g_DateTimeOffset;
+    clock->time.hours   = seconds / 3600;
+    clock->time.minutes = (seconds / 60) % 60;
+    clock->time.seconds = seconds % 60;
+}
+
+
+void DateTime_updateClock(Ifx_DateTimeClock *clock)
+{
+    Ifx_TickTime elapsed = now() - clock->last;
+    sint32       milliseconds;
+
+    if (elapsed < TimeConst_1s)
+    {
+        milliseconds = (sint32)((uint32)elapsed / (uint32)TimeConst_1ms);
+    }
+    else
+    {
+        milliseconds = (sint32)(elapsed / TimeConst_1ms);
+    }
+
+    clock->last         += milliseconds * TimeConst_1ms;
+    milliseconds        += clock->milliseconds;
+
+    if (milliseconds >= 1000)
+    {
+        sint32 seconds = clock->time.seconds + (milliseconds / 1000);
+        milliseconds = milliseconds % 1000;
+
+        if (seconds >= 60)
+        {
+            sint32 minutes = clock->time.minutes + (seconds / 60);
+            seconds = seconds % 60;
+
+            if (minutes >= 60)
+            {
+                clock->time.hours += minutes / 60;
+                minutes            = minutes % 60;
+            }
+
+            clock->time.minutes = minutes;
+        }
+
+        clock->time.seconds = seconds;
+    }
+
+    clock->milliseconds = milliseconds;
+}
+
+
+/** \brief Write a value with a fixed number of digits */
+static char *DateTime_formatDigits(char *buffer, uint32 value, uint32 digits)
+{
+    uint32 i;
+
+    for (i = digits; i > 0; i--)
+    {
+        buffer[i - 1] = (char)('0' + (value % 10));
+        value         = value / 10;
+    }
+
+    return &buffer[digits];
+}
+
+
+uint32 DateTime_format(const Ifx_DateTimeClock *clock, char *buffer)
+{
+    char  *p      = buffer;
+    uint32 hours  = (uint32)clock->time.hours;
+    uint32 digits = 2;
+    uint32 limit  = 100;
+
+    while ((digits < 5) && (hours >= limit))
+    {
+        digits++;
+        limit = limit * 10;
+    }
+
+    p    = DateTime_formatDigits(p, hours, digits);
+    *p++ = ':';
+    p    = DateTime_formatDigits(p, (uint32)clock->time.minutes, 2);
+    *p++ = ':';
+    p    = DateTime_formatDigits(p, (uint32)clock->time.seconds, 2);
+    *p++ = '.';
+    p    = DateTime_formatDigits(p, (uint32)clock->milliseconds, 3);
+    *p   = 0;
+
+    return (uint32)(p - buffer);
+}
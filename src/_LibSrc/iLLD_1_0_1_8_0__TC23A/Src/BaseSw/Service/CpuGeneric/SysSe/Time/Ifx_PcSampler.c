@@ -0,0 +1,163 @@
+/**
+ * \file Ifx_PcSampler.c
+ * \brief Statistical program counter sampling profiler
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_PcSampler.h"
+#include "SysSe/Comm/Ifx_Shell.h"
+
+/** \brief PCXI.UL, set if PCXI points to an upper context */
+#define IFX_PCSAMPLER_PCXI_UL         (1UL << 20)
+
+/** \brief Position of PCXI.PCPN, the priority of the code which saved the context */
+#define IFX_PCSAMPLER_PCXI_PCPN_SHIFT (22)
+
+/** \brief Word index of PCXI in an upper context */
+#define IFX_PCSAMPLER_CONTEXT_PCXI    (0)
+
+/** \brief Word index of A11 in an upper context */
+#define IFX_PCSAMPLER_CONTEXT_A11     (3)
+
+boolean Ifx_PcSampler_dump(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    Ifx_PcSampler *sampler = (Ifx_PcSampler *)data;
+    uint32         i;
+
+    IfxStdIf_DPipe_print(io, "PCSAMPLER cpu=%d start=0x%08X binSize=%u bins=%u samples=%u outside=%u interrupt=%u invalid=%u"ENDL,
+        sampler->cpu, sampler->start, 1U << sampler->binShift, sampler->binCount, sampler->sampleCount,
+        sampler->outsideCount, sampler->interruptCount, sampler->invalidCount);
+
+    for (i = 0; i < sampler->binCount; i++)
+    {
+        uint32 count = sampler->bins[i];
+
+        if (count != 0)
+        {
+            IfxStdIf_DPipe_print(io, "0x%08X %u"ENDL, sampler->start + (i << sampler->binShift), count);
+        }
+    }
+
+    IfxStdIf_DPipe_print(io, "END"ENDL);
+
+    if (Ifx_Shell_matchToken(&args, "reset") != FALSE)
+    {
+        Ifx_PcSampler_reset(sampler);
+    }
+
+    return TRUE;
+}
+
+
+boolean Ifx_PcSampler_init(Ifx_PcSampler *sampler, const Ifx_PcSampler_Config *config)
+{
+    boolean result = FALSE;
+
+    sampler->enabled = FALSE;
+
+    if ((config->bins != NULL_PTR) && (config->binCount != 0) && (config->end > config->start))
+    {
+        sampler->bins     = config->bins;
+        sampler->binCount = config->binCount;
+        sampler->start    = config->start;
+        sampler->size     = config->end - config->start;
+        sampler->binShift = 0;
+        sampler->cpu      = IfxCpu_getCoreIndex();
+
+        /* Smallest bin width for which the range fits into the bins */
+        while (((sampler->size - 1) >> sampler->binShift) >= sampler->binCount)
+        {
+            sampler->binShift++;
+        }
+
+        Ifx_PcSampler_reset(sampler);
+        result = TRUE;
+    }
+
+    return result;
+}
+
+
+void Ifx_PcSampler_initConfig(Ifx_PcSampler_Config *config)
+{
+    config->bins     = NULL_PTR;
+    config->binCount = 0;
+    config->start    = 0x80000000U;
+    config->end      = 0x80400000U;
+}
+
+
+void Ifx_PcSampler_reset(Ifx_PcSampler *sampler)
+{
+    boolean enabled = sampler->enabled;
+    uint32  i;
+
+    /* The samples are counted in an interrupt, possibly of another CPU */
+    sampler->enabled = FALSE;
+
+    for (i = 0; i < sampler->binCount; i++)
+    {
+        sampler->bins[i] = 0;
+    }
+
+    sampler->sampleCount    = 0;
+    sampler->outsideCount   = 0;
+    sampler->interruptCount = 0;
+    sampler->invalidCount   = 0;
+    sampler->enabled        = enabled;
+}
+
+
+void Ifx_PcSampler_sample(Ifx_PcSampler *sampler)
+{
+    uint32  pcxi = __mfcr(CPU_PCXI);
+    uint32 *context;
+    uint32  offset;
+
+    if (sampler->enabled != FALSE)
+    {
+        sampler->sampleCount++;
+
+        if ((pcxi & IFX_PCSAMPLER_PCXI_UL) == 0)
+        {
+            sampler->invalidCount++;
+        }
+        else
+        {
+            /* Upper context of the service routine: A11 is the interrupted PC, PCXI.PCPN the interrupted priority */
+            context = (uint32 *)__cx_to_addr(pcxi);
+            offset  = context[IFX_PCSAMPLER_CONTEXT_A11] - sampler->start;
+
+            if (offset < sampler->size)
+            {
+                sampler->bins[offset >> sampler->binShift]++;
+            }
+            else
+            {
+                sampler->outsideCount++;
+            }
+
+            if ((context[IFX_PCSAMPLER_CONTEXT_PCXI] >> IFX_PCSAMPLER_PCXI_PCPN_SHIFT) != 0)
+            {
+                sampler->interruptCount++;
+            }
+        }
+    }
+}
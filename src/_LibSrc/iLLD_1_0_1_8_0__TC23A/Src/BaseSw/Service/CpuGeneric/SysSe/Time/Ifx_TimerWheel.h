@@ -0,0 +1,166 @@
+/**
+ * \file Ifx_TimerWheel.h
+ * \brief Software timers multiplexed on one STM comparator
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_time_timerwheel Timer wheel
+ * \ingroup library_srvsw_sysse_time
+ *
+ * Any number of software timers (protocol timeouts, periodic functions) share one STM comparator and its
+ * interrupt. The timers are kept in a hierarchical timer wheel of IFX_TIMERWHEEL_LEVELS levels of
+ * IFX_TIMERWHEEL_SLOTS slots: starting, stopping and restarting a timer is O(1), independently of the number of
+ * running timers. The timers of a higher level are moved to the lower levels when the lower level wraps.
+ *
+ * The wheel time unit is the wheel tick, a multiple of the STM tick. The comparator is programmed to the next
+ * wheel tick with an expiring timer, or to the next wrap of the first level, so that the idle wheel costs at most
+ * one interrupt per IFX_TIMERWHEEL_SLOTS wheel ticks. The timers expiring at the same wheel tick are delivered as
+ * one batch: the callbacks are called one after the other from the STM interrupt.
+ *
+ * A timer started with a delay of n wheel ticks expires after n - 1 to n wheel ticks, depending on the time
+ * elapsed since the last wheel tick. A callback may start or stop any timer, itself included. A periodic timer is restarted before its callback is
+ * called. The longest delay is IFX_TIMERWHEEL_MAX_TICKS wheel ticks, longer delays are shortened to it.
+ *
+ * The wheel shall only be used by the CPU which services the STM interrupt. The comparator compares the lower
+ * 32 bits of the timer (offset 0, size 32 bits, which is the IfxStm_initCompareConfig() default).
+ *
+ * Usage example:
+ * \code
+ * static Ifx_TimerWheel       wheel;
+ * static Ifx_TimerWheel_Timer canTpTimeout;
+ *
+ * // initialisation: 1 ms wheel tick on STM0 comparator 1
+ * IfxStm_CompareConfig stmConfig;
+ * IfxStm_initCompareConfig(&stmConfig);
+ * stmConfig.comparator           = IfxStm_Comparator_1;
+ * stmConfig.comparatorInterrupt  = IfxStm_ComparatorInterrupt_ir1;
+ * stmConfig.triggerPriority      = ISR_PRIORITY_TIMER_WHEEL;
+ * stmConfig.typeOfService        = IfxSrc_Tos_cpu0;
+ * IfxStm_initCompare(&MODULE_STM0, &stmConfig);
+ * Ifx_TimerWheel_init(&wheel, &MODULE_STM0, IfxStm_Comparator_1, IfxStm_getTicksFromMilliseconds(&MODULE_STM0, 1));
+ * Ifx_TimerWheel_initTimer(&canTpTimeout, &canTpOnTimeout, &canTp);
+ *
+ * // interrupt
+ * IFX_INTERRUPT(timerWheelIsr, 0, ISR_PRIORITY_TIMER_WHEEL)
+ * {
+ *     Ifx_TimerWheel_process(&wheel);
+ * }
+ *
+ * // application: 1000 ms timeout, restarted on each received frame
+ * Ifx_TimerWheel_start(&wheel, &canTpTimeout, 1000, 0);
+ * \endcode
+ *
+ */
+#ifndef IFX_TIMERWHEEL_H
+#define IFX_TIMERWHEEL_H 1
+
+#include "Stm/Std/IfxStm.h"
+
+//----------------------------------------------------------------------------------------
+#define IFX_TIMERWHEEL_SLOT_BITS (6)                                          /**<\brief log2 of the number of slots per level */
+#define IFX_TIMERWHEEL_SLOTS     (1u << IFX_TIMERWHEEL_SLOT_BITS)             /**<\brief Number of slots per level */
+#define IFX_TIMERWHEEL_LEVELS    (3)                                          /**<\brief Number of levels */
+#define IFX_TIMERWHEEL_MAX_TICKS ((1u << (IFX_TIMERWHEEL_SLOT_BITS * IFX_TIMERWHEEL_LEVELS)) - IFX_TIMERWHEEL_SLOTS) /**<\brief Longest delay in wheel ticks */
+
+/** \addtogroup library_srvsw_sysse_time_timerwheel
+ * \{ */
+
+/** \brief Timer callback
+ * \param data Data registered with the timer
+ */
+typedef void (*Ifx_TimerWheel_Callback)(void *data);
+
+/** \brief Software timer */
+typedef struct Ifx_TimerWheel_Timer_s
+{
+    struct Ifx_TimerWheel_Timer_s  *next;      /**<\brief next timer of the list */
+    struct Ifx_TimerWheel_Timer_s  *prev;      /**<\brief previous timer of the list */
+    struct Ifx_TimerWheel_Timer_s **list;      /**<\brief head of the list holding the timer, NULL_PTR if stopped */
+    uint32                          expiry;    /**<\brief expiry wheel tick */
+    uint32                          period;    /**<\brief period in wheel ticks, 0 for a single shot timer */
+    Ifx_TimerWheel_Callback         callback;  /**<\brief callback */
+    void                           *data;      /**<\brief data given to the callback */
+} Ifx_TimerWheel_Timer;
+
+/** \brief Timer wheel object */
+typedef struct
+{
+    Ifx_TimerWheel_Timer *slots[IFX_TIMERWHEEL_LEVELS][IFX_TIMERWHEEL_SLOTS];  /**<\brief timer lists */
+    Ifx_TimerWheel_Timer *expired;                                             /**<\brief timers of the batch being delivered */
+    uint32                occupied[IFX_TIMERWHEEL_SLOTS / 32];                 /**<\brief bit set for the non empty slots of the first level */
+    uint32                upperCount;                                          /**<\brief number of timers in the upper levels */
+    uint32                current;                                             /**<\brief next wheel tick to process */
+    uint32                currentTime;                                         /**<\brief STM time of the current wheel tick */
+    uint32                nextTick;                                            /**<\brief wheel tick programmed in the comparator */
+    uint32                period;                                              /**<\brief wheel tick in STM ticks */
+    Ifx_STM              *stm;                                                 /**<\brief STM module */
+    IfxStm_Comparator     comparator;                                          /**<\brief STM comparator */
+    uint32                batches;                                             /**<\brief number of wheel ticks with expired timers */
+    uint32                callbacks;                                           /**<\brief number of callbacks */
+    uint32                maxBatch;                                            /**<\brief largest number of timers expired at one wheel tick */
+} Ifx_TimerWheel;
+
+/** \brief Indicates whether the timer is running
+ * \param timer Pointer to the timer
+ * \return Returns TRUE if the timer is started and has not expired
+ */
+IFX_INLINE boolean Ifx_TimerWheel_isActive(const Ifx_TimerWheel_Timer *timer)
+{
+    return timer->list != NULL_PTR;
+}
+
+
+/** \brief Initialize the timer wheel, no timer is running
+ *
+ * The STM comparator and its interrupt shall be initialised before, e.g. with IfxStm_initCompare().
+ * \param wheel Pointer to the timer wheel object
+ * \param stm STM module
+ * \param comparator STM comparator
+ * \param period Wheel tick in STM ticks
+ */
+IFX_EXTERN void Ifx_TimerWheel_init(Ifx_TimerWheel *wheel, Ifx_STM *stm, IfxStm_Comparator comparator, uint32 period);
+
+/** \brief Initialize a timer, the timer is stopped
+ * \param timer Pointer to the timer
+ * \param callback Callback called when the timer expires
+ * \param data Data given to the callback
+ */
+IFX_EXTERN void Ifx_TimerWheel_initTimer(Ifx_TimerWheel_Timer *timer, Ifx_TimerWheel_Callback callback, void *data);
+
+/** \brief Process the expired timers. Called from the STM compare interrupt
+ * \param wheel Pointer to the timer wheel object
+ */
+IFX_EXTERN void Ifx_TimerWheel_process(Ifx_TimerWheel *wheel);
+
+/** \brief Start or restart a timer
+ * \param wheel Pointer to the timer wheel object
+ * \param timer Pointer to the timer
+ * \param ticks Delay to the first expiry in wheel ticks, at least 1
+ * \param period Period in wheel ticks for a periodic timer, 0 for a single shot timer
+ */
+IFX_EXTERN void Ifx_TimerWheel_start(Ifx_TimerWheel *wheel, Ifx_TimerWheel_Timer *timer, uint32 ticks, uint32 period);
+
+/** \brief Stop a timer. Nothing is done if the timer is not running
+ * \param wheel Pointer to the timer wheel object
+ * \param timer Pointer to the timer
+ */
+IFX_EXTERN void Ifx_TimerWheel_stop(Ifx_TimerWheel *wheel, Ifx_TimerWheel_Timer *timer);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -0,0 +1,172 @@
+/**
+ * \file Ifx_Trace.h
+ * \brief Time stamped event trace
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_time_trace Event trace
+ * \ingroup library_srvsw_sysse_time
+ *
+ * The trace stores events (ISR entry / exit, task start / stop, errors...) as \ref Ifx_Trace_Record
+ * in one ring per CPU. A record holds the system timer value (see now()), the CPU index, the event ID
+ * and one payload word.
+ *
+ * The rings are written by the local CPU only, the interrupts are disabled for the few instructions
+ * storing the record, no lock is shared between CPUs. When a ring is full, the oldest records are
+ * overwritten, the ring always holds the last records before a failure.
+ * The records should be located in the DSPR of the CPU writing them.
+ *
+ * The rings can be read:
+ * - by the shell command \ref Ifx_Trace_showRecords(), e.g. over ASCLIN
+ * - by the debugger or a host tool through \ref Ifx_g_TraceHostAccess, which is identified by
+ * the signature \ref IFX_TRACE_SIGNATURE and contains the global addresses of the rings
+ *
+ * Usage example:
+ * \code
+ * static Ifx_Trace_Record traceRecordsCpu0[256]; // located in DSPR0
+ * static Ifx_Trace_Buffer traceCpu0;
+ *
+ * // initialisation, on CPU0
+ * Ifx_Trace_init(&traceCpu0, traceRecordsCpu0, 256);
+ *
+ * // interrupt
+ * IFX_TRACE(Ifx_Trace_Event_isrEntry, ISR_PRIORITY_ADC);
+ * ...
+ * IFX_TRACE(Ifx_Trace_Event_isrExit, ISR_PRIORITY_ADC);
+ *
+ * // shell command list entry, NULL_PTR for all CPUs
+ * {"trace", "   : Show the trace records", NULL_PTR, &Ifx_Trace_showRecords},
+ * \endcode
+ *
+ */
+#ifndef IFX_TRACE_H
+#define IFX_TRACE_H 1
+
+#include "Cpu/Std/IfxCpu.h"
+#include "SysSe/Bsp/Bsp.h"
+#include "StdIf/IfxStdIf_DPipe.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_TRACE_ENABLED)
+#define IFX_CFG_TRACE_ENABLED (1)   /**<\brief If 0, \ref IFX_TRACE() is compiled out */
+#endif
+
+#define IFX_TRACE_SIGNATURE   (0x45435254U)  /**<\brief \ref Ifx_g_TraceHostAccess signature: "TRCE" */
+#define IFX_TRACE_VERSION     (1)            /**<\brief \ref Ifx_g_TraceHostAccess layout version */
+
+/** \brief Store an event into the ring of the calling CPU
+ *
+ * Nothing is stored if the ring of the calling CPU is not initialized.
+ * \param event event ID, see \ref Ifx_Trace_Event
+ * \param payload event payload, converted to uint32
+ */
+#if IFX_CFG_TRACE_ENABLED
+#define IFX_TRACE(event, payload) Ifx_Trace_log(Ifx_g_TraceHostAccess.buffers[IfxCpu_getCoreIndex()], (uint16)(event), (uint32)(payload))
+#else
+#define IFX_TRACE(event, payload)
+#endif
+
+/** \addtogroup library_srvsw_sysse_time_trace
+ * \{ */
+
+/** \brief Event IDs. The application events start at Ifx_Trace_Event_user */
+typedef enum
+{
+    Ifx_Trace_Event_isrEntry     = 1,       /**<\brief interrupt entry, payload: interrupt priority */
+    Ifx_Trace_Event_isrExit      = 2,       /**<\brief interrupt exit, payload: interrupt priority */
+    Ifx_Trace_Event_taskStart    = 3,       /**<\brief task start, payload: task ID */
+    Ifx_Trace_Event_taskStop     = 4,       /**<\brief task end, payload: task ID */
+    Ifx_Trace_Event_fifoOverflow = 5,       /**<\brief FIFO overflow, payload: FIFO address */
+    Ifx_Trace_Event_canBusOff    = 6,       /**<\brief CAN bus off, payload: CAN node ID */
+    Ifx_Trace_Event_user         = 0x100    /**<\brief first application event ID */
+} Ifx_Trace_Event;
+
+/** \brief Trace record, 16 bytes */
+typedef struct
+{
+    uint64 timestamp;           /**<\brief system timer value, see now() */
+    uint16 event;               /**<\brief event ID */
+    uint8  cpu;                 /**<\brief CPU index */
+    uint8  reserved;            /**<\brief reserved, 0 */
+    uint32 payload;             /**<\brief event payload */
+} Ifx_Trace_Record;
+
+/** \brief Trace ring of one CPU */
+typedef struct
+{
+    Ifx_Trace_Record *records;          /**<\brief record ring, global address */
+    uint32            mask;             /**<\brief number of records in the ring minus 1 */
+    volatile uint32   writeCount;       /**<\brief number of records written since init. The next record is written at (writeCount & mask) */
+    uint8             cpu;              /**<\brief CPU writing the ring */
+} Ifx_Trace_Buffer;
+
+/** \brief Host access table, located at a fixed symbol for the debugger or host tools */
+typedef struct
+{
+    uint32                     signature;                       /**<\brief \ref IFX_TRACE_SIGNATURE */
+    uint16                     version;                         /**<\brief \ref IFX_TRACE_VERSION */
+    uint16                     recordSize;                      /**<\brief sizeof(Ifx_Trace_Record) */
+    Ifx_Trace_Buffer *volatile buffers[IFXCPU_NUM_MODULES];     /**<\brief ring of each CPU, global address, NULL_PTR if not initialized */
+} Ifx_Trace_HostAccess;
+
+/** \brief Host access table */
+IFX_EXTERN Ifx_Trace_HostAccess Ifx_g_TraceHostAccess;
+
+/** \brief Initialize the ring of the calling CPU and register it in \ref Ifx_g_TraceHostAccess
+ * \param buffer Pointer to the ring object
+ * \param records Pointer to the records, should be located in the DSPR of the calling CPU
+ * \param size Number of records, must be a power of 2
+ */
+IFX_EXTERN void Ifx_Trace_init(Ifx_Trace_Buffer *buffer, Ifx_Trace_Record *records, uint32 size);
+
+/** \brief Store an event into a ring. Must be called from the CPU which initialized the ring
+ * \param buffer Pointer to the ring object, if NULL_PTR nothing is stored
+ * \param event event ID, see \ref Ifx_Trace_Event
+ * \param payload event payload
+ */
+IFX_INLINE void Ifx_Trace_log(Ifx_Trace_Buffer *buffer, uint16 event, uint32 payload)
+{
+    if (buffer != NULL_PTR)
+    {
+        Ifx_Trace_Record *record;
+        boolean           interruptState = IfxCpu_disableInterrupts();
+        uint32            index          = buffer->writeCount;
+
+        buffer->writeCount = index + 1;
+        record             = &buffer->records[index & buffer->mask];
+        record->timestamp  = (uint64)nowWithoutCriticalSection();
+        record->event      = event;
+        record->cpu        = buffer->cpu;
+        record->reserved   = 0;
+        record->payload    = payload;
+        IfxCpu_restoreInterrupts(interruptState);
+    }
+}
+
+
+/** \brief Shell command: print the records, oldest first
+ * \param args command arguments
+ * \param data Pointer to the ring object, or NULL_PTR for the rings of all CPUs
+ * \param io Pointer to the IfxStdIf_DPipe object
+ * \return TRUE
+ */
+IFX_EXTERN boolean Ifx_Trace_showRecords(pchar args, void *data, IfxStdIf_DPipe *io);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -48,6 +48,54 @@
 /** \brief Feature is not available on the selected hardware */
 #define IFX_ASSERT_FEATURE_NOT_AVAILABLE   (FALSE)
 
+/** \name Module filtering
+ *
+ * Each translation unit belongs to an assertion module, selected by defining IFX_ASSERT_MODULE before the
+ * first include of the source file, e.g.:
+ * \code
+ * #define IFX_ASSERT_MODULE ASCLIN
+ * #include "IfxAsclin_Asc.h"
+ * \endcode
+ * The assertions of a module with a level above IFX_CFG_ASSERT_LEVEL_<module> are removed at compile time,
+ * their expression is not evaluated. For example in Ifx_Cfg.h:
+ * \code
+ * #define IFX_CFG_ASSERT_LEVEL_ASCLIN (IFX_VERBOSE_LEVEL_ERROR)  // only failure and error assertions
+ * #define IFX_CFG_ASSERT_LEVEL_FIFO   (IFX_VERBOSE_LEVEL_OFF)    // no assertion
+ * \endcode
+ * The module identifiers are stored in the assertion log, see \ref IFX_CFG_ASSERT_LOG.
+ * \{ */
+#define IFX_ASSERT_MODULE_ID_OTHER         (0) /**< \brief Translation units without IFX_ASSERT_MODULE */
+#define IFX_ASSERT_MODULE_ID_ASCLIN        (1) /**< \brief ASCLIN drivers */
+#define IFX_ASSERT_MODULE_ID_FIFO          (2) /**< \brief FIFO */
+
+#ifndef IFX_ASSERT_MODULE
+#    define IFX_ASSERT_MODULE              OTHER
+#endif
+
+#ifndef IFX_CFG_ASSERT_LEVEL_OTHER
+#    define IFX_CFG_ASSERT_LEVEL_OTHER     (IFX_VERBOSE_LEVEL_DEBUG) /**< \brief Highest assertion level compiled in the translation units without IFX_ASSERT_MODULE */
+#endif
+
+#ifndef IFX_CFG_ASSERT_LEVEL_ASCLIN
+#    define IFX_CFG_ASSERT_LEVEL_ASCLIN    (IFX_VERBOSE_LEVEL_DEBUG) /**< \brief Highest assertion level compiled in the ASCLIN drivers */
+#endif
+
+#ifndef IFX_CFG_ASSERT_LEVEL_FIFO
+#    define IFX_CFG_ASSERT_LEVEL_FIFO      (IFX_VERBOSE_LEVEL_DEBUG) /**< \brief Highest assertion level compiled in the FIFO */
+#endif
+
+/** \brief Module identifier of the translation unit */
+#define IFX_ASSERT_MODULE_ID               IFX_ASSERT_CONCAT(IFX_ASSERT_MODULE_ID_, IFX_ASSERT_MODULE)
+
+/** \brief TRUE if the assertions of the given level are compiled in the translation unit (constant expression) */
+#define IFX_ASSERT_IS_COMPILED(level)      ((level) <= IFX_ASSERT_CONCAT(IFX_CFG_ASSERT_LEVEL_, IFX_ASSERT_MODULE))
+
+/** \internal \brief Concatenation after macro expansion of the arguments */
+#define IFX_ASSERT_CONCAT(a, b)            IFX_ASSERT_CONCAT_(a, b)
+/** \internal */
+#define IFX_ASSERT_CONCAT_(a, b)           a ## b
+/** \} */
+
 #ifndef IFX_ASSERT
 #    define IFX_ASSERT(level, expr)   ((void)0)
 #endif
@@ -182,6 +182,53 @@
  *       IfxAsclin_Spi_exchange(&spi, NULL_PTR, spiRxBuffer, 8);
  *   \endcode
  *
+ *   \section IfxLld_Asclin_Spi_Dma DMA Mode
+ *
+ *   With dma.useDma the data are moved by two DMA channels, triggered by the Tx and Rx FIFO level service
+ *   requests of the module: one data per request, with the default FIFO interrupt levels (Tx 15, Rx 1). The CPU is
+ *   only interrupted once per exchange, by the receive DMA channel at the end of the exchange. The interrupt
+ *   priorities are the priorities of the DMA channel interrupts, the Tx and Rx service requests of the module are
+ *   routed to the DMA. Only the receive DMA channel interrupt and the error interrupt are used:
+ *
+ *   \code
+ *       IFX_INTERRUPT(asclin1DmaRxISR, 0, IFX_INTPRIO_ASCLIN1_RX)
+ *       {
+ *            IfxAsclin_Spi_isrDmaReceive(&spi);
+ *       }
+ *
+ *       // initialisation
+ *       spiConfig.interrupt.rxPriority = IFX_INTPRIO_ASCLIN1_RX;
+ *       spiConfig.interrupt.erPriority = IFX_INTPRIO_ASCLIN1_ER;
+ *       spiConfig.dma.txDmaChannelId   = IfxDma_ChannelId_3;
+ *       spiConfig.dma.rxDmaChannelId   = IfxDma_ChannelId_4;
+ *       spiConfig.dma.useDma           = TRUE;
+ *       IfxAsclin_Spi_initModule(&spi, &spiConfig);
+ *   \endcode
+ *
+ *   An exchange moves at most 16383 data in DMA mode.
+ *
+ *   \section IfxLld_Asclin_Spi_Queue Job Queue
+ *
+ *   Several clients can share one module with the job queue, as with the QSPI SPI master. A job carries its
+ *   data length and a completion callback. The jobs are started back-to-back from the completion interrupt,
+ *   no client waits on the transfers of another one:
+ *
+ *   \code
+ *       IfxAsclin_Spi_QueuedJob commandJob, shiftJob;
+ *
+ *       IfxAsclin_Spi_initJob(&commandJob, &spi, command, NULL_PTR, 2);
+ *
+ *       IfxAsclin_Spi_initJob(&shiftJob, &spi, outputs, inputs, 4);
+ *       IfxAsclin_Spi_setJobDataWidth(&shiftJob, 16);
+ *       IfxAsclin_Spi_setJobCallback(&shiftJob, &shiftDone, NULL_PTR);
+ *
+ *       IfxAsclin_Spi_queueJob(&commandJob);
+ *       IfxAsclin_Spi_queueJob(&shiftJob);
+ *   \endcode
+ *
+ *   The callback is executed in the completion interrupt. A job shall not be modified while it is queued,
+ *   \ref IfxAsclin_Spi_isJobDone() tells when it can be reused.
+ *
  * \defgroup IfxLld_Asclin_Spi SPI
  * \ingroup IfxLld_Asclin
  * \defgroup IfxLld_Asclin_Spi_DataStructures Data Structures
@@ -202,6 +249,15 @@
 /******************************************************************************/
 
 #include "Asclin/Std/IfxAsclin.h"
+#include "Dma/Dma/IfxDma_Dma.h"
+
+/******************************************************************************/
+/*------------------------------Type Definitions------------------------------*/
+/******************************************************************************/
+
+typedef struct IfxAsclin_Spi_QueuedJob_s IfxAsclin_Spi_QueuedJob;
+
+typedef void                             (*IfxAsclin_Spi_JobCallback)(IfxAsclin_Spi_QueuedJob *job);
 
 /******************************************************************************/
 /*-------------------------------Enumerations---------------------------------*/
@@ -238,6 +294,26 @@ typedef struct
     IfxAsclin_SamplesPerBit medianFilter;       /**< \brief BITCON.SM, no. of samples per bit 1 or 3 */
 } IfxAsclin_Spi_BitSamplingControl;
 
+/** \brief Dma handle
+ */
+typedef struct
+{
+    IfxDma_Dma_Channel rxDmaChannel;         /**< \brief receive DMA channel handle */
+    IfxDma_Dma_Channel txDmaChannel;         /**< \brief transmit DMA channel handle */
+    IfxDma_ChannelId   rxDmaChannelId;       /**< \brief DMA channel no for the Spi receive */
+    IfxDma_ChannelId   txDmaChannelId;       /**< \brief DMA channel no for the Spi transmit */
+    boolean            useDma;               /**< \brief use Dma for Data transfer/s */
+} IfxAsclin_Spi_Dma;
+
+/** \brief Dma configuration
+ */
+typedef struct
+{
+    IfxDma_ChannelId rxDmaChannelId;       /**< \brief DMA channel no for the Spi receive */
+    IfxDma_ChannelId txDmaChannelId;       /**< \brief DMA channel no for the Spi transmit */
+    boolean          useDma;               /**< \brief use Dma for Data transfer/s */
+} IfxAsclin_Spi_DmaConfig;
+
 /** \brief Structure for Error Flags
  */
 typedef struct
@@ -316,6 +392,16 @@ typedef struct
 
 /** \addtogroup IfxLld_Asclin_Spi_DataStructures
  * \{ */
+/** \brief Job queue
+ */
+typedef struct
+{
+    IfxAsclin_Spi_QueuedJob *first;            /**< \brief next job to be started */
+    IfxAsclin_Spi_QueuedJob *last;             /**< \brief last queued job */
+    IfxAsclin_Spi_QueuedJob *active;           /**< \brief job on transfer, NULL_PTR if none */
+    IfxAsclin_DataLength     dataLength;       /**< \brief module data length, restored after the active job */
+} IfxAsclin_Spi_JobQueue;
+
 /** \brief Module handle
  */
 typedef struct
@@ -327,8 +413,25 @@ typedef struct
     IfxAsclin_Spi_ErrorFlags errorFlags;               /**< \brief structure for error flags status */
     uint8                    dataWidth;                /**< \brief width of the data in bytes */
     boolean                  transferInProgress;       /**< \brief status of the transfer In progress */
+    IfxAsclin_Spi_Dma        dma;                      /**< \brief dma handle */
+    IfxAsclin_Spi_JobQueue   queue;                    /**< \brief job queue */
 } IfxAsclin_Spi;
 
+/** \brief Queued job: one exchange with its own data length
+ */
+struct IfxAsclin_Spi_QueuedJob_s
+{
+    IfxAsclin_Spi_QueuedJob  *next;             /**< \brief next job in the queue */
+    IfxAsclin_Spi            *spi;              /**< \brief module handle */
+    const void               *src;              /**< \brief data to be sent, NULL_PTR to send all-1 */
+    void                     *dest;             /**< \brief received data, NULL_PTR to discard them */
+    uint32                    count;            /**< \brief number of data */
+    IfxAsclin_DataLength      dataLength;       /**< \brief data length of the job */
+    IfxAsclin_Spi_JobCallback callback;         /**< \brief called on completion, NULL_PTR if none */
+    void                     *data;             /**< \brief callback data */
+    volatile boolean          done;             /**< \brief TRUE when the exchange is finished */
+};
+
 /** \brief Configuration structure of the module
  */
 typedef struct
@@ -344,6 +447,7 @@ typedef struct
     IfxAsclin_Spi_InterruptConfig    interrupt;         /**< \brief structure for interrupt configuration */
     IFX_CONST IfxAsclin_Spi_Pins    *pins;              /**< \brief structure for SPI pins */
     IfxAsclin_ClockSource            clockSource;       /**< \brief CSR.CLKSEL, clock source selection */
+    IfxAsclin_Spi_DmaConfig          dma;               /**< \brief Dma configuration */
 } IfxAsclin_Spi_Config;
 
 /** \} */
@@ -399,6 +503,12 @@ IFX_EXTERN void IfxAsclin_Spi_initModuleConfig(IfxAsclin_Spi_Config *config, Ifx
  */
 IFX_EXTERN void IfxAsclin_Spi_isrError(IfxAsclin_Spi *asclin);
 
+/** \brief Receive DMA channel interrupt handler, completes the exchange in DMA mode
+ * \param asclin module handle
+ * \return None
+ */
+IFX_EXTERN void IfxAsclin_Spi_isrDmaReceive(IfxAsclin_Spi *asclin);
+
 /** \brief ISR receive routine
  * \param asclin module handle
  * \return None
@@ -432,18 +542,63 @@ IFX_EXTERN void IfxAsclin_Spi_isrTransmit(IfxAsclin_Spi *asclin);
  */
 IFX_EXTERN IfxAsclin_Spi_Status IfxAsclin_Spi_exchange(IfxAsclin_Spi *asclin, void *src, void *dest, uint32 count);
 
+/** \brief Initialises a job with the data length of the module
+ * \param job Job to be initialised
+ * \param asclin module handle
+ * \param src Source of data. Can be set to NULL_PTR if nothing to transmit (receive only) - in this case, all-1 will be sent.
+ * \param dest Destination of data. Can be set to NULL_PTR if nothing to receive (transmit only).
+ * \param count Number of data
+ * \return None
+ */
+IFX_EXTERN void IfxAsclin_Spi_initJob(IfxAsclin_Spi_QueuedJob *job, IfxAsclin_Spi *asclin, const void *src, void *dest, uint32 count);
+
+/** \brief Appends a job to the queue of the module. The job is started immediately if the module is free,
+ * else after the previous jobs
+ * \param job Job to be queued
+ * \return IfxAsclin_Spi_Status_ok
+ *
+ * Usage example: see \ref IfxLld_Asclin_Spi_Queue
+ *
+ */
+IFX_EXTERN IfxAsclin_Spi_Status IfxAsclin_Spi_queueJob(IfxAsclin_Spi_QueuedJob *job);
+
 /** \brief Reads data from the Rx FIFO based on the outlet width
  * \param asclin module handle
  * \return None
  */
 IFX_EXTERN void IfxAsclin_Spi_read(IfxAsclin_Spi *asclin);
 
+/** \brief Sets the completion callback of a job
+ * \param job Job handle
+ * \param callback Function called in the completion interrupt, NULL_PTR if none
+ * \param data Callback data
+ * \return None
+ */
+IFX_EXTERN void IfxAsclin_Spi_setJobCallback(IfxAsclin_Spi_QueuedJob *job, IfxAsclin_Spi_JobCallback callback, void *data);
+
+/** \brief Sets the data width of a job
+ * \param job Job handle
+ * \param dataWidth Number of bits per data (1 .. 16)
+ * \return None
+ */
+IFX_EXTERN void IfxAsclin_Spi_setJobDataWidth(IfxAsclin_Spi_QueuedJob *job, uint8 dataWidth);
+
 /** \brief Writes data into the Tx FIFO based on the inlet width
  * \param asclin module handle
  * \return None
  */
 IFX_EXTERN void IfxAsclin_Spi_write(IfxAsclin_Spi *asclin);
 
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Returns TRUE when the job is finished
+ * \param job Job handle
+ * \return TRUE when the job is finished
+ */
+IFX_INLINE boolean IfxAsclin_Spi_isJobDone(IfxAsclin_Spi_QueuedJob *job);
+
 /** \} */
 
 /******************************************************************************/
@@ -456,4 +611,13 @@ IFX_EXTERN void IfxAsclin_Spi_write(IfxAsclin_Spi *asclin);
  */
 IFX_EXTERN IfxAsclin_Spi_Status IfxAsclin_Spi_getStatus(IfxAsclin_Spi *asclin);
 
+/******************************************************************************/
+/*---------------------Inline Function Implementations------------------------*/
+/******************************************************************************/
+
+IFX_INLINE boolean IfxAsclin_Spi_isJobDone(IfxAsclin_Spi_QueuedJob *job)
+{
+    return job->done;
+}
+
 #endif /* IFXASCLIN_SPI_H */
@@ -26,6 +26,7 @@
 /*----------------------------------Includes----------------------------------*/
 /******************************************************************************/
 
+#define IFX_ASSERT_MODULE ASCLIN
 #include "IfxAsclin.h"
 
 /******************************************************************************/
@@ -196,6 +196,41 @@
  *     timeStamp[i] = IfxCcu6_Icu_getTimeStamp(&icuChannel);
  * \endcode
  *
+ * \section IfxLld_Ccu6_Icu_Dma DMA capture ring
+ *
+ * For high frequency inputs, the captures can be moved by the DMA instead of interrupting the CPU on each edge.
+ * When IfxCcu6_Icu_ChannelConfig.dma.dma is set, the channel runs in IfxCcu6_T12ChannelMode_doubleRegisterCaptureRisingAndFalling:
+ * - the rising edge capture (CC6xR) and the falling edge capture (CC6xSR) service requests trigger one DMA channel each.
+ * - each DMA channel stores the 16 bit T12 value into its member of the current IfxCcu6_Icu_Capture of a ring.
+ * - T12 is set to count over the full 16 bit range (period 0xFFFF), so that the differences of the time stamps are
+ *   valid as long as the input period is shorter than 65536 T12 ticks.
+ *
+ * IfxCcu6_Icu_getDmaMeasurement() computes the mean period and duty cycle over the periods captured since its last call,
+ * e.g. from a periodic task:
+ *
+ * \code
+ *     // ring of 64 captures, aligned to its size
+ *     IFX_ALIGN(64 * sizeof(IfxCcu6_Icu_Capture)) IfxCcu6_Icu_Capture icuCaptures[64];
+ *
+ *     icuChannelConfig.channelMode               = IfxCcu6_T12ChannelMode_doubleRegisterCaptureRisingAndFalling;
+ *     icuChannelConfig.dma.dma                   = &dma;
+ *     icuChannelConfig.dma.risingChannelId       = IfxDma_ChannelId_4;
+ *     icuChannelConfig.dma.fallingChannelId      = IfxDma_ChannelId_5;
+ *     icuChannelConfig.dma.risingServiceRequest  = IfxCcu6_ServiceRequest_2;
+ *     icuChannelConfig.dma.fallingServiceRequest = IfxCcu6_ServiceRequest_3;
+ *     icuChannelConfig.dma.buffer                = icuCaptures;
+ *     icuChannelConfig.dma.length                = 64;
+ *     IfxCcu6_Icu_initChannel(&icuChannel, &icuChannelConfig);
+ *     IfxCcu6_Icu_startCapture(&icuChannel);
+ *
+ *     // 1 ms task
+ *     IfxCcu6_Icu_Measurement measurement;
+ *     if (IfxCcu6_Icu_getDmaMeasurement(&icuChannel, &measurement, 32) != FALSE)
+ *     {
+ *         // measurement.frequency, measurement.dutyCycle
+ *     }
+ * \endcode
+ *
  * \defgroup IfxLld_Ccu6_Icu ICU Interface driver
  * \ingroup IfxLld_Ccu6
  * \defgroup IfxLld_Ccu6_Icu_DataStructures Data Structures
@@ -218,6 +253,7 @@
 #include "Ccu6/Std/IfxCcu6.h"
 #include "If/Ccu6If/Icu.h"
 #include "Ccu6/Timer/IfxCcu6_Timer.h"
+#include "Dma/Dma/IfxDma_Dma.h"
 
 /******************************************************************************/
 /*-----------------------------Data Structures--------------------------------*/
@@ -225,6 +261,14 @@
 
 /** \addtogroup IfxLld_Ccu6_Icu_DataStructures
  * \{ */
+/** \brief Time stamps of one input period, written by the DMA
+ */
+typedef struct
+{
+    uint16 rising;        /**< \brief T12 value at the rising edge */
+    uint16 falling;       /**< \brief T12 value at the falling edge */
+} IfxCcu6_Icu_Capture;
+
 /** \brief Structure for clock configuration
  */
 typedef struct
@@ -234,6 +278,19 @@ typedef struct
     IfxCcu6_CountingInputMode countingInputMode;       /**< \brief Input event leading to a counting action of the timer T12 */
 } IfxCcu6_Icu_Clock;
 
+/** \brief Structure for the DMA capture ring configuration
+ */
+typedef struct
+{
+    IfxDma_Dma             *dma;                         /**< \brief Pointer to the DMA driver. If NULL_PTR, the captures are not moved by the DMA */
+    IfxDma_ChannelId        risingChannelId;             /**< \brief DMA channel of the rising edge captures, also the priority of its service request. Must not be 0 */
+    IfxDma_ChannelId        fallingChannelId;            /**< \brief DMA channel of the falling edge captures, also the priority of its service request. Must not be 0 */
+    IfxCcu6_ServiceRequest  risingServiceRequest;        /**< \brief Service request output of the rising edge captures */
+    IfxCcu6_ServiceRequest  fallingServiceRequest;       /**< \brief Service request output of the falling edge captures */
+    IfxCcu6_Icu_Capture    *buffer;                      /**< \brief Ring of length captures, aligned to its size in bytes */
+    uint16                  length;                      /**< \brief Number of captures of the ring: power of 2, 4 .. 8192 */
+} IfxCcu6_Icu_DmaConfig;
+
 /** \brief Structure for interrupt configuration
  */
 typedef struct
@@ -244,6 +301,17 @@ typedef struct
     IfxSrc_Tos              typeOfService;        /**< \brief type of interrupt service */
 } IfxCcu6_Icu_InterruptConfig;
 
+/** \brief Result of IfxCcu6_Icu_getDmaMeasurement()
+ */
+typedef struct
+{
+    float32 period;           /**< \brief Mean period in T12 ticks */
+    float32 highTime;         /**< \brief Mean high time in T12 ticks */
+    float32 frequency;        /**< \brief Mean input frequency in Hz */
+    float32 dutyCycle;        /**< \brief Mean duty cycle, 0.0 .. 1.0 */
+    uint16  periods;          /**< \brief Number of periods averaged */
+} IfxCcu6_Icu_Measurement;
+
 /** \brief Structure for capture input pins
  */
 typedef struct
@@ -270,6 +338,19 @@ typedef struct
     IfxCcu6_ExternalTriggerMode extInputTriggerMode;       /**< \brief Event of signal T12HR that can set the run bit T12R by HW */
 } IfxCcu6_Icu_TriggerConfig;
 
+/** \brief DMA capture ring handle
+ */
+typedef struct
+{
+    boolean              enabled;                  /**< \brief TRUE if the captures are moved by the DMA */
+    IfxDma_Dma_Channel   risingChannel;            /**< \brief DMA channel of the rising edge captures */
+    IfxDma_Dma_Channel   fallingChannel;           /**< \brief DMA channel of the falling edge captures */
+    IfxCcu6_Icu_Capture *buffer;                   /**< \brief Ring of captures */
+    uint16               length;                   /**< \brief Number of captures of the ring */
+    uint16               readIndex;                /**< \brief Index of the next rising edge capture not yet measured */
+    boolean              started;                  /**< \brief TRUE once the first rising edge has been measured */
+} IfxCcu6_Icu_Dma;
+
 /** \} */
 
 /** \addtogroup IfxLld_Ccu6_Icu_DataStructures
@@ -290,6 +371,7 @@ typedef struct
     IfxCcu6_Icu_TriggerConfig trigger;           /**< \brief Structure for trigger configuration */
     IfxCcu6_T12Channel        channelId;         /**< \brief Capture compare channel of the Timer12 */
     IfxCcu6_T12ChannelMode    channelMode;       /**< \brief The operating mode for the T12 channel */
+    IfxCcu6_Icu_Dma           dma;               /**< \brief DMA capture ring, see \ref IfxLld_Ccu6_Icu_Dma */
 } IfxCcu6_Icu_Channel;
 
 /** \brief Configuration structure of the channel
@@ -308,6 +390,7 @@ typedef struct
     IfxCcu6_Icu_Pins           *pins;                           /**< \brief Structure for capture input pins */
     boolean                     multiInputCaptureEnabled;       /**< \brief Choice of multi input capture */
     IfxCcu6_Timer               timer;                          /**< \brief Timer handle */
+    IfxCcu6_Icu_DmaConfig       dma;                            /**< \brief DMA capture ring configuration, see \ref IfxLld_Ccu6_Icu_Dma */
 } IfxCcu6_Icu_ChannelConfig;
 
 /** \brief Configuration structure of the module
@@ -360,6 +443,17 @@ IFX_EXTERN void IfxCcu6_Icu_initModuleConfig(IfxCcu6_Icu_Config *config, Ifx_CCU
 /*-------------------------Global Function Prototypes-------------------------*/
 /******************************************************************************/
 
+/** \brief Computes the mean period and duty cycle over the periods captured by the DMA since the last call
+ * \param channel Channel handle
+ * \param measurement Result, written only if TRUE is returned
+ * \param maxPeriods Maximum number of the latest periods averaged, 1 .. length - 2
+ * \return TRUE if at least one new period was captured, FALSE otherwise (e.g. input stuck)
+ *
+ * A coding example can be found in \ref IfxLld_Ccu6_Icu_Dma
+ *
+ */
+IFX_EXTERN boolean IfxCcu6_Icu_getDmaMeasurement(IfxCcu6_Icu_Channel *channel, IfxCcu6_Icu_Measurement *measurement, uint16 maxPeriods);
+
 /** \brief Returns the cuurent value stored in the Compare Shadow register (current time stamp)
  * \param channel Channel handle
  * \return timeStamp (cuurent CC6xSR register value)
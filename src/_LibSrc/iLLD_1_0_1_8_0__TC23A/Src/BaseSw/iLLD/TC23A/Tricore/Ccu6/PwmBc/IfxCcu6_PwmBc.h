@@ -222,6 +222,38 @@
  *     speed = IfxCcu6_PwmBc_getMotorSpeed(&pwmBc);
  * \endcode
  *
+ * \section IfxLld_Ccu6_PwmBc_HardwareCommutation Hardware commutation
+ *
+ * With dma.useDma, the six hall patterns of dma.controlTable are preloaded into RAM as MCMOUTS register values
+ * (current hall pattern, expected hall pattern, output pattern), and the multi-channel shadow transfer interrupt (STR)
+ * is routed to a DMA channel. The commutation then runs without CPU:
+ * - on a correct hall event, the CCU6 compares the hall inputs with the expected pattern, captures and resets T12
+ *   and transfers the hall pattern shadow (CURHS, EXPHS)
+ * - after the phase delay (CC61 compare) the output pattern shadow MCMPS is transferred to MCMP
+ * - the shadow transfer request triggers the DMA which writes the next table entry into MCMOUTS
+ *
+ * The table rows must be in the order of rotation, i.e. the expected pattern of a row is the current pattern
+ * of the next row. \ref IfxCcu6_PwmBc_start() synchronises the table with the hall inputs. On a wrong hall event
+ * (direction change, sensor fault) the application should stop the motor or call \ref IfxCcu6_PwmBc_syncCommutation().
+ *
+ * The commutation latency is the phase delay only, independent of the interrupt load. The speed is computed from the
+ * T12 capture of each hall edge, \ref IfxCcu6_PwmBc_getMotorSpeed() only reads registers and can be called from any
+ * context. The T12 period must be longer than the longest hall period to be measured.
+ *
+ * \code
+ *     IFX_ALIGN(32) IfxCcu6_PwmBc_DmaBuffer pwmBcDmaBuffer; // DSPR
+ *     uint8 commutationTable[6][3] = {{1, 3, 0x21}, {3, 2, 0x09}, {2, 6, 0x0C},
+ *                                     {6, 4, 0x24}, {4, 5, 0x06}, {5, 1, 0x12}};
+ *
+ *     pwmBcConfig.dma.useDma         = TRUE;
+ *     pwmBcConfig.dma.channelId      = IfxDma_ChannelId_2;
+ *     pwmBcConfig.dma.serviceRequest = IfxCcu6_ServiceRequest_1;
+ *     pwmBcConfig.dma.buffer         = &pwmBcDmaBuffer;
+ *     pwmBcConfig.dma.controlTable   = commutationTable;
+ *     IfxCcu6_PwmBc_initModule(&pwmBc, &pwmBcConfig);
+ *     IfxCcu6_PwmBc_start(&pwmBc);
+ * \endcode
+ *
  * \defgroup IfxLld_Ccu6_PwmBc PWMBC Interface driver
  * \ingroup IfxLld_Ccu6
  * \defgroup IfxLld_Ccu6_PwmBc_DataStructures Data Structures
@@ -243,6 +275,14 @@
 
 #include "Ccu6/Std/IfxCcu6.h"
 #include "If/Ccu6If/PwmHl.h"
+#include "Dma/Dma/IfxDma_Dma.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Number of hall patterns of the motor control table */
+#define IFXCCU6_PWMBC_NUM_HALL_PATTERNS (6)
 
 /******************************************************************************/
 /*-----------------------------Data Structures--------------------------------*/
@@ -322,6 +362,25 @@ typedef struct
     IfxCcu6_TrigSel             outputTrigger;                /**< \brief Trigger selection */
 } IfxCcu6_PwmBc_TriggerConfig;
 
+/** \brief DMA memory for the hardware commutation, must be located in DSPR and aligned on 32 bytes
+ */
+typedef struct
+{
+    Ifx_DMA_CH descriptors[IFXCCU6_PWMBC_NUM_HALL_PATTERNS];   /**< \brief DMA linked list, one entry per hall pattern */
+    uint32     mcmouts[IFXCCU6_PWMBC_NUM_HALL_PATTERNS];       /**< \brief MCMOUTS values, in the order of rotation */
+} IfxCcu6_PwmBc_DmaBuffer;
+
+/** \brief Configuration structure for the hardware commutation
+ */
+typedef struct
+{
+    boolean                  useDma;                   /**< \brief If TRUE, MCMOUTS is written by the DMA on each multi-channel shadow transfer */
+    IfxDma_ChannelId         channelId;                /**< \brief DMA channel, triggered by the shadow transfer interrupt */
+    IfxCcu6_ServiceRequest   serviceRequest;           /**< \brief Service request node of the shadow transfer interrupt (shared with the correct hall event interrupt) */
+    IfxCcu6_PwmBc_DmaBuffer *buffer;                   /**< \brief DMA memory */
+    uint8                  (*controlTable)[3];         /**< \brief Motor control table [6][3]: current hall pattern, expected hall pattern, output pattern. Rows in the order of rotation */
+} IfxCcu6_PwmBc_DmaConfig;
+
 /** \} */
 
 /** \addtogroup IfxLld_Ccu6_PwmBc_DataStructures
@@ -334,6 +393,9 @@ typedef struct
     Ifx_CCU6                   *ccu6;                   /**< \brief Pointer to the base of CCU6 registers */
     IfxCcu6_PwmBc_TriggerConfig trigger;                /**< \brief Structure for trigger configuration */
     uint8                       hallPatternIndex;       /**< \brief Hall pattern index of motor control table */
+    float32                     t12ClockFrequency;      /**< \brief T12 counter clock frequency in Hz */
+    IfxCcu6_PwmBc_DmaBuffer    *dmaBuffer;              /**< \brief DMA memory, NULL_PTR if MCMOUTS is written by the CPU */
+    IfxDma_Dma_Channel          dmaChannel;             /**< \brief DMA channel used for the hardware commutation */
 } IfxCcu6_PwmBc;
 
 /** \brief Configuration structure of the module
@@ -353,6 +415,7 @@ typedef struct
     IfxCcu6_PwmBc_InterruptConfig     interrupt3;                /**< \brief Structure for third interrupt configuration */
     IfxCcu6_PwmBc_InterruptConfig     interrupt4;                /**< \brief Structure for fourth interrupt configuration */
     IfxCcu6_PwmBc_TriggerConfig       trigger;                   /**< \brief Structure for trigger configuration */
+    IfxCcu6_PwmBc_DmaConfig           dma;                       /**< \brief Hardware commutation configuration */
 } IfxCcu6_PwmBc_Config;
 
 /** \} */
@@ -421,8 +484,11 @@ IFX_EXTERN void IfxCcu6_PwmBc_stop(IfxCcu6_PwmBc *pwmBc);
 /******************************************************************************/
 
 /** \brief returns the current motor speed
+ *
+ * The speed is computed from the time between the last two hall edges captured by T12 (CC60R), bounded by the
+ * time since the last hall edge when the motor decelerates. Registers are read only, the function is safe in any context.
  * \param pwmBc Module handle
- * \return speed
+ * \return Electrical speed in rpm, 0 before the first hall edge
  *
  * A coding example can be found in \ref IfxLld_Ccu6_PwmBc_Usage
  *
@@ -439,6 +505,16 @@ IFX_EXTERN uint32 IfxCcu6_PwmBc_getMotorSpeed(IfxCcu6_PwmBc *pwmBc);
  */
 IFX_EXTERN void IfxCcu6_PwmBc_updateHallPattern(IfxCcu6_PwmBc * pwmBc, uint8 controlTable[6][3]);
 
+/** \brief Synchronises the hardware commutation with the actual hall inputs
+ *
+ * The hall and output patterns of the actual hall inputs are applied immediately, the next row is written
+ * into MCMOUTS and the DMA continues with the row after. Used by \ref IfxCcu6_PwmBc_start(), and after a
+ * wrong hall event. Only used with dma.useDma.
+ * \param pwmBc Module handle
+ * \return FALSE if the hall inputs do not match any row of the control table, else TRUE
+ */
+IFX_EXTERN boolean IfxCcu6_PwmBc_syncCommutation(IfxCcu6_PwmBc *pwmBc);
+
 /** \} */
 
 #endif /* IFXCCU6_PWMBC_H */
@@ -32,6 +32,9 @@
  *
  * \defgroup IfxLld_Cpu_CStart_ConfigEnableCores How to enable CPUs during startup?
  * \ingroup IfxLld_Cpu_CStart
+ *
+ * \defgroup IfxLld_Cpu_CStart_ConfigBootTimes How to measure the startup time?
+ * \ingroup IfxLld_Cpu_CStart
  */
 #ifndef IFXCPU_CSTART_H_
 #define IFXCPU_CSTART_H_
@@ -55,12 +58,34 @@
 #ifndef IFX_CFG_CPU_CSTART_PRE_C_INIT_HOOK
 #   define IFX_CFG_CPU_CSTART_PRE_C_INIT_HOOK(cpu) /**< Hook function is empty if not configured*/
 #endif
+
+/** \brief Configuration for the startup time stamps, see \ref IfxLld_Cpu_CStart_ConfigBootTimes
+ *
+ */
+#ifndef IFX_CFG_CPU_CSTART_BOOT_TIMES
+#   define IFX_CFG_CPU_CSTART_BOOT_TIMES (0)  /**< No startup time stamps by default*/
+#endif
 /******************************************************************************/
 /*                         Exported prototypes                                */
 /******************************************************************************/
 void _Core1_start(void);
 void _Core2_start(void);
 
+#if (IFX_CFG_CPU_CSTART_BOOT_TIMES != 0)
+/** \brief STM0 time stamps of the CPU0 startup, see \ref IfxLld_Cpu_CStart_ConfigBootTimes */
+typedef struct
+{
+    uint32  start;             /**< \brief STM0 value at _Core0_start() entry: boot software time since reset */
+    uint32  cInit;             /**< \brief STM0 value after the C variables initialization */
+    uint32  clockInit;         /**< \brief STM0 value after the clock system initialization */
+    uint32  main;              /**< \brief STM0 value before core0_main() is called */
+    float32 resetFrequency;    /**< \brief STM frequency before the clock system initialization */
+} IfxCpu_CStart_BootTimes;
+
+/** \brief Time stamps of the CPU0 startup, valid from core0_main() on */
+IFX_EXTERN IfxCpu_CStart_BootTimes IfxCpu_CStart0_bootTimes;
+#endif
+
 /*Documentation */
 
 /** \addtogroup IfxLld_Cpu_CStart_StartupSequence
@@ -257,5 +282,26 @@ void _Core2_start(void);
 
 /** \} */
 
+/** \addtogroup IfxLld_Cpu_CStart_ConfigBootTimes
+ * \{
+ *
+ * With IFX_CFG_CPU_CSTART_BOOT_TIMES set to 1, CPU0 records the STM0 value, which counts from the reset, at the
+ * steps of its startup into \ref IfxCpu_CStart0_bootTimes: _Core0_start() entry, end of the C variables
+ * initialization, end of the clock system initialization and call of core0_main(). The STM frequency changes with
+ * the clock system initialization, the frequency before is recorded too.
+ *
+ * \code
+ * //file: Ifx_Cfg.h
+ *
+ * #define IFX_CFG_CPU_CSTART_BOOT_TIMES (1)   //Record the startup time stamps
+ *
+ * \endcode
+ *
+ * The time stamps are the first records of \ref library_srvsw_sysse_time_bootprofile
+ *
+ */
+
+/** \} */
+
 #endif /*#ifndef IFX_CFG_USE_COMPILER_DEFAULT_LINKER */
 #endif /* IFXCPU_CSTART_H_ */
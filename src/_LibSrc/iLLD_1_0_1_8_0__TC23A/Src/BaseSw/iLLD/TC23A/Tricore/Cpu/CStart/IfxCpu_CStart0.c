@@ -32,12 +32,16 @@
 #include "Cpu/CStart/IfxCpu_CStart.h"
 #include "IfxScu_reg.h"
 #include "IfxCpu_reg.h"
+#if (IFX_CFG_CPU_CSTART_BOOT_TIMES != 0)
+#include "IfxStm_reg.h"
+#endif
 
 /******************************************************************************/
 /*                           Macros                                           */
 /******************************************************************************/
 /** \brief Configuration for cache enable.
- *
+ * The data cache can be enabled when the buffers shared with the DMA are placed with IFX_DMA_BUFFER or in a non
+ * cached segment, or are maintained with IfxCpu_flushDataCache().
  */
 #ifndef IFX_CFG_CPU_CSTART_ENABLE_TRICORE0_PCACHE
 #   define IFX_CFG_CPU_CSTART_ENABLE_TRICORE0_PCACHE (1)  /**< Program Cache enabled by default*/
@@ -67,6 +71,13 @@ __asm("\t .extern core0_main");
 #define IFXCSTART0_PSW_DEFAULT     (0x00000980u)
 #define IFXCSTART0_PCX_O_S_DEFAULT (0xfff00000u)
 
+/*******************************************************************************
+**                      Global Variable Definitions                           **
+*******************************************************************************/
+#if (IFX_CFG_CPU_CSTART_BOOT_TIMES != 0)
+IfxCpu_CStart_BootTimes IfxCpu_CStart0_bootTimes;
+#endif
+
 /*********************************************************************************
 * _start() - startup code
 *********************************************************************************/
@@ -76,6 +87,9 @@ __asm("\t .extern core0_main");
 
 void _Core0_start(void)
 {
+#if (IFX_CFG_CPU_CSTART_BOOT_TIMES != 0)
+    uint32 bootStart = MODULE_STM0.TIM0.U;  /*Kept until the C variables are initialized */
+#endif
     uint32 pcxi;
     uint16 cpuWdtPassword = IfxScuWdt_getCpuWatchdogPasswordInline(&MODULE_SCU.WDTCPU[0]);
 
@@ -136,9 +150,20 @@ void _Core0_start(void)
         IfxScuWdt_enableSafetyWatchdog(safetyWdtPassword);
     }
 
+#if (IFX_CFG_CPU_CSTART_BOOT_TIMES != 0)
+    IfxCpu_CStart0_bootTimes.start          = bootStart;
+    IfxCpu_CStart0_bootTimes.cInit          = MODULE_STM0.TIM0.U;
+    IfxCpu_CStart0_bootTimes.resetFrequency = IfxScuCcu_getStmFrequency();
+#endif
+
     /*Initialize the clock system */
     IFXCPU_CSTART_CCU_INIT_HOOK();
 
+#if (IFX_CFG_CPU_CSTART_BOOT_TIMES != 0)
+    IfxCpu_CStart0_bootTimes.clockInit = MODULE_STM0.TIM0.U;
+    IfxCpu_CStart0_bootTimes.main      = IfxCpu_CStart0_bootTimes.clockInit;
+#endif
+
     /*Call main function of Cpu0 */
     __non_return_call(core0_main);
 }
@@ -944,6 +944,15 @@ asm __upackhw    __insertuhw2( __upackhw a, uint16 b)
     insert  %d2, a, b, 16, 16
 }
 
+/**  Multiply-add of two __packhw Q15 values with rounding and saturation: acc + a * b for each halfword
+ */
+asm __packhw __maddrsh(__packhw acc, __packhw a, __packhw b)
+{
+% reg acc, a, b
+! "%d2"
+    maddrs.h %d2, acc, a, bUL, 1
+}
+
 /**  Minimum of two  __packb values
  */
 #ifdef INTRINSIC_WORKAROUND
@@ -984,6 +993,42 @@ asm __upackhw    __minhu( __upackhw a, __upackhw b)
     min.hu %d2, a, b
 }
 
+/**  Multiply-subtract of two __packhw Q15 values with rounding and saturation: acc - a * b for each halfword
+ */
+asm __packhw __msubrsh(__packhw acc, __packhw a, __packhw b)
+{
+% reg acc, a, b
+! "%d2"
+    msubrs.h %d2, acc, a, bUL, 1
+}
+
+/**  Multiplication of two __packhw Q15 values with rounding: a * b for each halfword
+ */
+asm __packhw __mulrh(__packhw a, __packhw b)
+{
+% reg a, b
+! "%d2"
+    mulr.h %d2, a, bUL, 1
+}
+
+/**  Addition of two __packhw values without saturation: a + b for each halfword, signed or unsigned
+ */
+asm __packhw __addh(__packhw a, __packhw b)
+{
+% reg a, b
+! "%d2"
+    add.h %d2, a, b
+}
+
+/**  Subtraction of two __packhw values without saturation: a - b for each halfword, signed or unsigned
+ */
+asm __packhw __subh(__packhw a, __packhw b)
+{
+% reg a, b
+! "%d2"
+    sub.h %d2, a, b
+}
+
 /**  Insert sint8 into first byte of a __packb
  */
 asm volatile void __setbyte1(__packb* a, sint8 b)
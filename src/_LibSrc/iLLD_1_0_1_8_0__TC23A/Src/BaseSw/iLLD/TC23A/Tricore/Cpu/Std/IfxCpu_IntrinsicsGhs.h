@@ -103,6 +103,24 @@ IFX_INLINE void __jumpBackToLink(void)
  * \{
  */
 #define __saturate(X,Min,Max)           ( __min(__max(X, Min), Max) )
+
+/** add signed with saturation
+ */
+IFX_INLINE sint32 __adds(sint32 a, sint32 b)
+{
+    sint32 res;
+    __asm__ volatile ("adds %0, %1, %2": "=d" (res) : "d" (a), "d" (b));
+    return res;
+}
+
+/** substract signed with saturation
+ */
+IFX_INLINE sint32 __subs(sint32 a, sint32 b)
+{
+    sint32 res;
+    __asm__ volatile ("subs %0, %1, %2": "=d" (res) : "d" (a), "d" (b));
+    return res;
+}
 /** \} */
 
 /** \defgroup IfxLld_Cpu_Intrinsics_Ghs_unsinged_integer Unsigned integer operation
@@ -889,6 +907,56 @@ IFX_INLINE __upackhw    __insertuhw2( __upackhw a, uint16 b)
     return res;
 }
 
+/**  Multiply-add of two __packhw Q15 values with rounding and saturation: acc + a * b for each halfword
+ */
+IFX_INLINE __packhw __maddrsh(__packhw acc, __packhw a, __packhw b)
+{
+    __packhw res;
+    __asm__ volatile ("maddrs.h %0,%1,%2,%3ul,1"
+                      :"=d"(res):"d"(acc), "d"(a), "d"(b):"memory");
+    return res;
+}
+
+/**  Multiply-subtract of two __packhw Q15 values with rounding and saturation: acc - a * b for each halfword
+ */
+IFX_INLINE __packhw __msubrsh(__packhw acc, __packhw a, __packhw b)
+{
+    __packhw res;
+    __asm__ volatile ("msubrs.h %0,%1,%2,%3ul,1"
+                      :"=d"(res):"d"(acc), "d"(a), "d"(b):"memory");
+    return res;
+}
+
+/**  Multiplication of two __packhw Q15 values with rounding: a * b for each halfword
+ */
+IFX_INLINE __packhw __mulrh(__packhw a, __packhw b)
+{
+    __packhw res;
+    __asm__ volatile ("mulr.h %0,%1,%2ul,1"
+                      :"=d"(res):"d"(a), "d"(b):"memory");
+    return res;
+}
+
+/**  Addition of two __packhw values without saturation: a + b for each halfword, signed or unsigned
+ */
+IFX_INLINE __packhw __addh(__packhw a, __packhw b)
+{
+    __packhw res;
+    __asm__ volatile ("add.h %0,%1,%2"
+                      :"=d"(res):"d"(a), "d"(b):"memory");
+    return res;
+}
+
+/**  Subtraction of two __packhw values without saturation: a - b for each halfword, signed or unsigned
+ */
+IFX_INLINE __packhw __subh(__packhw a, __packhw b)
+{
+    __packhw res;
+    __asm__ volatile ("sub.h %0,%1,%2"
+                      :"=d"(res):"d"(a), "d"(b):"memory");
+    return res;
+}
+
 /**  Insert sint8 into first byte of a __packb
  */
 IFX_INLINE void __setbyte1(__packb* a, sint8 b)
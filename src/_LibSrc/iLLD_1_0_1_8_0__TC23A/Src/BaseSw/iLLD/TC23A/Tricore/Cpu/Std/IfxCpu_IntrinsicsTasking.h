@@ -185,6 +185,52 @@ IFX_INLINE void __jumpBackToLink(void)
  * \{
  */
 
+/**  Multiply-add of two __packhw Q15 values with rounding and saturation: acc + a * b for each halfword
+ */
+IFX_INLINE __packhw __maddrsh(__packhw acc, __packhw a, __packhw b)
+{
+    __packhw res;
+    __asm("maddrs.h %0,%1,%2,%3ul,1":"=d"(res):"d"(acc),"d"(a),"d"(b));
+    return res;
+}
+
+/**  Multiply-subtract of two __packhw Q15 values with rounding and saturation: acc - a * b for each halfword
+ */
+IFX_INLINE __packhw __msubrsh(__packhw acc, __packhw a, __packhw b)
+{
+    __packhw res;
+    __asm("msubrs.h %0,%1,%2,%3ul,1":"=d"(res):"d"(acc),"d"(a),"d"(b));
+    return res;
+}
+
+/**  Multiplication of two __packhw Q15 values with rounding: a * b for each halfword
+ */
+IFX_INLINE __packhw __mulrh(__packhw a, __packhw b)
+{
+    __packhw res;
+    __asm("mulr.h %0,%1,%2ul,1":"=d"(res):"d"(a),"d"(b));
+    return res;
+}
+
+/**  Addition of two __packhw values without saturation: a + b for each halfword, signed or unsigned
+ */
+IFX_INLINE __packhw __addh(__packhw a, __packhw b)
+{
+    __packhw res;
+    __asm("add.h %0,%1,%2":"=d"(res):"d"(a),"d"(b));
+    return res;
+}
+
+/**  Subtraction of two __packhw values without saturation: a - b for each halfword, signed or unsigned
+ */
+IFX_INLINE __packhw __subh(__packhw a, __packhw b)
+{
+    __packhw res;
+    __asm("sub.h %0,%1,%2":"=d"(res):"d"(a),"d"(b));
+    return res;
+}
+
+
 /** \} */
 
 /** \defgroup IfxLld_Cpu_Intrinsics_Tasking_register Register Handling
@@ -31,7 +31,9 @@
 #include "Cpu/Std/IfxCpu.h"
 #include "Cpu/Std/IfxCpu_Intrinsics.h"
 #include "IfxCpu_reg.h"
+#include "IfxStm_reg.h"
 #include "Ifx_Cfg.h"
+#include <string.h>
 #ifdef IFX_CFG_EXTEND_TRAP_HOOKS
 #include "Ifx_Cfg_Trap.h"
 #endif
@@ -88,13 +90,34 @@
 #ifndef IFX_CFG_CPU_TRAP_DEBUG
  #define IFX_CFG_CPU_TRAP_DEBUG __debug()
 #endif
+
+/** \brief TRUE if the error trap class returns without IFX_CFG_CPU_TRAP_DEBUG */
+#define IFXCPU_TRAP_IS_RECOVERABLE(trapClass) ((IFX_CFG_CPU_TRAP_RECOVERABLE & (1UL << (trapClass))) != 0)
 /*******************************************************************************
 **                      variables                                     **
 *******************************************************************************/
+IFX_CFG_CPU_TRAP_STATISTICS_SECTION IfxCpu_Trap_Statistics IfxCpu_Trap_statistics[IFXCPU_NUM_MODULES];
 
 /*******************************************************************************
 **                      Function definitions                          **
 *******************************************************************************/
+/** \brief Record the trap in the statistics of the CPU.
+ * Inlined: the context management trap handler shall not call any function
+ */
+IFX_INLINE void IfxCpu_Trap_record(IfxCpu_Trap trapInfo)
+{
+    IfxCpu_Trap_Statistics *statistics = &IfxCpu_Trap_statistics[IfxCpu_getCoreIndex()];
+    IfxCpu_Trap_Record     *record     = &statistics->records[statistics->total & (IFX_CFG_CPU_TRAP_LOG_SIZE - 1)];
+
+    record->pc        = trapInfo.tAddr;
+    record->timestamp = MODULE_STM0.TIM0.U;
+    record->tClass    = (uint8)trapInfo.tClass;
+    record->tId       = (uint8)trapInfo.tId;
+    statistics->count[trapInfo.tClass]++;
+    statistics->total++;
+}
+
+
 IFX_INLINE IfxCpu_Trap IfxCpu_Trap_extractTrapInfo(uint8 trapClass, uint32 tin)
 {
     IfxCpu_Trap trapInfo;
@@ -102,16 +125,50 @@ IFX_INLINE IfxCpu_Trap IfxCpu_Trap_extractTrapInfo(uint8 trapClass, uint32 tin)
     trapInfo.tClass = trapClass;
     trapInfo.tId    = tin;
     trapInfo.tCpu   = IfxCpu_getCoreId();
+    IfxCpu_Trap_record(trapInfo);
     return trapInfo;
 }
 
 
+void IfxCpu_Trap_initStatistics(void)
+{
+    uint32 i;
+
+    for (i = 0; i < IFXCPU_NUM_MODULES; i++)
+    {
+        if (IfxCpu_Trap_statistics[i].valid != IFXCPU_TRAP_STATISTICS_VALID)
+        {
+            memset(&IfxCpu_Trap_statistics[i], 0, sizeof(IfxCpu_Trap_statistics[i]));
+            IfxCpu_Trap_statistics[i].valid = IFXCPU_TRAP_STATISTICS_VALID;
+        }
+    }
+}
+
+
+void IfxCpu_Trap_resetStatistics(void)
+{
+    uint32 i;
+
+    for (i = 0; i < IFXCPU_NUM_MODULES; i++)
+    {
+        IfxCpu_Trap_statistics[i].valid = 0;
+    }
+
+    IfxCpu_Trap_initStatistics();
+}
+
+
 void IfxCpu_Trap_memoryManagementError(uint32 tin)
 {
     volatile IfxCpu_Trap trapWatch;
     trapWatch = IfxCpu_Trap_extractTrapInfo(IfxCpu_Trap_Class_memoryManagement, tin);
     IFX_CFG_CPU_TRAP_MME_HOOK(trapWatch);
-    IFX_CFG_CPU_TRAP_DEBUG;
+
+    if (!IFXCPU_TRAP_IS_RECOVERABLE(IfxCpu_Trap_Class_memoryManagement))
+    {
+        IFX_CFG_CPU_TRAP_DEBUG;
+    }
+
     __asm("rslcx"); /* Restore lower context before returning. lower context was stored in the trap vector */
     __asm("rfe");
 }
@@ -122,7 +179,12 @@ void IfxCpu_Trap_internalProtectionError(uint32 tin)
     volatile IfxCpu_Trap trapWatch;
     trapWatch = IfxCpu_Trap_extractTrapInfo(IfxCpu_Trap_Class_internalProtection, tin);
     IFX_CFG_CPU_TRAP_IPE_HOOK(trapWatch);
-    IFX_CFG_CPU_TRAP_DEBUG;
+
+    if (!IFXCPU_TRAP_IS_RECOVERABLE(IfxCpu_Trap_Class_internalProtection))
+    {
+        IFX_CFG_CPU_TRAP_DEBUG;
+    }
+
     __asm("rslcx"); /* Restore lower context before returning. lower context was stored in the trap vector */
     __asm("rfe");
 }
@@ -133,7 +195,12 @@ void IfxCpu_Trap_instructionError(uint32 tin)
     volatile IfxCpu_Trap trapWatch;
     trapWatch = IfxCpu_Trap_extractTrapInfo(IfxCpu_Trap_Class_instructionErrors, tin);
     IFX_CFG_CPU_TRAP_IE_HOOK(trapWatch);
-    IFX_CFG_CPU_TRAP_DEBUG;
+
+    if (!IFXCPU_TRAP_IS_RECOVERABLE(IfxCpu_Trap_Class_instructionErrors))
+    {
+        IFX_CFG_CPU_TRAP_DEBUG;
+    }
+
     __asm("rslcx"); /* Restore lower context before returning. lower context was stored in the trap vector */
     __asm("rfe");
 }
@@ -144,7 +211,12 @@ void IfxCpu_Trap_contextManagementError(uint32 tin)
     volatile IfxCpu_Trap trapWatch;
     trapWatch = IfxCpu_Trap_extractTrapInfo(IfxCpu_Trap_Class_contextManagement, tin);
     IFX_CFG_CPU_TRAP_CME_HOOK(trapWatch);
-    IFX_CFG_CPU_TRAP_DEBUG;
+
+    if (!IFXCPU_TRAP_IS_RECOVERABLE(IfxCpu_Trap_Class_contextManagement))
+    {
+        IFX_CFG_CPU_TRAP_DEBUG;
+    }
+
     __asm("rslcx"); /* Restore lower context before returning. lower context was stored in the trap vector */
     __asm("rfe");
 }
@@ -155,7 +227,12 @@ void IfxCpu_Trap_busError(uint32 tin)
     volatile IfxCpu_Trap trapWatch;
     trapWatch = IfxCpu_Trap_extractTrapInfo(IfxCpu_Trap_Class_bus, tin);
     IFX_CFG_CPU_TRAP_BE_HOOK(trapWatch);
-    IFX_CFG_CPU_TRAP_DEBUG;
+
+    if (!IFXCPU_TRAP_IS_RECOVERABLE(IfxCpu_Trap_Class_bus))
+    {
+        IFX_CFG_CPU_TRAP_DEBUG;
+    }
+
     __asm("rslcx"); /* Restore lower context before returning. lower context was stored in the trap vector */
     __asm("rfe");
 }
@@ -166,7 +243,12 @@ void IfxCpu_Trap_assertion(uint32 tin)
     volatile IfxCpu_Trap trapWatch;
     trapWatch = IfxCpu_Trap_extractTrapInfo(IfxCpu_Trap_Class_assertion, tin);
     IFX_CFG_CPU_TRAP_ASSERT_HOOK(trapWatch);
-    IFX_CFG_CPU_TRAP_DEBUG;
+
+    if (!IFXCPU_TRAP_IS_RECOVERABLE(IfxCpu_Trap_Class_assertion))
+    {
+        IFX_CFG_CPU_TRAP_DEBUG;
+    }
+
     __asm("rslcx"); /* Restore lower context before returning. lower context was stored in the trap vector */
     __asm("rfe");
 }
@@ -195,7 +195,7 @@ void IfxDma_Dma_initChannelConfig(IfxDma_Dma_ChannelConfig *config, IfxDma_Dma *
 }
 
 
-void IfxDma_Dma_initLinkedListEntry(void *ptrToAddress, const IfxDma_Dma_ChannelConfig *config)
+void IfxDma_Dma_initLinkedListEntry(volatile void *ptrToAddress, const IfxDma_Dma_ChannelConfig *config)
 {
     IfxDma_Dma_configureTransactionSet((Ifx_DMA_CH *)ptrToAddress, config);
 }
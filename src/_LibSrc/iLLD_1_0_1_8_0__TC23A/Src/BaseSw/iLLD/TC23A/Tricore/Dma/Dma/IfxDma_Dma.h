@@ -610,7 +610,7 @@ IFX_INLINE volatile Ifx_SRC_SRCR *IfxDma_Dma_getSrcPointer(IfxDma_Dma_Channel *c
  * See \ref IfxLld_Dma_Dma_LinkedList
  *
  */
-IFX_EXTERN void IfxDma_Dma_initLinkedListEntry(void *ptrToAddress, const IfxDma_Dma_ChannelConfig *config);
+IFX_EXTERN void IfxDma_Dma_initLinkedListEntry(volatile void *ptrToAddress, const IfxDma_Dma_ChannelConfig *config);
 
 /** \} */
 
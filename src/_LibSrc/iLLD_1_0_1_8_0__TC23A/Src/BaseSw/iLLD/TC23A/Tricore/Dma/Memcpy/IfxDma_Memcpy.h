@@ -0,0 +1,255 @@
+/**
+ * \file IfxDma_Memcpy.h
+ * \brief DMA memory copy and fill service
+ * \ingroup IfxLld_Dma
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ *
+ * The memcpy service moves memory blocks (copy) or writes a byte value into a memory block (fill)
+ * with a pool of DMA channels, the CPU continues while the DMA moves the data.
+ *
+ * \section channels Channel pool
+ *   The channels given in the configuration are reserved for the service. A transfer claims a free channel
+ *   of the pool with \ref IfxCpu_acquireMutex(), the pool can be used by all CPUs when the
+ *   \ref IfxDma_Memcpy handle is located in a memory which is accessible by all CPUs (LMU or global DSPR address).
+ *   The channel is released when the transfer is finished, either by the channel interrupt
+ *   (\ref IfxDma_Memcpy_isrChannel()) or by polling the job (\ref IfxDma_Memcpy_isDone()).
+ *
+ * \section moves Move size and block mode
+ *   The move size is the largest of 256, 128, 64, 32, 16 and 8 bit to which the source address, the destination address
+ *   and the size are aligned. The block mode is the largest of 16, 8, 4, 2 and 1 moves per transfer which keeps the
+ *   transfer count in the 14 bit range. The transfer is done by the CPU when:
+ *   - the size is below \ref IfxDma_Memcpy_Config::cpuThreshold, the DMA setup is slower than the copy
+ *   - all channels of the pool are busy
+ *   - the transfer can not be done with one DMA transaction (e.g. more than 16383 unaligned bytes)
+ *   In this case the job is completed (and the callback executed) before the function returns.
+ *
+ * \section restrictions Restrictions
+ *   - Local DSPR addresses (segment 0xD) are converted to the global address of the calling CPU,
+ *     local PSPR addresses are not supported
+ *   - The DMA bypasses the CPU data cache. The cached source and destination lines are written back and
+ *     invalidated before the transfer (\ref IfxCpu_flushDataCache()), the CPU shall not access the destination
+ *     until the job is done
+ *   - 128 and 256 bit moves are only allowed between SRI memories (Flash, LMU, DSPR, PSPR), the addresses of
+ *     SPB peripherals shall not be aligned to more than 8 byte or shall be moved by the CPU
+ *
+ * \section example Usage example
+ * \code
+ *   IfxDma_Memcpy        dmaMemcpy;   // shared by all CPUs: place in LMU
+ *   IfxDma_Memcpy_Config dmaMemcpyConfig;
+ *   IfxDma_Memcpy_Job    job;
+ *
+ *   IfxDma_Memcpy_initConfig(&dmaMemcpyConfig, &MODULE_DMA);
+ *   dmaMemcpyConfig.numChannels                    = 2;
+ *   dmaMemcpyConfig.channels[0].channelId          = IfxDma_ChannelId_14;
+ *   dmaMemcpyConfig.channels[0].interruptPriority  = ISR_PRIORITY_DMA_MEMCPY0;
+ *   dmaMemcpyConfig.channels[1].channelId          = IfxDma_ChannelId_15;
+ *   dmaMemcpyConfig.channels[1].interruptPriority  = ISR_PRIORITY_DMA_MEMCPY1;
+ *   IfxDma_Memcpy_init(&dmaMemcpy, &dmaMemcpyConfig);
+ *
+ *   IfxDma_Memcpy_copy(&dmaMemcpy, &job, destination, source, sizeof(destination), NULL_PTR, NULL_PTR);
+ *   // ... CPU continues ...
+ *   IfxDma_Memcpy_wait(&job);
+ *
+ *   IFX_INTERRUPT(dmaMemcpy0Isr, 0, ISR_PRIORITY_DMA_MEMCPY0)
+ *   {
+ *       IfxDma_Memcpy_isrChannel(&dmaMemcpy, 0);
+ *   }
+ * \endcode
+ *
+ * \defgroup IfxLld_Dma_Memcpy DMA Memcpy
+ * \ingroup IfxLld_Dma
+ * \defgroup IfxLld_Dma_Memcpy_Data_Structures Data Structures
+ * \ingroup IfxLld_Dma_Memcpy
+ * \defgroup IfxLld_Dma_Memcpy_Functions Memcpy Functions
+ * \ingroup IfxLld_Dma_Memcpy
+ */
+
+#ifndef IFXDMA_MEMCPY_H
+#define IFXDMA_MEMCPY_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "Dma/Dma/IfxDma_Dma.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Maximal number of DMA channels in the pool */
+#ifndef IFXDMA_MEMCPY_MAX_CHANNELS
+#define IFXDMA_MEMCPY_MAX_CHANNELS (4)
+#endif
+
+/** \brief Size of the fill pattern in bytes (widest move, 256 bit) */
+#define IFXDMA_MEMCPY_PATTERN_SIZE (32)
+
+/******************************************************************************/
+/*------------------------------Type Definitions------------------------------*/
+/******************************************************************************/
+
+/** \brief Function called when a job is finished
+ * \param data Pointer given to \ref IfxDma_Memcpy_copy() or \ref IfxDma_Memcpy_fill()
+ */
+typedef void (*IfxDma_Memcpy_Callback)(void *data);
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+
+/** \addtogroup IfxLld_Dma_Memcpy_Data_Structures
+ * \{ */
+/** \brief Memcpy job, one per pending transfer. The job shall not be reused before it is finished
+ */
+typedef struct
+{
+    struct IfxDma_Memcpy_Channel_s *channel;     /**< \brief Channel of the pool executing the job, NULL_PTR when done by the CPU */
+    IfxDma_Memcpy_Callback          callback;    /**< \brief Function called when the job is finished, or NULL_PTR */
+    void                           *data;        /**< \brief Parameter of the callback */
+    IfxCpu_mutexLock                completion;  /**< \brief Taken by the first of interrupt or polling which finishes the job */
+    volatile boolean                done;        /**< \brief TRUE when the data is moved */
+} IfxDma_Memcpy_Job;
+
+/** \brief Channel of the pool
+ */
+typedef struct IfxDma_Memcpy_Channel_s
+{
+    IfxDma_Dma_Channel          channel;                                              /**< \brief DMA channel handle */
+    IfxCpu_mutexLock            lock;                                                 /**< \brief Taken while the channel executes a job */
+    IfxDma_Memcpy_Job *volatile job;                                                  /**< \brief Job executed by the channel */
+    uint32                     *pattern;                                              /**< \brief Fill pattern, IFXDMA_MEMCPY_PATTERN_SIZE aligned inside patternBuffer */
+    uint32                      patternBuffer[(2 * IFXDMA_MEMCPY_PATTERN_SIZE) / 4];  /**< \brief Storage of the fill pattern */
+} IfxDma_Memcpy_Channel;
+
+/** \brief Memcpy service handle
+ */
+typedef struct
+{
+    IfxDma_Memcpy_Channel channels[IFXDMA_MEMCPY_MAX_CHANNELS];  /**< \brief Channel pool */
+    uint8                 numChannels;                           /**< \brief Number of channels in the pool */
+    uint32                cpuThreshold;                          /**< \brief Transfers below this size in bytes are done by the CPU */
+} IfxDma_Memcpy;
+
+/** \brief Configuration of a pool channel
+ */
+typedef struct
+{
+    IfxDma_ChannelId channelId;           /**< \brief DMA channel reserved for the service */
+    Ifx_Priority     interruptPriority;   /**< \brief Priority of the channel interrupt, 0 for polling only */
+} IfxDma_Memcpy_ChannelConfig;
+
+/** \brief Configuration structure for the memcpy service
+ */
+typedef struct
+{
+    Ifx_DMA                    *dma;                                         /**< \brief Pointer to the DMA module */
+    IfxDma_Memcpy_ChannelConfig channels[IFXDMA_MEMCPY_MAX_CHANNELS];        /**< \brief Channels of the pool */
+    uint8                       numChannels;                                 /**< \brief Number of channels in the pool, 0 for CPU moves only */
+    IfxSrc_Tos                  typeOfService;                               /**< \brief Service provider of the channel interrupts */
+    IfxDma_ChannelBusPriority   busPriority;                                 /**< \brief Bus priority of the channels */
+    uint32                      cpuThreshold;                                /**< \brief Transfers below this size in bytes are done by the CPU */
+} IfxDma_Memcpy_Config;
+
+/** \} */
+
+/** \addtogroup IfxLld_Dma_Memcpy_Functions
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Wait until the job is finished
+ * \param job Pointer to the job
+ * \return None
+ */
+IFX_INLINE void IfxDma_Memcpy_wait(IfxDma_Memcpy_Job *job);
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Copy a memory block
+ * \param driver Pointer to the service handle
+ * \param job Pointer to the job, must stay valid until the job is finished
+ * \param destination Destination address
+ * \param source Source address
+ * \param size Number of bytes to copy
+ * \param callback Function called when the copy is finished, NULL_PTR for polling only
+ * \param data Parameter of the callback
+ * \return TRUE if the copy is done by the DMA, FALSE if it has been done by the CPU
+ */
+IFX_EXTERN boolean IfxDma_Memcpy_copy(IfxDma_Memcpy *driver, IfxDma_Memcpy_Job *job, void *destination, const void *source, uint32 size, IfxDma_Memcpy_Callback callback, void *data);
+
+/** \brief Fill a memory block with a byte value
+ * \param driver Pointer to the service handle
+ * \param job Pointer to the job, must stay valid until the job is finished
+ * \param destination Destination address
+ * \param value Value written to each byte
+ * \param size Number of bytes to write
+ * \param callback Function called when the fill is finished, NULL_PTR for polling only
+ * \param data Parameter of the callback
+ * \return TRUE if the fill is done by the DMA, FALSE if it has been done by the CPU
+ */
+IFX_EXTERN boolean IfxDma_Memcpy_fill(IfxDma_Memcpy *driver, IfxDma_Memcpy_Job *job, void *destination, uint8 value, uint32 size, IfxDma_Memcpy_Callback callback, void *data);
+
+/** \brief Initialise the memcpy service
+ * \param driver Pointer to the service handle
+ * \param config Pointer to the configuration
+ * \return TRUE on success
+ */
+IFX_EXTERN boolean IfxDma_Memcpy_init(IfxDma_Memcpy *driver, const IfxDma_Memcpy_Config *config);
+
+/** \brief Initialise the configuration with the default values: no channel, CPU threshold of 64 bytes
+ * \param config Pointer to the configuration
+ * \param dma Pointer to the DMA module
+ * \return None
+ */
+IFX_EXTERN void IfxDma_Memcpy_initConfig(IfxDma_Memcpy_Config *config, Ifx_DMA *dma);
+
+/** \brief Return the job status, finish the job if the DMA transaction is over
+ * \param job Pointer to the job
+ * \return TRUE if the job is finished
+ */
+IFX_EXTERN boolean IfxDma_Memcpy_isDone(IfxDma_Memcpy_Job *job);
+
+/** \brief Channel interrupt handler, finishes the job of the channel
+ * \param driver Pointer to the service handle
+ * \param index Index of the channel in the pool (not the DMA channel ID)
+ * \return None
+ */
+IFX_EXTERN void IfxDma_Memcpy_isrChannel(IfxDma_Memcpy *driver, uint8 index);
+
+/** \} */
+
+/******************************************************************************/
+/*---------------------Inline Function Implementations------------------------*/
+/******************************************************************************/
+
+IFX_INLINE void IfxDma_Memcpy_wait(IfxDma_Memcpy_Job *job)
+{
+    while (IfxDma_Memcpy_isDone(job) == FALSE)
+    {}
+}
+
+
+#endif /* IFXDMA_MEMCPY_H */
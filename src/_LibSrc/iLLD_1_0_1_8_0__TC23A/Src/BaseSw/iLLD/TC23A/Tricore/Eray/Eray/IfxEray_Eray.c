@@ -63,6 +63,271 @@ IFX_STATIC void IfxEray_Eray_Node_initMessageRAM(IfxEray_Eray *eray, const IfxEr
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
 
+boolean IfxEray_Eray_Bulk_init(IfxEray_Eray_Bulk *bulk, const IfxEray_Eray_BulkConfig *config)
+{
+    Ifx_ERAY              *eraySFR   = config->eray->eray;
+    boolean                receive   = (config->direction == IfxEray_Eray_BulkDirection_receive) ? TRUE : FALSE;
+    uint32                 coreId    = IfxCpu_getCoreId();
+    uint32                 listCount = receive ? (3 * config->slotCount) : ((2 * config->slotCount) + 1);
+    volatile Ifx_SRC_SRCR *src       = receive ? IfxEray_getOutputBufferBusySrcPtr(eraySFR) : IfxEray_getInputBufferBusySrcPtr(eraySFR);
+    uint8                  slotIx;
+    uint32                 listIx;
+
+    if ((config->slotCount == 0)
+        || (config->dmaChannelId == IfxDma_ChannelId_0)          /* priority 0 does not trigger the DMA */
+        || (((uint32)config->linkedList & 0x1FU) != 0)           /* transaction sets are read on a 256 bit boundary */
+        || IfxCpu_isAddressCachable(config->linkedList)          /* the DMA bypasses the data cache */
+        || IfxCpu_isAddressCachable(config->frames))
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+        return FALSE;
+    }
+
+    for (slotIx = 0; slotIx < config->slotCount; slotIx++)
+    {
+        if ((config->slots[slotIx].payloadLength == 0) || (config->slots[slotIx].payloadLength > 127))
+        {
+            IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+            return FALSE;
+        }
+    }
+
+    bulk->eray             = eraySFR;
+    bulk->direction        = config->direction;
+    bulk->frames           = config->frames;
+    bulk->slotCount        = config->slotCount;
+    bulk->firstBufferIndex = config->slots[0].bufferIndex;
+    bulk->polled           = (config->jobPriority == 0) ? TRUE : FALSE;
+    bulk->jobCount         = 0;
+    bulk->startCount       = 0;
+    bulk->overrunCount     = 0;
+
+    /* commands written by the DMA to OBCM / OBCR or IBCM / IBCR */
+    for (slotIx = 0; slotIx < config->slotCount; slotIx++)
+    {
+        IfxEray_Eray_BulkFrame *frame = &config->frames[slotIx];
+
+        if (receive)
+        {
+            Ifx_ERAY_OBCM obcm;
+            Ifx_ERAY_OBCR obcr;
+
+            obcm.U      = 0;
+            obcm.B.RHSS = 1;
+            obcm.B.RDSS = 1;
+
+            /* the current buffer is swapped to the host, the next one is requested to the shadow */
+            obcr.U      = 0;
+            obcr.B.VIEW = 1;
+
+            if (slotIx < (config->slotCount - 1))
+            {
+                obcr.B.REQ  = 1;
+                obcr.B.OBRS = config->slots[slotIx + 1].bufferIndex;
+            }
+
+            frame->commandMask    = obcm.U;
+            frame->commandRequest = obcr.U;
+        }
+        else
+        {
+            Ifx_ERAY_IBCM ibcm;
+            Ifx_ERAY_IBCR ibcr;
+
+            /* the header sections are configured statically, only the data is updated */
+            ibcm.U       = 0;
+            ibcm.B.LDSH  = 1;
+            ibcm.B.STXRH = 1;
+
+            ibcr.U      = 0;
+            ibcr.B.IBRH = config->slots[slotIx].bufferIndex;
+
+            frame->commandMask    = ibcm.U;
+            frame->commandRequest = ibcr.U;
+        }
+    }
+
+    /* DMA linked list, one complete transaction per request
+     * receive,  per slot: OBCM / OBCR (OBUSY), RDHS1..MBS (auto), RDDS (auto)
+     * transmit, per slot: WRDS (software for the first slot, else IBUSY), IBCM / IBCR (auto); then IBCR (IBUSY)
+     */
+    {
+        IfxDma_Dma_ChannelConfig dmaConfig;
+        IfxDma_Dma_initChannelConfig(&dmaConfig, config->dma);
+
+        dmaConfig.channelId                     = config->dmaChannelId;
+        dmaConfig.moveSize                      = IfxDma_ChannelMoveSize_32bit;
+        dmaConfig.blockMode                     = IfxDma_ChannelMove_1;
+        dmaConfig.requestMode                   = IfxDma_ChannelRequestMode_completeTransactionPerRequest;
+        dmaConfig.operationMode                 = IfxDma_ChannelOperationMode_continuous;
+        dmaConfig.hardwareRequestEnabled        = TRUE;
+        dmaConfig.shadowControl                 = IfxDma_ChannelShadow_linkedList;
+        dmaConfig.channelInterruptPriority      = config->jobPriority;
+        dmaConfig.channelInterruptTypeOfService = config->jobServProvider;
+
+        for (listIx = 0; listIx < listCount; listIx++)
+        {
+            IfxEray_Eray_BulkFrame *frame;
+            boolean                 autoStart;
+
+            if (receive)
+            {
+                frame = &config->frames[listIx / 3];
+
+                switch (listIx % 3)
+                {
+                case 0:
+                    dmaConfig.sourceAddress      = IFXCPU_GLB_ADDR_DSPR(coreId, &frame->commandMask);
+                    dmaConfig.destinationAddress = (uint32)&eraySFR->OBCM.U;
+                    dmaConfig.transferCount      = 2;
+                    autoStart                    = FALSE;
+                    break;
+                case 1:
+                    dmaConfig.sourceAddress      = (uint32)&eraySFR->RDHS1.U;
+                    dmaConfig.destinationAddress = IFXCPU_GLB_ADDR_DSPR(coreId, &frame->header1);
+                    dmaConfig.transferCount      = 4;
+                    autoStart                    = TRUE;
+                    break;
+                default:
+                    dmaConfig.sourceAddress      = (uint32)&eraySFR->RDDS_1S[0].U;
+                    dmaConfig.destinationAddress = IFXCPU_GLB_ADDR_DSPR(coreId, frame->data);
+                    dmaConfig.transferCount      = (config->slots[listIx / 3].payloadLength + 1) / 2;
+                    autoStart                    = TRUE;
+                    break;
+                }
+            }
+            else if (listIx == (listCount - 1))
+            {
+                /* consumes the busy request of the last buffer, the job ends with its transfer */
+                frame                        = &config->frames[config->slotCount - 1];
+                dmaConfig.sourceAddress      = (uint32)&eraySFR->IBCR.U;
+                dmaConfig.destinationAddress = IFXCPU_GLB_ADDR_DSPR(coreId, &frame->status);
+                dmaConfig.transferCount      = 1;
+                autoStart                    = FALSE;
+            }
+            else if ((listIx % 2) == 0)
+            {
+                frame                        = &config->frames[listIx / 2];
+                dmaConfig.sourceAddress      = IFXCPU_GLB_ADDR_DSPR(coreId, frame->data);
+                dmaConfig.destinationAddress = (uint32)&eraySFR->WRDS_1S[0].U;
+                dmaConfig.transferCount      = (config->slots[listIx / 2].payloadLength + 1) / 2;
+                autoStart                    = FALSE;
+            }
+            else
+            {
+                frame                        = &config->frames[listIx / 2];
+                dmaConfig.sourceAddress      = IFXCPU_GLB_ADDR_DSPR(coreId, &frame->commandMask);
+                dmaConfig.destinationAddress = (uint32)&eraySFR->IBCM.U;
+                dmaConfig.transferCount      = 2;
+                autoStart                    = TRUE;
+            }
+
+            dmaConfig.shadowAddress = IFXCPU_GLB_ADDR_DSPR(coreId, &config->linkedList[(listIx + 1) % listCount]);
+
+            if (listIx == 0)
+            {
+                IfxDma_Dma_initChannel(&bulk->dmaChannel, &dmaConfig);
+            }
+
+            IfxDma_Dma_initLinkedListEntry((void *)&config->linkedList[listIx], &dmaConfig);
+
+            if (listIx == 0)
+            {
+                /* job end: interrupt when the first set is loaded again, which then waits for the next job */
+                config->linkedList[listIx].CHCSR.B.SIT = 1;
+            }
+            else if (autoStart)
+            {
+                config->linkedList[listIx].CHCSR.B.SCH = 1;
+            }
+        }
+
+        IfxSrc_clearRequest(IfxDma_Dma_getSrcPointer(&bulk->dmaChannel));
+    }
+
+    /* buffer busy service request, serviced by the DMA channel */
+    IfxSrc_init(src, IfxSrc_Tos_dma, (Ifx_Priority)config->dmaChannelId);
+    IfxSrc_enable(src);
+
+    return TRUE;
+}
+
+
+void IfxEray_Eray_Bulk_initConfig(IfxEray_Eray_BulkConfig *config, IfxEray_Eray *eray)
+{
+    config->eray            = eray;
+    config->direction       = IfxEray_Eray_BulkDirection_receive;
+    config->slots           = NULL_PTR;
+    config->slotCount       = 0;
+    config->frames          = NULL_PTR;
+    config->linkedList      = NULL_PTR;
+    config->dma             = NULL_PTR;
+    config->dmaChannelId    = IfxDma_ChannelId_none;
+    config->jobPriority     = 0;
+    config->jobServProvider = IfxSrc_Tos_cpu0;
+}
+
+
+boolean IfxEray_Eray_Bulk_isBusy(IfxEray_Eray_Bulk *bulk)
+{
+    if (bulk->polled != FALSE)
+    {
+        volatile Ifx_SRC_SRCR *src = IfxDma_Dma_getSrcPointer(&bulk->dmaChannel);
+
+        if (IfxSrc_isRequested(src) != FALSE)
+        {
+            IfxSrc_clearRequest(src);
+            bulk->jobCount++;
+        }
+    }
+
+    return (bulk->jobCount != bulk->startCount) ? TRUE : FALSE;
+}
+
+
+boolean IfxEray_Eray_Bulk_start(IfxEray_Eray_Bulk *bulk)
+{
+    Ifx_ERAY *eraySFR = bulk->eray;
+
+    if (IfxEray_Eray_Bulk_isBusy(bulk) != FALSE)
+    {
+        bulk->overrunCount++;
+        return FALSE;
+    }
+
+    bulk->startCount++;
+
+    if (bulk->direction == IfxEray_Eray_BulkDirection_receive)
+    {
+        /* the first buffer is requested by the CPU, the DMA continues on its busy request */
+        while (IfxEray_getOutputBufferBusyShadowStatus(eraySFR) == TRUE)
+        {}
+
+        IfxEray_receiveHeader(eraySFR, TRUE);
+        IfxEray_receiveData(eraySFR, TRUE);
+        IfxEray_setRxBufferNumber(eraySFR, bulk->firstBufferIndex);
+        IfxEray_setReceiveRequest(eraySFR, TRUE);
+    }
+    else
+    {
+        IfxDma_Dma_startChannelTransaction(&bulk->dmaChannel);
+    }
+
+    return TRUE;
+}
+
+
+void IfxEray_Eray_Bulk_stop(IfxEray_Eray_Bulk *bulk)
+{
+    volatile Ifx_SRC_SRCR *src = (bulk->direction == IfxEray_Eray_BulkDirection_receive) ? IfxEray_getOutputBufferBusySrcPtr(bulk->eray) : IfxEray_getInputBufferBusySrcPtr(bulk->eray);
+
+    IfxSrc_disable(src);
+    IfxSrc_clearRequest(src);
+    IfxDma_disableChannelTransaction(bulk->dmaChannel.dma, bulk->dmaChannel.channelId);
+    IfxSrc_clearRequest(IfxDma_Dma_getSrcPointer(&bulk->dmaChannel));
+}
+
+
 void IfxEray_Eray_Node_init(IfxEray_Eray *eray, const IfxEray_Eray_NodeConfig *config)
 {
     Ifx_ERAY *eraySFR = eray->eray;
@@ -547,6 +812,49 @@ void IfxEray_Eray_receiveFifoFrame(IfxEray_Eray *eray, IfxEray_Eray_ReceiveContr
 }
 
 
+uint32 IfxEray_Eray_receiveFifoFrames(IfxEray_Eray *eray, IfxEray_Eray_ReceivedFrame *frames, uint32 count, Ifx_SizeT maxPayloadLength)
+{
+    Ifx_ERAY *eraySFR  = eray->eray;
+    uint32    received = 0;
+    boolean   pending  = FALSE;
+
+    while (IfxEray_getOutputBufferBusyShadowStatus(eraySFR) == TRUE)
+    {}
+
+    IfxEray_receiveHeader(eraySFR, TRUE);
+    IfxEray_receiveData(eraySFR, TRUE);
+
+    if ((count > 0) && (IfxEray_getFifoStatus(eraySFR).B.RFNE == 1))
+    {
+        IfxEray_setRxBufferNumber(eraySFR, IfxEray_getFifoIndex(eraySFR));
+        IfxEray_setReceiveRequest(eraySFR, TRUE);
+        pending = TRUE;
+    }
+
+    while (pending != FALSE)
+    {
+        while (IfxEray_getOutputBufferBusyShadowStatus(eraySFR) == TRUE)
+        {}
+
+        IfxEray_setViewData(eraySFR, TRUE);
+        pending = FALSE;
+
+        /* the next frame is transferred to the shadow while the current one is read from the host */
+        if (((received + 1) < count) && (IfxEray_getFifoStatus(eraySFR).B.RFNE == 1))
+        {
+            IfxEray_setRxBufferNumber(eraySFR, IfxEray_getFifoIndex(eraySFR));
+            IfxEray_setReceiveRequest(eraySFR, TRUE);
+            pending = TRUE;
+        }
+
+        IfxEray_Eray_readFrame(eray, &frames[received], maxPayloadLength);
+        received++;
+    }
+
+    return received;
+}
+
+
 void IfxEray_Eray_receiveFrame(IfxEray_Eray *eray, IfxEray_Eray_ReceiveControl *config)
 {
     Ifx_ERAY *eraySFR = eray->eray;
@@ -23,6 +23,26 @@
  *
  * \defgroup IfxLld_Eth_Phy_Pef7071 PHY_PEF7071
  * \ingroup IfxLld_Eth
+ *
+ * The PHY is managed without blocking wait: \ref IfxEth_Phy_Pef7071_init(), called by IfxEth_init() through
+ * IfxEth_Config::phyInit, only starts the PHY reset. \ref IfxEth_Phy_Pef7071_process(), called periodically
+ * (e.g. every 10 ms), completes the reset and the setup, then polls the link status. When the auto-negotiation
+ * completes, the speed and duplex mode of the ETH MAC are set to the highest ability common with the link
+ * partner (10/100 Mbit/s, half/full duplex). Each call starts at most one MDIO transaction and returns
+ * immediately if the transaction of the previous call is still running.
+ *
+ * \ref IfxEth_Phy_Pef7071_link() (IfxEth_Config::phyLink) returns the link status of the last poll, without MDIO
+ * access. The blocking \ref IfxEth_Phy_Pef7071_read_mdio_reg() / \ref IfxEth_Phy_Pef7071_write_mdio_reg() shall
+ * not be called concurrently to IfxEth_Phy_Pef7071_process().
+ *
+ * \code
+ * ethConfig.phyInit = &IfxEth_Phy_Pef7071_init;
+ * ethConfig.phyLink = &IfxEth_Phy_Pef7071_link;
+ * IfxEth_init(&eth, &ethConfig);
+ *
+ * // 10 ms task
+ * IfxEth_Phy_Pef7071_process(&eth);
+ * \endcode
  * \defgroup IfxLld_Eth_Phy_Pef7071_Functions Functions
  * \ingroup IfxLld_Eth_Phy_Pef7071
  */
@@ -35,6 +55,41 @@
 /******************************************************************************/
 
 #include "Eth/Std/IfxEth.h"
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+
+/** \brief State of the PHY management
+ */
+typedef enum
+{
+    IfxEth_Phy_Pef7071_State_off = 0,   /**< \brief IfxEth_Phy_Pef7071_init() not called */
+    IfxEth_Phy_Pef7071_State_reset,     /**< \brief PHY reset to be started */
+    IfxEth_Phy_Pef7071_State_waitReset, /**< \brief PHY reset running */
+    IfxEth_Phy_Pef7071_State_setup,     /**< \brief PHY setup and auto-negotiation start */
+    IfxEth_Phy_Pef7071_State_linkDown,  /**< \brief Waiting for the link and the auto-negotiation */
+    IfxEth_Phy_Pef7071_State_resolve,   /**< \brief Reading the link partner abilities */
+    IfxEth_Phy_Pef7071_State_linkUp     /**< \brief Link established, MAC configured */
+} IfxEth_Phy_Pef7071_State;
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+
+/** \brief Status of the PHY management
+ */
+typedef struct
+{
+    IfxEth_Phy_Pef7071_State state;             /**< \brief State of the PHY management */
+    uint8                    step;              /**< \brief Setup register written next */
+    boolean                  readPending;       /**< \brief TRUE while an MDIO read started by IfxEth_Phy_Pef7071_process() is not consumed */
+    boolean                  link;              /**< \brief TRUE if the link is established */
+    IfxEth_LinkSpeed         speed;             /**< \brief Link speed, valid if link is TRUE */
+    boolean                  fullDuplex;        /**< \brief Duplex mode, valid if link is TRUE */
+    uint32                   linkChanges;       /**< \brief Number of link up and link down events */
+} IfxEth_Phy_Pef7071_Status;
+
 /** \addtogroup IfxLld_Eth_Phy_Pef7071_Functions
  * \{ */
 
@@ -42,7 +97,7 @@
 /*-------------------------Global Function Prototypes-------------------------*/
 /******************************************************************************/
 
-/**
+/** \brief Starts the PHY reset, the PHY management continues in IfxEth_Phy_Pef7071_process()
  * \return Status
  */
 IFX_EXTERN uint32 IfxEth_Phy_Pef7071_init(void);
@@ -52,6 +107,12 @@ IFX_EXTERN uint32 IfxEth_Phy_Pef7071_init(void);
  */
 IFX_EXTERN boolean IfxEth_Phy_Pef7071_link(void);
 
+/** \brief PHY management state machine, at most one MDIO transaction per call, no wait
+ * \param eth ETH driver structure, speed and duplex mode set on link up
+ * \return None
+ */
+IFX_EXTERN void IfxEth_Phy_Pef7071_process(IfxEth *eth);
+
 /**
  * \return None
  */
@@ -70,4 +131,6 @@ IFX_EXTERN void IfxEth_Phy_Pef7071_write_mdio_reg(uint32 layeraddr, uint32 regad
 
 IFX_EXTERN uint32 IfxEth_Phy_Pef7071_iPhyInitDone;
 
+IFX_EXTERN IfxEth_Phy_Pef7071_Status IfxEth_Phy_Pef7071_status;
+
 #endif /* IFXETH_PHY_PEF7071_H */
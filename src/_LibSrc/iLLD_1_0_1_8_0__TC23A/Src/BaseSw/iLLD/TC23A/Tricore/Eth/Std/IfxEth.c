@@ -44,6 +44,60 @@ IfxEth_TxDescrList IfxEth_txDescr;
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
 
+void IfxEth_adjustFrequency(IfxEth *eth, sint32 ppb)
+{
+    sint64 addend = (sint64)eth->timestampAddend;
+
+    addend += (addend * ppb) / (sint64)IFXETH_NANOSECONDS_PER_SECOND;
+    addend  = (addend < 1) ? 1 : ((addend > (sint64)0xFFFFFFFFUL) ? (sint64)0xFFFFFFFFUL : addend);
+
+    /* the previous addend update must be completed */
+    while (MODULE_ETH.TIMESTAMP_CONTROL.B.TSADDREG != 0)
+    {}
+
+    MODULE_ETH.TIMESTAMP_ADDEND.U           = (uint32)addend;
+    MODULE_ETH.TIMESTAMP_CONTROL.B.TSADDREG = 1;
+}
+
+
+void IfxEth_adjustTime(IfxEth *eth, sint64 offset)
+{
+    uint64                                 magnitude = (uint64)((offset < 0) ? -offset : offset);
+    Ifx_ETH_SYSTEM_TIME_NANOSECONDS_UPDATE nanoseconds;
+    (void)eth;
+
+    nanoseconds.U        = 0;
+    nanoseconds.B.TSSS   = (uint32)(magnitude % IFXETH_NANOSECONDS_PER_SECOND);
+    nanoseconds.B.ADDSUB = (offset < 0) ? 1 : 0;
+
+    /* the previous initialisation / update must be completed */
+    while ((MODULE_ETH.TIMESTAMP_CONTROL.B.TSINIT != 0) || (MODULE_ETH.TIMESTAMP_CONTROL.B.TSUPDT != 0))
+    {}
+
+    MODULE_ETH.SYSTEM_TIME_SECONDS_UPDATE.U     = (uint32)(magnitude / IFXETH_NANOSECONDS_PER_SECOND);
+    MODULE_ETH.SYSTEM_TIME_NANOSECONDS_UPDATE.U = nanoseconds.U;
+    MODULE_ETH.TIMESTAMP_CONTROL.B.TSUPDT       = 1;
+}
+
+
+void *IfxEth_allocBuffer(IfxEth_BufferPool *pool)
+{
+    boolean interruptState = IfxCpu_disableInterrupts();
+    void   *buffer         = pool->freeList;
+
+    if (buffer != NULL_PTR)
+    {
+        pool->freeList     = *(void **)buffer;
+        pool->freeCount--;
+        pool->minFreeCount = __min(pool->minFreeCount, pool->freeCount);
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return buffer;
+}
+
+
 void IfxEth_disableModule(void)
 {
     uint16 l_TempVar = IfxScuWdt_getCpuWatchdogPassword();
@@ -64,6 +118,19 @@ void IfxEth_enableModule(void)
 }
 
 
+void IfxEth_freeBuffer(IfxEth_BufferPool *pool, void *buffer)
+{
+    boolean interruptState = IfxCpu_disableInterrupts();
+
+    /* the free buffer holds the link to the next free buffer */
+    *(void **)buffer = pool->freeList;
+    pool->freeList   = buffer;
+    pool->freeCount++;
+
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+
 void IfxEth_freeReceiveBuffer(IfxEth *eth)
 {
     IfxEth_RxDescr *descr = IfxEth_getActualRxDescriptor(eth);
@@ -90,6 +157,70 @@ void *IfxEth_getReceiveBuffer(IfxEth *eth)
 }
 
 
+void *IfxEth_getReceivePacket(IfxEth *eth, uint16 *length)
+{
+    void *result = NULL_PTR;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, eth->rxPool != NULL_PTR);
+
+    while ((result == NULL_PTR) && (IfxEth_isRxDataAvailable(eth) != FALSE))
+    {
+        IfxEth_RxDescr *descr  = IfxEth_getActualRxDescriptor(eth);
+        void           *buffer = NULL_PTR;
+
+        /* only complete and error free frames are handed over */
+        if ((descr->RDES0.A.FS != 0) && (descr->RDES0.A.LS != 0) && (descr->RDES0.A.ES == 0))
+        {
+            buffer = IfxEth_allocBuffer(eth->rxPool);
+        }
+
+        if (buffer != NULL_PTR)
+        {
+            result                = (void *)(descr->RDES2.U);
+            *length               = (uint16)descr->RDES0.A.FL;
+            eth->rxTimestampValid = IfxEth_RxDescr_getTimestamp(descr, &eth->rxTimestamp);
+            IfxEth_RxDescr_setBuffer(descr, buffer);
+            eth->rxCount++;
+        }
+        else
+        {
+            /* drop the frame, the descriptor keeps its buffer */
+            eth->rxDropped++;
+        }
+
+        IfxEth_RxDescr_release(descr);
+        IfxEth_shuffleRxDescriptor(eth);
+    }
+
+    IfxEth_wakeupReceiver(eth);
+
+    return result;
+}
+
+
+boolean IfxEth_getReceiveTimestamp(IfxEth *eth, IfxEth_Timestamp *timestamp)
+{
+    *timestamp = eth->rxTimestamp;
+
+    return eth->rxTimestampValid;
+}
+
+
+void IfxEth_getTime(IfxEth *eth, IfxEth_Timestamp *time)
+{
+    uint32 seconds;
+    (void)eth;
+
+    /* read again if the seconds were incremented meanwhile */
+    do
+    {
+        seconds           = MODULE_ETH.SYSTEM_TIME_SECONDS.U;
+        time->nanoseconds = MODULE_ETH.SYSTEM_TIME_NANOSECONDS.B.TSSS;
+        time->seconds     = MODULE_ETH.SYSTEM_TIME_SECONDS.U;
+    } while (time->seconds != seconds);
+}
+
+
 void *IfxEth_getTransmitBuffer(IfxEth *eth)
 {
     void           *buffer = NULL_PTR;
@@ -105,6 +236,28 @@ void *IfxEth_getTransmitBuffer(IfxEth *eth)
 }
 
 
+boolean IfxEth_getTransmitTimestamp(IfxEth *eth, IfxEth_Timestamp *timestamp)
+{
+    boolean interruptState;
+    boolean result;
+
+    IfxEth_reclaimTransmitBuffers(eth);
+
+    interruptState = IfxCpu_disableInterrupts();
+    result         = eth->txTimestampValid;
+
+    if (result != FALSE)
+    {
+        *timestamp            = eth->txTimestamp;
+        eth->txTimestampValid = FALSE;
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return result;
+}
+
+
 void IfxEth_init(IfxEth *eth, const IfxEth_Config *config)
 {
     eth->ethSfr = config->ethSfr;
@@ -152,7 +305,7 @@ void IfxEth_init(IfxEth *eth, const IfxEth_Config *config)
         Ifx_ETH_BUS_MODE busMode;
         busMode.U      = ETH_BUS_MODE.U;
         busMode.B.DSL  = 0; /* descriptor skip length in ring mode */
-        busMode.B.ATDS = 0; /* alternate descriptor size: 0 => 4 DWORDS, 1 => 8 DWORDS */
+        busMode.B.ATDS = 1; /* alternate descriptor size: 0 => 4 DWORDS, 1 => 8 DWORDS (timestamps) */
         busMode.B.DA   = 0; /* 0 = weighted round-robin, 1 = fixed priority */
 
         ETH_BUS_MODE.U = busMode.U;
@@ -225,6 +378,15 @@ void IfxEth_init(IfxEth *eth, const IfxEth_Config *config)
 
     eth->rxDescr        = config->rxDescr;
     eth->txDescr        = config->txDescr;
+    eth->rxPool         = NULL_PTR;
+    eth->rxDropped      = 0;
+    eth->txPending      = 0;
+    eth->rxPolling      = FALSE;
+
+    eth->timestampAddend    = 0;
+    eth->rxTimestampValid   = FALSE;
+    eth->txTimestampRequest = FALSE;
+    eth->txTimestampValid   = FALSE;
 
     eth->descriptorMode = config->descriptorMode;
 
@@ -243,6 +405,28 @@ void IfxEth_init(IfxEth *eth, const IfxEth_Config *config)
 }
 
 
+void IfxEth_initBufferPool(IfxEth_BufferPool *pool, void *buffers, uint16 bufferSize, uint16 count)
+{
+    uint8 *buffer = (uint8 *)buffers;
+    uint16 i;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (bufferSize % 4) == 0);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((uint32)buffers % 4) == 0);
+
+    pool->freeList   = NULL_PTR;
+    pool->bufferSize = bufferSize;
+    pool->count      = count;
+    pool->freeCount  = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        IfxEth_freeBuffer(pool, &buffer[(uint32)i * bufferSize]);
+    }
+
+    pool->minFreeCount = count;
+}
+
+
 void IfxEth_initConfig(IfxEth_Config *config, Ifx_ETH *ethSfr)
 {
     const IfxEth_Config defaultConfig = {
@@ -391,6 +575,89 @@ void IfxEth_initReceiveDescriptorsRingMode(IfxEth *eth, const IfxEth_RingModeRxB
 }
 
 
+boolean IfxEth_initReceiveDescriptorsWithPool(IfxEth *eth, IfxEth_BufferPool *pool)
+{
+    int             i;
+    IfxEth_RxDescr *descr;
+    boolean         result = (eth->descriptorMode == IfxEth_DescriptorMode_chain)
+                             && (pool->freeCount >= IFXETH_MAX_RX_BUFFERS) && (pool->bufferSize <= 0x1FFFU);
+
+    if (result != FALSE)
+    {
+        IfxEth_initReceiveDescriptors(eth);
+
+        descr = IfxEth_getBaseRxDescriptor(eth);
+
+        for (i = 0; i < IFXETH_MAX_RX_BUFFERS; i++)
+        {
+            descr[i].RDES1.A.RBS1 = pool->bufferSize;
+            IfxEth_RxDescr_setBuffer(&descr[i], IfxEth_allocBuffer(pool));
+        }
+
+        eth->rxPool    = pool;
+        eth->rxDropped = 0;
+    }
+    else
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+    }
+
+    return result;
+}
+
+
+boolean IfxEth_initTimestamp(IfxEth *eth, float32 clockFrequency)
+{
+    boolean result = (clockFrequency >= 8.0e6f) && (clockFrequency <= 2.0e9f);
+
+    if (result != FALSE)
+    {
+        uint32                    frequency = (uint32)clockFrequency;
+        /* nanoseconds increment for an update at about half the clock frequency */
+        uint32                    increment = ((2UL * IFXETH_NANOSECONDS_PER_SECOND) + frequency - 1) / frequency;
+        uint32                    timeout   = 0;
+        Ifx_ETH_TIMESTAMP_CONTROL control;
+
+        /* accumulator overflow at 1e9 / increment Hz: addend = 2^32 * (1e9 / increment) / frequency */
+        eth->timestampAddend = (uint32)(((uint64)IFXETH_NANOSECONDS_PER_SECOND << 32) / ((uint64)increment * frequency));
+
+        control.U           = 0;
+        control.B.TSENA     = 1;    /* timestamps enabled */
+        control.B.TSCFUPDT  = 1;    /* fine update with the addend */
+        control.B.TSCTRLSSR = 1;    /* digital rollover, nanoseconds */
+        control.B.TSVER2ENA = 1;    /* PTP version 2 */
+        control.B.TSIPENA   = 1;    /* PTP over ethernet */
+        control.B.TSIPV4ENA = 1;    /* PTP over UDP / IPv4 */
+        control.B.TSEVNTENA = 1;    /* event messages only: Sync (SNAPTYPSEL = 0, TSMSTRENA = 0, slave) */
+        MODULE_ETH.TIMESTAMP_CONTROL.U = control.U;
+
+        MODULE_ETH.SUB_SECOND_INCREMENT.B.SSINC = increment;
+        MODULE_ETH.TIMESTAMP_ADDEND.U           = eth->timestampAddend;
+        MODULE_ETH.TIMESTAMP_CONTROL.B.TSADDREG = 1;
+
+        while ((MODULE_ETH.TIMESTAMP_CONTROL.B.TSADDREG != 0) && (timeout < IFXETH_MAX_TIMEOUT_VALUE))
+        {
+            timeout++;
+        }
+
+        MODULE_ETH.SYSTEM_TIME_SECONDS_UPDATE.U     = 0;
+        MODULE_ETH.SYSTEM_TIME_NANOSECONDS_UPDATE.U = 0;
+        MODULE_ETH.TIMESTAMP_CONTROL.B.TSINIT       = 1;
+
+        while ((MODULE_ETH.TIMESTAMP_CONTROL.B.TSINIT != 0) && (timeout < IFXETH_MAX_TIMEOUT_VALUE))
+        {
+            timeout++;
+        }
+
+        result = (timeout < IFXETH_MAX_TIMEOUT_VALUE) ? TRUE : FALSE;
+    }
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, result != FALSE);
+
+    return result;
+}
+
+
 void IfxEth_initTransmitDescriptors(IfxEth *eth)
 {
     int             i;
@@ -411,6 +678,8 @@ void IfxEth_initTransmitDescriptors(IfxEth *eth)
         IfxEth_TxDescr_setBuffer(descr, &(IfxEth_txBuffer[i][0]));
 #endif
 
+        eth->txSegments[i].pool = NULL_PTR;
+
         /* with TCH set, TDES3 points to next descriptor */
         descr->TDES3.U = (uint32)&descr[1];
         descr          = &descr[1];
@@ -428,7 +697,9 @@ void IfxEth_initTransmitDescriptors(IfxEth *eth)
         descr->TDES3.U = (uint32)eth->pTxDescr;
     }
 
-    eth->txCount = 0;
+    eth->txCount         = 0;
+    eth->txPending       = 0;
+    eth->pTxReclaimDescr = eth->pTxDescr;
 
     /* write descriptor list base address */
     IfxEth_setTransmitDescriptorAddress(&MODULE_ETH, IfxEth_getBaseTxDescriptor(eth));
@@ -499,6 +770,59 @@ void IfxEth_initTransmitDescriptorsRingMode(IfxEth *eth, const IfxEth_RingModeTx
 }
 
 
+boolean IfxEth_isrReceive(IfxEth *eth)
+{
+    boolean schedule = FALSE;
+
+    if (IfxEth_isRxInterrupt(eth) != FALSE)
+    {
+        IfxEth_disableRxInterrupt(eth);
+        IfxEth_clearRxInterrupt(eth);
+
+        if (eth->rxPolling == FALSE)
+        {
+            eth->rxPolling = TRUE;
+            eth->isrRxCount++;
+            schedule       = TRUE;
+        }
+    }
+
+    return schedule;
+}
+
+
+uint32 IfxEth_pollReceive(IfxEth *eth, IfxEth_ReceiveHandler handler, void *data, uint32 budget)
+{
+    uint32 count = 0;
+    void  *buffer;
+
+    while ((count < budget) && ((buffer = IfxEth_getReceiveBuffer(eth)) != NULL_PTR))
+    {
+        eth->rxTimestampValid = IfxEth_RxDescr_getTimestamp(IfxEth_getActualRxDescriptor(eth), &eth->rxTimestamp);
+        handler(eth, buffer, (uint16)IfxEth_getActualRxDescriptor(eth)->RDES0.A.FL, data);
+        IfxEth_freeReceiveBuffer(eth);
+        count++;
+    }
+
+    if (count < budget)
+    {
+        /* RX descriptors empty, back to interrupt mode */
+        IfxEth_clearRxInterrupt(eth);
+        eth->rxPolling = FALSE;
+        IfxEth_enableRxInterrupt(eth);
+
+        /* a frame received before the interrupt flag was cleared did not raise an interrupt */
+        if (IfxEth_isRxDataAvailable(eth) != FALSE)
+        {
+            IfxEth_disableRxInterrupt(eth);
+            eth->rxPolling = TRUE;
+        }
+    }
+
+    return count;
+}
+
+
 void IfxEth_readMacAddress(IfxEth *eth, uint8 *macAddress)
 {
     (void)eth;
@@ -507,6 +831,37 @@ void IfxEth_readMacAddress(IfxEth *eth, uint8 *macAddress)
 }
 
 
+uint32 IfxEth_reclaimTransmitBuffers(IfxEth *eth)
+{
+    uint32  count          = 0;
+    boolean interruptState = IfxCpu_disableInterrupts();
+
+    while ((eth->txPending != 0) && (IfxEth_TxDescr_isAvailable(eth->pTxReclaimDescr) != FALSE))
+    {
+        IfxEth_TxSegment *segment = &eth->txSegments[eth->pTxReclaimDescr - IfxEth_getBaseTxDescriptor(eth)];
+
+        if (IfxEth_TxDescr_getTimestamp(eth->pTxReclaimDescr, &eth->txTimestamp) != FALSE)
+        {
+            eth->txTimestampValid = TRUE;
+        }
+
+        if (segment->pool != NULL_PTR)
+        {
+            IfxEth_freeBuffer(segment->pool, segment->data);
+            segment->pool = NULL_PTR;
+        }
+
+        eth->pTxReclaimDescr = IfxEth_TxDescr_getNext(eth->pTxReclaimDescr);
+        eth->txPending--;
+        count++;
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return count;
+}
+
+
 void IfxEth_resetModule(void)
 {
     uint16 passwd = IfxScuWdt_getCpuWatchdogPassword();
@@ -563,6 +918,57 @@ void IfxEth_sendTransmitBuffersRingMode(IfxEth *eth, uint16 buffer1Length, uint1
 }
 
 
+boolean IfxEth_sendTransmitPacket(IfxEth *eth, const IfxEth_TxSegment *segments, uint32 count)
+{
+    boolean interruptState = IfxCpu_disableInterrupts();
+    boolean result;
+
+    IfxEth_reclaimTransmitBuffers(eth);
+
+    result = (eth->descriptorMode == IfxEth_DescriptorMode_chain)
+             && (count != 0) && ((eth->txPending + count) <= IFXETH_MAX_TX_BUFFERS);
+
+    if (result != FALSE)
+    {
+        IfxEth_TxDescr *first = IfxEth_getActualTxDescriptor(eth);
+        uint32          i;
+
+        for (i = 0; i < count; i++)
+        {
+            IfxEth_TxDescr *descr = IfxEth_getActualTxDescriptor(eth);
+            boolean         last  = (i == (count - 1)) ? TRUE : FALSE;
+
+            IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, segments[i].length <= 0x1FFFU);
+
+            eth->txSegments[descr - IfxEth_getBaseTxDescriptor(eth)] = segments[i];
+            IfxEth_TxDescr_setBuffer(descr, segments[i].data);
+            IfxEth_TxDescr_setup(descr, segments[i].length, (i == 0) ? TRUE : FALSE, last);
+            descr->TDES0.A.IC   = last;
+            descr->TDES0.A.TTSE = (i == 0) ? eth->txTimestampRequest : FALSE;
+
+            /* the first descriptor is released last, so that the DMA never sees a partial frame */
+            if (i != 0)
+            {
+                IfxEth_TxDescr_release(descr);
+            }
+
+            IfxEth_shuffleTxDescriptor(eth);
+        }
+
+        eth->txPending         += count;
+        eth->txTimestampRequest = FALSE;
+        IfxEth_TxDescr_release(first);
+        IfxEth_wakeupTransmitter(eth);
+
+        eth->txCount++;
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return result;
+}
+
+
 void IfxEth_setAndSendTransmitBuffer(IfxEth *eth, void *buffer, uint16 len)
 {
     IfxEth_TxDescr_setBuffer(IfxEth_getActualTxDescriptor(eth), buffer);
@@ -587,6 +993,20 @@ void IfxEth_setMacAddress(IfxEth *eth, const uint8 *macAddress)
 }
 
 
+void IfxEth_setTime(IfxEth *eth, const IfxEth_Timestamp *time)
+{
+    (void)eth;
+
+    /* the previous initialisation / update must be completed */
+    while ((MODULE_ETH.TIMESTAMP_CONTROL.B.TSINIT != 0) || (MODULE_ETH.TIMESTAMP_CONTROL.B.TSUPDT != 0))
+    {}
+
+    MODULE_ETH.SYSTEM_TIME_SECONDS_UPDATE.U     = time->seconds;
+    MODULE_ETH.SYSTEM_TIME_NANOSECONDS_UPDATE.U = time->nanoseconds;
+    MODULE_ETH.TIMESTAMP_CONTROL.B.TSINIT       = 1;
+}
+
+
 void IfxEth_setupChecksumEngine(IfxEth *eth, IfxEth_ChecksumMode mode)
 {
     int i;
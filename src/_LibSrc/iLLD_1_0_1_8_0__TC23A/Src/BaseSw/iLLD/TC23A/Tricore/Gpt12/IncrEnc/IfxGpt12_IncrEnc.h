@@ -154,6 +154,26 @@
  *       }
  *   \endcode
  *
+ * \section IfxLld_Gpt12_IncrEnc_Timestamp Speed from edge timestamps
+ *
+ * If timestamp.pinA is set, the encoder A signal is also connected to a GTM TIM channel (same port pin) which
+ * latches the TBU_TS0 time stamp and the edge counter on both edges of A. The speed is then computed when
+ * \ref IfxGpt12_IncrEnc_getSpeed() is called, over the A edges seen since the previous call and the exact time
+ * between the first and the last of them (M/T method):
+ *   - the resolution is one encoder edge at any speed, instead of one GPT12 count per update period at
+ *     high speed and the T5 CAPREL measurement at low speed
+ *   - \ref IfxGpt12_IncrEnc_update() only reads the position and the direction from the GPT12, it no longer needs
+ *     to be called at a fixed rate for the speed, and the speed low pass filter is not used
+ *   - the direction and the GPT12 count are used when more than 127 edges (edge counter wrap) are seen between
+ *     2 calls
+ *   - without edge, the speed decreases as 1 edge / time since the last edge, and is 0 below minSpeed
+ *
+ * The GTM and the TBU_TS0 clock must be enabled before \ref IfxGpt12_IncrEnc_init(), TBU_TS0 must use the default
+ * resolution (lower 24 bits captured by the TIM).
+ *   \code
+ *       gpt12Config.timestamp.pinA = &IfxGtm_TIM0_6_TIN6_P02_6_IN; // same pin as gpt12Config.pinA
+ *   \endcode
+ *
  * \defgroup IfxLld_Gpt12_IncrEnc INCRENC
  * \ingroup IfxLld_Gpt12
  * \defgroup IfxLld_Gpt12_IncrEnc_Datastructures Data structures
@@ -174,6 +194,9 @@
 #include "StdIf/IfxStdIf_Pos.h"
 #include "SysSe/Math/Ifx_LowPassPt1F32.h"
 #include "Gpt12/Std/IfxGpt12.h"
+#include "Gtm/Std/IfxGtm_Tim.h"
+#include "Gtm/Std/IfxGtm_Tbu.h"
+#include "_PinMap/IfxGtm_PinMap.h"
 #include "string.h"
 
 /******************************************************************************/
@@ -188,6 +211,22 @@ typedef IfxStdIf_Pos_Update IfxGpt12_IncrEnc_Update;
 
 /** \addtogroup IfxLld_Gpt12_IncrEnc_Datastructures
  * \{ */
+/** \brief Edge timestamp speed estimation data
+ */
+typedef struct
+{
+    Ifx_GTM_TIM_CH *channel;                    /**< \brief TIM channel capturing the A edges, NULL_PTR if the speed is computed by the update */
+    Ifx_GTM        *gtm;                        /**< \brief Pointer to the GTM module */
+    float32         speedConst;                 /**< \brief speed in rad/s = speedConst * edges / time stamp ticks */
+    uint32          timeout;                    /**< \brief time without edge in ticks after which the speed is 0, from minSpeed */
+    uint32          timestamp;                  /**< \brief time stamp of the last edge used */
+    sint32          count;                      /**< \brief GPT12 count at the last speed computation */
+    uint8           countsPerEdge;              /**< \brief GPT12 counts per A edge: 1 (twoFold) or 2 (fourFold) */
+    uint8           edgeCount;                  /**< \brief TIM edge counter of the last edge used */
+    boolean         synchronised;               /**< \brief FALSE until an edge has been seen since the init, the reset or a stop */
+    boolean         coreT3;                     /**< \brief TRUE if T3 is the core timer, else T2 */
+} IfxGpt12_IncrEnc_Timestamp;
+
 /** \brief Incremental encoder object
  */
 typedef struct
@@ -211,6 +250,7 @@ typedef struct
     Ifx_LowPassPt1F32       speedLpf;                     /**< \brief Low pass filter object */
     IfxGpt12_IncrEnc_Update update;                       /**< \brief Update call back API */
     boolean                 speedFilterEnabled;           /**< \brief Enable / disable the speed low pass filter */
+    IfxGpt12_IncrEnc_Timestamp timestamp;                 /**< \brief Edge timestamp speed estimation */
 } IfxGpt12_IncrEnc;
 
 /** \brief Configuration structure for GPT12
@@ -226,6 +266,10 @@ typedef struct
     Ifx_Priority        zeroIsrPriority;       /**< \brief Interrupt isrPriority of the zero interrupt, if 0 the interrupt is disable */
     IfxSrc_Tos          zeroIsrProvider;       /**< \brief Interrupt service provider for the zero interrupt */
     IfxPort_PadDriver   pinDriver;             /**< \brief Pad Driver */
+    struct
+    {
+        IfxGtm_Tim_TinMap *pinA;               /**< \brief TIM input on the encoder A signal pin. If not NULL_PTR, the speed is computed from the edge timestamps by \ref IfxGpt12_IncrEnc_getSpeed() */
+    }                   timestamp;             /**< \brief Edge timestamp speed estimation */
 } IfxGpt12_IncrEnc_Config;
 
 /** \} */
@@ -336,6 +380,7 @@ IFX_EXTERN sint32 IfxGpt12_IncrEnc_getResolution(IfxGpt12_IncrEnc *driver);
 IFX_EXTERN IfxStdIf_Pos_SensorType IfxGpt12_IncrEnc_getSensorType(IfxGpt12_IncrEnc *driver);
 
 /** \brief \see IfxStdIf_Pos_GetSpeed
+ * With timestamp.pinA configured, the speed is computed from the edge timestamps on each call
  * \param driver driver handle
  * \return speed
  */
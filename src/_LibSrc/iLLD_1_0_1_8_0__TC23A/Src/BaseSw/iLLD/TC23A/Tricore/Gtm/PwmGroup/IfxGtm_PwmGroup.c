@@ -0,0 +1,213 @@
+/**
+ * \file IfxGtm_PwmGroup.c
+ * \brief GTM PWM group: synchronized start and update of TOM channels
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "IfxGtm_PwmGroup.h"
+#include "IfxGtm_bf.h"
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+
+/** \brief Mask of the TBU time stamp bits compared with ACT_TB */
+#define IFXGTM_PWMGROUP_ACT_TB_MASK (0x00FFFFFFU)
+
+/******************************************************************************/
+/*-----------------------Private Function Prototypes--------------------------*/
+/******************************************************************************/
+
+/** \brief Add a channel to a TGC of the group
+ * \param group Group handle
+ * \param tgc TGC pointer
+ * \param channelIndex Channel index in the TGC (0 .. 7)
+ * \return FALSE if the group is full, else TRUE
+ */
+static boolean IfxGtm_PwmGroup_addChannel(IfxGtm_PwmGroup *group, Ifx_GTM_TOM_TGC *tgc, uint8 channelIndex);
+
+/** \brief Returns the TBU time stamp value compared with ACT_TB
+ * \param group Group handle
+ * \return time stamp value
+ */
+static uint32 IfxGtm_PwmGroup_getTimeStamp(IfxGtm_PwmGroup *group);
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+static boolean IfxGtm_PwmGroup_addChannel(IfxGtm_PwmGroup *group, Ifx_GTM_TOM_TGC *tgc, uint8 channelIndex)
+{
+    uint8                       i;
+    IfxGtm_PwmGroup_Controller *controller = NULL_PTR;
+
+    for (i = 0; i < group->controllerCount; i++)
+    {
+        if (group->controller[i].tgc == tgc)
+        {
+            controller = &group->controller[i];
+        }
+    }
+
+    if (controller == NULL_PTR)
+    {
+        if (group->controllerCount >= IFXGTM_PWMGROUP_MAX_CONTROLLERS)
+        {
+            return FALSE;
+        }
+
+        controller                = &group->controller[group->controllerCount];
+        controller->tgc           = tgc;
+        controller->globalControl = &tgc->GLB_CTRL.U;
+        controller->channelsMask  = 0;
+        group->controllerCount++;
+    }
+
+    controller->channelsMask |= 1U << channelIndex;
+
+    controller->globalControlApplyUpdate   = IfxGtm_Tom_Tgc_buildFeature(controller->channelsMask, 0, IFX_GTM_TOM_TGC0_GLB_CTRL_UPEN_CTRL0_OFF);
+    controller->globalControlDisableUpdate = IfxGtm_Tom_Tgc_buildFeature(0, controller->channelsMask, IFX_GTM_TOM_TGC0_GLB_CTRL_UPEN_CTRL0_OFF);
+
+    return TRUE;
+}
+
+
+boolean IfxGtm_PwmGroup_addTomChannel(IfxGtm_PwmGroup *group, IfxGtm_Tom tom, IfxGtm_Tom_Ch channel)
+{
+    Ifx_GTM_TOM    *tomSFR = &group->gtm->TOM[tom];
+    Ifx_GTM_TOM_CH *tomCh  = IfxGtm_Tom_Ch_getChannelPointer(tomSFR, channel);
+    uint8           tgcIndex;
+
+    if (group->channelCount >= IFXGTM_PWMGROUP_MAX_CHANNELS)
+    {
+        return FALSE;
+    }
+
+    tgcIndex = (uint8)channel / IFXGTM_TOM_NUM_TGC_CHANNELS;
+
+    if (IfxGtm_PwmGroup_addChannel(group, IfxGtm_Tom_Ch_getTgcPointer(tomSFR, tgcIndex),
+            (uint8)channel % IFXGTM_TOM_NUM_TGC_CHANNELS) == FALSE)
+    {
+        return FALSE;
+    }
+
+    group->channel[group->channelCount].shadowZero = &tomCh->SR0.U;
+    group->channel[group->channelCount].shadowOne  = &tomCh->SR1.U;
+    group->channelCount++;
+
+    return TRUE;
+}
+
+
+static uint32 IfxGtm_PwmGroup_getTimeStamp(IfxGtm_PwmGroup *group)
+{
+    Ifx_GTM_TBU *tbu = &group->gtm->TBU;
+    uint32       timeStamp;
+
+    switch (group->timeBase)
+    {
+    case IfxGtm_Tbu_Ts_0:
+        timeStamp = tbu->CH0_BASE.U;
+
+        if (tbu->CH0_CTRL.B.LOW_RES != 0)
+        {
+            /* ACT_TB is compared with TBU_TS0[26:3] */
+            timeStamp = timeStamp >> 3;
+        }
+
+        break;
+    case IfxGtm_Tbu_Ts_1:
+        timeStamp = tbu->CH1_BASE.U;
+        break;
+    default:
+        timeStamp = tbu->CH2_BASE.U;
+        break;
+    }
+
+    return timeStamp & IFXGTM_PWMGROUP_ACT_TB_MASK;
+}
+
+
+void IfxGtm_PwmGroup_init(IfxGtm_PwmGroup *group, const IfxGtm_PwmGroup_Config *config)
+{
+    group->gtm             = config->gtm;
+    group->timeBase        = config->timeBase;
+    group->controllerCount = 0;
+    group->channelCount    = 0;
+}
+
+
+void IfxGtm_PwmGroup_initConfig(IfxGtm_PwmGroup_Config *config, Ifx_GTM *gtm)
+{
+    config->gtm      = gtm;
+    config->timeBase = IfxGtm_Tbu_Ts_0;
+}
+
+
+void IfxGtm_PwmGroup_start(IfxGtm_PwmGroup *group, uint32 delay)
+{
+    uint8  i;
+    uint32 startTime;
+
+    /* Arm the enable, output enable and counter reset of all TGC on their trigger */
+    for (i = 0; i < group->controllerCount; i++)
+    {
+        IfxGtm_PwmGroup_Controller *controller = &group->controller[i];
+        uint16                      mask       = controller->channelsMask;
+
+        IfxGtm_Tom_Tgc_enableTimeTrigger(controller->tgc, FALSE);
+        IfxGtm_Tom_Tgc_setChannelsForceUpdate(controller->tgc, mask, 0, mask, 0);
+        IfxGtm_Tom_Tgc_enableChannels(controller->tgc, mask, 0, FALSE);
+        IfxGtm_Tom_Tgc_enableChannelsOutput(controller->tgc, mask, 0, FALSE);
+    }
+
+    /* Single time stamp for all TGC */
+    startTime = (IfxGtm_PwmGroup_getTimeStamp(group) + delay) & IFXGTM_PWMGROUP_ACT_TB_MASK;
+
+    for (i = 0; i < group->controllerCount; i++)
+    {
+        IfxGtm_PwmGroup_Controller *controller = &group->controller[i];
+
+        IfxGtm_Tom_Tgc_setTimeTrigger(controller->tgc, group->timeBase, startTime);
+        IfxGtm_Tom_Tgc_enableTimeTrigger(controller->tgc, TRUE);
+    }
+}
+
+
+void IfxGtm_PwmGroup_stop(IfxGtm_PwmGroup *group)
+{
+    uint8 i;
+
+    for (i = 0; i < group->controllerCount; i++)
+    {
+        IfxGtm_PwmGroup_Controller *controller = &group->controller[i];
+        uint16                      mask       = controller->channelsMask;
+
+        IfxGtm_Tom_Tgc_enableTimeTrigger(controller->tgc, FALSE);
+        IfxGtm_Tom_Tgc_setChannelsForceUpdate(controller->tgc, 0, mask, 0, mask);
+        IfxGtm_Tom_Tgc_enableChannels(controller->tgc, 0, mask, TRUE);
+        IfxGtm_Tom_Tgc_enableChannelsOutput(controller->tgc, 0, mask, TRUE);
+    }
+}
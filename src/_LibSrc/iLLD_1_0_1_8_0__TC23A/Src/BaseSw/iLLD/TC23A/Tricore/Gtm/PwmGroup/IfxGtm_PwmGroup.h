@@ -0,0 +1,253 @@
+/**
+ * \file IfxGtm_PwmGroup.h
+ * \brief GTM PWM group: synchronized start and update of TOM channels
+ * \ingroup IfxLld_Gtm
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ *
+ * The PWM group collects PWM channels of different TOM modules and TGC, already initialised
+ * by their own driver (e.g. \ref IfxGtm_Tom_Pwm_init()) with the
+ * synchronous start disabled, and controls them as a single unit.
+ *
+ * \section start Synchronized start
+ *   The channel enable (ENDIS) and output enable (OUTEN) of each TOM TGC of the group
+ *   are armed on trigger together with a force update resetting the counters (FUPD, RSTCN0). All TGC
+ *   time base triggers (ACT_TB) are then set to the same TBU time stamp, computed once from the current
+ *   time stamp plus a delay. All channels start on the same TBU clock tick, independently of the code timing.
+ *
+ *   The delay must cover the time required to arm all TGC of the group, a few hundreds of CPU cycles.
+ *
+ * \section update Synchronized update
+ *   The GTM does not provide a register controlling the shadow transfer of several TGC, each TGC has
+ *   its own GLB_CTRL. The group caches the UPEN_CTRL value of each TGC so that
+ *   \ref IfxGtm_PwmGroup_disableUpdate() and \ref IfxGtm_PwmGroup_applyUpdate() require one register write per
+ *   TGC, independently of the number of channels. The new compare values are transferred at the next period
+ *   start of each channel (SR0 -> CM0, SR1 -> CM1).
+ *
+ * \section restrictions Restrictions
+ *   - All channels must use the same clock frequency and period for the edges to stay aligned
+ *   - Channels of the same TGC not part of the group are not affected, but are started by
+ *     \ref IfxGtm_PwmGroup_start() if their enable was armed by their own driver
+ *
+ * \section example Usage example
+ * \code
+ *   IfxGtm_PwmGroup_Config groupConfig;
+ *   IfxGtm_PwmGroup        group;
+ *
+ *   IfxGtm_PwmGroup_initConfig(&groupConfig, &MODULE_GTM);
+ *   IfxGtm_PwmGroup_init(&group, &groupConfig);
+ *   IfxGtm_PwmGroup_addTomChannel(&group, IfxGtm_Tom_0, IfxGtm_Tom_Ch_0);   // channel index 0
+ *   IfxGtm_PwmGroup_addTomChannel(&group, IfxGtm_Tom_1, IfxGtm_Tom_Ch_8);   // channel index 1
+ *   IfxGtm_PwmGroup_addTomChannel(&group, IfxGtm_Tom_1, IfxGtm_Tom_Ch_2);   // channel index 2
+ *
+ *   IfxGtm_PwmGroup_start(&group, 1000);
+ *
+ *   // Run-time
+ *   IfxGtm_PwmGroup_disableUpdate(&group);
+ *   IfxGtm_PwmGroup_setCompareShadow(&group, 0, period, duty0);
+ *   IfxGtm_PwmGroup_setCompareShadow(&group, 1, period, duty1);
+ *   IfxGtm_PwmGroup_setCompareShadow(&group, 2, period, duty2);
+ *   IfxGtm_PwmGroup_applyUpdate(&group);
+ * \endcode
+ *
+ * \defgroup IfxLld_Gtm_PwmGroup GTM PWM Group
+ * \ingroup IfxLld_Gtm
+ * \defgroup IfxLld_Gtm_PwmGroup_Data_Structures Data Structures
+ * \ingroup IfxLld_Gtm_PwmGroup
+ * \defgroup IfxLld_Gtm_PwmGroup_Group_Functions Group Functions
+ * \ingroup IfxLld_Gtm_PwmGroup
+ */
+
+#ifndef IFXGTM_PWMGROUP_H
+#define IFXGTM_PWMGROUP_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "Gtm/Std/IfxGtm_Tom.h"
+#include "Gtm/Std/IfxGtm_Tbu.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+#ifndef IFXGTM_PWMGROUP_MAX_CHANNELS
+/** \brief Maximal number of channels of a group */
+#define IFXGTM_PWMGROUP_MAX_CHANNELS    (16)
+#endif
+
+/** \brief Number of TGC which can be part of a group */
+#define IFXGTM_PWMGROUP_MAX_CONTROLLERS (IFXGTM_NUM_TOM_OBJECTS * 2)
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+
+/** \addtogroup IfxLld_Gtm_PwmGroup_Data_Structures
+ * \{ */
+/** \brief TOM TGC of the group
+ */
+typedef struct
+{
+    Ifx_GTM_TOM_TGC       *tgc;                         /**< \brief TGC pointer */
+    volatile unsigned int *globalControl;               /**< \brief GLB_CTRL register of the TGC, unsigned access type of the SFR */
+    uint16                 channelsMask;                /**< \brief Mask of the group channels in the TGC (bit 0: channel 0 of the TGC) */
+    uint32                 globalControlApplyUpdate;    /**< \brief GLB_CTRL value enabling the shadow transfer of the group channels (cached value) */
+    uint32                 globalControlDisableUpdate;  /**< \brief GLB_CTRL value disabling the shadow transfer of the group channels (cached value) */
+} IfxGtm_PwmGroup_Controller;
+
+/** \brief Channel of the group
+ */
+typedef struct
+{
+    volatile unsigned int *shadowZero;    /**< \brief SR0 register of the channel (period), unsigned access type of the SFR */
+    volatile unsigned int *shadowOne;     /**< \brief SR1 register of the channel (duty), unsigned access type of the SFR */
+} IfxGtm_PwmGroup_Channel;
+
+/** \brief PWM group handle
+ */
+typedef struct
+{
+    Ifx_GTM                   *gtm;                                         /**< \brief Pointer to GTM module */
+    IfxGtm_Tbu_Ts              timeBase;                                    /**< \brief TBU time stamp used for the synchronized start */
+    uint8                      controllerCount;                             /**< \brief Number of used entries in controller */
+    uint8                      channelCount;                                /**< \brief Number of used entries in channel */
+    IfxGtm_PwmGroup_Controller controller[IFXGTM_PWMGROUP_MAX_CONTROLLERS]; /**< \brief TGC of the group */
+    IfxGtm_PwmGroup_Channel    channel[IFXGTM_PWMGROUP_MAX_CHANNELS];       /**< \brief Channels of the group in the order they have been added */
+} IfxGtm_PwmGroup;
+
+/** \brief Configuration structure for the PWM group
+ */
+typedef struct
+{
+    Ifx_GTM      *gtm;              /**< \brief Pointer to GTM module */
+    IfxGtm_Tbu_Ts timeBase;         /**< \brief TBU time stamp used for the synchronized start. The TBU channel must be enabled */
+} IfxGtm_PwmGroup_Config;
+
+/** \} */
+
+/** \addtogroup IfxLld_Gtm_PwmGroup_Group_Functions
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Enable the shadow transfer of all group channels at their next period start
+ * \param group Group handle
+ * \return None
+ */
+IFX_INLINE void IfxGtm_PwmGroup_applyUpdate(IfxGtm_PwmGroup *group);
+
+/** \brief Disable the shadow transfer of all group channels, to be called before the shadow values are updated
+ * \param group Group handle
+ * \return None
+ */
+IFX_INLINE void IfxGtm_PwmGroup_disableUpdate(IfxGtm_PwmGroup *group);
+
+/** \brief Set the shadow compare values of a group channel
+ * \param group Group handle
+ * \param index Channel index, in the order the channels have been added
+ * \param shadowZero Period in ticks (SR0)
+ * \param shadowOne Duty in ticks (SR1)
+ * \return None
+ */
+IFX_INLINE void IfxGtm_PwmGroup_setCompareShadow(IfxGtm_PwmGroup *group, uint8 index, uint32 shadowZero, uint32 shadowOne);
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Add a TOM channel to the group
+ * \param group Group handle
+ * \param tom TOM object
+ * \param channel TOM channel
+ * \return FALSE if the group is full, else TRUE
+ */
+IFX_EXTERN boolean IfxGtm_PwmGroup_addTomChannel(IfxGtm_PwmGroup *group, IfxGtm_Tom tom, IfxGtm_Tom_Ch channel);
+
+/** \brief Initialise the group, the group is empty
+ * \param group Group handle
+ * \param config Configuration structure
+ * \return None
+ */
+IFX_EXTERN void IfxGtm_PwmGroup_init(IfxGtm_PwmGroup *group, const IfxGtm_PwmGroup_Config *config);
+
+/** \brief Initialise the configuration structure with default values
+ * \param config Configuration structure
+ * \param gtm Pointer to GTM module
+ * \return None
+ */
+IFX_EXTERN void IfxGtm_PwmGroup_initConfig(IfxGtm_PwmGroup_Config *config, Ifx_GTM *gtm);
+
+/** \brief Start all group channels on the same TBU time stamp
+ *
+ * The channels counters are reset and the shadow values transferred at the start.
+ * \param group Group handle
+ * \param delay Delay in TBU time stamp ticks between the call and the start
+ * \return None
+ */
+IFX_EXTERN void IfxGtm_PwmGroup_start(IfxGtm_PwmGroup *group, uint32 delay);
+
+/** \brief Stop all group channels immediately and disable their outputs
+ * \param group Group handle
+ * \return None
+ */
+IFX_EXTERN void IfxGtm_PwmGroup_stop(IfxGtm_PwmGroup *group);
+
+/** \} */
+
+/******************************************************************************/
+/*---------------------Inline Function Implementations------------------------*/
+/******************************************************************************/
+
+IFX_INLINE void IfxGtm_PwmGroup_applyUpdate(IfxGtm_PwmGroup *group)
+{
+    uint8 i;
+
+    for (i = 0; i < group->controllerCount; i++)
+    {
+        *group->controller[i].globalControl = group->controller[i].globalControlApplyUpdate;
+    }
+}
+
+
+IFX_INLINE void IfxGtm_PwmGroup_disableUpdate(IfxGtm_PwmGroup *group)
+{
+    uint8 i;
+
+    for (i = 0; i < group->controllerCount; i++)
+    {
+        *group->controller[i].globalControl = group->controller[i].globalControlDisableUpdate;
+    }
+}
+
+
+IFX_INLINE void IfxGtm_PwmGroup_setCompareShadow(IfxGtm_PwmGroup *group, uint8 index, uint32 shadowZero, uint32 shadowOne)
+{
+    IfxGtm_PwmGroup_Channel *channel = &group->channel[index];
+
+    *channel->shadowZero = shadowZero;
+    *channel->shadowOne  = shadowOne;
+}
+
+
+#endif /* IFXGTM_PWMGROUP_H */
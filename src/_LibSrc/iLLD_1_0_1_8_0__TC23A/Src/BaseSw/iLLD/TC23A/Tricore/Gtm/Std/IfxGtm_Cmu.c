@@ -240,9 +240,7 @@ void IfxGtm_Cmu_setClkFrequency(Ifx_GTM *gtm, IfxGtm_Cmu_Clk clkIndex, float32 f
         cnt++;
     }
 
-    uint16 psw = IfxScuWdt_getCpuWatchdogPassword();
-    IfxScuWdt_clearCpuEndinit(psw);     /* FIXME is this required ? */
-
+    /* The CMU registers are not ENDINIT protected */
     switch (clkIndex)
     {
     case IfxGtm_Cmu_Clk_0:
@@ -262,8 +260,6 @@ void IfxGtm_Cmu_setClkFrequency(Ifx_GTM *gtm, IfxGtm_Cmu_Clk clkIndex, float32 f
     default:
         break;
     }
-
-    IfxScuWdt_setCpuEndinit(psw);
 }
 
 
@@ -306,12 +302,10 @@ void IfxGtm_Cmu_setEclkFrequency(Ifx_GTM *gtm, IfxGtm_Cmu_Eclk clkIndex, float32
         }
     }
 
-    uint16 psw = IfxScuWdt_getCpuWatchdogPassword();
-    IfxScuWdt_clearCpuEndinit(psw);                 /* FIXME is this required ? */
+    /* The CMU registers are not ENDINIT protected */
     gtm->CMU.ECLK[clkIndex].NUM.B.ECLK_NUM = zBest;
     gtm->CMU.ECLK[clkIndex].NUM.B.ECLK_NUM = zBest; /* write twice to be sure */
     gtm->CMU.ECLK[clkIndex].DEN.B.ECLK_DEN = nBest;
-    IfxScuWdt_setCpuEndinit(psw);
 }
 
 
@@ -396,10 +390,8 @@ void IfxGtm_Cmu_setGclkFrequency(Ifx_GTM *gtm, float32 frequency)
 
 #endif
 
-    uint16 psw = IfxScuWdt_getCpuWatchdogPassword();
-    IfxScuWdt_clearCpuEndinit(psw);         /* FIXME is this required ? */
+    /* The CMU registers are not ENDINIT protected */
     gtm->CMU.GCLK_NUM.B.GCLK_NUM = zBest;
     gtm->CMU.GCLK_NUM.B.GCLK_NUM = zBest;   /* write twice to be sure */
     gtm->CMU.GCLK_DEN.B.GCLK_DEN = nBest;
-    IfxScuWdt_setCpuEndinit(psw);
 }
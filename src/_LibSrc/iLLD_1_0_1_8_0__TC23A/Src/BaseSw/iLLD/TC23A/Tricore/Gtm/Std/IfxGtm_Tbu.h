@@ -69,6 +69,15 @@ typedef enum
  */
 IFX_INLINE void IfxGtm_Tbu_enableChannel(Ifx_GTM *gtm, IfxGtm_Tbu_Ts channel);
 
+/** \brief Returns the time stamp TBU_TSx distributed to the TIM and ATOM channels
+ *
+ * For the channel 0, the time stamp is TBU_CH0_BASE[23:0], or TBU_CH0_BASE[26:3] with TBU_CH0_CTRL.LOW_RES.
+ * \param gtm Pointer to GTM module
+ * \param channel TBU Time stamps
+ * \return 24 bit time stamp
+ */
+IFX_INLINE uint32 IfxGtm_Tbu_getTimestamp(Ifx_GTM *gtm, IfxGtm_Tbu_Ts channel);
+
 /******************************************************************************/
 /*-------------------------Global Function Prototypes-------------------------*/
 /******************************************************************************/
@@ -94,4 +103,32 @@ IFX_INLINE void IfxGtm_Tbu_enableChannel(Ifx_GTM *gtm, IfxGtm_Tbu_Ts channel)
 }
 
 
+IFX_INLINE uint32 IfxGtm_Tbu_getTimestamp(Ifx_GTM *gtm, IfxGtm_Tbu_Ts channel)
+{
+    uint32 result;
+
+    if (channel == IfxGtm_Tbu_Ts_0)
+    {
+        result = gtm->TBU.CH0_BASE.B.BASE;
+
+        if (gtm->TBU.CH0_CTRL.B.LOW_RES != 0)
+        {
+            result = result >> 3;
+        }
+
+        result = result & 0x00FFFFFFU;
+    }
+    else if (channel == IfxGtm_Tbu_Ts_1)
+    {
+        result = gtm->TBU.CH1_BASE.B.BASE;
+    }
+    else
+    {
+        result = gtm->TBU.CH2_BASE.B.BASE;
+    }
+
+    return result;
+}
+
+
 #endif /* IFXGTM_TBU_H */
@@ -43,10 +43,26 @@
  */
 IFX_INLINE Ifx_ActiveState IfxGtm_Tom_PwmHl_invertActiveState(Ifx_ActiveState activeState);
 
+/** \brief Writes the compare shadow values of a channel, into the DMA update memory in DMA update mode
+ * \param driver GTM TOM PWM driver
+ * \param channel Channel index
+ * \param shadowZero Compare zero shadow value
+ * \param shadowOne Compare one shadow value
+ * \return None
+ */
+IFX_INLINE void IfxGtm_Tom_PwmHl_setCompareShadow(IfxGtm_Tom_PwmHl *driver, IfxGtm_Tom_Ch channel, uint32 shadowZero, uint32 shadowOne);
+
 /******************************************************************************/
 /*-----------------------Private Function Prototypes--------------------------*/
 /******************************************************************************/
 
+/** \brief Initialises the DMA linked list which copies the compare shadow values on each timer period
+ * \param driver GTM TOM PWM driver
+ * \param config GTM TOM: PWM HL configuration
+ * \return None
+ */
+IFX_STATIC void IfxGtm_Tom_PwmHl_initDma(IfxGtm_Tom_PwmHl *driver, const IfxGtm_Tom_PwmHl_Config *config);
+
 /** \brief Sets switched to OFF
  * \param driver GTM TOM PWM driver
  * \param tOn ON time
@@ -124,6 +140,20 @@ IFX_INLINE Ifx_ActiveState IfxGtm_Tom_PwmHl_invertActiveState(Ifx_ActiveState ac
 }
 
 
+IFX_INLINE void IfxGtm_Tom_PwmHl_setCompareShadow(IfxGtm_Tom_PwmHl *driver, IfxGtm_Tom_Ch channel, uint32 shadowZero, uint32 shadowOne)
+{
+    if (driver->dmaBuffer != NULL_PTR)
+    {
+        driver->dmaBuffer->shadow[channel].shadowZero = shadowZero;
+        driver->dmaBuffer->shadow[channel].shadowOne  = shadowOne;
+    }
+    else
+    {
+        IfxGtm_Tom_Ch_setCompareShadow(driver->tom, channel, shadowZero, shadowOne);
+    }
+}
+
+
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
@@ -162,6 +192,7 @@ boolean IfxGtm_Tom_PwmHl_init(IfxGtm_Tom_PwmHl *driver, const IfxGtm_Tom_PwmHl_C
     driver->base.ccxActiveState   = config->base.ccxActiveState;
     driver->base.coutxActiveState = config->base.coutxActiveState;
     driver->base.channelCount     = config->base.channelCount;
+    driver->dmaBuffer             = NULL_PTR;
 
     IfxGtm_Tom_PwmHl_setDeadtime(driver, config->base.deadtime);
     IfxGtm_Tom_PwmHl_setMinPulse(driver, config->base.minPulse);
@@ -261,10 +292,72 @@ boolean IfxGtm_Tom_PwmHl_init(IfxGtm_Tom_PwmHl *driver, const IfxGtm_Tom_PwmHl_C
         IfxGtm_Tom_Timer_addToChannelMask(timer, driver->coutx[channelIndex]);
     }
 
+    if (config->dma.useDma != FALSE)
+    {
+        IfxGtm_Tom_PwmHl_initDma(driver, config);
+    }
+
     return result;
 }
 
 
+IFX_STATIC void IfxGtm_Tom_PwmHl_initDma(IfxGtm_Tom_PwmHl *driver, const IfxGtm_Tom_PwmHl_Config *config)
+{
+    IfxGtm_Tom_PwmHl_DmaBuffer *buffer     = config->dma.buffer;
+    uint32                      coreId     = IfxCpu_getCoreId();
+    uint32                      entryCount = 2 * driver->base.channelCount;
+    uint32                      entryIndex;
+    IfxDma_Dma                  dma;
+    IfxDma_Dma_ChannelConfig    dmaCfg;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((uint32)buffer & 0x1F) == 0);
+
+    /* From now on the compare values are written into the buffer, start with the inactive outputs */
+    driver->dmaBuffer = buffer;
+    Ifx_TimerValue tOn[IFXGTM_TOM_PWMHL_MAX_NUM_CHANNELS] = {0};
+    IfxGtm_Tom_PwmHl_updateOff(driver, tOn);
+
+    IfxDma_Dma_createModuleHandle(&dma, &MODULE_DMA);
+    IfxDma_Dma_initChannelConfig(&dmaCfg, &dma);
+
+    dmaCfg.channelId                        = config->dma.channelId;
+    dmaCfg.transferCount                    = 2; /* SR0 and SR1 */
+    dmaCfg.requestMode                      = IfxDma_ChannelRequestMode_completeTransactionPerRequest;
+    dmaCfg.operationMode                    = IfxDma_ChannelOperationMode_continuous;
+    dmaCfg.moveSize                         = IfxDma_ChannelMoveSize_32bit;
+    dmaCfg.blockMode                        = IfxDma_ChannelMove_1;
+    dmaCfg.sourceAddressCircularRange       = IfxDma_ChannelIncrementCircular_none;
+    dmaCfg.destinationAddressCircularRange  = IfxDma_ChannelIncrementCircular_none;
+    dmaCfg.shadowControl                    = IfxDma_ChannelShadow_linkedList;
+    dmaCfg.hardwareRequestEnabled           = TRUE;
+
+    /* One entry per TOM channel, the last entry loads the first one again */
+    for (entryIndex = entryCount; entryIndex > 0; entryIndex--)
+    {
+        uint32        index   = entryIndex - 1;
+        IfxGtm_Tom_Ch channel = (index < driver->base.channelCount)
+                                ? driver->ccx[index]
+                                : driver->coutx[index - driver->base.channelCount];
+
+        dmaCfg.sourceAddress      = IFXCPU_GLB_ADDR_DSPR(coreId, &buffer->shadow[channel]);
+        dmaCfg.destinationAddress = (uint32)&IfxGtm_Tom_Ch_getChannelPointer(driver->tom, channel)->SR0;
+        dmaCfg.shadowAddress      = IFXCPU_GLB_ADDR_DSPR(coreId, &buffer->descriptors[(index + 1) % entryCount]);
+        IfxDma_Dma_initLinkedListEntry(&buffer->descriptors[index], &dmaCfg);
+
+        /* The first entry waits for the next timer period, the other entries start as soon as loaded */
+        buffer->descriptors[index].CHCSR.U = 0;
+
+        if (index != 0)
+        {
+            buffer->descriptors[index].CHCSR.B.SCH = 1;
+        }
+    }
+
+    /* dmaCfg holds the first entry */
+    IfxDma_Dma_initChannel(&driver->dmaChannel, &dmaCfg);
+}
+
+
 void IfxGtm_Tom_PwmHl_initConfig(IfxGtm_Tom_PwmHl_Config *config)
 {
     IfxStdIf_PwmHl_initConfig(&config->base);
@@ -272,6 +365,32 @@ void IfxGtm_Tom_PwmHl_initConfig(IfxGtm_Tom_PwmHl_Config *config)
     config->tom   = IfxGtm_Tom_0;
     config->ccx   = NULL_PTR;
     config->coutx = NULL_PTR;
+
+    config->dma.useDma    = FALSE;
+    config->dma.channelId = IfxDma_ChannelId_none;
+    config->dma.buffer    = NULL_PTR;
+}
+
+
+boolean IfxGtm_Tom_PwmHl_isStaticConfigValid(const IfxGtm_Tom_PwmHl *driver, const IfxGtm_Tom_PwmHl_StaticConfig *config)
+{
+    boolean result = (config->tom == driver->tom)
+                     && (config->mode == driver->base.mode)
+                     && (config->mode != Ifx_Pwm_Mode_off)
+                     && (config->channelCount == driver->base.channelCount)
+                     && (config->period == driver->timer->base.period)
+                     && (config->deadtime == driver->base.deadtime)
+                     && (config->minPulse == driver->base.minPulse)
+                     && (driver->dmaBuffer == NULL_PTR);
+    uint8   channelIndex;
+
+    for (channelIndex = 0; (result != FALSE) && (channelIndex < config->channelCount); channelIndex++)
+    {
+        result = (config->ccx[channelIndex] == driver->ccx[channelIndex])
+                 && (config->coutx[channelIndex] == driver->coutx[channelIndex]);
+    }
+
+    return result;
 }
 
 
@@ -456,10 +575,10 @@ IFX_STATIC void IfxGtm_Tom_PwmHl_updateCenterAligned(IfxGtm_Tom_PwmHl *driver, I
         /* Special handling due to GTM issue */
         if (x == period)
         {                       /* 100% duty cycle */
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->ccxTemp[channelIndex],
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->ccxTemp[channelIndex],
                 period + 1 /* No compare event */,
                 2 /* 1st compare event (issue: expected to be 1) */ + deadtime);
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->coutxTemp[channelIndex],
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->coutxTemp[channelIndex],
                 period + 2 /* No compare event, issues has been seen with +1 */,
                 2 /* 1st compare event (issue: expected to be 1) */);
         }
@@ -467,15 +586,15 @@ IFX_STATIC void IfxGtm_Tom_PwmHl_updateCenterAligned(IfxGtm_Tom_PwmHl *driver, I
         {
             cm0 = 1;
             cm1 = period + 2;
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->ccxTemp[channelIndex], cm0, cm1);
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->coutxTemp[channelIndex], cm0 + deadtime, cm1);
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->ccxTemp[channelIndex], cm0, cm1);
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->coutxTemp[channelIndex], cm0 + deadtime, cm1);
         }
         else
         {                           /* x% duty cycle */
             cm1 = (period - x) / 2; // CM1 /* FIXME issue if CM1 <= 1, should be limited for up to AB step at least */
             cm0 = (period + x) / 2; // CM0
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->ccxTemp[channelIndex], cm0, cm1 + deadtime);
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->coutxTemp[channelIndex], cm0 + deadtime, cm1);
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->ccxTemp[channelIndex], cm0, cm1 + deadtime);
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->coutxTemp[channelIndex], cm0 + deadtime, cm1);
         }
     }
 }
@@ -516,10 +635,10 @@ IFX_STATIC void IfxGtm_Tom_PwmHl_updateEdgeAligned(IfxGtm_Tom_PwmHl *driver, Ifx
         /* Special handling due to GTM issue */
         if (x == period)
         {                       /* 100% duty cycle */
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->ccxTemp[channelIndex],
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->ccxTemp[channelIndex],
                 period + 1 /* No compare event */,
                 2 /* 1st compare event (issue: expected to be 1) */ + deadtime);
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->coutxTemp[channelIndex],
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->coutxTemp[channelIndex],
                 period + 2 /* No compare event, issues has been seen with +1 */,
                 2 /* 1st compare event (issue: expected to be 1) */);
         }
@@ -527,15 +646,15 @@ IFX_STATIC void IfxGtm_Tom_PwmHl_updateEdgeAligned(IfxGtm_Tom_PwmHl *driver, Ifx
         {
             cm0 = 1;
             cm1 = period + 2;
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->ccxTemp[channelIndex], cm0, cm1);
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->coutxTemp[channelIndex], cm0 + deadtime, cm1);
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->ccxTemp[channelIndex], cm0, cm1);
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->coutxTemp[channelIndex], cm0 + deadtime, cm1);
         }
         else
         {                       /* x% duty cycle */
             cm1 = 2;            // CM1, set to 2 due to a GTM issue. should be 1 according to spec
             cm0 = x;            // CM0, set to x+2 due to a GTM issue. should be x+1 according to spec
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->ccxTemp[channelIndex], cm0, cm1 + deadtime);
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->coutxTemp[channelIndex], cm0 + deadtime, cm1);
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->ccxTemp[channelIndex], cm0, cm1 + deadtime);
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->coutxTemp[channelIndex], cm0 + deadtime, cm1);
         }
     }
 }
@@ -550,9 +669,9 @@ IFX_STATIC void IfxGtm_Tom_PwmHl_updateOff(IfxGtm_Tom_PwmHl *driver, Ifx_TimerVa
 
     for (channelIndex = 0; channelIndex < driver->base.channelCount; channelIndex++)
     {
-        IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->ccxTemp[channelIndex],
+        IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->ccxTemp[channelIndex],
             2 /* 1 will keep the previous level */, period + 2);
-        IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->coutxTemp[channelIndex], period + 1, 2);
+        IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->coutxTemp[channelIndex], period + 1, 2);
     }
 }
 
@@ -595,7 +714,7 @@ IFX_STATIC void IfxGtm_Tom_PwmHl_updatePulse(IfxGtm_Tom_PwmHl *driver, float32 *
         /* Special handling due to GTM issue */
         if (x == period)
         {   /* 100% duty cycle */
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->ccxTemp[channelIndex],
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->ccxTemp[channelIndex],
                 period + 1 /* No compare event */,
                 2 /* 1st compare event (issue: expected to be 1)*/);
         }
@@ -603,13 +722,13 @@ IFX_STATIC void IfxGtm_Tom_PwmHl_updatePulse(IfxGtm_Tom_PwmHl *driver, float32 *
         {
             cm0 = 1;
             cm1 = period + 2;
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->ccxTemp[channelIndex], cm0, cm1);
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->ccxTemp[channelIndex], cm0, cm1);
         }
         else
         {                /* x% duty cycle */
             cm1 = 2 + o; // CM1, set to 2 due to a GTM issue. should be 1 according to spec
             cm0 = o + x; // CM0, set to x+2 due to a GTM issue. should be x+1 according to spec
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->ccxTemp[channelIndex], cm0, cm1);
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->ccxTemp[channelIndex], cm0, cm1);
         }
     }
 
@@ -644,7 +763,7 @@ IFX_STATIC void IfxGtm_Tom_PwmHl_updatePulse(IfxGtm_Tom_PwmHl *driver, float32 *
         /* Special handling due to GTM issue */
         if (x == period)
         {   /* 100% duty cycle */
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->coutxTemp[channelIndex],
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->coutxTemp[channelIndex],
                 period + 2 /* No compare event, issues has been seen with +1 */,
                 2 /* 1st compare event (issue: expected to be 1)*/);
         }
@@ -652,13 +771,13 @@ IFX_STATIC void IfxGtm_Tom_PwmHl_updatePulse(IfxGtm_Tom_PwmHl *driver, float32 *
         {
             cm0 = 1;
             cm1 = period + 2;
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->coutxTemp[channelIndex], cm0, cm1);
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->coutxTemp[channelIndex], cm0, cm1);
         }
         else
         {                /* x% duty cycle */
             cm1 = 2 + o; // CM1, set to 2 due to a GTM issue. should be 1 according to spec
             cm0 = o + x; // CM0, set to x+2 due to a GTM issue. should be x+1 according to spec
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->coutxTemp[channelIndex], cm0, cm1);
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->coutxTemp[channelIndex], cm0, cm1);
         }
     }
 }
@@ -706,10 +825,10 @@ IFX_STATIC void IfxGtm_Tom_PwmHl_updateShiftCenterAligned(IfxGtm_Tom_PwmHl *driv
         /* Special handling due to GTM issue */
         if (x == period)
         {   /* 100% duty cycle */
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->ccxTemp[channelIndex],
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->ccxTemp[channelIndex],
                 period + 1 /* No compare event */,
                 2 /* 1st compare event (issue: expected to be 1)*/ + deadtime);
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->coutxTemp[channelIndex],
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->coutxTemp[channelIndex],
                 period + 2 /* No compare event, issues has been seen with +1 */,
                 2 /* 1st compare event (issue: expected to be 1)*/);
         }
@@ -717,8 +836,8 @@ IFX_STATIC void IfxGtm_Tom_PwmHl_updateShiftCenterAligned(IfxGtm_Tom_PwmHl *driv
         {
             cm0 = 1;
             cm1 = period + 2;
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->ccxTemp[channelIndex], cm0, cm1);
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->coutxTemp[channelIndex], cm0 + deadtime, cm1);
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->ccxTemp[channelIndex], cm0, cm1);
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->coutxTemp[channelIndex], cm0 + deadtime, cm1);
         }
         else
         {                           /* x% duty cycle */
@@ -735,8 +854,8 @@ IFX_STATIC void IfxGtm_Tom_PwmHl_updateShiftCenterAligned(IfxGtm_Tom_PwmHl *driv
 
             cm1 = s + (period - x) / 2; // CM1
             cm0 = s + (period + x) / 2; // CM0
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->ccxTemp[channelIndex], cm0, cm1 + deadtime);
-            IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->coutxTemp[channelIndex], cm0 + deadtime, cm1);
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->ccxTemp[channelIndex], cm0, cm1 + deadtime);
+            IfxGtm_Tom_PwmHl_setCompareShadow(driver, driver->coutxTemp[channelIndex], cm0 + deadtime, cm1);
         }
     }
 }
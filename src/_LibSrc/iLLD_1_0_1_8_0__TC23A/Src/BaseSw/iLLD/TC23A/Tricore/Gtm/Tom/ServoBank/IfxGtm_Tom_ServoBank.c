@@ -0,0 +1,193 @@
+/**
+ * \file IfxGtm_Tom_ServoBank.c
+ * \brief GTM TOM servo bank details
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "IfxGtm_Tom_ServoBank.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief First pulse start in ticks, the compare events at 0 and 1 are not reliable (GTM issue, see IfxGtm_Tom_PwmHl) */
+#define IFXGTM_TOM_SERVOBANK_FIRST_START (2)
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+boolean IfxGtm_Tom_ServoBank_init(IfxGtm_Tom_ServoBank *driver, const IfxGtm_Tom_ServoBank_Config *config)
+{
+    IfxGtm_Tom_Timer    *timer  = config->timer;
+    Ifx_TimerValue       period = IfxGtm_Tom_Timer_getPeriod(timer);
+    IfxGtm_Tom_Ch_ClkSrc clock  = IfxGtm_Tom_Ch_getClockSource(timer->tom, timer->timerChannel);
+    float32              clockFreq;
+    float32              maxPulse = 0;
+    float32              window;
+    uint8                servoIndex;
+
+    clockFreq          = IfxGtm_Tom_Timer_getInputFrequency(timer);
+    driver->timer      = timer;
+    driver->tom        = timer->tom;
+    driver->servoCount = config->servoCount;
+
+    if ((config->servoCount == 0) || (config->servoCount > IFXGTM_TOM_SERVOBANK_MAX_SERVOS))
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+        return FALSE;
+    }
+
+    /* channels: same TOM as the timer, reset by the timer trigger */
+    for (servoIndex = 0; servoIndex < config->servoCount; servoIndex++)
+    {
+        const IfxGtm_Tom_ServoBank_ServoConfig *servo   = &config->servos[servoIndex];
+        IfxGtm_Tom_Ch                           channel = servo->pin->channel;
+
+        if ((&timer->gtm->TOM[servo->pin->tom] != timer->tom)
+            || (channel <= timer->timerChannel)
+            || (channel == timer->triggerChannel)
+            || ((channel > IfxGtm_Tom_Ch_7) && (timer->timerChannel <= IfxGtm_Tom_Ch_7) && (timer->tgc[1] == NULL_PTR))
+            || (servo->angleA == servo->angleB))
+        {
+            IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+            return FALSE;
+        }
+
+        maxPulse = __maxf(maxPulse, __maxf(servo->pulseA, servo->pulseB));
+    }
+
+    /* pulse starts spread over the period not used by the longest pulse */
+    window = (float32)period - (float32)IfxStdIf_Timer_sToTick(clockFreq, maxPulse) - (2 * IFXGTM_TOM_SERVOBANK_FIRST_START);
+
+    if (window < 0)
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+        return FALSE;
+    }
+
+    for (servoIndex = 0; servoIndex < config->servoCount; servoIndex++)
+    {
+        const IfxGtm_Tom_ServoBank_ServoConfig *servoConfig = &config->servos[servoIndex];
+        IfxGtm_Tom_ServoBank_Servo             *servo       = &driver->servos[servoIndex];
+        IfxGtm_Tom_Ch                           channel     = servoConfig->pin->channel;
+        Ifx_GTM_TOM_TGC                        *tgc         = IfxGtm_Tom_Ch_getTgcPointer(driver->tom, (channel <= IfxGtm_Tom_Ch_7) ? 0 : 1);
+        uint16                                  channelMask = 1 << (channel & 0x7);
+        float32                                 endA, endB;
+
+        servo->channel = channel;
+        servo->start   = IFXGTM_TOM_SERVOBANK_FIRST_START;
+
+        if (config->stagger != FALSE)
+        {
+            servo->start += (Ifx_TimerValue)((window * servoIndex) / config->servoCount);
+        }
+
+        /* calibration: pulse end = offset + slope * angle, saturated to the calibration pulses */
+        endA          = (float32)servo->start + (float32)IfxStdIf_Timer_sToTick(clockFreq, servoConfig->pulseA);
+        endB          = (float32)servo->start + (float32)IfxStdIf_Timer_sToTick(clockFreq, servoConfig->pulseB);
+        servo->slope  = (endB - endA) / (servoConfig->angleB - servoConfig->angleA);
+        servo->offset = endA - (servo->slope * servoConfig->angleA);
+        servo->endMin = __minf(endA, endB);
+        servo->endMax = __maxf(endA, endB);
+
+        /* Initialize the timer part, a TOM channel has no mode selection: it always runs in PWM mode */
+        IfxGtm_Tom_Ch_setClockSource(driver->tom, channel, clock);
+
+        /* Initialize the SOUR reset value (inactive) and enable the channel */
+        IfxGtm_Tom_Ch_setSignalLevel(driver->tom, channel, Ifx_ActiveState_high);
+        IfxGtm_Tom_Tgc_enableChannels(tgc, channelMask, 0, TRUE);
+        IfxGtm_Tom_Tgc_enableChannelsOutput(tgc, channelMask, 0, TRUE);
+
+        /* Run time: CM1 sets the output active (!SL), CM0 inactive (SL) */
+        IfxGtm_Tom_Ch_setSignalLevel(driver->tom, channel, Ifx_ActiveState_low);
+        IfxGtm_Tom_Ch_setResetSource(driver->tom, channel, IfxGtm_Tom_Ch_ResetEvent_onTrigger);
+        IfxGtm_Tom_Ch_setTriggerOutput(driver->tom, channel, IfxGtm_Tom_Ch_OutputTrigger_forward);
+        IfxGtm_Tom_Ch_setCounterValue(driver->tom, channel, IfxGtm_Tom_Timer_getOffset(timer));
+
+        /* No pulse until the first angles are set */
+        IfxGtm_Tom_Ch_setCompare(driver->tom, channel, 1, period + 2);
+        IfxGtm_Tom_Ch_setCompareShadow(driver->tom, channel, 1, period + 2);
+
+        /*Initialize the port */
+        IfxGtm_PinMap_setTomTout(servoConfig->pin, config->outputMode, config->outputDriver);
+        IfxPort_setPinState(servoConfig->pin->pin.port, servoConfig->pin->pin.pinIndex, IfxPort_State_low);
+
+        /* Enable timer to update the channel */
+        IfxGtm_Tom_Timer_addToChannelMask(timer, channel);
+    }
+
+    return TRUE;
+}
+
+
+void IfxGtm_Tom_ServoBank_initConfig(IfxGtm_Tom_ServoBank_Config *config, IfxGtm_Tom_Timer *timer)
+{
+    config->timer        = timer;
+    config->servos       = NULL_PTR;
+    config->servoCount   = 0;
+    config->stagger      = TRUE;
+    config->outputMode   = IfxPort_OutputMode_pushPull;
+    config->outputDriver = IfxPort_PadDriver_cmosAutomotiveSpeed1;
+}
+
+
+void IfxGtm_Tom_ServoBank_setAngles(IfxGtm_Tom_ServoBank *driver, const float32 *angles)
+{
+    Ifx_GTM_TOM *tom = driver->tom;
+    uint8        servoIndex;
+
+    IfxGtm_Tom_Timer_disableUpdate(driver->timer);
+
+    for (servoIndex = 0; servoIndex < driver->servoCount; servoIndex++)
+    {
+        const IfxGtm_Tom_ServoBank_Servo *servo = &driver->servos[servoIndex];
+        float32                           end;
+
+        end = servo->offset + (servo->slope * angles[servoIndex]);
+        end = __saturatef(end, servo->endMin, servo->endMax);
+
+        IfxGtm_Tom_Ch_setCompareShadow(tom, servo->channel, (uint32)(end + 0.5f), servo->start);
+    }
+
+    IfxGtm_Tom_Timer_applyUpdate(driver->timer);
+}
+
+
+void IfxGtm_Tom_ServoBank_setOff(IfxGtm_Tom_ServoBank *driver)
+{
+    Ifx_TimerValue period = IfxGtm_Tom_Timer_getPeriod(driver->timer);
+    uint8          servoIndex;
+
+    IfxGtm_Tom_Timer_disableUpdate(driver->timer);
+
+    for (servoIndex = 0; servoIndex < driver->servoCount; servoIndex++)
+    {
+        IfxGtm_Tom_Ch_setCompareShadow(driver->tom, driver->servos[servoIndex].channel, 1, period + 2);
+    }
+
+    IfxGtm_Tom_Timer_applyUpdate(driver->timer);
+}
@@ -0,0 +1,196 @@
+/**
+ * \file IfxGtm_Tom_ServoBank.h
+ * \brief GTM TOM servo bank details
+ * \ingroup IfxLld_Gtm
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup IfxLld_Gtm_Tom_ServoBank_Usage How to use the GTM TOM Servo Bank Driver
+ * \ingroup IfxLld_Gtm_Tom_ServoBank
+ *
+ *   This driver drives up to 15 RC servos from one TOM, all at the frame rate of a linked
+ *   \ref IfxLld_Gtm_Tom_Timer "timer".
+ *
+ * \section specific Specific implementation
+ *   As for \ref IfxLld_Gtm_Tom_PwmHl, the timer channel generates the internal trigger at each period (CCU0 of the
+ *   timer channel). The servo channels are reset by this trigger instead of their own CM0, so that all servos share
+ *   the single time base of the timer, and transfer their shadow values SR0 / SR1 at the same time.
+ *
+ *   Each servo pulse starts at a fixed offset from the period start: the CM1 match sets the output active and the
+ *   CM0 match, offset + pulse width, clears it. The offsets are spread over the part of the period not used by the
+ *   longest pulse, so that the pulse starts, and the current peaks of the servo motors, do not coincide.
+ *
+ *   The angle to pulse width calibration of each servo (pulse widths at two angles) is converted at init into a
+ *   slope and an offset in timer ticks, \ref IfxGtm_Tom_ServoBank_setAngles() only multiplies, adds and saturates.
+ *   All pulse widths are written with the update of the timer disabled, then transferred together at the next
+ *   period start.
+ *
+ *   - Resources used:
+ *       - the linked timer
+ *       - 1 TOM channel per servo, in the TOM of the timer, with a higher index than the timer channel. The servo
+ *         channels may be in the other TGC if the timer channel is in TGC0. The channels between the timer and
+ *         the servos must forward the trigger (default).
+ *   - The timer period must fit the longest pulse plus the offsets, see \ref IfxGtm_Tom_ServoBank_init().
+ *     Servos with different frame rates (e.g. 50 Hz analog and 333 Hz digital servos) need one bank each, with
+ *     their own timer.
+ *
+ * \section example Usage example
+ * \code
+ *   // timer, 50 Hz, started before the servo bank initialisation
+ *   IfxGtm_Tom_Timer_Config timerConfig;
+ *   IfxGtm_Tom_Timer_initConfig(&timerConfig, &MODULE_GTM);
+ *   timerConfig.base.frequency = 50;
+ *   timerConfig.tom            = IfxGtm_Tom_0;
+ *   timerConfig.timerChannel   = IfxGtm_Tom_Ch_0;
+ *   timerConfig.clock          = IfxGtm_Tom_Ch_ClkSrc_cmuFxclk2;
+ *   IfxGtm_Tom_Timer_init(&timer, &timerConfig);
+ *   IfxGtm_Tom_Timer_run(&timer);
+ *
+ *   // servos: 1 ms at -45 deg, 2 ms at +45 deg
+ *   IfxGtm_Tom_ServoBank_ServoConfig servos[2] = {
+ *       {&IfxGtm_TOM0_1_TOUT27_P33_5_OUT, -45.0, 1.0e-3, 45.0, 2.0e-3},
+ *       {&IfxGtm_TOM0_2_TOUT28_P33_6_OUT, -45.0, 2.0e-3, 45.0, 1.0e-3},    // mounted mirrored
+ *   };
+ *
+ *   IfxGtm_Tom_ServoBank_Config bankConfig;
+ *   IfxGtm_Tom_ServoBank_initConfig(&bankConfig, &timer);
+ *   bankConfig.servos     = servos;
+ *   bankConfig.servoCount = 2;
+ *   IfxGtm_Tom_ServoBank_init(&bank, &bankConfig);
+ *
+ *   float32 angles[2] = {10.0, -10.0};
+ *   IfxGtm_Tom_ServoBank_setAngles(&bank, angles);
+ * \endcode
+ *
+ * \defgroup IfxLld_Gtm_Tom_ServoBank TOM Servo Bank Interface Driver
+ * \ingroup IfxLld_Gtm_Tom
+ * \defgroup IfxLld_Gtm_Tom_ServoBank_Data_Structures Data Structures
+ * \ingroup IfxLld_Gtm_Tom_ServoBank
+ * \defgroup IfxLld_Gtm_Tom_ServoBank_ServoBank_Functions ServoBank Functions
+ * \ingroup IfxLld_Gtm_Tom_ServoBank
+ */
+
+#ifndef IFXGTM_TOM_SERVOBANK_H
+#define IFXGTM_TOM_SERVOBANK_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "Gtm/Tom/Timer/IfxGtm_Tom_Timer.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Maximal number of servos of one bank, the TOM channels except the timer channel
+ */
+#define IFXGTM_TOM_SERVOBANK_MAX_SERVOS (IFXGTM_NUM_TOM_CHANNELS - 1)
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+
+/** \addtogroup IfxLld_Gtm_Tom_ServoBank_Data_Structures
+ * \{ */
+/** \brief Servo of the bank, calibration precomputed in timer ticks
+ */
+typedef struct
+{
+    IfxGtm_Tom_Ch  channel;         /**< \brief TOM channel */
+    Ifx_TimerValue start;           /**< \brief Pulse start (CM1) */
+    float32        slope;           /**< \brief Pulse width in ticks per degree */
+    float32        offset;          /**< \brief Pulse end (CM0) at 0 degree */
+    float32        endMin;          /**< \brief Minimal pulse end */
+    float32        endMax;          /**< \brief Maximal pulse end */
+} IfxGtm_Tom_ServoBank_Servo;
+
+/** \brief Servo configuration. The calibration is given as the pulse widths at two angles
+ */
+typedef struct
+{
+    IfxGtm_Tom_ToutMap *pin;                /**< \brief Servo output */
+    float32             angleA;             /**< \brief 1st calibration angle in degree */
+    float32             pulseA;             /**< \brief Pulse width at angleA in s */
+    float32             angleB;             /**< \brief 2nd calibration angle in degree, different from angleA */
+    float32             pulseB;             /**< \brief Pulse width at angleB in s. The pulse is saturated between pulseA and pulseB */
+} IfxGtm_Tom_ServoBank_ServoConfig;
+
+/** \brief GTM TOM servo bank configuration
+ */
+typedef struct
+{
+    IfxGtm_Tom_Timer                       *timer;              /**< \brief Linked timer, must be running */
+    const IfxGtm_Tom_ServoBank_ServoConfig *servos;             /**< \brief Pointer to an array of servoCount servo configurations */
+    uint8                                   servoCount;         /**< \brief Number of servos, up to IFXGTM_TOM_SERVOBANK_MAX_SERVOS */
+    boolean                                 stagger;            /**< \brief If TRUE, the pulse starts are spread over the period, else all pulses start with the period */
+    IfxPort_OutputMode                      outputMode;         /**< \brief Output mode of the servo pins */
+    IfxPort_PadDriver                       outputDriver;       /**< \brief Pad driver of the servo pins */
+} IfxGtm_Tom_ServoBank_Config;
+
+/** \brief GTM TOM servo bank driver
+ */
+typedef struct
+{
+    IfxGtm_Tom_Timer          *timer;                                       /**< \brief Linked timer */
+    Ifx_GTM_TOM               *tom;                                         /**< \brief TOM unit used */
+    IfxGtm_Tom_ServoBank_Servo servos[IFXGTM_TOM_SERVOBANK_MAX_SERVOS];      /**< \brief Servos */
+    uint8                      servoCount;                                  /**< \brief Number of servos */
+} IfxGtm_Tom_ServoBank;
+
+/** \} */
+
+/** \addtogroup IfxLld_Gtm_Tom_ServoBank_ServoBank_Functions
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Initializes the servo bank. The servo outputs stay inactive until the first call to \ref IfxGtm_Tom_ServoBank_setAngles()
+ * Note: the timer must be started before the call to this function, see \ref IfxGtm_Tom_PwmHl_init()
+ * \param driver GTM TOM servo bank driver
+ * \param config GTM TOM servo bank configuration
+ * \return TRUE on success, FALSE if a channel is not usable with the timer or the longest pulse and the offsets do not fit in the timer period
+ */
+IFX_EXTERN boolean IfxGtm_Tom_ServoBank_init(IfxGtm_Tom_ServoBank *driver, const IfxGtm_Tom_ServoBank_Config *config);
+
+/** \brief Initialize the configuration structure to default: no servo, staggered pulses, push pull outputs
+ * \param config GTM TOM servo bank configuration. This parameter is Initialised by the function
+ * \param timer Linked timer
+ * \return None
+ */
+IFX_EXTERN void IfxGtm_Tom_ServoBank_initConfig(IfxGtm_Tom_ServoBank_Config *config, IfxGtm_Tom_Timer *timer);
+
+/** \brief Sets the angle of all servos, applied together at the next period start
+ * \param driver GTM TOM servo bank driver
+ * \param angles Pointer to an array of servoCount angles in degree, saturated to the calibration range
+ * \return None
+ */
+IFX_EXTERN void IfxGtm_Tom_ServoBank_setAngles(IfxGtm_Tom_ServoBank *driver, const float32 *angles);
+
+/** \brief Stops the pulses of all servos from the next period start, the servos are not driven anymore
+ * \param driver GTM TOM servo bank driver
+ * \return None
+ */
+IFX_EXTERN void IfxGtm_Tom_ServoBank_setOff(IfxGtm_Tom_ServoBank *driver);
+
+/** \} */
+
+#endif /* IFXGTM_TOM_SERVOBANK_H */
@@ -291,6 +291,22 @@
  *     }
  * \endcode
  *
+ * \subsection IfxLld_Multican_Can_Fifo_BulkRead Reading several FIFO entries at once
+ *
+ * IfxMultican_Can_MsgObj_readMessages() drains all received entries of a receive FIFO in one call, e.g. from the
+ * receive interrupt or a periodic task. The FIFO pointer is advanced for each message read.
+ * \code
+ *     IfxMultican_Message rxMsgs[FIFO_SIZE];
+ *     uint32 received = IfxMultican_Can_MsgObj_readMessages(&canDstMsgObj, rxMsgs, FIFO_SIZE);
+ *
+ *     for (i = 0; i < received; ++i)
+ *     {
+ *         // process rxMsgs[i]
+ *     }
+ * \endcode
+ *
+ * Forwarding messages between nodes without CPU intervention is done with the gateway mode, see \ref IfxLld_Multican_Can_GatewayTransfers.
+ *
  *
  * \section IfxLld_Multican_Can_FDDataTransfers CAN FD Data Transfers
  *
@@ -727,6 +743,122 @@
  *     }
  * \endcode
  *
+ * \section IfxLld_Multican_Can_Capture Bus capture
+ *
+ * The capture mode records every frame received by a node, without CPU load per frame. A standard receive
+ * message object accepts all IDs, its receive interrupt is routed to a DMA channel which copies the message
+ * object registers into a ring buffer, one 32 byte \ref IfxMultican_Can_CaptureEntry per frame. The node frame
+ * counter runs in time stamp mode (bit times), the message object captures it on reception (MOIPR.CFCVAL).
+ *
+ * The consumer gets the received entries in variable length batches with IfxMultican_Can_Capture_getEntries(),
+ * which converts the frame counter values into STM based time stamps in microseconds, and returns them with
+ * IfxMultican_Can_Capture_releaseEntries(). The consumer shall run at least once every 65536 bit times
+ * (65 ms at 1 Mbit/s), else the time stamps of the older entries are ambiguous.
+ *
+ * Overrun accounting:
+ * - IfxMultican_Can_Capture::overruns: entries overwritten by the DMA before they were read
+ * - IfxMultican_Can_Capture::lostFrames: DMA requests lost because the previous frame was not yet copied (DMA TSR.TRL)
+ *
+ * One capture object, message object and DMA channel is used per node. The ring buffer is typically located in the LMU
+ * RAM, it shall be aligned on its size (power of 2, up to 32 KiB, i.e. 1024 entries). Only classic CAN frames are captured
+ * (8 data bytes).
+ *
+ * \code
+ * // ring in the LMU RAM (linker section), one per node
+ * IFX_ALIGN(8192) IfxMultican_Can_CaptureEntry canCaptureRing0[256];
+ * IfxMultican_Can_Capture canCapture0;
+ *
+ * // receive object accepting all frames, receive interrupt on service request node 4
+ * IfxMultican_Can_MsgObjConfig canMsgObjConfig;
+ * IfxMultican_Can_MsgObj_initConfig(&canMsgObjConfig, &canNode0);
+ * canMsgObjConfig.msgObjId              = 0;
+ * canMsgObjConfig.frame                 = IfxMultican_Frame_receive;
+ * canMsgObjConfig.acceptanceMask        = 0;
+ * canMsgObjConfig.control.matchingId    = FALSE;
+ * canMsgObjConfig.rxInterrupt.enabled   = TRUE;
+ * canMsgObjConfig.rxInterrupt.srcId     = IfxMultican_SrcId_4;
+ * IfxMultican_Can_MsgObj_init(&canCaptureMsgObj0, &canMsgObjConfig);
+ *
+ * IfxMultican_Can_CaptureConfig captureConfig;
+ * IfxMultican_Can_Capture_initConfig(&captureConfig, &canCaptureMsgObj0);
+ * captureConfig.srcId        = IfxMultican_SrcId_4;
+ * captureConfig.dmaChannelId = IfxDma_ChannelId_20;
+ * captureConfig.buffer       = canCaptureRing0;
+ * captureConfig.entries      = 256;
+ * captureConfig.baudrate     = 500000;
+ * captureConfig.dmaPriority  = IFX_INTPRIO_CAN_CAPTURE0;
+ * IfxMultican_Can_Capture_init(&canCapture0, &captureConfig);
+ *
+ * // DMA channel interrupt, counts the ring half buffers
+ * IFX_INTERRUPT(canCapture0Isr, 0, IFX_INTPRIO_CAN_CAPTURE0)
+ * {
+ *     IfxMultican_Can_Capture_isrDma(&canCapture0);
+ * }
+ *
+ * // logging task
+ * IfxMultican_Can_CaptureEntry *entries;
+ * uint32 count;
+ *
+ * while ((count = IfxMultican_Can_Capture_getEntries(&canCapture0, &entries)) > 0)
+ * {
+ *     // write entries[0 .. count-1] to the log, entries[i].timestamp is in microseconds
+ *     IfxMultican_Can_Capture_releaseEntries(&canCapture0, count);
+ * }
+ * \endcode
+ *
+ * \section IfxLld_Multican_Can_Cyclic Cyclic transmission
+ *
+ * The cyclic transmission sends periodic frames without CPU involvement at the send time. The payloads are held in
+ * a RAM image, one \ref IfxMultican_Can_CyclicFrame per frame, which the application updates at any time. A periodic
+ * hardware event (GTM TOM/ATOM period, STM compare) triggers a DMA channel once per slot. The DMA runs a linked list
+ * with one transaction per frame due in the slot: it copies the image entry into MODATAL, MODATAH, MOAR and MOCTR of
+ * the transmit message object, the MOCTR value setting NEWDAT, MSGVAL and TXRQ. The send time only depends on the trigger
+ * and on the DMA latency, not on the task load.
+ *
+ * The schedule is a cycle of \ref IfxMultican_Can_CyclicConfig::slots slots. A frame is due in the slots where
+ * (slot % period) == offset: with a 10 ms trigger and 10 slots, periods of 1, 2 and 10 slots send the frames every
+ * 10, 20 and 100 ms. The offsets spread the frames of the same period over the slots, to limit the bus load peaks.
+ * The number of slots shall be a multiple of every period. The linked list needs one entry per due frame and slot,
+ * and one entry per empty slot: \ref IfxMultican_Can_Cyclic_getEntryCount().
+ *
+ * Restrictions:
+ * - each frame uses its own standard transmit message object, its ID and DLC are the ones of the message object
+ * configuration.
+ * - if a frame could not be sent before it is due again (bus busy or bus off), its payload is overwritten and the
+ * frame is sent once with the latest payload.
+ * - the DMA copies the two data words with two moves: a signal spread over both words may be sent half updated.
+ * - the image and the linked list are read by the DMA: they shall not be in a data cached segment, see
+ * IFX_DMA_BUFFER. The linked list entries shall be aligned on 32 bytes.
+ *
+ * \code
+ * // 10 ms slots, 10 slots: 100 ms cycle
+ * IFX_DMA_BUFFER IFX_ALIGN(16) IfxMultican_Can_CyclicFrame canCyclicImage[3];
+ * IFX_DMA_BUFFER IFX_ALIGN(32) Ifx_DMA_CH                  canCyclicEntries[16];
+ * IfxMultican_Can_Cyclic canCyclic;
+ *
+ * IfxMultican_Can_CyclicFrameConfig frames[3] = {
+ *     {&canTxMsgObj10ms,  1, 0},    // every 10 ms
+ *     {&canTxMsgObj20ms,  2, 1},    // every 20 ms, odd slots
+ *     {&canTxMsgObj100ms, 10, 4},   // every 100 ms, slot 4
+ * };
+ *
+ * IfxMultican_Can_CyclicConfig cyclicConfig;
+ * IfxMultican_Can_Cyclic_initConfig(&cyclicConfig);
+ * cyclicConfig.frames       = frames;
+ * cyclicConfig.frameCount   = 3;
+ * cyclicConfig.slots        = 10;
+ * cyclicConfig.image        = canCyclicImage;
+ * cyclicConfig.entries      = canCyclicEntries;
+ * cyclicConfig.entryCount   = 16;                 // >= IfxMultican_Can_Cyclic_getEntryCount(&cyclicConfig), 15 here
+ * cyclicConfig.dmaChannelId = IfxDma_ChannelId_21;
+ * cyclicConfig.trigger      = &SRC_GTMTOM00;      // TOM0 channel 0 period interrupt, 10 ms, no other use
+ * IfxMultican_Can_Cyclic_init(&canCyclic, &cyclicConfig);
+ * IfxMultican_Can_Cyclic_start(&canCyclic);
+ *
+ * // application: update the signals only
+ * IfxMultican_Can_Cyclic_setData(&canCyclic, 0, speed, torque);
+ * \endcode
+ *
  * \defgroup IfxLld_Multican_Can CAN
  * \ingroup IfxLld_Multican
  * \defgroup IfxLld_Multican_Can_Data_Structures Data structures
@@ -739,6 +871,10 @@
  * \ingroup IfxLld_Multican_Can
  * \defgroup IfxLld_Multican_Can_Interrupts Interrupts
  * \ingroup IfxLld_Multican_Can
+ * \defgroup IfxLld_Multican_Can_Capture_Functions Bus capture
+ * \ingroup IfxLld_Multican_Can
+ * \defgroup IfxLld_Multican_Can_Cyclic_Functions Cyclic transmission
+ * \ingroup IfxLld_Multican_Can
  */
 
 #ifndef IFXMULTICAN_CAN_H
@@ -751,6 +887,9 @@
 #include "Multican/Std/IfxMultican.h"
 #include "Scu/Std/IfxScuCcu.h"
 #include "IfxScu_regdef.h"
+#include "Cpu/Std/IfxCpu.h"
+#include "Dma/Dma/IfxDma_Dma.h"
+#include "Stm/Std/IfxStm.h"
 
 /******************************************************************************/
 /*-----------------------------Data Structures--------------------------------*/
@@ -898,6 +1037,100 @@ typedef struct
     IfxPort_PadDriver               pinDriver;
 } IfxMultican_Can_NodeConfig;
 
+/** \brief Captured frame, image of the message object registers MOFCR .. MOSTAT
+ */
+typedef struct
+{
+    uint32 fcr;             /**< \brief MOFCR: data length code in bits [27:24] */
+    uint32 timestamp;       /**< \brief Reception time in microseconds (STM based), set by IfxMultican_Can_Capture_getEntries() */
+    uint32 ipr;             /**< \brief MOIPR: frame counter value (bit times) in bits [31:16] */
+    uint32 amr;             /**< \brief MOAMR: acceptance mask, not used */
+    uint32 data[2];         /**< \brief MODATAL, MODATAH: data bytes 0 .. 7 */
+    uint32 ar;              /**< \brief MOAR: ID in bits [28:0], extended frame in bit [29] */
+    uint32 stat;            /**< \brief MOSTAT */
+} IfxMultican_Can_CaptureEntry;
+
+/** \brief Bus capture handle
+ */
+typedef struct
+{
+    Ifx_CAN_N                    *node;            /**< \brief Captured node */
+    volatile Ifx_SRC_SRCR        *src;             /**< \brief Service request of the receive interrupt */
+    Ifx_DMA                      *dma;             /**< \brief DMA module */
+    IfxDma_ChannelId              dmaChannelId;    /**< \brief DMA channel copying the message object */
+    Ifx_STM                      *stm;             /**< \brief STM used for the time stamps */
+    IfxMultican_Can_CaptureEntry *buffer;          /**< \brief Ring buffer */
+    uint32                        address;         /**< \brief Ring buffer global address */
+    uint32                        entries;         /**< \brief Number of ring entries, power of 2 */
+    uint32                        stmTicksPerUs;   /**< \brief STM ticks per microsecond */
+    uint32                        bitTimeNs;       /**< \brief Nominal bit time in nanoseconds */
+    uint32                        readPosition;    /**< \brief Total number of entries read */
+    uint32                        stampPosition;   /**< \brief Total number of entries with a time stamp */
+    volatile uint32               halfBuffers;     /**< \brief Number of half ring buffers written by the DMA */
+    uint32                        overruns;        /**< \brief Number of entries overwritten before they were read */
+    uint32                        lostFrames;      /**< \brief Number of DMA request lost events */
+} IfxMultican_Can_Capture;
+
+/** \brief Bus capture configuration
+ */
+typedef struct
+{
+    IfxMultican_Can_MsgObj       *msgObj;           /**< \brief Initialised standard receive message object, receive interrupt enabled */
+    IfxMultican_SrcId             srcId;            /**< \brief Service request node of the receive interrupt, routed to the DMA channel */
+    Ifx_DMA                      *dma;              /**< \brief DMA module */
+    IfxDma_ChannelId              dmaChannelId;     /**< \brief DMA channel */
+    Ifx_Priority                  dmaPriority;      /**< \brief DMA channel interrupt priority (half buffer counting) */
+    IfxSrc_Tos                    dmaTypeOfService; /**< \brief DMA channel interrupt type of service */
+    Ifx_STM                      *stm;              /**< \brief STM used for the time stamps */
+    IfxMultican_Can_CaptureEntry *buffer;           /**< \brief Ring buffer, aligned on its size */
+    uint32                        entries;          /**< \brief Number of ring entries, power of 2, 2 .. 1024 */
+    uint32                        baudrate;         /**< \brief Nominal baudrate of the node */
+} IfxMultican_Can_CaptureConfig;
+
+/** \brief Image of a cyclic frame, copied by the DMA into MODATAL .. MOCTR of its message object
+ */
+typedef struct
+{
+    uint32 data[2];         /**< \brief MODATAL, MODATAH: data bytes 0 .. 7, updated by the application */
+    uint32 ar;              /**< \brief MOAR: ID and priority of the message object, set by IfxMultican_Can_Cyclic_init() */
+    uint32 ctr;             /**< \brief MOCTR: sets NEWDAT, MSGVAL and TXRQ, set by IfxMultican_Can_Cyclic_init() */
+} IfxMultican_Can_CyclicFrame;
+
+/** \brief Schedule of a cyclic frame
+ */
+typedef struct
+{
+    IfxMultican_Can_MsgObj *msgObj;     /**< \brief Initialised standard transmit message object */
+    uint16                  period;     /**< \brief Period in slots, divides IfxMultican_Can_CyclicConfig::slots */
+    uint16                  offset;     /**< \brief First slot of the frame, lower than period */
+} IfxMultican_Can_CyclicFrameConfig;
+
+/** \brief Cyclic transmission handle
+ */
+typedef struct
+{
+    IfxDma_Dma_Channel           dmaChannel;    /**< \brief DMA channel running the schedule */
+    IfxMultican_Can_CyclicFrame *image;         /**< \brief Frame images */
+    Ifx_DMA_CH                  *entries;       /**< \brief Linked list entries */
+    uint16                       frameCount;    /**< \brief Number of frames */
+    uint32                       dummy;         /**< \brief Source and destination of the transaction of an empty slot */
+} IfxMultican_Can_Cyclic;
+
+/** \brief Cyclic transmission configuration
+ */
+typedef struct
+{
+    const IfxMultican_Can_CyclicFrameConfig *frames;        /**< \brief Schedules of the frames */
+    uint16                                   frameCount;    /**< \brief Number of frames */
+    uint16                                   slots;         /**< \brief Number of slots of the cycle */
+    IfxMultican_Can_CyclicFrame             *image;         /**< \brief Frame images, frameCount entries, not data cached */
+    Ifx_DMA_CH                              *entries;       /**< \brief Linked list entries, aligned on 32 bytes, not data cached */
+    uint16                                   entryCount;    /**< \brief Number of linked list entries, see IfxMultican_Can_Cyclic_getEntryCount() */
+    Ifx_DMA                                 *dma;           /**< \brief DMA module */
+    IfxDma_ChannelId                         dmaChannelId;  /**< \brief DMA channel */
+    volatile Ifx_SRC_SRCR                   *trigger;       /**< \brief Service request node of the periodic slot trigger, routed to the DMA channel */
+} IfxMultican_Can_CyclicConfig;
+
 /** \} */
 
 /** \addtogroup IfxLld_Multican_Can_General
@@ -1182,6 +1415,20 @@ IFX_EXTERN boolean IfxMultican_Can_MsgObj_isTxPending(IfxMultican_Can_MsgObj *ms
  */
 IFX_EXTERN IfxMultican_Status IfxMultican_Can_MsgObj_readMessage(IfxMultican_Can_MsgObj *msgObj, IfxMultican_Message *msg);
 
+/** \brief Read up to count received CAN messages in one call
+ *
+ * For a receive FIFO the slots are read in FIFO order starting at the current FIFO pointer, the function stops
+ * at the first slot without new data. For a standard message object at most one message is read.
+ * \param msgObj pointer to the CAN message object handle
+ * \param msgs array of at least count messages, filled in by the function with the received messages
+ * \param count maximal number of messages to read
+ * \return number of messages read
+ *
+ * A coding example can be found in \ref IfxLld_Multican_Can_Fifo_BulkRead
+ *
+ */
+IFX_EXTERN uint32 IfxMultican_Can_MsgObj_readMessages(IfxMultican_Can_MsgObj *msgObj, IfxMultican_Message *msgs, uint32 count);
+
 /** \brief Send a CAN message
  * \param msgObj pointer to the CAN message object handle
  * \param msg Specifies the msg to be send
@@ -1195,10 +1442,133 @@ IFX_EXTERN IfxMultican_Status IfxMultican_Can_MsgObj_sendMessage(IfxMultican_Can
 
 /** \} */
 
+/** \addtogroup IfxLld_Multican_Can_Capture_Functions
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Returns the next contiguous batch of captured entries and sets their time stamps
+ *
+ * When the consumer did not keep up, the overwritten entries are discarded and
+ * IfxMultican_Can_Capture::overruns is incremented by their number.
+ * \param capture pointer to the capture handle
+ * \param entries Returns the pointer to the first entry of the batch
+ * \return Number of entries in the batch, 0 if none
+ *
+ * A coding example can be found in \ref IfxLld_Multican_Can_Capture
+ *
+ */
+IFX_EXTERN uint32 IfxMultican_Can_Capture_getEntries(IfxMultican_Can_Capture *capture, IfxMultican_Can_CaptureEntry **entries);
+
+/** \brief Returns the total number of entries written by the DMA
+ * \param capture pointer to the capture handle
+ * \return Total number of entries written, modulo 2^32
+ */
+IFX_EXTERN uint32 IfxMultican_Can_Capture_getWritePosition(IfxMultican_Can_Capture *capture);
+
+/** \brief Initialises the capture and starts the DMA channel
+ * \param capture pointer to the capture handle
+ * \param config pointer to the capture configuration
+ * \return IfxMultican_Status_ok if the capture is started\n
+ * IfxMultican_Status_wrongParam if the buffer or the message object do not fulfil the requirements
+ *
+ * A coding example can be found in \ref IfxLld_Multican_Can_Capture
+ *
+ */
+IFX_EXTERN IfxMultican_Status IfxMultican_Can_Capture_init(IfxMultican_Can_Capture *capture, const IfxMultican_Can_CaptureConfig *config);
+
+/** \brief Fills the capture configuration with default values
+ * \param config pointer to the capture configuration
+ * \param msgObj pointer to the receive message object
+ */
+IFX_EXTERN void IfxMultican_Can_Capture_initConfig(IfxMultican_Can_CaptureConfig *config, IfxMultican_Can_MsgObj *msgObj);
+
+/** \brief DMA channel interrupt handler, counts the ring half buffers
+ * \param capture pointer to the capture handle
+ */
+IFX_EXTERN void IfxMultican_Can_Capture_isrDma(IfxMultican_Can_Capture *capture);
+
+/** \brief Returns entries to the ring
+ * \param capture pointer to the capture handle
+ * \param count number of entries, at most the count returned by IfxMultican_Can_Capture_getEntries()
+ */
+IFX_EXTERN void IfxMultican_Can_Capture_releaseEntries(IfxMultican_Can_Capture *capture, uint32 count);
+
+/** \brief Stops the capture
+ * \param capture pointer to the capture handle
+ */
+IFX_EXTERN void IfxMultican_Can_Capture_stop(IfxMultican_Can_Capture *capture);
+
+/** \} */
+
+/** \addtogroup IfxLld_Multican_Can_Cyclic_Functions
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Updates the payload of a cyclic frame, sent when the frame is due
+ * \param cyclic pointer to the cyclic transmission handle
+ * \param index index of the frame in IfxMultican_Can_CyclicConfig::frames
+ * \param dataLow data bytes 0 .. 3
+ * \param dataHigh data bytes 4 .. 7
+ */
+IFX_INLINE void IfxMultican_Can_Cyclic_setData(IfxMultican_Can_Cyclic *cyclic, uint16 index, uint32 dataLow, uint32 dataHigh);
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Returns the number of linked list entries needed by a schedule
+ * \param config pointer to the cyclic transmission configuration, frames, frameCount and slots are used
+ * \return Number of entries: the frames due in each slot, at least one per slot
+ */
+IFX_EXTERN uint32 IfxMultican_Can_Cyclic_getEntryCount(const IfxMultican_Can_CyclicConfig *config);
+
+/** \brief Initialises the frame images, the linked list and the DMA channel. The transmission is stopped
+ * \param cyclic pointer to the cyclic transmission handle
+ * \param config pointer to the cyclic transmission configuration
+ * \return IfxMultican_Status_ok if the schedule is initialised\n
+ * IfxMultican_Status_wrongParam if a period, an offset, a message object or the linked list do not fulfil the requirements
+ *
+ * A coding example can be found in \ref IfxLld_Multican_Can_Cyclic
+ *
+ */
+IFX_EXTERN IfxMultican_Status IfxMultican_Can_Cyclic_init(IfxMultican_Can_Cyclic *cyclic, const IfxMultican_Can_CyclicConfig *config);
+
+/** \brief Fills the cyclic transmission configuration with default values
+ * \param config pointer to the cyclic transmission configuration
+ */
+IFX_EXTERN void IfxMultican_Can_Cyclic_initConfig(IfxMultican_Can_CyclicConfig *config);
+
+/** \brief Starts the transmission at slot 0, with the next trigger
+ * \param cyclic pointer to the cyclic transmission handle
+ */
+IFX_EXTERN void IfxMultican_Can_Cyclic_start(IfxMultican_Can_Cyclic *cyclic);
+
+/** \brief Stops the transmission, the frames already requested are still sent
+ * \param cyclic pointer to the cyclic transmission handle
+ */
+IFX_EXTERN void IfxMultican_Can_Cyclic_stop(IfxMultican_Can_Cyclic *cyclic);
+
+/** \} */
+
 /******************************************************************************/
 /*---------------------Inline Function Implementations------------------------*/
 /******************************************************************************/
 
+IFX_INLINE void IfxMultican_Can_Cyclic_setData(IfxMultican_Can_Cyclic *cyclic, uint16 index, uint32 dataLow, uint32 dataHigh)
+{
+    IfxMultican_Can_CyclicFrame *frame = &cyclic->image[index];
+
+    frame->data[0] = dataLow;
+    frame->data[1] = dataHigh;
+}
+
+
 IFX_INLINE boolean IfxMultican_Can_MsgObj_cancelSend(IfxMultican_Can_MsgObj *msgObj)
 {
     Ifx_CAN_MO *hwObj = IfxMultican_MsgObj_getPointer(msgObj->node->mcan, msgObj->msgObjId);
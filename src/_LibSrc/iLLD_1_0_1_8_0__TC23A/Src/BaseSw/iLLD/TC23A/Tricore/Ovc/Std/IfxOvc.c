@@ -0,0 +1,147 @@
+/**
+ * \file IfxOvc.c
+ * \brief OVC  basic functionality
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "IfxOvc.h"
+#include "IfxOvc_bf.h"
+#include "IfxScu_bf.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Address bits compared by the overlay blocks: the segment bits are ignored
+ */
+#define IFXOVC_ADDRESS_MASK     (0x0FFFFFE0UL)
+
+/** \brief Overlay RAM page offset bits of RABR.OBASE
+ */
+#define IFXOVC_OVERLAY_MASK     (0x003FFFE0UL)
+
+/** \brief CPU select bits of SCU_OVCCON
+ */
+#define IFXOVC_OVCCON_CSEL_MASK (IFXOVC_CPU_MASK_ALL << IFX_SCU_OVCCON_CSEL0_OFF)
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+void IfxOvc_disable(uint32 cpuMask)
+{
+    IfxScuWdt_EndinitSession session;
+
+    cpuMask &= IFXOVC_CPU_MASK_ALL;
+
+    IfxScuWdt_beginEndinitSession(&session, IfxScuWdt_Endinit_both);
+    /* OVSTP disables all the blocks of the selected CPUs */
+    SCU_OVCCON.U     = ((cpuMask << IFX_SCU_OVCCON_CSEL0_OFF) & IFXOVC_OVCCON_CSEL_MASK)
+                       | (1U << IFX_SCU_OVCCON_OVSTP_OFF) | (1U << IFX_SCU_OVCCON_DCINVAL_OFF);
+    SCU_OVCENABLE.U &= ~cpuMask;
+    IfxScuWdt_endEndinitSession(&session);
+}
+
+
+void IfxOvc_enable(uint32 cpuMask)
+{
+    IfxScuWdt_EndinitSession session;
+
+    IfxScuWdt_beginEndinitSession(&session, IfxScuWdt_Endinit_both);
+    SCU_OVCENABLE.U |= cpuMask & IFXOVC_CPU_MASK_ALL;
+    IfxScuWdt_endEndinitSession(&session);
+}
+
+
+boolean IfxOvc_initBlock(uint32 block, const IfxOvc_BlockConfig *config, uint32 cpuMask)
+{
+    IfxScuWdt_EndinitSession session;
+    uint32                   size = config->size;
+    uint32                   cpu;
+
+    if ((block >= IFXOVC_NUM_BLOCKS)
+        || (size < IFXOVC_BLOCK_SIZE_MIN) || (size > IFXOVC_BLOCK_SIZE_MAX) || ((size & (size - 1)) != 0)
+        || ((config->targetAddress & (size - 1)) != 0) || ((config->overlayAddress & (size - 1)) != 0))
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+        return FALSE;
+    }
+
+    IfxScuWdt_beginEndinitSession(&session, IfxScuWdt_Endinit_both);
+
+    for (cpu = 0; cpu < IFXOVC_NUM_MODULES; cpu++)
+    {
+        if ((cpuMask & (1U << cpu)) != 0)
+        {
+            Ifx_OVC_BLK *blk = &IfxOvc_getAddress(cpu)->BLK[block];
+
+            /* the block is disabled (OVEN = 0) while it is configured */
+            blk->RABR.U  = (config->overlayAddress & IFXOVC_OVERLAY_MASK)
+                           | ((uint32)config->memory << IFX_OVC_BLK_RABR_OMEM_OFF);
+            blk->OTAR.U  = config->targetAddress & IFXOVC_ADDRESS_MASK;
+            blk->OMASK.U = ~(size - 1) & IFXOVC_ADDRESS_MASK;
+            IfxOvc_getAddress(cpu)->OSEL.U &= ~(1U << block);
+        }
+    }
+
+    IfxScuWdt_endEndinitSession(&session);
+
+    return TRUE;
+}
+
+
+void IfxOvc_switchPage(IfxOvc_Page page, uint32 blockMask, uint32 cpuMask)
+{
+    IfxScuWdt_EndinitSession session;
+    uint32                   cpu;
+
+    cpuMask &= IFXOVC_CPU_MASK_ALL;
+
+    IfxScuWdt_beginEndinitSession(&session, IfxScuWdt_Endinit_both);
+
+    /* prepare the new block enables in the shadow registers, the blocks are not affected yet */
+    for (cpu = 0; cpu < IFXOVC_NUM_MODULES; cpu++)
+    {
+        if ((cpuMask & (1U << cpu)) != 0)
+        {
+            Ifx_OVC *ovc = IfxOvc_getAddress(cpu);
+
+            if (page == IfxOvc_Page_working)
+            {
+                ovc->OSEL.U |= blockMask;
+            }
+            else
+            {
+                ovc->OSEL.U &= ~blockMask;
+            }
+        }
+    }
+
+    /* OVSTRT copies OSEL to the blocks of all the selected CPUs at the same time */
+    SCU_OVCCON.U = ((cpuMask << IFX_SCU_OVCCON_CSEL0_OFF) & IFXOVC_OVCCON_CSEL_MASK)
+                   | (1U << IFX_SCU_OVCCON_OVSTRT_OFF) | (1U << IFX_SCU_OVCCON_DCINVAL_OFF);
+
+    IfxScuWdt_endEndinitSession(&session);
+}
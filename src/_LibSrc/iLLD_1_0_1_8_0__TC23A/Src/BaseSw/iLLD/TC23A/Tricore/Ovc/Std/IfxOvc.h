@@ -0,0 +1,220 @@
+/**
+ * \file IfxOvc.h
+ * \brief OVC  basic functionality
+ * \ingroup IfxLld_Ovc
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * The overlay controller (OVC) of each CPU redirects the data accesses to a flash page (block) to a page of the
+ * same size in RAM (DSPR, LMU, EMEM or EBU). The calibration constants are read at their flash address, at RAM
+ * speed, without code change:
+ * - \ref IfxOvc_initBlock() configures the target flash page and the overlay RAM page of a block, for the selected
+ * CPUs. The overlay RAM page is initialised by the application, typically with a copy of the flash page.
+ * - \ref IfxOvc_enable() enables the overlay function of the selected CPUs.
+ * - \ref IfxOvc_switchPage() switches the selected blocks of the selected CPUs at the same time between the working
+ * page (overlay RAM) and the reference page (flash): the new block enables are written to the shadow registers,
+ * then activated by a single write to SCU_OVCCON, which also invalidates the data cache of the selected CPUs.
+ *
+ * Only the data accesses are redirected, the instruction fetches are not. The blocks of all CPUs which read the
+ * calibration data shall be configured with the same pages, the overlay RAM page is then shared, for example in
+ * the LMU or the EMEM.
+ *
+ * Usage example:
+ * \code
+ * // 8 KB calibration page at 0x80010000, working page in the LMU at 0xB0008000
+ * IfxOvc_BlockConfig blockConfig;
+ * blockConfig.targetAddress  = 0x80010000;
+ * blockConfig.overlayAddress = 0xB0008000;
+ * blockConfig.memory         = IfxOvc_Memory_lmu;
+ * blockConfig.size           = 0x2000;
+ *
+ * memcpy((void *)blockConfig.overlayAddress, (const void *)blockConfig.targetAddress, blockConfig.size);
+ * IfxOvc_initBlock(0, &blockConfig, IFXOVC_CPU_MASK_ALL);
+ * IfxOvc_enable(IFXOVC_CPU_MASK_ALL);
+ *
+ * // calibration session: all CPUs read the working page
+ * IfxOvc_switchPage(IfxOvc_Page_working, 1U << 0, IFXOVC_CPU_MASK_ALL);
+ *
+ * // back to the flash values
+ * IfxOvc_switchPage(IfxOvc_Page_reference, 1U << 0, IFXOVC_CPU_MASK_ALL);
+ * \endcode
+ *
+ * \defgroup IfxLld_Ovc_Std_Enumerations Enumerations
+ * \ingroup IfxLld_Ovc_Std
+ * \defgroup IfxLld_Ovc_Std_DataStructures Data Structures
+ * \ingroup IfxLld_Ovc_Std
+ * \defgroup IfxLld_Ovc_Std_Module Module Functions
+ * \ingroup IfxLld_Ovc_Std
+ */
+
+#ifndef IFXOVC_H
+#define IFXOVC_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "_Impl/IfxOvc_cfg.h"
+#include "Scu/Std/IfxScuWdt.h"
+#include "IfxScu_reg.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief CPU mask selecting all the CPUs, bit n for CPU n
+ */
+#define IFXOVC_CPU_MASK_ALL ((1U << IFXOVC_NUM_MODULES) - 1U)
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+
+/** \addtogroup IfxLld_Ovc_Std_Enumerations
+ * \{ */
+/** \brief Memory of the overlay RAM page, defined in MODULE_OVCx.BLK[i].RABR.B.OMEM
+ */
+typedef enum
+{
+    IfxOvc_Memory_dspr0 = 0,  /**< \brief Data scratch-pad RAM of CPU0 */
+    IfxOvc_Memory_lmu   = 4,  /**< \brief Local memory unit RAM */
+    IfxOvc_Memory_emem  = 6,  /**< \brief Emulation memory, on emulation devices */
+    IfxOvc_Memory_ebu   = 7   /**< \brief External memory on the EBU */
+} IfxOvc_Memory;
+
+/** \brief Calibration page read at the target flash address
+ */
+typedef enum
+{
+    IfxOvc_Page_reference = 0,  /**< \brief Flash page, overlay block disabled */
+    IfxOvc_Page_working   = 1   /**< \brief Overlay RAM page, overlay block enabled */
+} IfxOvc_Page;
+
+/** \} */
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+
+/** \addtogroup IfxLld_Ovc_Std_DataStructures
+ * \{ */
+/** \brief Overlay block configuration
+ */
+typedef struct
+{
+    uint32        targetAddress;   /**< \brief Address of the flash page, aligned on size */
+    uint32        overlayAddress;  /**< \brief Address of the overlay RAM page, aligned on size */
+    IfxOvc_Memory memory;          /**< \brief Memory of the overlay RAM page */
+    uint32        size;            /**< \brief Size of the pages in bytes, power of 2 from IFXOVC_BLOCK_SIZE_MIN to IFXOVC_BLOCK_SIZE_MAX */
+} IfxOvc_BlockConfig;
+
+/** \} */
+
+/** \addtogroup IfxLld_Ovc_Std_Module
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Returns the OVC module of a CPU
+ * \param cpu CPU index
+ * \return OVC module register address
+ */
+IFX_INLINE Ifx_OVC *IfxOvc_getAddress(uint32 cpu);
+
+/** \brief Returns the page currently read by a CPU through an overlay block
+ * \param cpu CPU index
+ * \param block Overlay block index
+ * \return Page read at the target flash address
+ */
+IFX_INLINE IfxOvc_Page IfxOvc_getPage(uint32 cpu, uint32 block);
+
+/** \brief Returns the overlay enable state of a CPU
+ * \param cpu CPU index
+ * \return TRUE if the overlay function of the CPU is enabled
+ */
+IFX_INLINE boolean IfxOvc_isEnabled(uint32 cpu);
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Disables the overlay function of the selected CPUs, all their blocks are switched to the reference page
+ * \param cpuMask CPU mask, bit n for CPU n
+ * \return None
+ */
+IFX_EXTERN void IfxOvc_disable(uint32 cpuMask);
+
+/** \brief Enables the overlay function of the selected CPUs
+ *
+ * The blocks keep their page, \ref IfxOvc_switchPage() selects the working page.
+ * \param cpuMask CPU mask, bit n for CPU n
+ * \return None
+ */
+IFX_EXTERN void IfxOvc_enable(uint32 cpuMask);
+
+/** \brief Configures an overlay block of the selected CPUs
+ *
+ * The block is switched to the reference page. The overlay RAM page shall be initialised before the block is
+ * switched to the working page.
+ * \param block Overlay block index, 0 to IFXOVC_NUM_BLOCKS - 1
+ * \param config Pointer to the block configuration
+ * \param cpuMask CPU mask, bit n for CPU n
+ * \return FALSE if the block index, the size or the alignment of the pages is invalid
+ */
+IFX_EXTERN boolean IfxOvc_initBlock(uint32 block, const IfxOvc_BlockConfig *config, uint32 cpuMask);
+
+/** \brief Switches overlay blocks of the selected CPUs at the same time between the working and the reference page
+ *
+ * The blocks which are not selected keep their page. The data cache of the selected CPUs is invalidated, so that
+ * no value of the previous page is read from the cache.
+ * \param page Page read at the target flash addresses after the switch
+ * \param blockMask Block mask, bit i for block i
+ * \param cpuMask CPU mask, bit n for CPU n
+ * \return None
+ */
+IFX_EXTERN void IfxOvc_switchPage(IfxOvc_Page page, uint32 blockMask, uint32 cpuMask);
+
+/** \} */
+
+/******************************************************************************/
+/*---------------------Inline Function Implementations------------------------*/
+/******************************************************************************/
+
+IFX_INLINE Ifx_OVC *IfxOvc_getAddress(uint32 cpu)
+{
+    return (Ifx_OVC *)IfxOvc_cfg_indexMap[cpu].module;
+}
+
+
+IFX_INLINE IfxOvc_Page IfxOvc_getPage(uint32 cpu, uint32 block)
+{
+    return (IfxOvc_Page)IfxOvc_getAddress(cpu)->BLK[block].RABR.B.OVEN;
+}
+
+
+IFX_INLINE boolean IfxOvc_isEnabled(uint32 cpu)
+{
+    return (SCU_OVCENABLE.U & (1U << cpu)) != 0;
+}
+
+
+#endif /* IFXOVC_H */
@@ -32,6 +32,43 @@
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
 
+boolean IfxPort_Io_initBus(IfxPort_Io_Bus *bus, const IfxPort_Pin *pins, uint8 count)
+{
+    IfxPort_Io_Group *group = NULL_PTR;
+    uint8             i;
+
+    bus->groupCount = 0;
+
+    for (i = 0; (i < count) && (i < 32); i++)
+    {
+        const IfxPort_Pin *pin = &pins[i];
+
+        if ((group != NULL_PTR) && (group->port == pin->port)
+            && (pin->pinIndex == (group->pinIndex + (i - group->bit))))
+        {
+            /* next pin of the group */
+            group->mask |= (uint16)(1u << pin->pinIndex);
+        }
+        else
+        {
+            if (bus->groupCount >= IFXPORT_IO_CFG_BUS_GROUPS)
+            {
+                return FALSE;
+            }
+
+            group           = &bus->group[bus->groupCount];
+            group->port     = pin->port;
+            group->mask     = (uint16)(1u << pin->pinIndex);
+            group->pinIndex = pin->pinIndex;
+            group->bit      = i;
+            bus->groupCount++;
+        }
+    }
+
+    return TRUE;
+}
+
+
 void IfxPort_Io_initModule(const IfxPort_Io_Config *config)
 {
     IfxPort_Io_ConfigPin *pinTable = (IfxPort_Io_ConfigPin *)&config->pinTable[0];
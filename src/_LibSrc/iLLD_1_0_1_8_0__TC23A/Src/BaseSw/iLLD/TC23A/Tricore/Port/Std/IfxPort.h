@@ -162,6 +162,24 @@ typedef struct
     IfxPort_PadDriver padDriver;
 } IfxPort_Pin_Config;
 
+/** \brief Emergency stop configuration of a group of pins, see IfxPort_configureEmergencyStop()
+ */
+typedef struct
+{
+    Ifx_P  *port;         /**< \brief Pointer to the port */
+    uint16  mask;         /**< \brief Pins configured, bit n for pin n */
+    boolean enable;       /**< \brief TRUE to enable the emergency stop function of the pins, FALSE to disable it */
+} IfxPort_EmergencyStopConfig;
+
+/** \brief Pin configuration entry of a table, see IfxPort_configureTable()
+ */
+typedef struct
+{
+    IfxPort_Pin       pin;             /**< \brief Pin */
+    IfxPort_Mode      mode;            /**< \brief Port pin mode */
+    IfxPort_PadDriver padDriver;       /**< \brief Pad driver mode */
+} IfxPort_TableEntry;
+
 /** \} */
 
 /** \addtogroup IfxLld_Port_Std_SinglePin
@@ -280,6 +298,55 @@ IFX_INLINE void IfxPort_togglePin(Ifx_P *port, uint8 pinIndex);
 /*-------------------------Global Function Prototypes-------------------------*/
 /******************************************************************************/
 
+/** \brief Enable or disable the emergency stop function of several pins of several ports.
+ * The ESR registers are written in one CPU ENDINIT session, instead of one per pin with IfxPort_enableEmergencyStop()
+ * and IfxPort_disableEmergencyStop(). A check is done on port functionality: the pins without emergency stop function
+ * are not modified.
+ * \param config Emergency stop configuration, one entry per group of pins
+ * \param count Number of entries in config
+ * \return Returns TRUE if all the pins have been configured; FALSE if some pins have no emergency stop function
+ *
+ * Coding example:
+ * \code
+ *     const IfxPort_EmergencyStopConfig esrConfig[] = {
+ *         {&MODULE_P02, 0x01FF, TRUE},
+ *         {&MODULE_P33, 0x000F, TRUE},
+ *     };
+ *
+ *     if( !IfxPort_configureEmergencyStop(esrConfig, 2) )
+ *     {
+ *         // some pins have no emergency stop function
+ *     }
+ * \endcode
+ *
+ * \see IfxPort_enableEmergencyStop(), IfxPort_disableEmergencyStop()
+ *
+ */
+IFX_EXTERN boolean IfxPort_configureEmergencyStop(const IfxPort_EmergencyStopConfig *config, uint8 count);
+
+/** \brief Configure the mode and the pad driver of a table of pins.
+ * The entries are merged per port: each IOCR and PDR register of a port is written once for all the consecutive
+ * entries of this port, instead of one read-modify-write per pin with IfxPort_setPinMode() and
+ * IfxPort_setPinPadDriver(). All the PDR registers are written in one CPU ENDINIT session.
+ * The table should be sorted by port: a port which appears in several runs of entries is written once per run.
+ * \param table Pin configuration table
+ * \param count Number of entries in the table
+ * \return None
+ *
+ * Coding example:
+ * \code
+ *     static const IfxPort_TableEntry boardPins[] = {
+ *         {{&MODULE_P33, 0}, IfxPort_Mode_outputPushPullGeneral, IfxPort_PadDriver_cmosAutomotiveSpeed1},
+ *         {{&MODULE_P33, 1}, IfxPort_Mode_outputPushPullGeneral, IfxPort_PadDriver_cmosAutomotiveSpeed1},
+ *         {{&MODULE_P33, 8}, IfxPort_Mode_inputPullUp,           IfxPort_PadDriver_cmosAutomotiveSpeed1},
+ *     };
+ *
+ *     IfxPort_configureTable(boardPins, sizeof(boardPins) / sizeof(boardPins[0]));
+ * \endcode
+ *
+ */
+IFX_EXTERN void IfxPort_configureTable(const IfxPort_TableEntry *table, uint32 count);
+
 /** \brief Disable the emergency stop function.
  * This function disables the emergency stop function. A check is done on port functionality.
  * \param port Pointer to the port which should be accessed.
@@ -91,6 +91,38 @@ SpiIf_Status IfxQspi_SpiSlave_exchange(IfxQspi_SpiSlave *handle, const void *src
 }
 
 
+uint32 IfxQspi_SpiSlave_getRingData(IfxQspi_SpiSlave *handle, void **data)
+{
+    IfxQspi_SpiSlave_Ring *ring      = &handle->ring;
+    uint32                 available = IfxQspi_SpiSlave_getRingWritePosition(handle) - ring->readPosition;
+    uint32                 offset;
+
+    if (available > ring->size)
+    {
+        /* the DMA has overwritten unread data: discard them */
+        ring->overruns++;
+        ring->readPosition += available;
+        available           = 0;
+    }
+
+    offset = ring->readPosition & (ring->size - 1);
+    *data  = &ring->buffer[offset];
+
+    return __min(available, ring->size - offset);
+}
+
+
+uint32 IfxQspi_SpiSlave_getRingWritePosition(IfxQspi_SpiSlave *handle)
+{
+    IfxQspi_SpiSlave_Ring *ring   = &handle->ring;
+    uint32                 base   = ring->halfBuffers * (ring->size / 2);
+    uint32                 offset = IfxDma_getChannelDestinationAddress(&MODULE_DMA, handle->dma.rxDmaChannelId) - ring->address;
+
+    /* the DMA may have completed a half buffer whose interrupt is still pending */
+    return base + ((offset - base) & (ring->size - 1));
+}
+
+
 SpiIf_Status IfxQspi_SpiSlave_getStatus(IfxQspi_SpiSlave *handle)
 {
     SpiIf_Status status = SpiIf_Status_ok;
@@ -145,6 +177,8 @@ void IfxQspi_SpiSlave_initModule(IfxQspi_SpiSlave *handle, const IfxQspi_SpiSlav
         globalcon1.B.RXFIFOINT = config->rxFifoThreshold;
         globalcon1.B.TXFM      = config->txFifoMode;
         globalcon1.B.RXFM      = config->rxFifoMode;
+        globalcon1.B.PT2       = IfxQspi_PhaseTransitionEvent_endOfFrame;
+        globalcon1.B.PT2EN     = (config->frameEndPriority > 0) ? 1U : 0U;
 
         qspiSFR->GLOBALCON1.U  = globalcon1.U;
     }
@@ -182,6 +216,8 @@ void IfxQspi_SpiSlave_initModule(IfxQspi_SpiSlave *handle, const IfxQspi_SpiSlav
     handle->txJob.data      = NULL_PTR;
     handle->txJob.remaining = 0;
     handle->onTransfer      = FALSE;
+    handle->ring.enabled    = FALSE;
+    handle->ring.onFrameEnd = NULL_PTR;
 
     /* Configure I/O pins for slave mode */
     const IfxQspi_SpiSlave_Pins *pins = config->pins;
@@ -323,6 +359,13 @@ void IfxQspi_SpiSlave_initModule(IfxQspi_SpiSlave *handle, const IfxQspi_SpiSlav
                 IfxSrc_enable(src);
             }
         }
+
+        if (config->frameEndPriority != 0)
+        {
+            volatile Ifx_SRC_SRCR *src = IfxQspi_getPhaseTransitionSrc(qspiSFR);
+            IfxSrc_init(src, config->base.isrProvider, config->frameEndPriority);
+            IfxSrc_enable(src);
+        }
     }
     /* finally switch to slave mode */
     qspiSFR->GLOBALCON.B.MS = IfxQspi_Mode_slave;
@@ -356,6 +399,7 @@ void IfxQspi_SpiSlave_initModuleConfig(IfxQspi_SpiSlave_Config *config, Ifx_QSPI
     config->dma.rxDmaChannelId         = IfxDma_ChannelId_none;
     config->dma.txDmaChannelId         = IfxDma_ChannelId_none;
     config->dma.useDma                 = FALSE;
+    config->frameEndPriority           = 0;
 }
 
 
@@ -366,7 +410,14 @@ void IfxQspi_SpiSlave_isrDmaReceive(IfxQspi_SpiSlave *qspiHandle)
 
     if (IfxDma_getAndClearChannelInterrupt(dmaSFR, rxDmaChannelId))
     {
-        qspiHandle->onTransfer = FALSE;
+        if (qspiHandle->ring.enabled != FALSE)
+        {
+            qspiHandle->ring.halfBuffers++;
+        }
+        else
+        {
+            qspiHandle->onTransfer = FALSE;
+        }
     }
 
     IfxDma_getAndClearChannelPatternDetectionInterrupt(dmaSFR, rxDmaChannelId);
@@ -437,12 +488,12 @@ void IfxQspi_SpiSlave_isrError(IfxQspi_SpiSlave *handle)
         handle->errorFlags.slsiMisplacedInactivation = 1;
     }
 
-    if (errorFlags)
+    if (errorFlags && (handle->ring.enabled == FALSE))
     {
         handle->onTransfer = FALSE;
     }
 
-    if (handle->dma.useDma)
+    if (handle->dma.useDma && (handle->ring.enabled == FALSE))
     {
         IfxDma_getAndClearChannelInterrupt(dmaSFR, handle->dma.rxDmaChannelId);
         IfxDma_getAndClearChannelInterrupt(dmaSFR, handle->dma.txDmaChannelId);
@@ -450,6 +501,25 @@ void IfxQspi_SpiSlave_isrError(IfxQspi_SpiSlave *handle)
 }
 
 
+void IfxQspi_SpiSlave_isrFrameEnd(IfxQspi_SpiSlave *handle)
+{
+    IfxQspi_SpiSlave_Ring *ring = &handle->ring;
+
+    handle->qspi->FLAGSCLEAR.B.PT2C = 1;
+
+    if (ring->enabled != FALSE)
+    {
+        ring->frameEnd = IfxQspi_SpiSlave_getRingWritePosition(handle);
+        ring->frames++;
+
+        if (ring->onFrameEnd != NULL_PTR)
+        {
+            ring->onFrameEnd(ring->callbackData, ring->frameEnd);
+        }
+    }
+}
+
+
 void IfxQspi_SpiSlave_isrReceive(IfxQspi_SpiSlave *handle)
 {
     IfxQspi_SpiSlave_read(handle);
@@ -507,6 +577,114 @@ IFX_STATIC void IfxQspi_SpiSlave_read(IfxQspi_SpiSlave *handle)
 }
 
 
+void IfxQspi_SpiSlave_releaseRingData(IfxQspi_SpiSlave *handle, uint32 count)
+{
+    handle->ring.readPosition += count;
+}
+
+
+void IfxQspi_SpiSlave_setFrameEndCallback(IfxQspi_SpiSlave *handle, IfxQspi_SpiSlave_FrameEndCallback callback, void *data)
+{
+    handle->ring.onFrameEnd   = callback;
+    handle->ring.callbackData = data;
+}
+
+
+boolean IfxQspi_SpiSlave_startRing(IfxQspi_SpiSlave *handle, void *buffer, uint32 size)
+{
+    Ifx_DMA               *dmaSFR         = &MODULE_DMA;
+    IfxDma_ChannelId       rxDmaChannelId = handle->dma.rxDmaChannelId;
+    IfxQspi_SpiSlave_Ring *ring           = &handle->ring;
+    IfxDma_ChannelMoveSize moveSize;
+    uint32                 moveBytes;
+    boolean                result;
+
+    if (handle->dataWidth <= 8)
+    {
+        moveSize  = IfxDma_ChannelMoveSize_8bit;
+        moveBytes = 1;
+    }
+    else if (handle->dataWidth <= 16)
+    {
+        moveSize  = IfxDma_ChannelMoveSize_16bit;
+        moveBytes = 2;
+    }
+    else
+    {
+        moveSize  = IfxDma_ChannelMoveSize_32bit;
+        moveBytes = 4;
+    }
+
+    /* DMA circular buffer: power of 2 up to 32 KiB, aligned on its size, one transaction (TREL <= 0x3FFF) per half buffer */
+    result = (handle->dma.useDma != FALSE)
+             && (handle->onTransfer == FALSE)
+             && (size >= (2 * moveBytes))
+             && (size <= 32768)
+             && ((size & (size - 1)) == 0)
+             && (((uint32)buffer & (size - 1)) == 0)
+             && ((size / 2 / moveBytes) <= 0x3FFF);
+
+    if (result == FALSE)
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+    }
+    else
+    {
+        boolean interruptState = IfxCpu_disableInterrupts();
+
+        handle->onTransfer = TRUE;
+        ring->buffer       = (uint8 *)buffer;
+        ring->address      = (uint32)IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), buffer);
+        ring->size         = size;
+        ring->readPosition = 0;
+        ring->halfBuffers  = 0;
+        ring->frameEnd     = 0;
+        ring->frames       = 0;
+        ring->overruns     = 0;
+
+        IfxDma_disableChannelTransaction(dmaSFR, rxDmaChannelId);
+        IfxDma_setChannelTransferCount(dmaSFR, rxDmaChannelId, size / 2 / moveBytes);
+        IfxDma_setChannelMoveSize(dmaSFR, rxDmaChannelId, moveSize);
+        IfxDma_setChannelDestinationAddress(dmaSFR, rxDmaChannelId, (void *)ring->address);
+        IfxDma_setChannelDestinationIncrementStep(dmaSFR, rxDmaChannelId, IfxDma_ChannelIncrementStep_1,
+            IfxDma_ChannelIncrementDirection_positive, IfxDma_getCircularRangeCode((uint16)size));
+        IfxDma_enableDestinationCircularBuffer(dmaSFR, rxDmaChannelId);
+        /* the channel stays enabled and reloads the transfer count after each half buffer */
+        IfxDma_setChannelContinuousMode(dmaSFR, rxDmaChannelId);
+
+        IfxQspi_clearAllEventFlags(handle->qspi);
+        IfxSrc_clearRequest(IfxQspi_getReceiveSrc(handle->qspi));
+        IfxDma_clearChannelInterrupt(dmaSFR, rxDmaChannelId);
+        ring->enabled = TRUE;
+        IfxDma_enableChannelTransaction(dmaSFR, rxDmaChannelId);
+
+        IfxCpu_restoreInterrupts(interruptState);
+    }
+
+    return result;
+}
+
+
+void IfxQspi_SpiSlave_stopRing(IfxQspi_SpiSlave *handle)
+{
+    Ifx_DMA         *dmaSFR         = &MODULE_DMA;
+    IfxDma_ChannelId rxDmaChannelId = handle->dma.rxDmaChannelId;
+    boolean          interruptState = IfxCpu_disableInterrupts();
+
+    if (handle->ring.enabled != FALSE)
+    {
+        IfxDma_disableChannelTransaction(dmaSFR, rxDmaChannelId);
+        IfxDma_setChannelSingleMode(dmaSFR, rxDmaChannelId);
+        dmaSFR->CH[rxDmaChannelId].ADICR.B.DCBE = FALSE;
+        IfxDma_clearChannelInterrupt(dmaSFR, rxDmaChannelId);
+        handle->ring.enabled = FALSE;
+        handle->onTransfer   = FALSE;
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+
 IFX_STATIC void IfxQspi_SpiSlave_write(IfxQspi_SpiSlave *handle)
 {
     SpiIf_Job *job = &handle->txJob;
@@ -521,6 +699,7 @@ IFX_STATIC void IfxQspi_SpiSlave_write(IfxQspi_SpiSlave *handle)
 
         IfxDma_ChannelId       txDmaChannelId = handle->dma.txDmaChannelId;
         IfxDma_ChannelId       rxDmaChannelId = handle->dma.rxDmaChannelId;
+        Ifx_SizeT              dataSize       = job->remaining * ((handle->dataWidth <= 8) ? 1 : ((handle->dataWidth <= 16) ? 2 : 4));
 
         boolean                interruptState = IfxCpu_disableInterrupts();
         IfxDma_setChannelTransferCount(dmaSFR, txDmaChannelId, job->remaining);
@@ -546,6 +725,7 @@ IFX_STATIC void IfxQspi_SpiSlave_write(IfxQspi_SpiSlave *handle)
         }
         else
         {
+            IfxCpu_flushDataCache(job->data, dataSize);
             IfxDma_setChannelSourceAddress(dmaSFR, txDmaChannelId, (void *)IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), job->data));
             IfxDma_setChannelSourceIncrementStep(dmaSFR, txDmaChannelId, IfxDma_ChannelIncrementStep_1,
                 IfxDma_ChannelIncrementDirection_positive, IfxDma_ChannelIncrementCircular_none);
@@ -577,6 +757,7 @@ IFX_STATIC void IfxQspi_SpiSlave_write(IfxQspi_SpiSlave *handle)
         }
         else
         {
+            IfxCpu_flushDataCache(jobrx->data, dataSize);
             IfxDma_setChannelDestinationAddress(dmaSFR, rxDmaChannelId, (void *)IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), jobrx->data));
             IfxDma_setChannelDestinationIncrementStep(dmaSFR, rxDmaChannelId, IfxDma_ChannelIncrementStep_1,
                 IfxDma_ChannelIncrementDirection_positive, IfxDma_ChannelIncrementCircular_none);
@@ -261,6 +261,37 @@
  *     IfxQspi_SpiSlave_exchange(&spi, NULL_PTR, &spiRxBuffer[i], SPI_BUFFER_SIZE);
  * \endcode
  *
+ * \section IfxLld_Qspi_SpiSlave_Ring Continuous reception with the DMA ring mode
+ *
+ * For continuous streams the receive DMA channel writes into a circular buffer without any CPU interaction,
+ * the buffer is read in place. The buffer size is a power of 2 (up to 32 KiB), the buffer is aligned on its size
+ * and located in a DSPR. Only the receive DMA channel is used, the receive DMA interrupt is raised every half buffer.
+ * The end of a frame (SLSI deassertion) is signalled with the phase transition interrupt when
+ * IfxQspi_SpiSlave_Config.frameEndPriority is set:
+ * \code
+ * IFX_ALIGN(4096) uint8 spiRing[4096];
+ *
+ * IFX_INTERRUPT(qspi2PtISR, 0, IFX_INTPRIO_QSPI2_PT)
+ * {
+ *     IfxQspi_SpiSlave_isrFrameEnd(&spi);
+ * }
+ *
+ *     IfxQspi_SpiSlave_startRing(&spi, spiRing, sizeof(spiRing));
+ *
+ *     // background: process the received data in place
+ *     uint8 *data;
+ *     uint32 count;
+ *
+ *     while ((count = IfxQspi_SpiSlave_getRingData(&spi, (void **)&data)) > 0)
+ *     {
+ *         processSamples(data, count);
+ *         IfxQspi_SpiSlave_releaseRingData(&spi, count);
+ *     }
+ * \endcode
+ *
+ * When the reader does not keep up, IfxQspi_SpiSlave_getRingData() discards the overwritten data and
+ * increments IfxQspi_SpiSlave_Ring.overruns.
+ *
  * \defgroup IfxLld_Qspi_SpiSlave SPI Slave Driver
  * \ingroup IfxLld_Qspi
  * \defgroup IfxLld_Qspi_SpiSlave_DataStructures Data Structures
@@ -360,6 +391,29 @@ typedef struct
 
 /** \addtogroup IfxLld_Qspi_SpiSlave_DataStructures
  * \{ */
+/** \brief Frame end callback
+ * \param data Callback data
+ * \param position Free running ring position (in bytes) of the frame end
+ */
+typedef void (*IfxQspi_SpiSlave_FrameEndCallback)(void *data, uint32 position);
+
+/** \brief Receive ring buffer (DMA ring mode)
+ */
+typedef struct
+{
+    uint8                            *buffer;             /**< \brief Ring buffer, aligned on its size */
+    uint32                            address;            /**< \brief Global address of the ring buffer */
+    uint32                            size;               /**< \brief Ring buffer size in bytes, power of 2 */
+    uint32                            readPosition;       /**< \brief Free running read position in bytes */
+    volatile uint32                   halfBuffers;        /**< \brief Number of half buffers filled by the DMA */
+    volatile uint32                   frameEnd;           /**< \brief Free running write position at the last frame end */
+    volatile uint32                   frames;             /**< \brief Number of frame ends (SLSI deassertions) */
+    uint32                            overruns;           /**< \brief Number of overruns detected by the reader */
+    IfxQspi_SpiSlave_FrameEndCallback onFrameEnd;         /**< \brief Called on frame end, NULL_PTR if none */
+    void                             *callbackData;       /**< \brief Frame end callback data */
+    boolean                           enabled;            /**< \brief TRUE while the ring mode is active */
+} IfxQspi_SpiSlave_Ring;
+
 /** \brief Module handle data structure
  */
 typedef struct
@@ -372,6 +426,7 @@ typedef struct
     boolean                     onTransfer;       /**< \brief set to TRUE during ongoing transfer */
     IfxQspi_SpiSlave_Dma        dma;              /**< \brief Dma handle */
     IfxQspi_SpiSlave_ErrorFlags errorFlags;       /**< \brief Spi Slave Error Flags */
+    IfxQspi_SpiSlave_Ring       ring;             /**< \brief Receive ring buffer */
 } IfxQspi_SpiSlave;
 
 /** \brief Module configuration structure
@@ -390,6 +445,7 @@ typedef struct
     IfxQspi_SpiSlave_DmaConfig       dma;                              /**< \brief Dma configuration */
     IfxQspi_FifoMode                 txFifoMode;                       /**< \brief Specifies the transfer FIFO mode. */
     IfxQspi_FifoMode                 rxFifoMode;                       /**< \brief Specifies the receive FIFO mode */
+    Ifx_Priority                     frameEndPriority;                 /**< \brief Frame end (SLSI deassertion) interrupt priority, 0 to disable */
 } IfxQspi_SpiSlave_Config;
 
 /** \} */
@@ -451,6 +507,54 @@ IFX_EXTERN SpiIf_Status IfxQspi_SpiSlave_exchange(IfxQspi_SpiSlave *handle, cons
  */
 IFX_EXTERN SpiIf_Status IfxQspi_SpiSlave_getStatus(IfxQspi_SpiSlave *handle);
 
+/** \brief Returns the received data of the ring buffer, which are contiguous in memory
+ * \param handle Module handle
+ * \param data Returns the pointer to the first unread data
+ * \return Number of contiguous bytes which can be read
+ *
+ * Usage example: see \ref IfxLld_Qspi_SpiSlave_Ring
+ *
+ */
+IFX_EXTERN uint32 IfxQspi_SpiSlave_getRingData(IfxQspi_SpiSlave *handle, void **data);
+
+/** \brief Returns the free running ring position (in bytes) of the data written by the DMA
+ * \param handle Module handle
+ * \return Ring write position
+ */
+IFX_EXTERN uint32 IfxQspi_SpiSlave_getRingWritePosition(IfxQspi_SpiSlave *handle);
+
+/** \brief Releases data read from the ring buffer
+ * \param handle Module handle
+ * \param count Number of bytes
+ * \return None
+ */
+IFX_EXTERN void IfxQspi_SpiSlave_releaseRingData(IfxQspi_SpiSlave *handle, uint32 count);
+
+/** \brief Sets the frame end callback of the ring mode
+ * \param handle Module handle
+ * \param callback Function called in the frame end interrupt, NULL_PTR if none
+ * \param data Callback data
+ * \return None
+ */
+IFX_EXTERN void IfxQspi_SpiSlave_setFrameEndCallback(IfxQspi_SpiSlave *handle, IfxQspi_SpiSlave_FrameEndCallback callback, void *data);
+
+/** \brief Starts the continuous reception into a DMA ring buffer. \ref IfxQspi_SpiSlave_exchange() is not available while the ring mode is active
+ * \param handle Module handle
+ * \param buffer Ring buffer, aligned on its size
+ * \param size Ring buffer size in bytes, power of 2 (up to 32768)
+ * \return TRUE if the ring mode is started, FALSE if the DMA is not used or the buffer is not valid
+ *
+ * Usage example: see \ref IfxLld_Qspi_SpiSlave_Ring
+ *
+ */
+IFX_EXTERN boolean IfxQspi_SpiSlave_startRing(IfxQspi_SpiSlave *handle, void *buffer, uint32 size);
+
+/** \brief Stops the DMA ring mode
+ * \param handle Module handle
+ * \return None
+ */
+IFX_EXTERN void IfxQspi_SpiSlave_stopRing(IfxQspi_SpiSlave *handle);
+
 /** \} */
 
 /** \addtogroup IfxLld_Qspi_SpiSlave_InterruptFunctions
@@ -478,6 +582,12 @@ IFX_EXTERN void IfxQspi_SpiSlave_isrDmaTransmit(IfxQspi_SpiSlave *qspiHandle);
  */
 IFX_EXTERN void IfxQspi_SpiSlave_isrError(IfxQspi_SpiSlave *handle);
 
+/** \brief Frame end (phase transition) interrupt handler
+ * \param handle Module handle
+ * \return None
+ */
+IFX_EXTERN void IfxQspi_SpiSlave_isrFrameEnd(IfxQspi_SpiSlave *handle);
+
 /** \brief Receive Interrupt handler
  * \param handle Module handle
  * \return None
@@ -90,6 +90,26 @@ IFX_CONST IfxScuCcu_ErayPllConfig IfxScuCcu_defaultErayPllConfig = {
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
 
+uint32 IfxScuCcu_calculateFlashWaitStates(float32 fsi2Freq, float32 fsiFreq)
+{
+    /* Cycles = access time * frequency, rounded up. The fields are programmed with cycles - 1 */
+    uint32 wsPFlash = (uint32)((fsi2Freq * IFXSCU_CFG_FLASH_PFLASH_ACCESS_TIME) + 0.999F);
+    uint32 wsEcPf   = (uint32)((fsi2Freq * IFXSCU_CFG_FLASH_PFLASH_ECC_TIME) + 0.999F);
+    uint32 wsDFlash = (uint32)((fsiFreq * IFXSCU_CFG_FLASH_DFLASH_ACCESS_TIME) + 0.999F);
+    uint32 wsEcDf   = (uint32)((fsiFreq * IFXSCU_CFG_FLASH_DFLASH_ECC_TIME) + 0.999F);
+
+    wsPFlash = __minu(__maxu(wsPFlash, 1) - 1, IFX_FLASH_FCON_WSPFLASH_MSK);
+    wsEcPf   = __minu(__maxu(wsEcPf, 1) - 1, IFX_FLASH_FCON_WSECPF_MSK);
+    wsDFlash = __minu(__maxu(wsDFlash, 1) - 1, IFX_FLASH_FCON_WSDFLASH_MSK);
+    wsEcDf   = __minu(__maxu(wsEcDf, 1) - 1, IFX_FLASH_FCON_WSECDF_MSK);
+
+    return (wsPFlash << IFX_FLASH_FCON_WSPFLASH_OFF) |
+           (wsEcPf << IFX_FLASH_FCON_WSECPF_OFF) |
+           (wsDFlash << IFX_FLASH_FCON_WSDFLASH_OFF) |
+           (wsEcDf << IFX_FLASH_FCON_WSECDF_OFF);
+}
+
+
 boolean IfxScuCcu_calculateSysPllDividers(IfxScuCcu_Config *cfg, uint32 fPll)
 {
     boolean retVal           = 0;
@@ -617,244 +637,14 @@ float32 IfxScuCcu_getSriFrequency(void)
 
 boolean IfxScuCcu_init(const IfxScuCcu_Config *cfg)
 {
-    uint8   smuTrapEnable;
-    uint16  endinit_pw, endinitSfty_pw;
-    boolean status = 0;
-    /* Store the crystal frequency */
-    IfxScuCcu_xtalFrequency = cfg->xtalFrequency;
-
-    endinit_pw              = IfxScuWdt_getCpuWatchdogPassword();
-    endinitSfty_pw          = IfxScuWdt_getSafetyWatchdogPassword();
-
-    {
-        /* Disable TRAP for SMU (oscillator watchdog and unlock detection) */
-        IfxScuWdt_clearCpuEndinit(endinit_pw);
-        smuTrapEnable      = SCU_TRAPDIS.B.SMUT;
-        SCU_TRAPDIS.B.SMUT = 1U;
-        IfxScuWdt_setCpuEndinit(endinit_pw);
-    }
+    IfxScuCcu_Ramp ramp;
+    boolean        status = IfxScuCcu_startInit(&ramp, cfg, IfxScuCcu_RampProfile_normal);
 
+    while (IfxScuCcu_processInit(&ramp) == FALSE)
     {
-        /* Select fback (fosc-evr) as CCU input clock */
-        IfxScuWdt_clearSafetyEndinit(endinitSfty_pw);
-
-        while (SCU_CCUCON0.B.LCK != 0U)
-        {
-            /*Wait till ccucon0 lock is set */
-            /*No "timeout" required, because if it hangs, Safety Endinit will give a trap */
-        }
-
-        SCU_CCUCON0.B.CLKSEL = 0; /*Select the EVR as fOSC for the clock distribution */
-        SCU_CCUCON0.B.UP     = 1; /*Update the ccucon0 register */
-
-        /* Disconnet PLL (SETFINDIS=1): oscillator clock is disconnected from PLL */
-        SCU_PLLCON0.B.SETFINDIS = 1;
-        /* Now PLL is in free running mode */
-
-        /* Select Clock Source as PLL input clock */
-        while (SCU_CCUCON0.B.LCK != 0U)
-        {
-            /*Wait till ccucon0 lock is set */
-            /*No "timeout" required, because if it hangs, Safety Endinit will give a trap */
-        }
-
-        SCU_CCUCON1.B.INSEL = 1; /*Select oscillator OSC0 as clock to PLL */
-        SCU_CCUCON1.B.UP    = 1; /*Update the ccucon0 register */
-
-        status             |= IfxScuCcu_isOscillatorStable();
-
-        IfxScuWdt_setSafetyEndinit(endinitSfty_pw);
-    }
-
-    if (status == 0)
-    {
-        /*Start the PLL configuration sequence */
-        uint8 pllStepsCount;
-
-        /*Setting up P N and K2 values equate pll to evr osc freq */
-        {
-            {
-                /*Set the K2 divider value for the step corresponding to step count */
-                IfxScuWdt_clearSafetyEndinit(endinitSfty_pw);
-
-                while (SCU_PLLSTAT.B.K2RDY == 0U)
-                {
-                    /*Wait until K2 divider is ready */
-                    /*No "timeout" required because Safety Endinit will give a trap */
-                }
-
-                SCU_PLLCON1.B.K2DIV = cfg->sysPll.pllInitialStep.k2Initial;
-
-                {
-                    /*change P and N divider values */
-                    SCU_PLLCON0.B.PDIV = cfg->sysPll.pllInitialStep.pDivider;
-                    SCU_PLLCON0.B.NDIV = cfg->sysPll.pllInitialStep.nDivider;
-
-                    /* Disable oscillator disconnect feature
-                     * in case of PLL unlock, PLL stays connected to fref */
-                    SCU_PLLCON0.B.OSCDISCDIS = 1;
-                    //                    workaround for Errata: PLL TC 005
-                    SCU_PLLCON0.B.PLLPWD     = 0; // set PLL to power down
-                    /* Connect PLL to fREF as oscillator clock is connected to PLL   */
-                    SCU_PLLCON0.B.CLRFINDIS  = 1;
-                    SCU_PLLCON0.B.PLLPWD     = 1; // set PLL to normal
-
-                    /* Restart PLL lock detection (RESLD = 1) */
-                    SCU_PLLCON0.B.RESLD = 1;
-
-                    IfxScuCcu_wait(0.000050F);  /*Wait for 50us */
-
-                    while (SCU_PLLSTAT.B.VCOLOCK == 0U)
-                    {
-                        /* Wait for PLL lock */
-                        /*No "timeout" required, because if it hangs, Safety Endinit will give a trap */
-                    }
-
-                    SCU_PLLCON0.B.VCOBYP = 0; /*VCO bypass disabled */
-
-                    while (SCU_CCUCON0.B.LCK != 0U)
-                    {
-                        /*Wait till ccucon registers can be written with new value */
-                        /*No "timeout" required, because if it hangs, Safety Endinit will give a trap */
-                    }
-
-                    SCU_CCUCON0.B.CLKSEL = 0x01;
-
-                    /*Configure the clock distribution */
-                    while (SCU_CCUCON0.B.LCK != 0U)
-                    {
-                        /*Wait till ccucon registers can be written with new value */
-                        /*No "timeout" required, because if it hangs, Safety Endinit will give a trap */
-                    }
-
-                    /*Wait until the initial clock configurations take in to effect for the PLL*/
-                    IfxScuCcu_wait(cfg->sysPll.pllInitialStep.waitTime); /*Wait for configured initial time */
-
-                    {                                                    /*Write CCUCON0 configuration */
-                        Ifx_SCU_CCUCON0 ccucon0;
-                        ccucon0.U        = SCU_CCUCON0.U & ~cfg->clockDistribution.ccucon0.mask;
-                        /*update with configured value */
-                        ccucon0.U       |= (cfg->clockDistribution.ccucon0.mask & cfg->clockDistribution.ccucon0.value);
-                        ccucon0.B.CLKSEL = 0x01;    /*  Select fpll as CCU input clock, even if this was not selected by configuration */
-                        ccucon0.B.UP     = 1;
-                        SCU_CCUCON0      = ccucon0; /*Set update bit explicitly to make above configurations effective */
-                    }
-
-                    while (SCU_CCUCON1.B.LCK != 0U)
-                    {
-                        /*Wait till ccucon registers can be written with new value */
-                        /*No "timeout" required, because if it hangs, Safety Endinit will give a trap */
-                    }
-
-                    {
-                        /*Write CCUCON1 configuration */
-                        Ifx_SCU_CCUCON1 ccucon1;
-                        ccucon1.U       = SCU_CCUCON1.U & ~cfg->clockDistribution.ccucon1.mask;
-                        /*update with configured value */
-                        ccucon1.U      |= (cfg->clockDistribution.ccucon1.mask & cfg->clockDistribution.ccucon1.value);
-                        ccucon1.B.INSEL = 1;
-                        ccucon1.B.UP    = 1;
-                        SCU_CCUCON1     = ccucon1;
-                    }
-
-                    while (SCU_CCUCON2.B.LCK != 0U)
-                    {
-                        /*Wait till ccucon registers can be written with new value */
-                        /*No "timeout" required, because if it hangs, Safety Endinit will give a trap */
-                    }
-
-                    {
-                        /*Write CCUCON2 configuration */
-                        Ifx_SCU_CCUCON2 ccucon2;
-                        ccucon2.U    = SCU_CCUCON2.U & ~cfg->clockDistribution.ccucon2.mask;
-                        /*update with configured value */
-                        ccucon2.U   |= (cfg->clockDistribution.ccucon2.mask & cfg->clockDistribution.ccucon2.value);
-                        ccucon2.B.UP = 1;
-                        SCU_CCUCON2  = ccucon2;
-                    }
-
-                    while (SCU_CCUCON5.B.LCK != 0U)
-                    {           /*Wait till ccucon registers can be written with new value */
-                        /*No "timeout" required, because if it hangs, Safety Endinit will give a trap */
-                    }
-
-                    {           /*Write CCUCON5 configuration */
-                        Ifx_SCU_CCUCON5 ccucon5;
-                        ccucon5.U    = SCU_CCUCON5.U & ~cfg->clockDistribution.ccucon5.mask;
-                        /*update with configured value */
-                        ccucon5.U   |= (cfg->clockDistribution.ccucon5.mask & cfg->clockDistribution.ccucon5.value);
-                        ccucon5.B.UP = 1;
-                        SCU_CCUCON5  = ccucon5;
-                    }
-
-                    {           /*Write CCUCON6 configuration */
-                        Ifx_SCU_CCUCON6 ccucon6;
-                        ccucon6.U   = SCU_CCUCON6.U & ~cfg->clockDistribution.ccucon6.mask;
-                        /*update with configured value */
-                        ccucon6.U  |= (cfg->clockDistribution.ccucon6.mask & cfg->clockDistribution.ccucon6.value);
-                        SCU_CCUCON6 = ccucon6;
-                    }
-                }
-
-                IfxScuWdt_setSafetyEndinit(endinitSfty_pw);
-            }
-        }
-
-        {           /*Write Flash waitstate configuration */
-            Ifx_FLASH_FCON fcon;
-            fcon.U = FLASH0_FCON.U & ~cfg->flashFconWaitStateConfig.mask;
-
-            /*update with configured value */
-            fcon.U &= ~cfg->flashFconWaitStateConfig.mask;
-            fcon.U |= (cfg->flashFconWaitStateConfig.mask & cfg->flashFconWaitStateConfig.value);
-            {
-                IfxScuWdt_clearCpuEndinit(endinit_pw);
-                FLASH0_FCON = fcon;
-                IfxScuWdt_setCpuEndinit(endinit_pw);
-            }
-        }
-
-        /*Start Pll ramp up sequence */
-        for (pllStepsCount = 0; pllStepsCount < cfg->sysPll.numOfPllDividerSteps; pllStepsCount++)
-        {                       /*iterate through number of pll steps */
-            {
-                IfxScuWdt_clearSafetyEndinit(endinitSfty_pw);
-
-                /*Configure K2 divider */
-                while (SCU_PLLSTAT.B.K2RDY == 0U)
-                {
-                    /*Wait until K2 divider is ready */
-                    /*No "timeout" required, because if it hangs, Safety Endinit will give a trap */
-                }
-
-                /*Now set the K2 divider value for the step corresponding to step count */
-                SCU_PLLCON1.B.K2DIV = cfg->sysPll.pllDividerStep[pllStepsCount].k2Step;
-                IfxScuWdt_setSafetyEndinit(endinitSfty_pw);
-            }
-
-            /*call the hook function if configured */
-            if (cfg->sysPll.pllDividerStep[pllStepsCount].hookFunction != (IfxScuCcu_PllStepsFunctionHook)0)
-            {
-                cfg->sysPll.pllDividerStep[pllStepsCount].hookFunction();
-            }
-
-            /*Wait for waitCounter corresponding to the pll step */
-            IfxScuCcu_wait(cfg->sysPll.pllDividerStep[pllStepsCount].waitTime);
-        }
+        /* Wait for the PLL ramp up sequence */
     }
 
-    {                           /* Enable oscillator disconnect feature */
-        IfxScuWdt_clearSafetyEndinit(endinitSfty_pw);
-        SCU_PLLCON0.B.OSCDISCDIS = 0U;
-        IfxScuWdt_setSafetyEndinit(endinitSfty_pw);
-    }
-    {
-        /* Enable VCO unlock Trap if it was disabled before */
-        IfxScuWdt_clearCpuEndinit(endinit_pw);
-        SCU_TRAPCLR.B.SMUT = 1U;
-        SCU_TRAPDIS.B.SMUT = smuTrapEnable;
-        IfxScuWdt_setCpuEndinit(endinit_pw);
-    }
     return status;
 }
 
@@ -1015,6 +805,79 @@ IFX_STATIC boolean IfxScuCcu_isOscillatorStable(void)
 }
 
 
+boolean IfxScuCcu_processInit(IfxScuCcu_Ramp *ramp)
+{
+    const IfxScuCcu_Config *cfg = ramp->cfg;
+    uint16                  endinit_pw, endinitSfty_pw;
+
+    if ((ramp->done != FALSE) || ((uint32)(STM0_TIM0.U - ramp->stmCountBegin) < ramp->stmCount))
+    {
+        /* Completed, or wait time of the current step not elapsed */
+        return ramp->done;
+    }
+
+    endinit_pw     = IfxScuWdt_getCpuWatchdogPassword();
+    endinitSfty_pw = IfxScuWdt_getSafetyWatchdogPassword();
+
+    if (ramp->step < cfg->sysPll.numOfPllDividerSteps)
+    {
+        const IfxScuCcu_PllStepsConfig *pllStep  = &cfg->sysPll.pllDividerStep[ramp->step];
+        float32                         waitTime = pllStep->waitTime;
+
+        {
+            IfxScuWdt_clearSafetyEndinit(endinitSfty_pw);
+
+            /*Configure K2 divider */
+            while (SCU_PLLSTAT.B.K2RDY == 0U)
+            {
+                /*Wait until K2 divider is ready */
+                /*No "timeout" required, because if it hangs, Safety Endinit will give a trap */
+            }
+
+            /*Now set the K2 divider value for the step corresponding to step count */
+            SCU_PLLCON1.B.K2DIV = pllStep->k2Step;
+            IfxScuWdt_setSafetyEndinit(endinitSfty_pw);
+        }
+
+        /*call the hook function if configured */
+        if (pllStep->hookFunction != (IfxScuCcu_PllStepsFunctionHook)0)
+        {
+            pllStep->hookFunction();
+        }
+
+        ramp->step++;
+
+        if ((ramp->profile == IfxScuCcu_RampProfile_fast) && (ramp->step < cfg->sysPll.numOfPllDividerSteps))
+        {
+            /* Intermediate step */
+            waitTime = waitTime * IFX_CFG_SCUCCU_FAST_RAMP_SCALE;
+        }
+
+        /*Start the wait corresponding to the pll step, with the STM frequency of this step */
+        ramp->stmCountBegin = STM0_TIM0.U;
+        ramp->stmCount      = (uint32)(IfxScuCcu_getStmFrequency() * waitTime);
+    }
+    else
+    {
+        {                       /* Enable oscillator disconnect feature */
+            IfxScuWdt_clearSafetyEndinit(endinitSfty_pw);
+            SCU_PLLCON0.B.OSCDISCDIS = 0U;
+            IfxScuWdt_setSafetyEndinit(endinitSfty_pw);
+        }
+        {
+            /* Enable VCO unlock Trap if it was disabled before */
+            IfxScuWdt_clearCpuEndinit(endinit_pw);
+            SCU_TRAPCLR.B.SMUT = 1U;
+            SCU_TRAPDIS.B.SMUT = ramp->smuTrapEnable;
+            IfxScuWdt_setCpuEndinit(endinit_pw);
+        }
+        ramp->done = TRUE;
+    }
+
+    return ramp->done;
+}
+
+
 float32 IfxScuCcu_setCpuFrequency(IfxCpu_ResourceCpu cpu, float32 cpuFreq)
 {
     uint16  endinitSfty_pw;
@@ -1059,6 +922,19 @@ float32 IfxScuCcu_setCpuFrequency(IfxCpu_ResourceCpu cpu, float32 cpuFreq)
 }
 
 
+void IfxScuCcu_setFlashWaitStates(float32 fsi2Freq, float32 fsiFreq)
+{
+    uint16         endinit_pw = IfxScuWdt_getCpuWatchdogPassword();
+    Ifx_FLASH_FCON fcon;
+
+    fcon.U = (FLASH0_FCON.U & ~IFXSCU_CFG_FLASH_WAITSTATE_MSK) | IfxScuCcu_calculateFlashWaitStates(fsi2Freq, fsiFreq);
+
+    IfxScuWdt_clearCpuEndinit(endinit_pw);
+    FLASH0_FCON = fcon;
+    IfxScuWdt_setCpuEndinit(endinit_pw);
+}
+
+
 float32 IfxScuCcu_setGtmFrequency(float32 gtmFreq)
 {
     uint16          l_SEndInitPW;
@@ -1111,11 +987,10 @@ float32 IfxScuCcu_setPll2Frequency(float32 pll2Freq)
 float32 IfxScuCcu_setSpbFrequency(float32 spbFreq)
 {
     /* TODO: check whether it is necessary to disable trap and/or the safety */
-    uint16          l_EndInitPW;
-    uint16          l_SEndInitPW;
-    Ifx_SCU_CCUCON0 ccucon0;
-    float32         inputFreq = IfxScuCcu_getSourceFrequency();
-    uint32          spbDiv    = (uint32)(inputFreq / spbFreq);
+    IfxScuWdt_EndinitSession session;
+    Ifx_SCU_CCUCON0          ccucon0;
+    float32                  inputFreq = IfxScuCcu_getSourceFrequency();
+    uint32                   spbDiv    = (uint32)(inputFreq / spbFreq);
     spbDiv = __maxu(spbDiv, 2);
 
     if ((spbDiv >= 7) && (spbDiv < 14) && ((spbDiv & 1) == 1))
@@ -1128,14 +1003,9 @@ float32 IfxScuCcu_setSpbFrequency(float32 spbFreq)
         spbDiv = 12;
     }
 
-    l_EndInitPW  = IfxScuWdt_getCpuWatchdogPassword();
-    l_SEndInitPW = IfxScuWdt_getSafetyWatchdogPassword();
-
-    IfxScuWdt_clearCpuEndinit(l_EndInitPW);
+    /* Trap disable, divider update and trap enable in one ENDINIT session */
+    IfxScuWdt_beginEndinitSession(&session, IfxScuWdt_Endinit_both);
     SCU_TRAPDIS.U = SCU_TRAPDIS.U | 0x3E0U;
-    IfxScuWdt_setCpuEndinit(l_EndInitPW);
-
-    IfxScuWdt_clearSafetyEndinit(l_SEndInitPW);
 
     while (SCU_CCUCON0.B.LCK != 0U)
     {}
@@ -1144,11 +1014,9 @@ float32 IfxScuCcu_setSpbFrequency(float32 spbFreq)
     ccucon0.B.SPBDIV = spbDiv;
     ccucon0.B.UP     = 1;
     SCU_CCUCON0.U    = ccucon0.U;
-    IfxScuWdt_setSafetyEndinit(l_SEndInitPW);
 
-    IfxScuWdt_clearCpuEndinit(l_EndInitPW);
-    SCU_TRAPDIS.U = SCU_TRAPDIS.U & (uint32)~0x3E0UL;
-    IfxScuWdt_setCpuEndinit(l_EndInitPW);
+    SCU_TRAPDIS.U    = SCU_TRAPDIS.U & (uint32)~0x3E0UL;
+    IfxScuWdt_endEndinitSession(&session);
 
     while (SCU_CCUCON0.B.LCK != 0U)
     {}
@@ -1176,6 +1044,12 @@ float32 IfxScuCcu_setSriFrequency(float32 sriFreq)
         sriDiv = 12;
     }
 
+    if ((source / sriDiv) > IfxScuCcu_getSriFrequency())
+    {
+        /* Frequency increase: wait states for the new fSRI before the change (fFSI2 and fFSI do not exceed fSRI) */
+        IfxScuCcu_setFlashWaitStates(source / sriDiv, source / sriDiv);
+    }
+
     l_SEndInitPW = IfxScuWdt_getSafetyWatchdogPassword();
     IfxScuWdt_clearSafetyEndinit(l_SEndInitPW);
 
@@ -1192,14 +1066,232 @@ float32 IfxScuCcu_setSriFrequency(float32 sriFreq)
     while (SCU_CCUCON0.B.LCK != 0U)
     {}
 
+    /* Minimum wait states for the new frequencies */
+    IfxScuCcu_setFlashWaitStates(IfxScuCcu_getFsi2Frequency(), IfxScuCcu_getFsiFrequency());
+
     freq = IfxScuCcu_getSriFrequency();
     return freq;
 }
 
 
+boolean IfxScuCcu_startInit(IfxScuCcu_Ramp *ramp, const IfxScuCcu_Config *cfg, IfxScuCcu_RampProfile profile)
+{
+    uint8   smuTrapEnable;
+    uint16  endinit_pw, endinitSfty_pw;
+    boolean status = 0;
+    /* Store the crystal frequency */
+    IfxScuCcu_xtalFrequency = cfg->xtalFrequency;
+
+    endinit_pw              = IfxScuWdt_getCpuWatchdogPassword();
+    endinitSfty_pw          = IfxScuWdt_getSafetyWatchdogPassword();
+
+    {
+        /* Disable TRAP for SMU and select fback as CCU input clock in one ENDINIT session */
+        IfxScuWdt_EndinitSession session;
+        IfxScuWdt_beginEndinitSession(&session, IfxScuWdt_Endinit_both);
+
+        /* Disable TRAP for SMU (oscillator watchdog and unlock detection) */
+        smuTrapEnable      = SCU_TRAPDIS.B.SMUT;
+        SCU_TRAPDIS.B.SMUT = 1U;
+
+        /* Select fback (fosc-evr) as CCU input clock */
+        while (SCU_CCUCON0.B.LCK != 0U)
+        {
+            /*Wait till ccucon0 lock is set */
+            /*No "timeout" required, because if it hangs, Safety Endinit will give a trap */
+        }
+
+        SCU_CCUCON0.B.CLKSEL = 0; /*Select the EVR as fOSC for the clock distribution */
+        SCU_CCUCON0.B.UP     = 1; /*Update the ccucon0 register */
+
+        /* Disconnet PLL (SETFINDIS=1): oscillator clock is disconnected from PLL */
+        SCU_PLLCON0.B.SETFINDIS = 1;
+        /* Now PLL is in free running mode */
+
+        /* Select Clock Source as PLL input clock */
+        while (SCU_CCUCON0.B.LCK != 0U)
+        {
+            /*Wait till ccucon0 lock is set */
+            /*No "timeout" required, because if it hangs, Safety Endinit will give a trap */
+        }
+
+        SCU_CCUCON1.B.INSEL = 1; /*Select oscillator OSC0 as clock to PLL */
+        SCU_CCUCON1.B.UP    = 1; /*Update the ccucon0 register */
+
+        status             |= IfxScuCcu_isOscillatorStable();
+
+        IfxScuWdt_endEndinitSession(&session);
+    }
+
+    if (status == 0)
+    {
+        /*Start the PLL configuration sequence */
+        /*Setting up P N and K2 values equate pll to evr osc freq */
+        {
+            {
+                /*Set the K2 divider value for the step corresponding to step count */
+                IfxScuWdt_clearSafetyEndinit(endinitSfty_pw);
+
+                while (SCU_PLLSTAT.B.K2RDY == 0U)
+                {
+                    /*Wait until K2 divider is ready */
+                    /*No "timeout" required because Safety Endinit will give a trap */
+                }
+
+                SCU_PLLCON1.B.K2DIV = cfg->sysPll.pllInitialStep.k2Initial;
+
+                {
+                    /*change P and N divider values */
+                    SCU_PLLCON0.B.PDIV = cfg->sysPll.pllInitialStep.pDivider;
+                    SCU_PLLCON0.B.NDIV = cfg->sysPll.pllInitialStep.nDivider;
+
+                    /* Disable oscillator disconnect feature
+                     * in case of PLL unlock, PLL stays connected to fref */
+                    SCU_PLLCON0.B.OSCDISCDIS = 1;
+                    //                    workaround for Errata: PLL TC 005
+                    SCU_PLLCON0.B.PLLPWD     = 0; // set PLL to power down
+                    /* Connect PLL to fREF as oscillator clock is connected to PLL   */
+                    SCU_PLLCON0.B.CLRFINDIS  = 1;
+                    SCU_PLLCON0.B.PLLPWD     = 1; // set PLL to normal
+
+                    /* Restart PLL lock detection (RESLD = 1) */
+                    SCU_PLLCON0.B.RESLD = 1;
+
+                    IfxScuCcu_wait(0.000050F);  /*Wait for 50us */
+
+                    while (SCU_PLLSTAT.B.VCOLOCK == 0U)
+                    {
+                        /* Wait for PLL lock */
+                        /*No "timeout" required, because if it hangs, Safety Endinit will give a trap */
+                    }
+
+                    SCU_PLLCON0.B.VCOBYP = 0; /*VCO bypass disabled */
+
+                    while (SCU_CCUCON0.B.LCK != 0U)
+                    {
+                        /*Wait till ccucon registers can be written with new value */
+                        /*No "timeout" required, because if it hangs, Safety Endinit will give a trap */
+                    }
+
+                    SCU_CCUCON0.B.CLKSEL = 0x01;
+
+                    /*Configure the clock distribution */
+                    while (SCU_CCUCON0.B.LCK != 0U)
+                    {
+                        /*Wait till ccucon registers can be written with new value */
+                        /*No "timeout" required, because if it hangs, Safety Endinit will give a trap */
+                    }
+
+                    /*Wait until the initial clock configurations take in to effect for the PLL*/
+                    IfxScuCcu_wait(cfg->sysPll.pllInitialStep.waitTime); /*Wait for configured initial time */
+
+                    {                                                    /*Write CCUCON0 configuration */
+                        Ifx_SCU_CCUCON0 ccucon0;
+                        ccucon0.U        = SCU_CCUCON0.U & ~cfg->clockDistribution.ccucon0.mask;
+                        /*update with configured value */
+                        ccucon0.U       |= (cfg->clockDistribution.ccucon0.mask & cfg->clockDistribution.ccucon0.value);
+                        ccucon0.B.CLKSEL = 0x01;    /*  Select fpll as CCU input clock, even if this was not selected by configuration */
+                        ccucon0.B.UP     = 1;
+                        SCU_CCUCON0      = ccucon0; /*Set update bit explicitly to make above configurations effective */
+                    }
+
+                    while (SCU_CCUCON1.B.LCK != 0U)
+                    {
+                        /*Wait till ccucon registers can be written with new value */
+                        /*No "timeout" required, because if it hangs, Safety Endinit will give a trap */
+                    }
+
+                    {
+                        /*Write CCUCON1 configuration */
+                        Ifx_SCU_CCUCON1 ccucon1;
+                        ccucon1.U       = SCU_CCUCON1.U & ~cfg->clockDistribution.ccucon1.mask;
+                        /*update with configured value */
+                        ccucon1.U      |= (cfg->clockDistribution.ccucon1.mask & cfg->clockDistribution.ccucon1.value);
+                        ccucon1.B.INSEL = 1;
+                        ccucon1.B.UP    = 1;
+                        SCU_CCUCON1     = ccucon1;
+                    }
+
+                    while (SCU_CCUCON2.B.LCK != 0U)
+                    {
+                        /*Wait till ccucon registers can be written with new value */
+                        /*No "timeout" required, because if it hangs, Safety Endinit will give a trap */
+                    }
+
+                    {
+                        /*Write CCUCON2 configuration */
+                        Ifx_SCU_CCUCON2 ccucon2;
+                        ccucon2.U    = SCU_CCUCON2.U & ~cfg->clockDistribution.ccucon2.mask;
+                        /*update with configured value */
+                        ccucon2.U   |= (cfg->clockDistribution.ccucon2.mask & cfg->clockDistribution.ccucon2.value);
+                        ccucon2.B.UP = 1;
+                        SCU_CCUCON2  = ccucon2;
+                    }
+
+                    while (SCU_CCUCON5.B.LCK != 0U)
+                    {           /*Wait till ccucon registers can be written with new value */
+                        /*No "timeout" required, because if it hangs, Safety Endinit will give a trap */
+                    }
+
+                    {           /*Write CCUCON5 configuration */
+                        Ifx_SCU_CCUCON5 ccucon5;
+                        ccucon5.U    = SCU_CCUCON5.U & ~cfg->clockDistribution.ccucon5.mask;
+                        /*update with configured value */
+                        ccucon5.U   |= (cfg->clockDistribution.ccucon5.mask & cfg->clockDistribution.ccucon5.value);
+                        ccucon5.B.UP = 1;
+                        SCU_CCUCON5  = ccucon5;
+                    }
+
+                    {           /*Write CCUCON6 configuration */
+                        Ifx_SCU_CCUCON6 ccucon6;
+                        ccucon6.U   = SCU_CCUCON6.U & ~cfg->clockDistribution.ccucon6.mask;
+                        /*update with configured value */
+                        ccucon6.U  |= (cfg->clockDistribution.ccucon6.mask & cfg->clockDistribution.ccucon6.value);
+                        SCU_CCUCON6 = ccucon6;
+                    }
+                }
+
+                IfxScuWdt_setSafetyEndinit(endinitSfty_pw);
+            }
+        }
+
+        {           /*Write Flash waitstate configuration */
+            Ifx_FLASH_FCON fcon;
+            fcon.U = FLASH0_FCON.U & ~cfg->flashFconWaitStateConfig.mask;
+
+            /*update with configured value */
+            fcon.U &= ~cfg->flashFconWaitStateConfig.mask;
+            fcon.U |= (cfg->flashFconWaitStateConfig.mask & cfg->flashFconWaitStateConfig.value);
+            {
+                IfxScuWdt_clearCpuEndinit(endinit_pw);
+                FLASH0_FCON = fcon;
+                IfxScuWdt_setCpuEndinit(endinit_pw);
+            }
+        }
+    }
+
+    ramp->cfg           = cfg;
+    ramp->profile       = profile;
+    ramp->step          = 0;
+    ramp->smuTrapEnable = smuTrapEnable;
+    ramp->done          = FALSE;
+    ramp->stmCountBegin = STM0_TIM0.U;
+    ramp->stmCount      = 0;
+
+    if (status != 0)
+    {
+        /* No PLL ramp up sequence, restore the oscillator disconnect feature and the SMU trap */
+        ramp->step = cfg->sysPll.numOfPllDividerSteps;
+        IfxScuCcu_processInit(ramp);
+    }
+
+    return status;
+}
+
+
 void IfxScuCcu_switchToBackupClock(const IfxScuCcu_Config *cfg)
 {
-    uint16 endinit_pw, endinitSfty_pw;
+    uint16 endinitSfty_pw;
     int    pllStepsCount;
     uint8  smuTrapEnable;
 
@@ -1209,7 +1301,6 @@ void IfxScuCcu_switchToBackupClock(const IfxScuCcu_Config *cfg)
     }
 
     endinitSfty_pw = IfxScuWdt_getSafetyWatchdogPassword();
-    endinit_pw     = IfxScuWdt_getCpuWatchdogPassword();
 
     /*Start Pll ramp down sequence */
     for (pllStepsCount = cfg->sysPll.numOfPllDividerSteps; pllStepsCount > 0; pllStepsCount--)
@@ -1235,18 +1326,15 @@ void IfxScuCcu_switchToBackupClock(const IfxScuCcu_Config *cfg)
     }
 
     {
-        /* Disable TRAP for SMU (oscillator watchdog and unlock detection) */
-        IfxScuWdt_clearCpuEndinit(endinit_pw);
+        /* Trap disable, clock selection and trap enable in one ENDINIT session */
+        IfxScuWdt_EndinitSession session;
+        IfxScuWdt_beginEndinitSession(&session, IfxScuWdt_Endinit_both);
 
+        /* Disable TRAP for SMU (oscillator watchdog and unlock detection) */
         smuTrapEnable      = SCU_TRAPDIS.B.SMUT;
         SCU_TRAPDIS.B.SMUT = 1U;
 
-        IfxScuWdt_setCpuEndinit(endinit_pw);
-    }
-
-    {
         /* Select fback (fosc-evr) as CCU input clock */
-        IfxScuWdt_clearSafetyEndinit(endinitSfty_pw);
 
         while (SCU_CCUCON0.B.LCK != 0U)
         {
@@ -1268,16 +1356,16 @@ void IfxScuCcu_switchToBackupClock(const IfxScuCcu_Config *cfg)
 
         /* Enable oscillator disconnect feature */
         SCU_PLLCON0.B.OSCDISCDIS = 0U;
-        IfxScuWdt_setSafetyEndinit(endinitSfty_pw);
-    }
-    {
+
         /* Enable VCO unlock Trap if it was disabled before */
-        IfxScuWdt_clearCpuEndinit(endinit_pw);
-        SCU_TRAPCLR.B.SMUT = 1U;
+        SCU_TRAPCLR.B.SMUT       = 1U;
 
-        SCU_TRAPDIS.B.SMUT = smuTrapEnable;
-        IfxScuWdt_setCpuEndinit(endinit_pw);
+        SCU_TRAPDIS.B.SMUT       = smuTrapEnable;
+        IfxScuWdt_endEndinitSession(&session);
     }
+
+    /* The flash clocks are now derived from the backup clock: minimum wait states */
+    IfxScuCcu_setFlashWaitStates(IfxScuCcu_getFsi2Frequency(), IfxScuCcu_getFsiFrequency());
 }
 
 
@@ -78,6 +78,8 @@
  *
  * \endcode
  *
+ * To overlap the PLL ramp with other initialisation, use \ref IfxScuCcu_startInit() and \ref IfxScuCcu_processInit() instead.
+ *
  *    The PLL and clocks are now initialised based on the IFXSCU_CFG_XTAL_FREQ and  IFXSCU_CFG_PLL_FREQ values configured in Ifx_Cfg.h.
  *
  * \}
@@ -118,6 +120,12 @@
  */
 #define IFXSCUCCU_OSC_STABLECHK_TIME (640)
 
+/** \brief Factor applied to the wait time of the intermediate PLL steps with \ref IfxScuCcu_RampProfile_fast
+ */
+#ifndef IFX_CFG_SCUCCU_FAST_RAMP_SCALE
+#define IFX_CFG_SCUCCU_FAST_RAMP_SCALE (0.25F)
+#endif
+
 /******************************************************************************/
 /*------------------------------Type Definitions------------------------------*/
 /******************************************************************************/
@@ -691,6 +699,14 @@ typedef enum
     IfxScuCcu_Pdivider_16          /**< \brief  P-divider 16  */
 } IfxScuCcu_Pdivider;
 
+/** \brief Wait times used for the PLL ramp steps
+ */
+typedef enum
+{
+    IfxScuCcu_RampProfile_normal = 0,  /**< \brief  configured wait time for each step  */
+    IfxScuCcu_RampProfile_fast         /**< \brief  wait time of the intermediate steps scaled by IFX_CFG_SCUCCU_FAST_RAMP_SCALE, for boards with a stable supply. The last step keeps its configured wait time  */
+} IfxScuCcu_RampProfile;
+
 /** \} */
 
 /******************************************************************************/
@@ -783,6 +799,19 @@ typedef struct
 
 /** \} */
 
+/** \brief State of a non-blocking clock initialisation, see \ref IfxScuCcu_startInit()
+ */
+typedef struct
+{
+    const IfxScuCcu_Config *cfg;                 /**< \brief Clock configuration */
+    IfxScuCcu_RampProfile   profile;             /**< \brief Wait times used for the PLL steps */
+    uint8                   step;                /**< \brief Index of the next PLL divider step */
+    uint8                   smuTrapEnable;       /**< \brief SMU trap disable state before the initialisation */
+    boolean                 done;                /**< \brief TRUE once the initialisation is completed */
+    uint32                  stmCountBegin;       /**< \brief STM0 count at the start of the current step wait */
+    uint32                  stmCount;            /**< \brief Duration of the current step wait in STM0 ticks */
+} IfxScuCcu_Ramp;
+
 /** \addtogroup IfxLld_Scu_Std_Ccu_Ccu_Operative
  * \{ */
 
@@ -943,6 +972,7 @@ IFX_EXTERN float32 IfxScuCcu_setSpbFrequency(float32 spbFreq);
 
 /** \brief API to set SRI frequency (with SRI divider)
  * This API configure Sri divider values in CCUCON registers. The actual frequency always depends on the feasibility with the divider value
+ * The flash wait states are increased before a frequency increase, and reduced to the minimum after the change.
  * \param sriFreq Sri frequency (fSRI) in Hz
  * \return Actual Sri frequency (fSRI) in Hz
  */
@@ -964,6 +994,25 @@ IFX_EXTERN float32 IfxScuCcu_setSriFrequency(float32 sriFreq);
  */
 IFX_EXTERN boolean IfxScuCcu_calculateSysPllDividers(IfxScuCcu_Config *cfg, uint32 fPll);
 
+/** \brief The api calculates the minimum flash wait states for the given flash clock frequencies.
+ * The wait states are derived from the flash access times IFXSCU_CFG_FLASH_PFLASH_ACCESS_TIME,
+ * IFXSCU_CFG_FLASH_PFLASH_ECC_TIME, IFXSCU_CFG_FLASH_DFLASH_ACCESS_TIME and IFXSCU_CFG_FLASH_DFLASH_ECC_TIME.
+ * \param fsi2Freq PFlash clock frequency (fFSI2) in Hz
+ * \param fsiFreq DFlash clock frequency (fFSI) in Hz
+ * \return FLASH.FCON value of the wait state bit fields (mask IFXSCU_CFG_FLASH_WAITSTATE_MSK)
+ */
+IFX_EXTERN uint32 IfxScuCcu_calculateFlashWaitStates(float32 fsi2Freq, float32 fsiFreq);
+
+/** \brief The api writes the minimum flash wait states for the given flash clock frequencies.
+ * When the clocks are increased, this API shall be called with the new frequencies before the change. When the clocks
+ * are decreased, it shall be called after the change. IfxScuCcu_setSriFrequency() and IfxScuCcu_switchToBackupClock()
+ * call it themselves.
+ * \param fsi2Freq PFlash clock frequency (fFSI2) in Hz
+ * \param fsiFreq DFlash clock frequency (fFSI) in Hz
+ * \return None
+ */
+IFX_EXTERN void IfxScuCcu_setFlashWaitStates(float32 fsi2Freq, float32 fsiFreq);
+
 /** \brief API to initialize the SCU Clock Control Unit.
  * This API initialize the PLL with ramp steps, BUS dividers for the configuration provided by the configuration structure.
  * \param cfg Pointer to the configuration structure of the ScuCcu
@@ -1014,6 +1063,41 @@ IFX_EXTERN void IfxScuCcu_switchToBackupClock(const IfxScuCcu_Config *cfg);
 IFX_INLINE float32 IfxScuCcu_getGtmFrequency(void);
 
 /******************************************************************************/
+
+/** \brief API to advance a clock initialisation started with \ref IfxScuCcu_startInit().
+ * The API does not wait: once the wait time of the current PLL step is elapsed, it sets the next K2 divider step
+ * and calls its hook function, after the last step it enables again the oscillator disconnect and the SMU trap.
+ * It is polled or called from a timer interrupt, on the CPU which called IfxScuCcu_startInit(). The STM0 and CPU
+ * clocks change with each step.
+ * \param ramp Pointer to the ramp state
+ * \return TRUE if the initialisation is completed, else FALSE
+ */
+IFX_EXTERN boolean IfxScuCcu_processInit(IfxScuCcu_Ramp *ramp);
+
+/** \brief API to start a non-blocking initialisation of the SCU Clock Control Unit.
+ * The API executes the PLL initial step and the clock distribution and flash waitstate configuration like
+ * \ref IfxScuCcu_init(), then returns without waiting for the PLL divider steps. These are executed by
+ * \ref IfxScuCcu_processInit(), in the meantime the application continues its initialisation at the initial step
+ * frequency.
+ *
+ * Example:
+ * \code
+ * IfxScuCcu_Ramp ramp;
+ * IfxScuCcu_startInit(&ramp, &IfxScuCcu_defaultClockConfig, IfxScuCcu_RampProfile_fast);
+ *
+ * while (IfxScuCcu_processInit(&ramp) == FALSE)
+ * {
+ *     // other initialisation (pins, RAM clear, ...) in small parts
+ * }
+ * \endcode
+ * \param ramp Pointer to the ramp state, valid until the initialisation is completed
+ * \param cfg Pointer to the configuration structure of the ScuCcu, valid until the initialisation is completed
+ * \param profile Wait times used for the PLL divider steps
+ * \return Error status of the ScuCcu initialization process.
+ * \retval TRUE: If an error occurred during initialization. The initialisation is then completed.
+ * \retval FALSE: If initialization was successfully started.
+ */
+IFX_EXTERN boolean IfxScuCcu_startInit(IfxScuCcu_Ramp *ramp, const IfxScuCcu_Config *cfg, IfxScuCcu_RampProfile profile);
 /*-------------------------Global Function Prototypes-------------------------*/
 /******************************************************************************/
 
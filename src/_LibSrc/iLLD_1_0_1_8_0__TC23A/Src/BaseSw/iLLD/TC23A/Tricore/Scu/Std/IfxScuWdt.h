@@ -58,10 +58,49 @@
  */
 #define IFXSCUWDT_ENDINIT_WAIT_TIMEOUTCOUNT (0x100)
 
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+
+/** \brief ENDINIT protection(s) cleared by an ENDINIT session
+ */
+typedef enum
+{
+    IfxScuWdt_Endinit_cpu    = 1, /**< \brief ENDINIT of the CPU watchdog of the calling CPU */
+    IfxScuWdt_Endinit_safety = 2, /**< \brief ENDINIT of the safety watchdog */
+    IfxScuWdt_Endinit_both   = 3  /**< \brief ENDINIT of both watchdogs */
+} IfxScuWdt_Endinit;
+
 /******************************************************************************/
 /*-----------------------------Data Structures--------------------------------*/
 /******************************************************************************/
 
+/** \brief Callback performing the protected writes of an ENDINIT session
+ * \param data Data pointer passed to IfxScuWdt_runEndinitSession()
+ */
+typedef void (*IfxScuWdt_EndinitCallback)(void *data);
+
+/** \brief ENDINIT session: passwords read once by IfxScuWdt_beginEndinitSession()
+ */
+typedef struct
+{
+    uint16            cpuPassword;          /**< \brief password of the CPU watchdog of the calling CPU */
+    uint16            safetyPassword;       /**< \brief password of the safety watchdog */
+    IfxScuWdt_Endinit endinit;              /**< \brief ENDINIT protection(s) cleared by the session */
+} IfxScuWdt_EndinitSession;
+
+/** \brief Protected register write of an ENDINIT write table
+ * The register is written with (register & ~mask) | (value & mask). A mask of 0xFFFFFFFF writes the register
+ * without reading it.
+ */
+typedef struct
+{
+    volatile uint32 *address;               /**< \brief address of the register */
+    uint32           mask;                  /**< \brief bits written */
+    uint32           value;                 /**< \brief value of the bits written */
+} IfxScuWdt_EndinitWrite;
+
+
 /** \brief Configuration structure for Scu Watchdog.
  * IfxScuWdt_Config is a type describing configuration structure of CPU and
  * Safety WDT registers defined in IfxScuWdt.h file.
@@ -228,6 +267,45 @@ IFX_EXTERN void IfxScuWdt_setCpuEndinit(uint16 password);
  */
 IFX_EXTERN void IfxScuWdt_setSafetyEndinit(uint16 password);
 
+/** \brief SCUWDT API to start an ENDINIT session: the ENDINIT protection(s) are cleared once for a batch of writes.
+ *
+ * Each clear and set of ENDINIT is a password sequence on the watchdog followed by a read back. An initialisation
+ * which writes several protected registers in a row clears ENDINIT once with this API, writes all the registers
+ * and sets ENDINIT once with IfxScuWdt_endEndinitSession().
+ * The watchdog is in time-out mode while ENDINIT is cleared: the session shall be short, without wait loop nor
+ * call to a function which clears or sets ENDINIT itself. The sequence shall not be interrupted by another
+ * interrupt/call which modifies ENDINIT.
+ * \param session Session object, will be initialised by the function
+ * \param endinit ENDINIT protection(s) to clear
+ * \return None
+ */
+IFX_EXTERN void IfxScuWdt_beginEndinitSession(IfxScuWdt_EndinitSession *session, IfxScuWdt_Endinit endinit);
+
+/** \brief SCUWDT API to end an ENDINIT session: the ENDINIT protection(s) cleared by IfxScuWdt_beginEndinitSession()
+ * are set again.
+ * \param session Session object
+ * \return None
+ */
+IFX_EXTERN void IfxScuWdt_endEndinitSession(IfxScuWdt_EndinitSession *session);
+
+/** \brief SCUWDT API to run a callback in an ENDINIT session
+ *
+ * The callback performs the protected writes, with the restrictions of IfxScuWdt_beginEndinitSession().
+ * \param endinit ENDINIT protection(s) to clear
+ * \param callback Function performing the protected writes
+ * \param data Data pointer passed to the callback
+ * \return None
+ */
+IFX_EXTERN void IfxScuWdt_runEndinitSession(IfxScuWdt_Endinit endinit, IfxScuWdt_EndinitCallback callback, void *data);
+
+/** \brief SCUWDT API to write a table of protected registers in one ENDINIT session
+ * \param endinit ENDINIT protection(s) to clear
+ * \param table Protected writes, performed in the order of the table
+ * \param count Number of entries in the table
+ * \return None
+ */
+IFX_EXTERN void IfxScuWdt_writeEndinitTable(IfxScuWdt_Endinit endinit, const IfxScuWdt_EndinitWrite *table, uint32 count);
+
 /** \} */
 
 /** \addtogroup IfxLld_Scu_Std_Wdt_Wdt_Operative
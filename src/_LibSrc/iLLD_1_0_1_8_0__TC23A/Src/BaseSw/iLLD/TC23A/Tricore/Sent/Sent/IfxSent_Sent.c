@@ -28,11 +28,80 @@
 /******************************************************************************/
 
 #include "IfxSent_Sent.h"
+#include "Cpu/Std/IfxCpu.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+
+/** \brief CRC-4 of SAE J2716 (polynomial x^4 + x^3 + x^2 + 1), indexed by the current CRC value */
+static IFX_CONST uint8 IfxSent_Sent_crc4Table[16] = {0, 13, 7, 10, 14, 3, 9, 4, 1, 12, 6, 11, 15, 2, 8, 5};
+
+/******************************************************************************/
+/*-----------------------Private Function Prototypes--------------------------*/
+/******************************************************************************/
+
+/** \brief Returns the address of a variable seen by the DMA
+ * \param address address of the variable
+ * \return Global address of the variable
+ */
+static uint32 IfxSent_Sent_getDmaAddress(const void *address);
 
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
 
+uint32 IfxSent_Sent_decodeFastChannels(IfxSent_Sent_Dma *dma, IfxSent_Sent_FastChannelData *values)
+{
+    uint32 validChannels = 0;
+    uint32 fast1Shift    = 32u - (4u * dma->fast1Nibbles);
+    uint32 fast2Nibbles  = dma->frameLength - dma->fast1Nibbles;
+    uint32 fast2Mask     = (1u << (4u * fast2Nibbles)) - 1u;
+    uint32 fast2Shift    = (dma->fast2Reversed != FALSE) ? (4u * dma->fast1Nibbles) : (32u - (4u * dma->frameLength));
+    uint32 i;
+
+    for (i = 0; i < dma->numChannels; i++)
+    {
+        uint32          data   = dma->data[i];
+        Ifx_SENT_CH_RSR status = dma->status[i];
+        uint32          crc    = 5;     /* seed */
+        uint32          msbFirst;
+        uint32          nibble;
+
+        if (dma->statusNibbleInCrc != FALSE)
+        {
+            crc = IfxSent_Sent_crc4Table[crc] ^ status.B.SCN;
+        }
+
+        for (nibble = 0; nibble < dma->frameLength; nibble++)
+        {
+            crc = IfxSent_Sent_crc4Table[crc] ^ ((data >> (4u * nibble)) & 0xFu);
+        }
+
+        if (dma->legacyCrc == FALSE)
+        {
+            crc = IfxSent_Sent_crc4Table[crc];  /* augmentation with a zero nibble */
+        }
+
+        if ((crc == status.B.CRC) && (status.B.CST == IfxSent_ChannelStatus_synchronize))
+        {
+            validChannels |= 1u << i;
+        }
+
+        /* received nibble 0 is RDR nibble 0: reverse the nibble order to get the first nibble as most significant */
+        msbFirst = ((data >> 4) & 0x0F0F0F0Fu) | ((data & 0x0F0F0F0Fu) << 4);
+        msbFirst = (msbFirst >> 24) | ((msbFirst >> 8) & 0xFF00u) | ((msbFirst << 8) & 0xFF0000u) | (msbFirst << 24);
+
+        values->fast1[i]        = (uint16)(msbFirst >> fast1Shift);
+        values->fast2[i]        = (uint16)(((dma->fast2Reversed != FALSE) ? (data >> fast2Shift) : (msbFirst >> fast2Shift)) & fast2Mask);
+        values->statusNibble[i] = (uint8)status.B.SCN;
+    }
+
+    return validChannels;
+}
+
+
 void IfxSent_Sent_deInitModule(IfxSent_Sent *driver)
 {
     Ifx_SENT *sentSFR = driver->sent;
@@ -253,6 +322,80 @@ void IfxSent_Sent_initChannelConfig(IfxSent_Sent_ChannelConfig *config, IfxSent_
 }
 
 
+boolean IfxSent_Sent_initDma(IfxSent_Sent_Dma *dma, const IfxSent_Sent_DmaConfig *config)
+{
+    boolean   result  = TRUE;
+    Ifx_SENT *sentSFR = config->driver->sent;
+
+    if ((config->numChannels == 0) || (((uint32)config->firstChannel + config->numChannels) > IFXSENT_NUM_CHANNELS)
+        || (config->fast1Nibbles == 0) || (config->fast1Nibbles > 4) || (config->frameLength > 8)
+        || (config->frameLength < config->fast1Nibbles) || ((config->frameLength - config->fast1Nibbles) > 4))
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+        return FALSE;
+    }
+
+    dma->driver            = config->driver;
+    dma->firstChannel      = config->firstChannel;
+    dma->numChannels       = config->numChannels;
+    dma->frameLength       = config->frameLength;
+    dma->fast1Nibbles      = config->fast1Nibbles;
+    dma->fast2Reversed     = config->fast2Reversed;
+    dma->statusNibbleInCrc = config->statusNibbleInCrc;
+    dma->legacyCrc         = config->legacyCrc;
+
+    {
+        IfxDma_Dma               dmaHandle;
+        IfxDma_Dma_createModuleHandle(&dmaHandle, &MODULE_DMA);
+
+        IfxDma_Dma_ChannelConfig dmaCfg;
+        IfxDma_Dma_initChannelConfig(&dmaCfg, &dmaHandle);
+
+        dmaCfg.hardwareRequestEnabled  = FALSE; // triggered by software, once per control period
+        dmaCfg.channelInterruptEnabled = FALSE; // end of transaction polled with IfxSent_Sent_isDmaBusy()
+        dmaCfg.requestMode             = IfxDma_ChannelRequestMode_completeTransactionPerRequest;
+        dmaCfg.operationMode           = IfxDma_ChannelOperationMode_single;
+        dmaCfg.moveSize                = IfxDma_ChannelMoveSize_32bit;
+        dmaCfg.blockMode               = IfxDma_ChannelMove_1;
+        dmaCfg.transferCount           = config->numChannels;
+
+        // RDR registers are consecutive
+        dmaCfg.channelId          = config->dataDmaChannelId;
+        dmaCfg.sourceAddress      = (uint32)&sentSFR->RDR[config->firstChannel].U;
+        dmaCfg.destinationAddress = IfxSent_Sent_getDmaAddress(dma->data);
+        IfxDma_Dma_initChannel(&dma->dataDmaChannel, &dmaCfg);
+
+        // RSR registers are in the channel objects: one move per channel object
+        dmaCfg.channelId                  = config->statusDmaChannelId;
+        dmaCfg.sourceAddress              = (uint32)&sentSFR->CH[config->firstChannel].RSR.U;
+        dmaCfg.sourceAddressIncrementStep = IfxDma_ChannelIncrementStep_16;
+        dmaCfg.destinationAddress         = IfxSent_Sent_getDmaAddress(dma->status);
+        IfxDma_Dma_initChannel(&dma->statusDmaChannel, &dmaCfg);
+    }
+
+    return result;
+}
+
+
+void IfxSent_Sent_initDmaConfig(IfxSent_Sent_DmaConfig *config, IfxSent_Sent *driver)
+{
+    const IfxSent_Sent_DmaConfig defaultDmaConfig = {
+        .driver             = NULL_PTR,
+        .firstChannel       = IfxSent_ChannelId_0,
+        .numChannels        = 1,
+        .dataDmaChannelId   = IfxDma_ChannelId_0,
+        .statusDmaChannelId = IfxDma_ChannelId_1,
+        .frameLength        = 6,
+        .fast1Nibbles       = 3,
+        .fast2Reversed      = FALSE,
+        .statusNibbleInCrc  = FALSE,
+        .legacyCrc          = FALSE,
+    };
+    *config        = defaultDmaConfig;
+    config->driver = driver;
+}
+
+
 boolean IfxSent_Sent_initModule(IfxSent_Sent *driver, const IfxSent_Sent_Config *config)
 {
     boolean   result  = TRUE;
@@ -322,3 +465,30 @@ boolean IfxSent_Sent_readChannelSerialMessageFrame(IfxSent_Sent_Channel *channel
 
     return result;
 }
+
+
+
+void IfxSent_Sent_startDma(IfxSent_Sent_Dma *dma)
+{
+    Ifx_SENT *sentSFR = dma->driver->sent;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, IfxSent_Sent_isDmaBusy(dma) == FALSE);
+
+    /* the previous transaction moved the addresses */
+    IfxDma_Dma_setChannelSourceAddress(&dma->dataDmaChannel, (uint32)&sentSFR->RDR[dma->firstChannel].U);
+    IfxDma_Dma_setChannelDestinationAddress(&dma->dataDmaChannel, IfxSent_Sent_getDmaAddress(dma->data));
+    IfxDma_Dma_setChannelTransferCount(&dma->dataDmaChannel, dma->numChannels);
+
+    IfxDma_Dma_setChannelSourceAddress(&dma->statusDmaChannel, (uint32)&sentSFR->CH[dma->firstChannel].RSR.U);
+    IfxDma_Dma_setChannelDestinationAddress(&dma->statusDmaChannel, IfxSent_Sent_getDmaAddress(dma->status));
+    IfxDma_Dma_setChannelTransferCount(&dma->statusDmaChannel, dma->numChannels);
+
+    IfxDma_Dma_startChannelTransaction(&dma->dataDmaChannel);
+    IfxDma_Dma_startChannelTransaction(&dma->statusDmaChannel);
+}
+
+
+static uint32 IfxSent_Sent_getDmaAddress(const void *address)
+{
+    return IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), address);
+}
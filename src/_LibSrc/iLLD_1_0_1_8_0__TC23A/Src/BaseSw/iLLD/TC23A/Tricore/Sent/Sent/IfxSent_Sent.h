@@ -345,6 +345,40 @@
  * }
  * \endcode
  *
+ * \subsection IfxLld_Sent_Sent_Dma DMA Mode
+ * Instead of one interrupt per frame and channel, the last frame of all channels can be collected once per control
+ * period by the DMA: one DMA channel copies the RDR registers, a second one the RSR registers (status nibble, CRC
+ * nibble and channel status) of consecutive SENT channels. The channels are configured as above, with the RSI / RDI
+ * interrupts disabled and the default nibble view (received nibble k in RDR nibble k).
+ *
+ * \code
+ * static IfxSent_Sent_Dma sentDma;
+ *
+ * IfxSent_Sent_DmaConfig dmaConfig;
+ * IfxSent_Sent_initDmaConfig(&dmaConfig, &sent);
+ * dmaConfig.firstChannel       = IfxSent_ChannelId_0;
+ * dmaConfig.numChannels        = 8;
+ * dmaConfig.dataDmaChannelId   = IfxDma_ChannelId_10;
+ * dmaConfig.statusDmaChannelId = IfxDma_ChannelId_11;
+ * dmaConfig.frameLength        = 6;   // 2 fast channels of 12 bit
+ * dmaConfig.fast1Nibbles       = 3;
+ * IfxSent_Sent_initDma(&sentDma, &dmaConfig);
+ *
+ * // control period
+ * static IfxSent_Sent_FastChannelData pressure;
+ *
+ * uint32 validChannels = IfxSent_Sent_decodeFastChannels(&sentDma, &pressure); // frames collected in the previous period
+ * IfxSent_Sent_startDma(&sentDma);                                              // collect the frames for the next period
+ *
+ * for (i = 0; i < 8; i++)
+ * {
+ *     if (validChannels & (1u << i))
+ *     {
+ *         // use pressure.fast1[i], pressure.fast2[i]
+ *     }
+ * }
+ * \endcode
+ *
  * \defgroup IfxLld_Sent_Sent Interface Driver
  * \ingroup IfxLld_Sent
  * \defgroup IfxLld_Sent_Sent_Structures Data Structures
@@ -353,6 +387,8 @@
  * \ingroup IfxLld_Sent_Sent
  * \defgroup IfxLld_Sent_Sent_Channel Channel Functions
  * \ingroup IfxLld_Sent_Sent
+ * \defgroup IfxLld_Sent_Sent_Dma DMA Functions
+ * \ingroup IfxLld_Sent_Sent
  */
 
 #ifndef IFXSENT_SENT_H
@@ -365,6 +401,7 @@
 #include "Scu/Std/IfxScuWdt.h"
 #include "Sent/Std/IfxSent.h"
 #include "Cpu/Irq/IfxCpu_Irq.h"
+#include "Dma/Dma/IfxDma_Dma.h"
 
 /******************************************************************************/
 /*-----------------------------Data Structures--------------------------------*/
@@ -561,6 +598,49 @@ typedef struct
     IfxSent_ConfigBit configBit;        /**< \brief Contains the received configuration bit value */
 } IfxSent_Sent_SerialMessageFrame;
 
+/** \brief Specifies the DMA mode configuration structure
+ */
+typedef struct
+{
+    IfxSent_Sent     *driver;                    /**< \brief Specifies the pointer to SENT module handler */
+    IfxSent_ChannelId firstChannel;              /**< \brief Specifies the first SENT channel collected */
+    uint8             numChannels;               /**< \brief Specifies the number of consecutive SENT channels collected */
+    IfxDma_ChannelId  dataDmaChannelId;          /**< \brief Specifies the DMA channel copying the RDR registers */
+    IfxDma_ChannelId  statusDmaChannelId;        /**< \brief Specifies the DMA channel copying the RSR registers */
+    uint8             frameLength;               /**< \brief Specifies the number of data nibbles of the fast messages (1 to 8) */
+    uint8             fast1Nibbles;              /**< \brief Specifies the number of nibbles of fast channel 1, the remaining data nibbles are fast channel 2 */
+    boolean           fast2Reversed;             /**< \brief Specifies the fast channel 2 is sent least significant nibble first (SAE J2716 H.1) */
+    boolean           statusNibbleInCrc;         /**< \brief Specifies the status nibble is included in the CRC */
+    boolean           legacyCrc;                 /**< \brief Specifies the CRC is calculated without the zero nibble (SAE J2716 before 2010) */
+} IfxSent_Sent_DmaConfig;
+
+/** \brief Specifies the DMA mode handle structure
+ */
+typedef struct
+{
+    IfxSent_Sent      *driver;                            /**< \brief Specifies the pointer to SENT module handler */
+    IfxDma_Dma_Channel dataDmaChannel;                    /**< \brief Specifies the DMA channel copying the RDR registers */
+    IfxDma_Dma_Channel statusDmaChannel;                  /**< \brief Specifies the DMA channel copying the RSR registers */
+    IfxSent_ChannelId  firstChannel;                      /**< \brief Specifies the first SENT channel collected */
+    uint8              numChannels;                       /**< \brief Specifies the number of consecutive SENT channels collected */
+    uint8              frameLength;                       /**< \brief Specifies the number of data nibbles of the fast messages */
+    uint8              fast1Nibbles;                      /**< \brief Specifies the number of nibbles of fast channel 1 */
+    boolean            fast2Reversed;                     /**< \brief Specifies the fast channel 2 is sent least significant nibble first */
+    boolean            statusNibbleInCrc;                 /**< \brief Specifies the status nibble is included in the CRC */
+    boolean            legacyCrc;                         /**< \brief Specifies the CRC is calculated without the zero nibble */
+    uint32             data[IFXSENT_NUM_CHANNELS];        /**< \brief Contains the RDR registers copied by the DMA */
+    Ifx_SENT_CH_RSR    status[IFXSENT_NUM_CHANNELS];      /**< \brief Contains the RSR registers copied by the DMA */
+} IfxSent_Sent_Dma;
+
+/** \brief Specifies the fast channel values of the channels collected by the DMA, one array entry per channel
+ */
+typedef struct
+{
+    uint16 fast1[IFXSENT_NUM_CHANNELS];               /**< \brief Contains the fast channel 1 values */
+    uint16 fast2[IFXSENT_NUM_CHANNELS];               /**< \brief Contains the fast channel 2 values */
+    uint8  statusNibble[IFXSENT_NUM_CHANNELS];        /**< \brief Contains the status and communication nibbles */
+} IfxSent_Sent_FastChannelData;
+
 /** \} */
 
 /** \addtogroup IfxLld_Sent_Sent_Module
@@ -662,6 +742,68 @@ IFX_EXTERN boolean IfxSent_Sent_readChannelSerialMessageFrame(IfxSent_Sent_Chann
 
 /** \} */
 
+/** \addtogroup IfxLld_Sent_Sent_Dma
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Indicates if the DMA is still copying the registers
+ * \param dma pointer to the DMA mode handle
+ * \return TRUE while the copy started by IfxSent_Sent_startDma() is ongoing
+ */
+IFX_INLINE boolean IfxSent_Sent_isDmaBusy(IfxSent_Sent_Dma *dma);
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Validates the frames collected by the DMA and extracts the fast channel values
+ *
+ * For each channel, the frame is valid if the channel is synchronized and the CRC calculated over the data
+ * nibbles matches the received CRC nibble. A frame received between the copy of the RDR and RSR registers
+ * fails the CRC check. The values of invalid frames are extracted anyway.
+ * \param dma pointer to the DMA mode handle
+ * \param values fast channel values, index 0 is the first collected channel
+ * \return Bit mask of the valid frames, bit 0 is the first collected channel
+ *
+ * Usage example: see \ref IfxLld_Sent_Sent_Dma
+ *
+ */
+IFX_EXTERN uint32 IfxSent_Sent_decodeFastChannels(IfxSent_Sent_Dma *dma, IfxSent_Sent_FastChannelData *values);
+
+/** \brief Initialize the DMA channels with the supplied configuration
+ * \param dma pointer to the DMA mode handle, the registers are copied into this structure
+ * \param config pointer to the DMA mode configuration
+ * \return TRUE if valid configuration otherwise FALSE
+ *
+ * Usage example: see \ref IfxLld_Sent_Sent_Dma
+ *
+ */
+IFX_EXTERN boolean IfxSent_Sent_initDma(IfxSent_Sent_Dma *dma, const IfxSent_Sent_DmaConfig *config);
+
+/** \brief Initialise buffer with default DMA mode configuration
+ * \param config pointer to the DMA mode configuration
+ * \param driver pointer to the SENT module handler
+ * \return None
+ *
+ * Usage example: see \ref IfxLld_Sent_Sent_Dma
+ *
+ */
+IFX_EXTERN void IfxSent_Sent_initDmaConfig(IfxSent_Sent_DmaConfig *config, IfxSent_Sent *driver);
+
+/** \brief Starts the copy of the RDR and RSR registers of all collected channels
+ * \param dma pointer to the DMA mode handle
+ * \return None
+ *
+ * Usage example: see \ref IfxLld_Sent_Sent_Dma
+ *
+ */
+IFX_EXTERN void IfxSent_Sent_startDma(IfxSent_Sent_Dma *dma);
+
+/** \} */
+
 /******************************************************************************/
 /*---------------------Inline Function Implementations------------------------*/
 /******************************************************************************/
@@ -672,4 +814,11 @@ IFX_INLINE Ifx_SENT_CH_INTSTAT IfxSent_Sent_getAndClearInterruptStatus(IfxSent_S
 }
 
 
+IFX_INLINE boolean IfxSent_Sent_isDmaBusy(IfxSent_Sent_Dma *dma)
+{
+    return (IfxDma_Dma_isChannelTransactionPending(&dma->dataDmaChannel) != FALSE)
+           || (IfxDma_Dma_isChannelTransactionPending(&dma->statusDmaChannel) != FALSE);
+}
+
+
 #endif /* IFXSENT_SENT_H */
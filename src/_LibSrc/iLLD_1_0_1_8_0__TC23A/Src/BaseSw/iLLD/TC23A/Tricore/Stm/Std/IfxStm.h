@@ -278,6 +278,16 @@ IFX_INLINE uint64 IfxStm_get(Ifx_STM *stm);
  */
 IFX_INLINE float32 IfxStm_getFrequency(Ifx_STM *stm);
 
+/** \brief Returns system timer value, without critical section.
+ *
+ * IfxStm_get() reads TIM0 then CAP, which is overwritten by any TIM0..TIM5 read of an interrupt executed in
+ * between: it must be called with the interrupts disabled. This function reads TIM6, TIM0, then TIM6 again,
+ * and reads again when the upper word changed in between (TIM0 wrapped around, at most every 2^32 ticks).
+ * \param stm pointer to System timer module registers.
+ * \return system timer value.
+ */
+IFX_INLINE uint64 IfxStm_getLockFree(Ifx_STM *stm);
+
 /** \brief Returns the module's suspend state.
  * TRUE :if module is suspended.
  * FALSE:if module is not yet suspended.
@@ -550,6 +560,21 @@ IFX_INLINE float32 IfxStm_getFrequency(Ifx_STM *stm)
 }
 
 
+IFX_INLINE uint64 IfxStm_getLockFree(Ifx_STM *stm)
+{
+    uint32 upper;
+    uint32 lower;
+
+    do
+    {
+        upper = stm->TIM6.U;
+        lower = stm->TIM0.U;
+    } while (upper != stm->TIM6.U);
+
+    return ((uint64)upper << 32) | lower;
+}
+
+
 IFX_INLINE uint32 IfxStm_getLower(Ifx_STM *stm)
 {
     return stm->TIM0.U;
@@ -28,6 +28,18 @@
 
 #include "IfxVadc.h"
 
+/******************************************************************************/
+/*-----------------------Private Function Prototypes--------------------------*/
+/******************************************************************************/
+
+/** \brief Calculate the divider of the ADC analog clock
+ * \param fadc ADC module clock frequency in Hz
+ * \param fAdcI ADC analog clock frequency in Hz
+ * \param divA Returns the divider
+ * \return ADC analog clock frequency in Hz, 0 if out of range
+ */
+static uint32 IfxVadc_calculateAnalogClockDivider(uint32 fadc, uint32 fAdcI, uint32 *divA);
+
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
@@ -69,6 +81,17 @@ void IfxVadc_disableAccess(Ifx_VADC *vadc, IfxVadc_Protection protectionSet)
 }
 
 
+void IfxVadc_disableAccessMask(Ifx_VADC *vadc, uint32 accprot0Mask, uint32 accprot1Mask)
+{
+    IfxScuWdt_EndinitSession session;
+
+    IfxScuWdt_beginEndinitSession(&session, IfxScuWdt_Endinit_safety);
+    vadc->ACCPROT0.U |= accprot0Mask;
+    vadc->ACCPROT1.U |= accprot1Mask;
+    IfxScuWdt_endEndinitSession(&session);
+}
+
+
 void IfxVadc_disablePostCalibration(Ifx_VADC *vadc, IfxVadc_GroupId group, boolean disable)
 {
     if (group < IFXVADC_NUM_ADC_CAL_GROUPS)
@@ -109,6 +132,17 @@ void IfxVadc_enableAccess(Ifx_VADC *vadc, IfxVadc_Protection protectionSet)
 }
 
 
+void IfxVadc_enableAccessMask(Ifx_VADC *vadc, uint32 accprot0Mask, uint32 accprot1Mask)
+{
+    IfxScuWdt_EndinitSession session;
+
+    IfxScuWdt_beginEndinitSession(&session, IfxScuWdt_Endinit_safety);
+    vadc->ACCPROT0.U &= ~accprot0Mask;
+    vadc->ACCPROT1.U &= ~accprot1Mask;
+    IfxScuWdt_endEndinitSession(&session);
+}
+
+
 void IfxVadc_enableGroupSync(Ifx_VADC *vadc, uint32 ccu6Num)
 {
     uint16 passwd = IfxScuWdt_getCpuWatchdogPassword();
@@ -418,36 +452,44 @@ uint32 IfxVadc_initializeFAdcD(Ifx_VADC *vadc, uint32 fAdcD)
 uint32 IfxVadc_initializeFAdcI(Ifx_VADC *vadc, uint32 fAdcI)
 {
     uint32 divA;
-    uint32 result;
-    uint32 fadc = IfxScuCcu_getSpbFrequency();
+    uint32 result = IfxVadc_calculateAnalogClockDivider(IfxScuCcu_getSpbFrequency(), fAdcI, &divA);
 
-    /*    DivA = min(max(0, Fadc / FAdcI - 1), 0x3F); */
-    divA   = (fadc << 2) / fAdcI;
-
-    divA   = (divA + 2) >> 2; /* Round to nearest integer */
-    divA   = __minu(divA - 1, 0x1Fu);
-    result = fadc / (divA + 1);
-
-    if (result > IFXVADC_ANALOG_FREQUENCY_MAX)
+    if (result != 0)
     {
-        divA   = __minu(divA + 1, 0x1Fu);
-
-        result = fadc / (divA + 1);
+        IfxVadc_initialiseAdcConverterClock(vadc, divA);
     }
     else
     {
         /* do nothing */
     }
 
-    if (!((result >= IFXVADC_ANALOG_FREQUENCY_MIN) && (result <= IFXVADC_ANALOG_FREQUENCY_MAX)))
+    return result;
+}
+
+
+uint32 IfxVadc_initializeGlobalConfig(Ifx_VADC *vadc, IfxVadc_LowSupplyVoltageSelect supplyVoltage, uint32 fAdcI, uint32 fAdcD)
+{
+    uint32           divA;
+    uint32           fadc   = IfxScuCcu_getSpbFrequency();
+    uint32           result = IfxVadc_calculateAnalogClockDivider(fadc, fAdcI, &divA);
+    Ifx_VADC_GLOBCFG tempGLOBCFG;
+
+    tempGLOBCFG.U       = vadc->GLOBCFG.U;
+    tempGLOBCFG.B.LOSUP = supplyVoltage;
+    tempGLOBCFG.B.DIVWC = 1;
+
+    if (result != 0)
     {
-        result = 0;             /* Min / Max FAdcI frequency */
+        tempGLOBCFG.B.DIVA = divA;
+        tempGLOBCFG.B.DIVD = __minu(fadc / fAdcD - 1, 0x3u);
     }
     else
     {
-        IfxVadc_initialiseAdcConverterClock(vadc, divA);
+        /* do nothing */
     }
 
+    vadc->GLOBCFG.U = tempGLOBCFG.U;
+
     return result;
 }
 
@@ -470,6 +512,27 @@ boolean IfxVadc_isPostCalibration(Ifx_VADC *vadc, IfxVadc_GroupId group)
 }
 
 
+boolean IfxVadc_isStartupCalibrationDone(Ifx_VADC *vadc)
+{
+    boolean calibrationRunning = FALSE;
+    uint8   adcCalGroupNum;
+
+    for (adcCalGroupNum = 0; adcCalGroupNum < IFXVADC_NUM_ADC_CAL_GROUPS; adcCalGroupNum++)
+    {
+        if (IfxVadc_getAdcCalibrationActiveState(vadc, adcCalGroupNum) != 0)     /* Check ADC Calibration Flag CAL */
+        {
+            calibrationRunning = TRUE;
+        }
+        else
+        {
+            /* do nothing */
+        }
+    }
+
+    return (calibrationRunning == FALSE) ? TRUE : FALSE;
+}
+
+
 void IfxVadc_resetKernel(Ifx_VADC *vadc)
 {
     uint16 passwd = IfxScuWdt_getCpuWatchdogPassword();
@@ -537,31 +600,57 @@ void IfxVadc_setScan(Ifx_VADC_G *group, uint32 channels, uint32 mask)
 
 void IfxVadc_startupCalibration(Ifx_VADC *vadc)
 {
-    boolean calibrationRunning;
-    uint8   adcCalGroupNum;
+    IfxVadc_triggerStartupCalibration(vadc);
+
+    /* Wait for hardware self-test and calibration to complete */
+    while (IfxVadc_isStartupCalibrationDone(vadc) == FALSE)
+    {}
+}
+
 
+void IfxVadc_triggerStartupCalibration(Ifx_VADC *vadc)
+{
     /* Start calibration */
     IfxVadc_enableAccess(vadc, IfxVadc_Protection_globalConfig);
     /* Set SUCAL bit */
     IfxVadc_initiateStartupCalibration(vadc);
     IfxVadc_disableAccess(vadc, IfxVadc_Protection_globalConfig);
+}
 
-    /* Wait for hardware self-test and calibration to complete */
-    /* Wait until Calibration is done */
-    do
+
+static uint32 IfxVadc_calculateAnalogClockDivider(uint32 fadc, uint32 fAdcI, uint32 *divA)
+{
+    uint32 divider;
+    uint32 result;
+
+    /*    DivA = min(max(0, Fadc / FAdcI - 1), 0x3F); */
+    divider = (fadc << 2) / fAdcI;
+
+    divider = (divider + 2) >> 2; /* Round to nearest integer */
+    divider = __minu(divider - 1, 0x1Fu);
+    result  = fadc / (divider + 1);
+
+    if (result > IFXVADC_ANALOG_FREQUENCY_MAX)
     {
-        calibrationRunning = FALSE;
+        divider = __minu(divider + 1, 0x1Fu);
 
-        for (adcCalGroupNum = 0; adcCalGroupNum < IFXVADC_NUM_ADC_CAL_GROUPS; adcCalGroupNum++)
-        {
-            if (IfxVadc_getAdcCalibrationActiveState(vadc, adcCalGroupNum) != 0)     /* Check ADC Calibration Flag CAL */
-            {
-                calibrationRunning = TRUE;
-            }
-            else
-            {
-                /* do nothing */
-            }
-        }
-    } while (calibrationRunning == TRUE); /* wait until calibration of all calibrated kernels are done */
+        result  = fadc / (divider + 1);
+    }
+    else
+    {
+        /* do nothing */
+    }
+
+    if (!((result >= IFXVADC_ANALOG_FREQUENCY_MIN) && (result <= IFXVADC_ANALOG_FREQUENCY_MAX)))
+    {
+        result = 0;             /* Min / Max FAdcI frequency */
+    }
+    else
+    {
+        /* do nothing */
+    }
+
+    *divA = divider;
+
+    return result;
 }
@@ -193,6 +193,16 @@ typedef enum
     IfxVadc_ConversionType_Compatible = 0  /**< \brief Compatible Timing Mode */
 } IfxVadc_ConversionType;
 
+/** \brief Data modification mode of a result register\n
+ * Definition in Ifx_VADC.G[x].RCR[y].B.DMM
+ */
+typedef enum
+{
+    IfxVadc_DataModificationMode_standardDataReduction = 0,  /**< \brief accumulation of up to 16 results, see Ifx_VADC.G[x].RCR[y].B.DRCTR */
+    IfxVadc_DataModificationMode_resultFiltering       = 1,  /**< \brief FIR or IIR filter, see \ref IfxVadc_ResultFilter */
+    IfxVadc_DataModificationMode_difference            = 2   /**< \brief result minus the content of result register 0 */
+} IfxVadc_DataModificationMode;
+
 /** \brief Specifies the External Coding scheme(binary/gray)
  * defined in Ifx_VADC.G[x].EMUXCTR.B.EMXCOD
  */
@@ -411,6 +421,30 @@ typedef enum
     IfxVadc_RequestSource_background = 2  /**< \brief background scan request */
 } IfxVadc_RequestSource;
 
+/** \brief Data reduction control in the result filtering mode\n
+ * Definition in Ifx_VADC.G[x].RCR[y].B.DRCTR. FIR filter: a * x(n) + b * x(n-1) + c * x(n-2),
+ * IIR filter: see the user manual
+ */
+typedef enum
+{
+    IfxVadc_ResultFilter_fir210 = 0,   /**< \brief FIR filter a = 2, b = 1, c = 0 */
+    IfxVadc_ResultFilter_fir120 = 1,   /**< \brief FIR filter a = 1, b = 2, c = 0 */
+    IfxVadc_ResultFilter_fir201 = 2,   /**< \brief FIR filter a = 2, b = 0, c = 1 */
+    IfxVadc_ResultFilter_fir111 = 3,   /**< \brief FIR filter a = 1, b = 1, c = 1 */
+    IfxVadc_ResultFilter_fir102 = 4,   /**< \brief FIR filter a = 1, b = 0, c = 2 */
+    IfxVadc_ResultFilter_fir310 = 5,   /**< \brief FIR filter a = 3, b = 1, c = 0 */
+    IfxVadc_ResultFilter_fir220 = 6,   /**< \brief FIR filter a = 2, b = 2, c = 0 */
+    IfxVadc_ResultFilter_fir130 = 7,   /**< \brief FIR filter a = 1, b = 3, c = 0 */
+    IfxVadc_ResultFilter_fir301 = 8,   /**< \brief FIR filter a = 3, b = 0, c = 1 */
+    IfxVadc_ResultFilter_fir211 = 9,   /**< \brief FIR filter a = 2, b = 1, c = 1 */
+    IfxVadc_ResultFilter_fir121 = 10,  /**< \brief FIR filter a = 1, b = 2, c = 1 */
+    IfxVadc_ResultFilter_fir202 = 11,  /**< \brief FIR filter a = 2, b = 0, c = 2 */
+    IfxVadc_ResultFilter_fir112 = 12,  /**< \brief FIR filter a = 1, b = 1, c = 2 */
+    IfxVadc_ResultFilter_fir103 = 13,  /**< \brief FIR filter a = 1, b = 0, c = 3 */
+    IfxVadc_ResultFilter_iir22  = 14,  /**< \brief IIR filter a = 2, b = 2 */
+    IfxVadc_ResultFilter_iir34  = 15   /**< \brief IIR filter a = 3, b = 4 */
+} IfxVadc_ResultFilter;
+
 /** \brief Enable/disable the sensitivity of the module to sleep signal\n
  * Definition in Ifx_VADC.CLC.B.EDIS
  */
@@ -964,6 +998,12 @@ IFX_INLINE void IfxVadc_addToQueue(Ifx_VADC_G *group, IfxVadc_ChannelId channel,
  */
 IFX_INLINE void IfxVadc_clearQueue(Ifx_VADC_G *vadcG, boolean flushQueue);
 
+/** \brief Clears the queue source event flag.
+ * \param vadcG pointer to VADC group registers.
+ * \return None
+ */
+IFX_INLINE void IfxVadc_clearQueueSourceEvent(Ifx_VADC_G *vadcG);
+
 /** \brief Disables the external trigger.
  * \param vadcG pointer to VADC group registers.
  * \return None
@@ -1034,6 +1074,14 @@ IFX_INLINE void IfxVadc_setQueueSlotGatingConfig(Ifx_VADC_G *vadcG, IfxVadc_Gati
  */
 IFX_INLINE void IfxVadc_setQueueSlotTriggerOperatingConfig(Ifx_VADC_G *vadcG, IfxVadc_TriggerMode triggerMode, IfxVadc_TriggerSource triggerSource);
 
+/** \brief Sets the service request node of the queue source event.
+ * The event is raised at the end of the conversion of a queue entry with the source interrupt enabled (ENSI).
+ * \param vadcG pointer to VADC group registers.
+ * \param sourceSrcNr source event Service Node.
+ * \return None
+ */
+IFX_INLINE void IfxVadc_setQueueSourceEventNodePointer(Ifx_VADC_G *vadcG, IfxVadc_SrcNr sourceSrcNr);
+
 /** \brief Starts a queue of a group by generating a trigger event through software
  * \param group pointer to the VADC group
  * \return None
@@ -1128,12 +1176,25 @@ IFX_EXTERN float32 IfxVadc_getAdcDigitalFrequency(Ifx_VADC *vadc);
  */
 IFX_INLINE void IfxVadc_clearAllResultRequests(Ifx_VADC_G *vadcG);
 
+/** \brief Clears the channel event flags of the group.
+ * \param vadcG pointer to VADC group registers.
+ * \param flags channel event flags to clear, bit x for channel x.
+ * \return None
+ */
+IFX_INLINE void IfxVadc_clearChannelEventFlags(Ifx_VADC_G *vadcG, uint32 flags);
+
 /** \brief Gets the ADC group arbitration round length.
  * \param vadcG pointer to VADC group registers.
  * \return ADC group arbitration round length.
  */
 IFX_INLINE IfxVadc_ArbitrationRounds IfxVadc_getArbiterRoundLength(Ifx_VADC_G *vadcG);
 
+/** \brief Returns the channel event flags of the group.
+ * \param vadcG pointer to VADC group registers.
+ * \return channel event flags, bit x for channel x.
+ */
+IFX_INLINE uint32 IfxVadc_getChannelEventFlags(Ifx_VADC_G *vadcG);
+
 /** \brief Gets the channel esult service request node pointer 0.
  * \param vadcG pointer to VADC group registers.
  * \return channel result service request node pointer 0.
@@ -1178,6 +1239,23 @@ IFX_INLINE void IfxVadc_setAnalogConvertControl(Ifx_VADC_G *vadcG, IfxVadc_Analo
  */
 IFX_INLINE void IfxVadc_setArbitrationRoundLength(Ifx_VADC_G *vadcG, IfxVadc_ArbitrationRounds arbiterRoundLength);
 
+/** \brief Sets the boundary value stored in a result register, used by the channels whose boundary extension
+ * (IfxVadc_BoundaryExtension) selects this result register.
+ * \param vadcG pointer to VADC group registers.
+ * \param resultRegister result register holding the boundary value.
+ * \param value boundary value, aligned as the conversion results.
+ * \return None
+ */
+IFX_INLINE void IfxVadc_setExtendedBoundary(Ifx_VADC_G *vadcG, IfxVadc_ChannelResult resultRegister, uint16 value);
+
+/** \brief Sets the group boundary values for limit checking, selected by IfxVadc_BoundarySelection_group0/1.
+ * \param vadcG pointer to VADC group registers.
+ * \param boundary0 group boundary value 0, 12-bit.
+ * \param boundary1 group boundary value 1, 12-bit.
+ * \return None
+ */
+IFX_INLINE void IfxVadc_setGroupBoundaries(Ifx_VADC_G *vadcG, uint16 boundary0, uint16 boundary1);
+
 /** \brief Sets the ADC input class channel resolution.
  * \param vadcG pointer to VADC group registers.
  * \param inputClassNum input class number.
@@ -1202,6 +1280,13 @@ IFX_INLINE void IfxVadc_setGroupSampleTime(Ifx_VADC_G *vadcG, uint8 inputClassNu
  */
 IFX_INLINE void IfxVadc_setMasterIndex(Ifx_VADC_G *vadcG, uint8 masterIndex);
 
+/** \brief Enables the evaluation of a ready input of the synchronization, e.g. by the master for the ready signal of a slave.
+ * \param vadcG pointer to VADC group registers.
+ * \param kernelIndex index of the other group within the synchronization cluster, see IfxVadc_setMasterIndex() (1..3).
+ * \return None
+ */
+IFX_INLINE void IfxVadc_enableReadyInputEvaluation(Ifx_VADC_G *vadcG, uint8 kernelIndex);
+
 /******************************************************************************/
 /*-------------------------Global Function Prototypes-------------------------*/
 /******************************************************************************/
@@ -1262,6 +1347,14 @@ IFX_INLINE boolean IfxVadc_getStartupCalibration(Ifx_VADC *vadc);
  */
 IFX_INLINE void IfxVadc_initiateStartupCalibration(Ifx_VADC *vadc);
 
+/** \brief Sets the global boundary values for limit checking, selected by IfxVadc_BoundarySelection_global0/1.
+ * \param vadc pointer to VADC module registers.
+ * \param boundary0 global boundary value 0, 12-bit.
+ * \param boundary1 global boundary value 1, 12-bit.
+ * \return None
+ */
+IFX_INLINE void IfxVadc_setGlobalBoundaries(Ifx_VADC *vadc, uint16 boundary0, uint16 boundary1);
+
 /** \brief Sets the channel conversion mode.
  * \param vadc pointer to VADC module registers.
  * \param inputClassNum global input class  number.
@@ -1297,6 +1390,14 @@ IFX_INLINE void IfxVadc_setSleepMode(Ifx_VADC *vadc, IfxVadc_SleepMode mode);
  */
 IFX_EXTERN void IfxVadc_disableAccess(Ifx_VADC *vadc, IfxVadc_Protection protectionSet);
 
+/** \brief Disable write access to several VADC config/control registers, in one safety ENDINIT session.
+ * \param vadc pointer to the base of VADC registers.
+ * \param accprot0Mask Bits of ACCPROT0 for which write access is to be disabled.
+ * \param accprot1Mask Bits of ACCPROT1 for which write access is to be disabled.
+ * \return None
+ */
+IFX_EXTERN void IfxVadc_disableAccessMask(Ifx_VADC *vadc, uint32 accprot0Mask, uint32 accprot1Mask);
+
 /** \brief Disables the post calibration.
  * \param vadc pointer to the base of VADC registers.
  * \param group Index of the group.
@@ -1312,6 +1413,14 @@ IFX_EXTERN void IfxVadc_disablePostCalibration(Ifx_VADC *vadc, IfxVadc_GroupId g
  */
 IFX_EXTERN void IfxVadc_enableAccess(Ifx_VADC *vadc, IfxVadc_Protection protectionSet);
 
+/** \brief Enable write access to several VADC config/control registers, in one safety ENDINIT session.
+ * \param vadc pointer to the base of VADC registers.
+ * \param accprot0Mask Bits of ACCPROT0 for which write access is to be enabled, bit n for the protection set n.
+ * \param accprot1Mask Bits of ACCPROT1 for which write access is to be enabled, bit n for the protection set 32 + n.
+ * \return None
+ */
+IFX_EXTERN void IfxVadc_enableAccessMask(Ifx_VADC *vadc, uint32 accprot0Mask, uint32 accprot1Mask);
+
 /** \brief Enables the CCU6 based ADC group synchronisation as workaround for Erratum ADC_TC.068
  * \param vadc pointer to the base of VADC registers.
  * \param ccu6Num selects CCU60 or CCU61
@@ -1359,6 +1468,17 @@ IFX_EXTERN uint32 IfxVadc_initializeFAdcD(Ifx_VADC *vadc, uint32 fAdcD);
  */
 IFX_EXTERN uint32 IfxVadc_initializeFAdcI(Ifx_VADC *vadc, uint32 fAdcI);
 
+/** \brief Configure the supply voltage, the ADC analog clock and the ADC digital clock with one GLOBCFG write.
+ * The write access to GLOBCFG shall be enabled by the caller (IfxVadc_enableAccess() or IfxVadc_enableAccessMask()).
+ * The clocks are not modified if the analog clock frequency is out of range.
+ * \param vadc pointer to the base of VADC registers.
+ * \param supplyVoltage Supply voltage
+ * \param fAdcI ADC analog clock clock frequency in Hz. Range = [5000000, 10000000].
+ * \param fAdcD ADC digital clock frequency in Hz.
+ * \return ADC analog clock frequency in Hz, 0 if out of range.
+ */
+IFX_EXTERN uint32 IfxVadc_initializeGlobalConfig(Ifx_VADC *vadc, IfxVadc_LowSupplyVoltageSelect supplyVoltage, uint32 fAdcI, uint32 fAdcD);
+
 /** \brief Return the post calibration status
  * \param vadc Pointer to VADC module
  * \param group specifies Group ID
@@ -1366,6 +1486,12 @@ IFX_EXTERN uint32 IfxVadc_initializeFAdcI(Ifx_VADC *vadc, uint32 fAdcI);
  */
 IFX_EXTERN boolean IfxVadc_isPostCalibration(Ifx_VADC *vadc, IfxVadc_GroupId group);
 
+/** \brief Returns the end of the startup calibration
+ * \param vadc pointer to the base of VADC registers.
+ * \return TRUE if no calibrated group has its calibration flag CAL set
+ */
+IFX_EXTERN boolean IfxVadc_isStartupCalibrationDone(Ifx_VADC *vadc);
+
 /** \brief Resets the kernel.
  * \param vadc pointer to the base of VADC registers.
  * \return None
@@ -1385,6 +1511,12 @@ IFX_EXTERN void IfxVadc_selectPowerSupplyVoltage(Ifx_VADC *vadc, IfxVadc_LowSupp
  */
 IFX_EXTERN void IfxVadc_startupCalibration(Ifx_VADC *vadc);
 
+/** \brief Starts ADC calibration without waiting for the end of the calibration process, see IfxVadc_isStartupCalibrationDone().
+ * \param vadc pointer to the base of VADC registers.
+ * \return None
+ */
+IFX_EXTERN void IfxVadc_triggerStartupCalibration(Ifx_VADC *vadc);
+
 /** \} */
 
 /** \addtogroup IfxLld_Vadc_Std_Channel
@@ -1436,6 +1568,20 @@ IFX_INLINE Ifx_VADC_CHCTR IfxVadc_getChannelControlConfig(Ifx_VADC_G *vadcG, Ifx
  */
 IFX_INLINE IfxVadc_InputClasses IfxVadc_getChannelInputClass(Ifx_VADC_G *vadcG, IfxVadc_ChannelId channelIndex);
 
+/** \brief Gets the data modification mode of a result register.
+ * \param vadcG pointer to VADC group registers.
+ * \param resultRegister channel result register.
+ * \return data modification mode.
+ */
+IFX_INLINE IfxVadc_DataModificationMode IfxVadc_getDataModificationMode(Ifx_VADC_G *vadcG, IfxVadc_ChannelResult resultRegister);
+
+/** \brief Gets the data reduction control of a result register.
+ * \param vadcG pointer to VADC group registers.
+ * \param resultRegister channel result register.
+ * \return data reduction control, see IfxVadc_setDataReduction().
+ */
+IFX_INLINE uint8 IfxVadc_getDataReductionControl(Ifx_VADC_G *vadcG, IfxVadc_ChannelResult resultRegister);
+
 /** \brief Gets the ADC input class channel resolution.
  * \param vadcG pointer to VADC group registers.
  * \param inputClassNum ADC input class number.
@@ -1505,6 +1651,16 @@ IFX_INLINE void IfxVadc_setChannelLimitCheckMode(Ifx_VADC_G *vadcG, IfxVadc_Chan
  */
 IFX_INLINE void IfxVadc_setGroupPriorityChannel(Ifx_VADC_G *vadcG, IfxVadc_ChannelId channelIndex);
 
+/** \brief Sets the data reduction of a result register.
+ * \param vadcG pointer to VADC group registers.
+ * \param resultRegister channel result register.
+ * \param mode data modification mode.
+ * \param control data reduction control. standardDataReduction: number of accumulated results - 1 (0: none, 1..15: 2..16 results),
+ * resultFiltering: \ref IfxVadc_ResultFilter, difference: 0.
+ * \return None
+ */
+IFX_INLINE void IfxVadc_setDataReduction(Ifx_VADC_G *vadcG, IfxVadc_ChannelResult resultRegister, IfxVadc_DataModificationMode mode, uint8 control);
+
 /** \brief Sets group's lower boundary.
  * \param vadcG pointer to VADC group registers.
  * \param channelIndex group channel id.
@@ -1735,6 +1891,12 @@ IFX_INLINE void IfxVadc_clearAllResultRequests(Ifx_VADC_G *vadcG)
 }
 
 
+IFX_INLINE void IfxVadc_clearChannelEventFlags(Ifx_VADC_G *vadcG, uint32 flags)
+{
+    vadcG->CEFCLR.U = flags;
+}
+
+
 IFX_INLINE void IfxVadc_clearChannelRequest(Ifx_VADC_G *vadcG, IfxVadc_ChannelId channelId)
 {
     vadcG->CEFCLR.U = 1 << channelId;
@@ -1747,6 +1909,12 @@ IFX_INLINE void IfxVadc_clearQueue(Ifx_VADC_G *vadcG, boolean flushQueue)
 }
 
 
+IFX_INLINE void IfxVadc_clearQueueSourceEvent(Ifx_VADC_G *vadcG)
+{
+    vadcG->SEFCLR.U = 1 << IFX_VADC_G_SEFCLR_SEV0_OFF;
+}
+
+
 IFX_INLINE void IfxVadc_configureWaitForReadMode(Ifx_VADC_G *group, uint32 resultIdx, boolean waitForRead)
 {
     group->RCR[resultIdx].B.WFR = waitForRead;
@@ -1808,6 +1976,12 @@ IFX_INLINE void IfxVadc_enableQueueSlotExternalTrigger(Ifx_VADC_G *vadcG)
 }
 
 
+IFX_INLINE void IfxVadc_enableReadyInputEvaluation(Ifx_VADC_G *vadcG, uint8 kernelIndex)
+{
+    vadcG->SYNCTR.U |= (0x00000008U << (kernelIndex % 4));
+}
+
+
 IFX_INLINE void IfxVadc_enableScanSlotExternalTrigger(Ifx_VADC_G *vadcG)
 {
     vadcG->ASMR.B.ENTR = 1; /* enable external trigger */
@@ -1892,6 +2066,12 @@ IFX_INLINE IfxVadc_InputClasses IfxVadc_getChannelInputClass(Ifx_VADC_G *vadcG,
 }
 
 
+IFX_INLINE uint32 IfxVadc_getChannelEventFlags(Ifx_VADC_G *vadcG)
+{
+    return vadcG->CEFLAG.U;
+}
+
+
 IFX_INLINE Ifx_VADC_G_REVNP0 IfxVadc_getChannelResultServiceRequestNodePointer0(Ifx_VADC_G *vadcG)
 {
     Ifx_VADC_G_REVNP0 resultServiceRequestNodePtr0;
@@ -1985,6 +2165,18 @@ IFX_INLINE float32 IfxVadc_getGlobalSampleTime(Ifx_VADC *vadc, uint8 inputClassN
 }
 
 
+IFX_INLINE IfxVadc_DataModificationMode IfxVadc_getDataModificationMode(Ifx_VADC_G *vadcG, IfxVadc_ChannelResult resultRegister)
+{
+    return (IfxVadc_DataModificationMode)vadcG->RCR[resultRegister].B.DMM;
+}
+
+
+IFX_INLINE uint8 IfxVadc_getDataReductionControl(Ifx_VADC_G *vadcG, IfxVadc_ChannelResult resultRegister)
+{
+    return (uint8)vadcG->RCR[resultRegister].B.DRCTR;
+}
+
+
 IFX_INLINE IfxVadc_ChannelResolution IfxVadc_getGroupResolution(Ifx_VADC_G *vadcG, uint8 inputClassNum)
 {
     return (IfxVadc_ChannelResolution)vadcG->ICLASS[inputClassNum].B.CMS;
@@ -2301,6 +2493,22 @@ IFX_INLINE void IfxVadc_setEmuxInterfaceForGroup(Ifx_VADC *vadc, IfxVadc_EmuxInt
 }
 
 
+IFX_INLINE void IfxVadc_setExtendedBoundary(Ifx_VADC_G *vadcG, IfxVadc_ChannelResult resultRegister, uint16 value)
+{
+    vadcG->RES[resultRegister].B.RESULT = value;
+}
+
+
+IFX_INLINE void IfxVadc_setGlobalBoundaries(Ifx_VADC *vadc, uint16 boundary0, uint16 boundary1)
+{
+    Ifx_VADC_GLOBBOUND bound;
+    bound.U           = 0;
+    bound.B.BOUNDARY0 = boundary0;
+    bound.B.BOUNDARY1 = boundary1;
+    vadc->GLOBBOUND.U = bound.U;
+}
+
+
 IFX_INLINE void IfxVadc_setGlobalResolution(Ifx_VADC *vadc, uint8 inputClassNum, IfxVadc_ChannelResolution resolution)
 {
     vadc->GLOBICLASS[inputClassNum].B.CMS = resolution;
@@ -2313,6 +2521,16 @@ IFX_INLINE void IfxVadc_setGlobalSampleTime(Ifx_VADC *vadc, uint8 inputClassNum,
 }
 
 
+IFX_INLINE void IfxVadc_setGroupBoundaries(Ifx_VADC_G *vadcG, uint16 boundary0, uint16 boundary1)
+{
+    Ifx_VADC_G_BOUND bound;
+    bound.U           = 0;
+    bound.B.BOUNDARY0 = boundary0;
+    bound.B.BOUNDARY1 = boundary1;
+    vadcG->BOUND.U    = bound.U;
+}
+
+
 IFX_INLINE void IfxVadc_setGroupPriorityChannel(Ifx_VADC_G *vadcG, IfxVadc_ChannelId channelIndex)
 {
     vadcG->CHASS.U |= (1 << channelIndex);
@@ -2331,6 +2549,17 @@ IFX_INLINE void IfxVadc_setGroupSampleTime(Ifx_VADC_G *vadcG, uint8 inputClassNu
 }
 
 
+IFX_INLINE void IfxVadc_setDataReduction(Ifx_VADC_G *vadcG, IfxVadc_ChannelResult resultRegister, IfxVadc_DataModificationMode mode, uint8 control)
+{
+    Ifx_VADC_G_RCR rcr;
+
+    rcr.U                        = vadcG->RCR[resultRegister].U;
+    rcr.B.DMM                    = mode;
+    rcr.B.DRCTR                  = control;
+    vadcG->RCR[resultRegister].U = rcr.U;
+}
+
+
 IFX_INLINE void IfxVadc_setLowerBoundary(Ifx_VADC_G *vadcG, IfxVadc_ChannelId channelIndex, IfxVadc_BoundarySelection lowerBoundary)
 {
     vadcG->CHCTR[channelIndex].B.BNDSELL = lowerBoundary;
@@ -2366,6 +2595,12 @@ IFX_INLINE void IfxVadc_setQueueSlotTriggerOperatingConfig(Ifx_VADC_G *vadcG, If
 }
 
 
+IFX_INLINE void IfxVadc_setQueueSourceEventNodePointer(Ifx_VADC_G *vadcG, IfxVadc_SrcNr sourceSrcNr)
+{
+    vadcG->SEVNP.B.SEV0NP = sourceSrcNr;
+}
+
+
 IFX_INLINE void IfxVadc_setReferenceInput(Ifx_VADC_G *vadcG, IfxVadc_ChannelId channelIndex, IfxVadc_ChannelReference reference)
 {
     vadcG->CHCTR[channelIndex].B.REFSEL = reference;
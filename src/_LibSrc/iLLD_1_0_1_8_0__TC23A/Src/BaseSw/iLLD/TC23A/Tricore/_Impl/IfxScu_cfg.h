@@ -1009,6 +1009,26 @@
  *  \ref IfxScuCcu_InitialStepConfig
  */
 
+#ifndef IFXSCU_CFG_FLASH_PFLASH_ACCESS_TIME
+/** \brief PFlash read access time in s, in fFSI2 cycles (FCON.WSPFLASH), used by IfxScuCcu_calculateFlashWaitStates() */
+#define IFXSCU_CFG_FLASH_PFLASH_ACCESS_TIME  (30.0e-9F)
+#endif /*#ifndef IFXSCU_CFG_FLASH_PFLASH_ACCESS_TIME */
+
+#ifndef IFXSCU_CFG_FLASH_PFLASH_ECC_TIME
+/** \brief PFlash error correction time in s, in fFSI2 cycles (FCON.WSECPF), used by IfxScuCcu_calculateFlashWaitStates() */
+#define IFXSCU_CFG_FLASH_PFLASH_ECC_TIME     (10.0e-9F)
+#endif /*#ifndef IFXSCU_CFG_FLASH_PFLASH_ECC_TIME */
+
+#ifndef IFXSCU_CFG_FLASH_DFLASH_ACCESS_TIME
+/** \brief DFlash read access time in s, in fFSI cycles (FCON.WSDFLASH), used by IfxScuCcu_calculateFlashWaitStates() */
+#define IFXSCU_CFG_FLASH_DFLASH_ACCESS_TIME  (200.0e-9F)
+#endif /*#ifndef IFXSCU_CFG_FLASH_DFLASH_ACCESS_TIME */
+
+#ifndef IFXSCU_CFG_FLASH_DFLASH_ECC_TIME
+/** \brief DFlash error correction time in s, in fFSI cycles (FCON.WSECDF), used by IfxScuCcu_calculateFlashWaitStates() */
+#define IFXSCU_CFG_FLASH_DFLASH_ECC_TIME     (20.0e-9F)
+#endif /*#ifndef IFXSCU_CFG_FLASH_DFLASH_ECC_TIME */
+
 #ifndef IFXSCU_CFG_FLASH_FCON_WSPFLASH_80MHZ
 /** \brief Macro to configure FCON.WSPFLASH at 80MHz target frequency */
 #define IFXSCU_CFG_FLASH_FCON_WSPFLASH_80MHZ  (3 - 1)
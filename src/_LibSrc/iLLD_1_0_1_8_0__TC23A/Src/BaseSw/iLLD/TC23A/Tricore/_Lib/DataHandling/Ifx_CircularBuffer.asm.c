@@ -70,70 +70,4 @@ void Ifx_CircularBuffer_addDataIncr(Ifx_CircularBuffer *buffer, uint32 data)
 }
 
 
-void *Ifx_CircularBuffer_read8(Ifx_CircularBuffer *buffer, void *data, Ifx_SizeT count)
-{
-    count--;
-    __asm("	mov.a\ta13,%3\n"                                   /* Get count value */
-        "	ld.da\ta14/a15,[%1]\n"                             /* Get circular buffer state */
-        "Ifx_CircularBuffer_read1:" "	ld.b\td15,[a14/a15+c]\n"/* read the value from the buffer, and increment the buffer pointer */
-        "	st.b\t[%2+],d15\n"                                 /* Store value to the data buffer, and increment the pointer */
-        "	loop\ta13,Ifx_CircularBuffer_read1\n"              /* loop */
-        "	mov.d\t%0,a15\n"                                   /* Get the new index value */
-        "	extr.u\t%0,%0,#0,#16\n": "=d" (buffer->index) : "a" (buffer), "a" (data), "d" (count) : "a13", "a14", "a15",
-        "d15");
-
-    return data;
-}
-
-
-void *Ifx_CircularBuffer_read32(Ifx_CircularBuffer *buffer, void *data, Ifx_SizeT count)
-{
-    count--;
-    __asm("	mov.a\ta13,%3\n"                                   /* Get count value */
-        "	ld.da\ta14/a15,[%1]\n"                             /* Get circular buffer state */
-        "Ifx_CircularBuffer_read2:" "	ld.w\td15,[a14/a15+c]\n"/* read the value from the buffer, and increment the buffer pointer */
-        "	st.w\t[%2+],d15\n"                                 /* Store value to the data buffer, and increment the pointer */
-        "	loop\ta13,Ifx_CircularBuffer_read2\n"              /* loop */
-        "	mov.d\t%0,a15\n"                                   /* Get the new index value */
-        "	extr.u\t%0,%0,#0,#16\n": "=d" (buffer->index) : "a" (buffer), "a" (data), "d" (count) : "a13", "a14", "a15",
-        "d15");
-
-    return data;
-}
-
-
-const void *Ifx_CircularBuffer_write8(Ifx_CircularBuffer *buffer, const void *data, Ifx_SizeT count)
-{
-    count--;
-    __asm("	mov.a\ta13,%3\n"                              /* Get count value */
-        "	ld.da\ta14/a15,[%1]\n"                        /* Get circular buffer state */
-        "Ifx_CircularBuffer_write1:" "	ld.b\td15,[%2+]\n"/* Get value from the data buffer, and increment the pointer */
-        "	st.b\t[a14/a15+c]0,d15\n"                     /* Store the value to the buffer, and increment the buffer pointer */
-        "	ld.b\td15,[a14/a15+c]\n"                      /* Read the value from the buffer, to get the buffer pointer incremented (bug workaround) */
-        "	loop\ta13,Ifx_CircularBuffer_write1\n"        /* loop */
-        "	mov.d\t%0,a15\n"                              /* Get the new index value */
-        "	extr.u\t%0,%0,#0,#16\n": "=d" (buffer->index) : "a" (buffer), "a" (data), "d" (count) : "a13", "a14", "a15",
-        "d15");
-
-    return data;
-}
-
-
-const void *Ifx_CircularBuffer_write32(Ifx_CircularBuffer *buffer, const void *data, Ifx_SizeT count)
-{
-    count--;
-    __asm("	mov.a\ta13,%3\n"                              /* Get count value */
-        "	ld.da\ta14/a15,[%1]\n"                        /* Get circular buffer state */
-        "Ifx_CircularBuffer_write2:" "	ld.w\td15,[%2+]\n"/* Get value from the data buffer, and increment the pointer */
-        "	st.w\t[a14/a15+c]0,d15\n"                     /* Store the value to the buffer, and increment the buffer pointer */
-        "	ld.w\td15,[a14/a15+c]\n"                      /* Read the value from the buffer, to get the buffer pointer incremented (bug workaround) */
-        "	loop\ta13,Ifx_CircularBuffer_write2\n"        /* loop */
-        "	mov.d\t%0,a15\n"                              /* Get the new index value */
-        "	extr.u\t%0,%0,#0,#16\n": "=d" (buffer->index) : "a" (buffer), "a" (data), "d" (count) : "a13", "a14", "a15",
-        "d15");
-
-    return data;
-}
-
-
 #endif
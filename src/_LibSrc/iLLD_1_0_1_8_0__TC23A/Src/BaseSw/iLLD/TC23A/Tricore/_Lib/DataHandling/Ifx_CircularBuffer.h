@@ -22,6 +22,10 @@
  *
  * \defgroup IfxLld_lib_datahandling_circularbuffer Circular buffer
  * This module implements circular buffer functions.
+ *
+ * The block functions (read8, read32, write8, write32) split each transfer into at most 2 linear segments, which
+ * are moved with 64 bit accesses where source and destination have the same word alignment. They are implemented
+ * in C for both IFX_CFG_CIRCULARBUFFER_C settings, the circular addressing mode is used for single values only.
  * \ingroup IfxLld_lib_datahandling
  *
  */
@@ -96,6 +100,53 @@ const void *Ifx_CircularBuffer_write8(Ifx_CircularBuffer *buffer, const void *da
  */
 const void *Ifx_CircularBuffer_write32(Ifx_CircularBuffer *buffer, const void *data, Ifx_SizeT count);
 
+/** \brief Return the pointer to the current circular buffer position
+ *
+ * Used together with \ref Ifx_CircularBuffer_getLinearCount() and \ref Ifx_CircularBuffer_skip()
+ * to access the buffer in place, e.g. by a DMA or a frame encoder, without copy.
+ *
+ * \param buffer Specifies circular buffer.
+ *
+ * \return Return the pointer to the byte at the current index.
+ */
+IFX_INLINE void *Ifx_CircularBuffer_getPointer(Ifx_CircularBuffer *buffer)
+{
+    return &((uint8 *)buffer->base)[buffer->index];
+}
+
+
+/** \brief Return the number of bytes between the current index and the end of the buffer
+ *
+ * \param buffer Specifies circular buffer.
+ *
+ * \return Return the number of bytes which can be accessed from \ref Ifx_CircularBuffer_getPointer() without wrapping.
+ */
+IFX_INLINE Ifx_SizeT Ifx_CircularBuffer_getLinearCount(Ifx_CircularBuffer *buffer)
+{
+    return (Ifx_SizeT)(buffer->length - buffer->index);
+}
+
+
+/** \brief Move the circular buffer index forward by count bytes
+ *
+ * \param buffer Specifies circular buffer.
+ * \param count Specifies number of bytes to skip. count MUST be <= buffer->length.
+ *
+ * \return None.
+ */
+IFX_INLINE void Ifx_CircularBuffer_skip(Ifx_CircularBuffer *buffer, Ifx_SizeT count)
+{
+    uint32 index = (uint32)buffer->index + (uint32)count;
+
+    if (index >= buffer->length)
+    {
+        index -= buffer->length;
+    }
+
+    buffer->index = (uint16)index;
+}
+
+
 /** \} */
 //---------------------------------------------------------------------------
 #endif
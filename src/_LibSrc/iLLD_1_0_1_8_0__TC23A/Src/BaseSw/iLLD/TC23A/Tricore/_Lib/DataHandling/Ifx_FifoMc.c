@@ -0,0 +1,298 @@
+/**
+ * \file Ifx_FifoMc.c
+ * \brief Multi-core FIFO functions
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+//------------------------------------------------------------------------------
+#define IFX_ASSERT_MODULE FIFO
+#include "Ifx_FifoMc.h"
+#include "Ifx_CircularBuffer.h"
+#include "_Utilities/Ifx_Assert.h"
+#include "Cpu/Std/IfxCpu.h"
+#include "SysSe/Bsp/Bsp.h"
+//------------------------------------------------------------------------------
+/*
+ * Note: the multi-core fifo is a single producer / single consumer fifo:
+ * - the writer only modifies fifo->writer, the reader only modifies fifo->reader.
+ * Each side is located in its own cache line, there is no false sharing
+ * - it is supposed that all access to 32 bit data are atomic
+ * - a __dsync() is executed between the buffer access and the counter update,
+ * so that the other CPU never sees a counter before the corresponding data
+ * - Only one reader and one writer are allowed by FIFO, they may run on the
+ * same CPU or on different CPUs
+ *
+ */
+//------------------------------------------------------------------------------
+Ifx_FifoMc *Ifx_FifoMc_init(void *buffer, Ifx_SizeT size, Ifx_SizeT elementSize)
+{
+    Ifx_FifoMc *fifo;
+    uint32      address;
+
+    size = Ifx_AlignOn32(size);     /* data transfer is optimised for 32 bit access */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, elementSize <= size);
+#if IFX_SIZET_MAX > IFX_FIFOMC_MAX_SIZE
+    /* Check size over maximum FIFO size */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, size <= IFX_FIFOMC_MAX_SIZE);
+#endif
+    /* The reader CPU would not see the data written by the writer CPU */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, IfxCpu_isAddressCachable(buffer) == FALSE);
+
+    /* Use the global address so that the object is valid on all CPUs, aligned on a cache line */
+    address = IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), buffer);
+    address = (address + (IFX_FIFOMC_CACHE_LINE_SIZE - 1)) & ~(uint32)(IFX_FIFOMC_CACHE_LINE_SIZE - 1);
+
+    {
+        fifo                   = (Ifx_FifoMc *)address;
+        fifo->writer.total     = 0;
+        fifo->writer.waitLevel = 0;
+        fifo->writer.src       = NULL_PTR;
+        fifo->writer.index     = 0;
+        fifo->writer.maxcount  = 0;
+        fifo->reader.total     = 0;
+        fifo->reader.waitLevel = 0;
+        fifo->reader.src       = NULL_PTR;
+        fifo->reader.index     = 0;
+        fifo->reader.maxcount  = 0;
+        fifo->buffer           = (uint8 *)Ifx_AlignOn64(address + sizeof(Ifx_FifoMc));
+        fifo->size             = size;
+        fifo->elementSize      = elementSize;
+    }
+
+    __dsync();
+
+    return fifo;
+}
+
+
+/** Trigger the service request of the waiting side if its level is reached
+ */
+static void Ifx_FifoMc_notify(Ifx_FifoMc_Side *waiting, Ifx_SizeT available)
+{
+    sint32                 level = waiting->waitLevel;
+    volatile Ifx_SRC_SRCR *src   = waiting->src;
+
+    if ((level != 0) && (available >= level) && (src != NULL_PTR))
+    {
+        IfxSrc_setRequest(src);
+    }
+}
+
+
+/** Wait until the fifo contains at least level bytes
+ */
+static boolean Ifx_FifoMc_waitRead(Ifx_FifoMc *fifo, Ifx_SizeT level, Ifx_TickTime deadLine)
+{
+    boolean result;
+
+    fifo->reader.waitLevel = level;
+    __dsync();
+
+    while ((Ifx_FifoMc_readCount(fifo) < level) && (isDeadLine(deadLine) == FALSE))
+    {}
+
+    result = Ifx_FifoMc_readCount(fifo) >= level;
+
+    if (result != FALSE)
+    {
+        fifo->reader.waitLevel = 0;
+    }
+
+    return result;
+}
+
+
+/** Wait until the fifo has at least level bytes free
+ */
+static boolean Ifx_FifoMc_waitWrite(Ifx_FifoMc *fifo, Ifx_SizeT level, Ifx_TickTime deadLine)
+{
+    boolean result;
+
+    fifo->writer.waitLevel = level;
+    __dsync();
+
+    while ((Ifx_FifoMc_writeCount(fifo) < level) && (isDeadLine(deadLine) == FALSE))
+    {}
+
+    result = Ifx_FifoMc_writeCount(fifo) >= level;
+
+    if (result != FALSE)
+    {
+        fifo->writer.waitLevel = 0;
+    }
+
+    return result;
+}
+
+
+boolean Ifx_FifoMc_canReadCount(Ifx_FifoMc *fifo, Ifx_SizeT count, Ifx_TickTime timeout)
+{
+    boolean result;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
+
+    if (count < fifo->elementSize)
+    {                           /* Only complete elements can be read from the buffer */
+        result = FALSE;
+    }
+    else
+    {
+        result = Ifx_FifoMc_waitRead(fifo, __min(count, fifo->size), getDeadLine(timeout));
+    }
+
+    return result;
+}
+
+
+boolean Ifx_FifoMc_canWriteCount(Ifx_FifoMc *fifo, Ifx_SizeT count, Ifx_TickTime timeout)
+{
+    boolean result;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
+    count = __min(count, fifo->size);
+
+    if (count < fifo->elementSize)
+    {                           /* Only complete elements can be written to the buffer */
+        result = FALSE;
+    }
+    else
+    {
+        result = Ifx_FifoMc_waitWrite(fifo, count, getDeadLine(timeout));
+    }
+
+    return result;
+}
+
+
+void Ifx_FifoMc_clear(Ifx_FifoMc *fifo)
+{
+    Ifx_SizeT count = Ifx_FifoMc_readCount(fifo);
+
+    fifo->reader.index     = (uint16)((fifo->reader.index + count) % fifo->size);
+    fifo->reader.waitLevel = 0;
+    __dsync();
+    fifo->reader.total    += (uint32)count;
+    Ifx_FifoMc_notify(&fifo->writer, Ifx_FifoMc_writeCount(fifo));
+}
+
+
+Ifx_SizeT Ifx_FifoMc_read(Ifx_FifoMc *fifo, void *data, Ifx_SizeT count, Ifx_TickTime timeout)
+{
+    Ifx_TickTime       DeadLine;
+    Ifx_SizeT          blockSize;
+    Ifx_CircularBuffer buffer;
+    boolean            Stop = FALSE;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, data != NULL_PTR);
+
+    if (count != 0)
+    {
+        buffer.base   = fifo->buffer;
+        buffer.length = (uint16)fifo->size;     /* size always fit into 16 bit */
+        buffer.index  = fifo->reader.index;
+        DeadLine      = getDeadLine(timeout);
+
+        do
+        {
+            blockSize  = __min(count, Ifx_FifoMc_readCount(fifo));
+            blockSize -= blockSize % fifo->elementSize;
+
+            if (blockSize != 0)
+            {
+                /* read element from the buffer */
+                data               = Ifx_CircularBuffer_read8(&buffer, data, blockSize);
+                fifo->reader.index = buffer.index;
+                __dsync();  /* The data must be read before the space is released to the writer */
+                fifo->reader.total += (uint32)blockSize;
+                count              -= blockSize;
+                Ifx_FifoMc_notify(&fifo->writer, Ifx_FifoMc_writeCount(fifo));
+            }
+
+            if ((Stop != FALSE) || (isDeadLine(DeadLine) != FALSE))
+            {
+                break;
+            }
+
+            if (count != 0)
+            {
+                /* If the function timeout, the maximum number of characters are read before returning */
+                Stop = Ifx_FifoMc_waitRead(fifo, __min(count, fifo->size), DeadLine) == FALSE;
+            }
+        } while (count != 0);
+    }
+
+    return count;
+}
+
+
+Ifx_SizeT Ifx_FifoMc_write(Ifx_FifoMc *fifo, const void *data, Ifx_SizeT count, Ifx_TickTime timeout)
+{
+    Ifx_TickTime       DeadLine;
+    Ifx_SizeT          blockSize;
+    Ifx_CircularBuffer buffer;
+    boolean            Stop = FALSE;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, data != NULL_PTR);
+
+    if (count != 0)
+    {
+        buffer.base   = fifo->buffer;
+        buffer.length = (uint16)fifo->size;     /* size always fit into 16 bit */
+        buffer.index  = fifo->writer.index;
+        DeadLine      = getDeadLine(timeout);
+
+        do
+        {
+            blockSize  = __min(count, Ifx_FifoMc_writeCount(fifo));
+            blockSize -= blockSize % fifo->elementSize;
+
+            if (blockSize != 0)
+            {
+                /* write element to the buffer */
+                data               = Ifx_CircularBuffer_write8(&buffer, data, blockSize);
+                fifo->writer.index = buffer.index;
+                __dsync();  /* The data must be visible to the reader CPU before they are published */
+                fifo->writer.total   += (uint32)blockSize;
+                fifo->writer.maxcount = (uint16)__max(fifo->writer.maxcount, Ifx_FifoMc_readCount(fifo));
+                count                -= blockSize;
+                Ifx_FifoMc_notify(&fifo->reader, Ifx_FifoMc_readCount(fifo));
+            }
+
+            if ((Stop != FALSE) || (isDeadLine(DeadLine) != FALSE))
+            {
+                break;
+            }
+
+            if (count != 0)
+            {
+                /* If the function timeout, the maximum number of characters are written before returning */
+                Stop = Ifx_FifoMc_waitWrite(fifo, __min(count, fifo->size), DeadLine) == FALSE;
+            }
+        } while (count != 0);
+    }
+
+    return count;
+}
+
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,103 @@
+/**
+ * \file Ifx_SeqLock.c
+ * \brief Sequence lock and double buffered snapshot
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+//------------------------------------------------------------------------------
+#include "Ifx_SeqLock.h"
+#include "_Utilities/Ifx_Assert.h"
+#include "Cpu/Std/IfxCpu.h"
+//------------------------------------------------------------------------------
+/*
+ * Note: the snapshot copy buffer[n & 1] is written by the writer while the sequence is n - 1, before
+ * the sequence is set to n. A reader of the copy of sequence n can only be disturbed by the write of the
+ * copy n + 2, which starts after the sequence n + 1 is published: the reader retries if the sequence
+ * changed during its read.
+ */
+//------------------------------------------------------------------------------
+Ifx_SeqLock_Snapshot *Ifx_SeqLock_initSnapshot(void *memory, Ifx_SizeT size)
+{
+    Ifx_SeqLock_Snapshot *snapshot;
+    uint32                address;
+    uint32                words = size / 4;
+
+    /* The data is copied with 32 bit accesses */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (size % 4) == 0);
+    /* The reader CPUs would not see the data written by the writer CPU */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, IfxCpu_isAddressCachable(memory) == FALSE);
+
+    /* Use the global address so that the object is valid on all CPUs */
+    address  = Ifx_AlignOn32(IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), memory));
+    snapshot = (Ifx_SeqLock_Snapshot *)address;
+    snapshot->lock.sequence = 0;
+    snapshot->words         = (uint16)words;
+    snapshot->buffer[0]     = (volatile uint32 *)(address + sizeof(Ifx_SeqLock_Snapshot));
+    snapshot->buffer[1]     = &snapshot->buffer[0][words];
+
+    __dsync();
+
+    return snapshot;
+}
+
+
+void Ifx_SeqLock_publish(Ifx_SeqLock_Snapshot *snapshot, const void *data)
+{
+    uint32           sequence    = snapshot->lock.sequence;
+    volatile uint32 *destination = snapshot->buffer[(sequence + 1) & 1];
+    const uint32    *source      = (const uint32 *)data;
+    uint32           i;
+
+    for (i = 0; i < snapshot->words; i++)
+    {
+        destination[i] = source[i];
+    }
+
+    IFX_SEQLOCK_WRITE_BARRIER();    /* The copy must be visible to the reader CPUs before it is published */
+    snapshot->lock.sequence = sequence + 1;
+}
+
+
+uint32 Ifx_SeqLock_read(Ifx_SeqLock_Snapshot *snapshot, void *data)
+{
+    uint32  sequence;
+    uint32 *destination = (uint32 *)data;
+    uint32  i;
+
+    do
+    {
+        sequence = Ifx_SeqLock_readBegin(&snapshot->lock);
+
+        if (sequence != 0)
+        {
+            volatile uint32 *source = snapshot->buffer[sequence & 1];
+
+            for (i = 0; i < snapshot->words; i++)
+            {
+                destination[i] = source[i];
+            }
+        }
+
+        IFX_SEQLOCK_READ_BARRIER();
+    } while (sequence != snapshot->lock.sequence);
+
+    return sequence;
+}
@@ -0,0 +1,209 @@
+/**
+ * \file Ifx_SeqLock.h
+ * \brief Sequence lock and double buffered snapshot
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup IfxLld_lib_datahandling_seqlock Sequence lock
+ * This module implements the consistent read of data written by one CPU and read by the other CPUs,
+ * without lock: the readers never block the writer, they retry their copy if it may be torn.
+ * \ingroup IfxLld_lib_datahandling
+ *
+ * Two variants are available:
+ * - the sequence lock \ref Ifx_SeqLock protects data updated in place. The sequence is odd while the writer
+ * updates the data, the reader retries while the sequence is odd or has changed during its copy. It suits
+ * small data updated field by field.
+ * - the snapshot \ref Ifx_SeqLock_Snapshot holds two copies of the data. \ref Ifx_SeqLock_publish() writes the
+ * copy which is not read and then switches the sequence, \ref Ifx_SeqLock_read() only retries if a new copy
+ * was published during its read. A reader is then not delayed by a writer in progress, which suits larger
+ * data like a 64 byte structure.
+ *
+ * The data must be located in a memory which is visible by all CPUs without cache coherency issue: non cached
+ * LMU (segment 0xB) or a DSPR accessed through its global address. \ref Ifx_SeqLock_initSnapshot() converts a
+ * local DSPR address into its global address. Only one writer is allowed, the writer shall not be interrupted
+ * by another writer of the same data.
+ *
+ * Sequence lock usage example:
+ * \code
+ * typedef struct {Ifx_SeqLock lock; volatile float32 speed; volatile float32 angle;} Position;
+ * Position position;   // global address used by all CPUs
+ *
+ * // writer CPU
+ * Ifx_SeqLock_writeBegin(&position.lock);
+ * position.speed = speed;
+ * position.angle = angle;
+ * Ifx_SeqLock_writeEnd(&position.lock);
+ *
+ * // reader CPU
+ * uint32 sequence;
+ * do
+ * {
+ *     sequence = Ifx_SeqLock_readBegin(&position.lock);
+ *     speed    = position.speed;
+ *     angle    = position.angle;
+ * } while (Ifx_SeqLock_readRetry(&position.lock, sequence) != FALSE);
+ * \endcode
+ *
+ * Snapshot usage example:
+ * \code
+ * uint8                 sensorMemory[IFX_SEQLOCK_SNAPSHOT_SIZE(sizeof(SensorData))];
+ * Ifx_SeqLock_Snapshot *sensorSnapshot;
+ *
+ * // CPU0, before starting the other CPUs
+ * sensorSnapshot = Ifx_SeqLock_initSnapshot(sensorMemory, sizeof(SensorData));
+ *
+ * // writer CPU
+ * Ifx_SeqLock_publish(sensorSnapshot, &sensorData);
+ *
+ * // reader CPU
+ * SensorData copy;
+ * if (Ifx_SeqLock_read(sensorSnapshot, &copy) != 0)
+ * {
+ *     // copy is consistent
+ * }
+ * \endcode
+ *
+ */
+
+#ifndef IFX_SEQLOCK_H
+#define IFX_SEQLOCK_H 1
+//------------------------------------------------------------------------------
+#include "Ifx_Cfg.h"
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+//------------------------------------------------------------------------------
+
+/** \brief Barrier executed by the writer: the preceding writes are visible to the other CPUs before the following ones.
+ * The data and the sequence are data accesses, no __isync() is required */
+#define IFX_SEQLOCK_WRITE_BARRIER() __dsync()
+
+/** \brief Barrier executed by the reader: the preceding reads are completed before the following ones */
+#define IFX_SEQLOCK_READ_BARRIER()  __dsync()
+
+/** \brief Size in bytes of the memory required by \ref Ifx_SeqLock_initSnapshot() for a snapshot of size bytes */
+#define IFX_SEQLOCK_SNAPSHOT_SIZE(size) (sizeof(Ifx_SeqLock_Snapshot) + (2 * (size)) + 4)
+
+/** \addtogroup IfxLld_lib_datahandling_seqlock
+ * \{ */
+
+/** Sequence lock
+ *
+ */
+typedef struct
+{
+    volatile uint32 sequence;       /**< \brief incremented by the writer, odd while the data is updated in place */
+} Ifx_SeqLock;
+
+/** Double buffered snapshot
+ *
+ */
+typedef struct
+{
+    Ifx_SeqLock      lock;          /**< \brief number of published copies, the last one is in buffer[sequence & 1] */
+    volatile uint32 *buffer[2];     /**< \brief copies of the data, global address, aligned on 32 bit */
+    uint16           words;         /**< \brief size of one copy in 32 bit words */
+} Ifx_SeqLock_Snapshot;
+
+/** \brief Initialize a snapshot
+ *
+ * \param memory Specifies the snapshot object address. The size of this area must be at least \ref IFX_SEQLOCK_SNAPSHOT_SIZE(size)
+ * \param size Specifies the size of the data in bytes, multiple of 4. The data is copied with 32 bit accesses
+ *
+ * \return Returns the global address of the snapshot object, to be used by the writer and the reader CPUs
+ */
+IFX_EXTERN Ifx_SeqLock_Snapshot *Ifx_SeqLock_initSnapshot(void *memory, Ifx_SizeT size);
+
+/** \brief Publish a new copy of the data
+ *
+ * Must be called by the writer CPU. The call does not wait for the readers.
+ * \param snapshot Pointer on the snapshot object
+ * \param data Pointer to the data, aligned on 32 bit, size given to \ref Ifx_SeqLock_initSnapshot()
+ *
+ * \return void
+ */
+IFX_EXTERN void Ifx_SeqLock_publish(Ifx_SeqLock_Snapshot *snapshot, const void *data);
+
+/** \brief Read a consistent copy of the last published data
+ *
+ * Can be called by any CPU, the read is repeated if a new copy is published meanwhile.
+ * \param snapshot Pointer on the snapshot object
+ * \param data Pointer to the data buffer, aligned on 32 bit, size given to \ref Ifx_SeqLock_initSnapshot()
+ *
+ * \return Returns the sequence of the copy, 0 if no copy has been published yet (data is then not written)
+ */
+IFX_EXTERN uint32 Ifx_SeqLock_read(Ifx_SeqLock_Snapshot *snapshot, void *data);
+
+/** \brief Start a read of data protected by the sequence lock
+ *
+ * \param lock Pointer on the sequence lock
+ *
+ * \return Returns the sequence to be given to \ref Ifx_SeqLock_readRetry()
+ */
+IFX_INLINE uint32 Ifx_SeqLock_readBegin(Ifx_SeqLock *lock)
+{
+    uint32 sequence = lock->sequence;
+    IFX_SEQLOCK_READ_BARRIER();
+    return sequence;
+}
+
+
+/** \brief Indicates if the read of data protected by the sequence lock must be repeated
+ *
+ * \param lock Pointer on the sequence lock
+ * \param sequence Value returned by \ref Ifx_SeqLock_readBegin()
+ *
+ * \retval TRUE if the data was updated during the read
+ * \retval FALSE if the data read is consistent
+ */
+IFX_INLINE boolean Ifx_SeqLock_readRetry(Ifx_SeqLock *lock, uint32 sequence)
+{
+    IFX_SEQLOCK_READ_BARRIER();
+    return ((sequence & 1) != 0) || (sequence != lock->sequence);
+}
+
+
+/** \brief Start an update in place of data protected by the sequence lock
+ *
+ * Must be called by the writer CPU, followed by \ref Ifx_SeqLock_writeEnd().
+ * \param lock Pointer on the sequence lock
+ *
+ * \return void
+ */
+IFX_INLINE void Ifx_SeqLock_writeBegin(Ifx_SeqLock *lock)
+{
+    lock->sequence++;
+    IFX_SEQLOCK_WRITE_BARRIER();
+}
+
+
+/** \brief End an update in place of data protected by the sequence lock
+ *
+ * \param lock Pointer on the sequence lock
+ *
+ * \return void
+ */
+IFX_INLINE void Ifx_SeqLock_writeEnd(Ifx_SeqLock *lock)
+{
+    IFX_SEQLOCK_WRITE_BARRIER();
+    lock->sequence++;
+}
+
+
+/**\}*/
+//------------------------------------------------------------------------------
+#endif
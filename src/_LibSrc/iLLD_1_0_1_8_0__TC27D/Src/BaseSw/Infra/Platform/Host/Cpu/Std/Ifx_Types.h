@@ -0,0 +1,238 @@
+/**
+ * \file Ifx_Types.h
+ * \brief Types used by the IFX HAL and libraries, host build
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup IfxLld_Platform_Host Host build
+ * \ingroup IfxLld_Platform
+ *
+ * The headers of Infra/Platform/Host replace the target headers Cpu/Std/Ifx_Types.h, Cpu/Std/IfxCpu_Intrinsics.h,
+ * Cpu/Std/IfxCpu.h and SysSe/Bsp/Bsp.h, so that the target independent library modules (SysSe/Math,
+ * _Lib/DataHandling) are compiled unmodified by a PC compiler (gcc, clang): the host include directory is passed
+ * before the library include directories.
+ *
+ * Only the portable part of the target headers is provided: types, compiler keywords, intrinsics written in C,
+ * one CPU without interrupts and the time base on the host monotonic clock. Modules accessing the SFRs do not
+ * compile against the host headers.
+ *
+ * The library casts pointers to uint32, the data model shall therefore be 32 bit (gcc -m32), or the addresses
+ * shall be below 4 GByte (static data of a non position independent executable, gcc -no-pie).
+ */
+
+#ifndef IFX_TYPES_H
+#define IFX_TYPES_H 1
+
+/******************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+#include "Ifx_Cfg.h"
+
+/*******************************************************************************
+**                      Compiler keywords                                     **
+*******************************************************************************/
+#ifndef IFX_STATIC
+#define IFX_STATIC         static
+#endif
+
+#ifndef IFX_CONST
+#define IFX_CONST          const
+#endif
+
+#ifndef CONST_CFG
+#define CONST_CFG          const
+#endif
+
+#ifdef __cplusplus
+#define IFX_EXTERN         extern "C"
+#else
+#define IFX_EXTERN         extern
+#endif
+
+#ifndef NULL_PTR
+#define NULL_PTR           ((void *)0)
+#endif
+
+#ifndef CFG_LONG_SIZE_T
+#define CFG_LONG_SIZE_T    (0)
+#endif
+
+#ifndef IFX_INLINE
+#define IFX_INLINE         static inline
+#endif
+
+#define IFX_PACKED         __attribute__ ((packed))
+#define IFX_ALIGN(n)       __attribute__ ((aligned(n)))
+#define COMPILER_NAME      "HOST"
+#define COMPILER_VERSION   __VERSION__
+#define COMPILER_REVISION  0
+
+/** \brief Interrupt service routines are plain functions, called by the host test code */
+#define IFX_INTERRUPT(isr, vectabNum, prio) void isr(void)
+#define IFX_INTERRUPT_FAST IFX_INTERRUPT
+
+/* Memory placement has no meaning on the host */
+#define IFX_FAR_ABS
+#define IFX_NEAR_ABS
+#define IFX_REL_A0
+#define IFX_REL_A1
+#define IFX_REL_A8
+#define IFX_REL_A9
+#define IFX_HOT_CODE_CPU0
+#define IFX_HOT_CODE_CPU1
+#define IFX_HOT_CODE_CPU2
+#define IFX_FAST_DATA_CPU0
+#define IFX_FAST_DATA_CPU1
+#define IFX_FAST_DATA_CPU2
+#define IFX_LMU_DATA
+#define IFX_NO_INIT_DATA
+
+#ifndef IFX_HOT_CODE
+#define IFX_HOT_CODE
+#endif
+
+#ifndef IFX_DMA_BUFFER
+#define IFX_DMA_BUFFER
+#endif
+
+/*******************************************************************************
+**                      Platform types, same sizes as on the target           **
+*******************************************************************************/
+#define CPU_TYPE_32            32
+#define MSB_FIRST              0
+#define LSB_FIRST              1
+#define HIGH_BYTE_FIRST        0
+#define LOW_BYTE_FIRST         1
+#define HIGH_WORD_FIRST        0
+#define LOW_WORD_FIRST         1
+#define CPU_TYPE               CPU_TYPE_32
+#define CPU_BIT_ORDER          LSB_FIRST
+#define CPU_BYTE_ORDER         LOW_BYTE_FIRST
+#define CPU_WORD_ORDER         LOW_WORD_FIRST
+
+typedef int8_t   sint8;                     /*        -128 .. +127            */
+typedef uint8_t  uint8;                     /*           0 .. 255             */
+typedef int16_t  sint16;                    /*      -32768 .. +32767          */
+typedef uint16_t uint16;                    /*           0 .. 65535           */
+typedef int32_t  sint32;                    /* -2147483648 .. +2147483647     */
+typedef uint32_t uint32;                    /*           0 .. 4294967295      */
+typedef float    float32;
+typedef double   float64;
+typedef uint32_t uint8_least;               /* At least 8 bit                 */
+typedef uint32_t uint16_least;              /* At least 16 bit                */
+typedef uint32_t uint32_least;              /* At least 32 bit                */
+typedef int32_t  sint8_least;               /* At least 7 bit + 1 bit sign    */
+typedef int32_t  sint16_least;              /* At least 15 bit + 1 bit sign   */
+typedef int32_t  sint32_least;              /* At least 31 bit + 1 bit sign   */
+typedef uint8_t  boolean;                   /* for use with TRUE/FALSE        */
+
+#ifndef TRUE
+#define TRUE  1
+#endif
+
+#ifndef FALSE
+#define FALSE 0
+#endif
+
+/*******************************************************************************
+**                      Global Data Types                                     **
+*******************************************************************************/
+typedef int64_t            sint64;
+typedef uint64_t           uint64;
+
+typedef const char        *pchar;
+typedef void              *pvoid;
+typedef volatile void     *vvoid;
+typedef void              (*voidfuncvoid) (void);
+
+typedef struct
+{
+    float32 real;               /**< \brief Real part */
+    float32 imag;               /**< \brief Imaginary part */
+} cfloat32;
+
+typedef struct
+{
+    sint32 real;                /**< \brief Real part */
+    sint32 imag;                /**< \brief Imaginary part */
+} csint32;
+
+typedef struct
+{
+    sint16 real;                /**< \brief Real part */
+    sint16 imag;                /**< \brief Imaginary part */
+} csint16;
+
+typedef sint64 Ifx_TickTime;    /**< \brief Time in ticks */
+#define TIME_INFINITE ((Ifx_TickTime)0x7FFFFFFFFFFFFFFFLL)
+#define TIME_NULL     ((Ifx_TickTime)0x0000000000000000LL)
+
+#define IFX_ONES      (0xFFFFFFFFFFFFFFFFU)
+#define IFX_ZEROS     (0x0000000000000000U)
+
+#if CFG_LONG_SIZE_T
+#define IFX_SIZET_MAX (0x7FFFFFFFL)
+typedef sint32 Ifx_SizeT;       /**< \brief Type used for data stream size */
+#else
+#define IFX_SIZET_MAX (0x7FFF)
+typedef sint16 Ifx_SizeT;       /**< \brief Type used for data stream size */
+#endif
+
+/** \brief Circular buffer definition. */
+typedef struct
+{
+    void  *base;                /**< \brief buffer base address */
+    uint16 index;               /**< \brief buffer current index */
+    uint16 length;              /**< \brief buffer length*/
+} Ifx_CircularBuffer;
+
+typedef uint16 Ifx_Priority;
+typedef uint32 Ifx_TimerValue;
+typedef sint32 Ifx_SignedTimerVal;
+typedef pvoid  Ifx_AddressValue;
+
+/* Fractional types of the target compilers, stored in integers */
+#define FRACT_MAX 0x7fffffff
+typedef int32_t  fract;
+typedef int16_t  sfract;
+typedef int64_t  laccum;
+typedef int32_t  __packb;
+typedef uint32_t __upackb;
+typedef int32_t  __packhw;
+typedef uint32_t __upackhw;
+
+typedef struct
+{
+    fract real;                 /**< \brief Real part */
+    fract imag;                 /**< \brief Imaginary part */
+} cfract;
+
+typedef struct
+{
+    sfract real;                /**< \brief Real part */
+    sfract imag;                /**< \brief Imaginary part */
+} csfract;
+
+#define IFX_PI                  (3.1415926535897932384626433832795f)
+#define IFX_TWO_OVER_PI         (2.0 / IFX_PI)
+#define IFX_ONE_OVER_SQRT_THREE (0.57735026918962576450914878050196f)
+#define IFX_SQRT_TWO            (1.4142135623730950488016887242097f)
+#define IFX_SQRT_THREE          (1.7320508075688772935274463415059f)
+
+#endif /* IFX_TYPES_H */
@@ -0,0 +1,154 @@
+/**
+ * \file Bsp.h
+ * \brief Board support time base, host build
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \ingroup IfxLld_Platform_Host
+ *
+ * The time functions of the board support package on the host monotonic clock: one tick is one nanosecond, the
+ * time constants are fixed. The interrupt lock functions map to the emulated interrupt state of IfxCpu.h.
+ */
+#ifndef BSP_H
+#define BSP_H 1
+
+/******************************************************************************/
+#include <time.h>
+#include "Cpu/Std/Ifx_Types.h"
+#include "Cpu/Std/IfxCpu.h"
+
+/******************************************************************************/
+#define TimeConst_0s    ((Ifx_TickTime)0)               /**< \brief time constant equal to 0s */
+#define TimeConst_10ns  ((Ifx_TickTime)10)              /**< \brief time constant equal to 10ns */
+#define TimeConst_100ns ((Ifx_TickTime)100)             /**< \brief time constant equal to 100ns */
+#define TimeConst_1us   ((Ifx_TickTime)1000)            /**< \brief time constant equal to 1us */
+#define TimeConst_10us  ((Ifx_TickTime)10000)           /**< \brief time constant equal to 10us */
+#define TimeConst_100us ((Ifx_TickTime)100000)          /**< \brief time constant equal to 100us */
+#define TimeConst_1ms   ((Ifx_TickTime)1000000)         /**< \brief time constant equal to 1ms */
+#define TimeConst_10ms  ((Ifx_TickTime)10000000)        /**< \brief time constant equal to 10ms */
+#define TimeConst_100ms ((Ifx_TickTime)100000000)       /**< \brief time constant equal to 100ms */
+#define TimeConst_1s    ((Ifx_TickTime)1000000000)      /**< \brief time constant equal to 1s */
+#define TimeConst_10s   ((Ifx_TickTime)10000000000LL)   /**< \brief time constant equal to 10s */
+#define TimeConst_100s  ((Ifx_TickTime)100000000000LL)  /**< \brief time constant equal to 100s */
+
+/******************************************************************************/
+IFX_INLINE boolean disableInterrupts(void)
+{
+    return IfxCpu_disableInterrupts();
+}
+
+
+IFX_INLINE void enableInterrupts(void)
+{
+    IfxCpu_enableInterrupts();
+}
+
+
+IFX_INLINE void restoreInterrupts(boolean enabled)
+{
+    IfxCpu_restoreInterrupts(enabled);
+}
+
+
+/** \brief Nothing to initialise, the time constants are fixed */
+IFX_INLINE void initTime(void)
+{}
+
+
+/** \brief Return the monotonic clock in ns */
+IFX_INLINE Ifx_TickTime now(void)
+{
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return ((Ifx_TickTime)time.tv_sec * TimeConst_1s) + (Ifx_TickTime)time.tv_nsec;
+}
+
+
+IFX_INLINE uint32 nowFast32(void)
+{
+    return (uint32)now();
+}
+
+
+IFX_INLINE Ifx_TickTime nowWithoutCriticalSection(void)
+{
+    return now();
+}
+
+
+IFX_INLINE Ifx_TickTime addTTime(Ifx_TickTime a, Ifx_TickTime b)
+{
+    return ((a == TIME_INFINITE) || (b == TIME_INFINITE)) ? TIME_INFINITE : (a + b);
+}
+
+
+IFX_INLINE Ifx_TickTime elapsed(Ifx_TickTime since)
+{
+    return now() - since;
+}
+
+
+IFX_INLINE uint32 elapsedFast32(uint32 since)
+{
+    return nowFast32() - since;
+}
+
+
+IFX_INLINE Ifx_TickTime getDeadLine(Ifx_TickTime timeout)
+{
+    return (timeout == TIME_INFINITE) ? TIME_INFINITE : (now() + timeout);
+}
+
+
+IFX_INLINE Ifx_TickTime getTimeout(Ifx_TickTime deadline)
+{
+    return (deadline == TIME_INFINITE) ? TIME_INFINITE : (deadline - now());
+}
+
+
+IFX_INLINE boolean isDeadLine(Ifx_TickTime deadLine)
+{
+    return (deadLine == TIME_INFINITE) ? FALSE : (boolean)(now() >= deadLine);
+}
+
+
+IFX_INLINE boolean poll(volatile boolean *test, Ifx_TickTime timeout)
+{
+    Ifx_TickTime deadLine = getDeadLine(timeout);
+
+    while ((*test == FALSE) && (isDeadLine(deadLine) == FALSE))
+    {}
+
+    return *test;
+}
+
+
+IFX_INLINE void wait(Ifx_TickTime timeout)
+{
+    Ifx_TickTime deadLine = getDeadLine(timeout);
+
+    while (isDeadLine(deadLine) == FALSE)
+    {}
+}
+
+
+/******************************************************************************/
+#endif /* BSP_H */
@@ -42,4 +42,25 @@ void Ifx_C_Init(void)
 }
 
 
+/*!
+ * \brief   Initializes the C variables located in the scratchpad of one core
+ *
+ * The startup code of this compiler does not allow to split the initialization: core 0 initializes all the
+ * variables and the other cores return immediately. IFX_CFG_CPU_CSTART_PARALLEL_C_INIT is therefore refused by
+ * IfxCpu_CStart.h for this compiler.
+ *
+ * Parameters: core: index of the calling core, coreMask: cores initializing their own variables
+ * Return: Nil
+ */
+void Ifx_C_InitCore(unsigned int core, unsigned int coreMask)
+{
+    (void)coreMask;
+
+    if (core == 0)
+    {
+        Ifx_C_Init();
+    }
+}
+
+
 #endif
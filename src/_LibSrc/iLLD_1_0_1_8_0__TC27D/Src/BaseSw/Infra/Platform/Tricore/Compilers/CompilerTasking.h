@@ -139,5 +139,20 @@
 #define IFX_REL_A9 __a9
 #endif
 /******************************************************************************/
+/*Memory placement: PSPR code copied and DSPR data initialised by Ifx_C_Init() */
+#define IFX_HOT_CODE_CPU0  __attribute__ ((asection(".text.psram_cpu0", "f=ax")))
+#define IFX_HOT_CODE_CPU1  __attribute__ ((asection(".text.psram_cpu1", "f=ax")))
+#define IFX_HOT_CODE_CPU2  __attribute__ ((asection(".text.psram_cpu2", "f=ax")))
+
+#define IFX_FAST_DATA_CPU0 __attribute__ ((asection(".data.data_cpu0", "f=aw")))
+#define IFX_FAST_DATA_CPU1 __attribute__ ((asection(".data.data_cpu1", "f=aw")))
+#define IFX_FAST_DATA_CPU2 __attribute__ ((asection(".data.data_cpu2", "f=aw")))
+
+/*LMU data initialised by Ifx_C_Init(), cached: shared data is accessed through IFXCPU_NON_CACHED_ADDR() */
+#define IFX_LMU_DATA       __attribute__ ((asection(".data_lmu", "f=aw")))
+
+/*Data not initialised by Ifx_C_Init(), kept over a reset: the linker file shall not list the .noinit sections in the C initialisation tables */
+#define IFX_NO_INIT_DATA   __attribute__ ((asection(".noinit", "f=aw")))
+/******************************************************************************/
 
 #endif /* COMPILERTASKING_H */
@@ -94,6 +94,18 @@
 #error "Compiler unsupported"
 #endif
 
+/* Placement of the iLLD interrupt paths (ASC, QSPI, FIFO, circular buffer), in flash by default.
+ * e.g. #define IFX_HOT_CODE IFX_HOT_CODE_CPU0 in Ifx_Cfg.h to execute them from the PSPR of CPU0 */
+#ifndef IFX_HOT_CODE
+#define IFX_HOT_CODE
+#endif
+
+/* Placement of the buffers shared between the CPU and the DMA, in the DSPR of CPU0 by default which is never
+ * data cached. Buffers in a cached flash / LMU segment require IfxCpu_flushDataCache() around each transfer */
+#ifndef IFX_DMA_BUFFER
+#define IFX_DMA_BUFFER IFX_FAST_DATA_CPU0
+#endif
+
 #if defined(__GNUC__)
 #define BEGIN_DATA_SECTION(sec) DATA_SECTION(section #sec aw 4)
 #define DATA_SECTION(sec) _Pragma(#sec)
@@ -118,6 +130,10 @@
 /* Functions prototypes                                                       */
 /******************************************************************************/
 void Ifx_C_Init(void);
+
+/* Initializes the C variables located in the scratchpad of one core. core 0 initializes all the remaining
+ * variables. coreMask: bit n set if core n initializes its own variables, else core 0 initializes them */
+void Ifx_C_InitCore(unsigned int core, unsigned int coreMask);
 /******************************************************************************/
 
 
@@ -88,6 +88,22 @@
  * TCxxx/\<Module\>/Ifx\<Module\>_\<interface\>.h/c      | Specific standard interface wrapper initialization API are reconized by the name Ifx<Module>_<interface>_StdIf<std interface>Init()
  * TCxxx/\<Module\>/Ifx\<Module\>_\<interface\>.h/c      | Specific standard interface wrapper function API are named according to the interface driver naming rules
  *
+ *
+ * \par Compile-time binding
+ *
+ * When a translation unit uses a standard interface with a single interface driver in a time critical loop, the time critical functions can be
+ * bound at compile time to the interface driver functions. The call through the function pointer is replaced by a direct call which the compiler
+ * can inline. The binding applies to the translation unit only, the other translation units keep the function pointers, and the standard interface
+ * object shall still be initialized by the wrapper. The interface driver shall implement the bound functions under the names \<prefix\>_\<function\>(),
+ * see IFXSTDIF_\<standard interface\>_BIND() for the list of the bound functions.
+ *
+ * \code
+ * #define IFXSTDIF_POS_BOUND                     // before any include: the function pointer implementation is not defined
+ * #include "Gpt12/IncrEnc/IfxGpt12_IncrEnc.h"
+ *
+ * IFXSTDIF_POS_BIND(IfxGpt12_IncrEnc)            // IfxStdIf_Pos_update() calls IfxGpt12_IncrEnc_update(), ...
+ * \endcode
+ *
  */
 
 #ifndef IFXSTDIF_H_
@@ -23,6 +23,7 @@
  */
 
 #include "Assert.h"
+#include "Cpu/Std/IfxCpu.h"
 
 #if IFX_CFG_ASSERT_STDIO == 1
 /** Current standard IO used for the IFX_ASSERT and IFX_VALIDATE */
@@ -33,6 +34,14 @@ IfxStdIf_DPipe *Assert_io = NULL_PTR;
 uint32          Assert_verboseLevel = IFX_CFG_ASSERT_VERBOSE_LEVEL_DEFAULT;
 #endif
 
+#if IFX_CFG_ASSERT_LOG == 1
+Ifx_Assert_Log         Assert_log;
+#    if IFX_CFG_CPU_SINGLE_CORE == 0
+/** Lock of \ref Assert_log, the assertions of all CPUs are stored in the same ring */
+static IfxCpu_spinLock Assert_logLock = 0;
+#    endif
+#endif
+
 #if IFX_CFG_ASSERT_STDIO == 1
 void Ifx_Assert_setStandardIo(IfxStdIf_DPipe *standardIo)
 {
@@ -105,3 +114,64 @@ boolean Ifx_Assert_doValidate(boolean expr, uint8 level, pchar __assertion, pcha
 
     return expr;
 }
+
+
+#if (IFX_CFG_ASSERT_VERBOSE_LEVEL_DEFAULT > IFX_VERBOSE_LEVEL_OFF) && (IFX_CFG_ASSERT_LOG == 1)
+/** Store a record in \ref Assert_log
+ * \param pc return address of the assertion call
+ */
+static void Ifx_Assert_storeRecord(uint32 pc, uint8 level, uint8 module, uint16 line)
+{
+    boolean            interruptState = IfxCpu_disableInterrupts();
+    Ifx_Assert_Record *record;
+
+#if IFX_CFG_CPU_SINGLE_CORE == 0
+    IfxCpu_setSpinLock(&Assert_logLock, 0xFFFF);
+#endif
+
+    record         = &Assert_log.records[Assert_log.count & (IFX_CFG_ASSERT_LOG_SIZE - 1)];
+    record->pc     = pc;
+    record->line   = line;
+    record->module = module;
+    record->level  = level;
+    Assert_log.count++;
+
+#if IFX_CFG_CPU_SINGLE_CORE == 0
+    IfxCpu_resetSpinLock(&Assert_logLock);
+#endif
+    IfxCpu_restoreInterrupts(interruptState);
+
+#if IFX_CFG_ASSERT_USE_BREAKPOINT == 1
+
+    if (level <= IFX_VERBOSE_LEVEL_ERROR)
+    {
+        __debug();
+    }
+
+#endif
+}
+
+
+void Ifx_Assert_doLog(uint8 level, uint8 module, uint16 line)
+{
+    /* read first: the return address is the one of the assertion call */
+    uint32 pc = (uint32)__getA11();
+
+    Ifx_Assert_storeRecord(pc, level, module, line);
+}
+
+
+boolean Ifx_Assert_doValidateLog(boolean expr, uint8 level, uint8 module, uint16 line)
+{
+    uint32 pc = (uint32)__getA11();
+
+    if (!((expr) || (level > Assert_verboseLevel)))
+    {
+        Ifx_Assert_storeRecord(pc, level, module, line);
+    }
+
+    return expr;
+}
+
+
+#endif
@@ -0,0 +1,271 @@
+/**
+ * \file Ifx_CanDispatch.c
+ * \brief CAN frame dispatch table
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include <string.h>
+
+#include "Ifx_CanDispatch.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/** Number of data bytes of each data length code */
+static const uint8 Ifx_CanDispatch_dataLength[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
+
+/** Fibonacci hash of the CAN ID, returns the index slot
+ */
+IFX_INLINE uint32 Ifx_CanDispatch_hash(Ifx_CanDispatch *dispatch, uint32 id)
+{
+    return (id * 2654435761UL) >> dispatch->indexShift;
+}
+
+
+/** Byte swap of a 32 bit word
+ */
+IFX_INLINE uint32 Ifx_CanDispatch_swap(uint32 value)
+{
+    return (value << 24) | ((value & 0xFF00U) << 8) | ((value >> 8) & 0xFF00U) | (value >> 24);
+}
+
+
+/** Returns the position of the LSB of the signal in the 64 bit payload, -1 if the signal does not fit.
+ * For Motorola signals the position refers to the byte swapped payload (byte 0 in bits 63..56)
+ */
+static sint32 Ifx_CanDispatch_getSignalLsb(const Ifx_CanDispatch_Signal *signal)
+{
+    sint32 lsb;
+
+    if (signal->byteOrder == Ifx_CanDispatch_ByteOrder_intel)
+    {
+        lsb = ((signal->startBit + signal->length) <= 64) ? (sint32)signal->startBit : -1;
+    }
+    else
+    {
+        lsb = (((7 - (signal->startBit / 8)) * 8) + (signal->startBit % 8)) - (signal->length - 1);
+    }
+
+    return lsb;
+}
+
+
+/** Extract the signal from the payload and update its variable
+ */
+static void Ifx_CanDispatch_decodeSignal(const Ifx_CanDispatch_Signal *signal, const IfxMultican_Message *msg)
+{
+    uint64 payload;
+    uint32 mask = (signal->length >= 32) ? 0xFFFFFFFFUL : ((1UL << signal->length) - 1);
+    uint32 raw;
+
+    if (signal->byteOrder == Ifx_CanDispatch_ByteOrder_intel)
+    {
+        payload = ((uint64)msg->data[1] << 32) | msg->data[0];
+    }
+    else
+    {
+        payload = ((uint64)Ifx_CanDispatch_swap(msg->data[0]) << 32) | Ifx_CanDispatch_swap(msg->data[1]);
+    }
+
+    raw = (uint32)(payload >> Ifx_CanDispatch_getSignalLsb(signal)) & mask;
+
+    if ((signal->isSigned != FALSE) && (signal->length < 32) && ((raw >> (signal->length - 1)) != 0))
+    {
+        raw |= ~mask;
+    }
+
+    if (signal->type == Ifx_CanDispatch_SignalType_raw)
+    {
+        *(uint32 *)signal->value = raw;
+    }
+    else if (signal->isSigned != FALSE)
+    {
+        *(float32 *)signal->value = ((float32)(sint32)raw * signal->factor) + signal->offset;
+    }
+    else
+    {
+        *(float32 *)signal->value = ((float32)raw * signal->factor) + signal->offset;
+    }
+}
+
+
+boolean Ifx_CanDispatch_dispatch(Ifx_CanDispatch *dispatch, const IfxMultican_Message *msg)
+{
+    const Ifx_CanDispatch_Frame *frame = Ifx_CanDispatch_find(dispatch, msg->id);
+    boolean                      result;
+
+    dispatch->frames++;
+
+    if (frame == NULL_PTR)
+    {
+        dispatch->unknownFrames++;
+        result = FALSE;
+    }
+    else if (Ifx_CanDispatch_dataLength[msg->lengthCode & 0xFU] < frame->minLength)
+    {
+        dispatch->shortFrames++;
+        result = FALSE;
+    }
+    else
+    {
+        uint32 i;
+
+        for (i = 0; i < frame->signalCount; i++)
+        {
+            Ifx_CanDispatch_decodeSignal(&frame->signals[i], msg);
+        }
+
+        if (frame->handler != NULL_PTR)
+        {
+            frame->handler(frame, msg);
+        }
+
+        result = TRUE;
+    }
+
+    return result;
+}
+
+
+const Ifx_CanDispatch_Frame *Ifx_CanDispatch_find(Ifx_CanDispatch *dispatch, uint32 id)
+{
+    uint32 slot = Ifx_CanDispatch_hash(dispatch, id);
+
+    while (dispatch->index[slot].frame != NULL_PTR)
+    {
+        if (dispatch->index[slot].id == id)
+        {
+            return dispatch->index[slot].frame;
+        }
+
+        slot = (slot + 1) & dispatch->indexMask;
+    }
+
+    return NULL_PTR;
+}
+
+
+boolean Ifx_CanDispatch_init(Ifx_CanDispatch *dispatch, const Ifx_CanDispatch_Config *config)
+{
+    uint32  i;
+    uint32  j;
+    uint32  bits   = 0;
+    boolean result = (config->frames != NULL_PTR) && (config->index != NULL_PTR)
+                     && (config->indexSize > config->frameCount) && ((config->indexSize & (config->indexSize - 1)) == 0);
+
+    dispatch->msgObj        = config->msgObj;
+    dispatch->index         = config->index;
+    dispatch->indexMask     = config->indexSize - 1;
+    dispatch->maxProbes     = 0;
+    dispatch->frames        = 0;
+    dispatch->unknownFrames = 0;
+    dispatch->shortFrames   = 0;
+
+    while ((1UL << bits) < config->indexSize)
+    {
+        bits++;
+    }
+
+    dispatch->indexShift = 32 - bits;
+
+    if (result != FALSE)
+    {
+        memset(dispatch->index, 0, config->indexSize * sizeof(Ifx_CanDispatch_IndexEntry));
+    }
+
+    for (i = 0; (i < config->frameCount) && (result != FALSE); i++)
+    {
+        const Ifx_CanDispatch_Frame *frame  = &config->frames[i];
+        uint32                       slot   = Ifx_CanDispatch_hash(dispatch, frame->id);
+        uint32                       probes = 1;
+
+        for (j = 0; j < frame->signalCount; j++)
+        {
+            const Ifx_CanDispatch_Signal *signal = &frame->signals[j];
+
+            result = result && (signal->value != NULL_PTR) && (signal->length >= 1) && (signal->length <= 32)
+                     && (signal->startBit < 64) && (Ifx_CanDispatch_getSignalLsb(signal) >= 0);
+        }
+
+        while ((dispatch->index[slot].frame != NULL_PTR) && (result != FALSE))
+        {
+            result = dispatch->index[slot].id != frame->id;
+            slot   = (slot + 1) & dispatch->indexMask;
+            probes++;
+        }
+
+        if (result != FALSE)
+        {
+            dispatch->index[slot].id    = frame->id;
+            dispatch->index[slot].frame = frame;
+            dispatch->maxProbes         = __max(dispatch->maxProbes, probes);
+        }
+    }
+
+    if ((config->maxProbes != 0) && (dispatch->maxProbes > config->maxProbes))
+    {
+        result = FALSE;
+    }
+
+    if (result == FALSE)
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+
+        if (config->index != NULL_PTR)
+        {
+            memset(config->index, 0, config->indexSize * sizeof(Ifx_CanDispatch_IndexEntry));
+        }
+    }
+
+    return result;
+}
+
+
+void Ifx_CanDispatch_initConfig(Ifx_CanDispatch_Config *config)
+{
+    config->msgObj     = NULL_PTR;
+    config->frames     = NULL_PTR;
+    config->frameCount = 0;
+    config->index      = NULL_PTR;
+    config->indexSize  = 0;
+    config->maxProbes  = 0;
+}
+
+
+uint32 Ifx_CanDispatch_process(Ifx_CanDispatch *dispatch)
+{
+    IfxMultican_Message msgs[IFX_CFG_CANDISPATCH_BATCH_SIZE];
+    uint32              total = 0;
+    uint32              count;
+
+    do
+    {
+        uint32 i;
+
+        count = IfxMultican_Can_MsgObj_readMessages(dispatch->msgObj, msgs, IFX_CFG_CANDISPATCH_BATCH_SIZE);
+
+        for (i = 0; i < count; i++)
+        {
+            Ifx_CanDispatch_dispatch(dispatch, &msgs[i]);
+        }
+
+        total += count;
+    } while (count == IFX_CFG_CANDISPATCH_BATCH_SIZE);
+
+    return total;
+}
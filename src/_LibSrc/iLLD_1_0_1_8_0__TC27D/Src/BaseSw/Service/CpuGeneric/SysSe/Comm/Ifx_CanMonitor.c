@@ -0,0 +1,324 @@
+/**
+ * \file Ifx_CanMonitor.c
+ * \brief MultiCAN bus load, error and transmit latency statistics
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include <string.h>
+
+#include "Ifx_CanMonitor.h"
+#include "SysSe/Bsp/Bsp.h"
+#include "SysSe/Comm/Ifx_Shell.h"
+
+/** \brief Node state flags, rising edges are counted */
+#define IFX_CANMONITOR_FLAG_WARNING  (1U << 0)
+#define IFX_CANMONITOR_FLAG_BUS_OFF  (1U << 1)
+
+/** \brief Frame count selection: foreign, received and transmitted frames (NFCR.CFSEL) */
+#define IFX_CANMONITOR_CFSEL_ALL     (7U)
+
+/** \brief Mask of NSR.LEC */
+#define IFX_CANMONITOR_LEC_MASK      (7U)
+
+/** \brief Standard frame length without data nor stuff bits: SOF, ID, control, CRC, ACK, EOF and intermission */
+#define IFX_CANMONITOR_FRAME_BITS    (47U)
+
+static void Ifx_CanMonitor_clearMsgObj(Ifx_CanMonitor_MsgObj *msgObj)
+{
+    msgObj->pending       = FALSE;
+    msgObj->count         = 0;
+    msgObj->minimum       = 0;
+    msgObj->maximum       = 0;
+    msgObj->sum           = 0;
+    msgObj->countAtUpdate = 0;
+    msgObj->sumAtUpdate   = 0;
+    msgObj->averageUs     = 0.0F;
+}
+
+
+static void Ifx_CanMonitor_clearNode(Ifx_CanMonitor_Node *node)
+{
+    node->frameCounter    = (uint16)node->node->FCR.B.CFC;
+    node->frames          = 0;
+    node->errors          = 0;
+    node->errorsAtUpdate  = 0;
+    node->txErrors        = 0;
+    node->warningEvents   = 0;
+    node->busOffEvents    = 0;
+    node->busLoad         = 0.0F;
+    node->errorsPerSecond = 0.0F;
+    memset(node->errorCodes, 0, sizeof(node->errorCodes));
+}
+
+
+static void Ifx_CanMonitor_sampleMsgObj(Ifx_CanMonitor_MsgObj *msgObj, Ifx_TickTime time)
+{
+    boolean requested = msgObj->msgObj->STAT.B.TXRQ != 0;
+
+    if ((requested != FALSE) && (msgObj->pending == FALSE))
+    {
+        msgObj->pending     = TRUE;
+        msgObj->requestTime = time;
+    }
+    else if ((requested == FALSE) && (msgObj->pending != FALSE))
+    {
+        Ifx_TickTime latency = time - msgObj->requestTime;
+
+        if ((msgObj->count == 0) || (latency < msgObj->minimum))
+        {
+            msgObj->minimum = latency;
+        }
+
+        if (latency > msgObj->maximum)
+        {
+            msgObj->maximum = latency;
+        }
+
+        msgObj->sum    += latency;
+        msgObj->count++;
+        msgObj->pending = FALSE;
+    }
+}
+
+
+static void Ifx_CanMonitor_sampleNode(Ifx_CanMonitor_Node *node)
+{
+    Ifx_CAN_N_SR sr;
+    uint32       flags = 0;
+    uint32       rising;
+
+    sr.U = node->node->SR.U;
+
+    if (sr.B.LEC != 0)
+    {
+        /* the LEC is only updated by the hardware, it is cleared to see the next error */
+        node->node->SR.U = sr.U & ~IFX_CANMONITOR_LEC_MASK;
+        node->errors++;
+        node->errorCodes[sr.B.LEC]++;
+        node->txErrors += node->node->ECNT.B.LETD;
+    }
+
+    flags |= (sr.B.EWRN != 0) ? IFX_CANMONITOR_FLAG_WARNING : 0;
+    flags |= (sr.B.BOFF != 0) ? IFX_CANMONITOR_FLAG_BUS_OFF : 0;
+    rising = flags & ~node->flags;
+
+    node->warningEvents += (rising & IFX_CANMONITOR_FLAG_WARNING) != 0;
+    node->busOffEvents  += (rising & IFX_CANMONITOR_FLAG_BUS_OFF) != 0;
+    node->flags          = flags;
+}
+
+
+sint32 Ifx_CanMonitor_addMsgObj(Ifx_CanMonitor *monitor, pchar name, IfxMultican_Can_MsgObj *msgObj)
+{
+    sint32 id = -1;
+
+    if (monitor->msgObjCount < IFX_CFG_CANMONITOR_MAX_MSGOBJS)
+    {
+        Ifx_CanMonitor_MsgObj *entry = &monitor->msgObjs[monitor->msgObjCount];
+
+        entry->name   = name;
+        entry->msgObj = IfxMultican_MsgObj_getPointer(msgObj->node->mcan, msgObj->msgObjId);
+        Ifx_CanMonitor_clearMsgObj(entry);
+        id            = monitor->msgObjCount;
+        monitor->msgObjCount++;
+    }
+
+    return id;
+}
+
+
+sint32 Ifx_CanMonitor_addNode(Ifx_CanMonitor *monitor, pchar name, IfxMultican_Can_Node *node, uint32 baudrate, uint8 averageDlc)
+{
+    sint32 id = -1;
+
+    if ((monitor->nodeCount < IFX_CFG_CANMONITOR_MAX_NODES) && (baudrate != 0))
+    {
+        Ifx_CanMonitor_Node *entry = &monitor->nodes[monitor->nodeCount];
+        uint32               bits  = IFX_CANMONITOR_FRAME_BITS + (8U * __min(averageDlc, 8U));
+
+        entry->name      = name;
+        entry->node      = node->node;
+        entry->baudrate  = baudrate;
+        entry->frameBits = bits + (bits / 10U);
+        entry->flags     = 0;
+        strncpy(entry->errorName, name, IFX_CANMONITOR_NAME_SIZE - 4);
+        entry->errorName[IFX_CANMONITOR_NAME_SIZE - 4] = 0;
+        strcat(entry->errorName, "Err");
+
+        /* count all the frames on the bus */
+        entry->node->FCR.B.CFMOD = IfxMultican_FrameCounterMode_frameCountMode;
+        entry->node->FCR.B.CFSEL = IFX_CANMONITOR_CFSEL_ALL;
+
+        Ifx_CanMonitor_clearNode(entry);
+        id = monitor->nodeCount;
+        monitor->nodeCount++;
+    }
+
+    return id;
+}
+
+
+void Ifx_CanMonitor_addTelemetryChannels(Ifx_CanMonitor *monitor, Ifx_Telemetry *telemetry)
+{
+    uint32 i;
+
+    for (i = 0; i < monitor->nodeCount; i++)
+    {
+        Ifx_Telemetry_addChannel(telemetry, monitor->nodes[i].name, &monitor->nodes[i].busLoad, sizeof(float32));
+        Ifx_Telemetry_addChannel(telemetry, monitor->nodes[i].errorName, &monitor->nodes[i].errorsPerSecond, sizeof(float32));
+    }
+
+    for (i = 0; i < monitor->msgObjCount; i++)
+    {
+        Ifx_Telemetry_addChannel(telemetry, monitor->msgObjs[i].name, &monitor->msgObjs[i].averageUs, sizeof(float32));
+    }
+}
+
+
+void Ifx_CanMonitor_init(Ifx_CanMonitor *monitor)
+{
+    monitor->nodeCount   = 0;
+    monitor->msgObjCount = 0;
+    Ifx_CanMonitor_reset(monitor);
+}
+
+
+void Ifx_CanMonitor_reset(Ifx_CanMonitor *monitor)
+{
+    boolean interruptState = IfxCpu_disableInterrupts();
+    uint32  i;
+
+    for (i = 0; i < monitor->nodeCount; i++)
+    {
+        Ifx_CanMonitor_clearNode(&monitor->nodes[i]);
+    }
+
+    for (i = 0; i < monitor->msgObjCount; i++)
+    {
+        Ifx_CanMonitor_clearMsgObj(&monitor->msgObjs[i]);
+    }
+
+    monitor->samples    = 0;
+    monitor->updateTime = now();
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+
+void Ifx_CanMonitor_sample(Ifx_CanMonitor *monitor)
+{
+    Ifx_TickTime time = now();
+    uint32       i;
+
+    monitor->samples++;
+
+    for (i = 0; i < monitor->nodeCount; i++)
+    {
+        Ifx_CanMonitor_sampleNode(&monitor->nodes[i]);
+    }
+
+    for (i = 0; i < monitor->msgObjCount; i++)
+    {
+        Ifx_CanMonitor_sampleMsgObj(&monitor->msgObjs[i], time);
+    }
+}
+
+
+boolean Ifx_CanMonitor_show(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    Ifx_CanMonitor *monitor   = (Ifx_CanMonitor *)data;
+    float32         tickPerUs = (float32)TimeConst_1us;
+    uint32          i;
+
+    IfxStdIf_DPipe_print(io, "%u samples"ENDL, monitor->samples);
+    IfxStdIf_DPipe_print(io, "%-12s %6s %10s %8s %8s %4s %4s %6s %6s %6s %6s %6s %6s %5s %5s"ENDL,
+        "node", "load%", "frames", "errors", "err/s", "tec", "rec", "stuff", "form", "ack", "bit1", "bit0", "crc", "warn", "boff");
+
+    for (i = 0; i < monitor->nodeCount; i++)
+    {
+        Ifx_CanMonitor_Node *node = &monitor->nodes[i];
+
+        IfxStdIf_DPipe_print(io, "%-12s %6.1f %10u %8u %8.1f %4u %4u %6u %6u %6u %6u %6u %6u %5u %5u"ENDL,
+            node->name, node->busLoad * 100.0F, node->frames, node->errors, node->errorsPerSecond,
+            node->node->ECNT.B.TEC, node->node->ECNT.B.REC, node->errorCodes[1], node->errorCodes[2],
+            node->errorCodes[3], node->errorCodes[4], node->errorCodes[5], node->errorCodes[6],
+            node->warningEvents, node->busOffEvents);
+    }
+
+    IfxStdIf_DPipe_print(io, "%-12s %10s %10s %10s %10s %10s"ENDL, "msgObj", "count", "min us", "avg us", "max us", "last avg");
+
+    for (i = 0; i < monitor->msgObjCount; i++)
+    {
+        Ifx_CanMonitor_MsgObj *msgObj  = &monitor->msgObjs[i];
+        float32                average = (msgObj->count != 0) ? ((float32)msgObj->sum / (float32)msgObj->count) : 0.0F;
+
+        IfxStdIf_DPipe_print(io, "%-12s %10u %10.1f %10.1f %10.1f %10.1f"ENDL,
+            msgObj->name, msgObj->count, (float32)msgObj->minimum / tickPerUs, average / tickPerUs,
+            (float32)msgObj->maximum / tickPerUs, msgObj->averageUs);
+    }
+
+    if (Ifx_Shell_matchToken(&args, "reset") != FALSE)
+    {
+        Ifx_CanMonitor_reset(monitor);
+    }
+
+    return TRUE;
+}
+
+
+void Ifx_CanMonitor_update(Ifx_CanMonitor *monitor)
+{
+    Ifx_TickTime time    = now();
+    float32      seconds = (float32)(time - monitor->updateTime) / (float32)TimeConst_1s;
+    uint32       i;
+
+    if (seconds > 0.0F)
+    {
+        for (i = 0; i < monitor->nodeCount; i++)
+        {
+            Ifx_CanMonitor_Node *node         = &monitor->nodes[i];
+            uint16               frameCounter = (uint16)node->node->FCR.B.CFC;
+            uint32               frames       = (uint16)(frameCounter - node->frameCounter);
+            uint32               errors       = node->errors;
+
+            node->frames         += frames;
+            node->frameCounter    = frameCounter;
+            node->busLoad         = ((float32)frames * (float32)node->frameBits) / ((float32)node->baudrate * seconds);
+            node->errorsPerSecond = (float32)(errors - node->errorsAtUpdate) / seconds;
+            node->errorsAtUpdate  = errors;
+        }
+
+        for (i = 0; i < monitor->msgObjCount; i++)
+        {
+            Ifx_CanMonitor_MsgObj *msgObj = &monitor->msgObjs[i];
+            uint32                 count  = msgObj->count;
+            Ifx_TickTime           sum    = msgObj->sum;
+
+            if (count != msgObj->countAtUpdate)
+            {
+                msgObj->averageUs = ((float32)(sum - msgObj->sumAtUpdate) / (float32)(count - msgObj->countAtUpdate)) / (float32)TimeConst_1us;
+            }
+
+            msgObj->countAtUpdate = count;
+            msgObj->sumAtUpdate   = sum;
+        }
+
+        monitor->updateTime = time;
+    }
+}
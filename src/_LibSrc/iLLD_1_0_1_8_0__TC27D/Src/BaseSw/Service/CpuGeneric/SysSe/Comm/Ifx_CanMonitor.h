@@ -0,0 +1,192 @@
+/**
+ * \file Ifx_CanMonitor.h
+ * \brief MultiCAN bus load, error and transmit latency statistics
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_comm_canmonitor CAN monitor
+ * \ingroup library_srvsw_sysse_comm
+ *
+ * The CAN monitor derives bus statistics from the MultiCAN registers, without external analyser:
+ * - bus load: the node frame counter counts all the frames on the bus (foreign, received and transmitted
+ * frames). The load of an update period is frames * frame length / (baudrate * period). The frame length is
+ * estimated from the average DLC given for the node: header, data, CRC, end of frame and intermission, plus 10%
+ * stuff bits.
+ * - errors: the last error code (NSR.LEC) is sampled and cleared, each code is counted with its direction
+ * (NECNT.LETD). Several errors between two samples are counted once: the counts are a lower bound, the sample
+ * period shall be short compared to the error rate of interest. The error warning (EWRN) and bus-off (BOFF)
+ * states are counted on their rising edge, including a bus-off forced by \ref IfxMultican_Can_Node_sendToBusOff().
+ * - transmit latency: for each registered transmit message object, the time from the transmit request (MOSTAT.TXRQ
+ * set) to the transmit completion (TXRQ cleared), with minimum, maximum and average. A frame which waits long
+ * behind lower priority IDs shows priority inversion, e.g. through a transmit FIFO or another node of the same
+ * ECU. The resolution is the sample period.
+ *
+ * The frame counter of the registered nodes is set to frame count mode: the bus capture of IfxMultican_Can,
+ * which uses the time stamp mode, shall not run on a monitored node.
+ *
+ * The statistics are published with the shell command \ref Ifx_CanMonitor_show() and as telemetry channels
+ * (\ref Ifx_CanMonitor_addTelemetryChannels()).
+ *
+ * Usage example:
+ * \code
+ * static Ifx_CanMonitor canMonitor;
+ *
+ * // initialisation, after the nodes and message objects
+ * Ifx_CanMonitor_init(&canMonitor);
+ * Ifx_CanMonitor_addNode(&canMonitor, "can0", &canNode0, 500000, 8);
+ * Ifx_CanMonitor_addMsgObj(&canMonitor, "engineTx", &engineTxMsgObj);
+ * Ifx_CanMonitor_addTelemetryChannels(&canMonitor, &telemetry);
+ *
+ * // periodic interrupt, e.g. 10kHz
+ * Ifx_CanMonitor_sample(&canMonitor);
+ *
+ * // background loop, e.g. every second
+ * Ifx_CanMonitor_update(&canMonitor);
+ *
+ * // shell command list entry
+ * {"can", "   : Show the CAN statistics", &canMonitor, &Ifx_CanMonitor_show},
+ * \endcode
+ *
+ */
+#ifndef IFX_CANMONITOR_H
+#define IFX_CANMONITOR_H 1
+
+#include "Cpu/Std/Ifx_Types.h"
+#include "Multican/Can/IfxMultican_Can.h"
+#include "SysSe/Comm/Ifx_Telemetry.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_CANMONITOR_MAX_NODES)
+#define IFX_CFG_CANMONITOR_MAX_NODES   (4)    /**<\brief Maximal number of monitored nodes */
+#endif
+
+#if !defined(IFX_CFG_CANMONITOR_MAX_MSGOBJS)
+#define IFX_CFG_CANMONITOR_MAX_MSGOBJS (16)   /**<\brief Maximal number of monitored transmit message objects */
+#endif
+
+#define IFX_CANMONITOR_NAME_SIZE       (16)   /**<\brief Size of the generated telemetry channel names */
+#define IFX_CANMONITOR_NUM_ERROR_CODES (8)    /**<\brief Number of last error codes (NSR.LEC) */
+
+/** \addtogroup library_srvsw_sysse_comm_canmonitor
+ * \{ */
+
+/** \brief Statistics of one node */
+typedef struct
+{
+    pchar      name;                                         /**<\brief node name, telemetry channel of the bus load */
+    Ifx_CAN_N *node;                                         /**<\brief node registers */
+    uint32     baudrate;                                     /**<\brief nominal baudrate in bit/s */
+    uint32     frameBits;                                    /**<\brief estimated length of a frame in bits */
+    uint16     frameCounter;                                 /**<\brief NFCR.CFC at the previous update */
+    uint32     flags;                                        /**<\brief EWRN and BOFF of the previous sample */
+    uint32     frames;                                       /**<\brief number of frames on the bus */
+    uint32     errors;                                       /**<\brief number of sampled errors */
+    uint32     errorsAtUpdate;                               /**<\brief errors at the previous update */
+    uint32     txErrors;                                     /**<\brief errors detected while transmitting */
+    uint32     errorCodes[IFX_CANMONITOR_NUM_ERROR_CODES];   /**<\brief errors per last error code: 1 stuff, 2 form, 3 ack, 4 bit 1, 5 bit 0, 6 CRC */
+    uint32     warningEvents;                                /**<\brief entries into the error warning state */
+    uint32     busOffEvents;                                 /**<\brief entries into the bus-off state */
+    float32    busLoad;                                      /**<\brief bus load over the last update period, 0 .. 1 */
+    float32    errorsPerSecond;                              /**<\brief errors per second over the last update period */
+    char       errorName[IFX_CANMONITOR_NAME_SIZE];          /**<\brief telemetry channel name of the error rate: name and "Err" */
+} Ifx_CanMonitor_Node;
+
+/** \brief Transmit latency of one message object */
+typedef struct
+{
+    pchar        name;              /**<\brief message object name, telemetry channel of the average latency */
+    Ifx_CAN_MO  *msgObj;            /**<\brief message object registers */
+    boolean      pending;           /**<\brief TRUE while a transmit request is pending */
+    Ifx_TickTime requestTime;       /**<\brief sample time at which the pending request was seen first */
+    uint32       count;             /**<\brief number of measured transmissions */
+    Ifx_TickTime minimum;           /**<\brief minimal latency */
+    Ifx_TickTime maximum;           /**<\brief maximal latency */
+    Ifx_TickTime sum;               /**<\brief sum of the latencies */
+    uint32       countAtUpdate;     /**<\brief count at the previous update */
+    Ifx_TickTime sumAtUpdate;       /**<\brief sum at the previous update */
+    float32      averageUs;         /**<\brief average latency in us over the last update period */
+} Ifx_CanMonitor_MsgObj;
+
+/** \brief CAN monitor object */
+typedef struct
+{
+    Ifx_CanMonitor_Node   nodes[IFX_CFG_CANMONITOR_MAX_NODES];        /**<\brief monitored nodes */
+    uint8                 nodeCount;                                  /**<\brief number of monitored nodes */
+    Ifx_CanMonitor_MsgObj msgObjs[IFX_CFG_CANMONITOR_MAX_MSGOBJS];    /**<\brief monitored transmit message objects */
+    uint8                 msgObjCount;                                /**<\brief number of monitored message objects */
+    uint32                samples;                                    /**<\brief number of samples */
+    Ifx_TickTime          updateTime;                                 /**<\brief time of the previous update */
+} Ifx_CanMonitor;
+
+/** \brief Register a transmit message object for the latency measurement
+ * \param monitor Pointer to the CAN monitor object
+ * \param name message object name, must be a constant string
+ * \param msgObj Initialised transmit message object. For a transmit FIFO, the base object is monitored
+ * \return Returns the message object index, or -1 if the message object could not be registered
+ */
+IFX_EXTERN sint32 Ifx_CanMonitor_addMsgObj(Ifx_CanMonitor *monitor, pchar name, IfxMultican_Can_MsgObj *msgObj);
+
+/** \brief Register a node, its frame counter is set to frame count mode
+ * \param monitor Pointer to the CAN monitor object
+ * \param name node name, must be a constant string of less than IFX_CANMONITOR_NAME_SIZE - 3 characters
+ * \param node Initialised node
+ * \param baudrate Nominal baudrate in bit/s
+ * \param averageDlc Average data length of the frames on the bus, 0 .. 8. 8 gives the upper bound of the load
+ * \return Returns the node index, or -1 if the node could not be registered
+ */
+IFX_EXTERN sint32 Ifx_CanMonitor_addNode(Ifx_CanMonitor *monitor, pchar name, IfxMultican_Can_Node *node, uint32 baudrate, uint8 averageDlc);
+
+/** \brief Register the bus loads, the error rates and the average latencies as telemetry channels
+ * \param monitor Pointer to the CAN monitor object
+ * \param telemetry Pointer to the telemetry object
+ */
+IFX_EXTERN void Ifx_CanMonitor_addTelemetryChannels(Ifx_CanMonitor *monitor, Ifx_Telemetry *telemetry);
+
+/** \brief Initialize the CAN monitor, without node nor message object
+ * \param monitor Pointer to the CAN monitor object
+ */
+IFX_EXTERN void Ifx_CanMonitor_init(Ifx_CanMonitor *monitor);
+
+/** \brief Clear the statistics
+ * \param monitor Pointer to the CAN monitor object
+ */
+IFX_EXTERN void Ifx_CanMonitor_reset(Ifx_CanMonitor *monitor);
+
+/** \brief Sample the error codes, the node states and the transmit requests, to be called periodically
+ * \param monitor Pointer to the CAN monitor object
+ */
+IFX_EXTERN void Ifx_CanMonitor_sample(Ifx_CanMonitor *monitor);
+
+/** \brief Shell command: print the statistics. With the argument "reset", the statistics are cleared afterwards
+ * \param args command arguments
+ * \param data Pointer to the CAN monitor object
+ * \param io Pointer to the IfxStdIf_DPipe object
+ * \return TRUE
+ */
+IFX_EXTERN boolean Ifx_CanMonitor_show(pchar args, void *data, IfxStdIf_DPipe *io);
+
+/** \brief Count the frames and compute the loads, the rates and the latencies since the previous update
+ *
+ * To be called at least once per 65536 frames of a node, e.g. every second.
+ * \param monitor Pointer to the CAN monitor object
+ */
+IFX_EXTERN void Ifx_CanMonitor_update(Ifx_CanMonitor *monitor);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
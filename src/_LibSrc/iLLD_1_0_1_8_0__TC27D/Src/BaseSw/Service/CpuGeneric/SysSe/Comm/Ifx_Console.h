@@ -29,6 +29,8 @@
 #define IFX_CONSOLE_H               1
 
 #include "StdIf/IfxStdIf_DPipe.h"
+#include "Ifx_Log.h"
+#include "SysSe/General/Ifx_Format.h"
 
 //----------------------------------------------------------------------------------------
 #if !defined(IFX_CFG_CONSOLE_INDENT_SIZE)
@@ -39,6 +41,7 @@ typedef struct
 {
     IfxStdIf_DPipe *standardIo;       /**<\brief Pointer to the \ref IfxStdIf_DPipe object used as general console */
     sint16          align;            /**<\brief Variable for storing the actual (left)indentation level of the \ref Ifx_g_console */
+    Ifx_Log        *log;              /**<\brief Deferred log used by \ref Ifx_Console_printDeferred(), NULL_PTR if not used */
 } Ifx_Console;
 
 IFX_EXTERN Ifx_Console Ifx_g_console; /**< \brief Default main console global variable */
@@ -68,6 +71,34 @@ IFX_INLINE IfxStdIf_DPipe *Ifx_Console_getIo(void)
 IFX_EXTERN void    Ifx_Console_init(IfxStdIf_DPipe *standardIo);
 IFX_EXTERN boolean Ifx_Console_print(pchar format, ...);
 IFX_EXTERN boolean Ifx_Console_printAlign(pchar format, ...);
+IFX_EXTERN void    Ifx_Console_initLog(Ifx_Log *log);
+
+/** \brief Print a text built with \ref library_srvsw_sysse_general_format into \ref Ifx_g_console
+ *
+ * Unlike \ref Ifx_Console_print(), no format string is interpreted and no message buffer is allocated on the
+ * stack, the hot logging paths use this function.
+ * \param fmt Text builder object
+ * \retval TRUE if the string is printed successfully
+ * \retval FALSE if the function failed.
+ */
+IFX_INLINE boolean Ifx_Console_printFormat(const Ifx_Format *fmt)
+{
+    return Ifx_Format_write(fmt, Ifx_g_console.standardIo);
+}
+
+
+/** \brief Print into the deferred log of the \ref Ifx_g_console without waiting
+ *
+ * Only the format string pointer and up to \ref IFX_LOG_MAX_ARGS integer arguments are stored, see
+ * \ref library_srvsw_sysse_comm_log. The log is set with \ref Ifx_Console_initLog() and
+ * processed by calling \ref Ifx_Log_process(). As long as no log is set, the message is printed
+ * with \ref Ifx_Console_print(), which waits.
+ * \retval TRUE if the message is stored or printed
+ * \retval FALSE if the message has been dropped
+ */
+#define Ifx_Console_printDeferred(...)                                                        \
+    ((Ifx_g_console.log != NULL_PTR) ? IFX_LOG_PRINT(Ifx_g_console.log, __VA_ARGS__) \
+     : Ifx_Console_print(__VA_ARGS__))
 
 /**
  * \brief Decrement the alignment/indentation using the given value
@@ -0,0 +1,214 @@
+/**
+ * \file Ifx_DPipeMux.h
+ * \brief Standard interface multiplexer: one shared message ring, several sinks
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_comm_dpipemux Standard interface multiplexer
+ * \ingroup library_srvsw_sysse_comm
+ *
+ * The multiplexer sends the output of several producers (console, log, telemetry) to several
+ * \ref IfxStdIf_DPipe sinks (ASCLIN, simulated IO, UDP) at the same time:
+ * - each producer writes through an input, which is a \ref IfxStdIf_DPipe object (\ref Ifx_DPipeMux_stdIfDPipeInit())
+ * with a source number. Each write is stored once as message into the shared ring, the producer never waits.
+ * - each sink reads the ring independently with its own read position, from \ref Ifx_DPipeMux_process(). The
+ * messages are filtered by source (sourceMask) and limited in rate (token bucket of rate bytes per second, up to
+ * burst bytes). A message over the rate is dropped for this sink.
+ * - the oldest messages are overwritten when the ring is full. A sink which did not read them yet continues with
+ * the oldest message still in the ring, the messages lost are counted in overrunCount. A slow sink drops messages,
+ * it never slows down the producers nor the other sinks.
+ *
+ * The messages are sent without waiting: a message which does not fit into the transmit buffer of the sink is
+ * completed by the next calls of \ref Ifx_DPipeMux_process().
+ *
+ * The inputs forward the reception functions to an optional receive standard interface, so that a shell or the
+ * telemetry protocol can run on an input.
+ *
+ * Restrictions:
+ * - messages longer than \ref IFX_CFG_DPIPEMUX_MAX_MESSAGE bytes are split.
+ * - the producers may run in any task or interrupt of one CPU. \ref Ifx_DPipeMux_process() runs in one context of
+ * any CPU if the object and the ring are located in a non cached memory.
+ * - binary and text sources shall be sent to different sinks, with the sourceMask.
+ *
+ * Usage example:
+ * \code
+ * static uint8              muxBuffer[4096];
+ * static Ifx_DPipeMux       mux;
+ * static Ifx_DPipeMux_Input consoleInput;
+ * static IfxStdIf_DPipe     consoleStdIf;
+ *
+ * // initialisation
+ * Ifx_DPipeMux_Config config;
+ * Ifx_DPipeMux_initConfig(&config);
+ * config.buffer     = muxBuffer;
+ * config.bufferSize = sizeof(muxBuffer);
+ * Ifx_DPipeMux_init(&mux, &config);
+ *
+ * Ifx_DPipeMux_SinkConfig sinkConfig;
+ * Ifx_DPipeMux_initSinkConfig(&sinkConfig);
+ * sinkConfig.pipe = &ascStdIf;             // all sources, no rate limit
+ * Ifx_DPipeMux_addSink(&mux, &sinkConfig);
+ * sinkConfig.pipe       = &btStdIf;        // console only, 960 bytes/s (9600 baud)
+ * sinkConfig.sourceMask = 1U << 0;
+ * sinkConfig.rate       = 960;
+ * Ifx_DPipeMux_addSink(&mux, &sinkConfig);
+ *
+ * Ifx_DPipeMux_initInput(&consoleInput, &mux, 0, &ascStdIf);
+ * Ifx_DPipeMux_stdIfDPipeInit(&consoleStdIf, &consoleInput);
+ * Ifx_Console_init(&consoleStdIf);
+ *
+ * // background loop
+ * Ifx_DPipeMux_process(&mux);
+ * \endcode
+ *
+ */
+#ifndef IFX_DPIPEMUX_H
+#define IFX_DPIPEMUX_H 1
+
+#include "Cpu/Std/Ifx_Types.h"
+#include "StdIf/IfxStdIf_DPipe.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_DPIPEMUX_MAX_SINKS)
+#define IFX_CFG_DPIPEMUX_MAX_SINKS   (4)                            /**<\brief Maximal number of sinks */
+#endif
+
+#if !defined(IFX_CFG_DPIPEMUX_MAX_MESSAGE)
+#define IFX_CFG_DPIPEMUX_MAX_MESSAGE (STDIF_DPIPE_MAX_PRINT_SIZE)   /**<\brief Maximal length of a message in bytes, longer writes are split */
+#endif
+
+#define IFX_DPIPEMUX_HEADER_SIZE     (3)                            /**<\brief Size of the message header in the ring: length (2 bytes), source */
+#define IFX_DPIPEMUX_ALL_SOURCES     (0xFFFFFFFFU)                  /**<\brief Source mask of a sink which receives all sources */
+
+/** \addtogroup library_srvsw_sysse_comm_dpipemux
+ * \{ */
+
+/** \brief Sink configuration */
+typedef struct
+{
+    IfxStdIf_DPipe *pipe;          /**<\brief Standard interface of the sink */
+    uint32          sourceMask;    /**<\brief Sources sent to the sink, bit n for source n */
+    uint32          rate;          /**<\brief Maximal rate in bytes per second, 0 for no limit */
+    uint32          burst;         /**<\brief Maximal burst in bytes, at least IFX_CFG_DPIPEMUX_MAX_MESSAGE. 0 for one message */
+} Ifx_DPipeMux_SinkConfig;
+
+/** \brief Sink */
+typedef struct
+{
+    IfxStdIf_DPipe *pipe;                                   /**<\brief Standard interface of the sink */
+    uint32          sourceMask;                             /**<\brief Sources sent to the sink, bit n for source n */
+    uint32          rate;                                   /**<\brief Maximal rate in bytes per second, 0 for no limit */
+    uint32          burst;                                  /**<\brief Maximal burst in bytes */
+    uint32          tokens;                                 /**<\brief Bytes which can be sent without exceeding the rate */
+    Ifx_TickTime    refillTime;                             /**<\brief Time of the last token refill */
+    uint32          readTotal;                              /**<\brief Ring position of the next message */
+    uint32          sentCount;                              /**<\brief Number of messages sent */
+    uint32          rateDropCount;                          /**<\brief Number of messages dropped by the rate limit */
+    uint32          overrunCount;                           /**<\brief Number of messages overwritten before being read */
+    Ifx_SizeT       pendingIndex;                           /**<\brief Index of the first byte of message not yet written */
+    Ifx_SizeT       pendingCount;                           /**<\brief Number of bytes of message not yet written */
+    uint8           message[IFX_CFG_DPIPEMUX_MAX_MESSAGE];  /**<\brief Message being written */
+} Ifx_DPipeMux_Sink;
+
+/** \brief Multiplexer configuration */
+typedef struct
+{
+    uint8    *buffer;       /**<\brief Ring memory */
+    Ifx_SizeT bufferSize;   /**<\brief Size of the ring in bytes, power of 2, at least IFX_CFG_DPIPEMUX_MAX_MESSAGE + IFX_DPIPEMUX_HEADER_SIZE */
+} Ifx_DPipeMux_Config;
+
+/** \brief Multiplexer object */
+typedef struct
+{
+    uint8            *buffer;                               /**<\brief Ring memory */
+    uint32            size;                                 /**<\brief Size of the ring in bytes */
+    volatile uint32   writeTotal;                           /**<\brief Ring position of the next message, modified by the producers only */
+    volatile uint32   tailTotal;                            /**<\brief Ring position of the oldest message, modified by the producers only */
+    volatile uint32   messageCount;                         /**<\brief Number of messages written */
+    uint8             sinkCount;                            /**<\brief Number of sinks */
+    Ifx_DPipeMux_Sink sinks[IFX_CFG_DPIPEMUX_MAX_SINKS];    /**<\brief Sinks */
+} Ifx_DPipeMux;
+
+/** \brief Input of the multiplexer, driver of a standard interface */
+typedef struct
+{
+    Ifx_DPipeMux   *mux;       /**<\brief Multiplexer */
+    uint8           source;    /**<\brief Source number of the messages, 0 to 31 */
+    IfxStdIf_DPipe *rx;        /**<\brief Standard interface used for the reception, NULL_PTR if none */
+    uint32          sendCount; /**<\brief Number of bytes written */
+} Ifx_DPipeMux_Input;
+
+/** \brief Add a sink
+ * \param mux Pointer to the multiplexer object
+ * \param config Pointer to the sink configuration
+ * \return Returns the sink index, or -1 if the sink could not be added
+ */
+IFX_EXTERN sint32 Ifx_DPipeMux_addSink(Ifx_DPipeMux *mux, const Ifx_DPipeMux_SinkConfig *config);
+
+/** \brief Initialize the multiplexer object, without sink
+ * \param mux Pointer to the multiplexer object
+ * \param config Pointer to the configuration
+ * \return Returns FALSE if the ring is too small or its size is not a power of 2
+ */
+IFX_EXTERN boolean Ifx_DPipeMux_init(Ifx_DPipeMux *mux, const Ifx_DPipeMux_Config *config);
+
+/** \brief Initialize the configuration with default values
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_DPipeMux_initConfig(Ifx_DPipeMux_Config *config);
+
+/** \brief Initialize an input
+ * \param input Pointer to the input object
+ * \param mux Pointer to the multiplexer object
+ * \param source Source number of the messages, 0 to 31
+ * \param rx Standard interface used for the reception, NULL_PTR if none
+ */
+IFX_EXTERN void Ifx_DPipeMux_initInput(Ifx_DPipeMux_Input *input, Ifx_DPipeMux *mux, uint8 source, IfxStdIf_DPipe *rx);
+
+/** \brief Initialize the sink configuration: all sources, no rate limit
+ * \param config Pointer to the sink configuration
+ */
+IFX_EXTERN void Ifx_DPipeMux_initSinkConfig(Ifx_DPipeMux_SinkConfig *config);
+
+/** \brief Send the messages to the sinks, never waits
+ *
+ * To be called periodically, typically from the background loop.
+ * \param mux Pointer to the multiplexer object
+ */
+IFX_EXTERN void Ifx_DPipeMux_process(Ifx_DPipeMux *mux);
+
+/** \brief Initialize the standard interface of an input
+ * \param stdif Standard interface object, will be initialized by the function
+ * \param input Pointer to the input object
+ * \return Returns TRUE if the interface is initialized
+ */
+IFX_EXTERN boolean Ifx_DPipeMux_stdIfDPipeInit(IfxStdIf_DPipe *stdif, Ifx_DPipeMux_Input *input);
+
+/** \brief Store a message into the ring, never waits
+ *
+ * The oldest messages are overwritten if the ring is full.
+ * \param mux Pointer to the multiplexer object
+ * \param source Source number of the message, 0 to 31
+ * \param data Pointer to the message
+ * \param count Length of the message, 1 to IFX_CFG_DPIPEMUX_MAX_MESSAGE bytes
+ */
+IFX_EXTERN void Ifx_DPipeMux_write(Ifx_DPipeMux *mux, uint8 source, const void *data, Ifx_SizeT count);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
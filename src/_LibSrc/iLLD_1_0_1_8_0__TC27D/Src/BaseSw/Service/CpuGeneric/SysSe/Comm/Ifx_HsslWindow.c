@@ -0,0 +1,399 @@
+/**
+ * \file Ifx_HsslWindow.c
+ * \brief Memory window shared with a partner device over HSSL
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "Ifx_HsslWindow.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/*
+ * Note: the publish is a sequence of register frames and streams. Each step is started when the previous one is
+ * acknowledged, Ifx_HsslWindow_process() executes all the steps already finished and returns at the first one in
+ * progress. The header is written after the last stream is finished: the subscriber never sees a sequence
+ * number before the data of the bank.
+ */
+
+/** \brief Return the mask of the regions covered by an area, size > 0 */
+static uint32 Ifx_HsslWindow_getRegions(Ifx_SizeT regionSize, Ifx_SizeT offset, Ifx_SizeT size)
+{
+    uint32 first = (uint32)(offset / regionSize);
+    uint32 last  = (uint32)((offset + size - 1) / regionSize);
+
+    /* 2 << 31 is 0, the mask is then 0xFFFFFFFF */
+    return ((2u << last) - 1u) & ~((1u << first) - 1u);
+}
+
+
+/** \brief Write a register of the partner and wait for the acknowledge */
+static boolean Ifx_HsslWindow_writeTargetRegister(IfxHssl_Hssl_Channel *channel, uint32 address, uint32 data)
+{
+    IfxHssl_Hssl_Status status = IfxHssl_Hssl_write(channel, address, data, IfxHssl_DataLength_32bit);
+
+    if (status == IfxHssl_Hssl_Status_ok)
+    {
+        do
+        {
+            status = IfxHssl_Hssl_waitAcknowledge(channel);
+        } while (status == IfxHssl_Hssl_Status_busy);
+    }
+
+    return status == IfxHssl_Hssl_Status_ok;
+}
+
+
+/** \brief Start the next block of the bank in progress, or the header if all the blocks are streamed */
+static void Ifx_HsslWindow_startBlock(Ifx_HsslWindow *window)
+{
+    uint32 bank    = (window->sequence + 1) & 1;
+    uint32 pending = window->pending[bank];
+
+    if (pending != 0)
+    {
+        uint32 first = 0;
+        uint32 count = 0;
+
+        while ((pending & (1u << first)) == 0)
+        {
+            first++;
+        }
+
+        while (((first + count) < IFX_HSSLWINDOW_MAX_REGIONS) && ((pending & (1u << (first + count))) != 0))
+        {
+            count++;
+        }
+
+        window->run       = Ifx_HsslWindow_getRegions(window->regionSize, (Ifx_SizeT)(first * window->regionSize), (Ifx_SizeT)(count * window->regionSize));
+        window->runOffset = first * window->regionSize;
+        window->runFrames = (count * window->regionSize) / IFX_HSSLWINDOW_FRAME_SIZE;
+        window->state     = Ifx_HsslWindow_State_targetAddress;
+        IfxHssl_Hssl_write(window->channel, (uint32)&window->hssl->hssl->TS.SA[0], window->remoteImage[bank] + window->runOffset, IfxHssl_DataLength_32bit);
+    }
+    else
+    {
+        window->state = Ifx_HsslWindow_State_headerChanged;
+        IfxHssl_Hssl_write(window->channel, window->remoteHeader + offsetof(Ifx_HsslWindow_Header, changed), window->changed, IfxHssl_DataLength_32bit);
+    }
+}
+
+
+/** \brief Start the step following the one just finished */
+static void Ifx_HsslWindow_nextStep(Ifx_HsslWindow *window)
+{
+    Ifx_HSSL *hsslSFR = window->hssl->hssl;
+
+    switch (window->state)
+    {
+    case Ifx_HsslWindow_State_targetAddress:
+        window->state = Ifx_HsslWindow_State_targetCount;
+        IfxHssl_Hssl_write(window->channel, (uint32)&hsslSFR->TS.FC, window->runFrames, IfxHssl_DataLength_16bit);
+        break;
+    case Ifx_HsslWindow_State_targetCount:
+
+        if (window->channel->loopBack == FALSE)
+        {
+            Ifx_HSSL_MFLAGSSET flagsSet;
+
+            flagsSet.U      = 0;
+            flagsSet.B.TSES = 1;
+            window->state   = Ifx_HsslWindow_State_targetEnable;
+            IfxHssl_Hssl_write(window->channel, (uint32)&hsslSFR->MFLAGSSET, flagsSet.U, IfxHssl_DataLength_32bit);
+            break;
+        }
+
+    /* in loop back, IfxHssl_Hssl_writeStream() enables the target */
+    /* no break */
+    case Ifx_HsslWindow_State_targetEnable:
+        window->state = Ifx_HsslWindow_State_stream;
+        IfxHssl_Hssl_writeStream(window->hssl, (uint32 *)(window->imageAddress + window->runOffset), (Ifx_SizeT)window->runFrames);
+        break;
+    case Ifx_HsslWindow_State_stream:
+        window->pending[(window->sequence + 1) & 1] &= ~window->run;
+        Ifx_HsslWindow_startBlock(window);
+        break;
+    case Ifx_HsslWindow_State_headerChanged:
+        window->state = Ifx_HsslWindow_State_headerSequence;
+        IfxHssl_Hssl_write(window->channel, window->remoteHeader + offsetof(Ifx_HsslWindow_Header, sequence), window->sequence + 1, IfxHssl_DataLength_32bit);
+        break;
+    case Ifx_HsslWindow_State_headerSequence:
+        window->sequence++;
+        window->state = Ifx_HsslWindow_State_idle;
+        break;
+    default:
+        window->state = Ifx_HsslWindow_State_idle;
+        break;
+    }
+}
+
+
+boolean Ifx_HsslWindow_init(Ifx_HsslWindow *window, const Ifx_HsslWindow_Config *config)
+{
+    Ifx_HSSL *hsslSFR = config->hssl->hssl;
+    boolean   result  = TRUE;
+
+    /* channel 2 carries the stream frames, register accesses are not possible through it */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, config->channel->channelId != IfxHssl_ChannelId_2);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->regionSize > 0) && ((config->regionSize % IFX_HSSLWINDOW_FRAME_SIZE) == 0));
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->size > 0) && ((config->size % config->regionSize) == 0));
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->size / config->regionSize) <= IFX_HSSLWINDOW_MAX_REGIONS);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((uint32)config->image % IFX_HSSLWINDOW_FRAME_SIZE) == 0);
+
+    window->hssl           = config->hssl;
+    window->channel        = config->channel;
+    window->image          = (uint8 *)config->image;
+    window->imageAddress   = IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), config->image);
+    window->remoteImage[0] = config->remoteImage[0];
+    window->remoteImage[1] = config->remoteImage[1];
+    window->remoteHeader   = config->remoteHeader;
+    window->size           = config->size;
+    window->regionSize     = config->regionSize;
+    window->regions        = Ifx_HsslWindow_getRegions(config->regionSize, 0, config->size);
+    window->dirty          = window->regions;
+    window->pending[0]     = window->regions;
+    window->pending[1]     = window->regions;
+    window->changed        = 0;
+    window->run            = 0;
+    window->runOffset      = 0;
+    window->runFrames      = 0;
+    window->sequence       = 0;
+    window->errorCount     = 0;
+    window->state          = Ifx_HsslWindow_State_idle;
+
+    /* incase of transfers between two different devices (loopback off) */
+    if (config->channel->loopBack == FALSE)
+    {
+        Ifx_HSSL_CFG cfg;
+
+        /* single block streaming mode of channel 2 on target device, same predivider as the initiator */
+        cfg.U        = 0;
+        cfg.B.PREDIV = hsslSFR->CFG.B.PREDIV;
+        cfg.B.SCM    = 1;
+        cfg.B.SMT    = IfxHssl_StreamingMode_single;
+        cfg.B.SMR    = IfxHssl_StreamingMode_single;
+        result       = Ifx_HsslWindow_writeTargetRegister(config->channel, (uint32)&hsslSFR->CFG, cfg.U);
+    }
+
+    return result;
+}
+
+
+void Ifx_HsslWindow_initConfig(Ifx_HsslWindow_Config *config, IfxHssl_Hssl *hssl, IfxHssl_Hssl_Channel *channel)
+{
+    config->hssl           = hssl;
+    config->channel        = channel;
+    config->image          = NULL_PTR;
+    config->size           = 0;
+    config->regionSize     = 1024;
+    config->remoteImage[0] = 0;
+    config->remoteImage[1] = 0;
+    config->remoteHeader   = 0;
+}
+
+
+void Ifx_HsslWindow_markDirty(Ifx_HsslWindow *window, Ifx_SizeT offset, Ifx_SizeT size)
+{
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (offset >= 0) && ((offset + size) <= window->size));
+
+    if (size > 0)
+    {
+        window->dirty |= Ifx_HsslWindow_getRegions(window->regionSize, offset, size);
+    }
+}
+
+
+IfxHssl_Hssl_Status Ifx_HsslWindow_process(Ifx_HsslWindow *window)
+{
+    IfxHssl_Hssl_Status status = IfxHssl_Hssl_Status_ok;
+
+    while (window->state != Ifx_HsslWindow_State_idle)
+    {
+        if (window->state == Ifx_HsslWindow_State_stream)
+        {
+            Ifx_HSSL *hsslSFR = window->hssl->hssl;
+
+            if (hsslSFR->MFLAGS.B.ISB != 0)
+            {
+                status = IfxHssl_Hssl_Status_busy;
+            }
+            else if ((hsslSFR->MFLAGS.U & (0x1111u << IfxHssl_ChannelId_2)) != 0)
+            {
+                /* NACK, TTE, TIMEOUT or UNEXPECTED on the stream channel */
+                hsslSFR->MFLAGSCL.U = 0x1111u << IfxHssl_ChannelId_2;
+                status              = IfxHssl_Hssl_Status_error;
+            }
+            else
+            {
+                status = IfxHssl_Hssl_Status_ok;
+            }
+        }
+        else
+        {
+            status = IfxHssl_Hssl_waitAcknowledge(window->channel);
+
+            if (status == IfxHssl_Hssl_Status_error)
+            {
+                /* clear NACK, TTE, TIMEOUT and UNEXPECTED of the channel, the next publish starts without error */
+                window->channel->hssl->MFLAGSCL.U = 0x1111u << window->channel->channelId;
+            }
+        }
+
+        if (status == IfxHssl_Hssl_Status_busy)
+        {
+            break;
+        }
+        else if (status == IfxHssl_Hssl_Status_error)
+        {
+            /* the changes are reported again by the next publish, the blocks not streamed stay pending */
+            window->dirty |= window->changed;
+            window->errorCount++;
+            window->state  = Ifx_HsslWindow_State_idle;
+        }
+        else
+        {
+            Ifx_HsslWindow_nextStep(window);
+        }
+    }
+
+    return status;
+}
+
+
+boolean Ifx_HsslWindow_publish(Ifx_HsslWindow *window)
+{
+    if (window->state != Ifx_HsslWindow_State_idle)
+    {
+        return FALSE;
+    }
+
+    /* the dirty regions are out of date in both banks */
+    window->changed     = window->dirty;
+    window->pending[0] |= window->dirty;
+    window->pending[1] |= window->dirty;
+    window->dirty       = 0;
+
+    Ifx_HsslWindow_startBlock(window);
+
+    return TRUE;
+}
+
+
+boolean Ifx_HsslWindow_write(Ifx_HsslWindow *window, Ifx_SizeT offset, const void *data, Ifx_SizeT size)
+{
+    if (window->state != Ifx_HsslWindow_State_idle)
+    {
+        return FALSE;
+    }
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (offset >= 0) && ((offset + size) <= window->size));
+
+    if (size > 0)
+    {
+        memcpy(&window->image[offset], data, (size_t)size);
+        window->dirty |= Ifx_HsslWindow_getRegions(window->regionSize, offset, size);
+    }
+
+    return TRUE;
+}
+
+
+void Ifx_HsslWindow_initMirror(Ifx_HsslWindow_Mirror *mirror, const Ifx_HsslWindow_MirrorConfig *config)
+{
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->regionSize > 0) && ((config->size % config->regionSize) == 0));
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->size / config->regionSize) <= IFX_HSSLWINDOW_MAX_REGIONS);
+
+    mirror->image[0]          = (const uint8 *)config->image[0];
+    mirror->image[1]          = (const uint8 *)config->image[1];
+    mirror->header            = config->header;
+    mirror->size              = config->size;
+    mirror->regionSize        = config->regionSize;
+    mirror->regions           = Ifx_HsslWindow_getRegions(config->regionSize, 0, config->size);
+    mirror->sequence          = 0;
+    mirror->missedCount       = 0;
+    mirror->subscriptionCount = 0;
+
+    mirror->header->changed   = 0;
+    mirror->header->sequence  = 0;
+}
+
+
+boolean Ifx_HsslWindow_poll(Ifx_HsslWindow_Mirror *mirror)
+{
+    uint32       sequence = mirror->header->sequence;
+    uint32       changed;
+    const uint8 *image;
+    uint8        i;
+
+    if (sequence == mirror->sequence)
+    {
+        return FALSE;
+    }
+
+    if (sequence == (mirror->sequence + 1))
+    {
+        changed = mirror->header->changed;
+    }
+    else
+    {
+        /* the changes of the publish missed are unknown */
+        changed              = mirror->regions;
+        mirror->missedCount += sequence - mirror->sequence - 1;
+    }
+
+    mirror->sequence = sequence;
+    image            = mirror->image[sequence & 1];
+
+    for (i = 0; i < mirror->subscriptionCount; i++)
+    {
+        Ifx_HsslWindow_Subscription *subscription = &mirror->subscription[i];
+
+        if ((subscription->regions & changed) != 0)
+        {
+            subscription->callback(subscription->data, &image[subscription->offset], subscription->size, sequence);
+        }
+    }
+
+    return TRUE;
+}
+
+
+boolean Ifx_HsslWindow_subscribe(Ifx_HsslWindow_Mirror *mirror, Ifx_SizeT offset, Ifx_SizeT size, Ifx_HsslWindow_Callback callback, void *data)
+{
+    Ifx_HsslWindow_Subscription *subscription;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (offset >= 0) && (size > 0) && ((offset + size) <= mirror->size));
+
+    if (mirror->subscriptionCount >= IFX_CFG_HSSLWINDOW_SUBSCRIPTIONS)
+    {
+        return FALSE;
+    }
+
+    subscription           = &mirror->subscription[mirror->subscriptionCount];
+    subscription->callback = callback;
+    subscription->data     = data;
+    subscription->offset   = offset;
+    subscription->size     = size;
+    subscription->regions  = Ifx_HsslWindow_getRegions(mirror->regionSize, offset, size);
+    mirror->subscriptionCount++;
+
+    return TRUE;
+}
@@ -0,0 +1,323 @@
+/**
+ * \file Ifx_HsslWindow.h
+ * \brief Memory window shared with a partner device over HSSL
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_comm_hsslwindow HSSL remote memory window
+ * \ingroup library_srvsw_sysse_comm
+ *
+ * A window is a memory image owned by the publishing device and mirrored into the memory (e.g. the LMU) of the
+ * partner device, the subscriber. Two devices connected by HSSL / HSCT share the work: e.g. one device acquires
+ * the sensor data and publishes an image each cycle, the other one processes it.
+ *
+ * \ref IfxHssl_Hssl_read() and \ref IfxHssl_Hssl_write() of the HSSL driver are one blocking transaction per
+ * 32 bit word. The window transfers the image instead with the block streaming of the HSSL channel 2: 32 bytes per
+ * frame, without acknowledge per word.
+ *
+ * <b>Dirty regions</b>\n
+ * The image is divided into up to \ref IFX_HSSLWINDOW_MAX_REGIONS regions of the same size. The regions written
+ * with \ref Ifx_HsslWindow_write(), or marked with \ref Ifx_HsslWindow_markDirty() after a direct write into the
+ * image, are dirty. Only the dirty regions are streamed; the consecutive dirty regions are streamed as one block,
+ * each block costs the set up of the target (3 register frames).
+ *
+ * <b>Double buffering</b>\n
+ * The partner holds two banks of the image. \ref Ifx_HsslWindow_publish() streams the regions into the bank not
+ * read by the subscriber, then writes the header (the regions changed and the sequence number) into the partner
+ * memory. The bank of a sequence number is (sequence & 1). The regions streamed into a bank are the ones changed
+ * since the previous publish into the same bank, i.e. during the last two publish cycles.
+ *
+ * The publish is non blocking: \ref Ifx_HsslWindow_process() advances it, it is called cyclically until it
+ * does not return IfxHssl_Hssl_Status_busy. The image shall not be written while the publish is in progress,
+ * see \ref Ifx_HsslWindow_isBusy().
+ *
+ * <b>Subscriber</b>\n
+ * \ref Ifx_HsslWindow_poll() detects a new sequence number in the header and calls the subscriptions of the
+ * changed regions with the bank just published. If a sequence number was missed, all the subscriptions are
+ * called. The subscriber shall have finished reading the bank before the next but one publish, i.e. poll at
+ * least as often as the publisher publishes.
+ *
+ * <b>Memory</b>\n
+ * The image of the publisher is aligned on 32 bytes and read by the HSSL: it is in a DSPR or in a non cached
+ * LMU segment. The banks and the header of the subscriber are written by the HSSL: they are read through non
+ * cached addresses and are covered by the access windows of the subscriber (\ref IfxHssl_Hssl_Config).
+ * The streaming channel 2 is used exclusively by the window, the register accesses are done on another channel.
+ *
+ * Usage example: 4 KByte image published each cycle, regions of 256 bytes
+ * \code
+ * // acquisition device
+ * __attribute__ ((aligned(32))) uint8 image[4096];
+ * Ifx_HsslWindow window;
+ *
+ * Ifx_HsslWindow_Config config;
+ * Ifx_HsslWindow_initConfig(&config, &hssl, &hsslChannel[0]);
+ * config.image          = image;
+ * config.size           = sizeof(image);
+ * config.regionSize     = 256;
+ * config.remoteImage[0] = 0xB0010000;              // partner banks, non cached LMU
+ * config.remoteImage[1] = 0xB0011000;
+ * config.remoteHeader   = 0xB0012000;
+ * Ifx_HsslWindow_init(&window, &config);
+ *
+ * // each cycle
+ * Ifx_HsslWindow_write(&window, SENSOR_OFFSET, samples, sizeof(samples));
+ * Ifx_HsslWindow_publish(&window);
+ * while (Ifx_HsslWindow_process(&window) == IfxHssl_Hssl_Status_busy)
+ * {}                                               // or call it from the background loop
+ *
+ * // processing device
+ * Ifx_HsslWindow_Mirror mirror;
+ *
+ * Ifx_HsslWindow_MirrorConfig mirrorConfig;
+ * mirrorConfig.image[0]   = (void *)0xB0010000;
+ * mirrorConfig.image[1]   = (void *)0xB0011000;
+ * mirrorConfig.header     = (Ifx_HsslWindow_Header *)0xB0012000;
+ * mirrorConfig.size       = 4096;
+ * mirrorConfig.regionSize = 256;
+ * Ifx_HsslWindow_initMirror(&mirror, &mirrorConfig);
+ * Ifx_HsslWindow_subscribe(&mirror, SENSOR_OFFSET, sizeof(samples), processSamples, NULL_PTR);
+ *
+ * // each cycle, processSamples(data, samples, size, sequence) is called if the samples changed
+ * Ifx_HsslWindow_poll(&mirror);
+ * \endcode
+ *
+ */
+#ifndef IFX_HSSLWINDOW_H
+#define IFX_HSSLWINDOW_H 1
+
+#include "Hssl/Hssl/IfxHssl_Hssl.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_HSSLWINDOW_SUBSCRIPTIONS)
+#define IFX_CFG_HSSLWINDOW_SUBSCRIPTIONS (8)  /**<\brief Maximal number of subscriptions of a mirror */
+#endif
+
+/** \brief Size in bytes of a stream frame */
+#define IFX_HSSLWINDOW_FRAME_SIZE        (32)
+
+/** \brief Maximal number of regions of a window, one bit per region */
+#define IFX_HSSLWINDOW_MAX_REGIONS       (32)
+
+/** \addtogroup library_srvsw_sysse_comm_hsslwindow
+ * \{ */
+
+/** \brief Header written by the publisher after each complete bank */
+typedef struct
+{
+    volatile uint32 changed;       /**<\brief regions changed by the publish, one bit per region */
+    volatile uint32 sequence;      /**<\brief sequence number of the last complete publish, written last, 0 if none */
+} Ifx_HsslWindow_Header;
+
+/** \brief Step of the publish in progress */
+typedef enum
+{
+    Ifx_HsslWindow_State_idle = 0,        /**<\brief no publish in progress */
+    Ifx_HsslWindow_State_targetAddress,   /**<\brief start address of the block written into the target */
+    Ifx_HsslWindow_State_targetCount,     /**<\brief frame count of the block written into the target */
+    Ifx_HsslWindow_State_targetEnable,    /**<\brief streaming enabled on the target */
+    Ifx_HsslWindow_State_stream,          /**<\brief block streamed */
+    Ifx_HsslWindow_State_headerChanged,   /**<\brief changed regions written into the header */
+    Ifx_HsslWindow_State_headerSequence   /**<\brief sequence number written into the header */
+} Ifx_HsslWindow_State;
+
+/** \brief Configuration of the publisher */
+typedef struct
+{
+    IfxHssl_Hssl         *hssl;              /**<\brief HSSL module handle, the blocks are streamed by the channel 2 */
+    IfxHssl_Hssl_Channel *channel;           /**<\brief channel of the register accesses to the partner, not the channel 2 */
+    void                 *image;             /**<\brief local image, aligned on 32 bytes */
+    Ifx_SizeT             size;              /**<\brief size of the image in bytes, multiple of regionSize */
+    Ifx_SizeT             regionSize;        /**<\brief size of a region in bytes, multiple of \ref IFX_HSSLWINDOW_FRAME_SIZE */
+    uint32                remoteImage[2];    /**<\brief address of the banks in the partner memory, aligned on 32 bytes */
+    uint32                remoteHeader;      /**<\brief address of the \ref Ifx_HsslWindow_Header in the partner memory */
+} Ifx_HsslWindow_Config;
+
+/** \brief Publisher object */
+typedef struct
+{
+    IfxHssl_Hssl         *hssl;              /**<\brief HSSL module handle */
+    IfxHssl_Hssl_Channel *channel;           /**<\brief channel of the register accesses */
+    uint8                *image;             /**<\brief local image */
+    uint32                imageAddress;      /**<\brief global address of the local image, read by the HSSL */
+    uint32                remoteImage[2];    /**<\brief address of the banks in the partner memory */
+    uint32                remoteHeader;      /**<\brief address of the header in the partner memory */
+    Ifx_SizeT             size;              /**<\brief size of the image in bytes */
+    Ifx_SizeT             regionSize;        /**<\brief size of a region in bytes */
+    uint32                regions;           /**<\brief mask of all the regions */
+    uint32                dirty;             /**<\brief regions changed since the last publish */
+    uint32                pending[2];        /**<\brief regions to be streamed into each bank */
+    uint32                changed;           /**<\brief regions changed by the publish in progress */
+    uint32                run;               /**<\brief regions of the block in progress */
+    uint32                runOffset;         /**<\brief offset of the block in progress in bytes */
+    uint32                runFrames;         /**<\brief number of frames of the block in progress */
+    uint32                sequence;          /**<\brief sequence number of the last complete publish */
+    uint32                errorCount;        /**<\brief number of publish aborted by a link error */
+    Ifx_HsslWindow_State  state;             /**<\brief step of the publish in progress */
+} Ifx_HsslWindow;
+
+/** \brief Subscription callback
+ * \param data Callback data given to \ref Ifx_HsslWindow_subscribe()
+ * \param image Pointer to the subscribed area in the bank just published
+ * \param size Size of the subscribed area in bytes
+ * \param sequence Sequence number of the publish
+ */
+typedef void (*Ifx_HsslWindow_Callback)(void *data, const void *image, Ifx_SizeT size, uint32 sequence);
+
+/** \brief Subscription to an area of the image */
+typedef struct
+{
+    Ifx_HsslWindow_Callback callback;        /**<\brief function called when a region of the area changed */
+    void                   *data;            /**<\brief callback data */
+    Ifx_SizeT               offset;          /**<\brief offset of the area in the image in bytes */
+    Ifx_SizeT               size;            /**<\brief size of the area in bytes */
+    uint32                  regions;         /**<\brief regions covered by the area */
+} Ifx_HsslWindow_Subscription;
+
+/** \brief Configuration of the subscriber */
+typedef struct
+{
+    void                  *image[2];         /**<\brief banks written by the partner, non cached addresses */
+    Ifx_HsslWindow_Header *header;           /**<\brief header written by the partner, non cached address */
+    Ifx_SizeT              size;             /**<\brief size of the image in bytes, same as the publisher */
+    Ifx_SizeT              regionSize;       /**<\brief size of a region in bytes, same as the publisher */
+} Ifx_HsslWindow_MirrorConfig;
+
+/** \brief Subscriber object */
+typedef struct
+{
+    const uint8                 *image[2];                                     /**<\brief banks */
+    Ifx_HsslWindow_Header       *header;                                       /**<\brief header */
+    Ifx_SizeT                    size;                                         /**<\brief size of the image in bytes */
+    Ifx_SizeT                    regionSize;                                   /**<\brief size of a region in bytes */
+    uint32                       regions;                                      /**<\brief mask of all the regions */
+    uint32                       sequence;                                     /**<\brief sequence number of the last publish received */
+    uint32                       missedCount;                                  /**<\brief number of publish not seen by the poll */
+    uint8                        subscriptionCount;                            /**<\brief number of subscriptions */
+    Ifx_HsslWindow_Subscription  subscription[IFX_CFG_HSSLWINDOW_SUBSCRIPTIONS]; /**<\brief subscriptions */
+} Ifx_HsslWindow_Mirror;
+
+/** \name Publisher
+ * \{ */
+
+/** \brief Initialize the publisher and set the channel 2 of the partner in single block streaming mode
+ *
+ * Blocks until the register accesses to the partner are acknowledged. All the regions are dirty: the first
+ * publish into each bank transfers the complete image.
+ * \param window Pointer to the publisher object
+ * \param config Pointer to the configuration
+ * \return Returns FALSE if a register access to the partner failed
+ */
+IFX_EXTERN boolean Ifx_HsslWindow_init(Ifx_HsslWindow *window, const Ifx_HsslWindow_Config *config);
+
+/** \brief Initialize the configuration, the image and the partner addresses shall be set by the application
+ * \param config Pointer to the configuration
+ * \param hssl HSSL module handle
+ * \param channel Channel of the register accesses, not the channel 2
+ */
+IFX_EXTERN void Ifx_HsslWindow_initConfig(Ifx_HsslWindow_Config *config, IfxHssl_Hssl *hssl, IfxHssl_Hssl_Channel *channel);
+
+/** \brief Return the local image, written directly by the application before \ref Ifx_HsslWindow_markDirty()
+ * \param window Pointer to the publisher object
+ */
+IFX_INLINE void *Ifx_HsslWindow_getImage(Ifx_HsslWindow *window)
+{
+    return window->image;
+}
+
+
+/** \brief Return TRUE if a publish is in progress, the image shall not be written
+ * \param window Pointer to the publisher object
+ */
+IFX_INLINE boolean Ifx_HsslWindow_isBusy(const Ifx_HsslWindow *window)
+{
+    return window->state != Ifx_HsslWindow_State_idle;
+}
+
+
+/** \brief Mark an area of the image as changed
+ * \param window Pointer to the publisher object
+ * \param offset Offset of the area in bytes
+ * \param size Size of the area in bytes
+ */
+IFX_EXTERN void Ifx_HsslWindow_markDirty(Ifx_HsslWindow *window, Ifx_SizeT offset, Ifx_SizeT size);
+
+/** \brief Advance the publish in progress, never waits
+ * \param window Pointer to the publisher object
+ * \return Returns busy while the publish is in progress, error if it was aborted by a link error (the changes are
+ * published again by the next publish), ok else
+ */
+IFX_EXTERN IfxHssl_Hssl_Status Ifx_HsslWindow_process(Ifx_HsslWindow *window);
+
+/** \brief Start the publish of the dirty regions into the bank not read by the subscriber
+ * \param window Pointer to the publisher object
+ * \return Returns FALSE if the previous publish is still in progress
+ */
+IFX_EXTERN boolean Ifx_HsslWindow_publish(Ifx_HsslWindow *window);
+
+/** \brief Copy data into the image and mark the area as changed
+ * \param window Pointer to the publisher object
+ * \param offset Offset of the area in bytes
+ * \param data Data to copy
+ * \param size Size of the data in bytes
+ * \return Returns FALSE if a publish is in progress, nothing is copied
+ */
+IFX_EXTERN boolean Ifx_HsslWindow_write(Ifx_HsslWindow *window, Ifx_SizeT offset, const void *data, Ifx_SizeT size);
+
+/** \} */
+
+/** \name Subscriber
+ * \{ */
+
+/** \brief Return the bank of the last publish received, NULL_PTR if none
+ * \param mirror Pointer to the subscriber object
+ */
+IFX_INLINE const void *Ifx_HsslWindow_getMirrorImage(const Ifx_HsslWindow_Mirror *mirror)
+{
+    return (mirror->sequence != 0) ? mirror->image[mirror->sequence & 1] : NULL_PTR;
+}
+
+
+/** \brief Initialize the subscriber and clear the header
+ *
+ * Called before the partner starts publishing.
+ * \param mirror Pointer to the subscriber object
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_HsslWindow_initMirror(Ifx_HsslWindow_Mirror *mirror, const Ifx_HsslWindow_MirrorConfig *config);
+
+/** \brief Check for a new publish and call the subscriptions of the changed regions
+ * \param mirror Pointer to the subscriber object
+ * \return Returns TRUE if a new publish was received
+ */
+IFX_EXTERN boolean Ifx_HsslWindow_poll(Ifx_HsslWindow_Mirror *mirror);
+
+/** \brief Subscribe to an area of the image
+ * \param mirror Pointer to the subscriber object
+ * \param offset Offset of the area in bytes
+ * \param size Size of the area in bytes
+ * \param callback Function called by \ref Ifx_HsslWindow_poll() when a region of the area changed
+ * \param data Callback data
+ * \return Returns FALSE if all the subscriptions are used
+ */
+IFX_EXTERN boolean Ifx_HsslWindow_subscribe(Ifx_HsslWindow_Mirror *mirror, Ifx_SizeT offset, Ifx_SizeT size, Ifx_HsslWindow_Callback callback, void *data);
+
+/** \} */
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
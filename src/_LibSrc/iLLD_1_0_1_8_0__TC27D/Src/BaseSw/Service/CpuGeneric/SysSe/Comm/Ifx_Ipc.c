@@ -0,0 +1,147 @@
+/**
+ * \file Ifx_Ipc.c
+ * \brief Inter-core message passing
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_Ipc.h"
+#include "_Utilities/Ifx_Assert.h"
+#include "SysSe/Bsp/Bsp.h"
+
+/*
+ * Note: each queue has a single writer (the source CPU) and a single reader (the destination CPU), as
+ * required by the multi-core FIFO. Interrupts are disabled during the queue access so that tasks and
+ * interrupts of the same CPU can send and receive.
+ */
+
+Ifx_Ipc *Ifx_Ipc_init(Ifx_Ipc *ipc, const Ifx_Ipc_Config *config)
+{
+    uint32 source;
+    uint32 destination;
+
+    /* Shared object: use the non cached LMU or the global DSPR address */
+    ipc = (Ifx_Ipc *)IFXCPU_NON_CACHED_ADDR(IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), ipc));
+
+    for (source = 0; source < IFXCPU_NUM_MODULES; source++)
+    {
+        for (destination = 0; destination < IFXCPU_NUM_MODULES; destination++)
+        {
+            if (source != destination)
+            {
+                ipc->queue[source][destination] = Ifx_FifoMc_init(ipc->memory[source][destination],
+                    IFX_CFG_IPC_QUEUE_LENGTH * sizeof(Ifx_Ipc_Message), sizeof(Ifx_Ipc_Message));
+            }
+            else
+            {
+                ipc->queue[source][destination] = NULL_PTR;
+            }
+        }
+
+        ipc->sendFailed[source] = 0;
+
+        if (config->isrPriority[source] != 0)
+        {
+            ipc->src[source] = &MODULE_SRC.GPSR.GPSR[source].SR0;
+            IfxSrc_init(ipc->src[source], (IfxSrc_Tos)source, config->isrPriority[source]);
+            IfxSrc_enable(ipc->src[source]);
+        }
+        else
+        {
+            ipc->src[source] = NULL_PTR;
+        }
+    }
+
+    __dsync();
+
+    return ipc;
+}
+
+
+void Ifx_Ipc_initConfig(Ifx_Ipc_Config *config)
+{
+    uint32 i;
+
+    for (i = 0; i < IFXCPU_NUM_MODULES; i++)
+    {
+        config->isrPriority[i] = 0;
+    }
+}
+
+
+boolean Ifx_Ipc_receive(Ifx_Ipc *ipc, IfxCpu_Id *source, Ifx_Ipc_Message *msg)
+{
+    uint32  destination = IfxCpu_getCoreId();
+    uint32  i;
+    boolean result      = FALSE;
+
+    for (i = 0; (i < IFXCPU_NUM_MODULES) && (result == FALSE); i++)
+    {
+        Ifx_FifoMc *queue = ipc->queue[i][destination];
+
+        if ((queue != NULL_PTR) && (Ifx_FifoMc_isEmpty(queue) == FALSE))
+        {
+            boolean interruptState = IfxCpu_disableInterrupts();
+            result = Ifx_FifoMc_read(queue, msg, sizeof(Ifx_Ipc_Message), TIME_NULL) == 0;
+            IfxCpu_restoreInterrupts(interruptState);
+            *source = (IfxCpu_Id)i;
+        }
+    }
+
+    return result;
+}
+
+
+boolean Ifx_Ipc_send(Ifx_Ipc *ipc, IfxCpu_Id destination, const Ifx_Ipc_Message *msg)
+{
+    uint32          source = IfxCpu_getCoreId();
+    Ifx_FifoMc     *queue;
+    Ifx_Ipc_Message handoff;
+    boolean         result;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (destination < IFXCPU_NUM_MODULES) && (destination != source));
+    queue = ipc->queue[source][destination];
+
+    /* Zero-copy buffer handoff: the destination reads the buffer from memory, not from the cache of the source */
+    handoff = *msg;
+
+    if (msg->data != NULL_PTR)
+    {
+        IfxCpu_flushDataCache(msg->data, msg->length);
+        handoff.data = (void *)IFXCPU_NON_CACHED_ADDR(IFXCPU_GLB_ADDR_DSPR(source, msg->data));
+    }
+
+    {
+        boolean interruptState = IfxCpu_disableInterrupts();
+        result = (Ifx_FifoMc_writeCount(queue) >= sizeof(Ifx_Ipc_Message))
+                 && (Ifx_FifoMc_write(queue, &handoff, sizeof(Ifx_Ipc_Message), TIME_NULL) == 0);
+        IfxCpu_restoreInterrupts(interruptState);
+    }
+
+    if (result == FALSE)
+    {
+        ipc->sendFailed[source]++;
+    }
+    else if (ipc->src[destination] != NULL_PTR)
+    {
+        IfxSrc_setRequest(ipc->src[destination]);
+    }
+
+    return result;
+}
@@ -0,0 +1,148 @@
+/**
+ * \file Ifx_Ipc.h
+ * \brief Inter-core message passing
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_comm_ipc Inter-core messages
+ * \ingroup library_srvsw_sysse_comm
+ *
+ * The IPC service exchanges fixed size messages between the CPUs. Each source / destination CPU pair has its
+ * own queue of \ref IFX_CFG_IPC_QUEUE_LENGTH messages, implemented with the multi-core FIFO
+ * (\ref IfxLld_lib_datahandling_fifomc): no lock is shared between the CPUs.
+ *
+ * \ref Ifx_Ipc_send() raises the general purpose service request (GPSR group n, SR0) of the destination CPU n,
+ * so that the destination is woken up by an interrupt when a message arrives instead of polling a shared flag.
+ * The interrupt of a CPU is enabled with a non zero priority in \ref Ifx_Ipc_Config, its service routine calls
+ * \ref Ifx_Ipc_receive() until it returns FALSE. A CPU with priority 0 polls \ref Ifx_Ipc_receive().
+ *
+ * Messages carry a pointer to a buffer which is handed over to the destination without copy. The sender shall
+ * not access the buffer anymore; it is typically returned to its owner with a reply message. A buffer in a
+ * local DSPR is converted to its global address, a buffer in a cached segment is written back from the data
+ * cache of the sender and converted to its non cached address.
+ *
+ * The IPC object is shared by all the CPUs. It is placed in the LMU with \ref IFX_LMU_DATA and accessed through
+ * the non cached address returned by \ref Ifx_Ipc_init(), which is called by CPU0 before the other CPUs are started.
+ *
+ * Usage example: CPU1 passes sample blocks to CPU0
+ * \code
+ * IFX_LMU_DATA Ifx_Ipc ipcMemory;
+ * Ifx_Ipc             *ipc;
+ *
+ * // CPU0, before starting CPU1
+ * Ifx_Ipc_Config config;
+ * Ifx_Ipc_initConfig(&config);
+ * config.isrPriority[IfxCpu_Id_0] = IFX_INTPRIO_IPC_CPU0;
+ * ipc = Ifx_Ipc_init(&ipcMemory, &config);
+ *
+ * // CPU1
+ * Ifx_Ipc_Message msg = {MSG_SAMPLES, sizeof(block), &block, 0};
+ * Ifx_Ipc_send(ipc, IfxCpu_Id_0, &msg);
+ *
+ * // CPU0
+ * IFX_INTERRUPT(ipcIsrCpu0, 0, IFX_INTPRIO_IPC_CPU0)
+ * {
+ *     IfxCpu_Id       source;
+ *     Ifx_Ipc_Message msg;
+ *
+ *     while (Ifx_Ipc_receive(ipc, &source, &msg) != FALSE)
+ *     {
+ *         processSamples(msg.data, msg.length);
+ *     }
+ * }
+ * \endcode
+ *
+ */
+#ifndef IFX_IPC_H
+#define IFX_IPC_H 1
+
+#include "_Lib/DataHandling/Ifx_FifoMc.h"
+#include "Cpu/Std/IfxCpu.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_IPC_QUEUE_LENGTH)
+#define IFX_CFG_IPC_QUEUE_LENGTH  (8)  /**<\brief Number of messages of each source / destination queue */
+#endif
+
+/** \brief Size in bytes of the memory of one queue */
+#define IFX_IPC_QUEUE_SIZE (IFX_FIFOMC_BUFFER_SIZE(IFX_CFG_IPC_QUEUE_LENGTH * sizeof(Ifx_Ipc_Message)))
+
+/** \addtogroup library_srvsw_sysse_comm_ipc
+ * \{ */
+
+/** \brief Message */
+typedef struct
+{
+    uint32 id;      /**<\brief message identifier, defined by the application */
+    uint32 length;  /**<\brief length of the buffer in bytes */
+    void  *data;    /**<\brief buffer handed over to the destination CPU, NULL_PTR if none */
+    uint32 param;   /**<\brief message parameter, defined by the application */
+} Ifx_Ipc_Message;
+
+/** \brief Configuration */
+typedef struct
+{
+    Ifx_Priority isrPriority[IFXCPU_NUM_MODULES];  /**<\brief priority of the GPSR interrupt of each CPU, 0 if the CPU polls */
+} Ifx_Ipc_Config;
+
+/** \brief IPC object */
+typedef struct
+{
+    Ifx_FifoMc            *queue[IFXCPU_NUM_MODULES][IFXCPU_NUM_MODULES];                 /**<\brief queue [source][destination], NULL_PTR if source == destination */
+    volatile Ifx_SRC_SRCR *src[IFXCPU_NUM_MODULES];                                       /**<\brief service request of each destination CPU, NULL_PTR if the CPU polls */
+    uint32                 sendFailed[IFXCPU_NUM_MODULES];                                /**<\brief number of messages not sent because the queue was full, per source CPU */
+    uint8                  memory[IFXCPU_NUM_MODULES][IFXCPU_NUM_MODULES][IFX_IPC_QUEUE_SIZE]; /**<\brief queue memory */
+} Ifx_Ipc;
+
+/** \brief Initialize the IPC object and the GPSR service requests
+ *
+ * Called by CPU0 before the other CPUs are started.
+ * \param ipc Pointer to the IPC object, shall be in the LMU or in a DSPR
+ * \param config Pointer to the configuration
+ * \return Returns the non cached / global address of the IPC object, to be used by all CPUs
+ */
+IFX_EXTERN Ifx_Ipc *Ifx_Ipc_init(Ifx_Ipc *ipc, const Ifx_Ipc_Config *config);
+
+/** \brief Initialize the configuration with default values: all CPUs poll
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_Ipc_initConfig(Ifx_Ipc_Config *config);
+
+/** \brief Receive the oldest message sent to the calling CPU
+ *
+ * The queues of the source CPUs are checked in the CPU index order.
+ * \param ipc Pointer to the IPC object
+ * \param source Returns the index of the source CPU
+ * \param msg Returns the message
+ * \return Returns FALSE if no message is available
+ */
+IFX_EXTERN boolean Ifx_Ipc_receive(Ifx_Ipc *ipc, IfxCpu_Id *source, Ifx_Ipc_Message *msg);
+
+/** \brief Send a message from the calling CPU and raise the service request of the destination CPU
+ *
+ * The buffer msg->data is handed over to the destination CPU, its address is converted for the destination.
+ * \param ipc Pointer to the IPC object
+ * \param destination Index of the destination CPU
+ * \param msg Pointer to the message, copied into the queue
+ * \return Returns FALSE if the queue is full, the buffer stays then with the caller
+ */
+IFX_EXTERN boolean Ifx_Ipc_send(Ifx_Ipc *ipc, IfxCpu_Id destination, const Ifx_Ipc_Message *msg);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
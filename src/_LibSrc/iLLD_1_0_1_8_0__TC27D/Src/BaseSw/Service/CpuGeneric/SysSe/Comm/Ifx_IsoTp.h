@@ -0,0 +1,203 @@
+/**
+ * \file Ifx_IsoTp.h
+ * \brief ISO 15765-2 (ISO-TP) transport layer on CAN
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_comm_isotp ISO-TP
+ * \ingroup library_srvsw_sysse_comm
+ *
+ * Transport of messages longer than a CAN frame over \ref IfxLld_Multican_Can, as defined by ISO 15765-2 for
+ * classic CAN with normal addressing: single frame (SF), first frame (FF), consecutive frames (CF) and flow
+ * control (FC). Messages up to 4095 bytes use the 12 bit FF length, longer messages the 32 bit escape length.
+ *
+ * The messages are segmented directly from the buffer of the application, which shall stay unchanged until the
+ * transmission is complete, and reassembled directly into the receive buffer of the application: no
+ * intermediate copy.
+ *
+ * Transmission: the transmit message object should be a transmit FIFO (several message objects): while the
+ * receiver allows STmin = 0, \ref Ifx_IsoTp_process() fills all the free FIFO entries with consecutive frames,
+ * which are sent back to back. With STmin != 0, one CF is sent per STmin. The block size of the receiver is
+ * respected, a new FC is awaited after each block.
+ *
+ * Reception: the FC sent after the FF and after each block uses the blockSize and stMin of the configuration.
+ * The default BS = 0, STmin = 0 lets the sender transmit the whole message without further FC, for the highest
+ * throughput with trusted testers. Slow senders or gateways may require a block size and a minimal separation
+ * time. A FF announcing a message longer than the receive buffer is answered with FC overflow.
+ *
+ * The N_Bs (FC expected) and N_Cr (CF expected) timeouts abort the transfer.
+ *
+ * Usage example, download into the program flash:
+ * \code
+ * static IfxMultican_Can_MsgObj isoTpRxMsgObj;   // receive, physical request ID e.g. 0x7E0
+ * static IfxMultican_Can_MsgObj isoTpTxMsgObj;   // transmit FIFO of 8 message objects, response ID e.g. 0x7E8
+ * static Ifx_IsoTp              isoTp;
+ * static uint8                  rxBuffer[4095];
+ *
+ * static void onMessage(void *data, const uint8 *message, uint32 length)
+ * {
+ *     // e.g. UDS TransferData: 0x36, block sequence counter, data
+ *     Ifx_FlashUpdate_write(&flashUpdate, &message[2], length - 2);
+ * }
+ *
+ * // initialisation, after IfxMultican_Can_MsgObj_init()
+ * Ifx_IsoTp_Config config;
+ * Ifx_IsoTp_initConfig(&config);
+ * config.rxMsgObj     = &isoTpRxMsgObj;
+ * config.txMsgObj     = &isoTpTxMsgObj;
+ * config.rxBuffer     = rxBuffer;
+ * config.rxBufferSize = sizeof(rxBuffer);
+ * config.rxHandler    = &onMessage;
+ * Ifx_IsoTp_init(&isoTp, &config);
+ *
+ * // background loop, or transmit / receive interrupts of the message objects
+ * Ifx_IsoTp_process(&isoTp);
+ *
+ * // response
+ * Ifx_IsoTp_send(&isoTp, response, responseLength);
+ * \endcode
+ *
+ */
+#ifndef IFX_ISOTP_H
+#define IFX_ISOTP_H 1
+
+#include "Cpu/Std/Ifx_Types.h"
+#include "Multican/Can/IfxMultican_Can.h"
+
+//----------------------------------------------------------------------------------------
+#define IFX_ISOTP_FRAME_SIZE     (8)      /**<\brief Size of a classic CAN frame in bytes */
+#define IFX_ISOTP_MAX_SF_LENGTH  (7)      /**<\brief Maximal length of a message sent as single frame */
+#define IFX_ISOTP_MAX_FF_LENGTH  (4095)   /**<\brief Maximal length of a message with the 12 bit FF length */
+
+/** \addtogroup library_srvsw_sysse_comm_isotp
+ * \{ */
+
+/** \brief Handler of a received message
+ * \param data Handler data of the configuration
+ * \param message Pointer to the message, in the receive buffer. Valid until the next \ref Ifx_IsoTp_process()
+ * \param length Length of the message in bytes
+ */
+typedef void (*Ifx_IsoTp_Handler)(void *data, const uint8 *message, uint32 length);
+
+/** \brief Status of the last transmission or reception */
+typedef enum
+{
+    Ifx_IsoTp_Status_idle,           /**<\brief No transfer yet */
+    Ifx_IsoTp_Status_busy,           /**<\brief Transfer in progress */
+    Ifx_IsoTp_Status_done,           /**<\brief Transfer completed */
+    Ifx_IsoTp_Status_timeout,        /**<\brief Transfer aborted: no FC (N_Bs) or no CF (N_Cr) in time */
+    Ifx_IsoTp_Status_overflow,       /**<\brief Transfer aborted: message longer than the receive buffer */
+    Ifx_IsoTp_Status_sequenceError   /**<\brief Reception aborted: wrong CF sequence number */
+} Ifx_IsoTp_Status;
+
+/** \brief Configuration */
+typedef struct
+{
+    IfxMultican_Can_MsgObj *rxMsgObj;       /**<\brief Initialised receive message object: SF, FF, CF and FC of the peer */
+    IfxMultican_Can_MsgObj *txMsgObj;       /**<\brief Initialised transmit message object, preferably a transmit FIFO */
+    uint8                  *rxBuffer;       /**<\brief Receive buffer, NULL_PTR if no message is received */
+    uint32                  rxBufferSize;   /**<\brief Size of the receive buffer in bytes */
+    Ifx_IsoTp_Handler       rxHandler;      /**<\brief Handler of the received messages, NULL_PTR if polled with Ifx_IsoTp_getRxStatus() */
+    void                   *rxHandlerData;  /**<\brief Data passed to the handler */
+    uint8                   blockSize;      /**<\brief Block size sent in the FC, 0 for no further FC */
+    uint8                   stMin;          /**<\brief Minimal separation time sent in the FC, ISO 15765-2 coding */
+    boolean                 padding;        /**<\brief TRUE to send 8 byte frames, padded with paddingByte */
+    uint8                   paddingByte;    /**<\brief Value of the padding bytes */
+    uint16                  timeout;        /**<\brief N_Bs and N_Cr timeout in ms */
+} Ifx_IsoTp_Config;
+
+/** \brief Transport layer object */
+typedef struct
+{
+    IfxMultican_Can_MsgObj *rxMsgObj;         /**<\brief Receive message object */
+    IfxMultican_Can_MsgObj *txMsgObj;         /**<\brief Transmit message object */
+    uint32                  txId;             /**<\brief ID of the transmitted frames */
+    uint8                   blockSize;        /**<\brief Block size sent in the FC */
+    uint8                   stMin;            /**<\brief Minimal separation time sent in the FC */
+    boolean                 padding;          /**<\brief TRUE to send 8 byte frames */
+    uint8                   paddingByte;      /**<\brief Value of the padding bytes */
+    Ifx_TickTime            timeout;          /**<\brief N_Bs and N_Cr timeout */
+    Ifx_IsoTp_Handler       rxHandler;        /**<\brief Handler of the received messages */
+    void                   *rxHandlerData;    /**<\brief Data passed to the handler */
+    const uint8            *txData;           /**<\brief Message being sent, buffer of the application */
+    uint32                  txLength;         /**<\brief Length of the message being sent */
+    uint32                  txIndex;          /**<\brief Index of the next byte to be sent */
+    uint8                   txSequence;       /**<\brief Sequence number of the next CF */
+    uint8                   txBlockSize;      /**<\brief Block size of the last FC received */
+    uint8                   txBlockCount;     /**<\brief CFs sent in the current block */
+    boolean                 txWaitFc;         /**<\brief TRUE while a FC is awaited */
+    Ifx_TickTime            txStMin;          /**<\brief Minimal separation time of the last FC received */
+    Ifx_TickTime            txNextTime;       /**<\brief Earliest time of the next CF */
+    Ifx_TickTime            txDeadline;       /**<\brief End of the N_Bs timeout */
+    Ifx_IsoTp_Status        txStatus;         /**<\brief Status of the transmission */
+    uint8                  *rxBuffer;         /**<\brief Receive buffer */
+    uint32                  rxBufferSize;     /**<\brief Size of the receive buffer */
+    uint32                  rxLength;         /**<\brief Length of the message being received or received */
+    uint32                  rxIndex;          /**<\brief Number of bytes received */
+    uint8                   rxSequence;       /**<\brief Expected sequence number of the next CF */
+    uint8                   rxBlockCount;     /**<\brief CFs received in the current block */
+    uint8                   rxFcPci;          /**<\brief PCI byte of the FC to be sent, 0 if none */
+    Ifx_TickTime            rxDeadline;       /**<\brief End of the N_Cr timeout */
+    Ifx_IsoTp_Status        rxStatus;         /**<\brief Status of the reception */
+    uint32                  rxMessages;       /**<\brief Number of received messages */
+    uint32                  txMessages;       /**<\brief Number of sent messages */
+} Ifx_IsoTp;
+
+/** \brief Returns the status of the reception
+ * \param isoTp Pointer to the transport layer object
+ * \param length Returns the length of the received message if the status is Ifx_IsoTp_Status_done. May be NULL_PTR
+ * \return Returns the status of the reception
+ */
+IFX_EXTERN Ifx_IsoTp_Status Ifx_IsoTp_getRxStatus(const Ifx_IsoTp *isoTp, uint32 *length);
+
+/** \brief Returns the status of the transmission
+ * \param isoTp Pointer to the transport layer object
+ * \return Returns the status of the transmission
+ */
+IFX_EXTERN Ifx_IsoTp_Status Ifx_IsoTp_getTxStatus(const Ifx_IsoTp *isoTp);
+
+/** \brief Initialize the transport layer
+ * \param isoTp Pointer to the transport layer object
+ * \param config Pointer to the configuration
+ * \return Returns FALSE if a message object is missing
+ */
+IFX_EXTERN boolean Ifx_IsoTp_init(Ifx_IsoTp *isoTp, const Ifx_IsoTp_Config *config);
+
+/** \brief Initialize the configuration: BS = 0, STmin = 0, padding with 0xCC, 1000 ms timeout
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_IsoTp_initConfig(Ifx_IsoTp_Config *config);
+
+/** \brief Receive the frames, send the consecutive frames which are due and check the timeouts. Never waits
+ * \param isoTp Pointer to the transport layer object
+ */
+IFX_EXTERN void Ifx_IsoTp_process(Ifx_IsoTp *isoTp);
+
+/** \brief Start the transmission of a message
+ *
+ * The SF or the FF is sent immediately, the CFs by \ref Ifx_IsoTp_process().
+ * \param isoTp Pointer to the transport layer object
+ * \param data Pointer to the message, shall stay unchanged until the transmission is complete
+ * \param length Length of the message in bytes, at least 1
+ * \return Returns FALSE if a transmission is in progress or the message object is busy
+ */
+IFX_EXTERN boolean Ifx_IsoTp_send(Ifx_IsoTp *isoTp, const uint8 *data, uint32 length);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -0,0 +1,245 @@
+/**
+ * \file Ifx_LinMaster.h
+ * \brief Interrupt driven LIN master schedule table
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_comm_linmaster LIN master
+ * \ingroup library_srvsw_sysse_comm
+ *
+ * The LIN master runs a schedule table without CPU wait: each frame is a state machine advanced by the
+ * interrupts, the CPU only executes a few instructions per header, response and slot.
+ * - the slots are timed by an STM comparator. At each slot interrupt the compare value is increased by the slot
+ * time, so that the schedule does not drift with the interrupt latency. The slot interrupt sends the header of
+ * the frame of the slot: data length, checksum mode and protected ID (the parity bits are computed by the service).
+ * - at the end of the header (TH), the response of a published frame is written into the TX FIFO, the reception
+ * of the response of a subscribed frame is enabled.
+ * - at the end of the response (TR, RR) the frame is completed, the received data are copied into the frame.
+ * - the errors (header and response timeout, checksum, frame, collision, parity, RX FIFO overflow) complete the
+ * frame with an error status.
+ *
+ * The frames are the signal table of the application: \ref Ifx_LinMaster_readFrame() and
+ * \ref Ifx_LinMaster_writeFrame() copy the data with disabled interrupts, consistent with the interrupts. A frame
+ * still in progress at the next slot is aborted with the status Ifx_LinMaster_Status_slotOverrun.
+ *
+ * The ASCLIN module is initialised as LIN master with \ref IfxAsclin_Lin_initModule(), with the hardware checksum
+ * enabled (csEnable = TRUE) and the checksum not injected into the RX FIFO. The ASCLIN TX, RX and error interrupts
+ * and the STM interrupt are installed by the application.
+ *
+ * Usage example:
+ * \code
+ * static Ifx_LinMaster_Frame linFrames[] = {
+ *     // id,  length, direction,                          checksum
+ *     {0x10, 2,      Ifx_LinMaster_Direction_publish,   IfxAsclin_Checksum_enhanced},
+ *     {0x21, 8,      Ifx_LinMaster_Direction_subscribe, IfxAsclin_Checksum_enhanced},
+ * };
+ *
+ * static const Ifx_LinMaster_Slot linSchedule[] = {
+ *     // frame,         time [us]
+ *     {&linFrames[0], 10000},
+ *     {&linFrames[1], 10000},
+ *     {NULL_PTR,      5000 },
+ * };
+ *
+ * static IfxAsclin_Lin  lin;
+ * static Ifx_LinMaster  linMaster;
+ *
+ * IFX_INTERRUPT(linTxIsr, 0, ISR_PRIORITY_LIN_TX) { Ifx_LinMaster_onInterrupt(&linMaster); }
+ * IFX_INTERRUPT(linRxIsr, 0, ISR_PRIORITY_LIN_RX) { Ifx_LinMaster_onInterrupt(&linMaster); }
+ * IFX_INTERRUPT(linErIsr, 0, ISR_PRIORITY_LIN_ER) { Ifx_LinMaster_onInterrupt(&linMaster); }
+ * IFX_INTERRUPT(linSlotIsr, 0, ISR_PRIORITY_LIN_SLOT) { Ifx_LinMaster_onSlot(&linMaster); }
+ *
+ * // initialisation
+ * Ifx_LinMaster_Config config;
+ * Ifx_LinMaster_initConfig(&config);
+ * config.lin          = &lin;
+ * config.stm          = &MODULE_STM0;
+ * config.schedule     = linSchedule;
+ * config.slotCount    = Ifx_COUNTOF(linSchedule);
+ * config.txPriority   = ISR_PRIORITY_LIN_TX;
+ * config.rxPriority   = ISR_PRIORITY_LIN_RX;
+ * config.erPriority   = ISR_PRIORITY_LIN_ER;
+ * config.slotPriority = ISR_PRIORITY_LIN_SLOT;
+ * Ifx_LinMaster_init(&linMaster, &config);
+ * Ifx_LinMaster_start(&linMaster);
+ *
+ * // application task
+ * uint8 data[8];
+ * Ifx_LinMaster_writeFrame(&linFrames[0], lampRequest, 2);
+ *
+ * if (Ifx_LinMaster_readFrame(&linFrames[1], data) == Ifx_LinMaster_Status_ok)
+ * {
+ *     ...
+ * }
+ * \endcode
+ *
+ */
+#ifndef IFX_LINMASTER_H
+#define IFX_LINMASTER_H 1
+
+#include "Cpu/Std/Ifx_Types.h"
+#include "Asclin/Lin/IfxAsclin_Lin.h"
+#include "Stm/Std/IfxStm.h"
+
+//----------------------------------------------------------------------------------------
+#define IFX_LINMASTER_MAX_LENGTH (8)  /**<\brief Maximal data length of a frame */
+
+/** \addtogroup library_srvsw_sysse_comm_linmaster
+ * \{ */
+
+/** \brief Direction of the response, seen by the master */
+typedef enum
+{
+    Ifx_LinMaster_Direction_publish,    /**<\brief the master sends the response */
+    Ifx_LinMaster_Direction_subscribe   /**<\brief a slave sends the response */
+} Ifx_LinMaster_Direction;
+
+/** \brief Status of the last transfer of a frame */
+typedef enum
+{
+    Ifx_LinMaster_Status_none,           /**<\brief the frame was not transferred yet */
+    Ifx_LinMaster_Status_ok,             /**<\brief the frame was transferred */
+    Ifx_LinMaster_Status_busy,           /**<\brief the frame is in progress */
+    Ifx_LinMaster_Status_noResponse,     /**<\brief no response before the response timeout */
+    Ifx_LinMaster_Status_checksumError,  /**<\brief wrong checksum of the received response */
+    Ifx_LinMaster_Status_error,          /**<\brief header timeout, frame, collision, parity error or RX FIFO overflow */
+    Ifx_LinMaster_Status_slotOverrun     /**<\brief the frame was not completed before the next slot */
+} Ifx_LinMaster_Status;
+
+/** \brief Frame, entry of the signal table
+ *
+ * The first 4 fields are initialised by the application, the other fields are initialised to 0.
+ */
+typedef struct
+{
+    uint8                         id;                                /**<\brief frame ID, 0 to 63, without parity bits */
+    uint8                         length;                            /**<\brief data length, 1 to 8 */
+    Ifx_LinMaster_Direction       direction;                         /**<\brief direction of the response */
+    IfxAsclin_Checksum            checksum;                          /**<\brief checksum model, classic for the IDs 60 to 63 */
+    uint8                         data[IFX_LINMASTER_MAX_LENGTH];    /**<\brief data sent or last data received */
+    volatile Ifx_LinMaster_Status status;                            /**<\brief status of the last transfer */
+    volatile uint32               okCount;                           /**<\brief number of transferred frames */
+    volatile uint32               errorCount;                        /**<\brief number of frames completed with an error */
+} Ifx_LinMaster_Frame;
+
+/** \brief Slot of the schedule table */
+typedef struct
+{
+    Ifx_LinMaster_Frame *frame;   /**<\brief frame sent in the slot, NULL_PTR for an empty slot */
+    uint32               time;    /**<\brief slot time in microseconds, from the start of the slot to the start of the next slot */
+} Ifx_LinMaster_Slot;
+
+/** \brief LIN master configuration */
+typedef struct
+{
+    IfxAsclin_Lin            *lin;             /**<\brief ASCLIN LIN handle, initialised as master with hardware checksum */
+    const Ifx_LinMaster_Slot *schedule;        /**<\brief schedule table */
+    uint16                    slotCount;       /**<\brief number of slots in the schedule table */
+    Ifx_STM                  *stm;             /**<\brief STM timing the slots */
+    IfxStm_Comparator         comparator;      /**<\brief STM comparator timing the slots */
+    Ifx_Priority              txPriority;      /**<\brief priority of the ASCLIN TX interrupt */
+    Ifx_Priority              rxPriority;      /**<\brief priority of the ASCLIN RX interrupt */
+    Ifx_Priority              erPriority;      /**<\brief priority of the ASCLIN error interrupt */
+    Ifx_Priority              slotPriority;    /**<\brief priority of the STM interrupt */
+    IfxSrc_Tos                isrProvider;     /**<\brief service provider of the interrupts */
+} Ifx_LinMaster_Config;
+
+/** \brief LIN master object */
+typedef struct
+{
+    Ifx_ASCLIN               *asclin;                 /**<\brief ASCLIN module */
+    Ifx_STM                  *stm;                    /**<\brief STM timing the slots */
+    IfxStm_Comparator         comparator;             /**<\brief STM comparator timing the slots */
+    Ifx_Priority              slotPriority;           /**<\brief priority of the STM interrupt */
+    IfxSrc_Tos                isrProvider;            /**<\brief service provider of the STM interrupt */
+    uint32                    ticksPerMicrosecond;    /**<\brief STM ticks per microsecond */
+    const Ifx_LinMaster_Slot *schedule;               /**<\brief schedule table */
+    uint16                    slotCount;              /**<\brief number of slots in the schedule table */
+    uint16                    slotIndex;              /**<\brief next slot */
+    Ifx_LinMaster_Frame      *frame;                  /**<\brief frame in progress, NULL_PTR if the bus is idle */
+    uint32                    cycles;                 /**<\brief number of completed schedule table cycles */
+    uint32                    slotOverruns;           /**<\brief number of frames aborted by the next slot */
+} Ifx_LinMaster;
+
+/** \brief Returns the number of completed schedule table cycles
+ * \param master Pointer to the LIN master object
+ * \return Returns the number of cycles
+ */
+IFX_INLINE uint32 Ifx_LinMaster_getCycles(const Ifx_LinMaster *master)
+{
+    return master->cycles;
+}
+
+
+/** \brief Initialize the LIN master: interrupts of the ASCLIN module and STM comparator
+ *
+ * The schedule is not started.
+ * \param master Pointer to the LIN master object
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_LinMaster_init(Ifx_LinMaster *master, const Ifx_LinMaster_Config *config);
+
+/** \brief Initialize the configuration: STM0 comparator 0, interrupts disabled (priority 0) on CPU0
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_LinMaster_initConfig(Ifx_LinMaster_Config *config);
+
+/** \brief ASCLIN interrupt handler, called from the TX, RX and error interrupts
+ * \param master Pointer to the LIN master object
+ */
+IFX_EXTERN void Ifx_LinMaster_onInterrupt(Ifx_LinMaster *master);
+
+/** \brief STM interrupt handler, starts the frame of the next slot
+ * \param master Pointer to the LIN master object
+ */
+IFX_EXTERN void Ifx_LinMaster_onSlot(Ifx_LinMaster *master);
+
+/** \brief Copy the data of a frame
+ * \param frame Pointer to the frame
+ * \param data Destination of the data, frame->length bytes
+ * \return Returns the status of the last transfer of the frame
+ */
+IFX_EXTERN Ifx_LinMaster_Status Ifx_LinMaster_readFrame(const Ifx_LinMaster_Frame *frame, uint8 *data);
+
+/** \brief Select the schedule table, used from the next slot on
+ * \param master Pointer to the LIN master object
+ * \param schedule Schedule table
+ * \param slotCount Number of slots in the schedule table
+ */
+IFX_EXTERN void Ifx_LinMaster_setSchedule(Ifx_LinMaster *master, const Ifx_LinMaster_Slot *schedule, uint16 slotCount);
+
+/** \brief Start the schedule table at its first slot
+ * \param master Pointer to the LIN master object
+ */
+IFX_EXTERN void Ifx_LinMaster_start(Ifx_LinMaster *master);
+
+/** \brief Stop the schedule table, the frame in progress is completed
+ * \param master Pointer to the LIN master object
+ */
+IFX_EXTERN void Ifx_LinMaster_stop(Ifx_LinMaster *master);
+
+/** \brief Update the data of a published frame, sent from the next slot of the frame on
+ * \param frame Pointer to the frame
+ * \param data Data
+ * \param length Number of data bytes, at most frame->length
+ */
+IFX_EXTERN void Ifx_LinMaster_writeFrame(Ifx_LinMaster_Frame *frame, const uint8 *data, uint8 length);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -0,0 +1,122 @@
+/**
+ * \file Ifx_Log.c
+ * \brief Deferred formatted output
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include <string.h>
+#include <stdio.h>
+
+#include "Ifx_Log.h"
+#include "_Utilities/Ifx_Assert.h"
+#include "Cpu/Std/IfxCpu.h"
+
+void Ifx_Log_init(Ifx_Log *log, IfxStdIf_DPipe *standardIo, Ifx_Log_Entry *entries, uint32 size)
+{
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (entries != NULL_PTR) && (size > 0));
+
+    log->standardIo   = standardIo;
+    log->entries      = entries;
+    log->size         = size;
+    log->writeTotal   = 0;
+    log->readTotal    = 0;
+    log->dropCount    = 0;
+    log->pendingIndex = 0;
+    log->pendingCount = 0;
+}
+
+
+boolean Ifx_Log_push(Ifx_Log *log, pchar format, uint32 a0, uint32 a1, uint32 a2, uint32 a3)
+{
+    boolean result;
+    boolean interruptState;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, log != NULL_PTR);
+    interruptState = IfxCpu_disableInterrupts();
+
+    result = (log->writeTotal - log->readTotal) < log->size;
+
+    if (result != FALSE)
+    {
+        Ifx_Log_Entry *entry = &log->entries[log->writeTotal % log->size];
+        entry->format  = format;
+        entry->args[0] = a0;
+        entry->args[1] = a1;
+        entry->args[2] = a2;
+        entry->args[3] = a3;
+        __dsync();  /* The entry must be visible before it is published */
+        log->writeTotal++;
+    }
+    else
+    {
+        log->dropCount++;
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return result;
+}
+
+
+uint32 Ifx_Log_process(Ifx_Log *log)
+{
+    boolean full = FALSE;
+
+    do
+    {
+        if (log->pendingCount == 0)
+        {
+            if (Ifx_Log_getPendingCount(log) != 0)
+            {
+                Ifx_Log_Entry *entry = &log->entries[log->readTotal % log->size];
+                sint32         count;
+
+                /* A longer message is truncated, count is then the length before truncation */
+                count = snprintf(log->message, sizeof(log->message), entry->format, entry->args[0], entry->args[1], entry->args[2], entry->args[3]);
+                IFX_ASSERT(IFX_VERBOSE_LEVEL_WARNING, (count >= 0) && (count < (sint32)sizeof(log->message)));
+                count             = __max(0, __min(count, (sint32)sizeof(log->message) - 1));
+                log->pendingIndex = 0;
+                log->pendingCount = (Ifx_SizeT)count;
+                __dsync();  /* The entry must be read before it is released to the producers */
+                log->readTotal++;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        if (log->pendingCount != 0)
+        {
+            Ifx_SizeT count = log->pendingCount;
+
+            if (log->standardIo->txDisabled == FALSE)
+            {
+                IfxStdIf_DPipe_write(log->standardIo, &log->message[log->pendingIndex], &count, TIME_NULL);
+            }
+
+            log->pendingIndex += count;
+            log->pendingCount -= count;
+            full               = log->pendingCount != 0;
+        }
+    } while (full == FALSE);
+
+    return Ifx_Log_getPendingCount(log);
+}
@@ -0,0 +1,177 @@
+/**
+ * \file Ifx_MemShell.h
+ * \brief Memory access shell commands: binary DMA dump, read, write and telemetry watch
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_comm_memshell Memory access shell commands
+ * \ingroup library_srvsw_sysse_comm
+ *
+ * This module adds a command list to \ref Ifx_Shell to inspect the memory without debugger:
+ * - "mdump <address> <length>": binary dump. The memory is sent by the DMA straight from its location to the
+ * ASCLIN, without formatting nor copy: a chain of DMA linked list entries sends the header, the memory by blocks of
+ * \ref IFX_MEMSHELL_DUMP_BLOCK_SIZE bytes and the CRC (\ref IfxAsclin_Asc_writeDma()). The CPU only computes the
+ * CRC. The dump frame follows the command echo:
+ * | sync "MD" (2 bytes) | address (4 bytes) | length (4 bytes) | memory (length bytes) | CRC-32 (4 bytes) |
+ * The CRC is the CRC-32 of IEEE 802.3 (\ref Ifx_Crc_crc32()) over address, length and memory. Multi byte values
+ * are little endian.
+ * - "mread <address> [<count>]": text dump of 32 bit words.
+ * - "mwrite <address> <size> <value> [<value> ...]": write consecutive values of 1, 2 or 4 bytes, hexadecimal.
+ * - "watch [<address> <size> [<divider>]]": register a variable as \ref library_srvsw_sysse_comm_telemetry channel,
+ * sampled every divider calls of \ref Ifx_Telemetry_sample() from the protocol start on ("protocol start"), without
+ * subscribe frame. Without parameter, the watch list is shown.
+ *
+ * The addresses are not checked: an access to an invalid address raises a bus error trap.
+ *
+ * The memory shell object is read by the DMA: it shall be aligned on 32 bytes and not data cached, see
+ * IFX_DMA_BUFFER. The memory dumped from a data cached segment is written back from the data cache of the calling
+ * CPU before the transfer.
+ *
+ * Usage example:
+ * \code
+ * IFX_DMA_BUFFER IFX_ALIGN(32) static Ifx_MemShell memShell;
+ *
+ * // initialisation, the ASC is initialised with dma.useTxDma, the telemetry before Ifx_Shell_init()
+ * Ifx_MemShell_Config memShellConfig;
+ * Ifx_MemShell_initConfig(&memShellConfig);
+ * memShellConfig.asc       = &asc;
+ * memShellConfig.telemetry = &telemetry;
+ * Ifx_MemShell_init(&memShell, &memShellConfig);
+ *
+ * shellConfig.commandList[0] = &appCommands[0];
+ * shellConfig.commandList[1] = Ifx_MemShell_getCommands(&memShell);
+ * Ifx_Shell_init(&shell, &shellConfig);
+ * \endcode
+ *
+ */
+#ifndef IFX_MEMSHELL_H
+#define IFX_MEMSHELL_H 1
+
+#include "Cpu/Std/Ifx_Types.h"
+#include "Asclin/Asc/IfxAsclin_Asc.h"
+#include "SysSe/Comm/Ifx_Shell.h"
+#include "SysSe/Comm/Ifx_Telemetry.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_MEMSHELL_DUMP_BLOCKS)
+#define IFX_CFG_MEMSHELL_DUMP_BLOCKS  (4)    /**<\brief Number of DMA blocks of a dump */
+#endif
+
+#if !defined(IFX_CFG_MEMSHELL_MAX_WATCHES)
+#define IFX_CFG_MEMSHELL_MAX_WATCHES  (8)    /**<\brief Maximal number of watched variables */
+#endif
+
+#define IFX_MEMSHELL_DUMP_BLOCK_SIZE  (0x3FFF)                                                     /**<\brief Maximal size of a DMA block in bytes */
+#define IFX_MEMSHELL_MAX_DUMP_LENGTH  (IFX_CFG_MEMSHELL_DUMP_BLOCKS * IFX_MEMSHELL_DUMP_BLOCK_SIZE) /**<\brief Maximal length of a dump in bytes */
+#define IFX_MEMSHELL_DUMP_HEADER_SIZE (10)                                                         /**<\brief Size of the dump header: sync, address, length */
+#define IFX_MEMSHELL_WATCH_NAME_SIZE  (12)                                                         /**<\brief Size of a watch name: "0x" and 8 digits */
+
+/** \addtogroup library_srvsw_sysse_comm_memshell
+ * \{ */
+
+/** \brief Memory shell configuration */
+typedef struct
+{
+    IfxAsclin_Asc *asc;            /**<\brief ASC of the shell, initialised with dma.useTxDma. NULL_PTR if the dump command is not used */
+    Ifx_Telemetry *telemetry;      /**<\brief Telemetry object receiving the watches. NULL_PTR if the watch command is not used */
+    Ifx_TickTime   dumpTimeout;    /**<\brief Time allowed to the previous transmission to complete before a dump */
+} Ifx_MemShell_Config;
+
+/** \brief Memory shell object */
+typedef struct
+{
+    Ifx_DMA_CH        descriptors[IFX_CFG_MEMSHELL_DUMP_BLOCKS + 2];                        /**<\brief DMA linked list entries of the dump: header, memory blocks, CRC */
+    uint8             header[IFX_MEMSHELL_DUMP_HEADER_SIZE];                                /**<\brief dump header, sent by the DMA */
+    uint8             trailer[4];                                                           /**<\brief dump CRC, sent by the DMA */
+    IfxAsclin_Asc    *asc;                                                                  /**<\brief ASC of the shell, NULL_PTR if not used */
+    Ifx_Telemetry    *telemetry;                                                            /**<\brief telemetry object, NULL_PTR if not used */
+    Ifx_TickTime      dumpTimeout;                                                          /**<\brief time allowed to the previous transmission to complete */
+    uint32            dumpCount;                                                            /**<\brief number of started dumps */
+    uint8             watchCount;                                                           /**<\brief number of watched variables */
+    uint8             watchIds[IFX_CFG_MEMSHELL_MAX_WATCHES];                               /**<\brief telemetry channel IDs of the watched variables */
+    char              watchNames[IFX_CFG_MEMSHELL_MAX_WATCHES][IFX_MEMSHELL_WATCH_NAME_SIZE]; /**<\brief telemetry channel names of the watched variables */
+    Ifx_Shell_Command commands[5];                                                          /**<\brief command list */
+} Ifx_MemShell;
+
+/** \brief Returns the command list, to be set in the shell configuration
+ * \param memShell Pointer to the memory shell object
+ * \return Returns the command list
+ */
+IFX_INLINE Ifx_Shell_CommandListConst Ifx_MemShell_getCommands(const Ifx_MemShell *memShell)
+{
+    return &memShell->commands[0];
+}
+
+
+/** \brief Handle the 'mdump' command
+ * \param args command arguments
+ * \param data Pointer to the memory shell object
+ * \param io Pointer to the IfxStdIf_DPipe object of the shell
+ * \return Returns TRUE
+ */
+IFX_EXTERN boolean Ifx_MemShell_dump(pchar args, void *data, IfxStdIf_DPipe *io);
+
+/** \brief Start the binary dump of a memory area
+ *
+ * Waits at most dumpTimeout for the previous transmission, then returns while the DMA sends the dump.
+ * \param memShell Pointer to the memory shell object
+ * \param address Address of the memory area
+ * \param length Length of the memory area in bytes, 1 to \ref IFX_MEMSHELL_MAX_DUMP_LENGTH
+ * \return Returns TRUE if the dump is started
+ */
+IFX_EXTERN boolean Ifx_MemShell_dumpMemory(Ifx_MemShell *memShell, const void *address, uint32 length);
+
+/** \brief Initialize the memory shell object and its command list
+ * \param memShell Pointer to the memory shell object, aligned on 32 bytes and not data cached
+ * \param config Pointer to the configuration
+ * \return Returns FALSE if the ASC is not initialised with dma.useTxDma
+ */
+IFX_EXTERN boolean Ifx_MemShell_init(Ifx_MemShell *memShell, const Ifx_MemShell_Config *config);
+
+/** \brief Initialize the configuration: no dump, no watch, 100ms dump timeout
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_MemShell_initConfig(Ifx_MemShell_Config *config);
+
+/** \brief Handle the 'mread' command
+ * \param args command arguments
+ * \param data Pointer to the memory shell object
+ * \param io Pointer to the IfxStdIf_DPipe object of the shell
+ * \return Returns TRUE
+ */
+IFX_EXTERN boolean Ifx_MemShell_read(pchar args, void *data, IfxStdIf_DPipe *io);
+
+/** \brief Handle the 'watch' command
+ * \param args command arguments
+ * \param data Pointer to the memory shell object
+ * \param io Pointer to the IfxStdIf_DPipe object of the shell
+ * \return Returns TRUE
+ */
+IFX_EXTERN boolean Ifx_MemShell_watch(pchar args, void *data, IfxStdIf_DPipe *io);
+
+/** \brief Handle the 'mwrite' command
+ * \param args command arguments
+ * \param data Pointer to the memory shell object
+ * \param io Pointer to the IfxStdIf_DPipe object of the shell
+ * \return Returns TRUE
+ */
+IFX_EXTERN boolean Ifx_MemShell_write(pchar args, void *data, IfxStdIf_DPipe *io);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
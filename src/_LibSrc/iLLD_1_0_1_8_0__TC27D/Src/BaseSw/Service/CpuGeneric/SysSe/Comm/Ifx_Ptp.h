@@ -0,0 +1,238 @@
+/**
+ * \file Ifx_Ptp.h
+ * \brief Lightweight IEEE 1588 (PTP) slave on top of the ETH timestamps
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_comm_ptp PTP slave
+ * \ingroup library_srvsw_sysse_comm
+ *
+ * The PTP slave synchronises the system time of the ETH module (\ref IfxLld_Eth_Std_Timestamp) to a PTP
+ * master, so that several nodes share the same time, e.g. to sample synchronously for distributed measurements.
+ * It supports:
+ * - IEEE 1588-2008 (version 2) over ethernet (ethertype 0x88F7), multicast address 01:1B:19:00:00:00
+ * - one-step and two-step masters (Sync, Follow_Up), end to end delay measurement (Delay_Req, Delay_Resp)
+ * - one domain. There is no best master clock algorithm: the slave follows the first master whose Sync
+ * is received, and the next one if the master is silent for \ref Ifx_Ptp_Config::syncTimeout process calls
+ *
+ * On each Sync, the offset to the master is computed from the Sync timestamps and the mean path delay:
+ * - offsets larger than \ref Ifx_Ptp_Config::stepThreshold step the clock (\ref IfxEth_adjustTime())
+ * - smaller offsets are corrected by a PI controller on the clock frequency (\ref IfxEth_adjustFrequency()),
+ * the clock is never stepped back once locked
+ *
+ * The frames are not received by the slave: the owner of the ETH receive descriptors (application or stack)
+ * passes each frame with its receive timestamp to \ref Ifx_Ptp_receive(). \ref Ifx_Ptp_process() is called
+ * periodically (e.g. every 10 ms) to send the Delay_Req and read their transmit timestamps. The Delay_Req
+ * frame uses a buffer of the slave, the frames are sent with \ref IfxEth_sendTransmitPacket(). Both functions
+ * shall be called from the same task or interrupt level.
+ *
+ * Local time bases (STM, GTM TBU...) are not adjustable; \ref Ifx_Ptp_TimeBase maps them to the PTP time
+ * instead: \ref Ifx_Ptp_syncTimeBase() samples the PTP time and the local counter together and estimates the
+ * counter rate, then \ref Ifx_Ptp_getTimeBaseTicks() converts a PTP time into a counter value, e.g. to program
+ * an STM compare or a GTM action at the same PTP time on all nodes. The conversion error is the read jitter
+ * of the sample pair plus the drift since the last sample, below 1 us when synchronised every second.
+ *
+ * Usage example:
+ * \code
+ * static Ifx_Ptp          ptp;
+ * static Ifx_Ptp_TimeBase stmTimeBase;
+ *
+ * static uint64 getStmTicks(void *data)
+ * {
+ *     return IfxStm_get((Ifx_STM *)data);
+ * }
+ *
+ * // initialisation, after IfxEth_init() and IfxEth_initReceiveDescriptorsWithPool()
+ * IfxEth_initTimestamp(&eth, IfxScuCcu_getSpbFrequency());
+ *
+ * Ifx_Ptp_Config config;
+ * Ifx_Ptp_initConfig(&config);
+ * config.eth = &eth;
+ * Ifx_Ptp_init(&ptp, &config);
+ * Ifx_Ptp_initTimeBase(&stmTimeBase, &getStmTicks, &MODULE_STM0, IfxStm_getFrequency(&MODULE_STM0));
+ *
+ * // receive task
+ * uint16 length;
+ * uint8 *frame;
+ * while ((frame = IfxEth_getReceivePacket(&eth, &length)) != NULL_PTR)
+ * {
+ *     IfxEth_Timestamp timestamp;
+ *     boolean          timestamped = IfxEth_getReceiveTimestamp(&eth, &timestamp);
+ *
+ *     if (Ifx_Ptp_receive(&ptp, frame, length, timestamped ? &timestamp : NULL_PTR) == FALSE)
+ *     {
+ *         processFrame(frame, length);
+ *     }
+ *     IfxEth_freeBuffer(eth.rxPool, frame);
+ * }
+ *
+ * // 10 ms task
+ * Ifx_Ptp_process(&ptp);
+ *
+ * // 1 s task
+ * Ifx_Ptp_syncTimeBase(&ptp, &stmTimeBase);
+ *
+ * // sample at the next full second of the PTP time, on all nodes
+ * IfxEth_Timestamp now;
+ * IfxEth_getTime(&eth, &now);
+ * uint64 ticks = Ifx_Ptp_getTimeBaseTicks(&stmTimeBase, (sint64)(now.seconds + 1) * IFXETH_NANOSECONDS_PER_SECOND);
+ * \endcode
+ *
+ */
+#ifndef IFX_PTP_H
+#define IFX_PTP_H 1
+
+#include "Eth/Std/IfxEth.h"
+
+//----------------------------------------------------------------------------------------
+#define IFX_PTP_ETHERTYPE          (0x88F7U)  /**<\brief Ethertype of PTP over ethernet */
+#define IFX_PTP_PORT_IDENTITY_SIZE (10)       /**<\brief Size of a port identity (clock identity and port number) */
+#define IFX_PTP_FRAME_SIZE         (64)       /**<\brief Size of the Delay_Req frame buffer in bytes */
+
+/** \addtogroup library_srvsw_sysse_comm_ptp
+ * \{ */
+
+/** \brief State of the slave */
+typedef enum
+{
+    Ifx_Ptp_State_listening,     /**<\brief No master */
+    Ifx_Ptp_State_uncalibrated,  /**<\brief Master selected, mean path delay not yet measured or clock stepped */
+    Ifx_Ptp_State_slave          /**<\brief Clock controlled by the PI controller */
+} Ifx_Ptp_State;
+
+/** \brief Slave configuration */
+typedef struct
+{
+    IfxEth *eth;                   /**<\brief ETH driver, timestamps initialised by IfxEth_initTimestamp() */
+    uint8   domain;                /**<\brief PTP domain number */
+    uint8   delayRequestRate;      /**<\brief Number of Sync messages per Delay_Req */
+    uint16  syncTimeout;           /**<\brief Number of Ifx_Ptp_process() calls without Sync after which the master is lost */
+    sint32  stepThreshold;         /**<\brief Offset in ns above which the clock is stepped instead of slewed */
+    float32 kp;                    /**<\brief Proportional gain of the PI controller in ppb/ns */
+    float32 ki;                    /**<\brief Integral gain of the PI controller in ppb/ns per Sync */
+    sint32  maxFrequency;          /**<\brief Limit of the frequency correction in ppb */
+} Ifx_Ptp_Config;
+
+/** \brief Slave object */
+typedef struct
+{
+    IfxEth        *eth;                                         /**<\brief ETH driver */
+    Ifx_Ptp_Config config;                                      /**<\brief Copy of the configuration */
+    Ifx_Ptp_State  state;                                       /**<\brief State of the slave */
+    uint8          portIdentity[IFX_PTP_PORT_IDENTITY_SIZE];    /**<\brief Own port identity, from the MAC address */
+    uint8          master[IFX_PTP_PORT_IDENTITY_SIZE];          /**<\brief Port identity of the master */
+    uint16         syncAge;                                     /**<\brief Number of Ifx_Ptp_process() calls since the last Sync */
+    uint16         syncSequence;                                /**<\brief Sequence of the last Sync */
+    boolean        followUpPending;                             /**<\brief TRUE while the Follow_Up of a two-step Sync is expected */
+    uint8          syncCount;                                   /**<\brief Number of Sync since the last Delay_Req */
+    sint64         syncReceived;                                /**<\brief t2: receive time of the last Sync in ns */
+    sint64         syncCorrection;                              /**<\brief Correction field of the last Sync in ns */
+    sint64         masterToSlave;                               /**<\brief t2 - t1 of the last Sync in ns */
+    uint16         delaySequence;                               /**<\brief Sequence of the last Delay_Req */
+    uint16         delayAge;                                    /**<\brief Number of Ifx_Ptp_process() calls since the Delay_Req was sent */
+    boolean        delayPending;                                /**<\brief TRUE while the Delay_Req transmit timestamp is expected */
+    boolean        delaySentValid;                              /**<\brief TRUE if delaySent is known */
+    boolean        delayReceivedValid;                          /**<\brief TRUE if delayReceived is known */
+    sint64         delaySent;                                   /**<\brief t3: transmit time of the last Delay_Req in ns */
+    sint64         delayReceived;                               /**<\brief t4: receive time of the last Delay_Req at the master in ns, less the correction */
+    sint64         offset;                                      /**<\brief Last offset to the master in ns, positive if the slave clock is ahead */
+    sint64         meanPathDelay;                               /**<\brief Filtered mean path delay in ns, negative if not yet measured */
+    float32        integral;                                    /**<\brief Integral of the PI controller in ppb */
+    sint32         frequency;                                   /**<\brief Frequency correction in ppb */
+    uint32         syncs;                                       /**<\brief Number of Sync used */
+    uint32         steps;                                       /**<\brief Number of clock steps */
+    uint32         delayRequests;                               /**<\brief Number of Delay_Req sent */
+    uint32         delayResponses;                              /**<\brief Number of Delay_Resp used */
+    uint32         frame[IFX_PTP_FRAME_SIZE / 4];               /**<\brief Delay_Req frame buffer */
+} Ifx_Ptp;
+
+/** \brief Returns the local counter value, monotonic 64 bit count */
+typedef uint64 (*Ifx_Ptp_GetTicks)(void *data);
+
+/** \brief Mapping of a local counter to the PTP time */
+typedef struct
+{
+    Ifx_Ptp_GetTicks getTicks;      /**<\brief Local counter */
+    void            *data;          /**<\brief Local counter data */
+    uint32           frequency;     /**<\brief Nominal counter frequency in Hz */
+    uint32           samples;       /**<\brief Number of sample pairs since the last clock step */
+    uint32           steps;         /**<\brief Number of PTP clock steps at the last sample */
+    uint64           ticks;         /**<\brief Counter value of the last sample */
+    sint64           time;          /**<\brief PTP time of the last sample in ns */
+    sint32           rate;          /**<\brief Counter rate deviation from the nominal frequency in ppb, filtered */
+} Ifx_Ptp_TimeBase;
+
+/** \brief Converts a PTP time into a local counter value
+ * \param timeBase Pointer to the time base, synchronised by Ifx_Ptp_syncTimeBase()
+ * \param time PTP time in ns
+ * \return Returns the counter value at the PTP time
+ */
+IFX_EXTERN uint64 Ifx_Ptp_getTimeBaseTicks(const Ifx_Ptp_TimeBase *timeBase, sint64 time);
+
+/** \brief Converts a local counter value into a PTP time
+ * \param timeBase Pointer to the time base, synchronised by Ifx_Ptp_syncTimeBase()
+ * \param ticks Counter value
+ * \return Returns the PTP time in ns
+ */
+IFX_EXTERN sint64 Ifx_Ptp_getTimeBaseTime(const Ifx_Ptp_TimeBase *timeBase, uint64 ticks);
+
+/** \brief Initialize the slave
+ * \param ptp Pointer to the slave object
+ * \param config Pointer to the configuration
+ * \return Returns FALSE if the ETH timestamps are not initialised
+ */
+IFX_EXTERN boolean Ifx_Ptp_init(Ifx_Ptp *ptp, const Ifx_Ptp_Config *config);
+
+/** \brief Initialize the configuration with default values: domain 0, one Delay_Req per Sync, step above 100 us
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_Ptp_initConfig(Ifx_Ptp_Config *config);
+
+/** \brief Initialize a time base
+ * \param timeBase Pointer to the time base
+ * \param getTicks Local counter
+ * \param data Local counter data
+ * \param frequency Nominal counter frequency in Hz
+ */
+IFX_EXTERN void Ifx_Ptp_initTimeBase(Ifx_Ptp_TimeBase *timeBase, Ifx_Ptp_GetTicks getTicks, void *data, float32 frequency);
+
+/** \brief Read the Delay_Req transmit timestamp and supervise the master
+ * \param ptp Pointer to the slave object
+ */
+IFX_EXTERN void Ifx_Ptp_process(Ifx_Ptp *ptp);
+
+/** \brief Process a received frame
+ * \param ptp Pointer to the slave object
+ * \param frame Pointer to the frame, from the ethernet header
+ * \param length Frame length in bytes
+ * \param timestamp Receive timestamp of the frame, NULL_PTR if not timestamped
+ * \return Returns FALSE if the frame is not a PTP frame
+ */
+IFX_EXTERN boolean Ifx_Ptp_receive(Ifx_Ptp *ptp, const uint8 *frame, uint16 length, const IfxEth_Timestamp *timestamp);
+
+/** \brief Sample the PTP time and the local counter, and update the counter rate
+ *
+ * To be called periodically, about every second. The rate is not updated across a clock step.
+ * \param ptp Pointer to the slave object
+ * \param timeBase Pointer to the time base
+ */
+IFX_EXTERN void Ifx_Ptp_syncTimeBase(Ifx_Ptp *ptp, Ifx_Ptp_TimeBase *timeBase);
+
+/** \} */
+
+#endif /* IFX_PTP_H */
@@ -94,6 +94,22 @@
  * To enable help command, include the below command in the main command list
  *    {"help",         SHELL_HELP_DESCRIPTION_TEXT                             , &\<Ifx_Shell\>, &Ifx_Shell_showHelp,       },
  *
+ * Command index:
+ * By default each command line is compared with every entry of every command list. With many
+ * commands, a hash index can be built by \ref Ifx_Shell_init(): set Ifx_Shell_Config::commandIndex
+ * to an array of \ref Ifx_Shell_CommandIndexEntry and Ifx_Shell_Config::commandIndexSize to its
+ * number of entries, a power of 2 and at least twice the number of commands. The lookup then
+ * only compares the commands which have the same hash as the command line. The command
+ * lists are unchanged and still used by the help functions. If the index can not be built
+ * (array too small, command with more than \ref IFX_CFG_SHELL_INDEX_MAX_TOKENS tokens), the
+ * shell falls back to the linear search.
+ * \code
+ * static Ifx_Shell_CommandIndexEntry shellIndex[512];
+ *
+ * shellConfig.commandIndex     = shellIndex;
+ * shellConfig.commandIndexSize = Ifx_COUNTOF(shellIndex);
+ * \endcode
+ *
  * \ingroup library_srvsw_sysse_comm
  *
  */
@@ -118,6 +134,10 @@
 #define IFX_CFG_SHELL_COMMAND_LISTS    (1)      /**<\brief Number of command lists */
 #endif
 
+#ifndef IFX_CFG_SHELL_INDEX_MAX_TOKENS
+#define IFX_CFG_SHELL_INDEX_MAX_TOKENS (8)      /**<\brief Maximal number of tokens of an indexed command, including the list prefix */
+#endif
+
 #ifndef IFX_CFG_SHELL_PROMPT
 #define IFX_CFG_SHELL_PROMPT           "Shell>"    /**<\brief Shell prompt */
 #endif
@@ -209,6 +229,15 @@ typedef struct
 
 typedef Ifx_Shell_Command       *Ifx_Shell_CommandList;
 typedef const Ifx_Shell_Command *Ifx_Shell_CommandListConst;
+
+/** \brief Command index entry */
+typedef struct
+{
+    const Ifx_Shell_Command   *command;     /**< \brief Indexed command, NULL_PTR if the entry is free */
+    Ifx_Shell_CommandListConst commandList; /**< \brief Command list containing the command */
+    uint32                     hash;        /**< \brief Hash of the command tokens, including the list prefix */
+    uint32                     tokenCount;  /**< \brief Number of command tokens, including the list prefix */
+} Ifx_Shell_CommandIndexEntry;
 /**
  * \brief Shell object definition
  */
@@ -233,9 +262,12 @@ typedef struct
      * In case "call" is NULL, the corresponding 'data' is ignored, and the 'help' is displayed.
      *
      **/
-    Ifx_Shell_CommandListConst commandList[IFX_CFG_SHELL_COMMAND_LISTS];
+    Ifx_Shell_CommandListConst   commandList[IFX_CFG_SHELL_COMMAND_LISTS];
+
+    Ifx_Shell_CommandIndexEntry *commandIndex;     /**< \brief Command index, NULL_PTR if the command lists are searched linearly */
+    uint32                       commandIndexSize; /**< \brief Number of entries of the command index */
 
-    Ifx_Shell_Protocol         protocol; /**< \brief Protocol handler data */
+    Ifx_Shell_Protocol           protocol;         /**< \brief Protocol handler data */
 } Ifx_Shell;
 
 /**
@@ -243,12 +275,14 @@ typedef struct
  */
 typedef struct
 {
-    IfxStdIf_DPipe            *standardIo;                               /**<\brief Pointer to a IfxStdIf_DPipe object used by the Shell */
-    boolean                    echo;                                     /**<\brief Specifies whether each command shall be echoed back to user */
-    boolean                    showPrompt;                               /**<\brief Specifies whether the IFX_CFG_SHELL_PROMPT shall be displayed after each command */
-    boolean                    sendResultCode;                           /**<\brief Specifies whether the Ifx_Shell_ResultCode shall be sent to user */
-    Ifx_Shell_CommandListConst commandList[IFX_CFG_SHELL_COMMAND_LISTS]; /**< \brief Specifies pointer to the command list */
-    Ifx_Shell_Protocol         protocol;                                 /**<\brief Configuration for the Ifx_Shell_Protocol */
+    IfxStdIf_DPipe              *standardIo;                               /**<\brief Pointer to a IfxStdIf_DPipe object used by the Shell */
+    boolean                      echo;                                     /**<\brief Specifies whether each command shall be echoed back to user */
+    boolean                      showPrompt;                               /**<\brief Specifies whether the IFX_CFG_SHELL_PROMPT shall be displayed after each command */
+    boolean                      sendResultCode;                           /**<\brief Specifies whether the Ifx_Shell_ResultCode shall be sent to user */
+    Ifx_Shell_CommandListConst   commandList[IFX_CFG_SHELL_COMMAND_LISTS]; /**< \brief Specifies pointer to the command list */
+    Ifx_Shell_CommandIndexEntry *commandIndex;                             /**<\brief Memory for the command index, NULL_PTR to search the command lists linearly */
+    uint32                       commandIndexSize;                         /**<\brief Number of entries of commandIndex, must be a power of 2 */
+    Ifx_Shell_Protocol           protocol;                                 /**<\brief Configuration for the Ifx_Shell_Protocol */
 } Ifx_Shell_Config;
 
 /**
@@ -0,0 +1,191 @@
+/**
+ * \file Ifx_SimioPipe.c
+ * \brief Standard interface on the simulated IO (simio) of the instruction set simulator
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include <string.h>
+
+#include "Ifx_SimioPipe.h"
+#include "SysSe/Bsp/Bsp.h"
+#include "simio_pls.h"
+
+static boolean Ifx_SimioPipe_canReadCount(Ifx_SimioPipe *pipe, Ifx_SizeT count, Ifx_TickTime timeout)
+{
+    (void)pipe;
+    (void)timeout;
+    return SIMIO_GetHTCharCount() >= (uint32)count;
+}
+
+
+static boolean Ifx_SimioPipe_canWriteCount(Ifx_SimioPipe *pipe, Ifx_SizeT count, Ifx_TickTime timeout)
+{
+    (void)pipe;
+    (void)count;
+    (void)timeout;
+    return TRUE;
+}
+
+
+static void Ifx_SimioPipe_clearRx(Ifx_SimioPipe *pipe)
+{
+    uint8 data;
+
+    (void)pipe;
+
+    while (SIMIO_GetHTCharCount() != 0)
+    {
+        SIMIO_Read(&data, 1);
+    }
+}
+
+
+static void Ifx_SimioPipe_clearTx(Ifx_SimioPipe *pipe)
+{
+    (void)pipe;
+}
+
+
+static boolean Ifx_SimioPipe_flushTx(Ifx_SimioPipe *pipe, Ifx_TickTime timeout)
+{
+    (void)pipe;
+    (void)timeout;
+    return TRUE;
+}
+
+
+static sint32 Ifx_SimioPipe_getReadCount(Ifx_SimioPipe *pipe)
+{
+    (void)pipe;
+    return (sint32)SIMIO_GetHTCharCount();
+}
+
+
+static IfxStdIf_DPipe_ReadEvent Ifx_SimioPipe_getReadEvent(Ifx_SimioPipe *pipe)
+{
+    (void)pipe;
+    return NULL_PTR;
+}
+
+
+static uint32 Ifx_SimioPipe_getSendCount(Ifx_SimioPipe *pipe)
+{
+    return pipe->sendCount;
+}
+
+
+static Ifx_TickTime Ifx_SimioPipe_getTxTimeStamp(Ifx_SimioPipe *pipe)
+{
+    return pipe->txTimestamp;
+}
+
+
+static sint32 Ifx_SimioPipe_getWriteCount(Ifx_SimioPipe *pipe)
+{
+    (void)pipe;
+    return IFX_SIZET_MAX;
+}
+
+
+static IfxStdIf_DPipe_WriteEvent Ifx_SimioPipe_getWriteEvent(Ifx_SimioPipe *pipe)
+{
+    (void)pipe;
+    return NULL_PTR;
+}
+
+
+static void Ifx_SimioPipe_onEvent(Ifx_SimioPipe *pipe)
+{
+    (void)pipe;
+}
+
+
+static boolean Ifx_SimioPipe_read(Ifx_SimioPipe *pipe, void *data, Ifx_SizeT *count, Ifx_TickTime timeout)
+{
+    Ifx_SizeT requested = *count;
+    Ifx_SizeT available = (Ifx_SizeT)__minu(SIMIO_GetHTCharCount(), (uint32)requested);
+
+    (void)pipe;
+    (void)timeout;
+
+    /* SIMIO_Read() waits for the first byte in blocking mode, only the bytes available are read */
+    *count = (available > 0) ? (Ifx_SizeT)SIMIO_Read(data, (unsigned int)available) : 0;
+
+    return *count == requested;
+}
+
+
+static void Ifx_SimioPipe_resetSendCount(Ifx_SimioPipe *pipe)
+{
+    pipe->sendCount = 0;
+}
+
+
+static boolean Ifx_SimioPipe_write(Ifx_SimioPipe *pipe, void *data, Ifx_SizeT *count, Ifx_TickTime timeout)
+{
+    (void)timeout;
+
+    if (*count > 0)
+    {
+        SIMIO_Write(data, (unsigned int)*count);
+        pipe->sendCount  += (uint32)*count;
+        pipe->txTimestamp = now();
+    }
+
+    return TRUE;
+}
+
+
+void Ifx_SimioPipe_init(Ifx_SimioPipe *pipe, boolean nonBlocking)
+{
+    pipe->sendCount   = 0;
+    pipe->txTimestamp = 0;
+
+    SIMIO_Init((nonBlocking != FALSE) ? SIMIO_NONBLOCKINGMODE : 0);
+}
+
+
+boolean Ifx_SimioPipe_stdIfDPipeInit(IfxStdIf_DPipe *stdif, Ifx_SimioPipe *pipe)
+{
+    /* Ensure the stdif is reset to zeros */
+    memset(stdif, 0, sizeof(IfxStdIf_DPipe));
+
+    /* Set the API link */
+    stdif->driver         = pipe;
+    stdif->write          = (IfxStdIf_DPipe_Write) & Ifx_SimioPipe_write;
+    stdif->read           = (IfxStdIf_DPipe_Read) & Ifx_SimioPipe_read;
+    stdif->getReadCount   = (IfxStdIf_DPipe_GetReadCount) & Ifx_SimioPipe_getReadCount;
+    stdif->getReadEvent   = (IfxStdIf_DPipe_GetReadEvent) & Ifx_SimioPipe_getReadEvent;
+    stdif->getWriteCount  = (IfxStdIf_DPipe_GetWriteCount) & Ifx_SimioPipe_getWriteCount;
+    stdif->getWriteEvent  = (IfxStdIf_DPipe_GetWriteEvent) & Ifx_SimioPipe_getWriteEvent;
+    stdif->canReadCount   = (IfxStdIf_DPipe_CanReadCount) & Ifx_SimioPipe_canReadCount;
+    stdif->canWriteCount  = (IfxStdIf_DPipe_CanWriteCount) & Ifx_SimioPipe_canWriteCount;
+    stdif->flushTx        = (IfxStdIf_DPipe_FlushTx) & Ifx_SimioPipe_flushTx;
+    stdif->clearTx        = (IfxStdIf_DPipe_ClearTx) & Ifx_SimioPipe_clearTx;
+    stdif->clearRx        = (IfxStdIf_DPipe_ClearRx) & Ifx_SimioPipe_clearRx;
+    stdif->onReceive      = (IfxStdIf_DPipe_OnReceive) & Ifx_SimioPipe_onEvent;
+    stdif->onTransmit     = (IfxStdIf_DPipe_OnTransmit) & Ifx_SimioPipe_onEvent;
+    stdif->onError        = (IfxStdIf_DPipe_OnError) & Ifx_SimioPipe_onEvent;
+    stdif->getSendCount   = (IfxStdIf_DPipe_GetSendCount) & Ifx_SimioPipe_getSendCount;
+    stdif->getTxTimeStamp = (IfxStdIf_DPipe_GetTxTimeStamp) & Ifx_SimioPipe_getTxTimeStamp;
+    stdif->resetSendCount = (IfxStdIf_DPipe_ResetSendCount) & Ifx_SimioPipe_resetSendCount;
+    stdif->txDisabled     = FALSE;
+    return TRUE;
+}
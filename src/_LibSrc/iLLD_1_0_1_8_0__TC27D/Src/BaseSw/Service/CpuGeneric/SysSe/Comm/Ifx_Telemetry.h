@@ -0,0 +1,219 @@
+/**
+ * \file Ifx_Telemetry.h
+ * \brief Binary telemetry protocol
+ * \ingroup library_srvsw_sysse_comm_telemetry
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_comm_telemetry Telemetry
+ * This module implements a binary protocol to sample registered variables at configurable rates.
+ * It runs as \ref Ifx_Shell protocol: it is started with the shell command "protocol start"
+ * (\ref Ifx_Shell_protocolStart()) and then executed by \ref Ifx_Shell_process() in place of the
+ * command line parser.
+ *
+ * Frames are COBS encoded and terminated by a 0x00 byte. A decoded frame is:
+ * | type (1 byte) | sequence (1 byte) | payload | CRC16 (2 bytes, little endian) |
+ * The CRC is the CRC-16/CCITT-FALSE (polynom 0x1021, init 0xFFFF) over type, sequence and payload.
+ * Multi byte values are little endian.
+ *
+ * Host to target frames:
+ * - \ref Ifx_Telemetry_FrameType_subscribe: payload id (1 byte), divider (2 bytes). The channel is sampled
+ * every divider calls of \ref Ifx_Telemetry_sample(), 0 stops the channel.
+ * Frames with an invalid CRC are dropped without answer. A channel can also be sampled from the protocol start on,
+ * without subscribe frame, see \ref Ifx_Telemetry_setStartDivider().
+ * - \ref Ifx_Telemetry_FrameType_list: no payload. The target answers one \ref Ifx_Telemetry_FrameType_channel frame per channel
+ * - \ref Ifx_Telemetry_FrameType_stop: no payload. All channels are stopped and the shell returns to the command line
+ *
+ * Target to host frames:
+ * - \ref Ifx_Telemetry_FrameType_ack: payload: type of the acknowledged frame (1 byte), status (1 byte, \ref Ifx_Telemetry_Status)
+ * - \ref Ifx_Telemetry_FrameType_channel: payload: id (1 byte), size (1 byte), name (not terminated)
+ * - \ref Ifx_Telemetry_FrameType_data: payload: time stamp (4 bytes, STM ticks), followed for each sampled
+ * channel by id (1 byte) and value (size bytes)
+ *
+ * Usage example:
+ * \code
+ * static Ifx_Telemetry telemetry;
+ * static float32       speed;
+ * static sint16        current;
+ *
+ * // initialisation, before Ifx_Shell_init()
+ * Ifx_Telemetry_Config telemetryConfig;
+ * Ifx_Telemetry_initConfig(&telemetryConfig);
+ * telemetryConfig.shell = &shell;
+ * Ifx_Telemetry_init(&telemetry, &telemetryConfig);
+ * Ifx_Telemetry_addChannel(&telemetry, "speed", &speed, sizeof(speed));
+ * Ifx_Telemetry_addChannel(&telemetry, "current", &current, sizeof(current));
+ * Ifx_Telemetry_initProtocol(&telemetry, &shellConfig.protocol);
+ *
+ * // periodic interrupt, e.g. 10kHz
+ * Ifx_Telemetry_sample(&telemetry);
+ * \endcode
+ *
+ */
+#ifndef IFX_TELEMETRY_H
+#define IFX_TELEMETRY_H 1
+
+#include "Ifx_Shell.h"
+#include "_Lib/DataHandling/Ifx_Fifo.h"
+#include "SysSe/Math/Ifx_Crc.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_TELEMETRY_MAX_CHANNELS)
+#define IFX_CFG_TELEMETRY_MAX_CHANNELS (32)  /**<\brief Maximal number of registered channels */
+#endif
+
+#if !defined(IFX_CFG_TELEMETRY_FRAME_SIZE)
+#define IFX_CFG_TELEMETRY_FRAME_SIZE   (192) /**<\brief Maximal size of a decoded frame in bytes */
+#endif
+
+/* The length of a sample record, at most one frame, is stored in one byte */
+#if (IFX_CFG_TELEMETRY_FRAME_SIZE > 255)
+#error "IFX_CFG_TELEMETRY_FRAME_SIZE shall not exceed 255 bytes"
+#endif
+
+/** \brief Maximal size of a COBS encoded frame of size bytes, including the delimiter */
+#define IFX_TELEMETRY_ENCODED_SIZE(size) ((size) + ((size) / 254) + 2)
+
+/** \addtogroup library_srvsw_sysse_comm_telemetry
+ * \{ */
+
+/** \brief Frame types */
+typedef enum
+{
+    Ifx_Telemetry_FrameType_subscribe = 0x01,   /**<\brief host: start / stop the sampling of a channel */
+    Ifx_Telemetry_FrameType_list      = 0x02,   /**<\brief host: request the channel list */
+    Ifx_Telemetry_FrameType_stop      = 0x03,   /**<\brief host: stop the protocol */
+    Ifx_Telemetry_FrameType_ack       = 0x81,   /**<\brief target: command acknowledge */
+    Ifx_Telemetry_FrameType_channel   = 0x82,   /**<\brief target: channel description */
+    Ifx_Telemetry_FrameType_data      = 0x90    /**<\brief target: sampled values */
+} Ifx_Telemetry_FrameType;
+
+/** \brief Status returned in the \ref Ifx_Telemetry_FrameType_ack frame */
+typedef enum
+{
+    Ifx_Telemetry_Status_ok               = 0, /**<\brief command executed */
+    Ifx_Telemetry_Status_unknownCommand   = 1, /**<\brief unknown frame type */
+    Ifx_Telemetry_Status_invalidParameter = 2  /**<\brief invalid payload */
+} Ifx_Telemetry_Status;
+
+/** \brief Registered variable */
+typedef struct
+{
+    pchar                name;          /**<\brief channel name, as reported to the host */
+    const volatile void *address;       /**<\brief variable address */
+    uint8                size;          /**<\brief variable size in bytes: 1, 2 or 4 */
+    volatile uint16      divider;       /**<\brief sampling divider, 0 if the channel is not sampled */
+    volatile uint16      counter;       /**<\brief calls of Ifx_Telemetry_sample() left until the next sample */
+    uint16               startDivider;  /**<\brief sampling divider set at the protocol start, 0 to wait for a subscribe frame */
+} Ifx_Telemetry_Channel;
+
+/** \brief Telemetry object */
+typedef struct
+{
+    IfxStdIf_DPipe       *io;                                                           /**<\brief Pointer to the IfxStdIf_DPipe object used by the protocol */
+    Ifx_Shell            *shell;                                                        /**<\brief Shell running the protocol, NULL_PTR if not used */
+    Ifx_Fifo             *samples;                                                      /**<\brief sample records, written by Ifx_Telemetry_sample(), read by Ifx_Telemetry_execute() */
+    volatile boolean      started;                                                      /**<\brief TRUE while the protocol runs */
+    volatile uint32       dropCount;                                                    /**<\brief number of sample records dropped because the sample FIFO was full */
+    Ifx_Telemetry_Channel channels[IFX_CFG_TELEMETRY_MAX_CHANNELS];                     /**<\brief registered channels */
+    uint8                 channelCount;                                                 /**<\brief number of registered channels */
+    uint8                 listIndex;                                                    /**<\brief next channel to be reported to the host, channelCount if none */
+    uint8                 sequence;                                                     /**<\brief sequence number of the next transmitted frame */
+    Ifc_Crc               crc;                                                          /**<\brief CRC16 driver */
+    Ifc_Crc_Table16       crcTable;                                                     /**<\brief CRC16 table */
+    Ifx_SizeT             rxCount;                                                      /**<\brief number of bytes in rxFrame, bigger than the buffer if the frame is too long */
+    Ifx_SizeT             txIndex;                                                      /**<\brief index of the first byte of txFrame not yet written */
+    Ifx_SizeT             txCount;                                                      /**<\brief number of bytes of txFrame not yet written */
+    uint8                 rxFrame[IFX_TELEMETRY_ENCODED_SIZE(IFX_CFG_TELEMETRY_FRAME_SIZE)]; /**<\brief received frame */
+    uint8                 txFrame[IFX_TELEMETRY_ENCODED_SIZE(IFX_CFG_TELEMETRY_FRAME_SIZE)]; /**<\brief encoded frame being transmitted */
+} Ifx_Telemetry;
+
+/** \brief Telemetry configuration */
+typedef struct
+{
+    Ifx_Shell *shell;                   /**<\brief Shell running the protocol, used to return to the command line on stop command. NULL_PTR if not used */
+    Ifx_SizeT  sampleBufferSize;        /**<\brief Size of the sample FIFO in bytes */
+    void      *sampleBuffer;            /**<\brief Memory for the sample FIFO, at least sampleBufferSize + sizeof(Ifx_Fifo) + 8 bytes. If NULL_PTR, the FIFO is allocated dynamically */
+} Ifx_Telemetry_Config;
+
+/** \brief Initialize the configuration with default values
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_Telemetry_initConfig(Ifx_Telemetry_Config *config);
+
+/** \brief Initialize the telemetry object
+ * \param telemetry Pointer to the telemetry object
+ * \param config Pointer to the configuration
+ * \return TRUE on success else FALSE
+ */
+IFX_EXTERN boolean Ifx_Telemetry_init(Ifx_Telemetry *telemetry, const Ifx_Telemetry_Config *config);
+
+/** \brief Register a variable
+ * \param telemetry Pointer to the telemetry object
+ * \param name channel name, must be a constant string
+ * \param address variable address
+ * \param size variable size in bytes: 1, 2 or 4
+ * \return Returns the channel ID, or -1 if the channel could not be registered
+ */
+IFX_EXTERN sint32 Ifx_Telemetry_addChannel(Ifx_Telemetry *telemetry, pchar name, const volatile void *address, uint8 size);
+
+/** \brief Set the shell protocol hooks. Must be called on the shell configuration before \ref Ifx_Shell_init()
+ * \param telemetry Pointer to the telemetry object
+ * \param protocol Pointer to the protocol configuration of the shell
+ */
+IFX_EXTERN void Ifx_Telemetry_initProtocol(Ifx_Telemetry *telemetry, Ifx_Shell_Protocol *protocol);
+
+/** \brief Implementation of Ifx_Shell_Protocol::start
+ * \param telemetry Pointer to the telemetry object
+ * \param io Pointer to the IfxStdIf_DPipe object used by the protocol
+ * \return TRUE
+ */
+IFX_EXTERN boolean Ifx_Telemetry_start(void *telemetry, IfxStdIf_DPipe *io);
+
+/** \brief Implementation of Ifx_Shell_Protocol::execute. Process the host frames and transmit the sampled values.
+ *
+ * The function never waits on the IfxStdIf_DPipe object
+ * \param telemetry Pointer to the telemetry object
+ */
+IFX_EXTERN void Ifx_Telemetry_execute(void *telemetry);
+
+/** \brief Sample the channels which are due
+ *
+ * Must be called periodically, typically from a timer interrupt. A single context is allowed to call this function.
+ * \param telemetry Pointer to the telemetry object
+ */
+IFX_EXTERN void Ifx_Telemetry_sample(Ifx_Telemetry *telemetry);
+
+/** \brief Set the sampling divider of a channel at the protocol start
+ *
+ * The channel is then sampled without subscribe frame from the host. The host can still change the divider.
+ * \param telemetry Pointer to the telemetry object
+ * \param id channel ID, returned by \ref Ifx_Telemetry_addChannel()
+ * \param divider sampling divider, 0 to wait for a subscribe frame
+ * \return Returns FALSE if the channel ID is invalid
+ */
+IFX_EXTERN boolean Ifx_Telemetry_setStartDivider(Ifx_Telemetry *telemetry, sint32 id, uint16 divider);
+
+/** \brief Stop all channels and the protocol
+ * \param telemetry Pointer to the telemetry object
+ */
+IFX_EXTERN void Ifx_Telemetry_stop(Ifx_Telemetry *telemetry);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -0,0 +1,481 @@
+/**
+ * \file Ifx_UdpIp.c
+ * \brief Minimal ARP / IPv4 / UDP stack on top of the ETH driver
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include <string.h>
+
+#include "Ifx_UdpIp.h"
+#include "_Utilities/Ifx_Assert.h"
+
+#define IFX_UDPIP_ETHERTYPE_IPV4 (0x0800U)
+#define IFX_UDPIP_ETHERTYPE_ARP  (0x0806U)
+#define IFX_UDPIP_PROTOCOL_ICMP  (1U)
+#define IFX_UDPIP_PROTOCOL_UDP   (17U)
+#define IFX_UDPIP_ARP_SIZE       (42U)   /**< ethernet header and ARP packet */
+#define IFX_UDPIP_TTL            (64U)
+
+/* Byte offsets in the frame */
+#define IFX_UDPIP_ETH_DESTINATION (0U)
+#define IFX_UDPIP_ETH_SOURCE      (6U)
+#define IFX_UDPIP_ETH_TYPE        (12U)
+#define IFX_UDPIP_IP              (14U)
+#define IFX_UDPIP_ARP_OPERATION   (20U)
+#define IFX_UDPIP_ARP_SENDER_MAC  (22U)
+#define IFX_UDPIP_ARP_SENDER_IP   (28U)
+#define IFX_UDPIP_ARP_TARGET_MAC  (32U)
+#define IFX_UDPIP_ARP_TARGET_IP   (38U)
+
+static const uint8 Ifx_UdpIp_broadcastMac[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+/** Big endian 16 bit read
+ */
+IFX_INLINE uint16 Ifx_UdpIp_read16(const uint8 *data)
+{
+    return (uint16)(((uint16)data[0] << 8) | data[1]);
+}
+
+
+/** Big endian 32 bit read
+ */
+IFX_INLINE uint32 Ifx_UdpIp_read32(const uint8 *data)
+{
+    return ((uint32)data[0] << 24) | ((uint32)data[1] << 16) | ((uint32)data[2] << 8) | data[3];
+}
+
+
+/** Big endian 16 bit write
+ */
+IFX_INLINE void Ifx_UdpIp_write16(uint8 *data, uint16 value)
+{
+    data[0] = (uint8)(value >> 8);
+    data[1] = (uint8)value;
+}
+
+
+/** Big endian 32 bit write
+ */
+IFX_INLINE void Ifx_UdpIp_write32(uint8 *data, uint32 value)
+{
+    data[0] = (uint8)(value >> 24);
+    data[1] = (uint8)(value >> 16);
+    data[2] = (uint8)(value >> 8);
+    data[3] = (uint8)value;
+}
+
+
+/** Write the ethernet header
+ */
+static void Ifx_UdpIp_writeEthHeader(Ifx_UdpIp *stack, uint8 *frame, const uint8 *destination, uint16 type)
+{
+    memcpy(&frame[IFX_UDPIP_ETH_DESTINATION], destination, 6);
+    memcpy(&frame[IFX_UDPIP_ETH_SOURCE], stack->macAddress, 6);
+    Ifx_UdpIp_write16(&frame[IFX_UDPIP_ETH_TYPE], type);
+}
+
+
+/** Write the IPv4 header. The header checksum is inserted by the checksum engine
+ */
+static void Ifx_UdpIp_writeIpHeader(Ifx_UdpIp *stack, uint8 *ip, uint32 destination, uint8 protocol, uint16 totalLength)
+{
+    ip[0] = 0x45;                                      /* version 4, header length 5 words */
+    ip[1] = 0;                                         /* type of service */
+    Ifx_UdpIp_write16(&ip[2], totalLength);
+    Ifx_UdpIp_write16(&ip[4], stack->identification++);
+    Ifx_UdpIp_write16(&ip[6], 0x4000U);                /* don't fragment */
+    ip[8] = IFX_UDPIP_TTL;
+    ip[9] = protocol;
+    Ifx_UdpIp_write16(&ip[10], 0);
+    Ifx_UdpIp_write32(&ip[12], stack->ipAddress);
+    Ifx_UdpIp_write32(&ip[16], destination);
+}
+
+
+/** Send a frame from a buffer of the pool, the buffer is returned to the pool once sent
+ */
+static boolean Ifx_UdpIp_sendFrame(Ifx_UdpIp *stack, uint8 *frame, uint16 length, IfxEth_BufferPool *pool)
+{
+    IfxEth_TxSegment segment = {frame, length, pool};
+    boolean          result  = IfxEth_sendTransmitPacket(stack->eth, &segment, 1);
+
+    if (result != FALSE)
+    {
+        stack->txFrames++;
+    }
+    else
+    {
+        stack->txFailed++;
+    }
+
+    return result;
+}
+
+
+/** Add or update an ARP cache entry
+ */
+static void Ifx_UdpIp_updateArpCache(Ifx_UdpIp *stack, uint32 address, const uint8 *macAddress, boolean insert)
+{
+    Ifx_UdpIp_ArpEntry *entry = NULL_PTR;
+    uint32              i;
+
+    for (i = 0; (i < IFX_CFG_UDPIP_ARP_ENTRIES) && (entry == NULL_PTR); i++)
+    {
+        if (stack->arpCache[i].address == address)
+        {
+            entry = &stack->arpCache[i];
+        }
+    }
+
+    if ((entry == NULL_PTR) && (insert != FALSE))
+    {
+        entry          = &stack->arpCache[stack->arpNext];
+        stack->arpNext = (uint8)((stack->arpNext + 1) % IFX_CFG_UDPIP_ARP_ENTRIES);
+    }
+
+    if (entry != NULL_PTR)
+    {
+        entry->address = address;
+        memcpy(entry->macAddress, macAddress, 6);
+    }
+}
+
+
+/** Returns the MAC address of the next hop, NULL_PTR if not in the ARP cache
+ */
+static const uint8 *Ifx_UdpIp_findMac(Ifx_UdpIp *stack, uint32 address)
+{
+    const uint8 *macAddress = NULL_PTR;
+    uint32       i;
+
+    if ((address == 0xFFFFFFFFUL) || ((address | stack->netmask) == 0xFFFFFFFFUL))
+    {
+        macAddress = Ifx_UdpIp_broadcastMac;
+    }
+    else
+    {
+        if ((((address ^ stack->ipAddress) & stack->netmask) != 0) && (stack->gateway != 0))
+        {
+            address = stack->gateway;
+        }
+
+        for (i = 0; (i < IFX_CFG_UDPIP_ARP_ENTRIES) && (macAddress == NULL_PTR); i++)
+        {
+            if (stack->arpCache[i].address == address)
+            {
+                macAddress = stack->arpCache[i].macAddress;
+            }
+        }
+    }
+
+    return macAddress;
+}
+
+
+/** Process an ARP packet. Requests for the own address are answered in place
+ */
+static boolean Ifx_UdpIp_receiveArp(Ifx_UdpIp *stack, uint8 *frame, uint16 length)
+{
+    boolean result = FALSE;
+
+    if ((length >= IFX_UDPIP_ARP_SIZE)
+        && (Ifx_UdpIp_read32(&frame[IFX_UDPIP_IP]) == 0x00010800UL)     /* ethernet, IPv4 */
+        && (Ifx_UdpIp_read16(&frame[IFX_UDPIP_IP + 4]) == 0x0604U))     /* address sizes */
+    {
+        uint32  sender    = Ifx_UdpIp_read32(&frame[IFX_UDPIP_ARP_SENDER_IP]);
+        boolean forUs     = (Ifx_UdpIp_read32(&frame[IFX_UDPIP_ARP_TARGET_IP]) == stack->ipAddress) ? TRUE : FALSE;
+        uint16  operation = Ifx_UdpIp_read16(&frame[IFX_UDPIP_ARP_OPERATION]);
+
+        Ifx_UdpIp_updateArpCache(stack, sender, &frame[IFX_UDPIP_ARP_SENDER_MAC], forUs);
+
+        if ((operation == 1U) && (forUs != FALSE))
+        {
+            memcpy(&frame[IFX_UDPIP_ARP_TARGET_MAC], &frame[IFX_UDPIP_ARP_SENDER_MAC], 6);
+            Ifx_UdpIp_write32(&frame[IFX_UDPIP_ARP_TARGET_IP], sender);
+            memcpy(&frame[IFX_UDPIP_ARP_SENDER_MAC], stack->macAddress, 6);
+            Ifx_UdpIp_write32(&frame[IFX_UDPIP_ARP_SENDER_IP], stack->ipAddress);
+            Ifx_UdpIp_write16(&frame[IFX_UDPIP_ARP_OPERATION], 2U);
+            Ifx_UdpIp_writeEthHeader(stack, frame, &frame[IFX_UDPIP_ARP_TARGET_MAC], IFX_UDPIP_ETHERTYPE_ARP);
+
+            result = Ifx_UdpIp_sendFrame(stack, frame, IFX_UDPIP_ARP_SIZE, stack->eth->rxPool);
+        }
+    }
+
+    return result;
+}
+
+
+/** Process an IPv4 packet. Echo requests are answered in place
+ */
+static boolean Ifx_UdpIp_receiveIp(Ifx_UdpIp *stack, uint8 *frame, uint16 length)
+{
+    uint8  *ip          = &frame[IFX_UDPIP_IP];
+    uint16  headerSize  = (uint16)((ip[0] & 0xFU) * 4U);
+    uint16  totalLength = Ifx_UdpIp_read16(&ip[2]);
+    uint32  destination = Ifx_UdpIp_read32(&ip[16]);
+    boolean forUs       = (destination == stack->ipAddress) ? TRUE : FALSE;
+    boolean result      = FALSE;
+    boolean handled     = FALSE;
+
+    if ((length < (IFX_UDPIP_IP + 20U)) || ((ip[0] >> 4) != 4U) || (headerSize < 20U)
+        || (totalLength < headerSize) || ((IFX_UDPIP_IP + totalLength) > length)
+        || ((Ifx_UdpIp_read16(&ip[6]) & 0x3FFFU) != 0))                 /* fragments are not supported */
+    {
+        /* drop */
+    }
+    else if ((forUs == FALSE) && (destination != 0xFFFFFFFFUL) && ((destination | stack->netmask) != 0xFFFFFFFFUL))
+    {
+        /* not addressed to us */
+    }
+    else if (ip[9] == IFX_UDPIP_PROTOCOL_UDP)
+    {
+        uint8 *udp       = &ip[headerSize];
+        uint16 udpLength = Ifx_UdpIp_read16(&udp[4]);
+        uint16 port      = Ifx_UdpIp_read16(&udp[2]);
+        uint32 i;
+
+        if ((udpLength >= 8U) && (udpLength <= (totalLength - headerSize)))
+        {
+            for (i = 0; (i < stack->socketCount) && (handled == FALSE); i++)
+            {
+                Ifx_UdpIp_Socket *socket = stack->sockets[i];
+
+                if (socket->port == port)
+                {
+                    socket->handler(socket, Ifx_UdpIp_read32(&ip[12]), Ifx_UdpIp_read16(&udp[0]), &udp[8], (uint16)(udpLength - 8U));
+                    handled = TRUE;
+                }
+            }
+        }
+    }
+    else if ((ip[9] == IFX_UDPIP_PROTOCOL_ICMP) && (forUs != FALSE) && ((totalLength - headerSize) >= 8U) && (ip[headerSize] == 8U))
+    {
+        uint32 source = Ifx_UdpIp_read32(&ip[12]);
+
+        /* echo reply: same identifier, sequence and data, checksums inserted by the checksum engine */
+        ip[headerSize] = 0U;
+        Ifx_UdpIp_write16(&ip[headerSize + 2U], 0);
+        ip[8]          = IFX_UDPIP_TTL;
+        Ifx_UdpIp_write16(&ip[10], 0);
+        Ifx_UdpIp_write32(&ip[12], stack->ipAddress);
+        Ifx_UdpIp_write32(&ip[16], source);
+        Ifx_UdpIp_writeEthHeader(stack, frame, &frame[IFX_UDPIP_ETH_SOURCE], IFX_UDPIP_ETHERTYPE_IPV4);
+
+        handled = TRUE;
+        result  = Ifx_UdpIp_sendFrame(stack, frame, (uint16)(IFX_UDPIP_IP + totalLength), stack->eth->rxPool);
+    }
+
+    if (handled == FALSE)
+    {
+        stack->rxDropped++;
+    }
+
+    return result;
+}
+
+
+boolean Ifx_UdpIp_bind(Ifx_UdpIp *stack, Ifx_UdpIp_Socket *socket)
+{
+    boolean result = (stack->socketCount < IFX_CFG_UDPIP_MAX_SOCKETS) && (socket->handler != NULL_PTR);
+    uint32  i;
+
+    for (i = 0; i < stack->socketCount; i++)
+    {
+        result = result && (stack->sockets[i]->port != socket->port);
+    }
+
+    if (result != FALSE)
+    {
+        stack->sockets[stack->socketCount] = socket;
+        stack->socketCount++;
+    }
+
+    return result;
+}
+
+
+boolean Ifx_UdpIp_init(Ifx_UdpIp *stack, const Ifx_UdpIp_Config *config)
+{
+    boolean result = (config->eth != NULL_PTR) && (config->eth->rxPool != NULL_PTR);
+
+    memset(stack, 0, sizeof(Ifx_UdpIp));
+
+    if (result != FALSE)
+    {
+        stack->eth       = config->eth;
+        stack->ipAddress = config->ipAddress;
+        stack->netmask   = config->netmask;
+        stack->gateway   = config->gateway;
+        IfxEth_readMacAddress(stack->eth, stack->macAddress);
+
+        IfxEth_initBufferPool(&stack->headerPool, stack->headers, sizeof(stack->headers[0]), IFXETH_MAX_TX_BUFFERS);
+        IfxEth_setupChecksumEngine(stack->eth, IfxEth_ChecksumMode_tcpUdpIcmpFull);
+    }
+    else
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+    }
+
+    return result;
+}
+
+
+void Ifx_UdpIp_initConfig(Ifx_UdpIp_Config *config)
+{
+    config->eth       = NULL_PTR;
+    config->ipAddress = IFX_UDPIP_ADDRESS(192, 168, 0, 20);
+    config->netmask   = IFX_UDPIP_ADDRESS(255, 255, 255, 0);
+    config->gateway   = 0;
+}
+
+
+uint32 Ifx_UdpIp_process(Ifx_UdpIp *stack)
+{
+    uint32 count = 0;
+    uint16 length;
+    uint8 *frame;
+
+    IfxEth_reclaimTransmitBuffers(stack->eth);
+
+    while ((frame = IfxEth_getReceivePacket(stack->eth, &length)) != NULL_PTR)
+    {
+        uint16  type   = Ifx_UdpIp_read16(&frame[IFX_UDPIP_ETH_TYPE]);
+        boolean reused = FALSE;
+
+        stack->rxFrames++;
+        count++;
+
+        if (type == IFX_UDPIP_ETHERTYPE_ARP)
+        {
+            reused = Ifx_UdpIp_receiveArp(stack, frame, length);
+        }
+        else if (type == IFX_UDPIP_ETHERTYPE_IPV4)
+        {
+            reused = Ifx_UdpIp_receiveIp(stack, frame, length);
+        }
+        else
+        {
+            stack->rxDropped++;
+        }
+
+        if (reused == FALSE)
+        {
+            IfxEth_freeBuffer(stack->eth->rxPool, frame);
+        }
+    }
+
+    return count;
+}
+
+
+boolean Ifx_UdpIp_resolve(Ifx_UdpIp *stack, uint32 address)
+{
+    boolean result = (Ifx_UdpIp_findMac(stack, address) != NULL_PTR) ? TRUE : FALSE;
+
+    if (result == FALSE)
+    {
+        uint8 *frame = IfxEth_allocBuffer(&stack->headerPool);
+
+        if ((((address ^ stack->ipAddress) & stack->netmask) != 0) && (stack->gateway != 0))
+        {
+            address = stack->gateway;
+        }
+
+        if (frame != NULL_PTR)
+        {
+            Ifx_UdpIp_writeEthHeader(stack, frame, Ifx_UdpIp_broadcastMac, IFX_UDPIP_ETHERTYPE_ARP);
+            Ifx_UdpIp_write32(&frame[IFX_UDPIP_IP], 0x00010800UL);           /* ethernet, IPv4 */
+            Ifx_UdpIp_write16(&frame[IFX_UDPIP_IP + 4], 0x0604U);            /* address sizes */
+            Ifx_UdpIp_write16(&frame[IFX_UDPIP_ARP_OPERATION], 1U);          /* request */
+            memcpy(&frame[IFX_UDPIP_ARP_SENDER_MAC], stack->macAddress, 6);
+            Ifx_UdpIp_write32(&frame[IFX_UDPIP_ARP_SENDER_IP], stack->ipAddress);
+            memset(&frame[IFX_UDPIP_ARP_TARGET_MAC], 0, 6);
+            Ifx_UdpIp_write32(&frame[IFX_UDPIP_ARP_TARGET_IP], address);
+
+            if (Ifx_UdpIp_sendFrame(stack, frame, IFX_UDPIP_ARP_SIZE, &stack->headerPool) == FALSE)
+            {
+                IfxEth_freeBuffer(&stack->headerPool, frame);
+            }
+        }
+        else
+        {
+            stack->txFailed++;
+        }
+    }
+
+    return result;
+}
+
+
+boolean Ifx_UdpIp_send(Ifx_UdpIp *stack, uint32 address, uint16 port, uint16 sourcePort, void *data, uint16 length, IfxEth_BufferPool *pool)
+{
+    const uint8 *macAddress = Ifx_UdpIp_findMac(stack, address);
+    uint8       *header     = NULL_PTR;
+    boolean      result     = FALSE;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, length <= IFX_UDPIP_MAX_PAYLOAD);
+
+    if (length > IFX_UDPIP_MAX_PAYLOAD)
+    {
+        stack->txFailed++;
+    }
+    else if (macAddress == NULL_PTR)
+    {
+        stack->arpMisses++;
+        Ifx_UdpIp_resolve(stack, address);
+    }
+    else if ((header = IfxEth_allocBuffer(&stack->headerPool)) == NULL_PTR)
+    {
+        stack->txFailed++;
+    }
+    else
+    {
+        IfxEth_TxSegment segments[2];
+        uint8           *udp = &header[IFX_UDPIP_IP + 20U];
+
+        Ifx_UdpIp_writeEthHeader(stack, header, macAddress, IFX_UDPIP_ETHERTYPE_IPV4);
+        Ifx_UdpIp_writeIpHeader(stack, &header[IFX_UDPIP_IP], address, IFX_UDPIP_PROTOCOL_UDP, (uint16)(28U + length));
+        Ifx_UdpIp_write16(&udp[0], sourcePort);
+        Ifx_UdpIp_write16(&udp[2], port);
+        Ifx_UdpIp_write16(&udp[4], (uint16)(8U + length));
+        Ifx_UdpIp_write16(&udp[6], 0);                  /* inserted by the checksum engine */
+
+        segments[0].data   = header;
+        segments[0].length = IFX_UDPIP_HEADER_SIZE;
+        segments[0].pool   = &stack->headerPool;
+        segments[1].data   = data;
+        segments[1].length = length;
+        segments[1].pool   = pool;
+
+        result             = IfxEth_sendTransmitPacket(stack->eth, segments, (length != 0) ? 2 : 1);
+
+        if (result != FALSE)
+        {
+            stack->txFrames++;
+        }
+        else
+        {
+            IfxEth_freeBuffer(&stack->headerPool, header);
+            stack->txFailed++;
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,277 @@
+/**
+ * \file Ifx_Xcp.h
+ * \brief XCP slave: measurement with task synchronous DAQ lists, memory upload and download
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_comm_xcp XCP slave
+ * \ingroup library_srvsw_sysse_comm
+ *
+ * The XCP slave gives a standard measurement and calibration tool (XCP 1.x) access to the memory of the target:
+ * - memory access: SET_MTA, UPLOAD, SHORT_UPLOAD, DOWNLOAD, SHORT_DOWNLOAD
+ * - dynamic DAQ lists: FREE_DAQ, ALLOC_DAQ, ALLOC_ODT, ALLOC_ODT_ENTRY, SET_DAQ_PTR, WRITE_DAQ,
+ * SET_DAQ_LIST_MODE, GET_DAQ_LIST_MODE, START_STOP_DAQ_LIST, START_STOP_SYNCH, GET_DAQ_CLOCK,
+ * GET_DAQ_PROCESSOR_INFO, GET_DAQ_RESOLUTION_INFO, GET_DAQ_EVENT_INFO
+ * - session: CONNECT, DISCONNECT, GET_STATUS, SYNCH
+ *
+ * The protocol layer is independent of the transport. A transport layer (\ref library_srvsw_sysse_comm_xcpcan,
+ * \ref library_srvsw_sysse_comm_xcpudp) passes the received commands to \ref Ifx_Xcp_receive() and sends the
+ * responses and the DTOs from \ref Ifx_Xcp_process(). Multi byte values are little endian (Intel), the address
+ * granularity is one byte, the address extension is ignored.
+ *
+ * The event channels are the cyclic tasks of the application: each task calls \ref Ifx_Xcp_event() with its
+ * channel number. When the DAQ lists are started, their ODT entries are compiled into a flat copy list per
+ * event channel, adjacent entries of an ODT being merged. An event then only walks its copy list and copies
+ * the values into complete DTOs (PID, time stamp of the first ODT, values) in a queue of the channel: the
+ * cost of an event depends only on the number of bytes measured, not on the DAQ configuration, and the event
+ * never waits for the transport. If the queue cannot take all the DTOs of a DAQ list, the sample of the list
+ * is dropped and counted in overloadCount. The queues are sent by \ref Ifx_Xcp_process(), the command
+ * response first.
+ *
+ * Each event channel is called from one task only. The tasks calling \ref Ifx_Xcp_event() run on the CPU of
+ * the transport, with a higher priority than \ref Ifx_Xcp_process(), which compiles the copy lists.
+ *
+ * The PID is the absolute ODT number (identification field type 0), the time stamp is the lower 32 bits of
+ * the STM, in ns units.
+ *
+ * Usage example:
+ * \code
+ * static const Ifx_Xcp_EventConfig xcpEvents[3] = {
+ *     {"1ms",   1,   Ifx_Xcp_TimeUnit_1ms, 2},
+ *     {"10ms",  10,  Ifx_Xcp_TimeUnit_1ms, 1},
+ *     {"100ms", 100, Ifx_Xcp_TimeUnit_1ms, 0}
+ * };
+ * static Ifx_Xcp xcp;
+ *
+ * // initialisation, then a transport layer, e.g. Ifx_XcpCan_init()
+ * Ifx_Xcp_Config config;
+ * Ifx_Xcp_initConfig(&config);
+ * config.events     = xcpEvents;
+ * config.eventCount = 3;
+ * Ifx_Xcp_init(&xcp, &config);
+ *
+ * // 1 ms task, after the computation of the measured values
+ * Ifx_Xcp_event(&xcp, 0);
+ *
+ * // 10 ms task
+ * Ifx_Xcp_event(&xcp, 1);
+ * \endcode
+ *
+ */
+#ifndef IFX_XCP_H
+#define IFX_XCP_H 1
+
+#include "Cpu/Std/Ifx_Types.h"
+#include "Stm/Std/IfxStm.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_XCP_MAX_CTO)
+#define IFX_CFG_XCP_MAX_CTO          (8)    /**<\brief Maximal size of a command or a response in bytes */
+#endif
+
+#if !defined(IFX_CFG_XCP_MAX_DTO)
+#define IFX_CFG_XCP_MAX_DTO          (8)    /**<\brief Maximal size of a DTO in bytes, 8 for CAN, up to 1468 for UDP */
+#endif
+
+#if !defined(IFX_CFG_XCP_MAX_EVENTS)
+#define IFX_CFG_XCP_MAX_EVENTS       (4)    /**<\brief Maximal number of event channels */
+#endif
+
+#if !defined(IFX_CFG_XCP_MAX_DAQ)
+#define IFX_CFG_XCP_MAX_DAQ          (16)   /**<\brief Maximal number of DAQ lists */
+#endif
+
+#if !defined(IFX_CFG_XCP_MAX_ODT)
+#define IFX_CFG_XCP_MAX_ODT          (64)   /**<\brief Maximal number of ODTs of all DAQ lists, up to 252 */
+#endif
+
+#if !defined(IFX_CFG_XCP_MAX_ODT_ENTRIES)
+#define IFX_CFG_XCP_MAX_ODT_ENTRIES  (512)  /**<\brief Maximal number of ODT entries of all DAQ lists */
+#endif
+
+#if !defined(IFX_CFG_XCP_QUEUE_DEPTH)
+#define IFX_CFG_XCP_QUEUE_DEPTH      (16)   /**<\brief Number of DTOs queued per event channel, power of 2 */
+#endif
+
+#define IFX_XCP_TIMESTAMP_SIZE       (4)    /**<\brief Size of the DTO time stamp in bytes */
+
+/** \addtogroup library_srvsw_sysse_comm_xcp
+ * \{ */
+
+/** \brief Time unit of an event channel cycle, as coded by GET_DAQ_EVENT_INFO */
+typedef enum
+{
+    Ifx_Xcp_TimeUnit_1us   = 3,  /**<\brief 1 us */
+    Ifx_Xcp_TimeUnit_10us  = 4,  /**<\brief 10 us */
+    Ifx_Xcp_TimeUnit_100us = 5,  /**<\brief 100 us */
+    Ifx_Xcp_TimeUnit_1ms   = 6,  /**<\brief 1 ms */
+    Ifx_Xcp_TimeUnit_10ms  = 7,  /**<\brief 10 ms */
+    Ifx_Xcp_TimeUnit_100ms = 8,  /**<\brief 100 ms */
+    Ifx_Xcp_TimeUnit_1s    = 9   /**<\brief 1 s */
+} Ifx_Xcp_TimeUnit;
+
+/** \brief Transport layer, set by the transport layer initialisation */
+typedef struct
+{
+    void   *object;                                                   /**<\brief Transport layer object */
+    boolean (*send)(void *object, const uint8 *data, uint16 length);  /**<\brief Queue one packet for transmission, returns FALSE if the transport is busy */
+    void    (*flush)(void *object);                                   /**<\brief Transmit the queued packets, NULL_PTR if send() transmits */
+    uint16  maxCto;                                                   /**<\brief Maximal size of a command or a response in bytes, up to IFX_CFG_XCP_MAX_CTO */
+    uint16  maxDto;                                                   /**<\brief Maximal size of a DTO in bytes, up to IFX_CFG_XCP_MAX_DTO */
+} Ifx_Xcp_Transport;
+
+/** \brief Event channel configuration */
+typedef struct
+{
+    pchar            name;      /**<\brief Name reported to the tool, constant string */
+    uint8            cycle;     /**<\brief Cycle time in unit, 0 if not cyclic */
+    Ifx_Xcp_TimeUnit unit;      /**<\brief Unit of the cycle time */
+    uint8            priority;  /**<\brief Priority of the task, 0 lowest */
+} Ifx_Xcp_EventConfig;
+
+/** \brief ODT entry, as written by WRITE_DAQ */
+typedef struct
+{
+    const volatile uint8 *address;  /**<\brief Address of the value */
+    uint16                size;     /**<\brief Size of the value in bytes, merged entries in the copy list may be bigger than 255 */
+} Ifx_Xcp_Entry;
+
+/** \brief ODT */
+typedef struct
+{
+    uint16 firstEntry;  /**<\brief Index of the first entry in Ifx_Xcp::entries */
+    uint8  entryCount;  /**<\brief Number of entries */
+} Ifx_Xcp_Odt;
+
+/** \brief DTO layout in the copy list of an event channel */
+typedef struct
+{
+    uint16  firstEntry;  /**<\brief Index of the first copy entry in Ifx_Xcp::copyList */
+    uint16  entryCount;  /**<\brief Number of copy entries */
+    uint16  length;      /**<\brief DTO length in bytes: PID, time stamp, values */
+    uint8   pid;         /**<\brief PID, absolute ODT number */
+    boolean timestamp;   /**<\brief TRUE if the time stamp follows the PID */
+} Ifx_Xcp_Dto;
+
+/** \brief DAQ list */
+typedef struct
+{
+    uint16  firstOdt;   /**<\brief Index of the first ODT in Ifx_Xcp::odts, also its PID */
+    uint8   odtCount;   /**<\brief Number of ODTs */
+    uint8   mode;       /**<\brief Mode of SET_DAQ_LIST_MODE, with the running and selected bits of GET_DAQ_LIST_MODE */
+    uint16  event;      /**<\brief Event channel */
+    uint8   prescaler;  /**<\brief Sampled every prescaler events */
+    uint8   priority;   /**<\brief Priority, reported to the tool only */
+    uint8   counter;    /**<\brief Events left until the next sample */
+    uint16  firstDto;   /**<\brief Index of the first DTO layout in Ifx_Xcp::dtos, valid while running */
+} Ifx_Xcp_Daq;
+
+/** \brief Event channel */
+typedef struct
+{
+    Ifx_Xcp_EventConfig config;                                              /**<\brief Configuration */
+    uint16              firstDaq;                                            /**<\brief Index of the first running DAQ list in Ifx_Xcp::eventDaqs */
+    volatile uint16     daqCount;                                            /**<\brief Number of running DAQ lists, 0 while the copy list is compiled */
+    volatile uint32     writeTotal;                                          /**<\brief DTOs written to the queue, modified by Ifx_Xcp_event() only */
+    volatile uint32     readTotal;                                           /**<\brief DTOs sent from the queue, modified by Ifx_Xcp_process() only */
+    uint32              overloadCount;                                       /**<\brief Number of DAQ list samples dropped because the queue was full */
+    uint16              lengths[IFX_CFG_XCP_QUEUE_DEPTH];                    /**<\brief Length of the queued DTOs */
+    uint8               queue[IFX_CFG_XCP_QUEUE_DEPTH][IFX_CFG_XCP_MAX_DTO]; /**<\brief Queued DTOs */
+} Ifx_Xcp_Event;
+
+/** \brief XCP slave configuration */
+typedef struct
+{
+    const Ifx_Xcp_EventConfig *events;      /**<\brief Event channels, in the order of the channel numbers */
+    uint8                      eventCount;  /**<\brief Number of event channels, up to IFX_CFG_XCP_MAX_EVENTS */
+    Ifx_STM                   *stm;         /**<\brief STM used for the time stamps */
+} Ifx_Xcp_Config;
+
+/** \brief XCP slave object */
+typedef struct
+{
+    Ifx_Xcp_Transport transport;                                  /**<\brief Transport layer */
+    Ifx_STM          *stm;                                        /**<\brief STM used for the time stamps */
+    uint16            timestampTicks;                             /**<\brief Duration of an STM tick in ns */
+    boolean           connected;                                  /**<\brief TRUE while a tool is connected */
+    boolean           daqRunning;                                 /**<\brief TRUE while at least one DAQ list runs */
+    uint32            mta;                                        /**<\brief Memory transfer address */
+    uint16            daqPointer;                                 /**<\brief DAQ list of the DAQ pointer */
+    uint16            entryPointer;                               /**<\brief Index in entries of the DAQ pointer, 0xFFFF if not set */
+    uint16            entryPointerEnd;                            /**<\brief End of the ODT of the DAQ pointer in entries */
+    uint16            daqCount;                                   /**<\brief Number of allocated DAQ lists */
+    uint16            odtCount;                                   /**<\brief Number of allocated ODTs */
+    uint16            entryCount;                                 /**<\brief Number of allocated ODT entries */
+    Ifx_Xcp_Daq       daqs[IFX_CFG_XCP_MAX_DAQ];                  /**<\brief DAQ lists */
+    Ifx_Xcp_Odt       odts[IFX_CFG_XCP_MAX_ODT];                  /**<\brief ODTs */
+    Ifx_Xcp_Entry     entries[IFX_CFG_XCP_MAX_ODT_ENTRIES];       /**<\brief ODT entries */
+    Ifx_Xcp_Entry     copyList[IFX_CFG_XCP_MAX_ODT_ENTRIES];      /**<\brief Compiled copy lists of the event channels */
+    Ifx_Xcp_Dto       dtos[IFX_CFG_XCP_MAX_ODT];                  /**<\brief Compiled DTO layouts of the event channels */
+    uint16            eventDaqs[IFX_CFG_XCP_MAX_DAQ];             /**<\brief Running DAQ lists, sorted by event channel */
+    uint8             eventCount;                                 /**<\brief Number of event channels */
+    uint8             nextEvent;                                  /**<\brief Next event channel queue to be sent */
+    Ifx_Xcp_Event     events[IFX_CFG_XCP_MAX_EVENTS];             /**<\brief Event channels */
+    uint16            ctoLength;                                  /**<\brief Length of the pending response, 0 if none */
+    uint8             cto[IFX_CFG_XCP_MAX_CTO];                   /**<\brief Pending response */
+} Ifx_Xcp;
+
+/** \brief Sample the running DAQ lists of an event channel
+ *
+ * To be called by the task of the event channel, after the computation of the measured values. Never waits.
+ * \param xcp Pointer to the XCP slave object
+ * \param channel Event channel number
+ */
+IFX_EXTERN void Ifx_Xcp_event(Ifx_Xcp *xcp, uint8 channel);
+
+/** \brief Initialize the XCP slave object, without transport
+ * \param xcp Pointer to the XCP slave object
+ * \param config Pointer to the configuration
+ * \return Returns FALSE if there are too many event channels
+ */
+IFX_EXTERN boolean Ifx_Xcp_init(Ifx_Xcp *xcp, const Ifx_Xcp_Config *config);
+
+/** \brief Initialize the configuration: no event channel, STM0
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_Xcp_initConfig(Ifx_Xcp_Config *config);
+
+/** \brief Send the pending response and the queued DTOs, until the transport is busy
+ *
+ * Called by the transport layer.
+ * \param xcp Pointer to the XCP slave object
+ */
+IFX_EXTERN void Ifx_Xcp_process(Ifx_Xcp *xcp);
+
+/** \brief Execute a received command, the response is sent by the next \ref Ifx_Xcp_process()
+ *
+ * Called by the transport layer.
+ * \param xcp Pointer to the XCP slave object
+ * \param data Pointer to the command packet
+ * \param length Length of the command packet in bytes
+ */
+IFX_EXTERN void Ifx_Xcp_receive(Ifx_Xcp *xcp, const uint8 *data, uint16 length);
+
+/** \brief Set the transport layer. Called by the transport layer initialisation
+ * \param xcp Pointer to the XCP slave object
+ * \param transport Pointer to the transport layer, copied
+ */
+IFX_EXTERN void Ifx_Xcp_setTransport(Ifx_Xcp *xcp, const Ifx_Xcp_Transport *transport);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
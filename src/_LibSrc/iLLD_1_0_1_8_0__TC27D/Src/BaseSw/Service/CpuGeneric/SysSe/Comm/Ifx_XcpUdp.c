@@ -0,0 +1,163 @@
+/**
+ * \file Ifx_XcpUdp.c
+ * \brief XCP on UDP transport layer
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include <string.h>
+
+#include "Ifx_XcpUdp.h"
+
+/** Implementation of Ifx_Xcp_Transport::flush
+ */
+static void Ifx_XcpUdp_flush(void *object)
+{
+    Ifx_XcpUdp *xcpUdp = (Ifx_XcpUdp *)object;
+
+    /* a datagram which could not be sent is retried by the next call */
+    if ((xcpUdp->buffer != NULL_PTR)
+        && (Ifx_UdpIp_send(xcpUdp->stack, xcpUdp->hostAddress, xcpUdp->hostPort, xcpUdp->socket.port, xcpUdp->buffer, xcpUdp->length, xcpUdp->pool) != FALSE))
+    {
+        xcpUdp->buffer = NULL_PTR;
+        xcpUdp->length = 0;
+        xcpUdp->txCount++;
+    }
+}
+
+
+/** Socket handler: executes the commands of the datagram
+ */
+static void Ifx_XcpUdp_receive(Ifx_UdpIp_Socket *socket, uint32 address, uint16 port, const uint8 *data, uint16 length)
+{
+    Ifx_XcpUdp *xcpUdp = (Ifx_XcpUdp *)socket->data;
+
+    xcpUdp->hostAddress = address;
+    xcpUdp->hostPort    = port;
+
+    while (length >= IFX_XCPUDP_HEADER_SIZE)
+    {
+        uint16 packetLength = (uint16)(data[0] | ((uint16)data[1] << 8));
+
+        if ((IFX_XCPUDP_HEADER_SIZE + packetLength) > length)
+        {
+            break;
+        }
+
+        xcpUdp->rxCount++;
+        Ifx_Xcp_receive(xcpUdp->xcp, &data[IFX_XCPUDP_HEADER_SIZE], packetLength);
+
+        /* the response is gathered before the next command is executed */
+        Ifx_Xcp_process(xcpUdp->xcp);
+
+        data    = &data[IFX_XCPUDP_HEADER_SIZE + packetLength];
+        length -= IFX_XCPUDP_HEADER_SIZE + packetLength;
+    }
+}
+
+
+/** Implementation of Ifx_Xcp_Transport::send: appends the packet to the datagram
+ */
+static boolean Ifx_XcpUdp_send(void *object, const uint8 *data, uint16 length)
+{
+    Ifx_XcpUdp *xcpUdp = (Ifx_XcpUdp *)object;
+    uint8      *packet;
+
+    if (xcpUdp->hostAddress == 0)
+    {
+        /* no tool */
+        return TRUE;
+    }
+
+    if ((xcpUdp->buffer != NULL_PTR) && ((xcpUdp->length + IFX_XCPUDP_HEADER_SIZE + length) > IFX_UDPIP_MAX_PAYLOAD))
+    {
+        Ifx_XcpUdp_flush(xcpUdp);
+    }
+
+    if (xcpUdp->buffer == NULL_PTR)
+    {
+        xcpUdp->buffer = (uint8 *)IfxEth_allocBuffer(xcpUdp->pool);
+        xcpUdp->length = 0;
+    }
+
+    if ((xcpUdp->buffer == NULL_PTR) || ((xcpUdp->length + IFX_XCPUDP_HEADER_SIZE + length) > IFX_UDPIP_MAX_PAYLOAD))
+    {
+        return FALSE;
+    }
+
+    packet    = &xcpUdp->buffer[xcpUdp->length];
+    packet[0] = (uint8)length;
+    packet[1] = (uint8)(length >> 8);
+    packet[2] = (uint8)xcpUdp->counter;
+    packet[3] = (uint8)(xcpUdp->counter >> 8);
+    memcpy(&packet[IFX_XCPUDP_HEADER_SIZE], data, length);
+    xcpUdp->length += IFX_XCPUDP_HEADER_SIZE + length;
+    xcpUdp->counter++;
+
+    return TRUE;
+}
+
+
+boolean Ifx_XcpUdp_init(Ifx_XcpUdp *xcpUdp, const Ifx_XcpUdp_Config *config)
+{
+    Ifx_Xcp_Transport transport;
+
+    xcpUdp->xcp            = config->xcp;
+    xcpUdp->stack          = config->stack;
+    xcpUdp->pool           = config->pool;
+    xcpUdp->socket.port    = config->port;
+    xcpUdp->socket.handler = &Ifx_XcpUdp_receive;
+    xcpUdp->socket.data    = xcpUdp;
+    xcpUdp->hostAddress    = 0;
+    xcpUdp->hostPort       = 0;
+    xcpUdp->counter        = 0;
+    xcpUdp->buffer         = NULL_PTR;
+    xcpUdp->length         = 0;
+    xcpUdp->rxCount        = 0;
+    xcpUdp->txCount        = 0;
+
+    if (Ifx_UdpIp_bind(config->stack, &xcpUdp->socket) == FALSE)
+    {
+        return FALSE;
+    }
+
+    transport.object = xcpUdp;
+    transport.send   = &Ifx_XcpUdp_send;
+    transport.flush  = &Ifx_XcpUdp_flush;
+    transport.maxCto = IFX_UDPIP_MAX_PAYLOAD - IFX_XCPUDP_HEADER_SIZE;
+    transport.maxDto = IFX_UDPIP_MAX_PAYLOAD - IFX_XCPUDP_HEADER_SIZE;
+    Ifx_Xcp_setTransport(config->xcp, &transport);
+
+    return TRUE;
+}
+
+
+void Ifx_XcpUdp_initConfig(Ifx_XcpUdp_Config *config)
+{
+    config->xcp   = NULL_PTR;
+    config->stack = NULL_PTR;
+    config->pool  = NULL_PTR;
+    config->port  = IFX_XCPUDP_DEFAULT_PORT;
+}
+
+
+void Ifx_XcpUdp_process(Ifx_XcpUdp *xcpUdp)
+{
+    Ifx_Xcp_process(xcpUdp->xcp);
+}
@@ -0,0 +1,110 @@
+/**
+ * \file Ifx_XcpUdp.h
+ * \brief XCP on UDP transport layer
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_comm_xcpudp XCP on UDP
+ * \ingroup library_srvsw_sysse_comm
+ *
+ * Transport layer of the \ref library_srvsw_sysse_comm_xcp over \ref library_srvsw_sysse_comm_udpip. Each XCP
+ * packet is preceded by the XCP on Ethernet header: length (2 bytes) and counter (2 bytes), little endian.
+ * The responses and DTOs are sent to the address and port of the last received command. Several packets are
+ * gathered into one datagram, which is sent at the end of \ref Ifx_XcpUdp_process() or when it is full, from a
+ * buffer of the transmit pool without further copy.
+ *
+ * The commands are executed from \ref Ifx_UdpIp_process(), which shall be called from the same context as
+ * \ref Ifx_XcpUdp_process(). IFX_CFG_XCP_MAX_CTO and IFX_CFG_XCP_MAX_DTO are typically increased in Ifx_Cfg.h,
+ * e.g. to 255 and 1024.
+ *
+ * Usage example:
+ * \code
+ * static Ifx_XcpUdp xcpUdp;
+ *
+ * // initialisation, after Ifx_Xcp_init() and Ifx_UdpIp_init()
+ * Ifx_XcpUdp_Config config;
+ * Ifx_XcpUdp_initConfig(&config);
+ * config.xcp   = &xcp;
+ * config.stack = &udpIp;
+ * config.pool  = &txPool;
+ * Ifx_XcpUdp_init(&xcpUdp, &config);
+ *
+ * // background loop or 1 ms task with the lowest priority of the event channels
+ * Ifx_UdpIp_process(&udpIp);
+ * Ifx_XcpUdp_process(&xcpUdp);
+ * \endcode
+ *
+ */
+#ifndef IFX_XCPUDP_H
+#define IFX_XCPUDP_H 1
+
+#include "Ifx_Xcp.h"
+#include "Ifx_UdpIp.h"
+
+//----------------------------------------------------------------------------------------
+#define IFX_XCPUDP_DEFAULT_PORT (5555)    /**<\brief Default XCP UDP port */
+#define IFX_XCPUDP_HEADER_SIZE  (4)       /**<\brief Size of the XCP on Ethernet header: length, counter */
+
+/** \addtogroup library_srvsw_sysse_comm_xcpudp
+ * \{ */
+
+/** \brief Configuration */
+typedef struct
+{
+    Ifx_Xcp           *xcp;    /**<\brief XCP slave object, initialised */
+    Ifx_UdpIp         *stack;  /**<\brief UDP/IP stack, initialised */
+    IfxEth_BufferPool *pool;   /**<\brief Transmit buffer pool, buffers of at least IFX_UDPIP_MAX_PAYLOAD bytes */
+    uint16             port;   /**<\brief Local UDP port */
+} Ifx_XcpUdp_Config;
+
+/** \brief Transport layer object */
+typedef struct
+{
+    Ifx_Xcp           *xcp;          /**<\brief XCP slave object */
+    Ifx_UdpIp         *stack;        /**<\brief UDP/IP stack */
+    IfxEth_BufferPool *pool;         /**<\brief Transmit buffer pool */
+    Ifx_UdpIp_Socket   socket;       /**<\brief Socket of the commands */
+    uint32             hostAddress;  /**<\brief IPv4 address of the tool, 0 until the first command */
+    uint16             hostPort;     /**<\brief UDP port of the tool */
+    uint16             counter;      /**<\brief Counter of the next sent packet */
+    uint8             *buffer;       /**<\brief Datagram being gathered, NULL_PTR if none */
+    uint16             length;       /**<\brief Length of the datagram being gathered */
+    uint32             rxCount;      /**<\brief Number of received commands */
+    uint32             txCount;      /**<\brief Number of sent datagrams */
+} Ifx_XcpUdp;
+
+/** \brief Initialize the transport layer, bind its socket and set it to the XCP slave
+ * \param xcpUdp Pointer to the transport layer object
+ * \param config Pointer to the configuration
+ * \return Returns FALSE if the socket could not be bound
+ */
+IFX_EXTERN boolean Ifx_XcpUdp_init(Ifx_XcpUdp *xcpUdp, const Ifx_XcpUdp_Config *config);
+
+/** \brief Initialize the configuration with default values
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_XcpUdp_initConfig(Ifx_XcpUdp_Config *config);
+
+/** \brief Send the response and the queued DTOs. Never waits
+ * \param xcpUdp Pointer to the transport layer object
+ */
+IFX_EXTERN void Ifx_XcpUdp_process(Ifx_XcpUdp *xcpUdp);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -0,0 +1,80 @@
+/**
+ * \file Ifx_Coroutine.c
+ * \brief Stackless cooperative coroutines
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_Coroutine.h"
+#include "_Utilities/Ifx_Assert.h"
+
+void Ifx_Coroutine_initScheduler(Ifx_Coroutine_Scheduler *scheduler)
+{
+    scheduler->first = NULL_PTR;
+}
+
+
+uint32 Ifx_Coroutine_run(Ifx_Coroutine_Scheduler *scheduler)
+{
+    Ifx_Coroutine **link    = &scheduler->first;
+    uint32          running = 0;
+
+    while (*link != NULL_PTR)
+    {
+        Ifx_Coroutine *co = *link;
+
+        if (co->function(co) == Ifx_Coroutine_Status_finished)
+        {
+            co->line = IFX_COROUTINE_LINE_FINISHED;
+            *link    = co->next;
+            co->next = NULL_PTR;
+        }
+        else
+        {
+            link = &co->next;
+            running++;
+        }
+    }
+
+    return running;
+}
+
+
+void Ifx_Coroutine_start(Ifx_Coroutine_Scheduler *scheduler, Ifx_Coroutine *co, Ifx_Coroutine_Function function, void *data)
+{
+    Ifx_Coroutine **link = &scheduler->first;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, function != NULL_PTR);
+
+    co->function = function;
+    co->data     = data;
+    co->line     = 0;
+    co->deadLine = TIME_INFINITE;
+    co->timedOut = FALSE;
+    co->next     = NULL_PTR;
+
+    /* Appended, so that the coroutines are executed in the start order */
+    while (*link != NULL_PTR)
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, *link != co);
+        link = &(*link)->next;
+    }
+
+    *link = co;
+}
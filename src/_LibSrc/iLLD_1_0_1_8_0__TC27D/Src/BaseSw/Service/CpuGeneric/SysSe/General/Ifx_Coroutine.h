@@ -0,0 +1,266 @@
+/**
+ * \file Ifx_Coroutine.h
+ * \brief Stackless cooperative coroutines
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_general_coroutine Coroutines
+ * \ingroup library_srvsw_sysse_general
+ *
+ * A coroutine is a function which can wait for an event without blocking the caller: when the event
+ * has not occurred, the function returns and is called again later by \ref Ifx_Coroutine_run(), where it
+ * resumes at the wait statement. Many protocol handlers can then be written as sequential code and share
+ * one core, from the background or cyclic loop, without RTOS and without busy waiting.
+ *
+ * The coroutines are stackless (protothread style): the local variables of the function are lost at each
+ * wait, the state which must survive a wait is stored in the data of the coroutine. The wait statements
+ * are implemented with a switch statement, they shall then not be used inside a switch statement of the
+ * coroutine, and only one wait statement is allowed per source line.
+ *
+ * The following wait statements are available:
+ * - \ref IFX_COROUTINE_YIELD(): let the other coroutines run
+ * - \ref IFX_COROUTINE_AWAIT(): wait for a condition
+ * - \ref IFX_COROUTINE_SLEEP(): wait for a time
+ * - \ref IFX_COROUTINE_AWAIT_TIMEOUT(): wait for a condition, at most the timeout
+ * - \ref IFX_COROUTINE_AWAIT_FIFO(): wait until data can be read from an \ref Ifx_Fifo
+ * - \ref IFX_COROUTINE_AWAIT_DMA(): wait for the end of a DMA transaction (IfxDma_Dma.h required)
+ * - \ref IFX_COROUTINE_AWAIT_CAN(): wait for the reception of a CAN message (IfxMultican_Can.h required)
+ *
+ * Usage example:
+ * \code
+ * typedef struct
+ * {
+ *     Ifx_Fifo *rx;
+ *     uint8     frame[8];
+ * } Protocol;
+ *
+ * static Ifx_Coroutine_Status protocolHandler(Ifx_Coroutine *co)
+ * {
+ *     Protocol *protocol = (Protocol *)co->data;
+ *
+ *     IFX_COROUTINE_BEGIN(co);
+ *
+ *     while (TRUE)
+ *     {
+ *         IFX_COROUTINE_AWAIT_FIFO(co, protocol->rx, 8, TimeConst_100ms);
+ *
+ *         if (co->timedOut == FALSE)
+ *         {
+ *             Ifx_Fifo_read(protocol->rx, protocol->frame, 8, TIME_NULL);
+ *             processFrame(protocol->frame);
+ *         }
+ *         else
+ *         {
+ *             IFX_COROUTINE_SLEEP(co, TimeConst_10ms);
+ *             resynchronize();
+ *         }
+ *     }
+ *
+ *     IFX_COROUTINE_END(co);
+ * }
+ *
+ * static Ifx_Coroutine_Scheduler scheduler;
+ * static Ifx_Coroutine           handler;
+ * static Protocol                protocol;
+ *
+ * Ifx_Coroutine_initScheduler(&scheduler);
+ * Ifx_Coroutine_start(&scheduler, &handler, &protocolHandler, &protocol);
+ *
+ * while (TRUE)
+ * {
+ *     Ifx_Coroutine_run(&scheduler);    // background loop
+ * }
+ * \endcode
+ *
+ */
+#ifndef IFX_COROUTINE_H
+#define IFX_COROUTINE_H 1
+
+#include "SysSe/Bsp/Bsp.h"
+#include "_Lib/DataHandling/Ifx_Fifo.h"
+
+/** \addtogroup library_srvsw_sysse_general_coroutine
+ * \{ */
+
+//----------------------------------------------------------------------------------------
+/** \brief Start the body of a coroutine, shall be the first statement of the coroutine function */
+#define IFX_COROUTINE_BEGIN(co) \
+    switch ((co)->line)         \
+    {                           \
+    case 0:
+
+/** \brief End the body of a coroutine, shall be the last statement of the coroutine function */
+#define IFX_COROUTINE_END(co)                \
+    default:                                 \
+        break;                               \
+    }                                        \
+    (co)->line = IFX_COROUTINE_LINE_FINISHED; \
+    return Ifx_Coroutine_Status_finished
+
+/** \brief Finish the coroutine */
+#define IFX_COROUTINE_EXIT(co)                    \
+    do                                            \
+    {                                             \
+        (co)->line = IFX_COROUTINE_LINE_FINISHED; \
+        return Ifx_Coroutine_Status_finished;     \
+    } while (0)
+
+/** \brief Let the other coroutines run, the coroutine resumes at the next call */
+#define IFX_COROUTINE_YIELD(co)                 \
+    do                                          \
+    {                                           \
+        (co)->line = __LINE__;                  \
+        return Ifx_Coroutine_Status_waiting;    \
+    case __LINE__:                              \
+        ;                                       \
+    } while (0)
+
+/** \brief Wait until the condition is TRUE. The condition is evaluated at each call of the coroutine */
+#define IFX_COROUTINE_AWAIT(co, condition)           \
+    do                                               \
+    {                                                \
+        (co)->line = __LINE__;                       \
+    case __LINE__:                                   \
+        if (!(condition))                            \
+        {                                            \
+            return Ifx_Coroutine_Status_waiting;     \
+        }                                            \
+    } while (0)
+
+/** \brief Wait until the condition is TRUE or the timeout is over
+ *
+ * co->timedOut is then set to TRUE if the condition was not fulfilled. The condition is evaluated
+ * once per call of the coroutine, and not anymore after it is TRUE.
+ */
+#define IFX_COROUTINE_AWAIT_TIMEOUT(co, condition, timeout)               \
+    do                                                                    \
+    {                                                                     \
+        (co)->deadLine = getDeadLine(timeout);                            \
+        (co)->line     = __LINE__;                                        \
+    case __LINE__:                                                        \
+        if (condition)                                                    \
+        {                                                                 \
+            (co)->timedOut = FALSE;                                       \
+        }                                                                 \
+        else if (isDeadLine((co)->deadLine) != FALSE)                     \
+        {                                                                 \
+            (co)->timedOut = TRUE;                                        \
+        }                                                                 \
+        else                                                              \
+        {                                                                 \
+            return Ifx_Coroutine_Status_waiting;                          \
+        }                                                                 \
+    } while (0)
+
+/** \brief Wait for the time given in ticks */
+#define IFX_COROUTINE_SLEEP(co, time) \
+    IFX_COROUTINE_AWAIT_TIMEOUT(co, FALSE, time)
+
+/** \brief Wait until count elements can be read from the FIFO, or the timeout is over */
+#define IFX_COROUTINE_AWAIT_FIFO(co, fifo, count, timeout) \
+    IFX_COROUTINE_AWAIT_TIMEOUT(co, Ifx_Fifo_readCount(fifo) >= (count), timeout)
+
+/** \brief Wait for the end of the transaction of the DMA channel (IfxDma_Dma_Channel), or the timeout is over
+ *
+ * The channel interrupt flag is cleared when the end of the transaction is detected.
+ */
+#define IFX_COROUTINE_AWAIT_DMA(co, channel, timeout) \
+    IFX_COROUTINE_AWAIT_TIMEOUT(co, IfxDma_Dma_getAndClearChannelInterrupt(channel) != FALSE, timeout)
+
+/** \brief Wait for the reception of a message by the CAN message object (IfxMultican_Can_MsgObj), or the timeout is over
+ *
+ * The message shall then be read with IfxMultican_Can_MsgObj_readMessage().
+ */
+#define IFX_COROUTINE_AWAIT_CAN(co, msgObj, timeout) \
+    IFX_COROUTINE_AWAIT_TIMEOUT(co, IfxMultican_Can_MsgObj_isRxPending(msgObj) != FALSE, timeout)
+
+/** \brief Value of Ifx_Coroutine.line when the coroutine is finished */
+#define IFX_COROUTINE_LINE_FINISHED (0xFFFFFFFFu)
+
+//----------------------------------------------------------------------------------------
+
+/** \brief Status returned by a coroutine function */
+typedef enum
+{
+    Ifx_Coroutine_Status_waiting,  /**< \brief The coroutine waits, it shall be called again */
+    Ifx_Coroutine_Status_finished  /**< \brief The coroutine is finished */
+} Ifx_Coroutine_Status;
+
+typedef struct Ifx_Coroutine_s Ifx_Coroutine;
+
+/** \brief Coroutine function
+ * \param co Pointer to the coroutine object
+ * \return Returns the coroutine status
+ */
+typedef Ifx_Coroutine_Status (*Ifx_Coroutine_Function)(Ifx_Coroutine *co);
+
+/** \brief Coroutine object */
+struct Ifx_Coroutine_s
+{
+    Ifx_Coroutine_Function function;  /**< \brief coroutine function */
+    void                  *data;      /**< \brief coroutine data, given to \ref Ifx_Coroutine_start() */
+    uint32                 line;      /**< \brief resume point, 0 at start */
+    Ifx_TickTime           deadLine;  /**< \brief dead line of the current wait */
+    boolean                timedOut;  /**< \brief TRUE if the last wait with timeout was over */
+    Ifx_Coroutine         *next;      /**< \brief next coroutine of the scheduler */
+};
+
+/** \brief Coroutine scheduler object */
+typedef struct
+{
+    Ifx_Coroutine *first;  /**< \brief list of the running coroutines */
+} Ifx_Coroutine_Scheduler;
+
+//----------------------------------------------------------------------------------------
+
+/** \brief Initialize the scheduler
+ * \param scheduler Pointer to the scheduler object
+ */
+IFX_EXTERN void Ifx_Coroutine_initScheduler(Ifx_Coroutine_Scheduler *scheduler);
+
+/** \brief Indicates if the coroutine is finished
+ * \param co Pointer to the coroutine object
+ * \return Returns TRUE if the coroutine is finished
+ */
+IFX_INLINE boolean Ifx_Coroutine_isFinished(const Ifx_Coroutine *co)
+{
+    return co->line == IFX_COROUTINE_LINE_FINISHED;
+}
+
+
+/** \brief Execute each running coroutine once, until its next wait
+ *
+ * Called from the background or cyclic loop. The finished coroutines are removed from the scheduler.
+ * \param scheduler Pointer to the scheduler object
+ * \return Returns the number of running coroutines
+ */
+IFX_EXTERN uint32 Ifx_Coroutine_run(Ifx_Coroutine_Scheduler *scheduler);
+
+/** \brief Add a coroutine to the scheduler, the coroutine starts at the next \ref Ifx_Coroutine_run()
+ *
+ * The coroutine object shall not be running. A finished coroutine can be started again.
+ * \param scheduler Pointer to the scheduler object
+ * \param co Pointer to the coroutine object
+ * \param function Coroutine function
+ * \param data Coroutine data
+ */
+IFX_EXTERN void Ifx_Coroutine_start(Ifx_Coroutine_Scheduler *scheduler, Ifx_Coroutine *co, Ifx_Coroutine_Function function, void *data);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -0,0 +1,177 @@
+/**
+ * \file Ifx_DmaMonitor.h
+ * \brief DMA transaction statistics and bus load monitor
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_general_dmamonitor DMA monitor
+ * \ingroup library_srvsw_sysse_general
+ *
+ * The DMA has no transfer counter, the monitor samples the DMA registers periodically and
+ * derives the statistics from the changes between two samples:
+ * - move engine load: fraction of the samples in which the move engine reads or writes (DMA_MEx_SR.RS / WS).
+ *   The active channel (DMA_MEx_SR.CH) of each sample is accounted to the registered channel.
+ * - transfers: decrements of the channel transfer count (CHCSR.TCOUNT), a reload counts as the end of
+ *   the previous transaction. Moves and bytes follow from the block mode and the move size. The sample period
+ *   shall be shorter than a transaction, else transactions are lost; use the transaction hooks of
+ *   \ref library_srvsw_sysse_general_globalresources for short transactions
+ * - events: pattern match (IPM), source and destination wrap (WRPS, WRPD) and request lost (TSR.TRL) are
+ *   counted on their rising edge
+ * - errors: move engine error flags (DMA_ERRSRx) counted on their rising edge, with the last error channel,
+ *   and the SPB bus error counter of the SBCU (SBCU_ECON.ERRCNT)
+ *
+ * The monitor does not clear any flag, the drivers keep their flags and interrupts. The statistics are
+ * published with the shell command \ref Ifx_DmaMonitor_show() and as telemetry channels
+ * (\ref Ifx_DmaMonitor_addTelemetryChannels()).
+ *
+ * Usage example:
+ * \code
+ * static Ifx_DmaMonitor dmaMonitor;
+ *
+ * // initialisation
+ * Ifx_DmaMonitor_init(&dmaMonitor, &MODULE_DMA);
+ * Ifx_DmaMonitor_addChannel(&dmaMonitor, "qspi0Tx", IfxDma_ChannelId_1);
+ * Ifx_DmaMonitor_addChannel(&dmaMonitor, "adc", IfxDma_ChannelId_60);
+ * Ifx_DmaMonitor_addTelemetryChannels(&dmaMonitor, &telemetry);
+ *
+ * // periodic interrupt, e.g. 10kHz
+ * Ifx_DmaMonitor_sample(&dmaMonitor);
+ *
+ * // background loop, e.g. every second
+ * Ifx_DmaMonitor_update(&dmaMonitor);
+ *
+ * // shell command list entry
+ * {"dma", "   : Show the DMA statistics", &dmaMonitor, &Ifx_DmaMonitor_show},
+ * \endcode
+ *
+ */
+#ifndef IFX_DMAMONITOR_H
+#define IFX_DMAMONITOR_H 1
+
+#include "Dma/Std/IfxDma.h"
+#include "IfxSbcu_reg.h"
+#include "SysSe/Bsp/Bsp.h"
+#include "SysSe/Comm/Ifx_Telemetry.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_DMAMONITOR_MAX_CHANNELS)
+#define IFX_CFG_DMAMONITOR_MAX_CHANNELS (8)  /**<\brief Maximal number of monitored channels */
+#endif
+
+#define IFX_DMAMONITOR_NUM_MOVE_ENGINES (2)  /**<\brief Number of DMA move engines */
+
+/** \addtogroup library_srvsw_sysse_general_dmamonitor
+ * \{ */
+
+/** \brief Statistics of one DMA channel */
+typedef struct
+{
+    pchar            name;                   /**<\brief channel name */
+    IfxDma_ChannelId channelId;              /**<\brief DMA channel */
+    uint16           transferCount;          /**<\brief CHCSR.TCOUNT of the previous sample */
+    uint32           flags;                  /**<\brief event flags of the previous sample */
+    uint32           transfers;              /**<\brief number of transfers */
+    uint32           moves;                  /**<\brief number of moves */
+    uint32           bytes;                  /**<\brief number of bytes */
+    uint32           activeSamples;          /**<\brief samples in which the channel is active in a move engine */
+    uint32           patternEvents;          /**<\brief pattern matches */
+    uint32           wrapSourceEvents;       /**<\brief source buffer wraps */
+    uint32           wrapDestinationEvents;  /**<\brief destination buffer wraps */
+    uint32           requestLostEvents;      /**<\brief lost transaction requests */
+    uint32           movesAtUpdate;          /**<\brief moves at the previous update */
+    uint32           bytesAtUpdate;          /**<\brief bytes at the previous update */
+    float32          movesPerSecond;         /**<\brief moves per second over the last update period */
+    float32          bytesPerSecond;         /**<\brief bytes per second over the last update period */
+} Ifx_DmaMonitor_Channel;
+
+/** \brief Statistics of one move engine */
+typedef struct
+{
+    uint32  errorFlags;             /**<\brief DMA_ERRSRx of the previous sample */
+    uint32  busySamples;            /**<\brief samples in which the move engine reads or writes */
+    uint32  busySamplesAtUpdate;    /**<\brief busySamples at the previous update */
+    uint32  sourceErrors;           /**<\brief source errors (SER) */
+    uint32  destinationErrors;      /**<\brief destination errors (DER) */
+    uint32  spbErrors;              /**<\brief SPB bus errors (SPBER) */
+    uint32  sriErrors;              /**<\brief SRI bus errors (SRIER) */
+    uint32  ramErrors;              /**<\brief DMA RAM errors (RAMER) */
+    uint32  linkedListErrors;       /**<\brief safe and DMA linked list errors (SLLER, DLLER) */
+    uint8   lastErrorChannel;       /**<\brief channel of the last error (LEC) */
+    float32 load;                   /**<\brief busy fraction over the last update period, 0 .. 1 */
+} Ifx_DmaMonitor_MoveEngine;
+
+/** \brief DMA monitor object */
+typedef struct
+{
+    Ifx_DMA                  *dma;                                           /**<\brief DMA module */
+    Ifx_DmaMonitor_Channel    channels[IFX_CFG_DMAMONITOR_MAX_CHANNELS];     /**<\brief monitored channels */
+    uint8                     channelCount;                                  /**<\brief number of monitored channels */
+    Ifx_DmaMonitor_MoveEngine moveEngines[IFX_DMAMONITOR_NUM_MOVE_ENGINES];  /**<\brief move engines */
+    uint32                    samples;                                       /**<\brief number of samples */
+    uint32                    samplesAtUpdate;                               /**<\brief samples at the previous update */
+    uint16                    spbErrorCount;                                 /**<\brief SBCU_ECON.ERRCNT of the previous sample */
+    uint32                    spbBusErrors;                                  /**<\brief SPB bus errors of all masters */
+    Ifx_TickTime              updateTime;                                    /**<\brief time of the previous update */
+} Ifx_DmaMonitor;
+
+/** \brief Initialize the DMA monitor
+ * \param monitor Pointer to the DMA monitor object
+ * \param dma Pointer to the DMA module
+ */
+IFX_EXTERN void Ifx_DmaMonitor_init(Ifx_DmaMonitor *monitor, Ifx_DMA *dma);
+
+/** \brief Register a DMA channel
+ * \param monitor Pointer to the DMA monitor object
+ * \param name channel name, must be a constant string
+ * \param channelId DMA channel
+ * \return Returns the channel index, or -1 if the channel could not be registered
+ */
+IFX_EXTERN sint32 Ifx_DmaMonitor_addChannel(Ifx_DmaMonitor *monitor, pchar name, IfxDma_ChannelId channelId);
+
+/** \brief Register the move engine loads and the channel rates as telemetry channels
+ * \param monitor Pointer to the DMA monitor object
+ * \param telemetry Pointer to the telemetry object
+ */
+IFX_EXTERN void Ifx_DmaMonitor_addTelemetryChannels(Ifx_DmaMonitor *monitor, Ifx_Telemetry *telemetry);
+
+/** \brief Clear the statistics
+ * \param monitor Pointer to the DMA monitor object
+ */
+IFX_EXTERN void Ifx_DmaMonitor_reset(Ifx_DmaMonitor *monitor);
+
+/** \brief Sample the DMA registers, to be called periodically
+ * \param monitor Pointer to the DMA monitor object
+ */
+IFX_EXTERN void Ifx_DmaMonitor_sample(Ifx_DmaMonitor *monitor);
+
+/** \brief Compute the loads and the rates since the previous update
+ * \param monitor Pointer to the DMA monitor object
+ */
+IFX_EXTERN void Ifx_DmaMonitor_update(Ifx_DmaMonitor *monitor);
+
+/** \brief Shell command: print the statistics. With the argument "reset", the statistics are cleared afterwards
+ * \param args command arguments
+ * \param data Pointer to the DMA monitor object
+ * \param io Pointer to the IfxStdIf_DPipe object
+ * \return TRUE
+ */
+IFX_EXTERN boolean Ifx_DmaMonitor_show(pchar args, void *data, IfxStdIf_DPipe *io);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
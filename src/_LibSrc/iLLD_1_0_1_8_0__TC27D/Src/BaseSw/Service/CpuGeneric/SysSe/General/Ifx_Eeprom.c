@@ -0,0 +1,465 @@
+/**
+ * \file Ifx_Eeprom.c
+ * \brief EEPROM emulation in the data flash
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_Eeprom.h"
+#include "IfxFlash_bf.h"
+#include <string.h>
+
+/*
+ * Flash layout of a virtual sector (the erased flash reads 0):
+ * - page 0: sector header {IFX_EEPROM_MAGIC, sequence}, programmed at the end of the swap
+ * - records: header page {id | (length << 16), checksum} followed by the data pages. The header page is
+ * programmed first, so that the scan always knows the size of a record which was interrupted by a reset.
+ */
+
+#define IFX_EEPROM_MAGIC               (0x45455031u)   /* "EEP1" */
+#define IFX_EEPROM_PAGE_SIZE           (IFXFLASH_DFLASH_PAGE_LENGTH)
+#define IFX_EEPROM_LOGICAL_SECTOR_SIZE (IFXFLASH_DFLASH_SIZE / IFXFLASH_DFLASH_NUM_LOG_SECTORS)
+#define IFX_EEPROM_FSR_ERRORS          ((1u << IFX_FLASH_FSR_OPER_OFF) | (1u << IFX_FLASH_FSR_SQER_OFF) | (1u << IFX_FLASH_FSR_PROER_OFF) \
+                                        | (1u << IFX_FLASH_FSR_PVER_OFF) | (1u << IFX_FLASH_FSR_EVER_OFF))
+
+/** Size of a record in flash, header page included */
+#define IFX_EEPROM_RECORD_SIZE(length) (IFX_EEPROM_PAGE_SIZE + (((length) + IFX_EEPROM_PAGE_SIZE - 1) & ~(IFX_EEPROM_PAGE_SIZE - 1)))
+
+/** Returns FALSE and clears the status if the last flash command failed
+ */
+static boolean Ifx_Eeprom_checkStatus(void)
+{
+    boolean result = (FLASH0_FSR.U & IFX_EEPROM_FSR_ERRORS) == 0;
+
+    if (result == FALSE)
+    {
+        IfxFlash_clearStatus(0);
+    }
+
+    return result;
+}
+
+
+/** Checksum of a record image: header word and data words
+ */
+static uint32 Ifx_Eeprom_checksum(const uint32 *image, uint16 words)
+{
+    uint32 checksum = 0x5A5A5A5Au ^ image[0];
+    uint16 i;
+
+    for (i = 2; i < words; i++)
+    {
+        checksum = ((checksum << 1) | (checksum >> 31)) ^ image[i];
+    }
+
+    return checksum;
+}
+
+
+static uint32 Ifx_Eeprom_getSectorAddress(const Ifx_Eeprom *eeprom, uint8 sector)
+{
+    return eeprom->config.startAddress + ((uint32)sector * eeprom->config.sectorSize);
+}
+
+
+static boolean Ifx_Eeprom_isFlashBusy(void)
+{
+    return FLASH0_FSR.B.D0BUSY != 0;
+}
+
+
+/** Read a record from the flash into the image
+ */
+static void Ifx_Eeprom_loadImage(Ifx_Eeprom *eeprom, uint32 address, uint16 words)
+{
+    const volatile uint32 *source = (const volatile uint32 *)address;
+    uint16                 i;
+
+    for (i = 0; i < words; i++)
+    {
+        eeprom->image[i] = source[i];
+    }
+
+    eeprom->imageWords   = words;
+    eeprom->imageOffset  = 0;
+    eeprom->imageAddress = eeprom->writeAddress;
+}
+
+
+static void Ifx_Eeprom_eraseSector(Ifx_Eeprom *eeprom, uint8 sector)
+{
+    IfxFlash_eraseMultipleSectors(Ifx_Eeprom_getSectorAddress(eeprom, sector),
+        eeprom->config.sectorSize / IFX_EEPROM_LOGICAL_SECTOR_SIZE);
+}
+
+
+static void Ifx_Eeprom_programPage(uint32 address, uint32 wordL, uint32 wordU)
+{
+    IfxFlash_enterPageMode(address);
+    IfxFlash_waitUnbusy(0, IfxFlash_FlashType_D0);  /* short, only the page buffer is cleared */
+    IfxFlash_loadPage2X32(address, wordL, wordU);
+    IfxFlash_writePage(address);
+}
+
+
+/** Build the RAM index from the records of the active sector
+ */
+static void Ifx_Eeprom_scan(Ifx_Eeprom *eeprom)
+{
+    uint32 sectorAddress = Ifx_Eeprom_getSectorAddress(eeprom, eeprom->activeSector);
+    uint32 end           = sectorAddress + eeprom->config.sectorSize;
+    uint32 address       = sectorAddress + IFX_EEPROM_PAGE_SIZE;
+    uint16 id;
+
+    for (id = 0; id < IFX_CFG_EEPROM_ID_COUNT; id++)
+    {
+        eeprom->index[id] = 0;
+    }
+
+    while (address < end)
+    {
+        uint32 header = *(const volatile uint32 *)address;
+        uint16 length = (uint16)(header >> 16);
+        uint32 size   = IFX_EEPROM_RECORD_SIZE(length);
+
+        id = (uint16)(header & 0xFFFFu);
+
+        if (header == 0)
+        {
+            break;      /* erased: end of the records */
+        }
+
+        if ((id == 0) || (id >= IFX_CFG_EEPROM_ID_COUNT) || (length > IFX_CFG_EEPROM_RECORD_SIZE_MAX) || ((address + size) > end))
+        {
+            /* Corrupted header: the sector is considered as full, the next write swaps */
+            address = end;
+            break;
+        }
+
+        Ifx_Eeprom_loadImage(eeprom, address, (uint16)(size / 4));
+
+        if (Ifx_Eeprom_checksum(eeprom->image, eeprom->imageWords) == eeprom->image[1])
+        {
+            eeprom->index[id] = address;
+        }
+
+        address += size;
+    }
+
+    eeprom->writeAddress = address;
+}
+
+
+/** End of the swap on error: the active sector is unchanged, the index is rebuilt
+ */
+static void Ifx_Eeprom_abortSwap(Ifx_Eeprom *eeprom)
+{
+    eeprom->targetSector = eeprom->activeSector;
+    eeprom->state        = Ifx_Eeprom_State_idle;
+    Ifx_Eeprom_scan(eeprom);
+}
+
+
+/** Dequeue the oldest request
+ */
+static void Ifx_Eeprom_dequeue(Ifx_Eeprom *eeprom)
+{
+    eeprom->queueHead = (uint8)((eeprom->queueHead + 1) % IFX_CFG_EEPROM_QUEUE_LENGTH);
+    eeprom->queueCount--;
+}
+
+
+/** Copy step of the swap: the next record is loaded, or the sector header is programmed when all records are copied
+ */
+static void Ifx_Eeprom_copyNext(Ifx_Eeprom *eeprom)
+{
+    while ((eeprom->copyId < IFX_CFG_EEPROM_ID_COUNT) && (eeprom->index[eeprom->copyId] == 0))
+    {
+        eeprom->copyId++;
+    }
+
+    if (eeprom->copyId < IFX_CFG_EEPROM_ID_COUNT)
+    {
+        uint32 address = eeprom->index[eeprom->copyId];
+        uint16 length  = (uint16)(*(const volatile uint32 *)address >> 16);
+
+        Ifx_Eeprom_loadImage(eeprom, address, (uint16)(IFX_EEPROM_RECORD_SIZE(length) / 4));
+        eeprom->state = Ifx_Eeprom_State_program;
+    }
+    else
+    {
+        /* All records are copied: the sector becomes valid */
+        Ifx_Eeprom_programPage(Ifx_Eeprom_getSectorAddress(eeprom, eeprom->targetSector), IFX_EEPROM_MAGIC, eeprom->sequence + 1);
+        eeprom->commandIssued = TRUE;
+        eeprom->state         = Ifx_Eeprom_State_header;
+    }
+}
+
+
+/** Start the write of the oldest request, or the swap if the active sector is full
+ */
+static void Ifx_Eeprom_startWrite(Ifx_Eeprom *eeprom)
+{
+    Ifx_Eeprom_Request *request = &eeprom->queue[eeprom->queueHead];
+    uint32              size    = IFX_EEPROM_RECORD_SIZE(request->length);
+    uint32              end     = Ifx_Eeprom_getSectorAddress(eeprom, eeprom->activeSector) + eeprom->config.sectorSize;
+
+    if ((eeprom->writeAddress + size) > end)
+    {
+        /* Sector swap, the next sector is erased first: it may contain an interrupted swap */
+        eeprom->targetSector = (uint8)((eeprom->activeSector + 1) % eeprom->config.sectorCount);
+        Ifx_Eeprom_eraseSector(eeprom, eeprom->targetSector);
+        eeprom->commandIssued = TRUE;
+        eeprom->state         = Ifx_Eeprom_State_erase;
+    }
+    else
+    {
+        uint16 words = (uint16)(size / 4);
+        uint16 i;
+
+        eeprom->image[0] = (uint32)request->id | ((uint32)request->length << 16);
+
+        for (i = 2; i < words; i++)
+        {
+            eeprom->image[i] = request->data[i - 2];
+        }
+
+        eeprom->image[1]     = Ifx_Eeprom_checksum(eeprom->image, words);
+        eeprom->imageWords   = words;
+        eeprom->imageOffset  = 0;
+        eeprom->imageAddress = eeprom->writeAddress;
+        eeprom->state        = Ifx_Eeprom_State_program;
+    }
+}
+
+
+boolean Ifx_Eeprom_init(Ifx_Eeprom *eeprom, const Ifx_Eeprom_Config *config)
+{
+    boolean result = TRUE;
+    uint8   sector;
+    boolean found  = FALSE;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, config->sectorCount >= 2);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->sectorSize % IFX_EEPROM_LOGICAL_SECTOR_SIZE) == 0);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((config->startAddress - IFXFLASH_DFLASH_START) % IFX_EEPROM_LOGICAL_SECTOR_SIZE) == 0);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->startAddress + (config->sectorSize * config->sectorCount) - 1) <= IFXFLASH_DFLASH_END);
+    /* The last record of every identifier, and a new one, must fit into a sector */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (IFX_EEPROM_PAGE_SIZE + (IFX_CFG_EEPROM_ID_COUNT * IFX_EEPROM_RECORD_SIZE(IFX_CFG_EEPROM_RECORD_SIZE_MAX))) <= config->sectorSize);
+
+    eeprom->config        = *config;
+    eeprom->state         = Ifx_Eeprom_State_idle;
+    eeprom->commandIssued = FALSE;
+    eeprom->queueHead     = 0;
+    eeprom->queueCount    = 0;
+    eeprom->swapCount     = 0;
+    eeprom->errorCount    = 0;
+    eeprom->sequence      = 0;
+    eeprom->activeSector  = 0;
+
+    /* The active sector is the valid one with the highest sequence */
+    for (sector = 0; sector < config->sectorCount; sector++)
+    {
+        const volatile uint32 *header = (const volatile uint32 *)Ifx_Eeprom_getSectorAddress(eeprom, sector);
+
+        if ((header[0] == IFX_EEPROM_MAGIC) && ((found == FALSE) || ((sint32)(header[1] - eeprom->sequence) > 0)))
+        {
+            eeprom->activeSector = sector;
+            eeprom->sequence     = header[1];
+            found                = TRUE;
+        }
+    }
+
+    if (found == FALSE)
+    {
+        /* Format: blocking, only the first start */
+        Ifx_Eeprom_eraseSector(eeprom, 0);
+        IfxFlash_waitUnbusy(0, IfxFlash_FlashType_D0);
+        result = Ifx_Eeprom_checkStatus();
+
+        if (result != FALSE)
+        {
+            Ifx_Eeprom_programPage(Ifx_Eeprom_getSectorAddress(eeprom, 0), IFX_EEPROM_MAGIC, 1);
+            IfxFlash_waitUnbusy(0, IfxFlash_FlashType_D0);
+            result = Ifx_Eeprom_checkStatus();
+        }
+
+        eeprom->activeSector = 0;
+        eeprom->sequence     = 1;
+    }
+
+    eeprom->targetSector = eeprom->activeSector;
+    Ifx_Eeprom_scan(eeprom);
+
+    return result;
+}
+
+
+void Ifx_Eeprom_initConfig(Ifx_Eeprom_Config *config)
+{
+    config->startAddress = IFXFLASH_DFLASH_START;
+    config->sectorSize   = 2 * IFX_EEPROM_LOGICAL_SECTOR_SIZE;
+    config->sectorCount  = 2;
+}
+
+
+void Ifx_Eeprom_process(Ifx_Eeprom *eeprom)
+{
+    if (Ifx_Eeprom_isFlashBusy() != FALSE)
+    {
+        return;
+    }
+
+    if (eeprom->commandIssued != FALSE)
+    {
+        eeprom->commandIssued = FALSE;
+
+        if (Ifx_Eeprom_checkStatus() == FALSE)
+        {
+            eeprom->errorCount++;
+
+            if (eeprom->targetSector != eeprom->activeSector)
+            {
+                Ifx_Eeprom_abortSwap(eeprom);
+            }
+            else
+            {
+                /* The failed record is skipped and dropped */
+                eeprom->writeAddress = eeprom->imageAddress + (eeprom->imageWords * 4);
+                eeprom->state        = Ifx_Eeprom_State_idle;
+                Ifx_Eeprom_dequeue(eeprom);
+            }
+
+            return;
+        }
+    }
+
+    switch (eeprom->state)
+    {
+    case Ifx_Eeprom_State_idle:
+
+        if (eeprom->queueCount != 0)
+        {
+            Ifx_Eeprom_startWrite(eeprom);
+        }
+
+        break;
+    case Ifx_Eeprom_State_program:
+
+        if (eeprom->imageOffset < eeprom->imageWords)
+        {
+            uint16 offset = eeprom->imageOffset;
+
+            Ifx_Eeprom_programPage(eeprom->imageAddress + (offset * 4), eeprom->image[offset], eeprom->image[offset + 1]);
+            eeprom->imageOffset   = offset + 2;
+            eeprom->commandIssued = TRUE;
+        }
+        else
+        {
+            /* Record programmed */
+            eeprom->index[eeprom->image[0] & 0xFFFFu] = eeprom->imageAddress;
+            eeprom->writeAddress                     = eeprom->imageAddress + (eeprom->imageWords * 4);
+
+            if (eeprom->targetSector != eeprom->activeSector)
+            {
+                eeprom->copyId++;
+                eeprom->state = Ifx_Eeprom_State_copy;
+            }
+            else
+            {
+                Ifx_Eeprom_dequeue(eeprom);
+                eeprom->state = Ifx_Eeprom_State_idle;
+            }
+        }
+
+        break;
+    case Ifx_Eeprom_State_erase:
+        /* Target sector erased */
+        eeprom->writeAddress = Ifx_Eeprom_getSectorAddress(eeprom, eeprom->targetSector) + IFX_EEPROM_PAGE_SIZE;
+        eeprom->copyId       = 1;
+        Ifx_Eeprom_copyNext(eeprom);
+        break;
+    case Ifx_Eeprom_State_copy:
+        Ifx_Eeprom_copyNext(eeprom);
+        break;
+    case Ifx_Eeprom_State_header:
+        /* The target sector is the new active sector, the pending request is written into it */
+        eeprom->activeSector = eeprom->targetSector;
+        eeprom->sequence++;
+        eeprom->swapCount++;
+        eeprom->state        = Ifx_Eeprom_State_idle;
+        break;
+    default:
+        break;
+    }
+}
+
+
+boolean Ifx_Eeprom_read(Ifx_Eeprom *eeprom, uint16 id, void *data, uint16 length)
+{
+    uint8  i;
+    uint32 address;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (id != 0) && (id < IFX_CFG_EEPROM_ID_COUNT));
+
+    /* The newest queued record first */
+    for (i = eeprom->queueCount; i > 0; i--)
+    {
+        const Ifx_Eeprom_Request *request = &eeprom->queue[(eeprom->queueHead + i - 1) % IFX_CFG_EEPROM_QUEUE_LENGTH];
+
+        if (request->id == id)
+        {
+            memcpy(data, request->data, __min(length, request->length));
+            return TRUE;
+        }
+    }
+
+    address = eeprom->index[id];
+
+    if ((address == 0) || (Ifx_Eeprom_isFlashBusy() != FALSE))
+    {
+        return FALSE;
+    }
+
+    memcpy(data, (const void *)(address + IFX_EEPROM_PAGE_SIZE), __min(length, *(const volatile uint32 *)address >> 16));
+
+    return TRUE;
+}
+
+
+boolean Ifx_Eeprom_write(Ifx_Eeprom *eeprom, uint16 id, const void *data, uint16 length)
+{
+    Ifx_Eeprom_Request *request;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (id != 0) && (id < IFX_CFG_EEPROM_ID_COUNT));
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, length <= IFX_CFG_EEPROM_RECORD_SIZE_MAX);
+
+    if (eeprom->queueCount >= IFX_CFG_EEPROM_QUEUE_LENGTH)
+    {
+        return FALSE;
+    }
+
+    request         = &eeprom->queue[(eeprom->queueHead + eeprom->queueCount) % IFX_CFG_EEPROM_QUEUE_LENGTH];
+    request->id     = id;
+    request->length = length;
+    memset(request->data, 0, sizeof(request->data));
+    memcpy(request->data, data, length);
+    eeprom->queueCount++;
+
+    return TRUE;
+}
@@ -0,0 +1,193 @@
+/**
+ * \file Ifx_Eeprom.h
+ * \brief EEPROM emulation in the data flash
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_general_eeprom EEPROM emulation
+ * \ingroup library_srvsw_sysse_general
+ *
+ * The EEPROM emulation stores records identified by a number (1 to IFX_CFG_EEPROM_ID_COUNT - 1) in the
+ * data flash DF0, without blocking the application during the program and erase operations:
+ * - \ref Ifx_Eeprom_write() only copies the record into a RAM queue.
+ * - \ref Ifx_Eeprom_process() is called from a background task. Each call issues at most one flash command
+ * (program of one page or sector erase) and returns immediately while the flash is busy. A sector erase,
+ * about 100 ms, then does not delay the control loop.
+ * - \ref Ifx_Eeprom_read() reads the last record through a RAM index, without search.
+ *
+ * The emulation area is split in virtual sectors of one or several logical DF0 sectors. The records are
+ * appended to the active sector (log structured), a new record of an identifier hides the previous ones.
+ * When the active sector is full, the next sector is erased, the last record of each identifier is copied
+ * into it, then its header is written: the sectors are used in turn (wear levelling). A power loss during
+ * the copy leaves the previous sector active; a record with a wrong checksum is ignored.
+ *
+ * The DF0 can not be read while it is programmed or erased: \ref Ifx_Eeprom_read() then returns FALSE,
+ * except for the records which are still in the write queue. Data needed by the control loop should be
+ * read once at startup. The functions shall be called by one CPU, outside of interrupts.
+ *
+ * Usage example:
+ * \code
+ * enum {EEPROM_ID_CALIBRATION = 1, EEPROM_ID_ODOMETER = 2};
+ *
+ * static Ifx_Eeprom eeprom;
+ *
+ * // initialization, blocking while the emulation area is formatted the first time
+ * Ifx_Eeprom_Config config;
+ * Ifx_Eeprom_initConfig(&config);
+ * config.startAddress = IFXFLASH_DFLASH_START;
+ * config.sectorSize   = 0x4000;    // 2 logical sectors
+ * config.sectorCount  = 4;
+ * Ifx_Eeprom_init(&eeprom, &config);
+ *
+ * Ifx_Eeprom_read(&eeprom, EEPROM_ID_CALIBRATION, &calibration, sizeof(calibration));
+ *
+ * // 10 ms task
+ * Ifx_Eeprom_write(&eeprom, EEPROM_ID_ODOMETER, &odometer, sizeof(odometer));
+ *
+ * // background loop
+ * Ifx_Eeprom_process(&eeprom);
+ * \endcode
+ *
+ */
+#ifndef IFX_EEPROM_H
+#define IFX_EEPROM_H 1
+
+#include "Cpu/Std/Ifx_Types.h"
+#include "Flash/Std/IfxFlash.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_EEPROM_ID_COUNT)
+#define IFX_CFG_EEPROM_ID_COUNT         (32)  /**<\brief Number of record identifiers, size of the RAM index */
+#endif
+
+#if !defined(IFX_CFG_EEPROM_RECORD_SIZE_MAX)
+#define IFX_CFG_EEPROM_RECORD_SIZE_MAX  (64)  /**<\brief Maximal size of a record in bytes, multiple of 8 */
+#endif
+
+#if !defined(IFX_CFG_EEPROM_QUEUE_LENGTH)
+#define IFX_CFG_EEPROM_QUEUE_LENGTH     (4)   /**<\brief Number of records which can wait to be written */
+#endif
+
+/** \addtogroup library_srvsw_sysse_general_eeprom
+ * \{ */
+
+/** \brief State of the background processing */
+typedef enum
+{
+    Ifx_Eeprom_State_idle,     /**< \brief no flash operation */
+    Ifx_Eeprom_State_program,  /**< \brief a record is programmed page by page */
+    Ifx_Eeprom_State_erase,    /**< \brief the next sector is erased before the swap */
+    Ifx_Eeprom_State_copy,     /**< \brief the last records are copied into the next sector */
+    Ifx_Eeprom_State_header    /**< \brief the header of the next sector is programmed, end of the swap */
+} Ifx_Eeprom_State;
+
+/** \brief Configuration of the emulation area */
+typedef struct
+{
+    uint32 startAddress;  /**< \brief DF0 address of the first sector, aligned on a logical sector */
+    uint32 sectorSize;    /**< \brief size of a virtual sector in bytes, multiple of the logical sector size */
+    uint8  sectorCount;   /**< \brief number of virtual sectors, at least 2 */
+} Ifx_Eeprom_Config;
+
+/** \brief Record waiting to be written */
+typedef struct
+{
+    uint16 id;                                             /**< \brief record identifier */
+    uint16 length;                                         /**< \brief record length in bytes */
+    uint32 data[IFX_CFG_EEPROM_RECORD_SIZE_MAX / 4];       /**< \brief record data */
+} Ifx_Eeprom_Request;
+
+/** \brief EEPROM emulation object */
+typedef struct
+{
+    Ifx_Eeprom_Config  config;                                          /**< \brief emulation area */
+    uint32             index[IFX_CFG_EEPROM_ID_COUNT];                  /**< \brief address of the last record of each identifier, 0 if none */
+    uint32             sequence;                                        /**< \brief sequence number of the active sector */
+    uint8              activeSector;                                    /**< \brief index of the active sector */
+    uint8              targetSector;                                    /**< \brief index of the sector being prepared by the swap */
+    uint32             writeAddress;                                    /**< \brief next free page of the active sector, or of the target sector during the swap */
+    Ifx_Eeprom_State   state;                                           /**< \brief state of the background processing */
+    boolean            commandIssued;                                   /**< \brief TRUE if the status of the last flash command is not checked yet */
+    uint32             image[2 + (IFX_CFG_EEPROM_RECORD_SIZE_MAX / 4)]; /**< \brief pages being programmed: record header then data */
+    uint16             imageWords;                                      /**< \brief size of the image in 32 bit words */
+    uint16             imageOffset;                                     /**< \brief next word of the image to program */
+    uint32             imageAddress;                                    /**< \brief flash address of the image */
+    uint16             copyId;                                          /**< \brief next identifier to copy during the swap */
+    Ifx_Eeprom_Request queue[IFX_CFG_EEPROM_QUEUE_LENGTH];              /**< \brief records waiting to be written */
+    uint8              queueHead;                                       /**< \brief oldest record of the queue */
+    uint8              queueCount;                                      /**< \brief number of records in the queue */
+    uint32             swapCount;                                       /**< \brief number of sector swaps since the initialization */
+    uint32             errorCount;                                      /**< \brief number of failed flash commands */
+} Ifx_Eeprom;
+
+/** \brief Initialize the emulation and build the RAM index
+ *
+ * The emulation area is scanned, and formatted if no valid sector is found: this erase is blocking.
+ * \param eeprom Pointer to the EEPROM object
+ * \param config Configuration of the emulation area
+ * \return Returns FALSE if the emulation area could not be formatted
+ */
+IFX_EXTERN boolean Ifx_Eeprom_init(Ifx_Eeprom *eeprom, const Ifx_Eeprom_Config *config);
+
+/** \brief Initialize the configuration with the first 4 logical sectors of DF0, 2 virtual sectors
+ * \param config Configuration of the emulation area
+ */
+IFX_EXTERN void Ifx_Eeprom_initConfig(Ifx_Eeprom_Config *config);
+
+/** \brief Indicates if records are waiting to be written or a flash operation is in progress
+ * \param eeprom Pointer to the EEPROM object
+ * \return Returns TRUE if \ref Ifx_Eeprom_process() has work to do
+ */
+IFX_INLINE boolean Ifx_Eeprom_isBusy(const Ifx_Eeprom *eeprom)
+{
+    return (eeprom->state != Ifx_Eeprom_State_idle) || (eeprom->queueCount != 0);
+}
+
+
+/** \brief Execute the next step of the program and erase operations
+ *
+ * Called periodically from a background task. Returns immediately while the flash is busy.
+ * \param eeprom Pointer to the EEPROM object
+ */
+IFX_EXTERN void Ifx_Eeprom_process(Ifx_Eeprom *eeprom);
+
+/** \brief Read the last record of an identifier
+ *
+ * The records in the write queue are returned before they are programmed.
+ * \param eeprom Pointer to the EEPROM object
+ * \param id Record identifier
+ * \param data Buffer receiving the record
+ * \param length Size of the buffer in bytes. At most the record length is copied
+ * \return Returns FALSE if the record does not exist or the DF0 is busy
+ */
+IFX_EXTERN boolean Ifx_Eeprom_read(Ifx_Eeprom *eeprom, uint16 id, void *data, uint16 length);
+
+/** \brief Queue a record to be written by \ref Ifx_Eeprom_process()
+ *
+ * The data is copied, the buffer can be reused after the call.
+ * \param eeprom Pointer to the EEPROM object
+ * \param id Record identifier, 1 to IFX_CFG_EEPROM_ID_COUNT - 1
+ * \param data Record data
+ * \param length Record length in bytes, at most IFX_CFG_EEPROM_RECORD_SIZE_MAX
+ * \return Returns FALSE if the queue is full
+ */
+IFX_EXTERN boolean Ifx_Eeprom_write(Ifx_Eeprom *eeprom, uint16 id, const void *data, uint16 length);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -0,0 +1,196 @@
+/**
+ * \file Ifx_EmemCapture.c
+ * \brief EMEM capture store
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_EmemCapture.h"
+#include "Scu/Std/IfxScuWdt.h"
+#include "Src/Std/IfxSrc.h"
+#include "_Utilities/Ifx_Assert.h"
+
+uint32 Ifx_EmemCapture_getChunk(Ifx_EmemCapture *capture, const void **data)
+{
+    uint32 written = capture->written;
+
+    if ((written - capture->read) > (capture->numChunks - 1))
+    {
+        /* the DMA wrapped on the oldest chunks, keep the most recent ones */
+        capture->overruns += (written - capture->read) - (capture->numChunks - 1);
+        capture->read      = written - (capture->numChunks - 1);
+    }
+
+    if (written == capture->read)
+    {
+        return 0;
+    }
+
+    *data = (const void *)(capture->start + ((capture->read % capture->numChunks) * capture->chunkSize));
+
+    return capture->chunkSize;
+}
+
+
+boolean Ifx_EmemCapture_init(Ifx_EmemCapture *capture, const Ifx_EmemCapture_Config *config)
+{
+    uint32                   size = (uint32)config->numTiles * IFX_EMEMCAPTURE_TILE_SIZE;
+    uint32                   tile;
+    IfxDma_Dma               dma;
+    IfxDma_Dma_ChannelConfig dmaCfg;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->source != NULL_PTR) && (config->trigger != NULL_PTR));
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((uint32)config->firstTile + config->numTiles) <= 16);
+
+    capture->start       = IFXEMEM_START_ADDR_CPU + ((uint32)config->firstTile * IFX_EMEMCAPTURE_TILE_SIZE);
+    capture->chunkLength = config->chunkLength;
+    capture->chunkSize   = (uint32)config->chunkLength << config->moveSize;
+    capture->numChunks   = (capture->chunkSize != 0) ? (size / capture->chunkSize) : 0;
+    capture->written     = 0;
+    capture->read        = 0;
+    capture->overruns    = 0;
+
+    if ((IfxEmem_isModuleEnabled() == FALSE) || (IfxEmem_getLockedState() != IfxEmem_LockedState_unlocked) || (capture->numChunks < 2))
+    {
+        return FALSE;
+    }
+
+    for (tile = config->firstTile; tile < ((uint32)config->firstTile + config->numTiles); tile++)
+    {
+        IfxEmem_setTileConfigMode(IfxEmem_TileConfigMode_calibMode, (IfxEmem_TileNumber)tile);
+    }
+
+    /* DMA: one sample per request, continuous transactions of one chunk each */
+    IfxDma_Dma_createModuleHandle(&dma, &MODULE_DMA);
+    IfxDma_Dma_initChannelConfig(&dmaCfg, &dma);
+
+    dmaCfg.channelId                     = config->dmaChannelId;
+    dmaCfg.hardwareRequestEnabled        = FALSE;                                          // enabled by Ifx_EmemCapture_start()
+    dmaCfg.requestMode                   = IfxDma_ChannelRequestMode_oneTransferPerRequest;
+    dmaCfg.operationMode                 = IfxDma_ChannelOperationMode_continuous;
+    dmaCfg.moveSize                      = config->moveSize;
+    dmaCfg.blockMode                     = IfxDma_ChannelMove_1;
+    dmaCfg.transferCount                 = config->chunkLength;
+    dmaCfg.sourceAddress                 = (uint32)config->source;
+    dmaCfg.sourceCircularBufferEnabled   = TRUE;                                           // fixed source
+    dmaCfg.sourceAddressCircularRange    = IfxDma_ChannelIncrementCircular_none;
+    dmaCfg.destinationAddress            = capture->start;
+    dmaCfg.shadowControl                 = IfxDma_ChannelShadow_dst;                       // wrap taken at the next transaction start
+    dmaCfg.channelInterruptEnabled       = TRUE;
+    dmaCfg.channelInterruptPriority      = config->isrPriority;
+    dmaCfg.channelInterruptTypeOfService = config->isrProvider;
+    IfxDma_Dma_initChannel(&capture->dmaChannel, &dmaCfg);
+
+    /* each sample of the acquisition driver requests one transfer of the DMA channel with the same number */
+    IfxSrc_init(config->trigger, IfxSrc_Tos_dma, (Ifx_Priority)config->dmaChannelId);
+    IfxSrc_enable(config->trigger);
+
+    return TRUE;
+}
+
+
+void Ifx_EmemCapture_initConfig(Ifx_EmemCapture_Config *config)
+{
+    config->source       = NULL_PTR;
+    config->moveSize     = IfxDma_ChannelMoveSize_32bit;
+    config->trigger      = NULL_PTR;
+    config->firstTile    = IfxEmem_TileNumber_0;
+    config->numTiles     = 4;
+    config->chunkLength  = 4096;
+    config->dmaChannelId = IfxDma_ChannelId_0;
+    config->isrPriority  = 0;
+    config->isrProvider  = IfxSrc_Tos_cpu0;
+}
+
+
+void Ifx_EmemCapture_onChunkDone(Ifx_EmemCapture *capture)
+{
+    uint32 written = capture->written + 1;
+
+    /* the DMA writes chunk "written" now, the destination written at this time is taken for the next chunk */
+    if (((written + 1) % capture->numChunks) == 0)
+    {
+        IfxDma_setChannelDestinationAddress(capture->dmaChannel.dma, capture->dmaChannel.channelId, (void *)capture->start);
+    }
+
+    capture->written = written;
+}
+
+
+void Ifx_EmemCapture_releaseChunk(Ifx_EmemCapture *capture)
+{
+    if (capture->written != capture->read)
+    {
+        capture->read++;
+    }
+}
+
+
+void Ifx_EmemCapture_start(Ifx_EmemCapture *capture)
+{
+    Ifx_EmemCapture_stop(capture);
+
+    capture->written  = 0;
+    capture->read     = 0;
+    capture->overruns = 0;
+
+    IfxDma_setChannelShadow(capture->dmaChannel.dma, capture->dmaChannel.channelId, IfxDma_ChannelShadow_none);
+    IfxDma_setChannelDestinationAddress(capture->dmaChannel.dma, capture->dmaChannel.channelId, (void *)capture->start);
+    IfxDma_setChannelShadow(capture->dmaChannel.dma, capture->dmaChannel.channelId, IfxDma_ChannelShadow_dst);
+    IfxDma_Dma_setChannelTransferCount(&capture->dmaChannel, capture->chunkLength);
+    IfxDma_clearChannelInterrupt(capture->dmaChannel.dma, capture->dmaChannel.channelId);
+    IfxDma_clearChannelTransactionRequestLost(capture->dmaChannel.dma, capture->dmaChannel.channelId);
+    IfxDma_enableChannelTransaction(capture->dmaChannel.dma, capture->dmaChannel.channelId);
+}
+
+
+void Ifx_EmemCapture_stop(Ifx_EmemCapture *capture)
+{
+    IfxDma_disableChannelTransaction(capture->dmaChannel.dma, capture->dmaChannel.channelId);
+}
+
+
+uint32 Ifx_EmemCapture_stream(Ifx_EmemCapture *capture, IfxStdIf_DPipe *io, Ifx_TickTime timeout)
+{
+    uint32      total    = 0;
+    boolean     complete = TRUE;
+    const void *data;
+    uint32      size;
+
+    while ((complete != FALSE) && ((size = Ifx_EmemCapture_getChunk(capture, &data)) != 0))
+    {
+        uint32 offset = 0;
+
+        /* Ifx_SizeT may be 16 bit, the chunk is written in slices */
+        while ((complete != FALSE) && (offset < size))
+        {
+            Ifx_SizeT slice = (Ifx_SizeT)__minu(size - offset, 0x4000);
+            Ifx_SizeT count = slice;
+
+            IfxStdIf_DPipe_write(io, (void *)((uint32)data + offset), &count, timeout);
+            offset  += (uint32)count;
+            complete = (count == slice) ? TRUE : FALSE;
+        }
+
+        total += offset;
+        Ifx_EmemCapture_releaseChunk(capture);
+    }
+
+    return total;
+}
@@ -0,0 +1,177 @@
+/**
+ * \file Ifx_EmemCapture.h
+ * \brief EMEM capture store
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_general_ememcapture EMEM capture store
+ * \ingroup library_srvsw_sysse_general
+ *
+ * On the emulation devices, the emulation memory (EMEM, 1 MB in 16 tiles of 64 kB) can store long captures at high
+ * rate without using the LMU or the DSPRs:
+ * - a DMA channel copies the samples of an acquisition driver (VADC result register, CAN receive buffer, ...) to a
+ * ring buffer over consecutive EMEM tiles, one transfer per trigger (the service request of the acquisition driver
+ * is routed to the DMA channel).
+ * - the ring buffer is split into chunks of one DMA transaction. The ring buffer is larger than the DMA circular
+ * buffer range, at the end of each chunk the channel interrupt (\ref Ifx_EmemCapture_onChunkDone()) counts the
+ * chunk and sets the wrap of the destination address through the shadow address register, so that the DMA never
+ * waits for the CPU.
+ * - the complete chunks are read out in place (\ref Ifx_EmemCapture_getChunk()), e.g. sent over Ethernet, or
+ * streamed to a IfxStdIf_DPipe (ASCLIN, simio) with \ref Ifx_EmemCapture_stream(). When the read out is slower than
+ * the capture, the oldest chunks are dropped and counted as overruns.
+ *
+ * The EMEM shall be enabled and unlocked by the application before \ref Ifx_EmemCapture_init(); the tiles of the
+ * ring buffer are allocated to the calibration memory (CPU and DMA access).
+ *
+ * Usage example:
+ * \code
+ * static Ifx_EmemCapture capture;
+ *
+ * // initialisation: VADC group 0 result 0, 4 tiles (256 kB) in chunks of 4096 samples
+ * Ifx_EmemCapture_Config config;
+ * Ifx_EmemCapture_initConfig(&config);
+ * config.source        = &MODULE_VADC.G[0].RES[0].U;
+ * config.trigger       = &MODULE_SRC.VADC.G[0].SR0;
+ * config.firstTile     = IfxEmem_TileNumber_4;
+ * config.numTiles      = 4;
+ * config.chunkLength   = 4096;
+ * config.dmaChannelId  = IfxDma_ChannelId_40;
+ * config.isrPriority   = ISR_PRIORITY_EMEM_CAPTURE;
+ * Ifx_EmemCapture_init(&capture, &config);
+ * Ifx_EmemCapture_start(&capture);
+ *
+ * // DMA channel interrupt
+ * IFX_INTERRUPT(ISR_ememCapture, 0, ISR_PRIORITY_EMEM_CAPTURE)
+ * {
+ *     Ifx_EmemCapture_onChunkDone(&capture);
+ * }
+ *
+ * // background loop: read out over UDP
+ * const void *data;
+ * uint32      size;
+ * while ((size = Ifx_EmemCapture_getChunk(&capture, &data)) != 0)
+ * {
+ *     // send size bytes from data ...
+ *     Ifx_EmemCapture_releaseChunk(&capture);
+ * }
+ * \endcode
+ *
+ */
+#ifndef IFX_EMEMCAPTURE_H
+#define IFX_EMEMCAPTURE_H 1
+
+#include "Cpu/Std/Ifx_Types.h"
+#include "Dma/Dma/IfxDma_Dma.h"
+#include "Emem/Std/IfxEmem.h"
+#include "StdIf/IfxStdIf_DPipe.h"
+
+//----------------------------------------------------------------------------------------
+#define IFX_EMEMCAPTURE_TILE_SIZE (IFXEMEM_SIZE / 16)  /**<\brief Size of an EMEM tile in bytes */
+
+/** \addtogroup library_srvsw_sysse_general_ememcapture
+ * \{ */
+
+/** \brief Configuration */
+typedef struct
+{
+    const volatile void    *source;        /**<\brief register read at each trigger */
+    IfxDma_ChannelMoveSize  moveSize;      /**<\brief size of a sample */
+    volatile Ifx_SRC_SRCR  *trigger;       /**<\brief service request node of the acquisition driver, routed to the DMA channel */
+    IfxEmem_TileNumber      firstTile;     /**<\brief first EMEM tile of the ring buffer */
+    uint8                   numTiles;      /**<\brief number of EMEM tiles of the ring buffer */
+    uint16                  chunkLength;   /**<\brief number of samples per chunk (DMA transaction), at most 16383 */
+    IfxDma_ChannelId        dmaChannelId;  /**<\brief DMA channel */
+    Ifx_Priority            isrPriority;   /**<\brief priority of the DMA channel interrupt */
+    IfxSrc_Tos              isrProvider;   /**<\brief service provider of the DMA channel interrupt */
+} Ifx_EmemCapture_Config;
+
+/** \brief EMEM capture object */
+typedef struct
+{
+    IfxDma_Dma_Channel dmaChannel;    /**<\brief DMA channel */
+    uint32             start;         /**<\brief address of the ring buffer */
+    uint32             chunkSize;     /**<\brief size of a chunk in bytes */
+    uint32             numChunks;     /**<\brief number of chunks in the ring buffer */
+    uint16             chunkLength;   /**<\brief number of samples per chunk */
+    volatile uint32    written;       /**<\brief number of complete chunks, incremented by the DMA channel interrupt */
+    uint32             read;          /**<\brief number of chunks read out or dropped */
+    uint32             overruns;      /**<\brief number of dropped chunks */
+} Ifx_EmemCapture;
+
+/** \brief Returns the number of complete chunks not read out yet
+ * \param capture Pointer to the EMEM capture object
+ * \return Returns the number of chunks, including the chunks which will be dropped as overrun
+ */
+IFX_INLINE uint32 Ifx_EmemCapture_getCount(const Ifx_EmemCapture *capture)
+{
+    return capture->written - capture->read;
+}
+
+
+/** \brief Returns the oldest complete chunk not read out yet, the chunk stays in place until \ref Ifx_EmemCapture_releaseChunk()
+ *
+ * The chunk shall be released before the DMA wraps on it (numChunks - 1 chunk durations), else it is overwritten.
+ * \param capture Pointer to the EMEM capture object
+ * \param data Returns the address of the chunk
+ * \return Returns the size of the chunk in bytes, 0 if no chunk is complete
+ */
+IFX_EXTERN uint32 Ifx_EmemCapture_getChunk(Ifx_EmemCapture *capture, const void **data);
+
+/** \brief Initialize the EMEM tiles and the DMA channel, the capture is stopped
+ * \param capture Pointer to the EMEM capture object
+ * \param config Pointer to the configuration
+ * \return Returns FALSE if the EMEM is disabled or locked, or if the tiles do not hold two chunks
+ */
+IFX_EXTERN boolean Ifx_EmemCapture_init(Ifx_EmemCapture *capture, const Ifx_EmemCapture_Config *config);
+
+/** \brief Initialize the configuration: 32 bit samples, tiles 0 .. 3, 4096 samples per chunk, DMA channel 0
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_EmemCapture_initConfig(Ifx_EmemCapture_Config *config);
+
+/** \brief Count the complete chunk and prepare the wrap of the ring buffer, to be called from the DMA channel interrupt
+ * \param capture Pointer to the EMEM capture object
+ */
+IFX_EXTERN void Ifx_EmemCapture_onChunkDone(Ifx_EmemCapture *capture);
+
+/** \brief Release the chunk returned by \ref Ifx_EmemCapture_getChunk()
+ * \param capture Pointer to the EMEM capture object
+ */
+IFX_EXTERN void Ifx_EmemCapture_releaseChunk(Ifx_EmemCapture *capture);
+
+/** \brief Start the capture at the beginning of the ring buffer, the previous capture is discarded
+ * \param capture Pointer to the EMEM capture object
+ */
+IFX_EXTERN void Ifx_EmemCapture_start(Ifx_EmemCapture *capture);
+
+/** \brief Stop the capture, the complete chunks can still be read out
+ * \param capture Pointer to the EMEM capture object
+ */
+IFX_EXTERN void Ifx_EmemCapture_stop(Ifx_EmemCapture *capture);
+
+/** \brief Write the complete chunks to a data pipe, and release them
+ * \param capture Pointer to the EMEM capture object
+ * \param io Pointer to the IfxStdIf_DPipe object
+ * \param timeout Timeout per chunk
+ * \return Returns the number of bytes written
+ */
+IFX_EXTERN uint32 Ifx_EmemCapture_stream(Ifx_EmemCapture *capture, IfxStdIf_DPipe *io, Ifx_TickTime timeout);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -0,0 +1,170 @@
+/**
+ * \file Ifx_FlashUpdate.h
+ * \brief Background program flash update
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_general_flashupdate Program flash update
+ * \ingroup library_srvsw_sysse_general
+ *
+ * The flash update programs a new software image into a program flash area while the application is
+ * running. The image is received in chunks of any size (CAN, Ethernet, ...) with \ref Ifx_FlashUpdate_write(),
+ * and programmed by \ref Ifx_FlashUpdate_process(), called from a background task:
+ * - the sectors of the area are erased first, one sector per command, the chunks received meanwhile are
+ * buffered.
+ * - the data is programmed by bursts of IFXFLASH_PFLASH_BURST_LENGTH bytes (8 pages per command) and each
+ * burst is compared with the received data.
+ * - each call issues at most one flash command and returns immediately while the flash is busy.
+ *
+ * On a device with 2 program flash banks, the area is placed in the bank which does not hold the application:
+ * the application and its interrupts keep running from the other bank during the whole update, only the final
+ * switch to the new image (reset into the boot loader / start-up selecting the image) stops it.
+ *
+ * The functions writing the flash commands are executed from the PSPR (\ref IFX_CFG_FLASHUPDATE_CODE), so that
+ * no flash fetch occurs during a command sequence. When the area is in the bank of the application (single
+ * bank device), the PSPR functions additionally wait for the end of each command with the interrupts disabled,
+ * up to the erase time of the largest sector; the watchdogs shall then be serviced accordingly.
+ *
+ * The area addresses shall be non cached (segment 0xA). The functions shall be called by one CPU, outside of
+ * interrupts.
+ *
+ * Usage example:
+ * \code
+ * static Ifx_FlashUpdate flashUpdate;
+ *
+ * // download request: image for the second bank
+ * Ifx_FlashUpdate_Config config;
+ * config.startAddress = IFXFLASH_PFLASH_START + 0x200000;
+ * config.size         = imageSize;
+ * Ifx_FlashUpdate_start(&flashUpdate, &config);
+ *
+ * // reception of a frame, the bytes not accepted are sent again later (flow control)
+ * accepted = Ifx_FlashUpdate_write(&flashUpdate, frame.data, frame.length);
+ *
+ * // end of the download
+ * Ifx_FlashUpdate_finish(&flashUpdate);
+ *
+ * // background loop
+ * Ifx_FlashUpdate_process(&flashUpdate);
+ *
+ * if (Ifx_FlashUpdate_getState(&flashUpdate) == Ifx_FlashUpdate_State_finished)
+ * {
+ *     // switch to the new image
+ * }
+ * \endcode
+ *
+ */
+#ifndef IFX_FLASHUPDATE_H
+#define IFX_FLASHUPDATE_H 1
+
+#include "Cpu/Std/Ifx_Types.h"
+#include "Flash/Std/IfxFlash.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_FLASHUPDATE_BURST_COUNT)
+#define IFX_CFG_FLASHUPDATE_BURST_COUNT (2)                  /**<\brief Number of burst buffers, received data waiting to be programmed */
+#endif
+
+#if !defined(IFX_CFG_FLASHUPDATE_CODE)
+#define IFX_CFG_FLASHUPDATE_CODE        IFX_HOT_CODE_CPU0    /**<\brief Placement of the functions writing the flash commands, in a PSPR */
+#endif
+
+/** \addtogroup library_srvsw_sysse_general_flashupdate
+ * \{ */
+
+/** \brief State of the update */
+typedef enum
+{
+    Ifx_FlashUpdate_State_idle,      /**< \brief no update started */
+    Ifx_FlashUpdate_State_erase,     /**< \brief the sectors of the area are erased */
+    Ifx_FlashUpdate_State_program,   /**< \brief the received data is programmed */
+    Ifx_FlashUpdate_State_finished,  /**< \brief the image is programmed and verified */
+    Ifx_FlashUpdate_State_failed     /**< \brief a flash command failed or the verification failed */
+} Ifx_FlashUpdate_State;
+
+/** \brief Configuration of the update */
+typedef struct
+{
+    uint32 startAddress;  /**< \brief PFlash address of the area, start of a logical sector, segment 0xA */
+    uint32 size;          /**< \brief size of the image in bytes, the area covers the logical sectors up to the end of the image */
+} Ifx_FlashUpdate_Config;
+
+/** \brief Flash update object */
+typedef struct
+{
+    Ifx_FlashUpdate_Config config;                                                                          /**< \brief update area */
+    Ifx_FlashUpdate_State  state;                                                                           /**< \brief state of the update */
+    IfxFlash_FlashType     flashType;                                                                       /**< \brief bank of the area */
+    boolean                sameBank;                                                                        /**< \brief TRUE if the application is executed from the bank of the area */
+    boolean                commandIssued;                                                                   /**< \brief TRUE if the status of the last flash command is not checked yet */
+    boolean                lastChunk;                                                                       /**< \brief TRUE after \ref Ifx_FlashUpdate_finish() */
+    uint32                 eraseAddress;                                                                    /**< \brief next sector to erase */
+    uint32                 programAddress;                                                                  /**< \brief next burst to program */
+    uint32                 receivedSize;                                                                    /**< \brief number of received bytes */
+    uint32                 buffer[IFX_CFG_FLASHUPDATE_BURST_COUNT][IFXFLASH_PFLASH_BURST_LENGTH / 4];      /**< \brief burst buffers */
+    uint8                  bufferHead;                                                                      /**< \brief burst buffer programmed next */
+    uint8                  bufferCount;                                                                     /**< \brief number of full burst buffers */
+    uint16                 bufferFill;                                                                      /**< \brief number of bytes in the burst buffer being received */
+    uint32                 errorCount;                                                                      /**< \brief number of failed flash commands */
+} Ifx_FlashUpdate;
+
+/** \brief Terminate the image, the last partial burst is padded with 0
+ *
+ * The state becomes \ref Ifx_FlashUpdate_State_finished once the buffered data is programmed.
+ * \param update Pointer to the update object
+ */
+IFX_EXTERN void Ifx_FlashUpdate_finish(Ifx_FlashUpdate *update);
+
+/** \brief Returns the state of the update
+ * \param update Pointer to the update object
+ * \return Returns the state of the update
+ */
+IFX_INLINE Ifx_FlashUpdate_State Ifx_FlashUpdate_getState(const Ifx_FlashUpdate *update)
+{
+    return update->state;
+}
+
+
+/** \brief Execute the next step of the erase and program operations
+ *
+ * Called periodically from a background task. Returns immediately while the flash is busy.
+ * \param update Pointer to the update object
+ */
+IFX_EXTERN void Ifx_FlashUpdate_process(Ifx_FlashUpdate *update);
+
+/** \brief Start an update, the area is erased by \ref Ifx_FlashUpdate_process()
+ * \param update Pointer to the update object
+ * \param config Configuration of the update area
+ * \return Returns FALSE if the area is not in the program flash, or contains this service
+ */
+IFX_EXTERN boolean Ifx_FlashUpdate_start(Ifx_FlashUpdate *update, const Ifx_FlashUpdate_Config *config);
+
+/** \brief Copy a chunk of the image into the burst buffers
+ *
+ * The chunks can be written during the erase. When the burst buffers are full, only a part of the chunk is
+ * accepted, the remaining bytes shall be written again after \ref Ifx_FlashUpdate_process() programmed a burst.
+ * \param update Pointer to the update object
+ * \param data Chunk data
+ * \param length Chunk length in bytes
+ * \return Returns the number of accepted bytes
+ */
+IFX_EXTERN uint32 Ifx_FlashUpdate_write(Ifx_FlashUpdate *update, const void *data, uint32 length);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
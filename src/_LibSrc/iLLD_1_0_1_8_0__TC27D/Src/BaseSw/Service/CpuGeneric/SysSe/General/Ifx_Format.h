@@ -0,0 +1,225 @@
+/**
+ * \file Ifx_Format.h
+ * \brief Number formatting and parsing without printf / scanf
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_general_format Number formatting and parsing
+ * \ingroup library_srvsw_sysse_general
+ *
+ * vsprintf() and sscanf() of the C library interpret the format string at run time, pull the floating point
+ * support in and need several hundred bytes of stack. This module formats the numbers with typed functions
+ * instead: a line is built piece by piece into a caller buffer, without varargs and without float64 arithmetic
+ * for the float32 values.
+ *
+ * The buffer is always NUL terminated. The text which does not fit is dropped and \ref Ifx_Format.overflow is set,
+ * the functions never write outside of the buffer.
+ *
+ * The widths are minimal field widths, the values are right aligned with spaces as with "%*u". The precision is
+ * the number of fractional digits, limited to \ref IFX_FORMAT_MAX_PRECISION. The float32 values with a
+ * magnitude of 2^32 or more are printed as "ovf", the infinities as "inf" and "-inf", NaN as "nan".
+ *
+ * The parse functions convert the beginning of a text and return the pointer to the first character not
+ * converted, or NULL_PTR if the text does not start with a number. They accept the syntax of strtoull(),
+ * strtoll() and strtod(), except the leading white spaces, "inf" and "nan".
+ *
+ * Usage example:
+ * \code
+ * char       text[32];
+ * Ifx_Format fmt;
+ *
+ * Ifx_Format_init(&fmt, text, sizeof(text));
+ * Ifx_Format_string(&fmt, "CPU0 Load ");
+ * Ifx_Format_float32(&fmt, load, 0, 3);
+ * Ifx_Format_string(&fmt, " %");
+ * Ifx_Console_printFormat(&fmt);               // same text as Ifx_Console_print("CPU0 Load %.3f %%", load)
+ *
+ * float32 gain;
+ * if (Ifx_Format_parseFloat32(args, &gain) != NULL_PTR)
+ * {}
+ * \endcode
+ *
+ */
+#ifndef IFX_FORMAT_H
+#define IFX_FORMAT_H 1
+
+#include "Cpu/Std/Ifx_Types.h"
+#include "StdIf/IfxStdIf_DPipe.h"
+
+//----------------------------------------------------------------------------------------
+/** \brief Maximal number of fractional digits, 10^precision shall fit in an uint32 */
+#define IFX_FORMAT_MAX_PRECISION (9)
+
+/** \addtogroup library_srvsw_sysse_general_format
+ * \{ */
+
+/** \brief Text builder object */
+typedef struct
+{
+    char     *buffer;         /**<\brief caller buffer, NUL terminated */
+    Ifx_SizeT size;           /**<\brief size of the buffer in bytes, including the NUL character */
+    Ifx_SizeT length;         /**<\brief number of characters in the buffer */
+    boolean   overflow;       /**<\brief TRUE if characters were dropped because the buffer is full */
+} Ifx_Format;
+
+/** \brief Initialize the builder with an empty text
+ * \param fmt Pointer to the builder object
+ * \param buffer Buffer receiving the text
+ * \param size Size of the buffer in bytes, at least 1
+ */
+IFX_EXTERN void Ifx_Format_init(Ifx_Format *fmt, char *buffer, Ifx_SizeT size);
+
+/** \brief Empty the text, the buffer is reused for the next line
+ * \param fmt Pointer to the builder object
+ */
+IFX_INLINE void Ifx_Format_clear(Ifx_Format *fmt)
+{
+    fmt->length    = 0;
+    fmt->overflow  = FALSE;
+    fmt->buffer[0] = '\0';
+}
+
+
+/** \brief Return the NUL terminated text
+ * \param fmt Pointer to the builder object
+ */
+IFX_INLINE pchar Ifx_Format_getText(const Ifx_Format *fmt)
+{
+    return fmt->buffer;
+}
+
+
+/** \brief Return the number of characters of the text
+ * \param fmt Pointer to the builder object
+ */
+IFX_INLINE Ifx_SizeT Ifx_Format_getLength(const Ifx_Format *fmt)
+{
+    return fmt->length;
+}
+
+
+/** \brief Append a character
+ * \param fmt Pointer to the builder object
+ * \param c Character
+ */
+IFX_EXTERN void Ifx_Format_char(Ifx_Format *fmt, char c);
+
+/** \brief Append a NUL terminated string, as "%s"
+ * \param fmt Pointer to the builder object
+ * \param text String
+ */
+IFX_EXTERN void Ifx_Format_string(Ifx_Format *fmt, pchar text);
+
+/** \brief Append an unsigned decimal value, as "%*u"
+ * \param fmt Pointer to the builder object
+ * \param value Value
+ * \param width Minimal field width
+ */
+IFX_EXTERN void Ifx_Format_uint32(Ifx_Format *fmt, uint32 value, uint8 width);
+
+/** \brief Append a signed decimal value, as "%*d"
+ * \param fmt Pointer to the builder object
+ * \param value Value
+ * \param width Minimal field width, including the sign
+ */
+IFX_EXTERN void Ifx_Format_sint32(Ifx_Format *fmt, sint32 value, uint8 width);
+
+/** \brief Append an unsigned decimal 64 bit value, as "%*llu"
+ * \param fmt Pointer to the builder object
+ * \param value Value
+ * \param width Minimal field width
+ */
+IFX_EXTERN void Ifx_Format_uint64(Ifx_Format *fmt, uint64 value, uint8 width);
+
+/** \brief Append an hexadecimal value with upper case digits, as "%0*X"
+ * \param fmt Pointer to the builder object
+ * \param value Value
+ * \param digits Minimal number of digits, padded with zeros
+ */
+IFX_EXTERN void Ifx_Format_hex32(Ifx_Format *fmt, uint32 value, uint8 digits);
+
+/** \brief Append a float32 value, as "%*.*f"
+ *
+ * The value is rounded to the nearest at the last digit, the ties away from zero.
+ * The computation is done in float32 and uint32.
+ * \param fmt Pointer to the builder object
+ * \param value Value
+ * \param width Minimal field width, including the sign and the decimal point
+ * \param precision Number of fractional digits, 0 for no decimal point
+ */
+IFX_EXTERN void Ifx_Format_float32(Ifx_Format *fmt, float32 value, uint8 width, uint8 precision);
+
+/** \brief Append a signed fixed point value, as "%*.*f" of value / 2^fractionBits
+ *
+ * The value is rounded to the nearest at the last digit, the ties away from zero.
+ * The computation is done in integer arithmetic only.
+ * \param fmt Pointer to the builder object
+ * \param value Fixed point value, e.g. Q15 or Q16.16
+ * \param fractionBits Number of fractional bits of the value, 0..31
+ * \param width Minimal field width, including the sign and the decimal point
+ * \param precision Number of fractional digits, 0 for no decimal point
+ */
+IFX_EXTERN void Ifx_Format_fixed(Ifx_Format *fmt, sint32 value, uint8 fractionBits, uint8 width, uint8 precision);
+
+/** \brief Write the text to a standard interface
+ * \param fmt Pointer to the builder object
+ * \param io Standard interface
+ * \return Returns the result of \ref IfxStdIf_DPipe_write(), TRUE if the text is empty or the output disabled
+ */
+IFX_EXTERN boolean Ifx_Format_write(const Ifx_Format *fmt, IfxStdIf_DPipe *io);
+
+/** \brief Convert an unsigned integer, as strtoull() with the base 10 or 16
+ *
+ * The prefix "0x" or "0X" selects the hexadecimal base.
+ * \param text Text starting with the number
+ * \param value Converted value, 0 if the text does not start with a number
+ * \param hex If TRUE, the digits are hexadecimal also without prefix
+ * \return Returns the pointer after the number, NULL_PTR if there is no digit or the value overflows
+ */
+IFX_EXTERN pchar Ifx_Format_parseUInt64(pchar text, uint64 *value, boolean hex);
+
+/** \brief Convert a signed decimal integer with optional sign, as strtoll() with the base 10
+ * \param text Text starting with the number
+ * \param value Converted value, 0 if the text does not start with a number
+ * \return Returns the pointer after the number, NULL_PTR if there is no digit or the value overflows
+ */
+IFX_EXTERN pchar Ifx_Format_parseSInt64(pchar text, sint64 *value);
+
+/** \brief Convert a decimal floating point number, as strtod()
+ *
+ * Accepted syntax: [+|-]digits[.digits][(e|E)[+|-]digits], the integer or the fractional digits may be omitted.
+ * The 19 first significant digits are taken into account.
+ * \param text Text starting with the number
+ * \param value Converted value, 0 if the text does not start with a number
+ * \return Returns the pointer after the number, NULL_PTR if there is no digit
+ */
+IFX_EXTERN pchar Ifx_Format_parseFloat64(pchar text, float64 *value);
+
+/** \brief Convert a decimal floating point number, as strtof()
+ *
+ * Same syntax as \ref Ifx_Format_parseFloat64(). The 9 first significant digits are taken into account and the
+ * computation is done in float32, the result is within a few LSB of the correctly rounded value.
+ * \param text Text starting with the number
+ * \param value Converted value, 0 if the text does not start with a number
+ * \return Returns the pointer after the number, NULL_PTR if there is no digit
+ */
+IFX_EXTERN pchar Ifx_Format_parseFloat32(pchar text, float32 *value);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -23,6 +23,9 @@
  */
 
 #include "Ifx_GlobalResources.h"
+#include "SysSe/Bsp/Bsp.h"
+#include "SysSe/Comm/Ifx_Shell.h"
+#include "_Utilities/Ifx_Assert.h"
 /** \brief Global resource object */
 typedef struct
 {
@@ -30,10 +33,142 @@ typedef struct
     sint32                          size;   /**< \brief Size of the global resource table */
 } Ifx_GlobalResources;
 
+/** \brief DMA resource object */
+typedef struct
+{
+    Ifx_GlobalResources_DmaEntry entries[IFX_CFG_GLOBAL_RESOURCES_DMA_MAX_ITEMS]; /**< \brief Allocated resources and statistics */
+    sint32                       size;                                           /**< \brief Number of items in the DMA table */
+} Ifx_GlobalResourcesDma;
+
+#if IFX_CFG_GLOBAL_RESOURCES_ENABLED
+
+Ifx_GlobalResources    ifx_GlobalResource;
+Ifx_GlobalResourcesDma ifx_GlobalResourceDma;
+
+/** \brief First channel of each class, the last entry is the number of channels */
+static const sint16    Ifx_GlobalResources_dmaChannelRange[4] = {
+    0, IFX_CFG_GLOBAL_RESOURCES_DMA_NORMAL_CHANNEL, IFX_CFG_GLOBAL_RESOURCES_DMA_REALTIME_CHANNEL, IFXDMA_NUM_CHANNELS
+};
+
+/** \brief First interrupt priority of each class, the last entry is the number of priorities */
+static const sint16    Ifx_GlobalResources_priorityRange[4] = {
+    1, IFX_CFG_GLOBAL_RESOURCES_NORMAL_PRIORITY, IFX_CFG_GLOBAL_RESOURCES_REALTIME_PRIORITY, 256
+};
+
+/** \brief Return TRUE if the value is already allocated to an entry of the DMA table
+ * \param count number of entries to check
+ * \param value channel or priority
+ * \param priority TRUE to compare the priorities of the same service provider, FALSE to compare the channels
+ * \param typeOfService service provider of the priority
+ */
+static boolean Ifx_GlobalResources_isDmaAllocated(sint32 count, sint16 value, boolean priority, IfxSrc_Tos typeOfService)
+{
+    boolean result = FALSE;
+    sint32  i;
+
+    for (i = 0; i < count; i++)
+    {
+        const Ifx_GlobalResources_DmaEntry *entry = &ifx_GlobalResourceDma.entries[i];
+
+        if (priority != FALSE)
+        {
+            result |= (entry->priority == value) && (entry->item->typeOfService == typeOfService);
+        }
+        else
+        {
+            result |= (entry->channel == value);
+        }
+    }
+
+    return result;
+}
+
+
+/** \brief Allocate a channel or priority of an item
+ * \param count number of entries in the DMA table, the entry of the item is not yet allocated
+ * \param item table item
+ * \param request requested value, IFX_GLOBALRESOURCES_AUTO or IFX_GLOBALRESOURCES_NONE
+ * \param range class ranges, Ifx_GlobalResources_dmaChannelRange or Ifx_GlobalResources_priorityRange
+ * \param priority TRUE for a priority, FALSE for a channel
+ * \return allocated value, IFX_GLOBALRESOURCES_AUTO in case of conflict
+ */
+static sint16 Ifx_GlobalResources_allocateDma(sint32 count, const Ifx_GlobalResources_DmaItem *item, sint16 request, const sint16 *range, boolean priority)
+{
+    sint16 first  = range[item->dmaClass];
+    sint16 last   = range[item->dmaClass + 1] - 1;
+    sint16 result = IFX_GLOBALRESOURCES_AUTO;
+    sint16 value;
+
+    if (request == IFX_GLOBALRESOURCES_NONE)
+    {
+        result = IFX_GLOBALRESOURCES_NONE;
+    }
+    else if (request == IFX_GLOBALRESOURCES_AUTO)
+    {
+        /* From the top of the class range */
+        for (value = last; (value >= first) && (result == IFX_GLOBALRESOURCES_AUTO); value--)
+        {
+            if (Ifx_GlobalResources_isDmaAllocated(count, value, priority, item->typeOfService) == FALSE)
+            {
+                result = value;
+            }
+        }
+    }
+    else if ((request >= first) && (request <= last)
+             && (Ifx_GlobalResources_isDmaAllocated(count, request, priority, item->typeOfService) == FALSE))
+    {
+        result = request;
+    }
+    else
+    {}
+
+    return result;
+}
+
+
+#endif
+
+void Ifx_GlobalResources_dmaTransactionFinished(sint32 id, uint32 transfers)
+{
 #if IFX_CFG_GLOBAL_RESOURCES_ENABLED
 
-Ifx_GlobalResources ifx_GlobalResource;
+    if ((id >= 0) && (id < ifx_GlobalResourceDma.size))
+    {
+        Ifx_GlobalResources_DmaEntry *entry = &ifx_GlobalResourceDma.entries[id];
+
+        entry->transactions++;
+        entry->transfers += transfers;
+
+        if (entry->startTime != 0)
+        {
+            Ifx_TickTime busyTime = now() - entry->startTime;
+
+            entry->busyTime += busyTime;
+            entry->startTime = 0;
+
+            if (busyTime > entry->maxBusyTime)
+            {
+                entry->maxBusyTime = busyTime;
+            }
+        }
+    }
+
 #endif
+}
+
+
+void Ifx_GlobalResources_dmaTransactionStarted(sint32 id)
+{
+#if IFX_CFG_GLOBAL_RESOURCES_ENABLED
+
+    if ((id >= 0) && (id < ifx_GlobalResourceDma.size))
+    {
+        ifx_GlobalResourceDma.entries[id].startTime = now();
+    }
+
+#endif
+}
+
 
 void *Ifx_GlobalResources_get(sint32 id)
 {
@@ -59,6 +194,39 @@ void *Ifx_GlobalResources_get(sint32 id)
 }
 
 
+sint16 Ifx_GlobalResources_getDmaChannel(sint32 id)
+{
+    const Ifx_GlobalResources_DmaEntry *entry = Ifx_GlobalResources_getDmaEntry(id);
+
+    return (entry != NULL_PTR) ? entry->channel : IFX_GLOBALRESOURCES_NONE;
+}
+
+
+const Ifx_GlobalResources_DmaEntry *Ifx_GlobalResources_getDmaEntry(sint32 id)
+{
+    const Ifx_GlobalResources_DmaEntry *result = NULL_PTR;
+
+#if IFX_CFG_GLOBAL_RESOURCES_ENABLED
+
+    if ((id >= 0) && (id < ifx_GlobalResourceDma.size))
+    {
+        result = &ifx_GlobalResourceDma.entries[id];
+    }
+
+#endif
+
+    return result;
+}
+
+
+Ifx_Priority Ifx_GlobalResources_getDmaPriority(sint32 id)
+{
+    const Ifx_GlobalResources_DmaEntry *entry = Ifx_GlobalResources_getDmaEntry(id);
+
+    return ((entry != NULL_PTR) && (entry->priority > 0)) ? (Ifx_Priority)entry->priority : 0;
+}
+
+
 sint32 Ifx_GlobalResources_getIndex(void *resource)
 {
     sint32 id = -1;
@@ -146,3 +314,125 @@ boolean Ifx_GlobalResources_init(const Ifx_GlobalResources_Item *table, uint32 s
 
     return result;
 }
+
+
+boolean Ifx_GlobalResources_initDma(const Ifx_GlobalResources_DmaItem *table, uint32 size)
+{
+    boolean result = TRUE;
+
+#if IFX_CFG_GLOBAL_RESOURCES_ENABLED
+    sint32  count  = (sint32)size;
+    sint32  i;
+    sint32  pass;
+
+    ifx_GlobalResourceDma.size = 0;
+
+    if (count > IFX_CFG_GLOBAL_RESOURCES_DMA_MAX_ITEMS)
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+        result = FALSE;
+    }
+    else
+    {
+        for (i = 0; i < count; i++)
+        {
+            ifx_GlobalResourceDma.entries[i].item     = &table[i];
+            ifx_GlobalResourceDma.entries[i].channel  = IFX_GLOBALRESOURCES_NONE;
+            ifx_GlobalResourceDma.entries[i].priority = IFX_GLOBALRESOURCES_NONE;
+        }
+
+        /* Fixed values first, then the automatic ones in the remaining space of the class */
+        for (pass = 0; pass < 2; pass++)
+        {
+            boolean automatic = (pass != 0);
+
+            for (i = 0; i < count; i++)
+            {
+                Ifx_GlobalResources_DmaEntry *entry = &ifx_GlobalResourceDma.entries[i];
+                sint16                        value;
+
+                if ((table[i].channel == IFX_GLOBALRESOURCES_AUTO) == automatic)
+                {
+                    value          = Ifx_GlobalResources_allocateDma(count, &table[i], table[i].channel, Ifx_GlobalResources_dmaChannelRange, FALSE);
+                    result        &= (value != IFX_GLOBALRESOURCES_AUTO);
+                    entry->channel = (value != IFX_GLOBALRESOURCES_AUTO) ? value : IFX_GLOBALRESOURCES_NONE;
+                }
+
+                if ((table[i].priority == IFX_GLOBALRESOURCES_AUTO) == automatic)
+                {
+                    value           = Ifx_GlobalResources_allocateDma(count, &table[i], table[i].priority, Ifx_GlobalResources_priorityRange, TRUE);
+                    result         &= (value != IFX_GLOBALRESOURCES_AUTO);
+                    entry->priority = (value != IFX_GLOBALRESOURCES_AUTO) ? value : IFX_GLOBALRESOURCES_NONE;
+                }
+            }
+        }
+
+        /* Conflict: used twice, outside of the class range or class range exhausted */
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, result != FALSE);
+
+        ifx_GlobalResourceDma.size = count;
+        Ifx_GlobalResources_resetDmaStatistics();
+    }
+
+#else
+    result = FALSE;
+
+#endif
+
+    return result;
+}
+
+
+void Ifx_GlobalResources_resetDmaStatistics(void)
+{
+#if IFX_CFG_GLOBAL_RESOURCES_ENABLED
+    sint32 i;
+
+    for (i = 0; i < ifx_GlobalResourceDma.size; i++)
+    {
+        Ifx_GlobalResources_DmaEntry *entry = &ifx_GlobalResourceDma.entries[i];
+        boolean                       interruptState = IfxCpu_disableInterrupts();
+
+        entry->transactions = 0;
+        entry->transfers    = 0;
+        entry->busyTime     = 0;
+        entry->maxBusyTime  = 0;
+        entry->startTime    = 0;
+        IfxCpu_restoreInterrupts(interruptState);
+    }
+
+#endif
+}
+
+
+boolean Ifx_GlobalResources_showDma(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    sint32 i;
+
+    (void)data;
+
+    IfxStdIf_DPipe_print(io, "Busy time in STM ticks"ENDL);
+    IfxStdIf_DPipe_print(io, "%-16s %5s %4s %4s %10s %10s %12s %10s"ENDL, "name", "class", "ch", "prio", "trans", "transfers", "busy", "max");
+
+    for (i = 0; Ifx_GlobalResources_getDmaEntry(i) != NULL_PTR; i++)
+    {
+        Ifx_GlobalResources_DmaEntry entry;
+        boolean                      interruptState;
+
+        /* Consistent copy, the entry is updated by the interrupt */
+        interruptState = IfxCpu_disableInterrupts();
+        entry          = *Ifx_GlobalResources_getDmaEntry(i);
+        IfxCpu_restoreInterrupts(interruptState);
+
+        IfxStdIf_DPipe_print(io, "%-16s %5d %4d %4d %10u %10u %12u %10u"ENDL,
+            entry.item->name, entry.item->dmaClass, entry.channel, entry.priority,
+            entry.transactions, entry.transfers, (uint32)entry.busyTime, (uint32)entry.maxBusyTime);
+    }
+
+    if (Ifx_Shell_matchToken(&args, "reset") != FALSE)
+    {
+        Ifx_GlobalResources_resetDmaStatistics();
+    }
+
+    return TRUE;
+}
@@ -0,0 +1,140 @@
+/**
+ * \file Ifx_InitTable.h
+ * \brief Initialization table with dependencies and deferred steps
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_general_inittable Initialization table
+ * \ingroup library_srvsw_sysse_general
+ *
+ * The initialization table lists the peripheral initializations of the application with their dependencies,
+ * so that the time critical peripherals are available early after reset and the slow ones (VADC calibration,
+ * ETH PHY auto-negotiation, ...) are initialized in the background:
+ * - \ref Ifx_InitTable_runCritical() executes the entries which are not deferred, in table order as soon as
+ * their dependencies are done. It returns once they are all done or failed.
+ * - \ref Ifx_InitTable_process() calls once each ready deferred entry. It is called from the background loop
+ * until \ref Ifx_InitTable_isDone() returns TRUE.
+ *
+ * An entry function returns Ifx_InitTable_Status_busy to be called again later instead of waiting, e.g. while
+ * the VADC calibration is running. The dependencies are given as a bit mask of entry indexes; an entry whose
+ * dependency failed is not executed and fails too. A critical entry shall only depend on critical entries.
+ *
+ * The table is processed by one CPU. The completion time of each entry since \ref Ifx_InitTable_init() is
+ * recorded, to check the startup time budget.
+ *
+ * Usage example:
+ * \code
+ * enum {INIT_CLOCK, INIT_CAN, INIT_VADC, INIT_ETH};
+ *
+ * static const Ifx_InitTable_Entry initEntries[] = {
+ *     // function,     data,     dependencies,           deferred
+ *     {&initGtmClock,  NULL_PTR, 0,                       FALSE},
+ *     {&initCan,       NULL_PTR, 0,                       FALSE},
+ *     {&initVadc,      NULL_PTR, (1 << INIT_CLOCK),       TRUE },   // returns busy until the calibration is done
+ *     {&initEth,       NULL_PTR, (1 << INIT_CAN),         TRUE },   // returns busy until the PHY link is up
+ * };
+ *
+ * static Ifx_InitTable initTable;
+ *
+ * // core0_main()
+ * Ifx_InitTable_init(&initTable, initEntries, Ifx_COUNTOF(initEntries));
+ * Ifx_InitTable_runCritical(&initTable);
+ * sendFirstCanFrame();
+ *
+ * while (TRUE)
+ * {
+ *     Ifx_InitTable_process(&initTable);
+ *     ...
+ * }
+ * \endcode
+ *
+ */
+#ifndef IFX_INITTABLE_H
+#define IFX_INITTABLE_H 1
+
+#include "SysSe/Bsp/Bsp.h"
+
+//----------------------------------------------------------------------------------------
+#define IFX_INITTABLE_MAX_ENTRIES (32)  /**<\brief Maximal number of entries, limited by the dependency mask */
+
+/** \addtogroup library_srvsw_sysse_general_inittable
+ * \{ */
+
+/** \brief Result of an entry function */
+typedef enum
+{
+    Ifx_InitTable_Status_done   = 0,  /**<\brief initialization done */
+    Ifx_InitTable_Status_busy   = 1,  /**<\brief initialization in progress, the function is called again */
+    Ifx_InitTable_Status_failed = 2   /**<\brief initialization failed, the dependent entries are not executed */
+} Ifx_InitTable_Status;
+
+/** \brief Entry function
+ * \param data Entry data
+ * \return Returns the status of the initialization
+ */
+typedef Ifx_InitTable_Status (*Ifx_InitTable_Function)(void *data);
+
+/** \brief Table entry */
+typedef struct
+{
+    Ifx_InitTable_Function function;      /**<\brief initialization function */
+    void                  *data;          /**<\brief function data */
+    uint32                 dependencies;  /**<\brief bit n set if the entry n shall be done before */
+    boolean                deferred;      /**<\brief TRUE if executed by Ifx_InitTable_process(), FALSE if by Ifx_InitTable_runCritical() */
+} Ifx_InitTable_Entry;
+
+/** \brief Table object */
+typedef struct
+{
+    const Ifx_InitTable_Entry *entries;                              /**<\brief entries */
+    uint8                      count;                                /**<\brief number of entries */
+    uint32                     doneMask;                             /**<\brief bit n set if the entry n is done */
+    uint32                     failedMask;                           /**<\brief bit n set if the entry n failed or one of its dependencies */
+    Ifx_TickTime               start;                                /**<\brief time of Ifx_InitTable_init() */
+    Ifx_TickTime               doneTime[IFX_INITTABLE_MAX_ENTRIES];  /**<\brief completion time of each entry since start */
+} Ifx_InitTable;
+
+/** \brief Initialize the table object
+ * \param table Pointer to the table object
+ * \param entries Pointer to the entries, must stay valid
+ * \param count Number of entries, up to \ref IFX_INITTABLE_MAX_ENTRIES
+ * \return Returns FALSE if the count is too large, an entry depends on itself or on a missing entry, or a critical
+ * entry depends on a deferred entry
+ */
+IFX_EXTERN boolean Ifx_InitTable_init(Ifx_InitTable *table, const Ifx_InitTable_Entry *entries, uint8 count);
+
+/** \brief Returns TRUE if all the entries are done or failed
+ * \param table Pointer to the table object
+ */
+IFX_EXTERN boolean Ifx_InitTable_isDone(Ifx_InitTable *table);
+
+/** \brief Call once each deferred entry whose dependencies are done
+ * \param table Pointer to the table object
+ * \return Returns TRUE if all the entries are done or failed
+ */
+IFX_EXTERN boolean Ifx_InitTable_process(Ifx_InitTable *table);
+
+/** \brief Execute the critical entries until they are all done or failed
+ * \param table Pointer to the table object
+ * \return Returns TRUE if all the critical entries are done
+ */
+IFX_EXTERN boolean Ifx_InitTable_runCritical(Ifx_InitTable *table);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
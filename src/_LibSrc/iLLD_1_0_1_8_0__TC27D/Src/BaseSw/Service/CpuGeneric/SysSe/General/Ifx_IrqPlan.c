@@ -0,0 +1,134 @@
+/**
+ * \file Ifx_IrqPlan.c
+ * \brief Central interrupt routing and priority plan
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_IrqPlan.h"
+
+/** \brief Validate entry index against the previous entries */
+static Ifx_IrqPlan_Status Ifx_IrqPlan_validateEntry(const Ifx_IrqPlan_Entry *plan, uint32 index)
+{
+    const Ifx_IrqPlan_Entry *entry = &plan[index];
+    uint32                   i;
+
+    if ((entry->priority == 0) || (entry->priority > 255))
+    {
+        return Ifx_IrqPlan_Status_invalidPriority;
+    }
+
+    if (entry->handler != NULL_PTR)
+    {
+#if defined(IFX_USE_SW_MANAGED_INT)
+
+        if (entry->provider == IfxSrc_Tos_dma)
+        {
+            return Ifx_IrqPlan_Status_handlerNotSupported;
+        }
+
+#else
+        return Ifx_IrqPlan_Status_handlerNotSupported;
+#endif
+    }
+
+    for (i = 0; i < index; i++)
+    {
+        const Ifx_IrqPlan_Entry *other = &plan[i];
+
+        if (other->src == entry->src)
+        {
+            return Ifx_IrqPlan_Status_duplicateNode;
+        }
+
+        if (other->priority == entry->priority)
+        {
+            /* Same provider, or two handlers in the software vector table shared by the CPUs */
+            if ((other->provider == entry->provider) || ((other->handler != NULL_PTR) && (entry->handler != NULL_PTR)))
+            {
+                return Ifx_IrqPlan_Status_duplicatePriority;
+            }
+        }
+    }
+
+    return Ifx_IrqPlan_Status_ok;
+}
+
+
+Ifx_IrqPlan_Status Ifx_IrqPlan_apply(const Ifx_IrqPlan_Entry *plan, uint32 count, uint32 *failedIndex)
+{
+    Ifx_IrqPlan_Status status = Ifx_IrqPlan_validate(plan, count, failedIndex);
+    uint32             i;
+
+    if (status == Ifx_IrqPlan_Status_ok)
+    {
+        for (i = 0; i < count; i++)
+        {
+            const Ifx_IrqPlan_Entry *entry = &plan[i];
+
+#if defined(IFX_USE_SW_MANAGED_INT)
+
+            if (entry->handler != NULL_PTR)
+            {
+                IfxCpu_Irq_installInterruptHandler((void *)entry->handler, entry->priority);
+            }
+
+#endif
+            IfxSrc_init(entry->src, entry->provider, entry->priority);
+            IfxSrc_enable(entry->src);
+        }
+    }
+
+    return status;
+}
+
+
+const Ifx_IrqPlan_Entry *Ifx_IrqPlan_find(const Ifx_IrqPlan_Entry *plan, uint32 count, volatile Ifx_SRC_SRCR *src)
+{
+    uint32 i;
+
+    for (i = 0; i < count; i++)
+    {
+        if (plan[i].src == src)
+        {
+            return &plan[i];
+        }
+    }
+
+    return NULL_PTR;
+}
+
+
+Ifx_IrqPlan_Status Ifx_IrqPlan_validate(const Ifx_IrqPlan_Entry *plan, uint32 count, uint32 *failedIndex)
+{
+    Ifx_IrqPlan_Status status = Ifx_IrqPlan_Status_ok;
+    uint32             i;
+
+    for (i = 0; (i < count) && (status == Ifx_IrqPlan_Status_ok); i++)
+    {
+        status = Ifx_IrqPlan_validateEntry(plan, i);
+
+        if ((status != Ifx_IrqPlan_Status_ok) && (failedIndex != NULL_PTR))
+        {
+            *failedIndex = i;
+        }
+    }
+
+    return status;
+}
@@ -0,0 +1,118 @@
+/**
+ * \file Ifx_IrqPlan.h
+ * \brief Central interrupt routing and priority plan
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_general_irqplan Interrupt plan
+ * \ingroup library_srvsw_sysse_general
+ *
+ * The interrupt plan is one table of the application assigning to each service request node its service
+ * provider (CPU or DMA), its priority and optionally its handler. Moving an interrupt to another CPU or changing
+ * its priority is a change of the table only.
+ *
+ * \ref Ifx_IrqPlan_apply() validates the table, installs the handlers and initialises and enables the service
+ * request nodes. It is called after the drivers are initialised, the plan overrides the provider and priority
+ * set by the drivers. The drivers configuration can also be taken from the plan with \ref Ifx_IrqPlan_find().
+ *
+ * Validation rules:
+ * - the priority is in [1, 255]
+ * - a priority is used only once per service provider (for the DMA, the priority is the channel)
+ * - a node is planned only once
+ * - handlers are installed with IfxCpu_Irq_installInterruptHandler() and require IFX_USE_SW_MANAGED_INT. The
+ * software vector table is shared by the CPUs, the priority of an entry with handler is unique over all
+ * CPUs. Without handler, the service routine is defined with IFX_INTERRUPT() and the same priority.
+ *
+ * Usage example:
+ * \code
+ * static const Ifx_IrqPlan_Entry irqPlan[] = {
+ *     // node                                  provider         prio handler      name
+ *     {&MODULE_SRC.STM.STM[0].SR[0],           IfxSrc_Tos_cpu0, 40,  &stm0Isr,    "stm0"},
+ *     {&MODULE_SRC.ASCLIN.ASCLIN[0].RX,        IfxSrc_Tos_cpu1, 4,   &asc0RxIsr,  "asc0rx"},
+ *     {&MODULE_SRC.ASCLIN.ASCLIN[0].TX,        IfxSrc_Tos_cpu1, 5,   &asc0TxIsr,  "asc0tx"},
+ *     {&MODULE_SRC.VADC.G[0].SR0,              IfxSrc_Tos_dma,  12,  NULL_PTR,    "vadc0"},
+ * };
+ *
+ * uint32 failed;
+ * if (Ifx_IrqPlan_apply(irqPlan, sizeof(irqPlan) / sizeof(irqPlan[0]), &failed) != Ifx_IrqPlan_Status_ok)
+ * {
+ *     // irqPlan[failed] is invalid
+ * }
+ * \endcode
+ *
+ */
+#ifndef IFX_IRQPLAN_H
+#define IFX_IRQPLAN_H 1
+
+#include "Cpu/Irq/IfxCpu_Irq.h"
+#include "Src/Std/IfxSrc.h"
+
+/** \addtogroup library_srvsw_sysse_general_irqplan
+ * \{ */
+
+/** \brief Interrupt handler installed by the plan */
+typedef void (*Ifx_IrqPlan_Handler)(void);
+
+/** \brief Interrupt of the plan */
+typedef struct
+{
+    volatile Ifx_SRC_SRCR *src;       /**<\brief service request node */
+    IfxSrc_Tos             provider;  /**<\brief service provider */
+    Ifx_Priority           priority;  /**<\brief priority, DMA channel for the DMA */
+    Ifx_IrqPlan_Handler    handler;   /**<\brief handler installed for the priority, NULL_PTR if defined with IFX_INTERRUPT() or for the DMA */
+    pchar                  name;      /**<\brief name, for diagnostic */
+} Ifx_IrqPlan_Entry;
+
+/** \brief Result of the validation */
+typedef enum
+{
+    Ifx_IrqPlan_Status_ok                  = 0, /**<\brief the plan is valid */
+    Ifx_IrqPlan_Status_invalidPriority     = 1, /**<\brief priority not in [1, 255] */
+    Ifx_IrqPlan_Status_duplicatePriority   = 2, /**<\brief priority already used by the provider, or by a handler of another CPU */
+    Ifx_IrqPlan_Status_duplicateNode       = 3, /**<\brief service request node already planned */
+    Ifx_IrqPlan_Status_handlerNotSupported = 4  /**<\brief handler for the DMA, or without IFX_USE_SW_MANAGED_INT */
+} Ifx_IrqPlan_Status;
+
+/** \brief Validate the plan, install the handlers, initialise and enable the service request nodes
+ * Nothing is changed if the plan is not valid
+ * \param plan Plan
+ * \param count Number of entries
+ * \param failedIndex Index of the first invalid entry, not modified if the plan is valid. May be NULL_PTR
+ * \return Returns the result of the validation
+ */
+IFX_EXTERN Ifx_IrqPlan_Status Ifx_IrqPlan_apply(const Ifx_IrqPlan_Entry *plan, uint32 count, uint32 *failedIndex);
+
+/** \brief Returns the entry of a service request node
+ * \param plan Plan
+ * \param count Number of entries
+ * \param src Service request node
+ * \return Returns the entry, NULL_PTR if the node is not planned
+ */
+IFX_EXTERN const Ifx_IrqPlan_Entry *Ifx_IrqPlan_find(const Ifx_IrqPlan_Entry *plan, uint32 count, volatile Ifx_SRC_SRCR *src);
+
+/** \brief Validate the plan, see \ref library_srvsw_sysse_general_irqplan for the rules
+ * \param plan Plan
+ * \param count Number of entries
+ * \param failedIndex Index of the first invalid entry, not modified if the plan is valid. May be NULL_PTR
+ * \return Returns the result of the validation
+ */
+IFX_EXTERN Ifx_IrqPlan_Status Ifx_IrqPlan_validate(const Ifx_IrqPlan_Entry *plan, uint32 count, uint32 *failedIndex);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -0,0 +1,255 @@
+/**
+ * \file Ifx_Os.c
+ * \brief OS abstraction and task instrumentation
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_Os.h"
+#include "SysSe/Comm/Ifx_Shell.h"
+#include "_Utilities/Ifx_Assert.h"
+
+Ifx_Os_Task *volatile Ifx_g_OsTasks[IFX_CFG_OS_MAX_TASKS];
+
+/** \brief Task owning the CPU, by CPU index, NULL_PTR if none or not instrumented */
+static Ifx_Os_Task   *Ifx_Os_runningTask[IFXCPU_NUM_MODULES];
+
+/** \brief Returns the task object of a task ID, NULL_PTR if the task is not instrumented */
+static Ifx_Os_Task *Ifx_Os_getTask(Ifx_Os_TaskId id)
+{
+    return ((uint32)id < IFX_CFG_OS_MAX_TASKS) ? Ifx_g_OsTasks[id] : NULL_PTR;
+}
+
+
+static void Ifx_Os_clearTask(Ifx_Os_Task *task)
+{
+    task->activationCount = 0;
+    task->preemptionCount = 0;
+    task->lostCount       = 0;
+    task->missCount       = 0;
+    task->lastResponse    = 0;
+    task->maxResponse     = 0;
+}
+
+
+void Ifx_Os_activationLost(Ifx_Os_TaskId id)
+{
+    Ifx_Os_Task *task = Ifx_Os_getTask(id);
+
+    if (task != NULL_PTR)
+    {
+        task->lostCount++;
+    }
+}
+
+
+boolean Ifx_Os_addTask(Ifx_Os_Task *task, Ifx_Os_TaskId id, pchar name, uint32 deadline, Ifx_Profiler *profiler)
+{
+    IfxCpu_ResourceCpu cpu    = IfxCpu_getCoreIndex();
+    boolean            result = FALSE;
+
+    if ((uint32)id < IFX_CFG_OS_MAX_TASKS)
+    {
+        task->name       = name;
+        task->id         = id;
+        task->cpu        = cpu;
+        task->profiler   = profiler;
+        task->profilerId = -1;
+        task->deadline   = (uint32)(deadline * TimeConst_1us);
+        task->running    = FALSE;
+        task->ending     = FALSE;
+        Ifx_Os_clearTask(task);
+
+        if (profiler != NULL_PTR)
+        {
+            task->profilerId = Ifx_Profiler_addEntry(profiler, name, 0);
+        }
+
+        Ifx_g_OsTasks[id] = (Ifx_Os_Task *)IFXCPU_GLB_ADDR_DSPR(cpu, task);
+        result            = TRUE;
+    }
+
+    return result;
+}
+
+
+void Ifx_Os_postTask(Ifx_Os_TaskId id)
+{
+    IfxCpu_ResourceCpu cpu  = IfxCpu_getCoreIndex();
+    Ifx_Os_Task       *task = Ifx_Os_runningTask[cpu];
+
+    if (task != NULL_PTR)
+    {
+        Ifx_Profiler_accumulate(&task->elapsed, &task->segmentStart);
+
+        if (task->ending != FALSE)
+        {
+            uint32 response = elapsedFast32(task->activationStart);
+
+            task->ending       = FALSE;
+            task->running      = FALSE;
+            task->activationCount++;
+            task->lastResponse = response;
+            task->maxResponse  = __maxu(task->maxResponse, response);
+
+            if ((task->deadline != 0) && (response > task->deadline))
+            {
+                task->missCount++;
+            }
+
+            if (task->profiler != NULL_PTR)
+            {
+                Ifx_Profiler_record(task->profiler, task->profilerId, &task->elapsed);
+            }
+        }
+
+        Ifx_Os_runningTask[cpu] = NULL_PTR;
+    }
+
+    IFX_TRACE(Ifx_Trace_Event_taskStop, id);
+}
+
+
+void Ifx_Os_preTask(Ifx_Os_TaskId id)
+{
+    static const Ifx_Profiler_Mark zero = {0, 0, {0, 0, 0}};
+    Ifx_Os_Task                   *task = Ifx_Os_getTask(id);
+
+    IFX_TRACE(Ifx_Trace_Event_taskStart, id);
+
+    if (task != NULL_PTR)
+    {
+        if (task->running == FALSE)
+        {
+            /* First dispatch of the activation */
+            task->running         = TRUE;
+            task->activationStart = nowFast32();
+            task->elapsed         = zero;
+        }
+        else
+        {
+            /* Resume after a preemption */
+            task->preemptionCount++;
+        }
+
+        Ifx_Profiler_start(&task->segmentStart);
+    }
+
+    Ifx_Os_runningTask[IfxCpu_getCoreIndex()] = task;
+}
+
+
+void Ifx_Os_resetStatistics(void)
+{
+    IfxCpu_ResourceCpu cpu = IfxCpu_getCoreIndex();
+    uint32             i;
+
+    for (i = 0; i < IFX_CFG_OS_MAX_TASKS; i++)
+    {
+        Ifx_Os_Task *task = Ifx_g_OsTasks[i];
+
+        if ((task != NULL_PTR) && (task->cpu == cpu))
+        {
+            boolean interruptState = IfxCpu_disableInterrupts();
+            Ifx_Os_clearTask(task);
+            IfxCpu_restoreInterrupts(interruptState);
+        }
+    }
+}
+
+
+boolean Ifx_Os_showTasks(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    uint32 i;
+    (void)data;
+
+    IfxStdIf_DPipe_print(io, "%-3s %-16s %3s %10s %10s %8s %8s %10s %10s %10s"ENDL,
+        "id", "name", "cpu", "activation", "preemption", "lost", "miss", "last[us]", "max[us]", "limit[us]");
+
+    for (i = 0; i < IFX_CFG_OS_MAX_TASKS; i++)
+    {
+        Ifx_Os_Task *task = Ifx_g_OsTasks[i];
+
+        if (task != NULL_PTR)
+        {
+            /* Not locked: the counters of the other CPUs may be updated while printing */
+            Ifx_Os_Task copy = *task;
+
+            IfxStdIf_DPipe_print(io, "%3u %-16s %3u %10u %10u %8u %8u %10u %10u %10u"ENDL,
+                i, copy.name, copy.cpu, copy.activationCount, copy.preemptionCount, copy.lostCount,
+                copy.missCount, (uint32)(copy.lastResponse / TimeConst_1us), (uint32)(copy.maxResponse / TimeConst_1us),
+                (uint32)(copy.deadline / TimeConst_1us));
+        }
+    }
+
+    if (Ifx_Shell_matchToken(&args, "reset") != FALSE)
+    {
+        Ifx_Os_resetStatistics();
+    }
+
+    return TRUE;
+}
+
+
+void Ifx_Os_taskEnd(void)
+{
+    Ifx_Os_Task *task = Ifx_Os_runningTask[IfxCpu_getCoreIndex()];
+
+    if (task != NULL_PTR)
+    {
+        task->ending = TRUE;
+    }
+}
+
+
+#if IFX_CFG_OS_ERIKA
+/** \brief ERIKA hook, called by the kernel before a task gets the CPU */
+void PreTaskHook(void)
+{
+    TaskType id;
+
+    GetTaskID(&id);
+    Ifx_Os_preTask(id);
+}
+
+
+/** \brief ERIKA hook, called by the kernel before a task leaves the CPU */
+void PostTaskHook(void)
+{
+    TaskType id;
+
+    GetTaskID(&id);
+    Ifx_Os_postTask(id);
+}
+
+
+/** \brief ERIKA hook, called by the kernel when a service returns an error
+ *
+ * An activation of a task already activated ACTIVATION times returns E_OS_LIMIT: the activation is lost.
+ */
+void ErrorHook(StatusType error)
+{
+    if ((error == E_OS_LIMIT) && (OSErrorGetServiceId() == OSServiceId_ActivateTask))
+    {
+        Ifx_Os_activationLost(OSError_ActivateTask_TaskID());
+    }
+}
+
+
+#endif
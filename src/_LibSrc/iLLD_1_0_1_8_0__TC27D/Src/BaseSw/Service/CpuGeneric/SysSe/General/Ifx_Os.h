@@ -0,0 +1,327 @@
+/**
+ * \file Ifx_Os.h
+ * \brief OS abstraction and task instrumentation
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_general_os OS abstraction
+ * \ingroup library_srvsw_sysse_general
+ *
+ * The application tasks, interrupts and inter-core locks are written once with the macros of this module, and
+ * run either with a bare-metal scheduler (e.g. the StmStaticCycle demo) or with the ERIKA Enterprise OSEK/VDX
+ * kernel (IFX_CFG_OS_ERIKA = 1):
+ *
+ * | Abstraction               | Bare-metal                               | ERIKA                                          |
+ * |---------------------------|------------------------------------------|------------------------------------------------|
+ * | \ref IFX_OS_TASK()        | function called by the scheduler         | TASK() activated by an alarm, TerminateTask()  |
+ * | \ref IFX_OS_ISR1()        | IFX_INTERRUPT()                          | ISR1(), category 1, no OS service              |
+ * | \ref IFX_OS_ISR2()        | IFX_INTERRUPT()                          | ISR2(), category 2, priority set in the OIL    |
+ * | \ref Ifx_Os_Spinlock      | IfxCpu_setSpinLock() on a shared word    | GetSpinlock() on a SPINLOCK object of the OIL  |
+ *
+ * The task instrumentation is fed by the context switches: \ref Ifx_Os_preTask() when a task gets the CPU,
+ * \ref Ifx_Os_postTask() when it leaves the CPU, preempted or terminated. With ERIKA these are the
+ * PreTaskHook() and PostTaskHook() of the kernel, defined by this module. A bare-metal scheduler calls them
+ * around each task execution. Each task then feeds:
+ * - the \ref library_srvsw_sysse_time_profiler entry of the task: performance counters of the task only, the
+ * segments of a preempted task are summed, the preempting tasks are not counted.
+ * - the \ref library_srvsw_sysse_time_trace: one taskStart / taskStop record per segment, so that the trace
+ * shows the preemptions.
+ * - the deadline monitor: response time from the first dispatch to the termination, deadline misses, and
+ * activations lost because the previous one was not finished (\ref Ifx_Os_activationLost(), with ERIKA from
+ * the ErrorHook() on E_OS_LIMIT).
+ *
+ * The measurements and the statistics are identical with and without OS, only the numbering of the tasks
+ * differs: with ERIKA, the task ID is the TaskType generated by RT-Druid (order of the TASK objects of the
+ * OIL file), with a bare-metal scheduler its index in the task table.
+ *
+ * Restrictions:
+ * - a task object is written by the CPU which executes the task only, and should be located in the DSPR of this
+ * CPU, as the profiler of this CPU.
+ * - with ERIKA the OIL file shall enable the hooks used (PRETASKHOOK, POSTTASKHOOK, ERRORHOOK, USEGETSERVICEID,
+ * USEPARAMETERACCESS), and the application shall not define them.
+ *
+ * Usage example:
+ * \code
+ * // task, identical with and without OS
+ * IFX_OS_TASK(Task10ms)
+ * {
+ *     Ifx_Os_getSpinlock(&speedLock);
+ *     speed = g_Speed;
+ *     Ifx_Os_releaseSpinlock(&speedLock);
+ *     control(speed);
+ * }
+ *
+ * // interrupt of category 2, traced
+ * IFX_OS_ISR2(isrAdc, 0, ISR_PRIORITY_ADC)
+ * {
+ *     ...
+ * }
+ *
+ * // initialisation, on the CPU executing the task
+ * static Ifx_Os_Task task10ms;     // located in the DSPR of the CPU
+ * Ifx_Profiler_init(&profilerCpu1, 8);
+ * Ifx_Os_addTask(&task10ms, TASK_10MS_ID, "10ms", 800, &profilerCpu1);   // 800 us deadline
+ *
+ * // shell command list entry
+ * {"tasks", "   : Show the task statistics", NULL_PTR, &Ifx_Os_showTasks},
+ * \endcode
+ *
+ * RT-Druid template (OIL) for TC27x, tasks on CPU1 and CPU2, hooks and spinlock used by this module:
+ * \code
+ * CPU mySystem {
+ *     OS myOs {
+ *         EE_OPT = "EE_EXECUTE_FROM_RAM";
+ *         CPU_DATA = TRICORE {
+ *             ID = "master"; CPU_CLOCK = 200.0; APP_SRC = "Cpu0_Main.c"; MULTI_STACK = TRUE;
+ *             COMPILER_TYPE = GNU;
+ *         };
+ *         CPU_DATA = TRICORE { ID = "slave1"; APP_SRC = "Cpu1_Main.c"; MULTI_STACK = TRUE; };
+ *         CPU_DATA = TRICORE { ID = "slave2"; APP_SRC = "Cpu2_Main.c"; MULTI_STACK = TRUE; };
+ *         MCU_DATA = TRICORE { MODEL = TC27x; };
+ *         STATUS = EXTENDED;
+ *         PRETASKHOOK = TRUE;
+ *         POSTTASKHOOK = TRUE;
+ *         ERRORHOOK = TRUE;
+ *         USEGETSERVICEID = TRUE;
+ *         USEPARAMETERACCESS = TRUE;
+ *         USERESSCHEDULER = FALSE;
+ *         KERNEL_TYPE = ECC1;
+ *         ORTI_SECTIONS = ALL;
+ *     };
+ *
+ *     TASK Task1ms  { CPU_ID = "slave1"; PRIORITY = 20; SCHEDULE = FULL; ACTIVATION = 1; AUTOSTART = FALSE; STACK = PRIVATE { SIZE = 512; }; };
+ *     TASK Task10ms { CPU_ID = "slave2"; PRIORITY = 10; SCHEDULE = FULL; ACTIVATION = 1; AUTOSTART = FALSE; STACK = PRIVATE { SIZE = 512; }; };
+ *
+ *     COUNTER SystemTimer1 { CPU_ID = "slave1"; MINCYCLE = 1; MAXALLOWEDVALUE = 2147483647; TICKSPERBASE = 1;
+ *                            TYPE = HARDWARE { DEVICE = "STM_SR0"; SYSTEM_TIMER = TRUE; PRIORITY = 2; }; SECONDSPERTICK = 0.001; };
+ *     COUNTER SystemTimer2 { CPU_ID = "slave2"; MINCYCLE = 1; MAXALLOWEDVALUE = 2147483647; TICKSPERBASE = 1;
+ *                            TYPE = HARDWARE { DEVICE = "STM_SR0"; SYSTEM_TIMER = TRUE; PRIORITY = 2; }; SECONDSPERTICK = 0.001; };
+ *
+ *     ALARM Alarm1ms  { COUNTER = SystemTimer1; ACTION = ACTIVATETASK { TASK = Task1ms; };
+ *                       AUTOSTART = TRUE { ALARMTIME = 1; CYCLETIME = 1; }; };
+ *     ALARM Alarm10ms { COUNTER = SystemTimer2; ACTION = ACTIVATETASK { TASK = Task10ms; };
+ *                       AUTOSTART = TRUE { ALARMTIME = 1; CYCLETIME = 10; }; };
+ *
+ *     ISR isrAdc { CPU_ID = "master"; CATEGORY = 2; PRIORITY = 10; HANDLER = "isrAdc"; };
+ *
+ *     SPINLOCK speedLock { };
+ * };
+ * \endcode
+ *
+ */
+#ifndef IFX_OS_H
+#define IFX_OS_H 1
+
+#include "Cpu/Std/IfxCpu.h"
+#include "SysSe/Bsp/Bsp.h"
+#include "SysSe/Time/Ifx_Profiler.h"
+#include "SysSe/Time/Ifx_Trace.h"
+#include "StdIf/IfxStdIf_DPipe.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_OS_ERIKA)
+#define IFX_CFG_OS_ERIKA     (0)    /**<\brief If 1, the abstraction maps to the ERIKA Enterprise kernel, else to the bare-metal scheduler */
+#endif
+
+#if !defined(IFX_CFG_OS_MAX_TASKS)
+#define IFX_CFG_OS_MAX_TASKS (16)   /**<\brief Maximal number of instrumented tasks, task IDs 0 to IFX_CFG_OS_MAX_TASKS - 1 */
+#endif
+
+#if IFX_CFG_OS_ERIKA
+#include "ee.h"
+#endif
+
+/** \addtogroup library_srvsw_sysse_general_os
+ * \{ */
+
+#if IFX_CFG_OS_ERIKA
+
+/** \brief Task ID, TaskType of the kernel */
+typedef TaskType        Ifx_Os_TaskId;
+
+/** \brief Inter-core lock, ID of a SPINLOCK object of the OIL file */
+typedef SpinlockIdType  Ifx_Os_Spinlock;
+
+#define IFX_OS_TASK_ENTRY(task)                 TASK(task)
+#define IFX_OS_TASK_EXIT()                      TerminateTask()
+#define IFX_OS_ISR1_ENTRY(isr, vectabNum, prio) ISR1(isr)
+#define IFX_OS_ISR2_ENTRY(isr, vectabNum, prio) ISR2(isr)
+
+#else
+
+/** \brief Task ID, index of the task in the table of the scheduler */
+typedef uint32          Ifx_Os_TaskId;
+
+/** \brief Inter-core lock, shall be located in a memory visible by all CPUs */
+typedef IfxCpu_spinLock Ifx_Os_Spinlock;
+
+#define IFX_OS_TASK_ENTRY(task)                 void task(void)
+#define IFX_OS_TASK_EXIT()
+#define IFX_OS_ISR1_ENTRY(isr, vectabNum, prio) IFX_INTERRUPT(isr, vectabNum, prio)
+#define IFX_OS_ISR2_ENTRY(isr, vectabNum, prio) IFX_INTERRUPT(isr, vectabNum, prio)
+
+#endif
+
+/** \brief Define the task function task, followed by its body
+ *
+ * With ERIKA, the activation is marked as finished (\ref Ifx_Os_taskEnd()) and the task is terminated after
+ * the body. With the bare-metal scheduler, the scheduler marks the end of the activation.
+ * \param task Task name, TASK object of the OIL file with ERIKA
+ */
+#define IFX_OS_TASK(task)                          \
+    static void task##_body(void);                 \
+    IFX_OS_TASK_ENTRY(task)                        \
+    {                                              \
+        task##_body();                             \
+        Ifx_Os_taskEnd();                          \
+        IFX_OS_TASK_EXIT();                        \
+    }                                              \
+    static void task##_body(void)
+
+/** \brief Define the interrupt isr of category 1 (no OS service), followed by its body
+ * \param isr Interrupt service routine name, HANDLER of the ISR object of the OIL file with ERIKA
+ * \param vectabNum vector table number, bare-metal only
+ * \param prio interrupt priority, bare-metal only (in the OIL file with ERIKA)
+ */
+#define IFX_OS_ISR1(isr, vectabNum, prio)          \
+    IFX_OS_ISR1_ENTRY(isr, vectabNum, prio)
+
+/** \brief Define the interrupt isr of category 2 (OS services allowed), followed by its body
+ *
+ * The entry and exit are traced with the interrupt priority as payload.
+ * \param isr Interrupt service routine name, HANDLER of the ISR object of the OIL file with ERIKA
+ * \param vectabNum vector table number, bare-metal only
+ * \param prio interrupt priority, same value as in the OIL file with ERIKA
+ */
+#define IFX_OS_ISR2(isr, vectabNum, prio)          \
+    static void isr##_body(void);                  \
+    IFX_OS_ISR2_ENTRY(isr, vectabNum, prio)        \
+    {                                              \
+        IFX_TRACE(Ifx_Trace_Event_isrEntry, prio); \
+        isr##_body();                              \
+        IFX_TRACE(Ifx_Trace_Event_isrExit, prio);  \
+    }                                              \
+    static void isr##_body(void)
+
+/** \brief Statistics and measurement state of a task */
+typedef struct
+{
+    pchar              name;             /**<\brief task name */
+    Ifx_Os_TaskId      id;               /**<\brief task ID */
+    IfxCpu_ResourceCpu cpu;              /**<\brief CPU executing the task */
+    Ifx_Profiler      *profiler;         /**<\brief profiler of the CPU executing the task, NULL_PTR if not profiled */
+    sint32             profilerId;       /**<\brief profiler entry ID of the task */
+    uint32             deadline;         /**<\brief response time limit in STM ticks, 0 if not checked */
+    Ifx_Profiler_Mark  segmentStart;     /**<\brief counters at the last dispatch */
+    Ifx_Profiler_Mark  elapsed;          /**<\brief counters summed over the segments of the current activation */
+    uint32             activationStart;  /**<\brief \ref nowFast32() at the first dispatch of the current activation */
+    boolean            running;          /**<\brief TRUE from the first dispatch to the end of the activation */
+    boolean            ending;           /**<\brief TRUE if the next \ref Ifx_Os_postTask() ends the activation */
+    uint32             activationCount;  /**<\brief number of finished activations */
+    uint32             preemptionCount;  /**<\brief number of preemptions */
+    volatile uint32    lostCount;        /**<\brief number of activations lost, the previous one was not finished */
+    uint32             missCount;        /**<\brief number of activations with a response time over the deadline */
+    uint32             lastResponse;     /**<\brief response time of the last activation in STM ticks */
+    uint32             maxResponse;      /**<\brief maximal response time in STM ticks */
+} Ifx_Os_Task;
+
+/** \brief Task objects by task ID, global addresses, NULL_PTR if not instrumented */
+IFX_EXTERN Ifx_Os_Task *volatile Ifx_g_OsTasks[IFX_CFG_OS_MAX_TASKS];
+
+/** \brief Record an activation lost because the previous one was not finished
+ *
+ * Called by the bare-metal scheduler, or by the ErrorHook() of ERIKA. May be called from any CPU.
+ * \param id Task ID
+ */
+IFX_EXTERN void Ifx_Os_activationLost(Ifx_Os_TaskId id);
+
+/** \brief Register a task, on the CPU executing it
+ * \param task Pointer to the task object, located in the DSPR of the calling CPU
+ * \param id Task ID
+ * \param name Task name, must be a constant string
+ * \param deadline Response time limit in us, 0 if not checked
+ * \param profiler Profiler object of the calling CPU, NULL_PTR if the task is not profiled
+ * \return Returns FALSE if the task ID is out of range
+ */
+IFX_EXTERN boolean Ifx_Os_addTask(Ifx_Os_Task *task, Ifx_Os_TaskId id, pchar name, uint32 deadline, Ifx_Profiler *profiler);
+
+/** \brief Acquire an inter-core lock, waits until it is free
+ * \param lock Pointer to the lock
+ */
+IFX_INLINE void Ifx_Os_getSpinlock(Ifx_Os_Spinlock *lock)
+{
+#if IFX_CFG_OS_ERIKA
+    GetSpinlock(*lock);
+#else
+
+    while (IfxCpu_setSpinLock(lock, 0xFFFF) == FALSE)
+    {}
+
+#endif
+}
+
+
+/** \brief Task hook: a task leaves the CPU, preempted or terminated
+ *
+ * Called with ERIKA by PostTaskHook(), by the bare-metal scheduler after the task function.
+ * \param id Task ID
+ */
+IFX_EXTERN void Ifx_Os_postTask(Ifx_Os_TaskId id);
+
+/** \brief Task hook: a task gets the CPU, first dispatch of an activation or resume after a preemption
+ *
+ * Called with ERIKA by PreTaskHook(), by the bare-metal scheduler before the task function.
+ * \param id Task ID
+ */
+IFX_EXTERN void Ifx_Os_preTask(Ifx_Os_TaskId id);
+
+/** \brief Release an inter-core lock
+ * \param lock Pointer to the lock
+ */
+IFX_INLINE void Ifx_Os_releaseSpinlock(Ifx_Os_Spinlock *lock)
+{
+#if IFX_CFG_OS_ERIKA
+    ReleaseSpinlock(*lock);
+#else
+    IfxCpu_resetSpinLock(lock);
+#endif
+}
+
+
+/** \brief Clear the statistics of all tasks of the calling CPU
+ */
+IFX_EXTERN void Ifx_Os_resetStatistics(void);
+
+/** \brief Shell command: print the task statistics of all CPUs. With the argument "reset", the statistics of
+ * the tasks of the calling CPU are cleared afterwards
+ * \param args command arguments
+ * \param data not used
+ * \param io Pointer to the IfxStdIf_DPipe object
+ * \return TRUE
+ */
+IFX_EXTERN boolean Ifx_Os_showTasks(pchar args, void *data, IfxStdIf_DPipe *io);
+
+/** \brief Mark the end of the activation of the running task, the next \ref Ifx_Os_postTask() ends it
+ *
+ * Called by \ref IFX_OS_TASK() with ERIKA, by the bare-metal scheduler before \ref Ifx_Os_postTask().
+ */
+IFX_EXTERN void Ifx_Os_taskEnd(void);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
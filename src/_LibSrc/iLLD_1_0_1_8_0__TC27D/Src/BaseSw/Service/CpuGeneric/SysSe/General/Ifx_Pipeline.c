@@ -0,0 +1,396 @@
+/**
+ * \file Ifx_Pipeline.c
+ * \brief Multi-core dataflow pipeline
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_Pipeline.h"
+#include "SysSe/Comm/Ifx_Shell.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/*
+ * Note: each field shared between the CPUs has a single writer. The double buffers are written by the producer
+ * stage (slots, info, writeTotal) and the consumer stage (readTotal), the trigger counter by the interrupt which
+ * calls Ifx_Pipeline_trigger(), the statistics by the CPU of the stage. The readers of the statistics use
+ * statisticsVersion to detect an update in progress, as a sequence lock.
+ */
+
+static void Ifx_Pipeline_clearStatistics(Ifx_Pipeline_Stage *stage)
+{
+    Ifx_Pipeline_Statistics *statistics = &stage->statistics;
+
+    statistics->frameCount   = 0;
+    statistics->holdCount    = 0;
+    statistics->dropCount    = 0;
+    statistics->missedCount  = 0;
+    statistics->skipCount    = 0;
+    statistics->executionMin = 0xFFFFFFFFU;
+    statistics->executionMax = 0;
+    statistics->executionSum = 0;
+    statistics->latencyCount = 0;
+    statistics->latencyMin   = 0xFFFFFFFFU;
+    statistics->latencyMax   = 0;
+    statistics->latencySum   = 0;
+    statistics->throughput   = 0.0;
+    stage->windowStart       = nowFast32();
+    stage->windowCount       = 0;
+}
+
+
+/** \brief Run a stage if it is ready
+ * \return Returns TRUE if the process function was executed
+ */
+static boolean Ifx_Pipeline_runStage(Ifx_Pipeline_Stage *stage)
+{
+    Ifx_Pipeline_Buffer   *input      = stage->input;
+    Ifx_Pipeline_Buffer   *output     = stage->output;
+    const void            *inputData  = NULL_PTR;
+    void                  *outputData = NULL_PTR;
+    Ifx_Pipeline_FrameInfo info;
+    uint32                 skipped    = 0;
+    uint32                 missed     = 0;
+    boolean                dropped    = FALSE;
+    boolean                hasFrame   = FALSE;
+    boolean                published;
+    uint32                 start;
+    uint32                 end;
+
+    if (stage->trigger == Ifx_Pipeline_Trigger_upstream)
+    {
+        /* Back pressure: wait for a frame and for a free output slot */
+        if ((input->writeTotal == input->readTotal)
+            || ((output != NULL_PTR) && ((output->writeTotal - output->readTotal) >= 2)))
+        {
+            return FALSE;
+        }
+
+        hasFrame = TRUE;
+    }
+    else
+    {
+        uint32 triggerTotal = stage->triggerTotal;
+
+        if (triggerTotal == stage->handledTotal)
+        {
+            return FALSE;
+        }
+
+        missed              = triggerTotal - stage->handledTotal - 1;
+        stage->handledTotal = triggerTotal;
+        info.origin         = stage->triggerTime;
+        info.sequence       = stage->sequence;
+
+        if (input != NULL_PTR)
+        {
+            uint32 available = input->writeTotal - input->readTotal;
+
+            if (available > 1)
+            {
+                /* Take the newest frame, release the older one */
+                skipped          = available - 1;
+                input->readTotal = input->readTotal + skipped;
+            }
+
+            hasFrame = available != 0;
+        }
+        else
+        {
+            hasFrame = TRUE;
+            stage->sequence++;
+        }
+
+        if ((output != NULL_PTR) && ((output->writeTotal - output->readTotal) >= 2))
+        {
+            /* The trigger cannot wait, the input frame stays for the next trigger */
+            dropped = TRUE;
+        }
+    }
+
+    if (hasFrame && (input != NULL_PTR))
+    {
+        uint32 slot = input->readTotal & 1;
+
+        inputData = &input->memory[slot * input->size];
+        info      = input->info[slot];
+    }
+
+    if (dropped == FALSE)
+    {
+        if (output != NULL_PTR)
+        {
+            outputData = &output->memory[(output->writeTotal & 1) * output->size];
+        }
+
+        start     = nowFast32();
+        published = stage->process(stage->data, inputData, outputData);
+        end       = nowFast32();
+
+        if ((output != NULL_PTR) && (published != FALSE))
+        {
+            output->info[output->writeTotal & 1] = info;
+            __dsync();  /* The frame must be visible before it is published */
+            output->writeTotal = output->writeTotal + 1;
+        }
+    }
+    else
+    {
+        start = end = 0;
+    }
+
+    if (hasFrame && (input != NULL_PTR) && (dropped == FALSE))
+    {
+        __dsync();      /* The frame must be read before it is released to the producer */
+        input->readTotal = input->readTotal + 1;
+    }
+
+    /* Statistics */
+    stage->statisticsVersion++;
+    __dsync();
+
+    if (stage->resetRequest != FALSE)
+    {
+        stage->resetRequest = FALSE;
+        Ifx_Pipeline_clearStatistics(stage);
+    }
+
+    {
+        Ifx_Pipeline_Statistics *statistics = &stage->statistics;
+
+        statistics->missedCount += missed;
+        statistics->skipCount   += skipped;
+
+        if (dropped != FALSE)
+        {
+            statistics->dropCount++;
+        }
+        else
+        {
+            uint32 execution = end - start;
+
+            statistics->frameCount++;
+            statistics->executionSum += execution;
+            statistics->executionMin  = __minu(statistics->executionMin, execution);
+            statistics->executionMax  = __maxu(statistics->executionMax, execution);
+
+            if (hasFrame)
+            {
+                uint32 latency = end - info.origin;
+
+                statistics->latencyCount++;
+                statistics->latencySum += latency;
+                statistics->latencyMin  = __minu(statistics->latencyMin, latency);
+                statistics->latencyMax  = __maxu(statistics->latencyMax, latency);
+                stage->windowCount++;
+            }
+            else
+            {
+                statistics->holdCount++;
+            }
+
+            if ((end - stage->windowStart) >= (uint32)TimeConst_1s)
+            {
+                statistics->throughput = (float32)stage->windowCount * (float32)TimeConst_1s / (float32)(end - stage->windowStart);
+                stage->windowStart     = end;
+                stage->windowCount     = 0;
+            }
+        }
+    }
+
+    __dsync();
+    stage->statisticsVersion++;
+
+    return dropped == FALSE;
+}
+
+
+sint32 Ifx_Pipeline_addStage(Ifx_Pipeline *pipeline, const Ifx_Pipeline_StageConfig *config)
+{
+    uint32              index = pipeline->stageCount;
+    Ifx_Pipeline_Stage *stage;
+    IfxCpu_Id           cpu   = IfxCpu_getCoreId();
+
+    if ((index >= IFX_CFG_PIPELINE_MAX_STAGES) || (config->process == NULL_PTR) || (config->cpu >= IFXCPU_NUM_MODULES))
+    {
+        return -1;
+    }
+
+    if (index == 0)
+    {
+        /* The first stage has no upstream */
+        if (config->trigger == Ifx_Pipeline_Trigger_upstream)
+        {
+            return -1;
+        }
+    }
+    else if (pipeline->stages[index - 1].output == NULL_PTR)
+    {
+        /* The previous stage has no output */
+        return -1;
+    }
+
+    stage                    = &pipeline->stages[index];
+    stage->name              = config->name;
+    stage->cpu               = config->cpu;
+    stage->trigger           = config->trigger;
+    stage->process           = config->process;
+    stage->data              = (void *)IFXCPU_GLB_ADDR_DSPR(cpu, config->data);
+    stage->input             = (index != 0) ? pipeline->stages[index - 1].output : NULL_PTR;
+    stage->triggerTotal      = 0;
+    stage->triggerTime       = 0;
+    stage->handledTotal      = 0;
+    stage->sequence          = 0;
+    stage->resetRequest      = FALSE;
+    stage->statisticsVersion = 0;
+    Ifx_Pipeline_clearStatistics(stage);
+
+    if ((config->outputMemory != NULL_PTR) && (config->outputSize != 0))
+    {
+        Ifx_Pipeline_Buffer *buffer = &pipeline->buffers[index];
+
+        buffer->memory     = (uint8 *)IFXCPU_NON_CACHED_ADDR(IFXCPU_GLB_ADDR_DSPR(cpu, config->outputMemory));
+        buffer->size       = config->outputSize;
+        buffer->writeTotal = 0;
+        buffer->readTotal  = 0;
+        stage->output      = buffer;
+    }
+    else
+    {
+        stage->output = NULL_PTR;
+    }
+
+    __dsync();
+    pipeline->stageCount = (uint8)(index + 1);
+
+    return (sint32)index;
+}
+
+
+void Ifx_Pipeline_getStatistics(Ifx_Pipeline *pipeline, uint32 stageIndex, Ifx_Pipeline_Statistics *statistics)
+{
+    Ifx_Pipeline_Stage *stage = &pipeline->stages[stageIndex];
+    uint32              version;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, stageIndex < pipeline->stageCount);
+
+    do
+    {
+        version = stage->statisticsVersion;
+        __dsync();
+        *statistics = stage->statistics;
+        __dsync();
+    } while (((version & 1) != 0) || (version != stage->statisticsVersion));
+}
+
+
+Ifx_Pipeline *Ifx_Pipeline_init(Ifx_Pipeline *pipeline)
+{
+    /* Shared object: use the non cached LMU or the global DSPR address */
+    pipeline = (Ifx_Pipeline *)IFXCPU_NON_CACHED_ADDR(IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), pipeline));
+
+    pipeline->stageCount = 0;
+    __dsync();
+
+    return pipeline;
+}
+
+
+void Ifx_Pipeline_initStageConfig(Ifx_Pipeline_StageConfig *config)
+{
+    config->name         = "";
+    config->cpu          = IfxCpu_Id_0;
+    config->trigger      = Ifx_Pipeline_Trigger_upstream;
+    config->process      = NULL_PTR;
+    config->data         = NULL_PTR;
+    config->outputMemory = NULL_PTR;
+    config->outputSize   = 0;
+}
+
+
+uint32 Ifx_Pipeline_process(Ifx_Pipeline *pipeline)
+{
+    IfxCpu_Id cpu      = IfxCpu_getCoreId();
+    uint32    executed = 0;
+    uint32    index    = pipeline->stageCount;
+
+    while (index > 0)
+    {
+        Ifx_Pipeline_Stage *stage;
+
+        index--;
+        stage = &pipeline->stages[index];
+
+        if ((stage->cpu == cpu) && (Ifx_Pipeline_runStage(stage) != FALSE))
+        {
+            executed++;
+        }
+    }
+
+    return executed;
+}
+
+
+void Ifx_Pipeline_resetStatistics(Ifx_Pipeline *pipeline)
+{
+    uint32 index;
+
+    for (index = 0; index < pipeline->stageCount; index++)
+    {
+        pipeline->stages[index].resetRequest = TRUE;
+    }
+}
+
+
+boolean Ifx_Pipeline_showStatistics(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    Ifx_Pipeline *pipeline = (Ifx_Pipeline *)data;
+    uint32        index;
+    uint32        ticksPerUs = (uint32)TimeConst_1us;
+
+    IfxStdIf_DPipe_print(io, "%-12s %4s %8s %6s %6s %6s %6s %6s %7s %7s %7s %7s %7s %7s"ENDL, "stage", "cpu", "frames", "fps",
+        "hold", "drop", "miss", "skip", "exe min", "exe avg", "exe max", "lat min", "lat avg", "lat max");
+
+    for (index = 0; index < pipeline->stageCount; index++)
+    {
+        Ifx_Pipeline_Statistics statistics;
+        uint32                  executionMean;
+        uint32                  latencyMean;
+
+        Ifx_Pipeline_getStatistics(pipeline, index, &statistics);
+
+        executionMean = (statistics.frameCount != 0) ? (uint32)(statistics.executionSum / statistics.frameCount) : 0;
+        latencyMean   = (statistics.latencyCount != 0) ? (uint32)(statistics.latencySum / statistics.latencyCount) : 0;
+
+        IfxStdIf_DPipe_print(io, "%-12s %4u %8u %6u %6u %6u %6u %6u %7u %7u %7u %7u %7u %7u"ENDL,
+            pipeline->stages[index].name, pipeline->stages[index].cpu, statistics.frameCount,
+            (uint32)statistics.throughput, statistics.holdCount, statistics.dropCount, statistics.missedCount,
+            statistics.skipCount,
+            (statistics.frameCount != 0) ? statistics.executionMin / ticksPerUs : 0, executionMean / ticksPerUs,
+            statistics.executionMax / ticksPerUs,
+            (statistics.latencyCount != 0) ? statistics.latencyMin / ticksPerUs : 0, latencyMean / ticksPerUs,
+            statistics.latencyMax / ticksPerUs);
+    }
+
+    if (Ifx_Shell_matchToken(&args, "reset") != FALSE)
+    {
+        Ifx_Pipeline_resetStatistics(pipeline);
+    }
+
+    return TRUE;
+}
@@ -0,0 +1,287 @@
+/**
+ * \file Ifx_Pipeline.h
+ * \brief Multi-core dataflow pipeline
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ *
+ * \defgroup library_srvsw_sysse_general_pipeline Multi-core dataflow pipeline
+ * \ingroup library_srvsw_sysse_general
+ *
+ * The pipeline splits a periodic processing chain (acquisition, processing, control, actuation) into stages
+ * which run on different CPUs, so that the frames overlap: while a CPU acquires the frame N+1, another CPU
+ * processes the frame N and a third one actuates with the result of the frame N-1.
+ *
+ * The stages form a linear chain, in the order they are added. Each stage is declared with:
+ * - the CPU which runs it: \ref Ifx_Pipeline_process() is called in the background loop of each CPU and only
+ * runs the stages of the calling CPU.
+ * - a trigger. A DMA or timer stage runs once per call of \ref Ifx_Pipeline_trigger(), typically from the DMA
+ * done or the timer interrupt. An upstream stage runs as soon as the previous stage published a frame.
+ * - a process function, which reads the input frame (output of the previous stage) and writes the output frame.
+ *
+ * Two consecutive stages are connected by a double buffer of two frames of outputSize bytes. The buffer is lock
+ * free (single producer, single consumer, as \ref IfxLld_lib_datahandling_fifotyped): the producer writes the free
+ * slot and publishes it, the consumer releases the slot after its process function returned. The frames are
+ * processed in place, the process functions get pointers into the slots and no frame is copied by the pipeline.
+ * When the output buffer is full:
+ * - an upstream stage waits (back pressure), no frame is lost between the upstream stages.
+ * - a DMA or timer stage cannot wait for its trigger: the trigger is dropped and counted.
+ *
+ * A DMA or timer stage with an input always takes the newest frame, the older ones are skipped and counted, so
+ * that the actuation never lags behind. Without new frame since the last trigger, the process function is
+ * called with input = NULL_PTR and shall hold its last output.
+ *
+ * Each frame carries the sequence number and the time stamp of the trigger of the first stage. Each stage
+ * measures its execution time, its latency (from the trigger of the first stage to the end of the stage, the
+ * latency of the last stage is the end to end latency) and its throughput in frames per second. The statistics
+ * are read from any CPU with \ref Ifx_Pipeline_getStatistics() or printed with the shell command
+ * \ref Ifx_Pipeline_showStatistics(). The times are STM ticks of \ref nowFast32(), the latency shall be below
+ * 2^32 ticks.
+ *
+ * The pipeline object and the frame memory are shared by the CPUs. They are placed in the LMU with
+ * \ref IFX_LMU_DATA and accessed through their non cached addresses, converted by \ref Ifx_Pipeline_init()
+ * and \ref Ifx_Pipeline_addStage(), which are called by CPU0 before the other CPUs are started.
+ *
+ * Usage example: acquisition on CPU0, processing on CPU1, actuation on CPU0 at the timer rate
+ * \code
+ * IFX_LMU_DATA Ifx_Pipeline pipelineMemory;
+ * IFX_LMU_DATA uint16       rawFrames[2][128];
+ * IFX_LMU_DATA Result       results[2];
+ * Ifx_Pipeline             *pipeline;
+ *
+ * static boolean acquire(void *data, const void *input, void *output)   { return readFrame(output); }
+ * static boolean detect(void *data, const void *input, void *output)    { return findLine(input, output); }
+ * static boolean actuate(void *data, const void *input, void *output)   { if (input != NULL_PTR) setOutput(input); return TRUE; }
+ *
+ * // CPU0, before starting CPU1
+ * Ifx_Pipeline_StageConfig config;
+ * pipeline = Ifx_Pipeline_init(&pipelineMemory);
+ *
+ * Ifx_Pipeline_initStageConfig(&config);
+ * config.name         = "acquire";
+ * config.trigger      = Ifx_Pipeline_Trigger_dma;
+ * config.process      = &acquire;
+ * config.outputMemory = rawFrames;
+ * config.outputSize   = sizeof(rawFrames[0]);
+ * Ifx_Pipeline_addStage(pipeline, &config);         // stage 0
+ *
+ * Ifx_Pipeline_initStageConfig(&config);
+ * config.name         = "detect";
+ * config.cpu          = IfxCpu_Id_1;
+ * config.process      = &detect;
+ * config.outputMemory = results;
+ * config.outputSize   = sizeof(results[0]);
+ * Ifx_Pipeline_addStage(pipeline, &config);         // stage 1
+ *
+ * Ifx_Pipeline_initStageConfig(&config);
+ * config.name         = "actuate";
+ * config.trigger      = Ifx_Pipeline_Trigger_timer;
+ * config.process      = &actuate;
+ * Ifx_Pipeline_addStage(pipeline, &config);         // stage 2
+ *
+ * // DMA done interrupt, CPU0
+ * Ifx_Pipeline_trigger(pipeline, 0);
+ *
+ * // timer interrupt, CPU0
+ * Ifx_Pipeline_trigger(pipeline, 2);
+ *
+ * // background loop of each CPU
+ * Ifx_Pipeline_process(pipeline);
+ * \endcode
+ *
+ */
+#ifndef IFX_PIPELINE_H
+#define IFX_PIPELINE_H 1
+
+#include "Cpu/Std/IfxCpu.h"
+#include "SysSe/Bsp/Bsp.h"
+#include "StdIf/IfxStdIf_DPipe.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_PIPELINE_MAX_STAGES)
+#define IFX_CFG_PIPELINE_MAX_STAGES (8)  /**<\brief Maximal number of stages */
+#endif
+
+/** \addtogroup library_srvsw_sysse_general_pipeline
+ * \{ */
+
+/** \brief Trigger of a stage */
+typedef enum
+{
+    Ifx_Pipeline_Trigger_dma      = 0,  /**<\brief runs once per \ref Ifx_Pipeline_trigger() call from the DMA done interrupt */
+    Ifx_Pipeline_Trigger_timer    = 1,  /**<\brief runs once per \ref Ifx_Pipeline_trigger() call from a timer interrupt */
+    Ifx_Pipeline_Trigger_upstream = 2   /**<\brief runs when the previous stage published a frame, not allowed for the first stage */
+} Ifx_Pipeline_Trigger;
+
+/** \brief Process function of a stage
+ * \param data Data of the stage, see \ref Ifx_Pipeline_StageConfig
+ * \param input Input frame, NULL_PTR for the first stage, or for a DMA / timer stage without new frame
+ * \param output Output frame to be written, NULL_PTR for the last stage
+ * \return Returns TRUE if the output frame is published, FALSE if it is discarded (e.g. no valid result)
+ */
+typedef boolean (*Ifx_Pipeline_Process)(void *data, const void *input, void *output);
+
+/** \brief Frame information, given by the first stage and passed along the chain */
+typedef struct
+{
+    uint32 sequence;      /**<\brief frame number */
+    uint32 origin;        /**<\brief time of the trigger of the first stage, nowFast32() */
+} Ifx_Pipeline_FrameInfo;
+
+/** \brief Double buffer between two stages */
+typedef struct
+{
+    uint8                 *memory;       /**<\brief two frames of size bytes, non cached address */
+    uint32                 size;         /**<\brief size of one frame in bytes */
+    Ifx_Pipeline_FrameInfo info[2];      /**<\brief information of the frame in each slot */
+    volatile uint32        writeTotal;   /**<\brief frames published, modified by the producer only */
+    volatile uint32        readTotal;    /**<\brief frames released, modified by the consumer only */
+} Ifx_Pipeline_Buffer;
+
+/** \brief Statistics of a stage, times in STM ticks */
+typedef struct
+{
+    uint32  frameCount;      /**<\brief number of executions of the process function */
+    uint32  holdCount;       /**<\brief executions of a DMA / timer stage without new input frame */
+    uint32  dropCount;       /**<\brief triggers dropped because the output buffer was full */
+    uint32  missedCount;     /**<\brief triggers not served before the next trigger */
+    uint32  skipCount;       /**<\brief input frames skipped because a newer frame was available */
+    uint32  executionMin;    /**<\brief minimal execution time of the process function */
+    uint32  executionMax;    /**<\brief maximal execution time of the process function */
+    uint64  executionSum;    /**<\brief sum of the execution times */
+    uint32  latencyCount;    /**<\brief number of latency measurements (executions with a frame) */
+    uint32  latencyMin;      /**<\brief minimal time from the trigger of the first stage to the end of the stage */
+    uint32  latencyMax;      /**<\brief maximal latency */
+    uint64  latencySum;      /**<\brief sum of the latencies */
+    float32 throughput;      /**<\brief frames per second, measured over the last second */
+} Ifx_Pipeline_Statistics;
+
+/** \brief Stage configuration */
+typedef struct
+{
+    pchar                name;          /**<\brief name, used by \ref Ifx_Pipeline_showStatistics() */
+    IfxCpu_Id            cpu;           /**<\brief CPU which runs the stage */
+    Ifx_Pipeline_Trigger trigger;       /**<\brief trigger of the stage */
+    Ifx_Pipeline_Process process;       /**<\brief process function */
+    void                *data;          /**<\brief data given to the process function */
+    void                *outputMemory;  /**<\brief memory of the output buffer, two frames of outputSize bytes, in the LMU or a DSPR. NULL_PTR for the last stage */
+    uint32               outputSize;    /**<\brief size of one output frame in bytes, multiple of 4 */
+} Ifx_Pipeline_StageConfig;
+
+/** \brief Stage */
+typedef struct
+{
+    pchar                   name;               /**<\brief name */
+    IfxCpu_Id               cpu;                /**<\brief CPU which runs the stage */
+    Ifx_Pipeline_Trigger    trigger;            /**<\brief trigger of the stage */
+    Ifx_Pipeline_Process    process;            /**<\brief process function */
+    void                   *data;               /**<\brief data given to the process function, global address */
+    Ifx_Pipeline_Buffer    *input;              /**<\brief input buffer, NULL_PTR for the first stage */
+    Ifx_Pipeline_Buffer    *output;             /**<\brief output buffer, NULL_PTR for the last stage */
+    volatile uint32         triggerTotal;       /**<\brief triggers received, modified by \ref Ifx_Pipeline_trigger() only */
+    volatile uint32         triggerTime;        /**<\brief time of the last trigger */
+    uint32                  handledTotal;       /**<\brief triggers handled by the stage */
+    uint32                  sequence;           /**<\brief sequence number of the next frame (first stage) */
+    uint32                  windowStart;        /**<\brief start of the throughput measurement window */
+    uint32                  windowCount;        /**<\brief frames in the throughput measurement window */
+    volatile boolean        resetRequest;       /**<\brief statistics reset requested by \ref Ifx_Pipeline_resetStatistics() */
+    volatile uint32         statisticsVersion;  /**<\brief incremented before and after each update of the statistics, odd during the update */
+    Ifx_Pipeline_Statistics statistics;         /**<\brief statistics, modified by the CPU of the stage only */
+} Ifx_Pipeline_Stage;
+
+/** \brief Pipeline object */
+typedef struct
+{
+    Ifx_Pipeline_Stage  stages[IFX_CFG_PIPELINE_MAX_STAGES];   /**<\brief stages, in the chain order */
+    Ifx_Pipeline_Buffer buffers[IFX_CFG_PIPELINE_MAX_STAGES];  /**<\brief output buffer of each stage */
+    uint8               stageCount;                            /**<\brief number of stages */
+} Ifx_Pipeline;
+
+/** \brief Add a stage at the end of the chain
+ *
+ * Called by CPU0 before the other CPUs are started. The input of the stage is the output buffer of the previous stage.
+ * \param pipeline Pointer to the pipeline object, as returned by \ref Ifx_Pipeline_init()
+ * \param config Pointer to the stage configuration
+ * \return Returns the stage index, or -1 if the stage could not be added
+ */
+IFX_EXTERN sint32 Ifx_Pipeline_addStage(Ifx_Pipeline *pipeline, const Ifx_Pipeline_StageConfig *config);
+
+/** \brief Return a consistent copy of the statistics of a stage, from any CPU
+ * \param pipeline Pointer to the pipeline object
+ * \param stageIndex Index of the stage
+ * \param statistics Returns the statistics
+ */
+IFX_EXTERN void Ifx_Pipeline_getStatistics(Ifx_Pipeline *pipeline, uint32 stageIndex, Ifx_Pipeline_Statistics *statistics);
+
+/** \brief Initialize the pipeline object, without stage
+ *
+ * Called by CPU0 before the other CPUs are started.
+ * \param pipeline Pointer to the pipeline object, shall be in the LMU or in a DSPR
+ * \return Returns the non cached / global address of the pipeline object, to be used by all CPUs
+ */
+IFX_EXTERN Ifx_Pipeline *Ifx_Pipeline_init(Ifx_Pipeline *pipeline);
+
+/** \brief Initialize the stage configuration with default values: CPU0, upstream trigger, last stage
+ * \param config Pointer to the stage configuration
+ */
+IFX_EXTERN void Ifx_Pipeline_initStageConfig(Ifx_Pipeline_StageConfig *config);
+
+/** \brief Run the stages of the calling CPU which are ready
+ *
+ * To be called from the background loop of each CPU which runs stages. The stages are checked from the last one
+ * to the first one, so that a frame released by a stage frees its slot for the previous stage in the same call.
+ * \param pipeline Pointer to the pipeline object
+ * \return Returns the number of process functions executed
+ */
+IFX_EXTERN uint32 Ifx_Pipeline_process(Ifx_Pipeline *pipeline);
+
+/** \brief Request the reset of the statistics of all stages
+ *
+ * The statistics are reset by the CPU of each stage, at its next call of \ref Ifx_Pipeline_process().
+ * \param pipeline Pointer to the pipeline object
+ */
+IFX_EXTERN void Ifx_Pipeline_resetStatistics(Ifx_Pipeline *pipeline);
+
+/** \brief Shell command handler: print the statistics of the stages, times in us
+ *
+ * With the argument "reset", the statistics are reset after being printed.
+ * \param args Command arguments
+ * \param data Pointer to the pipeline object
+ * \param io Standard interface used for the output
+ * \return Returns TRUE
+ */
+IFX_EXTERN boolean Ifx_Pipeline_showStatistics(pchar args, void *data, IfxStdIf_DPipe *io);
+
+/** \brief Trigger a DMA or timer stage
+ *
+ * Called from the interrupt of the trigger source, on any CPU. A stage shall be triggered from one context only.
+ * \param pipeline Pointer to the pipeline object
+ * \param stageIndex Index of the stage
+ */
+IFX_INLINE void Ifx_Pipeline_trigger(Ifx_Pipeline *pipeline, uint32 stageIndex)
+{
+    Ifx_Pipeline_Stage *stage = &pipeline->stages[stageIndex];
+
+    stage->triggerTime = nowFast32();
+    __dsync();          /* The time stamp must be visible before the trigger is published */
+    stage->triggerTotal++;
+}
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
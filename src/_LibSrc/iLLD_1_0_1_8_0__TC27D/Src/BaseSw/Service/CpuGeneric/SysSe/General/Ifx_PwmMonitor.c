@@ -0,0 +1,202 @@
+/**
+ * \file Ifx_PwmMonitor.c
+ * \brief IOM based PWM output plausibility monitor
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_PwmMonitor.h"
+#include "_Utilities/Ifx_Assert.h"
+#include <string.h>
+
+/** Returns the IOM reference input connected to a GTM TOUT, FALSE if the TOUT is not connected to the IOM
+ */
+static boolean Ifx_PwmMonitor_getRefInput(uint32 toutn, IfxIom_RefInput *refInput)
+{
+    boolean result = TRUE;
+
+    if (toutn <= 15)
+    {
+        *refInput = (IfxIom_RefInput)(IfxIom_RefInput_gtmTout0 + toutn);
+    }
+    else if ((toutn >= 107) && (toutn <= 109))
+    {
+        *refInput = (IfxIom_RefInput)(IfxIom_RefInput_gtmTout107 + (toutn - 107));
+    }
+    else
+    {
+        result = FALSE;
+    }
+
+    return result;
+}
+
+
+boolean Ifx_PwmMonitor_init(Ifx_PwmMonitor *monitor, const Ifx_PwmMonitor_Config *config)
+{
+    boolean                 result   = TRUE;
+    uint8                   channels = config->pwmConfig->base.channelCount / 2;
+    IfxIom_Driver_Config    iomConfig;
+    IfxIom_Driver_LamConfig lamConfig;
+    uint8                   i;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->feedback != NULL_PTR) && (channels <= IFXGTM_TOM_PWMHL_MAX_NUM_CHANNELS));
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((uint32)config->firstLam + (2 * channels)) <= 16);
+
+    memset(monitor, 0, sizeof(*monitor));
+    monitor->numOutputs = 2 * channels;
+
+    IfxIom_enableModule(config->iom, 1);
+
+    IfxIom_Driver_initConfig(&iomConfig, config->iom);
+    IfxIom_Driver_init(&monitor->iom, &iomConfig);
+
+    for (i = 0; i < monitor->numOutputs; i++)
+    {
+        IFX_CONST IfxGtm_Tom_ToutMap *tout = (i < channels) ? config->pwmConfig->ccx[i] : config->pwmConfig->coutx[i - channels];
+
+        IfxIom_Driver_initLamConfig(&lamConfig, &monitor->iom);
+        lamConfig.channel = (IfxIom_LamId)(config->firstLam + i);
+
+        if (Ifx_PwmMonitor_getRefInput(tout->toutn, &lamConfig.ref.input) == FALSE)
+        {
+            result = FALSE;
+            continue;
+        }
+
+        lamConfig.mon.input = config->feedback[i];
+
+        if (config->filterTime > 0.0)
+        {
+            lamConfig.mon.filter.mode                  = IfxIom_LamFilterMode_delayDebounceBothEdge;
+            lamConfig.mon.filter.risingEdgeFilterTime  = config->filterTime;
+            lamConfig.mon.filter.fallingEdgeFilterTime = config->filterTime;
+        }
+
+        /* the window timer restarts on each edge of the output, a mismatch (mon XOR ref) which ends after
+         * maxDelay is an event */
+        lamConfig.eventWindow.controlSource   = IfxIom_LamEventWindowControlSource_ref;
+        lamConfig.eventWindow.run             = IfxIom_LamEventWindowRunControl_freeRunning;
+        lamConfig.eventWindow.clearEvent      = IfxIom_LamEventWindowClearEvent_anyEdge;
+        lamConfig.eventWindow.threshold       = config->maxDelay;
+        lamConfig.event.source                = IfxIom_LamEventSource_monXorRef;
+        lamConfig.event.trigger               = IfxIom_LamEventTrigger_fallingEdge;
+        lamConfig.systemEventTriggerThreshold = config->eventThreshold;
+
+        result &= IfxIom_Driver_initLam(&monitor->outputs[i].lam, &lamConfig);
+    }
+
+    IfxIom_Driver_clearAllGlitch(&monitor->iom);
+    IfxIom_Driver_clearHistory(&monitor->iom);
+
+    return result;
+}
+
+
+void Ifx_PwmMonitor_initConfig(Ifx_PwmMonitor_Config *config)
+{
+    config->iom            = &MODULE_IOM;
+    config->pwmConfig      = NULL_PTR;
+    config->feedback       = NULL_PTR;
+    config->firstLam       = IfxIom_LamId_0;
+    config->maxDelay       = 1e-6;
+    config->filterTime     = 0.0;
+    config->eventThreshold = 1;
+}
+
+
+void Ifx_PwmMonitor_process(Ifx_PwmMonitor *monitor)
+{
+    uint16  history[4];
+    uint16  faulty  = 0;
+    boolean glitch  = FALSE;
+    uint32  entries = 0;
+    uint32  h;
+    uint8   i;
+
+    /* an event between the read and the clear is lost, it is still signalled by the SMU alarm */
+    IfxIom_Driver_getHistory(&monitor->iom, &history[0], &history[1], &history[2], &history[3]);
+    IfxIom_Driver_clearHistory(&monitor->iom);
+
+    for (h = 0; h < 4; h++)
+    {
+        if (history[h] != 0)
+        {
+            entries++;
+        }
+    }
+
+    for (i = 0; i < monitor->numOutputs; i++)
+    {
+        Ifx_PwmMonitor_Output *output = &monitor->outputs[i];
+        uint16                 mask   = (uint16)(1u << output->lam.channel);
+        boolean                rising;
+        boolean                falling;
+
+        for (h = 0; h < 4; h++)
+        {
+            if ((history[h] & mask) != 0)
+            {
+                output->events++;
+                faulty |= (uint16)(1u << i);
+            }
+        }
+
+        IfxIom_Driver_isLamMonGlitch(&output->lam, &rising, &falling);
+
+        if ((rising != FALSE) || (falling != FALSE))
+        {
+            output->glitches++;
+            glitch = TRUE;
+        }
+    }
+
+    if (glitch != FALSE)
+    {
+        IfxIom_Driver_clearAllGlitch(&monitor->iom);
+    }
+
+    monitor->summary.batches++;
+    monitor->summary.events       += entries;
+    monitor->summary.faultyOutputs = faulty;
+
+    if (entries != 0)
+    {
+        monitor->summary.faultyBatches++;
+    }
+
+    if (entries == 4)
+    {
+        monitor->summary.historyFull++;
+    }
+}
+
+
+void Ifx_PwmMonitor_reset(Ifx_PwmMonitor *monitor)
+{
+    uint8 i;
+
+    memset(&monitor->summary, 0, sizeof(monitor->summary));
+
+    for (i = 0; i < monitor->numOutputs; i++)
+    {
+        monitor->outputs[i].events   = 0;
+        monitor->outputs[i].glitches = 0;
+    }
+}
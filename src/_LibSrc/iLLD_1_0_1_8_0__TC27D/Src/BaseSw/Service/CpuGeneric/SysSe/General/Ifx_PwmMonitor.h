@@ -0,0 +1,147 @@
+/**
+ * \file Ifx_PwmMonitor.h
+ * \brief IOM based PWM output plausibility monitor
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_general_pwmmonitor PWM output monitor
+ * \ingroup library_srvsw_sysse_general
+ *
+ * The PWM monitor moves the plausibility check of PWM outputs against their feedback inputs to the IOM:
+ * - one IOM logic analyser module (LAM) per output of a \ref IfxGtm_Tom_PwmHl driver compares the TOM output
+ * (reference, GTM TOUT) with the feedback input (monitor). A mismatch lasting longer than maxDelay after an edge
+ * of the output generates a LAM event, which triggers the IOM system event (SMU alarm).
+ * - the event history of the event combiner (\ref IfxIom_Driver_getHistory()) and the glitch flags of the filters
+ * are collected in batches by \ref Ifx_PwmMonitor_process(), called from a slow task (e.g. every 10ms) instead of
+ * a software check at the PWM frequency, and summarized per output and overall.
+ *
+ * The event history holds the last 4 system events, \ref Ifx_PwmMonitor_Summary.historyFull counts the batches in
+ * which events may have been lost; the exact number of events is given by the SMU alarm.
+ *
+ * The IOM reference inputs reach GTM TOUT0 .. TOUT15 and TOUT107 .. TOUT109 only, the PWM pins shall be selected
+ * accordingly.
+ *
+ * Usage example:
+ * \code
+ * static const IfxIom_MonInput feedback[6] = {
+ *     IfxIom_MonInput_p33_0, IfxIom_MonInput_p33_1, IfxIom_MonInput_p33_2,   // ccx[0..2]
+ *     IfxIom_MonInput_p33_3, IfxIom_MonInput_p33_4, IfxIom_MonInput_p33_5,   // coutx[0..2]
+ * };
+ * static Ifx_PwmMonitor pwmMonitor;
+ *
+ * // initialisation, after IfxGtm_Tom_PwmHl_init(&pwm, &pwmConfig)
+ * Ifx_PwmMonitor_Config config;
+ * Ifx_PwmMonitor_initConfig(&config);
+ * config.pwmConfig = &pwmConfig;
+ * config.feedback  = feedback;
+ * config.maxDelay  = 2e-6;
+ * Ifx_PwmMonitor_init(&pwmMonitor, &config);
+ *
+ * // 10ms task
+ * Ifx_PwmMonitor_process(&pwmMonitor);
+ * if (Ifx_PwmMonitor_getSummary(&pwmMonitor)->faultyOutputs != 0) { ... }
+ * \endcode
+ *
+ */
+#ifndef IFX_PWMMONITOR_H
+#define IFX_PWMMONITOR_H 1
+
+#include "Cpu/Std/Ifx_Types.h"
+#include "Gtm/Tom/PwmHl/IfxGtm_Tom_PwmHl.h"
+#include "Iom/Driver/IfxIom_Driver.h"
+
+//----------------------------------------------------------------------------------------
+#define IFX_PWMMONITOR_MAX_OUTPUTS (2 * IFXGTM_TOM_PWMHL_MAX_NUM_CHANNELS)  /**<\brief Maximal number of monitored outputs */
+
+/** \addtogroup library_srvsw_sysse_general_pwmmonitor
+ * \{ */
+
+/** \brief Configuration */
+typedef struct
+{
+    Ifx_IOM                       *iom;             /**<\brief IOM module */
+    const IfxGtm_Tom_PwmHl_Config *pwmConfig;       /**<\brief configuration of the monitored PWM driver */
+    const IfxIom_MonInput         *feedback;        /**<\brief feedback input per output, ccx[] then coutx[] */
+    IfxIom_LamId                   firstLam;        /**<\brief first LAM, one LAM per output */
+    float32                        maxDelay;        /**<\brief maximal delay in seconds between an output edge and the feedback edge */
+    float32                        filterTime;      /**<\brief debounce filter time of the feedback inputs in seconds, 0 for none */
+    uint8                          eventThreshold;  /**<\brief number of LAM events which trigger the system event (1 .. 15) */
+} Ifx_PwmMonitor_Config;
+
+/** \brief Monitored output */
+typedef struct
+{
+    IfxIom_Driver_Lam lam;          /**<\brief LAM comparing the output and the feedback */
+    uint32            events;       /**<\brief number of system events triggered by the output */
+    uint32            glitches;     /**<\brief number of batches with glitches filtered on the feedback */
+} Ifx_PwmMonitor_Output;
+
+/** \brief Summary of the batches */
+typedef struct
+{
+    uint32 batches;         /**<\brief number of calls of \ref Ifx_PwmMonitor_process() */
+    uint32 faultyBatches;   /**<\brief number of batches with system events */
+    uint32 events;          /**<\brief number of system events in the history */
+    uint32 historyFull;     /**<\brief number of batches with a full history, events may be lost */
+    uint16 faultyOutputs;   /**<\brief outputs with events in the last batch, bit i for output i */
+} Ifx_PwmMonitor_Summary;
+
+/** \brief PWM monitor object */
+typedef struct
+{
+    IfxIom_Driver          iom;                                  /**<\brief IOM driver */
+    Ifx_PwmMonitor_Output  outputs[IFX_PWMMONITOR_MAX_OUTPUTS];  /**<\brief monitored outputs */
+    uint8                  numOutputs;                           /**<\brief number of monitored outputs */
+    Ifx_PwmMonitor_Summary summary;                              /**<\brief summary */
+} Ifx_PwmMonitor;
+
+/** \brief Returns the summary of the batches
+ * \param monitor Pointer to the PWM monitor object
+ * \return Returns the summary
+ */
+IFX_INLINE const Ifx_PwmMonitor_Summary *Ifx_PwmMonitor_getSummary(const Ifx_PwmMonitor *monitor)
+{
+    return &monitor->summary;
+}
+
+
+/** \brief Initialize the IOM and one LAM per output of the PWM driver
+ * \param monitor Pointer to the PWM monitor object
+ * \param config Pointer to the configuration
+ * \return Returns FALSE if an output is not connected to an IOM reference input, or if a LAM or an event counter is already used
+ */
+IFX_EXTERN boolean Ifx_PwmMonitor_init(Ifx_PwmMonitor *monitor, const Ifx_PwmMonitor_Config *config);
+
+/** \brief Initialize the configuration: MODULE_IOM, LAM 0, 1us delay, no filter, one event per system event
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_PwmMonitor_initConfig(Ifx_PwmMonitor_Config *config);
+
+/** \brief Collect and clear the event history and the glitch flags, and update the summary
+ * \param monitor Pointer to the PWM monitor object
+ */
+IFX_EXTERN void Ifx_PwmMonitor_process(Ifx_PwmMonitor *monitor);
+
+/** \brief Clear the summary and the counters of the outputs
+ * \param monitor Pointer to the PWM monitor object
+ */
+IFX_EXTERN void Ifx_PwmMonitor_reset(Ifx_PwmMonitor *monitor);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
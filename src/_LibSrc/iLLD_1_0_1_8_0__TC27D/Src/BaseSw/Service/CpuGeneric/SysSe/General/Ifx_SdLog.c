@@ -0,0 +1,193 @@
+/**
+ * \file Ifx_SdLog.c
+ * \brief Log structured record stream on a SD card
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+
+#include "Ifx_SdLog.h"
+#include <string.h>
+
+/** Blocks released by the driver since the log start
+ */
+static uint32 Ifx_SdLog_getReleasedTotal(const Ifx_SdLog *log)
+{
+    return Ifx_SdSpi_getReleasedTotal(log->sd) - log->releaseBase;
+}
+
+
+/** Write the header of the block being filled and publish it, called with the interrupts disabled
+ */
+static void Ifx_SdLog_close(Ifx_SdLog *log)
+{
+    uint32                 fillTotal = log->fillTotal;
+    uint8                 *block     = (uint8 *)log->blocks[fillTotal & (IFX_CFG_SDLOG_BUFFER_COUNT - 1)];
+    Ifx_SdLog_BlockHeader *header    = (Ifx_SdLog_BlockHeader *)block;
+
+    header->magic       = IFX_SDLOG_MAGIC;
+    header->sequence    = fillTotal;
+    header->size        = log->fillSize;
+    header->recordCount = log->fillRecords;
+
+    /* the unused rest reads as records of length 0 */
+    memset(&block[log->fillSize], 0, IFX_SDSPI_BLOCK_SIZE - log->fillSize);
+
+    __dsync();      /* The block must be complete before it is published */
+    log->fillTotal   = fillTotal + 1;
+    log->fillSize    = 0;
+    log->fillRecords = 0;
+}
+
+
+void Ifx_SdLog_flush(Ifx_SdLog *log)
+{
+    boolean interruptState = IfxCpu_disableInterrupts();
+
+    if (log->fillSize != 0)
+    {
+        Ifx_SdLog_close(log);
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+
+boolean Ifx_SdLog_init(Ifx_SdLog *log, const Ifx_SdLog_Config *config)
+{
+    log->sd          = config->sd;
+    log->blockCount  = config->blockCount;
+    log->releaseBase = Ifx_SdSpi_getReleasedTotal(config->sd);
+    log->fillTotal   = 0;
+    log->queueTotal  = 0;
+    log->fillSize    = 0;
+    log->fillRecords = 0;
+    log->recordCount = 0;
+    log->dropCount   = 0;
+    log->running     = Ifx_SdSpi_startWrite(config->sd, config->startBlock, config->blockCount);
+    log->stopped     = (log->running == FALSE);
+
+    return log->running;
+}
+
+
+void Ifx_SdLog_initConfig(Ifx_SdLog_Config *config, Ifx_SdSpi *sd)
+{
+    config->sd         = sd;
+    config->startBlock = 0x8000;
+    config->blockCount = 0x200000;
+}
+
+
+void Ifx_SdLog_process(Ifx_SdLog *log)
+{
+    uint32 fillTotal = log->fillTotal;
+
+    while ((log->queueTotal != fillTotal)
+           && (Ifx_SdSpi_writeBlock(log->sd, log->blocks[log->queueTotal & (IFX_CFG_SDLOG_BUFFER_COUNT - 1)]) != FALSE))
+    {
+        log->queueTotal++;
+    }
+
+    if (Ifx_SdSpi_getState(log->sd) == Ifx_SdSpi_State_error)
+    {
+        log->running = FALSE;
+        log->stopped = TRUE;
+    }
+    else if ((log->running == FALSE) && (log->stopped == FALSE) && (log->queueTotal == fillTotal))
+    {
+        Ifx_SdSpi_stopWrite(log->sd);
+        log->stopped = TRUE;
+    }
+
+    Ifx_SdSpi_process(log->sd);
+}
+
+
+void Ifx_SdLog_stop(Ifx_SdLog *log)
+{
+    boolean interruptState = IfxCpu_disableInterrupts();
+
+    log->running = FALSE;
+
+    if (log->fillSize != 0)
+    {
+        Ifx_SdLog_close(log);
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+
+boolean Ifx_SdLog_write(Ifx_SdLog *log, uint16 id, const void *data, uint16 length)
+{
+    uint16  size           = (uint16)(sizeof(Ifx_SdLog_RecordHeader) + ((length + 3u) & ~3u));
+    boolean result         = FALSE;
+    boolean interruptState = IfxCpu_disableInterrupts();
+
+    if ((log->running != FALSE) && (length <= IFX_SDLOG_RECORD_SIZE_MAX))
+    {
+        uint32 fillTotal;
+
+        if ((log->fillSize + size) > IFX_SDSPI_BLOCK_SIZE)
+        {
+            Ifx_SdLog_close(log);
+        }
+
+        fillTotal = log->fillTotal;
+
+        /* a new block is started when its buffer is released by the driver */
+        if (log->fillSize == 0)
+        {
+            if (fillTotal >= log->blockCount)
+            {
+                log->running = FALSE;   /* end of the log area */
+            }
+            else if ((fillTotal - Ifx_SdLog_getReleasedTotal(log)) < IFX_CFG_SDLOG_BUFFER_COUNT)
+            {
+                log->fillSize = sizeof(Ifx_SdLog_BlockHeader);
+            }
+        }
+
+        if (log->fillSize != 0)
+        {
+            uint8                  *block  = (uint8 *)log->blocks[fillTotal & (IFX_CFG_SDLOG_BUFFER_COUNT - 1)];
+            Ifx_SdLog_RecordHeader *header = (Ifx_SdLog_RecordHeader *)&block[log->fillSize];
+
+            header->length = length;
+            header->id     = id;
+            header->time   = nowFast32();
+            memcpy(&header[1], data, length);
+
+            log->fillSize = (uint16)(log->fillSize + size);
+            log->fillRecords++;
+            log->recordCount++;
+            result = TRUE;
+        }
+    }
+
+    if (result == FALSE)
+    {
+        log->dropCount++;
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return result;
+}
@@ -0,0 +1,177 @@
+/**
+ * \file Ifx_SdLog.h
+ * \brief Log structured record stream on a SD card
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_general_sdlog SD card data logger
+ * \ingroup library_srvsw_sysse_general
+ *
+ * The logger appends records of any size (CAN frames, VADC sample bursts, ...) to an area of a SD card.
+ * The card is written at its sustained rate only with full blocks in one multi-block write, the logger
+ * therefore batches the records:
+ * - \ref Ifx_SdLog_write() copies the record with its header into the block being filled and never waits.
+ * A record which does not fit closes the block, the next record goes into the next block buffer. If no block
+ * buffer is free (the card is slower than the producers), the record is dropped and counted.
+ * - \ref Ifx_SdLog_process() hands the full blocks to \ref library_srvsw_sysse_general_sdspi, which sends them
+ * with the DMA directly from the block buffers, and executes the driver steps.
+ * - \ref Ifx_SdLog_flush() closes the partial block, e.g. once per second, so that the records reach the card
+ * even at a low rate. The rest of the block is unused.
+ *
+ * Block layout (little endian): block header \ref Ifx_SdLog_BlockHeader, then the records, each made of a
+ * \ref Ifx_SdLog_RecordHeader and the data, padded to 4 bytes. The blocks are numbered from 0 in sequence:
+ * after a reset, the log end is the first block whose magic or sequence number does not follow.
+ *
+ * Restrictions:
+ * - \ref Ifx_SdLog_write() and \ref Ifx_SdLog_flush() may be called from any task or interrupt of the CPU
+ * which calls \ref Ifx_SdLog_process(). They disable the interrupts during the copy of the record.
+ * - the object shall be located in the DSPR of the CPU servicing the QSPI interrupts, or in a non cached memory.
+ * - the log ends at the end of the area, the next records are dropped.
+ *
+ * Usage example:
+ * \code
+ * enum {LOG_ID_CAN = 1, LOG_ID_VADC = 2};
+ *
+ * static Ifx_SdSpi sd;
+ * static Ifx_SdLog sdLog;
+ *
+ * // initialization, after Ifx_SdSpi_init()
+ * Ifx_SdLog_Config config;
+ * Ifx_SdLog_initConfig(&config, &sd);
+ * config.startBlock = 0x1000;
+ * config.blockCount = 0x100000;     // 512 MByte
+ * Ifx_SdLog_init(&sdLog, &config);
+ *
+ * // CAN receive interrupt
+ * Ifx_SdLog_write(&sdLog, LOG_ID_CAN, &frame, sizeof(frame));
+ *
+ * // VADC DMA half buffer interrupt
+ * Ifx_SdLog_write(&sdLog, LOG_ID_VADC, samples, sizeof(samples) / 2);
+ *
+ * // background loop
+ * Ifx_SdLog_process(&sdLog);
+ *
+ * // 1 s task
+ * Ifx_SdLog_flush(&sdLog);
+ * \endcode
+ *
+ */
+#ifndef IFX_SDLOG_H
+#define IFX_SDLOG_H 1
+
+#include "Ifx_SdSpi.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_SDLOG_BUFFER_COUNT)
+#define IFX_CFG_SDLOG_BUFFER_COUNT (2)          /**<\brief Number of block buffers, power of 2, at most IFX_CFG_SDSPI_QUEUE_LENGTH */
+#endif
+
+#define IFX_SDLOG_MAGIC            (0x31474C53u)  /**<\brief Magic number of the blocks: "SLG1" */
+
+/** \addtogroup library_srvsw_sysse_general_sdlog
+ * \{ */
+
+/** \brief Header of a block on the card */
+typedef struct
+{
+    uint32 magic;         /**<\brief IFX_SDLOG_MAGIC */
+    uint32 sequence;      /**<\brief block number since the log start */
+    uint16 size;          /**<\brief bytes used in the block, header included */
+    uint16 recordCount;   /**<\brief number of records in the block */
+} Ifx_SdLog_BlockHeader;
+
+/** \brief Header of a record on the card */
+typedef struct
+{
+    uint16 length;        /**<\brief length of the record data in bytes */
+    uint16 id;            /**<\brief record identifier, e.g. the source of the data */
+    uint32 time;          /**<\brief time of the record, \ref nowFast32() */
+} Ifx_SdLog_RecordHeader;
+
+/** \brief Maximal length of the record data in bytes */
+#define IFX_SDLOG_RECORD_SIZE_MAX  (IFX_SDSPI_BLOCK_SIZE - sizeof(Ifx_SdLog_BlockHeader) - sizeof(Ifx_SdLog_RecordHeader))
+
+/** \brief Logger configuration */
+typedef struct
+{
+    Ifx_SdSpi *sd;           /**<\brief SD card driver, initialized and idle */
+    uint32     startBlock;   /**<\brief block address of the log area */
+    uint32     blockCount;   /**<\brief size of the log area in blocks, pre-erased by the card */
+} Ifx_SdLog_Config;
+
+/** \brief Logger object */
+typedef struct
+{
+    uint32           blocks[IFX_CFG_SDLOG_BUFFER_COUNT][IFX_SDSPI_BLOCK_SIZE / 4]; /**<\brief block buffers */
+    Ifx_SdSpi       *sd;                                                          /**<\brief SD card driver */
+    uint32           blockCount;                                                  /**<\brief size of the log area in blocks */
+    uint32           releaseBase;                                                 /**<\brief blocks released by the driver before the log start */
+    volatile uint32  fillTotal;                                                   /**<\brief blocks closed since the log start, modified by the writers only */
+    uint32           queueTotal;                                                  /**<\brief blocks handed to the driver since the log start */
+    uint16           fillSize;                                                    /**<\brief bytes used in the block being filled, 0 if none */
+    uint16           fillRecords;                                                 /**<\brief records in the block being filled */
+    boolean          running;                                                     /**<\brief TRUE while the records are accepted */
+    boolean          stopped;                                                     /**<\brief TRUE when the end of the multi-block write is requested */
+    uint32           recordCount;                                                 /**<\brief records written since the log start */
+    uint32           dropCount;                                                   /**<\brief records dropped since the log start: no free block, log ended or too long */
+} Ifx_SdLog;
+
+/** \brief Close the partial block, it is written by the next \ref Ifx_SdLog_process()
+ * \param log Pointer to the logger object
+ */
+IFX_EXTERN void Ifx_SdLog_flush(Ifx_SdLog *log);
+
+/** \brief Start the log: multi-block write of the log area, blocking
+ * \param log Pointer to the logger object
+ * \param config Pointer to the configuration
+ * \return Returns FALSE if the multi-block write could not be started
+ */
+IFX_EXTERN boolean Ifx_SdLog_init(Ifx_SdLog *log, const Ifx_SdLog_Config *config);
+
+/** \brief Initialize the configuration: area of 1 GByte from block 0x8000
+ * \param config Pointer to the configuration
+ * \param sd SD card driver
+ */
+IFX_EXTERN void Ifx_SdLog_initConfig(Ifx_SdLog_Config *config, Ifx_SdSpi *sd);
+
+/** \brief Hand the full blocks to the driver and execute the driver steps, never waits
+ *
+ * Called periodically from a background task.
+ * \param log Pointer to the logger object
+ */
+IFX_EXTERN void Ifx_SdLog_process(Ifx_SdLog *log);
+
+/** \brief End the log: the partial block is closed, the multi-block write is ended once all blocks are written
+ * \param log Pointer to the logger object
+ */
+IFX_EXTERN void Ifx_SdLog_stop(Ifx_SdLog *log);
+
+/** \brief Append a record, never waits
+ *
+ * The data is copied, the buffer can be reused after the call.
+ * \param log Pointer to the logger object
+ * \param id Record identifier
+ * \param data Record data
+ * \param length Record length in bytes, at most IFX_SDLOG_RECORD_SIZE_MAX
+ * \return Returns FALSE if the record is dropped
+ */
+IFX_EXTERN boolean Ifx_SdLog_write(Ifx_SdLog *log, uint16 id, const void *data, uint16 length);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -0,0 +1,568 @@
+/**
+ * \file Ifx_SdSpi.c
+ * \brief SD card block driver over QSPI
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_SdSpi.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/*
+ * SPI mode commands (SD physical layer specification, simplified version). The CRC is only checked for CMD0
+ * and CMD8, the other commands are sent with a dummy CRC.
+ */
+#define IFX_SDSPI_CMD0_GO_IDLE_STATE        (0)
+#define IFX_SDSPI_CMD8_SEND_IF_COND         (8)
+#define IFX_SDSPI_CMD9_SEND_CSD             (9)
+#define IFX_SDSPI_CMD16_SET_BLOCKLEN        (16)
+#define IFX_SDSPI_CMD17_READ_SINGLE_BLOCK   (17)
+#define IFX_SDSPI_CMD25_WRITE_MULTIPLE      (25)
+#define IFX_SDSPI_CMD55_APP_CMD             (55)
+#define IFX_SDSPI_CMD58_READ_OCR            (58)
+#define IFX_SDSPI_ACMD23_SET_WR_BLK_ERASE   (23)
+#define IFX_SDSPI_ACMD41_SD_SEND_OP_COND    (41)
+
+#define IFX_SDSPI_R1_IDLE                   (0x01u)
+#define IFX_SDSPI_R1_ILLEGAL_COMMAND        (0x04u)
+#define IFX_SDSPI_R1_TIMEOUT                (0xFFu)    /* no response within NCR */
+#define IFX_SDSPI_NCR_MAX                   (8)        /* bytes between a command and its response */
+
+#define IFX_SDSPI_TOKEN_START_BLOCK         (0xFEu)    /* single block read */
+#define IFX_SDSPI_TOKEN_START_MULTIPLE      (0xFCu)    /* block of a multi-block write */
+#define IFX_SDSPI_TOKEN_STOP_TRANSMISSION   (0xFDu)
+#define IFX_SDSPI_DATA_RESPONSE_MASK        (0x1Fu)
+#define IFX_SDSPI_DATA_RESPONSE_ACCEPTED    (0x05u)
+
+#define IFX_SDSPI_OCR_CCS                   (0x40000000u)  /* card capacity status: block addresses */
+#define IFX_SDSPI_ACMD41_HCS                (0x40000000u)  /* host supports high capacity cards */
+#define IFX_SDSPI_IF_COND_ARGUMENT          (0x000001AAu)  /* 2.7-3.6 V, check pattern 0xAA */
+
+/** Programming time of a block: 250 ms for SDHC, 500 ms for SDXC */
+#define IFX_SDSPI_WRITE_TIMEOUT             (TimeConst_100ms * 5)
+
+/** Exchange on the command channel, blocking
+ */
+static void Ifx_SdSpi_transfer(Ifx_SdSpi *sd, const void *src, void *dest, Ifx_SizeT count)
+{
+    while (IfxQspi_SpiMaster_exchange(&sd->command, src, dest, count) == SpiIf_Status_busy)
+    {}
+
+    while (IfxQspi_SpiMaster_getStatus(&sd->command) == SpiIf_Status_busy)
+    {}
+}
+
+
+static uint8 Ifx_SdSpi_receiveByte(Ifx_SdSpi *sd)
+{
+    uint8 data;
+    Ifx_SdSpi_transfer(sd, NULL_PTR, &data, 1);
+    return data;
+}
+
+
+static void Ifx_SdSpi_select(Ifx_SdSpi *sd)
+{
+    IfxPort_setPinLow(sd->command.slso.port, sd->command.slso.pinIndex);
+}
+
+
+/** Release the chip select, then 8 clocks so that the card releases its data output
+ */
+static void Ifx_SdSpi_deselect(Ifx_SdSpi *sd)
+{
+    IfxPort_setPinHigh(sd->command.slso.port, sd->command.slso.pinIndex);
+    Ifx_SdSpi_transfer(sd, NULL_PTR, NULL_PTR, 1);
+}
+
+
+/** Wait until the card does not signal busy any more
+ */
+static boolean Ifx_SdSpi_waitReady(Ifx_SdSpi *sd, Ifx_TickTime timeout)
+{
+    Ifx_TickTime deadLine = getDeadLine(timeout);
+
+    while (Ifx_SdSpi_receiveByte(sd) != 0xFFu)
+    {
+        if (isDeadLine(deadLine) != FALSE)
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+
+/** Send a command on the selected card and return its R1 response
+ */
+static uint8 Ifx_SdSpi_command(Ifx_SdSpi *sd, uint8 index, uint32 argument)
+{
+    uint8 r1 = IFX_SDSPI_R1_TIMEOUT;
+    uint8 i;
+
+    if ((index != IFX_SDSPI_CMD0_GO_IDLE_STATE) && (Ifx_SdSpi_waitReady(sd, IFX_SDSPI_WRITE_TIMEOUT) == FALSE))
+    {
+        return r1;
+    }
+
+    sd->frame[0] = (uint8)(0x40u | index);
+    sd->frame[1] = (uint8)(argument >> 24);
+    sd->frame[2] = (uint8)(argument >> 16);
+    sd->frame[3] = (uint8)(argument >> 8);
+    sd->frame[4] = (uint8)argument;
+    sd->frame[5] = (index == IFX_SDSPI_CMD0_GO_IDLE_STATE) ? 0x95u : ((index == IFX_SDSPI_CMD8_SEND_IF_COND) ? 0x87u : 0x01u);
+    Ifx_SdSpi_transfer(sd, sd->frame, NULL_PTR, 6);
+
+    for (i = 0; (i < IFX_SDSPI_NCR_MAX) && ((r1 & 0x80u) != 0); i++)
+    {
+        r1 = Ifx_SdSpi_receiveByte(sd);
+    }
+
+    return r1;
+}
+
+
+static uint8 Ifx_SdSpi_appCommand(Ifx_SdSpi *sd, uint8 index, uint32 argument)
+{
+    uint8 r1 = Ifx_SdSpi_command(sd, IFX_SDSPI_CMD55_APP_CMD, 0);
+
+    if (r1 <= IFX_SDSPI_R1_IDLE)
+    {
+        r1 = Ifx_SdSpi_command(sd, index, argument);
+    }
+
+    return r1;
+}
+
+
+/** Receive the 4 bytes following a R3 / R7 response
+ */
+static uint32 Ifx_SdSpi_receiveWord(Ifx_SdSpi *sd)
+{
+    Ifx_SdSpi_transfer(sd, NULL_PTR, sd->frame, 4);
+    return ((uint32)sd->frame[0] << 24) | ((uint32)sd->frame[1] << 16) | ((uint32)sd->frame[2] << 8) | sd->frame[3];
+}
+
+
+/** Receive a data block after a read command: start token, data, CRC (ignored)
+ */
+static boolean Ifx_SdSpi_receiveData(Ifx_SdSpi *sd, void *data, Ifx_SizeT count)
+{
+    Ifx_TickTime deadLine = getDeadLine(TimeConst_100ms);
+    uint8        token;
+
+    do
+    {
+        token = Ifx_SdSpi_receiveByte(sd);
+
+        if (isDeadLine(deadLine) != FALSE)
+        {
+            return FALSE;
+        }
+    } while (token == 0xFFu);
+
+    if (token != IFX_SDSPI_TOKEN_START_BLOCK)
+    {
+        return FALSE;
+    }
+
+    Ifx_SdSpi_transfer(sd, NULL_PTR, data, count);
+    Ifx_SdSpi_transfer(sd, NULL_PTR, NULL_PTR, 2);
+
+    return TRUE;
+}
+
+
+/** Card capacity in blocks from the CSD register (version 1.0 for SDSC, 2.0 for SDHC / SDXC)
+ */
+static uint32 Ifx_SdSpi_getCapacity(const uint8 *csd)
+{
+    uint32 capacity;
+
+    if ((csd[0] >> 6) == 1)
+    {
+        uint32 size = ((uint32)(csd[7] & 0x3Fu) << 16) | ((uint32)csd[8] << 8) | csd[9];
+        capacity = (size + 1) << 10;
+    }
+    else
+    {
+        uint32 readBlockLength = csd[5] & 0x0Fu;
+        uint32 size            = ((uint32)(csd[6] & 0x03u) << 10) | ((uint32)csd[7] << 2) | ((uint32)csd[8] >> 6);
+        uint32 multiplier      = ((uint32)(csd[9] & 0x03u) << 1) | ((uint32)csd[10] >> 7);
+        capacity = (size + 1) << (multiplier + 2 + readBlockLength - 9);
+    }
+
+    return capacity;
+}
+
+
+/** Card identification, the card is selected
+ */
+static boolean Ifx_SdSpi_identify(Ifx_SdSpi *sd)
+{
+    boolean      version2 = FALSE;
+    uint32       ocr      = 0;
+    Ifx_TickTime deadLine;
+    uint8        r1;
+    uint8        retry;
+
+    for (retry = 0, r1 = IFX_SDSPI_R1_TIMEOUT; (retry < 10) && (r1 != IFX_SDSPI_R1_IDLE); retry++)
+    {
+        r1 = Ifx_SdSpi_command(sd, IFX_SDSPI_CMD0_GO_IDLE_STATE, 0);
+    }
+
+    if (r1 != IFX_SDSPI_R1_IDLE)
+    {
+        return FALSE;
+    }
+
+    r1 = Ifx_SdSpi_command(sd, IFX_SDSPI_CMD8_SEND_IF_COND, IFX_SDSPI_IF_COND_ARGUMENT);
+
+    if (r1 == IFX_SDSPI_R1_IDLE)
+    {
+        if ((Ifx_SdSpi_receiveWord(sd) & 0xFFFu) != IFX_SDSPI_IF_COND_ARGUMENT)
+        {
+            return FALSE;   /* voltage range not supported */
+        }
+
+        version2 = TRUE;
+    }
+    else if ((r1 & IFX_SDSPI_R1_ILLEGAL_COMMAND) == 0)
+    {
+        return FALSE;
+    }
+
+    /* the initialization takes up to 1 s */
+    deadLine = getDeadLine(TimeConst_1s);
+
+    do
+    {
+        r1 = Ifx_SdSpi_appCommand(sd, IFX_SDSPI_ACMD41_SD_SEND_OP_COND, version2 ? IFX_SDSPI_ACMD41_HCS : 0);
+
+        if ((r1 > IFX_SDSPI_R1_IDLE) || (isDeadLine(deadLine) != FALSE))
+        {
+            return FALSE;
+        }
+    } while (r1 != 0);
+
+    if (version2)
+    {
+        if (Ifx_SdSpi_command(sd, IFX_SDSPI_CMD58_READ_OCR, 0) != 0)
+        {
+            return FALSE;
+        }
+
+        ocr = Ifx_SdSpi_receiveWord(sd);
+    }
+
+    sd->highCapacity = (ocr & IFX_SDSPI_OCR_CCS) != 0;
+
+    if ((sd->highCapacity == FALSE) && (Ifx_SdSpi_command(sd, IFX_SDSPI_CMD16_SET_BLOCKLEN, IFX_SDSPI_BLOCK_SIZE) != 0))
+    {
+        return FALSE;
+    }
+
+    if ((Ifx_SdSpi_command(sd, IFX_SDSPI_CMD9_SEND_CSD, 0) != 0) || (Ifx_SdSpi_receiveData(sd, sd->frame, 16) == FALSE))
+    {
+        return FALSE;
+    }
+
+    sd->capacity = Ifx_SdSpi_getCapacity(sd->frame);
+
+    return TRUE;
+}
+
+
+/** Address argument of the read and write commands
+ */
+static uint32 Ifx_SdSpi_getArgument(const Ifx_SdSpi *sd, uint32 address)
+{
+    return sd->highCapacity ? address : (address * IFX_SDSPI_BLOCK_SIZE);
+}
+
+
+/** Queue the jobs of the oldest queued block: start token, data, CRC and data response, first busy poll
+ */
+static void Ifx_SdSpi_startBlock(Ifx_SdSpi *sd)
+{
+    const uint32 *block = sd->queue[sd->readTotal & (IFX_CFG_SDSPI_QUEUE_LENGTH - 1)];
+
+    IfxQspi_SpiMaster_initJob(&sd->tokenJob, &sd->command, &sd->token[0], NULL_PTR, 2);
+    IfxQspi_SpiMaster_initJob(&sd->blockJob, &sd->data, block, NULL_PTR, IFX_SDSPI_BLOCK_SIZE);
+    IfxQspi_SpiMaster_initJob(&sd->responseJob, &sd->command, NULL_PTR, sd->response, sizeof(sd->response));
+    IfxQspi_SpiMaster_initJob(&sd->busyJob, &sd->command, NULL_PTR, sd->busy, IFX_CFG_SDSPI_BUSY_POLL_SIZE);
+
+    IfxQspi_SpiMaster_queueJob(&sd->tokenJob);
+    IfxQspi_SpiMaster_queueJob(&sd->blockJob);
+    IfxQspi_SpiMaster_queueJob(&sd->responseJob);
+    IfxQspi_SpiMaster_queueJob(&sd->busyJob);
+
+    sd->busyStart = nowFast32();
+    sd->deadLine  = getDeadLine(IFX_SDSPI_WRITE_TIMEOUT);
+    sd->state     = Ifx_SdSpi_State_block;
+}
+
+
+/** Queue the stop token and the first busy poll
+ */
+static void Ifx_SdSpi_startStop(Ifx_SdSpi *sd)
+{
+    IfxQspi_SpiMaster_initJob(&sd->tokenJob, &sd->command, &sd->token[2], NULL_PTR, 2);
+    IfxQspi_SpiMaster_initJob(&sd->busyJob, &sd->command, NULL_PTR, sd->busy, IFX_CFG_SDSPI_BUSY_POLL_SIZE);
+
+    IfxQspi_SpiMaster_queueJob(&sd->tokenJob);
+    IfxQspi_SpiMaster_queueJob(&sd->busyJob);
+
+    sd->deadLine = getDeadLine(IFX_SDSPI_WRITE_TIMEOUT);
+    sd->state    = Ifx_SdSpi_State_stop;
+}
+
+
+/** Return TRUE when the card released its data output (not busy), else queue the next busy poll until the timeout
+ */
+static boolean Ifx_SdSpi_pollReady(Ifx_SdSpi *sd, boolean timeout)
+{
+    boolean ready = sd->busy[IFX_CFG_SDSPI_BUSY_POLL_SIZE - 1] == 0xFFu;
+
+    if ((ready == FALSE) && (timeout == FALSE))
+    {
+        IfxQspi_SpiMaster_queueJob(&sd->busyJob);
+    }
+
+    return ready;
+}
+
+
+boolean Ifx_SdSpi_init(Ifx_SdSpi *sd, const Ifx_SdSpi_Config *config)
+{
+    IfxQspi_SpiMaster_ChannelConfig chConfig;
+    boolean                         result;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, config->spi->dma.useDma);
+
+    sd->state        = Ifx_SdSpi_State_error;
+    sd->highCapacity = FALSE;
+    sd->stopRequest  = FALSE;
+    sd->failed       = FALSE;
+    sd->capacity     = 0;
+    sd->baudrate     = config->baudrate;
+    sd->writeTotal   = 0;
+    sd->readTotal    = 0;
+    sd->busyTimeMax  = 0;
+    sd->blockCount   = 0;
+    sd->errorCount   = 0;
+    sd->token[0]     = 0xFFu;
+    sd->token[1]     = IFX_SDSPI_TOKEN_START_MULTIPLE;
+    sd->token[2]     = IFX_SDSPI_TOKEN_STOP_TRANSMISSION;
+    sd->token[3]     = 0xFFu;
+
+    /* SPI mode 0, chip select as general purpose output */
+    IfxQspi_SpiMaster_initChannelConfig(&chConfig, config->spi);
+    chConfig.base.baudrate        = IFX_SDSPI_INIT_BAUDRATE;
+    chConfig.base.mode.autoCS     = 0;
+    chConfig.base.mode.shiftClock = SpiIf_ShiftClock_shiftTransmitDataOnTrailingEdge;
+    chConfig.sls.output.pin       = config->cs;
+    chConfig.sls.output.driver    = config->csDriver;
+    IfxQspi_SpiMaster_initChannel(&sd->command, &chConfig);
+
+    chConfig.mode = IfxQspi_SpiMaster_Mode_xxl;
+    IfxQspi_SpiMaster_initChannel(&sd->data, &chConfig);
+
+    /* the chip select is held by the driver over several exchanges */
+    sd->command.activateSlso   = NULL_PTR;
+    sd->command.deactivateSlso = NULL_PTR;
+    sd->data.activateSlso      = NULL_PTR;
+    sd->data.deactivateSlso    = NULL_PTR;
+
+    /* at least 74 clocks with the chip select inactive: the card enters the SPI mode with the next CMD0 */
+    Ifx_SdSpi_transfer(sd, NULL_PTR, NULL_PTR, 10);
+
+    Ifx_SdSpi_select(sd);
+    result = Ifx_SdSpi_identify(sd);
+    Ifx_SdSpi_deselect(sd);
+
+    if (result != FALSE)
+    {
+        IfxQspi_SpiMaster_setChannelBaudrate(&sd->command, config->baudrate);
+        IfxQspi_SpiMaster_setChannelBaudrate(&sd->data, config->baudrate);
+        sd->state = Ifx_SdSpi_State_idle;
+    }
+
+    return result;
+}
+
+
+void Ifx_SdSpi_initConfig(Ifx_SdSpi_Config *config, IfxQspi_SpiMaster *spi)
+{
+    config->spi      = spi;
+    config->cs       = NULL_PTR;
+    config->csDriver = IfxPort_PadDriver_cmosAutomotiveSpeed1;
+    config->baudrate = 25000000.0f;
+}
+
+
+void Ifx_SdSpi_process(Ifx_SdSpi *sd)
+{
+    switch (sd->state)
+    {
+    case Ifx_SdSpi_State_write:
+
+        if (sd->writeTotal != sd->readTotal)
+        {
+            Ifx_SdSpi_startBlock(sd);
+        }
+        else if (sd->stopRequest != FALSE)
+        {
+            Ifx_SdSpi_startStop(sd);
+        }
+
+        break;
+
+    case Ifx_SdSpi_State_block:
+
+        if (IfxQspi_SpiMaster_isJobDone(&sd->busyJob) != FALSE)
+        {
+            boolean accepted = (sd->response[2] & IFX_SDSPI_DATA_RESPONSE_MASK) == IFX_SDSPI_DATA_RESPONSE_ACCEPTED;
+            boolean timeout  = isDeadLine(sd->deadLine);
+
+            if ((accepted != FALSE) && (Ifx_SdSpi_pollReady(sd, timeout) != FALSE))
+            {
+                sd->busyTimeMax = __maxu(sd->busyTimeMax, elapsedFast32(sd->busyStart));
+                sd->blockCount++;
+                sd->readTotal++;
+
+                if (sd->writeTotal != sd->readTotal)
+                {
+                    Ifx_SdSpi_startBlock(sd);
+                }
+                else
+                {
+                    sd->state = Ifx_SdSpi_State_write;
+                }
+            }
+            else if ((accepted == FALSE) || (timeout != FALSE))
+            {
+                /* the queued blocks are discarded, the multi-block write is ended */
+                sd->errorCount += sd->writeTotal - sd->readTotal;
+                sd->readTotal   = sd->writeTotal;
+                sd->failed      = TRUE;
+                Ifx_SdSpi_startStop(sd);
+            }
+        }
+
+        break;
+
+    case Ifx_SdSpi_State_stop:
+
+        if (IfxQspi_SpiMaster_isJobDone(&sd->busyJob) != FALSE)
+        {
+            boolean timeout = isDeadLine(sd->deadLine);
+
+            if ((Ifx_SdSpi_pollReady(sd, timeout) != FALSE) || (timeout != FALSE))
+            {
+                Ifx_SdSpi_deselect(sd);
+                sd->stopRequest = FALSE;
+                sd->state       = (sd->failed || timeout) ? Ifx_SdSpi_State_error : Ifx_SdSpi_State_idle;
+            }
+        }
+
+        break;
+
+    default:
+        break;
+    }
+}
+
+
+boolean Ifx_SdSpi_read(Ifx_SdSpi *sd, uint32 address, uint32 *block)
+{
+    boolean result = FALSE;
+
+    if (sd->state == Ifx_SdSpi_State_idle)
+    {
+        Ifx_SdSpi_select(sd);
+
+        if (Ifx_SdSpi_command(sd, IFX_SDSPI_CMD17_READ_SINGLE_BLOCK, Ifx_SdSpi_getArgument(sd, address)) == 0)
+        {
+            result = Ifx_SdSpi_receiveData(sd, block, IFX_SDSPI_BLOCK_SIZE);
+        }
+
+        Ifx_SdSpi_deselect(sd);
+    }
+
+    return result;
+}
+
+
+boolean Ifx_SdSpi_startWrite(Ifx_SdSpi *sd, uint32 address, uint32 preEraseCount)
+{
+    boolean result = FALSE;
+
+    if (sd->state == Ifx_SdSpi_State_idle)
+    {
+        Ifx_SdSpi_select(sd);
+
+        /* the pre-erase is a hint only, a card which rejects it is still written */
+        if (preEraseCount != 0)
+        {
+            Ifx_SdSpi_appCommand(sd, IFX_SDSPI_ACMD23_SET_WR_BLK_ERASE, __minu(preEraseCount, 0x7FFFFFu));
+        }
+
+        if (Ifx_SdSpi_command(sd, IFX_SDSPI_CMD25_WRITE_MULTIPLE, Ifx_SdSpi_getArgument(sd, address)) == 0)
+        {
+            sd->stopRequest = FALSE;
+            sd->failed      = FALSE;
+            sd->state       = Ifx_SdSpi_State_write;
+            result          = TRUE;
+        }
+        else
+        {
+            Ifx_SdSpi_deselect(sd);
+        }
+    }
+
+    return result;
+}
+
+
+void Ifx_SdSpi_stopWrite(Ifx_SdSpi *sd)
+{
+    if ((sd->state == Ifx_SdSpi_State_write) || (sd->state == Ifx_SdSpi_State_block))
+    {
+        sd->stopRequest = TRUE;
+    }
+}
+
+
+boolean Ifx_SdSpi_writeBlock(Ifx_SdSpi *sd, const uint32 *block)
+{
+    boolean result = FALSE;
+
+    if (((sd->state == Ifx_SdSpi_State_write) || (sd->state == Ifx_SdSpi_State_block))
+        && (sd->stopRequest == FALSE)
+        && ((sd->writeTotal - sd->readTotal) < IFX_CFG_SDSPI_QUEUE_LENGTH))
+    {
+        sd->queue[sd->writeTotal & (IFX_CFG_SDSPI_QUEUE_LENGTH - 1)] = block;
+        sd->writeTotal++;
+        result = TRUE;
+    }
+
+    return result;
+}
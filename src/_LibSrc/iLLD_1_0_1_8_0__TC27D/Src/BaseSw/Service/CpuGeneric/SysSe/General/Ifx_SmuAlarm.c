@@ -0,0 +1,177 @@
+/**
+ * \file Ifx_SmuAlarm.c
+ * \brief SMU alarm dispatcher
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_SmuAlarm.h"
+#include "Scu/Std/IfxScuWdt.h"
+#include <string.h>
+
+/** Read all alarm groups, clear the read alarms and add them to the pending alarms. Returns the read alarms
+ */
+static void Ifx_SmuAlarm_readStatus(Ifx_SmuAlarm *smuAlarm, uint32 *status)
+{
+    Ifx_SMU *smu      = smuAlarm->smu;
+    uint16   password = IfxScuWdt_getSafetyWatchdogPassword();
+    uint32   group;
+
+    for (group = 0; group < IFX_SMUALARM_NUM_GROUPS; group++)
+    {
+        status[group] = smu->AG[group].U;
+    }
+
+    /* one safety endinit window for all groups, each write is enabled by the alarm status clear command */
+    IfxScuWdt_clearSafetyEndinit(password);
+
+    for (group = 0; group < IFX_SMUALARM_NUM_GROUPS; group++)
+    {
+        if (status[group] != 0)
+        {
+            IfxSmu_enableClearAlarmStatus(smu);
+            smu->AG[group].U          = status[group];
+            smuAlarm->pending[group] |= status[group];
+        }
+    }
+
+    IfxScuWdt_setSafetyEndinit(password);
+}
+
+
+void Ifx_SmuAlarm_init(Ifx_SmuAlarm *smuAlarm, Ifx_SMU *smu, uint8 maxDispatch)
+{
+    memset(smuAlarm, 0, sizeof(*smuAlarm));
+    smuAlarm->smu         = smu;
+    smuAlarm->maxDispatch = (maxDispatch != 0) ? maxDispatch : 1;
+}
+
+
+boolean Ifx_SmuAlarm_isPending(const Ifx_SmuAlarm *smuAlarm)
+{
+    boolean result = FALSE;
+    uint32  group;
+
+    for (group = 0; group < IFX_SMUALARM_NUM_GROUPS; group++)
+    {
+        if (smuAlarm->pending[group] != 0)
+        {
+            result = TRUE;
+            break;
+        }
+    }
+
+    return result;
+}
+
+
+void Ifx_SmuAlarm_process(Ifx_SmuAlarm *smuAlarm)
+{
+    Ifx_TickTime start      = now();
+    uint32       status[IFX_SMUALARM_NUM_GROUPS];
+    uint32       budget     = smuAlarm->maxDispatch;
+    boolean      oldPending = Ifx_SmuAlarm_isPending(smuAlarm);
+    boolean      oldLeft    = FALSE;
+    Ifx_TickTime duration;
+    uint32       group;
+
+    Ifx_SmuAlarm_readStatus(smuAlarm, status);
+
+    for (group = 0; group < IFX_SMUALARM_NUM_GROUPS; group++)
+    {
+        uint32 pending = smuAlarm->pending[group];
+
+        while ((pending != 0) && (budget != 0))
+        {
+            uint32              index    = 31 - __clz(pending);
+            uint32              mask     = 1u << index;
+            Ifx_SmuAlarm_Entry *entry    = &smuAlarm->entries[group][index];
+            IfxSmu_Alarm        alarm    = (IfxSmu_Alarm)((group << 8) | index);
+            Ifx_TickTime        reaction = now() - ((((status[group] & mask) != 0) || (oldPending == FALSE)) ? start : smuAlarm->pendingTime);
+
+            pending &= ~mask;
+            entry->count++;
+
+            if (entry->handler != NULL_PTR)
+            {
+                entry->handler(entry->data, alarm);
+            }
+            else if (smuAlarm->defaultHandler != NULL_PTR)
+            {
+                smuAlarm->defaultHandler(smuAlarm->defaultData, alarm);
+            }
+
+            smuAlarm->statistics.dispatched++;
+            smuAlarm->statistics.reactionSum += reaction;
+
+            if (reaction > smuAlarm->statistics.reactionMax)
+            {
+                smuAlarm->statistics.reactionMax = reaction;
+            }
+
+            budget--;
+        }
+
+        smuAlarm->pending[group] = pending;
+
+        if ((pending & ~status[group]) != 0)
+        {
+            oldLeft = TRUE;
+        }
+    }
+
+    if (Ifx_SmuAlarm_isPending(smuAlarm) != FALSE)
+    {
+        smuAlarm->statistics.postponed++;
+
+        if (oldLeft == FALSE)
+        {
+            /* the oldest pending alarms are the ones read by this call */
+            smuAlarm->pendingTime = start;
+        }
+    }
+
+    smuAlarm->statistics.passes++;
+    duration = now() - start;
+
+    if (duration > smuAlarm->statistics.processMax)
+    {
+        smuAlarm->statistics.processMax = duration;
+    }
+}
+
+
+void Ifx_SmuAlarm_setDefaultHandler(Ifx_SmuAlarm *smuAlarm, Ifx_SmuAlarm_Handler handler, void *data)
+{
+    smuAlarm->defaultHandler = handler;
+    smuAlarm->defaultData    = data;
+}
+
+
+void Ifx_SmuAlarm_setHandler(Ifx_SmuAlarm *smuAlarm, IfxSmu_Alarm alarm, Ifx_SmuAlarm_Handler handler, void *data)
+{
+    uint32 group = ((uint32)alarm >> 8) & 0xFF;
+    uint32 index = (uint32)alarm & 0x1F;
+
+    if (group < IFX_SMUALARM_NUM_GROUPS)
+    {
+        smuAlarm->entries[group][index].handler = handler;
+        smuAlarm->entries[group][index].data    = data;
+    }
+}
@@ -0,0 +1,150 @@
+/**
+ * \file Ifx_SmuAlarm.h
+ * \brief SMU alarm dispatcher
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_general_smualarm SMU alarm dispatcher
+ * \ingroup library_srvsw_sysse_general
+ *
+ * The dispatcher handles the SMU alarms signalled by interrupt (IfxSmu_AlarmConfig_interruptSetx):
+ * - all alarm groups (SMU_AGx) are read in one pass and the read alarms are cleared at once, so that an
+ * alarm occurring again during the processing is signalled again.
+ * - the alarms are dispatched to the handlers registered per alarm (group and bit), highest bit first with
+ * count leading zeros. Alarms without handler go to the default handler.
+ * - at most maxDispatch handlers are called per call of \ref Ifx_SmuAlarm_process(), the remaining alarms stay
+ * pending for the next call. An alarm storm (e.g. correctable ECC errors) is collapsed into one pending bit per
+ * alarm and cannot starve the application.
+ *
+ * The statistics hold the number of occurrences of each alarm, and the reaction time: from the start of the
+ * processing (SMU interrupt) to the call of the handler. The reaction time includes the time the alarm waited as
+ * pending when the budget was exhausted.
+ *
+ * Usage example:
+ * \code
+ * static Ifx_SmuAlarm smuAlarm;
+ *
+ * // initialisation
+ * Ifx_SmuAlarm_init(&smuAlarm, &MODULE_SMU, 8);
+ * Ifx_SmuAlarm_setHandler(&smuAlarm, IfxSmu_Alarm_Cpu0UnifiedDcacheDsprSingleBitCorrection, &eccCorrected, NULL_PTR);
+ * Ifx_SmuAlarm_setDefaultHandler(&smuAlarm, &safetyReaction, NULL_PTR);
+ *
+ * // SMU interrupt, and background loop to finish the pending alarms
+ * Ifx_SmuAlarm_process(&smuAlarm);
+ * \endcode
+ *
+ */
+#ifndef IFX_SMUALARM_H
+#define IFX_SMUALARM_H 1
+
+#include "Cpu/Std/Ifx_Types.h"
+#include "Smu/Std/IfxSmu.h"
+#include "SysSe/Bsp/Bsp.h"
+
+//----------------------------------------------------------------------------------------
+#define IFX_SMUALARM_NUM_GROUPS (IfxSmu_AlarmGroup_6 + 1)  /**<\brief Number of alarm groups */
+
+/** \addtogroup library_srvsw_sysse_general_smualarm
+ * \{ */
+
+/** \brief Alarm handler
+ * \param data Data registered with the handler
+ * \param alarm Alarm
+ */
+typedef void (*Ifx_SmuAlarm_Handler)(void *data, IfxSmu_Alarm alarm);
+
+/** \brief Handler and statistics of one alarm */
+typedef struct
+{
+    Ifx_SmuAlarm_Handler handler;  /**<\brief handler, NULL_PTR for the default handler */
+    void                *data;     /**<\brief data given to the handler */
+    uint32               count;    /**<\brief number of occurrences */
+} Ifx_SmuAlarm_Entry;
+
+/** \brief Statistics of the dispatcher */
+typedef struct
+{
+    uint32       passes;           /**<\brief number of calls of \ref Ifx_SmuAlarm_process() */
+    uint32       dispatched;       /**<\brief number of handler calls */
+    uint32       postponed;        /**<\brief number of calls leaving pending alarms for the next call */
+    Ifx_TickTime reactionMax;      /**<\brief maximal reaction time */
+    Ifx_TickTime reactionSum;      /**<\brief sum of the reaction times, for the average */
+    Ifx_TickTime processMax;       /**<\brief maximal duration of \ref Ifx_SmuAlarm_process() */
+} Ifx_SmuAlarm_Statistics;
+
+/** \brief SMU alarm dispatcher object */
+typedef struct
+{
+    Ifx_SMU                *smu;                                   /**<\brief SMU module */
+    Ifx_SmuAlarm_Entry      entries[IFX_SMUALARM_NUM_GROUPS][32];  /**<\brief handlers per group and bit */
+    Ifx_SmuAlarm_Handler    defaultHandler;                        /**<\brief handler of the alarms without handler */
+    void                   *defaultData;                           /**<\brief data given to the default handler */
+    uint32                  pending[IFX_SMUALARM_NUM_GROUPS];      /**<\brief alarms read and not dispatched yet */
+    Ifx_TickTime            pendingTime;                           /**<\brief start of the processing which read the oldest pending alarm */
+    uint8                   maxDispatch;                           /**<\brief maximal number of handler calls per processing */
+    Ifx_SmuAlarm_Statistics statistics;                            /**<\brief statistics */
+} Ifx_SmuAlarm;
+
+/** \brief Returns the average reaction time
+ * \param smuAlarm Pointer to the dispatcher object
+ * \return Returns the average reaction time in ticks, 0 if no alarm was dispatched
+ */
+IFX_INLINE Ifx_TickTime Ifx_SmuAlarm_getReactionAverage(const Ifx_SmuAlarm *smuAlarm)
+{
+    return (smuAlarm->statistics.dispatched != 0) ? (smuAlarm->statistics.reactionSum / smuAlarm->statistics.dispatched) : 0;
+}
+
+
+/** \brief Initialize the dispatcher, no handler is registered
+ * \param smuAlarm Pointer to the dispatcher object
+ * \param smu Pointer to the SMU module
+ * \param maxDispatch Maximal number of handler calls per call of \ref Ifx_SmuAlarm_process()
+ */
+IFX_EXTERN void Ifx_SmuAlarm_init(Ifx_SmuAlarm *smuAlarm, Ifx_SMU *smu, uint8 maxDispatch);
+
+/** \brief Indicates if alarms are waiting for the next call of \ref Ifx_SmuAlarm_process()
+ * \param smuAlarm Pointer to the dispatcher object
+ * \return Returns TRUE if alarms are pending
+ */
+IFX_EXTERN boolean Ifx_SmuAlarm_isPending(const Ifx_SmuAlarm *smuAlarm);
+
+/** \brief Read and clear the alarm status, then dispatch the alarms to their handlers
+ *
+ * Called from the SMU interrupt, and from a background task while \ref Ifx_SmuAlarm_isPending() returns TRUE.
+ * \param smuAlarm Pointer to the dispatcher object
+ */
+IFX_EXTERN void Ifx_SmuAlarm_process(Ifx_SmuAlarm *smuAlarm);
+
+/** \brief Register the handler of the alarms without handler
+ * \param smuAlarm Pointer to the dispatcher object
+ * \param handler Handler, NULL_PTR to ignore the alarms without handler
+ * \param data Data given to the handler
+ */
+IFX_EXTERN void Ifx_SmuAlarm_setDefaultHandler(Ifx_SmuAlarm *smuAlarm, Ifx_SmuAlarm_Handler handler, void *data);
+
+/** \brief Register the handler of an alarm
+ * \param smuAlarm Pointer to the dispatcher object
+ * \param alarm Alarm
+ * \param handler Handler, NULL_PTR for the default handler
+ * \param data Data given to the handler
+ */
+IFX_EXTERN void Ifx_SmuAlarm_setHandler(Ifx_SmuAlarm *smuAlarm, IfxSmu_Alarm alarm, Ifx_SmuAlarm_Handler handler, void *data);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -0,0 +1,60 @@
+/**
+ * \file Ifx_TrapMonitor.h
+ * \brief Trap statistics shell command
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_general_trapmonitor Trap monitor
+ * \ingroup library_srvsw_sysse_general
+ *
+ * Shell command printing the trap statistics recorded by the trap handlers of each CPU, see
+ * \ref IfxCpu_Trap_statistics: the number of traps per class and the last traps with their class, TIN, return
+ * address and STM0 timestamp.
+ *
+ * Usage example:
+ * \code
+ * // initialisation, before the first trap can occur
+ * IfxCpu_Trap_initStatistics();
+ *
+ * // shell command list entry
+ * {"traps", "    : Show the trap statistics"ENDL
+ *           "/p reset: clear the statistics afterwards", NULL_PTR, &Ifx_TrapMonitor_show},
+ * \endcode
+ *
+ */
+#ifndef IFX_TRAPMONITOR_H
+#define IFX_TRAPMONITOR_H 1
+
+#include "Cpu/Trap/IfxCpu_Trap.h"
+#include "StdIf/IfxStdIf_DPipe.h"
+
+/** \addtogroup library_srvsw_sysse_general_trapmonitor
+ * \{ */
+
+/** \brief Shell command: print the trap statistics of all CPUs. With the argument "reset", the statistics are
+ * cleared afterwards
+ * \param args command arguments
+ * \param data Not used
+ * \param io Pointer to the IfxStdIf_DPipe object
+ * \return TRUE
+ */
+IFX_EXTERN boolean Ifx_TrapMonitor_show(pchar args, void *data, IfxStdIf_DPipe *io);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
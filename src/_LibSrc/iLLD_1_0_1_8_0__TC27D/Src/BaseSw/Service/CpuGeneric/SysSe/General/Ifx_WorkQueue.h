@@ -0,0 +1,125 @@
+/**
+ * \file Ifx_WorkQueue.h
+ * \brief Deferred work queue serviced by a software interrupt
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_general_workqueue Deferred work queue
+ * \ingroup library_srvsw_sysse_general
+ *
+ * The work queue splits the interrupt processing in two parts: the interrupt service routine only reads the
+ * hardware and posts a work item with \ref Ifx_WorkQueue_post(), the processing of the item runs later in the
+ * service routine of a low priority software interrupt. The interrupts of higher priority are then not
+ * delayed by the processing.
+ *
+ * Each CPU has its own queue. The software interrupt is the general purpose service request GPSR group n, SR1
+ * of the CPU n, routed to this CPU (SR0 is reserved for the inter-core messages). Items are executed in
+ * the order they were posted, with the interrupts enabled.
+ *
+ * Usage example:
+ * \code
+ * static Ifx_WorkQueue workQueue;
+ *
+ * IFX_INTERRUPT(workQueueIsr, 0, IFX_INTPRIO_WORKQUEUE)
+ * {
+ *     Ifx_WorkQueue_process(&workQueue);
+ * }
+ *
+ * static void processFrame(void *data)
+ * {
+ *     // slow processing at IFX_INTPRIO_WORKQUEUE
+ * }
+ *
+ * IFX_INTERRUPT(canRxIsr, 0, IFX_INTPRIO_CAN_RX)
+ * {
+ *     readFrame(&frame);
+ *     Ifx_WorkQueue_post(&workQueue, &processFrame, &frame);
+ * }
+ *
+ * // initialisation on the CPU which owns the queue
+ * Ifx_WorkQueue_init(&workQueue, IFX_INTPRIO_WORKQUEUE);
+ * \endcode
+ *
+ */
+#ifndef IFX_WORKQUEUE_H
+#define IFX_WORKQUEUE_H 1
+
+#include "Cpu/Std/IfxCpu.h"
+#include "Src/Std/IfxSrc.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_WORKQUEUE_SIZE)
+#define IFX_CFG_WORKQUEUE_SIZE  (16)  /**<\brief Maximal number of pending work items of a queue */
+#endif
+
+/** \addtogroup library_srvsw_sysse_general_workqueue
+ * \{ */
+
+/** \brief Work function
+ * \param data Data given to \ref Ifx_WorkQueue_post()
+ */
+typedef void (*Ifx_WorkQueue_Function)(void *data);
+
+/** \brief Work item */
+typedef struct
+{
+    Ifx_WorkQueue_Function function;  /**<\brief work function */
+    void                  *data;      /**<\brief function data */
+} Ifx_WorkQueue_Item;
+
+/** \brief Work queue object */
+typedef struct
+{
+    Ifx_WorkQueue_Item     items[IFX_CFG_WORKQUEUE_SIZE];  /**<\brief circular buffer of the pending items */
+    uint16                 head;                           /**<\brief index of the next item to execute */
+    uint16                 count;                          /**<\brief number of pending items */
+    uint16                 maxCount;                       /**<\brief highest number of pending items */
+    uint32                 dropped;                        /**<\brief number of items not posted because the queue was full */
+    volatile Ifx_SRC_SRCR *src;                            /**<\brief software interrupt servicing the queue */
+} Ifx_WorkQueue;
+
+/** \brief Initialize the queue and its software interrupt
+ *
+ * Called on the CPU which executes the work items.
+ * \param queue Pointer to the queue object
+ * \param priority Priority of the software interrupt, lower than the priority of the interrupts posting items
+ */
+IFX_EXTERN void Ifx_WorkQueue_init(Ifx_WorkQueue *queue, Ifx_Priority priority);
+
+/** \brief Post a work item and request the software interrupt
+ *
+ * Called on the CPU of the queue, from an interrupt or a task.
+ * \param queue Pointer to the queue object
+ * \param function Work function
+ * \param data Function data, shall stay valid until the function is executed
+ * \return Returns FALSE if the queue is full
+ */
+IFX_EXTERN boolean Ifx_WorkQueue_post(Ifx_WorkQueue *queue, Ifx_WorkQueue_Function function, void *data);
+
+/** \brief Execute the pending work items
+ *
+ * Called from the service routine of the software interrupt. The interrupts are enabled, so that the
+ * interrupts of higher priority preempt the work items.
+ * \param queue Pointer to the queue object
+ * \return Returns the number of executed items
+ */
+IFX_EXTERN uint32 Ifx_WorkQueue_process(Ifx_WorkQueue *queue);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -138,6 +138,15 @@ IFX_EXTERN float32 *CplxVecPwr_f32(cfloat32 *X, short nX);
 IFX_EXTERN float32 *CplxVecMag_f32(cfloat32 *X, short nX);
 IFX_EXTERN void     CplxVecMul_f32(cfloat32 *X, const cfloat32 *mul, short nX);
 
+/* Complex Vector Operation, unrolled ----------------------------------------*/
+/* Same results as the functions above, 4 elements per loop iteration with
+ * independent intermediate values, so that the loads (64-bit per cfloat32),
+ * the FPU operations and the stores of consecutive elements overlap. */
+
+IFX_EXTERN float32 *CplxVecPwr_f32Fast(cfloat32 *X, short nX);
+IFX_EXTERN float32 *CplxVecMag_f32Fast(cfloat32 *X, short nX);
+IFX_EXTERN void     CplxVecMul_f32Fast(cfloat32 *restrict X, const cfloat32 *restrict mul, short nX);
+
 /* Vector Operation ----------------------------------------------------------*/
 
 IFX_EXTERN void    VecWin_f32(float32 *X, const float32 *W, short nX, short nW, short incrX, short symW);
@@ -153,6 +162,25 @@ IFX_EXTERN float32 VecMinIdx_f32(float32 *X, short nX, sint16 *minIdx, sint16 *m
 IFX_EXTERN float32 VecMaxIdx_f32(float32 *X, short nX, sint16 *minIdx, sint16 *maxIdx);
 IFX_EXTERN void    VecHalfSwap_f32(float32 *X, short nX);
 
+/* Vector Operation, unrolled ------------------------------------------------*/
+/* 4 elements per loop iteration. The reductions (sum, maximum, minimum) use 4
+ * independent accumulators combined at the end: no FPU result latency between
+ * consecutive elements. VecSum_f32Fast() adds in a different order than
+ * VecSum_f32(), the result may differ in the last bits. */
+
+IFX_EXTERN void    VecWin_f32Fast(float32 *restrict X, const float32 *restrict W, short nX, short nW, short incrX, short symW);
+IFX_EXTERN float32 VecSum_f32Fast(const float32 *X, short nX);
+IFX_EXTERN float32 VecMax_f32Fast(const float32 *X, short nX);
+IFX_EXTERN float32 VecMin_f32Fast(const float32 *X, short nX);
+
+/* Q15 Vector Operation ------------------------------------------------------*/
+/* Fixed point alternatives of the reductions, for data kept in Q15 (e.g. ADC
+ * results): integer operations only, 4 independent accumulators. */
+
+IFX_EXTERN sint32 VecSum_q15(const sint16 *X, short nX);
+IFX_EXTERN sint16 VecMax_q15(const sint16 *X, short nX);
+IFX_EXTERN sint16 VecMin_q15(const sint16 *X, short nX);
+
 /* Helper functions ----------------------------------------------------------*/
 #ifdef __WIN32__
 #include <stdio.h>
@@ -0,0 +1,122 @@
+/**
+ * \file Ifx_Cic.h
+ * \brief CIC decimation filter
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_math_cic CIC decimation filter
+ * This module implements a cascaded integrator comb (CIC) decimation filter on unsigned integer
+ * samples, e.g. ADC results.
+ *
+ * A filter of order N and decimation ratio R sums the input in N integrators at the input rate
+ * and differentiates every R-th integrator output in N combs at the output rate. The order 1
+ * filter is the moving average over R samples. The gain R^N is removed from the output, the
+ * output has the resolution of the input. The CIC can be used as second stage after the
+ * hardware accumulation of the ADC.
+ *
+ * All stages use modulo 2^32 arithmetic: the integrators overflow, the output is exact as long
+ * as inputBits + N * log2(R) <= 32 (e.g. 12 bit input: R = 16 up to N = 5, R = 256 up to N = 2).
+ *
+ * \ingroup library_srvsw_sysse_math
+ *
+ */
+
+#if !defined(IFX_CIC_H)
+#define IFX_CIC_H
+//------------------------------------------------------------------------------
+#include "Cpu/Std/Ifx_Types.h"
+//------------------------------------------------------------------------------
+
+#if !defined(IFX_CFG_CIC_MAX_ORDER)
+#define IFX_CFG_CIC_MAX_ORDER (4)   /**< \brief Maximal filter order */
+#endif
+
+/** \brief CIC object definition.
+ */
+typedef struct
+{
+    uint32 integrator[IFX_CFG_CIC_MAX_ORDER];    /**< \brief integrator stages */
+    uint32 comb[IFX_CFG_CIC_MAX_ORDER];          /**< \brief last input of the comb stages */
+    uint32 gain;                                 /**< \brief R^N */
+    uint16 ratio;                                /**< \brief decimation ratio R */
+    uint16 phase;                                /**< \brief number of inputs since the last output */
+    uint8  order;                                /**< \brief filter order N */
+} Ifx_Cic;
+
+/** \brief CIC configuration */
+typedef struct
+{
+    uint8  order;            /**< \brief Filter order N, 1 to IFX_CFG_CIC_MAX_ORDER */
+    uint16 ratio;            /**< \brief Decimation ratio R, number of inputs per output */
+} Ifx_Cic_Config;
+
+//------------------------------------------------------------------------------
+
+/** \addtogroup  library_srvsw_sysse_math_cic
+ * \{ */
+IFX_EXTERN boolean Ifx_Cic_init(Ifx_Cic *filter, const Ifx_Cic_Config *config);
+IFX_EXTERN void    Ifx_Cic_reset(Ifx_Cic *filter);
+IFX_INLINE boolean Ifx_Cic_do(Ifx_Cic *filter, uint32 input, uint32 *output);
+/** \} */
+
+//------------------------------------------------------------------------------
+
+/** \brief Execute the CIC filter
+ *
+ * The integrators are updated with each input, the combs with every R-th input only.
+ *
+ * \param filter Specifies CIC filter.
+ * \param input Specifies the filter input.
+ * \param output Returns the filter output, only written if TRUE is returned
+ *
+ * \return Returns TRUE if an output is available (every R-th input), else FALSE
+ */
+IFX_INLINE boolean Ifx_Cic_do(Ifx_Cic *filter, uint32 input, uint32 *output)
+{
+    uint32 value = input;
+    uint8  stage;
+
+    for (stage = 0; stage < filter->order; stage++)
+    {
+        filter->integrator[stage] += value;
+        value                      = filter->integrator[stage];
+    }
+
+    filter->phase++;
+
+    if (filter->phase < filter->ratio)
+    {
+        return FALSE;
+    }
+
+    filter->phase = 0;
+
+    for (stage = 0; stage < filter->order; stage++)
+    {
+        uint32 delayed = filter->comb[stage];
+        filter->comb[stage] = value;
+        value               = value - delayed;
+    }
+
+    *output = value / filter->gain;
+    return TRUE;
+}
+
+
+//------------------------------------------------------------------------------
+#endif
@@ -23,7 +23,32 @@
  */
 #include "Ifx_Crc.h"
 
-uint32 Ifx_Crc_reflect(uint32 crc, sint32 bitnum);
+uint32        Ifx_Crc_reflect(uint32 crc, sint32 bitnum);
+static uint32 Ifx_Crc_tableFastUpdate(Ifc_Crc *driver, uint32 crc, uint8 *p, uint32 len);
+
+uint16 Ifx_Crc_crc16Ccitt(uint16 crc, const uint8 *p, uint32 len)
+{
+    return Ifx_Crc_slicing4Crc16(&Ifx_Crc_tableCcitt, crc, p, len);
+}
+
+
+uint32 Ifx_Crc_crc32(uint32 crc, const uint8 *p, uint32 len)
+{
+    return ~Ifx_Crc_slicing8Crc32Reflected(&Ifx_Crc_tableCrc32, ~crc, p, len);
+}
+
+
+uint32 Ifx_Crc_crc32c(uint32 crc, const uint8 *p, uint32 len)
+{
+    return ~Ifx_Crc_slicing8Crc32Reflected(&Ifx_Crc_tableCrc32c, ~crc, p, len);
+}
+
+
+uint8 Ifx_Crc_crc8SaeJ1850(uint8 crc, const uint8 *p, uint32 len)
+{
+    return (uint8)~Ifx_Crc_slicing4Crc8(&Ifx_Crc_tableSaeJ1850, (uint8)~crc, p, len);
+}
+
 
 boolean Ifx_Crc_init(Ifc_Crc *driver, const Ifc_Crc_Table *table, sint32 direct, sint32 refout, uint32 crcinit, uint32 crcxor)
 {
@@ -206,14 +231,37 @@ uint32 Ifx_Crc_tableFast(Ifc_Crc *driver, uint8 *p, uint32 len)
     // fast lookup table algorithm without augmented zero bytes, e.g. used in pkzip.
     // only usable with polynom orders of 8, 16, 24 or 32.
 
-    uint32 crc              = driver->crcinit_direct;
-    sint32 orderMinusHeight = driver->table->order - 8;
+    uint32 crc = driver->crcinit_direct;
 
     if (driver->table->refin)
     {
         crc = Ifx_Crc_reflect(crc, driver->table->order);
     }
 
+    return Ifx_Crc_tableFastUpdate(driver, crc, p, len);
+}
+
+
+uint32 Ifx_Crc_tableFastContinue(Ifc_Crc *driver, uint32 crc, uint8 *p, uint32 len)
+{
+    // revert the final XOR and reflection of the previous result, then continue with the next block
+
+    crc ^= driver->crcxor;
+    crc &= driver->table->crcmask;
+
+    if (driver->refout ^ driver->table->refin)
+    {
+        crc = Ifx_Crc_reflect(crc, driver->table->order);
+    }
+
+    return Ifx_Crc_tableFastUpdate(driver, crc, p, len);
+}
+
+
+static uint32 Ifx_Crc_tableFastUpdate(Ifc_Crc *driver, uint32 crc, uint8 *p, uint32 len)
+{
+    sint32 orderMinusHeight = driver->table->order - 8;
+
     if (driver->table->order <= 8)
     {
         uint8 *crctab = (uint8 *)((uint32)driver->table + sizeof(Ifc_Crc_Table));
@@ -634,3 +682,76 @@ boolean Ifx_Crc_Test(Ifc_Crc *driver, uint8 *string, uint32 length, IfxStdIf_DPi
 
 
 #endif
+
+
+uint8 Ifx_Crc_slicing4Crc8(const Ifc_Crc_Table8x4 *table, uint8 crc, const uint8 *p, uint32 len)
+{
+    // 4 bytes per iteration: crctab[k] gives the contribution of a byte followed by k bytes
+
+    while (len >= 4)
+    {
+        crc  = table->crctab[3][crc ^ p[0]] ^ table->crctab[2][p[1]] ^ table->crctab[1][p[2]] ^ table->crctab[0][p[3]];
+        p   += 4;
+        len -= 4;
+    }
+
+    while (len--)
+    {
+        crc = table->crctab[0][crc ^ *p++];
+    }
+
+    return crc;
+}
+
+
+uint16 Ifx_Crc_slicing4Crc16(const Ifc_Crc_Table16x4 *table, uint16 crc, const uint8 *p, uint32 len)
+{
+    // 4 bytes per iteration: crctab[k] gives the contribution of a byte followed by k bytes
+
+    while (len >= 4)
+    {
+        crc = table->crctab[3][((crc >> 8) ^ p[0]) & 0xff] ^ table->crctab[2][(crc ^ p[1]) & 0xff]
+              ^ table->crctab[1][p[2]] ^ table->crctab[0][p[3]];
+        p   += 4;
+        len -= 4;
+    }
+
+    while (len--)
+    {
+        crc = (uint16)(crc << 8) ^ table->crctab[0][((crc >> 8) ^ *p++) & 0xff];
+    }
+
+    return crc;
+}
+
+
+uint32 Ifx_Crc_slicing8Crc32Reflected(const Ifc_Crc_Table32x8 *table, uint32 crc, const uint8 *p, uint32 len)
+{
+    // byte wise up to the word boundary, then 8 bytes per iteration with 2 aligned little endian word reads
+
+    while ((len != 0) && (((uint32)p & 3) != 0))
+    {
+        crc = (crc >> 8) ^ table->crctab[0][(crc ^ *p++) & 0xff];
+        len--;
+    }
+
+    while (len >= 8)
+    {
+        uint32 one = ((const uint32 *)p)[0] ^ crc;
+        uint32 two = ((const uint32 *)p)[1];
+
+        crc = table->crctab[7][one & 0xff] ^ table->crctab[6][(one >> 8) & 0xff]
+              ^ table->crctab[5][(one >> 16) & 0xff] ^ table->crctab[4][one >> 24]
+              ^ table->crctab[3][two & 0xff] ^ table->crctab[2][(two >> 8) & 0xff]
+              ^ table->crctab[1][(two >> 16) & 0xff] ^ table->crctab[0][two >> 24];
+        p   += 8;
+        len -= 8;
+    }
+
+    while (len--)
+    {
+        crc = (crc >> 8) ^ table->crctab[0][(crc ^ *p++) & 0xff];
+    }
+
+    return crc;
+}
@@ -65,6 +65,27 @@ typedef struct
     uint32        crctab[256]; /**< \brief CRC Table, must be 2st member of the struct */
 }Ifc_Crc_Table32;
 
+/** \brief Slicing-by-4 tables for CRC up to 8 bit, compatible with Ifc_Crc_Table8 */
+typedef struct
+{
+    Ifc_Crc_Table data;           /**< \brief CRC data, must be 1st member of the struct */
+    uint8         crctab[4][256]; /**< \brief CRC Tables, crctab[0] is the byte wise table, must be 2st member of the struct */
+}Ifc_Crc_Table8x4;
+
+/** \brief Slicing-by-4 tables for CRC up to 16 bit, compatible with Ifc_Crc_Table16 */
+typedef struct
+{
+    Ifc_Crc_Table data;           /**< \brief CRC data, must be 1st member of the struct */
+    uint16        crctab[4][256]; /**< \brief CRC Tables, crctab[0] is the byte wise table, must be 2st member of the struct */
+}Ifc_Crc_Table16x4;
+
+/** \brief Slicing-by-8 tables for CRC up to 32 bit, compatible with Ifc_Crc_Table32 */
+typedef struct
+{
+    Ifc_Crc_Table data;           /**< \brief CRC data, must be 1st member of the struct */
+    uint32        crctab[8][256]; /**< \brief CRC Tables, crctab[0] is the byte wise table, must be 2st member of the struct */
+}Ifc_Crc_Table32x8;
+
 typedef struct
 {
     uint32               crcxor;
@@ -77,6 +98,24 @@ typedef struct
 
 /** \addtogroup library_srvsw_sysse_math_crc
  * \{ */
+/** \brief Result of Ifx_Crc_crc8SaeJ1850() over no data, start value of a new calculation */
+#define IFX_CRC_CRC8SAEJ1850_INIT (0x00u)
+
+/** \brief Result of Ifx_Crc_crc16Ccitt() over no data, start value of a new calculation */
+#define IFX_CRC_CRC16CCITT_INIT   (0xFFFFu)
+
+/** \brief Result of Ifx_Crc_crc32() / Ifx_Crc_crc32c() over no data, start value of a new calculation */
+#define IFX_CRC_CRC32_INIT        (0x00000000u)
+
+/** \brief CRC-8 SAE J1850 tables (polynom 0x1D), in flash. Can be used with Ifx_Crc_init() */
+IFX_EXTERN IFX_CONST Ifc_Crc_Table8x4  Ifx_Crc_tableSaeJ1850;
+/** \brief CRC-16-CCITT tables (polynom 0x1021), in flash. Can be used with Ifx_Crc_init() */
+IFX_EXTERN IFX_CONST Ifc_Crc_Table16x4 Ifx_Crc_tableCcitt;
+/** \brief CRC-32 IEEE 802.3 tables (polynom 0x04C11DB7, reflected), in flash. Can be used with Ifx_Crc_init() */
+IFX_EXTERN IFX_CONST Ifc_Crc_Table32x8 Ifx_Crc_tableCrc32;
+/** \brief CRC-32C Castagnoli tables (polynom 0x1EDC6F41, reflected), in flash. Can be used with Ifx_Crc_init() */
+IFX_EXTERN IFX_CONST Ifc_Crc_Table32x8 Ifx_Crc_tableCrc32c;
+
 /**
  * \param direct [0,1] specifies the kind of algorithm: 1=direct, no augmented zero bits
  * \param driver pointer to the crc driver
@@ -101,7 +140,76 @@ boolean Ifx_Crc_Test(Ifc_Crc *driver, uint8 *string, uint32 length, IfxStdIf_DPi
 void    Ifx_Crc_printTable(Ifc_Crc_Table *table, IfxStdIf_DPipe *io);
 #endif
 uint32 Ifx_Crc_tableFast(Ifc_Crc *driver, uint8 *p, uint32 len);
+/**
+ * \brief Continue the CRC of Ifx_Crc_tableFast() with the next block of data (streaming)
+ * \param driver pointer to the crc driver
+ * \param crc result of Ifx_Crc_tableFast() or Ifx_Crc_tableFastContinue() for the previous blocks
+ * \param p pointer to the next block
+ * \param len length of the next block in bytes
+ * \return the CRC of all blocks, as Ifx_Crc_tableFast() over the concatenated blocks
+ */
+uint32 Ifx_Crc_tableFastContinue(Ifc_Crc *driver, uint32 crc, uint8 *p, uint32 len);
 uint32 Ifx_Crc_table(Ifc_Crc *driver, uint8 *p, uint32 len);
+
+/**
+ * \brief CRC-8 SAE J1850 (init 0xFF, final XOR 0xFF), slicing-by-4
+ * \param crc result of the previous part of the data, IFX_CRC_CRC8SAEJ1850_INIT for a new calculation
+ * \param p pointer to the data
+ * \param len length of the data in bytes
+ * \return the CRC of the data and of the previous parts
+ */
+uint8 Ifx_Crc_crc8SaeJ1850(uint8 crc, const uint8 *p, uint32 len);
+/**
+ * \brief CRC-16-CCITT (init 0xFFFF, no final XOR, not reflected), slicing-by-4
+ * \param crc result of the previous part of the data, IFX_CRC_CRC16CCITT_INIT for a new calculation
+ * \param p pointer to the data
+ * \param len length of the data in bytes
+ * \return the CRC of the data and of the previous parts
+ */
+uint16 Ifx_Crc_crc16Ccitt(uint16 crc, const uint8 *p, uint32 len);
+/**
+ * \brief CRC-32 IEEE 802.3 (init and final XOR 0xFFFFFFFF, reflected), slicing-by-8
+ * \param crc result of the previous part of the data, IFX_CRC_CRC32_INIT for a new calculation
+ * \param p pointer to the data
+ * \param len length of the data in bytes
+ * \return the CRC of the data and of the previous parts
+ */
+uint32 Ifx_Crc_crc32(uint32 crc, const uint8 *p, uint32 len);
+/**
+ * \brief CRC-32C Castagnoli (init and final XOR 0xFFFFFFFF, reflected), slicing-by-8
+ * \param crc result of the previous part of the data, IFX_CRC_CRC32_INIT for a new calculation
+ * \param p pointer to the data
+ * \param len length of the data in bytes
+ * \return the CRC of the data and of the previous parts
+ */
+uint32 Ifx_Crc_crc32c(uint32 crc, const uint8 *p, uint32 len);
+/**
+ * \brief Slicing-by-4 kernel for CRC of 8 bit, not reflected. No initial value and final XOR applied
+ * \param table pointer to the tables
+ * \param crc CRC register
+ * \param p pointer to the data
+ * \param len length of the data in bytes
+ * \return the CRC register after the data
+ */
+uint8 Ifx_Crc_slicing4Crc8(const Ifc_Crc_Table8x4 *table, uint8 crc, const uint8 *p, uint32 len);
+/**
+ * \brief Slicing-by-4 kernel for CRC of 16 bit, not reflected. No initial value and final XOR applied
+ * \param table pointer to the tables
+ * \param crc CRC register
+ * \param p pointer to the data
+ * \param len length of the data in bytes
+ * \return the CRC register after the data
+ */
+uint16 Ifx_Crc_slicing4Crc16(const Ifc_Crc_Table16x4 *table, uint16 crc, const uint8 *p, uint32 len);
+/**
+ * \brief Slicing-by-8 kernel for CRC of 32 bit, reflected. No initial value and final XOR applied
+ * \param table pointer to the tables
+ * \param crc CRC register
+ * \param p pointer to the data
+ * \param len length of the data in bytes
+ * \return the CRC register after the data
+ */
+uint32 Ifx_Crc_slicing8Crc32Reflected(const Ifc_Crc_Table32x8 *table, uint32 crc, const uint8 *p, uint32 len);
 uint32 Ifx_Crc_bitByBit(Ifc_Crc *driver, uint8 *p, uint32 len);
 uint32 Ifx_Crc_bitByBitFast(Ifc_Crc *driver, uint8 *p, uint32 len);
 /** \} */
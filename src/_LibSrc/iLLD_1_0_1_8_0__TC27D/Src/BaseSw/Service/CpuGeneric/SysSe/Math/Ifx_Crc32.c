@@ -0,0 +1,141 @@
+/**
+ * \file Ifx_Crc32.c
+ * \brief CRC-32 calculation with software, FCE or FCE and DMA
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+#include "Ifx_Crc32.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/** Start value of the FCE kernel continuing the CRC of the previous bytes (see IfxLld_Fce_Crc_Usage) */
+static uint32 Ifx_Crc32_getFceStartValue(uint32 crc)
+{
+    return ~IfxFce_reflectCrc32(crc, 32);
+}
+
+
+/** Process the remaining bytes: start of the next DMA block, or FCE polled / software until the end
+ */
+static void Ifx_Crc32_step(Ifx_Crc32 *crc32)
+{
+    IfxFce_Crc_Crc *fce   = crc32->config.fce;
+    uint32          words = crc32->length / 4;
+
+    if ((fce != NULL_PTR) && (fce->useDma != FALSE) && (crc32->length >= crc32->config.dmaThreshold))
+    {
+        if (words > IFXFCE_CRC_DMA_LENGTH_MAX)
+        {
+            words = IFXFCE_CRC_DMA_LENGTH_MAX;
+        }
+
+        IfxFce_Crc_calculateCrc32Async(fce, (const uint32 *)crc32->data, words, Ifx_Crc32_getFceStartValue(crc32->crc));
+        crc32->dmaActive = TRUE;
+        crc32->data      = &crc32->data[words * 4];
+        crc32->length   -= words * 4;
+    }
+    else
+    {
+        if ((fce != NULL_PTR) && (crc32->length >= crc32->config.fceThreshold))
+        {
+            crc32->crc = IfxFce_Crc_calculateCrc32(fce, (const uint32 *)crc32->data, words, Ifx_Crc32_getFceStartValue(crc32->crc));
+        }
+        else
+        {
+            words = 0;
+        }
+
+        /* last bytes after the words, or whole buffer below the FCE threshold */
+        crc32->crc    = Ifx_Crc_crc32(crc32->crc, &crc32->data[words * 4], crc32->length - (words * 4));
+        crc32->data   = &crc32->data[crc32->length];
+        crc32->length = 0;
+    }
+}
+
+
+uint32 Ifx_Crc32_calculate(Ifx_Crc32 *crc32, uint32 crc, const void *data, uint32 length)
+{
+    Ifx_Crc32_start(crc32, crc, data, length);
+
+    while (Ifx_Crc32_isBusy(crc32) != FALSE)
+    {}
+
+    return crc32->crc;
+}
+
+
+void Ifx_Crc32_init(Ifx_Crc32 *crc32, const Ifx_Crc32_Config *config)
+{
+    crc32->config    = *config;
+    crc32->data      = NULL_PTR;
+    crc32->length    = 0;
+    crc32->crc       = IFX_CRC32_INIT;
+    crc32->dmaActive = FALSE;
+}
+
+
+void Ifx_Crc32_initConfig(Ifx_Crc32_Config *config)
+{
+    config->fce          = NULL_PTR;
+    config->fceThreshold = 64;
+    config->dmaThreshold = 1024;
+}
+
+
+boolean Ifx_Crc32_isBusy(Ifx_Crc32 *crc32)
+{
+    if (crc32->dmaActive != FALSE)
+    {
+        if (IfxFce_Crc_isDmaBusy(crc32->config.fce) == FALSE)
+        {
+            crc32->crc       = IfxFce_Crc_getCrc32Result(crc32->config.fce);
+            crc32->dmaActive = FALSE;
+
+            if (crc32->length != 0)
+            {
+                Ifx_Crc32_step(crc32);
+            }
+        }
+    }
+
+    return crc32->dmaActive;
+}
+
+
+void Ifx_Crc32_start(Ifx_Crc32 *crc32, uint32 crc, const void *data, uint32 length)
+{
+    const uint8 *bytes = (const uint8 *)data;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, crc32->dmaActive == FALSE);
+
+    if ((crc32->config.fce != NULL_PTR) && (length >= crc32->config.fceThreshold))
+    {
+        /* the FCE is fed with aligned words, the first bytes up to the word boundary are processed by software */
+        uint32 head = (0u - (uint32)bytes) & 3u;
+
+        crc     = Ifx_Crc_crc32(crc, bytes, head);
+        bytes   = &bytes[head];
+        length -= head;
+    }
+
+    crc32->crc    = crc;
+    crc32->data   = bytes;
+    crc32->length = length;
+
+    Ifx_Crc32_step(crc32);
+}
@@ -0,0 +1,148 @@
+/**
+ * \file Ifx_Crc32.h
+ * \brief CRC-32 calculation with software, FCE or FCE and DMA
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_math_crc32 CRC-32
+ * \ingroup library_srvsw_sysse_math
+ *
+ * Calculates the CRC-32 of IEEE 802.3 (polynomial 0x04C11DB7, reflected, initial value and final XOR
+ * 0xFFFFFFFF) over the bytes in memory order. The method is selected by the length of the buffer:
+ * - below fceThreshold: software slicing-by-8 with the flash tables (\ref Ifx_Crc_crc32()), no setup overhead.
+ * - from fceThreshold: the FCE kernel, fed word by word by the CPU. The unaligned bytes at the start and the
+ * end of the buffer are processed by software.
+ * - from dmaThreshold, if the FCE kernel is initialised with useDma: the FCE fed by the DMA, by blocks of
+ * IFXFCE_CRC_DMA_LENGTH_MAX words. The CPU is free during the transfer with \ref Ifx_Crc32_start().
+ *
+ * The calculation can be split into several calls (streaming): the result of a call is given as crc to the next
+ * call, \ref IFX_CRC32_INIT for the first one. The FCE kernel shall be initialised with the default configuration
+ * of IfxFce_Crc_initCrcConfig() and used only by this object. Buffers transferred by the DMA shall not be in a
+ * data cached segment, see IFX_DMA_BUFFER.
+ *
+ * Usage example:
+ * \code
+ * static Ifx_Crc32 crc32;
+ *
+ * Ifx_Crc32_Config config;
+ * Ifx_Crc32_initConfig(&config);
+ * config.fce = &fceCrc32_0;    // kernel initialised with useDma = TRUE
+ * Ifx_Crc32_init(&crc32, &config);
+ *
+ * // blocking, any length
+ * crc = Ifx_Crc32_calculate(&crc32, IFX_CRC32_INIT, header, sizeof(header));
+ * crc = Ifx_Crc32_calculate(&crc32, crc, payload, payloadLength);
+ *
+ * // flash image verification in background
+ * Ifx_Crc32_start(&crc32, IFX_CRC32_INIT, (const void *)IFXFLASH_PFLASH_START, imageSize);
+ *
+ * while (Ifx_Crc32_isBusy(&crc32))
+ * {
+ *     // other processing
+ * }
+ *
+ * crc = Ifx_Crc32_getResult(&crc32);
+ * \endcode
+ *
+ */
+
+#ifndef IFX_CRC32_H
+#define IFX_CRC32_H 1
+//---------------------------------------------------------------------------
+#include "Cpu/Std/Ifx_Types.h"
+#include "Ifx_Crc.h"
+#include "Fce/Crc/IfxFce_Crc.h"
+
+/** \addtogroup library_srvsw_sysse_math_crc32
+ * \{ */
+
+/** \brief CRC value to start a new calculation */
+#define IFX_CRC32_INIT IFX_CRC_CRC32_INIT
+
+/** \brief Configuration of the CRC-32 object */
+typedef struct
+{
+    IfxFce_Crc_Crc *fce;           /**< \brief FCE CRC-32 kernel, NULL_PTR to use only the software */
+    uint32          fceThreshold;  /**< \brief buffer length in bytes from which the FCE is used */
+    uint32          dmaThreshold;  /**< \brief buffer length in bytes from which the FCE is fed by the DMA, if the kernel uses the DMA */
+} Ifx_Crc32_Config;
+
+/** \brief CRC-32 object */
+typedef struct
+{
+    Ifx_Crc32_Config config;     /**< \brief configuration */
+    const uint8     *data;       /**< \brief next bytes of the calculation */
+    uint32           length;     /**< \brief number of bytes still to process */
+    uint32           crc;        /**< \brief CRC of the bytes already processed */
+    boolean          dmaActive;  /**< \brief TRUE while a block is transferred by the DMA */
+} Ifx_Crc32;
+
+//---------------------------------------------------------------------------
+
+/** \brief Calculate the CRC of a buffer, blocking
+ * \param crc32 Pointer to the CRC-32 object
+ * \param crc Result of the previous part of the data, \ref IFX_CRC32_INIT for a new calculation
+ * \param data Pointer to the data
+ * \param length Length of the data in bytes
+ * \return Returns the CRC of the data and of the previous parts
+ */
+IFX_EXTERN uint32 Ifx_Crc32_calculate(Ifx_Crc32 *crc32, uint32 crc, const void *data, uint32 length);
+
+/** \brief Returns the result of the calculation started by \ref Ifx_Crc32_start()
+ * \param crc32 Pointer to the CRC-32 object
+ * \return Returns the CRC, valid when \ref Ifx_Crc32_isBusy() returns FALSE
+ */
+IFX_INLINE uint32 Ifx_Crc32_getResult(const Ifx_Crc32 *crc32)
+{
+    return crc32->crc;
+}
+
+
+/** \brief Initialize the CRC-32 object
+ * \param crc32 Pointer to the CRC-32 object
+ * \param config Configuration
+ */
+IFX_EXTERN void Ifx_Crc32_init(Ifx_Crc32 *crc32, const Ifx_Crc32_Config *config);
+
+/** \brief Initialize the configuration: software only, FCE from 64 bytes, DMA from 1024 bytes
+ * \param config Configuration
+ */
+IFX_EXTERN void Ifx_Crc32_initConfig(Ifx_Crc32_Config *config);
+
+/** \brief Indicates if the calculation is ongoing, and starts the next DMA block when the previous one is finished
+ *
+ * Called periodically after \ref Ifx_Crc32_start().
+ * \param crc32 Pointer to the CRC-32 object
+ * \return Returns TRUE while the calculation is ongoing
+ */
+IFX_EXTERN boolean Ifx_Crc32_isBusy(Ifx_Crc32 *crc32);
+
+/** \brief Start the calculation of the CRC of a buffer
+ *
+ * Buffers shorter than dmaThreshold are calculated before the function returns. The data shall not be
+ * modified until \ref Ifx_Crc32_isBusy() returns FALSE.
+ * \param crc32 Pointer to the CRC-32 object
+ * \param crc Result of the previous part of the data, \ref IFX_CRC32_INIT for a new calculation
+ * \param data Pointer to the data
+ * \param length Length of the data in bytes
+ */
+IFX_EXTERN void Ifx_Crc32_start(Ifx_Crc32 *crc32, uint32 crc, const void *data, uint32 length);
+
+/** \} */
+//---------------------------------------------------------------------------
+#endif  // IFX_CRC32_H
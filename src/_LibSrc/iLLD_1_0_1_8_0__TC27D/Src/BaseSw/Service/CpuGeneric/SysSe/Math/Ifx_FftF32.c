@@ -163,3 +163,179 @@ cfloat32 *Ifx_FftF32_radix2I(cfloat32 *R, const cfloat32 *X, unsigned short nX)
 
     return R;
 }
+
+
+/******************************************************************************/
+void Ifx_FftF32_radix4DecimationInTime(cfloat32 *R, uint32 p, const cfloat32 *TF, uint32 nTF)
+{
+    /* Each pass combines 2 passes of Ifx_FftF32_radix2DecimationInTime() with half-span h:
+     * with w = W_4h^k, the 4 points k, k+h, k+2h, k+3h of a block of 4h points are twiddled
+     * by 1, w^2, w, w^3 and combined by a radix-4 butterfly.
+     * The input array R is in bit reversed order. */
+    unsigned long nX = 1UL << p;
+    unsigned long h, k, b, stride;
+
+    if ((p & 1) != 0)
+    {
+        /* odd number of radix-2 passes: first pass, without twiddle factors */
+        for (b = 0; b < nX; b += 2)
+        {
+            cfloat32 top = R[b];
+            R[b]     = IFX_Cf32_add(&top, &R[b + 1]);
+            R[b + 1] = IFX_Cf32_sub(&top, &R[b + 1]);
+        }
+
+        h = 2;
+    }
+    else
+    {
+        h = 1;
+    }
+
+    for ( ; h < nX; h = h << 2)
+    {
+        stride = nTF / (h << 2);
+
+        for (k = 0; k < h; k++)
+        {
+            cfloat32 w1 = Ifx_FftF32_getTwiddleFactor(TF, nTF, k * stride);
+            cfloat32 w2 = Ifx_FftF32_getTwiddleFactor(TF, nTF, 2 * k * stride);
+            cfloat32 w3 = Ifx_FftF32_getTwiddleFactor(TF, nTF, 3 * k * stride);
+
+            for (b = k; b < nX; b += (h << 2))
+            {
+                cfloat32 t0, t1, t2, t3, s0, s1, d0, d1;
+
+                t0 = R[b];
+                t1 = IFX_Cf32_mul(&R[b + h], &w2);
+                t2 = IFX_Cf32_mul(&R[b + (2 * h)], &w1);
+                t3 = IFX_Cf32_mul(&R[b + (3 * h)], &w3);
+                s0 = IFX_Cf32_add(&t0, &t1);
+                d0 = IFX_Cf32_sub(&t0, &t1);
+                s1 = IFX_Cf32_add(&t2, &t3);
+                d1 = IFX_Cf32_sub(&t2, &t3);
+
+                R[b]                = IFX_Cf32_add(&s0, &s1);
+                R[b + (2 * h)]      = IFX_Cf32_sub(&s0, &s1);
+                /* d0 -/+ j * d1 */
+                R[b + h].real       = d0.real + d1.imag;
+                R[b + h].imag       = d0.imag - d1.real;
+                R[b + (3 * h)].real = d0.real - d1.imag;
+                R[b + (3 * h)].imag = d0.imag + d1.real;
+            }
+        }
+    }
+}
+
+
+cfloat32 *Ifx_FftF32_radix4(cfloat32 *R, const cfloat32 *X, unsigned short nX, const cfloat32 *TF)
+{
+    unsigned int   logN = 31 - __clz(nX);
+    unsigned long  nTF  = nX;
+    unsigned short n, k;
+
+    if (TF == NULL_PTR)
+    {
+        TF  = Ifx_g_FftF32_twiddleTable;
+        nTF = IFX_FFTF32_MAX_LENGTH;
+    }
+
+    /* Arrange in bit-reversed index */
+    for (n = 0; n < nX; n++)
+    {
+        k    = Ifx_FftF32_lookUpReversedBits(n, logN);
+        R[k] = X[n];
+    }
+
+    Ifx_FftF32_radix4DecimationInTime(R, logN, TF, nTF);
+
+    return R;
+}
+
+
+cfloat32 *Ifx_FftF32_radix4I(cfloat32 *R, const cfloat32 *X, unsigned short nX, const cfloat32 *TF)
+{
+    unsigned int   logN = 31 - __clz(nX);
+    unsigned long  nTF  = nX;
+    unsigned short n, k;
+
+    if (TF == NULL_PTR)
+    {
+        TF  = Ifx_g_FftF32_twiddleTable;
+        nTF = IFX_FFTF32_MAX_LENGTH;
+    }
+
+    /* Arrange in bit-reversed index, and conjugate the input */
+    for (n = 0; n < nX; n++)
+    {
+        k         = Ifx_FftF32_lookUpReversedBits(n, logN);
+        R[k].real = X[n].real;
+        R[k].imag = -X[n].imag;
+    }
+
+    Ifx_FftF32_radix4DecimationInTime(R, logN, TF, nTF);
+
+    /* Conjugate the output */
+    for (n = 0; n < nX; n++)
+    {
+        R[n].imag = -R[n].imag;
+    }
+
+    return R;
+}
+
+
+cfloat32 *Ifx_FftF32_real(cfloat32 *R, const float32 *X, unsigned short nX, const cfloat32 *TF)
+{
+    unsigned short nZ   = nX / 2;
+    unsigned int   logN = 31 - __clz(nZ);
+    unsigned long  nTF  = nX;
+    unsigned short n, k;
+    cfloat32       z0;
+
+    if (TF == NULL_PTR)
+    {
+        TF  = Ifx_g_FftF32_twiddleTable;
+        nTF = IFX_FFTF32_MAX_LENGTH;
+    }
+
+    /* Pack the even / odd samples as real / imaginary part, in bit-reversed index */
+    for (n = 0; n < nZ; n++)
+    {
+        k         = Ifx_FftF32_lookUpReversedBits(n, logN);
+        R[k].real = X[2 * n];
+        R[k].imag = X[(2 * n) + 1];
+    }
+
+    /* nX / 2 points transform, the twiddle factors of nX are used with a stride of 2 */
+    Ifx_FftF32_radix4DecimationInTime(R, logN, TF, nTF);
+
+    /* Split: with Z the packed spectrum, E = (Z[k] + Z*[nZ-k]) / 2 and O = (Z[k] - Z*[nZ-k]) / 2j are
+     * the spectra of the even and odd samples, R[k] = E + W_nX^k * O, R[nZ-k] = (E - W_nX^k * O)* */
+    z0         = R[0];
+    R[0].real  = z0.real + z0.imag;
+    R[0].imag  = 0.0;
+    R[nZ].real = z0.real - z0.imag;
+    R[nZ].imag = 0.0;
+
+    for (k = 1; k <= (nZ / 2); k++)
+    {
+        cfloat32 a = R[k];
+        cfloat32 b = R[nZ - k];
+        cfloat32 e, o, w, t;
+
+        e.real         = (a.real + b.real) * 0.5f;
+        e.imag         = (a.imag - b.imag) * 0.5f;
+        o.real         = (a.imag + b.imag) * 0.5f;
+        o.imag         = (b.real - a.real) * 0.5f;
+        w              = Ifx_FftF32_getTwiddleFactor(TF, nTF, k * (nTF / nX));
+        t              = IFX_Cf32_mul(&w, &o);
+
+        R[k].real      = e.real + t.real;
+        R[k].imag      = e.imag + t.imag;
+        R[nZ - k].real = e.real - t.real;
+        R[nZ - k].imag = t.imag - e.imag;
+    }
+
+    return R;
+}
@@ -0,0 +1,246 @@
+/**
+ * \file Ifx_FftFxp.c
+ * \brief Fixed-point Fast Fourier Transform
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_FftFxp.h"
+
+/******************************************************************************/
+/** Q15 rounded complex multiplication */
+IFX_INLINE csint16 Ifx_FftFxp_mulQ15(const csint16 *a, const csint16 *b)
+{
+    csint16 R;
+    R.real = (sint16)((((sint32)a->real * b->real) - ((sint32)a->imag * b->imag) + 0x4000) >> 15);
+    R.imag = (sint16)((((sint32)a->imag * b->real) + ((sint32)a->real * b->imag) + 0x4000) >> 15);
+    return R;
+}
+
+
+/** Q31 complex multiplication */
+IFX_INLINE csint32 Ifx_FftFxp_mulQ31(const csint32 *a, const csint32 *b)
+{
+    csint32 R;
+    R.real = (sint32)((((sint64)a->real * b->real) - ((sint64)a->imag * b->imag)) >> 31);
+    R.imag = (sint32)((((sint64)a->imag * b->real) + ((sint64)a->real * b->imag)) >> 31);
+    return R;
+}
+
+
+/** Halved sum of 2 Q15 values, saturated */
+IFX_INLINE sint16 Ifx_FftFxp_halfAddQ15(sint32 a, sint32 b)
+{
+    return (sint16)__saturate((a + b) >> 1, -32768, 32767);
+}
+
+
+/** Rounded and saturated conversion of a twiddle factor component [-1, 1] to fixed-point */
+static sint32 Ifx_FftFxp_toFixed(float32 value, float32 scale, sint32 max)
+{
+    float32 fixed = (value * scale) + ((value < 0.0f) ? -0.5f : 0.5f);
+
+    if (fixed >= scale)
+    {
+        return max;
+    }
+    else if (fixed <= -scale)
+    {
+        return -max - 1;
+    }
+    else
+    {
+        return (sint32)fixed;
+    }
+}
+
+
+/******************************************************************************/
+csint16 *Ifx_FftFxp_generateTwiddleFactorQ15(csint16 *TF, uint16 nX)
+{
+    uint32 i;
+
+    for (i = 0; i < (nX / 2U); i++)
+    {
+        cfloat32 w = Ifx_FftF32_lookUpTwiddleFactor(nX, i);
+        TF[i].real = (sint16)Ifx_FftFxp_toFixed(w.real, 32768.0f, 0x7FFF);
+        TF[i].imag = (sint16)Ifx_FftFxp_toFixed(w.imag, 32768.0f, 0x7FFF);
+    }
+
+    return TF;
+}
+
+
+csint32 *Ifx_FftFxp_generateTwiddleFactorQ31(csint32 *TF, uint16 nX)
+{
+    uint32 i;
+
+    for (i = 0; i < (nX / 2U); i++)
+    {
+        cfloat32 w = Ifx_FftF32_lookUpTwiddleFactor(nX, i);
+        TF[i].real = Ifx_FftFxp_toFixed(w.real, 2147483648.0f, 0x7FFFFFFF);
+        TF[i].imag = Ifx_FftFxp_toFixed(w.imag, 2147483648.0f, 0x7FFFFFFF);
+    }
+
+    return TF;
+}
+
+
+/******************************************************************************/
+void Ifx_FftFxp_radix2DecimationInTimeQ15(csint16 *R, uint32 p, const csint16 *TF, uint32 nTF)
+{
+    /* Same passes as Ifx_FftF32_radix2DecimationInTime(), the butterfly results are halved.
+     * The input array R is in bit reversed order. */
+    uint32 nX = 1UL << p;
+    uint32 h, k, b, stride;
+
+    for (h = 1; h < nX; h = h << 1)
+    {
+        stride = nTF / (h << 1);
+
+        for (k = 0; k < h; k++)
+        {
+            csint16 w = TF[k * stride];
+
+            for (b = k; b < nX; b += (h << 1))
+            {
+                csint16 top = R[b];
+                csint16 bot = Ifx_FftFxp_mulQ15(&R[b + h], &w);
+
+                R[b].real     = Ifx_FftFxp_halfAddQ15(top.real, bot.real);
+                R[b].imag     = Ifx_FftFxp_halfAddQ15(top.imag, bot.imag);
+                R[b + h].real = Ifx_FftFxp_halfAddQ15(top.real, -bot.real);
+                R[b + h].imag = Ifx_FftFxp_halfAddQ15(top.imag, -bot.imag);
+            }
+        }
+    }
+}
+
+
+void Ifx_FftFxp_radix2DecimationInTimeQ31(csint32 *R, uint32 p, const csint32 *TF, uint32 nTF)
+{
+    /* Same passes as Ifx_FftF32_radix2DecimationInTime(), the butterfly results are halved.
+     * The input array R is in bit reversed order. */
+    uint32 nX = 1UL << p;
+    uint32 h, k, b, stride;
+
+    for (h = 1; h < nX; h = h << 1)
+    {
+        stride = nTF / (h << 1);
+
+        for (k = 0; k < h; k++)
+        {
+            csint32 w = TF[k * stride];
+
+            for (b = k; b < nX; b += (h << 1))
+            {
+                csint32 top = R[b];
+                csint32 bot = Ifx_FftFxp_mulQ31(&R[b + h], &w);
+
+                R[b].real     = (top.real >> 1) + (bot.real >> 1);
+                R[b].imag     = (top.imag >> 1) + (bot.imag >> 1);
+                R[b + h].real = (top.real >> 1) - (bot.real >> 1);
+                R[b + h].imag = (top.imag >> 1) - (bot.imag >> 1);
+            }
+        }
+    }
+}
+
+
+csint16 *Ifx_FftFxp_radix2Q15(csint16 *R, const csint16 *X, uint16 nX, const csint16 *TF)
+{
+    uint32 logN = 31 - __clz(nX);
+    uint16 n, k;
+
+    /* Arrange in bit-reversed index */
+    for (n = 0; n < nX; n++)
+    {
+        k    = Ifx_FftF32_lookUpReversedBits(n, logN);
+        R[k] = X[n];
+    }
+
+    Ifx_FftFxp_radix2DecimationInTimeQ15(R, logN, TF, nX);
+
+    return R;
+}
+
+
+csint32 *Ifx_FftFxp_radix2Q31(csint32 *R, const csint32 *X, uint16 nX, const csint32 *TF)
+{
+    uint32 logN = 31 - __clz(nX);
+    uint16 n, k;
+
+    /* Arrange in bit-reversed index */
+    for (n = 0; n < nX; n++)
+    {
+        k    = Ifx_FftF32_lookUpReversedBits(n, logN);
+        R[k] = X[n];
+    }
+
+    Ifx_FftFxp_radix2DecimationInTimeQ31(R, logN, TF, nX);
+
+    return R;
+}
+
+
+csint16 *Ifx_FftFxp_realQ15(csint16 *R, const sint16 *X, uint16 nX, const csint16 *TF, sint16 offset, uint8 shift)
+{
+    uint16  nZ   = nX / 2;
+    uint32  logN = 31 - __clz(nZ);
+    uint16  n, k;
+    csint16 z0;
+
+    /* Convert to Q15 and pack the even / odd samples as real / imaginary part, in bit-reversed index */
+    for (n = 0; n < nZ; n++)
+    {
+        k         = Ifx_FftF32_lookUpReversedBits(n, logN);
+        R[k].real = (sint16)__saturate(((sint32)X[2 * n] - offset) << shift, -32768, 32767);
+        R[k].imag = (sint16)__saturate(((sint32)X[(2 * n) + 1] - offset) << shift, -32768, 32767);
+    }
+
+    /* nX / 2 points transform, the twiddle factors of nX are used with a stride of 2 */
+    Ifx_FftFxp_radix2DecimationInTimeQ15(R, logN, TF, nX);
+
+    /* Split as in Ifx_FftF32_real(), the packed spectrum is divided by nX / 2, the result is halved */
+    z0         = R[0];
+    R[0].real  = Ifx_FftFxp_halfAddQ15(z0.real, z0.imag);
+    R[0].imag  = 0;
+    R[nZ].real = Ifx_FftFxp_halfAddQ15(z0.real, -z0.imag);
+    R[nZ].imag = 0;
+
+    for (k = 1; k <= (nZ / 2); k++)
+    {
+        csint16 a = R[k];
+        csint16 b = R[nZ - k];
+        csint16 e, o, t;
+
+        e.real         = Ifx_FftFxp_halfAddQ15(a.real, b.real);
+        e.imag         = Ifx_FftFxp_halfAddQ15(a.imag, -b.imag);
+        o.real         = Ifx_FftFxp_halfAddQ15(a.imag, b.imag);
+        o.imag         = Ifx_FftFxp_halfAddQ15(b.real, -a.real);
+        t              = Ifx_FftFxp_mulQ15(&TF[k], &o);
+
+        R[k].real      = Ifx_FftFxp_halfAddQ15(e.real, t.real);
+        R[k].imag      = Ifx_FftFxp_halfAddQ15(e.imag, t.imag);
+        R[nZ - k].real = Ifx_FftFxp_halfAddQ15(e.real, -t.real);
+        R[nZ - k].imag = Ifx_FftFxp_halfAddQ15(t.imag, -e.imag);
+    }
+
+    return R;
+}
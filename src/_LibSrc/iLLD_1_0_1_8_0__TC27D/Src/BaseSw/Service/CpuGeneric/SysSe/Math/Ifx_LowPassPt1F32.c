@@ -58,3 +58,262 @@ float32 Ifx_LowPassPt1F32_do(Ifx_LowPassPt1F32 *filter, float32 input)
     filter->out = filter->out + filter->a * input - filter->b * filter->out;
     return filter->out;
 }
+
+
+/** \brief Convert a filter parameter to Q15
+ * \param value parameter value
+ * \return Returns the saturated Q15 value
+ */
+static sint16 Ifx_LowPassPt1Q15_toQ15(float32 value)
+{
+    float32 q15 = value * 32768.0f;
+
+    if (q15 > 32767.0f)
+    {
+        q15 = 32767.0f;
+    }
+    else if (q15 < -32768.0f)
+    {
+        q15 = -32768.0f;
+    }
+
+    return (sint16)q15;
+}
+
+
+/** \brief Convert a filter parameter to Q31
+ * \param value parameter value
+ * \return Returns the saturated Q31 value
+ */
+static sint32 Ifx_LowPassPt1Q31_toQ31(float32 value)
+{
+    float32 q31 = value * 2147483648.0f;
+
+    if (q31 >= 2147483647.0f)
+    {
+        return 0x7FFFFFFF;
+    }
+    else if (q31 <= -2147483648.0f)
+    {
+        return (sint32)0x80000000;
+    }
+    else
+    {
+        return (sint32)q31;
+    }
+}
+
+
+/** \brief Set the Q31 low pass filter configuration
+ *
+ * This function sets the low pass filter configuration and reset the filter output.
+ *
+ * \param filter Specifies PT1 filter.
+ * \param config Specifies the PT1 filter configuration, a and b must be lower than 1.
+ *
+ * \return None
+ */
+void Ifx_LowPassPt1Q31_init(Ifx_LowPassPt1Q31 *filter, const Ifx_LowPassPt1F32_Config *config)
+{
+    Ifx_LowPassPt1F32 filterF32;
+
+    Ifx_LowPassPt1F32_init(&filterF32, config);
+    filter->a   = Ifx_LowPassPt1Q31_toQ31(filterF32.a);
+    filter->b   = Ifx_LowPassPt1Q31_toQ31(filterF32.b);
+    filter->out = 0;
+}
+
+
+/** \brief Execute the Q31 low pass filter
+ * \param filter Specifies PT1 filter.
+ * \param input Specifies the filter input in Q31.
+ *
+ * \return Returns the filter output in Q31
+ */
+sint32 Ifx_LowPassPt1Q31_do(Ifx_LowPassPt1Q31 *filter, sint32 input)
+{
+    filter->out = __adds(filter->out, __subs(__mulfractlong(filter->a, input), __mulfractlong(filter->b, filter->out)));
+    return filter->out;
+}
+
+
+/** \brief Initialize a float32 batch of low pass filters
+ *
+ * All channels get the same configuration, the outputs are reset.
+ *
+ * \param batch Specifies the PT1 batch.
+ * \param buffer Buffer of \ref IFX_LOWPASSPT1F32_BATCH_BUFFER_SIZE(count) elements for the parameters and outputs.
+ * \param count Number of channels.
+ * \param config Specifies the PT1 filter configuration.
+ *
+ * \return None
+ */
+void Ifx_LowPassPt1F32_initBatch(Ifx_LowPassPt1F32_Batch *batch, float32 *buffer, uint16 count, const Ifx_LowPassPt1F32_Config *config)
+{
+    uint16 channel;
+
+    batch->a     = &buffer[0];
+    batch->b     = &buffer[count];
+    batch->out   = &buffer[2 * count];
+    batch->count = count;
+
+    for (channel = 0; channel < count; channel++)
+    {
+        Ifx_LowPassPt1F32_setBatchChannel(batch, channel, config);
+    }
+
+    Ifx_LowPassPt1F32_resetBatch(batch);
+}
+
+
+/** \brief Set the configuration of one channel of a float32 batch
+ * \param batch Specifies the PT1 batch.
+ * \param channel Channel index.
+ * \param config Specifies the PT1 filter configuration.
+ *
+ * \return None
+ */
+void Ifx_LowPassPt1F32_setBatchChannel(Ifx_LowPassPt1F32_Batch *batch, uint16 channel, const Ifx_LowPassPt1F32_Config *config)
+{
+    Ifx_LowPassPt1F32 filter;
+
+    Ifx_LowPassPt1F32_init(&filter, config);
+    batch->a[channel] = filter.a;
+    batch->b[channel] = filter.b;
+}
+
+
+/** \brief Reset the outputs of a float32 batch
+ * \param batch Specifies the PT1 batch.
+ *
+ * \return None
+ */
+void Ifx_LowPassPt1F32_resetBatch(Ifx_LowPassPt1F32_Batch *batch)
+{
+    uint16 channel;
+
+    for (channel = 0; channel < batch->count; channel++)
+    {
+        batch->out[channel] = 0.0;
+    }
+}
+
+
+/** \brief Execute a float32 batch of low pass filters
+ * \param batch Specifies the PT1 batch. The outputs are stored in batch->out[]
+ * \param input Specifies the filter inputs, one per channel.
+ *
+ * \return None
+ */
+void Ifx_LowPassPt1F32_doBatch(Ifx_LowPassPt1F32_Batch *batch, const float32 *input)
+{
+    const float32 *a     = batch->a;
+    const float32 *b     = batch->b;
+    float32       *out   = batch->out;
+    uint16         count = batch->count;
+    uint16         i;
+
+    for (i = 0; (i + 4) <= count; i += 4)
+    {
+        float32 out0 = out[i];
+        float32 out1 = out[i + 1];
+        float32 out2 = out[i + 2];
+        float32 out3 = out[i + 3];
+
+        out[i]     = out0 + a[i] * input[i] - b[i] * out0;
+        out[i + 1] = out1 + a[i + 1] * input[i + 1] - b[i + 1] * out1;
+        out[i + 2] = out2 + a[i + 2] * input[i + 2] - b[i + 2] * out2;
+        out[i + 3] = out3 + a[i + 3] * input[i + 3] - b[i + 3] * out3;
+    }
+
+    for ( ; i < count; i++)
+    {
+        out[i] = out[i] + a[i] * input[i] - b[i] * out[i];
+    }
+}
+
+
+/** \brief Initialize a Q15 batch of low pass filters
+ *
+ * All channels get the same configuration, the outputs are reset.
+ *
+ * \param batch Specifies the PT1 batch.
+ * \param buffer Buffer of \ref IFX_LOWPASSPT1Q15_BATCH_BUFFER_SIZE(count) elements for the parameters and outputs.
+ * \param count Number of channels.
+ * \param config Specifies the PT1 filter configuration.
+ *
+ * \return None
+ */
+void Ifx_LowPassPt1Q15_initBatch(Ifx_LowPassPt1Q15_Batch *batch, __packhw *buffer, uint16 count, const Ifx_LowPassPt1F32_Config *config)
+{
+    uint16 pairCount = (count + 1) / 2;
+    uint16 channel;
+
+    batch->a     = &buffer[0];
+    batch->b     = &buffer[pairCount];
+    batch->out   = &buffer[2 * pairCount];
+    batch->count = count;
+
+    for (channel = 0; channel < (2 * pairCount); channel++)
+    {
+        Ifx_LowPassPt1Q15_setBatchChannel(batch, channel, config);
+    }
+
+    Ifx_LowPassPt1Q15_resetBatch(batch);
+}
+
+
+/** \brief Set the configuration of one channel of a Q15 batch
+ * \param batch Specifies the PT1 batch.
+ * \param channel Channel index.
+ * \param config Specifies the PT1 filter configuration.
+ *
+ * \return None
+ */
+void Ifx_LowPassPt1Q15_setBatchChannel(Ifx_LowPassPt1Q15_Batch *batch, uint16 channel, const Ifx_LowPassPt1F32_Config *config)
+{
+    Ifx_LowPassPt1F32 filter;
+
+    Ifx_LowPassPt1F32_init(&filter, config);
+    ((sint16 *)batch->a)[channel] = Ifx_LowPassPt1Q15_toQ15(filter.a);
+    ((sint16 *)batch->b)[channel] = Ifx_LowPassPt1Q15_toQ15(filter.b);
+}
+
+
+/** \brief Reset the outputs of a Q15 batch
+ * \param batch Specifies the PT1 batch.
+ *
+ * \return None
+ */
+void Ifx_LowPassPt1Q15_resetBatch(Ifx_LowPassPt1Q15_Batch *batch)
+{
+    uint16 pair;
+
+    for (pair = 0; pair < ((batch->count + 1) / 2); pair++)
+    {
+        batch->out[pair] = 0;
+    }
+}
+
+
+/** \brief Execute a Q15 batch of low pass filters
+ * \param batch Specifies the PT1 batch. The outputs are stored in batch->out[]
+ * \param input Specifies the filter inputs, one channel pair per element.
+ *
+ * \return None
+ */
+void Ifx_LowPassPt1Q15_doBatch(Ifx_LowPassPt1Q15_Batch *batch, const __packhw *input)
+{
+    const __packhw *a         = batch->a;
+    const __packhw *b         = batch->b;
+    __packhw       *out       = batch->out;
+    uint16          pairCount = (batch->count + 1) / 2;
+    uint16          pair;
+
+    for (pair = 0; pair < pairCount; pair++)
+    {
+        __packhw last = out[pair];
+
+        out[pair] = __msubrsh(__maddrsh(last, a[pair], input[pair]), b[pair], last);
+    }
+}
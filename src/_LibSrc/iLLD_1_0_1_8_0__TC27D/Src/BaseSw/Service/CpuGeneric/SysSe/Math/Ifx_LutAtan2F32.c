@@ -182,3 +182,86 @@ float32 Ifx_LutAtan2F32_float32(float32 y, float32 x)
 
     return angle;
 }
+
+
+boolean Ifx_LutAtan2F32_initTable(Ifx_LutAtan2F32_Table *table)
+{
+    boolean result = table->size > 0;
+
+    if (result)
+    {
+        sint32 k;
+
+        for (k = 0; k < IFX_LUTATAN2F32_TABLE_SIZE(table->size); k++)
+        {
+            table->table[k] = atanf((float32)k / table->size);
+        }
+    }
+
+    return result;
+}
+
+
+/** \brief Reduce (x, y) to the first octant
+ * \param y y coordinate
+ * \param x x coordinate
+ * \param swapped set to TRUE if |y| > |x|
+ * \return min(|x|, |y|) / max(|x|, |y|), 0 .. 1
+ */
+IFX_INLINE float32 Ifx_LutAtan2F32_ratio(float32 y, float32 x, boolean *swapped)
+{
+    float32 ax = (x < 0) ? -x : x;
+    float32 ay = (y < 0) ? -y : y;
+    float32 ratio;
+
+    *swapped = ay > ax;
+
+    if (*swapped)
+    {
+        ratio = ax / ay;
+    }
+    else
+    {
+        ratio = (ax > 0) ? (ay / ax) : 0.0f;
+    }
+
+    return ratio;
+}
+
+
+/** \brief Unfold the first octant angle into -IFX_PI .. IFX_PI */
+IFX_INLINE float32 Ifx_LutAtan2F32_unfold(float32 y, float32 x, boolean swapped, float32 angle)
+{
+    if (swapped)
+    {
+        angle = (IFX_PI / 2) - angle;
+    }
+
+    if (x < 0)
+    {
+        angle = IFX_PI - angle;
+    }
+
+    return (y < 0) ? -angle : angle;
+}
+
+
+float32 Ifx_LutAtan2F32_float32Table(const Ifx_LutAtan2F32_Table *table, float32 y, float32 x)
+{
+    boolean swapped;
+    float32 ratio = Ifx_LutAtan2F32_ratio(y, x, &swapped);
+    uint32  index = (uint32)((ratio * table->size) + 0.5f);
+
+    return Ifx_LutAtan2F32_unfold(y, x, swapped, table->table[index]);
+}
+
+
+float32 Ifx_LutAtan2F32_float32Interpolated(const Ifx_LutAtan2F32_Table *table, float32 y, float32 x)
+{
+    boolean swapped;
+    float32 position = Ifx_LutAtan2F32_ratio(y, x, &swapped) * table->size;
+    uint32  index    = (uint32)position;
+    float32 angle    = table->table[index] + ((table->table[index + 1] - table->table[index]) * (position - (float32)index));
+
+    return Ifx_LutAtan2F32_unfold(y, x, swapped, angle);
+}
@@ -53,4 +53,58 @@ IFX_EXTERN void Ifx_LutAtan2F32_init(void);
 IFX_EXTERN Ifx_Lut_FxpAngle Ifx_LutAtan2F32_fxpAngle(float32 x, float32 y);
 IFX_EXTERN float32          Ifx_LutAtan2F32_float32(float32 y, float32 x);
 
+//----------------------------------------------------------------------------------------
+/** \addtogroup library_srvsw_sysse_math_lut_atan2
+ * \{ */
+
+/** \brief Number of entries of a table with size intervals: atan(0 .. 1) plus one guard entry for the interpolation */
+#define IFX_LUTATAN2F32_TABLE_SIZE(size) ((size) + 2)
+
+/** \brief Define an arcus tangent table object with size intervals over the ratio 0 .. 1
+ *
+ * The table data is located with \ref IFX_CFG_LUT_TABLE_SECTION and generated by \ref Ifx_LutAtan2F32_initTable().
+ * Usage: IFX_LUTATAN2F32_TABLE(g_focAtan2, 64);
+ * \param name name of the \ref Ifx_LutAtan2F32_Table object
+ * \param size number of table intervals
+ */
+#define IFX_LUTATAN2F32_TABLE(name, size)                                                 \
+    static float32 name##Data[IFX_LUTATAN2F32_TABLE_SIZE(size)] IFX_CFG_LUT_TABLE_SECTION; \
+    Ifx_LutAtan2F32_Table name = {name##Data, (size)}
+
+/** \brief Arcus tangent table with a size selected per instance
+ *
+ * - Ifx_LutAtan2F32_float32Table() rounds the ratio to the nearest table entry, max error about 0.5 / size rad
+ * - Ifx_LutAtan2F32_float32Interpolated() interpolates linearly between two entries, max error about 0.081 / size^2 rad,
+ * e.g. 2.0e-5 rad with 64 intervals (66 entries)
+ */
+typedef struct
+{
+    float32 *table;         /**< \brief atan(k / size), k = 0 .. size + 1 */
+    uint16   size;          /**< \brief number of table intervals */
+} Ifx_LutAtan2F32_Table;
+
+/** \brief Generate the table data
+ * \param table Pointer to the table object defined with \ref IFX_LUTATAN2F32_TABLE()
+ * \return FALSE if the size is 0
+ */
+IFX_EXTERN boolean Ifx_LutAtan2F32_initTable(Ifx_LutAtan2F32_Table *table);
+
+/** \brief Look-up arcus tangent value of y/x with rounding to the nearest table entry
+ * \param table Pointer to the table object
+ * \param y y coordinate
+ * \param x x coordinate
+ * \return angle -IFX_PI .. IFX_PI, 0 if x and y are 0
+ */
+IFX_EXTERN float32 Ifx_LutAtan2F32_float32Table(const Ifx_LutAtan2F32_Table *table, float32 y, float32 x);
+
+/** \brief Look-up arcus tangent value of y/x with linear interpolation between two table entries
+ * \param table Pointer to the table object
+ * \param y y coordinate
+ * \param x x coordinate
+ * \return angle -IFX_PI .. IFX_PI, 0 if x and y are 0
+ */
+IFX_EXTERN float32 Ifx_LutAtan2F32_float32Interpolated(const Ifx_LutAtan2F32_Table *table, float32 y, float32 x);
+
+/** \} */
+
 #endif
@@ -32,7 +32,7 @@
 #define IFX_LUTLSINCOSF32_H
 //________________________________________________________________________________________
 
-#include "SysSe/Math/IFX_Cf32.h"
+#include "SysSe/Math/Ifx_Cf32.h"
 #include "Ifx_Lut.h"
 #include "Ifx_LutIndexedLinearF32.h"
 //________________________________________________________________________________________
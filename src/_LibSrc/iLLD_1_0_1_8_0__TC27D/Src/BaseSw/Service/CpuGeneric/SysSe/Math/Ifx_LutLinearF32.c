@@ -77,3 +77,53 @@ float32 Ifx_LutLinearF32_searchBin(const Ifx_LutLinearF32 *ml, float32 index)
 
     return (ml->segments[imin].gain * index) + ml->segments[imin].offset;
 }
+
+
+/** \brief Look-up table with local search from the previous segment
+ *
+ * Same result as \ref Ifx_LutLinearF32_searchBin(). The search walks from the segment found by the previous
+ * call: 1 or 2 comparisons when the input moves slowly.
+ *
+ * \param ml pointer to the multi-segment object
+ * \param index
+ * \param hint in: segment of the previous call (initialised once, e.g. to 0), out: segment of index
+ * \return linear interpolated value */
+float32 Ifx_LutLinearF32_searchHint(const Ifx_LutLinearF32 *ml, float32 index, sint16 *hint)
+{
+    sint16 last = ml->segmentCount - 1;
+    sint16 i    = *hint;
+
+    if ((i < 0) || (i > last))
+    {
+        i = 0;
+    }
+
+    if (ml->segments[1].boundary > ml->segments[0].boundary)
+    {
+        while ((i > 0) && (index <= ml->segments[i - 1].boundary))
+        {
+            i--;
+        }
+
+        while ((i < last) && (index > ml->segments[i].boundary))
+        {
+            i++;
+        }
+    }
+    else
+    {
+        while ((i > 0) && (index >= ml->segments[i - 1].boundary))
+        {
+            i--;
+        }
+
+        while ((i < last) && (index < ml->segments[i].boundary))
+        {
+            i++;
+        }
+    }
+
+    *hint = i;
+
+    return (ml->segments[i].gain * index) + ml->segments[i].offset;
+}
@@ -0,0 +1,125 @@
+/**
+ * \file Ifx_LutMapF32.c
+ * \brief Curve and map look-up with prelookup of the axes
+ *
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_LutMapF32.h"
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+
+/** \brief Fraction of the input inside the bin, clamped to 0.0 .. 1.0 */
+static void Ifx_LutMapF32_setFraction(const Ifx_LutMapF32_Axis *axis, float32 x, uint16 index, Ifx_LutMapF32_AxisIndex *result)
+{
+    const float32 *p        = &axis->points[index];
+    float32        fraction = (x - p[0]) / (p[1] - p[0]);
+
+    result->index    = index;
+    result->fraction = __minf(__maxf(fraction, 0.0f), 1.0f);
+}
+
+
+float32 Ifx_LutMapF32_curve(const Ifx_LutMapF32_Curve *curve, float32 x)
+{
+    Ifx_LutMapF32_AxisIndex index;
+
+    Ifx_LutMapF32_searchAxis(curve->axis, x, &index);
+
+    return Ifx_LutMapF32_interpolateCurve(curve, &index);
+}
+
+
+void Ifx_LutMapF32_interpolateMaps(const Ifx_LutMapF32_Map *const *maps, uint16 count, const Ifx_LutMapF32_AxisIndex *row, const Ifx_LutMapF32_AxisIndex *column, float32 *results)
+{
+    /* bilinear weights of the 4 values of the cell, common to all maps */
+    float32 w11 = row->fraction * column->fraction;
+    float32 w10 = row->fraction - w11;
+    float32 w01 = column->fraction - w11;
+    float32 w00 = 1.0f - row->fraction - w01;
+    uint16  i;
+
+    for (i = 0; i < count; i++)
+    {
+        uint16         columns = maps[i]->columnAxis->count;
+        const float32 *v0      = &maps[i]->values[(row->index * columns) + column->index];
+        const float32 *v1      = &v0[columns];
+
+        results[i] = (w00 * v0[0]) + (w01 * v0[1]) + (w10 * v1[0]) + (w11 * v1[1]);
+    }
+}
+
+
+float32 Ifx_LutMapF32_map(const Ifx_LutMapF32_Map *map, float32 x, float32 y)
+{
+    Ifx_LutMapF32_AxisIndex row;
+    Ifx_LutMapF32_AxisIndex column;
+
+    Ifx_LutMapF32_searchAxis(map->rowAxis, x, &row);
+    Ifx_LutMapF32_searchAxis(map->columnAxis, y, &column);
+
+    return Ifx_LutMapF32_interpolateMap(map, &row, &column);
+}
+
+
+void Ifx_LutMapF32_searchAxis(const Ifx_LutMapF32_Axis *axis, float32 x, Ifx_LutMapF32_AxisIndex *result)
+{
+    const float32 *p    = axis->points;
+    sint32         imin = 0;
+    sint32         imax = axis->count - 2;
+    sint32         imid;
+
+    /* last bin whose lower breakpoint is below or equal to the input, bin 0 below the axis */
+    while (imin < imax)
+    {
+        imid = (imin + imax + 1) / 2;
+
+        if (x >= p[imid])
+        {
+            imin = imid;
+        }
+        else
+        {
+            imax = imid - 1;
+        }
+    }
+
+    Ifx_LutMapF32_setFraction(axis, x, (uint16)imin, result);
+}
+
+
+void Ifx_LutMapF32_searchAxisHint(const Ifx_LutMapF32_Axis *axis, float32 x, Ifx_LutMapF32_AxisIndex *result)
+{
+    const float32 *p    = axis->points;
+    sint32         last = axis->count - 2;
+    sint32         i    = __min(result->index, last);
+
+    while ((i > 0) && (x < p[i]))
+    {
+        i--;
+    }
+
+    while ((i < last) && (x >= p[i + 1]))
+    {
+        i++;
+    }
+
+    Ifx_LutMapF32_setFraction(axis, x, (uint16)i, result);
+}
@@ -68,3 +68,80 @@ float32 Ifx_LutSincosF32_sin(Ifx_Lut_FxpAngle fxpAngle)
 
     return result;
 }
+
+
+boolean Ifx_LutSincosF32_initTable(Ifx_LutSincosF32_Table *table)
+{
+    boolean result = (table->bits >= 3) && (table->bits <= IFX_LUT_ANGLE_BITS);
+
+    if (result)
+    {
+        sint32  k;
+        sint32  size = IFX_LUTSINCOSF32_TABLE_SIZE(table->bits);
+        float32 step = (IFX_PI * 2) / (float32)(1 << table->bits);
+
+        for (k = 0; k < size; k++)
+        {
+            table->table[k] = sinf(step * k);
+        }
+
+        table->fractionScale = 1.0f / (float32)(1 << (IFX_LUT_ANGLE_BITS - table->bits));
+    }
+
+    return result;
+}
+
+
+float32 Ifx_LutSincosF32_sinTable(const Ifx_LutSincosF32_Table *table, Ifx_Lut_FxpAngle fxpAngle)
+{
+    float32 result;
+    sint32  shift   = IFX_LUT_ANGLE_BITS - table->bits;
+    sint32  quarter = 1 << (table->bits - 2);
+    sint32  index   = ((fxpAngle + ((1 << shift) >> 1)) >> shift) & ((quarter * 4) - 1);
+
+    if (index < quarter)
+    {
+        result = table->table[index];
+    }
+    else if (index < (quarter * 2))
+    {
+        result = table->table[(quarter * 2) - index];
+    }
+    else if (index < (quarter * 3))
+    {
+        result = -table->table[index - (quarter * 2)];
+    }
+    else
+    {
+        result = -table->table[(quarter * 4) - index];
+    }
+
+    return result;
+}
+
+
+float32 Ifx_LutSincosF32_sinInterpolated(const Ifx_LutSincosF32_Table *table, Ifx_Lut_FxpAngle fxpAngle)
+{
+    float32 result;
+    sint32  shift = IFX_LUT_ANGLE_BITS - table->bits;
+    sint32  index;
+    float32 fraction;
+
+    fxpAngle = fxpAngle & (IFX_LUT_ANGLE_RESOLUTION - 1);
+
+    /* Fold the angle into the first quarter, the guard entry is read with a fraction of 0 at IFX_PI / 2 */
+    if ((fxpAngle & (IFX_LUT_ANGLE_PI / 2)) == 0)
+    {
+        index = fxpAngle & ((IFX_LUT_ANGLE_PI / 2) - 1);
+    }
+    else
+    {
+        index = (IFX_LUT_ANGLE_PI / 2) - (fxpAngle & ((IFX_LUT_ANGLE_PI / 2) - 1));
+    }
+
+    fraction = (float32)(index & ((1 << shift) - 1)) * table->fractionScale;
+    index    = index >> shift;
+    result   = table->table[index] + ((table->table[index + 1] - table->table[index]) * fraction);
+
+    return (fxpAngle < IFX_LUT_ANGLE_PI) ? result : -result;
+}
@@ -0,0 +1,117 @@
+/**
+ * \file Ifx_PicFxp.c
+ * \brief PI controller in fixed point
+ *
+ *
+ * \version disabled
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+#include "Ifx_PicFxp.h"
+
+/** \brief Convert a value to Q31
+ * \param value value, full scale -1.0 .. 1.0
+ * \return Returns the saturated Q31 value
+ */
+static sint32 Ifx_PicQ31_toQ31(float32 value)
+{
+    float32 q31 = value * 2147483648.0f;
+
+    if (q31 >= 2147483647.0f)
+    {
+        return 0x7FFFFFFF;
+    }
+    else if (q31 <= -2147483648.0f)
+    {
+        return (sint32)0x80000000;
+    }
+    else
+    {
+        return (sint32)q31;
+    }
+}
+
+
+/** \brief Multiply a Q31 value with a gain mantissa and shift the product left with saturation
+ * \param mantissa Gain mantissa in Q31
+ * \param value Value in Q31
+ * \param shift Left shift of the product
+ * \return Returns the saturated product in Q31
+ */
+IFX_INLINE sint32 Ifx_PicQ31_mul(sint32 mantissa, sint32 value, uint8 shift)
+{
+    sint32 product = __mulfractlong(mantissa, value);
+    sint32 limit   = 0x7FFFFFFF >> shift;
+
+    return (sint32)((uint32)__saturate(product, -limit - 1, limit) << shift);
+}
+
+
+void Ifx_PicQ31_init(Ifx_PicQ31 *pic, const Ifx_PicQ31_Config *config)
+{
+    float32 kiTs  = config->ki * config->samplingTime;
+    float32 gain  = __maxf(__absf(config->kp), __absf(kiTs));
+    uint8   shift = 0;
+
+    /* smallest shift with both mantissas lower than 1 */
+    while ((gain >= 1.0f) && (shift < 30))
+    {
+        gain  = gain / 2;
+        shift = shift + 1;
+    }
+
+    pic->shift    = shift;
+    pic->kp       = Ifx_PicQ31_toQ31(config->kp / (float32)(1UL << shift));
+    pic->ki       = Ifx_PicQ31_toQ31(kiTs / (float32)(1UL << shift));
+    pic->min      = Ifx_PicQ31_toQ31(config->min);
+    pic->max      = Ifx_PicQ31_toQ31(config->max);
+    pic->integral = 0;
+}
+
+
+sint32 Ifx_PicQ31_step(Ifx_PicQ31 *pic, sint32 error)
+{
+    sint32 proportional = Ifx_PicQ31_mul(pic->kp, error, pic->shift);
+    sint32 integral     = __adds(pic->integral, Ifx_PicQ31_mul(pic->ki, error, pic->shift));
+    sint32 output       = __adds(proportional, integral);
+
+    if (output > pic->max)
+    {
+        output = pic->max;
+
+        if (error > 0)
+        {   /* anti-windup: no integration further into the limit */
+            integral = pic->integral;
+        }
+    }
+    else if (output < pic->min)
+    {
+        output = pic->min;
+
+        if (error < 0)
+        {
+            integral = pic->integral;
+        }
+    }
+    else
+    {}
+
+    pic->integral = __saturate(integral, pic->min, pic->max);
+
+    return output;
+}
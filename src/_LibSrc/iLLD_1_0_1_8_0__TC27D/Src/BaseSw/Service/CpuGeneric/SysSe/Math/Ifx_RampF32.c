@@ -49,3 +49,56 @@ float32 Ifx_RampF32_step(Ifx_RampF32 *ramp)
 
     return ramp->uk;
 }
+
+
+/**
+ * \brief Initialize the Ifx_RampQ31 object.
+ * \param ramp Pointer to the Ifx_RampQ31 object
+ * \param slewRate Maximum slew rate, full scale per second
+ * \param period Sampling period of the Ifx_RampQ31_step() function
+ */
+void Ifx_RampQ31_init(Ifx_RampQ31 *ramp, float32 slewRate, float32 period)
+{
+    Ifx_RampQ31_setSlewRate(ramp, slewRate, period);
+    Ifx_RampQ31_reset(ramp);
+}
+
+
+/**
+ * \brief Set the maximum slew rate
+ * \param ramp Pointer to the Ifx_RampQ31 object
+ * \param slewRate Maximum slew rate, full scale per second
+ * \param period Sampling period of the Ifx_RampQ31_step() function
+ */
+void Ifx_RampQ31_setSlewRate(Ifx_RampQ31 *ramp, float32 slewRate, float32 period)
+{
+    float32 delta = slewRate * period * 2147483648.0f;
+
+    ramp->delta = (delta >= 2147483647.0f) ? 0x7FFFFFFF : (sint32)__maxf(delta, 0.0f);
+}
+
+
+/**
+ * \brief Execute the Ramp function
+ *
+ * NOTE: shall be called every 'period'.
+ * The period was defined by Ifx_RampQ31_init() or Ifx_RampQ31_setSlewRate()
+ *
+ * \param ramp Pointer to the Ifx_RampQ31 object
+ * \return Actual value in Q31
+ */
+sint32 Ifx_RampQ31_step(Ifx_RampQ31 *ramp)
+{
+    if (ramp->uk < ramp->ik)
+    {
+        ramp->uk = __min(ramp->ik, __adds(ramp->uk, ramp->delta));
+    }
+    else if (ramp->uk > ramp->ik)
+    {
+        ramp->uk = __max(ramp->ik, __subs(ramp->uk, ramp->delta));
+    }
+    else
+    {}
+
+    return ramp->uk;
+}
@@ -25,6 +25,9 @@
  * \defgroup library_srvsw_sysse_math_f32_ramp Ramp
  * \ingroup library_srvsw_sysse_math_f32
  *
+ * \ref Ifx_RampQ31 is the fixed point counterpart of \ref Ifx_RampF32, the values are in Q31 (full scale
+ * [-1, 1[) and the slew rate in full scale per second.
+ *
  */
 
 #ifndef IFX_RAMPF32_H
@@ -42,6 +45,16 @@ typedef struct
     float32 delta;
 } Ifx_RampF32;
 
+/**
+ * \brief Ifx_RampQ31 object definition
+ */
+typedef struct
+{
+    sint32 uk;
+    sint32 ik;
+    sint32 delta;
+} Ifx_RampQ31;
+
 //________________________________________________________________________________________
 // FUNCTION PROTOTYPES
 
@@ -53,6 +66,12 @@ IFX_INLINE void    Ifx_RampF32_setSlewRate(Ifx_RampF32 *ramp, float32 slewRate,
 IFX_INLINE void    Ifx_RampF32_setRef(Ifx_RampF32 *ramp, float32 ref);
 IFX_INLINE float32 Ifx_RampF32_getValue(Ifx_RampF32 *ramp);
 IFX_EXTERN float32 Ifx_RampF32_step(Ifx_RampF32 *ramp);
+IFX_EXTERN void    Ifx_RampQ31_init(Ifx_RampQ31 *ramp, float32 slewRate, float32 period);
+IFX_INLINE void    Ifx_RampQ31_reset(Ifx_RampQ31 *ramp);
+IFX_EXTERN void    Ifx_RampQ31_setSlewRate(Ifx_RampQ31 *ramp, float32 slewRate, float32 period);
+IFX_INLINE void    Ifx_RampQ31_setRef(Ifx_RampQ31 *ramp, sint32 ref);
+IFX_INLINE sint32  Ifx_RampQ31_getValue(Ifx_RampQ31 *ramp);
+IFX_EXTERN sint32  Ifx_RampQ31_step(Ifx_RampQ31 *ramp);
 /** \} */
 
 //________________________________________________________________________________________
@@ -127,4 +146,37 @@ IFX_INLINE float32 Ifx_RampF32_getValue(Ifx_RampF32 *ramp)
 }
 
 
+/**
+ * \brief Reset internal values
+ * \param ramp Pointer to the Ifx_RampQ31 object
+ */
+IFX_INLINE void Ifx_RampQ31_reset(Ifx_RampQ31 *ramp)
+{
+    ramp->ik = 0;
+    ramp->uk = 0;
+}
+
+
+/**
+ * \brief Set the reference value
+ * \param ramp Pointer to the Ifx_RampQ31 object
+ * \param ref Reference value in Q31
+ */
+IFX_INLINE void Ifx_RampQ31_setRef(Ifx_RampQ31 *ramp, sint32 ref)
+{
+    ramp->ik = ref;
+}
+
+
+/**
+ * \brief Get the actual output value
+ * \param ramp Pointer to the Ifx_RampQ31 object
+ * \return Actual value in Q31
+ */
+IFX_INLINE sint32 Ifx_RampQ31_getValue(Ifx_RampQ31 *ramp)
+{
+    return ramp->uk;
+}
+
+
 #endif /* IFX_RAMPF32_H */
@@ -0,0 +1,262 @@
+/**
+ * \file Ifx_SpectrumAnalyzerF32.c
+ * \brief Streaming spectrum analyzer
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+//------------------------------------------------------------------------------
+#include "SysSe/Math/Ifx_SpectrumAnalyzerF32.h"
+#include <math.h>
+//------------------------------------------------------------------------------
+
+/** \brief Return the window value of a sample of the frame
+ * \param analyzer Specifies the spectrum analyzer.
+ * \param n Sample index in the frame
+ * \return Returns the window value
+ */
+IFX_INLINE float32 Ifx_SpectrumAnalyzerF32_getWindow(Ifx_SpectrumAnalyzerF32 *analyzer, uint32 n)
+{
+    uint32 step = IFX_WNDF32_TABLE_LENGTH / analyzer->length;
+
+    if (n >= (analyzer->length / 2U))
+    {   /* symmetrical window, using half of the length */
+        n = analyzer->length - 1 - n;
+    }
+
+    return analyzer->window[n * step];
+}
+
+
+/** \brief Accumulate the power of a bin into the back buffer
+ * \param analyzer Specifies the spectrum analyzer.
+ * \param spectrum Back buffer.
+ * \param k Bin index
+ * \param power Bin power of the frame
+ */
+IFX_INLINE void Ifx_SpectrumAnalyzerF32_accumulate(Ifx_SpectrumAnalyzerF32 *analyzer, float32 *spectrum, uint32 k, float32 power)
+{
+    if (analyzer->frameCount != 0)
+    {
+        power = power + spectrum[k];
+    }
+
+    if (analyzer->frameCount == (analyzer->averageCount - 1))
+    {   /* last frame of the spectrum */
+        power = power / (float32)analyzer->averageCount;
+
+        if (analyzer->output == Ifx_SpectrumAnalyzerF32_Output_magnitude)
+        {
+            power = sqrtf(power);
+        }
+    }
+
+    spectrum[k] = power;
+}
+
+
+/** \brief Transform the last nX samples and accumulate their power spectrum
+ * \param analyzer Specifies the spectrum analyzer.
+ */
+static void Ifx_SpectrumAnalyzerF32_processFrame(Ifx_SpectrumAnalyzerF32 *analyzer)
+{
+    cfloat32 *R        = analyzer->data;
+    uint32    nX       = analyzer->length;
+    uint32    nZ       = nX / 2;
+    uint32    mask     = nX - 1;
+    uint32    start    = analyzer->writeIndex; /* oldest sample */
+    float32  *spectrum = analyzer->spectrum[analyzer->frontIndex ^ 1];
+    uint32    n, k;
+    cfloat32  z0;
+
+    /* Window, pack the even / odd samples as real / imaginary part, in bit-reversed index */
+    for (n = 0; n < nZ; n++)
+    {
+        float32 even = analyzer->history[(start + (2 * n)) & mask];
+        float32 odd  = analyzer->history[(start + (2 * n) + 1) & mask];
+
+        if (analyzer->window != NULL_PTR)
+        {
+            even = even * Ifx_SpectrumAnalyzerF32_getWindow(analyzer, 2 * n);
+            odd  = odd * Ifx_SpectrumAnalyzerF32_getWindow(analyzer, (2 * n) + 1);
+        }
+
+        k         = Ifx_FftF32_lookUpReversedBits((uint16)n, analyzer->logLength - 1);
+        R[k].real = even;
+        R[k].imag = odd;
+    }
+
+    Ifx_FftF32_radix4DecimationInTime(R, analyzer->logLength - 1, analyzer->twiddle, nX);
+
+    /* Split as in Ifx_FftF32_real(), the bin power is accumulated instead of the bin */
+    z0 = R[0];
+    Ifx_SpectrumAnalyzerF32_accumulate(analyzer, spectrum, 0, __sqrf(z0.real + z0.imag));
+    Ifx_SpectrumAnalyzerF32_accumulate(analyzer, spectrum, nZ, __sqrf(z0.real - z0.imag));
+
+    for (k = 1; k <= (nZ / 2); k++)
+    {
+        cfloat32 a = R[k];
+        cfloat32 b = R[nZ - k];
+        cfloat32 e, o, w, t;
+
+        e.real = (a.real + b.real) * 0.5f;
+        e.imag = (a.imag - b.imag) * 0.5f;
+        o.real = (a.imag + b.imag) * 0.5f;
+        o.imag = (b.real - a.real) * 0.5f;
+        w      = analyzer->twiddle[k];
+        t      = IFX_Cf32_mul(&w, &o);
+
+        Ifx_SpectrumAnalyzerF32_accumulate(analyzer, spectrum, k, __sqrf(e.real + t.real) + __sqrf(e.imag + t.imag));
+
+        if (k != (nZ - k))
+        {
+            Ifx_SpectrumAnalyzerF32_accumulate(analyzer, spectrum, nZ - k, __sqrf(e.real - t.real) + __sqrf(t.imag - e.imag));
+        }
+    }
+
+    analyzer->frameCount++;
+
+    if (analyzer->frameCount >= analyzer->averageCount)
+    {   /* publish */
+        analyzer->frameCount = 0;
+        analyzer->frontIndex = analyzer->frontIndex ^ 1;
+        analyzer->spectrumCount++;
+    }
+}
+
+
+/** \brief Initialize the spectrum analyzer
+ *
+ * The twiddle factors are generated and the analyzer is reset.
+ *
+ * \param analyzer Specifies the spectrum analyzer.
+ * \param config Specifies the spectrum analyzer configuration.
+ *
+ * \return Returns TRUE on success, FALSE if the configuration is not valid
+ */
+boolean Ifx_SpectrumAnalyzerF32_init(Ifx_SpectrumAnalyzerF32 *analyzer, const Ifx_SpectrumAnalyzerF32_Config *config)
+{
+    uint32 nX = config->length;
+
+    if ((nX < 4) || (nX > IFX_WNDF32_TABLE_LENGTH) || ((nX & (nX - 1)) != 0)
+        || (config->overlap >= nX) || (config->averageCount == 0) || (config->buffer == NULL_PTR))
+    {
+        return FALSE;
+    }
+
+    analyzer->history      = &config->buffer[0];
+    analyzer->data         = (cfloat32 *)&config->buffer[nX];
+    analyzer->twiddle      = (cfloat32 *)&config->buffer[(2 * nX) + 2];
+    analyzer->spectrum[0]  = &config->buffer[(3 * nX) + 2];
+    analyzer->spectrum[1]  = &config->buffer[(3 * nX) + 2 + ((nX / 2) + 1)];
+    analyzer->window       = config->window;
+    analyzer->offset       = config->offset;
+    analyzer->gain         = config->gain;
+    analyzer->length       = (uint16)nX;
+    analyzer->hop          = (uint16)(nX - config->overlap);
+    analyzer->averageCount = config->averageCount;
+    analyzer->logLength    = (uint8)(31 - __clz(nX));
+    analyzer->output       = config->output;
+
+    Ifx_FftF32_generateTwiddleFactor(analyzer->twiddle, (sint16)nX);
+    Ifx_SpectrumAnalyzerF32_reset(analyzer);
+
+    return TRUE;
+}
+
+
+/** \brief Fill the configuration with default values
+ *
+ * Hann window, 50 % overlap, no averaging, power output, samples used as is.
+ *
+ * \param config Specifies the spectrum analyzer configuration.
+ * \param buffer Buffer of \ref IFX_SPECTRUMANALYZERF32_BUFFER_SIZE(length) elements
+ * \param length Transform length
+ *
+ * \return None
+ */
+void Ifx_SpectrumAnalyzerF32_initConfig(Ifx_SpectrumAnalyzerF32_Config *config, float32 *buffer, uint16 length)
+{
+    config->buffer       = buffer;
+    config->length       = length;
+    config->overlap      = length / 2;
+    config->averageCount = 1;
+    config->window       = Ifx_g_WndF32_hannTable;
+    config->offset       = 0.0f;
+    config->gain         = 1.0f;
+    config->output       = Ifx_SpectrumAnalyzerF32_Output_power;
+}
+
+
+/** \brief Clear the sample history and the spectra
+ * \param analyzer Specifies the spectrum analyzer.
+ *
+ * \return None
+ */
+void Ifx_SpectrumAnalyzerF32_reset(Ifx_SpectrumAnalyzerF32 *analyzer)
+{
+    analyzer->writeIndex    = 0;
+    analyzer->sampleCount   = 0;
+    analyzer->historyCount  = 0;
+    analyzer->frameCount    = 0;
+    analyzer->frontIndex    = 0;
+    analyzer->spectrumCount = 0;
+}
+
+
+/** \brief Add samples to the analyzer
+ *
+ * A frame is processed every nX - overlap samples once nX samples are available, i.e. this
+ * function may process several frames.
+ *
+ * \param analyzer Specifies the spectrum analyzer.
+ * \param samples Pointer to the first sample
+ * \param count Number of samples
+ * \param stride Distance between samples in sint16 elements, e.g. 2 for the lower halfwords of a 32-bit result block
+ *
+ * \return Returns TRUE if a new spectrum was published
+ */
+boolean Ifx_SpectrumAnalyzerF32_addSamples(Ifx_SpectrumAnalyzerF32 *analyzer, const sint16 *samples, uint32 count, uint16 stride)
+{
+    uint32  spectrumCount = analyzer->spectrumCount;
+    uint32  mask          = analyzer->length - 1;
+    float32 offset        = analyzer->offset;
+    float32 gain          = analyzer->gain;
+    uint32  i;
+
+    for (i = 0; i < count; i++)
+    {
+        analyzer->history[analyzer->writeIndex] = ((float32)samples[i * stride] - offset) * gain;
+        analyzer->writeIndex                    = (uint16)((analyzer->writeIndex + 1) & mask);
+        analyzer->sampleCount++;
+
+        if (analyzer->historyCount < analyzer->length)
+        {
+            analyzer->historyCount++;
+        }
+
+        if ((analyzer->historyCount == analyzer->length) && (analyzer->sampleCount >= analyzer->hop))
+        {
+            analyzer->sampleCount = 0;
+            Ifx_SpectrumAnalyzerF32_processFrame(analyzer);
+        }
+    }
+
+    return spectrumCount != analyzer->spectrumCount;
+}
@@ -0,0 +1,163 @@
+/**
+ * \file Ifx_SpectrumAnalyzerF32.h
+ * \brief Streaming spectrum analyzer
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_math_f32_spectrum Spectrum analyzer
+ * This module computes the averaged power spectrum of a real sample stream, e.g. the result blocks of
+ * the VADC DMA stream (\ref IfxLld_Vadc_Adc_Stream).
+ *
+ * The samples are converted to float32 ((sample - offset) * gain) into a history of nX samples.
+ * Every nX - overlap samples, a frame of the last nX samples is transformed with
+ * \ref Ifx_FftF32_real() fused with the other steps:
+ * - the window is applied while the samples are arranged in bit-reversed order for the first pass
+ * - the power |X[k]|^2 of each bin is accumulated into the output buffer by the post-twiddle pass
+ *
+ * After averageCount frames, the mean power (or its square root, the RMS magnitude) is published:
+ * the output is double buffered, \ref Ifx_SpectrumAnalyzerF32_getSpectrum() returns the last
+ * complete spectrum while the next one is accumulated in the other buffer. A spectrum stays valid
+ * while averageCount further frames are processed.
+ *
+ * The bins are not normalized: a sine of amplitude A at the frequency of bin k gives a power of
+ * (A * sum(window) / 2)^2.
+ *
+ * Usage example:
+ * \code
+ * #define SPECTRUM_LENGTH (1024)
+ * static float32                 spectrumBuffer[IFX_SPECTRUMANALYZERF32_BUFFER_SIZE(SPECTRUM_LENGTH)];
+ * static Ifx_SpectrumAnalyzerF32 spectrum;
+ *
+ * // initialisation
+ * Ifx_SpectrumAnalyzerF32_Config config;
+ * Ifx_SpectrumAnalyzerF32_initConfig(&config, spectrumBuffer, SPECTRUM_LENGTH);
+ * config.overlap      = SPECTRUM_LENGTH / 2;
+ * config.averageCount = 8;
+ * config.offset       = 0x800;     // 12-bit VADC results
+ * config.gain         = 1.0 / 0x800;
+ * Ifx_SpectrumAnalyzerF32_init(&spectrum, &config);
+ *
+ * // for each VADC stream block, the result is the lower halfword of each Ifx_VADC_RES
+ * const Ifx_VADC_RES *block = IfxVadc_Adc_getStreamBlock(&stream);
+ * if (block != NULL_PTR)
+ * {
+ *     Ifx_SpectrumAnalyzerF32_addSamples(&spectrum, (const sint16 *)block, blockSize, 2);
+ * }
+ *
+ * // consumer
+ * const float32 *power = Ifx_SpectrumAnalyzerF32_getSpectrum(&spectrum); // bins 0 .. SPECTRUM_LENGTH / 2
+ * \endcode
+ *
+ * \ingroup library_srvsw_sysse_math_f32
+ *
+ */
+
+#ifndef IFX_SPECTRUMANALYZERF32_H
+#define IFX_SPECTRUMANALYZERF32_H
+//------------------------------------------------------------------------------
+#include "SysSe/Math/Ifx_FftF32.h"
+#include "SysSe/Math/Ifx_WndF32.h"
+//------------------------------------------------------------------------------
+
+/** \brief Number of float32 elements of the analyzer buffer for a transform length nX:
+ * history (nX), FFT data (nX / 2 + 1 complex), twiddle factors (nX / 2 complex) and 2 spectra (nX / 2 + 1) */
+#define IFX_SPECTRUMANALYZERF32_BUFFER_SIZE(nX) ((4 * (nX)) + 4)
+
+/** \brief Spectrum output */
+typedef enum
+{
+    Ifx_SpectrumAnalyzerF32_Output_power     = 0, /**< \brief mean power |X[k]|^2 */
+    Ifx_SpectrumAnalyzerF32_Output_magnitude = 1  /**< \brief RMS magnitude, square root of the mean power */
+} Ifx_SpectrumAnalyzerF32_Output;
+
+/** \brief Spectrum analyzer object definition.
+ */
+typedef struct
+{
+    float32                       *history;        /**< \brief last nX samples, ring */
+    cfloat32                      *data;           /**< \brief FFT data, nX / 2 + 1 elements */
+    cfloat32                      *twiddle;        /**< \brief twiddle factors for nX */
+    float32                       *spectrum[2];    /**< \brief double buffered spectrum, nX / 2 + 1 bins each */
+    const float32                 *window;         /**< \brief half window table, NULL_PTR for the rectangular window */
+    float32                        offset;         /**< \brief sample offset */
+    float32                        gain;           /**< \brief sample gain */
+    uint16                         length;         /**< \brief transform length nX */
+    uint16                         hop;            /**< \brief number of new samples per frame */
+    uint16                         writeIndex;     /**< \brief next history index */
+    uint16                         sampleCount;    /**< \brief number of new samples since the last frame */
+    uint16                         historyCount;   /**< \brief number of valid history samples, up to nX */
+    uint16                         averageCount;   /**< \brief number of frames per spectrum */
+    uint16                         frameCount;     /**< \brief number of frames accumulated into the back buffer */
+    uint8                          logLength;      /**< \brief log2(nX) */
+    Ifx_SpectrumAnalyzerF32_Output output;         /**< \brief spectrum output */
+    volatile uint8                 frontIndex;     /**< \brief index of the last complete spectrum */
+    volatile uint32                spectrumCount;  /**< \brief number of published spectra */
+} Ifx_SpectrumAnalyzerF32;
+
+/** \brief Spectrum analyzer configuration */
+typedef struct
+{
+    float32                       *buffer;         /**< \brief Buffer of \ref IFX_SPECTRUMANALYZERF32_BUFFER_SIZE(length) elements */
+    uint16                         length;         /**< \brief Transform length nX, power of 2 from 4 up to IFX_WNDF32_TABLE_LENGTH */
+    uint16                         overlap;        /**< \brief Number of samples shared by consecutive frames, lower than length */
+    uint16                         averageCount;   /**< \brief Number of frames averaged per spectrum, at least 1 */
+    CONST_CFG float32             *window;         /**< \brief Window table, e.g. Ifx_g_WndF32_hannTable. NULL_PTR: rectangular window */
+    float32                        offset;         /**< \brief Offset removed from the samples */
+    float32                        gain;           /**< \brief Gain applied to the samples after the offset removal */
+    Ifx_SpectrumAnalyzerF32_Output output;         /**< \brief Spectrum output */
+} Ifx_SpectrumAnalyzerF32_Config;
+
+//------------------------------------------------------------------------------
+
+/** \addtogroup library_srvsw_sysse_math_f32_spectrum
+ * \{ */
+IFX_EXTERN boolean        Ifx_SpectrumAnalyzerF32_init(Ifx_SpectrumAnalyzerF32 *analyzer, const Ifx_SpectrumAnalyzerF32_Config *config);
+IFX_EXTERN void           Ifx_SpectrumAnalyzerF32_initConfig(Ifx_SpectrumAnalyzerF32_Config *config, float32 *buffer, uint16 length);
+IFX_EXTERN void           Ifx_SpectrumAnalyzerF32_reset(Ifx_SpectrumAnalyzerF32 *analyzer);
+IFX_EXTERN boolean        Ifx_SpectrumAnalyzerF32_addSamples(Ifx_SpectrumAnalyzerF32 *analyzer, const sint16 *samples, uint32 count, uint16 stride);
+IFX_INLINE const float32 *Ifx_SpectrumAnalyzerF32_getSpectrum(Ifx_SpectrumAnalyzerF32 *analyzer);
+IFX_INLINE uint32         Ifx_SpectrumAnalyzerF32_getSpectrumCount(Ifx_SpectrumAnalyzerF32 *analyzer);
+/** \} */
+
+//------------------------------------------------------------------------------
+
+/** \brief Return the last complete spectrum
+ * \param analyzer Specifies the spectrum analyzer.
+ * \return Returns the nX / 2 + 1 bins of the last complete spectrum, or NULL_PTR if no spectrum is available yet
+ */
+IFX_INLINE const float32 *Ifx_SpectrumAnalyzerF32_getSpectrum(Ifx_SpectrumAnalyzerF32 *analyzer)
+{
+    return (analyzer->spectrumCount != 0) ? analyzer->spectrum[analyzer->frontIndex] : NULL_PTR;
+}
+
+
+/** \brief Return the number of published spectra
+ *
+ * A change of the value indicates a new spectrum.
+ *
+ * \param analyzer Specifies the spectrum analyzer.
+ * \return Returns the number of spectra published since the initialisation
+ */
+IFX_INLINE uint32 Ifx_SpectrumAnalyzerF32_getSpectrumCount(Ifx_SpectrumAnalyzerF32 *analyzer)
+{
+    return analyzer->spectrumCount;
+}
+
+
+//------------------------------------------------------------------------------
+#endif
@@ -0,0 +1,46 @@
+/**
+ * \file Ifx_SvmF32.c
+ * \brief Space vector modulation
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_SvmF32.h"
+
+/******************************************************************************/
+IFX_CONST uint8 Ifx_g_Svm_phaseOrder[6][IFX_SVM_NUM_PHASES] = {
+    {0, 1, 2},  /* Sector 0: A > B > C */
+    {1, 0, 2},  /* Sector 1: B > A > C */
+    {1, 2, 0},  /* Sector 2: B > C > A */
+    {2, 1, 0},  /* Sector 3: C > B > A */
+    {2, 0, 1},  /* Sector 4: C > A > B */
+    {0, 2, 1},  /* Sector 5: A > C > B */
+};
+
+/******************************************************************************/
+void Ifx_SvmF32_minMax(Ifx_TimerValue *tOn, cfloat32 m, Ifx_TimerValue period)
+{
+    Ifx_SvmF32_minMaxInline(tOn, m, period);
+}
+
+
+uint8 Ifx_SvmF32_sector(Ifx_TimerValue *tOn, cfloat32 m, Ifx_TimerValue period)
+{
+    return Ifx_SvmF32_sectorInline(tOn, m, period);
+}
@@ -22,6 +22,20 @@
  *
  * \defgroup library_srvsw_sysse_time_datetime DateTime
  * This module implements the Date-Time functions.
+ *
+ * The clock \ref Ifx_DateTimeClock caches the time of the day: \ref DateTime_updateClock() advances it by the
+ * ticks elapsed since the last update with carries, instead of converting the absolute tick count each time.
+ * Called often (e.g. for each log line), an update costs one 32 bit division. \ref DateTime_format() writes the
+ * time without sprintf:
+ * \code
+ * Ifx_DateTimeClock clock;
+ * char              stamp[IFX_DATETIME_FORMAT_SIZE];
+ *
+ * DateTime_initClock(&clock);
+ *
+ * DateTime_updateClock(&clock);
+ * DateTime_format(&clock, stamp);    // "hh:mm:ss.mmm"
+ * \endcode
  * \ingroup library_srvsw_sysse_time
  */
 
@@ -34,10 +48,40 @@ typedef struct
     sint32 minutes;
     sint32 seconds;
 } Ifx_DateTime;
+
+/** \brief Incrementally updated time */
+typedef struct
+{
+    Ifx_DateTime time;             /**< \brief time, consistent with DateTime_get() */
+    sint32       milliseconds;     /**< \brief milliseconds of the current second */
+    Ifx_TickTime last;             /**< \brief tick of the current millisecond start */
+} Ifx_DateTimeClock;
+
+/** \brief Minimal buffer size for \ref DateTime_format(), "hh:mm:ss.mmm" with up to 5 digits hours */
+#define IFX_DATETIME_FORMAT_SIZE (16)
+
 /** \addtogroup library_srvsw_sysse_time_datetime
  * \{ */
 IFX_EXTERN void DateTime_set(Ifx_DateTime *time);
 IFX_EXTERN void DateTime_get(Ifx_DateTime *time);
+
+/** \brief Initialise the clock with the current time, see DateTime_get() */
+IFX_EXTERN void DateTime_initClock(Ifx_DateTimeClock *clock);
+
+/** \brief Advance the clock to the current time
+ *
+ * The elapsed ticks are converted with one 32 bit division when the last update is less than 1s old, and the
+ * carries are propagated to the seconds, minutes and hours.
+ * The clock shall be initialised again after DateTime_set().
+ */
+IFX_EXTERN void DateTime_updateClock(Ifx_DateTimeClock *clock);
+
+/** \brief Write the clock time as "hh:mm:ss.mmm"
+ * \param clock Clock
+ * \param buffer Destination, at least IFX_DATETIME_FORMAT_SIZE characters. The string is terminated by 0
+ * \return Returns the number of characters written, without the terminating 0
+ */
+IFX_EXTERN uint32 DateTime_format(const Ifx_DateTimeClock *clock, char *buffer);
 /** \} */
 
 #endif /* REALTIME_H_ */
@@ -0,0 +1,175 @@
+/**
+ * \file Ifx_IsrLatency.c
+ * \brief Interrupt latency and jitter measurement
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_IsrLatency.h"
+#include "SysSe/Comm/Ifx_Shell.h"
+#include "_Utilities/Ifx_Assert.h"
+
+static void Ifx_IsrLatency_clearEntry(Ifx_IsrLatency_Entry *entry)
+{
+    uint32 i;
+
+    entry->count = 0;
+    entry->last  = 0;
+    entry->min   = 0xFFFFFFFFU;
+    entry->max   = 0;
+    entry->sum   = 0;
+
+    for (i = 0; i < IFX_CFG_ISRLATENCY_HISTOGRAM_SIZE; i++)
+    {
+        entry->histogram[i] = 0;
+    }
+}
+
+
+void Ifx_IsrLatency_init(Ifx_IsrLatency *latency, uint8 binShift)
+{
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, binShift < 32);
+
+    latency->entryCount = 0;
+    latency->binShift   = binShift;
+}
+
+
+sint32 Ifx_IsrLatency_addEntry(Ifx_IsrLatency *latency, pchar name, uint16 priority)
+{
+    sint32 id = -1;
+
+    if (latency->entryCount < IFX_CFG_ISRLATENCY_MAX_ENTRIES)
+    {
+        Ifx_IsrLatency_Entry *entry = &latency->entries[latency->entryCount];
+
+        entry->name     = name;
+        entry->priority = priority;
+        Ifx_IsrLatency_clearEntry(entry);
+        id              = latency->entryCount;
+        latency->entryCount++;
+    }
+
+    return id;
+}
+
+
+void Ifx_IsrLatency_reset(Ifx_IsrLatency *latency)
+{
+    uint32 i;
+
+    for (i = 0; i < latency->entryCount; i++)
+    {
+        boolean interruptState = IfxCpu_disableInterrupts();
+        Ifx_IsrLatency_clearEntry(&latency->entries[i]);
+        IfxCpu_restoreInterrupts(interruptState);
+    }
+}
+
+
+void Ifx_IsrLatency_update(Ifx_IsrLatency *latency, sint32 id, uint32 ticks)
+{
+    Ifx_IsrLatency_Entry *entry;
+    uint32                bin;
+    boolean               interruptState;
+
+    if ((id >= 0) && (id < latency->entryCount))
+    {
+        entry = &latency->entries[id];
+        bin   = __minu(ticks >> latency->binShift, IFX_CFG_ISRLATENCY_HISTOGRAM_SIZE - 1);
+
+        /* Statistics are read and reset from other contexts */
+        interruptState = IfxCpu_disableInterrupts();
+        entry->count++;
+        entry->last  = ticks;
+        entry->min   = __minu(entry->min, ticks);
+        entry->max   = __maxu(entry->max, ticks);
+        entry->sum  += ticks;
+        entry->histogram[bin]++;
+        IfxCpu_restoreInterrupts(interruptState);
+    }
+}
+
+
+/** \brief Print the longest critical section of each CPU */
+static void Ifx_IsrLatency_showCriticalSections(IfxStdIf_DPipe *io)
+{
+#if IFX_CFG_BSP_CRITICAL_SECTION_MONITOR
+    uint32 i;
+
+    IfxStdIf_DPipe_print(io, "%-6s %10s %10s %s"ENDL, "CPU", "sections", "max cycles", "caller");
+
+    for (i = 0; i < IFXCPU_NUM_MODULES; i++)
+    {
+        Bsp_CriticalSection section = Bsp_g_criticalSection[i];
+
+        IfxStdIf_DPipe_print(io, "CPU%-3u %10u %10u %s"ENDL, i, section.count, section.max,
+            (section.maxCaller != NULL_PTR) ? section.maxCaller : "-");
+    }
+
+#else
+    IfxStdIf_DPipe_print(io, "Critical section monitor disabled (IFX_CFG_BSP_CRITICAL_SECTION_MONITOR)"ENDL);
+#endif
+}
+
+
+boolean Ifx_IsrLatency_showStatistics(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    Ifx_IsrLatency *latency = (Ifx_IsrLatency *)data;
+    uint32          i, j;
+
+    IfxStdIf_DPipe_print(io, "Latency in STM ticks, histogram bin width %u ticks"ENDL, 1U << latency->binShift);
+    IfxStdIf_DPipe_print(io, "%-16s %4s %10s %10s %10s %10s %10s"ENDL, "name", "prio", "count", "min", "mean", "max", "jitter");
+
+    for (i = 0; i < latency->entryCount; i++)
+    {
+        Ifx_IsrLatency_Entry entry;
+        uint32               min;
+        boolean              interruptState;
+
+        /* Consistent copy, the entry is updated by the interrupt */
+        interruptState = IfxCpu_disableInterrupts();
+        entry          = latency->entries[i];
+        IfxCpu_restoreInterrupts(interruptState);
+
+        min = (entry.count != 0) ? entry.min : 0;
+
+        IfxStdIf_DPipe_print(io, "%-16s %4u %10u %10u %10u %10u %10u"ENDL "%-16s",
+            entry.name, entry.priority, entry.count, min,
+            (entry.count != 0) ? (uint32)(entry.sum / entry.count) : 0,
+            entry.max, entry.max - min, "");
+
+        for (j = 0; j < IFX_CFG_ISRLATENCY_HISTOGRAM_SIZE; j++)
+        {
+            IfxStdIf_DPipe_print(io, " %u", entry.histogram[j]);
+        }
+
+        IfxStdIf_DPipe_print(io, ENDL);
+    }
+
+    Ifx_IsrLatency_showCriticalSections(io);
+
+    if (Ifx_Shell_matchToken(&args, "reset") != FALSE)
+    {
+        Ifx_IsrLatency_reset(latency);
+        resetCriticalSections();
+    }
+
+    return TRUE;
+}
@@ -0,0 +1,154 @@
+/**
+ * \file Ifx_IsrLatency.h
+ * \brief Interrupt latency and jitter measurement
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_time_isrlatency Interrupt latency
+ * \ingroup library_srvsw_sysse_time
+ *
+ * The latency of an interrupt is the time from its hardware event to the start of its service
+ * routine. For an STM compare interrupt, the event time is the compare value, and
+ * \ref Ifx_IsrLatency_measureStm() called first in the service routine compares it with the
+ * STM value. For other events, e.g. a GTM TIM capture, the caller computes the latency in
+ * STM ticks and passes it to \ref Ifx_IsrLatency_update().
+ *
+ * One entry is registered per interrupt priority. Each entry keeps the count, the minimal,
+ * maximal and mean latency, and a histogram: bin i counts the latencies with
+ * i * 2^binShift <= ticks < (i + 1) * 2^binShift, the last bin counts all longer latencies.
+ * The jitter of an entry is max - min.
+ *
+ * An entry must only be updated by one CPU. The STM comparator must compare the lower 32 bits
+ * of the timer (offset 0, size 32 bits, which is the IfxStm_initCompareConfig() default).
+ *
+ * Long critical sections are the usual cause of late interrupts: with
+ * IFX_CFG_BSP_CRITICAL_SECTION_MONITOR = 1 in Ifx_Cfg.h, the longest section of each CPU and
+ * its caller are printed by \ref Ifx_IsrLatency_showStatistics(), see \ref Bsp_CriticalSection.
+ *
+ * Usage example:
+ * \code
+ * static Ifx_IsrLatency isrLatency;
+ * static sint32         isrLatencyIdStm0;
+ *
+ * // initialisation
+ * Ifx_IsrLatency_init(&isrLatency, 2); // 4 STM ticks per bin
+ * isrLatencyIdStm0 = Ifx_IsrLatency_addEntry(&isrLatency, "stm0", ISR_PRIORITY_STM_INT0);
+ *
+ * // interrupt
+ * IFX_INTERRUPT(stm0Isr, 0, ISR_PRIORITY_STM_INT0)
+ * {
+ *     Ifx_IsrLatency_measureStm(&isrLatency, isrLatencyIdStm0, &MODULE_STM0, IfxStm_Comparator_0);
+ *     ...
+ * }
+ *
+ * // shell command list entry
+ * {"latency", "   : Show the interrupt latencies", &isrLatency, &Ifx_IsrLatency_showStatistics},
+ * \endcode
+ *
+ */
+#ifndef IFX_ISRLATENCY_H
+#define IFX_ISRLATENCY_H 1
+
+#include "Stm/Std/IfxStm.h"
+#include "SysSe/Bsp/Bsp.h"
+#include "StdIf/IfxStdIf_DPipe.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_ISRLATENCY_MAX_ENTRIES)
+#define IFX_CFG_ISRLATENCY_MAX_ENTRIES    (8)  /**<\brief Maximal number of entries */
+#endif
+
+#if !defined(IFX_CFG_ISRLATENCY_HISTOGRAM_SIZE)
+#define IFX_CFG_ISRLATENCY_HISTOGRAM_SIZE (16) /**<\brief Number of histogram bins per entry */
+#endif
+
+/** \addtogroup library_srvsw_sysse_time_isrlatency
+ * \{ */
+
+/** \brief Latency statistics of one interrupt priority */
+typedef struct
+{
+    pchar  name;                                            /**<\brief entry name */
+    uint16 priority;                                        /**<\brief interrupt priority */
+    uint32 count;                                           /**<\brief number of measurements */
+    uint32 last;                                            /**<\brief last latency in STM ticks */
+    uint32 min;                                             /**<\brief minimal latency in STM ticks */
+    uint32 max;                                             /**<\brief maximal latency in STM ticks */
+    uint64 sum;                                             /**<\brief sum of the latencies */
+    uint32 histogram[IFX_CFG_ISRLATENCY_HISTOGRAM_SIZE];    /**<\brief latency histogram */
+} Ifx_IsrLatency_Entry;
+
+/** \brief Latency measurement object */
+typedef struct
+{
+    Ifx_IsrLatency_Entry entries[IFX_CFG_ISRLATENCY_MAX_ENTRIES]; /**<\brief registered entries */
+    uint8                entryCount;                              /**<\brief number of registered entries */
+    uint8                binShift;                                /**<\brief histogram bin width is 2^binShift STM ticks */
+} Ifx_IsrLatency;
+
+/** \brief Initialize the latency measurement object
+ * \param latency Pointer to the latency measurement object
+ * \param binShift The histogram bin width is 2^binShift STM ticks
+ */
+IFX_EXTERN void Ifx_IsrLatency_init(Ifx_IsrLatency *latency, uint8 binShift);
+
+/** \brief Register an interrupt priority
+ * \param latency Pointer to the latency measurement object
+ * \param name entry name, must be a constant string
+ * \param priority interrupt priority
+ * \return Returns the entry ID, or -1 if the entry could not be registered
+ */
+IFX_EXTERN sint32 Ifx_IsrLatency_addEntry(Ifx_IsrLatency *latency, pchar name, uint16 priority);
+
+/** \brief Clear the statistics of all entries
+ * \param latency Pointer to the latency measurement object
+ */
+IFX_EXTERN void Ifx_IsrLatency_reset(Ifx_IsrLatency *latency);
+
+/** \brief Add a latency measurement to an entry
+ * \param latency Pointer to the latency measurement object
+ * \param id entry ID returned by \ref Ifx_IsrLatency_addEntry()
+ * \param ticks latency in STM ticks
+ */
+IFX_EXTERN void Ifx_IsrLatency_update(Ifx_IsrLatency *latency, sint32 id, uint32 ticks);
+
+/** \brief Measure the latency of an STM compare interrupt. Must be called first in the service routine
+ * \param latency Pointer to the latency measurement object
+ * \param id entry ID returned by \ref Ifx_IsrLatency_addEntry()
+ * \param stm Pointer to the STM module which raised the interrupt
+ * \param comparator comparator which raised the interrupt
+ */
+IFX_INLINE void Ifx_IsrLatency_measureStm(Ifx_IsrLatency *latency, sint32 id, Ifx_STM *stm, IfxStm_Comparator comparator)
+{
+    uint32 ticks = IfxStm_getLower(stm) - IfxStm_getCompare(stm, comparator);
+
+    Ifx_IsrLatency_update(latency, id, ticks);
+}
+
+
+/** \brief Shell command: print the statistics and the longest critical sections. With the argument "reset", the statistics are cleared afterwards
+ * \param args command arguments
+ * \param data Pointer to the latency measurement object
+ * \param io Pointer to the IfxStdIf_DPipe object
+ * \return TRUE
+ */
+IFX_EXTERN boolean Ifx_IsrLatency_showStatistics(pchar args, void *data, IfxStdIf_DPipe *io);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
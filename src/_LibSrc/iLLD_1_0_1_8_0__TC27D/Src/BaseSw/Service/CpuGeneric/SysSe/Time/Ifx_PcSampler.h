@@ -0,0 +1,164 @@
+/**
+ * \file Ifx_PcSampler.h
+ * \brief Statistical program counter sampling profiler
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_time_pcsampler PC sampling profiler
+ * \ingroup library_srvsw_sysse_time
+ *
+ * The PC sampler shows where the cycles are spent in the whole image, without instrumenting the code: a
+ * periodic interrupt of the highest priority of the CPU (STM compare, GTM TOM) calls
+ * \ref Ifx_PcSampler_sample(), which reads the program counter of the interrupted code and counts it in an
+ * address bin. Over many samples, the count of a bin is proportional to the time spent in its code.
+ *
+ * The interrupted program counter is read from the context save area: on interrupt entry the CPU sets A11 to the
+ * interrupted PC, and the call of \ref Ifx_PcSampler_sample() saves the upper context of the service routine,
+ * PCXI pointing to it, with this A11. \ref Ifx_PcSampler_sample() shall therefore be called directly from the
+ * service routine, and not from a function called by the service routine. The samples taken in other interrupts
+ * (interrupted priority not 0) are counted in interruptCount.
+ *
+ * The bins cover the address range [start, end[, each bin covers 2^binShift bytes, the smallest width for which
+ * the range fits into binCount bins. The samples outside the range are counted in outsideCount. One sampler
+ * object is used per CPU, its bins should be located in the DSPR of the CPU. The sampling costs a few tens of
+ * cycles: at 10 kHz and 200 MHz the overhead is below 0.1%. The sampling rate shall not be a multiple of the
+ * rate of a periodic task, else the samples are correlated with this task.
+ *
+ * The dump of \ref Ifx_PcSampler_dump() is a text format, which a host script symbolises with the ELF file of the
+ * build (1_ToolEnv/0_Build output, e.g. tricore-addr2line -f -e <elf> <address>, or the symbol table of the map
+ * file):
+ * \code
+ * PCSAMPLER cpu=<cpu> start=<address> binSize=<bytes> bins=<binCount> samples=<n> outside=<n> interrupt=<n> invalid=<n>
+ * <bin address> <count>        // one line per bin with samples, hexadecimal address, decimal count
+ * END
+ * \endcode
+ *
+ * Usage example:
+ * \code
+ * IFX_ALIGN(4) static uint32 pcSamplerBins[4096];     // DSPR of CPU0
+ * static Ifx_PcSampler       pcSampler;
+ *
+ * // initialisation, on CPU0
+ * Ifx_PcSampler_Config config;
+ * Ifx_PcSampler_initConfig(&config);
+ * config.bins     = pcSamplerBins;
+ * config.binCount = 4096;
+ * config.start    = 0x80000000;            // PFLASH, 1 KB bins for 4 MB
+ * config.end      = 0x80400000;
+ * Ifx_PcSampler_init(&pcSampler, &config);
+ * Ifx_PcSampler_start(&pcSampler);
+ *
+ * // STM compare interrupt of the highest priority, 10 kHz
+ * IFX_INTERRUPT(pcSamplerIsr, 0, ISR_PRIORITY_PCSAMPLER)
+ * {
+ *     Ifx_PcSampler_sample(&pcSampler);
+ *     IfxStm_increaseCompare(&MODULE_STM0, IfxStm_Comparator_1, pcSamplerTicks);
+ * }
+ *
+ * // shell command list entry
+ * {"pcsampler", "   : Dump the PC samples", &pcSampler, &Ifx_PcSampler_dump},
+ * \endcode
+ *
+ */
+#ifndef IFX_PCSAMPLER_H
+#define IFX_PCSAMPLER_H 1
+
+#include "Cpu/Std/IfxCpu.h"
+#include "StdIf/IfxStdIf_DPipe.h"
+
+/** \addtogroup library_srvsw_sysse_time_pcsampler
+ * \{ */
+
+/** \brief PC sampler configuration */
+typedef struct
+{
+    uint32 *bins;          /**<\brief Sample counters, binCount words */
+    uint32  binCount;      /**<\brief Number of bins */
+    uint32  start;         /**<\brief First address of the sampled range */
+    uint32  end;           /**<\brief Address following the sampled range */
+} Ifx_PcSampler_Config;
+
+/** \brief PC sampler object, one per CPU */
+typedef struct
+{
+    uint32            *bins;              /**<\brief Sample counters */
+    uint32             binCount;          /**<\brief Number of bins */
+    uint32             start;             /**<\brief First address of the sampled range */
+    uint32             size;              /**<\brief Size of the sampled range in bytes */
+    uint8              binShift;          /**<\brief A bin covers 2^binShift bytes */
+    volatile boolean   enabled;           /**<\brief TRUE if the samples are counted */
+    IfxCpu_ResourceCpu cpu;               /**<\brief CPU which is sampled */
+    uint32             sampleCount;       /**<\brief Number of samples */
+    uint32             outsideCount;      /**<\brief Number of samples outside the sampled range */
+    uint32             interruptCount;    /**<\brief Number of samples in interrupts */
+    uint32             invalidCount;      /**<\brief Number of samples without upper context, the sample function was not called from the service routine */
+} Ifx_PcSampler;
+
+/** \brief Shell command: dump the bins with samples, see \ref library_srvsw_sysse_time_pcsampler for the format. With the argument "reset", the samples are cleared afterwards
+ * \param args command arguments
+ * \param data Pointer to the PC sampler object
+ * \param io Pointer to the IfxStdIf_DPipe object
+ * \return TRUE
+ */
+IFX_EXTERN boolean Ifx_PcSampler_dump(pchar args, void *data, IfxStdIf_DPipe *io);
+
+/** \brief Initialize the PC sampler object for the calling CPU, stopped and cleared
+ * \param sampler Pointer to the PC sampler object
+ * \param config Pointer to the configuration
+ * \return Returns FALSE if there is no bin or the range is empty
+ */
+IFX_EXTERN boolean Ifx_PcSampler_init(Ifx_PcSampler *sampler, const Ifx_PcSampler_Config *config);
+
+/** \brief Initialize the configuration: no bin, PFLASH range 0x80000000 to 0x80400000
+ * \param config Pointer to the configuration
+ */
+IFX_EXTERN void Ifx_PcSampler_initConfig(Ifx_PcSampler_Config *config);
+
+/** \brief Clear the samples
+ * \param sampler Pointer to the PC sampler object
+ */
+IFX_EXTERN void Ifx_PcSampler_reset(Ifx_PcSampler *sampler);
+
+/** \brief Count the program counter of the interrupted code
+ *
+ * Shall be called directly from the service routine of the sampling interrupt, on the sampled CPU.
+ * \param sampler Pointer to the PC sampler object
+ */
+IFX_EXTERN void Ifx_PcSampler_sample(Ifx_PcSampler *sampler);
+
+/** \brief Start counting the samples
+ * \param sampler Pointer to the PC sampler object
+ */
+IFX_INLINE void Ifx_PcSampler_start(Ifx_PcSampler *sampler)
+{
+    sampler->enabled = TRUE;
+}
+
+
+/** \brief Stop counting the samples, the sampling interrupt may continue
+ * \param sampler Pointer to the PC sampler object
+ */
+IFX_INLINE void Ifx_PcSampler_stop(Ifx_PcSampler *sampler)
+{
+    sampler->enabled = FALSE;
+}
+
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
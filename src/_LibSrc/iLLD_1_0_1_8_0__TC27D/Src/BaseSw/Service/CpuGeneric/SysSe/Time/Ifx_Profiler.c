@@ -0,0 +1,268 @@
+/**
+ * \file Ifx_Profiler.c
+ * \brief Task and interrupt cycle profiler
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include <string.h>
+
+#include "Ifx_Profiler.h"
+#include "SysSe/Comm/Ifx_Shell.h"
+#include "SysSe/General/Ifx_Format.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/** \brief Counter difference, the counters have 31 bits, bit 31 is the sticky overflow bit */
+#define IFX_PROFILER_DELTA(end, begin) (((end) - (begin)) & 0x7FFFFFFFU)
+
+static void Ifx_Profiler_clearEntry(Ifx_Profiler_Entry *entry)
+{
+    uint32 i;
+
+    entry->count          = 0;
+    entry->overrunCount   = 0;
+    entry->last           = 0;
+    entry->min            = 0xFFFFFFFFU;
+    entry->max            = 0;
+    entry->clockSum       = 0;
+    entry->instructionSum = 0;
+
+    for (i = 0; i < IFX_PROFILER_MULTI_COUNTERS; i++)
+    {
+        entry->counterSum[i] = 0;
+    }
+
+    for (i = 0; i < IFX_CFG_PROFILER_HISTOGRAM_SIZE; i++)
+    {
+        entry->histogram[i] = 0;
+    }
+}
+
+
+void Ifx_Profiler_init(Ifx_Profiler *profiler, uint8 binShift)
+{
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, binShift < 32);
+
+    profiler->entryCount = 0;
+    profiler->binShift   = binShift;
+    profiler->cpu        = IfxCpu_getCoreIndex();
+}
+
+
+sint32 Ifx_Profiler_addEntry(Ifx_Profiler *profiler, pchar name, uint32 budget)
+{
+    sint32 id = -1;
+
+    if (profiler->entryCount < IFX_CFG_PROFILER_MAX_ENTRIES)
+    {
+        Ifx_Profiler_Entry *entry = &profiler->entries[profiler->entryCount];
+
+        entry->name   = name;
+        entry->budget = budget;
+        Ifx_Profiler_clearEntry(entry);
+        id            = profiler->entryCount;
+        profiler->entryCount++;
+    }
+
+    return id;
+}
+
+
+void Ifx_Profiler_reset(Ifx_Profiler *profiler)
+{
+    uint32 i;
+
+    for (i = 0; i < profiler->entryCount; i++)
+    {
+        boolean interruptState = IfxCpu_disableInterrupts();
+        Ifx_Profiler_clearEntry(&profiler->entries[i]);
+        IfxCpu_restoreInterrupts(interruptState);
+    }
+}
+
+
+void Ifx_Profiler_accumulate(Ifx_Profiler_Mark *elapsed, const Ifx_Profiler_Mark *mark)
+{
+    Ifx_Profiler_Mark end;
+    uint32            i;
+
+    Ifx_Profiler_start(&end);
+    elapsed->clock       += IFX_PROFILER_DELTA(end.clock, mark->clock);
+    elapsed->instruction += IFX_PROFILER_DELTA(end.instruction, mark->instruction);
+
+    for (i = 0; i < IFX_PROFILER_MULTI_COUNTERS; i++)
+    {
+        elapsed->counter[i] += IFX_PROFILER_DELTA(end.counter[i], mark->counter[i]);
+    }
+}
+
+
+void Ifx_Profiler_record(Ifx_Profiler *profiler, sint32 id, const Ifx_Profiler_Mark *elapsed)
+{
+    Ifx_Profiler_Entry *entry;
+    uint32              cycles;
+    uint32              bin;
+    uint32              i;
+    boolean             interruptState;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, profiler->cpu == IfxCpu_getCoreIndex());
+
+    if ((id >= 0) && (id < profiler->entryCount))
+    {
+        entry  = &profiler->entries[id];
+        cycles = elapsed->clock;
+        bin    = __minu(cycles >> profiler->binShift, IFX_CFG_PROFILER_HISTOGRAM_SIZE - 1);
+
+        /* Statistics are read and reset from other contexts */
+        interruptState = IfxCpu_disableInterrupts();
+        entry->count++;
+        entry->last            = cycles;
+        entry->min             = __minu(entry->min, cycles);
+        entry->max             = __maxu(entry->max, cycles);
+        entry->clockSum       += cycles;
+        entry->instructionSum += elapsed->instruction;
+
+        for (i = 0; i < IFX_PROFILER_MULTI_COUNTERS; i++)
+        {
+            entry->counterSum[i] += elapsed->counter[i];
+        }
+
+        entry->histogram[bin]++;
+
+        if ((entry->budget != 0) && (cycles > entry->budget))
+        {
+            entry->overrunCount++;
+        }
+
+        IfxCpu_restoreInterrupts(interruptState);
+    }
+}
+
+
+void Ifx_Profiler_stop(Ifx_Profiler *profiler, sint32 id, const Ifx_Profiler_Mark *mark)
+{
+    Ifx_Profiler_Mark elapsed = {0, 0, {0, 0, 0}};
+
+    Ifx_Profiler_accumulate(&elapsed, mark);
+    Ifx_Profiler_record(profiler, id, &elapsed);
+}
+
+
+uint32 Ifx_Profiler_getMean(const Ifx_Profiler_Entry *entry)
+{
+    uint32 mean = 0;
+
+    if (entry->count != 0)
+    {
+        mean = (uint32)(entry->clockSum / entry->count);
+    }
+
+    return mean;
+}
+
+
+boolean Ifx_Profiler_showStatistics(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    Ifx_Profiler *profiler = (Ifx_Profiler *)data;
+    uint32        i, j;
+
+    IfxStdIf_DPipe_print(io, "CPU%d, histogram bin width %u cycles"ENDL, profiler->cpu, 1U << profiler->binShift);
+    IfxStdIf_DPipe_print(io, "%-16s %10s %10s %10s %10s %10s %8s %8s"ENDL, "name", "count", "min", "mean", "max", "overrun", "IPC%", "M1/M2/M3");
+
+    for (i = 0; i < profiler->entryCount; i++)
+    {
+        Ifx_Profiler_Entry entry;
+        uint32             ipc;
+        boolean            interruptState;
+
+        /* Consistent copy, the entry is updated by the measured task */
+        interruptState = IfxCpu_disableInterrupts();
+        entry          = profiler->entries[i];
+        IfxCpu_restoreInterrupts(interruptState);
+
+        ipc = (entry.clockSum != 0) ? (uint32)((entry.instructionSum * 100) / entry.clockSum) : 0;
+
+        IfxStdIf_DPipe_print(io, "%-16s %10u %10u %10u %10u %10u %8u",
+            entry.name, entry.count, (entry.count != 0) ? entry.min : 0, Ifx_Profiler_getMean(&entry),
+            entry.max, entry.overrunCount, ipc);
+
+        for (j = 0; j < IFX_PROFILER_MULTI_COUNTERS; j++)
+        {
+            IfxStdIf_DPipe_print(io, " %u", (entry.count != 0) ? (uint32)(entry.counterSum[j] / entry.count) : 0);
+        }
+
+        IfxStdIf_DPipe_print(io, ENDL "%-16s", "");
+
+        for (j = 0; j < IFX_CFG_PROFILER_HISTOGRAM_SIZE; j++)
+        {
+            IfxStdIf_DPipe_print(io, " %u", entry.histogram[j]);
+        }
+
+        IfxStdIf_DPipe_print(io, ENDL);
+    }
+
+    if (Ifx_Shell_matchToken(&args, "reset") != FALSE)
+    {
+        Ifx_Profiler_reset(profiler);
+    }
+
+    return TRUE;
+}
+
+
+void Ifx_Profiler_printRecords(const Ifx_Profiler *profiler, pchar tag, IfxStdIf_DPipe *io)
+{
+    uint32 i;
+
+    for (i = 0; i < profiler->entryCount; i++)
+    {
+        Ifx_Profiler_Entry entry;
+        uint32             meanInstructions;
+        boolean            interruptState;
+        char               line[STDIF_DPIPE_MAX_PRINT_SIZE + 1];
+        Ifx_Format         fmt;
+
+        /* Consistent copy, the entry is updated by the measured task */
+        interruptState = IfxCpu_disableInterrupts();
+        entry          = profiler->entries[i];
+        IfxCpu_restoreInterrupts(interruptState);
+
+        meanInstructions = (entry.count != 0) ? (uint32)(entry.instructionSum / entry.count) : 0;
+
+        /* Same text as "%s,%d,%s,%u,%u,%u,%u,%u", without vsprintf() in the reporting task */
+        Ifx_Format_init(&fmt, line, sizeof(line));
+        Ifx_Format_string(&fmt, tag);
+        Ifx_Format_char(&fmt, ',');
+        Ifx_Format_uint32(&fmt, (uint32)profiler->cpu, 0);
+        Ifx_Format_char(&fmt, ',');
+        Ifx_Format_string(&fmt, entry.name);
+        Ifx_Format_char(&fmt, ',');
+        Ifx_Format_uint32(&fmt, entry.count, 0);
+        Ifx_Format_char(&fmt, ',');
+        Ifx_Format_uint32(&fmt, (entry.count != 0) ? entry.min : 0, 0);
+        Ifx_Format_char(&fmt, ',');
+        Ifx_Format_uint32(&fmt, entry.max, 0);
+        Ifx_Format_char(&fmt, ',');
+        Ifx_Format_uint32(&fmt, Ifx_Profiler_getMean(&entry), 0);
+        Ifx_Format_char(&fmt, ',');
+        Ifx_Format_uint32(&fmt, meanInstructions, 0);
+        Ifx_Format_string(&fmt, ENDL);
+        Ifx_Format_write(&fmt, io);
+    }
+}
@@ -0,0 +1,229 @@
+/**
+ * \file Ifx_Profiler.h
+ * \brief Task and interrupt cycle profiler
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_time_profiler Profiler
+ * \ingroup library_srvsw_sysse_time
+ *
+ * The profiler records the CPU performance counters (CCNT, ICNT, M1CNT, M2CNT, M3CNT) on entry and
+ * exit of registered tasks and interrupts, and keeps for each of them the execution count, the
+ * minimal, maximal and mean cycle count, the sums of the instruction and multi counters and a
+ * histogram of the cycle count.
+ *
+ * The performance counters are CPU local: one \ref Ifx_Profiler object is used per CPU, and
+ * the entries of an object must only be measured on the CPU which called \ref Ifx_Profiler_init().
+ * The counters must be running, see \ref IfxCpu_resetAndStartCounters(). The events counted by the
+ * multi counters are selected with \ref IfxCpu_setPerfCounterEvents().
+ *
+ * The measured values include the time spent in nested interrupts.
+ *
+ * The histogram bin i counts the executions with i * 2^binShift <= cycles < (i + 1) * 2^binShift,
+ * the last bin counts all longer executions.
+ *
+ * The statistics can be printed with the shell command \ref Ifx_Profiler_showStatistics(), or the
+ * entry values (e.g. Ifx_Profiler_Entry::max) can be registered as
+ * \ref library_srvsw_sysse_comm_telemetry channels. \ref Ifx_Profiler_printRecords() prints them as
+ * comma separated lines, e.g. at the end of a simulator run, to compare the cycle and instruction counts
+ * between two software versions.
+ *
+ * Usage example:
+ * \code
+ * static Ifx_Profiler profilerCpu0;
+ * static sint32       profilerIdControl;
+ * static sint32       profilerIdAdc;
+ *
+ * // initialisation, on CPU0
+ * Ifx_Profiler_init(&profilerCpu0, 8);
+ * profilerIdControl = Ifx_Profiler_addEntry(&profilerCpu0, "control", 200000); // 1ms budget @ 200MHz
+ * profilerIdAdc     = Ifx_Profiler_addEntry(&profilerCpu0, "isrAdc", 0);
+ *
+ * // task
+ * {
+ *     Ifx_Profiler_Mark mark;
+ *     Ifx_Profiler_start(&mark);
+ *     control();
+ *     Ifx_Profiler_stop(&profilerCpu0, profilerIdControl, &mark);
+ * }
+ *
+ * // interrupt, in place of IFX_INTERRUPT(isrAdc, 0, ISR_PRIORITY_ADC) {...}
+ * IFX_PROFILER_INTERRUPT(isrAdc, 0, ISR_PRIORITY_ADC, &profilerCpu0, profilerIdAdc)
+ * {
+ *     ...
+ * }
+ *
+ * // shell command list entry
+ * {"profiler", "   : Show the profiler statistics", &profilerCpu0, &Ifx_Profiler_showStatistics},
+ * \endcode
+ *
+ */
+#ifndef IFX_PROFILER_H
+#define IFX_PROFILER_H 1
+
+#include "Cpu/Std/IfxCpu.h"
+#include "StdIf/IfxStdIf_DPipe.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_PROFILER_MAX_ENTRIES)
+#define IFX_CFG_PROFILER_MAX_ENTRIES    (16) /**<\brief Maximal number of entries per profiler */
+#endif
+
+#if !defined(IFX_CFG_PROFILER_HISTOGRAM_SIZE)
+#define IFX_CFG_PROFILER_HISTOGRAM_SIZE (16) /**<\brief Number of histogram bins per entry */
+#endif
+
+/** \brief Number of multi counters (M1CNT, M2CNT, M3CNT) */
+#define IFX_PROFILER_MULTI_COUNTERS     (3)
+
+/** \brief Define the interrupt isr, measured as entry id of profiler
+ *
+ * The macro is used in place of IFX_INTERRUPT() and is followed by the body of the interrupt.
+ * \param isr Interrupt service routine name
+ * \param vectabNum vector table number
+ * \param prio interrupt priority
+ * \param profiler Pointer to the profiler object of the CPU which services the interrupt
+ * \param id entry ID returned by \ref Ifx_Profiler_addEntry()
+ */
+#define IFX_PROFILER_INTERRUPT(isr, vectabNum, prio, profiler, id) \
+    static void isr##_profiled(void);                              \
+    IFX_INTERRUPT(isr, vectabNum, prio)                            \
+    {                                                              \
+        Ifx_Profiler_Mark mark;                                    \
+        Ifx_Profiler_start(&mark);                                 \
+        isr##_profiled();                                          \
+        Ifx_Profiler_stop((profiler), (id), &mark);                \
+    }                                                              \
+    static void isr##_profiled(void)
+
+/** \addtogroup library_srvsw_sysse_time_profiler
+ * \{ */
+
+/** \brief Counter values at the start of a measurement */
+typedef struct
+{
+    uint32 clock;                                   /**<\brief CCNT value */
+    uint32 instruction;                             /**<\brief ICNT value */
+    uint32 counter[IFX_PROFILER_MULTI_COUNTERS];    /**<\brief M1CNT, M2CNT and M3CNT values */
+} Ifx_Profiler_Mark;
+
+/** \brief Statistics of one task or interrupt */
+typedef struct
+{
+    pchar  name;                                            /**<\brief entry name */
+    uint32 budget;                                          /**<\brief cycle budget, 0 if not checked */
+    uint32 count;                                           /**<\brief number of measurements */
+    uint32 overrunCount;                                    /**<\brief number of measurements longer than the budget */
+    uint32 last;                                            /**<\brief cycles of the last measurement */
+    uint32 min;                                             /**<\brief minimal cycles */
+    uint32 max;                                             /**<\brief maximal cycles */
+    uint64 clockSum;                                        /**<\brief sum of the cycles */
+    uint64 instructionSum;                                  /**<\brief sum of the instructions */
+    uint64 counterSum[IFX_PROFILER_MULTI_COUNTERS];         /**<\brief sums of the multi counters */
+    uint32 histogram[IFX_CFG_PROFILER_HISTOGRAM_SIZE];      /**<\brief cycle histogram */
+} Ifx_Profiler_Entry;
+
+/** \brief Profiler object, one per CPU */
+typedef struct
+{
+    Ifx_Profiler_Entry entries[IFX_CFG_PROFILER_MAX_ENTRIES]; /**<\brief registered entries */
+    uint8              entryCount;                            /**<\brief number of registered entries */
+    uint8              binShift;                              /**<\brief histogram bin width is 2^binShift cycles */
+    IfxCpu_ResourceCpu cpu;                                   /**<\brief CPU on which the entries are measured */
+} Ifx_Profiler;
+
+/** \brief Initialize the profiler object for the calling CPU
+ * \param profiler Pointer to the profiler object
+ * \param binShift The histogram bin width is 2^binShift cycles
+ */
+IFX_EXTERN void Ifx_Profiler_init(Ifx_Profiler *profiler, uint8 binShift);
+
+/** \brief Register a task or interrupt
+ * \param profiler Pointer to the profiler object
+ * \param name entry name, must be a constant string
+ * \param budget cycle budget, 0 if not checked
+ * \return Returns the entry ID, or -1 if the entry could not be registered
+ */
+IFX_EXTERN sint32 Ifx_Profiler_addEntry(Ifx_Profiler *profiler, pchar name, uint32 budget);
+
+/** \brief Clear the statistics of all entries
+ * \param profiler Pointer to the profiler object
+ */
+IFX_EXTERN void Ifx_Profiler_reset(Ifx_Profiler *profiler);
+
+/** \brief Start a measurement
+ * \param mark Pointer to the counter values, usually on the stack
+ */
+IFX_INLINE void Ifx_Profiler_start(Ifx_Profiler_Mark *mark)
+{
+    mark->clock       = __mfcr(CPU_CCNT);
+    mark->instruction = __mfcr(CPU_ICNT);
+    mark->counter[0]  = __mfcr(CPU_M1CNT);
+    mark->counter[1]  = __mfcr(CPU_M2CNT);
+    mark->counter[2]  = __mfcr(CPU_M3CNT);
+}
+
+/** \brief Stop a measurement and update the statistics of the entry
+ * \param profiler Pointer to the profiler object
+ * \param id entry ID returned by \ref Ifx_Profiler_addEntry()
+ * \param mark Pointer to the counter values set by \ref Ifx_Profiler_start()
+ */
+IFX_EXTERN void Ifx_Profiler_stop(Ifx_Profiler *profiler, sint32 id, const Ifx_Profiler_Mark *mark);
+
+/** \brief Add the counter differences since a start to an elapsed value
+ *
+ * Used to measure an execution made of several segments, e.g. a preempted task: the elapsed value is cleared
+ * at the start of the execution, each segment is added, the sum is stored with \ref Ifx_Profiler_record().
+ * \param elapsed Pointer to the elapsed counter values
+ * \param mark Pointer to the counter values set by \ref Ifx_Profiler_start() at the start of the segment
+ */
+IFX_EXTERN void Ifx_Profiler_accumulate(Ifx_Profiler_Mark *elapsed, const Ifx_Profiler_Mark *mark);
+
+/** \brief Update the statistics of the entry with an elapsed value
+ * \param profiler Pointer to the profiler object
+ * \param id entry ID returned by \ref Ifx_Profiler_addEntry()
+ * \param elapsed Pointer to the elapsed counter values, see \ref Ifx_Profiler_accumulate()
+ */
+IFX_EXTERN void Ifx_Profiler_record(Ifx_Profiler *profiler, sint32 id, const Ifx_Profiler_Mark *elapsed);
+
+/** \brief Returns the mean cycle count of an entry, 0 if the entry was not measured
+ * \param entry Pointer to the entry
+ */
+IFX_EXTERN uint32 Ifx_Profiler_getMean(const Ifx_Profiler_Entry *entry);
+
+/** \brief Shell command: print the statistics. With the argument "reset", the statistics are cleared afterwards
+ * \param args command arguments
+ * \param data Pointer to the profiler object
+ * \param io Pointer to the IfxStdIf_DPipe object
+ * \return TRUE
+ */
+IFX_EXTERN boolean Ifx_Profiler_showStatistics(pchar args, void *data, IfxStdIf_DPipe *io);
+
+/** \brief Print one comma separated line per entry:
+ * \code
+ * <tag>,<cpu>,<name>,<count>,<min cycles>,<max cycles>,<mean cycles>,<mean instructions>
+ * \endcode
+ * \param profiler Pointer to the profiler object
+ * \param tag First field of the lines
+ * \param io Pointer to the IfxStdIf_DPipe object
+ */
+IFX_EXTERN void Ifx_Profiler_printRecords(const Ifx_Profiler *profiler, pchar tag, IfxStdIf_DPipe *io);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -0,0 +1,211 @@
+/**
+ * \file Ifx_Stopwatch.c
+ * \brief Nestable code section timing
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_Stopwatch.h"
+#include "SysSe/Comm/Ifx_Shell.h"
+#include "_Utilities/Ifx_Assert.h"
+
+static void Ifx_Stopwatch_clearSection(Ifx_Stopwatch_Section *section)
+{
+    section->count   = 0;
+    section->last    = 0;
+    section->min     = 0xFFFFFFFFU;
+    section->max     = 0;
+    section->sum     = 0;
+    section->selfSum = 0;
+}
+
+
+void Ifx_Stopwatch_init(Ifx_Stopwatch *stopwatch)
+{
+    stopwatch->sectionCount  = 0;
+    stopwatch->depth         = 0;
+    stopwatch->overflowCount = 0;
+    stopwatch->overhead      = 0;
+    stopwatch->cpu           = IfxCpu_getCoreIndex();
+}
+
+
+sint32 Ifx_Stopwatch_addSection(Ifx_Stopwatch *stopwatch, pchar name)
+{
+    sint32 id = -1;
+
+    if (stopwatch->sectionCount < IFX_CFG_STOPWATCH_MAX_SECTIONS)
+    {
+        Ifx_Stopwatch_Section *section = &stopwatch->sections[stopwatch->sectionCount];
+
+        section->name = name;
+        Ifx_Stopwatch_clearSection(section);
+        id            = stopwatch->sectionCount;
+        stopwatch->sectionCount++;
+    }
+
+    return id;
+}
+
+
+sint32 Ifx_Stopwatch_addTelemetry(Ifx_Stopwatch *stopwatch, sint32 id, Ifx_Telemetry *telemetry)
+{
+    sint32 channel = -1;
+
+    if ((id >= 0) && (id < stopwatch->sectionCount))
+    {
+        Ifx_Stopwatch_Section *section = &stopwatch->sections[id];
+        channel = Ifx_Telemetry_addChannel(telemetry, section->name, &section->last, sizeof(section->last));
+    }
+
+    return channel;
+}
+
+
+void Ifx_Stopwatch_calibrate(Ifx_Stopwatch *stopwatch)
+{
+    uint32 overhead = 0xFFFFFFFFU;
+    uint32 i;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, stopwatch->depth == 0);
+    stopwatch->overhead = 0;
+
+    for (i = 0; i < IFX_CFG_STOPWATCH_CALIBRATION_RUNS; i++)
+    {
+        Ifx_Stopwatch_begin(stopwatch, -1);
+        overhead = __minu(overhead, Ifx_Stopwatch_end(stopwatch));
+    }
+
+    stopwatch->overhead = overhead;
+}
+
+
+uint32 Ifx_Stopwatch_end(Ifx_Stopwatch *stopwatch)
+{
+    uint32 end     = Ifx_Stopwatch_now();
+    uint32 depth   = stopwatch->depth;
+    uint32 elapsed = 0;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, stopwatch->cpu == IfxCpu_getCoreIndex());
+
+    if (depth == 0)
+    {
+        /* end without begin */
+        return 0;
+    }
+
+    depth--;
+
+    if (depth < IFX_CFG_STOPWATCH_MAX_DEPTH)
+    {
+        Ifx_Stopwatch_Frame *frame = &stopwatch->stack[depth];
+        uint32               raw   = IFX_STOPWATCH_DELTA(end, frame->start);
+
+        elapsed = (raw > stopwatch->overhead) ? (raw - stopwatch->overhead) : 0;
+
+        if (depth > 0)
+        {
+            stopwatch->stack[depth - 1].children += raw;
+        }
+
+        if ((frame->id >= 0) && (frame->id < stopwatch->sectionCount))
+        {
+            Ifx_Stopwatch_Section *section = &stopwatch->sections[frame->id];
+
+            section->count++;
+            section->last     = elapsed;
+            section->min      = __minu(section->min, elapsed);
+            section->max      = __maxu(section->max, elapsed);
+            section->sum     += elapsed;
+            section->selfSum += (elapsed > frame->children) ? (elapsed - frame->children) : 0;
+        }
+    }
+    else
+    {
+        stopwatch->overflowCount++;
+    }
+
+    /* the slot is released after it is read */
+    stopwatch->depth = depth;
+
+    return elapsed;
+}
+
+
+uint32 Ifx_Stopwatch_getMean(const Ifx_Stopwatch_Section *section)
+{
+    uint32 mean = 0;
+
+    if (section->count != 0)
+    {
+        mean = (uint32)(section->sum / section->count);
+    }
+
+    return mean;
+}
+
+
+void Ifx_Stopwatch_reset(Ifx_Stopwatch *stopwatch)
+{
+    uint32 i;
+
+    for (i = 0; i < stopwatch->sectionCount; i++)
+    {
+        boolean interruptState = IfxCpu_disableInterrupts();
+        Ifx_Stopwatch_clearSection(&stopwatch->sections[i]);
+        IfxCpu_restoreInterrupts(interruptState);
+    }
+
+    stopwatch->overflowCount = 0;
+}
+
+
+boolean Ifx_Stopwatch_show(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    Ifx_Stopwatch *stopwatch = (Ifx_Stopwatch *)data;
+    uint32         i;
+
+    IfxStdIf_DPipe_print(io, "CPU%d, %s, overhead %u, stack overflows %u"ENDL, stopwatch->cpu,
+        (IFX_CFG_STOPWATCH_SOURCE == IFX_STOPWATCH_SOURCE_CCNT) ? "CPU cycles" : "STM ticks",
+        stopwatch->overhead, stopwatch->overflowCount);
+    IfxStdIf_DPipe_print(io, "%-16s %10s %10s %10s %10s %10s %10s"ENDL, "name", "count", "last", "min", "mean", "max", "self");
+
+    for (i = 0; i < stopwatch->sectionCount; i++)
+    {
+        Ifx_Stopwatch_Section section;
+        boolean               interruptState;
+
+        /* Consistent copy, the section is updated by the measured code */
+        interruptState = IfxCpu_disableInterrupts();
+        section        = stopwatch->sections[i];
+        IfxCpu_restoreInterrupts(interruptState);
+
+        IfxStdIf_DPipe_print(io, "%-16s %10u %10u %10u %10u %10u %10u"ENDL,
+            section.name, section.count, section.last, (section.count != 0) ? section.min : 0,
+            Ifx_Stopwatch_getMean(&section), section.max,
+            (section.count != 0) ? (uint32)(section.selfSum / section.count) : 0);
+    }
+
+    if (Ifx_Shell_matchToken(&args, "reset") != FALSE)
+    {
+        Ifx_Stopwatch_reset(stopwatch);
+    }
+
+    return TRUE;
+}
@@ -0,0 +1,225 @@
+/**
+ * \file Ifx_Stopwatch.h
+ * \brief Nestable code section timing
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_time_stopwatch Stopwatch
+ * \ingroup library_srvsw_sysse_time
+ *
+ * The stopwatch measures named code sections, which may be nested. For each section, a static table keeps the
+ * count, the last, minimal, maximal and mean inclusive time (nested sections included), and the mean self time
+ * (nested sections excluded).
+ *
+ * The time source is selected by IFX_CFG_STOPWATCH_SOURCE: the CPU clock counter CCNT (default, CPU cycles, the
+ * counter must be running, see \ref IfxCpu_resetAndStartCounters()) or the STM0 lower timer (STM ticks). Both are
+ * read with one instruction, \ref Ifx_Stopwatch_begin() and \ref Ifx_Stopwatch_end() have no critical section.
+ * \ref Ifx_Stopwatch_calibrate() measures the cost of an empty section, which is then subtracted from each
+ * measurement.
+ *
+ * One \ref Ifx_Stopwatch object is used per CPU. Interrupts may measure sections with the object of their CPU,
+ * as long as each section is measured from one context only: the interrupts are nested like the sections, the
+ * open sections of the interrupted code are kept. The inclusive times include the time spent in nested interrupts,
+ * the self times exclude the sections measured by the nested interrupts.
+ *
+ * The statistics are printed by the shell command \ref Ifx_Stopwatch_show(). The last time of a section is
+ * registered as \ref library_srvsw_sysse_comm_telemetry channel by \ref Ifx_Stopwatch_addTelemetry(), the other
+ * values (e.g. Ifx_Stopwatch_Section::max) can be registered directly.
+ *
+ * Usage example:
+ * \code
+ * static Ifx_Stopwatch stopwatchCpu0;
+ * static sint32        swControl, swObserver;
+ *
+ * // initialisation, on CPU0
+ * Ifx_Stopwatch_init(&stopwatchCpu0);
+ * swControl  = Ifx_Stopwatch_addSection(&stopwatchCpu0, "control");
+ * swObserver = Ifx_Stopwatch_addSection(&stopwatchCpu0, "observer");
+ * Ifx_Stopwatch_calibrate(&stopwatchCpu0);
+ *
+ * // task
+ * Ifx_Stopwatch_begin(&stopwatchCpu0, swControl);
+ * readSensors();
+ * Ifx_Stopwatch_begin(&stopwatchCpu0, swObserver);
+ * observer();
+ * Ifx_Stopwatch_end(&stopwatchCpu0);
+ * control();
+ * Ifx_Stopwatch_end(&stopwatchCpu0);
+ *
+ * // shell command list entry
+ * {"stopwatch", "   : Show the code section times", &stopwatchCpu0, &Ifx_Stopwatch_show},
+ * \endcode
+ *
+ */
+#ifndef IFX_STOPWATCH_H
+#define IFX_STOPWATCH_H 1
+
+#include "Cpu/Std/IfxCpu.h"
+#include "Stm/Std/IfxStm.h"
+#include "StdIf/IfxStdIf_DPipe.h"
+#include "SysSe/Comm/Ifx_Telemetry.h"
+
+//----------------------------------------------------------------------------------------
+#define IFX_STOPWATCH_SOURCE_CCNT           (0)  /**<\brief Time source: CPU clock counter */
+#define IFX_STOPWATCH_SOURCE_STM            (1)  /**<\brief Time source: STM0 lower timer */
+
+#if !defined(IFX_CFG_STOPWATCH_SOURCE)
+#define IFX_CFG_STOPWATCH_SOURCE            (IFX_STOPWATCH_SOURCE_CCNT) /**<\brief Time source */
+#endif
+
+#if !defined(IFX_CFG_STOPWATCH_MAX_SECTIONS)
+#define IFX_CFG_STOPWATCH_MAX_SECTIONS      (16) /**<\brief Maximal number of sections per stopwatch */
+#endif
+
+#if !defined(IFX_CFG_STOPWATCH_MAX_DEPTH)
+#define IFX_CFG_STOPWATCH_MAX_DEPTH         (8)  /**<\brief Maximal number of open sections, interrupts included */
+#endif
+
+#if !defined(IFX_CFG_STOPWATCH_CALIBRATION_RUNS)
+#define IFX_CFG_STOPWATCH_CALIBRATION_RUNS  (16) /**<\brief Number of empty sections measured by the calibration */
+#endif
+
+#if IFX_CFG_STOPWATCH_SOURCE == IFX_STOPWATCH_SOURCE_CCNT
+#define IFX_STOPWATCH_DELTA(end, begin) (((end) - (begin)) & 0x7FFFFFFFU) /**<\brief CCNT has 31 bits, bit 31 is the sticky overflow bit */
+#else
+#define IFX_STOPWATCH_DELTA(end, begin) ((end) - (begin))                  /**<\brief STM lower timer has 32 bits */
+#endif
+
+/** \addtogroup library_srvsw_sysse_time_stopwatch
+ * \{ */
+
+/** \brief Statistics of one code section, times in CPU cycles or STM ticks */
+typedef struct
+{
+    pchar  name;       /**<\brief section name */
+    uint32 count;      /**<\brief number of measurements */
+    uint32 last;       /**<\brief last inclusive time */
+    uint32 min;        /**<\brief minimal inclusive time */
+    uint32 max;        /**<\brief maximal inclusive time */
+    uint64 sum;        /**<\brief sum of the inclusive times */
+    uint64 selfSum;    /**<\brief sum of the self times */
+} Ifx_Stopwatch_Section;
+
+/** \brief Open section */
+typedef struct
+{
+    sint32 id;         /**<\brief section ID, -1 for an unregistered section */
+    uint32 start;      /**<\brief time source value at the start */
+    uint32 children;   /**<\brief time spent in the nested sections */
+} Ifx_Stopwatch_Frame;
+
+/** \brief Stopwatch object, one per CPU */
+typedef struct
+{
+    Ifx_Stopwatch_Section sections[IFX_CFG_STOPWATCH_MAX_SECTIONS];  /**<\brief registered sections */
+    Ifx_Stopwatch_Frame   stack[IFX_CFG_STOPWATCH_MAX_DEPTH];        /**<\brief open sections */
+    uint32                depth;                                     /**<\brief number of open sections, can exceed IFX_CFG_STOPWATCH_MAX_DEPTH */
+    uint32                overflowCount;                             /**<\brief number of sections not measured because the stack was full */
+    uint32                overhead;                                  /**<\brief cost of an empty section, subtracted from the measurements */
+    uint8                 sectionCount;                              /**<\brief number of registered sections */
+    IfxCpu_ResourceCpu    cpu;                                       /**<\brief CPU on which the sections are measured */
+} Ifx_Stopwatch;
+
+/** \brief Returns the time source value
+ * \return Returns CCNT or the STM0 lower timer, depending on IFX_CFG_STOPWATCH_SOURCE
+ */
+IFX_INLINE uint32 Ifx_Stopwatch_now(void)
+{
+#if IFX_CFG_STOPWATCH_SOURCE == IFX_STOPWATCH_SOURCE_CCNT
+    return __mfcr(CPU_CCNT);
+#else
+    return IfxStm_getLower(&MODULE_STM0);
+#endif
+}
+
+
+/** \brief Open a section
+ * \param stopwatch Pointer to the stopwatch object of the calling CPU
+ * \param id section ID returned by \ref Ifx_Stopwatch_addSection(), -1 to measure without statistics
+ */
+IFX_INLINE void Ifx_Stopwatch_begin(Ifx_Stopwatch *stopwatch, sint32 id)
+{
+    uint32 depth = stopwatch->depth;
+
+    /* the slot is reserved before it is written: an interrupt opens and closes its sections above it */
+    stopwatch->depth = depth + 1;
+
+    if (depth < IFX_CFG_STOPWATCH_MAX_DEPTH)
+    {
+        Ifx_Stopwatch_Frame *frame = &stopwatch->stack[depth];
+        frame->id       = id;
+        frame->children = 0;
+        frame->start    = Ifx_Stopwatch_now();
+    }
+}
+
+
+/** \brief Initialize the stopwatch object for the calling CPU, no section is registered
+ * \param stopwatch Pointer to the stopwatch object
+ */
+IFX_EXTERN void Ifx_Stopwatch_init(Ifx_Stopwatch *stopwatch);
+
+/** \brief Register a section
+ * \param stopwatch Pointer to the stopwatch object
+ * \param name section name, must be a constant string
+ * \return Returns the section ID, or -1 if the section could not be registered
+ */
+IFX_EXTERN sint32 Ifx_Stopwatch_addSection(Ifx_Stopwatch *stopwatch, pchar name);
+
+/** \brief Register the last time of a section as telemetry channel named after the section
+ * \param stopwatch Pointer to the stopwatch object
+ * \param id section ID returned by \ref Ifx_Stopwatch_addSection()
+ * \param telemetry Pointer to the telemetry object
+ * \return Returns the channel ID, or -1 if the channel could not be registered
+ */
+IFX_EXTERN sint32 Ifx_Stopwatch_addTelemetry(Ifx_Stopwatch *stopwatch, sint32 id, Ifx_Telemetry *telemetry);
+
+/** \brief Measure the cost of an empty section, subtracted from the following measurements
+ *
+ * Called once after \ref Ifx_Stopwatch_init(), on the CPU of the stopwatch, outside of any section.
+ * \param stopwatch Pointer to the stopwatch object
+ */
+IFX_EXTERN void Ifx_Stopwatch_calibrate(Ifx_Stopwatch *stopwatch);
+
+/** \brief Close the last opened section and update its statistics
+ * \param stopwatch Pointer to the stopwatch object of the calling CPU
+ * \return Returns the inclusive time of the section, 0 if the section was not measured
+ */
+IFX_EXTERN uint32 Ifx_Stopwatch_end(Ifx_Stopwatch *stopwatch);
+
+/** \brief Returns the mean inclusive time of a section, 0 if the section was not measured
+ * \param section Pointer to the section
+ */
+IFX_EXTERN uint32 Ifx_Stopwatch_getMean(const Ifx_Stopwatch_Section *section);
+
+/** \brief Clear the statistics of all sections
+ * \param stopwatch Pointer to the stopwatch object
+ */
+IFX_EXTERN void Ifx_Stopwatch_reset(Ifx_Stopwatch *stopwatch);
+
+/** \brief Shell command: print the statistics. With the argument "reset", the statistics are cleared afterwards
+ * \param args command arguments
+ * \param data Pointer to the stopwatch object
+ * \param io Pointer to the IfxStdIf_DPipe object
+ * \return TRUE
+ */
+IFX_EXTERN boolean Ifx_Stopwatch_show(pchar args, void *data, IfxStdIf_DPipe *io);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
@@ -0,0 +1,234 @@
+/**
+ * \file Ifx_TimeCorrelation.c
+ * \brief Correlation of the GTM TBU time stamps with the system timer
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_TimeCorrelation.h"
+#include "SysSe/Comm/Ifx_Shell.h"
+
+/** \brief Returns the number of fractional bits giving the best resolution of a ratio below 2^31 */
+static uint8 Ifx_TimeCorrelation_getShift(float32 ratio)
+{
+    uint8 shift = 31;
+
+    while ((shift > 0) && ((ratio * (float32)(1UL << shift)) >= 2147483648.0F))
+    {
+        shift--;
+    }
+
+    return shift;
+}
+
+
+/** \brief Low pass filter of a ratio */
+static uint32 Ifx_TimeCorrelation_filter(uint32 ratio, uint32 measured)
+{
+    return (uint32)((sint64)ratio + (((sint64)measured - (sint64)ratio) >> IFX_CFG_TIMECORRELATION_FILTER_SHIFT));
+}
+
+
+/** \brief Sample the system timer and the TBU channel, keep the sample with the shortest read window
+ *
+ * The system timer value is the middle of the read window of the TBU register. The upper bits are taken from a
+ * full read of the system timer just before the window.
+ */
+static void Ifx_TimeCorrelation_sample(Ifx_TimeCorrelation *timeCorrelation, Ifx_TickTime *stm, uint32 *tbu)
+{
+    uint32 bestWindow = 0xFFFFFFFFU;
+    uint32 i;
+
+    for (i = 0; i < IFX_CFG_TIMECORRELATION_SAMPLES; i++)
+    {
+        boolean      interruptState = IfxCpu_disableInterrupts();
+        Ifx_TickTime base           = now();
+        uint32       start          = nowFast32();
+        uint32       value          = *timeCorrelation->tbuBase;
+        uint32       end            = nowFast32();
+
+        IfxCpu_restoreInterrupts(interruptState);
+
+        if ((end - start) < bestWindow)
+        {
+            bestWindow = end - start;
+            *stm       = base + (uint32)(start - (uint32)base) + (bestWindow / 2);
+            *tbu       = (value >> timeCorrelation->tbuBaseShift) & IFX_TIMECORRELATION_TBU_MASK;
+        }
+    }
+
+    timeCorrelation->window = bestWindow;
+
+    if (bestWindow > timeCorrelation->maxWindow)
+    {
+        timeCorrelation->maxWindow = bestWindow;
+    }
+}
+
+
+boolean Ifx_TimeCorrelation_init(Ifx_TimeCorrelation *timeCorrelation, const Ifx_TimeCorrelation_Config *config)
+{
+    Ifx_GTM *gtm          = config->gtm;
+    float32  tbuFrequency = IfxGtm_Tbu_getClockFrequency(gtm, config->channel);
+    boolean  result       = FALSE;
+
+    timeCorrelation->tbuBaseShift = 0;
+
+    if (config->channel == IfxGtm_Tbu_Ts_0)
+    {
+        timeCorrelation->tbuBase = (volatile uint32 *)&gtm->TBU.CH0_BASE.U;
+
+        if (gtm->TBU.CH0_CTRL.B.LOW_RES != 0)
+        {
+            /* TBU_TS0 is TBU_CH0_BASE[26:3] */
+            timeCorrelation->tbuBaseShift = 3;
+            tbuFrequency                  = tbuFrequency / 8.0F;
+        }
+    }
+    else if (config->channel == IfxGtm_Tbu_Ts_1)
+    {
+        timeCorrelation->tbuBase = (volatile uint32 *)&gtm->TBU.CH1_BASE.U;
+    }
+    else
+    {
+        timeCorrelation->tbuBase = (volatile uint32 *)&gtm->TBU.CH2_BASE.U;
+    }
+
+    if (tbuFrequency > 0.0F)
+    {
+        Ifx_TimeCorrelation_Mapping *mapping = &timeCorrelation->mappings[0];
+
+        timeCorrelation->nominalRatio = (float32)TimeConst_1s / tbuFrequency;
+        timeCorrelation->stmShift     = Ifx_TimeCorrelation_getShift(timeCorrelation->nominalRatio);
+        timeCorrelation->tbuShift     = Ifx_TimeCorrelation_getShift(1.0F / timeCorrelation->nominalRatio);
+        timeCorrelation->maxInterval  = (Ifx_TickTime)(timeCorrelation->nominalRatio * (float32)(IFX_TIMECORRELATION_TBU_MASK / 2));
+
+        mapping->stm                  = 0;
+        mapping->tbu                  = 0;
+        mapping->stmPerTbu            = (uint32)(timeCorrelation->nominalRatio * (float32)(1UL << timeCorrelation->stmShift));
+        mapping->tbuPerStm            = (uint32)((float32)(1UL << timeCorrelation->tbuShift) / timeCorrelation->nominalRatio);
+        timeCorrelation->mappings[1]  = *mapping;
+        timeCorrelation->active       = 0;
+        timeCorrelation->valid        = FALSE;
+        timeCorrelation->updateCount  = 0;
+        timeCorrelation->restartCount = 0;
+
+        Ifx_TimeCorrelation_reset(timeCorrelation);
+        Ifx_TimeCorrelation_update(timeCorrelation);
+
+        result = TRUE;
+    }
+
+    return result;
+}
+
+
+void Ifx_TimeCorrelation_initConfig(Ifx_TimeCorrelation_Config *config, Ifx_GTM *gtm)
+{
+    config->gtm     = gtm;
+    config->channel = IfxGtm_Tbu_Ts_0;
+}
+
+
+void Ifx_TimeCorrelation_reset(Ifx_TimeCorrelation *timeCorrelation)
+{
+    timeCorrelation->window    = 0;
+    timeCorrelation->maxWindow = 0;
+    timeCorrelation->lastError = 0;
+    timeCorrelation->maxError  = 0;
+}
+
+
+boolean Ifx_TimeCorrelation_show(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    Ifx_TimeCorrelation               *timeCorrelation = (Ifx_TimeCorrelation *)data;
+    const Ifx_TimeCorrelation_Mapping *mapping         = &timeCorrelation->mappings[timeCorrelation->active];
+    float32                            ratio           = (float32)mapping->stmPerTbu / (float32)(1UL << timeCorrelation->stmShift);
+    float32                            nsPerTick       = 1.0e9F / (float32)TimeConst_1s;
+
+    IfxStdIf_DPipe_print(io, "STM ticks per TBU tick: %.6f, nominal %.6f (%d ppm)"ENDL, ratio, timeCorrelation->nominalRatio,
+        (sint32)(((ratio / timeCorrelation->nominalRatio) - 1.0F) * 1.0e6F));
+    IfxStdIf_DPipe_print(io, "Updates: %u, restarts: %u"ENDL, timeCorrelation->updateCount, timeCorrelation->restartCount);
+    IfxStdIf_DPipe_print(io, "Read window: last %.0f ns, max %.0f ns"ENDL,
+        (float32)timeCorrelation->window * nsPerTick, (float32)timeCorrelation->maxWindow * nsPerTick);
+    IfxStdIf_DPipe_print(io, "Mapping error: last %.0f ns, max %.0f ns"ENDL,
+        (float32)timeCorrelation->lastError * nsPerTick, (float32)timeCorrelation->maxError * nsPerTick);
+
+    if (Ifx_Shell_matchToken(&args, "reset") != FALSE)
+    {
+        Ifx_TimeCorrelation_reset(timeCorrelation);
+    }
+
+    return TRUE;
+}
+
+
+void Ifx_TimeCorrelation_update(Ifx_TimeCorrelation *timeCorrelation)
+{
+    const Ifx_TimeCorrelation_Mapping *mapping = &timeCorrelation->mappings[timeCorrelation->active];
+    Ifx_TimeCorrelation_Mapping       *next    = &timeCorrelation->mappings[timeCorrelation->active ^ 1];
+    Ifx_TickTime                       stm     = 0;
+    uint32                             tbu     = 0;
+
+    Ifx_TimeCorrelation_sample(timeCorrelation, &stm, &tbu);
+
+    *next     = *mapping;
+    next->stm = stm;
+    next->tbu = tbu;
+
+    if (timeCorrelation->valid != FALSE)
+    {
+        Ifx_TickTime interval = stm - mapping->stm;
+
+        if ((interval > 0) && (interval < timeCorrelation->maxInterval))
+        {
+            sint32 error    = (sint32)(Ifx_TimeCorrelation_tbuToStm(timeCorrelation, tbu) - stm);
+            uint32 absError = (error < 0) ? (uint32)(-error) : (uint32)error;
+            uint32 tbuDelta = (tbu - mapping->tbu) & IFX_TIMECORRELATION_TBU_MASK;
+
+            timeCorrelation->lastError = error;
+
+            if (absError > timeCorrelation->maxError)
+            {
+                timeCorrelation->maxError = absError;
+            }
+
+            if (tbuDelta != 0)
+            {
+                uint32 stmPerTbu = (uint32)(((uint64)interval << timeCorrelation->stmShift) / tbuDelta);
+                uint32 tbuPerStm = (uint32)(((uint64)tbuDelta << timeCorrelation->tbuShift) / (uint64)interval);
+
+                next->stmPerTbu = Ifx_TimeCorrelation_filter(mapping->stmPerTbu, stmPerTbu);
+                next->tbuPerStm = Ifx_TimeCorrelation_filter(mapping->tbuPerStm, tbuPerStm);
+            }
+        }
+        else
+        {
+            /* TBU wrapped more than half a period: new reference point, the ratio is kept */
+            timeCorrelation->restartCount++;
+        }
+    }
+
+    timeCorrelation->valid = TRUE;
+    timeCorrelation->updateCount++;
+
+    /* The new mapping must be visible before it is activated */
+    __dsync();
+    timeCorrelation->active ^= 1;
+}
@@ -0,0 +1,190 @@
+/**
+ * \file Ifx_TimeCorrelation.h
+ * \brief Correlation of the GTM TBU time stamps with the system timer
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup library_srvsw_sysse_time_timecorrelation GTM time stamp correlation
+ * \ingroup library_srvsw_sysse_time
+ *
+ * The GTM captures (TIM, ATOM) hold the 24 bit time stamp of a TBU channel, the software events (see
+ * \ref library_srvsw_sysse_time_trace, now()) hold the system timer value. The two counters run with different
+ * clocks and the TBU wraps within a fraction of a second. This module maintains a linear mapping between them,
+ * so that the hardware and software events can be merged on the system timer time line:
+ * - \ref Ifx_TimeCorrelation_update() samples the system timer and the TBU channel with interrupts disabled. The
+ * sample is repeated IFX_CFG_TIMECORRELATION_SAMPLES times and the one with the shortest read window is kept; the
+ * system timer value is the middle of the window. The new sample becomes the reference point of the mapping, the
+ * ratio of the counter frequencies is measured since the previous sample and low pass filtered.
+ * - \ref Ifx_TimeCorrelation_tbuToStm() and \ref Ifx_TimeCorrelation_stmToTbu() convert with one multiplication
+ * and one shift, without division nor critical section: the mapping is double buffered, the update switches to the
+ * new one in one write.
+ *
+ * The accuracy is given by the read window of the samples (Ifx_TimeCorrelation::window) and by the error of the
+ * mapping, measured at each update as difference between the predicted and the sampled system timer value
+ * (Ifx_TimeCorrelation::lastError). Both are printed by the shell command \ref Ifx_TimeCorrelation_show().
+ *
+ * Restrictions:
+ * - \ref Ifx_TimeCorrelation_update() shall be called from one context at least twice per TBU wrap period
+ * (2^24 TBU ticks), typically from a 10ms task. A longer interval restarts the mapping without ratio measurement.
+ * - \ref Ifx_TimeCorrelation_tbuToStm() converts the time stamps within half a TBU wrap period around the last
+ * update, \ref Ifx_TimeCorrelation_stmToTbu() the system timer values within 2^31 ticks around the last update.
+ *
+ * Usage example:
+ * \code
+ * static Ifx_TimeCorrelation timeCorrelation;
+ *
+ * // initialisation, the GTM and the TBU channel are running
+ * Ifx_TimeCorrelation_Config config;
+ * Ifx_TimeCorrelation_initConfig(&config, &MODULE_GTM);
+ * config.channel = IfxGtm_Tbu_Ts_0;
+ * Ifx_TimeCorrelation_init(&timeCorrelation, &config);
+ *
+ * // 10ms task
+ * Ifx_TimeCorrelation_update(&timeCorrelation);
+ *
+ * // TIM capture interrupt, GPR0 holds TBU_TS0: time of the edge on the system timer time line
+ * Ifx_TickTime edgeTime = Ifx_TimeCorrelation_tbuToStm(&timeCorrelation, timCh->GPR0.B.GPR0);
+ *
+ * // shell command list entry
+ * {"timecorr", "   : Show the GTM time stamp correlation", &timeCorrelation, &Ifx_TimeCorrelation_show},
+ * \endcode
+ *
+ */
+#ifndef IFX_TIMECORRELATION_H
+#define IFX_TIMECORRELATION_H 1
+
+#include "Cpu/Std/IfxCpu.h"
+#include "Gtm/Std/IfxGtm_Tbu.h"
+#include "StdIf/IfxStdIf_DPipe.h"
+#include "SysSe/Bsp/Bsp.h"
+
+//----------------------------------------------------------------------------------------
+#if !defined(IFX_CFG_TIMECORRELATION_SAMPLES)
+#define IFX_CFG_TIMECORRELATION_SAMPLES       (4)   /**<\brief Number of samples per update, the one with the shortest read window is kept */
+#endif
+
+#if !defined(IFX_CFG_TIMECORRELATION_FILTER_SHIFT)
+#define IFX_CFG_TIMECORRELATION_FILTER_SHIFT  (3)   /**<\brief Low pass filter of the frequency ratio: new ratio weighted 1/2^shift */
+#endif
+
+#define IFX_TIMECORRELATION_TBU_MASK          (0x00FFFFFFU) /**<\brief The TBU time stamps have 24 bits */
+
+/** \addtogroup library_srvsw_sysse_time_timecorrelation
+ * \{ */
+
+/** \brief Linear mapping between the system timer and the TBU time stamp */
+typedef struct
+{
+    Ifx_TickTime stm;          /**<\brief system timer value of the reference point */
+    uint32       tbu;          /**<\brief TBU time stamp of the reference point */
+    uint32       stmPerTbu;    /**<\brief system timer ticks per TBU tick, fixed point with Ifx_TimeCorrelation::stmShift fractional bits */
+    uint32       tbuPerStm;    /**<\brief TBU ticks per system timer tick, fixed point with Ifx_TimeCorrelation::tbuShift fractional bits */
+} Ifx_TimeCorrelation_Mapping;
+
+/** \brief Configuration */
+typedef struct
+{
+    Ifx_GTM      *gtm;         /**<\brief GTM module */
+    IfxGtm_Tbu_Ts channel;     /**<\brief TBU channel of the correlated time stamps */
+} Ifx_TimeCorrelation_Config;
+
+/** \brief Time correlation object */
+typedef struct
+{
+    volatile uint32            *tbuBase;          /**<\brief TBU channel base register */
+    uint8                       tbuBaseShift;     /**<\brief shift from the base register to the time stamp, 3 with TBU_CH0_CTRL.LOW_RES */
+    uint8                       stmShift;         /**<\brief fractional bits of Ifx_TimeCorrelation_Mapping::stmPerTbu */
+    uint8                       tbuShift;         /**<\brief fractional bits of Ifx_TimeCorrelation_Mapping::tbuPerStm */
+    float32                     nominalRatio;     /**<\brief system timer ticks per TBU tick from the clock configuration */
+    Ifx_TickTime                maxInterval;      /**<\brief maximal interval between two updates for the ratio measurement, half a TBU wrap period */
+    Ifx_TimeCorrelation_Mapping mappings[2];      /**<\brief mappings, the active one and the one written by the update */
+    volatile uint8              active;           /**<\brief index of the active mapping */
+    boolean                     valid;            /**<\brief TRUE once the reference point is set by an update */
+    uint32                      updateCount;      /**<\brief number of updates */
+    uint32                      restartCount;     /**<\brief number of updates too late for the ratio measurement */
+    uint32                      window;           /**<\brief read window of the last sample in system timer ticks */
+    uint32                      maxWindow;        /**<\brief maximal read window in system timer ticks */
+    sint32                      lastError;        /**<\brief predicted minus sampled system timer value at the last update */
+    uint32                      maxError;         /**<\brief maximal absolute error */
+} Ifx_TimeCorrelation;
+
+/** \brief Convert a TBU time stamp to a system timer value
+ * \param timeCorrelation Pointer to the time correlation object
+ * \param tbu TBU time stamp (24 bit), within half a TBU wrap period around the last update
+ * \return Returns the system timer value, see now()
+ */
+IFX_INLINE Ifx_TickTime Ifx_TimeCorrelation_tbuToStm(const Ifx_TimeCorrelation *timeCorrelation, uint32 tbu)
+{
+    const Ifx_TimeCorrelation_Mapping *mapping = &timeCorrelation->mappings[timeCorrelation->active];
+    sint32                             delta   = ((sint32)((tbu - mapping->tbu) << 8)) >> 8; /* 24 bit signed difference */
+
+    return mapping->stm + (((sint64)delta * mapping->stmPerTbu) >> timeCorrelation->stmShift);
+}
+
+
+/** \brief Convert a system timer value to a TBU time stamp
+ * \param timeCorrelation Pointer to the time correlation object
+ * \param stm system timer value, within 2^31 ticks around the last update
+ * \return Returns the TBU time stamp (24 bit)
+ */
+IFX_INLINE uint32 Ifx_TimeCorrelation_stmToTbu(const Ifx_TimeCorrelation *timeCorrelation, Ifx_TickTime stm)
+{
+    const Ifx_TimeCorrelation_Mapping *mapping = &timeCorrelation->mappings[timeCorrelation->active];
+    sint32                             delta   = (sint32)(stm - mapping->stm);
+
+    return (mapping->tbu + (uint32)(((sint64)delta * mapping->tbuPerStm) >> timeCorrelation->tbuShift)) & IFX_TIMECORRELATION_TBU_MASK;
+}
+
+
+/** \brief Initialize the time correlation object and do the first update
+ * \param timeCorrelation Pointer to the time correlation object
+ * \param config Pointer to the configuration
+ * \return Returns FALSE if the TBU channel clock is not running
+ */
+IFX_EXTERN boolean Ifx_TimeCorrelation_init(Ifx_TimeCorrelation *timeCorrelation, const Ifx_TimeCorrelation_Config *config);
+
+/** \brief Initialize the configuration: TBU channel 0
+ * \param config Pointer to the configuration
+ * \param gtm GTM module
+ */
+IFX_EXTERN void Ifx_TimeCorrelation_initConfig(Ifx_TimeCorrelation_Config *config, Ifx_GTM *gtm);
+
+/** \brief Clear the window and error statistics, the mapping is kept
+ * \param timeCorrelation Pointer to the time correlation object
+ */
+IFX_EXTERN void Ifx_TimeCorrelation_reset(Ifx_TimeCorrelation *timeCorrelation);
+
+/** \brief Shell command: print the frequency ratio, the read window and the mapping error. With the argument
+ * "reset", the statistics are cleared afterwards
+ * \param args command arguments
+ * \param data Pointer to the time correlation object
+ * \param io Pointer to the IfxStdIf_DPipe object
+ * \return TRUE
+ */
+IFX_EXTERN boolean Ifx_TimeCorrelation_show(pchar args, void *data, IfxStdIf_DPipe *io);
+
+/** \brief Sample the system timer and the TBU channel, and update the mapping
+ *
+ * The interrupts are disabled during each sample, a few bus accesses.
+ * \param timeCorrelation Pointer to the time correlation object
+ */
+IFX_EXTERN void Ifx_TimeCorrelation_update(Ifx_TimeCorrelation *timeCorrelation);
+
+/** \} */
+//----------------------------------------------------------------------------------------
+#endif
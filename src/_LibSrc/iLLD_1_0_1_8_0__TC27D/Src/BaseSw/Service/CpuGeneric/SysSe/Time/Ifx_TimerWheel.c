@@ -0,0 +1,332 @@
+/**
+ * \file Ifx_TimerWheel.c
+ * \brief Software timers multiplexed on one STM comparator
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_TimerWheel.h"
+#include "Cpu/Std/IfxCpu.h"
+#include <string.h>
+
+#define IFX_TIMERWHEEL_SLOT_MASK (IFX_TIMERWHEEL_SLOTS - 1)
+
+/** Insert the timer in the slot of its expiry wheel tick
+ */
+static void Ifx_TimerWheel_add(Ifx_TimerWheel *wheel, Ifx_TimerWheel_Timer *timer)
+{
+    uint32                 delta = timer->expiry - wheel->current;
+    uint32                 level;
+    uint32                 slot;
+    Ifx_TimerWheel_Timer **list;
+
+    if (delta < IFX_TIMERWHEEL_SLOTS)
+    {
+        level = 0;
+        slot  = timer->expiry & IFX_TIMERWHEEL_SLOT_MASK;
+    }
+    else if (delta < (IFX_TIMERWHEEL_SLOTS * IFX_TIMERWHEEL_SLOTS))
+    {
+        level = 1;
+        slot  = (timer->expiry >> IFX_TIMERWHEEL_SLOT_BITS) & IFX_TIMERWHEEL_SLOT_MASK;
+    }
+    else
+    {
+        level = 2;
+        slot  = (timer->expiry >> (2 * IFX_TIMERWHEEL_SLOT_BITS)) & IFX_TIMERWHEEL_SLOT_MASK;
+    }
+
+    list        = &wheel->slots[level][slot];
+    timer->list = list;
+    timer->prev = NULL_PTR;
+    timer->next = *list;
+
+    if (*list != NULL_PTR)
+    {
+        (*list)->prev = timer;
+    }
+
+    *list = timer;
+
+    if (level == 0)
+    {
+        wheel->occupied[slot / 32] |= 1u << (slot % 32);
+    }
+    else
+    {
+        wheel->upperCount++;
+    }
+}
+
+
+/** Remove the timer from its list
+ */
+static void Ifx_TimerWheel_remove(Ifx_TimerWheel *wheel, Ifx_TimerWheel_Timer *timer)
+{
+    Ifx_TimerWheel_Timer **list = timer->list;
+
+    if (timer->prev != NULL_PTR)
+    {
+        timer->prev->next = timer->next;
+    }
+    else
+    {
+        *list = timer->next;
+    }
+
+    if (timer->next != NULL_PTR)
+    {
+        timer->next->prev = timer->prev;
+    }
+
+    timer->list = NULL_PTR;
+
+    if (list != &wheel->expired)
+    {
+        uint32 index = (uint32)(list - &wheel->slots[0][0]);
+
+        if (index >= IFX_TIMERWHEEL_SLOTS)
+        {
+            wheel->upperCount--;
+        }
+        else if (*list == NULL_PTR)
+        {
+            wheel->occupied[index / 32] &= ~(1u << (index % 32));
+        }
+    }
+}
+
+
+/** Move the timers of an upper level slot to the lower levels
+ */
+static void Ifx_TimerWheel_cascade(Ifx_TimerWheel *wheel, uint32 level, uint32 slot)
+{
+    Ifx_TimerWheel_Timer **list = &wheel->slots[level][slot];
+
+    while (*list != NULL_PTR)
+    {
+        Ifx_TimerWheel_Timer *timer = *list;
+
+        Ifx_TimerWheel_remove(wheel, timer);
+        Ifx_TimerWheel_add(wheel, timer);
+    }
+}
+
+
+/** Returns the next wheel tick to process: the next non empty slot of the first level, or its next wrap
+ */
+static uint32 Ifx_TimerWheel_getNextTick(const Ifx_TimerWheel *wheel)
+{
+    uint32 index = wheel->current & IFX_TIMERWHEEL_SLOT_MASK;
+    uint32 word;
+
+    if ((index == 0) && (wheel->upperCount != 0))
+    {
+        return wheel->current;
+    }
+
+    for (word = index / 32; word < (IFX_TIMERWHEEL_SLOTS / 32); word++)
+    {
+        uint32 bits = wheel->occupied[word];
+
+        if (word == (index / 32))
+        {
+            bits &= ~((1u << (index % 32)) - 1);
+        }
+
+        if (bits != 0)
+        {
+            uint32 slot = (word * 32) + (31 - __clz(bits & (~bits + 1)));
+            return wheel->current + (slot - index);
+        }
+    }
+
+    return wheel->current + (IFX_TIMERWHEEL_SLOTS - index);
+}
+
+
+/** Program the comparator to the next wheel tick to process. Raise the interrupt if this tick is already passed
+ */
+static void Ifx_TimerWheel_program(Ifx_TimerWheel *wheel)
+{
+    uint32 compare;
+
+    wheel->nextTick = Ifx_TimerWheel_getNextTick(wheel);
+    compare         = wheel->currentTime + ((wheel->nextTick - wheel->current) * wheel->period);
+    IfxStm_updateCompare(wheel->stm, wheel->comparator, compare);
+
+    if ((sint32)(IfxStm_getLower(wheel->stm) - compare) >= 0)
+    {
+        IfxSrc_setRequest(IfxStm_getSrcPointer(wheel->stm, wheel->comparator));
+    }
+}
+
+
+/** Process the current wheel tick: cascade the upper levels on wrap, then deliver the expired timers
+ */
+static void Ifx_TimerWheel_runTick(Ifx_TimerWheel *wheel)
+{
+    uint32                tick  = wheel->current;
+    uint32                index = tick & IFX_TIMERWHEEL_SLOT_MASK;
+    uint32                count = 0;
+    Ifx_TimerWheel_Timer *timer;
+
+    if (index == 0)
+    {
+        uint32 index1 = (tick >> IFX_TIMERWHEEL_SLOT_BITS) & IFX_TIMERWHEEL_SLOT_MASK;
+
+        if (index1 == 0)
+        {
+            Ifx_TimerWheel_cascade(wheel, 2, (tick >> (2 * IFX_TIMERWHEEL_SLOT_BITS)) & IFX_TIMERWHEEL_SLOT_MASK);
+        }
+
+        Ifx_TimerWheel_cascade(wheel, 1, index1);
+    }
+
+    /* the batch is moved to the expired list, so that the callbacks can stop any timer of the batch */
+    wheel->expired                = wheel->slots[0][index];
+    wheel->slots[0][index]        = NULL_PTR;
+    wheel->occupied[index / 32]  &= ~(1u << (index % 32));
+
+    for (timer = wheel->expired; timer != NULL_PTR; timer = timer->next)
+    {
+        timer->list = &wheel->expired;
+    }
+
+    wheel->current      = tick + 1;
+    wheel->currentTime += wheel->period;
+
+    while (wheel->expired != NULL_PTR)
+    {
+        timer = wheel->expired;
+        Ifx_TimerWheel_remove(wheel, timer);
+
+        if (timer->period != 0)
+        {
+            timer->expiry += timer->period;
+            Ifx_TimerWheel_add(wheel, timer);
+        }
+
+        timer->callback(timer->data);
+        count++;
+    }
+
+    if (count != 0)
+    {
+        wheel->batches++;
+        wheel->callbacks += count;
+
+        if (count > wheel->maxBatch)
+        {
+            wheel->maxBatch = count;
+        }
+    }
+}
+
+
+void Ifx_TimerWheel_init(Ifx_TimerWheel *wheel, Ifx_STM *stm, IfxStm_Comparator comparator, uint32 period)
+{
+    memset(wheel, 0, sizeof(*wheel));
+    wheel->stm         = stm;
+    wheel->comparator  = comparator;
+    wheel->period      = (period != 0) ? period : 1;
+    wheel->currentTime = IfxStm_getLower(stm) + wheel->period;
+
+    Ifx_TimerWheel_program(wheel);
+}
+
+
+void Ifx_TimerWheel_initTimer(Ifx_TimerWheel_Timer *timer, Ifx_TimerWheel_Callback callback, void *data)
+{
+    timer->next     = NULL_PTR;
+    timer->prev     = NULL_PTR;
+    timer->list     = NULL_PTR;
+    timer->expiry   = 0;
+    timer->period   = 0;
+    timer->callback = callback;
+    timer->data     = data;
+}
+
+
+void Ifx_TimerWheel_process(Ifx_TimerWheel *wheel)
+{
+    IfxStm_clearCompareFlag(wheel->stm, wheel->comparator);
+
+    for ( ; ; )
+    {
+        uint32 next = Ifx_TimerWheel_getNextTick(wheel);
+        uint32 due  = wheel->currentTime + ((next - wheel->current) * wheel->period);
+
+        if ((sint32)(IfxStm_getLower(wheel->stm) - due) < 0)
+        {
+            break;
+        }
+
+        wheel->current     = next;
+        wheel->currentTime = due;
+        Ifx_TimerWheel_runTick(wheel);
+    }
+
+    Ifx_TimerWheel_program(wheel);
+}
+
+
+void Ifx_TimerWheel_start(Ifx_TimerWheel *wheel, Ifx_TimerWheel_Timer *timer, uint32 ticks, uint32 period)
+{
+    boolean interruptState = IfxCpu_disableInterrupts();
+    sint32  elapsed;
+    uint32  now;
+
+    if (timer->list != NULL_PTR)
+    {
+        Ifx_TimerWheel_remove(wheel, timer);
+    }
+
+    /* the wheel tick in progress, the wheel itself is only advanced up to the last processed tick */
+    elapsed = (sint32)(IfxStm_getLower(wheel->stm) - wheel->currentTime);
+    now     = (elapsed < 0) ? (wheel->current - 1) : (wheel->current + ((uint32)elapsed / wheel->period));
+
+    ticks   = (ticks != 0) ? ticks : 1;
+    ticks   = (ticks <= IFX_TIMERWHEEL_MAX_TICKS) ? ticks : IFX_TIMERWHEEL_MAX_TICKS;
+    period  = (period <= IFX_TIMERWHEEL_MAX_TICKS) ? period : IFX_TIMERWHEEL_MAX_TICKS;
+
+    timer->expiry = now + ticks;
+    timer->period = period;
+    Ifx_TimerWheel_add(wheel, timer);
+
+    if ((sint32)(timer->expiry - wheel->nextTick) < 0)
+    {
+        Ifx_TimerWheel_program(wheel);
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+
+void Ifx_TimerWheel_stop(Ifx_TimerWheel *wheel, Ifx_TimerWheel_Timer *timer)
+{
+    boolean interruptState = IfxCpu_disableInterrupts();
+
+    if (timer->list != NULL_PTR)
+    {
+        Ifx_TimerWheel_remove(wheel, timer);
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+}
@@ -0,0 +1,97 @@
+/**
+ * \file Ifx_Trace.c
+ * \brief Time stamped event trace
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+#include "Ifx_Trace.h"
+#include "_Utilities/Ifx_Assert.h"
+
+Ifx_Trace_HostAccess Ifx_g_TraceHostAccess = {
+    .signature  = IFX_TRACE_SIGNATURE,
+    .version    = IFX_TRACE_VERSION,
+    .recordSize = sizeof(Ifx_Trace_Record),
+};
+
+void Ifx_Trace_init(Ifx_Trace_Buffer *buffer, Ifx_Trace_Record *records, uint32 size)
+{
+    IfxCpu_ResourceCpu cpu = IfxCpu_getCoreIndex();
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (size != 0) && ((size & (size - 1)) == 0));
+
+    buffer->records    = (Ifx_Trace_Record *)IFXCPU_GLB_ADDR_DSPR(cpu, records);
+    buffer->mask       = size - 1;
+    buffer->writeCount = 0;
+    buffer->cpu        = (uint8)cpu;
+
+    Ifx_g_TraceHostAccess.buffers[cpu] = (Ifx_Trace_Buffer *)IFXCPU_GLB_ADDR_DSPR(cpu, buffer);
+}
+
+
+/** \brief Print the records of one ring, oldest first
+ *
+ * The ring is not locked: the records overwritten while printing are skipped.
+ */
+static void Ifx_Trace_showBuffer(Ifx_Trace_Buffer *buffer, IfxStdIf_DPipe *io)
+{
+    uint32 size  = buffer->mask + 1;
+    uint32 end   = buffer->writeCount;
+    uint32 index = (end > size) ? (end - size) : 0;
+
+    IfxStdIf_DPipe_print(io, "CPU%d, %u records written"ENDL, buffer->cpu, end);
+
+    for ( ; index != end; index++)
+    {
+        Ifx_Trace_Record record = buffer->records[index & buffer->mask];
+
+        if ((buffer->writeCount - index) <= size)
+        {
+            IfxStdIf_DPipe_print(io, "%08X%08X %u %5u 0x%08X"ENDL,
+                (uint32)(record.timestamp >> 32), (uint32)record.timestamp, record.cpu, record.event, record.payload);
+        }
+    }
+}
+
+
+boolean Ifx_Trace_showRecords(pchar args, void *data, IfxStdIf_DPipe *io)
+{
+    uint32 i;
+
+    (void)args;
+
+    IfxStdIf_DPipe_print(io, "%-16s %s %5s %s"ENDL, "timestamp", "CPU", "event", "payload");
+
+    if (data != NULL_PTR)
+    {
+        Ifx_Trace_showBuffer((Ifx_Trace_Buffer *)data, io);
+    }
+    else
+    {
+        for (i = 0; i < IFXCPU_NUM_MODULES; i++)
+        {
+            if (Ifx_g_TraceHostAccess.buffers[i] != NULL_PTR)
+            {
+                Ifx_Trace_showBuffer(Ifx_g_TraceHostAccess.buffers[i], io);
+            }
+        }
+    }
+
+    return TRUE;
+}
@@ -26,9 +26,40 @@
 /*----------------------------------Includes----------------------------------*/
 /******************************************************************************/
 
+#define IFX_ASSERT_MODULE ASCLIN
 #include "IfxAsclin_Asc.h"
 #include "string.h"
 
+/******************************************************************************/
+/*-----------------------Private Function Prototypes--------------------------*/
+/******************************************************************************/
+
+/** \brief Copies the bytes stored by the DMA since the last call from the DMA buffer into the rx FIFO
+ * \param asclin module handle
+ * \return None
+ */
+static void IfxAsclin_Asc_copyDmaRxData(IfxAsclin_Asc *asclin);
+
+/** \brief Fills the DMA transmit channel configuration common to all transfers
+ * \param asclin module handle
+ * \param dmaCfg DMA channel configuration
+ * \return None
+ */
+static void IfxAsclin_Asc_initDmaTxConfig(IfxAsclin_Asc *asclin, IfxDma_Dma_ChannelConfig *dmaCfg);
+
+/** \brief Loads a transaction set into the DMA transmit channel and starts it
+ * \param asclin module handle
+ * \param set transaction set
+ * \return None
+ */
+static void IfxAsclin_Asc_startDmaTx(IfxAsclin_Asc *asclin, const Ifx_DMA_CH *set);
+
+/** \brief Starts the DMA transfer of the next contiguous block of the tx FIFO, or ends the transmission if the FIFO is empty
+ * \param asclin module handle
+ * \return None
+ */
+static void IfxAsclin_Asc_startDmaTxFifo(IfxAsclin_Asc *asclin);
+
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
@@ -55,6 +86,8 @@ boolean IfxAsclin_Asc_blockingWrite(IfxAsclin_Asc *asclin, uint8 data)
 
 boolean IfxAsclin_Asc_canReadCount(IfxAsclin_Asc *asclin, Ifx_SizeT count, Ifx_TickTime timeout)
 {
+    IfxAsclin_Asc_pollFrameReceive(asclin);
+
     return Ifx_Fifo_canReadCount(asclin->rx, count, timeout);
 }
 
@@ -68,13 +101,95 @@ boolean IfxAsclin_Asc_canWriteCount(IfxAsclin_Asc *asclin, Ifx_SizeT count, Ifx_
 void IfxAsclin_Asc_clearRx(IfxAsclin_Asc *asclin)
 {
     IfxAsclin_flushRxFifo(asclin->asclin);
+
+    if (asclin->dma.useRxDma != FALSE)
+    {
+        /* Drop the bytes waiting in the DMA buffer */
+        boolean interruptState = IfxCpu_disableInterrupts();
+        uint32  address        = IfxDma_getChannelDestinationAddress(&MODULE_DMA, asclin->dma.rxDmaChannelId);
+        asclin->dma.rxIndex = (uint16)((address - (uint32)asclin->dma.rxBuffer) & (asclin->dma.rxBufferSize - 1));
+        IfxCpu_restoreInterrupts(interruptState);
+    }
+
+    /* Drop the frame being received */
+    asclin->rxFrame.count = 0;
+    asclin->rxFrame.open  = FALSE;
+
     Ifx_Fifo_clear(asclin->rx);
 }
 
 
+static void IfxAsclin_Asc_copyDmaRxData(IfxAsclin_Asc *asclin)
+{
+    IfxAsclin_Asc_Dma *dma     = &asclin->dma;
+    uint16             mask    = dma->rxBufferSize - 1;
+    uint32             address = IfxDma_getChannelDestinationAddress(&MODULE_DMA, dma->rxDmaChannelId);
+    uint16             index   = (uint16)((address - (uint32)dma->rxBuffer) & mask);
+    uint16             count   = (uint16)((index - dma->rxIndex) & mask);
+
+    /* The DMA buffer is circular: copy in at most 2 blocks */
+    while (count != 0)
+    {
+        uint16 blockSize = __min(count, dma->rxBufferSize - dma->rxIndex);
+
+        if (Ifx_Fifo_write(asclin->rx, &dma->rxBuffer[dma->rxIndex], (Ifx_SizeT)blockSize, TIME_NULL) != 0)
+        {
+            /* Receive buffer is full, data is discard */
+            asclin->rxSwFifoOverflow = TRUE;
+        }
+
+        dma->rxIndex = (uint16)((dma->rxIndex + blockSize) & mask);
+        count        = (uint16)(count - blockSize);
+    }
+}
+
+
+static void IfxAsclin_Asc_writeRxFrame(IfxAsclin_Asc *asclin)
+{
+    IfxAsclin_Asc_RxFrame            *frame = &asclin->rxFrame;
+    Ifx_DataBufferMode_TimeStampFrame header;
+
+    header.timestamp = frame->timestamp;
+    header.count     = frame->count;
+
+    if (frame->count != 0)
+    {
+        /* The record is written only as a whole, the reader relies on the headers */
+        if (Ifx_Fifo_writeCount(asclin->rx) >= (Ifx_SizeT)(sizeof(header) + frame->count))
+        {
+            Ifx_Fifo_write(asclin->rx, &header, sizeof(header), TIME_NULL);
+            Ifx_Fifo_write(asclin->rx, frame->data, (Ifx_SizeT)frame->count, TIME_NULL);
+        }
+        else
+        {
+            /* Receive buffer is full, data is discard */
+            asclin->rxSwFifoOverflow = TRUE;
+        }
+    }
+
+    frame->count = 0;
+}
+
+
 void IfxAsclin_Asc_clearTx(IfxAsclin_Asc *asclin)
 {
-    Ifx_Fifo_clear(asclin->tx);
+    if (asclin->dma.useTxDma != FALSE)
+    {
+        /* Abort the ongoing DMA transfer, the FIFO data must not be released afterwards */
+        boolean interruptState = IfxCpu_disableInterrupts();
+        IfxDma_disableChannelTransaction(&MODULE_DMA, asclin->dma.txDmaChannelId);
+        IfxDma_Dma_clearChannelInterrupt(&asclin->dma.txDmaChannel);
+        asclin->dma.txFifoCount  = 0;
+        asclin->dma.txChainCount = 0;
+        asclin->txInProgress     = FALSE;
+        Ifx_Fifo_clear(asclin->tx);
+        IfxCpu_restoreInterrupts(interruptState);
+    }
+    else
+    {
+        Ifx_Fifo_clear(asclin->tx);
+    }
+
     IfxAsclin_flushTxFifo(asclin->asclin);
 }
 
@@ -102,7 +217,7 @@ boolean IfxAsclin_Asc_flushTx(IfxAsclin_Asc *asclin, Ifx_TickTime timeout)
         /* Flush the hardware FIFO (wait until all bytes have been transmitted) */
         do
         {
-            result = IfxAsclin_getTxFifoFillLevel(asclin->asclin) == 0;
+            result = (IfxAsclin_getTxFifoFillLevel(asclin->asclin) == 0) && (asclin->txInProgress == FALSE);
         } while (!result && !isDeadLine(deadline));
     }
 
@@ -112,6 +227,13 @@ boolean IfxAsclin_Asc_flushTx(IfxAsclin_Asc *asclin, Ifx_TickTime timeout)
 
 sint32 IfxAsclin_Asc_getReadCount(IfxAsclin_Asc *asclin)
 {
+    if (asclin->dma.useRxDma != FALSE)
+    {
+        IfxAsclin_Asc_pollDmaReceive(asclin);
+    }
+
+    IfxAsclin_Asc_pollFrameReceive(asclin);
+
     return Ifx_Fifo_readCount(asclin->rx);
 }
 
@@ -258,6 +380,7 @@ IfxAsclin_Status IfxAsclin_Asc_initModule(IfxAsclin_Asc *asclin, const IfxAsclin
     switch (asclin->dataBufferMode)
     {
     case Ifx_DataBufferMode_normal:
+    case Ifx_DataBufferMode_timeStampFrame:
         elementSize = 1;
         break;
     case Ifx_DataBufferMode_timeStampSingle:
@@ -269,6 +392,16 @@ IfxAsclin_Status IfxAsclin_Asc_initModule(IfxAsclin_Asc *asclin, const IfxAsclin
         break;
     }
 
+    /* Frame time stamps */
+    asclin->rxFrame.idleTime  = (Ifx_TickTime)((float32)TimeConst_1s * config->rxFrameIdleBits / config->baudrate.baudrate);
+    asclin->rxFrame.timestamp = 0;
+    asclin->rxFrame.lastTime  = 0;
+    asclin->rxFrame.count     = 0;
+    asclin->rxFrame.open      = FALSE;
+
+    /* The overwrite mode would drop the beginning of a record */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->dataBufferMode != Ifx_DataBufferMode_timeStampFrame) || (config->rxOverwrite == FALSE));
+
     /* SW Fifos */
     if (config->txBuffer != NULL_PTR)
     {
@@ -281,15 +414,115 @@ IfxAsclin_Status IfxAsclin_Asc_initModule(IfxAsclin_Asc *asclin, const IfxAsclin
 
     if (config->rxBuffer != NULL_PTR)
     {
-        asclin->rx = Ifx_Fifo_init(config->rxBuffer, config->rxBufferSize, elementSize);
+        asclin->rx = (config->rxOverwrite != FALSE)
+                     ? Ifx_Fifo_initOverwrite(config->rxBuffer, config->rxBufferSize, elementSize)
+                     : Ifx_Fifo_init(config->rxBuffer, config->rxBufferSize, elementSize);
     }
     else
     {
-        asclin->rx = Ifx_Fifo_create(config->rxBufferSize, elementSize);
+        asclin->rx = (config->rxOverwrite != FALSE)
+                     ? Ifx_Fifo_createOverwrite(config->rxBufferSize, elementSize)
+                     : Ifx_Fifo_create(config->rxBufferSize, elementSize);
+    }
+
+    /* DMA reception */
+    asclin->dma.useRxDma = config->dma.useRxDma;
+
+    if (config->dma.useRxDma != FALSE)
+    {
+        /* The DMA moves plain bytes, one byte per ASCLIN receive request */
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, config->dataBufferMode == Ifx_DataBufferMode_normal);
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, config->fifo.rxFifoInterruptLevel == IfxAsclin_RxFifoInterruptLevel_1);
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, config->fifo.outWidth == IfxAsclin_RxFifoOutletWidth_1);
+        /* The CPU would not see the data written by the DMA */
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, IfxCpu_isAddressCachable(config->dma.rxBuffer) == FALSE);
+
+        asclin->dma.rxDmaChannelId = config->dma.rxDmaChannelId;
+        asclin->dma.rxBuffer       = (uint8 *)IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), config->dma.rxBuffer);
+        asclin->dma.rxBufferSize   = (uint16)(1U << config->dma.rxBufferSize);
+        asclin->dma.rxIndex        = 0;
+
+        /* The destination circular buffer wraps on an address aligned on its size */
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((uint32)asclin->dma.rxBuffer & (asclin->dma.rxBufferSize - 1)) == 0);
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->dma.rxTransferCount > 0) && (config->dma.rxTransferCount <= (asclin->dma.rxBufferSize / 2)));
+
+        IfxDma_Dma               dma;
+        IfxDma_Dma_createModuleHandle(&dma, &MODULE_DMA);
+
+        IfxDma_Dma_ChannelConfig dmaCfg;
+        IfxDma_Dma_initChannelConfig(&dmaCfg, &dma);
+
+        dmaCfg.channelId               = asclin->dma.rxDmaChannelId;
+        dmaCfg.hardwareRequestEnabled  = TRUE; // triggered by the asclin receive service request
+        dmaCfg.channelInterruptEnabled = TRUE; // interrupt at the end of each transaction, i.e. every rxTransferCount bytes
+        dmaCfg.channelInterruptControl = IfxDma_ChannelInterruptControl_thresholdLimitMatch;
+        dmaCfg.interruptRaiseThreshold = 0;
+
+        // source address is fixed; use circular mode to stay at this address for each move
+        dmaCfg.sourceAddress               = (uint32)&asclinSFR->RXDATA.U;
+        dmaCfg.sourceAddressCircularRange  = IfxDma_ChannelIncrementCircular_none;
+        dmaCfg.sourceCircularBufferEnabled = TRUE;
+
+        // destination wraps in the DMA buffer
+        dmaCfg.destinationAddress               = (uint32)asclin->dma.rxBuffer;
+        dmaCfg.destinationAddressCircularRange  = config->dma.rxBufferSize;
+        dmaCfg.destinationCircularBufferEnabled = TRUE;
+        dmaCfg.transferCount                    = config->dma.rxTransferCount;
+
+        // the channel stays enabled after each transaction, the transfer count is reloaded
+        dmaCfg.requestMode   = IfxDma_ChannelRequestMode_oneTransferPerRequest;
+        dmaCfg.operationMode = IfxDma_ChannelOperationMode_continuous;
+        dmaCfg.moveSize      = IfxDma_ChannelMoveSize_8bit;
+        dmaCfg.blockMode     = IfxDma_ChannelMove_1;
+
+        // initialize interrupt for rx
+        dmaCfg.channelInterruptTypeOfService = config->interrupt.typeOfService;
+        dmaCfg.channelInterruptPriority      = config->interrupt.rxPriority;
+
+        IfxDma_Dma_initChannel(&asclin->dma.rxDmaChannel, &dmaCfg);
+
+        volatile Ifx_SRC_SRCR *src;
+        src = IfxAsclin_getSrcPointerRx(asclinSFR);
+        IfxSrc_init(src, IfxSrc_Tos_dma, (Ifx_Priority)asclin->dma.rxDmaChannelId);
+        IfxAsclin_enableRxFifoFillLevelFlag(asclinSFR, TRUE);
+        IfxSrc_enable(src);
+    }
+
+    /* DMA transmission */
+    asclin->dma.useTxDma     = config->dma.useTxDma;
+    asclin->dma.txFifoCount  = 0;
+    asclin->dma.txChainCount = 0;
+
+    if (config->dma.useTxDma != FALSE)
+    {
+        /* The DMA moves plain bytes, one byte per ASCLIN transmit request. A request is raised as long as one byte is free */
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, config->dataBufferMode == Ifx_DataBufferMode_normal);
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, config->fifo.txFifoInterruptLevel == IfxAsclin_TxFifoInterruptLevel_15);
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, config->fifo.inWidth == IfxAsclin_TxFifoInletWidth_1);
+        /* The DMA would not see the data written by the CPU */
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, IfxCpu_isAddressCachable(asclin->tx->buffer) == FALSE);
+
+        asclin->dma.txDmaChannelId = config->dma.txDmaChannelId;
+
+        IfxDma_Dma_ChannelConfig dmaCfg;
+        IfxAsclin_Asc_initDmaTxConfig(asclin, &dmaCfg);
+
+        // source address and transfer count will be configured during runtime
+        dmaCfg.hardwareRequestEnabled        = FALSE;
+        dmaCfg.channelInterruptTypeOfService = config->interrupt.typeOfService;
+        dmaCfg.channelInterruptPriority      = config->interrupt.txPriority;
+
+        IfxDma_Dma_initChannel(&asclin->dma.txDmaChannel, &dmaCfg);
+
+        volatile Ifx_SRC_SRCR *src;
+        src = IfxAsclin_getSrcPointerTx(asclinSFR);
+        IfxSrc_init(src, IfxSrc_Tos_dma, (Ifx_Priority)asclin->dma.txDmaChannelId);
+        IfxAsclin_enableTxFifoFillLevelFlag(asclinSFR, TRUE);
+        IfxSrc_enable(src);
     }
 
     /* initialising the interrupts */
-    if (config->interrupt.rxPriority > 0)
+    if ((config->interrupt.rxPriority > 0) && (config->dma.useRxDma == FALSE))
     {
         volatile Ifx_SRC_SRCR *src;
         src = IfxAsclin_getSrcPointerRx(asclinSFR);
@@ -298,7 +531,7 @@ IfxAsclin_Status IfxAsclin_Asc_initModule(IfxAsclin_Asc *asclin, const IfxAsclin
         IfxSrc_enable(src);
     }
 
-    if (config->interrupt.txPriority > 0)
+    if ((config->interrupt.txPriority > 0) && (config->dma.useTxDma == FALSE))
     {
         volatile Ifx_SRC_SRCR *src;
         src = IfxAsclin_getSrcPointerTx(asclinSFR);
@@ -375,14 +608,136 @@ void IfxAsclin_Asc_initModuleConfig(IfxAsclin_Asc_Config *config, Ifx_ASCLIN *as
 
     config->txBufferSize   = 0;                                                /* Rx Fifo buffer size*/
     config->rxBufferSize   = 0;                                                /* Rx Fifo buffer size*/
+    config->rxOverwrite    = FALSE;                                            /* Rx Fifo keeps the oldest data when full*/
+
+    config->dataBufferMode  = Ifx_DataBufferMode_normal;
+    config->rxFrameIdleBits = 20;                                              /* 2 characters of 10 bits */
+
+    /* DMA disabled */
+    config->dma.useRxDma        = FALSE;
+    config->dma.rxDmaChannelId  = IfxDma_ChannelId_none;
+    config->dma.rxBuffer        = NULL_PTR;
+    config->dma.rxBufferSize    = IfxDma_ChannelIncrementCircular_none;
+    config->dma.rxTransferCount = 0;
+    config->dma.useTxDma        = FALSE;
+    config->dma.txDmaChannelId  = IfxDma_ChannelId_none;
+}
+
 
-    config->dataBufferMode = Ifx_DataBufferMode_normal;
+static void IfxAsclin_Asc_initDmaTxConfig(IfxAsclin_Asc *asclin, IfxDma_Dma_ChannelConfig *dmaCfg)
+{
+    IfxDma_Dma dma;
+    IfxDma_Dma_createModuleHandle(&dma, &MODULE_DMA);
+    IfxDma_Dma_initChannelConfig(dmaCfg, &dma);
+
+    dmaCfg->channelId               = asclin->dma.txDmaChannelId;
+    dmaCfg->channelInterruptEnabled = TRUE; // trigger interrupt after transaction
+
+    dmaCfg->sourceAddress               = 0;
+    dmaCfg->sourceAddressCircularRange  = IfxDma_ChannelIncrementCircular_none;
+    dmaCfg->sourceCircularBufferEnabled = FALSE;
+    dmaCfg->transferCount               = 0;
+
+    // destination address is fixed; use circular mode to stay at this address for each move
+    dmaCfg->destinationAddress               = (uint32)&asclin->asclin->TXDATA.U;
+    dmaCfg->destinationAddressCircularRange  = IfxDma_ChannelIncrementCircular_none;
+    dmaCfg->destinationCircularBufferEnabled = TRUE;
+
+    // the hardware request is disabled at the end of the transaction
+    dmaCfg->requestMode   = IfxDma_ChannelRequestMode_oneTransferPerRequest;
+    dmaCfg->operationMode = IfxDma_ChannelOperationMode_single;
+    dmaCfg->moveSize      = IfxDma_ChannelMoveSize_8bit;
+    dmaCfg->blockMode     = IfxDma_ChannelMove_1;
+}
+
+
+void IfxAsclin_Asc_initDmaTxDescriptor(IfxAsclin_Asc *asclin, Ifx_DMA_CH *descriptor, const void *data, Ifx_SizeT count, Ifx_DMA_CH *next)
+{
+    IfxDma_Dma_ChannelConfig dmaCfg;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, asclin->dma.useTxDma != FALSE);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (count > 0) && (count <= 0x3FFF));
+    /* The DMA loads the descriptors from memory, bypassing the data cache */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, IfxCpu_isAddressCachable(descriptor) == FALSE);
+
+    IfxCpu_flushDataCache(data, count);
+    IfxAsclin_Asc_initDmaTxConfig(asclin, &dmaCfg);
+    dmaCfg.sourceAddress = IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), data);
+    dmaCfg.transferCount = (uint16)count;
+
+    if (next != NULL_PTR)
+    {
+        // load the next entry at the end of the transaction, the hardware request stays enabled
+        dmaCfg.shadowControl           = IfxDma_ChannelShadow_linkedList;
+        dmaCfg.shadowAddress           = IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), next);
+        dmaCfg.operationMode           = IfxDma_ChannelOperationMode_continuous;
+        dmaCfg.channelInterruptEnabled = FALSE;
+    }
+
+    IfxDma_Dma_initLinkedListEntry(descriptor, &dmaCfg);
+    descriptor->CHCSR.U = 0; /* no software request when the entry is loaded */
+}
+
+
+static void IfxAsclin_Asc_startDmaTx(IfxAsclin_Asc *asclin, const Ifx_DMA_CH *set)
+{
+    Ifx_DMA_CH *channel = asclin->dma.txDmaChannel.channel;
+
+    channel->CHCFGR.U = set->CHCFGR.U;
+    channel->ADICR.U  = set->ADICR.U;
+    channel->SADR.U   = set->SADR.U;
+    channel->DADR.U   = set->DADR.U;
+
+    if (set->ADICR.B.SHCT == IfxDma_ChannelShadow_linkedList)
+    {
+        channel->SHADR.U = set->SHADR.U;
+    }
+
+    IfxDma_enableChannelTransaction(&MODULE_DMA, asclin->dma.txDmaChannelId);
+
+    /* The transmit request was consumed while the channel was disabled, raise the first one */
+    IfxSrc_setRequest(IfxAsclin_getSrcPointerTx(asclin->asclin));
+}
+
+
+static void IfxAsclin_Asc_startDmaTxFifo(IfxAsclin_Asc *asclin)
+{
+    const void *data;
+    Ifx_SizeT   count;
+
+    Ifx_Fifo_peekRead(asclin->tx, &data, &count);
+
+    if (count != 0)
+    {
+        Ifx_DMA_CH set;
+        count                   = __min(count, 0x3FFF);
+        asclin->dma.txFifoCount = count;
+        IfxAsclin_Asc_initDmaTxDescriptor(asclin, &set, data, count, NULL_PTR);
+        IfxAsclin_Asc_startDmaTx(asclin, &set);
+    }
+    else
+    {
+        /* Transmit buffer is empty */
+        asclin->txInProgress = FALSE;
+    }
 }
 
 
 void IfxAsclin_Asc_initiateTransmission(IfxAsclin_Asc *asclin)
 {
-    if (asclin->txInProgress == FALSE)     /* Send first byte: send init */
+    if (asclin->dma.useTxDma != FALSE)
+    {
+        boolean interruptState = IfxCpu_disableInterrupts();
+
+        if (asclin->txInProgress == FALSE)
+        {
+            asclin->txInProgress = TRUE;
+            IfxAsclin_Asc_startDmaTxFifo(asclin);
+        }
+
+        IfxCpu_restoreInterrupts(interruptState);
+    }
+    else if (asclin->txInProgress == FALSE)     /* Send first byte: send init */
     {
         if (Ifx_Fifo_isEmpty(asclin->tx) == FALSE)
         {
@@ -392,6 +747,7 @@ void IfxAsclin_Asc_initiateTransmission(IfxAsclin_Asc *asclin)
             switch (asclin->dataBufferMode)
             {
             case Ifx_DataBufferMode_normal:
+            case Ifx_DataBufferMode_timeStampFrame:
             {
                 Ifx_Fifo_read(asclin->tx, &data, 1, TIME_NULL);
                 /* FIXME optimize usage of HW fifo */
@@ -413,7 +769,7 @@ void IfxAsclin_Asc_initiateTransmission(IfxAsclin_Asc *asclin)
 }
 
 
-void IfxAsclin_Asc_isrError(IfxAsclin_Asc *asclin)
+IFX_HOT_CODE void IfxAsclin_Asc_isrError(IfxAsclin_Asc *asclin)
 {
     Ifx_ASCLIN *asclinSFR = asclin->asclin; /* getting the pointer to ASCLIN registers from module handler*/
 
@@ -450,7 +806,14 @@ void IfxAsclin_Asc_isrError(IfxAsclin_Asc *asclin)
 }
 
 
-void IfxAsclin_Asc_isrReceive(IfxAsclin_Asc *asclin)
+IFX_HOT_CODE void IfxAsclin_Asc_isrDmaReceive(IfxAsclin_Asc *asclin)
+{
+    IfxDma_Dma_clearChannelInterrupt(&asclin->dma.rxDmaChannel);
+    IfxAsclin_Asc_copyDmaRxData(asclin);
+}
+
+
+IFX_HOT_CODE void IfxAsclin_Asc_isrReceive(IfxAsclin_Asc *asclin)
 {
     uint8 ascData;
 
@@ -458,13 +821,13 @@ void IfxAsclin_Asc_isrReceive(IfxAsclin_Asc *asclin)
     {
     case Ifx_DataBufferMode_normal:
     {
-        /* FIXME optimize usage of HW fifo */
         /* FIXME add support for data size != 8 bit */
+        uint8 buffer[IFXASCLIN_ASC_RX_FIFO_SIZE];
         uint8 count;
-        count = IfxAsclin_getRxFifoFillLevel(asclin->asclin);
-        IfxAsclin_read8(asclin->asclin, &ascData, count);
+        count = __min(IfxAsclin_getRxFifoFillLevel(asclin->asclin), IFXASCLIN_ASC_RX_FIFO_SIZE);
+        IfxAsclin_read8(asclin->asclin, buffer, count);
 
-        if (Ifx_Fifo_write(asclin->rx, &ascData, count, TIME_NULL) != 0)
+        if (Ifx_Fifo_write(asclin->rx, buffer, count, TIME_NULL) != 0)
         {
             /* Receive buffer is full, data is discard */
             asclin->rxSwFifoOverflow = TRUE;
@@ -490,11 +853,96 @@ void IfxAsclin_Asc_isrReceive(IfxAsclin_Asc *asclin)
         }
     }
     break;
+    case Ifx_DataBufferMode_timeStampFrame:
+    {
+        IfxAsclin_Asc_RxFrame *frame     = &asclin->rxFrame;
+        Ifx_TickTime           timestamp = now();
+
+        /* A reception after the idle time starts a new frame */
+        if ((frame->open != FALSE) && ((timestamp - frame->lastTime) > frame->idleTime))
+        {
+            IfxAsclin_Asc_writeRxFrame(asclin);
+            frame->open = FALSE;
+        }
+
+        if (frame->open == FALSE)
+        {
+            frame->open      = TRUE;
+            frame->timestamp = timestamp;
+        }
+
+        while (IfxAsclin_getRxFifoFillLevel(asclin->asclin) > 0)
+        {
+            if (frame->count == IFXASCLIN_ASC_RX_FRAME_SIZE)
+            {
+                /* Continued in the next record, with the same time stamp */
+                IfxAsclin_Asc_writeRxFrame(asclin);
+            }
+
+            IfxAsclin_read8(asclin->asclin, &ascData, 1);
+            frame->data[frame->count] = ascData;
+            frame->count++;
+        }
+
+        frame->lastTime = timestamp;
+    }
+    break;
+    }
+}
+
+
+void IfxAsclin_Asc_pollDmaReceive(IfxAsclin_Asc *asclin)
+{
+    boolean interruptState = IfxCpu_disableInterrupts();
+    IfxAsclin_Asc_copyDmaRxData(asclin);
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+
+void IfxAsclin_Asc_pollFrameReceive(IfxAsclin_Asc *asclin)
+{
+    if (asclin->dataBufferMode == Ifx_DataBufferMode_timeStampFrame)
+    {
+        IfxAsclin_Asc_RxFrame *frame          = &asclin->rxFrame;
+        boolean                interruptState = IfxCpu_disableInterrupts();
+
+        /* The bytes waiting in the hardware FIFO belong to the frame, the receive interrupt is pending */
+        if ((frame->open != FALSE)
+            && (IfxAsclin_getRxFifoFillLevel(asclin->asclin) == 0)
+            && ((now() - frame->lastTime) > frame->idleTime))
+        {
+            IfxAsclin_Asc_writeRxFrame(asclin);
+            frame->open = FALSE;
+        }
+
+        IfxCpu_restoreInterrupts(interruptState);
+    }
+}
+
+
+IFX_HOT_CODE void IfxAsclin_Asc_isrDmaTransmit(IfxAsclin_Asc *asclin)
+{
+    IfxDma_Dma_clearChannelInterrupt(&asclin->dma.txDmaChannel);
+    asclin->txTimestamp = now();
+
+    if (asclin->dma.txFifoCount != 0)
+    {
+        Ifx_Fifo_releaseRead(asclin->tx, asclin->dma.txFifoCount);
+        asclin->sendCount      += (uint32)asclin->dma.txFifoCount;
+        asclin->dma.txFifoCount = 0;
+    }
+    else
+    {
+        asclin->sendCount       += asclin->dma.txChainCount;
+        asclin->dma.txChainCount = 0;
     }
+
+    /* Continue with the data written to the tx FIFO meanwhile */
+    IfxAsclin_Asc_startDmaTxFifo(asclin);
 }
 
 
-void IfxAsclin_Asc_isrTransmit(IfxAsclin_Asc *asclin)
+IFX_HOT_CODE void IfxAsclin_Asc_isrTransmit(IfxAsclin_Asc *asclin)
 {
     asclin->txTimestamp = now();
     asclin->sendCount++;
@@ -502,6 +950,7 @@ void IfxAsclin_Asc_isrTransmit(IfxAsclin_Asc *asclin)
     switch (asclin->dataBufferMode)
     {
     case Ifx_DataBufferMode_normal:
+    case Ifx_DataBufferMode_timeStampFrame:
     {
         uint8 ascData;
 
@@ -541,7 +990,16 @@ void IfxAsclin_Asc_isrTransmit(IfxAsclin_Asc *asclin)
 
 boolean IfxAsclin_Asc_read(IfxAsclin_Asc *asclin, void *data, Ifx_SizeT *count, Ifx_TickTime timeout)
 {
-    Ifx_SizeT left = Ifx_Fifo_read(asclin->rx, data, *count, timeout);
+    Ifx_SizeT left;
+
+    if (asclin->dma.useRxDma != FALSE)
+    {
+        IfxAsclin_Asc_pollDmaReceive(asclin);
+    }
+
+    IfxAsclin_Asc_pollFrameReceive(asclin);
+
+    left = Ifx_Fifo_read(asclin->rx, data, *count, timeout);
 
     *count -= left;
 
@@ -549,6 +1007,44 @@ boolean IfxAsclin_Asc_read(IfxAsclin_Asc *asclin, void *data, Ifx_SizeT *count,
 }
 
 
+boolean IfxAsclin_Asc_readFrame(IfxAsclin_Asc *asclin, Ifx_TickTime *timestamp, void *data, Ifx_SizeT *count, Ifx_TickTime timeout)
+{
+    Ifx_TickTime                      deadline = getDeadLine(timeout);
+    Ifx_SizeT                         size     = *count;
+    Ifx_DataBufferMode_TimeStampFrame header;
+    boolean                           available;
+
+    *count = 0;
+
+    /* The last frame is only closed by polling */
+    do
+    {
+        IfxAsclin_Asc_pollFrameReceive(asclin);
+        available = Ifx_Fifo_readCount(asclin->rx) >= (Ifx_SizeT)sizeof(header);
+    } while (!available && !isDeadLine(deadline));
+
+    if (available == FALSE)
+    {
+        return FALSE;
+    }
+
+    /* The data bytes are written together with the header */
+    Ifx_Fifo_read(asclin->rx, &header, sizeof(header), TIME_INFINITE);
+    *count = __min(size, (Ifx_SizeT)header.count);
+    Ifx_Fifo_read(asclin->rx, data, *count, TIME_INFINITE);
+
+    for (size = *count; size < header.count; size++)
+    {
+        uint8 dropped;
+        Ifx_Fifo_read(asclin->rx, &dropped, 1, TIME_INFINITE);
+    }
+
+    *timestamp = header.timestamp;
+
+    return TRUE;
+}
+
+
 void IfxAsclin_Asc_resetSendCount(IfxAsclin_Asc *asclin)
 {
     asclin->sendCount = 0;
@@ -600,3 +1096,49 @@ boolean IfxAsclin_Asc_write(IfxAsclin_Asc *asclin, void *data, Ifx_SizeT *count,
 
     return result;
 }
+
+
+boolean IfxAsclin_Asc_writeDma(IfxAsclin_Asc *asclin, Ifx_DMA_CH *descriptor)
+{
+    const Ifx_DMA_CH *entry   = descriptor;
+    uint32            entries = 1;
+    uint32            count   = entry->CHCFGR.B.TREL;
+    boolean           result;
+    boolean           interruptState;
+
+    /* Count the bytes of the chain for the send counter, a circular chain never ends */
+    while ((entry->ADICR.B.SHCT == IfxDma_ChannelShadow_linkedList) && (entries <= IFXASCLIN_ASC_DMA_MAX_DESCRIPTORS))
+    {
+        entry = (const Ifx_DMA_CH *)entry->SHADR.U;
+
+        if (entry == descriptor)
+        {
+            entries = IFXASCLIN_ASC_DMA_MAX_DESCRIPTORS + 1;
+        }
+        else
+        {
+            count += entry->CHCFGR.B.TREL;
+            entries++;
+        }
+    }
+
+    if (entries > IFXASCLIN_ASC_DMA_MAX_DESCRIPTORS)
+    {
+        return FALSE;
+    }
+
+    interruptState = IfxCpu_disableInterrupts();
+    result         = asclin->txInProgress == FALSE;
+
+    if (result != FALSE)
+    {
+        asclin->txInProgress     = TRUE;
+        asclin->dma.txFifoCount  = 0;
+        asclin->dma.txChainCount = count;
+        IfxAsclin_Asc_startDmaTx(asclin, descriptor);
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return result;
+}
@@ -197,6 +197,96 @@
  *     }
  * \endcode
  *
+ * \section IfxLld_Asclin_Asc_DmaReceive Reception with DMA
+ *
+ * At high baudrates the receive interrupt load can be reduced by moving the received bytes with a DMA channel.
+ * The ASCLIN receive service request is routed to the DMA, the channel stores the bytes in a circular buffer and
+ * raises its interrupt every dma.rxTransferCount bytes. The DMA interrupt copies the received bytes in one burst into
+ * the software FIFO.
+ *
+ * The ASCLIN has no idle line detection in ASC mode. To deliver frames shorter than dma.rxTransferCount,
+ * \ref IfxAsclin_Asc_pollDmaReceive() must be called periodically, for example from a timer interrupt. Its period is the
+ * maximum delay of a partial frame. \ref IfxAsclin_Asc_read() and \ref IfxAsclin_Asc_getReadCount() also poll the DMA buffer.
+ *
+ * \code
+ * // DMA ring buffer, aligned on its size and located in a non cached memory
+ * IFX_ALIGN(256) static uint8 ascRxDmaBuffer[256];
+ *
+ * IFX_INTERRUPT(asclin0DmaRxISR, 0, IFX_INTPRIO_ASCLIN0_RX)
+ * {
+ *     IfxAsclin_Asc_isrDmaReceive(&asc);
+ * }
+ *
+ *     // in the initialisation function, in addition to the configuration above
+ *     IfxCpu_Irq_installInterruptHandler(&asclin0DmaRxISR, IFX_INTPRIO_ASCLIN0_RX);
+ *
+ *     ascConfig.dma.useRxDma        = TRUE;
+ *     ascConfig.dma.rxDmaChannelId  = IfxDma_ChannelId_3;
+ *     ascConfig.dma.rxBuffer        = ascRxDmaBuffer;
+ *     ascConfig.dma.rxBufferSize    = IfxDma_ChannelIncrementCircular_256;
+ *     ascConfig.dma.rxTransferCount = 32;  // one interrupt every 32 bytes
+ * \endcode
+ *
+ * \section IfxLld_Asclin_Asc_FrameTimeStamp Frame time stamps
+ *
+ * The Ifx_DataBufferMode_timeStampSingle mode stores a time stamp with each received byte. With
+ * Ifx_DataBufferMode_timeStampFrame, the time stamp is taken only at the first byte after a line idle time of
+ * rxFrameIdleBits bit times, and the rx FIFO receives a \ref Ifx_DataBufferMode_TimeStampFrame header followed by the
+ * bytes of the frame. A frame longer than IFXASCLIN_ASC_RX_FRAME_SIZE bytes is stored as several records with the same
+ * time stamp. The transmission is the same as in normal mode.
+ *
+ * The ASCLIN has no idle line detection in ASC mode: the idle time is measured between the receive interrupts, so the
+ * rx FIFO interrupt level should be 1. The last frame is closed by \ref IfxAsclin_Asc_pollFrameReceive(), which must be
+ * called periodically like \ref IfxAsclin_Asc_pollDmaReceive(). \ref IfxAsclin_Asc_readFrame(),
+ * \ref IfxAsclin_Asc_read() and \ref IfxAsclin_Asc_getReadCount() also poll. The rx FIFO shall not be in overwrite mode.
+ *
+ * \code
+ *     ascConfig.dataBufferMode  = Ifx_DataBufferMode_timeStampFrame;
+ *     ascConfig.rxFrameIdleBits = 20;  // 2 characters of 10 bits
+ *
+ *     // receive a frame
+ *     uint8        frame[32];
+ *     Ifx_SizeT    count = sizeof(frame);
+ *     Ifx_TickTime timestamp;
+ *
+ *     if (IfxAsclin_Asc_readFrame(&asc, &timestamp, frame, &count, TIME_INFINITE))
+ *     {}
+ * \endcode
+ *
+ * \section IfxLld_Asclin_Asc_DmaTransmit Transmission with DMA
+ *
+ * When dma.useTxDma is set, the ASCLIN transmit request is routed to a DMA channel. Data written with
+ * \ref IfxAsclin_Asc_write() are moved by the DMA directly from the software FIFO, one interrupt is raised per
+ * contiguous block instead of one per byte.
+ *
+ * In addition, data located in several buffers can be sent as one transfer without copying them into the
+ * software FIFO. Each buffer is described by a linked list entry initialised with \ref IfxAsclin_Asc_initDmaTxDescriptor(),
+ * the chain is started with \ref IfxAsclin_Asc_writeDma(). The buffers and the descriptors must stay valid until
+ * the transfer is completed, see \ref IfxAsclin_Asc_flushTx().
+ *
+ * \code
+ * IFX_INTERRUPT(asclin0DmaTxISR, 0, IFX_INTPRIO_ASCLIN0_TX)
+ * {
+ *     IfxAsclin_Asc_isrDmaTransmit(&asc);
+ * }
+ *
+ *     // in the initialisation function
+ *     IfxCpu_Irq_installInterruptHandler(&asclin0DmaTxISR, IFX_INTPRIO_ASCLIN0_TX);
+ *
+ *     ascConfig.dma.useTxDma       = TRUE;
+ *     ascConfig.dma.txDmaChannelId = IfxDma_ChannelId_4;
+ *
+ *     // header, payload and trailer sent as one transfer
+ *     IFX_ALIGN(32) static Ifx_DMA_CH frameDescriptors[3];
+ *
+ *     IfxAsclin_Asc_initDmaTxDescriptor(&asc, &frameDescriptors[0], &header, sizeof(header), &frameDescriptors[1]);
+ *     IfxAsclin_Asc_initDmaTxDescriptor(&asc, &frameDescriptors[1], payload, payloadSize, &frameDescriptors[2]);
+ *     IfxAsclin_Asc_initDmaTxDescriptor(&asc, &frameDescriptors[2], &crc, sizeof(crc), NULL_PTR);
+ *
+ *     while (IfxAsclin_Asc_writeDma(&asc, &frameDescriptors[0]) == FALSE)
+ *     {}
+ * \endcode
+ *
  * \defgroup IfxLld_Asclin_Asc ASC
  * \ingroup IfxLld_Asclin
  * \defgroup IfxLld_Asclin_Asc_DataStructures Data Structures
@@ -222,6 +312,27 @@
 #include "_Lib/DataHandling/Ifx_Fifo.h"
 #include "SysSe/Bsp/Bsp.h"
 #include "StdIf/IfxStdIf_DPipe.h"
+#include "Dma/Dma/IfxDma_Dma.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Size of the ASCLIN hardware receive FIFO in bytes
+ */
+#define IFXASCLIN_ASC_RX_FIFO_SIZE (16)
+
+/** \brief Maximal number of data bytes of a frame record in the Ifx_DataBufferMode_timeStampFrame mode
+ */
+#ifndef IFXASCLIN_ASC_RX_FRAME_SIZE
+#define IFXASCLIN_ASC_RX_FRAME_SIZE (32)
+#endif
+
+/** \brief Maximal number of linked list entries of a chain sent with IfxAsclin_Asc_writeDma()
+ */
+#ifndef IFXASCLIN_ASC_DMA_MAX_DESCRIPTORS
+#define IFXASCLIN_ASC_DMA_MAX_DESCRIPTORS (64)
+#endif
 
 /******************************************************************************/
 /*-----------------------------Data Structures--------------------------------*/
@@ -306,6 +417,48 @@ typedef struct
     IfxPort_PadDriver            pinDriver;       /**< \brief pad driver */
 } IfxAsclin_Asc_Pins;
 
+/** \brief Dma handle
+ */
+typedef struct
+{
+    IfxDma_Dma_Channel rxDmaChannel;         /**< \brief receive DMA channel handle */
+    IfxDma_Dma_Channel txDmaChannel;         /**< \brief transmit DMA channel handle */
+    IfxDma_ChannelId   rxDmaChannelId;       /**< \brief DMA channel no for the Asc receive */
+    IfxDma_ChannelId   txDmaChannelId;       /**< \brief DMA channel no for the Asc transmit */
+    uint8             *rxBuffer;             /**< \brief DMA receive circular buffer (global address) */
+    uint16             rxBufferSize;         /**< \brief DMA receive circular buffer size in bytes, power of 2 */
+    uint16             rxIndex;              /**< \brief index of the next byte to be copied from the DMA buffer into the rx FIFO */
+    Ifx_SizeT          txFifoCount;          /**< \brief number of bytes of the tx FIFO being moved by the DMA */
+    uint32             txChainCount;         /**< \brief number of bytes of the descriptor chain being moved by the DMA */
+    boolean            useRxDma;             /**< \brief use Dma for the data reception */
+    boolean            useTxDma;             /**< \brief use Dma for the data transmission */
+} IfxAsclin_Asc_Dma;
+
+/** \brief Dma configuration
+ */
+typedef struct
+{
+    IfxDma_ChannelId                rxDmaChannelId;        /**< \brief DMA channel no for the Asc receive */
+    void                           *rxBuffer;              /**< \brief DMA receive circular buffer. Must be aligned on its size and located in a non cached memory */
+    IfxDma_ChannelIncrementCircular rxBufferSize;          /**< \brief DMA receive circular buffer size */
+    uint16                          rxTransferCount;       /**< \brief number of bytes received between 2 DMA interrupts, must not exceed half of the buffer size */
+    IfxDma_ChannelId                txDmaChannelId;        /**< \brief DMA channel no for the Asc transmit */
+    boolean                         useRxDma;              /**< \brief use Dma for the data reception, only supported with Ifx_DataBufferMode_normal */
+    boolean                         useTxDma;              /**< \brief use Dma for the data transmission, only supported with Ifx_DataBufferMode_normal */
+} IfxAsclin_Asc_DmaConfig;
+
+/** \brief Frame being received in the Ifx_DataBufferMode_timeStampFrame mode
+ */
+typedef struct
+{
+    Ifx_TickTime idleTime;                               /**< \brief minimal line idle time between two frames */
+    Ifx_TickTime timestamp;                              /**< \brief time stamp of the first byte of the frame */
+    Ifx_TickTime lastTime;                               /**< \brief time of the latest reception */
+    uint16       count;                                  /**< \brief number of bytes in data */
+    boolean      open;                                   /**< \brief TRUE while the frame is being received */
+    uint8        data[IFXASCLIN_ASC_RX_FRAME_SIZE];      /**< \brief bytes of the frame not yet written into the rx FIFO */
+} IfxAsclin_Asc_RxFrame;
+
 /** \} */
 
 /** \brief This union contains the error flags. In addition it allows to write and read to/from all flags as once via the ALL member.
@@ -331,6 +484,8 @@ typedef struct
     Ifx_DataBufferMode            dataBufferMode;         /**< \brief Rx buffer mode */
     volatile uint32               sendCount;              /**< \brief Number of byte that are send out, this value is reset with the function Asc_If_resetSendCount() */
     volatile Ifx_TickTime         txTimestamp;            /**< \brief Time stamp of the latest send byte */
+    IfxAsclin_Asc_Dma             dma;                    /**< \brief dma handle */
+    IfxAsclin_Asc_RxFrame         rxFrame;                /**< \brief frame being received, Ifx_DataBufferMode_timeStampFrame mode only */
 } IfxAsclin_Asc;
 
 /** \brief Configuration structure of the module
@@ -358,8 +513,11 @@ typedef struct
                                                           * The Size of this area must be at least equals to "rxBufferSize + sizeof(Ifx_Fifo) + 8". Not tacking this in account may result in unpredictable behavior.
                                                           *
                                                           * If set to NULL, the buffer will be allocated dynamically according to rxBufferSize */
+    boolean            rxOverwrite;                      /**< \brief If TRUE, the rx buffer keeps the newest data when it is full: the oldest data are dropped and counted by Ifx_Fifo_getLossCount(asclin->rx), rxSwFifoOverflow is not set. See Ifx_Fifo_initOverwrite() */
     boolean            loopBack;                         /**< \brief IOCR.LB, loop back mode selection, 0 for disable, 1 for enable */
-    Ifx_DataBufferMode dataBufferMode;                   /**< \brief Rx buffer mode */
+    Ifx_DataBufferMode      dataBufferMode;              /**< \brief Rx buffer mode */
+    uint16                  rxFrameIdleBits;             /**< \brief line idle time in bit times closing a frame, Ifx_DataBufferMode_timeStampFrame mode only */
+    IfxAsclin_Asc_DmaConfig dma;                         /**< \brief Dma configuration */
 } IfxAsclin_Asc_Config;
 
 /** \} */
@@ -395,6 +553,42 @@ IFX_EXTERN void IfxAsclin_Asc_isrReceive(IfxAsclin_Asc *asclin);
  */
 IFX_EXTERN void IfxAsclin_Asc_isrTransmit(IfxAsclin_Asc *asclin);
 
+/** \brief ISR DMA receive routine
+ *
+ * Copies the bytes stored by the DMA channel since the last call into the rx FIFO.
+ * Used instead of \ref IfxAsclin_Asc_isrReceive() when dma.useRxDma is set.
+ * \param asclin module handler
+ * \return None
+ */
+IFX_EXTERN void IfxAsclin_Asc_isrDmaReceive(IfxAsclin_Asc *asclin);
+
+/** \brief Deliver the bytes received by DMA which did not yet raise the DMA interrupt
+ *
+ * Must be called periodically when dma.useRxDma is set, the call period is the maximum reception
+ * delay of a frame shorter than dma.rxTransferCount. Can be called from any context.
+ * \param asclin module handler
+ * \return None
+ */
+IFX_EXTERN void IfxAsclin_Asc_pollDmaReceive(IfxAsclin_Asc *asclin);
+
+/** \brief Close the frame being received once the line is idle
+ *
+ * Must be called periodically in the Ifx_DataBufferMode_timeStampFrame mode, the call period is the maximum
+ * delivery delay of the last frame. Does nothing in the other modes. Can be called from any context.
+ * \param asclin module handler
+ * \return None
+ */
+IFX_EXTERN void IfxAsclin_Asc_pollFrameReceive(IfxAsclin_Asc *asclin);
+
+/** \brief ISR DMA transmit routine
+ *
+ * Releases the data sent from the tx FIFO and starts the transfer of the next block.
+ * Used instead of \ref IfxAsclin_Asc_isrTransmit() when dma.useTxDma is set.
+ * \param asclin module handler
+ * \return None
+ */
+IFX_EXTERN void IfxAsclin_Asc_isrDmaTransmit(IfxAsclin_Asc *asclin);
+
 /** \} */
 
 /** \addtogroup IfxLld_Asclin_Asc_SimpleCom
@@ -516,6 +710,20 @@ IFX_EXTERN IfxStdIf_DPipe_WriteEvent IfxAsclin_Asc_getWriteEvent(IfxAsclin_Asc *
  */
 IFX_EXTERN boolean IfxAsclin_Asc_read(IfxAsclin_Asc *asclin, void *data, Ifx_SizeT *count, Ifx_TickTime timeout);
 
+/** \brief Read one frame record in the Ifx_DataBufferMode_timeStampFrame mode
+ * \param asclin module handle
+ * \param timestamp Time stamp of the first byte of the frame
+ * \param data Pointer to the frame buffer
+ * \param count Size of the frame buffer (in bytes), returns the number of bytes stored. The bytes not fitting in the buffer are dropped
+ * \param timeout in system timer ticks
+ * \return Returns TRUE if a frame has been read\n
+ * Returns FALSE if no frame was received within the timeout
+ *
+ * A coding example can be found in \ref IfxLld_Asclin_Asc_FrameTimeStamp
+ *
+ */
+IFX_EXTERN boolean IfxAsclin_Asc_readFrame(IfxAsclin_Asc *asclin, Ifx_TickTime *timestamp, void *data, Ifx_SizeT *count, Ifx_TickTime timeout);
+
 /** \brief \see IfxStdIf_DPipe_ResetSendCount
  * \param asclin module handle
  * \return None
@@ -535,6 +743,30 @@ IFX_EXTERN void IfxAsclin_Asc_resetSendCount(IfxAsclin_Asc *asclin);
  */
 IFX_EXTERN boolean IfxAsclin_Asc_write(IfxAsclin_Asc *asclin, void *data, Ifx_SizeT *count, Ifx_TickTime timeout);
 
+/** \brief Initialise a DMA linked list entry which sends a buffer
+ *
+ * Only available when dma.useTxDma is set. The entries are chained through the next parameter
+ * and sent with \ref IfxAsclin_Asc_writeDma().
+ * \param asclin module handle
+ * \param descriptor linked list entry, must be aligned on 32 bytes
+ * \param data Pointer to the data to be sent, must not be located in a cached memory
+ * \param count Count of data (in bytes), max 16383
+ * \param next next linked list entry, NULL_PTR for the last entry of the chain
+ * \return None
+ */
+IFX_EXTERN void IfxAsclin_Asc_initDmaTxDescriptor(IfxAsclin_Asc *asclin, Ifx_DMA_CH *descriptor, const void *data, Ifx_SizeT count, Ifx_DMA_CH *next);
+
+/** \brief Send a chain of DMA linked list entries
+ *
+ * The data are sent without being copied into the tx FIFO. The descriptors and the data must not be
+ * modified until the transfer is completed. The chain shall end with a NULL_PTR next entry: a circular chain or
+ * a chain of more than IFXASCLIN_ASC_DMA_MAX_DESCRIPTORS entries is refused.
+ * \param asclin module handle
+ * \param descriptor first entry of the chain, initialised with \ref IfxAsclin_Asc_initDmaTxDescriptor()
+ * \return Returns TRUE if the transfer is started, FALSE if a transmission is already ongoing or the chain is refused
+ */
+IFX_EXTERN boolean IfxAsclin_Asc_writeDma(IfxAsclin_Asc *asclin, Ifx_DMA_CH *descriptor);
+
 /** \} */
 
 /** \addtogroup IfxLld_Asclin_Asc_ModuleFunctions
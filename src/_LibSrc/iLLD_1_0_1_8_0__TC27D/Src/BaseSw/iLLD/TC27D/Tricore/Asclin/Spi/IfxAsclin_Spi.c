@@ -26,7 +26,9 @@
 /*----------------------------------Includes----------------------------------*/
 /******************************************************************************/
 
+#define IFX_ASSERT_MODULE ASCLIN
 #include "IfxAsclin_Spi.h"
+#include "_Utilities/Ifx_Assert.h"
 
 /******************************************************************************/
 /*-----------------------Private Function Prototypes--------------------------*/
@@ -38,12 +40,43 @@
  */
 IFX_STATIC IfxAsclin_Spi_Status IfxAsclin_Spi_lock(IfxAsclin_Spi *asclin);
 
-/**
+/** \brief Sets the data length and the matching FIFO widths
+ * \param asclin module handle
+ * \param dataLength data length
+ * \return None
+ */
+IFX_STATIC void IfxAsclin_Spi_setDataLength(IfxAsclin_Spi *asclin, IfxAsclin_DataLength dataLength);
+
+/** \brief Programs the DMA channels for an exchange and starts it
+ * \param asclin module handle
+ * \return None
+ */
+IFX_STATIC void IfxAsclin_Spi_startDma(IfxAsclin_Spi *asclin);
+
+/** \brief Starts the first queued job if the module is free
+ * \param asclin module handle
+ * \return None
+ */
+IFX_STATIC void IfxAsclin_Spi_startJob(IfxAsclin_Spi *asclin);
+
+/** \brief Unlocks the transfers, completes the active job and starts the next queued one
  * \param asclin module handle
  * \return None
  */
 IFX_STATIC void IfxAsclin_Spi_unlock(IfxAsclin_Spi *asclin);
 
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+
+/** \brief Destination of the discarded received data in DMA mode
+ */
+IFX_STATIC uint32           IfxAsclin_Spi_dummyRxValue = 0;
+
+/** \brief Source of the all-1 transmitted data in DMA mode
+ */
+IFX_STATIC IFX_CONST uint32 IfxAsclin_Spi_dummyTxValue = ~0;
+
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
@@ -70,7 +103,14 @@ IfxAsclin_Spi_Status IfxAsclin_Spi_exchange(IfxAsclin_Spi *asclin, void *src, vo
         asclin->rxJob.data         = dest;  /* empty buffer to receive data */
         asclin->rxJob.pending      = count; /* count of Rx data */
 
-        IfxAsclin_Spi_write(asclin);        /* write data into Tx fifo */
+        if (asclin->dma.useDma)
+        {
+            IfxAsclin_Spi_startDma(asclin); /* data moved by the DMA */
+        }
+        else
+        {
+            IfxAsclin_Spi_write(asclin);    /* write data into Tx fifo */
+        }
     }
 
     return status;
@@ -90,6 +130,20 @@ IfxAsclin_Spi_Status IfxAsclin_Spi_getStatus(IfxAsclin_Spi *asclin)
 }
 
 
+void IfxAsclin_Spi_initJob(IfxAsclin_Spi_QueuedJob *job, IfxAsclin_Spi *asclin, const void *src, void *dest, uint32 count)
+{
+    job->next       = NULL_PTR;
+    job->spi        = asclin;
+    job->src        = src;
+    job->dest       = dest;
+    job->count      = count;
+    job->dataLength = (IfxAsclin_DataLength)asclin->asclin->DATCON.B.DATLEN;
+    job->callback   = NULL_PTR;
+    job->data       = NULL_PTR;
+    job->done       = TRUE;
+}
+
+
 IfxAsclin_Status IfxAsclin_Spi_initModule(IfxAsclin_Spi *asclin, const IfxAsclin_Spi_Config *config)
 {
     Ifx_ASCLIN      *asclinSFR = config->asclin;                                                                                  /* pointer to ASCLIN registers */
@@ -159,24 +213,79 @@ IfxAsclin_Status IfxAsclin_Spi_initModule(IfxAsclin_Spi *asclin, const IfxAsclin
     IfxAsclin_disableAllFlags(asclinSFR);                                            /* disable all flags */
     IfxAsclin_clearAllFlags(asclinSFR);                                              /* clear all flags */
 
+    asclin->dma.useDma = config->dma.useDma;
+
     /* initialising the interrupts */
-    if (config->interrupt.rxPriority > 0)
+    if (config->dma.useDma)
     {
-        volatile Ifx_SRC_SRCR *src;
+        IfxDma_Dma               dma;
+        IfxDma_Dma_ChannelConfig dmaCfg;
+        volatile Ifx_SRC_SRCR   *src;
+
+        IfxDma_Dma_createModuleHandle(&dma, &MODULE_DMA);
+        IfxDma_Dma_initChannelConfig(&dmaCfg, &dma);
+
+        /* transmit: one data per Tx FIFO level request, source and count configured by each exchange */
+        asclin->dma.txDmaChannelId              = config->dma.txDmaChannelId;
+        dmaCfg.channelId                        = config->dma.txDmaChannelId;
+        dmaCfg.hardwareRequestEnabled           = FALSE;
+        dmaCfg.channelInterruptEnabled          = FALSE;
+        dmaCfg.requestMode                      = IfxDma_ChannelRequestMode_oneTransferPerRequest;
+        dmaCfg.operationMode                    = IfxDma_ChannelOperationMode_single;
+        dmaCfg.moveSize                         = IfxDma_ChannelMoveSize_8bit;
+        dmaCfg.blockMode                        = IfxDma_ChannelMove_1;
+        dmaCfg.transferCount                    = 0;
+        dmaCfg.sourceAddress                    = 0;
+        dmaCfg.sourceCircularBufferEnabled      = FALSE;
+        dmaCfg.sourceAddressCircularRange       = IfxDma_ChannelIncrementCircular_none;
+        dmaCfg.destinationAddress               = (uint32)&asclinSFR->TXDATA.U;
+        dmaCfg.destinationCircularBufferEnabled = TRUE;                                           // fixed destination
+        dmaCfg.destinationAddressCircularRange  = IfxDma_ChannelIncrementCircular_none;
+        IfxDma_Dma_initChannel(&asclin->dma.txDmaChannel, &dmaCfg);
+
+        /* receive: one data per Rx FIFO level request, the channel interrupt ends the exchange */
+        asclin->dma.rxDmaChannelId              = config->dma.rxDmaChannelId;
+        dmaCfg.channelId                        = config->dma.rxDmaChannelId;
+        dmaCfg.channelInterruptEnabled          = TRUE;
+        dmaCfg.channelInterruptPriority         = config->interrupt.rxPriority;
+        dmaCfg.channelInterruptTypeOfService    = config->interrupt.typeOfService;
+        dmaCfg.sourceAddress                    = (uint32)&asclinSFR->RXDATA.U;
+        dmaCfg.sourceCircularBufferEnabled      = TRUE;                                           // fixed source
+        dmaCfg.destinationAddress               = 0;
+        dmaCfg.destinationCircularBufferEnabled = FALSE;
+        IfxDma_Dma_initChannel(&asclin->dma.rxDmaChannel, &dmaCfg);
+
+        /* the FIFO level service requests trigger the DMA channels */
         src = IfxAsclin_getSrcPointerRx(asclinSFR);
-        IfxSrc_init(src, config->interrupt.typeOfService, config->interrupt.rxPriority);
+        IfxSrc_init(src, IfxSrc_Tos_dma, (Ifx_Priority)config->dma.rxDmaChannelId);
         IfxAsclin_enableRxFifoFillLevelFlag(asclinSFR, TRUE);
         IfxSrc_enable(src);
-    }
 
-    if (config->interrupt.txPriority > 0)
-    {
-        volatile Ifx_SRC_SRCR *src;
         src = IfxAsclin_getSrcPointerTx(asclinSFR);
-        IfxSrc_init(src, config->interrupt.typeOfService, config->interrupt.txPriority);
+        IfxSrc_init(src, IfxSrc_Tos_dma, (Ifx_Priority)config->dma.txDmaChannelId);
         IfxAsclin_enableTxFifoFillLevelFlag(asclinSFR, TRUE);
         IfxSrc_enable(src);
     }
+    else
+    {
+        if (config->interrupt.rxPriority > 0)
+        {
+            volatile Ifx_SRC_SRCR *src;
+            src = IfxAsclin_getSrcPointerRx(asclinSFR);
+            IfxSrc_init(src, config->interrupt.typeOfService, config->interrupt.rxPriority);
+            IfxAsclin_enableRxFifoFillLevelFlag(asclinSFR, TRUE);
+            IfxSrc_enable(src);
+        }
+
+        if (config->interrupt.txPriority > 0)
+        {
+            volatile Ifx_SRC_SRCR *src;
+            src = IfxAsclin_getSrcPointerTx(asclinSFR);
+            IfxSrc_init(src, config->interrupt.typeOfService, config->interrupt.txPriority);
+            IfxAsclin_enableTxFifoFillLevelFlag(asclinSFR, TRUE);
+            IfxSrc_enable(src);
+        }
+    }
 
     if (config->interrupt.erPriority > 0)
     {
@@ -225,7 +334,10 @@ IfxAsclin_Status IfxAsclin_Spi_initModule(IfxAsclin_Spi *asclin, const IfxAsclin
 
     IfxAsclin_setClockSource(asclinSFR, config->clockSource);       /* setting the clock source*/
 
-    asclin->sending = 0;
+    asclin->sending      = 0;
+    asclin->queue.first  = NULL_PTR;
+    asclin->queue.last   = NULL_PTR;
+    asclin->queue.active = NULL_PTR;
     IfxAsclin_enableTxFifoOutlet(asclinSFR, TRUE);                  /* disabling Rx FIFO for recieving */
     IfxAsclin_enableRxFifoInlet(asclinSFR, TRUE);                   /* disabling Tx FIFO for transmitting */
 
@@ -290,6 +402,13 @@ void IfxAsclin_Spi_initModuleConfig(IfxAsclin_Spi_Config *config, Ifx_ASCLIN *as
         },
 
         .pins                     = NULL_PTR,              /* pins to null pointer */
+
+        /* Default Values for Dma Config */
+        .dma                      = {
+            .rxDmaChannelId = IfxDma_ChannelId_none,       /* no receive DMA channel */
+            .txDmaChannelId = IfxDma_ChannelId_none,       /* no transmit DMA channel */
+            .useDma         = FALSE,                       /* data moved by the interrupts */
+        },
     };
 
     /* Default Configuration */
@@ -299,6 +418,23 @@ void IfxAsclin_Spi_initModuleConfig(IfxAsclin_Spi_Config *config, Ifx_ASCLIN *as
 }
 
 
+void IfxAsclin_Spi_isrDmaReceive(IfxAsclin_Spi *asclin)
+{
+    Ifx_DMA *dmaSFR = &MODULE_DMA;
+
+    if (IfxDma_getAndClearChannelInterrupt(dmaSFR, asclin->dma.rxDmaChannelId))
+    {
+        IfxDma_disableChannelTransaction(dmaSFR, asclin->dma.txDmaChannelId);
+        IfxDma_disableChannelTransaction(dmaSFR, asclin->dma.rxDmaChannelId);
+
+        asclin->txJob.pending      = 0;
+        asclin->rxJob.pending      = 0;
+        asclin->transferInProgress = 0; /* clearing the transfer in progress status */
+        IfxAsclin_Spi_unlock(asclin);   /* unlock the driver */
+    }
+}
+
+
 void IfxAsclin_Spi_isrError(IfxAsclin_Spi *asclin)
 {
     Ifx_ASCLIN *asclinSFR = asclin->asclin; /* getting the pointer to ASCLIN registers from module handler */
@@ -353,6 +489,37 @@ IFX_STATIC IfxAsclin_Spi_Status IfxAsclin_Spi_lock(IfxAsclin_Spi *asclin)
 }
 
 
+IfxAsclin_Spi_Status IfxAsclin_Spi_queueJob(IfxAsclin_Spi_QueuedJob *job)
+{
+    IfxAsclin_Spi          *asclin         = job->spi;
+    IfxAsclin_Spi_JobQueue *queue          = &asclin->queue;
+    boolean                 interruptState = IfxCpu_disableInterrupts();
+
+    job->next = NULL_PTR;
+    job->done = FALSE;
+
+    if (queue->last == NULL_PTR)
+    {
+        queue->first = job;
+    }
+    else
+    {
+        queue->last->next = job;
+    }
+
+    queue->last = job;
+
+    if (queue->active == NULL_PTR)
+    {
+        IfxAsclin_Spi_startJob(asclin);
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return IfxAsclin_Spi_Status_ok;
+}
+
+
 void IfxAsclin_Spi_read(IfxAsclin_Spi *asclin)
 {
     Ifx_ASCLIN        *asclinSFR = asclin->asclin;                                  /* getting the pointer to ASCLIN registers from module handler */
@@ -398,9 +565,157 @@ void IfxAsclin_Spi_read(IfxAsclin_Spi *asclin)
 }
 
 
+IFX_STATIC void IfxAsclin_Spi_setDataLength(IfxAsclin_Spi *asclin, IfxAsclin_DataLength dataLength)
+{
+    Ifx_ASCLIN *asclinSFR = asclin->asclin;
+
+    IfxAsclin_setDataLength(asclinSFR, dataLength);
+
+    if (dataLength <= IfxAsclin_DataLength_8)
+    {
+        IfxAsclin_setTxFifoInletWidth(asclinSFR, IfxAsclin_TxFifoInletWidth_1);
+        IfxAsclin_setRxFifoOutletWidth(asclinSFR, IfxAsclin_RxFifoOutletWidth_1);
+        asclin->dataWidth = 1;
+    }
+    else
+    {
+        IfxAsclin_setTxFifoInletWidth(asclinSFR, IfxAsclin_TxFifoInletWidth_2);
+        IfxAsclin_setRxFifoOutletWidth(asclinSFR, IfxAsclin_RxFifoOutletWidth_2);
+        asclin->dataWidth = 2;
+    }
+}
+
+
+void IfxAsclin_Spi_setJobCallback(IfxAsclin_Spi_QueuedJob *job, IfxAsclin_Spi_JobCallback callback, void *data)
+{
+    job->callback = callback;
+    job->data     = data;
+}
+
+
+void IfxAsclin_Spi_setJobDataWidth(IfxAsclin_Spi_QueuedJob *job, uint8 dataWidth)
+{
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (dataWidth >= 1) && (dataWidth <= 16));
+    job->dataLength = (IfxAsclin_DataLength)(dataWidth - 1);
+}
+
+
+IFX_STATIC void IfxAsclin_Spi_startDma(IfxAsclin_Spi *asclin)
+{
+    Ifx_DMA               *dmaSFR         = &MODULE_DMA;
+    Ifx_ASCLIN            *asclinSFR      = asclin->asclin;
+    IfxDma_ChannelId       txDmaChannelId = asclin->dma.txDmaChannelId;
+    IfxDma_ChannelId       rxDmaChannelId = asclin->dma.rxDmaChannelId;
+    uint32                 count          = asclin->rxJob.pending;
+    IfxDma_ChannelMoveSize moveSize       = (asclin->dataWidth == 1) ? IfxDma_ChannelMoveSize_8bit : IfxDma_ChannelMoveSize_16bit;
+    boolean                interruptState = IfxCpu_disableInterrupts();
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (count != 0) && (count <= 16383));
+
+    /* transmit */
+    IfxDma_setChannelTransferCount(dmaSFR, txDmaChannelId, count);
+    IfxDma_setChannelMoveSize(dmaSFR, txDmaChannelId, moveSize);
+
+    if (asclin->txJob.data == NULL_PTR)
+    {
+        IfxDma_setChannelSourceAddress(dmaSFR, txDmaChannelId, (void *)IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), &IfxAsclin_Spi_dummyTxValue));
+        IfxDma_setChannelSourceIncrementStep(dmaSFR, txDmaChannelId, IfxDma_ChannelIncrementStep_1,
+            IfxDma_ChannelIncrementDirection_positive, IfxDma_ChannelIncrementCircular_none);
+        dmaSFR->CH[txDmaChannelId].ADICR.B.SCBE = TRUE;     /* fixed source */
+    }
+    else
+    {
+        IfxCpu_flushDataCache(asclin->txJob.data, count * asclin->dataWidth);
+        IfxDma_setChannelSourceAddress(dmaSFR, txDmaChannelId, (void *)IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), asclin->txJob.data));
+        IfxDma_setChannelSourceIncrementStep(dmaSFR, txDmaChannelId, IfxDma_ChannelIncrementStep_1,
+            IfxDma_ChannelIncrementDirection_positive, IfxDma_ChannelIncrementCircular_none);
+        dmaSFR->CH[txDmaChannelId].ADICR.B.SCBE = FALSE;
+    }
+
+    /* receive */
+    IfxDma_setChannelTransferCount(dmaSFR, rxDmaChannelId, count);
+    IfxDma_setChannelMoveSize(dmaSFR, rxDmaChannelId, moveSize);
+
+    if (asclin->rxJob.data == NULL_PTR)
+    {
+        IfxDma_setChannelDestinationAddress(dmaSFR, rxDmaChannelId, (void *)IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), &IfxAsclin_Spi_dummyRxValue));
+        IfxDma_setChannelDestinationIncrementStep(dmaSFR, rxDmaChannelId, IfxDma_ChannelIncrementStep_1,
+            IfxDma_ChannelIncrementDirection_positive, IfxDma_ChannelIncrementCircular_none);
+        dmaSFR->CH[rxDmaChannelId].ADICR.B.DCBE = TRUE;     /* fixed destination */
+    }
+    else
+    {
+        IfxCpu_flushDataCache(asclin->rxJob.data, count * asclin->dataWidth);
+        IfxDma_setChannelDestinationAddress(dmaSFR, rxDmaChannelId, (void *)IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), asclin->rxJob.data));
+        IfxDma_setChannelDestinationIncrementStep(dmaSFR, rxDmaChannelId, IfxDma_ChannelIncrementStep_1,
+            IfxDma_ChannelIncrementDirection_positive, IfxDma_ChannelIncrementCircular_none);
+        dmaSFR->CH[rxDmaChannelId].ADICR.B.DCBE = FALSE;
+    }
+
+    IfxAsclin_clearRxFifoFillLevelFlag(asclinSFR);
+    IfxAsclin_clearTxFifoFillLevelFlag(asclinSFR);
+    IfxSrc_clearRequest(IfxAsclin_getSrcPointerRx(asclinSFR));
+    IfxSrc_clearRequest(IfxAsclin_getSrcPointerTx(asclinSFR));
+    IfxDma_clearChannelInterrupt(dmaSFR, rxDmaChannelId);
+    IfxDma_enableChannelTransaction(dmaSFR, rxDmaChannelId);
+    IfxDma_enableChannelTransaction(dmaSFR, txDmaChannelId);
+
+    /* the Tx FIFO is empty: the first data is requested by software, the next ones by the FIFO level */
+    IfxDma_startChannelTransaction(dmaSFR, txDmaChannelId);
+
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+
+IFX_STATIC void IfxAsclin_Spi_startJob(IfxAsclin_Spi *asclin)
+{
+    IfxAsclin_Spi_JobQueue  *queue = &asclin->queue;
+    IfxAsclin_Spi_QueuedJob *job   = queue->first;
+
+    /* a direct exchange in progress starts the queue on its completion */
+    if ((job != NULL_PTR) && (asclin->sending == 0))
+    {
+        queue->first = job->next;
+
+        if (queue->first == NULL_PTR)
+        {
+            queue->last = NULL_PTR;
+        }
+
+        queue->active     = job;
+        queue->dataLength = (IfxAsclin_DataLength)asclin->asclin->DATCON.B.DATLEN;
+
+        IfxAsclin_Spi_setDataLength(asclin, job->dataLength);
+        IfxAsclin_Spi_exchange(asclin, (void *)job->src, job->dest, job->count);
+    }
+}
+
+
 IFX_STATIC void IfxAsclin_Spi_unlock(IfxAsclin_Spi *asclin)
 {
+    IfxAsclin_Spi_JobQueue  *queue = &asclin->queue;
+    IfxAsclin_Spi_QueuedJob *job   = queue->active;
+
     asclin->sending = 0UL;
+
+    if (job != NULL_PTR)
+    {
+        /* restore the module settings for direct exchanges */
+        IfxAsclin_Spi_setDataLength(asclin, queue->dataLength);
+        queue->active = NULL_PTR;
+        job->done     = TRUE;
+
+        if (job->callback != NULL_PTR)
+        {
+            job->callback(job);
+        }
+    }
+
+    /* the callback may already have started the next job */
+    if (queue->active == NULL_PTR)
+    {
+        IfxAsclin_Spi_startJob(asclin);
+    }
 }
 
 
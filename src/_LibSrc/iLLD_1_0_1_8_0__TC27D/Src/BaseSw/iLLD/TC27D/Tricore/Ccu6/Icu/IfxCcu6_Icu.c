@@ -29,10 +29,113 @@
 
 #include "IfxCcu6_Icu.h"
 
+/******************************************************************************/
+/*-----------------------Private Function Prototypes--------------------------*/
+/******************************************************************************/
+
+/** \brief Returns the frequency of the T12 ticks
+ * \param ccu6 Pointer to the base of CCU6 registers
+ * \return T12 tick frequency in Hz
+ */
+IFX_STATIC float32 IfxCcu6_Icu_getT12TickFrequency(Ifx_CCU6 *ccu6);
+
+/** \brief Initialises the DMA capture ring of the channel
+ * \param channel Channel handle
+ * \param channelConfig Configuration structure of the channel
+ * \return None
+ */
+IFX_STATIC void IfxCcu6_Icu_initDma(IfxCcu6_Icu_Channel *channel, const IfxCcu6_Icu_ChannelConfig *channelConfig);
+
+/** \brief Initialises a DMA channel storing the captures of one edge, and routes its service request
+ * \param dmaChannel DMA channel handle
+ * \param channelConfig Configuration structure of the channel
+ * \param channelId DMA channel
+ * \param source Interrupt source of the capture event
+ * \param serviceRequest Service request output of the capture event
+ * \param captureRegister Address of the capture register
+ * \param destination Address of the member of the first capture of the ring
+ * \return None
+ */
+IFX_STATIC void IfxCcu6_Icu_initDmaChannel(IfxDma_Dma_Channel *dmaChannel, const IfxCcu6_Icu_ChannelConfig *channelConfig, IfxDma_ChannelId channelId, IfxCcu6_InterruptSource source, IfxCcu6_ServiceRequest serviceRequest, uint32 captureRegister, uint32 destination);
+
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
 
+boolean IfxCcu6_Icu_getDmaMeasurement(IfxCcu6_Icu_Channel *channel, IfxCcu6_Icu_Measurement *measurement, uint16 maxPeriods)
+{
+    IfxCcu6_Icu_Dma                    *dma        = &channel->dma;
+    const volatile IfxCcu6_Icu_Capture *captures   = dma->buffer;
+    uint16                              mask       = dma->length - 1;
+    uint16                              writeIndex = (uint16)((dma->length - IfxDma_getChannelTransferCount(dma->risingChannel.dma, dma->risingChannel.channelId)) & mask);
+    uint16                              lastRising;
+    uint16                              available;
+    uint16                              periods;
+    uint16                              i;
+    uint32                              periodSum  = 0;
+    uint32                              highSum    = 0;
+    boolean                             fallingLeads;
+
+    if ((dma->started == FALSE) && (writeIndex == 0))
+    {
+        return FALSE;   /* no rising edge yet */
+    }
+
+    dma->started = TRUE;
+    lastRising   = (uint16)((writeIndex - 1) & mask);
+    available    = (uint16)((lastRising - dma->readIndex) & mask);
+
+    if (available == 0)
+    {
+        return FALSE;   /* no new period */
+    }
+
+    periods = available;
+    periods = (periods > maxPeriods) ? maxPeriods : periods;
+    periods = (periods > (dma->length - 2)) ? (dma->length - 2) : periods;
+
+    /* if the capture started with the input high, the falling edge of a period is stored with the next rising edge */
+    {
+        uint16 start = (uint16)((lastRising - 1) & mask);
+        uint16 high  = (uint16)(captures[start].falling - captures[start].rising);
+        fallingLeads = (high > (uint16)(captures[lastRising].rising - captures[start].rising)) ? TRUE : FALSE;
+    }
+
+    for (i = 0; i < periods; i++)
+    {
+        uint16 end     = (uint16)((lastRising - i) & mask);
+        uint16 start   = (uint16)((end - 1) & mask);
+        uint16 falling = (fallingLeads != FALSE) ? captures[end].falling : captures[start].falling;
+
+        periodSum += (uint16)(captures[end].rising - captures[start].rising);
+        highSum   += (uint16)(falling - captures[start].rising);
+    }
+
+    dma->readIndex         = lastRising;
+
+    measurement->periods   = periods;
+    measurement->period    = (float32)periodSum / periods;
+    measurement->highTime  = (float32)highSum / periods;
+    measurement->frequency = (periodSum != 0) ? (IfxCcu6_Icu_getT12TickFrequency(channel->ccu6) / measurement->period) : 0.0;
+    measurement->dutyCycle = (periodSum != 0) ? ((float32)highSum / periodSum) : 0.0;
+
+    return TRUE;
+}
+
+
+IFX_STATIC float32 IfxCcu6_Icu_getT12TickFrequency(Ifx_CCU6 *ccu6)
+{
+    float32 frequency = IfxScuCcu_getSpbFrequency() / (1U << ccu6->TCTR0.B.T12CLK);
+
+    if (ccu6->TCTR0.B.T12PRE != 0)
+    {
+        frequency = frequency / 256;
+    }
+
+    return frequency;
+}
+
+
 uint32 IfxCcu6_Icu_getTimeStamp(IfxCcu6_Icu_Channel *channel)
 {
     uint32 timeStamp = 0;
@@ -163,6 +266,10 @@ void IfxCcu6_Icu_initChannel(IfxCcu6_Icu_Channel *channel, const IfxCcu6_Icu_Cha
     channel->channelId   = channelConfig->channelId;
     channel->channelMode = channelConfig->channelMode;
 
+    /* -- DMA capture ring initialisation -- */
+
+    IfxCcu6_Icu_initDma(channel, channelConfig);
+
 #if IFX_CFG_USE_STANDARD_INTERFACE
     IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (uint32)icu == ((uint32)&icu->base));
     icu->base.functions.startCapture = (Icu_StartCapture) & IfxCcu6_Icu_startCapture;
@@ -205,6 +312,92 @@ void IfxCcu6_Icu_initChannelConfig(IfxCcu6_Icu_ChannelConfig *channelConfig, Ifx
     channelConfig->pins                        = NULL_PTR;
 
     channelConfig->multiInputCaptureEnabled    = FALSE;
+
+    channelConfig->dma.dma                     = NULL_PTR;
+    channelConfig->dma.risingChannelId         = IfxDma_ChannelId_none;
+    channelConfig->dma.fallingChannelId        = IfxDma_ChannelId_none;
+    channelConfig->dma.risingServiceRequest    = IfxCcu6_ServiceRequest_2;
+    channelConfig->dma.fallingServiceRequest   = IfxCcu6_ServiceRequest_3;
+    channelConfig->dma.buffer                  = NULL_PTR;
+    channelConfig->dma.length                  = 0;
+}
+
+
+IFX_STATIC void IfxCcu6_Icu_initDma(IfxCcu6_Icu_Channel *channel, const IfxCcu6_Icu_ChannelConfig *channelConfig)
+{
+    const IfxCcu6_Icu_DmaConfig *config = &channelConfig->dma;
+    IfxCcu6_Icu_Dma             *dma    = &channel->dma;
+    Ifx_CCU6                    *ccu6   = channelConfig->ccu6;
+
+    dma->enabled   = (config->dma != NULL_PTR) ? TRUE : FALSE;
+    dma->buffer    = config->buffer;
+    dma->length    = config->length;
+    dma->readIndex = 0;
+    dma->started   = FALSE;
+
+    if (dma->enabled != FALSE)
+    {
+        IfxCcu6_InterruptSource risingSource  = (IfxCcu6_InterruptSource)(IfxCcu6_InterruptSource_cc60RisingEdge + (2 * channelConfig->channelId));
+        IfxCcu6_InterruptSource fallingSource = (IfxCcu6_InterruptSource)(IfxCcu6_InterruptSource_cc60FallingEdge + (2 * channelConfig->channelId));
+
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, channelConfig->channelMode == IfxCcu6_T12ChannelMode_doubleRegisterCaptureRisingAndFalling);
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->risingChannelId > IfxDma_ChannelId_0) && (config->fallingChannelId > IfxDma_ChannelId_0)); /* priority 0 does not trigger the DMA */
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->length >= 4) && (config->length <= 8192) && ((config->length & (config->length - 1)) == 0));
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((uint32)config->buffer & ((config->length * sizeof(IfxCcu6_Icu_Capture)) - 1)) == 0);
+
+        /* full 16 bit range, the differences of the time stamps are then modulo 65536 */
+        IfxCcu6_setT12PeriodValue(ccu6, 0xFFFF);
+
+        /* rising edge: T12 stored in CC6xR, falling edge: T12 stored in CC6xSR */
+        IfxCcu6_Icu_initDmaChannel(&dma->risingChannel, channelConfig, config->risingChannelId, risingSource, config->risingServiceRequest,
+            (uint32)(&ccu6->CC60R.U + channelConfig->channelId), IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), &config->buffer[0].rising));
+        IfxCcu6_Icu_initDmaChannel(&dma->fallingChannel, channelConfig, config->fallingChannelId, fallingSource, config->fallingServiceRequest,
+            (uint32)(&ccu6->CC60SR.U + channelConfig->channelId), IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), &config->buffer[0].falling));
+    }
+}
+
+
+IFX_STATIC void IfxCcu6_Icu_initDmaChannel(IfxDma_Dma_Channel *dmaChannel, const IfxCcu6_Icu_ChannelConfig *channelConfig, IfxDma_ChannelId channelId, IfxCcu6_InterruptSource source, IfxCcu6_ServiceRequest serviceRequest, uint32 captureRegister, uint32 destination)
+{
+    const IfxCcu6_Icu_DmaConfig    *config        = &channelConfig->dma;
+    uint32                          ringSize      = config->length * sizeof(IfxCcu6_Icu_Capture);
+    IfxDma_ChannelIncrementCircular circularRange = IfxDma_ChannelIncrementCircular_2;
+
+    /* the ring is the circular range of the destination address */
+    while ((1UL << circularRange) < ringSize)
+    {
+        circularRange++;
+    }
+
+    IfxDma_Dma_ChannelConfig dmaConfig;
+    IfxDma_Dma_initChannelConfig(&dmaConfig, config->dma);
+
+    /* 16 bit time stamp, one capture (2 time stamps) further for each move */
+    dmaConfig.channelId                        = channelId;
+    dmaConfig.sourceAddress                    = captureRegister;
+    dmaConfig.sourceAddressCircularRange       = IfxDma_ChannelIncrementCircular_none;
+    dmaConfig.sourceCircularBufferEnabled      = TRUE;
+    dmaConfig.destinationAddress               = destination;
+    dmaConfig.destinationAddressIncrementStep  = IfxDma_ChannelIncrementStep_2;
+    dmaConfig.destinationAddressCircularRange  = circularRange;
+    dmaConfig.destinationCircularBufferEnabled = TRUE;
+    dmaConfig.transferCount                    = config->length;
+    dmaConfig.moveSize                         = IfxDma_ChannelMoveSize_16bit;
+    dmaConfig.blockMode                        = IfxDma_ChannelMove_1;
+    dmaConfig.requestMode                      = IfxDma_ChannelRequestMode_oneTransferPerRequest;
+    dmaConfig.operationMode                    = IfxDma_ChannelOperationMode_continuous;
+    dmaConfig.hardwareRequestEnabled           = TRUE;
+
+    IfxDma_Dma_initChannel(dmaChannel, &dmaConfig);
+
+    /* capture event to the DMA channel */
+    IfxCcu6_enableInterrupt(channelConfig->ccu6, source);
+    IfxCcu6_routeInterruptNode(channelConfig->ccu6, source, serviceRequest);
+
+    volatile Ifx_SRC_SRCR *src;
+    src = IfxCcu6_getSrcAddress(channelConfig->ccu6, serviceRequest);
+    IfxSrc_init(src, IfxSrc_Tos_dma, (Ifx_Priority)channelId);
+    IfxSrc_enable(src);
 }
 
 
@@ -28,6 +28,18 @@
 /******************************************************************************/
 
 #include "IfxCcu6_PwmBc.h"
+#include "IfxCcu6_bf.h"
+
+/******************************************************************************/
+/*-----------------------Private Function Prototypes--------------------------*/
+/******************************************************************************/
+
+/** \brief Initialises the DMA linked list writing MCMOUTS on each multi-channel shadow transfer
+ * \param pwmBc Module handle
+ * \param config Configuration structure of the module
+ * \return None
+ */
+IFX_STATIC void IfxCcu6_PwmBc_initDma(IfxCcu6_PwmBc *pwmBc, const IfxCcu6_PwmBc_Config *config);
 
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
@@ -35,15 +47,21 @@
 
 uint32 IfxCcu6_PwmBc_getMotorSpeed(IfxCcu6_PwmBc *pwmBc)
 {
-    uint32  currentTime, previousTime;
-    float32 speed;
+    uint32 hallPeriod;
+    uint32 elapsed;
+    uint32 speed = 0;
 
-    currentTime  = IfxCcu6_getCaptureRegisterValue(pwmBc->ccu6, IfxCcu6_T12Channel_0);
-    previousTime = IfxCcu6_getCaptureShadowRegisterValue(pwmBc->ccu6, IfxCcu6_T12Channel_0);
+    /* CC60R: T12 captured on the last correct hall event, T12 is reset on each correct hall event */
+    hallPeriod = IfxCcu6_getCaptureRegisterValue(pwmBc->ccu6, IfxCcu6_T12Channel_0);
+    elapsed    = pwmBc->ccu6->T12.B.T12CV;
+    hallPeriod = __maxu(hallPeriod, elapsed);
+
+    if (hallPeriod != 0)
+    {
+        /* 6 hall edges per electrical revolution */
+        speed = (uint32)((pwmBc->t12ClockFrequency * (60.0F / IFXCCU6_PWMBC_NUM_HALL_PATTERNS)) / (float32)hallPeriod);
+    }
 
-    // TODO -- FIX IT --
-    speed = (currentTime - previousTime) * (6 / (pwmBc->base.t13Frequency));
-    speed = speed * 60 * 100000;    //convertion to RPM (minutes),
     return speed;
 }
 
@@ -96,7 +114,8 @@ void IfxCcu6_PwmBc_initModule(IfxCcu6_PwmBc *pwmBc, const IfxCcu6_PwmBc_Config *
 
     // clock initialisation //
 
-    IfxCcu6_setT12Frequency(ccu6SFR, config->base.t12Frequency, config->base.t12Period, config->timer12.countMode);
+    pwmBc->base.t12Frequency = IfxCcu6_setT12Frequency(ccu6SFR, config->base.t12Frequency, config->base.t12Period, config->timer12.countMode);
+    pwmBc->t12ClockFrequency = IfxScuCcu_getSpbFrequency() / (float32)(1U << (ccu6SFR->TCTR0.B.T12CLK + (ccu6SFR->TCTR0.B.T12PRE * 8)));
 
     // duty cycle initialisation //
 
@@ -302,6 +321,14 @@ void IfxCcu6_PwmBc_initModule(IfxCcu6_PwmBc *pwmBc, const IfxCcu6_PwmBc_Config *
 
     pwmBc->trigger          = config->trigger;
     pwmBc->hallPatternIndex = 0;
+    pwmBc->dmaBuffer        = NULL_PTR;
+
+    /* -- hardware commutation -- */
+
+    if (config->dma.useDma != FALSE)
+    {
+        IfxCcu6_PwmBc_initDma(pwmBc, config);
+    }
 
 #if IFX_CFG_USE_STANDARD_INTERFACE
     IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (uint32)pwmBc == ((uint32)&pwmBc->base));
@@ -313,6 +340,70 @@ void IfxCcu6_PwmBc_initModule(IfxCcu6_PwmBc *pwmBc, const IfxCcu6_PwmBc_Config *
 }
 
 
+IFX_STATIC void IfxCcu6_PwmBc_initDma(IfxCcu6_PwmBc *pwmBc, const IfxCcu6_PwmBc_Config *config)
+{
+    Ifx_CCU6                *ccu6   = pwmBc->ccu6;
+    IfxCcu6_PwmBc_DmaBuffer *buffer = config->dma.buffer;
+    uint8 (*table)[3]               = config->dma.controlTable;
+    uint32                   coreId = IfxCpu_getCoreId();
+    uint32                   index;
+    Ifx_CCU6_MCMOUTS         mcmouts;
+    IfxDma_Dma               dma;
+    IfxDma_Dma_ChannelConfig dmaCfg;
+    volatile Ifx_SRC_SRCR   *src;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((uint32)buffer & 0x1F) == 0);
+
+    /* MCMOUTS values, the rows must follow each other in the order of rotation */
+    for (index = 0; index < IFXCCU6_PWMBC_NUM_HALL_PATTERNS; index++)
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, table[index][1] == table[(index + 1) % IFXCCU6_PWMBC_NUM_HALL_PATTERNS][0]);
+        mcmouts.U              = 0;
+        mcmouts.B.CURHS        = table[index][0];
+        mcmouts.B.EXPHS        = table[index][1];
+        mcmouts.B.MCMPS        = table[index][2];
+        buffer->mcmouts[index] = mcmouts.U;
+    }
+
+    pwmBc->dmaBuffer = buffer;
+
+    IfxDma_Dma_createModuleHandle(&dma, &MODULE_DMA);
+    IfxDma_Dma_initChannelConfig(&dmaCfg, &dma);
+
+    dmaCfg.channelId                       = config->dma.channelId;
+    dmaCfg.transferCount                   = 1;
+    dmaCfg.requestMode                     = IfxDma_ChannelRequestMode_completeTransactionPerRequest;
+    dmaCfg.operationMode                   = IfxDma_ChannelOperationMode_continuous;
+    dmaCfg.moveSize                        = IfxDma_ChannelMoveSize_32bit;
+    dmaCfg.blockMode                       = IfxDma_ChannelMove_1;
+    dmaCfg.sourceAddressCircularRange      = IfxDma_ChannelIncrementCircular_none;
+    dmaCfg.destinationAddressCircularRange = IfxDma_ChannelIncrementCircular_none;
+    dmaCfg.destinationAddress              = (uint32)&ccu6->MCMOUTS;
+    dmaCfg.shadowControl                   = IfxDma_ChannelShadow_linkedList;
+    dmaCfg.hardwareRequestEnabled          = TRUE;
+
+    /* One entry per hall pattern, each entry waits for the next shadow transfer, the last entry loads the first one again */
+    for (index = IFXCCU6_PWMBC_NUM_HALL_PATTERNS; index > 0; index--)
+    {
+        dmaCfg.sourceAddress = IFXCPU_GLB_ADDR_DSPR(coreId, &buffer->mcmouts[index - 1]);
+        dmaCfg.shadowAddress = IFXCPU_GLB_ADDR_DSPR(coreId, &buffer->descriptors[index % IFXCCU6_PWMBC_NUM_HALL_PATTERNS]);
+        IfxDma_Dma_initLinkedListEntry(&buffer->descriptors[index - 1], &dmaCfg);
+        buffer->descriptors[index - 1].CHCSR.U = 0;
+    }
+
+    /* dmaCfg holds the first entry, IfxCcu6_PwmBc_syncCommutation() selects the actual one */
+    IfxDma_Dma_initChannel(&pwmBc->dmaChannel, &dmaCfg);
+
+    /* The multi-channel shadow transfer interrupt uses the CHE node */
+    ccu6->INP.B.INPCHE = config->dma.serviceRequest;
+    src                = IfxCcu6_getSrcAddress(ccu6, config->dma.serviceRequest);
+    IfxSrc_init(src, IfxSrc_Tos_dma, (Ifx_Priority)config->dma.channelId);
+    IfxSrc_enable(src);
+
+    IfxCcu6_enableMultiChannelMode(ccu6);
+}
+
+
 void IfxCcu6_PwmBc_initModuleConfig(IfxCcu6_PwmBc_Config *config, Ifx_CCU6 *ccu6)
 {
     const IfxCcu6_PwmBc_Config defaultConfig = {
@@ -388,6 +479,14 @@ void IfxCcu6_PwmBc_initModuleConfig(IfxCcu6_PwmBc_Config *config, Ifx_CCU6 *ccu6
             .outputLine             = IfxCcu6_TrigOut_0,
             .outputTrigger          = IfxCcu6_TrigSel_cout63,
         },
+
+        .dma                        = {
+            .useDma         = FALSE,
+            .channelId      = IfxDma_ChannelId_none,
+            .serviceRequest = IfxCcu6_ServiceRequest_1,
+            .buffer         = NULL_PTR,
+            .controlTable   = NULL_PTR,
+        },
     };
 
     /* Default Configuration */
@@ -400,6 +499,12 @@ void IfxCcu6_PwmBc_initModuleConfig(IfxCcu6_PwmBc_Config *config, Ifx_CCU6 *ccu6
 
 void IfxCcu6_PwmBc_start(IfxCcu6_PwmBc *pwmBc)
 {
+    // load the pattern of the actual hall inputs
+    if (pwmBc->dmaBuffer != NULL_PTR)
+    {
+        IfxCcu6_PwmBc_syncCommutation(pwmBc);
+    }
+
     // enable shadow transfers
     IfxCcu6_enableShadowTransfer(pwmBc->ccu6, TRUE, TRUE);
 
@@ -489,6 +594,55 @@ void IfxCcu6_PwmBc_stop(IfxCcu6_PwmBc *pwmBc)
 }
 
 
+boolean IfxCcu6_PwmBc_syncCommutation(IfxCcu6_PwmBc *pwmBc)
+{
+    Ifx_CCU6                *ccu6   = pwmBc->ccu6;
+    IfxCcu6_PwmBc_DmaBuffer *buffer = pwmBc->dmaBuffer;
+    Ifx_DMA_CH              *dmaCh  = pwmBc->dmaChannel.channel;
+    uint32                   hall   = (ccu6->CMPSTAT.U >> IFX_CCU6_CMPSTAT_CCPOS60_OFF) & 0x7U;
+    uint32                   index;
+    boolean                  result = FALSE;
+    Ifx_CCU6_MCMOUTS         mcmouts;
+
+    for (index = 0; index < IFXCCU6_PWMBC_NUM_HALL_PATTERNS; index++)
+    {
+        mcmouts.U = buffer->mcmouts[index];
+
+        if (mcmouts.B.CURHS == hall)
+        {
+            result = TRUE;
+            break;
+        }
+    }
+
+    if (result != FALSE)
+    {
+        uint32 next  = (index + 1) % IFXCCU6_PWMBC_NUM_HALL_PATTERNS;
+        uint32 after = (index + 2) % IFXCCU6_PWMBC_NUM_HALL_PATTERNS;
+
+        /* No DMA request for the transfers below */
+        ccu6->IEN.B.ENSTR = 0;
+
+        /* Actual row applied immediately, next row in the shadow register */
+        mcmouts.B.STRHP  = 1;
+        mcmouts.B.STRMCM = 1;
+        ccu6->MCMOUTS.U  = mcmouts.U;
+        ccu6->MCMOUTS.U  = buffer->mcmouts[next];
+
+        /* The DMA continues with the row after, same entry as the linked list one */
+        IfxDma_clearChannelTransactionRequestLost(pwmBc->dmaChannel.dma, pwmBc->dmaChannel.channelId);
+        dmaCh->SADR.U  = buffer->descriptors[after].SADR.U;
+        dmaCh->SHADR.U = buffer->descriptors[after].SHADR.U;
+
+        pwmBc->hallPatternIndex = (uint8)index;
+        ccu6->ISR.U             = 1U << IFX_CCU6_ISR_RSTR_OFF;
+        ccu6->IEN.B.ENSTR       = 1;
+    }
+
+    return result;
+}
+
+
 void IfxCcu6_PwmBc_updateHallPattern(IfxCcu6_PwmBc *pwmBc, uint8 controlTable[6][3])
 {
     uint8 index = pwmBc->hallPatternIndex;
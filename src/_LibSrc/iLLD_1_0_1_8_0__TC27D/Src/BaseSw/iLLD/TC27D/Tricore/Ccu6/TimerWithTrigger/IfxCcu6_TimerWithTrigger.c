@@ -260,6 +260,34 @@ boolean IfxCcu6_TimerWithTrigger_init(IfxCcu6_TimerWithTrigger *driver, IfxCcu6_
 }
 
 
+boolean IfxCcu6_TimerWithTrigger_initAdcTrigger(IfxCcu6_TimerWithTrigger *driver, IfxCcu6_TrigOut outputLine, sint32 firstOffset, sint32 secondOffset)
+{
+    boolean result = driver->base.triggerEnabled;
+
+    /* T13 must have been configured as trigger timer by IfxCcu6_TimerWithTrigger_init() */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, result);
+
+    if (result)
+    {
+        result = IfxCcu6_TimerWithTrigger_setAdcTriggerOffsets(driver, firstOffset, secondOffset);
+    }
+    else
+    {}
+
+    if (result)
+    {
+        IfxCcu6_connectTrigger(driver->ccu6, outputLine, IfxCcu6_TrigSel_cout63);
+
+        /* Transfer the shadow registers */
+        IfxCcu6_TimerWithTrigger_applyUpdate(driver);
+    }
+    else
+    {}
+
+    return result;
+}
+
+
 void IfxCcu6_TimerWithTrigger_initConfig(IfxCcu6_TimerWithTrigger_Config *config, Ifx_CCU6 *ccu6)
 {
     IfxStdIf_Timer_initConfig(&config->base);
@@ -276,6 +304,27 @@ void IfxCcu6_TimerWithTrigger_run(IfxCcu6_TimerWithTrigger *driver)
 }
 
 
+boolean IfxCcu6_TimerWithTrigger_setAdcTriggerOffsets(IfxCcu6_TimerWithTrigger *driver, sint32 firstOffset, sint32 secondOffset)
+{
+    sint32  period = (sint32)driver->base.period;
+    sint32  first  = (period / 2) + firstOffset;
+    sint32  second = (period / 2) + secondOffset;
+    boolean result = (first > 0) && (first < second) && (second < period);
+
+    if (result)
+    {
+        /* T13 is started at T12 zero: COUT63 changes at the CC63 compare match and at the T13 period match,
+         * where the single shot T13 stops until the next PWM period */
+        driver->ccu6->CC63SR.U = (uint32)first;
+        IfxCcu6_setT13PeriodValue(driver->ccu6, (uint16)(second - 1));
+    }
+    else
+    {}
+
+    return result;
+}
+
+
 boolean IfxCcu6_TimerWithTrigger_setFrequency(IfxCcu6_TimerWithTrigger *driver, float32 frequency)
 {
     Ifx_TimerValue period = IfxStdIf_Timer_sToTick(driver->base.clockFreq, 1.0 / frequency);
@@ -26,6 +26,40 @@
  * This driver implements the timer functionalities as defined by \ref library_srvsw_stdif_timer.
  * The user is free to use either the driver specific APIs below or to used the \ref library_srvsw_stdif_timer "standard interface APIs".
  *
+ * \section IfxLld_Ccu6_TimerWithTrigger_AdcTrigger VADC conversion trigger
+ *
+ * The trigger timer T13 can start the VADC conversions at fixed phase offsets relative to the PWM centre, without any
+ * interrupt: T13 is started in single shot mode by T12 zero, its output COUT63 changes at the CC63 compare match
+ * (first offset) and again at the T13 period match (second offset). The signal is routed to one of the CCU6061 TRIGx
+ * lines, which are inputs of the VADC request sources.
+ *
+ * \code
+ *     IfxCcu6_TimerWithTrigger_Config timerConfig;
+ *     IfxCcu6_TimerWithTrigger_initConfig(&timerConfig, &MODULE_CCU60);
+ *     timerConfig.base.frequency       = 20000;
+ *     timerConfig.base.countDir        = IfxStdIf_Timer_CountDir_upAndDown;
+ *     timerConfig.base.trigger.enabled = TRUE;
+ *     IfxCcu6_TimerWithTrigger_init(&timer, &timerConfig);
+ *
+ *     // sample 100 ticks before and 100 ticks after the PWM centre, on CCU6061 TRIG0
+ *     IfxCcu6_TimerWithTrigger_initAdcTrigger(&timer, IfxCcu6_TrigOut_0, -100, 100);
+ * \endcode
+ *
+ * On the VADC side, the scan or queue request source selects the request trigger input connected to CCU6061 TRIG0
+ * (see the REQTRx connection table of the device) and triggers on both edges, one conversion per offset:
+ * \code
+ *     adcGroupConfig.queueRequest.triggerConfig.triggerSource = IfxVadc_TriggerSource_x; // REQTRx connected to CCU6061 TRIG0
+ *     adcGroupConfig.queueRequest.triggerConfig.triggerMode   = IfxVadc_TriggerMode_uponAnyEdge;
+ * \endcode
+ * A single sampling point is obtained by triggering on the edge of the first offset only.
+ *
+ * The offsets follow the operating point at each control cycle, they are written to the shadow registers and
+ * transferred together with the duty cycles:
+ * \code
+ *     IfxCcu6_TimerWithTrigger_setAdcTriggerOffsets(&timer, firstOffset, secondOffset);
+ *     IfxCcu6_TimerWithTrigger_applyUpdate(&timer);
+ * \endcode
+ *
  * \defgroup IfxLld_Ccu6_TimerWithTrigger TimerWithTrigger Interface driver
  * \ingroup IfxLld_Ccu6
  * \defgroup IfxLld_Ccu6_TimerWithTrigger_Data_Structures Data Structures
@@ -267,6 +301,19 @@ IFX_EXTERN volatile uint32 *IfxCcu6_TimerWithTrigger_getPointer(IfxCcu6_TimerWit
  */
 IFX_EXTERN boolean IfxCcu6_TimerWithTrigger_init(IfxCcu6_TimerWithTrigger *driver, IfxCcu6_TimerWithTrigger_Config *config);
 
+/** \brief Initialises the trigger T13 as VADC conversion trigger\n
+ * COUT63 is routed to the CCU6061 trigger line and the offsets are transferred. The trigger must have been enabled with
+ * IfxCcu6_TimerWithTrigger_Config.base.trigger.enabled, and the function is called before the timer is started.
+ * \param driver CCU6 Timer interface Handle
+ * \param outputLine CCU6061 trigger line connected to the VADC request trigger input
+ * \param firstOffset Offset of the first trigger edge relative to the PWM centre in ticks
+ * \param secondOffset Offset of the second trigger edge relative to the PWM centre in ticks
+ * \return TRUE on success else FALSE
+ *
+ * \see IfxLld_Ccu6_TimerWithTrigger_AdcTrigger
+ */
+IFX_EXTERN boolean IfxCcu6_TimerWithTrigger_initAdcTrigger(IfxCcu6_TimerWithTrigger *driver, IfxCcu6_TrigOut outputLine, sint32 firstOffset, sint32 secondOffset);
+
 /** \brief Initializes the configuration structure to default
  * \param config Configuration structure for Timer
  * \param ccu6 Pointer to CCU6 module
@@ -274,6 +321,16 @@ IFX_EXTERN boolean IfxCcu6_TimerWithTrigger_init(IfxCcu6_TimerWithTrigger *drive
  */
 IFX_EXTERN void IfxCcu6_TimerWithTrigger_initConfig(IfxCcu6_TimerWithTrigger_Config *config, Ifx_CCU6 *ccu6);
 
+/** \brief Sets the offsets of the VADC trigger edges relative to the PWM centre\n
+ * The values are written to the T13 shadow registers, they are used from the next PWM period after
+ * IfxCcu6_TimerWithTrigger_applyUpdate(). The PWM centre is half the timer period after T12 zero.
+ * \param driver CCU6 Timer interface Handle
+ * \param firstOffset Offset of the first trigger edge (CC63 compare match) in ticks
+ * \param secondOffset Offset of the second trigger edge (T13 period match) in ticks, must be greater than firstOffset
+ * \return TRUE on success, FALSE if the edges don't fit in the PWM period
+ */
+IFX_EXTERN boolean IfxCcu6_TimerWithTrigger_setAdcTriggerOffsets(IfxCcu6_TimerWithTrigger *driver, sint32 firstOffset, sint32 secondOffset);
+
 /** \} */
 
 #endif /* IFXCCU6_TIMERWITHTRIGGER_H */
@@ -126,6 +126,13 @@ IFX_STATIC void IfxCif_Cam_initCifMemInterface(const IfxCif_Cam *cam, const IfxC
  */
 IFX_STATIC void IfxCif_Cam_initEmem(void);
 
+/** \brief Calls the line callback for the lines written since the last call
+ * \param stream streaming capture handle
+ * \param frameEnd TRUE at the end of the frame: the remaining lines are reported
+ * \return None
+ */
+IFX_STATIC void IfxCif_Cam_reportStreamLines(IfxCif_Cam_Stream *stream, boolean frameEnd);
+
 /** \} */
 
 /******************************************************************************/
@@ -798,6 +805,78 @@ IFX_STATIC IfxCif_Cam_Status IfxCif_Cam_initMemSize(IfxCif_Cam *cam, const IfxCi
 }
 
 
+void IfxCif_Cam_initStreamConfig(IfxCif_Cam_StreamConfig *config, IfxCif_Cam *cam)
+{
+    config->cam                  = cam;
+    config->miInterrupt.priority = 0;
+    config->miInterrupt.provider = IfxSrc_Tos_cpu0;
+    config->linesPerCallback     = 16;
+    config->lineCallback         = NULL_PTR;
+    config->frameCallback        = NULL_PTR;
+    config->callbackData         = NULL_PTR;
+}
+
+
+void IfxCif_Cam_isrStream(IfxCif_Cam_Stream *stream)
+{
+    uint32 flags = MODULE_CIF.MI.MIS.U;
+
+    MODULE_CIF.MI.ICR.U = flags;
+
+    if ((flags & (IFX_CIF_MI_MIS_MP_FRAME_END_MSK << IFX_CIF_MI_MIS_MP_FRAME_END_OFF)) != 0)
+    {
+        uint8 buffer = stream->buffer;
+
+        IfxCif_Cam_reportStreamLines(stream, TRUE);
+        stream->linesReported = 0;
+        stream->buffer        = buffer ^ 1U;
+        stream->frameCount++;
+
+        if (stream->frameCallback != NULL_PTR)
+        {
+            stream->frameCallback(stream->callbackData, buffer, stream->frame[buffer]);
+        }
+    }
+    else
+    {
+        IfxCif_Cam_reportStreamLines(stream, FALSE);
+    }
+}
+
+
+IFX_STATIC void IfxCif_Cam_reportStreamLines(IfxCif_Cam_Stream *stream, boolean frameEnd)
+{
+    uint16 lines = stream->lines;
+
+    if (frameEnd == FALSE)
+    {
+        /* bytes written into the current frame buffer, the ring holds the two buffers */
+        uint32 ringSize = 2 * stream->frameSize;
+        uint32 offset   = IfxCif_getMiMainPictureComponentOffsetCounter(IfxCif_MiMainPicturePathComponents_Y);
+        uint32 written  = (offset + ringSize - (stream->buffer * stream->frameSize)) % ringSize;
+
+        lines = (uint16)(written / stream->lineSize);
+
+        if ((lines - stream->linesReported) < stream->linesPerCallback)
+        {
+            lines = stream->linesReported;
+        }
+    }
+
+    if ((lines > stream->linesReported) && (lines <= stream->lines) && (stream->lineCallback != NULL_PTR))
+    {
+        Ifx_AddressValue address = (Ifx_AddressValue)((uint32)stream->frame[stream->buffer] + (stream->linesReported * stream->lineSize));
+
+        stream->lineCallback(stream->callbackData, stream->buffer, stream->linesReported, lines - stream->linesReported, address);
+    }
+
+    if (lines <= stream->lines)
+    {
+        stream->linesReported = lines;
+    }
+}
+
+
 void IfxCif_Cam_restartCapture(const IfxCif_Cam *cam, uint8 frames)
 {
     (void)cam;
@@ -819,9 +898,82 @@ void IfxCif_Cam_startCapture(const IfxCif_Cam *cam, uint8 frames)
 }
 
 
+IfxCif_Cam_Status IfxCif_Cam_startStream(IfxCif_Cam_Stream *stream, const IfxCif_Cam_StreamConfig *config)
+{
+    IfxCif_Cam               *cam   = config->cam;
+    const IfxCif_Cam_MemInfo *y     = &cam->memAreas.y;
+    volatile Ifx_SRC_SRCR    *srcr  = &SRC_CIFMI;
+    uint32                    bytes = (cam->ispMode == IfxCif_Cam_IspMode_raw) ? cam->ispBpp : 2;
+
+    if ((IfxCif_getMiFeatureEnableState(IfxCif_MiDataPaths_JpegData) == IfxCif_State_Enabled)
+        || (cam->ispMode == IfxCif_Cam_IspMode_yuvPlanar))
+    {
+        return IfxCif_Cam_Status_notAvailable;
+    }
+
+    stream->cam              = cam;
+    stream->lineSize         = y->image.hSize * bytes;
+    stream->lines            = y->image.vSize;
+    stream->frameSize        = stream->lineSize * stream->lines;
+    stream->linesPerCallback = (config->linesPerCallback > 0) ? config->linesPerCallback : 1;
+    stream->linesReported    = 0;
+    stream->buffer           = 0;
+    stream->frameCount       = 0;
+    stream->lineCallback     = config->lineCallback;
+    stream->frameCallback    = config->frameCallback;
+    stream->callbackData     = config->callbackData;
+
+    if ((stream->frameSize % 4) != 0)
+    {
+        /* invalid setting, the MI offset counter works on words */
+        IFXCIF_DEBUG;
+    }
+
+    if ((2 * stream->frameSize) > y->size)
+    {
+        return IfxCif_Cam_Status_notEnoughMemory;
+    }
+
+    /* CPU accesses through the non cached segment, the buffers are rewritten every second frame */
+    stream->frame[0] = (Ifx_AddressValue)(IFXEMEM_START_ADDR_CPU + ((uint32)y->start & 0x00FFFFFFU));
+    stream->frame[1] = (Ifx_AddressValue)((uint32)stream->frame[0] + stream->frameSize);
+
+    /* ring buffer of exactly two frames: the offset counter wraps to the first buffer after the second frame */
+    IfxCif_setMiMainPictureComponentInitSize(IfxCif_MiMainPicturePathComponents_Y, 2 * stream->frameSize);
+    IfxCif_setMiMainPictureComponentInitialOffsetCounter(IfxCif_MiMainPicturePathComponents_Y, 0);
+
+    IfxCif_clearMiInterrupt(IfxCif_MiInterruptSources_MacroBlockLine);
+    IfxCif_clearMiInterrupt(IfxCif_MiInterruptSources_MainPictureFrameEnd);
+    IfxCif_setMiInterruptEnableState(IfxCif_MiInterruptSources_MacroBlockLine, IfxCif_State_Enabled);
+    IfxCif_setMiInterruptEnableState(IfxCif_MiInterruptSources_MainPictureFrameEnd, IfxCif_State_Enabled);
+
+    if (config->miInterrupt.priority > 0)
+    {
+        IfxSrc_init(srcr, (IfxSrc_Tos)config->miInterrupt.provider, config->miInterrupt.priority);
+        IfxSrc_enable(srcr);
+    }
+
+    IfxCif_Cam_startCapture(cam, 0);
+
+    /* the offset counter continues over the frames instead of restarting at the init value */
+    IfxCif_setMiOffsetCounterInitializationEnableState(IfxCif_State_Disabled);
+
+    return IfxCif_Cam_Status_ok;
+}
+
+
 void IfxCif_Cam_stopCapture(const IfxCif_Cam *cam)
 {
     (void)cam;
     IfxCif_setIspOutputState(IfxCif_State_Disabled);
     IfxCif_generateIspImmediateConfigUpdateSignal();
 }
+
+
+void IfxCif_Cam_stopStream(IfxCif_Cam_Stream *stream)
+{
+    IfxCif_Cam_stopCapture(stream->cam);
+    IfxSrc_disable(&SRC_CIFMI);
+    IfxCif_setMiInterruptEnableState(IfxCif_MiInterruptSources_MacroBlockLine, IfxCif_State_Disabled);
+    IfxCif_Cam_clearAllFlags(stream->cam);
+}
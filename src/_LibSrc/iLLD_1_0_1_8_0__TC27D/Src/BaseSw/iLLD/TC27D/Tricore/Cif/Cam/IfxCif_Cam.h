@@ -250,6 +250,52 @@ typedef struct
     IFX_CONST IfxCif_Cam_Downscaling *downscaling;          /**< \brief downscaling settings for ExtraPath 1 */
 } IfxCif_Cam_Config;
 
+/** \brief Callback of the streaming capture for the lines written into the frame buffer
+ * \param data callback data
+ * \param buffer index of the frame buffer (0 or 1)
+ * \param firstLine index of the first line in the frame
+ * \param lineCount number of lines
+ * \param address non cached address of the first line
+ */
+typedef void (*IfxCif_Cam_LineCallback)(void *data, uint8 buffer, uint16 firstLine, uint16 lineCount, Ifx_AddressValue address);
+
+/** \brief Callback of the streaming capture for a complete frame
+ * \param data callback data
+ * \param buffer index of the frame buffer (0 or 1)
+ * \param address non cached address of the frame
+ */
+typedef void (*IfxCif_Cam_FrameCallback)(void *data, uint8 buffer, Ifx_AddressValue address);
+
+/** \brief Streaming capture configuration
+ */
+typedef struct
+{
+    IfxCif_Cam              *cam;                    /**< \brief cam handle, initialised with memFactor >= 2 for the main path and without JPEG */
+    Ifx_IsrSetting           miInterrupt;            /**< \brief MI interrupt (macroblock line and frame end) */
+    uint16                   linesPerCallback;       /**< \brief minimum number of lines reported by the line callback, except at the end of the frame */
+    IfxCif_Cam_LineCallback  lineCallback;           /**< \brief line callback, NULL_PTR if not used */
+    IfxCif_Cam_FrameCallback frameCallback;          /**< \brief frame callback, NULL_PTR if not used */
+    void                    *callbackData;           /**< \brief parameter of the callbacks */
+} IfxCif_Cam_StreamConfig;
+
+/** \brief Streaming capture handle: the main path is written alternately into two frame buffers
+ */
+typedef struct
+{
+    IfxCif_Cam              *cam;                    /**< \brief cam handle */
+    Ifx_AddressValue         frame[2];               /**< \brief non cached addresses of the frame buffers */
+    uint32                   frameSize;              /**< \brief size of a frame in bytes */
+    uint32                   lineSize;               /**< \brief size of a line in bytes */
+    uint16                   lines;                  /**< \brief number of lines of a frame */
+    uint16                   linesPerCallback;       /**< \brief minimum number of lines reported by the line callback */
+    uint16                   linesReported;          /**< \brief number of lines of the current frame already reported */
+    uint8                    buffer;                 /**< \brief frame buffer being written */
+    volatile uint32          frameCount;             /**< \brief number of completed frames */
+    IfxCif_Cam_LineCallback  lineCallback;           /**< \brief line callback */
+    IfxCif_Cam_FrameCallback frameCallback;          /**< \brief frame callback */
+    void                    *callbackData;           /**< \brief parameter of the callbacks */
+} IfxCif_Cam_Stream;
+
 /** \} */
 
 /** \addtogroup IfxLld_Cif_Cam_camFunctions
@@ -408,6 +454,19 @@ IFX_EXTERN boolean IfxCif_Cam_getLastJpegEncodingInfo(IfxCif_Cam *cam, Ifx_Addre
  */
 IFX_EXTERN IfxCif_Cam_Status IfxCif_Cam_init(IfxCif_Cam *cam, const IfxCif_Cam_Config *config, boolean initCam);
 
+/** \brief Fills the streaming capture configuration with default values: callbacks every 16 lines, MI interrupt disabled
+ * \param config streaming capture configuration
+ * \param cam cam handle
+ * \return None
+ */
+IFX_EXTERN void IfxCif_Cam_initStreamConfig(IfxCif_Cam_StreamConfig *config, IfxCif_Cam *cam);
+
+/** \brief MI interrupt handler of the streaming capture: reports the written lines and the complete frames
+ * \param stream streaming capture handle
+ * \return None
+ */
+IFX_EXTERN void IfxCif_Cam_isrStream(IfxCif_Cam_Stream *stream);
+
 /** \brief Restart capture by enabling the ISP output
  * \param cam cam handle
  * \param frames Number of acquisitions. Set to zero for continuous acquisition
@@ -422,12 +481,30 @@ IFX_EXTERN void IfxCif_Cam_restartCapture(const IfxCif_Cam *cam, uint8 frames);
  */
 IFX_EXTERN void IfxCif_Cam_startCapture(const IfxCif_Cam *cam, uint8 frames);
 
+/** \brief Start the continuous streaming capture
+ *
+ * The main path is written alternately into two frame buffers (ping-pong) of the main path area. The MI macroblock
+ * line interrupt reports the lines already in memory, so that a frame can be processed while it is received. A frame
+ * buffer is overwritten one frame after its frame callback. The addresses given to the callbacks are non cached.
+ * \param stream streaming capture handle
+ * \param config streaming capture configuration
+ * \return IfxCif_Cam_Status_notEnoughMemory if the main path area does not hold two frames,
+ * IfxCif_Cam_Status_notAvailable if the JPEG encoder is enabled
+ */
+IFX_EXTERN IfxCif_Cam_Status IfxCif_Cam_startStream(IfxCif_Cam_Stream *stream, const IfxCif_Cam_StreamConfig *config);
+
 /** \brief Stop capture by disabling the ISP output
  * \param cam cam handle
  * \return None
  */
 IFX_EXTERN void IfxCif_Cam_stopCapture(const IfxCif_Cam *cam);
 
+/** \brief Stop the streaming capture
+ * \param stream streaming capture handle
+ * \return None
+ */
+IFX_EXTERN void IfxCif_Cam_stopStream(IfxCif_Cam_Stream *stream);
+
 /** \} */
 
 /******************************************************************************/
@@ -32,6 +32,12 @@
  *
  * \defgroup IfxLld_Cpu_CStart_ConfigEnableCores How to enable CPUs during startup?
  * \ingroup IfxLld_Cpu_CStart
+ *
+ * \defgroup IfxLld_Cpu_CStart_ConfigParallelInit How to initialize the C variables in parallel?
+ * \ingroup IfxLld_Cpu_CStart
+ *
+ * \defgroup IfxLld_Cpu_CStart_ConfigBootTimes How to measure the startup time?
+ * \ingroup IfxLld_Cpu_CStart
  */
 #ifndef IFXCPU_CSTART_H_
 #define IFXCPU_CSTART_H_
@@ -55,12 +61,54 @@
 #ifndef IFX_CFG_CPU_CSTART_PRE_C_INIT_HOOK
 #   define IFX_CFG_CPU_CSTART_PRE_C_INIT_HOOK(cpu) /**< Hook function is empty if not configured*/
 #endif
+
+/** \brief Configuration for the parallel C initialization, see \ref IfxLld_Cpu_CStart_ConfigParallelInit
+ *
+ */
+#ifndef IFX_CFG_CPU_CSTART_PARALLEL_C_INIT
+#   define IFX_CFG_CPU_CSTART_PARALLEL_C_INIT (0)  /**< C variables initialized by CPU0 by default*/
+#endif
+
+/* Only the GNU C startup tables can be split per core. With the other compilers, Ifx_C_Init() on CPU0 would
+ * initialize again the variables of CPU1 / CPU2, including their IfxCpu_CStartX_cInitDone flags, while they run */
+#if (IFX_CFG_CPU_CSTART_PARALLEL_C_INIT != 0) && (defined(__DCC__) || !defined(__GNUC__))
+#error "IFX_CFG_CPU_CSTART_PARALLEL_C_INIT is only supported with the GNU C compiler"
+#endif
+
+/** \brief Configuration for the startup time stamps, see \ref IfxLld_Cpu_CStart_ConfigBootTimes
+ *
+ */
+#ifndef IFX_CFG_CPU_CSTART_BOOT_TIMES
+#   define IFX_CFG_CPU_CSTART_BOOT_TIMES (0)  /**< No startup time stamps by default*/
+#endif
 /******************************************************************************/
 /*                         Exported prototypes                                */
 /******************************************************************************/
 void _Core1_start(void);
 void _Core2_start(void);
 
+#if (IFX_CFG_CPU_CSTART_PARALLEL_C_INIT != 0)
+/** \brief Set by each CPU when its C variables are initialized, located in the DSPR of the CPU */
+IFX_EXTERN volatile uint32 IfxCpu_CStart0_cInitDone;
+IFX_EXTERN volatile uint32 IfxCpu_CStart1_cInitDone;
+IFX_EXTERN volatile uint32 IfxCpu_CStart2_cInitDone;
+#endif
+
+#if (IFX_CFG_CPU_CSTART_BOOT_TIMES != 0)
+/** \brief STM0 time stamps of the CPU0 startup, see \ref IfxLld_Cpu_CStart_ConfigBootTimes */
+typedef struct
+{
+    uint32  start;             /**< \brief STM0 value at _Core0_start() entry: boot software time since reset */
+    uint32  cInit;             /**< \brief STM0 value after the C variables initialization */
+    uint32  clockInit;         /**< \brief STM0 value after the clock system initialization */
+    uint32  main;              /**< \brief STM0 value before core0_main() is called */
+    float32 resetFrequency;    /**< \brief STM frequency before the clock system initialization */
+} IfxCpu_CStart_BootTimes;
+
+/** \brief Time stamps of the CPU0 startup, valid from core0_main() on */
+IFX_EXTERN IfxCpu_CStart_BootTimes IfxCpu_CStart0_bootTimes;
+#endif
+
 /*Documentation */
 
 /** \addtogroup IfxLld_Cpu_CStart_StartupSequence
@@ -257,5 +305,55 @@ void _Core2_start(void);
 
 /** \} */
 
+/** \addtogroup IfxLld_Cpu_CStart_ConfigParallelInit
+ * \{
+ *
+ * By default CPU0 clears and initializes all the C variables before it initializes the clock system and
+ * starts the other CPUs. With IFX_CFG_CPU_CSTART_PARALLEL_C_INIT set to 1, CPU0 starts the other CPUs first and
+ * each CPU initializes the variables located in its own scratchpad (sections .data_cpuX, .bss_cpuX,
+ * .psram_cpuX of the linker files) while CPU0 initializes all the remaining variables and the clock system:
+ *
+ * - CPU0 starts the enabled CPUs, initializes its variables with Ifx_C_InitCore(), sets
+ * IfxCpu_CStart0_cInitDone, initializes the clock system and waits for the other CPUs before core0_main() is called
+ * - CPU1 / CPU2 initialize their variables, set IfxCpu_CStartX_cInitDone and wait for CPU0 before coreX_main()
+ * is called
+ *
+ * The variables of a disabled CPU are initialized by CPU0. Only the GNU C startup tables can be split, the
+ * parallel initialization is refused with an \#error by the other compilers.
+ *
+ * \code
+ * //file: Ifx_Cfg.h
+ *
+ * #define IFX_CFG_CPU_CSTART_PARALLEL_C_INIT (1)   //Each CPU initializes its own scratchpad variables
+ *
+ * \endcode
+ *
+ * The slow peripheral initializations can then be deferred after the time critical ones, see \ref library_srvsw_sysse_general_inittable
+ *
+ */
+
+/** \} */
+
+/** \addtogroup IfxLld_Cpu_CStart_ConfigBootTimes
+ * \{
+ *
+ * With IFX_CFG_CPU_CSTART_BOOT_TIMES set to 1, CPU0 records the STM0 value, which counts from the reset, at the
+ * steps of its startup into \ref IfxCpu_CStart0_bootTimes: _Core0_start() entry, end of the C variables
+ * initialization, end of the clock system initialization and call of core0_main(). The STM frequency changes with
+ * the clock system initialization, the frequency before is recorded too.
+ *
+ * \code
+ * //file: Ifx_Cfg.h
+ *
+ * #define IFX_CFG_CPU_CSTART_BOOT_TIMES (1)   //Record the startup time stamps
+ *
+ * \endcode
+ *
+ * The time stamps are the first records of \ref library_srvsw_sysse_time_bootprofile
+ *
+ */
+
+/** \} */
+
 #endif /*#ifndef IFX_CFG_USE_COMPILER_DEFAULT_LINKER */
 #endif /* IFXCPU_CSTART_H_ */
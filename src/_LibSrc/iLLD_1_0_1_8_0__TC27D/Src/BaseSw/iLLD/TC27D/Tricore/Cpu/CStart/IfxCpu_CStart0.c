@@ -32,6 +32,9 @@
 #include "Cpu/CStart/IfxCpu_CStart.h"
 #include "IfxScu_reg.h"
 #include "IfxCpu_reg.h"
+#if (IFX_CFG_CPU_CSTART_BOOT_TIMES != 0)
+#include "IfxStm_reg.h"
+#endif
 
 /******************************************************************************/
 /*                           Macros                                           */
@@ -50,7 +53,8 @@
 #endif
 
 /** \brief Configuration for cache enable.
- *
+ * The data cache can be enabled when the buffers shared with the DMA are placed with IFX_DMA_BUFFER or in a non
+ * cached segment, or are maintained with IfxCpu_flushDataCache().
  */
 #ifndef IFX_CFG_CPU_CSTART_ENABLE_TRICORE0_PCACHE
 #   define IFX_CFG_CPU_CSTART_ENABLE_TRICORE0_PCACHE (1)  /**< Program Cache enabled by default*/
@@ -80,6 +84,20 @@ __asm("\t .extern core0_main");
 #define IFXCSTART0_PSW_DEFAULT     (0x00000980u)
 #define IFXCSTART0_PCX_O_S_DEFAULT (0xfff00000u)
 
+/** \brief Cores initializing their own C variables in the parallel C initialization */
+#define IFXCSTART0_C_INIT_CORES    (0x1u | ((IFX_CFG_CPU_CSTART_ENABLE_TRICORE1 != 0) ? 0x2u : 0u) | ((IFX_CFG_CPU_CSTART_ENABLE_TRICORE2 != 0) ? 0x4u : 0u))
+
+/*******************************************************************************
+**                      Global Variable Definitions                           **
+*******************************************************************************/
+#if (IFX_CFG_CPU_CSTART_PARALLEL_C_INIT != 0)
+IFX_FAST_DATA_CPU0 volatile uint32 IfxCpu_CStart0_cInitDone = 0;
+#endif
+
+#if (IFX_CFG_CPU_CSTART_BOOT_TIMES != 0)
+IfxCpu_CStart_BootTimes IfxCpu_CStart0_bootTimes;
+#endif
+
 /*********************************************************************************
 * _start() - startup code
 *********************************************************************************/
@@ -89,6 +107,9 @@ __asm("\t .extern core0_main");
 
 void _Core0_start(void)
 {
+#if (IFX_CFG_CPU_CSTART_BOOT_TIMES != 0)
+    uint32 bootStart = MODULE_STM0.TIM0.U;  /*Kept until the C variables are initialized */
+#endif
     uint32 pcxi;
     uint16 cpuWdtPassword = IfxScuWdt_getCpuWatchdogPasswordInline(&MODULE_SCU.WDTCPU[0]);
 
@@ -143,15 +164,57 @@ void _Core0_start(void)
         IfxScuWdt_disableCpuWatchdog(cpuWdtPassword);
         IfxScuWdt_disableSafetyWatchdog(safetyWdtPassword);
 
+#if (IFX_CFG_CPU_CSTART_PARALLEL_C_INIT != 0)
+        /*Start remaining cores first, each core initializes the C variables of its scratchpad */
+        IfxCpu_CStart0_cInitDone = 0;
+#if (IFX_CFG_CPU_CSTART_ENABLE_TRICORE1 != 0)
+        *(volatile uint32 *)IFXCPU_GLB_ADDR_DSPR(1, &IfxCpu_CStart1_cInitDone) = 0;
+#endif
+#if (IFX_CFG_CPU_CSTART_ENABLE_TRICORE2 != 0)
+        *(volatile uint32 *)IFXCPU_GLB_ADDR_DSPR(2, &IfxCpu_CStart2_cInitDone) = 0;
+#endif
+        __dsync();
+#if (IFX_CFG_CPU_CSTART_ENABLE_TRICORE1 != 0)
+        (void)IfxCpu_startCore(&MODULE_CPU1, (uint32)&_Core1_start);   /*The status returned by function call is ignored */
+#endif
+#if (IFX_CFG_CPU_CSTART_ENABLE_TRICORE2 != 0)
+        (void)IfxCpu_startCore(&MODULE_CPU2, (uint32)&_Core2_start);   /*The status returned by function call is ignored */
+#endif
+
+        Ifx_C_InitCore(0, IFXCSTART0_C_INIT_CORES);   /*Initialization of C runtime variables not owned by CPU1/CPU2 */
+        IfxCpu_CStart0_cInitDone = 1;
+#else
         Ifx_C_Init();           /*Initialization of C runtime variables */
+#endif
 
         IfxScuWdt_enableCpuWatchdog(cpuWdtPassword);
         IfxScuWdt_enableSafetyWatchdog(safetyWdtPassword);
     }
 
+#if (IFX_CFG_CPU_CSTART_BOOT_TIMES != 0)
+    IfxCpu_CStart0_bootTimes.start          = bootStart;
+    IfxCpu_CStart0_bootTimes.cInit          = MODULE_STM0.TIM0.U;
+    IfxCpu_CStart0_bootTimes.resetFrequency = IfxScuCcu_getStmFrequency();
+#endif
+
     /*Initialize the clock system */
     IFXCPU_CSTART_CCU_INIT_HOOK();
 
+#if (IFX_CFG_CPU_CSTART_BOOT_TIMES != 0)
+    IfxCpu_CStart0_bootTimes.clockInit = MODULE_STM0.TIM0.U;
+#endif
+
+#if (IFX_CFG_CPU_CSTART_PARALLEL_C_INIT != 0)
+    /*Wait for the C initialization of the remaining cores */
+#if (IFX_CFG_CPU_CSTART_ENABLE_TRICORE1 != 0)
+    while (*(volatile uint32 *)IFXCPU_GLB_ADDR_DSPR(1, &IfxCpu_CStart1_cInitDone) == 0)
+    {}
+#endif
+#if (IFX_CFG_CPU_CSTART_ENABLE_TRICORE2 != 0)
+    while (*(volatile uint32 *)IFXCPU_GLB_ADDR_DSPR(2, &IfxCpu_CStart2_cInitDone) == 0)
+    {}
+#endif
+#else
     /*Start remaining cores */
 #if (IFX_CFG_CPU_CSTART_ENABLE_TRICORE1 != 0)
     (void)IfxCpu_startCore(&MODULE_CPU1, (uint32)&_Core1_start);       /*The status returned by function call is ignored */
@@ -159,6 +222,7 @@ void _Core0_start(void)
 #if (IFX_CFG_CPU_CSTART_ENABLE_TRICORE2 != 0)
     (void)IfxCpu_startCore(&MODULE_CPU2, (uint32)&_Core2_start);       /*The status returned by function call is ignored */
 #endif
+#endif
 
 #if (IFX_CFG_CPU_CSTART_ENABLE_TRICORE0 == 0)
     IfxScuWdt_disableCpuWatchdog(cpuWdtPassword);
@@ -166,6 +230,10 @@ void _Core0_start(void)
     IfxCpu_setCoreMode(&MODULE_CPU0, IfxCpu_CoreMode_idle);
 #endif
 
+#if (IFX_CFG_CPU_CSTART_BOOT_TIMES != 0)
+    IfxCpu_CStart0_bootTimes.main = MODULE_STM0.TIM0.U;
+#endif
+
     /*Call main function of Cpu0 */
     __non_return_call(core0_main);
 }
@@ -37,7 +37,8 @@
 /*                           Macros                                            */
 /******************************************************************************/
 /** \brief Configuration for cache enable.
- *
+ * The data cache can be enabled when the buffers shared with the DMA are placed with IFX_DMA_BUFFER or in a non
+ * cached segment, or are maintained with IfxCpu_flushDataCache().
  */
 #ifndef IFX_CFG_CPU_CSTART_ENABLE_TRICORE1_PCACHE
 #   define IFX_CFG_CPU_CSTART_ENABLE_TRICORE1_PCACHE (1)  /**< Program Cache enabled by default*/
@@ -62,6 +63,13 @@ __asm("\t .extern core1_main");
 #define IFXCSTART1_PSW_DEFAULT     (0x00000980u)
 #define IFXCSTART1_PCX_O_S_DEFAULT (0xfff00000u)
 
+/*******************************************************************************
+**                      Global Variable Definitions                           **
+*******************************************************************************/
+#if (IFX_CFG_CPU_CSTART_PARALLEL_C_INIT != 0)
+IFX_FAST_DATA_CPU1 volatile uint32 IfxCpu_CStart1_cInitDone = 0;
+#endif
+
 /*********************************************************************************
 * - startup code
 *********************************************************************************/
@@ -118,6 +126,18 @@ void _Core1_start(void)
 
     IfxCpu_initCSA((uint32 *)__CSA(1), (uint32 *)__CSA_END(1));
 
+#if (IFX_CFG_CPU_CSTART_PARALLEL_C_INIT != 0)
+    /*C initialization of the scratchpad variables, the CPU watchdog is not serviced */
+    IfxScuWdt_disableCpuWatchdog(wdtPassword);
+    Ifx_C_InitCore(1, 1u << 1);
+    IfxScuWdt_enableCpuWatchdog(wdtPassword);
+    IfxCpu_CStart1_cInitDone = 1;
+
+    /*Wait for the C initialization of CPU0 */
+    while (*(volatile uint32 *)IFXCPU_GLB_ADDR_DSPR(0, &IfxCpu_CStart0_cInitDone) == 0)
+    {}
+#endif
+
     /*Call main function of Cpu0 */
     __non_return_call(core1_main);
 }
@@ -60,6 +60,16 @@
 /*-----------------------------------Macros-----------------------------------*/
 /******************************************************************************/
 
+/** \brief Single core profile: the software is executed by CPU0 only.
+ * IfxCpu_getCoreId() and IfxCpu_getCoreIndex() are then constant, the per CPU data of the library (critical
+ * section statistics, pools, traces, ...) are addressed without reading the CORE_ID register and the cross CPU
+ * locks are removed where an interrupt lock is sufficient.
+ * Default is 1 on the devices with one CPU, can be set in Ifx_Cfg.h when the other CPUs are kept halted.
+ */
+#ifndef IFX_CFG_CPU_SINGLE_CORE
+#define IFX_CFG_CPU_SINGLE_CORE (IFXCPU_NUM_MODULES == 1)
+#endif
+
 /** \brief Convert local DSPR address to global DSPR address which can be accessed from the SRI bus.
  * Use this macro to convert a local DSPR address (in segment 0xd00.....) to
  * a global DSPR address (in segment 0x700....., 0x600....., 0x500..... downwards) depending on
@@ -85,6 +95,17 @@
  */
 #define IFXCPU_GLB_ADDR_PSPR(cpu, address) ((((unsigned)(address) & 0x000fffff) | 0x70100000) - ((cpu) * 0x10000000))
 
+/** \brief Convert a cached flash or LMU address to its non cached alias.
+ * Use this macro to access a buffer shared with the DMA through the non cached segment
+ * (0xa......., 0xb.......) when the data cache is enabled. Other addresses are returned unchanged.
+ *
+ *   Example usage:
+ *   \code
+ *     uint32 *samples = (uint32 *)IFXCPU_NON_CACHED_ADDR(&sampleBufferInLmu[0]);
+ *   \endcode
+ */
+#define IFXCPU_NON_CACHED_ADDR(address)    ((((((unsigned)(address) >> 28) == IFXCPU_CACHABLE_FLASH_SEGMENT) || (((unsigned)(address) >> 28) == IFXCPU_CACHABLE_LMU_SEGMENT)) ? ((unsigned)(address) + 0x20000000) : (unsigned)(address)))
+
 /******************************************************************************/
 /*------------------------------Type Definitions------------------------------*/
 /******************************************************************************/
@@ -101,6 +122,26 @@ typedef unsigned int IfxCpu_mutexLock;
  */
 typedef unsigned int IfxCpu_syncEvent;
 
+/** \brief Start the measurement of a block, see \ref IfxCpu_readPerfCounters()
+ *
+ * Must be followed by \ref IFXCPU_PERF_MEASURE_END() in the same scope.
+ * \param name measurement name, used for the local variables
+ */
+#define IFXCPU_PERF_MEASURE_BEGIN(name) \
+    {                                   \
+        IfxCpu_PerfCounters name##Begin; \
+        IfxCpu_PerfCounters name##End;   \
+        IfxCpu_readPerfCounters(&name##Begin);
+
+/** \brief End the measurement of a block started with \ref IFXCPU_PERF_MEASURE_BEGIN()
+ * \param name measurement name, as given to IFXCPU_PERF_MEASURE_BEGIN()
+ * \param result Pointer to the IfxCpu_PerfCounters object receiving the counter deltas
+ */
+#define IFXCPU_PERF_MEASURE_END(name, result)                    \
+        IfxCpu_readPerfCounters(&name##End);                     \
+        IfxCpu_getPerfCountersDelta(&name##Begin, &name##End, (result)); \
+    }
+
 /******************************************************************************/
 /*--------------------------------Enumerations--------------------------------*/
 /******************************************************************************/
@@ -127,6 +168,37 @@ typedef enum
     IfxCpu_CounterMode_task   = 1   /**< \brief Normal counter mode:additional gating control from the debug unit which allows the data gathered in the performance counters to be filtered by some specific criteria */
 } IfxCpu_CounterMode;
 
+/** \brief Events counted by the multi counter M1CNT (CCTRL.M1), TriCore 1.6P encoding
+ * \note The TriCore 1.6E CPUs use a different assignment, see the CPU chapter of the user manual
+ */
+typedef enum
+{
+    IfxCpu_CounterEventM1_ipDispatchStall = 0,  /**< \brief Integer pipeline dispatch stall */
+    IfxCpu_CounterEventM1_pcacheHit       = 1,  /**< \brief Program cache hit */
+    IfxCpu_CounterEventM1_dcacheHit       = 2,  /**< \brief Data cache hit */
+    IfxCpu_CounterEventM1_totalBranch     = 3   /**< \brief Branch instructions */
+} IfxCpu_CounterEventM1;
+
+/** \brief Events counted by the multi counter M2CNT (CCTRL.M2), TriCore 1.6P encoding
+ * \note The TriCore 1.6E CPUs use a different assignment, see the CPU chapter of the user manual
+ */
+typedef enum
+{
+    IfxCpu_CounterEventM2_lsDispatchStall = 0,  /**< \brief Load store pipeline dispatch stall */
+    IfxCpu_CounterEventM2_pcacheMiss      = 1,  /**< \brief Program cache miss */
+    IfxCpu_CounterEventM2_dcacheMissClean = 2   /**< \brief Data cache miss, the replaced line was clean */
+} IfxCpu_CounterEventM2;
+
+/** \brief Events counted by the multi counter M3CNT (CCTRL.M3), TriCore 1.6P encoding
+ * \note The TriCore 1.6E CPUs use a different assignment, see the CPU chapter of the user manual
+ */
+typedef enum
+{
+    IfxCpu_CounterEventM3_lpDispatchStall = 0,  /**< \brief Loop pipeline dispatch stall */
+    IfxCpu_CounterEventM3_multiIssue      = 1,  /**< \brief Cycles with more than one instruction issued */
+    IfxCpu_CounterEventM3_dcacheMissDirty = 2   /**< \brief Data cache miss, the replaced line was dirty */
+} IfxCpu_CounterEventM3;
+
 /** \} */
 
 /******************************************************************************/
@@ -158,6 +230,17 @@ typedef struct
     IfxCpu_Counter counter3;          /**< \brief Multi counter 3 */
 } IfxCpu_Perf;
 
+/** \brief Snapshot of the performance counters, or difference of two snapshots
+ */
+typedef struct
+{
+    uint32 clock;                     /**< \brief CCNT value */
+    uint32 instruction;               /**< \brief ICNT value */
+    uint32 counter1;                  /**< \brief M1CNT value */
+    uint32 counter2;                  /**< \brief M2CNT value */
+    uint32 counter3;                  /**< \brief M3CNT value */
+} IfxCpu_PerfCounters;
+
 /** \} */
 
 /** \addtogroup IfxLld_Cpu_Std_Core
@@ -323,6 +406,17 @@ IFX_INLINE void IfxCpu_enableSegmentSpecificDataAccessCacheability(uint16 segmen
  */
 IFX_INLINE void IfxCpu_enableSegmentSpecificInstructionAccessCacheability(uint16 segmentNumberMask, boolean enable);
 
+/** \brief API to write back and invalidate the data cache lines of a buffer shared with the DMA
+ *
+ * Call this API before the DMA reads a buffer written by the CPU, and before the DMA writes a buffer
+ * read afterwards by the CPU. The CPU shall not access the buffer until the DMA transfer is completed.
+ * Nothing is done for buffers in a non cached memory (DSPR, PSPR, non cached flash or LMU segment).
+ * \param address Start address of the buffer
+ * \param size Size of the buffer in bytes
+ * \return None
+ */
+IFX_INLINE void IfxCpu_flushDataCache(const void *address, uint32 size);
+
 /** \brief API to invalidate the program cache
  * \return None
  */
@@ -332,7 +426,7 @@ IFX_INLINE void IfxCpu_invalidateProgramCache(void);
  * \param address Address
  * \return Status TRUE/FALSE
  */
-IFX_INLINE boolean IfxCpu_isAddressCachable(void *address);
+IFX_INLINE boolean IfxCpu_isAddressCachable(const volatile void *address);
 
 /** \brief API to enable or bypass the data cache for the CPU which calls this API.
  *
@@ -420,6 +514,26 @@ IFX_INLINE uint32 IfxCpu_getPerformanceCounter(uint16 address);
  */
 IFX_INLINE boolean IfxCpu_getPerformanceCounterStickyOverflow(uint16 address);
 
+/** \brief Compute the counter differences between two snapshots of \ref IfxCpu_readPerfCounters()
+ *
+ * The differences are computed modulo 2^31, the overflow bit is ignored: a counter must not run
+ * over more than once between the two snapshots.
+ * \param begin Pointer to the first snapshot
+ * \param end Pointer to the second snapshot
+ * \param delta Pointer to the counter differences
+ * \return None
+ */
+IFX_INLINE void IfxCpu_getPerfCountersDelta(const IfxCpu_PerfCounters *begin, const IfxCpu_PerfCounters *end, IfxCpu_PerfCounters *delta);
+
+/** \brief Read all performance counters of the CPU which calls this API
+ *
+ * The counters are read with disabled interrupts by consecutive instructions, the offsets between
+ * the counter reads are constant and cancel out in \ref IfxCpu_getPerfCountersDelta().
+ * \param snapshot Pointer to the counter values
+ * \return None
+ */
+IFX_INLINE void IfxCpu_readPerfCounters(IfxCpu_PerfCounters *snapshot);
+
 /** \brief Reset and start instruction, clock and multi counters
  *
  * Reset and start CCNT, ICNT, M1CNT, M2CNT, M3CNT. the overflow bits are cleared.
@@ -439,6 +553,17 @@ IFX_INLINE void IfxCpu_resetAndStartCounters(IfxCpu_CounterMode mode);
  */
 IFX_INLINE void IfxCpu_setPerformanceCountersEnableBit(uint32 enable);
 
+/** \brief Select the events counted by the multi counters of the CPU which calls this API
+ *
+ * The counters keep their values and their enable state, they should be reset with
+ * \ref IfxCpu_resetAndStartCounters() before a new measurement.
+ * \param m1 Event counted by M1CNT
+ * \param m2 Event counted by M2CNT
+ * \param m3 Event counted by M3CNT
+ * \return None
+ */
+IFX_INLINE void IfxCpu_setPerfCounterEvents(IfxCpu_CounterEventM1 m1, IfxCpu_CounterEventM2 m2, IfxCpu_CounterEventM3 m3);
+
 /** \brief Stop instruction and clock counters, return their values
  *
  * Stop CCNT, ICNT, M1CNT, M2CNT, M3CNT and return their values;
@@ -712,6 +837,23 @@ IFX_INLINE void IfxCpu_enableSegmentSpecificInstructionAccessCacheability(uint16
 }
 
 
+IFX_INLINE void IfxCpu_flushDataCache(const void *address, uint32 size)
+{
+    if ((size != 0) && IfxCpu_isAddressCachable(address))
+    {
+        uint32 line = (uint32)address & ~(uint32)(IFXCPU_DCACHE_LINE_SIZE - 1);
+        uint32 end  = (uint32)address + size;
+
+        for ( ; line < end; line += IFXCPU_DCACHE_LINE_SIZE)
+        {
+            __cacheawi((uint8 *)line);
+        }
+
+        __dsync();
+    }
+}
+
+
 IFX_INLINE void IfxCpu_forceDisableInterrupts(void)
 {
     __disable();
@@ -750,17 +892,25 @@ IFX_INLINE boolean IfxCpu_getClockCounterStickyOverflow(void)
 
 IFX_INLINE IfxCpu_Id IfxCpu_getCoreId(void)
 {
+#if IFX_CFG_CPU_SINGLE_CORE != 0
+    return IfxCpu_Id_0;
+#else
     Ifx_CPU_CORE_ID reg;
     reg.U = __mfcr(CPU_CORE_ID);
     return (IfxCpu_Id)reg.B.CORE_ID;
+#endif
 }
 
 
 IFX_INLINE IfxCpu_ResourceCpu IfxCpu_getCoreIndex(void)
 {
+#if IFX_CFG_CPU_SINGLE_CORE != 0
+    return IfxCpu_ResourceCpu_0;
+#else
     Ifx_CPU_CORE_ID reg;
     reg.U = __mfcr(CPU_CORE_ID);
     return (IfxCpu_ResourceCpu)reg.B.CORE_ID;
+#endif
 }
 
 
@@ -834,6 +984,17 @@ IFX_INLINE boolean IfxCpu_getPerformanceCounterStickyOverflow(uint16 address)
 }
 
 
+IFX_INLINE void IfxCpu_getPerfCountersDelta(const IfxCpu_PerfCounters *begin, const IfxCpu_PerfCounters *end, IfxCpu_PerfCounters *delta)
+{
+    /* The counters have 31 bits, bit 31 is the sticky overflow bit */
+    delta->clock       = (end->clock - begin->clock) & 0x7FFFFFFFU;
+    delta->instruction = (end->instruction - begin->instruction) & 0x7FFFFFFFU;
+    delta->counter1    = (end->counter1 - begin->counter1) & 0x7FFFFFFFU;
+    delta->counter2    = (end->counter2 - begin->counter2) & 0x7FFFFFFFU;
+    delta->counter3    = (end->counter3 - begin->counter3) & 0x7FFFFFFFU;
+}
+
+
 IFX_INLINE void IfxCpu_initCSA(uint32 *csaBegin, uint32 *csaEnd)
 {
     uint32  k;
@@ -882,13 +1043,25 @@ IFX_INLINE void IfxCpu_invalidateProgramCache(void)
 }
 
 
-IFX_INLINE boolean IfxCpu_isAddressCachable(void *address)
+IFX_INLINE boolean IfxCpu_isAddressCachable(const volatile void *address)
 {
-    uint8 segment = (uint32)address >> 24;
+    uint8 segment = (uint32)address >> 28;
     return ((segment == IFXCPU_CACHABLE_FLASH_SEGMENT) || (segment == IFXCPU_CACHABLE_LMU_SEGMENT)) ? TRUE : FALSE;
 }
 
 
+IFX_INLINE void IfxCpu_readPerfCounters(IfxCpu_PerfCounters *snapshot)
+{
+    boolean interruptState = IfxCpu_disableInterrupts();
+    snapshot->clock       = __mfcr(CPU_CCNT);
+    snapshot->instruction = __mfcr(CPU_ICNT);
+    snapshot->counter1    = __mfcr(CPU_M1CNT);
+    snapshot->counter2    = __mfcr(CPU_M2CNT);
+    snapshot->counter3    = __mfcr(CPU_M3CNT);
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+
 IFX_INLINE void IfxCpu_resetAndStartCounters(IfxCpu_CounterMode mode)
 {
     Ifx_CPU_CCTRL cctrl;
@@ -938,6 +1111,17 @@ IFX_INLINE void IfxCpu_setDataCache(boolean enable)
 }
 
 
+IFX_INLINE void IfxCpu_setPerfCounterEvents(IfxCpu_CounterEventM1 m1, IfxCpu_CounterEventM2 m2, IfxCpu_CounterEventM3 m3)
+{
+    Ifx_CPU_CCTRL cctrl;
+    cctrl.U    = __mfcr(CPU_CCTRL);
+    cctrl.B.M1 = m1;
+    cctrl.B.M2 = m2;
+    cctrl.B.M3 = m3;
+    __mtcr(CPU_CCTRL, cctrl.U);
+}
+
+
 IFX_INLINE void IfxCpu_setPerformanceCountersEnableBit(uint32 enable)
 {
     Ifx_CPU_CCTRL cctrl;
@@ -135,6 +135,13 @@ typedef struct
     uint8        data;
 }Ifx_DataBufferMode_TimeStampSingle;
 
+/** \brief Frame header of the Ifx_DataBufferMode_timeStampFrame mode, followed by count data bytes */
+typedef struct
+{
+    Ifx_TickTime timestamp;     /**< \brief Time stamp of the first byte of the frame */
+    uint16       count;         /**< \brief Number of data bytes following the header */
+}Ifx_DataBufferMode_TimeStampFrame;
+
 /*
  * typedef struct
  * {
@@ -148,6 +155,7 @@ typedef enum
 {
     Ifx_DataBufferMode_normal = 0,           /**< \brief normal mode, each received byte is moved to the rx fifo */
     Ifx_DataBufferMode_timeStampSingle,      /**< \brief Single byte type stamp mode. The rx fifo is filled in with Ifx_DataBufferMode_TimeStampSingle items. */
+    Ifx_DataBufferMode_timeStampFrame,       /**< \brief Frame time stamp mode. The rx fifo is filled in with an Ifx_DataBufferMode_TimeStampFrame header followed by the data bytes of each frame. */
 //    Ifx_DataBufferMode_timeStameBurst      /**< \brief Burst byte type stamp mode. The rx fifo is filled in with Ifx_DataBufferMode_TimeStampBurst items. */
 }Ifx_DataBufferMode;
 
@@ -40,8 +40,43 @@
 *******************************************************************************/
 #include "Cpu/Std/Ifx_Types.h"
 #include "Cpu/Std/IfxCpu_Intrinsics.h"
+#include "_Impl/IfxCpu_cfg.h"
 #include "Ifx_Cfg.h"
 
+/*******************************************************************************
+**                      Configuration                                         **
+*******************************************************************************/
+/** \addtogroup IfxLld_Cpu_Trap_Hooks
+ * \{ */
+
+/** \brief Number of records of the trap log of each CPU, power of 2
+ */
+#ifndef IFX_CFG_CPU_TRAP_LOG_SIZE
+#   define IFX_CFG_CPU_TRAP_LOG_SIZE           (8)
+#endif
+
+/** \brief Recoverable trap classes: bit n set for \ref IfxCpu_Trap_Class n.
+ * The error trap of a recoverable class returns after the hook without executing IFX_CFG_CPU_TRAP_DEBUG. Only
+ * classes whose cause does not persist after the return shall be set (e.g. the assertion trap, which returns
+ * after the TRAPV / TRAPSV instruction), or the hook shall remove the cause. System call and non maskable
+ * interrupt always return.
+ */
+#ifndef IFX_CFG_CPU_TRAP_RECOVERABLE
+#   define IFX_CFG_CPU_TRAP_RECOVERABLE        (0)
+#endif
+
+/** \brief Placement of \ref IfxCpu_Trap_statistics, e.g. a section which is not cleared by the startup code to
+ * keep the statistics through an application reset
+ */
+#ifndef IFX_CFG_CPU_TRAP_STATISTICS_SECTION
+#   define IFX_CFG_CPU_TRAP_STATISTICS_SECTION
+#endif
+
+/** \brief Value of IfxCpu_Trap_Statistics.valid when the statistics are initialised */
+#define IFXCPU_TRAP_STATISTICS_VALID            (0x54524150UL)
+
+/** \} */
+
 /*******************************************************************************
 **                      Type definitions                                     **
 *******************************************************************************/
@@ -171,10 +206,48 @@ typedef struct
     unsigned int tCpu : 3;
 } IfxCpu_Trap;
 
+/** \brief Record of a trap in the trap log
+ */
+typedef struct
+{
+    uint32 pc;          /**< \brief return address of the trap (A11) */
+    uint32 timestamp;   /**< \brief STM0 lower 32 bits when the trap was taken */
+    uint8  tClass;      /**< \brief trap class, see \ref IfxCpu_Trap_Class */
+    uint8  tId;         /**< \brief trap identification number (TIN) */
+} IfxCpu_Trap_Record;
+
+/** \brief Trap statistics of one CPU.
+ * Written only by the trap handlers of the CPU, without lock. A trap taken while a trap of the same CPU is
+ * recorded (non maskable interrupt) may overwrite the same record.
+ */
+typedef struct
+{
+    uint32             valid;                              /**< \brief IFXCPU_TRAP_STATISTICS_VALID if initialised */
+    uint32             total;                              /**< \brief number of traps, the last record is records[(total - 1) % IFX_CFG_CPU_TRAP_LOG_SIZE] */
+    uint32             count[8];                           /**< \brief number of traps per class */
+    IfxCpu_Trap_Record records[IFX_CFG_CPU_TRAP_LOG_SIZE]; /**< \brief last traps */
+} IfxCpu_Trap_Statistics;
+
 /*******************************************************************************
 **                Global Exported variables/constants                         **
 *******************************************************************************/
 
+/** \brief Trap statistics, indexed by the CPU index
+ */
+IFX_EXTERN IfxCpu_Trap_Statistics IfxCpu_Trap_statistics[IFXCPU_NUM_MODULES];
+
+/** \brief Initialise the trap statistics of the CPUs which are not valid yet.
+ * The valid statistics are kept, e.g. after an application reset when they are placed with
+ * IFX_CFG_CPU_TRAP_STATISTICS_SECTION in a memory which is not cleared by the startup code.
+ * \return None
+ */
+IFX_EXTERN void IfxCpu_Trap_initStatistics(void);
+
+/** \brief Clear the trap statistics of all CPUs
+ * \return None
+ */
+IFX_EXTERN void IfxCpu_Trap_resetStatistics(void);
+
 /*******************************************************************************
 **         Global Exported macros/inlines/function ptototypes                 **
 *******************************************************************************/
@@ -0,0 +1,415 @@
+/**
+ * \file IfxDma_Memcpy.c
+ * \brief DMA memory copy and fill service
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "IfxDma_Memcpy.h"
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+
+/** \brief Maximal transfer count of a transaction (CHCFGR.TREL) */
+#define IFXDMA_MEMCPY_MAX_TRANSFER_COUNT (0x3FFFU)
+
+/******************************************************************************/
+/*-----------------------Private Function Prototypes--------------------------*/
+/******************************************************************************/
+
+/** \brief Claim a free channel of the pool
+ * \param driver Pointer to the service handle
+ * \return Pointer to the channel, NULL_PTR if all channels are busy
+ */
+IFX_STATIC IfxDma_Memcpy_Channel *IfxDma_Memcpy_claimChannel(IfxDma_Memcpy *driver);
+
+/** \brief Copy with the CPU
+ * \param destination Destination address
+ * \param source Source address
+ * \param size Number of bytes
+ * \return None
+ */
+IFX_STATIC void IfxDma_Memcpy_cpuCopy(void *destination, const void *source, uint32 size);
+
+/** \brief Fill with the CPU
+ * \param destination Destination address
+ * \param value Value written to each byte
+ * \param size Number of bytes
+ * \return None
+ */
+IFX_STATIC void IfxDma_Memcpy_cpuFill(void *destination, uint8 value, uint32 size);
+
+/** \brief Finish the job: release the channel and execute the callback, once
+ * \param job Pointer to the job
+ * \return None
+ */
+IFX_STATIC void IfxDma_Memcpy_finish(IfxDma_Memcpy_Job *job);
+
+/** \brief Compute move size, block mode and transfer count
+ * \param alignment Source address, destination address and size or-ed together
+ * \param size Number of bytes
+ * \param chcfgr Returns TREL, BLKM and CHDW
+ * \return TRUE if the transfer fits into one transaction
+ */
+IFX_STATIC boolean IfxDma_Memcpy_getMoves(uint32 alignment, uint32 size, Ifx_DMA_CH_CHCFGR *chcfgr);
+
+/** \brief Start the DMA transaction of a job
+ * \param channel Pointer to the claimed channel
+ * \param job Pointer to the job
+ * \param destination Global destination address
+ * \param source Global source address
+ * \param moves TREL, BLKM and CHDW from \ref IfxDma_Memcpy_getMoves()
+ * \param fill TRUE to repeat the source move (fill pattern)
+ * \return None
+ */
+IFX_STATIC void IfxDma_Memcpy_start(IfxDma_Memcpy_Channel *channel, IfxDma_Memcpy_Job *job, uint32 destination, uint32 source, Ifx_DMA_CH_CHCFGR moves, boolean fill);
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+IFX_STATIC IfxDma_Memcpy_Channel *IfxDma_Memcpy_claimChannel(IfxDma_Memcpy *driver)
+{
+    IfxDma_Memcpy_Channel *channel = NULL_PTR;
+    uint8                  index;
+
+    for (index = 0; (index < driver->numChannels) && (channel == NULL_PTR); index++)
+    {
+        if (IfxCpu_acquireMutex(&driver->channels[index].lock) != FALSE)
+        {
+            channel = &driver->channels[index];
+        }
+    }
+
+    return channel;
+}
+
+
+boolean IfxDma_Memcpy_copy(IfxDma_Memcpy *driver, IfxDma_Memcpy_Job *job, void *destination, const void *source, uint32 size, IfxDma_Memcpy_Callback callback, void *data)
+{
+    uint32                 coreId  = IfxCpu_getCoreId();
+    uint32                 dst     = IFXCPU_GLB_ADDR_DSPR(coreId, destination);
+    uint32                 src     = IFXCPU_GLB_ADDR_DSPR(coreId, source);
+    IfxDma_Memcpy_Channel *channel = NULL_PTR;
+    Ifx_DMA_CH_CHCFGR      moves;
+
+    job->channel    = NULL_PTR;
+    job->callback   = callback;
+    job->data       = data;
+    job->completion = 0;
+    job->done       = FALSE;
+
+    if ((size >= driver->cpuThreshold) && (IfxDma_Memcpy_getMoves(dst | src | size, size, &moves) != FALSE))
+    {
+        channel = IfxDma_Memcpy_claimChannel(driver);
+    }
+
+    if (channel != NULL_PTR)
+    {
+        IfxCpu_flushDataCache(source, size);
+        IfxCpu_flushDataCache(destination, size);
+        IfxDma_Memcpy_start(channel, job, dst, src, moves, FALSE);
+    }
+    else
+    {
+        IfxDma_Memcpy_cpuCopy(destination, source, size);
+        IfxDma_Memcpy_finish(job);
+    }
+
+    return channel != NULL_PTR;
+}
+
+
+IFX_STATIC void IfxDma_Memcpy_cpuCopy(void *destination, const void *source, uint32 size)
+{
+    uint32 i;
+
+    if ((((uint32)destination | (uint32)source | size) & 3U) == 0)
+    {
+        uint32       *dst = (uint32 *)destination;
+        const uint32 *src = (const uint32 *)source;
+
+        for (i = 0; i < (size / 4); i++)
+        {
+            dst[i] = src[i];
+        }
+    }
+    else
+    {
+        uint8       *dst = (uint8 *)destination;
+        const uint8 *src = (const uint8 *)source;
+
+        for (i = 0; i < size; i++)
+        {
+            dst[i] = src[i];
+        }
+    }
+}
+
+
+IFX_STATIC void IfxDma_Memcpy_cpuFill(void *destination, uint8 value, uint32 size)
+{
+    uint32 i;
+
+    if ((((uint32)destination | size) & 3U) == 0)
+    {
+        uint32 *dst     = (uint32 *)destination;
+        uint32  pattern = value * 0x01010101U;
+
+        for (i = 0; i < (size / 4); i++)
+        {
+            dst[i] = pattern;
+        }
+    }
+    else
+    {
+        uint8 *dst = (uint8 *)destination;
+
+        for (i = 0; i < size; i++)
+        {
+            dst[i] = value;
+        }
+    }
+}
+
+
+boolean IfxDma_Memcpy_fill(IfxDma_Memcpy *driver, IfxDma_Memcpy_Job *job, void *destination, uint8 value, uint32 size, IfxDma_Memcpy_Callback callback, void *data)
+{
+    uint32                 coreId  = IfxCpu_getCoreId();
+    uint32                 dst     = IFXCPU_GLB_ADDR_DSPR(coreId, destination);
+    IfxDma_Memcpy_Channel *channel = NULL_PTR;
+    Ifx_DMA_CH_CHCFGR      moves;
+
+    job->channel    = NULL_PTR;
+    job->callback   = callback;
+    job->data       = data;
+    job->completion = 0;
+    job->done       = FALSE;
+
+    /* The pattern is aligned to the widest move, only destination and size limit the move size */
+    if ((size >= driver->cpuThreshold) && (IfxDma_Memcpy_getMoves(dst | size, size, &moves) != FALSE))
+    {
+        channel = IfxDma_Memcpy_claimChannel(driver);
+    }
+
+    if (channel != NULL_PTR)
+    {
+        uint32 i;
+
+        for (i = 0; i < (IFXDMA_MEMCPY_PATTERN_SIZE / 4); i++)
+        {
+            channel->pattern[i] = value * 0x01010101U;
+        }
+
+        IfxCpu_flushDataCache(channel->pattern, IFXDMA_MEMCPY_PATTERN_SIZE);
+        IfxCpu_flushDataCache(destination, size);
+        IfxDma_Memcpy_start(channel, job, dst, IFXCPU_GLB_ADDR_DSPR(coreId, channel->pattern), moves, TRUE);
+    }
+    else
+    {
+        IfxDma_Memcpy_cpuFill(destination, value, size);
+        IfxDma_Memcpy_finish(job);
+    }
+
+    return channel != NULL_PTR;
+}
+
+
+IFX_STATIC void IfxDma_Memcpy_finish(IfxDma_Memcpy_Job *job)
+{
+    /* Interrupt and polling may race, possibly on different CPUs */
+    if (IfxCpu_acquireMutex(&job->completion) != FALSE)
+    {
+        IfxDma_Memcpy_Channel *channel  = job->channel;
+        IfxDma_Memcpy_Callback callback = job->callback;
+        void                  *data     = job->data;
+
+        if (channel != NULL_PTR)
+        {
+            channel->job = NULL_PTR;
+            IfxCpu_releaseMutex(&channel->lock);
+        }
+
+        job->done = TRUE;
+
+        if (callback != NULL_PTR)
+        {
+            callback(data);
+        }
+    }
+}
+
+
+IFX_STATIC boolean IfxDma_Memcpy_getMoves(uint32 alignment, uint32 size, Ifx_DMA_CH_CHCFGR *chcfgr)
+{
+    IfxDma_ChannelMoveSize moveSize  = IfxDma_ChannelMoveSize_256bit;
+    IfxDma_ChannelMove     blockMode = IfxDma_ChannelMove_16;
+    uint32                 moves;
+
+    /* 1 << moveSize is the number of bytes per move */
+    while ((moveSize > IfxDma_ChannelMoveSize_8bit) && ((alignment & ((1U << moveSize) - 1)) != 0))
+    {
+        moveSize--;
+    }
+
+    moves = size >> moveSize;
+
+    /* 1 << blockMode is the number of moves per transfer for the modes 1 .. 16 */
+    while ((blockMode > IfxDma_ChannelMove_1) && ((moves & ((1U << blockMode) - 1)) != 0))
+    {
+        blockMode--;
+    }
+
+    chcfgr->U      = 0;
+    chcfgr->B.TREL = moves >> blockMode;
+    chcfgr->B.BLKM = blockMode;
+    chcfgr->B.CHDW = moveSize;
+
+    return (moves != 0) && ((moves >> blockMode) <= IFXDMA_MEMCPY_MAX_TRANSFER_COUNT);
+}
+
+
+boolean IfxDma_Memcpy_init(IfxDma_Memcpy *driver, const IfxDma_Memcpy_Config *config)
+{
+    boolean                  result = TRUE;
+    IfxDma_Dma               dma;
+    IfxDma_Dma_ChannelConfig channelConfig;
+    uint8                    index;
+
+    if (config->numChannels > IFXDMA_MEMCPY_MAX_CHANNELS)
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+        result = FALSE;
+    }
+    else
+    {
+        IfxDma_Dma_createModuleHandle(&dma, config->dma);
+        driver->numChannels  = config->numChannels;
+        driver->cpuThreshold = config->cpuThreshold;
+
+        for (index = 0; index < config->numChannels; index++)
+        {
+            IfxDma_Memcpy_Channel *channel = &driver->channels[index];
+
+            IfxDma_Dma_initChannelConfig(&channelConfig, &dma);
+            channelConfig.channelId                     = config->channels[index].channelId;
+            channelConfig.requestMode                   = IfxDma_ChannelRequestMode_completeTransactionPerRequest;
+            channelConfig.operationMode                 = IfxDma_ChannelOperationMode_single;
+            channelConfig.channelInterruptEnabled       = config->channels[index].interruptPriority != 0;
+            channelConfig.channelInterruptControl       = IfxDma_ChannelInterruptControl_thresholdLimitMatch;
+            channelConfig.interruptRaiseThreshold       = 0;
+            channelConfig.channelInterruptPriority      = config->channels[index].interruptPriority;
+            channelConfig.channelInterruptTypeOfService = config->typeOfService;
+            IfxDma_Dma_initChannel(&channel->channel, &channelConfig);
+            channel->channel.channel->CHCFGR.B.DMAPRIO = config->busPriority;
+
+            channel->job     = NULL_PTR;
+            channel->pattern = (uint32 *)(((uint32)channel->patternBuffer + IFXDMA_MEMCPY_PATTERN_SIZE - 1) & ~(IFXDMA_MEMCPY_PATTERN_SIZE - 1U));
+            IfxCpu_releaseMutex(&channel->lock);
+        }
+    }
+
+    return result;
+}
+
+
+void IfxDma_Memcpy_initConfig(IfxDma_Memcpy_Config *config, Ifx_DMA *dma)
+{
+    uint8 index;
+
+    config->dma = dma;
+
+    for (index = 0; index < IFXDMA_MEMCPY_MAX_CHANNELS; index++)
+    {
+        config->channels[index].channelId         = IfxDma_ChannelId_none;
+        config->channels[index].interruptPriority = 0;
+    }
+
+    config->numChannels   = 0;
+    config->typeOfService = IfxSrc_Tos_cpu0;
+    config->busPriority   = IfxDma_ChannelBusPriority_low;
+    config->cpuThreshold  = 64;
+}
+
+
+boolean IfxDma_Memcpy_isDone(IfxDma_Memcpy_Job *job)
+{
+    if (job->done == FALSE)
+    {
+        IfxDma_Memcpy_Channel *channel = job->channel;
+
+        if ((channel != NULL_PTR) && (IfxDma_Dma_isChannelTransactionPending(&channel->channel) == FALSE))
+        {
+            IfxDma_Memcpy_finish(job);
+        }
+    }
+
+    return job->done;
+}
+
+
+void IfxDma_Memcpy_isrChannel(IfxDma_Memcpy *driver, uint8 index)
+{
+    IfxDma_Memcpy_Channel *channel = &driver->channels[index];
+    IfxDma_Memcpy_Job     *job     = channel->job;
+
+    IfxDma_Dma_clearChannelInterrupt(&channel->channel);
+
+    /* The job may already be finished by polling and the channel reused by a new job */
+    if ((job != NULL_PTR) && (IfxDma_Dma_isChannelTransactionPending(&channel->channel) == FALSE))
+    {
+        IfxDma_Memcpy_finish(job);
+    }
+}
+
+
+IFX_STATIC void IfxDma_Memcpy_start(IfxDma_Memcpy_Channel *channel, IfxDma_Memcpy_Job *job, uint32 destination, uint32 source, Ifx_DMA_CH_CHCFGR moves, boolean fill)
+{
+    Ifx_DMA_CH       *ch = channel->channel.channel;
+    Ifx_DMA_CH_CHCFGR chcfgr;
+    Ifx_DMA_CH_ADICR  adicr;
+
+    job->channel = channel;
+    channel->job = job;
+
+    chcfgr.U        = ch->CHCFGR.U;
+    chcfgr.B.TREL   = moves.B.TREL;
+    chcfgr.B.BLKM   = moves.B.BLKM;
+    chcfgr.B.CHDW   = moves.B.CHDW;
+    ch->CHCFGR.U    = chcfgr.U;
+
+    /* Fill: a source circular buffer of one move keeps the source address on the pattern */
+    adicr.U         = ch->ADICR.U;
+    adicr.B.SCBE    = (fill != FALSE) ? 1 : 0;
+    adicr.B.CBLS    = (fill != FALSE) ? moves.B.CHDW : IfxDma_ChannelIncrementCircular_32768;
+    ch->ADICR.U     = adicr.U;
+
+    ch->SADR.U      = source;
+    ch->DADR.U      = destination;
+
+    IfxDma_Dma_clearChannelInterrupt(&channel->channel);
+    __dsync();
+    IfxDma_Dma_startChannelTransaction(&channel->channel);
+}
@@ -88,6 +88,14 @@ IFX_STATIC void IfxDsadc_Dsadc_initModulator(IfxDsadc_Dsadc_Channel *channel, co
  */
 IFX_STATIC void IfxDsadc_Dsadc_initRectifier(IfxDsadc_Dsadc_Channel *channel, const IfxDsadc_Dsadc_RectifierConfig *config);
 
+/** \brief Initialises the DMA channel moving the main results of a channel into its slot of the frames
+ * \param stream Pointer to the DSADC stream handle
+ * \param config pointer to the DSADC stream configuration
+ * \param channelId streamed channel
+ * \return None
+ */
+IFX_STATIC void IfxDsadc_Dsadc_initStreamDmaChannel(IfxDsadc_Dsadc_Stream *stream, const IfxDsadc_Dsadc_StreamConfig *config, IfxDsadc_ChannelId channelId);
+
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
@@ -452,6 +460,152 @@ IFX_STATIC void IfxDsadc_Dsadc_initRectifier(IfxDsadc_Dsadc_Channel *channel, co
 }
 
 
+void IfxDsadc_Dsadc_initStream(IfxDsadc_Dsadc_Stream *stream, const IfxDsadc_Dsadc_StreamConfig *config)
+{
+    Ifx_DSADC                   *dsadc         = config->channel.module;
+    uint32                       bufferSize    = 2 * config->blockSize * sizeof(IfxDsadc_Dsadc_Frame);
+    IfxDsadc_Dsadc_ChannelConfig channelConfig = config->channel;
+    IfxDsadc_Dsadc_Channel       channel;
+    uint32                       channelIx;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->channelMask != 0) && ((config->channelMask >> IFXDSADC_NUM_CHANNELS) == 0));
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->blockSize > 0) && (config->blockSize <= 1024) && ((config->blockSize & (config->blockSize - 1)) == 0));
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((uint32)config->buffer & (bufferSize - 1)) == 0);
+
+    stream->module      = dsadc;
+    stream->channelMask = config->channelMask;
+    stream->buffer      = config->buffer;
+    stream->blockSize   = config->blockSize;
+    stream->blockCount  = 0;
+
+    /* block ready: the highest channel stores the last result of a frame */
+    for (channelIx = 0; channelIx < IFXDSADC_NUM_CHANNELS; channelIx++)
+    {
+        if ((config->channelMask & (1U << channelIx)) != 0)
+        {
+            stream->lastChannel = (IfxDsadc_ChannelId)channelIx;
+        }
+    }
+
+    /* the integrator trigger is switched from bypassed once the channel is initialised */
+    channelConfig.combFilter.serviceRequest      = IfxDsadc_MainServiceRequest_everyNewResult;
+    channelConfig.demodulator.integrationTrigger = IfxDsadc_IntegratorTrigger_bypassed;
+
+    if (config->pwmSync.gtm != NULL_PTR)
+    {
+        channelConfig.demodulator.triggerInput = (config->pwmSync.trigger == IfxGtm_Trig_DsadcTrig_0) ? IfxDsadc_TriggerInput_a : IfxDsadc_TriggerInput_b;
+    }
+
+    for (channelIx = 0; channelIx < IFXDSADC_NUM_CHANNELS; channelIx++)
+    {
+        if ((config->channelMask & (1U << channelIx)) != 0)
+        {
+            IfxDsadc_ChannelId     channelId = (IfxDsadc_ChannelId)channelIx;
+            volatile Ifx_SRC_SRCR *src       = IfxDsadc_getMainSrc(dsadc, channelId);
+
+            IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, config->dmaChannelId[channelIx] > IfxDma_ChannelId_0); /* priority 0 does not trigger the DMA */
+
+            channelConfig.channelId = channelId;
+            IfxDsadc_Dsadc_initChannel(&channel, &channelConfig);
+
+            if (config->pwmSync.gtm != NULL_PTR)
+            {
+                IfxGtm_Trig_toDsadc(config->pwmSync.gtm, channelIx, config->pwmSync.trigger, config->pwmSync.source);
+                IfxDsadc_setIntegratorTrigger(dsadc, channelId, config->pwmSync.edge);
+            }
+            else if (config->channel.demodulator.integrationTrigger != IfxDsadc_IntegratorTrigger_bypassed)
+            {
+                IfxDsadc_setIntegratorTrigger(dsadc, channelId, config->channel.demodulator.integrationTrigger);
+            }
+
+            IfxDsadc_Dsadc_initStreamDmaChannel(stream, config, channelId);
+
+            /* each result is moved by the DMA channel of the channel */
+            IfxSrc_init(src, IfxSrc_Tos_dma, (Ifx_Priority)config->dmaChannelId[channelIx]);
+            IfxSrc_enable(src);
+        }
+    }
+}
+
+
+void IfxDsadc_Dsadc_initStreamConfig(IfxDsadc_Dsadc_StreamConfig *config, IfxDsadc_Dsadc *dsadc)
+{
+    uint32 channelIx;
+
+    IfxDsadc_Dsadc_initChannelConfig(&config->channel, dsadc);
+
+    /* 10 MHz / 50 (CIC3) / 2 (FIR0) / 2 (FIR1) = 50 kHz */
+    config->channel.combFilter.combFilterType   = IfxDsadc_MainCombFilterType_comb3;
+    config->channel.combFilter.decimationFactor = 50;
+    config->channel.combFilter.startValue       = 50;
+    config->channel.firFilter.fir0Enabled       = TRUE;
+    config->channel.firFilter.fir1Enabled       = TRUE;
+
+    config->channelMask                         = 0;
+    config->dma                                 = NULL_PTR;
+
+    for (channelIx = 0; channelIx < IFXDSADC_NUM_CHANNELS; channelIx++)
+    {
+        config->dmaChannelId[channelIx] = IfxDma_ChannelId_none;
+    }
+
+    config->buffer            = NULL_PTR;
+    config->blockSize         = 16;
+    config->blockPriority     = 0;
+    config->blockServProvider = IfxSrc_Tos_cpu0;
+    config->pwmSync.gtm       = NULL_PTR;
+    config->pwmSync.trigger   = IfxGtm_Trig_DsadcTrig_0;
+    config->pwmSync.source    = IfxGtm_Trig_DsadcTrigSource_tomX_6;
+    config->pwmSync.edge      = IfxDsadc_IntegratorTrigger_risingEdge;
+}
+
+
+IFX_STATIC void IfxDsadc_Dsadc_initStreamDmaChannel(IfxDsadc_Dsadc_Stream *stream, const IfxDsadc_Dsadc_StreamConfig *config, IfxDsadc_ChannelId channelId)
+{
+    IfxDma_Dma_Channel             *channel       = &stream->dmaChannel[channelId];
+    uint32                          bufferSize    = 2 * config->blockSize * sizeof(IfxDsadc_Dsadc_Frame);
+    IfxDma_ChannelIncrementCircular circularRange = IfxDma_ChannelIncrementCircular_2;
+
+    /* the double buffer is the circular range of the destination address */
+    while ((1UL << circularRange) < bufferSize)
+    {
+        circularRange++;
+    }
+
+    IfxDma_Dma_ChannelConfig dmaConfig;
+    IfxDma_Dma_initChannelConfig(&dmaConfig, config->dma);
+
+    /* 16 bit result, one frame (IFXDSADC_DSADC_FRAME_SIZE results) further for each move */
+    dmaConfig.channelId                        = config->dmaChannelId[channelId];
+    dmaConfig.sourceAddress                    = (uint32)&stream->module->CH[channelId].RESM.U;
+    dmaConfig.sourceAddressCircularRange       = IfxDma_ChannelIncrementCircular_none;
+    dmaConfig.sourceCircularBufferEnabled      = TRUE;
+    dmaConfig.destinationAddress               = IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), &config->buffer[0].result[channelId]);
+    dmaConfig.destinationAddressIncrementStep  = IfxDma_ChannelIncrementStep_8;
+    dmaConfig.destinationAddressCircularRange  = circularRange;
+    dmaConfig.destinationCircularBufferEnabled = TRUE;
+    dmaConfig.transferCount                    = config->blockSize;
+    dmaConfig.moveSize                         = IfxDma_ChannelMoveSize_16bit;
+    dmaConfig.blockMode                        = IfxDma_ChannelMove_1;
+    dmaConfig.requestMode                      = IfxDma_ChannelRequestMode_oneTransferPerRequest;
+    dmaConfig.operationMode                    = IfxDma_ChannelOperationMode_continuous;
+    dmaConfig.hardwareRequestEnabled           = TRUE;
+
+    if (channelId == stream->lastChannel)
+    {
+        /* block ready: transfer count reaches 0 */
+        dmaConfig.channelInterruptEnabled       = TRUE;
+        dmaConfig.channelInterruptControl       = IfxDma_ChannelInterruptControl_thresholdLimitMatch;
+        dmaConfig.interruptRaiseThreshold       = 0;
+        dmaConfig.channelInterruptPriority      = config->blockPriority;
+        dmaConfig.channelInterruptTypeOfService = config->blockServProvider;
+    }
+
+    IfxDma_Dma_initChannel(channel, &dmaConfig);
+    IfxDma_Dma_clearChannelInterrupt(channel);
+}
+
+
 void IfxDsadc_Dsadc_initCarrierGenConfig(IfxDsadc_Dsadc_CarrierGenConfig *config)
 {
     config->bitReversed         = FALSE;
@@ -138,6 +138,64 @@
  * }
  * \endcode
  *
+ * \section IfxLld_Dsadc_Dsadc_StreamUsage DMA stream of the main results
+ *
+ * For current sensing at a fixed rate, the main results of several channels are moved by the DMA into an
+ * interleaved double buffer, without any CPU load per result:
+ * - all channels of IfxDsadc_Dsadc_StreamConfig.channelMask are initialised with the same filter chain
+ *   (IfxDsadc_Dsadc_StreamConfig.channel): CIC3 decimation, FIR0 / FIR1 (each decimating by 2) and integrator window.
+ * - each channel has its own DMA channel (the result registers are 0x100 apart), which stores the result into its
+ *   slot of the current IfxDsadc_Dsadc_Frame: result[channelId].
+ * - the DMA channel of the highest channel raises the block interrupt after blockSize frames. The service routine
+ *   calls IfxDsadc_Dsadc_isrStream() and processes IfxDsadc_Dsadc_getStreamBlock().
+ *
+ * With the default configuration (10 MHz modulator clock, CIC3 decimation of 50, FIR0 and FIR1 enabled), one
+ * frame is stored every 20 us (50 kHz):
+ * \code
+ *     // double buffer, aligned to its size and not data cached
+ *     IFX_DMA_BUFFER IFX_ALIGN(2 * 16 * sizeof(IfxDsadc_Dsadc_Frame)) IfxDsadc_Dsadc_Frame dsadcFrames[2 * 16];
+ *     IfxDsadc_Dsadc_Stream dsadcStream;
+ *
+ *     IfxDsadc_Dsadc_StreamConfig streamConfig;
+ *     IfxDsadc_Dsadc_initStreamConfig(&streamConfig, &dsadc);
+ *
+ *     streamConfig.channelMask       = 0x07;  // channels 0..2
+ *     streamConfig.dma               = &dma;
+ *     streamConfig.dmaChannelId[0]   = IfxDma_ChannelId_10;
+ *     streamConfig.dmaChannelId[1]   = IfxDma_ChannelId_11;
+ *     streamConfig.dmaChannelId[2]   = IfxDma_ChannelId_12;
+ *     streamConfig.buffer            = dsadcFrames;
+ *     streamConfig.blockSize         = 16;
+ *     streamConfig.blockPriority     = ISR_PRIORITY_DSADC_BLOCK;
+ *     streamConfig.blockServProvider = IfxSrc_Tos_cpu0;
+ *
+ *     IfxDsadc_Dsadc_initStream(&dsadcStream, &streamConfig);
+ *     IfxDsadc_Dsadc_startStream(&dsadcStream);
+ *
+ *     IFX_INTERRUPT(dsadcBlockISR, 0, ISR_PRIORITY_DSADC_BLOCK)
+ *     {
+ *         IfxDsadc_Dsadc_isrStream(&dsadcStream);
+ *         const IfxDsadc_Dsadc_Frame *frames = IfxDsadc_Dsadc_getStreamBlock(&dsadcStream);
+ *         // frames[0..15].result[0..2]
+ *     }
+ * \endcode
+ *
+ * \subsection IfxLld_Dsadc_Dsadc_StreamPwm Synchronisation to the PWM
+ *
+ * When IfxDsadc_Dsadc_StreamConfig.pwmSync.gtm is set, a TOM / ATOM output of the PWM is routed by IfxGtm_Trig
+ * to the trigger input of each channel and starts its integrator. The integrator window
+ * (IfxDsadc_Dsadc_StreamConfig.channel.integrator: discarded then integrated results, one cycle) then produces
+ * exactly one result per channel and PWM period: all the frames of a period arrive in one burst,
+ * at a fixed delay after the PWM edge. With blockSize 1, the block interrupt is raised once per PWM period.
+ * \code
+ *     streamConfig.channel.integrator.discardCount     = 2;
+ *     streamConfig.channel.integrator.integrationCount = 8;
+ *     streamConfig.pwmSync.gtm                         = &MODULE_GTM;
+ *     streamConfig.pwmSync.trigger                     = IfxGtm_Trig_DsadcTrig_0;
+ *     streamConfig.pwmSync.source                      = IfxGtm_Trig_DsadcTrigSource_tomX_6;  // TOM channel 6 of the PWM
+ *     streamConfig.blockSize                           = 1;
+ * \endcode
+ *
  * \defgroup IfxLld_Dsadc_Dsadc DSADC
  * \ingroup IfxLld_Dsadc
  * \defgroup IfxLld_Dsadc_Dsadc_DataStructures Data Structures
@@ -152,6 +210,8 @@
  * \ingroup IfxLld_Dsadc_Dsadc
  * \defgroup IfxLld_Dsadc_Dsadc_Interrupt Interrupt Functions
  * \ingroup IfxLld_Dsadc_Dsadc
+ * \defgroup IfxLld_Dsadc_Dsadc_Stream Stream Functions
+ * \ingroup IfxLld_Dsadc_Dsadc
  */
 
 #ifndef IFXDSADC_DSADC_H
@@ -163,6 +223,16 @@
 
 #include "Dsadc/Std/IfxDsadc.h"
 #include "Scu/Std/IfxScuWdt.h"
+#include "Dma/Dma/IfxDma_Dma.h"
+#include "Gtm/Trig/IfxGtm_Trig.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Number of results of an IfxDsadc_Dsadc_Frame: power of 2, at least IFXDSADC_NUM_CHANNELS
+ */
+#define IFXDSADC_DSADC_FRAME_SIZE (8)
 
 /******************************************************************************/
 /*-----------------------------Data Structures--------------------------------*/
@@ -235,6 +305,13 @@ typedef struct
     IfxDsadc_FirInternalShift internalShift;            /**< \brief FIR shift control selction */
 } IfxDsadc_Dsadc_FirFilterConfig;
 
+/** \brief Results of one decimation step in stream mode, the result of channel x is stored in result[x]
+ */
+typedef struct
+{
+    sint16 result[IFXDSADC_DSADC_FRAME_SIZE];       /**< \brief Main results indexed by channel, the slots of the channels not streamed are not written */
+} IfxDsadc_Dsadc_Frame;
+
 /** \brief Integrator configuration structure
  */
 typedef struct
@@ -257,6 +334,16 @@ typedef struct
     IfxDsadc_CommonModeVoltage commonModeVoltage;        /**< \brief Modulator common mode voltage selection */
 } IfxDsadc_Dsadc_ModulatorConfig;
 
+/** \brief Synchronisation of the stream to a PWM
+ */
+typedef struct
+{
+    Ifx_GTM                    *gtm;           /**< \brief Pointer to the GTM registers. If NULL_PTR, the channels convert continuously */
+    IfxGtm_Trig_DsadcTrig       trigger;       /**< \brief DSADC trigger of the GTM (trigger input a or b of the channels) */
+    IfxGtm_Trig_DsadcTrigSource source;        /**< \brief TOM / ATOM output of the PWM starting the integration */
+    IfxDsadc_IntegratorTrigger  edge;          /**< \brief Edge of the PWM output starting the integration */
+} IfxDsadc_Dsadc_PwmSyncConfig;
+
 /** \brief Rectifier configuration structure
  */
 typedef struct
@@ -326,6 +413,34 @@ typedef struct
     IfxDsadc_LowPowerSupply lowPowerSupply;             /**< \brief Low power supply voltage selection */
 } IfxDsadc_Dsadc_Config;
 
+/** \brief DMA stream handle
+ */
+typedef struct
+{
+    Ifx_DSADC            *module;                                  /**< \brief Specifies the pointer to the DSADC module registers */
+    IfxDma_Dma_Channel    dmaChannel[IFXDSADC_NUM_CHANNELS];       /**< \brief DMA channel of each streamed channel */
+    uint32                channelMask;                             /**< \brief Streamed channels (bitwise selection) */
+    IfxDsadc_ChannelId    lastChannel;                             /**< \brief Highest streamed channel, its DMA channel raises the block interrupt */
+    IfxDsadc_Dsadc_Frame *buffer;                                  /**< \brief Double buffer of 2 * blockSize frames */
+    uint16                blockSize;                               /**< \brief Number of frames per block */
+    volatile uint32       blockCount;                              /**< \brief Number of blocks filled since the initialisation */
+} IfxDsadc_Dsadc_Stream;
+
+/** \brief DMA stream configuration
+ */
+typedef struct
+{
+    IfxDsadc_Dsadc_ChannelConfig channel;                                   /**< \brief Configuration of all streamed channels, channelId is ignored */
+    uint32                       channelMask;                               /**< \brief Streamed channels (bitwise selection) */
+    IfxDma_Dma                  *dma;                                       /**< \brief Pointer to the DMA driver */
+    IfxDma_ChannelId             dmaChannelId[IFXDSADC_NUM_CHANNELS];       /**< \brief DMA channel of each streamed channel, also the priority of its service request. Must not be 0 */
+    IfxDsadc_Dsadc_Frame        *buffer;                                    /**< \brief Double buffer of 2 * blockSize frames, aligned to its size in bytes, not data cached */
+    uint16                       blockSize;                                 /**< \brief Number of frames per block: power of 2, max 1024 */
+    Ifx_Priority                 blockPriority;                             /**< \brief Interrupt priority of the block ready interrupt */
+    IfxSrc_Tos                   blockServProvider;                         /**< \brief Interrupt service provider of the block ready interrupt */
+    IfxDsadc_Dsadc_PwmSyncConfig pwmSync;                                   /**< \brief Synchronisation to a PWM, see \ref IfxLld_Dsadc_Dsadc_StreamPwm */
+} IfxDsadc_Dsadc_StreamConfig;
+
 /** \} */
 
 /** \addtogroup IfxLld_Dsadc_Dsadc_Module
@@ -472,6 +587,63 @@ IFX_INLINE volatile Ifx_SRC_SRCR *IfxDsadc_Dsadc_getMainSrc(IfxDsadc_Dsadc_Chann
 
 /** \} */
 
+/** \addtogroup IfxLld_Dsadc_Dsadc_Stream
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Get the block filled last by the DMA, valid until the DMA writes this half of the double buffer again
+ * \param stream Pointer to the DSADC stream handle
+ * \return Pointer to the first of the blockSize frames of the block
+ */
+IFX_INLINE const IfxDsadc_Dsadc_Frame *IfxDsadc_Dsadc_getStreamBlock(IfxDsadc_Dsadc_Stream *stream);
+
+/** \brief Handle the block ready interrupt. Must be called first from the interrupt
+ * with the priority IfxDsadc_Dsadc_StreamConfig.blockPriority
+ * \param stream Pointer to the DSADC stream handle
+ * \return None
+ */
+IFX_INLINE void IfxDsadc_Dsadc_isrStream(IfxDsadc_Dsadc_Stream *stream);
+
+/** \brief Start the modulators and the demodulators of the streamed channels together
+ * \param stream Pointer to the DSADC stream handle
+ * \return None
+ */
+IFX_INLINE void IfxDsadc_Dsadc_startStream(IfxDsadc_Dsadc_Stream *stream);
+
+/** \brief Stop the modulators of the streamed channels
+ * \param stream Pointer to the DSADC stream handle
+ * \return None
+ */
+IFX_INLINE void IfxDsadc_Dsadc_stopStream(IfxDsadc_Dsadc_Stream *stream);
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Initialise the streamed channels, their service requests and DMA channels, and the PWM synchronisation.
+ * The conversions are started with IfxDsadc_Dsadc_startStream()
+ * \param stream Pointer to the DSADC stream handle (it will be initialized by this function)
+ * \param config Pointer to the DSADC stream configuration
+ * \return None
+ *
+ * A coding example can be found in \ref IfxLld_Dsadc_Dsadc_StreamUsage
+ *
+ */
+IFX_EXTERN void IfxDsadc_Dsadc_initStream(IfxDsadc_Dsadc_Stream *stream, const IfxDsadc_Dsadc_StreamConfig *config);
+
+/** \brief Initialise the config struct with the default stream configuration: 50 kHz frames with a 10 MHz modulator
+ * clock, no PWM synchronisation
+ * \param config Pointer to the DSADC stream configuration (it will be initialized by this function)
+ * \param dsadc Pointer to the DSADC handle
+ * \return None
+ */
+IFX_EXTERN void IfxDsadc_Dsadc_initStreamConfig(IfxDsadc_Dsadc_StreamConfig *config, IfxDsadc_Dsadc *dsadc);
+
+/** \} */
+
 /******************************************************************************/
 /*-------------------------Global Function Prototypes-------------------------*/
 /******************************************************************************/
@@ -498,22 +670,47 @@ IFX_INLINE sint16 IfxDsadc_Dsadc_getMainResult(IfxDsadc_Dsadc_Channel *channel)
 }
 
 
+IFX_INLINE const IfxDsadc_Dsadc_Frame *IfxDsadc_Dsadc_getStreamBlock(IfxDsadc_Dsadc_Stream *stream)
+{
+    return &stream->buffer[((stream->blockCount - 1) & 1U) * stream->blockSize];
+}
+
+
 IFX_INLINE volatile Ifx_SRC_SRCR *IfxDsadc_Dsadc_getMainSrc(IfxDsadc_Dsadc_Channel *channel)
 {
     return IfxDsadc_getMainSrc(channel->module, channel->channelId);
 }
 
 
+IFX_INLINE void IfxDsadc_Dsadc_isrStream(IfxDsadc_Dsadc_Stream *stream)
+{
+    IfxDma_Dma_clearChannelInterrupt(&stream->dmaChannel[stream->lastChannel]);
+    stream->blockCount++;
+}
+
+
 IFX_INLINE void IfxDsadc_Dsadc_startScan(IfxDsadc_Dsadc *dsadc, uint32 modulatorMask, uint32 channelMask)
 {
     IfxDsadc_startScan(dsadc->dsadc, modulatorMask, channelMask);
 }
 
 
+IFX_INLINE void IfxDsadc_Dsadc_startStream(IfxDsadc_Dsadc_Stream *stream)
+{
+    IfxDsadc_startScan(stream->module, stream->channelMask, stream->channelMask);
+}
+
+
 IFX_INLINE void IfxDsadc_Dsadc_stopScan(IfxDsadc_Dsadc *dsadc, uint32 modulatorMask)
 {
     IfxDsadc_stopScan(dsadc->dsadc, modulatorMask);
 }
 
 
+IFX_INLINE void IfxDsadc_Dsadc_stopStream(IfxDsadc_Dsadc_Stream *stream)
+{
+    IfxDsadc_stopScan(stream->module, stream->channelMask);
+}
+
+
 #endif /* IFXDSADC_DSADC_H */
@@ -30,6 +30,12 @@
 #include "string.h"
 #include "Gtm/Trig/IfxGtm_Trig.h"
 
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+#define IFXDSADC_RDC_TIMESTAMP_MASK (0x00FFFFFFU) /**< \brief Width of the TIM captures of the absolute time */
+
 /** \addtogroup IfxLld_Dsadc_Rdc_func_config
  * \{ */
 
@@ -58,6 +64,24 @@ IFX_STATIC boolean IfxDsadc_Rdc_initHwChannels(IfxDsadc_Rdc *driver, const IfxDs
  */
 IFX_STATIC void IfxDsadc_Rdc_initHwTimestamp(IfxDsadc_Rdc *driver, const IfxDsadc_Rdc_Config *config);
 
+/** \brief Initialise the DMA channels of the stream mode, if IfxDsadc_Rdc_Config.stream.dma is set
+ * \param driver Driver handle
+ * \param config DSADC RDC configuration structure
+ * \return None
+ */
+IFX_STATIC void IfxDsadc_Rdc_initStream(IfxDsadc_Rdc *driver, const IfxDsadc_Rdc_Config *config);
+
+/** \brief Initialise one DMA channel of the stream: one result per request, blockSize results per transaction
+ * \param channel DMA channel handle
+ * \param config Stream configuration
+ * \param channelId DMA channel
+ * \param source Address of the DSADC result register
+ * \param destination Global address of the first sample member in the buffer
+ * \param blockInterrupt If TRUE, the channel raises the block ready interrupt
+ * \return None
+ */
+IFX_STATIC void IfxDsadc_Rdc_initStreamDmaChannel(IfxDma_Dma_Channel *channel, const IfxDsadc_Rdc_StreamConfig *config, IfxDma_ChannelId channelId, uint32 source, uint32 destination, boolean blockInterrupt);
+
 /** \} */
 
 /** \addtogroup IfxLld_Dsadc_Rdc_func_utility
@@ -195,6 +219,60 @@ IfxStdIf_Pos_SensorType IfxDsadc_Rdc_getSensorType(IfxDsadc_Rdc *driver)
 }
 
 
+void IfxDsadc_Rdc_getSnapshot(IfxDsadc_Rdc *driver, IfxDsadc_Rdc_Snapshot *snapshot)
+{
+    IfxDsadc_Rdc_Stream *stream = &driver->stream;
+    uint32               sequence;
+
+    do
+    {
+        /* wait until no snapshot is being written, then copy it and check that it has not changed */
+        do
+        {
+            sequence = stream->sequence;
+        } while ((sequence & 1U) != 0);
+
+        *snapshot = *(volatile IfxDsadc_Rdc_Snapshot *)&stream->snapshot;
+    } while (stream->sequence != sequence);
+}
+
+
+float32 IfxDsadc_Rdc_getStreamAbsolutePosition(IfxDsadc_Rdc *driver)
+{
+    return ((float32)driver->angleTrk.base.turn + (float32)driver->stream.rawPosition / (float32)driver->angleTrk.base.resolution) * 2.0 * IFX_PI;
+}
+
+
+IfxStdIf_Pos_Dir IfxDsadc_Rdc_getStreamDirection(IfxDsadc_Rdc *driver)
+{
+    return driver->stream.reader.direction;
+}
+
+
+IfxStdIf_Pos_Status IfxDsadc_Rdc_getStreamFault(IfxDsadc_Rdc *driver)
+{
+    return driver->stream.reader.status;
+}
+
+
+float32 IfxDsadc_Rdc_getStreamPosition(IfxDsadc_Rdc *driver)
+{
+    return (float32)driver->stream.rawPosition * driver->angleTrk.base.positionConst;
+}
+
+
+IfxStdIf_Pos_RawAngle IfxDsadc_Rdc_getStreamRawPosition(IfxDsadc_Rdc *driver)
+{
+    return driver->stream.rawPosition;
+}
+
+
+float32 IfxDsadc_Rdc_getStreamSpeed(IfxDsadc_Rdc *driver)
+{
+    return driver->stream.reader.speed;
+}
+
+
 sint32 IfxDsadc_Rdc_getTurn(IfxDsadc_Rdc *driver)
 {
     return Ifx_AngleTrkF32_getTurn(&driver->angleTrk);
@@ -211,6 +289,9 @@ IFX_STATIC float32 IfxDsadc_Rdc_getUpdatePeriod(IfxDsadc_Rdc *driver)
 boolean IfxDsadc_Rdc_init(IfxDsadc_Rdc *driver, const IfxDsadc_Rdc_Config *config)
 {
     boolean result = TRUE;
+    /* Initialise the DMA sample stream, before the service requests are routed to it */
+    IfxDsadc_Rdc_initStream(driver, config);
+
     /* Initialise the DSADC hardware channels */
     result &= IfxDsadc_Rdc_initHwChannels(driver, config);
 
@@ -244,11 +325,19 @@ boolean IfxDsadc_Rdc_init(IfxDsadc_Rdc *driver, const IfxDsadc_Rdc_Config *confi
         atoConfig.kd                = config->kd;
         atoConfig.resolution        = config->resolution;
 
+        if (driver->stream.enabled != FALSE)
+        {
+            /* stream mode: one observer step per sample */
+            Ifx_AngleTrkF32_init(&(driver->angleTrk), &atoConfig, driver->updatePeriod);
+        }
+        else
+        {
 #if IFXDSADC_RDC_CFG_PRE_OBSERVER_CORRECTION
-        Ifx_AngleTrkF32_init(&(driver->angleTrk), &atoConfig, config->userTs);
+            Ifx_AngleTrkF32_init(&(driver->angleTrk), &atoConfig, config->userTs);
 #else
-        Ifx_AngleTrkF32_init(&(driver->angleTrk), &atoConfig, driver->updatePeriod);
+            Ifx_AngleTrkF32_init(&(driver->angleTrk), &atoConfig, driver->updatePeriod);
 #endif
+        }
     }
 
     /* Optional calibration init */
@@ -286,6 +375,13 @@ void IfxDsadc_Rdc_initConfig(IfxDsadc_Rdc_Config *config)
     config->hardware.servReqPriority             = 0;
     config->hardware.servReqProvider             = IfxSrc_Tos_cpu0;
     config->hardware.startScan                   = FALSE;
+    config->stream.dma                           = NULL_PTR;
+    config->stream.sinDmaChannelId               = IfxDma_ChannelId_none;
+    config->stream.cosDmaChannelId               = IfxDma_ChannelId_none;
+    config->stream.buffer                        = NULL_PTR;
+    config->stream.blockSize                     = 0;
+    config->stream.blockPriority                 = 0;
+    config->stream.blockServProvider             = IfxSrc_Tos_cpu1;
 }
 
 
@@ -319,7 +415,20 @@ IFX_STATIC boolean IfxDsadc_Rdc_initHwChannels(IfxDsadc_Rdc *driver, const IfxDs
             channelConfig.channelId = configHw->inputSin;
             IfxDsadc_Dsadc_initChannel(&hwHandle->inputSin, &channelConfig);
 
-            if (configHw->servReqPriority != 0)
+            if (driver->stream.enabled != FALSE)
+            {
+                /* stream mode: the results of both channels are moved by the DMA */
+                volatile Ifx_SRC_SRCR *srcr;
+
+                srcr = &MODULE_SRC.DSADC.DSADC[configHw->inputSin].SRM;
+                IfxSrc_init(srcr, IfxSrc_Tos_dma, (Ifx_Priority)config->stream.sinDmaChannelId);
+                IfxSrc_enable(srcr);
+
+                srcr = &MODULE_SRC.DSADC.DSADC[configHw->inputCos].SRM;
+                IfxSrc_init(srcr, IfxSrc_Tos_dma, (Ifx_Priority)config->stream.cosDmaChannelId);
+                IfxSrc_enable(srcr);
+            }
+            else if (configHw->servReqPriority != 0)
             {
                 IfxDsadc_ChannelId     ch = channelConfig.channelId;
 
@@ -387,6 +496,84 @@ IFX_STATIC void IfxDsadc_Rdc_initHwTimestamp(IfxDsadc_Rdc *driver, const IfxDsad
 }
 
 
+IFX_STATIC void IfxDsadc_Rdc_initStream(IfxDsadc_Rdc *driver, const IfxDsadc_Rdc_Config *config)
+{
+    IfxDsadc_Rdc_Stream             *stream       = &driver->stream;
+    const IfxDsadc_Rdc_StreamConfig *streamConfig = &config->stream;
+    Ifx_DSADC                       *dsadc        = config->hardware.inputConfig.module;
+
+    stream->enabled      = (streamConfig->dma != NULL_PTR) ? TRUE : FALSE;
+    stream->buffer       = streamConfig->buffer;
+    stream->blockSize    = streamConfig->blockSize;
+    stream->polled       = (streamConfig->blockPriority == 0) ? TRUE : FALSE;
+    stream->blockCount   = 0;
+    stream->readCount    = 0;
+    stream->overrunCount = 0;
+    stream->sequence     = 0;
+    stream->rawPosition  = 0;
+    memset(&stream->snapshot, 0, sizeof(stream->snapshot));
+    memset(&stream->reader, 0, sizeof(stream->reader));
+
+    if (stream->enabled != FALSE)
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (streamConfig->sinDmaChannelId > IfxDma_ChannelId_0) && (streamConfig->cosDmaChannelId > IfxDma_ChannelId_0)); /* priority 0 does not trigger the DMA */
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (streamConfig->blockSize > 0) && (streamConfig->blockSize <= 4096) && ((streamConfig->blockSize & (streamConfig->blockSize - 1)) == 0));
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((uint32)streamConfig->buffer & ((2 * streamConfig->blockSize * sizeof(IfxDsadc_Rdc_Sample)) - 1)) == 0);
+
+        /* both channels write the same double buffer, each into its member of the samples */
+        IfxDsadc_Rdc_initStreamDmaChannel(&stream->cosDmaChannel, streamConfig, streamConfig->cosDmaChannelId,
+            (uint32)&dsadc->CH[config->hardware.inputCos].RESM.U, IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), &streamConfig->buffer[0].cosIn), FALSE);
+        IfxDsadc_Rdc_initStreamDmaChannel(&stream->sinDmaChannel, streamConfig, streamConfig->sinDmaChannelId,
+            (uint32)&dsadc->CH[config->hardware.inputSin].RESM.U, IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), &streamConfig->buffer[0].sinIn), TRUE);
+    }
+}
+
+
+IFX_STATIC void IfxDsadc_Rdc_initStreamDmaChannel(IfxDma_Dma_Channel *channel, const IfxDsadc_Rdc_StreamConfig *config, IfxDma_ChannelId channelId, uint32 source, uint32 destination, boolean blockInterrupt)
+{
+    uint32                          bufferSize    = 2 * config->blockSize * sizeof(IfxDsadc_Rdc_Sample);
+    IfxDma_ChannelIncrementCircular circularRange = IfxDma_ChannelIncrementCircular_2;
+
+    /* the double buffer is the circular range of the destination address */
+    while ((1UL << circularRange) < bufferSize)
+    {
+        circularRange++;
+    }
+
+    IfxDma_Dma_ChannelConfig dmaConfig;
+    IfxDma_Dma_initChannelConfig(&dmaConfig, config->dma);
+
+    /* 16 bit result, one sample (2 results) further for each move */
+    dmaConfig.channelId                        = channelId;
+    dmaConfig.sourceAddress                    = source;
+    dmaConfig.sourceAddressCircularRange       = IfxDma_ChannelIncrementCircular_none;
+    dmaConfig.sourceCircularBufferEnabled      = TRUE;
+    dmaConfig.destinationAddress               = destination;
+    dmaConfig.destinationAddressIncrementStep  = IfxDma_ChannelIncrementStep_2;
+    dmaConfig.destinationAddressCircularRange  = circularRange;
+    dmaConfig.destinationCircularBufferEnabled = TRUE;
+    dmaConfig.transferCount                    = config->blockSize;
+    dmaConfig.moveSize                         = IfxDma_ChannelMoveSize_16bit;
+    dmaConfig.blockMode                        = IfxDma_ChannelMove_1;
+    dmaConfig.requestMode                      = IfxDma_ChannelRequestMode_oneTransferPerRequest;
+    dmaConfig.operationMode                    = IfxDma_ChannelOperationMode_continuous;
+    dmaConfig.hardwareRequestEnabled           = TRUE;
+
+    if (blockInterrupt != FALSE)
+    {
+        /* block ready: transfer count reaches 0 */
+        dmaConfig.channelInterruptEnabled       = TRUE;
+        dmaConfig.channelInterruptControl       = IfxDma_ChannelInterruptControl_thresholdLimitMatch;
+        dmaConfig.interruptRaiseThreshold       = 0;
+        dmaConfig.channelInterruptPriority      = config->blockPriority;
+        dmaConfig.channelInterruptTypeOfService = config->blockServProvider;
+    }
+
+    IfxDma_Dma_initChannel(channel, &dmaConfig);
+    IfxDma_Dma_clearChannelInterrupt(channel);
+}
+
+
 void IfxDsadc_Rdc_onEventA(IfxDsadc_Rdc *driver)
 {
     driver->timestamp.rdc = driver->hardware.rdcTimCh->GPR0.B.GPR0;
@@ -410,6 +597,69 @@ void IfxDsadc_Rdc_onEventA(IfxDsadc_Rdc *driver)
 }
 
 
+boolean IfxDsadc_Rdc_processStream(IfxDsadc_Rdc *driver)
+{
+    IfxDsadc_Rdc_Stream       *stream   = &driver->stream;
+    Ifx_AngleTrkF32           *angleTrk = &driver->angleTrk;
+    const IfxDsadc_Rdc_Sample *block;
+    uint32                     blockCount;
+    uint32                     tsRdc;
+    uint32                     newSamples;
+    uint16                     sampleIx;
+
+    if (stream->polled != FALSE)
+    {
+        if (IfxDma_Dma_getAndClearChannelInterrupt(&stream->sinDmaChannel) != FALSE)
+        {
+            stream->blockCount++;
+        }
+    }
+
+    blockCount = stream->blockCount;
+
+    if (blockCount == stream->readCount)
+    {
+        return FALSE;
+    }
+
+    /* only the last filled block is still valid, the older ones are being overwritten */
+    stream->overrunCount += blockCount - stream->readCount - 1;
+    stream->readCount     = blockCount;
+    block                 = &stream->buffer[((blockCount - 1) & 1) * stream->blockSize];
+
+    /* tracking observer (note: atan2 lookup function is available inside) */
+    for (sampleIx = 0; sampleIx < stream->blockSize; sampleIx++)
+    {
+        float32 groupDelayAngle = driver->groupDelay * Ifx_AngleTrkF32_getLoopSpeed(angleTrk);
+
+        Ifx_AngleTrkF32_step(angleTrk, block[sampleIx].sinIn, block[sampleIx].cosIn, groupDelayAngle);
+    }
+
+    driver->sinIn = block[stream->blockSize - 1].sinIn;
+    driver->cosIn = block[stream->blockSize - 1].cosIn;
+    Ifx_AngleTrkF32_updateStatus(angleTrk, driver->sinIn, driver->cosIn);
+
+    /* time of the last sample of the block: the last DSADC result, minus the samples of the next block */
+    tsRdc      = driver->hardware.rdcTimCh->GPR0.B.GPR0;
+    newSamples = (stream->blockSize - IfxDma_getChannelTransferCount(stream->sinDmaChannel.dma, stream->sinDmaChannel.channelId)) & (stream->blockSize - 1U);
+
+    /* publish the snapshot */
+    stream->sequence++;
+    __dsync();
+    stream->snapshot.angle      = angleTrk->angleEst;
+    stream->snapshot.loopSpeed  = Ifx_AngleTrkF32_getLoopSpeed(angleTrk);
+    stream->snapshot.speed      = Ifx_AngleTrkF32_getSpeed(angleTrk);
+    stream->snapshot.direction  = angleTrk->base.direction;
+    stream->snapshot.status     = angleTrk->base.status;
+    stream->snapshot.timestamp  = (tsRdc - (newSamples * driver->timestamp.maxTicks)) & IFXDSADC_RDC_TIMESTAMP_MASK;
+    stream->snapshot.blockCount = blockCount;
+    __dsync();
+    stream->sequence++;
+
+    return TRUE;
+}
+
+
 void IfxDsadc_Rdc_reset(IfxDsadc_Rdc *driver)
 {
     Ifx_AngleTrkF32_reset(&driver->angleTrk);
@@ -478,6 +728,19 @@ boolean IfxDsadc_Rdc_stdIfPosInit(IfxStdIf_Pos *stdif, IfxDsadc_Rdc *driver)
 	stdif->onEventA            =(IfxStdIf_Pos_OnEventA               )&IfxDsadc_Rdc_onEventA;
     /* *INDENT-ON* */
 
+    if (driver->stream.enabled != FALSE)
+    {
+        /* stream mode: the outputs are read from the snapshot */
+        stdif->getAbsolutePosition = (IfxStdIf_Pos_GetAbsolutePosition)&IfxDsadc_Rdc_getStreamAbsolutePosition;
+        stdif->getDirection        = (IfxStdIf_Pos_GetDirection)&IfxDsadc_Rdc_getStreamDirection;
+        stdif->getFault            = (IfxStdIf_Pos_GetFault)&IfxDsadc_Rdc_getStreamFault;
+        stdif->getPosition         = (IfxStdIf_Pos_GetPosition)&IfxDsadc_Rdc_getStreamPosition;
+        stdif->getRawPosition      = (IfxStdIf_Pos_GetRawPosition)&IfxDsadc_Rdc_getStreamRawPosition;
+        stdif->getSpeed            = (IfxStdIf_Pos_GetSpeed)&IfxDsadc_Rdc_getStreamSpeed;
+        stdif->update              = (IfxStdIf_Pos_Update)&IfxDsadc_Rdc_updateStream;
+        stdif->onEventA            = (IfxStdIf_Pos_OnEventA)NULL_PTR;
+    }
+
     return TRUE;
 }
 
@@ -537,3 +800,29 @@ void IfxDsadc_Rdc_update(IfxDsadc_Rdc *driver)
         base->rawPosition = newPosition;
     }
 }
+
+
+void IfxDsadc_Rdc_updateStream(IfxDsadc_Rdc *driver)
+{
+    IfxDsadc_Rdc_Stream   *stream = &driver->stream;
+    Ifx_AngleTrkF32_PosIf *base   = &(driver->angleTrk).base;
+    float32                angleOut;
+
+    IfxDsadc_Rdc_getSnapshot(driver, &stream->reader);
+    angleOut = stream->reader.angle;
+
+    /* angular component since the last sample, if time-stamping is enabled */
+    if (driver->timestamp.enabled != FALSE)
+    {
+        uint32 tsPwm      = driver->hardware.pwmTimCh->GPR0.B.GPR0;
+        uint32 clockTicks = (tsPwm - stream->reader.timestamp) & IFXDSADC_RDC_TIMESTAMP_MASK;
+        angleOut = angleOut + (driver->timestamp.clockPeriod * (float32)clockTicks * stream->reader.loopSpeed);
+    }
+
+    /* final output estimation */
+    {
+        IfxStdIf_Pos_RawAngle newPosition = (IfxStdIf_Pos_RawAngle)(angleOut * (base->resolution / 2) / IFX_PI);
+        newPosition         = (newPosition + base->offset) & (base->resolution - 1);
+        stream->rawPosition = newPosition;
+    }
+}
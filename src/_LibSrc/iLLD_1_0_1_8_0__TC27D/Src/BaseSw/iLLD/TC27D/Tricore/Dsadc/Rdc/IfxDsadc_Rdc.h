@@ -255,6 +255,52 @@
  * Configuration of the fault-detection (tolerance) boundary values and threshold are done
  * by user's call to IfxDsadc_Rdc_init().
  *
+ * \section sec_dsadc_rdc_stream DMA stream and secondary CPU
+ *
+ * With a high sample rate, calling IfxDsadc_Rdc_onEventA() and the observer for each sample
+ * takes a large part of the CPU running the control loop. When IfxDsadc_Rdc_Config.stream.dma
+ * is set, the driver runs in stream mode instead:
+ * - the result service requests of the SIN and COS channels are routed to two DMA channels,
+ *   which store each sample as a \ref IfxDsadc_Rdc_Sample pair into a double buffer of
+ *   2 * blockSize samples. No CPU is interrupted per sample
+ * - at the end of each block, the DMA raises the block interrupt on the tracking CPU (e.g. CPU1),
+ *   whose service routine calls IfxDsadc_Rdc_isrStream(). IfxDsadc_Rdc_processStream() then
+ *   runs the observer over all samples of the block with the group delay correction, and
+ *   publishes a \ref IfxDsadc_Rdc_Snapshot
+ * - the control loop (e.g. CPU0) reads the snapshot at any time without lock with
+ *   IfxDsadc_Rdc_getSnapshot(), or through the standard interface: IfxDsadc_Rdc_stdIfPosInit()
+ *   installs IfxDsadc_Rdc_updateStream() as update function, which extrapolates the angle of the
+ *   last sample to the application's PWM timestamp.
+ *
+ * The snapshot is protected by a sequence counter: the writer makes it odd while updating the
+ * snapshot, and the reader copies the snapshot until it reads the same even counter before and
+ * after the copy. The writer never waits, the reader retries at most when a block completes
+ * during its copy.
+ *
+ * In stream mode:
+ * - IfxDsadc_Rdc_init() must be called by the tracking CPU, the sample buffer must be located
+ *   in its DSPR and aligned to its size in bytes
+ * - the IfxDsadc_Rdc object must be located in a memory which is not cached, e.g. a DSPR
+ * - IfxDsadc_Rdc_onEventA() and IfxDsadc_Rdc_update() must not be used, and
+ *   IfxDsadc_Rdc_reset(), IfxDsadc_Rdc_resetFaults() and IfxDsadc_Rdc_setOffset() must be
+ *   called by the tracking CPU
+ * - the observer runs at the DSADC sample rate, IfxDsadc_Rdc_Config.userTs is not used
+ * - IfxDsadc_Rdc_getSnapshot() must not be called from an interrupt which can preempt
+ *   IfxDsadc_Rdc_processStream() on the same CPU
+ *
+ * \code
+ * // CPU1: block interrupt, ISR_PRIORITY_RDC_BLOCK serviced by IfxSrc_Tos_cpu1
+ * IFX_INTERRUPT(rdcBlockIsr, 1, ISR_PRIORITY_RDC_BLOCK)
+ * {
+ *     IfxDsadc_Rdc_isrStream(&rdcHandle);
+ *     IfxDsadc_Rdc_processStream(&rdcHandle);
+ * }
+ *
+ * // CPU0: current control loop
+ * IfxStdIf_Pos_update(&rdcStdIf);
+ * elAngle = IfxStdIf_Pos_getRawPosition(&rdcStdIf);
+ * \endcode
+ *
  * \defgroup IfxLld_Dsadc_Rdc RDC
  * \ingroup IfxLld_Dsadc
  * \defgroup IfxLld_Dsadc_Rdc_variable Variables
@@ -267,6 +313,8 @@
  * \ingroup IfxLld_Dsadc_Rdc
  * \defgroup IfxLld_Dsadc_Rdc_func_utility Utility Functions
  * \ingroup IfxLld_Dsadc_Rdc
+ * \defgroup IfxLld_Dsadc_Rdc_func_stream Stream Functions
+ * \ingroup IfxLld_Dsadc_Rdc
  */
 
 #ifndef IFXDSADC_RDC_H
@@ -279,6 +327,7 @@
 #include "SysSe/Math/Ifx_AngleTrkF32.h"
 #include "Dsadc/Dsadc/IfxDsadc_Dsadc.h"
 #include "Gtm/Std/IfxGtm_Tim.h"
+#include "Dma/Dma/IfxDma_Dma.h"
 #include "_PinMap/IfxGtm_PinMap.h"
 #include "Ifx_Cfg.h"
 
@@ -354,6 +403,59 @@ typedef struct
     float32 clockPeriod;       /**< \brief Period of absolute time clock (in second) */
 } IfxDsadc_Rdc_Ts;
 
+/** \brief Resolver sample stored by the DMA in stream mode
+ */
+typedef struct
+{
+    sint16 sinIn;        /**< \brief SIN channel result */
+    sint16 cosIn;        /**< \brief COS channel result */
+} IfxDsadc_Rdc_Sample;
+
+/** \brief Observer outputs published after each block in stream mode
+ */
+typedef struct
+{
+    float32             angle;            /**< \brief Electrical angle at the last sample of the block (in radian), group delay compensated */
+    float32             loopSpeed;        /**< \brief Observer speed, used for the extrapolation (in rad/s) */
+    float32             speed;            /**< \brief Filtered speed (in rad/s) */
+    IfxStdIf_Pos_Dir    direction;        /**< \brief Rotation direction */
+    IfxStdIf_Pos_Status status;           /**< \brief Fault status of the last sample */
+    uint32              timestamp;        /**< \brief Absolute time of the last sample (in ticks of absolute time clock) */
+    uint32              blockCount;       /**< \brief Number of processed blocks */
+} IfxDsadc_Rdc_Snapshot;
+
+/** \brief DMA sample stream handle
+ */
+typedef struct
+{
+    boolean               enabled;            /**< \brief TRUE if the driver runs in stream mode */
+    IfxDma_Dma_Channel    sinDmaChannel;      /**< \brief DMA channel moving the SIN results, raises the block interrupt */
+    IfxDma_Dma_Channel    cosDmaChannel;      /**< \brief DMA channel moving the COS results */
+    IfxDsadc_Rdc_Sample  *buffer;             /**< \brief Double buffer of 2 * blockSize samples */
+    uint16                blockSize;          /**< \brief Number of samples per block */
+    boolean               polled;             /**< \brief TRUE if the block end is polled by IfxDsadc_Rdc_processStream() */
+    volatile uint32       blockCount;         /**< \brief Number of blocks filled since the initialisation */
+    uint32                readCount;          /**< \brief Number of blocks processed or skipped */
+    uint32                overrunCount;       /**< \brief Number of blocks overwritten before they were processed */
+    volatile uint32       sequence;           /**< \brief Snapshot sequence counter, odd while the snapshot is written */
+    IfxDsadc_Rdc_Snapshot snapshot;           /**< \brief Snapshot written by IfxDsadc_Rdc_processStream() */
+    IfxDsadc_Rdc_Snapshot reader;             /**< \brief Copy of the snapshot read by IfxDsadc_Rdc_updateStream() */
+    IfxStdIf_Pos_RawAngle rawPosition;        /**< \brief Position computed by IfxDsadc_Rdc_updateStream() */
+} IfxDsadc_Rdc_Stream;
+
+/** \brief DMA sample stream configuration
+ */
+typedef struct
+{
+    IfxDma_Dma          *dma;                  /**< \brief Pointer to the DMA driver. If NULL_PTR, the stream mode is not used */
+    IfxDma_ChannelId     sinDmaChannelId;      /**< \brief DMA channel of the SIN results, also the priority of its service request. Must not be 0 */
+    IfxDma_ChannelId     cosDmaChannelId;      /**< \brief DMA channel of the COS results, also the priority of its service request. Must not be 0 */
+    IfxDsadc_Rdc_Sample *buffer;               /**< \brief Double buffer of 2 * blockSize samples, aligned to its size in bytes, in the DSPR of the tracking CPU */
+    uint16               blockSize;            /**< \brief Number of samples per block: power of 2, max 4096 */
+    Ifx_Priority         blockPriority;        /**< \brief Interrupt priority of the block ready interrupt, if 0 the block end is polled by IfxDsadc_Rdc_processStream() */
+    IfxSrc_Tos           blockServProvider;    /**< \brief Interrupt service provider of the block ready interrupt, i.e. the tracking CPU */
+} IfxDsadc_Rdc_StreamConfig;
+
 /** \} */
 
 /** \addtogroup IfxLld_Dsadc_Rdc_structures
@@ -362,13 +464,14 @@ typedef struct
  */
 typedef struct
 {
-    Ifx_AngleTrkF32 angleTrk;
-    sint16          sinIn;
-    sint16          cosIn;
-    float32         updatePeriod;
-    float32         groupDelay;
-    IfxDsadc_Rdc_Hw hardware;
-    IfxDsadc_Rdc_Ts timestamp;
+    Ifx_AngleTrkF32     angleTrk;
+    sint16              sinIn;
+    sint16              cosIn;
+    float32             updatePeriod;
+    float32             groupDelay;
+    IfxDsadc_Rdc_Hw     hardware;
+    IfxDsadc_Rdc_Ts     timestamp;
+    IfxDsadc_Rdc_Stream stream;          /**< \brief DMA sample stream, see \ref sec_dsadc_rdc_stream */
 } IfxDsadc_Rdc;
 
 /** \brief DSADC RDC configuration structure
@@ -376,20 +479,21 @@ typedef struct
  */
 typedef struct
 {
-    float32               kp;                      /**< \brief Observer proportional gain */
-    float32               ki;                      /**< \brief Observer integral gain */
-    float32               kd;                      /**< \brief Observer differential gain */
-    float32               speedLpfFc;              /**< \brief Cut-off frequency of speed low-pass filter (in Hertz). */
-    float32               errorThreshold;          /**< \brief Threshold of error value in the tracking loop (in radian) */
-    float32               userTs;                  /**< \brief Sampling period of the application */
-    sint32                sqrAmplMax;              /**< \brief Maximum value for square of signal amplitudes */
-    sint32                sqrAmplMin;              /**< \brief Minimum value for square of signal amplitudes */
-    uint16                periodPerRotation;       /**< \brief Number of electrical periods per mechanical rotation */
-    boolean               reversed;                /**< \brief TRUE: reversed direction, FALSE: straight direction */
-    sint32                resolution;              /**< \brief Sensor resolution */
-    IfxStdIf_Pos_RawAngle offset;                  /**< \brief Offset in ticks. [0 .. (\ref IfxDsadc_Rdc_Config.resolution - 1)] */
-    IfxDsadc_Rdc_ConfigHw hardware;                /**< \brief Pointer to hardware config. */
-    IfxDsadc_Dsadc       *dsadc;                   /**< \brief Pointer to the DSADC driver */
+    float32                   kp;                       /**< \brief Observer proportional gain */
+    float32                   ki;                       /**< \brief Observer integral gain */
+    float32                   kd;                       /**< \brief Observer differential gain */
+    float32                   speedLpfFc;               /**< \brief Cut-off frequency of speed low-pass filter (in Hertz). */
+    float32                   errorThreshold;           /**< \brief Threshold of error value in the tracking loop (in radian) */
+    float32                   userTs;                   /**< \brief Sampling period of the application */
+    sint32                    sqrAmplMax;               /**< \brief Maximum value for square of signal amplitudes */
+    sint32                    sqrAmplMin;               /**< \brief Minimum value for square of signal amplitudes */
+    uint16                    periodPerRotation;        /**< \brief Number of electrical periods per mechanical rotation */
+    boolean                   reversed;                 /**< \brief TRUE: reversed direction, FALSE: straight direction */
+    sint32                    resolution;               /**< \brief Sensor resolution */
+    IfxStdIf_Pos_RawAngle     offset;                   /**< \brief Offset in ticks. [0 .. (\ref IfxDsadc_Rdc_Config.resolution - 1)] */
+    IfxDsadc_Rdc_ConfigHw     hardware;                 /**< \brief Pointer to hardware config. */
+    IfxDsadc_Dsadc           *dsadc;                    /**< \brief Pointer to the DSADC driver */
+    IfxDsadc_Rdc_StreamConfig stream;                   /**< \brief DMA sample stream configuration, see \ref sec_dsadc_rdc_stream */
 } IfxDsadc_Rdc_Config;
 
 /** \} */
@@ -537,6 +641,7 @@ IFX_EXTERN void IfxDsadc_Rdc_setOffset(IfxDsadc_Rdc *driver, sint32 offset);
 IFX_EXTERN void IfxDsadc_Rdc_setRefreshPeriod(IfxDsadc_Rdc *driver, float32 updatePeriod);
 
 /** \brief Initializes the standard interface "Pos"
+ * In stream mode, the update and output functions read the snapshot, see \ref sec_dsadc_rdc_stream
  * \param stdif Standard interface position object
  * \param driver Virtual position sensor
  * \return TRUE on success else FALSE
@@ -577,6 +682,88 @@ IFX_EXTERN void IfxDsadc_Rdc_startConversion(IfxDsadc_Rdc *driver);
 
 /** \} */
 
+/** \addtogroup IfxLld_Dsadc_Rdc_func_stream
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Handle the block ready interrupt in stream mode. Must be called first from the interrupt
+ * with the priority IfxDsadc_Rdc_StreamConfig.blockPriority, on the tracking CPU
+ * \param driver Driver handle
+ * \return None
+ */
+IFX_INLINE void IfxDsadc_Rdc_isrStream(IfxDsadc_Rdc *driver);
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Copy the last published snapshot, without lock. Can be called at any time by any CPU
+ * \param driver Driver handle
+ * \param snapshot Copy of the snapshot
+ * \return None
+ */
+IFX_EXTERN void IfxDsadc_Rdc_getSnapshot(IfxDsadc_Rdc *driver, IfxDsadc_Rdc_Snapshot *snapshot);
+
+/** \brief \see IfxStdIf_Pos_GetAbsolutePosition, in stream mode
+ * \param driver Driver handle
+ * \return Absolute position
+ */
+IFX_EXTERN float32 IfxDsadc_Rdc_getStreamAbsolutePosition(IfxDsadc_Rdc *driver);
+
+/** \brief \see IfxStdIf_Pos_GetDirection, in stream mode
+ * \param driver Driver handle
+ * \return Direction
+ */
+IFX_EXTERN IfxStdIf_Pos_Dir IfxDsadc_Rdc_getStreamDirection(IfxDsadc_Rdc *driver);
+
+/** \brief \see IfxStdIf_Pos_GetFault, in stream mode
+ * \param driver Driver handle
+ * \return Fault
+ */
+IFX_EXTERN IfxStdIf_Pos_Status IfxDsadc_Rdc_getStreamFault(IfxDsadc_Rdc *driver);
+
+/** \brief \see IfxStdIf_Pos_GetPosition, in stream mode
+ * \param driver Driver handle
+ * \return Position
+ */
+IFX_EXTERN float32 IfxDsadc_Rdc_getStreamPosition(IfxDsadc_Rdc *driver);
+
+/** \brief \see IfxStdIf_Pos_GetRawPosition, in stream mode
+ * \param driver Driver handle
+ * \return Position in ticks
+ */
+IFX_EXTERN IfxStdIf_Pos_RawAngle IfxDsadc_Rdc_getStreamRawPosition(IfxDsadc_Rdc *driver);
+
+/** \brief \see IfxStdIf_Pos_GetSpeed, in stream mode
+ * \param driver Driver handle
+ * \return speed
+ */
+IFX_EXTERN float32 IfxDsadc_Rdc_getStreamSpeed(IfxDsadc_Rdc *driver);
+
+/** \brief Run the tracking observer and the fault detection over the last filled block, then
+ * publish the snapshot. To be called by the tracking CPU after IfxDsadc_Rdc_isrStream(), or
+ * periodically with blockPriority = 0.
+ *
+ * If more than one block has been filled since the last call, the older blocks are skipped and
+ * counted in IfxDsadc_Rdc_Stream.overrunCount.
+ * \param driver Driver handle
+ * \return TRUE if a block has been processed
+ */
+IFX_EXTERN boolean IfxDsadc_Rdc_processStream(IfxDsadc_Rdc *driver);
+
+/** \brief \see IfxStdIf_Pos_Update, in stream mode
+ * Copies the snapshot and extrapolates its angle to the last application's PWM timestamp.
+ * To be executed at user's application interrupt or task, e.g. motor control
+ * \param driver Driver handle
+ * \return None
+ */
+IFX_EXTERN void IfxDsadc_Rdc_updateStream(IfxDsadc_Rdc *driver);
+
+/** \} */
+
 /******************************************************************************/
 /*---------------------Inline Function Implementations------------------------*/
 /******************************************************************************/
@@ -612,4 +799,11 @@ IFX_INLINE float32 IfxDsadc_Rdc_getTimestamp(IfxDsadc_Rdc *driver)
 }
 
 
+IFX_INLINE void IfxDsadc_Rdc_isrStream(IfxDsadc_Rdc *driver)
+{
+    IfxDma_Dma_clearChannelInterrupt(&driver->stream.sinDmaChannel);
+    driver->stream.blockCount++;
+}
+
+
 #endif /* IFXDSADC_RDC_H */
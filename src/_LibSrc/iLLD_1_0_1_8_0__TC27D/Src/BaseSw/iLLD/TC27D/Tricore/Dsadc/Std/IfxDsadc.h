@@ -384,6 +384,14 @@ typedef enum
 /*-------------------------Inline Function Prototypes-------------------------*/
 /******************************************************************************/
 
+/** \brief Sets the integrator trigger mode of a channel, keeping its trigger selection
+ * \param dsadc pointer to DSADC registers
+ * \param channel channel number
+ * \param mode integrator trigger mode. Switch to \ref IfxDsadc_IntegratorTrigger_bypassed first before selecting another mode
+ * \return None
+ */
+IFX_INLINE void IfxDsadc_setIntegratorTrigger(Ifx_DSADC *dsadc, IfxDsadc_ChannelId channel, IfxDsadc_IntegratorTrigger mode);
+
 /** \brief Sets the sensitivity of the module to sleep signal
  * \param dsadc pointer to DSADC registers
  * \param mode mode selection (enable/disable)
@@ -719,6 +727,19 @@ IFX_INLINE void IfxDsadc_setCarrierMode(Ifx_DSADC *dsadc, IfxDsadc_CarrierWavefo
 }
 
 
+IFX_INLINE void IfxDsadc_setIntegratorTrigger(Ifx_DSADC *dsadc, IfxDsadc_ChannelId channel, IfxDsadc_IntegratorTrigger mode)
+{
+    Ifx_DSADC_CH_DICFG dicfg;
+
+    dicfg.U                    = dsadc->CH[channel].DICFG.U;
+    dicfg.B.ITRMODE            = mode;
+    dicfg.B.TRWC               = 1; // enable write access for the trigger bitfields only
+    dicfg.B.DSWC               = 0;
+    dicfg.B.SCWC               = 0;
+    dsadc->CH[channel].DICFG.U = dicfg.U;
+}
+
+
 IFX_INLINE void IfxDsadc_setSleepMode(Ifx_DSADC *dsadc, IfxDsadc_SleepMode mode)
 {
     uint16 passwd = IfxScuWdt_getCpuWatchdogPassword();
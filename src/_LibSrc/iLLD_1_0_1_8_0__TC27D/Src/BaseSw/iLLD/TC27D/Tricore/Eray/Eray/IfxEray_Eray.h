@@ -475,6 +475,56 @@
  * }
  * \endcode
  *
+ * \section IfxLld_Eray_Eray_BulkUsage Bulk Transfer with DMA
+ *
+ * With many static slots, copying the message buffers one by one through the output / input buffer costs
+ * the CPU two busy waits per frame. A bulk transfer moves a list of message buffers in one DMA job: the
+ * DMA channel is triggered by the output (receive) or input (transmit) buffer busy service request, and
+ * for each message buffer it writes the buffer command registers, then copies the header and data
+ * sections between the buffer and a frame image in the RAM. The CPU only starts the job, typically from
+ * the cycle start interrupt, and is notified at the end of the job.
+ *
+ * The OBUSY / IBUSY service requests are used by the DMA, they shall not be enabled in
+ * IfxEray_Eray_Config::interrupt, and the output / input buffer shall not be used by the CPU while a job is running.
+ * The frames and the linked list shall be located in the DSPR of the CPU calling \ref IfxEray_Eray_Bulk_init().
+ *
+ * \code
+ * #define ERAY_RX_SLOTS 8
+ *
+ * static const IfxEray_Eray_BulkSlot rxSlots[ERAY_RX_SLOTS] = {
+ *     // bufferIndex, payloadLength (double bytes)
+ *     {8, 16}, {9, 16}, {10, 16}, {11, 16}, {12, 8}, {13, 8}, {14, 8}, {15, 8},
+ * };
+ * static IfxEray_Eray_BulkFrame rxFrames[ERAY_RX_SLOTS];
+ * static Ifx_DMA_CH             rxLinkedList[3 * ERAY_RX_SLOTS] __attribute__ ((aligned(32)));
+ * static IfxEray_Eray_Bulk      rxBulk;
+ *
+ * IfxEray_Eray_BulkConfig bulkConfig;
+ * IfxEray_Eray_Bulk_initConfig(&bulkConfig, &eray);
+ * bulkConfig.direction    = IfxEray_Eray_BulkDirection_receive;
+ * bulkConfig.slots        = rxSlots;
+ * bulkConfig.slotCount    = ERAY_RX_SLOTS;
+ * bulkConfig.frames       = rxFrames;
+ * bulkConfig.linkedList   = rxLinkedList;
+ * bulkConfig.dma          = &dma;
+ * bulkConfig.dmaChannelId = IfxDma_ChannelId_5;
+ * bulkConfig.jobPriority  = IFX_ERAY_BULK_PRIO;
+ * IfxEray_Eray_Bulk_init(&rxBulk, &bulkConfig);
+ *
+ * // cycle start interrupt (INT0, SIR.CAS / CYCS)
+ * IfxEray_Eray_Bulk_start(&rxBulk);
+ *
+ * IFX_INTERRUPT(erayBulkISR, 0, IFX_ERAY_BULK_PRIO)
+ * {
+ *     IfxEray_Eray_Bulk_isr(&rxBulk);
+ *     // rxFrames[] holds the headers, status and data of the last cycle
+ * }
+ * \endcode
+ *
+ * When only a few frames are read from the receive FIFO, \ref IfxEray_Eray_receiveFifoFrames() reads them
+ * in one call, the transfer of the next frame to the output buffer shadow overlapping the copy of the
+ * current one.
+ *
  * \defgroup IfxLld_Eray_Eray ERAY
  * \ingroup IfxLld_Eray
  * \defgroup IfxLld_Eray_Eray_Structures Data Structures
@@ -489,6 +539,8 @@
  * \ingroup IfxLld_Eray_Eray
  * \defgroup IfxLld_Eray_Eray_Interrupt Interrupt Functions
  * \ingroup IfxLld_Eray_Eray
+ * \defgroup IfxLld_Eray_Eray_Bulk Bulk Transfer Functions
+ * \ingroup IfxLld_Eray_Eray
  */
 
 #ifndef IFXERAY_ERAY_H
@@ -502,6 +554,23 @@
 #include "Cpu/Std/IfxCpu.h"
 #include "Scu/Std/IfxScuWdt.h"
 #include "Scu/Std/IfxScuCcu.h"
+#include "Dma/Dma/IfxDma_Dma.h"
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+
+/** \addtogroup IfxLld_Eray_Eray_Bulk
+ * \{ */
+/** \brief Direction of a bulk transfer.
+ */
+typedef enum
+{
+    IfxEray_Eray_BulkDirection_receive  = 0,  /**< \brief message buffers copied to the frames through the output buffer. */
+    IfxEray_Eray_BulkDirection_transmit = 1   /**< \brief frames copied to the message buffers through the input buffer. */
+} IfxEray_Eray_BulkDirection;
+
+/** \} */
 
 /******************************************************************************/
 /*-----------------------------Data Structures--------------------------------*/
@@ -851,6 +920,64 @@ typedef struct
 
 /** \} */
 
+/** \addtogroup IfxLld_Eray_Eray_Structures
+ * \{ */
+/** \brief Frame image of a bulk transfer.
+ * The members are ordered as the output buffer registers, copied by the DMA in one move each.
+ */
+typedef struct
+{
+    uint32         commandMask;          /**< \brief internal: OBCM / IBCM value written by the DMA. */
+    uint32         commandRequest;       /**< \brief internal: OBCR / IBCR value written by the DMA. */
+    Ifx_ERAY_RDHS1 header1;              /**< \brief receive: header section 1 (frame ID, cycle code, channel filter). */
+    Ifx_ERAY_RDHS2 header2;              /**< \brief receive: header section 2 (header CRC, received payload length). */
+    Ifx_ERAY_RDHS3 header3;              /**< \brief receive: header section 3 (cycle count, frame indicators). */
+    Ifx_ERAY_MBS   status;               /**< \brief receive: message buffer status. transmit, last frame: input buffer command request at the end of the job. */
+    uint32         data[64];             /**< \brief data section. */
+} IfxEray_Eray_BulkFrame;
+
+/** \brief Message buffer of a bulk transfer.
+ */
+typedef struct
+{
+    uint8 bufferIndex;         /**< \brief buffer index in the Message RAM. */
+    uint8 payloadLength;       /**< \brief copied payload length in double bytes, 1 .. 127. */
+} IfxEray_Eray_BulkSlot;
+
+/** \brief Bulk transfer handle.
+ */
+typedef struct
+{
+    Ifx_ERAY                  *eray;              /**< \brief pointer to ERAY module registers. */
+    IfxDma_Dma_Channel         dmaChannel;        /**< \brief DMA channel executing the jobs. */
+    IfxEray_Eray_BulkDirection direction;         /**< \brief direction of the transfer. */
+    IfxEray_Eray_BulkFrame    *frames;            /**< \brief frame images, one per message buffer. */
+    uint8                      slotCount;         /**< \brief number of message buffers per job. */
+    uint8                      firstBufferIndex;  /**< \brief receive: message buffer requested by \ref IfxEray_Eray_Bulk_start(). */
+    boolean                    polled;            /**< \brief TRUE if the job end is polled by \ref IfxEray_Eray_Bulk_isBusy(). */
+    volatile uint32            jobCount;          /**< \brief number of completed jobs. */
+    uint32                     startCount;        /**< \brief number of started jobs. */
+    uint32                     overrunCount;      /**< \brief number of jobs not started because the previous one was still running. */
+} IfxEray_Eray_Bulk;
+
+/** \brief Bulk transfer configuration structure.
+ */
+typedef struct
+{
+    IfxEray_Eray                    *eray;             /**< \brief pointer to ERAY Module handle. */
+    IfxEray_Eray_BulkDirection       direction;        /**< \brief direction of the transfer. */
+    IFX_CONST IfxEray_Eray_BulkSlot *slots;            /**< \brief message buffers, in transfer order. */
+    uint8                            slotCount;        /**< \brief number of message buffers. */
+    IfxEray_Eray_BulkFrame          *frames;           /**< \brief slotCount frame images, located in the DSPR. */
+    Ifx_DMA_CH                      *linkedList;       /**< \brief receive: 3 * slotCount, transmit: 2 * slotCount + 1 transaction sets, aligned to 256 bit, located in the DSPR. */
+    IfxDma_Dma                      *dma;              /**< \brief pointer to the IfxDma_Dma module handle. */
+    IfxDma_ChannelId                 dmaChannelId;     /**< \brief DMA channel, also the priority of the buffer busy service request. Must not be 0. */
+    Ifx_Priority                     jobPriority;      /**< \brief interrupt priority of the job end, if 0 the job end is polled by \ref IfxEray_Eray_Bulk_isBusy(). */
+    IfxSrc_Tos                       jobServProvider;  /**< \brief interrupt service provider of the job end. */
+} IfxEray_Eray_BulkConfig;
+
+/** \} */
+
 /** \addtogroup IfxLld_Eray_Eray_Module
  * \{ */
 
@@ -1035,6 +1162,19 @@ IFX_INLINE void IfxEray_Eray_writeData(IfxEray_Eray *eray, uint32 *data, uint8 p
  */
 IFX_EXTERN void IfxEray_Eray_receiveFifoFrame(IfxEray_Eray *eray, IfxEray_Eray_ReceiveControl *config);
 
+/** \brief Reads the frames of the receive FIFO, up to a maximal number of frames.
+ * The transfer of each frame from the message RAM overlaps the copy of the previous one from the output buffer.
+ * \param eray pointer to ERAY Module handle.
+ * \param frames pointer to the received frames.
+ * \param count maximal number of frames.
+ * \param maxPayloadLength maximal payload length copied, in double bytes.
+ * \return number of frames read.
+ *
+ * For usage exapmle see : \ref IfxLld_Eray_Eray_BulkUsage
+ *
+ */
+IFX_EXTERN uint32 IfxEray_Eray_receiveFifoFrames(IfxEray_Eray *eray, IfxEray_Eray_ReceivedFrame *frames, uint32 count, Ifx_SizeT maxPayloadLength);
+
 /** \brief Transfers header and data from message buffer to output buffer.
  * \param eray pointer to ERAY Module handle.
  * \param config pointer to receive control structure.
@@ -1152,10 +1292,78 @@ IFX_INLINE void IfxEray_Eray_setNewDataInterruptDestination(IfxEray_Eray *eray,
 
 /** \} */
 
+/** \addtogroup IfxLld_Eray_Eray_Bulk
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Job end interrupt handler, to be called from the interrupt of IfxEray_Eray_BulkConfig::jobPriority.
+ * \param bulk pointer to the bulk transfer handle.
+ * \return None
+ *
+ * For usage exapmle see : \ref IfxLld_Eray_Eray_BulkUsage
+ *
+ */
+IFX_INLINE void IfxEray_Eray_Bulk_isr(IfxEray_Eray_Bulk *bulk);
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Initialises a bulk transfer: builds the DMA linked list and routes the buffer busy service request to the DMA.
+ * \param bulk pointer to the bulk transfer handle.
+ * \param config pointer to the bulk transfer configuration.
+ * \return FALSE if the configuration is not valid.
+ *
+ * For usage exapmle see : \ref IfxLld_Eray_Eray_BulkUsage
+ *
+ */
+IFX_EXTERN boolean IfxEray_Eray_Bulk_init(IfxEray_Eray_Bulk *bulk, const IfxEray_Eray_BulkConfig *config);
+
+/** \brief Initialises the bulk transfer configuration with default values.
+ * \param config pointer to the bulk transfer configuration.
+ * \param eray pointer to ERAY Module handle.
+ * \return None
+ */
+IFX_EXTERN void IfxEray_Eray_Bulk_initConfig(IfxEray_Eray_BulkConfig *config, IfxEray_Eray *eray);
+
+/** \brief Returns the state of the last job.
+ * \param bulk pointer to the bulk transfer handle.
+ * \return TRUE while the last started job is running.
+ */
+IFX_EXTERN boolean IfxEray_Eray_Bulk_isBusy(IfxEray_Eray_Bulk *bulk);
+
+/** \brief Starts a job, typically from the cycle start interrupt.
+ * Receive: the frames are copied from the message buffers. Transmit: the frames shall be ready, they are
+ * copied to the message buffers and their transmission is requested.
+ * \param bulk pointer to the bulk transfer handle.
+ * \return FALSE if the previous job is still running, the job is then not started.
+ *
+ * For usage exapmle see : \ref IfxLld_Eray_Eray_BulkUsage
+ *
+ */
+IFX_EXTERN boolean IfxEray_Eray_Bulk_start(IfxEray_Eray_Bulk *bulk);
+
+/** \brief Stops the bulk transfer: disables the DMA channel and the buffer busy service request.
+ * \param bulk pointer to the bulk transfer handle.
+ * \return None
+ */
+IFX_EXTERN void IfxEray_Eray_Bulk_stop(IfxEray_Eray_Bulk *bulk);
+
+/** \} */
+
 /******************************************************************************/
 /*---------------------Inline Function Implementations------------------------*/
 /******************************************************************************/
 
+IFX_INLINE void IfxEray_Eray_Bulk_isr(IfxEray_Eray_Bulk *bulk)
+{
+    bulk->jobCount++;
+}
+
+
 IFX_INLINE boolean IfxEray_Eray_allowColdStart(IfxEray_Eray *eray)
 {
     return IfxEray_changePocState(eray->eray, IfxEray_PocCommand_coldStart);
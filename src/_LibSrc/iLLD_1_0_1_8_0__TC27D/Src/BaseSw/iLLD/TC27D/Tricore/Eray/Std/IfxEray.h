@@ -510,6 +510,32 @@ IFX_INLINE volatile Ifx_SRC_SRCR *IfxEray_getTimerInterrupt0SrcPtr(Ifx_ERAY *era
  */
 IFX_INLINE volatile Ifx_SRC_SRCR *IfxEray_getTimerInterrupt1SrcPtr(Ifx_ERAY *eray);
 
+/** \brief Selects the interrupt line INT0 or INT1 of a status interrupt.
+ * \param eray pointer to ERAY module registers.
+ * \param statusFlag status interrupt which should be configured.
+ * \param line interrupt line, 0 for INT0, 1 for INT1.
+ * \return None
+ */
+IFX_INLINE void IfxEray_setStatusInterruptLine(Ifx_ERAY *eray, IfxEray_ClearStatusFlag statusFlag, uint8 line);
+
+/** \brief Starts the absolute timer 0, which raises SIR.TI0 and the TINT0 service request.
+ *
+ * The timer elapses when the macrotick macrotickOffset is reached in a cycle of the cycle set. The timer is
+ * halted by the hardware when the controller leaves the NORMAL_ACTIVE and NORMAL_PASSIVE states.
+ * \param eray pointer to ERAY module registers.
+ * \param cycleCode cycle set: cycle repetition (power of 2) + cycle offset, 1 for every cycle.
+ * \param macrotickOffset macrotick of the cycle at which the timer elapses.
+ * \param continuous TRUE: continuous mode, FALSE: single shot mode, the timer is halted after it elapsed.
+ * \return None
+ */
+IFX_INLINE void IfxEray_startTimer0(Ifx_ERAY *eray, uint8 cycleCode, uint16 macrotickOffset, boolean continuous);
+
+/** \brief Halts the absolute timer 0.
+ * \param eray pointer to ERAY module registers.
+ * \return None
+ */
+IFX_INLINE void IfxEray_stopTimer0(Ifx_ERAY *eray);
+
 /******************************************************************************/
 /*-------------------------Global Function Prototypes-------------------------*/
 /******************************************************************************/
@@ -641,6 +667,12 @@ IFX_EXTERN void IfxEray_resetModule(Ifx_ERAY *eray);
 /*-------------------------Inline Function Prototypes-------------------------*/
 /******************************************************************************/
 
+/** \brief Gets the cycle counter value (vCycleCounter), common to all nodes of the cluster.
+ * \param eray pointer to ERAY module registers.
+ * \return cycle counter value, 0 to 63.
+ */
+IFX_INLINE uint8 IfxEray_getCycleCount(Ifx_ERAY *eray);
+
 /** \brief Gets the FIFO status.
  * \param eray pointer to ERAY module registers.
  * \return FIFO status.
@@ -659,6 +691,12 @@ IFX_INLINE boolean IfxEray_getInputBufferBusyHostStatus(Ifx_ERAY *eray);
  */
 IFX_INLINE uint8 IfxEray_getInputBufferBusyShadowStatus(Ifx_ERAY *eray);
 
+/** \brief Gets the macrotick value (vMacrotick) in the current cycle, common to all nodes of the cluster.
+ * \param eray pointer to ERAY module registers.
+ * \return macrotick value.
+ */
+IFX_INLINE uint16 IfxEray_getMacrotick(Ifx_ERAY *eray);
+
 /** \brief Gets the output buffer index.
  * \param eray pointer to ERAY module registers.
  * \return output buffer index.
@@ -1224,6 +1262,12 @@ IFX_INLINE void IfxEray_enableModule(Ifx_ERAY *eray)
 }
 
 
+IFX_INLINE uint8 IfxEray_getCycleCount(Ifx_ERAY *eray)
+{
+    return (uint8)eray->MTCCV.B.CCV;
+}
+
+
 IFX_INLINE Ifx_ERAY_EIR IfxEray_getErrorInterrupts(Ifx_ERAY *eray)
 {
     Ifx_ERAY_EIR interruptFlags;
@@ -1276,6 +1320,12 @@ IFX_INLINE volatile Ifx_SRC_SRCR *IfxEray_getInterruptLine1SrcPtr(Ifx_ERAY *eray
 }
 
 
+IFX_INLINE uint16 IfxEray_getMacrotick(Ifx_ERAY *eray)
+{
+    return (uint16)eray->MTCCV.B.MTV;
+}
+
+
 IFX_INLINE boolean IfxEray_getMessageBufferInterruptStatus(Ifx_ERAY *eray, uint8 messageBuffer)
 {
     uint8           ix                     = messageBuffer / 32;
@@ -1714,6 +1764,19 @@ IFX_INLINE void IfxEray_setStaticSlots(Ifx_ERAY *eray, uint16 staticSlotLength,
 }
 
 
+IFX_INLINE void IfxEray_setStatusInterruptLine(Ifx_ERAY *eray, IfxEray_ClearStatusFlag statusFlag, uint8 line)
+{
+    if (line != 0)
+    {
+        eray->SILS.U |= (uint32)statusFlag;
+    }
+    else
+    {
+        eray->SILS.U &= ~(uint32)statusFlag;
+    }
+}
+
+
 IFX_INLINE void IfxEray_setStrobePosition(Ifx_ERAY *eray, IfxEray_StrobePosition strobePosition)
 {
     eray->PRTC1.B.SPP = strobePosition;
@@ -1789,6 +1852,30 @@ IFX_INLINE void IfxEray_setWakeupPatternChannel(Ifx_ERAY *eray, IfxEray_WakeupCh
 }
 
 
+IFX_INLINE void IfxEray_startTimer0(Ifx_ERAY *eray, uint8 cycleCode, uint16 macrotickOffset, boolean continuous)
+{
+    Ifx_ERAY_T0C t0c;
+
+    /* the mode, cycle code and offset are only written while the timer is halted */
+    eray->T0C.B.T0RC = 0;
+
+    t0c.U       = 0;
+    t0c.B.T0MS  = continuous ? 1 : 0;
+    t0c.B.T0CC  = cycleCode;
+    t0c.B.T0MO  = macrotickOffset;
+    eray->T0C.U = t0c.U;
+
+    t0c.B.T0RC  = 1;
+    eray->T0C.U = t0c.U;
+}
+
+
+IFX_INLINE void IfxEray_stopTimer0(Ifx_ERAY *eray)
+{
+    eray->T0C.B.T0RC = 0;
+}
+
+
 IFX_INLINE void IfxEray_waitForPocState(Ifx_ERAY *eray, IfxEray_PocState pocState)
 {
     while (eray->CCSV.B.POCS != (uint8)pocState)
@@ -98,11 +98,75 @@
 
 #define IFXETH_PHY_PEF7071_WAIT_GMII_READY() while (ETH_GMII_ADDRESS.B.GB) {}
 
+#define IFXETH_PHY_PEF7071_CTRL_RESET    0x8000 /* CTRL: software reset, self clearing */
+
+#define IFXETH_PHY_PEF7071_STAT_LINK     0x0004 /* STAT: link status, latched low */
+
+#define IFXETH_PHY_PEF7071_STAT_ANOK     0x0020 /* STAT: auto-negotiation complete */
+
+#define IFXETH_PHY_PEF7071_AN_100FD      0x0100 /* AN_ADV / AN_LPA: 100BASE-TX full duplex */
+
+#define IFXETH_PHY_PEF7071_AN_100HD      0x0080 /* AN_ADV / AN_LPA: 100BASE-TX half duplex */
+
+#define IFXETH_PHY_PEF7071_AN_10FD       0x0040 /* AN_ADV / AN_LPA: 10BASE-T full duplex */
+
+#define IFXETH_PHY_PEF7071_AN_ADVERTISE  0x01E1 /* AN_ADV: 10BASE-T and 100BASE-TX, full and half duplex, IEEE 802.3 */
+
+/******************************************************************************/
+/*------------------------------Type Definitions------------------------------*/
+/******************************************************************************/
+
+typedef struct
+{
+    uint32 regaddr;
+    uint32 data;
+} IfxEth_Phy_Pef7071_Setup;
+
 /******************************************************************************/
 /*-----------------------Exported Variables/Constants-------------------------*/
 /******************************************************************************/
 
-uint32 IfxEth_Phy_Pef7071_iPhyInitDone = 0;
+uint32                    IfxEth_Phy_Pef7071_iPhyInitDone = 0;
+
+IfxEth_Phy_Pef7071_Status IfxEth_Phy_Pef7071_status;
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+
+/* PHY setup after the reset, one MDIO write per process call */
+static const IfxEth_Phy_Pef7071_Setup IfxEth_Phy_Pef7071_setup[] = {
+    {IFXETH_PHY_PEF7071_MDIO_MIICTRL, 0xF702},                                   // skew adaptation is needed, RMII mode (10/100MBit)
+    {IFXETH_PHY_PEF7071_MDIO_GCTRL,   0x0000},                                   // advertise no 1000BASE-T (full/half duplex)
+    {IFXETH_PHY_PEF7071_MDIO_AN_ADV,  IFXETH_PHY_PEF7071_AN_ADVERTISE},          // advertise 10BASE-T and 100BASE-TX, full and half duplex
+    {IFXETH_PHY_PEF7071_MDIO_CTRL,    0x1200},                                   // enable auto-negotiation, restart auto-negotiation
+};
+
+/******************************************************************************/
+/*-----------------------Private Function Prototypes--------------------------*/
+/******************************************************************************/
+
+/** \brief Starts an MDIO read, the data is available in ETH_GMII_DATA when GMII_ADDRESS.GB is cleared
+ * \param layeraddr PHY address
+ * \param regaddr PHY register
+ * \return None
+ */
+IFX_STATIC void IfxEth_Phy_Pef7071_startRead(uint32 layeraddr, uint32 regaddr);
+
+/** \brief Starts an MDIO write, completed when GMII_ADDRESS.GB is cleared
+ * \param layeraddr PHY address
+ * \param regaddr PHY register
+ * \param data Register value
+ * \return None
+ */
+IFX_STATIC void IfxEth_Phy_Pef7071_startWrite(uint32 layeraddr, uint32 regaddr, uint32 data);
+
+/** \brief Reads a PHY register in two process calls: the 1st one starts the read, the 2nd one gets the data
+ * \param regaddr PHY register
+ * \param pdata Register value, set when the data is available
+ * \return TRUE if the data is available
+ */
+IFX_STATIC boolean IfxEth_Phy_Pef7071_poll(uint32 regaddr, uint32 *pdata);
 
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
@@ -110,61 +174,153 @@ uint32 IfxEth_Phy_Pef7071_iPhyInitDone = 0;
 
 uint32 IfxEth_Phy_Pef7071_init(void)
 {
-    IFXETH_PHY_PEF7071_WAIT_GMII_READY();
+    IfxEth_Phy_Pef7071_Status *status = &IfxEth_Phy_Pef7071_status;
 
-    /*  // read once all PHY registers
-     * int i;
-     * for(i = 0; i < 31; i++)
-     * {
-     * uint32 value;
-     * read_mdio_reg(0, i, &value);
-     * } */
+    status->state       = IfxEth_Phy_Pef7071_State_reset;
+    status->step        = 0;
+    status->readPending = FALSE;
+    status->link        = FALSE;
+    status->speed       = IfxEth_LinkSpeed_100Mbps;
+    status->fullDuplex  = TRUE;
 
-    // reset PHY
-    IfxEth_Phy_Pef7071_write_mdio_reg(0, IFXETH_PHY_PEF7071_MDIO_CTRL, 0x8000);   // reset
-    uint32 value;
+    IfxEth_Phy_Pef7071_iPhyInitDone = 0;
 
-    do
+    // reset PHY, the setup and the auto-negotiation continue in IfxEth_Phy_Pef7071_process()
+    if (ETH_GMII_ADDRESS.B.GB == 0)
     {
-        IfxEth_Phy_Pef7071_read_mdio_reg(0, IFXETH_PHY_PEF7071_MDIO_CTRL, &value);
-    } while (value & 0x8000);                                                      // wait for reset to finish
-
-    // setup PHY
-    IfxEth_Phy_Pef7071_write_mdio_reg(0, IFXETH_PHY_PEF7071_MDIO_MIICTRL, 0xF702); // skew adaptation is needed, RMII mode (10/100MBit)
-    IfxEth_Phy_Pef7071_write_mdio_reg(0, IFXETH_PHY_PEF7071_MDIO_GCTRL, 0x0000);   // advertise no 1000BASE-T (full/half duplex)
-    IfxEth_Phy_Pef7071_write_mdio_reg(0, IFXETH_PHY_PEF7071_MDIO_AN_ADV, 0x0101);  // advertise 100BASE-TX full duplex only
-    IfxEth_Phy_Pef7071_write_mdio_reg(0, IFXETH_PHY_PEF7071_MDIO_CTRL, 0x1200);    // enable auto-negotiation, restart auto-negotiation
+        IfxEth_Phy_Pef7071_startWrite(0, IFXETH_PHY_PEF7071_MDIO_CTRL, IFXETH_PHY_PEF7071_CTRL_RESET);
+        status->state = IfxEth_Phy_Pef7071_State_waitReset;
+    }
 
     //  we set our loop mode (RJ45) in side the PHY (PHYCTL1 register) if we will have a loop
     //  if (CONFIG_ETH._loop)
     //  write_mdio_reg (0, 0x13, (0x4 << 13) | 0x1);
 
-    // done
-    IfxEth_Phy_Pef7071_iPhyInitDone = 1;
-
     return 1;
 }
 
 
 boolean IfxEth_Phy_Pef7071_link(void)
 {
-    boolean linkEstablished = FALSE;
+    return IfxEth_Phy_Pef7071_status.link;
+}
+
 
-    if (IfxEth_Phy_Pef7071_iPhyInitDone)
+IFX_STATIC boolean IfxEth_Phy_Pef7071_poll(uint32 regaddr, uint32 *pdata)
+{
+    IfxEth_Phy_Pef7071_Status *status = &IfxEth_Phy_Pef7071_status;
+    boolean                    ready  = status->readPending;
+
+    if (ready != FALSE)
     {
-        uint32 value;
-        IfxEth_Phy_Pef7071_read_mdio_reg(0, IFXETH_PHY_PEF7071_MDIO_STAT, &value);
-        linkEstablished = ((value & (1 << 2)) != 0) ? TRUE : FALSE;
+        *pdata              = ETH_GMII_DATA.U;
+        status->readPending = FALSE;
+    }
+    else
+    {
+        IfxEth_Phy_Pef7071_startRead(0, regaddr);
+        status->readPending = TRUE;
     }
 
-    return linkEstablished;
+    return ready;
+}
+
+
+void IfxEth_Phy_Pef7071_process(IfxEth *eth)
+{
+    IfxEth_Phy_Pef7071_Status *status = &IfxEth_Phy_Pef7071_status;
+    uint32                     value;
+
+    if (ETH_GMII_ADDRESS.B.GB != 0)
+    {
+        /* MDIO transaction of the previous call still running */
+        return;
+    }
+
+    switch (status->state)
+    {
+    case IfxEth_Phy_Pef7071_State_reset:
+        IfxEth_Phy_Pef7071_startWrite(0, IFXETH_PHY_PEF7071_MDIO_CTRL, IFXETH_PHY_PEF7071_CTRL_RESET);
+        status->state = IfxEth_Phy_Pef7071_State_waitReset;
+        break;
+
+    case IfxEth_Phy_Pef7071_State_waitReset:
+
+        if ((IfxEth_Phy_Pef7071_poll(IFXETH_PHY_PEF7071_MDIO_CTRL, &value) != FALSE) && ((value & IFXETH_PHY_PEF7071_CTRL_RESET) == 0))
+        {
+            status->state = IfxEth_Phy_Pef7071_State_setup;
+            status->step  = 0;
+        }
+
+        break;
+
+    case IfxEth_Phy_Pef7071_State_setup:
+        IfxEth_Phy_Pef7071_startWrite(0, IfxEth_Phy_Pef7071_setup[status->step].regaddr, IfxEth_Phy_Pef7071_setup[status->step].data);
+        status->step++;
+
+        if (status->step >= (sizeof(IfxEth_Phy_Pef7071_setup) / sizeof(IfxEth_Phy_Pef7071_setup[0])))
+        {
+            IfxEth_Phy_Pef7071_iPhyInitDone = 1;
+            status->state                   = IfxEth_Phy_Pef7071_State_linkDown;
+        }
+
+        break;
+
+    case IfxEth_Phy_Pef7071_State_linkDown:
+
+        if ((IfxEth_Phy_Pef7071_poll(IFXETH_PHY_PEF7071_MDIO_STAT, &value) != FALSE)
+            && ((value & (IFXETH_PHY_PEF7071_STAT_LINK | IFXETH_PHY_PEF7071_STAT_ANOK)) == (IFXETH_PHY_PEF7071_STAT_LINK | IFXETH_PHY_PEF7071_STAT_ANOK)))
+        {
+            status->state = IfxEth_Phy_Pef7071_State_resolve;
+        }
+
+        break;
+
+    case IfxEth_Phy_Pef7071_State_resolve:
+
+        if (IfxEth_Phy_Pef7071_poll(IFXETH_PHY_PEF7071_MDIO_AN_LPA, &value) != FALSE)
+        {
+            /* highest common ability, the MAC is idle while the link is down */
+            value &= IFXETH_PHY_PEF7071_AN_ADVERTISE;
+
+            status->speed      = ((value & (IFXETH_PHY_PEF7071_AN_100FD | IFXETH_PHY_PEF7071_AN_100HD)) != 0) ? IfxEth_LinkSpeed_100Mbps : IfxEth_LinkSpeed_10Mbps;
+            status->fullDuplex = ((value & IFXETH_PHY_PEF7071_AN_100FD) != 0)
+                                 || (((value & IFXETH_PHY_PEF7071_AN_100HD) == 0) && ((value & IFXETH_PHY_PEF7071_AN_10FD) != 0));
+
+            IfxEth_setLinkSpeed(eth, status->speed);
+            IfxEth_setDuplexMode(eth, status->fullDuplex);
+
+            status->link = TRUE;
+            status->linkChanges++;
+            status->state = IfxEth_Phy_Pef7071_State_linkUp;
+        }
+
+        break;
+
+    case IfxEth_Phy_Pef7071_State_linkUp:
+
+        if ((IfxEth_Phy_Pef7071_poll(IFXETH_PHY_PEF7071_MDIO_STAT, &value) != FALSE) && ((value & IFXETH_PHY_PEF7071_STAT_LINK) == 0))
+        {
+            /* the PHY restarts the auto-negotiation by itself */
+            status->link = FALSE;
+            status->linkChanges++;
+            status->state = IfxEth_Phy_Pef7071_State_linkDown;
+        }
+
+        break;
+
+    default:
+        /* IfxEth_Phy_Pef7071_init() not called */
+        break;
+    }
 }
 
 
 void IfxEth_Phy_Pef7071_read_mdio_reg(uint32 layeraddr, uint32 regaddr, uint32 *pdata)
 {
-    // 5bit Physical Layer Adddress, 5bit GMII Regnr, 4bit csrclock divider, Read, Busy
-    ETH_GMII_ADDRESS.U = (layeraddr << 11) | (regaddr << 6) | (0 << 2) | (0 << 1) | (1 << 0);
+    IFXETH_PHY_PEF7071_WAIT_GMII_READY();
+
+    IfxEth_Phy_Pef7071_startRead(layeraddr, regaddr);
 
     IFXETH_PHY_PEF7071_WAIT_GMII_READY();
 
@@ -173,13 +329,28 @@ void IfxEth_Phy_Pef7071_read_mdio_reg(uint32 layeraddr, uint32 regaddr, uint32 *
 }
 
 
-void IfxEth_Phy_Pef7071_write_mdio_reg(uint32 layeraddr, uint32 regaddr, uint32 data)
+IFX_STATIC void IfxEth_Phy_Pef7071_startRead(uint32 layeraddr, uint32 regaddr)
+{
+    // 5bit Physical Layer Adddress, 5bit GMII Regnr, 4bit csrclock divider, Read, Busy
+    ETH_GMII_ADDRESS.U = (layeraddr << 11) | (regaddr << 6) | (0 << 2) | (0 << 1) | (1 << 0);
+}
+
+
+IFX_STATIC void IfxEth_Phy_Pef7071_startWrite(uint32 layeraddr, uint32 regaddr, uint32 data)
 {
     // put data
     ETH_GMII_DATA.U = data;
 
     // 5bit Physical Layer Adddress, 5bit GMII Regnr, 4bit csrclock divider, Write, Busy
     ETH_GMII_ADDRESS.U = (layeraddr << 11) | (regaddr << 6) | (0 << 2) | (1 << 1) | (1 << 0);
+}
+
+
+void IfxEth_Phy_Pef7071_write_mdio_reg(uint32 layeraddr, uint32 regaddr, uint32 data)
+{
+    IFXETH_PHY_PEF7071_WAIT_GMII_READY();
+
+    IfxEth_Phy_Pef7071_startWrite(layeraddr, regaddr, data);
 
     IFXETH_PHY_PEF7071_WAIT_GMII_READY();
 }
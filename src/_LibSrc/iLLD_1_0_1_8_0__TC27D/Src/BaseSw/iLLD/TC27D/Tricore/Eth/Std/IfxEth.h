@@ -33,6 +33,86 @@
  * \ingroup IfxLld_Eth_Std
  * \defgroup IfxLld_Eth_Std_Enum Enumerations
  * \ingroup IfxLld_Eth_Std
+ * \defgroup IfxLld_Eth_Std_BufferPool Buffer Pool Functions
+ * \ingroup IfxLld_Eth_Std
+ *
+ * Zero-copy operation with a packet buffer pool (chain mode only)
+ *
+ * \ref IfxEth_initReceiveDescriptorsWithPool() attaches a buffer of the pool to each RX descriptor.
+ * \ref IfxEth_getReceivePacket() hands the buffer of a received frame to the caller and attaches a new
+ * buffer of the pool to the descriptor, the frame is not copied. The caller returns the buffer with
+ * \ref IfxEth_freeBuffer() when the frame has been processed. If the pool is empty, the frame is dropped
+ * and its buffer stays on the descriptor, so that the receiver never runs out of descriptors.
+ *
+ * \ref IfxEth_sendTransmitPacket() transmits a frame made of several segments (e.g. protocol header and
+ * payload), one chained TX descriptor per segment. Segments with IfxEth_TxSegment::pool set are returned to
+ * their pool by \ref IfxEth_reclaimTransmitBuffers() once the DMA has sent them.
+ *
+ * The pool functions replace IfxEth_getReceiveBuffer() / IfxEth_freeReceiveBuffer() resp.
+ * IfxEth_getTransmitBuffer() / IfxEth_sendTransmitBuffer() and shall not be mixed with them.
+ * \ref IfxEth_allocBuffer() and \ref IfxEth_freeBuffer() can be called from interrupts and tasks.
+ *
+ * \code
+ * static uint8             rxPoolMemory[32][IFXETH_RTX_BUFFER_SIZE];
+ * static uint8             txPoolMemory[32][IFXETH_RTX_BUFFER_SIZE];
+ * static IfxEth_BufferPool rxPool, txPool;
+ *
+ * IfxEth_initBufferPool(&rxPool, rxPoolMemory, IFXETH_RTX_BUFFER_SIZE, 32);
+ * IfxEth_initBufferPool(&txPool, txPoolMemory, IFXETH_RTX_BUFFER_SIZE, 32);
+ * IfxEth_initReceiveDescriptorsWithPool(&eth, &rxPool);
+ *
+ * // receive
+ * uint16 length;
+ * uint8 *frame = IfxEth_getReceivePacket(&eth, &length);
+ * if (frame != NULL_PTR)
+ * {
+ *     processFrame(frame, length);
+ *     IfxEth_freeBuffer(&rxPool, frame);
+ * }
+ *
+ * // transmit: static header, payload from the pool
+ * IfxEth_TxSegment segments[2] = {
+ *     {header,  sizeof(header), NULL_PTR},
+ *     {payload, payloadLength,  &txPool },
+ * };
+ * IfxEth_sendTransmitPacket(&eth, segments, 2);
+ *
+ * // TX interrupt or background task
+ * IfxEth_reclaimTransmitBuffers(&eth);
+ * \endcode
+ *
+ * \defgroup IfxLld_Eth_Std_Timestamp Timestamp Functions
+ * \ingroup IfxLld_Eth_Std
+ *
+ * IEEE 1588 system time and frame timestamps
+ *
+ * \ref IfxEth_initTimestamp() starts the system time of the ETH module in nanoseconds (digital rollover),
+ * with the fine correction: the addend register divides the PTP reference clock, so that the clock frequency
+ * can be corrected in steps of about 1 ppb with \ref IfxEth_adjustFrequency(). The time is set with
+ * \ref IfxEth_setTime() and corrected without stopping the clock with \ref IfxEth_adjustTime().
+ *
+ * The descriptors have the alternate size of 8 words, the DMA writes the timestamp of a frame in the words
+ * 6 and 7 of its (last) descriptor:
+ * - received frames: the PTP Sync messages (IEEE 1588 version 2 over ethernet or UDP/IPv4) are timestamped.
+ * \ref IfxEth_getReceivePacket() and IfxEth_pollReceive() save the timestamp, which is read with
+ * \ref IfxEth_getReceiveTimestamp() after IfxEth_getReceivePacket() resp. from the receive handler.
+ * - transmitted frames: \ref IfxEth_requestTransmitTimestamp() requests the timestamp of the next frame sent
+ * with \ref IfxEth_sendTransmitPacket(). It is saved by \ref IfxEth_reclaimTransmitBuffers() and read with
+ * \ref IfxEth_getTransmitTimestamp().
+ *
+ * \code
+ * IfxEth_initTimestamp(&eth, IfxScuCcu_getSpbFrequency());
+ *
+ * // transmit with timestamp
+ * IfxEth_requestTransmitTimestamp(&eth);
+ * IfxEth_sendTransmitPacket(&eth, segments, 1);
+ * ...
+ * IfxEth_Timestamp sent;
+ * if (IfxEth_getTransmitTimestamp(&eth, &sent) != FALSE)
+ * {
+ *     // sent.seconds, sent.nanoseconds
+ * }
+ * \endcode
  */
 
 #ifndef IFXET_H
@@ -74,9 +154,13 @@
 #define IFXETH_MAX_TX_BUFFERS  16
 #endif
 
-/** \brief 4 DWORDS (16 bytes)
+/** \brief 8 DWORDS (32 bytes), alternate descriptor size required for the timestamps
  */
-#define IFXETH_DESCR_SIZE      4
+#define IFXETH_DESCR_SIZE      8
+
+/** \brief Nanoseconds per second, rollover of the system time nanoseconds (digital rollover)
+ */
+#define IFXETH_NANOSECONDS_PER_SECOND (1000000000UL)
 
 /******************************************************************************/
 /*--------------------------------Enumerations--------------------------------*/
@@ -98,6 +182,15 @@ typedef enum
     IfxEth_DescriptorMode_ring    /**< \brief ring mode descriptors */
 } IfxEth_DescriptorMode;
 
+/** \brief Link speed of the MAC\n
+ * Definition in ETH_MAC_CONFIGURATION.FES
+ */
+typedef enum
+{
+    IfxEth_LinkSpeed_10Mbps  = 0, /**< \brief 10 Mbit/s */
+    IfxEth_LinkSpeed_100Mbps = 1  /**< \brief 100 Mbit/s */
+} IfxEth_LinkSpeed;
+
 /** \brief External Phy Interface RMII Mode
  */
 typedef enum
@@ -266,6 +359,34 @@ typedef union
     uint32 U;       /**< \brief unsigned long access */
 } IfxEth_RxDescr3;
 
+/** \brief Union for RX descriptor DWORD 4, extended status
+ */
+typedef union
+{
+    uint32 U;       /**< \brief unsigned long access */
+} IfxEth_RxDescr4;
+
+/** \brief Union for RX descriptor DWORD 5
+ */
+typedef union
+{
+    uint32 U;       /**< \brief unsigned long access */
+} IfxEth_RxDescr5;
+
+/** \brief Union for RX descriptor DWORD 6, timestamp nanoseconds
+ */
+typedef union
+{
+    uint32 U;       /**< \brief unsigned long access */
+} IfxEth_RxDescr6;
+
+/** \brief Union for RX descriptor DWORD 7, timestamp seconds
+ */
+typedef union
+{
+    uint32 U;       /**< \brief unsigned long access */
+} IfxEth_RxDescr7;
+
 /** \brief Union for TX descriptor DWORD 0
  */
 typedef union
@@ -296,6 +417,34 @@ typedef union
     uint32 U;       /**< \brief unsigned long access */
 } IfxEth_TxDescr3;
 
+/** \brief Union for TX descriptor DWORD 4
+ */
+typedef union
+{
+    uint32 U;       /**< \brief unsigned long access */
+} IfxEth_TxDescr4;
+
+/** \brief Union for TX descriptor DWORD 5
+ */
+typedef union
+{
+    uint32 U;       /**< \brief unsigned long access */
+} IfxEth_TxDescr5;
+
+/** \brief Union for TX descriptor DWORD 6, timestamp nanoseconds
+ */
+typedef union
+{
+    uint32 U;       /**< \brief unsigned long access */
+} IfxEth_TxDescr6;
+
+/** \brief Union for TX descriptor DWORD 7, timestamp seconds
+ */
+typedef union
+{
+    uint32 U;       /**< \brief unsigned long access */
+} IfxEth_TxDescr7;
+
 /** \} */
 
 /** \addtogroup IfxLld_Eth_Std_DataStructures
@@ -322,7 +471,7 @@ typedef struct
     uint16                    txBuffer2Size;               /**< \brief Size of Tx Buffer 2 */
 } IfxEth_RingModeTxBuffersConfig;
 
-/** \brief Normal RX descriptor
+/** \brief Alternate (8 DWORDS) RX descriptor
  */
 typedef struct
 {
@@ -330,9 +479,13 @@ typedef struct
     IfxEth_RxDescr1 RDES1;       /**< \brief RX descriptor DWORD 1 */
     IfxEth_RxDescr2 RDES2;       /**< \brief RX descriptor DWORD 2 */
     IfxEth_RxDescr3 RDES3;       /**< \brief RX descriptor DWORD 3 */
+    IfxEth_RxDescr4 RDES4;       /**< \brief RX descriptor DWORD 4 */
+    IfxEth_RxDescr5 RDES5;       /**< \brief RX descriptor DWORD 5 */
+    IfxEth_RxDescr6 RDES6;       /**< \brief RX descriptor DWORD 6 */
+    IfxEth_RxDescr7 RDES7;       /**< \brief RX descriptor DWORD 7 */
 } IfxEth_RxDescr;
 
-/** \brief Normal TX descriptor
+/** \brief Alternate (8 DWORDS) TX descriptor
  */
 typedef struct
 {
@@ -340,6 +493,10 @@ typedef struct
     IfxEth_TxDescr1 TDES1;       /**< \brief TX descriptor DWORD 1 */
     IfxEth_TxDescr2 TDES2;       /**< \brief TX descriptor DWORD 2 */
     IfxEth_TxDescr3 TDES3;       /**< \brief TX descriptor DWORD 3 */
+    IfxEth_TxDescr4 TDES4;       /**< \brief TX descriptor DWORD 4 */
+    IfxEth_TxDescr5 TDES5;       /**< \brief TX descriptor DWORD 5 */
+    IfxEth_TxDescr6 TDES6;       /**< \brief TX descriptor DWORD 6 */
+    IfxEth_TxDescr7 TDES7;       /**< \brief TX descriptor DWORD 7 */
 } IfxEth_TxDescr;
 
 /** \} */
@@ -411,6 +568,34 @@ typedef union
 
 /** \addtogroup IfxLld_Eth_Std_DataStructures
  * \{ */
+/** \brief Packet buffer pool
+ */
+typedef struct
+{
+    void  *freeList;           /**< \brief First free buffer, each free buffer holds the pointer to the next one */
+    uint16 bufferSize;         /**< \brief Size of one buffer in bytes */
+    uint16 count;              /**< \brief Number of buffers */
+    uint16 freeCount;          /**< \brief Number of free buffers */
+    uint16 minFreeCount;       /**< \brief Lowest number of free buffers since the initialisation */
+} IfxEth_BufferPool;
+
+/** \brief System time or frame timestamp
+ */
+typedef struct
+{
+    uint32 seconds;            /**< \brief Seconds */
+    uint32 nanoseconds;        /**< \brief Nanoseconds, less than IFXETH_NANOSECONDS_PER_SECOND */
+} IfxEth_Timestamp;
+
+/** \brief Transmit frame segment
+ */
+typedef struct
+{
+    void              *data;         /**< \brief Segment data */
+    uint16             length;       /**< \brief Segment length in bytes, up to 8191 */
+    IfxEth_BufferPool *pool;         /**< \brief Pool to which the data buffer is returned once sent, NULL_PTR if the buffer stays with the caller */
+} IfxEth_TxSegment;
+
 /** \brief ETH configuration structure
  */
 typedef struct
@@ -438,26 +623,46 @@ typedef struct
  */
 typedef struct
 {
-    Ifx_ETH_STATUS            status;               /**< \brief Intermediate variable to use register content in control structure */
-    uint32                    rxCount;              /**< \brief Number of frames received */
-    uint32                    txCount;              /**< \brief Number of frames transmitted */
-    uint32                    error;                /**< \brief Indicate an error has occurred during execution */
-    sint32                    isrRxCount;           /**< \brief Count of RX ISR */
-    sint32                    isrTxCount;           /**< \brief Count of TX ISR */
-    sint32                    txDiff;               /**< \brief Difference between isrTxCount and txCount */
-    sint32                    rxDiff;               /**< \brief Difference between isrRxCount and rxCount */
-    sint32                    isrCount;             /**< \brief count of all ISR */
-    IfxEth_Config             config;               /**< \brief Copy of the configuration passed through IfxEth_init() */
-    IfxEth_RxDescrList       *rxDescr;              /**< \brief pointer to RX descriptor RAM */
-    IfxEth_TxDescrList       *txDescr;              /**< \brief pointer to TX descriptor RAM */
+    Ifx_ETH_STATUS            status;                            /**< \brief Intermediate variable to use register content in control structure */
+    uint32                    rxCount;                           /**< \brief Number of frames received */
+    uint32                    txCount;                           /**< \brief Number of frames transmitted */
+    uint32                    error;                             /**< \brief Indicate an error has occurred during execution */
+    sint32                    isrRxCount;                        /**< \brief Count of RX ISR */
+    sint32                    isrTxCount;                        /**< \brief Count of TX ISR */
+    sint32                    txDiff;                            /**< \brief Difference between isrTxCount and txCount */
+    sint32                    rxDiff;                            /**< \brief Difference between isrRxCount and rxCount */
+    sint32                    isrCount;                          /**< \brief count of all ISR */
+    IfxEth_Config             config;                            /**< \brief Copy of the configuration passed through IfxEth_init() */
+    IfxEth_RxDescrList       *rxDescr;                           /**< \brief pointer to RX descriptor RAM */
+    IfxEth_TxDescrList       *txDescr;                           /**< \brief pointer to TX descriptor RAM */
     IfxEth_RxDescr           *pRxDescr;
     IfxEth_TxDescr           *pTxDescr;
-    Ifx_ETH                  *ethSfr;               /**< \brief Pointer to register base */
-    IfxEth_DescriptorMode     descriptorMode;       /**< \brief Descriptor mode (chain or ring) */
-    IfxEth_RingModeBufferUsed txBufferUsed;         /**< \brief Transmit Buffer(s) used in ringmode */
-    IfxEth_RingModeBufferUsed rxBufferUsed;         /**< \brief Receive Buffer(s) used in ringmode */
+    Ifx_ETH                  *ethSfr;                            /**< \brief Pointer to register base */
+    IfxEth_DescriptorMode     descriptorMode;                    /**< \brief Descriptor mode (chain or ring) */
+    IfxEth_RingModeBufferUsed txBufferUsed;                      /**< \brief Transmit Buffer(s) used in ringmode */
+    IfxEth_RingModeBufferUsed rxBufferUsed;                      /**< \brief Receive Buffer(s) used in ringmode */
+    IfxEth_BufferPool        *rxPool;                            /**< \brief Pool of the RX descriptor buffers, NULL_PTR if the fixed buffers are used */
+    uint32                    rxDropped;                         /**< \brief Number of frames dropped by IfxEth_getReceivePacket() */
+    IfxEth_TxDescr           *pTxReclaimDescr;                   /**< \brief Oldest TX descriptor not yet reclaimed */
+    uint32                    txPending;                         /**< \brief Number of TX descriptors not yet reclaimed */
+    IfxEth_TxSegment          txSegments[IFXETH_MAX_TX_BUFFERS]; /**< \brief Segment of each TX descriptor, for IfxEth_reclaimTransmitBuffers() */
+    volatile boolean          rxPolling;                         /**< \brief TRUE while the RX interrupt is disabled and IfxEth_pollReceive() drains the RX descriptors */
+    uint32                    timestampAddend;                   /**< \brief Addend of the system time at the nominal frequency, 0 if the timestamps are not initialised */
+    IfxEth_Timestamp          rxTimestamp;                       /**< \brief Timestamp of the last received frame */
+    boolean                   rxTimestampValid;                  /**< \brief TRUE if the last received frame was timestamped */
+    boolean                   txTimestampRequest;                /**< \brief TRUE if the next frame sent with IfxEth_sendTransmitPacket() is timestamped */
+    IfxEth_Timestamp          txTimestamp;                       /**< \brief Timestamp of the last timestamped frame sent */
+    boolean                   txTimestampValid;                  /**< \brief TRUE if txTimestamp has not been read yet */
 } IfxEth;
 
+/** \brief Handler of a received frame, called by IfxEth_pollReceive()
+ * \param eth ETH driver structure
+ * \param buffer RX buffer, valid only during the call
+ * \param length Frame length in bytes
+ * \param data Handler data passed to IfxEth_pollReceive()
+ */
+typedef void (*IfxEth_ReceiveHandler)(IfxEth *eth, void *buffer, uint16 length, void *data);
+
 /** \brief Structure for RX descriptor DWORD 0 Bit field access
  */
 typedef struct
@@ -600,6 +805,12 @@ IFX_INLINE void IfxEth_clearTuInterrupt(IfxEth *eth);
  */
 IFX_INLINE void IfxEth_clearTxInterrupt(IfxEth *eth);
 
+/** \brief Disables the receive interrupt
+ * \param eth ETH driver structure
+ * \return None
+ */
+IFX_INLINE void IfxEth_disableRxInterrupt(IfxEth *eth);
+
 /** \brief Disables Timestamp Fine or Coarse Update
  * \param eth ETH driver structure
  * \return None
@@ -618,6 +829,12 @@ IFX_INLINE void IfxEth_disableTimeStampForIpv4Frames(IfxEth *eth);
  */
 IFX_INLINE void IfxEth_enableMmcCounter(IfxEth *eth);
 
+/** \brief Enables the receive interrupt
+ * \param eth ETH driver structure
+ * \return None
+ */
+IFX_INLINE void IfxEth_enableRxInterrupt(IfxEth *eth);
+
 /** \brief Enables the TimeStamp
  * \param eth ETH driver structure
  * \return None
@@ -691,6 +908,20 @@ IFX_INLINE void IfxEth_setAddToTimeUpdate(IfxEth *eth);
  */
 IFX_INLINE void IfxEth_setBinaryRolloverControl(IfxEth *eth, boolean enabled);
 
+/** \brief Sets the duplex mode of the MAC, to be changed while the link is down
+ * \param eth ETH driver structure
+ * \param fullDuplex TRUE: full duplex, FALSE: half duplex
+ * \return None
+ */
+IFX_INLINE void IfxEth_setDuplexMode(IfxEth *eth, boolean fullDuplex);
+
+/** \brief Sets the link speed of the MAC, to be changed while the link is down
+ * \param eth ETH driver structure
+ * \param speed Link speed
+ * \return None
+ */
+IFX_INLINE void IfxEth_setLinkSpeed(IfxEth *eth, IfxEth_LinkSpeed speed);
+
 /** \brief Sets the loopback mode
  * \param eth ETH driver structure
  * \param loopbackMode loopback mode enable/disbale
@@ -769,6 +1000,49 @@ IFX_INLINE void *IfxEth_waitTransmitBuffer(IfxEth *eth);
  */
 IFX_EXTERN void IfxEth_freeReceiveBuffer(IfxEth *eth);
 
+/** \brief Receive interrupt handling with interrupt coalescing
+ *
+ * To be called from the ETH interrupt. On a receive interrupt, the receive interrupt is disabled and the
+ * function returns TRUE once: the caller shall then schedule a task calling IfxEth_pollReceive(), e.g. by
+ * triggering a software interrupt. Further frames are received without interrupt until IfxEth_pollReceive()
+ * finds the RX descriptors empty and enables the receive interrupt again.
+ *
+ * \code
+ * void ethIsr(void)
+ * {
+ *     if (IfxEth_isrReceive(&eth) != FALSE)
+ *     {
+ *         IfxSrc_setRequest(&SRC_GPSR01);   // schedules ethPollIsr()
+ *     }
+ * }
+ *
+ * void ethPollIsr(void)
+ * {
+ *     IfxEth_pollReceive(&eth, &onFrame, NULL_PTR, 16);
+ *
+ *     if (eth.rxPolling != FALSE)
+ *     {
+ *         IfxSrc_setRequest(&SRC_GPSR01);   // budget exhausted, poll again after the other interrupts
+ *     }
+ * }
+ * \endcode
+ * \param eth ETH driver structure
+ * \return Returns TRUE if the poll task shall be scheduled
+ */
+IFX_EXTERN boolean IfxEth_isrReceive(IfxEth *eth);
+
+/** \brief Processes up to budget received frames with IfxEth_getReceiveBuffer() / IfxEth_freeReceiveBuffer()
+ *
+ * If less than budget frames are available, the RX descriptors are empty: the polling ends
+ * (IfxEth::rxPolling = FALSE) and the receive interrupt is enabled again.
+ * \param eth ETH driver structure
+ * \param handler Handler called for each received frame
+ * \param data Handler data
+ * \param budget Maximal number of frames processed
+ * \return Returns the number of processed frames
+ */
+IFX_EXTERN uint32 IfxEth_pollReceive(IfxEth *eth, IfxEth_ReceiveHandler handler, void *data, uint32 budget);
+
 /** \brief Request to send the transmit buffer
  *
  * The transmit buffer is the last one specified by IfxEth_getTransmitBuffer()
@@ -1182,6 +1456,163 @@ IFX_EXTERN void IfxEth_setupRmiiOutputPins(IfxEth *eth, const IfxEth_RmiiPins *r
 
 /** \} */
 
+/** \addtogroup IfxLld_Eth_Std_BufferPool
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Takes a buffer from the pool
+ * \param pool Pointer to the buffer pool
+ * \return Returns the buffer, NULL_PTR if the pool is empty
+ */
+IFX_EXTERN void *IfxEth_allocBuffer(IfxEth_BufferPool *pool);
+
+/** \brief Returns a buffer to the pool
+ * \param pool Pointer to the buffer pool
+ * \param buffer Buffer previously taken from the pool
+ * \return None
+ */
+IFX_EXTERN void IfxEth_freeBuffer(IfxEth_BufferPool *pool, void *buffer);
+
+/** \brief Returns the next received frame without copying it
+ *
+ * The descriptor gets a new buffer of the pool. Frames spread over several descriptors, erroneous
+ * frames and frames received while the pool is empty are dropped (IfxEth::rxDropped).
+ * \param eth ETH driver structure
+ * \param length Returns the frame length in bytes
+ * \return Returns the frame buffer, to be returned with IfxEth_freeBuffer(), NULL_PTR if no frame is available
+ */
+IFX_EXTERN void *IfxEth_getReceivePacket(IfxEth *eth, uint16 *length);
+
+/** \brief Initialises the buffer pool
+ * \param pool Pointer to the buffer pool
+ * \param buffers Buffer memory of count * bufferSize bytes, word aligned
+ * \param bufferSize Size of one buffer in bytes, multiple of 4. Should be at least IFXETH_RTX_BUFFER_SIZE for receive buffers
+ * \param count Number of buffers
+ * \return None
+ */
+IFX_EXTERN void IfxEth_initBufferPool(IfxEth_BufferPool *pool, void *buffers, uint16 bufferSize, uint16 count);
+
+/** \brief Initialises the RX descriptors in chain mode with buffers of the pool
+ *
+ * The pool shall contain more than IFXETH_MAX_RX_BUFFERS buffers, the buffers in excess are handed
+ * to the application with the received frames.
+ * \param eth ETH driver structure
+ * \param pool Pointer to the buffer pool
+ * \return Returns FALSE if the pool has not enough free buffers
+ */
+IFX_EXTERN boolean IfxEth_initReceiveDescriptorsWithPool(IfxEth *eth, IfxEth_BufferPool *pool);
+
+/** \brief Returns the buffers of the sent segments to their pool
+ * \param eth ETH driver structure
+ * \return Returns the number of reclaimed descriptors
+ */
+IFX_EXTERN uint32 IfxEth_reclaimTransmitBuffers(IfxEth *eth);
+
+/** \brief Sends a frame made of several segments without copying them (scatter-gather)
+ *
+ * Each segment uses one chained TX descriptor. The segments are read by the DMA after the call,
+ * their buffers shall not be modified until they are reclaimed.
+ * \param eth ETH driver structure
+ * \param segments Segments of the frame, in transmit order
+ * \param count Number of segments
+ * \return Returns FALSE if not enough TX descriptors are free, the segments are then not used
+ */
+IFX_EXTERN boolean IfxEth_sendTransmitPacket(IfxEth *eth, const IfxEth_TxSegment *segments, uint32 count);
+
+/** \} */
+
+/** \addtogroup IfxLld_Eth_Std_Timestamp
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Reads the timestamp of a received frame
+ * \param descr Pointer to the RX descriptor of the frame, not yet released
+ * \param timestamp Returns the timestamp
+ * \return Returns TRUE if the frame was timestamped
+ */
+IFX_INLINE boolean IfxEth_RxDescr_getTimestamp(IfxEth_RxDescr *descr, IfxEth_Timestamp *timestamp);
+
+/** \brief Reads the timestamp of a transmitted frame
+ * \param descr Pointer to the TX descriptor of the last segment of the frame, released by the DMA
+ * \param timestamp Returns the timestamp
+ * \return Returns TRUE if the frame was timestamped
+ */
+IFX_INLINE boolean IfxEth_TxDescr_getTimestamp(IfxEth_TxDescr *descr, IfxEth_Timestamp *timestamp);
+
+/** \brief Requests the timestamp of the next frame sent with IfxEth_sendTransmitPacket()
+ * \param eth ETH driver structure
+ * \return None
+ */
+IFX_INLINE void IfxEth_requestTransmitTimestamp(IfxEth *eth);
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Corrects the frequency of the system time
+ * \param eth ETH driver structure
+ * \param ppb Frequency correction in parts per billion relative to the PTP reference clock, positive to speed up
+ * \return None
+ */
+IFX_EXTERN void IfxEth_adjustFrequency(IfxEth *eth, sint32 ppb);
+
+/** \brief Adds an offset to the system time, the clock is not stopped
+ * \param eth ETH driver structure
+ * \param offset Offset in nanoseconds, negative to set the time back
+ * \return None
+ */
+IFX_EXTERN void IfxEth_adjustTime(IfxEth *eth, sint64 offset);
+
+/** \brief Returns the timestamp of the last received frame
+ *
+ * To be called after IfxEth_getReceivePacket() or from the receive handler of IfxEth_pollReceive().
+ * \param eth ETH driver structure
+ * \param timestamp Returns the timestamp
+ * \return Returns FALSE if the frame was not timestamped (not a PTP event message)
+ */
+IFX_EXTERN boolean IfxEth_getReceiveTimestamp(IfxEth *eth, IfxEth_Timestamp *timestamp);
+
+/** \brief Reads the system time
+ * \param eth ETH driver structure
+ * \param time Returns the system time
+ * \return None
+ */
+IFX_EXTERN void IfxEth_getTime(IfxEth *eth, IfxEth_Timestamp *time);
+
+/** \brief Returns the timestamp of the last frame sent after IfxEth_requestTransmitTimestamp()
+ *
+ * The sent buffers are reclaimed, see IfxEth_reclaimTransmitBuffers(). Each timestamp is returned once.
+ * \param eth ETH driver structure
+ * \param timestamp Returns the timestamp
+ * \return Returns FALSE if no new timestamp is available (frame not yet sent)
+ */
+IFX_EXTERN boolean IfxEth_getTransmitTimestamp(IfxEth *eth, IfxEth_Timestamp *timestamp);
+
+/** \brief Starts the system time at 0 with the fine correction and enables the timestamping of the PTP event messages
+ *
+ * The nanoseconds are incremented by the sub-second increment at each overflow of the 32 bit accumulator
+ * of the addend, at about half the PTP reference clock frequency.
+ * \param eth ETH driver structure
+ * \param clockFrequency PTP reference clock frequency of the ETH module in Hz
+ * \return Returns FALSE if the clock frequency is out of range (8 MHz to 2 GHz)
+ */
+IFX_EXTERN boolean IfxEth_initTimestamp(IfxEth *eth, float32 clockFrequency);
+
+/** \brief Sets the system time
+ * \param eth ETH driver structure
+ * \param time System time
+ * \return None
+ */
+IFX_EXTERN void IfxEth_setTime(IfxEth *eth, const IfxEth_Timestamp *time);
+
+/** \} */
+
 /******************************************************************************/
 /*-------------------Global Exported Variables/Constants----------------------*/
 /******************************************************************************/
@@ -1208,6 +1639,21 @@ IFX_INLINE IfxEth_RxDescr *IfxEth_RxDescr_getNext(IfxEth_RxDescr *descr)
 }
 
 
+IFX_INLINE boolean IfxEth_RxDescr_getTimestamp(IfxEth_RxDescr *descr, IfxEth_Timestamp *timestamp)
+{
+    /* with the timestamps enabled, IPC indicates a timestamp in RDES6 / RDES7 (last descriptor only) */
+    boolean result = ((descr->RDES0.A.LS != 0) && (descr->RDES0.A.IPC != 0)) ? TRUE : FALSE;
+
+    if (result != FALSE)
+    {
+        timestamp->nanoseconds = descr->RDES6.U;
+        timestamp->seconds     = descr->RDES7.U;
+    }
+
+    return result;
+}
+
+
 IFX_INLINE void IfxEth_RxDescr_release(IfxEth_RxDescr *descr)
 {
     descr->RDES0.A.OWN = 1U;
@@ -1226,6 +1672,20 @@ IFX_INLINE IfxEth_TxDescr *IfxEth_TxDescr_getNext(IfxEth_TxDescr *descr)
 }
 
 
+IFX_INLINE boolean IfxEth_TxDescr_getTimestamp(IfxEth_TxDescr *descr, IfxEth_Timestamp *timestamp)
+{
+    boolean result = ((descr->TDES0.A.LS != 0) && (descr->TDES0.A.TTSS != 0)) ? TRUE : FALSE;
+
+    if (result != FALSE)
+    {
+        timestamp->nanoseconds = descr->TDES6.U;
+        timestamp->seconds     = descr->TDES7.U;
+    }
+
+    return result;
+}
+
+
 IFX_INLINE boolean IfxEth_TxDescr_isAvailable(IfxEth_TxDescr *descr)
 {
     return (descr->TDES0.A.OWN == 0) ? TRUE : FALSE;
@@ -1297,6 +1757,13 @@ IFX_INLINE void IfxEth_clearTxInterrupt(IfxEth *eth)
 }
 
 
+IFX_INLINE void IfxEth_disableRxInterrupt(IfxEth *eth)
+{
+    (void)eth;
+    MODULE_ETH.INTERRUPT_ENABLE.B.RIE = 0;
+}
+
+
 IFX_INLINE void IfxEth_disableTimeStampCoarseUpdate(IfxEth *eth)
 {
     (void)eth;
@@ -1318,6 +1785,13 @@ IFX_INLINE void IfxEth_enableMmcCounter(IfxEth *eth)
 }
 
 
+IFX_INLINE void IfxEth_enableRxInterrupt(IfxEth *eth)
+{
+    (void)eth;
+    MODULE_ETH.INTERRUPT_ENABLE.B.RIE = 1;
+}
+
+
 IFX_INLINE void IfxEth_enableTimeStamp(IfxEth *eth)
 {
     (void)eth;
@@ -1539,6 +2013,12 @@ IFX_INLINE void IfxEth_readAllFlags(IfxEth *eth)
 }
 
 
+IFX_INLINE void IfxEth_requestTransmitTimestamp(IfxEth *eth)
+{
+    eth->txTimestampRequest = TRUE;
+}
+
+
 IFX_INLINE void IfxEth_setAddToTimeUpdate(IfxEth *eth)
 {
     (void)eth;
@@ -1553,6 +2033,20 @@ IFX_INLINE void IfxEth_setBinaryRolloverControl(IfxEth *eth, boolean enabled)
 }
 
 
+IFX_INLINE void IfxEth_setDuplexMode(IfxEth *eth, boolean fullDuplex)
+{
+    (void)eth;
+    ETH_MAC_CONFIGURATION.B.DM = fullDuplex ? 1 : 0;
+}
+
+
+IFX_INLINE void IfxEth_setLinkSpeed(IfxEth *eth, IfxEth_LinkSpeed speed)
+{
+    (void)eth;
+    ETH_MAC_CONFIGURATION.B.FES = speed;
+}
+
+
 IFX_INLINE void IfxEth_setLoopbackMode(IfxEth *eth, boolean loopbackMode)
 {
     (void)eth;
@@ -28,6 +28,19 @@
 /******************************************************************************/
 
 #include "IfxFce_Crc.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/******************************************************************************/
+/*-----------------------Private Function Prototypes--------------------------*/
+/******************************************************************************/
+
+/** \brief Configures the CRC-32 kernel for a new calculation
+ * \param fce Specifies the pointer to FCE module handler
+ * \param crcDataLength Length of the input data block
+ * \param crcStartValue start value for CRC calculation
+ * \return Pointer to the input register of the kernel
+ */
+static volatile uint32 *IfxFce_Crc_startCrc32(IfxFce_Crc_Crc *fce, uint32 crcDataLength, uint32 crcStartValue);
 
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
@@ -63,33 +76,9 @@ uint16 IfxFce_Crc_calculateCrc16(IfxFce_Crc_Crc *fce, const uint16 *crcData, uin
 
 uint32 IfxFce_Crc_calculateCrc32(IfxFce_Crc_Crc *fce, const uint32 *crcData, uint32 crcDataLength, uint32 crcStartValue)
 {
-    Ifx_FCE         *fceSFR = fce->fce;
     uint32           inputDataCounter;
-    uint32           crcResultValue;
     uint32          *dataPtr = (uint32 *)crcData;
-    volatile uint32 *inPtr;
-
-    /*Crc-32 calculaion with 0x04C11DB7 polynomial*/
-    if (fce->crc32Kernel == IfxFce_Crc32Kernel_0)
-    {
-        fceSFR->IN0.CHECK.U  = 0xFACECAFE;
-        fceSFR->IN0.LENGTH.U = 0xFACECAFE;
-        fceSFR->IN0.CHECK.U  = fce->expectedCrc;
-        fceSFR->IN0.LENGTH.U = crcDataLength;
-        fceSFR->IN0.CRC.U    = crcStartValue;
-
-        inPtr                = (volatile uint32 *)&fceSFR->IN0.IR.U;
-    }
-    else
-    {
-        fceSFR->IN1.CHECK.U  = 0xFACECAFE;
-        fceSFR->IN1.LENGTH.U = 0xFACECAFE;
-        fceSFR->IN1.CHECK.U  = fce->expectedCrc;
-        fceSFR->IN1.LENGTH.U = crcDataLength;
-        fceSFR->IN1.CRC.U    = crcStartValue;
-
-        inPtr                = (volatile uint32 *)&fceSFR->IN1.IR.U;
-    }
+    volatile uint32 *inPtr   = IfxFce_Crc_startCrc32(fce, crcDataLength, crcStartValue);
 
     {
         for (inputDataCounter = 0; inputDataCounter < crcDataLength; inputDataCounter++)
@@ -98,16 +87,20 @@ uint32 IfxFce_Crc_calculateCrc32(IfxFce_Crc_Crc *fce, const uint32 *crcData, uin
         }
     }
 
-    if (fce->crc32Kernel == IfxFce_Crc32Kernel_0)
-    {
-        crcResultValue = fceSFR->IN0.RES.U;
-    }
-    else
-    {
-        crcResultValue = fceSFR->IN1.RES.U;
-    }
+    return IfxFce_Crc_getCrc32Result(fce);
+}
 
-    return crcResultValue;
+
+void IfxFce_Crc_calculateCrc32Async(IfxFce_Crc_Crc *fce, const uint32 *crcData, uint32 crcDataLength, uint32 crcStartValue)
+{
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fce->useDma != FALSE);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (crcDataLength != 0) && (crcDataLength <= IFXFCE_CRC_DMA_LENGTH_MAX));
+
+    IfxFce_Crc_startCrc32(fce, crcDataLength, crcStartValue);
+
+    IfxDma_Dma_setChannelSourceAddress(&fce->dmaChannel, IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), crcData));
+    IfxDma_Dma_setChannelTransferCount(&fce->dmaChannel, crcDataLength);
+    IfxDma_Dma_startChannelTransaction(&fce->dmaChannel);
 }
 
 
@@ -163,6 +156,19 @@ void IfxFce_Crc_deInitModule(IfxFce_Crc_Crc *fce)
 }
 
 
+uint32 IfxFce_Crc_getCrc32Result(IfxFce_Crc_Crc *fce)
+{
+    if (fce->crc32Kernel == IfxFce_Crc32Kernel_0)
+    {
+        return fce->fce->IN0.RES.U;
+    }
+    else
+    {
+        return fce->fce->IN1.RES.U;
+    }
+}
+
+
 Ifx_FCE_STS IfxFce_Crc_getInterruptStatus(IfxFce_Crc_Crc *fce)
 {
     if (fce->crcMode == IfxFce_CrcMode_8)
@@ -226,6 +232,53 @@ void IfxFce_Crc_initCrc(IfxFce_Crc_Crc *fceCrc, const IfxFce_Crc_CrcConfig *crcC
     }
 
     IfxScuWdt_setCpuEndinit(password);
+
+    fceCrc->useDma = crcConfig->useDma;
+
+    if (crcConfig->useDma != FALSE)
+    {
+        IfxDma_Dma               dma;
+        IfxDma_Dma_createModuleHandle(&dma, &MODULE_DMA);
+
+        IfxDma_Dma_ChannelConfig dmaCfg;
+        IfxDma_Dma_initChannelConfig(&dmaCfg, &dma);
+
+        dmaCfg.channelId               = crcConfig->fceChannelId;
+        dmaCfg.hardwareRequestEnabled  = FALSE; // triggered by software, one request per data block
+        dmaCfg.channelInterruptEnabled = FALSE; // end of transaction polled with IfxFce_Crc_isDmaBusy()
+
+        // source address and transfer count will be configured during runtime
+        dmaCfg.sourceAddress               = 0;
+        dmaCfg.sourceAddressCircularRange  = IfxDma_ChannelIncrementCircular_none;
+        dmaCfg.sourceCircularBufferEnabled = FALSE;
+        dmaCfg.transferCount               = 0;
+
+        // destination address is the input register of the kernel; use circular mode to stay at this address for each move
+        if (crcConfig->crcMode == IfxFce_CrcMode_8)
+        {
+            dmaCfg.destinationAddress = (uint32)&fceSFR->IN3.IR.U;
+            dmaCfg.moveSize           = IfxDma_ChannelMoveSize_8bit;
+        }
+        else if (crcConfig->crcMode == IfxFce_CrcMode_16)
+        {
+            dmaCfg.destinationAddress = (uint32)&fceSFR->IN2.IR.U;
+            dmaCfg.moveSize           = IfxDma_ChannelMoveSize_16bit;
+        }
+        else
+        {
+            dmaCfg.destinationAddress = (crcConfig->crc32Kernel == IfxFce_Crc32Kernel_0) ? (uint32)&fceSFR->IN0.IR.U : (uint32)&fceSFR->IN1.IR.U;
+            dmaCfg.moveSize           = IfxDma_ChannelMoveSize_32bit;
+        }
+
+        dmaCfg.destinationAddressCircularRange  = IfxDma_ChannelIncrementCircular_none;
+        dmaCfg.destinationCircularBufferEnabled = TRUE;
+
+        dmaCfg.requestMode                      = IfxDma_ChannelRequestMode_completeTransactionPerRequest;
+        dmaCfg.operationMode                    = IfxDma_ChannelOperationMode_single;
+        dmaCfg.blockMode                        = IfxDma_ChannelMove_1;
+
+        IfxDma_Dma_initChannel(&fceCrc->dmaChannel, &dmaCfg);
+    }
 }
 
 
@@ -242,6 +295,8 @@ void IfxFce_Crc_initCrcConfig(IfxFce_Crc_CrcConfig *crcConfig, IfxFce_Crc *fce)
     crcConfig->enabledInterrupts.configError = TRUE;
     crcConfig->enabledInterrupts.lengthError = TRUE;
     crcConfig->enabledInterrupts.busError    = TRUE;
+    crcConfig->useDma                        = FALSE;
+    crcConfig->fceChannelId                  = IfxDma_ChannelId_0;
 }
 
 
@@ -264,3 +319,31 @@ void IfxFce_Crc_initModuleConfig(IfxFce_Crc_Config *config, Ifx_FCE *fce)
     config->isrPriority      = 0;
     config->isrTypeOfService = IfxSrc_Tos_cpu0;
 }
+
+
+static volatile uint32 *IfxFce_Crc_startCrc32(IfxFce_Crc_Crc *fce, uint32 crcDataLength, uint32 crcStartValue)
+{
+    Ifx_FCE *fceSFR = fce->fce;
+
+    /*Crc-32 calculaion with 0x04C11DB7 polynomial*/
+    if (fce->crc32Kernel == IfxFce_Crc32Kernel_0)
+    {
+        fceSFR->IN0.CHECK.U  = 0xFACECAFE;
+        fceSFR->IN0.LENGTH.U = 0xFACECAFE;
+        fceSFR->IN0.CHECK.U  = fce->expectedCrc;
+        fceSFR->IN0.LENGTH.U = crcDataLength;
+        fceSFR->IN0.CRC.U    = crcStartValue;
+
+        return (volatile uint32 *)&fceSFR->IN0.IR.U;
+    }
+    else
+    {
+        fceSFR->IN1.CHECK.U  = 0xFACECAFE;
+        fceSFR->IN1.LENGTH.U = 0xFACECAFE;
+        fceSFR->IN1.CHECK.U  = fce->expectedCrc;
+        fceSFR->IN1.LENGTH.U = crcDataLength;
+        fceSFR->IN1.CRC.U    = crcStartValue;
+
+        return (volatile uint32 *)&fceSFR->IN1.IR.U;
+    }
+}
@@ -344,6 +344,15 @@
 
 #include "Fce/Std/IfxFce.h"
 #include "Cpu/Irq/IfxCpu_Irq.h"
+#include "Dma/Dma/IfxDma_Dma.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Maximal length of the input data block of \ref IfxFce_Crc_calculateCrc32Async(), in words
+ */
+#define IFXFCE_CRC_DMA_LENGTH_MAX (16383)
 
 /******************************************************************************/
 /*-----------------------------Data Structures--------------------------------*/
@@ -389,6 +398,8 @@ typedef struct
     IfxFce_CrcMode     crcMode;           /**< \brief Specifies the CRC mode */
     uint32             expectedCrc;       /**< \brief Specifies the expected CRC to be compared with resulted. */
     IfxFce_Crc32Kernel crc32Kernel;       /**< \brief Specifies the kernel used for CRC-32 */
+    boolean            useDma;            /**< \brief Specifies whether the input data is transferred by the DMA */
+    IfxDma_Dma_Channel dmaChannel;        /**< \brief Specifies the DMA channel feeding the kernel */
 } IfxFce_Crc_Crc;
 
 /** \brief Specifies the module configuration structure
@@ -405,6 +416,8 @@ typedef struct
     boolean                      crcResultInverted;               /**< \brief Specifies the XOR valueto get the final CRC */
     IfxFce_Crc32Kernel           crc32Kernel;                     /**< \brief Specifies the kernel used for CRC-32 */
     IfxFce_Crc_EnabledInterrupts enabledInterrupts;               /**< \brief Specifies the interrupt enable structure */
+    boolean                      useDma;                          /**< \brief Specifies whether the input data is transferred by the DMA */
+    IfxDma_ChannelId             fceChannelId;                    /**< \brief Specifies the DMA channel feeding the kernel, used if useDma is TRUE */
 } IfxFce_Crc_CrcConfig;
 
 /** \} */
@@ -501,6 +514,29 @@ IFX_EXTERN uint16 IfxFce_Crc_calculateCrc16(IfxFce_Crc_Crc *fce, const uint16 *c
  */
 IFX_EXTERN uint32 IfxFce_Crc_calculateCrc32(IfxFce_Crc_Crc *fce, const uint32 *crcData, uint32 crcDataLength, uint32 crcStartValue);
 
+/** \brief Start the 32-bit CRC calculation of a data block transferred by the DMA channel of the kernel.
+ * The CPU is free during the transfer, the result is read with \ref IfxFce_Crc_getCrc32Result() once
+ * \ref IfxFce_Crc_isDmaBusy() returns FALSE.
+ * \param fce Specifies the pointer to FCE module handler, initialised with useDma = TRUE
+ * \param crcData pointer to the input data block, word aligned
+ * \param crcDataLength Length of the input data block in words, 1..IFXFCE_CRC_DMA_LENGTH_MAX
+ * \param crcStartValue start value for CRC calculation
+ * \return None
+ *
+ * \code
+ *      IfxFce_Crc_calculateCrc32Async(&fceCrc32_0, checkData, CHECK_DATA_SIZE, 0x00000000);
+ *
+ *      // ... other processing
+ *
+ *      while (IfxFce_Crc_isDmaBusy(&fceCrc32_0))
+ *      {}
+ *
+ *      fceCrc = IfxFce_Crc_getCrc32Result(&fceCrc32_0);
+ * \endcode
+ *
+ */
+IFX_EXTERN void IfxFce_Crc_calculateCrc32Async(IfxFce_Crc_Crc *fce, const uint32 *crcData, uint32 crcDataLength, uint32 crcStartValue);
+
 /** \brief Calculate the XORed 8-bit CRC value and returns it. It takes the precomputed XORed and reversed.
  * \param fce Specifies the pointer to FCE module handler
  * \param crcData Length of the input data block
@@ -513,6 +549,18 @@ IFX_EXTERN uint32 IfxFce_Crc_calculateCrc32(IfxFce_Crc_Crc *fce, const uint32 *c
  */
 IFX_EXTERN uint8 IfxFce_Crc_calculateCrc8(IfxFce_Crc_Crc *fce, const uint8 *crcData, uint32 crcDataLength, uint8 crcStartValue);
 
+/** \brief Returns the 32-bit CRC result of the kernel, after \ref IfxFce_Crc_calculateCrc32Async()
+ * \param fce Specifies the pointer to FCE module handler
+ * \return Final CRC after XORed with XOR value.
+ */
+IFX_EXTERN uint32 IfxFce_Crc_getCrc32Result(IfxFce_Crc_Crc *fce);
+
+/** \brief Indicates if the DMA transfer started by \ref IfxFce_Crc_calculateCrc32Async() is ongoing
+ * \param fce Specifies the pointer to FCE module handler
+ * \return TRUE while the input data is transferred
+ */
+IFX_INLINE boolean IfxFce_Crc_isDmaBusy(IfxFce_Crc_Crc *fce);
+
 /** \} */
 
 /** \addtogroup IfxLld_Fce_Crc_Interrupt
@@ -542,4 +590,14 @@ IFX_EXTERN Ifx_FCE_STS IfxFce_Crc_getInterruptStatus(IfxFce_Crc_Crc *fce);
 
 /** \} */
 
+/******************************************************************************/
+/*---------------------Inline Function Implementations------------------------*/
+/******************************************************************************/
+
+IFX_INLINE boolean IfxFce_Crc_isDmaBusy(IfxFce_Crc_Crc *fce)
+{
+    return IfxDma_Dma_isChannelTransactionPending(&fce->dmaChannel);
+}
+
+
 #endif /* IFXFCE_CRC_H */
@@ -27,11 +27,19 @@
 /******************************************************************************/
 
 #include "IfxGpt12_IncrEnc.h"
+#include "IfxGtm_bf.h"
 
 /******************************************************************************/
 /*-----------------------Private Function Prototypes--------------------------*/
 /******************************************************************************/
 
+/** \brief Initialises the TIM channel which time stamps the A edges
+ * \param driver driver handle
+ * \param config Configuration structure
+ * \return None
+ */
+IFX_STATIC void IfxGpt12_IncrEnc_initTimestamp(IfxGpt12_IncrEnc *driver, const IfxGpt12_IncrEnc_Config *config);
+
 /** \brief Update internal data when incremental mode is using T2.\n
  * This function shall be periodically called
  * \param driver driver handle
@@ -60,6 +68,12 @@ IFX_STATIC void IfxGpt12_IncrEnc_updateSpeedFromT2(IfxGpt12_IncrEnc *driver, sin
  */
 IFX_STATIC void IfxGpt12_IncrEnc_updateSpeedFromT3(IfxGpt12_IncrEnc *driver, sint32 newPosition);
 
+/** \brief Computes the speed from the A edge time stamps and the GPT12 count
+ * \param driver driver handle
+ * \return None
+ */
+IFX_STATIC void IfxGpt12_IncrEnc_updateSpeedFromTimestamp(IfxGpt12_IncrEnc *driver);
+
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
@@ -126,6 +140,11 @@ IfxStdIf_Pos_SensorType IfxGpt12_IncrEnc_getSensorType(IfxGpt12_IncrEnc *driver)
 
 float32 IfxGpt12_IncrEnc_getSpeed(IfxGpt12_IncrEnc *driver)
 {
+    if (driver->timestamp.channel != NULL_PTR)
+    {
+        IfxGpt12_IncrEnc_updateSpeedFromTimestamp(driver);
+    }
+
     return driver->speed;
 }
 
@@ -158,6 +177,7 @@ boolean IfxGpt12_IncrEnc_init(IfxGpt12_IncrEnc *driver, const IfxGpt12_IncrEnc_C
     driver->speed                    = 0;
     driver->direction                = IfxStdIf_Pos_Dir_unknown;
     driver->turn                     = 0;
+    driver->timestamp.channel        = NULL_PTR;
 
     if (config->pinA->timer == 3)
     {
@@ -275,10 +295,50 @@ boolean IfxGpt12_IncrEnc_init(IfxGpt12_IncrEnc *driver, const IfxGpt12_IncrEnc_C
         Ifx_LowPassPt1F32_init(&driver->speedLpf, &lpfConfig);
     }
 
+    if (config->timestamp.pinA != NULL_PTR)
+    {
+        IfxGpt12_IncrEnc_initTimestamp(driver, config);
+    }
+
     return status;
 }
 
 
+IFX_STATIC void IfxGpt12_IncrEnc_initTimestamp(IfxGpt12_IncrEnc *driver, const IfxGpt12_IncrEnc_Config *config)
+{
+    IfxGpt12_IncrEnc_Timestamp *timestamp = &driver->timestamp;
+    IfxGtm_Tim_TinMap          *pin       = config->timestamp.pinA;
+    Ifx_GTM                    *gtm       = &MODULE_GTM;
+    Ifx_GTM_TIM_CH             *channel   = IfxGtm_Tim_getChannel(&gtm->TIM[pin->tim], pin->channel);
+    float32                     frequency;
+    float32                     timeout;
+
+    /* Input event mode: GPR0 latches TBU_TS0 and the edge counter on both edges */
+    channel->CTRL.U          = 0;
+    channel->CTRL.B.TIM_MODE = IfxGtm_Tim_Mode_inputEvent;
+    channel->CTRL.B.ISL      = 1;
+    channel->CTRL.B.GPR0_SEL = IfxGtm_Tim_GprSel_tbuTs0;
+    channel->CTRL.B.GPR1_SEL = IfxGtm_Tim_GprSel_tbuTs0;
+    channel->CTRL.B.CICTRL   = IfxGtm_Tim_Input_currentChannel;
+    IfxGtm_PinMap_setTimTin(pin, config->pinMode);
+    IfxGtm_Tbu_enableChannel(gtm, IfxGtm_Tbu_Ts_0);
+
+    frequency                = IfxGtm_Tbu_getClockFrequency(gtm, IfxGtm_Tbu_Ts_0);
+    timestamp->channel       = channel;
+    timestamp->gtm           = gtm;
+    timestamp->speedConst    = (2.0 * IFX_PI) / (config->base.resolution * 2) * frequency;
+    timestamp->countsPerEdge = (uint8)(config->base.resolutionFactor / 2);
+    timestamp->coreT3        = config->pinA->timer == 3;
+    timestamp->synchronised  = FALSE;
+
+    /* Time of one edge at minSpeed, limited to half of the 24 bit time stamp range */
+    timeout            = (config->base.minSpeed > 0.0) ? (timestamp->speedConst / config->base.minSpeed) : (float32)0x7FFFFF;
+    timestamp->timeout = (uint32)__minf(timeout, (float32)0x7FFFFF);
+
+    channel->CTRL.B.TIM_EN = 1;
+}
+
+
 void IfxGpt12_IncrEnc_initConfig(IfxGpt12_IncrEnc_Config *config, Ifx_GPT12 *gpt12)
 {
     IfxStdIf_Pos_initConfig(&config->base);
@@ -324,6 +384,7 @@ void IfxGpt12_IncrEnc_reset(IfxGpt12_IncrEnc *driver)
     driver->speed                    = 0;
     driver->status.status            = 0;
     driver->status.B.notSynchronised = 1;
+    driver->timestamp.synchronised   = FALSE;
 }
 
 
@@ -410,7 +471,11 @@ IFX_STATIC void IfxGpt12_IncrEnc_updateFromT2(IfxGpt12_IncrEnc *driver)
         newPosition = (newPosition + driver->resolution);
     }
 
-    IfxGpt12_IncrEnc_updateSpeedFromT2(driver, newPosition);
+    if (driver->timestamp.channel == NULL_PTR)
+    {   /* Else the speed is computed by IfxGpt12_IncrEnc_getSpeed() */
+        IfxGpt12_IncrEnc_updateSpeedFromT2(driver, newPosition);
+    }
+
     driver->rawPosition = newPosition;
 }
 
@@ -434,7 +499,11 @@ IFX_STATIC void IfxGpt12_IncrEnc_updateFromT3(IfxGpt12_IncrEnc *driver)
         newPosition = (newPosition + driver->resolution);
     }
 
-    IfxGpt12_IncrEnc_updateSpeedFromT3(driver, newPosition);
+    if (driver->timestamp.channel == NULL_PTR)
+    {   /* Else the speed is computed by IfxGpt12_IncrEnc_getSpeed() */
+        IfxGpt12_IncrEnc_updateSpeedFromT3(driver, newPosition);
+    }
+
     driver->rawPosition = newPosition;
 }
 
@@ -530,3 +599,72 @@ IFX_STATIC void IfxGpt12_IncrEnc_updateSpeedFromT3(IfxGpt12_IncrEnc *driver, sin
         driver->speed = speed;
     }
 }
+
+
+IFX_STATIC void IfxGpt12_IncrEnc_updateSpeedFromTimestamp(IfxGpt12_IncrEnc *driver)
+{
+    IfxGpt12_IncrEnc_Timestamp *timestamp = &driver->timestamp;
+    Ifx_GPT12                  *gpt12     = driver->module;
+    Ifx_GTM_TIM_CH_GPR0         gpr0;
+    boolean                     forward;
+    sint32                      count;
+    uint32                      diff;
+    uint32                      edges;
+    uint32                      elapsed;
+    float32                     speed;
+
+    /* Time stamp and edge counter of the last edge are latched together */
+    gpr0.U = timestamp->channel->GPR0.U;
+
+    if (timestamp->coreT3)
+    {
+        forward = gpt12->T3CON.B.T3RDIR == 0;
+        count   = gpt12->T3.U;
+    }
+    else
+    {
+        forward = gpt12->T2CON.B.T2RDIR == 0;
+        count   = gpt12->T2.U;
+    }
+
+    diff             = (uint32)(forward ? (count - timestamp->count) : (timestamp->count - count));
+    diff            &= driver->resolution - 1;
+    timestamp->count = count;
+    edges            = (uint8)(gpr0.B.ECNT - timestamp->edgeCount);
+
+    if ((diff / timestamp->countsPerEdge) > 127)
+    {   /* The 8 bit edge counter may have wrapped */
+        edges = diff / timestamp->countsPerEdge;
+    }
+
+    if (edges != 0)
+    {
+        elapsed                 = (gpr0.B.GPR0 - timestamp->timestamp) & IFX_GTM_TIM_CH_GPR0_GPR0_MSK;
+        /* After a stop the previous time stamp is too old: wait for the next edge */
+        speed                   = (timestamp->synchronised && (elapsed != 0)) ? (timestamp->speedConst * (float32)edges / (float32)elapsed) : 0.0;
+        timestamp->timestamp    = gpr0.B.GPR0;
+        timestamp->edgeCount    = (uint8)gpr0.B.ECNT;
+        timestamp->synchronised = TRUE;
+    }
+    else if (timestamp->synchronised)
+    {   /* No edge: the speed is at most 1 edge over the time since the last edge */
+        elapsed = (timestamp->gtm->TBU.CH0_BASE.U - timestamp->timestamp) & IFX_GTM_TIM_CH_GPR0_GPR0_MSK;
+
+        if (elapsed >= timestamp->timeout)
+        {
+            speed                   = 0.0;
+            timestamp->synchronised = FALSE;
+        }
+        else
+        {
+            speed = __minf(__absf(driver->speed), timestamp->speedConst / (float32)elapsed);
+        }
+    }
+    else
+    {
+        speed = 0.0;
+    }
+
+    driver->direction = forward ? IfxStdIf_Pos_Dir_forward : IfxStdIf_Pos_Dir_backward;
+    driver->speed     = forward ? speed : -speed;
+}
@@ -0,0 +1,225 @@
+/**
+ * \file IfxGtm_Atom_Event.c
+ * \brief GTM ATOM hardware timed output events details
+ *
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "IfxGtm_Atom_Event.h"
+#include "Cpu/Std/IfxCpu.h"
+#include "Gtm/Std/IfxGtm_Aru.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief F2A_ENABLE code which disables a stream, 0 leaves a stream unchanged */
+#define IFXGTM_ATOM_EVENT_F2A_DISABLE    (1)
+
+/** \brief F2A_ENABLE code which enables a stream */
+#define IFXGTM_ATOM_EVENT_F2A_ENABLE     (2)
+
+/** \brief F2A stream transfer mode: both ARU words, low word first */
+#define IFXGTM_ATOM_EVENT_F2A_TMODE_BOTH (2)
+
+/** \brief F2A stream direction: from the FIFO to the ARU */
+#define IFXGTM_ATOM_EVENT_F2A_DIR_TO_ARU (1)
+
+/** \brief Position of the ACB bits in the ARU high word */
+#define IFXGTM_ATOM_EVENT_ACB_SHIFT      (24)
+
+/******************************************************************************/
+/*------------------------Private Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Enables or disables the F2A stream of the FIFO channel
+ * \param driver GTM ATOM event driver
+ * \param enabled TRUE to enable the stream
+ * \return None
+ */
+IFX_STATIC void IfxGtm_Atom_Event_enableStream(IfxGtm_Atom_Event *driver, boolean enabled);
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+IFX_STATIC void IfxGtm_Atom_Event_enableStream(IfxGtm_Atom_Event *driver, boolean enabled)
+{
+    uint32 code = enabled ? IFXGTM_ATOM_EVENT_F2A_ENABLE : IFXGTM_ATOM_EVENT_F2A_DISABLE;
+
+    driver->gtm->F2A0.ENABLE.U = code << (driver->fifoChannel * 2);
+}
+
+
+void IfxGtm_Atom_Event_flush(IfxGtm_Atom_Event *driver)
+{
+    Ifx_GTM_ATOM_CH *atomCh = IfxGtm_Atom_Ch_getChannelPointer(driver->atom, driver->atomChannel);
+
+    IfxGtm_Atom_Event_enableStream(driver, FALSE);
+    driver->fifo->CTRL.B.FLUSH = 1;
+
+    /* cancel the event waiting for its compare match, the output level is not changed */
+    atomCh->CTRL.B.ARU_EN = 0;
+    IfxGtm_Atom_Ch_setSomcControl(driver->atom, driver->atomChannel, IfxGtm_Atom_SomcControl_cancelCompare);
+    atomCh->CTRL.B.ARU_EN = 1;
+
+    IfxGtm_Atom_Event_enableStream(driver, TRUE);
+}
+
+
+boolean IfxGtm_Atom_Event_init(IfxGtm_Atom_Event *driver, const IfxGtm_Atom_Event_Config *config)
+{
+    Ifx_GTM                           *gtm = config->gtm;
+    IfxGtm_Atom_ToutMap               *pin = config->pin;
+    Ifx_GTM_ATOM_CH                   *atomCh;
+    Ifx_GTM_ATOM_CH_CTRL               ctrl;
+    Ifx_GTM_FIFO_CH_CTRL               fifoCtrl;
+    Ifx_GTM_F2A_STR_CH_STR_CFG         streamConfig;
+    IfxGtm_Atom_SomcSignalLevelControl setLevel;
+    IfxGtm_Atom_SomcSignalLevelControl clearLevel;
+    uint32                             compare;
+
+    if ((config->fifoChannel >= IFXGTM_ATOM_EVENT_NUM_FIFO_CHANNELS)
+        || (config->fifoSize < IFXGTM_ATOM_EVENT_WORDS)
+        || ((config->fifoSize % IFXGTM_ATOM_EVENT_WORDS) != 0)
+        || ((config->fifoStart + config->fifoSize) > IFXGTM_ATOM_EVENT_FIFO_RAM_SIZE)
+        || (config->aruAddress < IFXGTM_ARU_ADDRESS_MIN)
+        || (config->aruAddress > IFXGTM_ARU_ADDRESS_MAX))
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+        return FALSE;
+    }
+
+    driver->gtm            = gtm;
+    driver->atom           = &gtm->ATOM[pin->atom];
+    driver->atomChannel    = pin->channel;
+    driver->fifo           = &gtm->FIFO0.CH[config->fifoChannel];
+    driver->buffer         = &gtm->AFD0.CH[config->fifoChannel].BUF_ACC;
+    driver->fifoChannel    = config->fifoChannel;
+    driver->fifoSize       = config->fifoSize;
+    driver->scheduledCount = 0;
+    driver->rejectedCount  = 0;
+
+    /* ACB of each action: compare CCU0 against TS0, signal level control relative to SL */
+    if (config->initialLevel != FALSE)
+    {
+        setLevel   = IfxGtm_Atom_SomcSignalLevelControl_sl0out0;
+        clearLevel = IfxGtm_Atom_SomcSignalLevelControl_sl0out1;
+    }
+    else
+    {
+        setLevel   = IfxGtm_Atom_SomcSignalLevelControl_sl0out1;
+        clearLevel = IfxGtm_Atom_SomcSignalLevelControl_sl0out0;
+    }
+
+    compare                                           = (uint32)IfxGtm_Atom_SomcControl_ccu0Ts0 << 2;
+    driver->control[IfxGtm_Atom_Event_Action_set]    = (compare | setLevel) << IFXGTM_ATOM_EVENT_ACB_SHIFT;
+    driver->control[IfxGtm_Atom_Event_Action_clear]  = (compare | clearLevel) << IFXGTM_ATOM_EVENT_ACB_SHIFT;
+    driver->control[IfxGtm_Atom_Event_Action_toggle] = (compare | IfxGtm_Atom_SomcSignalLevelControl_toggle) << IFXGTM_ATOM_EVENT_ACB_SHIFT;
+
+    /* FIFO channel region, empty */
+    IfxGtm_Atom_Event_enableStream(driver, FALSE);
+    driver->fifo->START_ADDR.U = config->fifoStart;
+    driver->fifo->END_ADDR.U   = config->fifoStart + config->fifoSize - 1;
+    fifoCtrl.U                 = 0;
+    fifoCtrl.B.FLUSH           = 1;
+    driver->fifo->CTRL.U       = fifoCtrl.U;
+
+    /* F2A stream: both words from the FIFO to the ARU */
+    streamConfig.U       = 0;
+    streamConfig.B.TMODE = IFXGTM_ATOM_EVENT_F2A_TMODE_BOTH;
+    streamConfig.B.DIR   = IFXGTM_ATOM_EVENT_F2A_DIR_TO_ARU;
+    gtm->F2A0.STR_CH[config->fifoChannel].STR_CFG.U = streamConfig.U;
+
+    /* ATOM channel: SOMC, compare values and ACB from the F2A stream */
+    IfxGtm_Atom_Agc_enableChannel(&driver->atom->AGC, driver->atomChannel, FALSE, TRUE);
+    atomCh         = IfxGtm_Atom_Ch_getChannelPointer(driver->atom, driver->atomChannel);
+    ctrl.U         = 0;
+    ctrl.B.MODE    = IfxGtm_Atom_Mode_outputCompare;
+    ctrl.B.ARU_EN  = 1;
+    ctrl.B.SL      = config->initialLevel != FALSE;
+    atomCh->CTRL.U = ctrl.U;
+    IfxGtm_Atom_Ch_setAruReadAddress0(driver->atom, driver->atomChannel, config->aruAddress);
+
+    IfxGtm_Atom_Agc_enableChannel(&driver->atom->AGC, driver->atomChannel, TRUE, TRUE);
+    IfxGtm_Atom_Agc_enableChannelOutput(&driver->atom->AGC, driver->atomChannel, TRUE, TRUE);
+    IfxGtm_PinMap_setAtomTout(pin, config->outputMode, config->outputDriver);
+
+    IfxGtm_Atom_Event_enableStream(driver, TRUE);
+
+    return TRUE;
+}
+
+
+void IfxGtm_Atom_Event_initConfig(IfxGtm_Atom_Event_Config *config, Ifx_GTM *gtm)
+{
+    config->gtm          = gtm;
+    config->pin          = NULL_PTR;
+    config->fifoChannel  = 0;
+    config->fifoStart    = 0;
+    config->fifoSize     = IFXGTM_ATOM_EVENT_FIFO_RAM_SIZE;
+    config->aruAddress   = 0;
+    config->initialLevel = FALSE;
+    config->outputMode   = IfxPort_OutputMode_pushPull;
+    config->outputDriver = IfxPort_PadDriver_cmosAutomotiveSpeed1;
+}
+
+
+boolean IfxGtm_Atom_Event_schedule(IfxGtm_Atom_Event *driver, IfxGtm_Atom_Event_Action action, uint32 time)
+{
+    IfxGtm_Atom_Event_Entry event;
+
+    event.time   = time;
+    event.action = action;
+
+    return IfxGtm_Atom_Event_scheduleList(driver, &event, 1) != 0;
+}
+
+
+uint32 IfxGtm_Atom_Event_scheduleList(IfxGtm_Atom_Event *driver, const IfxGtm_Atom_Event_Entry *events, uint32 count)
+{
+    uint32  index;
+    boolean interruptState = IfxCpu_disableInterrupts();
+    uint32  freeCount      = IfxGtm_Atom_Event_getFreeCount(driver);
+
+    if (count > freeCount)
+    {
+        driver->rejectedCount += count - freeCount;
+        count                  = freeCount;
+    }
+
+    /* the two words of an event are consecutive in the FIFO, the F2A sends them pairwise */
+    for (index = 0; index < count; index++)
+    {
+        driver->buffer->U = events[index].time & IFXGTM_ATOM_EVENT_TIME_MASK;
+        driver->buffer->U = driver->control[events[index].action];
+    }
+
+    driver->scheduledCount += count;
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return count;
+}
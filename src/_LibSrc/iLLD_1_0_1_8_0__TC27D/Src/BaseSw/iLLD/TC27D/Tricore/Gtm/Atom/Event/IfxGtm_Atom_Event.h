@@ -0,0 +1,301 @@
+/**
+ * \file IfxGtm_Atom_Event.h
+ * \brief GTM ATOM hardware timed output events details
+ * \ingroup IfxLld_Gtm
+ *
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup IfxLld_Gtm_Atom_Event_Usage How to use the GTM ATOM Event Driver
+ * \ingroup IfxLld_Gtm_Atom_Event
+ *
+ *   This driver sets, clears or toggles an ATOM output at absolute TBU_TS0 times. The events are queued by the CPU
+ *   and executed by the ATOM channel: the output edges land on the TBU_TS0 resolution, whatever the CPU load and
+ *   the interrupt latency.
+ *
+ * \section specific Specific implementation
+ *   The queue is a region of the GTM FIFO0 RAM (one FIFO channel per output). Each event is written as two FIFO
+ *   words through the AFD (CPU access to the FIFO):
+ *   - low word: time, TBU_TS0 value [23:0], becomes the ATOM CM0.
+ *   - high word: ATOM control bits ACB in [28:24]: ACB[4:2] = 2 (compare CCU0 against TS0), ACB[1:0] = signal
+ *     level control (set, clear or toggle, adjusted to the configured SL).
+ *
+ *   The F2A stream of the FIFO channel sends the words pairwise to the ARU (transfer of both words, FIFO to ARU).
+ *   The ATOM channel runs in SOMC mode with the ARU input enabled, it reads the F2A stream write address, waits for
+ *   the compare match of the event, applies the signal level control, then reads the next event. The CPU only
+ *   writes two words per event, and the queue may be refilled by the DMA with words prepared by
+ *   \ref IfxGtm_Atom_Event_encode(), the destination being \ref IfxGtm_Atom_Event_getBufferPointer().
+ *
+ *   - Resources used:
+ *       - 1 ATOM channel per output
+ *       - 1 FIFO0 channel, its F2A stream and a FIFO RAM region of 2 words per queued event. The FIFO regions of
+ *         the channels in use shall not overlap
+ *       - the ARU write address of the F2A stream, from the ARU write address table of the user manual. It shall
+ *         not be read by another consumer, see \ref IfxLld_Gtm_Std_Aru
+ *       - TBU channel 0, running
+ *   - The compare is "greater or equal" on 24 bit: an event up to 2^23 ticks in the past is executed immediately,
+ *     further in the past it is executed after the TBU_TS0 wrap around. Events shall be queued in time order.
+ *
+ * \section example Usage example
+ * \code
+ *   #define F2A0_CH0_ARU_ADDRESS ...   // from the ARU write address table of the user manual
+ *
+ *   IfxGtm_Atom_Event_Config eventConfig;
+ *   IfxGtm_Atom_Event_initConfig(&eventConfig, &MODULE_GTM);
+ *   eventConfig.pin         = &IfxGtm_ATOM0_0_TOUT0_P02_0_OUT;
+ *   eventConfig.fifoChannel = 0;
+ *   eventConfig.fifoStart   = 0;
+ *   eventConfig.fifoSize    = 64;      // 32 events
+ *   eventConfig.aruAddress  = F2A0_CH0_ARU_ADDRESS;
+ *   IfxGtm_Atom_Event_init(&event, &eventConfig);
+ *
+ *   // 10 us pulse, 100 us from now
+ *   uint32 now = IfxGtm_Atom_Event_getTime(&event);
+ *   IfxGtm_Atom_Event_schedule(&event, IfxGtm_Atom_Event_Action_set, now + ticks100us);
+ *   IfxGtm_Atom_Event_schedule(&event, IfxGtm_Atom_Event_Action_clear, now + ticks100us + ticks10us);
+ * \endcode
+ *
+ * \defgroup IfxLld_Gtm_Atom_Event ATOM Event Interface Driver
+ * \ingroup IfxLld_Gtm_Atom
+ * \defgroup IfxLld_Gtm_Atom_Event_Enumerations Enumerations
+ * \ingroup IfxLld_Gtm_Atom_Event
+ * \defgroup IfxLld_Gtm_Atom_Event_Data_Structures Data Structures
+ * \ingroup IfxLld_Gtm_Atom_Event
+ * \defgroup IfxLld_Gtm_Atom_Event_Event_Functions Event Functions
+ * \ingroup IfxLld_Gtm_Atom_Event
+ */
+
+#ifndef IFXGTM_ATOM_EVENT_H
+#define IFXGTM_ATOM_EVENT_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "_PinMap/IfxGtm_PinMap.h"
+#include "Gtm/Std/IfxGtm_Atom.h"
+#include "Gtm/Std/IfxGtm_Tbu.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Number of FIFO0 channels, one per output
+ */
+#define IFXGTM_ATOM_EVENT_NUM_FIFO_CHANNELS (8)
+
+/** \brief Size of the FIFO0 RAM in words
+ */
+#define IFXGTM_ATOM_EVENT_FIFO_RAM_SIZE     (1024)
+
+/** \brief Number of FIFO words per event
+ */
+#define IFXGTM_ATOM_EVENT_WORDS             (2)
+
+/** \brief Mask of the event time, TBU_TS0 is 24 bit
+ */
+#define IFXGTM_ATOM_EVENT_TIME_MASK         (0x00FFFFFFU)
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+
+/** \addtogroup IfxLld_Gtm_Atom_Event_Enumerations
+ * \{ */
+/** \brief Output action of an event
+ */
+typedef enum
+{
+    IfxGtm_Atom_Event_Action_set    = 0,  /**< \brief set the output high */
+    IfxGtm_Atom_Event_Action_clear  = 1,  /**< \brief set the output low */
+    IfxGtm_Atom_Event_Action_toggle = 2   /**< \brief toggle the output */
+} IfxGtm_Atom_Event_Action;
+
+/** \} */
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+
+/** \addtogroup IfxLld_Gtm_Atom_Event_Data_Structures
+ * \{ */
+/** \brief Event of a list, see \ref IfxGtm_Atom_Event_scheduleList()
+ */
+typedef struct
+{
+    uint32                   time;     /**< \brief TBU_TS0 time of the event, 24 bit */
+    IfxGtm_Atom_Event_Action action;   /**< \brief Output action */
+} IfxGtm_Atom_Event_Entry;
+
+/** \brief GTM ATOM event configuration
+ */
+typedef struct
+{
+    Ifx_GTM             *gtm;             /**< \brief GTM module used */
+    IfxGtm_Atom_ToutMap *pin;             /**< \brief Output pin, defines the ATOM and the channel */
+    uint8                fifoChannel;     /**< \brief FIFO0 channel and F2A stream, 0 to 7 */
+    uint16               fifoStart;       /**< \brief First word of the FIFO region in the FIFO0 RAM */
+    uint16               fifoSize;        /**< \brief Size of the FIFO region in words, even. fifoSize / 2 events can be queued */
+    uint16               aruAddress;      /**< \brief ARU write address of the F2A stream, from the user manual */
+    boolean              initialLevel;    /**< \brief Output level after initialisation, TRUE for high */
+    IfxPort_OutputMode   outputMode;      /**< \brief Output mode of the pin */
+    IfxPort_PadDriver    outputDriver;    /**< \brief Pad driver of the pin */
+} IfxGtm_Atom_Event_Config;
+
+/** \brief GTM ATOM event driver
+ */
+typedef struct
+{
+    Ifx_GTM                         *gtm;               /**< \brief GTM module used */
+    Ifx_GTM_ATOM                    *atom;              /**< \brief ATOM unit used */
+    IfxGtm_Atom_Ch                   atomChannel;       /**< \brief ATOM channel used */
+    Ifx_GTM_FIFO_CH                 *fifo;              /**< \brief FIFO0 channel used */
+    volatile Ifx_GTM_AFD_CH_BUF_ACC *buffer;            /**< \brief AFD buffer access register of the FIFO channel */
+    uint8                            fifoChannel;       /**< \brief FIFO0 channel and F2A stream index */
+    uint16                           fifoSize;          /**< \brief Size of the FIFO region in words */
+    uint32                           control[3];        /**< \brief High word of each action, indexed by \ref IfxGtm_Atom_Event_Action */
+    uint32                           scheduledCount;    /**< \brief Number of events queued */
+    uint32                           rejectedCount;     /**< \brief Number of events rejected, the queue being full */
+} IfxGtm_Atom_Event;
+
+/** \} */
+
+/** \addtogroup IfxLld_Gtm_Atom_Event_Event_Functions
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Builds the two FIFO words of an event, e.g. for a DMA transfer to \ref IfxGtm_Atom_Event_getBufferPointer()
+ * \param driver GTM ATOM event driver
+ * \param action Output action
+ * \param time TBU_TS0 time of the event
+ * \param words Pointer to the 2 words, low word first. This parameter is Initialised by the function
+ * \return None
+ */
+IFX_INLINE void IfxGtm_Atom_Event_encode(const IfxGtm_Atom_Event *driver, IfxGtm_Atom_Event_Action action, uint32 time, uint32 *words);
+
+/** \brief Returns the address the events are written to, as DMA destination. Each event is 2 words, low word first
+ * \param driver GTM ATOM event driver
+ * \return Pointer to the AFD buffer access register, unsigned access type of the SFR
+ */
+IFX_INLINE volatile unsigned int *IfxGtm_Atom_Event_getBufferPointer(IfxGtm_Atom_Event *driver);
+
+/** \brief Returns the number of events which can be queued
+ * \param driver GTM ATOM event driver
+ * \return Number of free event entries
+ */
+IFX_INLINE uint32 IfxGtm_Atom_Event_getFreeCount(const IfxGtm_Atom_Event *driver);
+
+/** \brief Returns the number of events queued and not yet read by the ATOM channel
+ *
+ * The event read by the ATOM channel waits for its compare match and is not counted.
+ * \param driver GTM ATOM event driver
+ * \return Number of queued events
+ */
+IFX_INLINE uint32 IfxGtm_Atom_Event_getPendingCount(const IfxGtm_Atom_Event *driver);
+
+/** \brief Returns the current time, TBU_TS0
+ * \param driver GTM ATOM event driver
+ * \return 24 bit TBU_TS0 value
+ */
+IFX_INLINE uint32 IfxGtm_Atom_Event_getTime(const IfxGtm_Atom_Event *driver);
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Cancels the queued events and the event waiting in the ATOM channel. The output keeps its level
+ * \param driver GTM ATOM event driver
+ * \return None
+ */
+IFX_EXTERN void IfxGtm_Atom_Event_flush(IfxGtm_Atom_Event *driver);
+
+/** \brief Initializes the FIFO channel, the F2A stream and the ATOM channel, the queue is empty
+ * \param driver GTM ATOM event driver
+ * \param config GTM ATOM event configuration
+ * \return TRUE on success, FALSE if the FIFO channel, region or ARU address is invalid
+ */
+IFX_EXTERN boolean IfxGtm_Atom_Event_init(IfxGtm_Atom_Event *driver, const IfxGtm_Atom_Event_Config *config);
+
+/** \brief Initialize the configuration structure to default: FIFO0 channel 0, whole FIFO0 RAM, output low, push pull
+ * \param config GTM ATOM event configuration. This parameter is Initialised by the function
+ * \param gtm GTM module used
+ * \return None
+ */
+IFX_EXTERN void IfxGtm_Atom_Event_initConfig(IfxGtm_Atom_Event_Config *config, Ifx_GTM *gtm);
+
+/** \brief Queues an event
+ *
+ * May be called from any task or interrupt of the CPU, the two words of the event are written with the interrupts
+ * disabled.
+ * \param driver GTM ATOM event driver
+ * \param action Output action
+ * \param time TBU_TS0 time of the event, 24 bit
+ * \return TRUE if the event is queued, FALSE if the queue is full
+ */
+IFX_EXTERN boolean IfxGtm_Atom_Event_schedule(IfxGtm_Atom_Event *driver, IfxGtm_Atom_Event_Action action, uint32 time);
+
+/** \brief Queues a list of events, in time order
+ * \param driver GTM ATOM event driver
+ * \param events Pointer to the events
+ * \param count Number of events
+ * \return Number of events queued, less than count if the queue is full
+ */
+IFX_EXTERN uint32 IfxGtm_Atom_Event_scheduleList(IfxGtm_Atom_Event *driver, const IfxGtm_Atom_Event_Entry *events, uint32 count);
+
+/** \} */
+
+/******************************************************************************/
+/*---------------------Inline Function Implementations------------------------*/
+/******************************************************************************/
+
+IFX_INLINE void IfxGtm_Atom_Event_encode(const IfxGtm_Atom_Event *driver, IfxGtm_Atom_Event_Action action, uint32 time, uint32 *words)
+{
+    words[0] = time & IFXGTM_ATOM_EVENT_TIME_MASK;
+    words[1] = driver->control[action];
+}
+
+
+IFX_INLINE volatile unsigned int *IfxGtm_Atom_Event_getBufferPointer(IfxGtm_Atom_Event *driver)
+{
+    return &driver->buffer->U;
+}
+
+
+IFX_INLINE uint32 IfxGtm_Atom_Event_getFreeCount(const IfxGtm_Atom_Event *driver)
+{
+    return (driver->fifoSize - driver->fifo->FILL_LEVEL.B.LEVEL) / IFXGTM_ATOM_EVENT_WORDS;
+}
+
+
+IFX_INLINE uint32 IfxGtm_Atom_Event_getPendingCount(const IfxGtm_Atom_Event *driver)
+{
+    return driver->fifo->FILL_LEVEL.B.LEVEL / IFXGTM_ATOM_EVENT_WORDS;
+}
+
+
+IFX_INLINE uint32 IfxGtm_Atom_Event_getTime(const IfxGtm_Atom_Event *driver)
+{
+    return IfxGtm_Tbu_getTimestamp(driver->gtm, IfxGtm_Tbu_Ts_0);
+}
+
+
+#endif /* IFXGTM_ATOM_EVENT_H */
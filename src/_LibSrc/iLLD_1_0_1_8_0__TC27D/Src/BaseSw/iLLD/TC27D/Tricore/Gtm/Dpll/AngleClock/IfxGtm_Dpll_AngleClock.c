@@ -0,0 +1,194 @@
+/**
+ * \file IfxGtm_Dpll_AngleClock.c
+ * \brief GTM DPLL angle clock: sub-increments from a tooth wheel / encoder input
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "IfxGtm_Dpll_AngleClock.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+
+/** \brief Maximal number of teeth per revolution (DPLL_CTRL_0.TNU + 1) */
+#define IFXGTM_DPLL_ANGLECLOCK_MAX_TEETH          (512)
+
+/** \brief Maximal number of sub-increments per tooth (DPLL_CTRL_0.MLT + 1) */
+#define IFXGTM_DPLL_ANGLECLOCK_MAX_SUBINCREMENTS  (1024)
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+uint32 IfxGtm_Dpll_AngleClock_getNextTimeBase(IfxGtm_Dpll_AngleClock *clock, uint32 angle)
+{
+    uint32 timeBase = IfxGtm_Dpll_AngleClock_getTimeBase(clock);
+    uint32 current  = timeBase % clock->subIncrementsPerRevolution;
+    uint32 delta    = (angle + clock->subIncrementsPerRevolution - current) % clock->subIncrementsPerRevolution;
+
+    if (delta == 0)
+    {
+        delta = clock->subIncrementsPerRevolution;
+    }
+
+    return (timeBase + delta) & IFXGTM_DPLL_ANGLECLOCK_TIMEBASE_MASK;
+}
+
+
+float32 IfxGtm_Dpll_AngleClock_getSpeed(IfxGtm_Dpll_AngleClock *clock)
+{
+    float32 speed = 0.0F;
+
+    if (IfxGtm_Dpll_AngleClock_isLocked(clock) != FALSE)
+    {
+        speed = IfxGtm_Dpll_getSubIncFrequency(clock->gtm, IfxGtm_Dpll_SubInc_1) / (float32)clock->subIncrementsPerRevolution;
+    }
+
+    return speed;
+}
+
+
+boolean IfxGtm_Dpll_AngleClock_init(IfxGtm_Dpll_AngleClock *clock, const IfxGtm_Dpll_AngleClock_Config *config)
+{
+    Ifx_GTM            *gtm    = config->gtm;
+    Ifx_GTM_DPLL       *dpll   = &gtm->DPLL;
+    boolean             result = TRUE;
+    Ifx_GTM_TIM_CH     *input;
+    Ifx_GTM_DPLL_CTRL_0 ctrl0;
+    Ifx_GTM_DPLL_CTRL_1 ctrl1;
+
+    /* The DPLL TRIGGER is hardwired to TIM0 channel 0 */
+    if ((config->input == NULL_PTR)
+        || (config->input->tim != IfxGtm_Tim_0)
+        || (config->input->channel != IfxGtm_Tim_Ch_0)
+        || (config->teethPerRevolution == 0)
+        || (config->teethPerRevolution > IFXGTM_DPLL_ANGLECLOCK_MAX_TEETH)
+        || (config->subIncrementsPerTooth == 0)
+        || (config->subIncrementsPerTooth > IFXGTM_DPLL_ANGLECLOCK_MAX_SUBINCREMENTS))
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+        result = FALSE;
+    }
+    else
+    {
+        clock->gtm                        = gtm;
+        clock->teethPerRevolution         = config->teethPerRevolution;
+        clock->subIncrementsPerTooth      = config->subIncrementsPerTooth;
+        clock->subIncrementsPerRevolution = (uint32)config->teethPerRevolution * config->subIncrementsPerTooth;
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_WARNING, ((IFXGTM_DPLL_ANGLECLOCK_TIMEBASE_MASK + 1) % clock->subIncrementsPerRevolution) == 0);
+
+        /* DPLL disabled and RAM initialised before the configuration */
+        dpll->CTRL_1.B.DEN = 0;
+        dpll->RAM_INI.U    = 1U << IFX_GTM_DPLL_RAM_INI_INIT_RAM_OFF;
+
+        while ((dpll->RAM_INI.B.INIT_1A != 0) || (dpll->RAM_INI.B.INIT_1B != 0) || (dpll->RAM_INI.B.INIT_2 != 0))
+        {}
+
+        /* Normal mode: TRIGGER only, MLT + 1 sub-increments per tooth, no adaptation */
+        ctrl0.U         = 0;
+        ctrl0.B.MLT     = config->subIncrementsPerTooth - 1;
+        ctrl0.B.TNU     = config->teethPerRevolution - 1;
+        ctrl0.B.TEN     = 1;
+        dpll->CTRL_0.U  = ctrl0.U;
+
+        /* Automatic end mode, SUB_INC1 generator enabled */
+        ctrl1.U         = 0;
+        ctrl1.B.SGE1    = 1;
+        ctrl1.B.TSL     = config->activeEdge;
+        dpll->CTRL_1.U  = ctrl1.U;
+
+        /* No hold time check, missing tooth detected after 1.5 tooth durations */
+        dpll->THMI.U    = 0;
+        dpll->THMA.U    = 0;
+        dpll->TOV.U     = 0;
+        dpll->TOV.B.DW  = 1;
+        dpll->TOV.B.DB  = 0x200;
+
+        /* TIM0 channel 0 provides the input edges and their TBU_TS0 time stamp */
+        input                  = IfxGtm_Tim_getChannel(&gtm->TIM[0], IfxGtm_Tim_Ch_0);
+        input->CTRL.U          = 0;
+        input->CTRL.B.TIM_MODE = IfxGtm_Tim_Mode_inputEvent;
+        input->CTRL.B.ISL      = 1;
+        input->CTRL.B.GPR0_SEL = IfxGtm_Tim_GprSel_tbuTs0;
+        input->CTRL.B.CICTRL   = IfxGtm_Tim_Input_currentChannel;
+        IfxGtm_PinMap_setTimTin(config->input, config->inputMode);
+        gtm->MAP_CTRL.B.TSEL   = 0;
+        IfxGtm_Tbu_enableChannel(gtm, IfxGtm_Tbu_Ts_0);
+        input->CTRL.B.TIM_EN   = 1;
+
+        /* TBU_TS1 counts SUB_INC1 */
+        gtm->TBU.CH1_CTRL.B.CH_MODE = 1;
+        gtm->TBU.CH1_BASE.U         = 0;
+        IfxGtm_Tbu_enableChannel(gtm, IfxGtm_Tbu_Ts_1);
+
+        if (config->subIncClock != FALSE)
+        {
+            gtm->CMU.CLK_7.CTRL.B.CLK7_SEL = 1;
+            IfxGtm_Cmu_enableClocks(gtm, IFXGTM_CMU_CLKEN_CLK7);
+        }
+
+        dpll->CTRL_1.B.DEN = 1;
+    }
+
+    return result;
+}
+
+
+void IfxGtm_Dpll_AngleClock_initConfig(IfxGtm_Dpll_AngleClock_Config *config, Ifx_GTM *gtm)
+{
+    config->gtm                   = gtm;
+    config->input                 = NULL_PTR;
+    config->inputMode             = IfxPort_InputMode_noPullDevice;
+    config->activeEdge            = IfxGtm_Dpll_AngleClock_Edge_rising;
+    config->teethPerRevolution    = 64;
+    config->subIncrementsPerTooth = 64;
+    config->subIncClock           = FALSE;
+}
+
+
+void IfxGtm_Dpll_AngleClock_setAtomEvent(IfxGtm_Dpll_AngleClock *clock, Ifx_GTM_ATOM *atom, IfxGtm_Atom_Ch channel, uint32 angle, IfxGtm_Atom_SomcSignalLevelControl action)
+{
+    Ifx_GTM_ATOM_CH *atomCh = IfxGtm_Atom_Ch_getChannelPointer(atom, channel);
+
+    IfxGtm_Atom_Ch_setMode(atom, channel, IfxGtm_Atom_Mode_outputCompare);
+    atomCh->CTRL.B.TB12_SEL = 0; /* CCU1 compares against TBU_TS1 */
+    IfxGtm_Atom_Ch_setSignalLevel(atom, channel, Ifx_ActiveState_low);
+    IfxGtm_Atom_Ch_setSomcSignalLevelControl(atom, channel, action);
+    IfxGtm_Atom_Ch_setSomcControl(atom, channel, IfxGtm_Atom_SomcControl_ccu1Ts12);
+    IfxGtm_Atom_Agc_enableChannel(&atom->AGC, channel, TRUE, TRUE);
+    IfxGtm_Atom_Agc_enableChannelOutput(&atom->AGC, channel, TRUE, TRUE);
+
+    /* Writing CM1 arms the compare */
+    IfxGtm_Atom_Ch_setCompareOne(atom, channel, IfxGtm_Dpll_AngleClock_getNextTimeBase(clock, angle));
+}
+
+
+void IfxGtm_Dpll_AngleClock_setAngle(IfxGtm_Dpll_AngleClock *clock, uint32 angle)
+{
+    uint32 timeBase = IfxGtm_Dpll_AngleClock_getTimeBase(clock);
+
+    clock->gtm->TBU.CH1_BASE.U = (timeBase - (timeBase % clock->subIncrementsPerRevolution) + angle) & IFXGTM_DPLL_ANGLECLOCK_TIMEBASE_MASK;
+}
@@ -0,0 +1,243 @@
+/**
+ * \file IfxGtm_Dpll_AngleClock.h
+ * \brief GTM DPLL angle clock: sub-increments from a tooth wheel / encoder input
+ * \ingroup IfxLld_Gtm
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ *
+ * The angle clock configures the DPLL in normal mode to multiply the edges of a tooth wheel or encoder
+ * signal (DPLL TRIGGER, TIM0 channel 0) by a fixed factor. The generated sub-increments (SUB_INC1)
+ * drive the TBU channel 1 in forward mode, so that TBU_TS1 is an angle base with
+ * teethPerRevolution * subIncrementsPerTooth ticks per revolution. The DPLL predicts the tooth
+ * duration from the previous one, the angle base stays continuous between the teeth.
+ *
+ * \section events Angle events
+ *   Angle synchronous actions are executed by the ATOM without any CPU interrupt per tooth:
+ *   - \ref IfxGtm_Dpll_AngleClock_setAtomEvent() configures an ATOM channel in SOMC mode comparing
+ *     its CCU1 against TBU_TS1. The output changes when the angle is reached, once per call
+ *     (e.g. injection start / end)
+ *   - with Config::subIncClock set, SUB_INC1 is also the CMU_CLK7 clock. An ATOM channel in PWM mode clocked
+ *     by CMU_CLK7 with a period of \ref IfxGtm_Dpll_AngleClock::subIncrementsPerRevolution produces edges at
+ *     fixed angles on every revolution (e.g. ADC trigger at fixed rotor angles with \ref IfxGtm_Trig_toVadc())
+ *
+ * \section restrictions Restrictions
+ *   - Wheels with equidistant teeth only, the DPLL adaptation and missing teeth profiles are not used
+ *   - Forward direction only
+ *   - The angle base is continuous over the 24 bit TBU_TS1 wrap around only when the number of
+ *     sub-increments per revolution is a power of 2
+ *   - The angle zero is the first tooth after \ref IfxGtm_Dpll_AngleClock_init(), use
+ *     \ref IfxGtm_Dpll_AngleClock_setAngle() to align it to a reference (e.g. index pulse)
+ *
+ * \section example Usage example
+ * \code
+ *   IfxGtm_Dpll_AngleClock_Config angleClockConfig;
+ *   IfxGtm_Dpll_AngleClock        angleClock;
+ *
+ *   IfxGtm_Dpll_AngleClock_initConfig(&angleClockConfig, &MODULE_GTM);
+ *   angleClockConfig.input                 = &IfxGtm_TIM0_0_TIN0_P02_0_IN;
+ *   angleClockConfig.teethPerRevolution    = 64;
+ *   angleClockConfig.subIncrementsPerTooth = 64;   // 4096 ticks per revolution
+ *   IfxGtm_Dpll_AngleClock_init(&angleClock, &angleClockConfig);
+ *
+ *   // Output ATOM0 channel 3 goes high at 90 degrees
+ *   IfxGtm_Dpll_AngleClock_setAtomEvent(&angleClock, &MODULE_GTM.ATOM[0], IfxGtm_Atom_Ch_3, 1024, IfxGtm_Atom_SomcSignalLevelControl_sl0out1);
+ * \endcode
+ *
+ * \defgroup IfxLld_Gtm_Dpll_AngleClock GTM DPLL Angle Clock
+ * \ingroup IfxLld_Gtm
+ * \defgroup IfxLld_Gtm_Dpll_AngleClock_Data_Structures Data Structures
+ * \ingroup IfxLld_Gtm_Dpll_AngleClock
+ * \defgroup IfxLld_Gtm_Dpll_AngleClock_Enumerations Enumerations
+ * \ingroup IfxLld_Gtm_Dpll_AngleClock
+ * \defgroup IfxLld_Gtm_Dpll_AngleClock_Functions Angle Clock Functions
+ * \ingroup IfxLld_Gtm_Dpll_AngleClock
+ */
+
+#ifndef IFXGTM_DPLL_ANGLECLOCK_H
+#define IFXGTM_DPLL_ANGLECLOCK_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "Gtm/Std/IfxGtm_Dpll.h"
+#include "Gtm/Std/IfxGtm_Tim.h"
+#include "Gtm/Std/IfxGtm_Atom.h"
+#include "Gtm/Std/IfxGtm_Tbu.h"
+#include "Gtm/Std/IfxGtm_Cmu.h"
+#include "_PinMap/IfxGtm_PinMap.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Mask of the 24 bit TBU_TS1 angle base */
+#define IFXGTM_DPLL_ANGLECLOCK_TIMEBASE_MASK (0x00FFFFFFU)
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+
+/** \addtogroup IfxLld_Gtm_Dpll_AngleClock_Enumerations
+ * \{ */
+/** \brief Active edge of the input signal (DPLL_CTRL_1.TSL)
+ */
+typedef enum
+{
+    IfxGtm_Dpll_AngleClock_Edge_both    = 0,  /**< \brief rising and falling edges are teeth */
+    IfxGtm_Dpll_AngleClock_Edge_rising  = 1,  /**< \brief rising edges are teeth */
+    IfxGtm_Dpll_AngleClock_Edge_falling = 2   /**< \brief falling edges are teeth */
+} IfxGtm_Dpll_AngleClock_Edge;
+
+/** \} */
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+
+/** \addtogroup IfxLld_Gtm_Dpll_AngleClock_Data_Structures
+ * \{ */
+/** \brief Angle clock handle
+ */
+typedef struct
+{
+    Ifx_GTM *gtm;                          /**< \brief Pointer to GTM module */
+    uint32   subIncrementsPerRevolution;   /**< \brief Number of TBU_TS1 ticks per revolution */
+    uint16   subIncrementsPerTooth;        /**< \brief Number of TBU_TS1 ticks per tooth */
+    uint16   teethPerRevolution;           /**< \brief Number of teeth (active edges) per revolution */
+} IfxGtm_Dpll_AngleClock;
+
+/** \brief Configuration structure for the angle clock
+ */
+typedef struct
+{
+    Ifx_GTM                    *gtm;                     /**< \brief Pointer to GTM module */
+    IfxGtm_Tim_TinMap          *input;                   /**< \brief Tooth wheel / encoder input, must be a TIM0 channel 0 pin (DPLL TRIGGER) */
+    IfxPort_InputMode           inputMode;               /**< \brief Input pin mode */
+    IfxGtm_Dpll_AngleClock_Edge activeEdge;              /**< \brief Active edge of the input */
+    uint16                      teethPerRevolution;      /**< \brief Number of active edges per revolution, 1 .. 512 */
+    uint16                      subIncrementsPerTooth;   /**< \brief Number of sub-increments per active edge, 1 .. 1024 */
+    boolean                     subIncClock;             /**< \brief If TRUE, SUB_INC1 is selected as CMU_CLK7 and the clock is enabled */
+} IfxGtm_Dpll_AngleClock_Config;
+
+/** \} */
+
+/** \addtogroup IfxLld_Gtm_Dpll_AngleClock_Functions
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Returns the angle within the revolution
+ * \param clock Angle clock handle
+ * \return Angle in sub-increments, 0 .. subIncrementsPerRevolution - 1
+ */
+IFX_INLINE uint32 IfxGtm_Dpll_AngleClock_getAngle(IfxGtm_Dpll_AngleClock *clock);
+
+/** \brief Returns the raw 24 bit angle base TBU_TS1
+ * \param clock Angle clock handle
+ * \return TBU_TS1 value
+ */
+IFX_INLINE uint32 IfxGtm_Dpll_AngleClock_getTimeBase(IfxGtm_Dpll_AngleClock *clock);
+
+/** \brief Returns TRUE if the DPLL is locked on the input, i.e. the sub-increments follow the teeth
+ * \param clock Angle clock handle
+ * \return TRUE if locked
+ */
+IFX_INLINE boolean IfxGtm_Dpll_AngleClock_isLocked(IfxGtm_Dpll_AngleClock *clock);
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Returns the TBU_TS1 value at which the angle is reached next
+ * \param clock Angle clock handle
+ * \param angle Angle in sub-increments, 0 .. subIncrementsPerRevolution - 1
+ * \return TBU_TS1 value, between the next tick and one revolution ahead
+ */
+IFX_EXTERN uint32 IfxGtm_Dpll_AngleClock_getNextTimeBase(IfxGtm_Dpll_AngleClock *clock, uint32 angle);
+
+/** \brief Returns the rotation speed
+ * \param clock Angle clock handle
+ * \return Speed in revolutions per second, 0 if the DPLL is not locked
+ */
+IFX_EXTERN float32 IfxGtm_Dpll_AngleClock_getSpeed(IfxGtm_Dpll_AngleClock *clock);
+
+/** \brief Initialise the DPLL, the TIM0 channel 0 input and the TBU channel 1
+ * \param clock Angle clock handle
+ * \param config Configuration structure
+ * \return TRUE on success else FALSE
+ */
+IFX_EXTERN boolean IfxGtm_Dpll_AngleClock_init(IfxGtm_Dpll_AngleClock *clock, const IfxGtm_Dpll_AngleClock_Config *config);
+
+/** \brief Initialise the configuration structure with default values
+ * \param config Configuration structure
+ * \param gtm Pointer to GTM module
+ * \return None
+ */
+IFX_EXTERN void IfxGtm_Dpll_AngleClock_initConfig(IfxGtm_Dpll_AngleClock_Config *config, Ifx_GTM *gtm);
+
+/** \brief Configure an ATOM channel to change its output when the angle is reached
+ *
+ * The channel is set in SOMC mode, CCU1 compares against TBU_TS1. The action is executed once, at the next
+ * occurrence of the angle, without CPU interaction. The CCU1 notification of the channel can be used as
+ * interrupt or trigger source. Calling the function again re-arms the channel for a new angle.
+ * \param clock Angle clock handle
+ * \param atom Pointer to the ATOM object
+ * \param channel ATOM channel
+ * \param angle Angle in sub-increments, 0 .. subIncrementsPerRevolution - 1
+ * \param action Output action when the angle is reached, the initial signal level is 0
+ * \return None
+ */
+IFX_EXTERN void IfxGtm_Dpll_AngleClock_setAtomEvent(IfxGtm_Dpll_AngleClock *clock, Ifx_GTM_ATOM *atom, IfxGtm_Atom_Ch channel, uint32 angle, IfxGtm_Atom_SomcSignalLevelControl action);
+
+/** \brief Set the actual angle, e.g. on a reference pulse
+ * \param clock Angle clock handle
+ * \param angle Angle in sub-increments, 0 .. subIncrementsPerRevolution - 1
+ * \return None
+ */
+IFX_EXTERN void IfxGtm_Dpll_AngleClock_setAngle(IfxGtm_Dpll_AngleClock *clock, uint32 angle);
+
+/** \} */
+
+/******************************************************************************/
+/*---------------------Inline Function Implementations------------------------*/
+/******************************************************************************/
+
+IFX_INLINE uint32 IfxGtm_Dpll_AngleClock_getAngle(IfxGtm_Dpll_AngleClock *clock)
+{
+    return IfxGtm_Dpll_AngleClock_getTimeBase(clock) % clock->subIncrementsPerRevolution;
+}
+
+
+IFX_INLINE uint32 IfxGtm_Dpll_AngleClock_getTimeBase(IfxGtm_Dpll_AngleClock *clock)
+{
+    return clock->gtm->TBU.CH1_BASE.U & IFXGTM_DPLL_ANGLECLOCK_TIMEBASE_MASK;
+}
+
+
+IFX_INLINE boolean IfxGtm_Dpll_AngleClock_isLocked(IfxGtm_Dpll_AngleClock *clock)
+{
+    return clock->gtm->DPLL.STATUS.B.LOCK1 != 0;
+}
+
+
+#endif /* IFXGTM_DPLL_ANGLECLOCK_H */
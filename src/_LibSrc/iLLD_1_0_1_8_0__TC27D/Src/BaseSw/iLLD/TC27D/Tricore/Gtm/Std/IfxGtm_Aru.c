@@ -0,0 +1,221 @@
+/**
+ * \file IfxGtm_Aru.c
+ * \brief GTM  basic functionality
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "IfxGtm_Aru.h"
+#include "IfxGtm_Atom.h"
+#include "IfxGtm_Mcs.h"
+#include <string.h>
+
+/******************************************************************************/
+/*-----------------------Private Function Prototypes--------------------------*/
+/******************************************************************************/
+
+/** \brief Checks one connection
+ * \param connection Connection
+ * \return IfxGtm_Aru_Status_ok if the addresses, the producer and the consumer are in range
+ */
+static IfxGtm_Aru_Status IfxGtm_Aru_checkConnection(const IfxGtm_Aru_Connection *connection);
+
+/** \brief Returns a value identifying the consumer register
+ * \param consumer Consumer
+ * \return Consumer identifier
+ */
+static uint32 IfxGtm_Aru_getConsumerId(const IfxGtm_Aru_ConsumerConfig *consumer);
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+uint16 IfxGtm_Aru_allocateAddress(IfxGtm_Aru_AddressMap *map, uint32 first, uint32 last)
+{
+    uint32 address;
+
+    for (address = first; (address <= last) && (address <= IFXGTM_ARU_ADDRESS_MAX); address++)
+    {
+        if (IfxGtm_Aru_isAddressUsed(map, address) == FALSE)
+        {
+            map->used[address / 32] |= 1u << (address % 32);
+            return (uint16)address;
+        }
+    }
+
+    return IFXGTM_ARU_ADDRESS_NONE;
+}
+
+
+static IfxGtm_Aru_Status IfxGtm_Aru_checkConnection(const IfxGtm_Aru_Connection *connection)
+{
+    const IfxGtm_Aru_ConsumerConfig *consumer = &connection->consumer;
+    const IfxGtm_Aru_ProducerConfig *producer = &connection->producer;
+    boolean                          valid;
+
+    if ((connection->address < IFXGTM_ARU_ADDRESS_MIN) || (connection->address > IFXGTM_ARU_ADDRESS_MAX))
+    {
+        return IfxGtm_Aru_Status_invalidAddress;
+    }
+
+    if ((producer->type == IfxGtm_Aru_Producer_tim) && ((producer->module > IfxGtm_Tim_3) || (producer->channel > IfxGtm_Tim_Ch_7)))
+    {
+        return IfxGtm_Aru_Status_invalidProducer;
+    }
+
+    switch (consumer->type)
+    {
+    case IfxGtm_Aru_Consumer_atomRead0:
+    case IfxGtm_Aru_Consumer_atomRead1:
+        valid = (consumer->module <= IfxGtm_Atom_4) && (consumer->channel <= IfxGtm_Atom_Ch_7);
+        break;
+    case IfxGtm_Aru_Consumer_dpll:
+        valid = consumer->channel < 24;
+        break;
+    case IfxGtm_Aru_Consumer_brc:
+        valid = consumer->channel < 12;
+        break;
+    case IfxGtm_Aru_Consumer_mcsRegister:
+        valid = (consumer->module <= IfxGtm_Mcs_3) && (consumer->channel <= IfxGtm_Mcs_Ch_7) && (consumer->reg < IFXGTM_MCS_NUM_REGISTERS);
+        break;
+    default:
+        valid = FALSE;
+        break;
+    }
+
+    return (valid != FALSE) ? IfxGtm_Aru_Status_ok : IfxGtm_Aru_Status_invalidConsumer;
+}
+
+
+IfxGtm_Aru_Status IfxGtm_Aru_connect(Ifx_GTM *gtm, const IfxGtm_Aru_Connection *connections, uint32 count, uint32 *failed)
+{
+    IfxGtm_Aru_Status status = IfxGtm_Aru_validate(connections, count, failed);
+    uint32            i;
+
+    if (status != IfxGtm_Aru_Status_ok)
+    {
+        return status;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        const IfxGtm_Aru_Connection     *connection = &connections[i];
+        const IfxGtm_Aru_ConsumerConfig *consumer   = &connection->consumer;
+
+        if (connection->producer.type == IfxGtm_Aru_Producer_tim)
+        {
+            Ifx_GTM_TIM_CH *timCh = (Ifx_GTM_TIM_CH *)((uint32)&gtm->TIM[connection->producer.module].CH0 + (0x80 * connection->producer.channel));
+            timCh->CTRL.B.ARU_EN = 1;
+        }
+
+        switch (consumer->type)
+        {
+        case IfxGtm_Aru_Consumer_atomRead0:
+            IfxGtm_Atom_Ch_setAruReadAddress0(&gtm->ATOM[consumer->module], (IfxGtm_Atom_Ch)consumer->channel, connection->address);
+            IfxGtm_Atom_Ch_setAruInput(&gtm->ATOM[consumer->module], (IfxGtm_Atom_Ch)consumer->channel, TRUE);
+            break;
+        case IfxGtm_Aru_Consumer_atomRead1:
+            IfxGtm_Atom_Ch_setAruReadAddress1(&gtm->ATOM[consumer->module], (IfxGtm_Atom_Ch)consumer->channel, connection->address);
+            IfxGtm_Atom_Ch_setAruInput(&gtm->ATOM[consumer->module], (IfxGtm_Atom_Ch)consumer->channel, TRUE);
+            break;
+        case IfxGtm_Aru_Consumer_dpll:
+            gtm->DPLL.ID_PMTR[consumer->channel].B.ID_PMTR_x = connection->address;
+            break;
+        case IfxGtm_Aru_Consumer_brc:
+        {
+            /* SRCx_ADDR and SRCx_DEST alternate */
+            Ifx_GTM_BRC_SRC0_ADDR *srcAddr = (Ifx_GTM_BRC_SRC0_ADDR *)(&gtm->BRC.SRC0_ADDR + (2 * consumer->channel));
+            srcAddr->B.ADDR = connection->address;
+        }
+        break;
+        case IfxGtm_Aru_Consumer_mcsRegister:
+            IfxGtm_Mcs_writeRegister(gtm, (IfxGtm_Mcs)consumer->module, (IfxGtm_Mcs_Ch)consumer->channel, consumer->reg, connection->address);
+            break;
+        default:
+            break;
+        }
+    }
+
+    return IfxGtm_Aru_Status_ok;
+}
+
+
+static uint32 IfxGtm_Aru_getConsumerId(const IfxGtm_Aru_ConsumerConfig *consumer)
+{
+    uint32 reg = (consumer->type == IfxGtm_Aru_Consumer_mcsRegister) ? consumer->reg : 0;
+
+    return ((uint32)consumer->type << 24) | ((uint32)consumer->module << 16) | ((uint32)consumer->channel << 8) | reg;
+}
+
+
+void IfxGtm_Aru_initAddressMap(IfxGtm_Aru_AddressMap *map)
+{
+    memset(map, 0, sizeof(*map));
+    map->used[0]                                   |= 1u << 0;
+    map->used[(IFXGTM_ARU_NUM_ADDRESSES / 32) - 1] |= 1u << 31;
+}
+
+
+boolean IfxGtm_Aru_reserveAddress(IfxGtm_Aru_AddressMap *map, uint32 address)
+{
+    if ((address < IFXGTM_ARU_ADDRESS_MIN) || (address > IFXGTM_ARU_ADDRESS_MAX) || (IfxGtm_Aru_isAddressUsed(map, address) != FALSE))
+    {
+        return FALSE;
+    }
+
+    map->used[address / 32] |= 1u << (address % 32);
+
+    return TRUE;
+}
+
+
+IfxGtm_Aru_Status IfxGtm_Aru_validate(const IfxGtm_Aru_Connection *connections, uint32 count, uint32 *failed)
+{
+    IfxGtm_Aru_Status status = IfxGtm_Aru_Status_ok;
+    uint32            i, j;
+
+    for (i = 0; (i < count) && (status == IfxGtm_Aru_Status_ok); i++)
+    {
+        status = IfxGtm_Aru_checkConnection(&connections[i]);
+
+        for (j = 0; (j < i) && (status == IfxGtm_Aru_Status_ok); j++)
+        {
+            if (connections[j].address == connections[i].address)
+            {
+                status = IfxGtm_Aru_Status_duplicateAddress;
+            }
+            else if (IfxGtm_Aru_getConsumerId(&connections[j].consumer) == IfxGtm_Aru_getConsumerId(&connections[i].consumer))
+            {
+                status = IfxGtm_Aru_Status_duplicateConsumer;
+            }
+        }
+
+        if ((status != IfxGtm_Aru_Status_ok) && (failed != NULL_PTR))
+        {
+            *failed = i;
+        }
+    }
+
+    return status;
+}
@@ -0,0 +1,246 @@
+/**
+ * \file IfxGtm_Aru.h
+ * \brief GTM  basic functionality
+ * \ingroup IfxLld_Gtm
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup IfxLld_Gtm_Std_Aru Aru Basic Functionality
+ * \ingroup IfxLld_Gtm_Std
+ *
+ * The ARU routes 53 bit data words (24 bit low word, 29 bit high word with the ARU control bits) from a producer
+ * to a consumer without CPU copy. Each producer channel writes to its ARU write address (see the ARU write address
+ * table of the user manual); the consumer is configured with the address it reads from.
+ *
+ * A connection table declares the data flow: for each connection the producer write address and the consumer
+ * (ATOM channel read address 0/1, DPLL PMTR input, BRC input channel, MCS channel register used as address of an
+ * indirect ARU instruction). \ref IfxGtm_Aru_validate() checks the table before \ref IfxGtm_Aru_connect() applies it:
+ * - the addresses 0 and 0x1FF are reserved.
+ * - an ARU read is destructive: an address read by two consumers delivers each word to only one of them, such
+ * addresses are rejected, the data shall be duplicated by the BRC.
+ * - a consumer shall be configured once.
+ *
+ * The write addresses which are not fixed by the hardware, for example the addresses a MCS program writes to, are
+ * allocated with an \ref IfxGtm_Aru_AddressMap, in which the fixed addresses in use are reserved first.
+ *
+ * Example: pulse regeneration, the TIM0 channel 0 capture values are the compare values of ATOM0 channel 0:
+ * \code
+ * #define TIM0_CH0_ARU_ADDRESS ...   // from the ARU write address table of the user manual
+ *
+ * static const IfxGtm_Aru_Connection connections[] = {
+ *     {TIM0_CH0_ARU_ADDRESS, {IfxGtm_Aru_Producer_tim, IfxGtm_Tim_0, IfxGtm_Tim_Ch_0}, {IfxGtm_Aru_Consumer_atomRead0, IfxGtm_Atom_0, IfxGtm_Atom_Ch_0, 0}},
+ * };
+ *
+ * if (IfxGtm_Aru_connect(&MODULE_GTM, connections, 1, NULL_PTR) != IfxGtm_Aru_Status_ok)
+ * {
+ *     // invalid table, nothing is configured
+ * }
+ * \endcode
+ *
+ * \defgroup IfxLld_Gtm_Std_Aru_Enumerations ARU Enumerations
+ * \ingroup IfxLld_Gtm_Std_Aru
+ * \defgroup IfxLld_Gtm_Std_Aru_DataStructures ARU Data Structures
+ * \ingroup IfxLld_Gtm_Std_Aru
+ * \defgroup IfxLld_Gtm_Std_Aru_Basic_Functions ARU Basic Functions
+ * \ingroup IfxLld_Gtm_Std_Aru
+ */
+
+#ifndef IFXGTM_ARU_H
+#define IFXGTM_ARU_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "_Impl/IfxGtm_cfg.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Number of ARU addresses
+ */
+#define IFXGTM_ARU_NUM_ADDRESSES (512)
+
+/** \brief Lowest ARU address usable by a connection
+ */
+#define IFXGTM_ARU_ADDRESS_MIN   (0x001)
+
+/** \brief Highest ARU address usable by a connection
+ */
+#define IFXGTM_ARU_ADDRESS_MAX   (0x1FE)
+
+/** \brief Returned by \ref IfxGtm_Aru_allocateAddress() when no address is free
+ */
+#define IFXGTM_ARU_ADDRESS_NONE  (0xFFFF)
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+
+/** \addtogroup IfxLld_Gtm_Std_Aru_Enumerations
+ * \{ */
+/** \brief Consumer of an ARU connection
+ */
+typedef enum
+{
+    IfxGtm_Aru_Consumer_atomRead0,    /**< \brief ATOM channel, read address 0 (module: ATOM, channel: ATOM channel) */
+    IfxGtm_Aru_Consumer_atomRead1,    /**< \brief ATOM channel, read address 1 (module: ATOM, channel: ATOM channel) */
+    IfxGtm_Aru_Consumer_dpll,         /**< \brief DPLL input signal PMTR (channel: PMTR index 0..23) */
+    IfxGtm_Aru_Consumer_brc,          /**< \brief BRC input channel (channel: input channel 0..11) */
+    IfxGtm_Aru_Consumer_mcsRegister   /**< \brief MCS channel register (module: MCS, channel: MCS channel, reg: R0..R7) */
+} IfxGtm_Aru_Consumer;
+
+/** \brief Producer of an ARU connection, enabled by \ref IfxGtm_Aru_connect()
+ */
+typedef enum
+{
+    IfxGtm_Aru_Producer_other,  /**< \brief enabled by its own driver (ATOM, MCS, DPLL, BRC, ...) */
+    IfxGtm_Aru_Producer_tim     /**< \brief TIM channel, the GPR0/GPR1 values are written to the ARU */
+} IfxGtm_Aru_Producer;
+
+/** \brief Result of the connection table check
+ */
+typedef enum
+{
+    IfxGtm_Aru_Status_ok = 0,            /**< \brief the table is valid */
+    IfxGtm_Aru_Status_invalidAddress,    /**< \brief reserved or out of range ARU address */
+    IfxGtm_Aru_Status_invalidProducer,   /**< \brief producer module or channel out of range */
+    IfxGtm_Aru_Status_invalidConsumer,   /**< \brief consumer module, channel or register out of range */
+    IfxGtm_Aru_Status_duplicateAddress,  /**< \brief address read by two consumers, use the BRC */
+    IfxGtm_Aru_Status_duplicateConsumer  /**< \brief consumer configured by two connections */
+} IfxGtm_Aru_Status;
+
+/** \} */
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+
+/** \addtogroup IfxLld_Gtm_Std_Aru_DataStructures
+ * \{ */
+/** \brief Producer side of a connection
+ */
+typedef struct
+{
+    IfxGtm_Aru_Producer type;      /**< \brief producer type */
+    uint8               module;    /**< \brief TIM index for IfxGtm_Aru_Producer_tim */
+    uint8               channel;   /**< \brief TIM channel for IfxGtm_Aru_Producer_tim */
+} IfxGtm_Aru_ProducerConfig;
+
+/** \brief Consumer side of a connection
+ */
+typedef struct
+{
+    IfxGtm_Aru_Consumer type;      /**< \brief consumer type */
+    uint8               module;    /**< \brief ATOM or MCS index */
+    uint8               channel;   /**< \brief channel, PMTR or BRC input index */
+    uint8               reg;       /**< \brief MCS channel register index, 0 for R0 .. 7 for R7 */
+} IfxGtm_Aru_ConsumerConfig;
+
+/** \brief ARU connection: the consumer reads the words written by the producer
+ */
+typedef struct
+{
+    uint16                    address;    /**< \brief ARU write address of the producer */
+    IfxGtm_Aru_ProducerConfig producer;   /**< \brief producer */
+    IfxGtm_Aru_ConsumerConfig consumer;   /**< \brief consumer */
+} IfxGtm_Aru_Connection;
+
+/** \brief ARU address map, one bit per address in use
+ */
+typedef struct
+{
+    uint32 used[IFXGTM_ARU_NUM_ADDRESSES / 32];   /**< \brief bit set for the addresses in use */
+} IfxGtm_Aru_AddressMap;
+
+/** \} */
+
+/** \addtogroup IfxLld_Gtm_Std_Aru_Basic_Functions
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Indicates whether an address is in use
+ * \param map Address map
+ * \param address ARU address
+ * \return TRUE if the address is in use
+ */
+IFX_INLINE boolean IfxGtm_Aru_isAddressUsed(const IfxGtm_Aru_AddressMap *map, uint32 address);
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Allocates the first free address of a range
+ * \param map Address map
+ * \param first First address of the range, e.g. the first write address of a MCS
+ * \param last Last address of the range
+ * \return Allocated address, IFXGTM_ARU_ADDRESS_NONE if all addresses of the range are in use
+ */
+IFX_EXTERN uint16 IfxGtm_Aru_allocateAddress(IfxGtm_Aru_AddressMap *map, uint32 first, uint32 last);
+
+/** \brief Validates then applies a connection table
+ *
+ * Nothing is configured if the table is not valid. The producers and consumers shall be disabled while they are
+ * connected, their own drivers enable them afterwards.
+ * \param gtm Pointer to GTM module
+ * \param connections Connection table
+ * \param count Number of connections
+ * \param failed Index of the first invalid connection, may be NULL_PTR
+ * \return IfxGtm_Aru_Status_ok if the table was applied
+ */
+IFX_EXTERN IfxGtm_Aru_Status IfxGtm_Aru_connect(Ifx_GTM *gtm, const IfxGtm_Aru_Connection *connections, uint32 count, uint32 *failed);
+
+/** \brief Marks all addresses as free, except the reserved ones
+ * \param map Address map
+ * \return None
+ */
+IFX_EXTERN void IfxGtm_Aru_initAddressMap(IfxGtm_Aru_AddressMap *map);
+
+/** \brief Marks an address as in use, e.g. the fixed write address of a producer
+ * \param map Address map
+ * \param address ARU address
+ * \return FALSE if the address is reserved, out of range or already in use
+ */
+IFX_EXTERN boolean IfxGtm_Aru_reserveAddress(IfxGtm_Aru_AddressMap *map, uint32 address);
+
+/** \brief Checks a connection table
+ * \param connections Connection table
+ * \param count Number of connections
+ * \param failed Index of the first invalid connection, may be NULL_PTR
+ * \return IfxGtm_Aru_Status_ok if the table is valid
+ */
+IFX_EXTERN IfxGtm_Aru_Status IfxGtm_Aru_validate(const IfxGtm_Aru_Connection *connections, uint32 count, uint32 *failed);
+
+/** \} */
+
+/******************************************************************************/
+/*---------------------Inline Function Implementations------------------------*/
+/******************************************************************************/
+
+IFX_INLINE boolean IfxGtm_Aru_isAddressUsed(const IfxGtm_Aru_AddressMap *map, uint32 address)
+{
+    return (map->used[address / 32] & (1u << (address % 32))) != 0;
+}
+
+
+#endif /* IFXGTM_ARU_H */
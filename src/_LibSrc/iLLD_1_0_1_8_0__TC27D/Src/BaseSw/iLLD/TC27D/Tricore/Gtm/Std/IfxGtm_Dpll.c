@@ -27,6 +27,7 @@
 /******************************************************************************/
 
 #include "IfxGtm_Dpll.h"
+#include "IfxGtm_Tbu.h"
 
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
@@ -34,5 +35,40 @@
 
 float32 IfxGtm_Dpll_getSubIncFrequency(Ifx_GTM *gtm, IfxGtm_Dpll_SubInc index)
 {
-    return 0.0F;
+    Ifx_GTM_DPLL *dpll     = &gtm->DPLL;
+    uint32        pulses   = 0;
+    uint32        duration = 0;
+    float32       result   = 0.0F;
+
+    if (dpll->CTRL_1.B.DEN != 0)
+    {
+        if (index == IfxGtm_Dpll_SubInc_1)
+        {
+            if (dpll->CTRL_1.B.SGE1 != 0)
+            {
+                if (dpll->CTRL_0.B.RMO == 0)
+                {
+                    pulses   = dpll->CTRL_0.B.MLT + 1;
+                    duration = dpll->DT_T_ACT.B.DT_T_ACT;
+                }
+                else
+                {
+                    pulses   = dpll->MLS1.B.MLS1;
+                    duration = dpll->DT_S_ACT.B.DT_S_ACT;
+                }
+            }
+        }
+        else if ((dpll->CTRL_1.B.SGE2 != 0) && (dpll->CTRL_1.B.SMC != 0))
+        {
+            pulses   = dpll->MLS1.B.MLS1;
+            duration = dpll->DT_S_ACT.B.DT_S_ACT;
+        }
+    }
+
+    if (duration != 0)
+    {
+        result = (float32)pulses * IfxGtm_Tbu_getClockFrequency(gtm, IfxGtm_Tbu_Ts_0) / (float32)duration;
+    }
+
+    return result;
 }
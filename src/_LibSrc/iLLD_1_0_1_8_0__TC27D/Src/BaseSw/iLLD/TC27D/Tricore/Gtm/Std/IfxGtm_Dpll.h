@@ -42,10 +42,16 @@
 /*-------------------------Global Function Prototypes-------------------------*/
 /******************************************************************************/
 
-/** \brief FIXME TO DO
+/** \brief Returns the actual frequency of the DPLL sub-increment signal
+ *
+ * The frequency is computed from the duration of the last input increment measured by the DPLL
+ * (DT_T_ACT for TRIGGER, DT_S_ACT for STATE) and the number of sub-increments per input increment
+ * (MLT + 1 for TRIGGER, MLS1 for STATE). SUB_INC1 is generated from TRIGGER in normal mode (RMO = 0)
+ * and from STATE in emergency mode (RMO = 1), SUB_INC2 is generated from STATE in synchronous motor
+ * control mode (SMC = 1).
  * \param gtm Pointer to GTM module
  * \param index Dpll subincrement index
- * \return frequency
+ * \return Frequency in Hz, 0 if the generator is disabled or no increment has been measured
  */
 IFX_EXTERN float32 IfxGtm_Dpll_getSubIncFrequency(Ifx_GTM *gtm, IfxGtm_Dpll_SubInc index);
 
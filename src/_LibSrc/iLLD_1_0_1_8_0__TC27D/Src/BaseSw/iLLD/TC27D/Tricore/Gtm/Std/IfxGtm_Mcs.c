@@ -0,0 +1,152 @@
+/**
+ * \file IfxGtm_Mcs.c
+ * \brief GTM  basic functionality
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "IfxGtm_Mcs.h"
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+void IfxGtm_Mcs_clearChannelError(Ifx_GTM *gtm, IfxGtm_Mcs mcs, IfxGtm_Mcs_Ch channel)
+{
+    gtm->MCS[mcs].ERR.U = 1u << channel;
+}
+
+
+volatile Ifx_SRC_SRCR *IfxGtm_Mcs_getSrcPointer(Ifx_GTM *gtm, IfxGtm_Mcs mcs, IfxGtm_Mcs_Ch channel)
+{
+    (void)gtm;
+    return &MODULE_SRC.GTM.GTM[0].MCS[mcs][channel];
+}
+
+
+boolean IfxGtm_Mcs_loadProgram(Ifx_GTM *gtm, IfxGtm_Mcs mcs, uint32 address, const uint32 *program, uint32 size)
+{
+    if ((address & 3u) != 0)
+    {
+        return FALSE;
+    }
+
+    while (IfxGtm_Mcs_isRamReady(gtm, mcs) == FALSE)
+    {}
+
+    return IfxGtm_Mcs_writeRam(gtm, mcs, address / 4, program, size);
+}
+
+
+boolean IfxGtm_Mcs_readRam(Ifx_GTM *gtm, IfxGtm_Mcs mcs, uint32 index, uint32 *data, uint32 count)
+{
+    volatile uint32 *ram = IfxGtm_Mcs_getRamPointer(gtm, mcs);
+    uint32           i;
+
+    if ((index > (IFXGTM_MCS_RAM_SIZE / 4)) || (count > ((IFXGTM_MCS_RAM_SIZE / 4) - index)))
+    {
+        return FALSE;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        data[i] = ram[index + i];
+    }
+
+    return TRUE;
+}
+
+
+boolean IfxGtm_Mcs_requestAruRead(Ifx_GTM *gtm, uint32 address)
+{
+    Ifx_GTM_ARU_ARU_ACCESS access;
+
+    if (IfxGtm_Mcs_isAruAccessPending(gtm) != FALSE)
+    {
+        return FALSE;
+    }
+
+    access.U              = 0;
+    access.B.ADDR         = address;
+    access.B.RREQ         = 1;
+    gtm->ARU.ARU_ACCESS.U = access.U;
+
+    return TRUE;
+}
+
+
+void IfxGtm_Mcs_resetChannel(Ifx_GTM *gtm, IfxGtm_Mcs mcs, IfxGtm_Mcs_Ch channel)
+{
+    gtm->MCS[mcs].RST.U = 1u << channel;
+}
+
+
+void IfxGtm_Mcs_startChannel(Ifx_GTM *gtm, IfxGtm_Mcs mcs, IfxGtm_Mcs_Ch channel, uint32 address)
+{
+    Ifx_GTM_MCS_CH *channelRegs = IfxGtm_Mcs_getChannelPointer(gtm, mcs, channel);
+
+    channelRegs->CTRL.U    = 0;
+    channelRegs->PC.U      = address;
+    channelRegs->CTRL.B.EN = 1;
+}
+
+
+boolean IfxGtm_Mcs_writeAru(Ifx_GTM *gtm, uint32 address, uint32 dataLow, uint32 dataHigh)
+{
+    Ifx_GTM_ARU_ARU_ACCESS access;
+
+    if (IfxGtm_Mcs_isAruAccessPending(gtm) != FALSE)
+    {
+        return FALSE;
+    }
+
+    gtm->ARU.DATA_L.U     = dataLow;
+    gtm->ARU.DATA_H.U     = dataHigh;
+
+    access.U              = 0;
+    access.B.ADDR         = address;
+    access.B.WREQ         = 1;
+    gtm->ARU.ARU_ACCESS.U = access.U;
+
+    return TRUE;
+}
+
+
+boolean IfxGtm_Mcs_writeRam(Ifx_GTM *gtm, IfxGtm_Mcs mcs, uint32 index, const uint32 *data, uint32 count)
+{
+    volatile uint32 *ram = IfxGtm_Mcs_getRamPointer(gtm, mcs);
+    uint32           i;
+
+    if ((index > (IFXGTM_MCS_RAM_SIZE / 4)) || (count > ((IFXGTM_MCS_RAM_SIZE / 4) - index)))
+    {
+        return FALSE;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        ram[index + i] = data[i];
+    }
+
+    return TRUE;
+}
@@ -0,0 +1,408 @@
+/**
+ * \file IfxGtm_Mcs.h
+ * \brief GTM  basic functionality
+ * \ingroup IfxLld_Gtm
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup IfxLld_Gtm_Std_Mcs Mcs Basic Functionality
+ * \ingroup IfxLld_Gtm_Std
+ *
+ * The MCS (multi channel sequencer) executes microprograms from its own RAM, one program counter and one register
+ * set R0..R7 per channel. The channels read and write the ARU like any other GTM submodule, so that per edge logic
+ * (stepper ramps, pattern sequencing, protocol bit timing) runs without CPU interrupt.
+ *
+ * The driver loads the microprogram into the MCS RAM, starts and stops the channels, and gives the CPU access to
+ * the data exchanged with the channels:
+ * - the channel registers R0..R7 (24 bit), written by the CPU while the channel is stopped, read at any time.
+ * - the MCS RAM, shared by the program and the CPU, e.g. a table of periods updated by the CPU.
+ * - the MCS trigger bits (STRG/CTRG), set by the CPU to release a channel waiting on a trigger bit.
+ * - the ARU, through the CPU ARU access: the CPU writes a value at an ARU address read by a channel (ARD), or
+ * reads the value a channel writes (AWR).
+ *
+ * Example: the STM interrupt toggling a pin with a period table is replaced by an MCS channel writing the ATOM
+ * channel in SOMC mode through the ARU. The program is built with the MCS assembler, the table at RAM byte offset
+ * 0x400 is updated by the CPU.
+ * \code
+ * ;  R0: table pointer, R1: compare value, R2: ATOM control bits, R3: entries left
+ * start:  MOVL  R0, 0x400        ; first table entry
+ *         MOVL  R3, 16           ; 16 entries
+ * loop:   MRD   R4, R0           ; next period from the table
+ *         ADD   R1, R4           ; next compare value
+ *         AWR   R2, R1, ATOM_CH  ; compare value to the ATOM channel, through the ARU
+ *         ADDL  R0, 4
+ *         SUBL  R3, 1
+ *         JBC   STA, Z, loop
+ *         JMP   start
+ * \endcode
+ * \code
+ *     extern const uint32 waveProgram[];    // MCS assembler output
+ *     extern const uint32 waveProgramSize;  // in words
+ *
+ *     IfxGtm_Mcs_loadProgram(&MODULE_GTM, IfxGtm_Mcs_0, 0, waveProgram, waveProgramSize);
+ *     IfxGtm_Mcs_writeRam(&MODULE_GTM, IfxGtm_Mcs_0, 0x400 / 4, periods, 16);
+ *     IfxGtm_Mcs_writeRegister(&MODULE_GTM, IfxGtm_Mcs_0, IfxGtm_Mcs_Ch_0, 2, atomControl);
+ *     IfxGtm_Mcs_startChannel(&MODULE_GTM, IfxGtm_Mcs_0, IfxGtm_Mcs_Ch_0, 0);
+ * \endcode
+ *
+ * \defgroup IfxLld_Gtm_Std_Mcs_Basic_Functions MCS Basic Functions
+ * \ingroup IfxLld_Gtm_Std_Mcs
+ * \defgroup IfxLld_Gtm_Std_Mcs_Aru_Functions MCS ARU Functions
+ * \ingroup IfxLld_Gtm_Std_Mcs
+ */
+
+#ifndef IFXGTM_MCS_H
+#define IFXGTM_MCS_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "_Impl/IfxGtm_cfg.h"
+#include "Src/Std/IfxSrc.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Offset of the MCS0 RAM in the GTM address space
+ */
+#define IFXGTM_MCS_RAM_OFFSET       (0x38000u)
+
+/** \brief Address distance between the RAM of two MCS objects
+ */
+#define IFXGTM_MCS_RAM_DISTANCE     (0x8000u)
+
+/** \brief Size of the MCS RAM in bytes (RAM0 4KB and RAM1 2KB)
+ */
+#define IFXGTM_MCS_RAM_SIZE         (0x1800u)
+
+/** \brief Address distance between two MCS channel register sets
+ */
+#define IFXGTM_MCS_CHANNEL_DISTANCE (0x80u)
+
+/** \brief Number of general purpose registers per MCS channel
+ */
+#define IFXGTM_MCS_NUM_REGISTERS    (8)
+
+/** \addtogroup IfxLld_Gtm_Std_Mcs_Basic_Functions
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Returns the channel register set
+ *
+ * The channel 0 register set has the trigger registers in place of reserved space, the other registers are at the
+ * same offsets for all channels.
+ * \param gtm Pointer to GTM module
+ * \param mcs MCS object
+ * \param channel MCS channel
+ * \return Pointer to the channel registers
+ */
+IFX_INLINE Ifx_GTM_MCS_CH *IfxGtm_Mcs_getChannelPointer(Ifx_GTM *gtm, IfxGtm_Mcs mcs, IfxGtm_Mcs_Ch channel);
+
+/** \brief Returns the MCS RAM
+ * \param gtm Pointer to GTM module
+ * \param mcs MCS object
+ * \return Pointer to the first word of the MCS RAM
+ */
+IFX_INLINE volatile uint32 *IfxGtm_Mcs_getRamPointer(Ifx_GTM *gtm, IfxGtm_Mcs mcs);
+
+/** \brief Returns the MCS trigger bits
+ * \param gtm Pointer to GTM module
+ * \param mcs MCS object
+ * \return Trigger bits TRG0..TRG15
+ */
+IFX_INLINE uint16 IfxGtm_Mcs_getTriggers(Ifx_GTM *gtm, IfxGtm_Mcs mcs);
+
+/** \brief Clears MCS trigger bits
+ * \param gtm Pointer to GTM module
+ * \param mcs MCS object
+ * \param mask Trigger bits to clear
+ * \return None
+ */
+IFX_INLINE void IfxGtm_Mcs_clearTriggers(Ifx_GTM *gtm, IfxGtm_Mcs mcs, uint16 mask);
+
+/** \brief Indicates whether the channel is in error state (stopped by the MCS)
+ * \param gtm Pointer to GTM module
+ * \param mcs MCS object
+ * \param channel MCS channel
+ * \return TRUE if the channel is in error state
+ */
+IFX_INLINE boolean IfxGtm_Mcs_isChannelError(Ifx_GTM *gtm, IfxGtm_Mcs mcs, IfxGtm_Mcs_Ch channel);
+
+/** \brief Indicates whether the channel is running
+ * \param gtm Pointer to GTM module
+ * \param mcs MCS object
+ * \param channel MCS channel
+ * \return TRUE if the channel is enabled
+ */
+IFX_INLINE boolean IfxGtm_Mcs_isChannelRunning(Ifx_GTM *gtm, IfxGtm_Mcs mcs, IfxGtm_Mcs_Ch channel);
+
+/** \brief Indicates whether the MCS RAM initialisation after reset is finished
+ * \param gtm Pointer to GTM module
+ * \param mcs MCS object
+ * \return TRUE if the RAM can be accessed
+ */
+IFX_INLINE boolean IfxGtm_Mcs_isRamReady(Ifx_GTM *gtm, IfxGtm_Mcs mcs);
+
+/** \brief Returns a channel general purpose register
+ * \param gtm Pointer to GTM module
+ * \param mcs MCS object
+ * \param channel MCS channel
+ * \param index Register index, 0 for R0 .. 7 for R7
+ * \return Register value, 24 bit
+ */
+IFX_INLINE uint32 IfxGtm_Mcs_readRegister(Ifx_GTM *gtm, IfxGtm_Mcs mcs, IfxGtm_Mcs_Ch channel, uint32 index);
+
+/** \brief Sets MCS trigger bits, a channel waiting on a trigger bit continues
+ * \param gtm Pointer to GTM module
+ * \param mcs MCS object
+ * \param mask Trigger bits to set
+ * \return None
+ */
+IFX_INLINE void IfxGtm_Mcs_setTriggers(Ifx_GTM *gtm, IfxGtm_Mcs mcs, uint16 mask);
+
+/** \brief Stops the channel, the program counter and the registers are kept
+ * \param gtm Pointer to GTM module
+ * \param mcs MCS object
+ * \param channel MCS channel
+ * \return None
+ */
+IFX_INLINE void IfxGtm_Mcs_stopChannel(Ifx_GTM *gtm, IfxGtm_Mcs mcs, IfxGtm_Mcs_Ch channel);
+
+/** \brief Writes a channel general purpose register, the channel shall be stopped
+ * \param gtm Pointer to GTM module
+ * \param mcs MCS object
+ * \param channel MCS channel
+ * \param index Register index, 0 for R0 .. 7 for R7
+ * \param value Register value, 24 bit
+ * \return None
+ */
+IFX_INLINE void IfxGtm_Mcs_writeRegister(Ifx_GTM *gtm, IfxGtm_Mcs mcs, IfxGtm_Mcs_Ch channel, uint32 index, uint32 value);
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Clears the error state of the channel
+ * \param gtm Pointer to GTM module
+ * \param mcs MCS object
+ * \param channel MCS channel
+ * \return None
+ */
+IFX_EXTERN void IfxGtm_Mcs_clearChannelError(Ifx_GTM *gtm, IfxGtm_Mcs mcs, IfxGtm_Mcs_Ch channel);
+
+/** \brief Returns the service request node of the channel
+ * \param gtm Pointer to GTM module
+ * \param mcs MCS object
+ * \param channel MCS channel
+ * \return Pointer to the service request node
+ */
+IFX_EXTERN volatile Ifx_SRC_SRCR *IfxGtm_Mcs_getSrcPointer(Ifx_GTM *gtm, IfxGtm_Mcs mcs, IfxGtm_Mcs_Ch channel);
+
+/** \brief Loads a microprogram into the MCS RAM
+ *
+ * Waits for the end of the RAM initialisation after reset. The channels executing the replaced part of the RAM
+ * shall be stopped.
+ * \param gtm Pointer to GTM module
+ * \param mcs MCS object
+ * \param address Byte offset of the program in the MCS RAM, multiple of 4
+ * \param program Program words, as generated by the MCS assembler
+ * \param size Number of program words
+ * \return FALSE if the program does not fit in the MCS RAM
+ */
+IFX_EXTERN boolean IfxGtm_Mcs_loadProgram(Ifx_GTM *gtm, IfxGtm_Mcs mcs, uint32 address, const uint32 *program, uint32 size);
+
+/** \brief Copies words from the MCS RAM, e.g. results written by a channel
+ * \param gtm Pointer to GTM module
+ * \param mcs MCS object
+ * \param index Index of the first word in the MCS RAM
+ * \param data Destination
+ * \param count Number of words
+ * \return FALSE if the words are not in the MCS RAM
+ */
+IFX_EXTERN boolean IfxGtm_Mcs_readRam(Ifx_GTM *gtm, IfxGtm_Mcs mcs, uint32 index, uint32 *data, uint32 count);
+
+/** \brief Resets the channel: the channel is stopped, its registers and its program counter are cleared
+ * \param gtm Pointer to GTM module
+ * \param mcs MCS object
+ * \param channel MCS channel
+ * \return None
+ */
+IFX_EXTERN void IfxGtm_Mcs_resetChannel(Ifx_GTM *gtm, IfxGtm_Mcs mcs, IfxGtm_Mcs_Ch channel);
+
+/** \brief Starts the channel at a program address
+ *
+ * The channel is stopped first. The registers are kept, so that the parameters written with
+ * \ref IfxGtm_Mcs_writeRegister() before are given to the program.
+ * \param gtm Pointer to GTM module
+ * \param mcs MCS object
+ * \param channel MCS channel
+ * \param address Byte offset of the first instruction in the MCS RAM
+ * \return None
+ */
+IFX_EXTERN void IfxGtm_Mcs_startChannel(Ifx_GTM *gtm, IfxGtm_Mcs mcs, IfxGtm_Mcs_Ch channel, uint32 address);
+
+/** \brief Copies words into the MCS RAM, e.g. a table read by a channel
+ * \param gtm Pointer to GTM module
+ * \param mcs MCS object
+ * \param index Index of the first word in the MCS RAM
+ * \param data Source
+ * \param count Number of words
+ * \return FALSE if the words are not in the MCS RAM
+ */
+IFX_EXTERN boolean IfxGtm_Mcs_writeRam(Ifx_GTM *gtm, IfxGtm_Mcs mcs, uint32 index, const uint32 *data, uint32 count);
+
+/** \} */
+
+/** \addtogroup IfxLld_Gtm_Std_Mcs_Aru_Functions
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Returns the data of the last CPU ARU read
+ * \param gtm Pointer to GTM module
+ * \param dataLow Lower data word (24 bit)
+ * \param dataHigh Upper data word (29 bit, ACB bits included)
+ * \return None
+ */
+IFX_INLINE void IfxGtm_Mcs_getAruData(Ifx_GTM *gtm, uint32 *dataLow, uint32 *dataHigh);
+
+/** \brief Indicates whether the CPU ARU read or write request is pending
+ *
+ * A write request stays pending until the consumer reads the ARU address, a read request until the producer
+ * writes it.
+ * \param gtm Pointer to GTM module
+ * \return TRUE if the request is pending
+ */
+IFX_INLINE boolean IfxGtm_Mcs_isAruAccessPending(Ifx_GTM *gtm);
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Requests the read of an ARU address by the CPU, e.g. the value written by a channel with AWR
+ *
+ * The data is returned by \ref IfxGtm_Mcs_getAruData() when \ref IfxGtm_Mcs_isAruAccessPending() returns FALSE.
+ * \param gtm Pointer to GTM module
+ * \param address ARU address
+ * \return FALSE if a CPU ARU request is still pending
+ */
+IFX_EXTERN boolean IfxGtm_Mcs_requestAruRead(Ifx_GTM *gtm, uint32 address);
+
+/** \brief Provides a value at an ARU address, e.g. read by a channel with ARD
+ * \param gtm Pointer to GTM module
+ * \param address ARU address
+ * \param dataLow Lower data word (24 bit)
+ * \param dataHigh Upper data word (29 bit, ACB bits included)
+ * \return FALSE if a CPU ARU request is still pending
+ */
+IFX_EXTERN boolean IfxGtm_Mcs_writeAru(Ifx_GTM *gtm, uint32 address, uint32 dataLow, uint32 dataHigh);
+
+/** \} */
+
+/******************************************************************************/
+/*---------------------Inline Function Implementations------------------------*/
+/******************************************************************************/
+
+IFX_INLINE void IfxGtm_Mcs_clearTriggers(Ifx_GTM *gtm, IfxGtm_Mcs mcs, uint16 mask)
+{
+    gtm->MCS[mcs].CH0.CTRG.U = mask;
+}
+
+
+IFX_INLINE void IfxGtm_Mcs_getAruData(Ifx_GTM *gtm, uint32 *dataLow, uint32 *dataHigh)
+{
+    *dataLow  = gtm->ARU.DATA_L.U;
+    *dataHigh = gtm->ARU.DATA_H.U;
+}
+
+
+IFX_INLINE Ifx_GTM_MCS_CH *IfxGtm_Mcs_getChannelPointer(Ifx_GTM *gtm, IfxGtm_Mcs mcs, IfxGtm_Mcs_Ch channel)
+{
+    return (Ifx_GTM_MCS_CH *)((uint32)&gtm->MCS[mcs] + (channel * IFXGTM_MCS_CHANNEL_DISTANCE));
+}
+
+
+IFX_INLINE volatile uint32 *IfxGtm_Mcs_getRamPointer(Ifx_GTM *gtm, IfxGtm_Mcs mcs)
+{
+    return (volatile uint32 *)((uint32)gtm + IFXGTM_MCS_RAM_OFFSET + (mcs * IFXGTM_MCS_RAM_DISTANCE));
+}
+
+
+IFX_INLINE uint16 IfxGtm_Mcs_getTriggers(Ifx_GTM *gtm, IfxGtm_Mcs mcs)
+{
+    return (uint16)gtm->MCS[mcs].CH0.STRG.U;
+}
+
+
+IFX_INLINE boolean IfxGtm_Mcs_isAruAccessPending(Ifx_GTM *gtm)
+{
+    return (gtm->ARU.ARU_ACCESS.B.RREQ != 0) || (gtm->ARU.ARU_ACCESS.B.WREQ != 0);
+}
+
+
+IFX_INLINE boolean IfxGtm_Mcs_isChannelError(Ifx_GTM *gtm, IfxGtm_Mcs mcs, IfxGtm_Mcs_Ch channel)
+{
+    return IfxGtm_Mcs_getChannelPointer(gtm, mcs, channel)->CTRL.B.ERR != 0;
+}
+
+
+IFX_INLINE boolean IfxGtm_Mcs_isChannelRunning(Ifx_GTM *gtm, IfxGtm_Mcs mcs, IfxGtm_Mcs_Ch channel)
+{
+    return IfxGtm_Mcs_getChannelPointer(gtm, mcs, channel)->CTRL.B.EN != 0;
+}
+
+
+IFX_INLINE boolean IfxGtm_Mcs_isRamReady(Ifx_GTM *gtm, IfxGtm_Mcs mcs)
+{
+    return gtm->MCS[mcs].CTRL.B.RAM_RST == 0;
+}
+
+
+IFX_INLINE uint32 IfxGtm_Mcs_readRegister(Ifx_GTM *gtm, IfxGtm_Mcs mcs, IfxGtm_Mcs_Ch channel, uint32 index)
+{
+    return (&IfxGtm_Mcs_getChannelPointer(gtm, mcs, channel)->R0.U)[index];
+}
+
+
+IFX_INLINE void IfxGtm_Mcs_setTriggers(Ifx_GTM *gtm, IfxGtm_Mcs mcs, uint16 mask)
+{
+    gtm->MCS[mcs].CH0.STRG.U = mask;
+}
+
+
+IFX_INLINE void IfxGtm_Mcs_stopChannel(Ifx_GTM *gtm, IfxGtm_Mcs mcs, IfxGtm_Mcs_Ch channel)
+{
+    IfxGtm_Mcs_getChannelPointer(gtm, mcs, channel)->CTRL.U = 0;
+}
+
+
+IFX_INLINE void IfxGtm_Mcs_writeRegister(Ifx_GTM *gtm, IfxGtm_Mcs mcs, IfxGtm_Mcs_Ch channel, uint32 index, uint32 value)
+{
+    (&IfxGtm_Mcs_getChannelPointer(gtm, mcs, channel)->R0.U)[index] = value;
+}
+
+
+#endif /* IFXGTM_MCS_H */
@@ -29,6 +29,20 @@
 #include "IfxGtm_Tim_In.h"
 #include "IfxGtm_bf.h"
 #include "string.h"
+#include <math.h>
+
+/******************************************************************************/
+/*-----------------------Private Function Prototypes--------------------------*/
+/******************************************************************************/
+
+/** \brief Initialises the DMA channel which copies GPR0 / GPR1 into the capture ring buffer on each new value
+ * \param driver TIM Input object
+ * \param config Configuration structure for the input capture Timer
+ * \param timIndex TIM index
+ * \param channelIndex Channel index
+ * \return None
+ */
+IFX_STATIC void IfxGtm_Tim_In_initDma(IfxGtm_Tim_In *driver, const IfxGtm_Tim_In_Config *config, IfxGtm_Tim timIndex, IfxGtm_Tim_Ch channelIndex);
 
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
@@ -70,6 +84,7 @@ boolean IfxGtm_Tim_In_init(IfxGtm_Tim_In *driver, const IfxGtm_Tim_In_Config *co
     driver->dataLost         = FALSE;
     driver->overflowCnt      = FALSE;
     driver->edgeCounterUpper = 0;
+    driver->dma.useDma       = FALSE;
 
     channel->CTRL.B.TIM_MODE = IfxGtm_Tim_Mode_pwmMeasurement;
 
@@ -229,6 +244,11 @@ boolean IfxGtm_Tim_In_init(IfxGtm_Tim_In *driver, const IfxGtm_Tim_In_Config *co
         IfxGtm_Tim_Ch_setFilterNotification(channel, config->filter.irqOnGlitch);
     }
 
+    if (config->dma.useDma != FALSE)
+    {
+        IfxGtm_Tim_In_initDma(driver, config, timIndex, channelIndex);
+    }
+
     /* Enable TIM channel */
     channel->CTRL.B.TIM_EN = 1;
 
@@ -236,6 +256,67 @@ boolean IfxGtm_Tim_In_init(IfxGtm_Tim_In *driver, const IfxGtm_Tim_In_Config *co
 }
 
 
+IFX_STATIC void IfxGtm_Tim_In_initDma(IfxGtm_Tim_In *driver, const IfxGtm_Tim_In_Config *config, IfxGtm_Tim timIndex, IfxGtm_Tim_Ch channelIndex)
+{
+    IfxGtm_Tim_In_Dma       *dma        = &driver->dma;
+    Ifx_GTM_TIM_CH          *channel    = driver->channel;
+    uint32                   bufferSize = 1U << config->dma.bufferSize;
+    IfxDma_Dma               dmaModule;
+    IfxDma_Dma_ChannelConfig dmaCfg;
+    volatile Ifx_SRC_SRCR   *src;
+
+    /* The CPU would not see the data written by the DMA */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, IfxCpu_isAddressCachable(config->dma.buffer) == FALSE);
+    /* The channel interrupt is the DMA request */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->isrPriority == 0) && (config->timeout.irqOnTimeout == FALSE));
+
+    dma->channelId   = config->dma.channelId;
+    dma->buffer      = (IfxGtm_Tim_In_Capture *)IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), config->dma.buffer);
+    dma->bufferCount = (uint16)(bufferSize / sizeof(IfxGtm_Tim_In_Capture));
+    dma->readIndex   = 0;
+    dma->edgeCount   = 0;
+    dma->started     = FALSE;
+    dma->useDma      = TRUE;
+
+    /* The destination circular buffer wraps on an address aligned on its size */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((uint32)dma->buffer & (bufferSize - 1)) == 0);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, dma->bufferCount >= 2);
+
+    IfxDma_Dma_createModuleHandle(&dmaModule, &MODULE_DMA);
+    IfxDma_Dma_initChannelConfig(&dmaCfg, &dmaModule);
+
+    dmaCfg.channelId              = config->dma.channelId;
+    dmaCfg.hardwareRequestEnabled = TRUE; /* triggered by the TIM new value event */
+
+    /* GPR0 and GPR1 on each request, the source wraps back to GPR0 */
+    dmaCfg.sourceAddress               = (uint32)&channel->GPR0.U;
+    dmaCfg.sourceAddressCircularRange  = IfxDma_ChannelIncrementCircular_8;
+    dmaCfg.sourceCircularBufferEnabled = TRUE;
+
+    /* destination wraps in the capture ring buffer */
+    dmaCfg.destinationAddress               = (uint32)dma->buffer;
+    dmaCfg.destinationAddressCircularRange  = config->dma.bufferSize;
+    dmaCfg.destinationCircularBufferEnabled = TRUE;
+    dmaCfg.transferCount                    = dma->bufferCount;
+
+    /* the channel stays enabled after each transaction, the transfer count is reloaded */
+    dmaCfg.requestMode   = IfxDma_ChannelRequestMode_oneTransferPerRequest;
+    dmaCfg.operationMode = IfxDma_ChannelOperationMode_continuous;
+    dmaCfg.moveSize      = IfxDma_ChannelMoveSize_32bit;
+    dmaCfg.blockMode     = IfxDma_ChannelMove_2;
+
+    IfxDma_Dma_initChannel(&dma->channel, &dmaCfg);
+
+    /* Only the new value event requests the DMA */
+    IfxGtm_Tim_Ch_setNotificationMode(channel, IfxGtm_IrqMode_pulseNotify);
+    IfxGtm_Tim_Ch_setChannelNotification(channel, TRUE, FALSE, FALSE, FALSE);
+
+    src = IfxGtm_Tim_Ch_getSrcPointer(config->gtm, timIndex, channelIndex);
+    IfxSrc_init(src, IfxSrc_Tos_dma, (Ifx_Priority)config->dma.channelId);
+    IfxSrc_enable(src);
+}
+
+
 void IfxGtm_Tim_In_initConfig(IfxGtm_Tim_In_Config *config, Ifx_GTM *gtm)
 {
     memset(config, 0, sizeof(IfxGtm_Tim_In_Config));
@@ -263,6 +344,10 @@ void IfxGtm_Tim_In_initConfig(IfxGtm_Tim_In_Config *config, Ifx_GTM *gtm)
     config->filter.risingEdgeFilterTime  = 0;
     config->filter.fallingEdgeFilterTime = 0;
     config->filter.clock                 = IfxGtm_Cmu_Tim_Filter_Clk_0;
+    config->dma.useDma                   = FALSE;
+    config->dma.channelId                = IfxDma_ChannelId_none;
+    config->dma.buffer                   = NULL_PTR;
+    config->dma.bufferSize               = IfxDma_ChannelIncrementCircular_none;
 }
 
 
@@ -321,3 +406,98 @@ void IfxGtm_Tim_In_update(IfxGtm_Tim_In *driver)
         IfxGtm_Tim_Ch_clearNewValueEvent(driver->channel);
     }
 }
+
+
+uint32 IfxGtm_Tim_In_getDmaCaptureCount(IfxGtm_Tim_In *driver)
+{
+    IfxGtm_Tim_In_Dma *dma     = &driver->dma;
+    uint32             size    = (uint32)dma->bufferCount * sizeof(IfxGtm_Tim_In_Capture);
+    uint32             address = IfxDma_getChannelDestinationAddress(&MODULE_DMA, dma->channelId);
+
+    /* A capture being moved is not counted: the index is rounded down */
+    uint32             index   = ((address - (uint32)dma->buffer) & (size - 1)) / sizeof(IfxGtm_Tim_In_Capture);
+
+    return (index - dma->readIndex) & (dma->bufferCount - 1U);
+}
+
+
+uint32 IfxGtm_Tim_In_processDmaCaptures(IfxGtm_Tim_In *driver, IfxGtm_Tim_In_Statistics *stats)
+{
+    IfxGtm_Tim_In_Dma    *dma            = &driver->dma;
+    uint32                count          = IfxGtm_Tim_In_getDmaCaptureCount(driver);
+    uint32                coherentCount  = 0;
+    uint32                reference;
+    sint64                deltaSum       = 0;
+    uint64                deltaSquareSum = 0;
+    float32               dutySum        = 0.0;
+    float32               deltaMean;
+    float32               variance;
+    uint32                i;
+    IfxGtm_Tim_In_Capture capture;
+
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    /* The statistics are accumulated relative to the first period to keep the squares small */
+    reference        = dma->buffer[dma->readIndex].gpr1.B.GPR1;
+    stats->lostCount = 0;
+    stats->periodMin = 0xFFFFFFFF;
+    stats->periodMax = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        uint32 period;
+        uint32 pulseLength;
+        sint32 delta;
+
+        capture     = dma->buffer[dma->readIndex];
+        period      = capture.gpr1.B.GPR1;
+        pulseLength = capture.gpr0.B.GPR0;
+
+        /* 2 edges per period, a larger step of the edge counter means lost periods */
+        if (dma->started != FALSE)
+        {
+            uint8 edges = (uint8)(capture.gpr1.B.ECNT - dma->edgeCount);
+
+            if (edges > 2)
+            {
+                stats->lostCount += (uint32)(edges - 1) / 2;
+            }
+        }
+
+        dma->started   = TRUE;
+        dma->edgeCount = (uint8)capture.gpr1.B.ECNT;
+        dma->readIndex = (uint16)((dma->readIndex + 1) & (dma->bufferCount - 1));
+
+        stats->periodMin = __minu(stats->periodMin, period);
+        stats->periodMax = __maxu(stats->periodMax, period);
+        delta            = (sint32)(period - reference);
+        deltaSum        += delta;
+        deltaSquareSum  += (uint64)((sint64)delta * delta);
+
+        if ((capture.gpr0.B.ECNT == capture.gpr1.B.ECNT) && (period != 0))
+        {
+            dutySum += (float32)pulseLength / (float32)period;
+            coherentCount++;
+        }
+    }
+
+    deltaMean           = (float32)deltaSum / (float32)count;
+    variance            = ((float32)deltaSquareSum / (float32)count) - (deltaMean * deltaMean);
+    stats->count        = count;
+    stats->periodMean   = (float32)reference + deltaMean;
+    stats->periodJitter = (variance > 0.0) ? sqrtf(variance) : 0.0;
+    stats->dutyMean     = (coherentCount != 0) ? (dutySum / (float32)coherentCount) : 0.0;
+
+    /* The last capture is returned by the period and duty functions */
+    driver->periodTick      = capture.gpr1.B.GPR1;
+    driver->pulseLengthTick = capture.gpr0.B.GPR0;
+    driver->dataCoherent    = capture.gpr0.B.ECNT == capture.gpr1.B.ECNT;
+    driver->edgeCount       = (uint16)capture.gpr1.B.ECNT;
+    driver->dataLost        = stats->lostCount != 0;
+    driver->newData         = TRUE;
+
+    return count;
+}
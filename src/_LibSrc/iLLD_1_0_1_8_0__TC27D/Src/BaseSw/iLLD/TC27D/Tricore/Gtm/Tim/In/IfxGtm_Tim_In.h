@@ -21,6 +21,38 @@
  * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
  * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
  *
+ * \section IfxLld_Gtm_Tim_In_Dma Capture streaming with DMA
+ *   With dma.useDma, the new value interrupt of the TIM channel is routed to a DMA channel which copies
+ *   GPR0 (pulse length) and GPR1 (period) of each measured period into a ring buffer
+ *   (\ref IfxGtm_Tim_In_Capture). No CPU interrupt is raised per edge, \ref IfxGtm_Tim_In_onIsr() and
+ *   \ref IfxGtm_Tim_In_update() are not used.
+ *   \ref IfxGtm_Tim_In_processDmaCaptures() is called periodically, e.g. from the control loop, and
+ *   computes the period, duty cycle and jitter statistics over the captures received since the previous call.
+ *   It also updates the period and pulse length returned by \ref IfxGtm_Tim_In_getPeriodTicks() and
+ *   \ref IfxGtm_Tim_In_getPulseLengthTick() with the last capture.
+ *
+ *   - The ring buffer must be aligned on its size and located in a non cached memory.
+ *   - It must hold the captures of at least 2 processing periods. Captures overwritten before being
+ *     processed, as well as captures lost by the TIM, are detected with the edge counter (ECNT) stored
+ *     with each capture and reported in IfxGtm_Tim_In_Statistics.lostCount (up to 127 per call).
+ *   - The channel interrupt is used as DMA request: config.isrPriority must be 0 and timeout.irqOnTimeout FALSE.
+ *
+ * \code
+ *   IFX_ALIGN(256) static IfxGtm_Tim_In_Capture timCaptures[32]; // DSPR
+ *
+ *   timConfig.dma.useDma     = TRUE;
+ *   timConfig.dma.channelId  = IfxDma_ChannelId_4;
+ *   timConfig.dma.buffer     = timCaptures;
+ *   timConfig.dma.bufferSize = IfxDma_ChannelIncrementCircular_256;
+ *   IfxGtm_Tim_In_init(&tim, &timConfig);
+ *   ...
+ *   IfxGtm_Tim_In_Statistics stats;
+ *   if (IfxGtm_Tim_In_processDmaCaptures(&tim, &stats) != 0)
+ *   {
+ *       float32 speed = tim.captureClockFrequency / stats.periodMean;
+ *   }
+ * \endcode
+ *
  * \defgroup IfxLld_Gtm_Tim_In TIM Input Interface
  * \ingroup IfxLld_Gtm_Tim
  * \defgroup IfxLld_Gtm_Tim_In_DataStructures Data Structures
@@ -43,6 +75,7 @@
 #include "Gtm/Std/IfxGtm_Cmu.h"
 #include "Cpu/Std/IfxCpu.h"
 #include "_Utilities/Ifx_Assert.h"
+#include "Dma/Dma/IfxDma_Dma.h"
 
 /******************************************************************************/
 /*--------------------------------Enumerations--------------------------------*/
@@ -113,6 +146,51 @@ typedef struct
     boolean        irqOnTimeout;       /**< \brief If TRUE, the interrupt on timeout is enabled */
 } IfxGtm_Tim_In_ConfigTimeout;
 
+/** \brief Capture copied by the DMA: raw GPR0 / GPR1 values
+ */
+typedef struct
+{
+    Ifx_GTM_TIM_CH_GPR0 gpr0;           /**< \brief pulse length in ticks [23:0], edge counter [31:24] */
+    Ifx_GTM_TIM_CH_GPR1 gpr1;           /**< \brief period in ticks [23:0], edge counter [31:24] */
+} IfxGtm_Tim_In_Capture;
+
+/** \brief Configuration structure for the DMA capture streaming
+ */
+typedef struct
+{
+    boolean                         useDma;             /**< \brief If TRUE, GPR0 / GPR1 are copied by the DMA into the ring buffer on each new value */
+    IfxDma_ChannelId                channelId;          /**< \brief DMA channel, triggered by the TIM channel interrupt */
+    IfxGtm_Tim_In_Capture          *buffer;             /**< \brief Capture ring buffer. Must be aligned on its size and located in a non cached memory */
+    IfxDma_ChannelIncrementCircular bufferSize;         /**< \brief Capture ring buffer size, at least 2 captures */
+} IfxGtm_Tim_In_ConfigDma;
+
+/** \brief Statistics over the captures of one \ref IfxGtm_Tim_In_processDmaCaptures() call
+ */
+typedef struct
+{
+    uint32  count;                      /**< \brief number of captures processed */
+    uint32  lostCount;                  /**< \brief number of periods lost since the previous call (TIM data lost or ring buffer overrun) */
+    uint32  periodMin;                  /**< \brief minimal period in ticks */
+    uint32  periodMax;                  /**< \brief maximal period in ticks */
+    float32 periodMean;                 /**< \brief mean period in ticks */
+    float32 periodJitter;               /**< \brief standard deviation of the period in ticks */
+    float32 dutyMean;                   /**< \brief mean duty cycle 0.0 .. 1.0, over the coherent captures */
+} IfxGtm_Tim_In_Statistics;
+
+/** \brief DMA capture streaming data
+ */
+typedef struct
+{
+    IfxDma_Dma_Channel     channel;     /**< \brief DMA channel handle */
+    IfxDma_ChannelId       channelId;   /**< \brief DMA channel */
+    IfxGtm_Tim_In_Capture *buffer;      /**< \brief capture ring buffer (global address) */
+    uint16                 bufferCount; /**< \brief number of captures in the ring buffer, power of 2 */
+    uint16                 readIndex;   /**< \brief index of the next capture to be processed */
+    uint8                  edgeCount;   /**< \brief edge counter of the last processed capture */
+    boolean                started;     /**< \brief TRUE once a capture has been processed */
+    boolean                useDma;      /**< \brief TRUE if the captures are copied by the DMA */
+} IfxGtm_Tim_In_Dma;
+
 /** \} */
 
 /** \addtogroup IfxLld_Gtm_Tim_In_DataStructures
@@ -134,6 +212,7 @@ typedef struct
     IfxGtm_Tim      timIndex;                    /**< \brief Index of the TIM module being used. */
     IfxGtm_Tim_Ch   channelIndex;                /**< \brief Index of the TIM channel being used. */
     uint16          edgeCount;                   /**< \brief number of edges counted. */
+    IfxGtm_Tim_In_Dma dma;                       /**< \brief DMA capture streaming data */
 } IfxGtm_Tim_In;
 
 /** \brief Configuration structure for TIM input capture
@@ -149,6 +228,7 @@ typedef struct
     IfxGtm_Tim_In_ConfigCapture capture;            /**< \brief Capture configuration */
     IfxGtm_Tim_In_ConfigFilter  filter;             /**< \brief Filter configuration */
     IfxGtm_Tim_In_ConfigTimeout timeout;            /**< \brief Timeout configuration */
+    IfxGtm_Tim_In_ConfigDma     dma;                /**< \brief DMA capture streaming configuration */
 } IfxGtm_Tim_In_Config;
 
 /** \} */
@@ -234,6 +314,21 @@ IFX_EXTERN void IfxGtm_Tim_In_onIsr(IfxGtm_Tim_In *driver);
  */
 IFX_EXTERN void IfxGtm_Tim_In_update(IfxGtm_Tim_In *driver);
 
+/** \brief Returns the number of captures written by the DMA and not yet processed
+ * \param driver TIM Input object, initialised with dma.useDma
+ * \return Number of captures, up to the ring buffer size
+ */
+IFX_EXTERN uint32 IfxGtm_Tim_In_getDmaCaptureCount(IfxGtm_Tim_In *driver);
+
+/** \brief Processes the captures written by the DMA since the previous call\n
+ * Computes the period, duty and jitter statistics, and updates the period and pulse length of the driver
+ * with the last capture
+ * \param driver TIM Input object, initialised with dma.useDma
+ * \param stats Statistics over the processed captures, only valid if the return value is not 0
+ * \return Number of captures processed
+ */
+IFX_EXTERN uint32 IfxGtm_Tim_In_processDmaCaptures(IfxGtm_Tim_In *driver, IfxGtm_Tim_In_Statistics *stats);
+
 /** \} */
 
 /******************************************************************************/
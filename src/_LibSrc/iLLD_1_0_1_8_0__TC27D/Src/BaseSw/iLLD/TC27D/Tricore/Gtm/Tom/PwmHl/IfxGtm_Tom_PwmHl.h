@@ -99,6 +99,70 @@
  *   IfxStdIf_Timer_applyUpdate(timer);
  * \endcode
  *
+ * \section dma DMA update mode
+ *   With dma.useDma, \ref IfxGtm_Tom_PwmHl_setOnTime() and the other update functions write the compare
+ *   values into RAM (\ref IfxGtm_Tom_PwmHl_DmaBuffer) instead of the TOM shadow registers.
+ *   On each timer period, i.e. after the shadow registers got transferred to the compare registers,
+ *   the timer interrupt is routed to a DMA channel which copies the SR0 / SR1 values of all PWM channels
+ *   (one linked list entry per TOM channel). No CPU interrupt and no SFR access is needed for the update,
+ *   and the time at which the shadow registers are written does not depend on the CPU load.
+ *   The values written during period n are output during period n + 2 if written before the DMA transfer,
+ *   n + 1 otherwise.
+ *
+ *   - The timer must be configured with base.isrProvider = IfxSrc_Tos_dma, base.isrPriority = dma.channelId
+ *     and irqModeTimer = IfxGtm_IrqMode_pulseNotify.
+ *   - The DMA buffer must be aligned on 32 bytes and located in a DSPR or a non cached memory.
+ *   - The update of one period should not be written during the DMA transfer (about 1us after the period start),
+ *     else the DMA may copy channels with old and new values mixed. The usual place is the
+ *     ADC interrupt triggered by the PWM trigger channel.
+ *   - There is no need to call IfxStdIf_Timer_disableUpdate() / IfxStdIf_Timer_applyUpdate() around
+ *     the duty cycle updates.
+ *
+ * \code
+ *   IFX_ALIGN(32) IfxGtm_Tom_PwmHl_DmaBuffer pwmDmaBuffer; // DSPR
+ *
+ *   timerConfig.base.isrProvider = IfxSrc_Tos_dma;
+ *   timerConfig.base.isrPriority = IfxDma_ChannelId_1;
+ *   timerConfig.irqModeTimer     = IfxGtm_IrqMode_pulseNotify;
+ *   ...
+ *   driverConfig.dma.useDma    = TRUE;
+ *   driverConfig.dma.channelId = IfxDma_ChannelId_1;
+ *   driverConfig.dma.buffer    = &pwmDmaBuffer;
+ *   IfxGtm_Tom_PwmHl_init(&driverData, &driverConfig);
+ *   ...
+ *   IfxGtm_Tom_PwmHl_setOnTime(&driverData, onTime); // RAM writes only
+ * \endcode
+ *
+ * \section static Static configuration
+ *   \ref IfxGtm_Tom_PwmHl_setOnTimeStatic() updates the duty cycles from a constant configuration
+ *   (\ref IfxGtm_Tom_PwmHl_StaticConfig) instead of the driver object. When the configuration is a const object
+ *   visible in the translation unit, the compiler folds the TOM channel addresses, the period and the dead time
+ *   into immediate values, and the mode selection into a single code path: no pointer is loaded from the driver
+ *   object and no function pointer is called.
+ *
+ *   - The driver is still initialised by \ref IfxGtm_Tom_PwmHl_init(), which configures the channels and their
+ *     signal levels. The static configuration must describe the same channels, mode, period and times, see
+ *     \ref IfxGtm_Tom_PwmHl_isStaticConfigValid().
+ *   - The period, dead time and minimum pulse are constants: the functions changing them on the driver object
+ *     have no effect on the static update. The DMA update mode is not supported.
+ *
+ * \code
+ *   static IFX_CONST IfxGtm_Tom_PwmHl_StaticConfig pwmStatic = {
+ *       .tom          = &MODULE_GTM.TOM[0],
+ *       .mode         = Ifx_Pwm_Mode_centerAligned,
+ *       .channelCount = 3,
+ *       .ccx          = {IfxGtm_Tom_Ch_1, IfxGtm_Tom_Ch_3, IfxGtm_Tom_Ch_5},
+ *       .coutx        = {IfxGtm_Tom_Ch_2, IfxGtm_Tom_Ch_4, IfxGtm_Tom_Ch_6},
+ *       .period       = 5000,
+ *       .deadtime     = 50,
+ *       .minPulse     = 100,              // dead time included, as in IfxGtm_Tom_PwmHl_Base
+ *   };
+ *
+ *   IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, IfxGtm_Tom_PwmHl_isStaticConfigValid(&driverData, &pwmStatic));
+ *   ...
+ *   IfxGtm_Tom_PwmHl_setOnTimeStatic(&pwmStatic, onTime);
+ * \endcode
+ *
  * \defgroup IfxLld_Gtm_Tom_PwmHl TOM PWM HL Interface Driver
  * \ingroup IfxLld_Gtm_Tom
  * \defgroup IfxLld_Gtm_Tom_PwmHl_Data_Structures Data Structures
@@ -118,6 +182,7 @@
 
 #include "StdIf/IfxStdIf_PwmHl.h"
 #include "Gtm/Tom/Timer/IfxGtm_Tom_Timer.h"
+#include "Dma/Dma/IfxDma_Dma.h"
 
 /******************************************************************************/
 /*-----------------------------------Macros-----------------------------------*/
@@ -165,6 +230,31 @@ typedef struct
 
 /** \addtogroup IfxLld_Gtm_Tom_PwmHl_Data_Structures
  * \{ */
+/** \brief Compare shadow values of one TOM channel, in the SR0 / SR1 register order
+ */
+typedef struct
+{
+    uint32 shadowZero;          /**< \brief SR0 value */
+    uint32 shadowOne;           /**< \brief SR1 value */
+} IfxGtm_Tom_PwmHl_Shadow;
+
+/** \brief DMA update memory. Must be aligned on 32 bytes and located in a DSPR or a non cached memory
+ */
+typedef struct
+{
+    Ifx_DMA_CH              descriptors[2 * IFXGTM_TOM_PWMHL_MAX_NUM_CHANNELS];  /**< \brief DMA linked list, one entry per PWM TOM channel */
+    IfxGtm_Tom_PwmHl_Shadow shadow[IFXGTM_NUM_TOM_CHANNELS];                    /**< \brief Compare shadow values, indexed by TOM channel */
+} IfxGtm_Tom_PwmHl_DmaBuffer;
+
+/** \brief GTM TOM: PWM HL DMA configuration
+ */
+typedef struct
+{
+    boolean                     useDma;         /**< \brief If TRUE, the compare shadow registers are written by the DMA on each timer period */
+    IfxDma_ChannelId            channelId;      /**< \brief DMA channel, triggered by the timer interrupt */
+    IfxGtm_Tom_PwmHl_DmaBuffer *buffer;         /**< \brief DMA update memory */
+} IfxGtm_Tom_PwmHl_DmaConfig;
+
 /** \brief GTM TOM: PWM HL configuration
  */
 typedef struct
@@ -174,8 +264,23 @@ typedef struct
     IfxGtm_Tom                     tom;         /**< \brief TOM unit used */
     IFX_CONST IfxGtm_Tom_ToutMapP *ccx;         /**< \brief Pointer to an array of size base.channelCount/2 containing the channels used. All channels used for ccx and coutx must be adjacent to the channel used for the timer, order is not important. */
     IFX_CONST IfxGtm_Tom_ToutMapP *coutx;       /**< \brief Pointer to an array of size base.channelCount/2 containing the channels used. All channels used for ccx and coutx must be adjacent to the channel used for the timer, order is not important */
+    IfxGtm_Tom_PwmHl_DmaConfig     dma;         /**< \brief DMA update mode configuration */
 } IfxGtm_Tom_PwmHl_Config;
 
+/** \brief Constant configuration for \ref IfxGtm_Tom_PwmHl_setOnTimeStatic(), all times in timer ticks
+ */
+typedef struct
+{
+    Ifx_GTM_TOM   *tom;                                          /**< \brief TOM unit used */
+    Ifx_Pwm_Mode   mode;                                         /**< \brief PWM mode configured with the driver, Ifx_Pwm_Mode_off is not supported */
+    uint8          channelCount;                                 /**< \brief Number of PWM channels */
+    IfxGtm_Tom_Ch  ccx[IFXGTM_TOM_PWMHL_MAX_NUM_CHANNELS];       /**< \brief TOM channels used for the CCX outputs */
+    IfxGtm_Tom_Ch  coutx[IFXGTM_TOM_PWMHL_MAX_NUM_CHANNELS];     /**< \brief TOM channels used for the COUTX outputs */
+    Ifx_TimerValue period;                                       /**< \brief Timer period */
+    Ifx_TimerValue deadtime;                                     /**< \brief Dead time between the top and bottom channel */
+    Ifx_TimerValue minPulse;                                     /**< \brief Minimum pulse including the dead time, the maximum pulse is period - minPulse */
+} IfxGtm_Tom_PwmHl_StaticConfig;
+
 /** \brief Structure for PWM configuration
  */
 typedef struct
@@ -202,6 +307,8 @@ struct IfxGtm_Tom_PwmHl_s
     IfxGtm_Tom_Ch                coutx[IFXGTM_TOM_PWMHL_MAX_NUM_CHANNELS];       /**< \brief TOM channels used for the OUTX outputs */
     IfxGtm_Tom_Ch               *ccxTemp;                                        /**< \brief cached value */
     IfxGtm_Tom_Ch               *coutxTemp;                                      /**< \brief cached value */
+    IfxGtm_Tom_PwmHl_DmaBuffer  *dmaBuffer;                                      /**< \brief DMA update memory, NULL_PTR if the shadow registers are written by the CPU */
+    IfxDma_Dma_Channel           dmaChannel;                                     /**< \brief DMA channel used in DMA update mode */
 };
 
 /** \} */
@@ -229,6 +336,24 @@ IFX_EXTERN boolean IfxGtm_Tom_PwmHl_init(IfxGtm_Tom_PwmHl *driver, const IfxGtm_
  */
 IFX_EXTERN void IfxGtm_Tom_PwmHl_initConfig(IfxGtm_Tom_PwmHl_Config *config);
 
+/** \brief Checks that a static configuration matches the initialised driver
+ * \param driver GTM TOM PWM driver
+ * \param config Static configuration
+ * \return TRUE if the channels, mode and times match and the DMA update mode is not used, else FALSE
+ */
+IFX_EXTERN boolean IfxGtm_Tom_PwmHl_isStaticConfigValid(const IfxGtm_Tom_PwmHl *driver, const IfxGtm_Tom_PwmHl_StaticConfig *config);
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Sets the ON time from a constant configuration, see \ref static
+ * \param config Static configuration, a const object for the addresses to be folded at compile time
+ * \param tOn ON time
+ * \return None
+ */
+IFX_INLINE void IfxGtm_Tom_PwmHl_setOnTimeStatic(const IfxGtm_Tom_PwmHl_StaticConfig *config, Ifx_TimerValue *tOn);
+
 /** \} */
 
 /** \addtogroup IfxLld_Gtm_Tom_PwmHl_PwmHl_StdIf_Functions
@@ -325,4 +450,71 @@ IFX_EXTERN boolean IfxGtm_Tom_PwmHl_stdIfPwmHlInit(IfxStdIf_PwmHl *stdif, IfxGtm
 
 /** \} */
 
+/******************************************************************************/
+/*---------------------Inline Function Implementations------------------------*/
+/******************************************************************************/
+
+IFX_INLINE void IfxGtm_Tom_PwmHl_setOnTimeStatic(const IfxGtm_Tom_PwmHl_StaticConfig *config, Ifx_TimerValue *tOn)
+{
+    boolean        inverted      = (config->mode == Ifx_Pwm_Mode_centerAlignedInverted) || (config->mode == Ifx_Pwm_Mode_rightAligned);
+    boolean        centerAligned = (config->mode == Ifx_Pwm_Mode_centerAligned) || (config->mode == Ifx_Pwm_Mode_centerAlignedInverted);
+    Ifx_TimerValue period        = config->period;
+    Ifx_TimerValue deadtime      = config->deadtime;
+    uint8          channelIndex;
+
+    for (channelIndex = 0; channelIndex < config->channelCount; channelIndex++)
+    {
+        Ifx_GTM_TOM_CH *top    = IfxGtm_Tom_Ch_getChannelPointer(config->tom, inverted ? config->coutx[channelIndex] : config->ccx[channelIndex]);
+        Ifx_GTM_TOM_CH *bottom = IfxGtm_Tom_Ch_getChannelPointer(config->tom, inverted ? config->ccx[channelIndex] : config->coutx[channelIndex]);
+        Ifx_TimerValue  x      = inverted ? (period - tOn[channelIndex]) : tOn[channelIndex];
+        Ifx_TimerValue  cm0, cm1;
+
+        if ((x < config->minPulse) || (x <= deadtime))
+        {
+            x = 0;
+        }
+        else if (x > (period - config->minPulse))
+        {
+            x = period;
+        }
+        else
+        {}
+
+        /* same compare values as IfxGtm_Tom_PwmHl_setOnTime(), including the GTM issue handling */
+        if (x == period)
+        {
+            top->SR0.U    = period + 1;
+            top->SR1.U    = 2 + deadtime;
+            bottom->SR0.U = period + 2;
+            bottom->SR1.U = 2;
+        }
+        else if (x == 0)
+        {
+            top->SR0.U    = 1;
+            top->SR1.U    = period + 2;
+            bottom->SR0.U = 1 + deadtime;
+            bottom->SR1.U = period + 2;
+        }
+        else
+        {
+            if (centerAligned != FALSE)
+            {
+                cm1 = (period - x) / 2;
+                cm0 = (period + x) / 2;
+            }
+            else
+            {
+                cm1 = 2;
+                cm0 = x;
+            }
+
+            top->SR0.U    = cm0;
+            top->SR1.U    = cm1 + deadtime;
+            bottom->SR0.U = cm0 + deadtime;
+            bottom->SR1.U = cm1;
+        }
+    }
+}
+
+
 #endif /* IFXGTM_TOM_PWMHL_H */
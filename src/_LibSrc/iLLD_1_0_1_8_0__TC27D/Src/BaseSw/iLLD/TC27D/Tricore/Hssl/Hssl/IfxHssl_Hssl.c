@@ -28,6 +28,27 @@
 /******************************************************************************/
 
 #include "IfxHssl_Hssl.h"
+#include "Cpu/Std/IfxCpu.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/******************************************************************************/
+/*------------------------Private Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief issues the queued requests on the free channels of the pipeline
+ * \param pipeline pipeline handle
+ * \return None
+ */
+static void IfxHssl_Hssl_dispatchRequests(IfxHssl_Hssl_Pipeline *pipeline);
+
+/** \brief writes a register of the target device and waits for the acknowledge
+ * \param channel channel handle
+ * \param address address of the register
+ * \param data data to be written
+ * \param dataLength length of the data
+ * \return module status (ok, error)
+ */
+static IfxHssl_Hssl_Status IfxHssl_Hssl_writeTargetRegister(IfxHssl_Hssl_Channel *channel, uint32 address, uint32 data, IfxHssl_DataLength dataLength);
 
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
@@ -285,6 +306,46 @@ void IfxHssl_Hssl_initHsslModuleConfig(IfxHssl_Hssl_Config *config, Ifx_HSSL *hs
 }
 
 
+void IfxHssl_Hssl_initPipeline(IfxHssl_Hssl_Pipeline *pipeline, const IfxHssl_Hssl_PipelineConfig *config)
+{
+    uint32 chn;
+
+    for (chn = 0; chn < IFXHSSL_NUM_CHANNELS; chn++)
+    {
+        pipeline->channel[chn]     = config->channel[chn];
+        pipeline->activeValid[chn] = FALSE;
+    }
+
+    pipeline->queueHead  = 0;
+    pipeline->queueCount = 0;
+    pipeline->nextTag    = 0;
+}
+
+
+void IfxHssl_Hssl_initPipelineConfig(IfxHssl_Hssl_PipelineConfig *config)
+{
+    uint32 chn;
+
+    for (chn = 0; chn < IFXHSSL_NUM_CHANNELS; chn++)
+    {
+        config->channel[chn] = NULL_PTR;
+    }
+}
+
+
+void IfxHssl_Hssl_initStreamConfig(IfxHssl_Hssl_StreamConfig *config, IfxHssl_Hssl *hssl, IfxHssl_Hssl_Channel *channel)
+{
+    config->hssl             = hssl;
+    config->channel          = channel;
+    config->targetAddress[0] = 0;
+    config->targetAddress[1] = 0;
+    config->block[0]         = NULL_PTR;
+    config->block[1]         = NULL_PTR;
+    config->frameCount       = 1;
+    config->dmaChannelId     = IfxDma_ChannelId_0;
+}
+
+
 IfxHssl_Hssl_Status IfxHssl_Hssl_prepareStream(IfxHssl_Hssl_Channel *channel, uint32 slaveTargetAddress, Ifx_SizeT count)
 {
     IfxHssl_ChannelId channelId = channel->channelId;
@@ -328,6 +389,90 @@ IfxHssl_Hssl_Status IfxHssl_Hssl_prepareStream(IfxHssl_Hssl_Channel *channel, ui
 }
 
 
+void IfxHssl_Hssl_processPipeline(IfxHssl_Hssl_Pipeline *pipeline)
+{
+    uint32 chn;
+
+    for (chn = 0; chn < IFXHSSL_NUM_CHANNELS; chn++)
+    {
+        IfxHssl_Hssl_Channel *channel = pipeline->channel[chn];
+
+        if ((channel != NULL_PTR) && (pipeline->activeValid[chn] != FALSE))
+        {
+            IfxHssl_Hssl_Status status = IfxHssl_Hssl_waitAcknowledge(channel);
+
+            if (status != IfxHssl_Hssl_Status_busy)
+            {
+                IfxHssl_Hssl_PipelineEntry entry    = pipeline->active[chn];
+                uint32                     readData = 0;
+
+                if (status == IfxHssl_Hssl_Status_ok)
+                {
+                    if ((entry.request.frameRequest == IfxHssl_Hssl_FrameRequest_readFrame) || (entry.request.frameRequest == IfxHssl_Hssl_FrameRequest_readId))
+                    {
+                        readData = IfxHssl_Hssl_getReadData(channel);
+                    }
+                }
+                else
+                {
+                    // clear NACK, TTE, TIMEOUT and UNEXPECTED of the channel, the next request starts without error //
+                    channel->hssl->MFLAGSCL.U = 0x1111u << channel->channelId;
+                }
+
+                pipeline->activeValid[chn] = FALSE;
+
+                if (entry.request.callback != NULL_PTR)
+                {
+                    entry.request.callback(entry.request.callbackData, entry.tag, status, readData);
+                }
+            }
+        }
+    }
+
+    IfxHssl_Hssl_dispatchRequests(pipeline);
+}
+
+
+IfxHssl_Hssl_Status IfxHssl_Hssl_queueRequest(IfxHssl_Hssl_Pipeline *pipeline, const IfxHssl_Hssl_Request *request, uint16 *tag)
+{
+    IfxHssl_Hssl_Status status = IfxHssl_Hssl_Status_busy;
+    boolean             interruptState;
+
+    if ((request->frameRequest < IfxHssl_Hssl_FrameRequest_readFrame) || (request->frameRequest > IfxHssl_Hssl_FrameRequest_readId))
+    {
+        return IfxHssl_Hssl_Status_error;
+    }
+
+    interruptState = IfxCpu_disableInterrupts();
+
+    if (pipeline->queueCount < IFXHSSL_CFG_PIPELINE_REQUESTS)
+    {
+        IfxHssl_Hssl_PipelineEntry *entry = &pipeline->queue[(pipeline->queueHead + pipeline->queueCount) % IFXHSSL_CFG_PIPELINE_REQUESTS];
+
+        entry->request = *request;
+        entry->tag     = pipeline->nextTag;
+        pipeline->nextTag++;
+        pipeline->queueCount++;
+
+        if (tag != NULL_PTR)
+        {
+            *tag = entry->tag;
+        }
+
+        status = IfxHssl_Hssl_Status_ok;
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+
+    if (status == IfxHssl_Hssl_Status_ok)
+    {
+        IfxHssl_Hssl_dispatchRequests(pipeline);
+    }
+
+    return status;
+}
+
+
 IfxHssl_Hssl_Status IfxHssl_Hssl_read(IfxHssl_Hssl_Channel *channel, uint32 address, IfxHssl_DataLength dataLength)
 {
     uint32 data = 0;                                                                                                 // not required, data will be read back
@@ -389,6 +534,129 @@ IfxHssl_Hssl_Status IfxHssl_Hssl_singleFrameRequest(IfxHssl_Hssl_Channel *channe
 }
 
 
+IfxHssl_Hssl_Status IfxHssl_Hssl_startContinuousStream(IfxHssl_Hssl_Stream *stream, const IfxHssl_Hssl_StreamConfig *config)
+{
+    Ifx_HSSL                *hsslSFR = config->hssl->hssl;
+    IfxHssl_Hssl_Channel    *channel = config->channel;
+    IfxCpu_Id                coreId  = IfxCpu_getCoreId();
+    IfxHssl_Hssl_Status      status;
+    IfxDma_Dma               dma;
+    IfxDma_Dma_ChannelConfig dmaCfg;
+
+    // channel 2 carries the stream frames, register accesses are not possible through it //
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, channel->channelId != IfxHssl_ChannelId_2);
+
+    stream->hssl       = hsslSFR;
+    stream->block[0]   = config->block[0];
+    stream->block[1]   = config->block[1];
+    stream->frameCount = config->frameCount;
+
+    // one software request copies a complete memory block, one frame per DMA transfer //
+    IfxDma_Dma_createModuleHandle(&dma, &MODULE_DMA);
+    IfxDma_Dma_initChannelConfig(&dmaCfg, &dma);
+
+    dmaCfg.channelId          = config->dmaChannelId;
+    dmaCfg.requestMode        = IfxDma_ChannelRequestMode_completeTransactionPerRequest;
+    dmaCfg.moveSize           = IfxDma_ChannelMoveSize_32bit;
+    dmaCfg.blockMode          = IfxDma_ChannelMove_8;
+    dmaCfg.transferCount      = config->frameCount;
+    dmaCfg.sourceAddress      = IFXCPU_GLB_ADDR_DSPR(coreId, config->block[0]);
+    dmaCfg.destinationAddress = IFXCPU_GLB_ADDR_DSPR(coreId, config->block[1]);
+    IfxDma_Dma_initChannel(&stream->dmaChannel, &dmaCfg);
+
+    // memory blocks of the target device //
+    status = IfxHssl_Hssl_writeTargetRegister(channel, (uint32)&hsslSFR->TS.SA[0], config->targetAddress[0], IfxHssl_DataLength_32bit);
+
+    if (status == IfxHssl_Hssl_Status_ok)
+    {
+        status = IfxHssl_Hssl_writeTargetRegister(channel, (uint32)&hsslSFR->TS.SA[1], config->targetAddress[1], IfxHssl_DataLength_32bit);
+    }
+
+    if (status == IfxHssl_Hssl_Status_ok)
+    {
+        status = IfxHssl_Hssl_writeTargetRegister(channel, (uint32)&hsslSFR->TS.FC, config->frameCount, IfxHssl_DataLength_16bit);
+    }
+
+    // incase of transfers between two different devices (loopback off) //
+    if ((status == IfxHssl_Hssl_Status_ok) && (channel->loopBack == FALSE))
+    {
+        Ifx_HSSL_CFG       cfg;
+        Ifx_HSSL_MFLAGSSET flagsSet;
+
+        // continuous streaming mode of channel 2 on target device, same predivider as the initiator //
+        cfg.U        = 0;
+        cfg.B.PREDIV = hsslSFR->CFG.B.PREDIV;
+        cfg.B.SCM    = 1;
+        cfg.B.SMT    = IfxHssl_StreamingMode_continuous;
+        cfg.B.SMR    = IfxHssl_StreamingMode_continuous;
+        status       = IfxHssl_Hssl_writeTargetRegister(channel, (uint32)&hsslSFR->CFG, cfg.U, IfxHssl_DataLength_32bit);
+
+        if (status == IfxHssl_Hssl_Status_ok)
+        {
+            // enable streaming on target device //
+            flagsSet.U      = 0;
+            flagsSet.B.TSES = 1;
+            status          = IfxHssl_Hssl_writeTargetRegister(channel, (uint32)&hsslSFR->MFLAGSSET, flagsSet.U, IfxHssl_DataLength_32bit);
+        }
+    }
+
+    if (status != IfxHssl_Hssl_Status_ok)
+    {
+        return status;
+    }
+
+    // both memory blocks of the initiator, transmitted alternately //
+    hsslSFR->IS.SA[0].U                          = IFXCPU_GLB_ADDR_DSPR(coreId, config->block[0]);
+    hsslSFR->IS.SA[1].U                          = IFXCPU_GLB_ADDR_DSPR(coreId, config->block[1]);
+    hsslSFR->IS.FC.B.RELCOUNT                    = config->frameCount;
+
+    hsslSFR->CFG.B.SCM                           = 1;
+    hsslSFR->CFG.B.SMT                           = IfxHssl_StreamingMode_continuous;
+    hsslSFR->CFG.B.SMR                           = IfxHssl_StreamingMode_continuous;
+    hsslSFR->I[IfxHssl_ChannelId_2].ICON.B.TOREL = 0xff;
+
+    // incase of transfers within the device(loopback on) //
+    if (config->hssl->loopBack)
+    {
+        hsslSFR->MFLAGSSET.B.TSES = 1;
+    }
+
+    // initiate the transfer //
+    hsslSFR->MFLAGSSET.B.ISBS = 1;
+
+    return IfxHssl_Hssl_Status_ok;
+}
+
+
+void IfxHssl_Hssl_stopContinuousStream(IfxHssl_Hssl_Stream *stream)
+{
+    // the initiator stops at the end of the memory block in transmission //
+    stream->hssl->CFG.B.SMT = IfxHssl_StreamingMode_single;
+}
+
+
+IfxHssl_Hssl_Status IfxHssl_Hssl_updateStream(IfxHssl_Hssl_Stream *stream, const uint32 *data)
+{
+    IfxCpu_Id          coreId = IfxCpu_getCoreId();
+    uint32             idleBlock;
+
+    if (IfxDma_Dma_isChannelTransactionPending(&stream->dmaChannel) != FALSE)
+    {
+        return IfxHssl_Hssl_Status_busy;
+    }
+
+    // IMB selects the memory block in transmission //
+    idleBlock = (stream->hssl->MFLAGS.B.IMB == 0) ? 1 : 0;
+
+    IfxDma_Dma_setChannelSourceAddress(&stream->dmaChannel, IFXCPU_GLB_ADDR_DSPR(coreId, data));
+    IfxDma_Dma_setChannelDestinationAddress(&stream->dmaChannel, IFXCPU_GLB_ADDR_DSPR(coreId, stream->block[idleBlock]));
+    IfxDma_Dma_setChannelTransferCount(&stream->dmaChannel, stream->frameCount);
+    IfxDma_Dma_startChannelTransaction(&stream->dmaChannel);
+
+    return IfxHssl_Hssl_Status_ok;
+}
+
+
 IfxHssl_Hssl_Status IfxHssl_Hssl_waitAcknowledge(IfxHssl_Hssl_Channel *channel)
 {
     uint32            requestType = channel->currentFrameRequest;
@@ -480,3 +748,47 @@ IfxHssl_Hssl_Status IfxHssl_Hssl_writeStream(IfxHssl_Hssl *hssl, uint32 *data, I
     // streaming started //
     return IfxHssl_Hssl_Status_ok;
 }
+
+
+static void IfxHssl_Hssl_dispatchRequests(IfxHssl_Hssl_Pipeline *pipeline)
+{
+    boolean interruptState = IfxCpu_disableInterrupts();
+    uint32  chn;
+
+    for (chn = 0; (chn < IFXHSSL_NUM_CHANNELS) && (pipeline->queueCount != 0); chn++)
+    {
+        IfxHssl_Hssl_Channel *channel = pipeline->channel[chn];
+
+        if ((channel != NULL_PTR) && (pipeline->activeValid[chn] == FALSE))
+        {
+            const IfxHssl_Hssl_PipelineEntry *entry   = &pipeline->queue[pipeline->queueHead];
+            const IfxHssl_Hssl_Request       *request = &entry->request;
+
+            if (IfxHssl_Hssl_singleFrameRequest(channel, request->frameRequest, request->address, request->data, request->dataLength) == IfxHssl_Hssl_Status_ok)
+            {
+                pipeline->active[chn]      = *entry;
+                pipeline->activeValid[chn] = TRUE;
+                pipeline->queueHead        = (uint8)((pipeline->queueHead + 1) % IFXHSSL_CFG_PIPELINE_REQUESTS);
+                pipeline->queueCount--;
+            }
+        }
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+
+static IfxHssl_Hssl_Status IfxHssl_Hssl_writeTargetRegister(IfxHssl_Hssl_Channel *channel, uint32 address, uint32 data, IfxHssl_DataLength dataLength)
+{
+    IfxHssl_Hssl_Status status = IfxHssl_Hssl_write(channel, address, data, dataLength);
+
+    if (status == IfxHssl_Hssl_Status_ok)
+    {
+        do
+        {
+            status = IfxHssl_Hssl_waitAcknowledge(channel);
+        } while (status == IfxHssl_Hssl_Status_busy);
+    }
+
+    return status;
+}
@@ -170,6 +170,67 @@
  *     {}
  * \endcode
  *
+ * \subsection IfxLld_Hssl_Hssl_PipelinedTransfers Pipelined Transfers
+ *
+ * Each channel has one request in progress, waiting for its acknowledge. The pipeline distributes queued
+ * requests over several channels, so that up to one request per channel is on the link at the same time
+ * instead of one request per acknowledge latency. Each request gets a tag, given back with the status and the
+ * read data to the completion callback. The requests on different channels can complete in any order.
+ *
+ * \code
+ *     static IfxHssl_Hssl_Pipeline pipeline;
+ *
+ *     static void onRequestDone(void *data, uint16 tag, IfxHssl_Hssl_Status status, uint32 readData)
+ *     {
+ *         // match the tag with the request
+ *     }
+ *
+ *     IfxHssl_Hssl_PipelineConfig pipelineConfig;
+ *     IfxHssl_Hssl_initPipelineConfig(&pipelineConfig);
+ *     pipelineConfig.channel[0] = &hsslChannel[0];
+ *     pipelineConfig.channel[1] = &hsslChannel[1];
+ *     pipelineConfig.channel[3] = &hsslChannel[3];   // channel 2 is kept for streaming
+ *     IfxHssl_Hssl_initPipeline(&pipeline, &pipelineConfig);
+ *
+ *     IfxHssl_Hssl_Request request;
+ *     uint16               tag;
+ *     request.frameRequest = IfxHssl_Hssl_FrameRequest_writeFrame;
+ *     request.address      = 0x70000000;
+ *     request.data         = 0x12345678;
+ *     request.dataLength   = IfxHssl_DataLength_32bit;
+ *     request.callback     = &onRequestDone;
+ *     request.callbackData = NULL_PTR;
+ *     IfxHssl_Hssl_queueRequest(&pipeline, &request, &tag);
+ *
+ *     // cyclic task or COK / ERR interrupts of the channels
+ *     IfxHssl_Hssl_processPipeline(&pipeline);
+ * \endcode
+ *
+ * \subsection IfxLld_Hssl_Hssl_ContinuousStreaming Continuous Streaming
+ *
+ * In continuous streaming mode the initiator transmits its two memory blocks alternately without stopping, and
+ * the target writes them alternately to its two memory blocks. \ref IfxHssl_Hssl_updateStream() copies the new
+ * data by DMA into the block which is not transmitted. The DMA copy is much faster than the transmission of a
+ * block, it is finished before the block is transmitted if the update is done after the previous block switch.
+ *
+ * \code
+ *     __attribute__ ((aligned(32))) uint32 streamBlock[2][80];   // 10 frames of 32 bytes each
+ *     static IfxHssl_Hssl_Stream stream;
+ *
+ *     IfxHssl_Hssl_StreamConfig streamConfig;
+ *     IfxHssl_Hssl_initStreamConfig(&streamConfig, &hssl, &hsslChannel[0]);
+ *     streamConfig.targetAddress[0] = 0x70000000;
+ *     streamConfig.targetAddress[1] = 0x70000200;
+ *     streamConfig.block[0]         = streamBlock[0];
+ *     streamConfig.block[1]         = streamBlock[1];
+ *     streamConfig.frameCount       = 10;
+ *     streamConfig.dmaChannelId     = IfxDma_ChannelId_4;
+ *     IfxHssl_Hssl_startContinuousStream(&stream, &streamConfig);
+ *
+ *     // new sensor image
+ *     IfxHssl_Hssl_updateStream(&stream, sensorImage);
+ * \endcode
+ *
  * \subsection IfxLld_Hssl_Hssl_DMAOperatedCommandQueues DMA Operated Command Queues
  *
  * It makes sense to do this from outside the driver, by initialising the DMA after HSSL, and send command queues through linked lists
@@ -361,6 +422,8 @@
  * \ingroup IfxLld_Hssl_Hssl
  * \defgroup IfxLld_Hssl_Hssl_StreamingCom Streaming Communication
  * \ingroup IfxLld_Hssl_Hssl
+ * \defgroup IfxLld_Hssl_Hssl_PipelinedCom Pipelined Communication
+ * \ingroup IfxLld_Hssl_Hssl
  */
 
 #ifndef IFXHSSL_HSSL_H
@@ -372,6 +435,7 @@
 
 #include "Hssl/Std/IfxHssl.h"
 #include "Port/Std/IfxPort.h"
+#include "Dma/Dma/IfxDma_Dma.h"
 
 /******************************************************************************/
 /*--------------------------------Enumerations--------------------------------*/
@@ -479,6 +543,76 @@ typedef struct
     uint16                    preDivider;          /**< \brief Defines the down-scaled module clock to be used by all channel timeout timers */
 } IfxHssl_Hssl_Config;
 
+/** \brief completion callback of a pipelined request
+ * \param data callbackData of the request
+ * \param tag tag of the request, given by IfxHssl_Hssl_queueRequest()
+ * \param status ok, or error if the request was not acknowledged (NACK, tag error, timeout, unexpected frame)
+ * \param readData data of the read response, 0 for the other requests
+ */
+typedef void (*IfxHssl_Hssl_RequestCallback)(void *data, uint16 tag, IfxHssl_Hssl_Status status, uint32 readData);
+
+/** \brief pipelined request
+ */
+typedef struct
+{
+    IfxHssl_Hssl_FrameRequest    frameRequest;       /**< \brief frame request (read, write, trigger frame and read id) */
+    uint32                       address;            /**< \brief address of the location on the target device */
+    uint32                       data;               /**< \brief data to be written */
+    IfxHssl_DataLength           dataLength;         /**< \brief length of the data */
+    IfxHssl_Hssl_RequestCallback callback;           /**< \brief completion callback, NULL_PTR if none */
+    void                        *callbackData;       /**< \brief first parameter of the callback */
+} IfxHssl_Hssl_Request;
+
+/** \brief request with its tag
+ */
+typedef struct
+{
+    IfxHssl_Hssl_Request request;       /**< \brief request */
+    uint16               tag;           /**< \brief tag of the request */
+} IfxHssl_Hssl_PipelineEntry;
+
+/** \brief pipeline handle
+ */
+typedef struct
+{
+    IfxHssl_Hssl_Channel      *channel[IFXHSSL_NUM_CHANNELS];            /**< \brief channels used by the pipeline, NULL_PTR if not used */
+    IfxHssl_Hssl_PipelineEntry active[IFXHSSL_NUM_CHANNELS];             /**< \brief request in progress on each channel */
+    boolean                    activeValid[IFXHSSL_NUM_CHANNELS];        /**< \brief TRUE while a request is in progress on the channel */
+    IfxHssl_Hssl_PipelineEntry queue[IFXHSSL_CFG_PIPELINE_REQUESTS];     /**< \brief requests waiting for a free channel */
+    uint8                      queueHead;                                /**< \brief index of the oldest queued request */
+    uint8                      queueCount;                               /**< \brief number of queued requests */
+    uint16                     nextTag;                                  /**< \brief tag of the next request */
+} IfxHssl_Hssl_Pipeline;
+
+/** \brief configuration structure of the pipeline
+ */
+typedef struct
+{
+    IfxHssl_Hssl_Channel *channel[IFXHSSL_NUM_CHANNELS];       /**< \brief initialised channels used by the pipeline, NULL_PTR if not used */
+} IfxHssl_Hssl_PipelineConfig;
+
+/** \brief continuous stream handle
+ */
+typedef struct
+{
+    Ifx_HSSL          *hssl;              /**< \brief pointer to HSSL registers */
+    uint32            *block[2];          /**< \brief memory blocks of the initiator */
+    Ifx_SizeT          frameCount;        /**< \brief number of frames per memory block */
+    IfxDma_Dma_Channel dmaChannel;        /**< \brief DMA channel copying the data into the memory blocks */
+} IfxHssl_Hssl_Stream;
+
+/** \brief configuration structure of the continuous stream
+ */
+typedef struct
+{
+    IfxHssl_Hssl         *hssl;                 /**< \brief HSSL handle */
+    IfxHssl_Hssl_Channel *channel;              /**< \brief channel for the register accesses preparing the target, not channel 2 */
+    uint32                targetAddress[2];     /**< \brief addresses of the memory blocks on the target device, aligned on 32 bytes */
+    uint32               *block[2];             /**< \brief memory blocks of the initiator, aligned on 32 bytes, frameCount * 32 bytes each */
+    Ifx_SizeT             frameCount;           /**< \brief number of frames of 32 bytes per memory block */
+    IfxDma_ChannelId      dmaChannelId;         /**< \brief DMA channel copying the data into the memory blocks */
+} IfxHssl_Hssl_StreamConfig;
+
 /** \} */
 
 /** \addtogroup IfxLld_Hssl_Hssl_ModuleFunctions
@@ -672,6 +806,14 @@ IFX_EXTERN void IfxHssl_Hssl_delay(IfxHssl_Hsct *hsct);
 /*-------------------------Global Function Prototypes-------------------------*/
 /******************************************************************************/
 
+/** \brief Fills the continuous stream config structure with default values
+ * \param config configuration structure of the continuous stream
+ * \param hssl HSSL Handle
+ * \param channel channel for the register accesses preparing the target
+ * \return None
+ */
+IFX_EXTERN void IfxHssl_Hssl_initStreamConfig(IfxHssl_Hssl_StreamConfig *config, IfxHssl_Hssl *hssl, IfxHssl_Hssl_Channel *channel);
+
 /** \brief Prepares the target device for streaming
  * \param channel channel handle
  * \param slaveTargetAddress address of the location on target device where the data needs to be transfered
@@ -694,10 +836,83 @@ IFX_EXTERN IfxHssl_Hssl_Status IfxHssl_Hssl_prepareStream(IfxHssl_Hssl_Channel *
  * A coding example can be found in \ref IfxLld_Hssl_Hssl_Usage
  *
  */
+/** \brief Prepares the target device and starts the continuous streaming of the two memory blocks
+ *
+ * The memory blocks shall contain the first data.
+ * \param stream continuous stream handle
+ * \param config configuration structure of the continuous stream
+ * \return module status, error if a register access to the target failed
+ *
+ * A coding example can be found in \ref IfxLld_Hssl_Hssl_ContinuousStreaming
+ *
+ */
+IFX_EXTERN IfxHssl_Hssl_Status IfxHssl_Hssl_startContinuousStream(IfxHssl_Hssl_Stream *stream, const IfxHssl_Hssl_StreamConfig *config);
+
+/** \brief Stops the continuous streaming after the memory block in transmission
+ * \param stream continuous stream handle
+ * \return None
+ */
+IFX_EXTERN void IfxHssl_Hssl_stopContinuousStream(IfxHssl_Hssl_Stream *stream);
+
+/** \brief Copies new data by DMA into the memory block which is not transmitted
+ * \param stream continuous stream handle
+ * \param data frameCount * 32 bytes of data, shall not be modified until the copy is finished
+ * \return module status, busy if the previous copy is not finished
+ *
+ * A coding example can be found in \ref IfxLld_Hssl_Hssl_ContinuousStreaming
+ *
+ */
+IFX_EXTERN IfxHssl_Hssl_Status IfxHssl_Hssl_updateStream(IfxHssl_Hssl_Stream *stream, const uint32 *data);
+
 IFX_EXTERN IfxHssl_Hssl_Status IfxHssl_Hssl_writeStream(IfxHssl_Hssl *hssl, uint32 *data, Ifx_SizeT count);
 
 /** \} */
 
+/** \addtogroup IfxLld_Hssl_Hssl_PipelinedCom
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Initialises the pipeline
+ * \param pipeline pipeline handle
+ * \param config configuration structure of the pipeline
+ * \return None
+ *
+ * A coding example can be found in \ref IfxLld_Hssl_Hssl_PipelinedTransfers
+ *
+ */
+IFX_EXTERN void IfxHssl_Hssl_initPipeline(IfxHssl_Hssl_Pipeline *pipeline, const IfxHssl_Hssl_PipelineConfig *config);
+
+/** \brief Fills the pipeline config structure with default values (no channel)
+ * \param config configuration structure of the pipeline
+ * \return None
+ */
+IFX_EXTERN void IfxHssl_Hssl_initPipelineConfig(IfxHssl_Hssl_PipelineConfig *config);
+
+/** \brief Completes the acknowledged requests and issues the queued requests on the free channels
+ *
+ * The completion callbacks are called from this function. It shall be called from one context only (cyclic task
+ * or the COK / ERR interrupts of the channels, same priority).
+ * \param pipeline pipeline handle
+ * \return None
+ */
+IFX_EXTERN void IfxHssl_Hssl_processPipeline(IfxHssl_Hssl_Pipeline *pipeline);
+
+/** \brief Queues a request, issued at once if a channel is free
+ * \param pipeline pipeline handle
+ * \param request request, copied into the queue
+ * \param tag returns the tag of the request, can be NULL_PTR
+ * \return module status, busy if the queue is full, error if the frame request is not valid
+ *
+ * A coding example can be found in \ref IfxLld_Hssl_Hssl_PipelinedTransfers
+ *
+ */
+IFX_EXTERN IfxHssl_Hssl_Status IfxHssl_Hssl_queueRequest(IfxHssl_Hssl_Pipeline *pipeline, const IfxHssl_Hssl_Request *request, uint16 *tag);
+
+/** \} */
+
 /******************************************************************************/
 /*---------------------Inline Function Implementations------------------------*/
 /******************************************************************************/
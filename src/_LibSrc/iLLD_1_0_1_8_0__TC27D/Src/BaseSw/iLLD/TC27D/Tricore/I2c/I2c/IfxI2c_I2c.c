@@ -27,11 +27,133 @@
 /******************************************************************************/
 
 #include "IfxI2c_I2c.h"
+#include "_Utilities/Ifx_Assert.h"
+
+/******************************************************************************/
+/*------------------------Private Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief completes the current transaction and starts the next one
+ * \param async Handle of the interrupt driven transfers
+ * \return None
+ */
+static void IfxI2c_I2c_finishTransaction(IfxI2c_I2c_Async *async);
+
+/** \brief counts the refresh of a register block and calls its callback
+ * \param data register block object
+ * \param status status of the refresh
+ * \return None
+ */
+static void IfxI2c_I2c_pollDone(void *data, IfxI2c_I2c_Status status);
+
+/** \brief requests the stop condition, or completes the transaction if the bus is already released
+ * \param async Handle of the interrupt driven transfers
+ * \return None
+ */
+static void IfxI2c_I2c_requestStop(IfxI2c_I2c_Async *async);
+
+/** \brief starts the read phase: device address with RnW bit set, repeated start if the write phase was executed
+ * \param async Handle of the interrupt driven transfers
+ * \return None
+ */
+static void IfxI2c_I2c_startRead(IfxI2c_I2c_Async *async);
+
+/** \brief starts the next queued transaction if no transaction is being executed
+ * \param async Handle of the interrupt driven transfers
+ * \return None
+ */
+static void IfxI2c_I2c_startTransaction(IfxI2c_I2c_Async *async);
+
+/** \brief starts the write phase: device address and transmitted bytes written at once to the FIFO
+ * \param async Handle of the interrupt driven transfers
+ * \return None
+ */
+static void IfxI2c_I2c_startWrite(IfxI2c_I2c_Async *async);
 
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
 
+boolean IfxI2c_I2c_addPoll(IfxI2c_I2c_Async *async, IfxI2c_I2c_Poll *poll, const IfxI2c_I2c_PollConfig *config)
+{
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, config->period > 0);
+
+    if (async->pollCount >= IFXI2C_CFG_POLL_LENGTH)
+    {
+        return FALSE;
+    }
+
+    poll->transaction.device       = config->device;
+    poll->transaction.txData       = config->txData;
+    poll->transaction.txSize       = config->txSize;
+    poll->transaction.rxData       = config->rxData;
+    poll->transaction.rxSize       = config->rxSize;
+    poll->transaction.callback     = &IfxI2c_I2c_pollDone;
+    poll->transaction.callbackData = poll;
+    poll->transaction.busy         = FALSE;
+    poll->transaction.status       = IfxI2c_I2c_Status_ok;
+    poll->period                   = config->period;
+    poll->countdown                = config->period;
+    poll->updateCount              = 0;
+    poll->overrunCount             = 0;
+    poll->callback                 = config->callback;
+    poll->callbackData             = config->callbackData;
+
+    boolean interruptState = IfxCpu_disableInterrupts();
+    async->poll[async->pollCount] = poll;
+    async->pollCount++;
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return TRUE;
+}
+
+
+
+void IfxI2c_I2c_initAsync(IfxI2c_I2c_Async *async, const IfxI2c_I2c_AsyncConfig *config)
+{
+    Ifx_I2C *i2cSFR = config->i2c->i2c;
+
+    async->i2c        = config->i2c;
+    async->queueHead  = 0;
+    async->queueCount = 0;
+    async->current    = NULL_PTR;
+    async->phase      = IfxI2c_I2c_Phase_idle;
+    async->status     = IfxI2c_I2c_Status_ok;
+    async->pollCount  = 0;
+
+    // the FIFO requests are not used, each phase fits into the FIFO
+    IfxI2c_disableBurstRequestInterruptSource(i2cSFR);
+    IfxI2c_disableLastBurstRequestInterruptSource(i2cSFR);
+    IfxI2c_disableSingleRequestInterruptSource(i2cSFR);
+    IfxI2c_disableLastSingleRequestInterruptSource(i2cSFR);
+
+    i2cSFR->PIRQSM.U = 0;
+    IfxI2c_enableProtocolInterruptSource(i2cSFR, IfxI2c_ProtocolInterruptSource_arbitrationLost);
+    IfxI2c_enableProtocolInterruptSource(i2cSFR, IfxI2c_ProtocolInterruptSource_notAcknowledgeReceived);
+    IfxI2c_enableProtocolInterruptSource(i2cSFR, IfxI2c_ProtocolInterruptSource_transmissionEnd);
+    IfxI2c_enableErrorInterruptSource(i2cSFR, IfxI2c_ErrorInterruptSource_rxFifoUnderflow);
+    IfxI2c_enableErrorInterruptSource(i2cSFR, IfxI2c_ErrorInterruptSource_rxFifoOverflow);
+    IfxI2c_enableErrorInterruptSource(i2cSFR, IfxI2c_ErrorInterruptSource_txFifoUnderflow);
+    IfxI2c_enableErrorInterruptSource(i2cSFR, IfxI2c_ErrorInterruptSource_txFifoOverflow);
+    IfxI2c_clearAllProtocolInterruptSources(i2cSFR);
+    IfxI2c_clearAllErrorInterruptSources(i2cSFR);
+    IfxI2c_enableProtocolInterruptFlag(i2cSFR);
+    IfxI2c_enableErrorInterruptFlag(i2cSFR);
+
+    IfxI2c_enableProtocolInterrupt(i2cSFR, config->typeOfService, config->protocolPriority);
+    IfxI2c_enableErrorInterrupt(i2cSFR, config->typeOfService, config->errorPriority);
+}
+
+
+void IfxI2c_I2c_initAsyncConfig(IfxI2c_I2c_AsyncConfig *config, IfxI2c_I2c *i2c)
+{
+    config->i2c              = i2c;
+    config->protocolPriority = 0;
+    config->errorPriority    = 0;
+    config->typeOfService    = IfxSrc_Tos_cpu0;
+}
+
+
 void IfxI2c_I2c_initConfig(IfxI2c_I2c_Config *config, Ifx_I2C *i2c)
 {
     config->i2c      = i2c;
@@ -54,6 +176,19 @@ void IfxI2c_I2c_initDeviceConfig(IfxI2c_I2c_deviceConfig *i2cDeviceConfig, IfxI2
 }
 
 
+void IfxI2c_I2c_initPollConfig(IfxI2c_I2c_PollConfig *config, IfxI2c_I2c_Device *device)
+{
+    config->device       = device;
+    config->txData       = NULL_PTR;
+    config->txSize       = 0;
+    config->rxData       = NULL_PTR;
+    config->rxSize       = 0;
+    config->period       = 1;
+    config->callback     = NULL_PTR;
+    config->callbackData = NULL_PTR;
+}
+
+
 void IfxI2c_I2c_initModule(IfxI2c_I2c *i2c, const IfxI2c_I2c_Config *config)
 {
     Ifx_I2C *i2cSFR = config->i2c;
@@ -71,6 +206,155 @@ void IfxI2c_I2c_initModule(IfxI2c_I2c *i2c, const IfxI2c_I2c_Config *config)
 }
 
 
+void IfxI2c_I2c_isrError(IfxI2c_I2c_Async *async)
+{
+    Ifx_I2C *i2c = async->i2c->i2c;
+
+    IfxI2c_clearAllErrorInterruptSources(i2c);
+
+    if (async->current == NULL_PTR)
+    {
+        return;
+    }
+
+    async->status = IfxI2c_I2c_Status_error;
+
+    if (async->phase != IfxI2c_I2c_Phase_stop)
+    {
+        IfxI2c_I2c_requestStop(async);
+    }
+}
+
+
+void IfxI2c_I2c_isrProtocol(IfxI2c_I2c_Async *async)
+{
+    Ifx_I2C *i2c    = async->i2c->i2c;
+    uint32   events = i2c->PIRQSS.U;
+
+    if (async->current == NULL_PTR)
+    {
+        IfxI2c_clearAllProtocolInterruptSources(i2c);
+        return;
+    }
+
+    if (events & (1 << IFX_I2C_PIRQSS_AL_OFF))
+    {
+        // the bus is owned by the other master, no stop condition
+        IfxI2c_clearAllProtocolInterruptSources(i2c);
+        async->status = IfxI2c_I2c_Status_al;
+        IfxI2c_I2c_finishTransaction(async);
+    }
+    else if ((events & (1 << IFX_I2C_PIRQSS_NACK_OFF)) && (async->phase != IfxI2c_I2c_Phase_stop))
+    {
+        IfxI2c_clearProtocolInterruptSource(i2c, IfxI2c_ProtocolInterruptSource_notAcknowledgeReceived);
+        IfxI2c_clearProtocolInterruptSource(i2c, IfxI2c_ProtocolInterruptSource_transmissionEnd);
+        async->status = IfxI2c_I2c_Status_nak;
+        IfxI2c_I2c_requestStop(async);
+    }
+    else if (events & (1 << IFX_I2C_PIRQSS_TX_END_OFF))
+    {
+        IfxI2c_clearProtocolInterruptSource(i2c, IfxI2c_ProtocolInterruptSource_transmissionEnd);
+
+        switch (async->phase)
+        {
+        case IfxI2c_I2c_Phase_write:
+
+            if (async->current->rxSize > 0)
+            {
+                IfxI2c_I2c_startRead(async);
+            }
+            else
+            {
+                IfxI2c_I2c_requestStop(async);
+            }
+
+            break;
+
+        case IfxI2c_I2c_Phase_read:
+        {
+            IfxI2c_I2c_Transaction *transaction = async->current;
+            uint32                  i;
+
+            // all received bytes are in the FIFO
+            for (i = 0; i < transaction->rxSize; i += 4)
+            {
+                uint32 rxData = i2c->RXD.U;
+                uint32 k;
+
+                for (k = 0; (k < 4) && ((i + k) < transaction->rxSize); k++)
+                {
+                    transaction->rxData[i + k] = (uint8)(rxData >> (k * 8));
+                }
+            }
+
+            IfxI2c_clearAllDtrInterruptSources(i2c);
+            IfxI2c_I2c_requestStop(async);
+            break;
+        }
+
+        case IfxI2c_I2c_Phase_stop:
+            IfxI2c_I2c_finishTransaction(async);
+            break;
+
+        default:
+            break;
+        }
+    }
+    else
+    {
+        IfxI2c_clearAllProtocolInterruptSources(i2c);
+    }
+}
+
+
+void IfxI2c_I2c_processPoll(IfxI2c_I2c_Async *async)
+{
+    uint32 i;
+
+    for (i = 0; i < async->pollCount; i++)
+    {
+        IfxI2c_I2c_Poll *poll = async->poll[i];
+
+        poll->countdown--;
+
+        if (poll->countdown == 0)
+        {
+            poll->countdown = poll->period;
+
+            if (IfxI2c_I2c_queueTransaction(async, &poll->transaction) == FALSE)
+            {
+                poll->overrunCount++;
+            }
+        }
+    }
+}
+
+
+boolean IfxI2c_I2c_queueTransaction(IfxI2c_I2c_Async *async, IfxI2c_I2c_Transaction *transaction)
+{
+    boolean result = FALSE;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, transaction->txSize < IFXI2C_FIFO_SIZE);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, transaction->rxSize <= IFXI2C_FIFO_SIZE);
+
+    boolean interruptState = IfxCpu_disableInterrupts();
+
+    if ((transaction->busy == FALSE) && (async->queueCount < IFXI2C_CFG_QUEUE_LENGTH))
+    {
+        async->queue[(async->queueHead + async->queueCount) % IFXI2C_CFG_QUEUE_LENGTH] = transaction;
+        async->queueCount++;
+        transaction->busy = TRUE;
+        result            = TRUE;
+
+        IfxI2c_I2c_startTransaction(async);
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return result;
+}
+
+
 IfxI2c_I2c_Status IfxI2c_I2c_read(IfxI2c_I2c_Device *i2cDevice, volatile uint8 *data, Ifx_SizeT size)
 {
     IfxI2c_I2c_Status status         = IfxI2c_I2c_Status_ok;
@@ -422,3 +706,137 @@ IfxI2c_I2c_Status IfxI2c_I2c_write(IfxI2c_I2c_Device *i2cDevice, volatile uint8
     i2cDevice->i2c->status    = status;
     return status;
 }
+
+
+static void IfxI2c_I2c_finishTransaction(IfxI2c_I2c_Async *async)
+{
+    IfxI2c_I2c_Transaction *transaction = async->current;
+    Ifx_I2C                *i2c         = async->i2c->i2c;
+
+    async->phase          = IfxI2c_I2c_Phase_idle;
+    async->i2c->busStatus = IfxI2c_getBusStatus(i2c);
+    async->i2c->status    = async->status;
+    transaction->status   = async->status;
+    transaction->busy     = FALSE;
+
+    // current is still set: a transaction queued by the callback is not started from the callback
+    if (transaction->callback != NULL_PTR)
+    {
+        transaction->callback(transaction->callbackData, async->status);
+    }
+
+    async->current = NULL_PTR;
+    IfxI2c_I2c_startTransaction(async);
+}
+
+
+static void IfxI2c_I2c_pollDone(void *data, IfxI2c_I2c_Status status)
+{
+    IfxI2c_I2c_Poll *poll = (IfxI2c_I2c_Poll *)data;
+
+    if (status == IfxI2c_I2c_Status_ok)
+    {
+        poll->updateCount++;
+    }
+
+    if (poll->callback != NULL_PTR)
+    {
+        poll->callback(poll->callbackData, status);
+    }
+}
+
+
+static void IfxI2c_I2c_requestStop(IfxI2c_I2c_Async *async)
+{
+    Ifx_I2C *i2c = async->i2c->i2c;
+
+    if (IfxI2c_busIsFree(i2c) == FALSE)
+    {
+        async->phase           = IfxI2c_I2c_Phase_stop;
+        i2c->ENDDCTRL.B.SETEND = 1;
+    }
+    else
+    {
+        IfxI2c_I2c_finishTransaction(async);
+    }
+}
+
+
+static void IfxI2c_I2c_startRead(IfxI2c_I2c_Async *async)
+{
+    Ifx_I2C *i2c = async->i2c->i2c;
+
+    async->phase = IfxI2c_I2c_Phase_read;
+
+    IfxI2c_setTransmitPacketSize(i2c, 1);
+    IfxI2c_setReceivePacketSize(i2c, async->current->rxSize);
+    IfxI2c_writeFifo(i2c, async->current->device->deviceAddress | 1);
+    IfxI2c_clearAllDtrInterruptSources(i2c);
+}
+
+
+static void IfxI2c_I2c_startTransaction(IfxI2c_I2c_Async *async)
+{
+    Ifx_I2C *i2c = async->i2c->i2c;
+
+    while ((async->current == NULL_PTR) && (async->queueCount > 0))
+    {
+        IfxI2c_I2c_Transaction *transaction = async->queue[async->queueHead];
+
+        async->queueHead = (uint8)((async->queueHead + 1) % IFXI2C_CFG_QUEUE_LENGTH);
+        async->queueCount--;
+        async->current   = transaction;
+        async->status    = IfxI2c_I2c_Status_ok;
+
+        if (IfxI2c_busIsFree(i2c) == FALSE)
+        {
+            // bus used by another master, reported to the application which may retry
+            async->status = IfxI2c_I2c_Status_busNotFree;
+            IfxI2c_I2c_finishTransaction(async);
+        }
+        else
+        {
+            IfxI2c_clearAllProtocolInterruptSources(i2c);
+            IfxI2c_clearAllErrorInterruptSources(i2c);
+
+            if ((transaction->txSize > 0) || (transaction->rxSize == 0))
+            {
+                IfxI2c_I2c_startWrite(async);
+            }
+            else
+            {
+                IfxI2c_I2c_startRead(async);
+            }
+        }
+    }
+}
+
+
+static void IfxI2c_I2c_startWrite(IfxI2c_I2c_Async *async)
+{
+    Ifx_I2C                *i2c         = async->i2c->i2c;
+    IfxI2c_I2c_Transaction *transaction = async->current;
+    uint32                  packet      = transaction->device->deviceAddress;
+    uint32                  shift       = 8;
+    uint32                  i;
+
+    async->phase = IfxI2c_I2c_Phase_write;
+
+    IfxI2c_setTransmitPacketSize(i2c, transaction->txSize + 1);
+
+    for (i = 0; i < transaction->txSize; i++)
+    {
+        if (shift == 32)
+        {
+            IfxI2c_writeFifo(i2c, packet);
+            packet = 0;
+            shift  = 0;
+        }
+
+        packet |= (uint32)transaction->txData[i] << shift;
+        shift  += 8;
+    }
+
+    IfxI2c_writeFifo(i2c, packet);
+    IfxI2c_clearAllDtrInterruptSources(i2c);
+}
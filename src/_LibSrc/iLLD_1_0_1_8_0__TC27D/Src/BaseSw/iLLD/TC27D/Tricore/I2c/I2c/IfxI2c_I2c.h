@@ -269,6 +269,83 @@
  *
  * some additional APIs to clear, disable interrupt flags and get flag status are also available.
  *
+ * \section IfxLld_I2c_I2c_Async Interrupt Driven Transfers
+ * The interrupt driven transfers execute a queue of transactions without polling the status flags.
+ * A transaction writes bytes to the device (e.g. the register address), then reads bytes from the device
+ * after a repeated start condition. Each phase is written to, or read from, the hardware FIFO at once, so that
+ * a transaction needs three protocol interrupts (end of the write, end of the read, stop condition) independently
+ * of its size. The size of each phase is limited to the FIFO: \ref IFXI2C_FIFO_SIZE - 1 bytes written,
+ * \ref IFXI2C_FIFO_SIZE bytes read. The completion is reported by the callback of the transaction, called from
+ * the interrupt.
+ *
+ * The blocking functions \ref IfxI2c_I2c_read and \ref IfxI2c_I2c_write shall not be used on the module while
+ * the interrupt driven transfers are initialised.
+ *
+ * \subsection IfxLld_I2c_I2c_AsyncInit Initialisation
+ * After the module initialisation \ref IfxLld_I2c_I2c_Init:
+ * \code
+ *     static IfxI2c_I2c_Async i2cAsync;
+ *
+ *     IfxI2c_I2c_AsyncConfig asyncConfig;
+ *     IfxI2c_I2c_initAsyncConfig(&asyncConfig, &i2c);
+ *     asyncConfig.protocolPriority = IFX_INTPRIO_I2C0_P;
+ *     asyncConfig.errorPriority    = IFX_INTPRIO_I2C0_ERR;
+ *     IfxI2c_I2c_initAsync(&i2cAsync, &asyncConfig);
+ *
+ *     IFX_INTERRUPT(i2c0ProtocolISR, 0, IFX_INTPRIO_I2C0_P)
+ *     {
+ *         IfxI2c_I2c_isrProtocol(&i2cAsync);
+ *     }
+ *
+ *     IFX_INTERRUPT(i2c0ErrorISR, 0, IFX_INTPRIO_I2C0_ERR)
+ *     {
+ *         IfxI2c_I2c_isrError(&i2cAsync);
+ *     }
+ * \endcode
+ *
+ * \subsection IfxLld_I2c_I2c_AsyncQueue Transaction Queue
+ * The transaction and its buffers shall stay valid until the callback is called:
+ * \code
+ *     static const uint8             regAddress = 0x3B;
+ *     static uint8                   sample[14];
+ *     static IfxI2c_I2c_Transaction  readSample;
+ *
+ *     readSample.device       = &i2cDev;
+ *     readSample.txData       = &regAddress;
+ *     readSample.txSize       = 1;
+ *     readSample.rxData       = sample;
+ *     readSample.rxSize       = sizeof(sample);
+ *     readSample.callback     = &sampleReceived;   // void sampleReceived(void *data, IfxI2c_I2c_Status status)
+ *     readSample.callbackData = NULL_PTR;
+ *
+ *     IfxI2c_I2c_queueTransaction(&i2cAsync, &readSample);
+ * \endcode
+ *
+ * \subsection IfxLld_I2c_I2c_AsyncPoll Periodic Refresh
+ * A register block of a device is read periodically into RAM. \ref IfxI2c_I2c_processPoll is called
+ * from a periodic task or timer interrupt, the period of each block is given in calls:
+ * \code
+ *     static IfxI2c_I2c_Poll imuPoll;
+ *
+ *     IfxI2c_I2c_PollConfig pollConfig;
+ *     IfxI2c_I2c_initPollConfig(&pollConfig, &i2cDev);
+ *     pollConfig.txData = &regAddress;
+ *     pollConfig.txSize = 1;
+ *     pollConfig.rxData = sample;
+ *     pollConfig.rxSize = sizeof(sample);
+ *     pollConfig.period = 1;                       // each call of IfxI2c_I2c_processPoll
+ *     IfxI2c_I2c_addPoll(&i2cAsync, &imuPoll, &pollConfig);
+ *
+ *     // 1 ms timer interrupt
+ *     IfxI2c_I2c_processPoll(&i2cAsync);
+ *
+ *     // application: the block is updated when the update count changes
+ *     if (imuPoll.updateCount != lastUpdateCount)
+ *     {
+ *         lastUpdateCount = imuPoll.updateCount;
+ *     }
+ * \endcode
+ *
  * \defgroup IfxLld_I2c_I2c I2C
  * \ingroup IfxLld_I2c
  * \defgroup IfxLld_I2c_I2c_Functions Module Functions
@@ -277,6 +354,8 @@
  * \ingroup IfxLld_I2c_I2c
  * \defgroup IfxLld_I2c_I2c_DataStructures Data Structures
  * \ingroup IfxLld_I2c_I2c
+ * \defgroup IfxLld_I2c_I2c_Async Interrupt Driven Transfers
+ * \ingroup IfxLld_I2c_I2c
  */
 
 #ifndef IFXI2C_I2C_H
@@ -304,6 +383,16 @@ typedef enum
     IfxI2c_I2c_Status_error      = 4   /**< \brief error */
 } IfxI2c_I2c_Status;
 
+/** \brief Phase of the current transaction of the interrupt driven transfers
+ */
+typedef enum
+{
+    IfxI2c_I2c_Phase_idle  = 0,  /**< \brief no transaction */
+    IfxI2c_I2c_Phase_write = 1,  /**< \brief bytes written to the device */
+    IfxI2c_I2c_Phase_read  = 2,  /**< \brief bytes read from the device after a repeated start */
+    IfxI2c_I2c_Phase_stop  = 3   /**< \brief stop condition requested */
+} IfxI2c_I2c_Phase;
+
 /** \} */
 
 /******************************************************************************/
@@ -347,6 +436,77 @@ typedef struct
     uint8       deviceAddress;       /**< \brief the slave device's address */
 } IfxI2c_I2c_deviceConfig;
 
+/** \brief Completion callback of a transaction, called from the interrupt
+ */
+typedef void (*IfxI2c_I2c_TransactionCallback)(void *data, IfxI2c_I2c_Status status);
+
+/** \brief Transaction of the interrupt driven transfers: write txSize bytes, then read rxSize bytes
+ */
+typedef struct
+{
+    IfxI2c_I2c_Device             *device;             /**< \brief slave device */
+    const uint8                   *txData;             /**< \brief bytes written to the device, e.g. register address */
+    Ifx_SizeT                      txSize;             /**< \brief number of bytes written, at most IFXI2C_FIFO_SIZE - 1 */
+    uint8                         *rxData;             /**< \brief buffer of the bytes read from the device */
+    Ifx_SizeT                      rxSize;             /**< \brief number of bytes read, at most IFXI2C_FIFO_SIZE, 0 for a write only transaction */
+    IfxI2c_I2c_TransactionCallback callback;           /**< \brief completion callback, NULL_PTR if not used */
+    void                          *callbackData;       /**< \brief parameter of the callback */
+    volatile boolean               busy;               /**< \brief TRUE from the queueing until the completion */
+    volatile IfxI2c_I2c_Status     status;             /**< \brief status of the last execution */
+} IfxI2c_I2c_Transaction;
+
+/** \brief Register block refreshed periodically
+ */
+typedef struct
+{
+    IfxI2c_I2c_Transaction         transaction;        /**< \brief transaction reading the block */
+    uint16                         period;             /**< \brief refresh period in calls of \ref IfxI2c_I2c_processPoll */
+    uint16                         countdown;          /**< \brief calls until the next refresh */
+    volatile uint32                updateCount;        /**< \brief number of successful refreshes */
+    volatile uint32                overrunCount;       /**< \brief number of refreshes skipped because the previous one was not completed */
+    IfxI2c_I2c_TransactionCallback callback;           /**< \brief called after each refresh, NULL_PTR if not used */
+    void                          *callbackData;       /**< \brief parameter of the callback */
+} IfxI2c_I2c_Poll;
+
+/** \brief Configuration of a periodically refreshed register block
+ */
+typedef struct
+{
+    IfxI2c_I2c_Device             *device;             /**< \brief slave device */
+    const uint8                   *txData;             /**< \brief bytes written before the read, e.g. register address */
+    Ifx_SizeT                      txSize;             /**< \brief number of bytes written */
+    uint8                         *rxData;             /**< \brief RAM image of the register block */
+    Ifx_SizeT                      rxSize;             /**< \brief size of the register block */
+    uint16                         period;             /**< \brief refresh period in calls of \ref IfxI2c_I2c_processPoll */
+    IfxI2c_I2c_TransactionCallback callback;           /**< \brief called after each refresh, NULL_PTR if not used */
+    void                          *callbackData;       /**< \brief parameter of the callback */
+} IfxI2c_I2c_PollConfig;
+
+/** \brief Handle of the interrupt driven transfers
+ */
+typedef struct
+{
+    IfxI2c_I2c                      *i2c;                                  /**< \brief Handler */
+    IfxI2c_I2c_Transaction          *queue[IFXI2C_CFG_QUEUE_LENGTH];      /**< \brief transactions waiting for execution */
+    uint8                            queueHead;                            /**< \brief index of the next transaction */
+    uint8                            queueCount;                           /**< \brief number of waiting transactions */
+    IfxI2c_I2c_Transaction *volatile current;                              /**< \brief transaction being executed, NULL_PTR if none */
+    IfxI2c_I2c_Phase                 phase;                                /**< \brief phase of the current transaction */
+    IfxI2c_I2c_Status                status;                               /**< \brief status of the current transaction */
+    IfxI2c_I2c_Poll                 *poll[IFXI2C_CFG_POLL_LENGTH];        /**< \brief periodically refreshed register blocks */
+    uint8                            pollCount;                            /**< \brief number of refreshed register blocks */
+} IfxI2c_I2c_Async;
+
+/** \brief Configuration of the interrupt driven transfers
+ */
+typedef struct
+{
+    IfxI2c_I2c *i2c;                  /**< \brief Handler, initialised with \ref IfxI2c_I2c_initModule */
+    uint16      protocolPriority;     /**< \brief protocol interrupt priority */
+    uint16      errorPriority;        /**< \brief error interrupt priority */
+    IfxSrc_Tos  typeOfService;        /**< \brief type of interrupt service */
+} IfxI2c_I2c_AsyncConfig;
+
 /** \} */
 
 /** \addtogroup IfxLld_I2c_I2c_Functions
@@ -406,4 +566,92 @@ IFX_EXTERN IfxI2c_I2c_Status IfxI2c_I2c_write(IfxI2c_I2c_Device *i2cDevice, vola
 
 /** \} */
 
+/** \addtogroup IfxLld_I2c_I2c_Async
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Indicates if a transaction is queued or being executed
+ * \param transaction Transaction
+ * \return TRUE until the transaction is completed
+ */
+IFX_INLINE boolean IfxI2c_I2c_isTransactionBusy(const IfxI2c_I2c_Transaction *transaction);
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Adds a register block refreshed periodically
+ * \param async Handle of the interrupt driven transfers
+ * \param poll Register block object, shall stay valid while the transfers are running
+ * \param config Configuration of the register block
+ * \return FALSE if IFXI2C_CFG_POLL_LENGTH blocks are already refreshed
+ */
+IFX_EXTERN boolean IfxI2c_I2c_addPoll(IfxI2c_I2c_Async *async, IfxI2c_I2c_Poll *poll, const IfxI2c_I2c_PollConfig *config);
+
+/** \brief Initialises the interrupt driven transfers: enables the protocol and error interrupts
+ * \param async Handle of the interrupt driven transfers
+ * \param config Configuration
+ * \return None
+ * A coding example can be found in \ref IfxLld_I2c_I2c_Async
+ */
+IFX_EXTERN void IfxI2c_I2c_initAsync(IfxI2c_I2c_Async *async, const IfxI2c_I2c_AsyncConfig *config);
+
+/** \brief Fills the configuration of the interrupt driven transfers with default values
+ * \param config Configuration
+ * \param i2c Handler
+ * \return None
+ */
+IFX_EXTERN void IfxI2c_I2c_initAsyncConfig(IfxI2c_I2c_AsyncConfig *config, IfxI2c_I2c *i2c);
+
+/** \brief Fills the configuration of a register block with default values: refreshed at each call of \ref IfxI2c_I2c_processPoll
+ * \param config Configuration of the register block
+ * \param device Slave device
+ * \return None
+ */
+IFX_EXTERN void IfxI2c_I2c_initPollConfig(IfxI2c_I2c_PollConfig *config, IfxI2c_I2c_Device *device);
+
+/** \brief Error interrupt handler of the interrupt driven transfers
+ * \param async Handle of the interrupt driven transfers
+ * \return None
+ */
+IFX_EXTERN void IfxI2c_I2c_isrError(IfxI2c_I2c_Async *async);
+
+/** \brief Protocol interrupt handler of the interrupt driven transfers: executes the next phase of the transaction
+ * \param async Handle of the interrupt driven transfers
+ * \return None
+ */
+IFX_EXTERN void IfxI2c_I2c_isrProtocol(IfxI2c_I2c_Async *async);
+
+/** \brief Queues the refresh of the register blocks whose period elapsed
+ *
+ * A refresh is skipped and counted in overrunCount if the previous one is not completed.
+ * \param async Handle of the interrupt driven transfers
+ * \return None
+ */
+IFX_EXTERN void IfxI2c_I2c_processPoll(IfxI2c_I2c_Async *async);
+
+/** \brief Queues a transaction, started immediately if no transaction is being executed
+ *
+ * Can be called from the completion callback.
+ * \param async Handle of the interrupt driven transfers
+ * \param transaction Transaction, shall stay valid until its completion
+ * \return FALSE if the queue is full or the transaction is already queued
+ */
+IFX_EXTERN boolean IfxI2c_I2c_queueTransaction(IfxI2c_I2c_Async *async, IfxI2c_I2c_Transaction *transaction);
+
+/** \} */
+
+/******************************************************************************/
+/*---------------------Inline Function Implementations------------------------*/
+/******************************************************************************/
+
+IFX_INLINE boolean IfxI2c_I2c_isTransactionBusy(const IfxI2c_I2c_Transaction *transaction)
+{
+    return transaction->busy;
+}
+
+
 #endif /* IFXI2C_I2C_H */
@@ -132,7 +132,7 @@ void IfxI2c_enableModule(Ifx_I2C *i2c)
 }
 
 
-void IfxI2c_enableProtocolInterrupt(void *i2c, IfxSrc_Tos typeOfService, uint16 priority)
+void IfxI2c_enableProtocolInterrupt(Ifx_I2C *i2c, IfxSrc_Tos typeOfService, uint16 priority)
 {
     volatile Ifx_SRC_SRCR *src;
     src = IfxI2c_getProtocolSrcPointer(i2c);
@@ -505,7 +505,7 @@ IFX_EXTERN void IfxI2c_enableModule(Ifx_I2C *i2c);
  * \param priority Priority of the interrupt
  * \return None
  */
-IFX_EXTERN void IfxI2c_enableProtocolInterrupt(void *i2c, IfxSrc_Tos typeOfService, uint16 priority);
+IFX_EXTERN void IfxI2c_enableProtocolInterrupt(Ifx_I2C *i2c, IfxSrc_Tos typeOfService, uint16 priority);
 
 /** \brief enables the single data transfer interrupt
  * \param i2c pointer to i2c registers
@@ -27,6 +27,8 @@
 /******************************************************************************/
 
 #include "IfxMsc_Msc.h"
+#include "Cpu/Std/IfxCpu.h"
+#include "_Utilities/Ifx_Assert.h"
 
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
@@ -519,6 +521,71 @@ void IfxMsc_Msc_initModuleConfig(IfxMsc_Msc_Config *config, Ifx_MSC *msc)
 }
 
 
+boolean IfxMsc_Msc_initShadow(IfxMsc_Msc_Shadow *shadow, const IfxMsc_Msc_ShadowConfig *config)
+{
+    Ifx_MSC                 *mscSfr = config->msc->msc;
+    volatile Ifx_SRC_SRCR   *src;
+    IfxDma_Dma               dmaHandle;
+    IfxDma_Dma_ChannelConfig dmaCfg;
+
+    /* the frames are repeated by the hardware, the time frame node pointer selects SR0 to SR3 only */
+    if ((mscSfr->DSC.B.TM != IfxMsc_TransmissionMode_dataRepetition) || (config->serviceRequest > IfxMsc_InterruptServiceRequest_3))
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+        return FALSE;
+    }
+
+    shadow->msc          = mscSfr;
+    shadow->image        = config->image;
+    shadow->stagedImage  = config->image;
+    shadow->commandHead  = 0;
+    shadow->commandCount = 0;
+
+    mscSfr->DD.U         = config->image;
+
+    IfxDma_Dma_createModuleHandle(&dmaHandle, &MODULE_DMA);
+    IfxDma_Dma_initChannelConfig(&dmaCfg, &dmaHandle);
+
+    dmaCfg.channelId              = config->dmaChannelId;
+    dmaCfg.hardwareRequestEnabled = FALSE;                                          // armed by IfxMsc_Msc_updateShadow() on image change
+    dmaCfg.requestMode            = IfxDma_ChannelRequestMode_oneTransferPerRequest;
+    dmaCfg.operationMode          = IfxDma_ChannelOperationMode_single;             // hw request enable is cleared after the transfer
+    dmaCfg.moveSize               = IfxDma_ChannelMoveSize_32bit;
+    dmaCfg.blockMode              = IfxDma_ChannelMove_1;
+    dmaCfg.transferCount          = 1;
+    dmaCfg.sourceAddress          = IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), &shadow->stagedImage);
+    dmaCfg.destinationAddress     = (uint32)&mscSfr->DD.U;
+    IfxDma_Dma_initChannel(&shadow->dmaChannel, &dmaCfg);
+
+    /* the time frame event triggers the DMA channel with the same number */
+    src = IfxMsc_getSrcPointer(mscSfr, config->serviceRequest);
+    IfxSrc_init(src, IfxSrc_Tos_dma, (Ifx_Priority)config->dmaChannelId);
+    IfxSrc_enable(src);
+
+    mscSfr->ICR.B.TFIP = config->serviceRequest;
+    mscSfr->ICR.B.TFIE = IfxMsc_TimeFrameInterrupt_enabled;
+
+    return TRUE;
+}
+
+
+void IfxMsc_Msc_initShadowConfig(IfxMsc_Msc_ShadowConfig *config, IfxMsc_Msc *msc)
+{
+    const IfxMsc_Msc_ShadowConfig defaultConfig = {
+        .msc            = NULL_PTR,
+        .dmaChannelId   = IfxDma_ChannelId_0,
+        .serviceRequest = IfxMsc_InterruptServiceRequest_0,
+        .image          = 0
+    };
+
+    /* Default Configuration */
+    *config = defaultConfig;
+
+    /* take over module handle */
+    config->msc = msc;
+}
+
+
 void IfxMsc_Msc_initializeAbra(IfxMsc_Msc *msc, const IfxMsc_Msc_Config *config)
 {
     Ifx_MSC *mscSfr = msc->msc;
@@ -596,6 +663,26 @@ void IfxMsc_Msc_initializeDataExtension(IfxMsc_Msc *msc, const IfxMsc_Msc_Config
 }
 
 
+boolean IfxMsc_Msc_queueShadowCommand(IfxMsc_Msc_Shadow *shadow, uint32 command)
+{
+    boolean result = FALSE;
+    boolean interruptState;
+
+    interruptState = IfxCpu_disableInterrupts();
+
+    if (shadow->commandCount < IFXMSC_CFG_SHADOW_COMMANDS)
+    {
+        shadow->command[(shadow->commandHead + shadow->commandCount) % IFXMSC_CFG_SHADOW_COMMANDS] = command;
+        shadow->commandCount++;
+        result = TRUE;
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return result;
+}
+
+
 uint32 IfxMsc_Msc_receiveData(IfxMsc_Msc *msc, uint8 upstreamIdx)
 {
     Ifx_MSC *mscSfr = msc->msc;
@@ -698,3 +785,34 @@ void IfxMsc_Msc_setDataTarget(IfxMsc_Msc *msc, IfxMsc_Target enXHigh, IfxMsc_Tar
     /* Set data high target */
     IfxMsc_setDataHighTarget(mscSfr, enXHigh);
 }
+
+
+void IfxMsc_Msc_updateShadow(IfxMsc_Msc_Shadow *shadow)
+{
+    Ifx_MSC *mscSfr = shadow->msc;
+    uint32   image  = shadow->image;
+
+    /* Downstream command, one per update while the previous one is pending */
+    if ((shadow->commandCount != 0) && (mscSfr->DSC.B.CP == 0))
+    {
+        boolean interruptState = IfxCpu_disableInterrupts();
+
+        mscSfr->DC.U         = shadow->command[shadow->commandHead];
+        shadow->commandHead  = (uint8)((shadow->commandHead + 1) % IFXMSC_CFG_SHADOW_COMMANDS);
+        shadow->commandCount--;
+
+        IfxCpu_restoreInterrupts(interruptState);
+    }
+
+    /* Downstream data, the staged image is not modified while its transfer is armed */
+    if ((image != shadow->stagedImage) && (IfxDma_isChannelTransactionEnabled(shadow->dmaChannel.dma, shadow->dmaChannel.channelId) == FALSE)
+        && (IfxDma_Dma_isChannelTransactionPending(&shadow->dmaChannel) == FALSE))
+    {
+        shadow->stagedImage = image;
+
+        IfxDma_Dma_setChannelSourceAddress(&shadow->dmaChannel, IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), &shadow->stagedImage));
+        IfxDma_Dma_setChannelDestinationAddress(&shadow->dmaChannel, (uint32)&mscSfr->DD.U);
+        IfxDma_Dma_setChannelTransferCount(&shadow->dmaChannel, 1);
+        IfxDma_enableChannelTransaction(shadow->dmaChannel.dma, shadow->dmaChannel.channelId);
+    }
+}
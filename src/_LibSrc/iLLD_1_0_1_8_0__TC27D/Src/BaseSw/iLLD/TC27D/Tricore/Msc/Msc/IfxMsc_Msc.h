@@ -142,6 +142,37 @@
  * }
  * \endcode
  *
+ * \section IfxLld_Msc_Msc_Shadow Shadow Image Mode
+ *
+ * In the shadow image mode the application only updates a RAM image of the 32 downstream data bits (DDL in
+ * the bits 0 to 15, DDH in the bits 16 to 31), no SFR is written per output update:
+ * - the module runs in data repetition mode: the data frames are repeated by the hardware, one data frame
+ * every passiveTimeFrameCount + 1 time frames (periodic refresh of the outputs).
+ * - \ref IfxMsc_Msc_updateShadow(), called from a cyclic task, compares the image with the last image given to
+ * the module. Only a changed image is copied to a staging word and the DMA channel is armed for one transfer.
+ * - the time frame service request triggers the DMA, which writes the staging word into DD at the next time
+ * frame. The new image is sent in the next data frame, all bits changed since the last update in the same frame.
+ * - commands are queued with \ref IfxMsc_Msc_queueShadowCommand() and written to DC by
+ * \ref IfxMsc_Msc_updateShadow() when no command is pending, the command frame is inserted between the
+ * data frames by the hardware.
+ *
+ * \code
+ *     // module configured with mscConfig.downstreamConfig.transmissionMode = IfxMsc_TransmissionMode_dataRepetition
+ *     static IfxMsc_Msc_Shadow mscShadow;
+ *
+ *     IfxMsc_Msc_ShadowConfig shadowConfig;
+ *     IfxMsc_Msc_initShadowConfig(&shadowConfig, &msc[0]);
+ *     shadowConfig.dmaChannelId   = IfxDma_ChannelId_5;
+ *     shadowConfig.serviceRequest = IfxMsc_InterruptServiceRequest_3;
+ *     IfxMsc_Msc_initShadow(&mscShadow, &shadowConfig);
+ *
+ *     // application, any number of output updates
+ *     IfxMsc_Msc_setShadowBits(&mscShadow, 1u << 4, value << 4);
+ *
+ *     // cyclic task
+ *     IfxMsc_Msc_updateShadow(&mscShadow);
+ * \endcode
+ *
  * \defgroup IfxLld_Msc_Msc MSC
  * \ingroup IfxLld_Msc
  * \defgroup IfxLld_Msc_Msc_Enumerations Enumerations
@@ -156,6 +187,8 @@
  * \ingroup IfxLld_Msc_Msc
  * \defgroup IfxLld_Msc_Msc_Target_Read_Write_Functions Target Read Write Functions
  * \ingroup IfxLld_Msc_Msc
+ * \defgroup IfxLld_Msc_Msc_Shadow_Functions Shadow Image Functions
+ * \ingroup IfxLld_Msc_Msc
  */
 
 #ifndef IFXMSC_MSC_H
@@ -166,6 +199,7 @@
 /******************************************************************************/
 
 #include "Msc/Std/IfxMsc.h"
+#include "Dma/Dma/IfxDma_Dma.h"
 
 /******************************************************************************/
 /*--------------------------------Enumerations--------------------------------*/
@@ -387,6 +421,29 @@ typedef struct
     IfxMsc_Msc_Io                               io;                                           /**< \brief Specifies the IO Pin configuration */
 } IfxMsc_Msc_Config;
 
+/** \brief Shadow image handle
+ */
+typedef struct
+{
+    uint32             image;                                     /**< \brief RAM image of the downstream data, DDL in the bits 0 to 15, DDH in the bits 16 to 31 */
+    uint32             stagedImage;                               /**< \brief image given to the module, source of the DMA transfer */
+    Ifx_MSC           *msc;                                       /**< \brief Specifies the pointer to the MSC registers */
+    IfxDma_Dma_Channel dmaChannel;                                /**< \brief DMA channel writing DD */
+    uint32             command[IFXMSC_CFG_SHADOW_COMMANDS];       /**< \brief queued downstream commands */
+    uint8              commandHead;                               /**< \brief index of the next command to send */
+    uint8              commandCount;                              /**< \brief number of queued commands */
+} IfxMsc_Msc_Shadow;
+
+/** \brief Shadow image configuration
+ */
+typedef struct
+{
+    IfxMsc_Msc                    *msc;                 /**< \brief MSC module handle, initialised in data repetition mode */
+    IfxDma_ChannelId               dmaChannelId;        /**< \brief DMA channel writing DD */
+    IfxMsc_InterruptServiceRequest serviceRequest;      /**< \brief service request node of the time frame event, routed to the DMA (SR0 to SR3) */
+    uint32                         image;               /**< \brief initial image, written to DD by IfxMsc_Msc_initShadow() */
+} IfxMsc_Msc_ShadowConfig;
+
 /** \} */
 
 /** \addtogroup IfxLld_Msc_Msc_Module_Initialize_Functions
@@ -539,6 +596,49 @@ IFX_EXTERN void IfxMsc_Msc_setDataTarget(IfxMsc_Msc *msc, IfxMsc_Target enXHigh,
 
 /** \} */
 
+/** \addtogroup IfxLld_Msc_Msc_Shadow_Functions
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Initialise the shadow image mode
+ *
+ * Writes the initial image to DD, initialises the DMA channel and routes the time frame event to it.
+ * \param shadow pointer to the shadow image handle
+ * \param config pointer to the shadow image configuration
+ * \return FALSE if the module is not in data repetition mode or the service request node can not signal the time frame
+ *
+ * A coding example can be found in \ref IfxLld_Msc_Msc_Shadow
+ *
+ */
+IFX_EXTERN boolean IfxMsc_Msc_initShadow(IfxMsc_Msc_Shadow *shadow, const IfxMsc_Msc_ShadowConfig *config);
+
+/** \brief Initialise the shadow image configuration: DMA channel 0, node SR0, image 0
+ * \param config pointer to the shadow image configuration
+ * \param msc pointer to the MSC module handle
+ * \return None
+ */
+IFX_EXTERN void IfxMsc_Msc_initShadowConfig(IfxMsc_Msc_ShadowConfig *config, IfxMsc_Msc *msc);
+
+/** \brief Queue a downstream command, sent by \ref IfxMsc_Msc_updateShadow()
+ * \param shadow pointer to the shadow image handle
+ * \param command command, DCL in the bits 0 to 15, DCH in the bits 16 to 31
+ * \return FALSE if the queue is full
+ */
+IFX_EXTERN boolean IfxMsc_Msc_queueShadowCommand(IfxMsc_Msc_Shadow *shadow, uint32 command);
+
+/** \brief Give the changed image and the next queued command to the module
+ *
+ * Called from a cyclic task. Nothing is written when the image did not change and no command is queued.
+ * \param shadow pointer to the shadow image handle
+ * \return None
+ */
+IFX_EXTERN void IfxMsc_Msc_updateShadow(IfxMsc_Msc_Shadow *shadow);
+
+/** \} */
+
 /******************************************************************************/
 /*-------------------------Inline Function Prototypes-------------------------*/
 /******************************************************************************/
@@ -561,6 +661,24 @@ IFX_INLINE boolean IfxMsc_Msc_getActiveDataFrameStatus(IfxMsc_Msc *msc);
  */
 IFX_INLINE boolean IfxMsc_Msc_getDataFrameInterruptStatus(IfxMsc_Msc *msc);
 
+/** \brief Update bits of the shadow image
+ *
+ * The update is not atomic, the image shall be written by one task only.
+ * \param shadow pointer to the shadow image handle
+ * \param mask bits to update
+ * \param value new value of the bits
+ * \return None
+ */
+IFX_INLINE void IfxMsc_Msc_setShadowBits(IfxMsc_Msc_Shadow *shadow, uint32 mask, uint32 value);
+
+/** \brief Set the complete shadow image
+ * \param shadow pointer to the shadow image handle
+ * \param dataLow low downstream data
+ * \param dataHigh high downstream data
+ * \return None
+ */
+IFX_INLINE void IfxMsc_Msc_setShadowImage(IfxMsc_Msc_Shadow *shadow, uint16 dataLow, uint16 dataHigh);
+
 /******************************************************************************/
 /*---------------------Inline Function Implementations------------------------*/
 /******************************************************************************/
@@ -583,4 +701,16 @@ IFX_INLINE boolean IfxMsc_Msc_getDataFrameInterruptStatus(IfxMsc_Msc *msc)
 }
 
 
+IFX_INLINE void IfxMsc_Msc_setShadowBits(IfxMsc_Msc_Shadow *shadow, uint32 mask, uint32 value)
+{
+    shadow->image = (shadow->image & ~mask) | (value & mask);
+}
+
+
+IFX_INLINE void IfxMsc_Msc_setShadowImage(IfxMsc_Msc_Shadow *shadow, uint16 dataLow, uint16 dataHigh)
+{
+    shadow->image = ((uint32)dataHigh << 16) | dataLow;
+}
+
+
 #endif /* IFXMSC_MSC_H */
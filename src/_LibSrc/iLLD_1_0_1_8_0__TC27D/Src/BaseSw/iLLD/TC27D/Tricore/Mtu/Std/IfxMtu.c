@@ -28,6 +28,7 @@
 /******************************************************************************/
 
 #include "IfxMtu.h"
+#include "Stm/Std/IfxStm.h"
 
 /** \addtogroup IfxLld_Mtu_Std_Utility
  * \{ */
@@ -46,6 +47,57 @@ IFX_STATIC void IfxMtu_waitForMbistDone(uint32 towerDepth, uint8 numInstructions
 
 /** \} */
 
+/** \addtogroup IfxLld_Mtu_Std_Schedule
+ * \{ */
+
+/******************************************************************************/
+/*-----------------------Private Function Prototypes--------------------------*/
+/******************************************************************************/
+
+/** \brief Checks the finished step of a running test and starts the next step, or terminates the test
+ * Note: the safety endinit shall be cleared.
+ * \param entry Schedule entry
+ * \return None
+ */
+IFX_STATIC void IfxMtu_continueScheduleEntry(IfxMtu_ScheduleEntry *entry);
+
+/** \brief Returns the number of MBIST steps of a test, including the final clear of the destructive tests
+ * \param test Memory test
+ * \return number of steps
+ */
+IFX_STATIC uint8 IfxMtu_getScheduleStepCount(IfxMtu_Test test);
+
+/** \brief Starts the current step of a schedule entry
+ * Note: the safety endinit shall be cleared.
+ * \param entry Schedule entry
+ * \return None
+ */
+IFX_STATIC void IfxMtu_startScheduleStep(IfxMtu_ScheduleEntry *entry);
+
+/** \} */
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+
+/** \brief MBIST CONFIG1 (upper half word) and CONFIG0 (lower half word) of the checker board test steps */
+static const uint32 IfxMtu_checkerBoardSequence[4] = {
+    0x08001000, //up /lin/w0
+    0x08001001, //up /lin/r0
+    0x00011000, //down/lin/w1
+    0x00011001  //down/lin/r1
+};
+
+/** \brief MBIST CONFIG1 (upper half word) and CONFIG0 (lower half word) of the March U test steps */
+static const uint32 IfxMtu_marchUSequence[6] = {
+    0x08001000, //up /lin/w0
+    0x08064005, //up /lin/r0->w1->r1->w0
+    0x08022001, //up /lin/r0->w1
+    0x00094005, //down/lin/r1->w0->r0->w1
+    0x00012001, //down/lin/r1->w0
+    0x00001001  //down/lin/r0
+};
+
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
@@ -181,6 +233,53 @@ void IfxMtu_clearSramStart(IfxMtu_MbistSel mbistSel)
 }
 
 
+IFX_STATIC void IfxMtu_continueScheduleEntry(IfxMtu_ScheduleEntry *entry)
+{
+    Ifx_MC *mc        = (Ifx_MC *)(IFXMTU_MC_ADDRESS_BASE + 0x100 * entry->mbistSel);
+    uint8   stepCount = IfxMtu_getScheduleStepCount(entry->test);
+    boolean clearStep = (entry->test == IfxMtu_Test_clear) || ((entry->test != IfxMtu_Test_nonDestructiveInversion) && (entry->step == (stepCount - 1)));
+
+    if (clearStep != FALSE)
+    {
+        /* the memory content is valid, the MBIST shell is disabled */
+        IfxMtu_clearSramContinue(entry->mbistSel);
+        entry->state = IfxMtu_TestState_passed;
+    }
+    else if ((mc->MSTATUS.B.FAIL != 0) && (mc->ECCD.B.UERR != 0))
+    {
+        entry->errorAddr = mc->ETRR[0].U;
+        entry->state     = IfxMtu_TestState_failed;
+    }
+    else
+    {
+        entry->step++;
+
+        if (entry->step < stepCount)
+        {
+            IfxMtu_startScheduleStep(entry);
+        }
+        else
+        {
+            entry->state = IfxMtu_TestState_passed;
+        }
+    }
+
+    if (entry->state != IfxMtu_TestState_running)
+    {
+        if (clearStep == FALSE)
+        {
+            IfxMtu_disableMbistShell(entry->mbistSel);
+
+            /* for auto-init memories: wait for the end of the clear operation */
+            while (IfxMtu_isAutoInitRunning(entry->mbistSel))
+            {}
+        }
+
+        entry->duration = IfxStm_getLower(&MODULE_STM0) - entry->start;
+    }
+}
+
+
 void IfxMtu_enableErrorTracking(IfxMtu_MbistSel mbistSel, boolean enable)
 {
     Ifx_MC *mc = (Ifx_MC *)(IFXMTU_MC_ADDRESS_BASE + 0x100 * mbistSel);
@@ -196,6 +295,29 @@ void IfxMtu_enableErrorTracking(IfxMtu_MbistSel mbistSel, boolean enable)
 }
 
 
+IFX_STATIC uint8 IfxMtu_getScheduleStepCount(IfxMtu_Test test)
+{
+    uint8 count;
+
+    switch (test)
+    {
+    case IfxMtu_Test_marchU:
+        count = (uint8)(sizeof(IfxMtu_marchUSequence) / sizeof(IfxMtu_marchUSequence[0])) + 1;
+        break;
+
+    case IfxMtu_Test_checkerBoard:
+        count = (uint8)(sizeof(IfxMtu_checkerBoardSequence) / sizeof(IfxMtu_checkerBoardSequence[0])) + 1;
+        break;
+
+    default:
+        count = 1;
+        break;
+    }
+
+    return count;
+}
+
+
 uint32 IfxMtu_getSystemAddress(IfxMtu_MbistSel mbistSel, Ifx_MC_ETRR trackedSramAddress)
 {
     uint32 sramAddress   = trackedSramAddress.B.ADDR;
@@ -268,6 +390,115 @@ uint8 IfxMtu_getTrackedSramAddresses(IfxMtu_MbistSel mbistSel, Ifx_MC_ETRR *trac
 }
 
 
+void IfxMtu_initSchedule(IfxMtu_Schedule *schedule, IfxMtu_ScheduleEntry *entries, uint8 count, uint8 maxParallel)
+{
+    uint8 i;
+
+    if (IfxMtu_isModuleEnabled() == FALSE)
+    {
+        IfxMtu_enableModule();
+    }
+
+    schedule->entries     = entries;
+    schedule->count       = count;
+    schedule->maxParallel = (maxParallel != 0) ? maxParallel : 1;
+
+    for (i = 0; i < count; ++i)
+    {
+        entries[i].state     = IfxMtu_TestState_pending;
+        entries[i].step      = 0;
+        entries[i].errorAddr = 0;
+        entries[i].start     = 0;
+        entries[i].duration  = 0;
+    }
+}
+
+
+boolean IfxMtu_isMemoryAvailable(const IfxMtu_Schedule *schedule, IfxMtu_MbistSel mbistSel)
+{
+    boolean result = TRUE;
+    uint8   i;
+
+    for (i = 0; i < schedule->count; ++i)
+    {
+        if (schedule->entries[i].mbistSel == mbistSel)
+        {
+            result = schedule->entries[i].state == IfxMtu_TestState_passed;
+            break;
+        }
+    }
+
+    return result;
+}
+
+
+boolean IfxMtu_processSchedule(IfxMtu_Schedule *schedule, boolean deferred)
+{
+    uint16  password         = IfxScuWdt_getSafetyWatchdogPassword();
+    uint8   isEndInitEnabled = 0;
+    uint8   running          = 0;
+    boolean finished         = TRUE;
+    uint8   i;
+
+    /* Check if the Endinit is cleared by application. If not, then handle it internally inside the function.*/
+    if (IfxScuWdt_getSafetyWatchdogEndInit() == 1U)
+    {
+        /* Clear EndInit */
+        IfxScuWdt_clearSafetyEndinit(password);
+        isEndInitEnabled = 1;
+    }
+
+    /* continue the running tests, the MBIST controllers work in parallel */
+    for (i = 0; i < schedule->count; ++i)
+    {
+        IfxMtu_ScheduleEntry *entry = &schedule->entries[i];
+
+        if ((entry->deferred == deferred) && (entry->state == IfxMtu_TestState_running))
+        {
+            /* DONE is cleared when the step is started, no wait time is needed before polling it */
+            if (IfxMtu_isMbistDone(entry->mbistSel))
+            {
+                IfxMtu_continueScheduleEntry(entry);
+            }
+
+            if (entry->state == IfxMtu_TestState_running)
+            {
+                ++running;
+            }
+        }
+    }
+
+    /* start the pending tests */
+    for (i = 0; i < schedule->count; ++i)
+    {
+        IfxMtu_ScheduleEntry *entry = &schedule->entries[i];
+
+        if ((entry->deferred == deferred) && (entry->state == IfxMtu_TestState_pending) && (running < schedule->maxParallel))
+        {
+            entry->state = IfxMtu_TestState_running;
+            entry->step  = 0;
+            entry->start = IfxStm_getLower(&MODULE_STM0);
+            IfxMtu_startScheduleStep(entry);
+            ++running;
+        }
+
+        if ((entry->deferred == deferred) && ((entry->state == IfxMtu_TestState_pending) || (entry->state == IfxMtu_TestState_running)))
+        {
+            finished = FALSE;
+        }
+    }
+
+    /* Restore the endinit state */
+    if (isEndInitEnabled == 1)
+    {
+        /* Set EndInit Watchdog (to prevent Watchdog TO)*/
+        IfxScuWdt_setSafetyEndinit(password);
+    }
+
+    return finished;
+}
+
+
 void IfxMtu_readSramAddress(IfxMtu_MbistSel mbistSel, uint16 sramAddress)
 {
     Ifx_MC *mc = (Ifx_MC *)(IFXMTU_MC_ADDRESS_BASE + 0x100 * mbistSel);
@@ -300,13 +531,7 @@ uint8 IfxMtu_runCheckerBoardTest(IfxMtu_MbistSel mbistSel, uint8 rangeSel, uint8
     /* Select MBIST Memory Controller:
      * Ifx_MC is a type describing structure of MBIST Memory Controller
      * registers defined in IfxMc_regdef.h file - MC object */
-    Ifx_MC *mc                            = (Ifx_MC *)(IFXMTU_MC_ADDRESS_BASE + 0x100 * mbistSel);
-    uint32  configCheckerBoardSequence[4] = {
-        0x08001000, //up /lin/w0
-        0x08001001, //up /lin/r0
-        0x00011000, //down/lin/w1
-        0x00011001
-    };              //down/lin/r1
+    Ifx_MC *mc               = (Ifx_MC *)(IFXMTU_MC_ADDRESS_BASE + 0x100 * mbistSel);
     uint16  password         = 0;
     uint8   retVal           = 0U;
     uint8   testStep;
@@ -334,8 +559,8 @@ uint8 IfxMtu_runCheckerBoardTest(IfxMtu_MbistSel mbistSel, uint8 rangeSel, uint8
     /* Run the test */
     for (testStep = 0; testStep < 4; ++testStep)
     {
-        mc->CONFIG0.U  = configCheckerBoardSequence[testStep] & 0x0000FFFF;
-        mc->CONFIG1.U  = (configCheckerBoardSequence[testStep] & 0xFFFF0000) >> 16;
+        mc->CONFIG0.U  = IfxMtu_checkerBoardSequence[testStep] & 0x0000FFFF;
+        mc->CONFIG1.U  = (IfxMtu_checkerBoardSequence[testStep] & 0xFFFF0000) >> 16;
         mc->MCONTROL.U = numberRedundancyLines ? 0x30c9 : 0x00c9; // bit and row toggle
         mc->MCONTROL.U = numberRedundancyLines ? 0x30c8 : 0x00c8; // MCONTROL.B.START will generate a RMW which is too long for small SRAMs!
 
@@ -390,15 +615,7 @@ uint8 IfxMtu_runMarchUTest(IfxMtu_MbistSel mbistSel, uint8 rangeSel, uint8 range
     /* Select MBIST Memory Controller:
      * Ifx_MC is a type describing structure of MBIST Memory Controller
      * registers defined in IfxMc_regdef.h file - MC object */
-    Ifx_MC *mc                      = (Ifx_MC *)(IFXMTU_MC_ADDRESS_BASE + 0x100 * mbistSel);
-    uint32  configMarchUSequence[6] = {
-        0x08001000, //up /lin/w0
-        0x08064005, //up /lin/r0->w1->r1->w0
-        0x08022001, //up /lin/r0->w1
-        0x00094005, //down/lin/r1->w0->r0->w1
-        0x00012001, //down/lin/r1->w0
-        0x00001001
-    };              //down/lin/r0
+    Ifx_MC *mc               = (Ifx_MC *)(IFXMTU_MC_ADDRESS_BASE + 0x100 * mbistSel);
     uint16  password         = 0;
     uint8   retVal           = 0U;
     uint8   testStep;
@@ -426,8 +643,8 @@ uint8 IfxMtu_runMarchUTest(IfxMtu_MbistSel mbistSel, uint8 rangeSel, uint8 range
     /* Run the test */
     for (testStep = 0; testStep < 6; ++testStep)
     {
-        mc->CONFIG0.U        = configMarchUSequence[testStep] & 0x0000FFFF;
-        mc->CONFIG1.U        = (configMarchUSequence[testStep] & 0xFFFF0000) >> 16;
+        mc->CONFIG0.U        = IfxMtu_marchUSequence[testStep] & 0x0000FFFF;
+        mc->CONFIG1.U        = (IfxMtu_marchUSequence[testStep] & 0xFFFF0000) >> 16;
         mc->MCONTROL.U       = 0x0209;
         mc->MCONTROL.B.START = 0;
 
@@ -557,6 +774,80 @@ uint8 IfxMtu_runNonDestructiveInversionTest(IfxMtu_MbistSel mbistSel, uint8 rang
 }
 
 
+uint8 IfxMtu_runSchedule(IfxMtu_Schedule *schedule)
+{
+    uint8 failed = 0;
+    uint8 i;
+
+    while (IfxMtu_processSchedule(schedule, FALSE) == FALSE)
+    {
+        __nop();
+    }
+
+    for (i = 0; i < schedule->count; ++i)
+    {
+        if ((schedule->entries[i].deferred == FALSE) && (schedule->entries[i].state == IfxMtu_TestState_failed))
+        {
+            ++failed;
+        }
+    }
+
+    return failed;
+}
+
+
+IFX_STATIC void IfxMtu_startScheduleStep(IfxMtu_ScheduleEntry *entry)
+{
+    Ifx_MC *mc        = (Ifx_MC *)(IFXMTU_MC_ADDRESS_BASE + 0x100 * entry->mbistSel);
+    uint8   stepCount = IfxMtu_getScheduleStepCount(entry->test);
+
+    if ((entry->test == IfxMtu_Test_clear) || ((entry->test != IfxMtu_Test_nonDestructiveInversion) && (entry->step == (stepCount - 1))))
+    {
+        /* fill with valid ECC, the MBIST shell stays enabled until IfxMtu_clearSramContinue() */
+        IfxMtu_clearSramStart(entry->mbistSel);
+    }
+    else
+    {
+        if (entry->step == 0)
+        {
+            IfxMtu_enableMbistShell(entry->mbistSel);
+
+            /* for auto-init memories: wait for the end of the clear operation */
+            while (IfxMtu_isAutoInitRunning(entry->mbistSel))
+            {}
+
+            /* whole memory (range selection disabled) */
+            mc->RANGE.U = 0;
+        }
+
+        switch (entry->test)
+        {
+        case IfxMtu_Test_marchU:
+            mc->CONFIG0.U  = IfxMtu_marchUSequence[entry->step] & 0x0000FFFF;
+            mc->CONFIG1.U  = (IfxMtu_marchUSequence[entry->step] & 0xFFFF0000) >> 16;
+            mc->MCONTROL.U = 0x0209;
+            mc->MCONTROL.U = 0x0208;
+            break;
+
+        case IfxMtu_Test_checkerBoard:
+            mc->CONFIG0.U  = IfxMtu_checkerBoardSequence[entry->step] & 0x0000FFFF;
+            mc->CONFIG1.U  = (IfxMtu_checkerBoardSequence[entry->step] & 0xFFFF0000) >> 16;
+            mc->MCONTROL.U = 0x00c9; // bit and row toggle
+            mc->MCONTROL.U = 0x00c8;
+            break;
+
+        default:
+            /* Non-destructive inversion: NUMACCS=4, ACCSTYPE=5, AG_MOD=5 */
+            mc->CONFIG0.U  = 0x4005;
+            mc->CONFIG1.U  = 0x5000;
+            mc->MCONTROL.U = 0xF201;
+            mc->MCONTROL.U = 0xF200;
+            break;
+        }
+    }
+}
+
+
 IFX_STATIC void IfxMtu_waitForMbistDone(uint32 towerDepth, uint8 numInstructions, IfxMtu_MbistSel mbistSel)
 {
     uint32          waitFact = (SCU_CCUCON0.B.SPBDIV / SCU_CCUCON0.B.SRIDIV) * numInstructions;
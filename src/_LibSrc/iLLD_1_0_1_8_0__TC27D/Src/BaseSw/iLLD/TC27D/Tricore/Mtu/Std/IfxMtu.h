@@ -195,12 +195,52 @@
  *     }
  * \endcode
  *
+ * \section IfxLld_Mtu_Schedule Memory Test Schedule
+ * The MBIST controllers of the memories are independent: a schedule starts the tests of several memories at the
+ * same time and checks their progress without waiting, so that the boot time is given by the longest test instead
+ * of the sum of the tests. Each entry of the schedule selects a memory and a test:
+ * - the destructive tests (March U, checker board) are followed by the clear of the memory, the memory is usable
+ * with valid ECC when the entry passed.
+ * - the deferred entries are not run at boot but by \ref IfxMtu_processSchedule() called from a background task
+ * after the start of the application. Their memories shall not be used until \ref IfxMtu_isMemoryAvailable()
+ * returns TRUE.
+ * - the duration of each test (STM0 ticks, from the start to the end of the last step) is stored in the entry to
+ * tune the boot budget.
+ *
+ * The memories holding the schedule, the stack and the code of the CPU running the schedule shall not be in
+ * the schedule. maxParallel limits the number of tests running at the same time (current consumption).
+ *
+ * \code
+ *     static IfxMtu_ScheduleEntry memoryTests[] = {
+ *         IFXMTU_SCHEDULE_ENTRY(IfxMtu_MbistSel_lmu,      IfxMtu_Test_marchU, FALSE),
+ *         IFXMTU_SCHEDULE_ENTRY(IfxMtu_MbistSel_mcan,     IfxMtu_Test_marchU, FALSE),
+ *         IFXMTU_SCHEDULE_ENTRY(IfxMtu_MbistSel_erayMbf,  IfxMtu_Test_marchU, FALSE),
+ *         IFXMTU_SCHEDULE_ENTRY(IfxMtu_MbistSel_emem0,    IfxMtu_Test_clear,  FALSE),
+ *         IFXMTU_SCHEDULE_ENTRY(IfxMtu_MbistSel_ethermac, IfxMtu_Test_marchU, TRUE),     // not used at start-up
+ *     };
+ *     static IfxMtu_Schedule memorySchedule;
+ *
+ *     // start-up: the non deferred tests, in parallel
+ *     IfxMtu_initSchedule(&memorySchedule, memoryTests, sizeof(memoryTests) / sizeof(memoryTests[0]), 4);
+ *     IfxMtu_runSchedule(&memorySchedule);
+ *
+ *     // background task: the deferred tests
+ *     IfxMtu_processSchedule(&memorySchedule, TRUE);
+ *
+ *     if (IfxMtu_isMemoryAvailable(&memorySchedule, IfxMtu_MbistSel_ethermac))
+ *     {
+ *         // start the ethernet
+ *     }
+ * \endcode
+ *
  * \defgroup IfxLld_Mtu_Std_Utility Utility Functions
  * \ingroup IfxLld_Mtu_Std
  * \defgroup IfxLld_Mtu_Std_Operative MBIST Operations
  * \ingroup IfxLld_Mtu_Std
  * \defgroup IfxLld_Mtu_Std_ErrorTracking MBIST Error Tracking
  * \ingroup IfxLld_Mtu_Std
+ * \defgroup IfxLld_Mtu_Std_Schedule MBIST Test Schedule
+ * \ingroup IfxLld_Mtu_Std
  */
 
 #ifndef IFXMTU_H
@@ -219,6 +259,73 @@
 #include "Scu/Std/IfxScuWdt.h"
 #include "Scu/Std/IfxScuCcu.h"
 
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Initialiser of a schedule entry
+ */
+#define IFXMTU_SCHEDULE_ENTRY(mbistSel, test, deferred) {(mbistSel), (test), (deferred), IfxMtu_TestState_pending, 0, 0, 0, 0}
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+
+/** \addtogroup IfxLld_Mtu_Std_Schedule
+ * \{ */
+/** \brief Memory test run by a schedule entry
+ */
+typedef enum
+{
+    IfxMtu_Test_clear                    = 0,  /**< \brief clear of the memory with valid ECC */
+    IfxMtu_Test_marchU                   = 1,  /**< \brief March U test, followed by the clear */
+    IfxMtu_Test_checkerBoard             = 2,  /**< \brief checker board test, followed by the clear */
+    IfxMtu_Test_nonDestructiveInversion  = 3   /**< \brief non destructive inversion test, the content is kept */
+} IfxMtu_Test;
+
+/** \brief State of a schedule entry
+ */
+typedef enum
+{
+    IfxMtu_TestState_pending = 0,  /**< \brief the test is not started */
+    IfxMtu_TestState_running = 1,  /**< \brief the test is running, the memory is not accessible */
+    IfxMtu_TestState_passed  = 2,  /**< \brief the test passed, the memory can be used */
+    IfxMtu_TestState_failed  = 3   /**< \brief the test detected an uncorrectable error */
+} IfxMtu_TestState;
+
+/** \} */
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+
+/** \addtogroup IfxLld_Mtu_Std_Schedule
+ * \{ */
+/** \brief Test of one memory in a schedule
+ */
+typedef struct
+{
+    IfxMtu_MbistSel  mbistSel;    /**< \brief memory selection */
+    IfxMtu_Test      test;        /**< \brief test of the memory */
+    boolean          deferred;    /**< \brief TRUE to run the test in the background after the start of the application */
+    IfxMtu_TestState state;       /**< \brief state of the test */
+    uint8            step;        /**< \brief step of the test sequence being executed */
+    uint16           errorAddr;   /**< \brief error tracking register content if the test failed */
+    uint32           start;       /**< \brief STM0 time of the start of the test */
+    uint32           duration;    /**< \brief duration of the test in STM0 ticks, valid when the test is finished */
+} IfxMtu_ScheduleEntry;
+
+/** \brief Memory test schedule
+ */
+typedef struct
+{
+    IfxMtu_ScheduleEntry *entries;      /**< \brief tests of the schedule */
+    uint8                 count;        /**< \brief number of tests */
+    uint8                 maxParallel;  /**< \brief maximum number of tests running at the same time */
+} IfxMtu_Schedule;
+
+/** \} */
+
 /** \addtogroup IfxLld_Mtu_Std_Utility
  * \{ */
 
@@ -511,6 +618,47 @@ IFX_EXTERN uint8 IfxMtu_getTrackedSramAddresses(IfxMtu_MbistSel mbistSel, Ifx_MC
 
 /** \} */
 
+/** \addtogroup IfxLld_Mtu_Std_Schedule
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Initialises a schedule, all tests are pending, and enables the MTU module
+ * \param schedule Memory test schedule
+ * \param entries Tests of the schedule, see \ref IFXMTU_SCHEDULE_ENTRY
+ * \param count Number of tests
+ * \param maxParallel Maximum number of tests running at the same time
+ * \return None
+ */
+IFX_EXTERN void IfxMtu_initSchedule(IfxMtu_Schedule *schedule, IfxMtu_ScheduleEntry *entries, uint8 count, uint8 maxParallel);
+
+/** \brief Returns TRUE if the memory can be used: its test passed, or it is not in the schedule
+ * \param schedule Memory test schedule
+ * \param mbistSel Memory Selection
+ * \return TRUE if the memory can be used
+ */
+IFX_EXTERN boolean IfxMtu_isMemoryAvailable(const IfxMtu_Schedule *schedule, IfxMtu_MbistSel mbistSel);
+
+/** \brief Advances the tests of a schedule without waiting
+ *
+ * The running tests whose current step is finished are checked and continued with their next step, then pending
+ * tests are started up to maxParallel running tests. The safety endinit is handled inside the function.
+ * \param schedule Memory test schedule
+ * \param deferred FALSE to run the start-up tests, TRUE to run the deferred tests
+ * \return TRUE when all the tests of the selected kind are finished
+ */
+IFX_EXTERN boolean IfxMtu_processSchedule(IfxMtu_Schedule *schedule, boolean deferred);
+
+/** \brief Runs the start-up tests of a schedule in parallel and waits for their end
+ * \param schedule Memory test schedule
+ * \return number of failed tests
+ */
+IFX_EXTERN uint8 IfxMtu_runSchedule(IfxMtu_Schedule *schedule);
+
+/** \} */
+
 /******************************************************************************/
 /*---------------------Inline Function Implementations------------------------*/
 /******************************************************************************/
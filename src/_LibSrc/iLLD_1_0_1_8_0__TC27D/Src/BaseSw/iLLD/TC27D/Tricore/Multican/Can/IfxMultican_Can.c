@@ -32,6 +32,365 @@
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
 
+uint32 IfxMultican_Can_Capture_getEntries(IfxMultican_Can_Capture *capture, IfxMultican_Can_CaptureEntry **entries)
+{
+    uint32  mask = capture->entries - 1;
+    uint32  writePosition;
+    uint32  available;
+    uint32  offset;
+    uint32  nowUs;
+    uint16  frameCounter;
+    boolean interruptState;
+
+    if (IfxDma_getChannelTransactionRequestLost(capture->dma, capture->dmaChannelId) != FALSE)
+    {
+        IfxDma_clearChannelTransactionRequestLost(capture->dma, capture->dmaChannelId);
+        capture->lostFrames++;
+    }
+
+    /* reference point of the time stamps: STM and frame counter at the same time */
+    interruptState = IfxCpu_disableInterrupts();
+    writePosition  = IfxMultican_Can_Capture_getWritePosition(capture);
+    nowUs          = (uint32)(IfxStm_get(capture->stm) / capture->stmTicksPerUs);
+    frameCounter   = (uint16)capture->node->FCR.B.CFC;
+    IfxCpu_restoreInterrupts(interruptState);
+
+    available = writePosition - capture->readPosition;
+
+    if (available > capture->entries)
+    {
+        /* the DMA has overwritten unread entries: discard them */
+        capture->overruns     += available;
+        capture->readPosition  = writePosition;
+        capture->stampPosition = writePosition;
+        available              = 0;
+    }
+
+    while (capture->stampPosition != writePosition)
+    {
+        IfxMultican_Can_CaptureEntry *entry = &capture->buffer[capture->stampPosition & mask];
+        uint32                        age   = (uint16)(frameCounter - (uint16)(entry->ipr >> 16));
+
+        entry->timestamp = nowUs - ((age * capture->bitTimeNs) / 1000);
+        capture->stampPosition++;
+    }
+
+    offset   = capture->readPosition & mask;
+    *entries = &capture->buffer[offset];
+
+    return __min(available, capture->entries - offset);
+}
+
+
+uint32 IfxMultican_Can_Capture_getWritePosition(IfxMultican_Can_Capture *capture)
+{
+    uint32 base   = capture->halfBuffers * (capture->entries / 2);
+    uint32 offset = (IfxDma_getChannelDestinationAddress(capture->dma, capture->dmaChannelId) - capture->address) / sizeof(IfxMultican_Can_CaptureEntry);
+
+    /* the DMA may have completed a half buffer whose interrupt is still pending */
+    return base + ((offset - base) & (capture->entries - 1));
+}
+
+
+IfxMultican_Status IfxMultican_Can_Capture_init(IfxMultican_Can_Capture *capture, const IfxMultican_Can_CaptureConfig *config)
+{
+    IfxMultican_Can_MsgObj *msgObj = config->msgObj;
+    uint32                  size   = config->entries * sizeof(IfxMultican_Can_CaptureEntry);
+
+    /* DMA circular buffer: power of 2 up to 32 KiB, aligned on its size, one transaction (TREL <= 0x3FFF) per half buffer */
+    if ((msgObj->msgObjCount != 1)
+        || (config->entries < 2)
+        || (size > 32768)
+        || ((config->entries & (config->entries - 1)) != 0)
+        || (((uint32)config->buffer & (size - 1)) != 0)
+        || IfxCpu_isAddressCachable(config->buffer)          /* the DMA bypasses the data cache */
+        || (config->baudrate == 0))
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+        return IfxMultican_Status_wrongParam;
+    }
+
+    Ifx_CAN_MO *hwObj = IfxMultican_MsgObj_getPointer(msgObj->node->mcan, msgObj->msgObjId);
+
+    capture->node          = msgObj->node->node;
+    capture->src           = IfxMultican_getSrcPointer(msgObj->node->mcan, config->srcId);
+    capture->dma           = config->dma;
+    capture->dmaChannelId  = config->dmaChannelId;
+    capture->stm           = config->stm;
+    capture->buffer        = config->buffer;
+    capture->address       = (uint32)IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), config->buffer);
+    capture->entries       = config->entries;
+    capture->stmTicksPerUs = (uint32)(IfxStm_getFrequency(config->stm) / 1000000.0F);
+    capture->bitTimeNs     = 1000000000UL / config->baudrate;
+    capture->readPosition  = 0;
+    capture->stampPosition = 0;
+    capture->halfBuffers   = 0;
+    capture->overruns      = 0;
+    capture->lostFrames    = 0;
+
+    /* the frame counter counts bit times and is captured into MOIPR.CFCVAL on reception */
+    IfxMultican_Node_setFrameCounterMode(capture->node, IfxMultican_FrameCounterMode_timeStampMode);
+
+    /* each reception triggers one transfer of the 8 message object registers */
+    {
+        IfxDma_Dma               dma;
+        IfxDma_Dma_Channel       channel;
+        IfxDma_Dma_ChannelConfig channelConfig;
+
+        IfxDma_Dma_createModuleHandle(&dma, config->dma);
+        IfxDma_Dma_initChannelConfig(&channelConfig, &dma);
+
+        channelConfig.channelId                        = config->dmaChannelId;
+        channelConfig.sourceAddress                    = (uint32)hwObj;
+        channelConfig.destinationAddress               = capture->address;
+        channelConfig.transferCount                    = config->entries / 2;
+        channelConfig.blockMode                        = IfxDma_ChannelMove_8;
+        channelConfig.requestMode                      = IfxDma_ChannelRequestMode_oneTransferPerRequest;
+        channelConfig.operationMode                    = IfxDma_ChannelOperationMode_continuous;
+        channelConfig.moveSize                         = IfxDma_ChannelMoveSize_32bit;
+        channelConfig.hardwareRequestEnabled           = TRUE;
+        channelConfig.sourceAddressCircularRange       = IfxDma_ChannelIncrementCircular_32;
+        channelConfig.sourceCircularBufferEnabled      = TRUE;
+        channelConfig.destinationAddressCircularRange  = IfxDma_getCircularRangeCode((uint16)size);
+        channelConfig.destinationCircularBufferEnabled = TRUE;
+        channelConfig.channelInterruptEnabled          = TRUE;
+        channelConfig.channelInterruptControl          = IfxDma_ChannelInterruptControl_thresholdLimitMatch;
+        channelConfig.interruptRaiseThreshold          = 0;
+        channelConfig.channelInterruptPriority         = config->dmaPriority;
+        channelConfig.channelInterruptTypeOfService    = config->dmaTypeOfService;
+
+        IfxDma_Dma_initChannel(&channel, &channelConfig);
+    }
+
+    /* receive interrupt routed to the DMA channel */
+    IfxSrc_init(capture->src, IfxSrc_Tos_dma, (Ifx_Priority)config->dmaChannelId);
+    IfxSrc_enable(capture->src);
+
+    return IfxMultican_Status_ok;
+}
+
+
+void IfxMultican_Can_Capture_initConfig(IfxMultican_Can_CaptureConfig *config, IfxMultican_Can_MsgObj *msgObj)
+{
+    config->msgObj           = msgObj;
+    config->srcId            = IfxMultican_SrcId_0;
+    config->dma              = &MODULE_DMA;
+    config->dmaChannelId     = IfxDma_ChannelId_0;
+    config->dmaPriority      = 0;
+    config->dmaTypeOfService = IfxSrc_Tos_cpu0;
+    config->stm              = &MODULE_STM0;
+    config->buffer           = NULL_PTR;
+    config->entries          = 0;
+    config->baudrate         = 500000;
+}
+
+
+void IfxMultican_Can_Capture_isrDma(IfxMultican_Can_Capture *capture)
+{
+    IfxDma_clearChannelInterrupt(capture->dma, capture->dmaChannelId);
+    capture->halfBuffers++;
+}
+
+
+void IfxMultican_Can_Capture_releaseEntries(IfxMultican_Can_Capture *capture, uint32 count)
+{
+    capture->readPosition += count;
+}
+
+
+void IfxMultican_Can_Capture_stop(IfxMultican_Can_Capture *capture)
+{
+    IfxSrc_disable(capture->src);
+    IfxDma_disableChannelTransaction(capture->dma, capture->dmaChannelId);
+    IfxDma_setChannelSingleMode(capture->dma, capture->dmaChannelId);
+    IfxDma_clearChannelInterrupt(capture->dma, capture->dmaChannelId);
+}
+
+
+uint32 IfxMultican_Can_Cyclic_getEntryCount(const IfxMultican_Can_CyclicConfig *config)
+{
+    uint32 count = 0;
+    uint16 slot;
+    uint16 index;
+
+    for (slot = 0; slot < config->slots; slot++)
+    {
+        uint32 due = 0;
+
+        for (index = 0; index < config->frameCount; index++)
+        {
+            const IfxMultican_Can_CyclicFrameConfig *frame = &config->frames[index];
+
+            if ((frame->period != 0) && ((slot % frame->period) == frame->offset))
+            {
+                due++;
+            }
+        }
+
+        count += __max(due, 1);
+    }
+
+    return count;
+}
+
+
+IfxMultican_Status IfxMultican_Can_Cyclic_init(IfxMultican_Can_Cyclic *cyclic, const IfxMultican_Can_CyclicConfig *config)
+{
+    IfxDma_Dma               dma;
+    IfxDma_Dma_ChannelConfig channelConfig;
+    uint32                   coreId = IfxCpu_getCoreId();
+    uint32                   entry  = 0;
+    uint16                   slot;
+    uint16                   index;
+
+    if ((config->slots == 0)
+        || (config->image == NULL_PTR)
+        || (((uint32)config->entries & 0x1FU) != 0)
+        || (config->entryCount < IfxMultican_Can_Cyclic_getEntryCount(config)))
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+        return IfxMultican_Status_wrongParam;
+    }
+
+    for (index = 0; index < config->frameCount; index++)
+    {
+        const IfxMultican_Can_CyclicFrameConfig *frame = &config->frames[index];
+
+        if ((frame->msgObj->msgObjCount != 1)
+            || (frame->period == 0)
+            || (frame->offset >= frame->period)
+            || ((config->slots % frame->period) != 0))
+        {
+            IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+            return IfxMultican_Status_wrongParam;
+        }
+    }
+
+    cyclic->image      = config->image;
+    cyclic->entries    = config->entries;
+    cyclic->frameCount = config->frameCount;
+    cyclic->dummy      = 0;
+
+    /* the image entries are copied as is into MODATAL, MODATAH, MOAR and MOCTR */
+    for (index = 0; index < config->frameCount; index++)
+    {
+        IfxMultican_Can_MsgObj *msgObj = config->frames[index].msgObj;
+        Ifx_CAN_MO             *hwObj  = IfxMultican_MsgObj_getPointer(msgObj->node->mcan, msgObj->msgObjId);
+
+        config->image[index].data[0] = 0;
+        config->image[index].data[1] = 0;
+        config->image[index].ar      = hwObj->AR.U;
+        config->image[index].ctr     = (1U << (16 + IfxMultican_MsgObjStatusFlag_newData))
+                                       | (1U << (16 + IfxMultican_MsgObjStatusFlag_messageValid))
+                                       | (1U << (16 + IfxMultican_MsgObjStatusFlag_transmitRequest));
+    }
+
+    IfxDma_Dma_createModuleHandle(&dma, config->dma);
+    IfxDma_Dma_initChannelConfig(&channelConfig, &dma);
+
+    channelConfig.channelId                        = config->dmaChannelId;
+    channelConfig.transferCount                    = 1;
+    channelConfig.requestMode                      = IfxDma_ChannelRequestMode_completeTransactionPerRequest;
+    channelConfig.operationMode                    = IfxDma_ChannelOperationMode_continuous;
+    channelConfig.moveSize                         = IfxDma_ChannelMoveSize_32bit;
+    channelConfig.shadowControl                    = IfxDma_ChannelShadow_linkedList;
+    channelConfig.hardwareRequestEnabled           = FALSE;                      // enabled by IfxMultican_Can_Cyclic_start()
+    channelConfig.sourceCircularBufferEnabled      = FALSE;
+    channelConfig.destinationCircularBufferEnabled = FALSE;
+
+    /* one linked list entry per due frame, one dummy entry per empty slot. The first entry of a slot waits for the
+     * trigger, the next ones start as soon as they are loaded (SCH) */
+    for (slot = 0; slot < config->slots; slot++)
+    {
+        uint32 first = entry;
+
+        for (index = 0; index < config->frameCount; index++)
+        {
+            const IfxMultican_Can_CyclicFrameConfig *frame = &config->frames[index];
+
+            if ((slot % frame->period) == frame->offset)
+            {
+                Ifx_CAN_MO *hwObj = IfxMultican_MsgObj_getPointer(frame->msgObj->node->mcan, frame->msgObj->msgObjId);
+
+                channelConfig.blockMode          = IfxDma_ChannelMove_4;
+                channelConfig.sourceAddress      = IFXCPU_GLB_ADDR_DSPR(coreId, &config->image[index]);
+                channelConfig.destinationAddress = (uint32)&hwObj->DATAL.U;
+                channelConfig.shadowAddress      = IFXCPU_GLB_ADDR_DSPR(coreId, &config->entries[entry + 1]);
+                IfxDma_Dma_initLinkedListEntry(&config->entries[entry], &channelConfig);
+                config->entries[entry].CHCSR.B.SCH = (entry != first) ? 1 : 0;
+                entry++;
+            }
+        }
+
+        if (entry == first)
+        {
+            channelConfig.blockMode          = IfxDma_ChannelMove_1;
+            channelConfig.sourceAddress      = IFXCPU_GLB_ADDR_DSPR(coreId, &cyclic->dummy);
+            channelConfig.destinationAddress = IFXCPU_GLB_ADDR_DSPR(coreId, &cyclic->dummy);
+            channelConfig.shadowAddress      = IFXCPU_GLB_ADDR_DSPR(coreId, &config->entries[entry + 1]);
+            IfxDma_Dma_initLinkedListEntry(&config->entries[entry], &channelConfig);
+            config->entries[entry].CHCSR.B.SCH = 0;
+            entry++;
+        }
+    }
+
+    /* the last entry loads the first slot again */
+    config->entries[entry - 1].SHADR.U = IFXCPU_GLB_ADDR_DSPR(coreId, &config->entries[0]);
+
+    cyclic->dmaChannel.dma       = config->dma;
+    cyclic->dmaChannel.channelId = config->dmaChannelId;
+    cyclic->dmaChannel.channel   = &config->dma->CH[config->dmaChannelId];
+    IfxDma_disableChannelTransaction(config->dma, config->dmaChannelId);
+
+    /* each trigger event requests the transactions of one slot */
+    IfxSrc_init(config->trigger, IfxSrc_Tos_dma, (Ifx_Priority)config->dmaChannelId);
+    IfxSrc_enable(config->trigger);
+
+    return IfxMultican_Status_ok;
+}
+
+
+void IfxMultican_Can_Cyclic_initConfig(IfxMultican_Can_CyclicConfig *config)
+{
+    config->frames       = NULL_PTR;
+    config->frameCount   = 0;
+    config->slots        = 0;
+    config->image        = NULL_PTR;
+    config->entries      = NULL_PTR;
+    config->entryCount   = 0;
+    config->dma          = &MODULE_DMA;
+    config->dmaChannelId = IfxDma_ChannelId_0;
+    config->trigger      = NULL_PTR;
+}
+
+
+void IfxMultican_Can_Cyclic_start(IfxMultican_Can_Cyclic *cyclic)
+{
+    Ifx_DMA_CH *channel = cyclic->dmaChannel.channel;
+    Ifx_DMA_CH *first   = &cyclic->entries[0];
+
+    IfxMultican_Can_Cyclic_stop(cyclic);
+
+    /* load the first entry of slot 0 */
+    channel->RDCRCR.U = first->RDCRCR.U;
+    channel->SDCRCR.U = first->SDCRCR.U;
+    channel->SADR.U   = first->SADR.U;
+    channel->DADR.U   = first->DADR.U;
+    channel->ADICR.U  = first->ADICR.U;
+    channel->CHCFGR.U = first->CHCFGR.U;
+    channel->SHADR.U  = first->SHADR.U;
+
+    IfxDma_clearChannelTransactionRequestLost(cyclic->dmaChannel.dma, cyclic->dmaChannel.channelId);
+    IfxDma_enableChannelTransaction(cyclic->dmaChannel.dma, cyclic->dmaChannel.channelId);
+}
+
+
+void IfxMultican_Can_Cyclic_stop(IfxMultican_Can_Cyclic *cyclic)
+{
+    IfxDma_disableChannelTransaction(cyclic->dmaChannel.dma, cyclic->dmaChannel.channelId);
+}
+
+
 void IfxMultican_Can_MsgObj_getConfig(IfxMultican_Can_MsgObj *msgObj, IfxMultican_Can_MsgObjConfig *config)
 {
     Ifx_CAN_MO    *hwObj = IfxMultican_MsgObj_getPointer(msgObj->node->mcan, msgObj->msgObjId);
@@ -682,6 +1041,25 @@ IfxMultican_Status IfxMultican_Can_MsgObj_readMessage(IfxMultican_Can_MsgObj *ms
 }
 
 
+uint32 IfxMultican_Can_MsgObj_readMessages(IfxMultican_Can_MsgObj *msgObj, IfxMultican_Message *msgs, uint32 count)
+{
+    uint32 received = 0;
+
+    /* drain the FIFO slots in PNEXT order, stop at the first slot without new data */
+    while (received < count)
+    {
+        if ((IfxMultican_Can_MsgObj_readMessage(msgObj, &msgs[received]) & IfxMultican_Status_newData) == 0)
+        {
+            break;
+        }
+
+        received++;
+    }
+
+    return received;
+}
+
+
 IfxMultican_Status IfxMultican_Can_MsgObj_sendMessage(IfxMultican_Can_MsgObj *msgObj, const IfxMultican_Message *msg)
 {
     IfxMultican_Status   status = IfxMultican_Status_ok;
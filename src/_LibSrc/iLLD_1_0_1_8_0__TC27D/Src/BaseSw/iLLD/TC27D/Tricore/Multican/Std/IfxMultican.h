@@ -454,6 +454,12 @@ IFX_INLINE void IfxMultican_Node_disableConfigurationChange(Ifx_CAN_N *hwNode);
  */
 IFX_INLINE void IfxMultican_Node_enableConfigurationChange(Ifx_CAN_N *hwNode);
 
+/** \brief Gets the current value of the frame counter (NFCR.CFC)
+ * \param hwNode Pointer to CAN Node registers
+ * \return Frame counter value, in bit times in time stamp mode
+ */
+IFX_INLINE uint16 IfxMultican_Node_getFrameCounter(Ifx_CAN_N *hwNode);
+
 /** \brief Returns the base address to a given CAN node number
  * \param mcan Specifies the CAN module
  * \param node Specifies the CAN node
@@ -741,6 +747,12 @@ IFX_INLINE IfxMultican_MsgObjId IfxMultican_MsgObj_getBottomObjectPointer(Ifx_CA
  */
 IFX_INLINE IfxMultican_DataLengthCode IfxMultican_MsgObj_getDataLengthCode(Ifx_CAN_MO *hwObj);
 
+/** \brief Gets the frame counter value captured with the last frame transmitted or received by the message object (MOIPR.CFCVAL)
+ * \param hwObj Pointer to CAN message object registers
+ * \return Frame counter value, in bit times in time stamp mode
+ */
+IFX_INLINE uint16 IfxMultican_MsgObj_getFrameCounterValue(Ifx_CAN_MO *hwObj);
+
 /** \brief Gets message identifier of message object
  * \param hwObj Pointer to CAN message object registers
  * \return messageId
@@ -1152,6 +1164,12 @@ IFX_INLINE IfxMultican_DataLengthCode IfxMultican_MsgObj_getDataLengthCode(Ifx_C
 }
 
 
+IFX_INLINE uint16 IfxMultican_MsgObj_getFrameCounterValue(Ifx_CAN_MO *hwObj)
+{
+    return (uint16)(hwObj->IPR.B.CFCVAL);
+}
+
+
 IFX_INLINE uint32 IfxMultican_MsgObj_getMessageId(Ifx_CAN_MO *hwObj)
 {
     Ifx_CAN_MO_AR ar;
@@ -1379,6 +1397,12 @@ IFX_INLINE void IfxMultican_Node_enableConfigurationChange(Ifx_CAN_N *hwNode)
 }
 
 
+IFX_INLINE uint16 IfxMultican_Node_getFrameCounter(Ifx_CAN_N *hwNode)
+{
+    return (uint16)(hwNode->FCR.B.CFC);
+}
+
+
 IFX_INLINE Ifx_CAN_N *IfxMultican_Node_getPointer(Ifx_CAN *mcan, IfxMultican_NodeId node)
 {
     return &(mcan->N[node]);
@@ -133,6 +133,34 @@
  *
  * The driver also provides a function to disable this feature.
  *
+ * \section IfxLld_Port_Io_Bus Digital I/O Bus
+ * Several pins, possibly on several ports, are handled as one bus: bit n of the bus image is the pin n of the
+ * pin table. The pin table is resolved once into groups of consecutive pins of one port, so that the outputs
+ * are written with one OMR write per port (set and clear masks, no read-modify-write) and the inputs are read
+ * with one IN read per port.
+ * \code
+ *     static const IfxPort_Pin dioPins[] = {
+ *         {&MODULE_P33, 0}, {&MODULE_P33, 1}, {&MODULE_P33, 2}, {&MODULE_P33, 3},   // bits 0..3
+ *         {&MODULE_P02, 0}, {&MODULE_P02, 1}, {&MODULE_P02, 2}, {&MODULE_P02, 3},   // bits 4..7
+ *     };
+ *     static IfxPort_Io_Bus dioBus;
+ *
+ *     IfxPort_Io_initBus(&dioBus, dioPins, sizeof(dioPins) / sizeof(dioPins[0]));
+ *
+ *     IfxPort_Io_writeBus(&dioBus, outputImage);
+ *     inputImage = IfxPort_Io_readBus(&dioBus);
+ * \endcode
+ * When the pins are known at compile time, the groups can be given as constant table without initialisation:
+ * \code
+ *     static const IfxPort_Io_Bus ledBus = {
+ *         {IFXPORT_IO_GROUP(&MODULE_P33, 4, 3, 0)},   // P33.4..6 on bits 0..2
+ *         1
+ *     };
+ *
+ *     IfxPort_Io_writeBus(&ledBus, leds);
+ * \endcode
+ * The pins of one port shall be consecutive in the pin table to be written and read with a single access.
+ *
  * \defgroup IfxLld_Port_Io Interface Driver
  * \ingroup IfxLld_Port
  * \defgroup IfxLld_Port_Io_DataStructures Data Structures
@@ -150,6 +178,20 @@
 
 #include "Port/Std/IfxPort.h"
 
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Maximum number of groups of consecutive pins of one port in a bus
+ */
+#ifndef IFXPORT_IO_CFG_BUS_GROUPS
+#define IFXPORT_IO_CFG_BUS_GROUPS 8
+#endif
+
+/** \brief Initialiser of a bus group: width pins of port starting at pinIndex, on the bus bits starting at bit
+ */
+#define IFXPORT_IO_GROUP(port, pinIndex, width, bit) {(port), (uint16)(((1u << (width)) - 1u) << (pinIndex)), (pinIndex), (bit)}
+
 /******************************************************************************/
 /*-----------------------------Data Structures--------------------------------*/
 /******************************************************************************/
@@ -173,6 +215,24 @@ typedef struct
     IfxPort_Io_ConfigPin *pinTable;
 } IfxPort_Io_Config;
 
+/** \brief Consecutive pins of one port mapped on consecutive bits of a bus
+ */
+typedef struct
+{
+    Ifx_P *port;          /**< \brief port of the pins */
+    uint16 mask;          /**< \brief mask of the pins in the port */
+    uint8  pinIndex;      /**< \brief first pin */
+    uint8  bit;           /**< \brief bus bit of the first pin */
+} IfxPort_Io_Group;
+
+/** \brief Bus of up to 32 pins, written and read with one access per port
+ */
+typedef struct
+{
+    IfxPort_Io_Group group[IFXPORT_IO_CFG_BUS_GROUPS];     /**< \brief groups of pins, the groups of one port are consecutive */
+    uint8            groupCount;                           /**< \brief number of groups */
+} IfxPort_Io_Bus;
+
 /** \} */
 
 /** \addtogroup IfxLld_Port_Io_ModuleFunctions
@@ -182,6 +242,14 @@ typedef struct
 /*-------------------------Global Function Prototypes-------------------------*/
 /******************************************************************************/
 
+/** \brief Resolves a pin table into the groups of a bus
+ * \param bus bus
+ * \param pins pin table, the pin n is the bus bit n
+ * \param count number of pins, at most 32
+ * \return FALSE if the pins need more than IFXPORT_IO_CFG_BUS_GROUPS groups
+ */
+IFX_EXTERN boolean IfxPort_Io_initBus(IfxPort_Io_Bus *bus, const IfxPort_Pin *pins, uint8 count);
+
 /**
  * \return None
  */
@@ -189,4 +257,73 @@ IFX_EXTERN void IfxPort_Io_initModule(const IfxPort_Io_Config *config);
 
 /** \} */
 
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Reads the input state of the bus pins, one IN read per port
+ * \param bus bus
+ * \return the bus image, bit n is the state of the pin n
+ */
+IFX_INLINE uint32 IfxPort_Io_readBus(const IfxPort_Io_Bus *bus);
+
+/** \brief Writes the output state of the bus pins, one OMR write per port
+ * \param bus bus
+ * \param image bus image, bit n is the state of the pin n
+ * \return None
+ */
+IFX_INLINE void IfxPort_Io_writeBus(const IfxPort_Io_Bus *bus, uint32 image);
+
+/** \} */
+
+/******************************************************************************/
+/*---------------------Inline Function Implementations------------------------*/
+/******************************************************************************/
+
+IFX_INLINE uint32 IfxPort_Io_readBus(const IfxPort_Io_Bus *bus)
+{
+    uint32 image = 0;
+    uint32 in    = 0;
+    Ifx_P *port  = NULL_PTR;
+    uint8  i;
+
+    for (i = 0; i < bus->groupCount; i++)
+    {
+        const IfxPort_Io_Group *group = &bus->group[i];
+
+        if (group->port != port)
+        {
+            port = group->port;
+            in   = port->IN.U;
+        }
+
+        image |= ((in & group->mask) >> group->pinIndex) << group->bit;
+    }
+
+    return image;
+}
+
+
+IFX_INLINE void IfxPort_Io_writeBus(const IfxPort_Io_Bus *bus, uint32 image)
+{
+    uint32 omr = 0;
+    uint8  i;
+
+    for (i = 0; i < bus->groupCount; i++)
+    {
+        const IfxPort_Io_Group *group = &bus->group[i];
+        uint32                  set   = ((image >> group->bit) << group->pinIndex) & group->mask;
+
+        /* PSx in the lower half word, PCLx in the upper half word */
+        omr |= set | ((group->mask & ~set) << 16);
+
+        if ((i == (bus->groupCount - 1)) || (bus->group[i + 1].port != group->port))
+        {
+            group->port->OMR.U = omr;
+            omr                = 0;
+        }
+    }
+}
+
+
 #endif /* IFXPORT_IO_H */
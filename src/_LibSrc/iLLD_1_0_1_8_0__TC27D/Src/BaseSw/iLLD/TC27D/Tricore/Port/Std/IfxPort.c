@@ -32,6 +32,107 @@
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
 
+boolean IfxPort_configureEmergencyStop(const IfxPort_EmergencyStopConfig *config, uint8 count)
+{
+    IfxScuWdt_EndinitSession session;
+    sint32                   portIndex;
+    uint8                    index;
+    boolean                  result = TRUE;
+
+    IfxScuWdt_beginEndinitSession(&session, IfxScuWdt_Endinit_cpu);
+
+    for (index = 0; index < count; index++)
+    {
+        uint32 masks = 0;
+
+        for (portIndex = 0; portIndex < IFXPORT_NUM_MODULES; portIndex++)
+        {
+            if (config[index].port == IfxPort_cfg_esrMasks[portIndex].port)
+            {
+                masks = IfxPort_cfg_esrMasks[portIndex].masks;
+                break;
+            }
+        }
+
+        if ((config[index].mask & ~masks) != 0)
+        {
+            result = FALSE;
+        }
+
+        __ldmst(&config[index].port->ESR.U, config[index].mask & masks, config[index].enable ? 0xFFFFU : 0);
+    }
+
+    IfxScuWdt_endEndinitSession(&session);
+
+    return result;
+}
+
+
+void IfxPort_configureTable(const IfxPort_TableEntry *table, uint32 count)
+{
+    IfxScuWdt_EndinitSession session;
+    uint32                   index = 0;
+
+    IfxScuWdt_beginEndinitSession(&session, IfxScuWdt_Endinit_cpu);
+
+    while (index < count)
+    {
+        Ifx_P *port         = table[index].pin.port;
+        uint32 iocrMask[4]  = {0, 0, 0, 0};
+        uint32 iocrValue[4] = {0, 0, 0, 0};
+        uint32 pdrMask[2]   = {0, 0};
+        uint32 pdrValue[2]  = {0, 0};
+        uint32 pdiscMask    = 0;
+        uint32 i;
+
+        /* Merge the consecutive entries of the port */
+        for ( ; (index < count) && (table[index].pin.port == port); index++)
+        {
+            uint8 pinIndex  = table[index].pin.pinIndex;
+            uint8 iocrShift = (pinIndex & 0x3U) * 8;
+            uint8 pdrShift  = (pinIndex & 0x7U) * 4;
+
+            iocrMask[pinIndex / 4]  |= (0xFFUL << iocrShift);
+            iocrValue[pinIndex / 4] |= ((uint32)table[index].mode << iocrShift);
+            pdrMask[pinIndex / 8]   |= (0xFUL << pdrShift);
+            pdrValue[pinIndex / 8]  |= ((uint32)table[index].padDriver << pdrShift);
+            pdiscMask               |= (1UL << pinIndex);
+        }
+
+        if (port == &MODULE_P40)
+        {
+            port->PDISC.U &= ~pdiscMask;
+        }
+
+        for (i = 0; i < 2; i++)
+        {
+            if (pdrMask[i] == 0xFFFFFFFFUL)
+            {
+                (&(port->PDR0.U))[i] = pdrValue[i];
+            }
+            else if (pdrMask[i] != 0)
+            {
+                __ldmst(&((&(port->PDR0.U))[i]), pdrMask[i], pdrValue[i]);
+            }
+        }
+
+        for (i = 0; i < 4; i++)
+        {
+            if (iocrMask[i] == 0xFFFFFFFFUL)
+            {
+                (&(port->IOCR0.U))[i] = iocrValue[i];
+            }
+            else if (iocrMask[i] != 0)
+            {
+                __ldmst(&((&(port->IOCR0.U))[i]), iocrMask[i], iocrValue[i]);
+            }
+        }
+    }
+
+    IfxScuWdt_endEndinitSession(&session);
+}
+
+
 boolean IfxPort_disableEmergencyStop(Ifx_P *port, uint8 pinIndex)
 {
     sint32  portIndex;
@@ -27,6 +27,12 @@
 /******************************************************************************/
 
 #include "IfxPsi5_Psi5.h"
+#include "Cpu/Std/IfxCpu.h"
+#include "_Utilities/Ifx_Assert.h"
+
+#if (IFXPSI5_CFG_DMA_FRAMES < 2) || ((IFXPSI5_CFG_DMA_FRAMES & (IFXPSI5_CFG_DMA_FRAMES - 1)) != 0)
+#error IFXPSI5_CFG_DMA_FRAMES shall be a power of 2
+#endif
 
 /******************************************************************************/
 /*-------------------------Function Implementations---------------------------*/
@@ -308,6 +314,92 @@ void IfxPsi5_Psi5_initChannelConfig(IfxPsi5_Psi5_ChannelConfig *config, IfxPsi5_
 }
 
 
+boolean IfxPsi5_Psi5_initDma(IfxPsi5_Psi5_Dma *dma, const IfxPsi5_Psi5_DmaConfig *config)
+{
+    uint32                          ringSize  = IFXPSI5_CFG_DMA_FRAMES * sizeof(IfxPsi5_Psi5_Rdm);
+    IfxDma_ChannelIncrementCircular ringRange = IfxDma_ChannelIncrementCircular_2;
+    uint32                          chn, slot;
+    IfxDma_Dma                      dmaHandle;
+    IfxDma_Dma_ChannelConfig        dmaCfg;
+
+    /* the DMA circular buffer wraps on the address bits below the ring size */
+    if (((uint32)&dma->ring[0][0] & (ringSize - 1)) != 0)
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+        return FALSE;
+    }
+
+    while ((1u << ringRange) < ringSize)
+    {
+        ringRange = (IfxDma_ChannelIncrementCircular)(ringRange + 1);
+    }
+
+    IfxDma_Dma_createModuleHandle(&dmaHandle, &MODULE_DMA);
+    IfxDma_Dma_initChannelConfig(&dmaCfg, &dmaHandle);
+
+    dmaCfg.hardwareRequestEnabled           = TRUE;                                         // triggered by the RDI event of the PSI5 channel
+    dmaCfg.requestMode                      = IfxDma_ChannelRequestMode_oneTransferPerRequest;
+    dmaCfg.operationMode                    = IfxDma_ChannelOperationMode_continuous;       // hw request enable remains set after transaction
+    dmaCfg.moveSize                         = IfxDma_ChannelMoveSize_32bit;
+    dmaCfg.blockMode                        = IfxDma_ChannelMove_2;                         // RDRL and RDRH
+    dmaCfg.transferCount                    = IFXPSI5_CFG_DMA_FRAMES;
+    dmaCfg.sourceCircularBufferEnabled      = TRUE;
+    dmaCfg.sourceAddressCircularRange       = IfxDma_ChannelIncrementCircular_8;            // back to RDRL after RDRH
+    dmaCfg.destinationCircularBufferEnabled = TRUE;
+    dmaCfg.destinationAddressCircularRange  = ringRange;
+
+    for (chn = 0; chn < IFXPSI5_NUM_CHANNELS; chn++)
+    {
+        const IfxPsi5_Psi5_DmaChannelConfig *chnConfig = &config->channel[chn];
+
+        dma->enabled[chn]      = (chnConfig->channel != NULL_PTR) ? TRUE : FALSE;
+        dma->readIndex[chn]    = 0;
+        dma->updatedSlots[chn] = 0;
+
+        for (slot = 0; slot < IFXPSI5_NUM_SLOTS; slot++)
+        {
+            dma->latestFrame[chn][slot].rdm.lowWord  = 0;
+            dma->latestFrame[chn][slot].rdm.highWord = 0;
+        }
+
+        if (dma->enabled[chn] != FALSE)
+        {
+            Ifx_PSI5              *psi5 = chnConfig->channel->module->psi5;
+            volatile Ifx_SRC_SRCR *src  = IfxPsi5_getSrcPointer(psi5, chnConfig->serviceRequest);
+
+            IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, chnConfig->channel->channelId == (IfxPsi5_ChannelId)chn);
+
+            dmaCfg.channelId          = chnConfig->dmaChannelId;
+            dmaCfg.sourceAddress      = (uint32)&chnConfig->channel->channel->RDRL.U;
+            dmaCfg.destinationAddress = IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), &dma->ring[chn][0]);
+            IfxDma_Dma_initChannel(&dma->dmaChannel[chn], &dmaCfg);
+
+            // the service request node triggers the DMA channel with the same number
+            IfxSrc_init(src, IfxSrc_Tos_dma, (Ifx_Priority)chnConfig->dmaChannelId);
+            IfxSrc_enable(src);
+
+            psi5->INP[chn].B.RDI    = chnConfig->serviceRequest;
+            psi5->INTENA[chn].B.RDI = 1;
+        }
+    }
+
+    return TRUE;
+}
+
+
+void IfxPsi5_Psi5_initDmaConfig(IfxPsi5_Psi5_DmaConfig *config)
+{
+    uint32 chn;
+
+    for (chn = 0; chn < IFXPSI5_NUM_CHANNELS; chn++)
+    {
+        config->channel[chn].channel        = NULL_PTR;
+        config->channel[chn].dmaChannelId   = (IfxDma_ChannelId)chn;
+        config->channel[chn].serviceRequest = (IfxPsi5_InterruptServiceRequest)chn;
+    }
+}
+
+
 boolean IfxPsi5_Psi5_initModule(IfxPsi5_Psi5 *psi5, const IfxPsi5_Psi5_Config *config)
 {
     boolean   status  = TRUE;
@@ -552,3 +644,44 @@ boolean IfxPsi5_Psi5_sendChannelData(IfxPsi5_Psi5_Channel *channel, uint64 data)
         return TRUE;
     }
 }
+
+
+void IfxPsi5_Psi5_updateDma(IfxPsi5_Psi5_Dma *dma)
+{
+    uint32 chn;
+
+    for (chn = 0; chn < IFXPSI5_NUM_CHANNELS; chn++)
+    {
+        uint8 updatedSlots = 0;
+
+        if (dma->enabled[chn] != FALSE)
+        {
+            const volatile IfxPsi5_Psi5_Rdm *ring        = dma->ring[chn];
+            uint32                           ringAddress = IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), ring);
+            uint32                           index       = dma->readIndex[chn];
+            /* only the frames completely written: a frame being written is taken with the next call */
+            uint32                           writeIndex  = (dma->dmaChannel[chn].channel->DADR.U - ringAddress) / sizeof(IfxPsi5_Psi5_Rdm);
+
+            writeIndex = writeIndex % IFXPSI5_CFG_DMA_FRAMES;
+
+            while (index != writeIndex)
+            {
+                uint32 highWord = ring[index].highWord;
+                uint32 slot     = (highWord >> IFX_PSI5_CH_RDRH_SC_OFF) & IFX_PSI5_CH_RDRH_SC_MSK;
+
+                if (slot < IFXPSI5_NUM_SLOTS)
+                {
+                    dma->latestFrame[chn][slot].rdm.lowWord  = ring[index].lowWord;
+                    dma->latestFrame[chn][slot].rdm.highWord = highWord;
+                    updatedSlots                            |= (uint8)(1u << slot);
+                }
+
+                index = (index + 1) % IFXPSI5_CFG_DMA_FRAMES;
+            }
+
+            dma->readIndex[chn] = (uint16)index;
+        }
+
+        dma->updatedSlots[chn] = updatedSlots;
+    }
+}
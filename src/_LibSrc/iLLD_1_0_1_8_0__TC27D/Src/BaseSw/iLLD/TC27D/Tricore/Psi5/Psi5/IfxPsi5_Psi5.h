@@ -110,6 +110,36 @@
  *     }
  * \endcode
  *
+ * \subsection IfxLld_Psi5_Psi5_Dma DMA receive mode
+ * Instead of reading each frame in an interrupt, the receive data interrupt (RDI) of each channel can trigger a DMA
+ * channel, which copies RDRL/RDRH into a receive ring of IFXPSI5_CFG_DMA_FRAMES frames. IfxPsi5_Psi5_updateDma()
+ * sorts the new frames by slot counter into a table holding the latest frame (data, flags and timestamp) of each
+ * channel and slot. No CPU interrupt is involved. The DMA handle shall be aligned to the ring size, and
+ * IfxPsi5_Psi5_updateDma() shall be called before a ring wraps (IFXPSI5_CFG_DMA_FRAMES frames per channel).
+ * \code
+ * IFX_ALIGN(IFXPSI5_CFG_DMA_FRAMES * 8) static IfxPsi5_Psi5_Dma psi5Dma;
+ *
+ * IfxPsi5_Psi5_DmaConfig dmaConfig;
+ * IfxPsi5_Psi5_initDmaConfig(&dmaConfig);
+ *
+ * for(int chn=0; chn<3; ++chn) {
+ *     dmaConfig.channel[chn].channel      = &psi5Channel[chn];
+ *     dmaConfig.channel[chn].dmaChannelId = (IfxDma_ChannelId)(IfxDma_ChannelId_20 + chn);
+ * }
+ *
+ * IfxPsi5_Psi5_initDma(&psi5Dma, &dmaConfig);
+ *
+ * // control period
+ * IfxPsi5_Psi5_updateDma(&psi5Dma);
+ *
+ * for(int chn=0; chn<3; ++chn) {
+ *     for(int slot=0; slot<4; ++slot) {
+ *         const IfxPsi5_Psi5_Frame *frame = &psi5Dma.latestFrame[chn][slot];
+ *         // frame->frame.readData, frame->frame.timestamp, (psi5Dma.updatedSlots[chn] >> slot) & 1
+ *     }
+ * }
+ * \endcode
+ *
  * \defgroup IfxLld_Psi5_Psi5 PSI5
  * \ingroup IfxLld_Psi5
  * \defgroup IfxLld_Psi5_Psi5_Structures Data Structures
@@ -120,6 +150,8 @@
  * \ingroup IfxLld_Psi5_Psi5
  * \defgroup IfxLld_Psi5_Psi5_Clock Clock Intialisation functions
  * \ingroup IfxLld_Psi5_Psi5
+ * \defgroup IfxLld_Psi5_Psi5_Dma DMA receive functions
+ * \ingroup IfxLld_Psi5_Psi5
  */
 
 #ifndef IFXPSI5_PSI5_H
@@ -132,6 +164,7 @@
 #include "Psi5/Std/IfxPsi5.h"
 #include "Scu/Std/IfxScuCcu.h"
 #include "IfxPsi5_bf.h"
+#include "Dma/Dma/IfxDma_Dma.h"
 
 /******************************************************************************/
 /*-----------------------------Data Structures--------------------------------*/
@@ -336,6 +369,34 @@ typedef union
     IfxPsi5_Psi5_Message message;       /**< \brief Psi5 serial message with individual members */
 } IfxPsi5_Psi5_SerialMessage;
 
+/** \brief DMA receive configuration of a channel
+ */
+typedef struct
+{
+    IfxPsi5_Psi5_Channel           *channel;             /**< \brief Specifies the initialised PSI5 channel, NULL_PTR if the channel is not received by DMA */
+    IfxDma_ChannelId                dmaChannelId;        /**< \brief Specifies the DMA channel copying the frames */
+    IfxPsi5_InterruptServiceRequest serviceRequest;      /**< \brief Specifies the service request node routing the RDI event to the DMA */
+} IfxPsi5_Psi5_DmaChannelConfig;
+
+/** \brief DMA receive configuration structure
+ */
+typedef struct
+{
+    IfxPsi5_Psi5_DmaChannelConfig channel[IFXPSI5_NUM_CHANNELS];       /**< \brief Specifies the configuration of each channel */
+} IfxPsi5_Psi5_DmaConfig;
+
+/** \brief DMA receive handle data structure
+ */
+typedef struct
+{
+    IfxPsi5_Psi5_Rdm     ring[IFXPSI5_NUM_CHANNELS][IFXPSI5_CFG_DMA_FRAMES];          /**< \brief Receive rings written by the DMA, must be the 1st member */
+    IfxPsi5_Psi5_Frame   latestFrame[IFXPSI5_NUM_CHANNELS][IFXPSI5_NUM_SLOTS];        /**< \brief Latest frame of each channel and slot */
+    uint8                updatedSlots[IFXPSI5_NUM_CHANNELS];                          /**< \brief Bit mask of the slots received by the last IfxPsi5_Psi5_updateDma() */
+    IfxDma_Dma_Channel   dmaChannel[IFXPSI5_NUM_CHANNELS];                            /**< \brief DMA channel of each PSI5 channel */
+    uint16               readIndex[IFXPSI5_NUM_CHANNELS];                             /**< \brief Next ring entry to process */
+    boolean              enabled[IFXPSI5_NUM_CHANNELS];                               /**< \brief TRUE if the channel is received by DMA */
+} IfxPsi5_Psi5_Dma;
+
 /** \brief startup related options TBD
  */
 typedef struct
@@ -486,6 +547,43 @@ IFX_EXTERN uint32 IfxPsi5_Psi5_initializeClock(Ifx_PSI5 *psi5, const IfxPsi5_Psi
 
 /** \} */
 
+/** \addtogroup IfxLld_Psi5_Psi5_Dma
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Initialize the DMA receive mode: routes the RDI event of the channels to the DMA and starts the reception
+ * \param dma pointer to the DMA receive handle, aligned to IFXPSI5_CFG_DMA_FRAMES * 8 bytes
+ * \param config pointer to the DMA receive configuration
+ * \return TRUE on success & FALSE if configuration not valid
+ *
+ * A coding example can be found in \ref IfxLld_Psi5_Psi5_Dma
+ *
+ */
+IFX_EXTERN boolean IfxPsi5_Psi5_initDma(IfxPsi5_Psi5_Dma *dma, const IfxPsi5_Psi5_DmaConfig *config);
+
+/** \brief Get the default DMA receive configuration: no channel, DMA channel and service request node equal to the channel index
+ * \param config pointer to the DMA receive configuration
+ * \return None
+ *
+ * A coding example can be found in \ref IfxLld_Psi5_Psi5_Dma
+ *
+ */
+IFX_EXTERN void IfxPsi5_Psi5_initDmaConfig(IfxPsi5_Psi5_DmaConfig *config);
+
+/** \brief Copies the frames received since the last call into the table of latest frames
+ * \param dma pointer to the DMA receive handle
+ * \return None
+ *
+ * A coding example can be found in \ref IfxLld_Psi5_Psi5_Dma
+ *
+ */
+IFX_EXTERN void IfxPsi5_Psi5_updateDma(IfxPsi5_Psi5_Dma *dma);
+
+/** \} */
+
 /******************************************************************************/
 /*---------------------Inline Function Implementations------------------------*/
 /******************************************************************************/
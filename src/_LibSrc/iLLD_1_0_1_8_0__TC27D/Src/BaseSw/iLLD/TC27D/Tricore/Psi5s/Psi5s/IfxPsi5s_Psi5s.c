@@ -27,6 +27,16 @@
 /******************************************************************************/
 
 #include "IfxPsi5s_Psi5s.h"
+#include "Cpu/Std/IfxCpu.h"
+#include "_Utilities/Ifx_Assert.h"
+
+#if (IFXPSI5S_CFG_DMA_FRAMES < 2) || ((IFXPSI5S_CFG_DMA_FRAMES & (IFXPSI5S_CFG_DMA_FRAMES - 1)) != 0)
+#error IFXPSI5S_CFG_DMA_FRAMES shall be a power of 2
+#endif
+
+#if (IFXPSI5S_CFG_DMA_HISTORY < 1) || ((IFXPSI5S_CFG_DMA_HISTORY & (IFXPSI5S_CFG_DMA_HISTORY - 1)) != 0)
+#error IFXPSI5S_CFG_DMA_HISTORY shall be a power of 2
+#endif
 
 /** \addtogroup IfxLld_Psi5s_Psi5s_Utility
  * \{ */
@@ -249,6 +259,107 @@ void IfxPsi5s_Psi5s_initChannelConfig(IfxPsi5s_Psi5s_ChannelConfig *config, IfxP
 }
 
 
+boolean IfxPsi5s_Psi5s_initDma(IfxPsi5s_Psi5s_Dma *dma, const IfxPsi5s_Psi5s_DmaConfig *config)
+{
+    Ifx_PSI5S                      *psi5s     = config->module->psi5s;
+    volatile Ifx_SRC_SRCR          *src       = IfxPsi5s_getSrcPointer(psi5s, config->serviceRequest);
+    uint32                          ringSize  = IFXPSI5S_CFG_DMA_FRAMES * sizeof(IfxPsi5s_Psi5s_DmaFrame);
+    IfxDma_ChannelIncrementCircular ringRange = IfxDma_ChannelIncrementCircular_2;
+    uint32                          chn, index;
+    IfxDma_Dma                      dmaHandle;
+    IfxDma_Dma_ChannelConfig        dmaCfg;
+
+    /* the DMA circular buffer wraps on the address bits below the ring size */
+    if (((uint32)&dma->ring[0] & (ringSize - 1)) != 0)
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+        return FALSE;
+    }
+
+    /* in ASC only mode the UART frames are not assembled into PSI5S frames */
+    if (psi5s->GCR.B.ASC != 0)
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE);
+        return FALSE;
+    }
+
+    while ((1u << ringRange) < ringSize)
+    {
+        ringRange = (IfxDma_ChannelIncrementCircular)(ringRange + 1);
+    }
+
+    dma->channelMask = config->channelMask;
+    dma->errorMask   = config->errorMask;
+    dma->readIndex   = 0;
+
+    for (chn = 0; chn < IFXPSI5S_NUM_CHANNELS; chn++)
+    {
+        dma->frameCount[chn]   = 0;
+        dma->errorCount[chn]   = 0;
+        dma->historyIndex[chn] = 0;
+        dma->updatedSlots[chn] = 0;
+
+        for (index = 0; index < IFXPSI5S_NUM_SLOTS; index++)
+        {
+            dma->latestFrame[chn][index].status.rds = 0;
+            dma->latestFrame[chn][index].data.rdr   = 0;
+        }
+
+        for (index = 0; index < IFXPSI5S_CFG_DMA_HISTORY; index++)
+        {
+            dma->history[chn][index].status.rds = 0;
+            dma->history[chn][index].data.rdr   = 0;
+        }
+    }
+
+    IfxDma_Dma_createModuleHandle(&dmaHandle, &MODULE_DMA);
+    IfxDma_Dma_initChannelConfig(&dmaCfg, &dmaHandle);
+
+    dmaCfg.channelId                        = config->dmaChannelId;
+    dmaCfg.hardwareRequestEnabled           = TRUE;                                         // triggered by the RDI events of the selected channels
+    dmaCfg.requestMode                      = IfxDma_ChannelRequestMode_oneTransferPerRequest;
+    dmaCfg.operationMode                    = IfxDma_ChannelOperationMode_continuous;       // hw request enable remains set after transaction
+    dmaCfg.moveSize                         = IfxDma_ChannelMoveSize_32bit;
+    dmaCfg.blockMode                        = IfxDma_ChannelMove_2;                         // RDS and RDR
+    dmaCfg.transferCount                    = IFXPSI5S_CFG_DMA_FRAMES;
+    dmaCfg.sourceAddress                    = (uint32)&psi5s->RDS.U;
+    dmaCfg.sourceCircularBufferEnabled      = TRUE;
+    dmaCfg.sourceAddressCircularRange       = IfxDma_ChannelIncrementCircular_8;            // back to RDS after RDR
+    dmaCfg.destinationAddress               = IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), &dma->ring[0]);
+    dmaCfg.destinationCircularBufferEnabled = TRUE;
+    dmaCfg.destinationAddressCircularRange  = ringRange;
+    IfxDma_Dma_initChannel(&dma->dmaChannel, &dmaCfg);
+
+    // the service request node triggers the DMA channel with the same number
+    IfxSrc_init(src, IfxSrc_Tos_dma, (Ifx_Priority)config->dmaChannelId);
+    IfxSrc_enable(src);
+
+    for (chn = 0; chn < IFXPSI5S_NUM_CHANNELS; chn++)
+    {
+        if (((config->channelMask >> chn) & 1u) != 0)
+        {
+            psi5s->INP[chn].B.RDI   = config->serviceRequest;
+            psi5s->INTEN[chn].B.RDI = 1;
+        }
+    }
+
+    return TRUE;
+}
+
+
+void IfxPsi5s_Psi5s_initDmaConfig(IfxPsi5s_Psi5s_DmaConfig *config, IfxPsi5s_Psi5s *psi5s)
+{
+    config->module         = psi5s;
+    config->channelMask    = 0;
+    config->dmaChannelId   = IfxDma_ChannelId_0;
+    config->serviceRequest = IfxPsi5s_InterruptServiceRequest_0;
+    config->errorMask      = (IFX_PSI5S_RDS_XCRCI_MSK << IFX_PSI5S_RDS_XCRCI_OFF) | (IFX_PSI5S_RDS_CRCI_MSK << IFX_PSI5S_RDS_CRCI_OFF) |
+                             (IFX_PSI5S_RDS_HDI_MSK << IFX_PSI5S_RDS_HDI_OFF) | (IFX_PSI5S_RDS_PE_MSK << IFX_PSI5S_RDS_PE_OFF) |
+                             (IFX_PSI5S_RDS_FE_MSK << IFX_PSI5S_RDS_FE_OFF) | (IFX_PSI5S_RDS_OE_MSK << IFX_PSI5S_RDS_OE_OFF) |
+                             (IFX_PSI5S_RDS_TEI_MSK << IFX_PSI5S_RDS_TEI_OFF) | (IFX_PSI5S_RDS_RBI_MSK << IFX_PSI5S_RDS_RBI_OFF);
+}
+
+
 boolean IfxPsi5s_Psi5s_initModule(IfxPsi5s_Psi5s *psi5s, const IfxPsi5s_Psi5s_Config *config)
 {
     boolean    status   = TRUE;
@@ -635,3 +746,58 @@ IFX_STATIC uint32 IfxPsi5s_Psi5s_setBaudrate(Ifx_PSI5S *psi5s, uint32 baudrate,
 
     return result;
 }
+
+
+void IfxPsi5s_Psi5s_updateDma(IfxPsi5s_Psi5s_Dma *dma)
+{
+    const volatile IfxPsi5s_Psi5s_DmaFrame *ring        = dma->ring;
+    uint32                                  ringAddress = IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), ring);
+    uint32                                  index       = dma->readIndex;
+    /* only the frames completely written: a frame being written is taken with the next call */
+    uint32                                  writeIndex  = (dma->dmaChannel.channel->DADR.U - ringAddress) / sizeof(IfxPsi5s_Psi5s_DmaFrame);
+    uint32                                  chn;
+
+    writeIndex = writeIndex % IFXPSI5S_CFG_DMA_FRAMES;
+
+    for (chn = 0; chn < IFXPSI5S_NUM_CHANNELS; chn++)
+    {
+        dma->updatedSlots[chn] = 0;
+    }
+
+    while (index != writeIndex)
+    {
+        uint32 rds  = ring[index].status.rds;
+        uint32 rdr  = ring[index].data.rdr;
+        uint32 slot = (rds >> IFX_PSI5S_RDS_FID_OFF) & IFX_PSI5S_RDS_FID_MSK;
+
+        chn = (rds >> IFX_PSI5S_RDS_CID_OFF) & IFX_PSI5S_RDS_CID_MSK;
+
+        /* frames of the other channels are only copied if they overwrite RDS/RDR before the DMA transfer */
+        if (((dma->channelMask >> chn) & 1u) != 0)
+        {
+            /* RDS and RDR of the same frame have the same packet frame count */
+            if (((rds & dma->errorMask) == 0)
+                && ((rds >> IFX_PSI5S_RDS_PFC_OFF) == (rdr >> IFX_PSI5S_RDR_PFC_OFF))
+                && (slot < IFXPSI5S_NUM_SLOTS))
+            {
+                IfxPsi5s_Psi5s_DmaFrame *history = &dma->history[chn][dma->historyIndex[chn]];
+
+                dma->latestFrame[chn][slot].status.rds = rds;
+                dma->latestFrame[chn][slot].data.rdr   = rdr;
+                history->status.rds                    = rds;
+                history->data.rdr                      = rdr;
+                dma->historyIndex[chn]                 = (uint16)((dma->historyIndex[chn] + 1) % IFXPSI5S_CFG_DMA_HISTORY);
+                dma->updatedSlots[chn]                |= (uint8)(1u << slot);
+                dma->frameCount[chn]++;
+            }
+            else
+            {
+                dma->errorCount[chn]++;
+            }
+        }
+
+        index = (index + 1) % IFXPSI5S_CFG_DMA_FRAMES;
+    }
+
+    dma->readIndex = (uint16)index;
+}
@@ -125,6 +125,45 @@
  *
  * \endcode
  *
+ * \subsection IfxLld_Psi5s_Psi5s_Dma DMA receive mode
+ * The sensor frames come from the external transceiver over the ASC interface, the module assembles the UART frames
+ * of a packet and provides it in the receive registers RDS/RDR, shared by all channels. Instead of reading each frame
+ * in an interrupt, the receive data interrupt (RDI) of the selected channels is routed to one service request node,
+ * which triggers a DMA channel copying RDS and RDR into a receive ring of IFXPSI5S_CFG_DMA_FRAMES frames. No CPU
+ * interrupt is involved.
+ *
+ * IfxPsi5s_Psi5s_updateDma() processes the new frames in one pass: the frames with an error flag of
+ * IfxPsi5s_Psi5s_DmaConfig::errorMask or with different packet frame counts in RDS and RDR are counted and dropped,
+ * the valid frames are sorted by channel and frame ID into a table of latest frames and appended to a history ring of
+ * IFXPSI5S_CFG_DMA_HISTORY frames per channel.
+ *
+ * The DMA handle shall be aligned to the ring size, and IfxPsi5s_Psi5s_updateDma() shall be called before the ring
+ * wraps (IFXPSI5S_CFG_DMA_FRAMES frames of all channels together). The timestamp register TSM is not copied: RDS, RDR
+ * and TSM cannot be read as one circular source range of the DMA. The DMA mode is not available in ASC only mode.
+ * \code
+ * IFX_ALIGN(IFXPSI5S_CFG_DMA_FRAMES * 8) static IfxPsi5s_Psi5s_Dma psi5sDma;
+ *
+ * IfxPsi5s_Psi5s_DmaConfig dmaConfig;
+ * IfxPsi5s_Psi5s_initDmaConfig(&dmaConfig, &psi5s);
+ * dmaConfig.channelMask  = (1 << IfxPsi5s_ChannelId_4) | (1 << IfxPsi5s_ChannelId_5);
+ * dmaConfig.dmaChannelId = IfxDma_ChannelId_20;
+ *
+ * IfxPsi5s_Psi5s_initDma(&psi5sDma, &dmaConfig);
+ *
+ * // control period
+ * IfxPsi5s_Psi5s_updateDma(&psi5sDma);
+ *
+ * for(int slot=0; slot<6; ++slot) {
+ *     const IfxPsi5s_Psi5s_DmaFrame *frame = &psi5sDma.latestFrame[IfxPsi5s_ChannelId_4][slot];
+ *     // frame->data.receivedData.readData, (psi5sDma.updatedSlots[IfxPsi5s_ChannelId_4] >> slot) & 1
+ * }
+ *
+ * // last 4 valid frames of channel 5, newest first
+ * for(int age=0; age<4; ++age) {
+ *     const IfxPsi5s_Psi5s_DmaFrame *frame = IfxPsi5s_Psi5s_getDmaHistory(&psi5sDma, IfxPsi5s_ChannelId_5, age);
+ * }
+ * \endcode
+ *
  * \defgroup IfxLld_Psi5s_Psi5s PSI5S
  * \ingroup IfxLld_Psi5s
  * \defgroup IfxLld_Psi5s_Psi5s_Structures Data Structures
@@ -137,6 +176,8 @@
  * \ingroup IfxLld_Psi5s_Psi5s
  * \defgroup IfxLld_Psi5s_Psi5s_Interrupt Interrupt configuration Function
  * \ingroup IfxLld_Psi5s_Psi5s
+ * \defgroup IfxLld_Psi5s_Psi5s_Dma DMA receive functions
+ * \ingroup IfxLld_Psi5s_Psi5s
  */
 
 #ifndef IFXPSI5S_PSI5S_H
@@ -148,6 +189,7 @@
 
 #include "Psi5s/Std/IfxPsi5s.h"
 #include "Scu/Std/IfxScuWdt.h"
+#include "Dma/Dma/IfxDma_Dma.h"
 
 /******************************************************************************/
 /*-----------------------------Data Structures--------------------------------*/
@@ -387,6 +429,42 @@ typedef struct
     IfxPsi5s_Psi5s_ReceiveTimestamp timestamp;       /**< \brief Receiver timestamp */
 } IfxPsi5s_Psi5s_Frame;
 
+/** \brief Psi5s frame as copied by the DMA, in the order of the receive registers
+ */
+typedef struct
+{
+    IfxPsi5s_Psi5s_ReceiveStatus status;       /**< \brief Receiver status */
+    IfxPsi5s_Psi5s_ReceiveData   data;         /**< \brief Received data */
+} IfxPsi5s_Psi5s_DmaFrame;
+
+/** \brief DMA receive configuration structure
+ */
+typedef struct
+{
+    IfxPsi5s_Psi5s                  *module;              /**< \brief Specifies the initialised PSI5S module */
+    uint8                            channelMask;         /**< \brief Specifies the channels received by DMA, bit n for channel n */
+    IfxDma_ChannelId                 dmaChannelId;        /**< \brief Specifies the DMA channel copying the frames */
+    IfxPsi5s_InterruptServiceRequest serviceRequest;      /**< \brief Specifies the service request node routing the RDI events to the DMA */
+    uint32                           errorMask;           /**< \brief Specifies the RDS flags rejecting a frame */
+} IfxPsi5s_Psi5s_DmaConfig;
+
+/** \brief DMA receive handle data structure
+ */
+typedef struct
+{
+    IfxPsi5s_Psi5s_DmaFrame ring[IFXPSI5S_CFG_DMA_FRAMES];                                   /**< \brief Receive ring written by the DMA, must be the 1st member */
+    IfxPsi5s_Psi5s_DmaFrame latestFrame[IFXPSI5S_NUM_CHANNELS][IFXPSI5S_NUM_SLOTS];          /**< \brief Latest valid frame of each channel and frame ID */
+    IfxPsi5s_Psi5s_DmaFrame history[IFXPSI5S_NUM_CHANNELS][IFXPSI5S_CFG_DMA_HISTORY];        /**< \brief Last valid frames of each channel */
+    uint32                  frameCount[IFXPSI5S_NUM_CHANNELS];                               /**< \brief Number of valid frames of each channel */
+    uint32                  errorCount[IFXPSI5S_NUM_CHANNELS];                               /**< \brief Number of frames of each channel dropped by the validation */
+    uint32                  errorMask;                                                       /**< \brief RDS flags rejecting a frame */
+    IfxDma_Dma_Channel      dmaChannel;                                                      /**< \brief DMA channel copying the frames */
+    uint16                  readIndex;                                                       /**< \brief Next ring entry to process */
+    uint16                  historyIndex[IFXPSI5S_NUM_CHANNELS];                             /**< \brief Next history entry to write */
+    uint8                   updatedSlots[IFXPSI5S_NUM_CHANNELS];                             /**< \brief Bit mask of the frame IDs received by the last IfxPsi5s_Psi5s_updateDma() */
+    uint8                   channelMask;                                                     /**< \brief Channels received by DMA */
+} IfxPsi5s_Psi5s_Dma;
+
 /** \} */
 
 /** \addtogroup IfxLld_Psi5s_Psi5s_Module
@@ -538,6 +616,59 @@ IFX_EXTERN void IfxPsi5s_Psi5s_resetModule(Ifx_PSI5S *psi5s);
 
 /** \} */
 
+/** \addtogroup IfxLld_Psi5s_Psi5s_Dma
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Get a frame of the DMA history of a channel
+ * \param dma pointer to the DMA receive handle
+ * \param channelId specifies channelID
+ * \param age 0 for the newest frame, up to IFXPSI5S_CFG_DMA_HISTORY - 1
+ * \return Returns the frame, all zero if fewer frames were received
+ *
+ * A coding example can be found in \ref IfxLld_Psi5s_Psi5s_Dma
+ *
+ */
+IFX_INLINE const IfxPsi5s_Psi5s_DmaFrame *IfxPsi5s_Psi5s_getDmaHistory(const IfxPsi5s_Psi5s_Dma *dma, IfxPsi5s_ChannelId channelId, uint32 age);
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Initialize the DMA receive mode: routes the RDI event of the channels to the DMA and starts the reception
+ * \param dma pointer to the DMA receive handle, aligned to IFXPSI5S_CFG_DMA_FRAMES * 8 bytes
+ * \param config pointer to the DMA receive configuration
+ * \return TRUE on success & FALSE if configuration not valid
+ *
+ * A coding example can be found in \ref IfxLld_Psi5s_Psi5s_Dma
+ *
+ */
+IFX_EXTERN boolean IfxPsi5s_Psi5s_initDma(IfxPsi5s_Psi5s_Dma *dma, const IfxPsi5s_Psi5s_DmaConfig *config);
+
+/** \brief Get the default DMA receive configuration: no channel, DMA channel 0, service request node 0, all transmission errors rejected
+ * \param config pointer to the DMA receive configuration
+ * \param psi5s pointer to the PSI5S module
+ * \return None
+ *
+ * A coding example can be found in \ref IfxLld_Psi5s_Psi5s_Dma
+ *
+ */
+IFX_EXTERN void IfxPsi5s_Psi5s_initDmaConfig(IfxPsi5s_Psi5s_DmaConfig *config, IfxPsi5s_Psi5s *psi5s);
+
+/** \brief Validates the frames received since the last call, updates the table of latest frames and the histories
+ * \param dma pointer to the DMA receive handle
+ * \return None
+ *
+ * A coding example can be found in \ref IfxLld_Psi5s_Psi5s_Dma
+ *
+ */
+IFX_EXTERN void IfxPsi5s_Psi5s_updateDma(IfxPsi5s_Psi5s_Dma *dma);
+
+/** \} */
+
 /******************************************************************************/
 /*-------------------------Inline Function Prototypes-------------------------*/
 /******************************************************************************/
@@ -585,4 +716,11 @@ IFX_INLINE boolean IfxPsi5s_Psi5s_getReadFrameStatus(IfxPsi5s_Psi5s *psi5s, IfxP
 }
 
 
+IFX_INLINE const IfxPsi5s_Psi5s_DmaFrame *IfxPsi5s_Psi5s_getDmaHistory(const IfxPsi5s_Psi5s_Dma *dma, IfxPsi5s_ChannelId channelId, uint32 age)
+{
+    uint32 index = (dma->historyIndex[channelId] - 1u - age) % IFXPSI5S_CFG_DMA_HISTORY;
+    return &dma->history[channelId][index];
+}
+
+
 #endif /* IFXPSI5S_PSI5S_H */
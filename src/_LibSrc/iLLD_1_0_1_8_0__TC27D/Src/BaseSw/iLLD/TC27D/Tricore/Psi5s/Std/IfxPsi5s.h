@@ -174,6 +174,20 @@ typedef enum
     IfxPsi5s_IdleTime_16          /**< \brief 16 bit Idle time  */
 } IfxPsi5s_IdleTime;
 
+/** \brief MODULE_PSI5S.INPx:Service request node selected by the interrupt node pointers
+ */
+typedef enum
+{
+    IfxPsi5s_InterruptServiceRequest_0 = 0,  /**< \brief Service request node SR0  */
+    IfxPsi5s_InterruptServiceRequest_1,      /**< \brief Service request node SR1  */
+    IfxPsi5s_InterruptServiceRequest_2,      /**< \brief Service request node SR2  */
+    IfxPsi5s_InterruptServiceRequest_3,      /**< \brief Service request node SR3  */
+    IfxPsi5s_InterruptServiceRequest_4,      /**< \brief Service request node SR4  */
+    IfxPsi5s_InterruptServiceRequest_5,      /**< \brief Service request node SR5  */
+    IfxPsi5s_InterruptServiceRequest_6,      /**< \brief Service request node SR6  */
+    IfxPsi5s_InterruptServiceRequest_7       /**< \brief Service request node SR7  */
+} IfxPsi5s_InterruptServiceRequest;
+
 /** \brief Enable/Disable Loop back Mode
  */
 typedef enum
@@ -436,6 +450,22 @@ IFX_EXTERN void IfxPsi5s_resetModule(Ifx_PSI5S *psi5s);
 
 /** \} */
 
+/** \addtogroup IfxLld_Psi5s_Std_Interrupt
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Gives the pointer to the SRC register for respective PSI5S interrupt source
+ * \param psi5s Pointer to PSI5S module registers
+ * \param intRequest Interrupt Source
+ * \return Address of the required SRC register
+ */
+IFX_INLINE volatile Ifx_SRC_SRCR *IfxPsi5s_getSrcPointer(Ifx_PSI5S *psi5s, IfxPsi5s_InterruptServiceRequest intRequest);
+
+/** \} */
+
 /******************************************************************************/
 /*---------------------Inline Function Implementations------------------------*/
 /******************************************************************************/
@@ -471,6 +501,12 @@ IFX_INLINE void IfxPsi5s_initTxPin(const IfxPsi5s_Tx_Out *tx, IfxPort_OutputMode
 }
 
 
+IFX_INLINE volatile Ifx_SRC_SRCR *IfxPsi5s_getSrcPointer(Ifx_PSI5S *psi5s, IfxPsi5s_InterruptServiceRequest intRequest)
+{
+    return &MODULE_SRC.PSI5S.PSI5S[0].SR[intRequest];
+}
+
+
 IFX_INLINE boolean IfxPsi5s_isModuleSuspended(Ifx_PSI5S *psi5s)
 {
     Ifx_PSI5S_OCS ocs;
@@ -68,13 +68,25 @@ IFX_STATIC void IfxQspi_SpiMaster_deactivateSlso(IfxQspi_SpiMaster_Channel *chHa
  */
 IFX_STATIC SpiIf_Status IfxQspi_SpiMaster_lock(IfxQspi_SpiMaster *handle);
 
+/** \brief Starts the next segment of a XXL mode transfer
+ * \param chHandle Module Channel handle
+ * \return None
+ */
+IFX_STATIC void IfxQspi_SpiMaster_nextXxlSegment(IfxQspi_SpiMaster_Channel *chHandle);
+
 /** \brief Reads data from the Rx FIFO
  * \param chHandle Module Channel handle
  * \return None
  */
 IFX_STATIC void IfxQspi_SpiMaster_read(IfxQspi_SpiMaster_Channel *chHandle);
 
-/** \brief Unlocks the transfers
+/** \brief Starts the first queued job if the module is free
+ * \param handle Module handle
+ * \return None
+ */
+IFX_STATIC void IfxQspi_SpiMaster_startJob(IfxQspi_SpiMaster *handle);
+
+/** \brief Unlocks the transfers, completes the active job and starts the next queued one
  * \param handle Module handle
  * \return None
  */
@@ -163,7 +175,7 @@ SpiIf_Status IfxQspi_SpiMaster_exchange(IfxQspi_SpiMaster_Channel *chHandle, con
         }
         else if (chHandle->mode == IfxQspi_SpiMaster_Mode_xxl)
         {
-            handle->qspi->XXLCON.B.XDL = count - 1;
+            handle->qspi->XXLCON.B.XDL = __min(count, IFXQSPI_SPIMASTER_XXL_SEGMENT_SIZE) - 1;
             IfxQspi_SpiMaster_writeLong((IfxQspi_SpiMaster_Channel *)chHandle);
         }
         else
@@ -326,6 +338,24 @@ void IfxQspi_SpiMaster_initChannelConfig(IfxQspi_SpiMaster_ChannelConfig *chConf
 }
 
 
+void IfxQspi_SpiMaster_initJob(IfxQspi_SpiMaster_Job *job, IfxQspi_SpiMaster_Channel *chHandle, const void *src, void *dest, Ifx_SizeT count)
+{
+    IfxQspi_SpiMaster *handle = (IfxQspi_SpiMaster *)chHandle->base.driver->driver;
+
+    job->next      = NULL_PTR;
+    job->channel   = chHandle;
+    job->src       = src;
+    job->dest      = dest;
+    job->count     = count;
+    job->bacon.U   = chHandle->bacon.U;
+    job->econ      = handle->qspi->ECON[chHandle->channelId % 8].U;
+    job->dataWidth = chHandle->dataWidth;
+    job->callback  = NULL_PTR;
+    job->data      = NULL_PTR;
+    job->done      = TRUE;
+}
+
+
 void IfxQspi_SpiMaster_initModule(IfxQspi_SpiMaster *handle, const IfxQspi_SpiMaster_Config *config)
 {
     Ifx_QSPI *qspiSFR = config->qspi;
@@ -403,6 +433,9 @@ void IfxQspi_SpiMaster_initModule(IfxQspi_SpiMaster *handle, const IfxQspi_SpiMa
     handle->base.driver              = handle;
     handle->base.sending             = 0U;
     handle->base.activeChannel       = NULL_PTR;
+    handle->queue.first              = NULL_PTR;
+    handle->queue.last               = NULL_PTR;
+    handle->queue.active             = NULL_PTR;
 
     handle->base.functions.exchange  = (SpiIf_Exchange) & IfxQspi_SpiMaster_exchange;
     handle->base.functions.getStatus = (SpiIf_GetStatus) & IfxQspi_SpiMaster_getStatus;
@@ -554,7 +587,7 @@ void IfxQspi_SpiMaster_initModuleConfig(IfxQspi_SpiMaster_Config *config, Ifx_QS
 }
 
 
-void IfxQspi_SpiMaster_isrDmaReceive(IfxQspi_SpiMaster *qspiHandle)
+IFX_HOT_CODE void IfxQspi_SpiMaster_isrDmaReceive(IfxQspi_SpiMaster *qspiHandle)
 {
     Ifx_DMA                   *dmaSFR         = &MODULE_DMA;
     IfxDma_ChannelId           rxDmaChannelId = qspiHandle->dma.rxDmaChannelId;
@@ -562,20 +595,27 @@ void IfxQspi_SpiMaster_isrDmaReceive(IfxQspi_SpiMaster *qspiHandle)
 
     if (IfxDma_getAndClearChannelInterrupt(dmaSFR, rxDmaChannelId))
     {
-        if (chHandle->deactivateSlso != NULL_PTR)
+        if ((chHandle->mode == IfxQspi_SpiMaster_Mode_xxl) && (chHandle->base.rx.remaining > IFXQSPI_SPIMASTER_XXL_SEGMENT_SIZE))
         {
-            chHandle->deactivateSlso(chHandle);
+            IfxQspi_SpiMaster_nextXxlSegment(chHandle);
         }
+        else
+        {
+            if (chHandle->deactivateSlso != NULL_PTR)
+            {
+                chHandle->deactivateSlso(chHandle);
+            }
 
-        chHandle->base.flags.onTransfer = 0;
-        IfxQspi_SpiMaster_unlock((IfxQspi_SpiMaster *)chHandle->base.driver);
+            chHandle->base.flags.onTransfer = 0;
+            IfxQspi_SpiMaster_unlock((IfxQspi_SpiMaster *)chHandle->base.driver);
+        }
     }
 
     IfxDma_getAndClearChannelPatternDetectionInterrupt(dmaSFR, rxDmaChannelId);
 }
 
 
-void IfxQspi_SpiMaster_isrDmaTransmit(IfxQspi_SpiMaster *qspiHandle)
+IFX_HOT_CODE void IfxQspi_SpiMaster_isrDmaTransmit(IfxQspi_SpiMaster *qspiHandle)
 {
     IfxQspi_SpiMaster_Channel *chHandle       = IfxQspi_SpiMaster_activeChannel(qspiHandle);
     Ifx_DMA                   *dmaSFR         = &MODULE_DMA;
@@ -630,7 +670,7 @@ void IfxQspi_SpiMaster_isrDmaTransmit(IfxQspi_SpiMaster *qspiHandle)
 }
 
 
-void IfxQspi_SpiMaster_isrError(IfxQspi_SpiMaster *handle)
+IFX_HOT_CODE void IfxQspi_SpiMaster_isrError(IfxQspi_SpiMaster *handle)
 {
     Ifx_QSPI                  *qspiSFR    = handle->qspi;
     uint16                     errorFlags = IfxQspi_getErrorFlags(qspiSFR);
@@ -719,7 +759,7 @@ IfxQspi_PhaseTransitionEvent IfxQspi_SpiMaster_isrPhaseTransition(IfxQspi_SpiMas
 }
 
 
-void IfxQspi_SpiMaster_isrReceive(IfxQspi_SpiMaster *handle)
+IFX_HOT_CODE void IfxQspi_SpiMaster_isrReceive(IfxQspi_SpiMaster *handle)
 {
     IfxQspi_SpiMaster_Channel *chHandle = IfxQspi_SpiMaster_activeChannel(handle);
     chHandle->base.rxHandler(&chHandle->base);
@@ -727,7 +767,7 @@ void IfxQspi_SpiMaster_isrReceive(IfxQspi_SpiMaster *handle)
 }
 
 
-void IfxQspi_SpiMaster_isrTransmit(IfxQspi_SpiMaster *handle)
+IFX_HOT_CODE void IfxQspi_SpiMaster_isrTransmit(IfxQspi_SpiMaster *handle)
 {
     IfxQspi_SpiMaster_Channel *chHandle = IfxQspi_SpiMaster_activeChannel(handle);
     chHandle->base.txHandler(&chHandle->base);
@@ -757,6 +797,25 @@ IFX_STATIC SpiIf_Status IfxQspi_SpiMaster_lock(IfxQspi_SpiMaster *handle)
 }
 
 
+IFX_STATIC void IfxQspi_SpiMaster_nextXxlSegment(IfxQspi_SpiMaster_Channel *chHandle)
+{
+    IfxQspi_SpiMaster *handle = chHandle->base.driver->driver;
+
+    /* the previous segment is completely received, its BACON kept the chip select active */
+    chHandle->base.tx.data       = &(((uint8 *)chHandle->base.tx.data)[IFXQSPI_SPIMASTER_XXL_SEGMENT_SIZE]);
+    chHandle->base.tx.remaining -= IFXQSPI_SPIMASTER_XXL_SEGMENT_SIZE;
+    chHandle->base.rx.remaining -= IFXQSPI_SPIMASTER_XXL_SEGMENT_SIZE;
+
+    if (chHandle->base.rx.data != NULL_PTR)
+    {
+        chHandle->base.rx.data = &(((uint8 *)chHandle->base.rx.data)[IFXQSPI_SPIMASTER_XXL_SEGMENT_SIZE]);
+    }
+
+    handle->qspi->XXLCON.B.XDL = __min(chHandle->base.tx.remaining, IFXQSPI_SPIMASTER_XXL_SEGMENT_SIZE) - 1;
+    IfxQspi_SpiMaster_writeLong(chHandle);
+}
+
+
 void IfxQspi_SpiMaster_packLongModeBuffer(IfxQspi_SpiMaster_Channel *chHandle, void *data, uint32 *longFifoBuffer, Ifx_SizeT dataLength)
 {
     int     i;
@@ -827,7 +886,38 @@ void IfxQspi_SpiMaster_packLongModeBuffer(IfxQspi_SpiMaster_Channel *chHandle, v
 }
 
 
-IFX_STATIC void IfxQspi_SpiMaster_read(IfxQspi_SpiMaster_Channel *chHandle)
+SpiIf_Status IfxQspi_SpiMaster_queueJob(IfxQspi_SpiMaster_Job *job)
+{
+    IfxQspi_SpiMaster          *handle         = (IfxQspi_SpiMaster *)job->channel->base.driver->driver;
+    IfxQspi_SpiMaster_JobQueue *queue          = &handle->queue;
+    boolean                     interruptState = IfxCpu_disableInterrupts();
+
+    job->next = NULL_PTR;
+    job->done = FALSE;
+
+    if (queue->last == NULL_PTR)
+    {
+        queue->first = job;
+    }
+    else
+    {
+        queue->last->next = job;
+    }
+
+    queue->last = job;
+
+    if (queue->active == NULL_PTR)
+    {
+        IfxQspi_SpiMaster_startJob(handle);
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return SpiIf_Status_ok;
+}
+
+
+IFX_HOT_CODE IFX_STATIC void IfxQspi_SpiMaster_read(IfxQspi_SpiMaster_Channel *chHandle)
 {
     IfxQspi_SpiMaster *handle  = chHandle->base.driver->driver;
     Ifx_QSPI          *qspiSFR = handle->qspi;
@@ -895,13 +985,98 @@ SpiIf_Status IfxQspi_SpiMaster_setChannelBaudrate(IfxQspi_SpiMaster_Channel *chH
 }
 
 
+void IfxQspi_SpiMaster_setJobBaudrate(IfxQspi_SpiMaster_Job *job, float32 baudrate)
+{
+    IfxQspi_SpiMaster_Channel *chHandle = job->channel;
+    IfxQspi_SpiMaster         *handle   = (IfxQspi_SpiMaster *)chHandle->base.driver->driver;
+    Ifx_QSPI                  *qspiSFR  = handle->qspi;
+    SpiIf_ChConfig             chConfig = IfxQspi_SpiMaster_getChannelConfig(chHandle);
+
+    chConfig.baudrate       = baudrate;
+    chConfig.mode.dataWidth = job->dataWidth;
+    job->econ               = IfxQspi_calculateExtendedConfigurationValue(qspiSFR, (uint8)(chHandle->channelId % 8), &chConfig);
+    job->bacon.U            = IfxQspi_calculateBasicConfigurationValue(qspiSFR, chHandle->channelId, &chConfig.mode, baudrate);
+}
+
+
+void IfxQspi_SpiMaster_setJobCallback(IfxQspi_SpiMaster_Job *job, IfxQspi_SpiMaster_JobCallback callback, void *data)
+{
+    job->callback = callback;
+    job->data     = data;
+}
+
+
+void IfxQspi_SpiMaster_setJobDataWidth(IfxQspi_SpiMaster_Job *job, uint8 dataWidth)
+{
+    job->dataWidth  = dataWidth;
+    job->bacon.B.DL = dataWidth - 1;
+}
+
+
+IFX_STATIC void IfxQspi_SpiMaster_startJob(IfxQspi_SpiMaster *handle)
+{
+    IfxQspi_SpiMaster_JobQueue *queue = &handle->queue;
+    IfxQspi_SpiMaster_Job      *job   = queue->first;
+
+    /* a direct exchange in progress starts the queue on its completion */
+    if ((job != NULL_PTR) && (handle->base.sending == 0))
+    {
+        IfxQspi_SpiMaster_Channel *chHandle = job->channel;
+        uint8                      cs       = chHandle->channelId % 8;
+
+        queue->first = job->next;
+
+        if (queue->first == NULL_PTR)
+        {
+            queue->last = NULL_PTR;
+        }
+
+        queue->active    = job;
+        queue->bacon.U   = chHandle->bacon.U;
+        queue->econ      = handle->qspi->ECON[cs].U;
+        queue->dataWidth = chHandle->dataWidth;
+
+        handle->qspi->ECON[cs].U = job->econ;
+        chHandle->bacon.U        = job->bacon.U;
+        chHandle->dataWidth      = job->dataWidth;
+        IfxQspi_SpiMaster_exchange(chHandle, job->src, job->dest, job->count);
+    }
+}
+
+
 IFX_STATIC void IfxQspi_SpiMaster_unlock(IfxQspi_SpiMaster *handle)
 {
+    IfxQspi_SpiMaster_JobQueue *queue = &handle->queue;
+    IfxQspi_SpiMaster_Job      *job   = queue->active;
+
     handle->base.sending = 0UL;
+
+    if (job != NULL_PTR)
+    {
+        IfxQspi_SpiMaster_Channel *chHandle = job->channel;
+
+        /* restore the channel settings for direct exchanges */
+        handle->qspi->ECON[chHandle->channelId % 8].U = queue->econ;
+        chHandle->bacon.U                             = queue->bacon.U;
+        chHandle->dataWidth                           = queue->dataWidth;
+        queue->active                                 = NULL_PTR;
+        job->done                                     = TRUE;
+
+        if (job->callback != NULL_PTR)
+        {
+            job->callback(job);
+        }
+    }
+
+    /* the callback may already have started the next job */
+    if (queue->active == NULL_PTR)
+    {
+        IfxQspi_SpiMaster_startJob(handle);
+    }
 }
 
 
-IFX_STATIC void IfxQspi_SpiMaster_write(IfxQspi_SpiMaster_Channel *chHandle)
+IFX_HOT_CODE IFX_STATIC void IfxQspi_SpiMaster_write(IfxQspi_SpiMaster_Channel *chHandle)
 {
     SpiIf_Job         *job    = &chHandle->base.tx;
     IfxQspi_SpiMaster *handle = chHandle->base.driver->driver;
@@ -915,6 +1090,7 @@ IFX_STATIC void IfxQspi_SpiMaster_write(IfxQspi_SpiMaster_Channel *chHandle)
 
         IfxDma_ChannelId       txDmaChannelId = handle->dma.txDmaChannelId;
         IfxDma_ChannelId       rxDmaChannelId = handle->dma.rxDmaChannelId;
+        Ifx_SizeT              dataSize       = job->remaining * ((chHandle->dataWidth <= 8) ? 1 : ((chHandle->dataWidth <= 16) ? 2 : 4));
 
         boolean                interruptState = IfxCpu_disableInterrupts();
 
@@ -946,6 +1122,7 @@ IFX_STATIC void IfxQspi_SpiMaster_write(IfxQspi_SpiMaster_Channel *chHandle)
             }
             else
             {
+                IfxCpu_flushDataCache(job->data, dataSize);
                 IfxDma_setChannelSourceAddress(dmaSFR, txDmaChannelId, (void *)IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), job->data));
                 IfxDma_setChannelSourceIncrementStep(dmaSFR, txDmaChannelId, IfxDma_ChannelIncrementStep_1,
                     IfxDma_ChannelIncrementDirection_positive, IfxDma_ChannelIncrementCircular_none);
@@ -988,6 +1165,7 @@ IFX_STATIC void IfxQspi_SpiMaster_write(IfxQspi_SpiMaster_Channel *chHandle)
         }
         else
         {
+            IfxCpu_flushDataCache(chHandle->base.rx.data, dataSize);
             IfxDma_setChannelDestinationAddress(dmaSFR, rxDmaChannelId, (void *)IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), chHandle->base.rx.data));
             IfxDma_setChannelDestinationIncrementStep(dmaSFR, rxDmaChannelId, IfxDma_ChannelIncrementStep_1,
                 IfxDma_ChannelIncrementDirection_positive, IfxDma_ChannelIncrementCircular_none);
@@ -1173,15 +1351,24 @@ IFX_STATIC void IfxQspi_SpiMaster_write(IfxQspi_SpiMaster_Channel *chHandle)
 }
 
 
-IFX_STATIC void IfxQspi_SpiMaster_writeLong(IfxQspi_SpiMaster_Channel *chHandle)
+IFX_HOT_CODE IFX_STATIC void IfxQspi_SpiMaster_writeLong(IfxQspi_SpiMaster_Channel *chHandle)
 {
-    SpiIf_Job         *job      = &chHandle->base.tx;
-    IfxQspi_SpiMaster *handle   = chHandle->base.driver->driver;
-    uint8              fifosize = IFXQSPI_FIFO32BITSIZE(job->remaining);
+    SpiIf_Job         *job    = &chHandle->base.tx;
+    IfxQspi_SpiMaster *handle = chHandle->base.driver->driver;
+    Ifx_SizeT          length = job->remaining;
+    uint16             fifosize;
+
+    if (chHandle->mode == IfxQspi_SpiMaster_Mode_xxl)
+    {
+        /* long XXL frames are split in segments, see IfxQspi_SpiMaster_nextXxlSegment() */
+        length = __min(length, IFXQSPI_SPIMASTER_XXL_SEGMENT_SIZE);
+    }
+
+    fifosize = IFXQSPI_FIFO32BITSIZE(length);
 
     if (chHandle->mode != IfxQspi_SpiMaster_Mode_xxl)
     {
-        fifosize = fifosize + IFXQSPI_BACONSIZE(job->remaining) - 1;       // combining this line and above doesn't work
+        fifosize = fifosize + IFXQSPI_BACONSIZE(length) - 1;       // combining this line and above doesn't work
     }
 
     if (handle->dma.useDma)
@@ -1202,6 +1389,7 @@ IFX_STATIC void IfxQspi_SpiMaster_writeLong(IfxQspi_SpiMaster_Channel *chHandle)
             IfxDma_setChannelMoveSize(dmaSFR, txDmaChannelId, IfxDma_ChannelMoveSize_32bit);
 
             {
+                IfxCpu_flushDataCache(job->data, fifosize * 4);
                 IfxDma_setChannelSourceAddress(dmaSFR, txDmaChannelId, (void *)IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), job->data));
                 IfxDma_setChannelSourceIncrementStep(dmaSFR, txDmaChannelId, IfxDma_ChannelIncrementStep_1,
                     IfxDma_ChannelIncrementDirection_positive, IfxDma_ChannelIncrementCircular_none);
@@ -1221,7 +1409,7 @@ IFX_STATIC void IfxQspi_SpiMaster_writeLong(IfxQspi_SpiMaster_Channel *chHandle)
         }
 
         /* Receive config */
-        IfxDma_setChannelTransferCount(dmaSFR, rxDmaChannelId, IFXQSPI_FIFO32BITSIZE(job->remaining));
+        IfxDma_setChannelTransferCount(dmaSFR, rxDmaChannelId, IFXQSPI_FIFO32BITSIZE(length));
         IfxDma_setChannelMoveSize(dmaSFR, rxDmaChannelId, IfxDma_ChannelMoveSize_32bit);
 
         if (chHandle->base.rx.data == NULL_PTR)
@@ -1235,6 +1423,7 @@ IFX_STATIC void IfxQspi_SpiMaster_writeLong(IfxQspi_SpiMaster_Channel *chHandle)
         }
         else
         {
+            IfxCpu_flushDataCache(chHandle->base.rx.data, IFXQSPI_FIFO32BITSIZE(length) * 4);
             IfxDma_setChannelDestinationAddress(dmaSFR, rxDmaChannelId, (void *)IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), chHandle->base.rx.data));
             IfxDma_setChannelDestinationIncrementStep(dmaSFR, rxDmaChannelId, IfxDma_ChannelIncrementStep_1,
                 IfxDma_ChannelIncrementDirection_positive, IfxDma_ChannelIncrementCircular_none);
@@ -1268,7 +1457,8 @@ IFX_STATIC void IfxQspi_SpiMaster_writeLong(IfxQspi_SpiMaster_Channel *chHandle)
         }
         else
         {
-            chHandle->bacon.B.LAST = 1;
+            /* the chip select stays active until the last segment */
+            chHandle->bacon.B.LAST = (job->remaining <= IFXQSPI_SPIMASTER_XXL_SEGMENT_SIZE) ? 1 : 0;
             chHandle->bacon.B.BYTE = 1;
             chHandle->bacon.B.DL   = 0;
         }
@@ -333,6 +333,16 @@
  * spiMasterChannelConfig.mode = IfxQspi_SpiMaster_Mode_xxl;
  * \endcode
  *
+ * In XXL mode the DMA moves the data directly from the application buffer (32-bit aligned, count in bytes) to the
+ * QSPI, the data are sent in memory byte order without any packing. Frames of any length are split into segments of
+ * \ref IFXQSPI_SPIMASTER_XXL_SEGMENT_SIZE bytes, the driver inserts the BACON of each segment and keeps the chip select
+ * active until the last one.
+ * A RGB565 row is sent with the pixels stored in the byte order of the display (high byte first):
+ * \code
+ * uint16 row[320]; // pixels stored high byte first
+ * IfxQspi_SpiMaster_exchange(&spiChannel, row, NULL_PTR, sizeof(row));
+ * \endcode
+ *
  *
  * \section IfxLld_Qspi_SpiMaster_LongMode How to use Long / Long Continuous Mode with Dma
  *
@@ -463,6 +473,51 @@
  * If an output pin is not configured in loopback, the default SPI channel selected
  * will be 0.
  *
+ * \section IfxLld_Qspi_SpiMaster_Queue Job Queue
+ *
+ * Several clients can share one QSPI module with the job queue. A job carries its channel, its
+ * BACON / ECON settings (data length, baudrate) and a completion callback. The jobs are started
+ * back-to-back from the completion interrupt, with DMA the data are moved without CPU load.
+ * No client waits on the transfers of another one:
+ * \code
+ *     IfxQspi_SpiMaster_Job commandJob, pixelJob;
+ *
+ *     IfxQspi_SpiMaster_initJob(&commandJob, &tftChannel, command, NULL_PTR, 1);
+ *     IfxQspi_SpiMaster_setJobDataWidth(&commandJob, 8);
+ *
+ *     IfxQspi_SpiMaster_initJob(&pixelJob, &tftChannel, pixels, NULL_PTR, 320);
+ *     IfxQspi_SpiMaster_setJobDataWidth(&pixelJob, 16);
+ *     IfxQspi_SpiMaster_setJobCallback(&pixelJob, &tftRowDone, NULL_PTR);
+ *
+ *     IfxQspi_SpiMaster_queueJob(&commandJob);
+ *     IfxQspi_SpiMaster_queueJob(&pixelJob);
+ * \endcode
+ *
+ * The callback is executed in the completion interrupt. A job shall not be modified while it is queued,
+ * \ref IfxQspi_SpiMaster_isJobDone() tells when it can be reused.
+ *
+ * \section IfxLld_Qspi_SpiMaster_Static Static Channel
+ *
+ * Short frames exchanged in a time critical loop (e.g. a position sensor read in the control interrupt) can use a
+ * constant \ref IfxQspi_SpiMaster_StaticChannel instead of the channel handle. For a const object visible in the
+ * translation unit, \ref IfxQspi_SpiMaster_exchangeStatic() writes the BACON and the data to FIFO addresses folded
+ * at compile time and polls the receive FIFO, without locking, job bookkeeping nor interrupt.
+ *
+ * - The module and the channel are initialised as usual: \ref IfxQspi_SpiMaster_initChannel() configures the baudrate
+ * (ECON) of the chip select used. The module shall be initialised without DMA and with txPriority and rxPriority 0,
+ * and shall not be used by \ref IfxQspi_SpiMaster_exchange() nor by the job queue.
+ * - The chip select is the hardware one of the channel, the frame ends with the last data.
+ * \code
+ *     static IFX_CONST IfxQspi_SpiMaster_StaticChannel encoderChannel = {
+ *         .qspi  = &MODULE_QSPI2,
+ *         .bacon = IFXQSPI_SPIMASTER_STATIC_BACON(IfxQspi_ChannelId_1, 16),
+ *     };
+ *     uint32 command[2] = {0x8021, 0x0000};
+ *     uint32 response[2];
+ *
+ *     IfxQspi_SpiMaster_exchangeStatic(&encoderChannel, command, response, 2);
+ * \endcode
+ *
  * \defgroup IfxLld_Qspi_SpiMaster SPI Master Driver
  * \ingroup IfxLld_Qspi
  * \defgroup IfxLld_Qspi_SpiMaster_DataStructures Data Structures
@@ -491,8 +546,25 @@
 #include "Cpu/Irq/IfxCpu_Irq.h"
 #include "Dma/Dma/IfxDma_Dma.h"
 #include "Qspi/Std/IfxQspi.h"
+#include "IfxQspi_bf.h"
 #include "Scu/Std/IfxScuWdt.h"
 
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Maximal number of bytes of one XXL mode segment.
+ * Limited by the 16383 32-bit moves of a DMA transaction, longer transfers are chained in segments
+ */
+#define IFXQSPI_SPIMASTER_XXL_SEGMENT_SIZE (0xFFFCU)
+
+/** \brief BACON value of a \ref IfxQspi_SpiMaster_StaticChannel: MSB first, even parity, minimal chip select delays
+ */
+#define IFXQSPI_SPIMASTER_STATIC_BACON(channelId, dataWidth)         \
+    (((uint32)(channelId) << IFX_QSPI_BACON_CS_OFF)                  \
+     | ((uint32)((dataWidth) - 1) << IFX_QSPI_BACON_DL_OFF)          \
+     | (1u << IFX_QSPI_BACON_MSB_OFF))
+
 /******************************************************************************/
 /*------------------------------Type Definitions------------------------------*/
 /******************************************************************************/
@@ -501,6 +573,10 @@ typedef struct IfxQspi_SpiMaster_Channel_s IfxQspi_SpiMaster_Channel;
 
 typedef void                             (*IfxQspi_SpiMaster_AutoSlso)(IfxQspi_SpiMaster_Channel *chHandle);
 
+typedef struct IfxQspi_SpiMaster_Job_s IfxQspi_SpiMaster_Job;
+
+typedef void                           (*IfxQspi_SpiMaster_JobCallback)(IfxQspi_SpiMaster_Job *job);
+
 /******************************************************************************/
 /*--------------------------------Enumerations--------------------------------*/
 /******************************************************************************/
@@ -610,14 +686,44 @@ typedef struct
 
 /** \addtogroup IfxLld_Qspi_SpiMaster_DataStructures
  * \{ */
+/** \brief Queued job: one exchange with its own channel settings
+ */
+struct IfxQspi_SpiMaster_Job_s
+{
+    IfxQspi_SpiMaster_Job        *next;            /**< \brief next job in the queue */
+    IfxQspi_SpiMaster_Channel    *channel;         /**< \brief channel used for the exchange */
+    const void                   *src;             /**< \brief data to be sent, NULL_PTR to send all-1 */
+    void                         *dest;            /**< \brief received data, NULL_PTR to discard them */
+    Ifx_SizeT                     count;           /**< \brief number of data */
+    Ifx_QSPI_BACON                bacon;           /**< \brief basic configuration of the job */
+    uint32                        econ;            /**< \brief extended configuration of the job */
+    uint8                         dataWidth;       /**< \brief data width of the job */
+    IfxQspi_SpiMaster_JobCallback callback;        /**< \brief called on completion, NULL_PTR if none */
+    void                         *data;            /**< \brief callback data */
+    volatile boolean              done;            /**< \brief TRUE when the exchange is finished */
+};
+
+/** \brief Job queue
+ */
+typedef struct
+{
+    IfxQspi_SpiMaster_Job *first;           /**< \brief next job to be started */
+    IfxQspi_SpiMaster_Job *last;            /**< \brief last queued job */
+    IfxQspi_SpiMaster_Job *active;          /**< \brief job on transfer, NULL_PTR if none */
+    Ifx_QSPI_BACON         bacon;           /**< \brief channel basic configuration, restored after the active job */
+    uint32                 econ;            /**< \brief channel extended configuration, restored after the active job */
+    uint8                  dataWidth;       /**< \brief channel data width, restored after the active job */
+} IfxQspi_SpiMaster_JobQueue;
+
 /** \brief Module handle data structure
  */
 typedef struct
 {
-    SpiIf                 base;                  /**< \brief Module SPI interface handle */
-    Ifx_QSPI             *qspi;                  /**< \brief Pointer to QSPI module registers */
-    IfxQspi_SpiMaster_Dma dma;                   /**< \brief dma handle */
-    float32               maximumBaudrate;       /**< \brief Maximum Baud Rate for the SPI Module. */
+    SpiIf                      base;                  /**< \brief Module SPI interface handle */
+    Ifx_QSPI                  *qspi;                  /**< \brief Pointer to QSPI module registers */
+    IfxQspi_SpiMaster_Dma      dma;                   /**< \brief dma handle */
+    float32                    maximumBaudrate;       /**< \brief Maximum Baud Rate for the SPI Module. */
+    IfxQspi_SpiMaster_JobQueue queue;                 /**< \brief job queue */
 } IfxQspi_SpiMaster;
 
 /** \brief Module Channel configuration structure
@@ -665,6 +771,14 @@ typedef struct
     IfxQspi_FifoMode                  rxFifoMode;                       /**< \brief Specifies the Receive FIFO mode */
 } IfxQspi_SpiMaster_Config;
 
+/** \brief Constant description of a channel for \ref IfxQspi_SpiMaster_exchangeStatic()
+ */
+typedef struct
+{
+    Ifx_QSPI *qspi;        /**< \brief Pointer to QSPI module registers */
+    uint32    bacon;       /**< \brief Basic configuration of the frames, see \ref IFXQSPI_SPIMASTER_STATIC_BACON */
+} IfxQspi_SpiMaster_StaticChannel;
+
 /** \} */
 
 /** \addtogroup IfxLld_Qspi_SpiMaster_Module
@@ -753,6 +867,72 @@ IFX_EXTERN SpiIf_Status IfxQspi_SpiMaster_exchange(IfxQspi_SpiMaster_Channel *ch
  */
 IFX_EXTERN SpiIf_Status IfxQspi_SpiMaster_getStatus(IfxQspi_SpiMaster_Channel *chHandle);
 
+/** \brief Initialises a job with the settings of the channel
+ * \param job Job to be initialised
+ * \param chHandle Module Channel handle
+ * \param src Source of data. Can be set to NULL_PTR if nothing to transmit (receive only) - in this case, all-1 will be sent.
+ * \param dest Destination of data. Can be set to NULL_PTR if nothing to receive (transmit only).
+ * \param count Number of data
+ * \return None
+ */
+IFX_EXTERN void IfxQspi_SpiMaster_initJob(IfxQspi_SpiMaster_Job *job, IfxQspi_SpiMaster_Channel *chHandle, const void *src, void *dest, Ifx_SizeT count);
+
+/** \brief Appends a job to the queue of the module. The job is started immediately if the module is free,
+ * else after the previous jobs
+ * \param job Job to be queued
+ * \return SpiIf_Status_ok
+ *
+ * Usage example: see \ref IfxLld_Qspi_SpiMaster_Queue
+ *
+ */
+IFX_EXTERN SpiIf_Status IfxQspi_SpiMaster_queueJob(IfxQspi_SpiMaster_Job *job);
+
+/** \brief Sets the baudrate of a job
+ * \param job Job handle
+ * \param baudrate Baudrate to be used for the job (in Baud)
+ * \return None
+ */
+IFX_EXTERN void IfxQspi_SpiMaster_setJobBaudrate(IfxQspi_SpiMaster_Job *job, float32 baudrate);
+
+/** \brief Sets the completion callback of a job
+ * \param job Job handle
+ * \param callback Function called in the completion interrupt, NULL_PTR if none
+ * \param data Callback data
+ * \return None
+ */
+IFX_EXTERN void IfxQspi_SpiMaster_setJobCallback(IfxQspi_SpiMaster_Job *job, IfxQspi_SpiMaster_JobCallback callback, void *data);
+
+/** \brief Sets the data width of a job
+ * \param job Job handle
+ * \param dataWidth Number of bits per data (1 .. 32)
+ * \return None
+ */
+IFX_EXTERN void IfxQspi_SpiMaster_setJobDataWidth(IfxQspi_SpiMaster_Job *job, uint8 dataWidth);
+
+/** \} */
+
+/** \addtogroup IfxLld_Qspi_SpiMaster_Com
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Exchanges one frame on a static channel and waits for its end, see \ref IfxLld_Qspi_SpiMaster_Static
+ * \param channel Static channel, a const object for the addresses to be folded at compile time
+ * \param src Data to transmit
+ * \param dest Received data, NULL_PTR to discard them
+ * \param count Number of data of the frame, at least 1
+ * \return None
+ */
+IFX_INLINE void IfxQspi_SpiMaster_exchangeStatic(const IfxQspi_SpiMaster_StaticChannel *channel, const uint32 *src, uint32 *dest, Ifx_SizeT count);
+
+/** \brief Returns TRUE when the job is finished
+ * \param job Job handle
+ * \return TRUE when the job is finished
+ */
+IFX_INLINE boolean IfxQspi_SpiMaster_isJobDone(IfxQspi_SpiMaster_Job *job);
+
 /** \} */
 
 /** \addtogroup IfxLld_Qspi_SpiMaster_InterruptFunctions
@@ -883,6 +1063,52 @@ IFX_EXTERN SpiIf_Status IfxQspi_SpiMaster_setChannelBaudrate(IfxQspi_SpiMaster_C
 /*---------------------Inline Function Implementations------------------------*/
 /******************************************************************************/
 
+IFX_INLINE void IfxQspi_SpiMaster_exchangeStatic(const IfxQspi_SpiMaster_StaticChannel *channel, const uint32 *src, uint32 *dest, Ifx_SizeT count)
+{
+    Ifx_QSPI *qspi    = channel->qspi;
+    Ifx_SizeT txIndex = 0;
+    Ifx_SizeT rxIndex = 0;
+
+    if (count > 1)
+    {
+        IfxQspi_writeBasicConfigurationBeginStream(qspi, channel->bacon);
+    }
+
+    while (rxIndex < count)
+    {
+        /* -1, since the BACON of the last data allocates one FIFO entry */
+        if ((txIndex < count) && (IfxQspi_getTransmitFifoLevel(qspi) < (IFXQSPI_HWFIFO_DEPTH - 1)))
+        {
+            if (txIndex == (count - 1))
+            {
+                IfxQspi_writeBasicConfigurationEndStream(qspi, channel->bacon);
+            }
+
+            IfxQspi_writeTransmitFifo(qspi, src[txIndex]);
+            txIndex++;
+        }
+
+        if (IfxQspi_getReceiveFifoLevel(qspi) != 0)
+        {
+            uint32 data = IfxQspi_readReceiveFifo(qspi);
+
+            if (dest != NULL_PTR)
+            {
+                dest[rxIndex] = data;
+            }
+
+            rxIndex++;
+        }
+    }
+}
+
+
+IFX_INLINE boolean IfxQspi_SpiMaster_isJobDone(IfxQspi_SpiMaster_Job *job)
+{
+    return job->done;
+}
+
+
 IFX_INLINE uint32 IfxQspi_SpiMaster_readReceiveFifo(IfxQspi_SpiMaster *handle)
 {
     Ifx_QSPI *qspiSFR = handle->qspi;
@@ -54,9 +54,9 @@
 /** \brief Get Fifo size required for Long / Long continous mode interms 32-bit
  * LONG MODE FIFO size (data size in bytes) = (size for Bacon) + (Datasize converted to 32-bit)
  */
-#define IFXQSPI_BACONSIZE(Datasize)           (((((Datasize) % 16) == 0) ? ((uint8)((Datasize) / 16)) : ((uint8)((Datasize) / 16) + 1)))
+#define IFXQSPI_BACONSIZE(Datasize)           (((((Datasize) % 16) == 0) ? ((uint16)((Datasize) / 16)) : ((uint16)((Datasize) / 16) + 1)))
 
-#define IFXQSPI_FIFO32BITSIZE(Datasize)       ((((Datasize) % 4) == 0) ? ((uint8)((Datasize) / 4)) : ((uint8)((Datasize) / 4) + 1))
+#define IFXQSPI_FIFO32BITSIZE(Datasize)       ((((Datasize) % 4) == 0) ? ((uint16)((Datasize) / 4)) : ((uint16)((Datasize) / 4) + 1))
 
 #define IFXQSPI_GETLONGMODEFIFOSIZE(Datasize) (IFXQSPI_BACONSIZE(Datasize) + IFXQSPI_FIFO32BITSIZE(Datasize))
 
@@ -687,6 +687,12 @@ IFX_EXTERN void IfxQspi_calculateDelayConstants(const Ifx_QSPI *qspi, const IfxQ
  */
 IFX_INLINE volatile Ifx_SRC_SRCR *IfxQspi_getErrorSrc(Ifx_QSPI *qspi);
 
+/** \brief Gets the phase transition service request
+ * \param qspi Pointer to QSPI module registers
+ * \return Phase transition service request value
+ */
+IFX_INLINE volatile Ifx_SRC_SRCR *IfxQspi_getPhaseTransitionSrc(Ifx_QSPI *qspi);
+
 /** \brief Gets the RXFIFO service request
  * \param qspi Pointer to QSPI module registers
  * \return Receive service request value
@@ -962,6 +968,13 @@ IFX_INLINE IfxQspi_Phase IfxQspi_getPhase(Ifx_QSPI *qspi)
 }
 
 
+IFX_INLINE volatile Ifx_SRC_SRCR *IfxQspi_getPhaseTransitionSrc(Ifx_QSPI *qspi)
+{
+    uint32 index = IfxQspi_getIndex(qspi);
+    return &MODULE_SRC.QSPI.QSPI[index].PT;
+}
+
+
 IFX_INLINE uint8 IfxQspi_getReceiveFifoLevel(Ifx_QSPI *qspi)
 {
     return qspi->STATUS.B.RXFIFOLEVEL;
@@ -0,0 +1,194 @@
+/**
+ * \file IfxScuEru_Capture.c
+ * \brief SCU ERU CAPTURE details
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "IfxScuEru_Capture.h"
+#include "IfxSrc_reg.h"
+#include "IfxStm_reg.h"
+#include "Src/Std/IfxSrc.h"
+
+/******************************************************************************/
+/*-----------------------Private Function Prototypes--------------------------*/
+/******************************************************************************/
+
+/** \brief Returns the DMA circular buffer range of the ring buffer
+ * \param address global address of the ring buffer
+ * \param size number of timestamps
+ * \return IfxDma_ChannelIncrementCircular_none if the size is not a power of 2 or the buffer not aligned on its size
+ */
+static IfxDma_ChannelIncrementCircular IfxScuEru_Capture_getCircularRange(uint32 address, uint16 size);
+
+/** \brief Returns the index of the next timestamp written by the DMA
+ * \param capture capture handle
+ * \return index in the ring buffer
+ */
+static uint16 IfxScuEru_Capture_getWriteIndex(const IfxScuEru_Capture *capture);
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+uint16 IfxScuEru_Capture_getCount(const IfxScuEru_Capture *capture)
+{
+    return (uint16)((IfxScuEru_Capture_getWriteIndex(capture) - capture->readIndex) & (capture->bufferSize - 1));
+}
+
+
+static IfxDma_ChannelIncrementCircular IfxScuEru_Capture_getCircularRange(uint32 address, uint16 size)
+{
+    uint32 bytes = (uint32)size * 4;
+    uint32 range = IfxDma_ChannelIncrementCircular_4;
+
+    if ((size == 0) || ((bytes & (bytes - 1)) != 0) || ((address & (bytes - 1)) != 0))
+    {
+        return IfxDma_ChannelIncrementCircular_none;
+    }
+
+    while ((range < IfxDma_ChannelIncrementCircular_32768) && ((1u << range) < bytes))
+    {
+        range++;
+    }
+
+    return ((1u << range) == bytes) ? (IfxDma_ChannelIncrementCircular)range : IfxDma_ChannelIncrementCircular_none;
+}
+
+
+static uint16 IfxScuEru_Capture_getWriteIndex(const IfxScuEru_Capture *capture)
+{
+    uint32 address = IfxDma_getChannelDestinationAddress(capture->dmaChannel.dma, capture->dmaChannel.channelId);
+
+    return (uint16)(((address - capture->bufferAddress) / 4) & (capture->bufferSize - 1));
+}
+
+
+boolean IfxScuEru_Capture_init(IfxScuEru_Capture *capture, const IfxScuEru_Capture_Config *config)
+{
+    IfxScuEru_InputChannel          inputChannel = (IfxScuEru_InputChannel)config->reqPin->channelId;
+    volatile Ifx_SRC_SRCR          *src          = &MODULE_SRC.SCU.SCU.ERU[config->outputChannel % 4];
+    IfxDma_ChannelIncrementCircular range;
+    IfxDma_Dma                      dma;
+    IfxDma_Dma_ChannelConfig        dmaCfg;
+
+    capture->buffer        = config->buffer;
+    capture->bufferAddress = IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), config->buffer);
+    capture->bufferSize    = config->bufferSize;
+    capture->readIndex     = 0;
+
+    range                  = IfxScuEru_Capture_getCircularRange(capture->bufferAddress, config->bufferSize);
+
+    if (range == IfxDma_ChannelIncrementCircular_none)
+    {
+        return FALSE;
+    }
+
+    /* DMA: one timestamp per request, the destination wraps in the ring buffer */
+    IfxDma_Dma_createModuleHandle(&dma, &MODULE_DMA);
+    IfxDma_Dma_initChannelConfig(&dmaCfg, &dma);
+
+    dmaCfg.channelId                        = config->dmaChannelId;
+    dmaCfg.hardwareRequestEnabled           = TRUE;
+    dmaCfg.requestMode                      = IfxDma_ChannelRequestMode_oneTransferPerRequest;
+    dmaCfg.operationMode                    = IfxDma_ChannelOperationMode_continuous;
+    dmaCfg.moveSize                         = IfxDma_ChannelMoveSize_32bit;
+    dmaCfg.blockMode                        = IfxDma_ChannelMove_1;
+    dmaCfg.transferCount                    = config->bufferSize;
+    dmaCfg.sourceAddress                    = (uint32)config->timestamp;
+    dmaCfg.sourceCircularBufferEnabled      = TRUE;                                   // fixed source
+    dmaCfg.sourceAddressCircularRange       = IfxDma_ChannelIncrementCircular_none;
+    dmaCfg.destinationAddress               = capture->bufferAddress;
+    dmaCfg.destinationCircularBufferEnabled = TRUE;
+    dmaCfg.destinationAddressCircularRange  = range;
+    IfxDma_Dma_initChannel(&capture->dmaChannel, &dmaCfg);
+
+    /* ERU: pin -> ETL -> OGU, the interrupt output is activated on each trigger */
+    IfxScuEru_initReqPin(config->reqPin, config->inputMode);
+
+    if (config->risingEdge != FALSE)
+    {
+        IfxScuEru_enableRisingEdgeDetection(inputChannel);
+    }
+    else
+    {
+        IfxScuEru_disableRisingEdgeDetection(inputChannel);
+    }
+
+    if (config->fallingEdge != FALSE)
+    {
+        IfxScuEru_enableFallingEdgeDetection(inputChannel);
+    }
+    else
+    {
+        IfxScuEru_disableFallingEdgeDetection(inputChannel);
+    }
+
+    IfxScuEru_enableAutoClear(inputChannel);
+    IfxScuEru_connectTrigger(inputChannel, (IfxScuEru_InputNodePointer)config->outputChannel);
+    IfxScuEru_setInterruptGatingPattern(config->outputChannel, IfxScuEru_InterruptGatingPattern_alwaysActive);
+    IfxScuEru_clearEventFlag(inputChannel);
+
+    /* the ERU service request triggers the DMA channel with the same number */
+    IfxSrc_init(src, IfxSrc_Tos_dma, (Ifx_Priority)config->dmaChannelId);
+    IfxSrc_enable(src);
+
+    IfxScuEru_enableTriggerPulse(inputChannel);
+
+    return TRUE;
+}
+
+
+void IfxScuEru_Capture_initConfig(IfxScuEru_Capture_Config *config)
+{
+    config->reqPin        = NULL_PTR;
+    config->inputMode     = IfxPort_InputMode_pullUp;
+    config->risingEdge    = TRUE;
+    config->fallingEdge   = FALSE;
+    config->outputChannel = IfxScuEru_OutputChannel_0;
+    config->dmaChannelId  = IfxDma_ChannelId_0;
+    config->timestamp     = &MODULE_STM0.TIM0.U;
+    config->buffer        = NULL_PTR;
+    config->bufferSize    = 0;
+}
+
+
+uint16 IfxScuEru_Capture_read(IfxScuEru_Capture *capture, uint32 *timestamps, uint16 count)
+{
+    uint16 available = IfxScuEru_Capture_getCount(capture);
+    uint16 i;
+
+    if (count > available)
+    {
+        count = available;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        timestamps[i]      = capture->buffer[capture->readIndex];
+        capture->readIndex = (uint16)((capture->readIndex + 1) & (capture->bufferSize - 1));
+    }
+
+    return count;
+}
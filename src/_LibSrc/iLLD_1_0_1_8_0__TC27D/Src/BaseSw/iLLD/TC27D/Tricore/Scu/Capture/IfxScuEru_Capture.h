@@ -0,0 +1,161 @@
+/**
+ * \file IfxScuEru_Capture.h
+ * \brief SCU ERU CAPTURE details
+ * \ingroup IfxLld_Scu
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup IfxLld_Scu_Capture_Usage How to use the ERU capture driver?
+ * \ingroup IfxLld_Scu
+ *
+ * The ERU capture driver timestamps the edges of an external request pin without CPU load per edge:
+ * - the edge is detected by an ERU input channel (ETL) and routed through the connecting matrix to an output
+ * gating unit (OGU), which activates its interrupt output on each trigger.
+ * - the ERU service request node is routed to a DMA channel, which copies the value of a free running timer
+ * (STM, GTM TBU, ...) into a ring buffer at each edge.
+ * - the application reads the timestamps from the ring buffer, for example from a periodic task.
+ *
+ * The timestamp is taken by the DMA within its request latency after the edge, constant when the DMA channel has
+ * no concurrent request of higher priority. The ring buffer is a DMA circular buffer: its size is a power of 2
+ * (up to 8192 timestamps), it is aligned on its size in bytes and it is not in a data cached segment. The
+ * timestamps shall be read before the ring buffer is full, older timestamps are overwritten.
+ *
+ * The OGU x and x+4 share the ERU service request node x, only one of them can be used by a capture.
+ *
+ * \section IfxLld_Scu_Capture_Preparation Preparation
+ * \subsection IfxLld_Scu_Capture_Include Include Files
+ *
+ * Include following header file into your C code:
+ * \code
+ * #include <Scu/Capture/IfxScuEru_Capture.h>
+ * \endcode
+ *
+ * \subsection IfxLld_Scu_Capture_Init Initialisation
+ *
+ * Wheel speed input on REQ0 (P15.4), rising edges timestamped with STM0:
+ * \code
+ *     static uint32 wheelTimestamps[256] __attribute__ ((aligned(1024)));
+ *     static IfxScuEru_Capture wheelCapture;
+ *
+ *     IfxScuEru_Capture_Config config;
+ *     IfxScuEru_Capture_initConfig(&config);
+ *     config.reqPin        = &IfxScu_REQ0_P15_4_IN;
+ *     config.outputChannel = IfxScuEru_OutputChannel_0;
+ *     config.dmaChannelId  = IfxDma_ChannelId_12;
+ *     config.buffer        = wheelTimestamps;
+ *     config.bufferSize    = 256;
+ *     IfxScuEru_Capture_init(&wheelCapture, &config);
+ * \endcode
+ *
+ * \subsection IfxLld_Scu_Capture_Read Reading the Timestamps
+ *
+ * \code
+ *     uint32 timestamps[16];
+ *     uint16 count = IfxScuEru_Capture_read(&wheelCapture, timestamps, 16);
+ * \endcode
+ *
+ * \defgroup IfxLld_Scu_Capture Capture Driver
+ * \ingroup IfxLld_Scu
+ * \defgroup IfxLld_Scu_Capture_DataStructures Data Structures
+ * \ingroup IfxLld_Scu_Capture
+ * \defgroup IfxLld_Scu_Capture_ModuleFunctions Module Functions
+ * \ingroup IfxLld_Scu_Capture
+ */
+
+#ifndef IFXSCUERU_CAPTURE_H
+#define IFXSCUERU_CAPTURE_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "Scu/Std/IfxScuEru.h"
+#include "Dma/Dma/IfxDma_Dma.h"
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+
+/** \addtogroup IfxLld_Scu_Capture_DataStructures
+ * \{ */
+/** \brief Configuration of the capture
+ */
+typedef struct
+{
+    IFX_CONST IfxScu_Req_In     *reqPin;           /**< \brief external request pin */
+    IfxPort_InputMode            inputMode;        /**< \brief input mode of the pin */
+    boolean                      risingEdge;       /**< \brief TRUE to timestamp the rising edges */
+    boolean                      fallingEdge;      /**< \brief TRUE to timestamp the falling edges */
+    IfxScuEru_OutputChannel      outputChannel;    /**< \brief output gating unit triggered by the pin */
+    IfxDma_ChannelId             dmaChannelId;     /**< \brief DMA channel copying the timestamps */
+    const volatile unsigned int *timestamp;        /**< \brief free running timer register copied at each edge, unsigned access type of the SFR */
+    uint32                      *buffer;           /**< \brief ring buffer of the timestamps */
+    uint16                       bufferSize;       /**< \brief number of timestamps in the ring buffer, power of 2 */
+} IfxScuEru_Capture_Config;
+
+/** \brief Capture handle
+ */
+typedef struct
+{
+    IfxDma_Dma_Channel dmaChannel;      /**< \brief DMA channel copying the timestamps */
+    const uint32      *buffer;          /**< \brief ring buffer of the timestamps */
+    uint32             bufferAddress;   /**< \brief global address of the ring buffer, as seen by the DMA */
+    uint16             bufferSize;      /**< \brief number of timestamps in the ring buffer */
+    uint16             readIndex;       /**< \brief next timestamp to read */
+} IfxScuEru_Capture;
+
+/** \} */
+
+/** \addtogroup IfxLld_Scu_Capture_ModuleFunctions
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Returns the number of timestamps not read yet
+ * \param capture capture handle
+ * \return number of timestamps, at most bufferSize - 1
+ */
+IFX_EXTERN uint16 IfxScuEru_Capture_getCount(const IfxScuEru_Capture *capture);
+
+/** \brief Initialises the ERU path, the DMA channel and the service request node, the capture is started
+ * \param capture capture handle
+ * \param config configuration
+ * \return FALSE if the ring buffer size is not a power of 2 or the ring buffer is not aligned on its size
+ */
+IFX_EXTERN boolean IfxScuEru_Capture_init(IfxScuEru_Capture *capture, const IfxScuEru_Capture_Config *config);
+
+/** \brief Initialises the configuration: rising edges, input with pull-up, OGU0, DMA channel 0, STM0 timestamps
+ * \param config configuration
+ * \return None
+ */
+IFX_EXTERN void IfxScuEru_Capture_initConfig(IfxScuEru_Capture_Config *config);
+
+/** \brief Copies the oldest timestamps not read yet
+ * \param capture capture handle
+ * \param timestamps destination of the timestamps
+ * \param count maximum number of timestamps to copy
+ * \return number of copied timestamps
+ */
+IFX_EXTERN uint16 IfxScuEru_Capture_read(IfxScuEru_Capture *capture, uint32 *timestamps, uint16 count);
+
+/** \} */
+
+#endif /* IFXSCUERU_CAPTURE_H */
@@ -42,6 +42,24 @@
 /*-------------------------Function Implementations---------------------------*/
 /******************************************************************************/
 
+void IfxScuWdt_beginEndinitSession(IfxScuWdt_EndinitSession *session, IfxScuWdt_Endinit endinit)
+{
+    session->endinit = endinit;
+
+    if ((endinit & IfxScuWdt_Endinit_cpu) != 0)
+    {
+        session->cpuPassword = IfxScuWdt_getCpuWatchdogPassword();
+        IfxScuWdt_clearCpuEndinit(session->cpuPassword);
+    }
+
+    if ((endinit & IfxScuWdt_Endinit_safety) != 0)
+    {
+        session->safetyPassword = IfxScuWdt_getSafetyWatchdogPassword();
+        IfxScuWdt_clearSafetyEndinit(session->safetyPassword);
+    }
+}
+
+
 void IfxScuWdt_changeCpuWatchdogPassword(uint16 password, uint16 newPassword)
 {
     Ifx_SCU_WDTCPU     *watchdog = &MODULE_SCU.WDTCPU[IfxCpu_getCoreIndex()];
@@ -221,6 +239,20 @@ void IfxScuWdt_enableSafetyWatchdog(uint16 password)
 }
 
 
+void IfxScuWdt_endEndinitSession(IfxScuWdt_EndinitSession *session)
+{
+    if ((session->endinit & IfxScuWdt_Endinit_safety) != 0)
+    {
+        IfxScuWdt_setSafetyEndinit(session->safetyPassword);
+    }
+
+    if ((session->endinit & IfxScuWdt_Endinit_cpu) != 0)
+    {
+        IfxScuWdt_setCpuEndinit(session->cpuPassword);
+    }
+}
+
+
 uint16 IfxScuWdt_getCpuWatchdogPassword(void)
 {
     return IfxScuWdt_getCpuWatchdogPasswordInline(&MODULE_SCU.WDTCPU[IfxCpu_getCoreIndex()]);
@@ -386,6 +418,16 @@ void IfxScuWdt_initSafetyWatchdog(Ifx_SCU_WDTS *wdt, const IfxScuWdt_Config *con
 }
 
 
+void IfxScuWdt_runEndinitSession(IfxScuWdt_Endinit endinit, IfxScuWdt_EndinitCallback callback, void *data)
+{
+    IfxScuWdt_EndinitSession session;
+
+    IfxScuWdt_beginEndinitSession(&session, endinit);
+    callback(data);
+    IfxScuWdt_endEndinitSession(&session);
+}
+
+
 void IfxScuWdt_serviceCpuWatchdog(uint16 password)
 {
     IfxScuWdt_setCpuEndinit(password);
@@ -410,6 +452,29 @@ void IfxScuWdt_setSafetyEndinit(uint16 password)
 }
 
 
+void IfxScuWdt_writeEndinitTable(IfxScuWdt_Endinit endinit, const IfxScuWdt_EndinitWrite *table, uint32 count)
+{
+    IfxScuWdt_EndinitSession session;
+    uint32                   index;
+
+    IfxScuWdt_beginEndinitSession(&session, endinit);
+
+    for (index = 0; index < count; index++)
+    {
+        if (table[index].mask == 0xFFFFFFFFU)
+        {
+            *table[index].address = table[index].value;
+        }
+        else
+        {
+            *table[index].address = (*table[index].address & ~table[index].mask) | (table[index].value & table[index].mask);
+        }
+    }
+
+    IfxScuWdt_endEndinitSession(&session);
+}
+
+
 boolean IfxScuWdt_enableWatchdogWithDebugger(void)
 {
     boolean          status = 0, oenEnabled = 0, watchdogEnabled = 0;
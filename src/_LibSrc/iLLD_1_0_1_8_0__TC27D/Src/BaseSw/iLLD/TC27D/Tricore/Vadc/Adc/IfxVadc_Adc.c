@@ -154,6 +154,11 @@ void IfxVadc_Adc_getChannelConfig(IfxVadc_Adc_Channel *channel, IfxVadc_Adc_Chan
     config->synchonize          = tempChctr.B.SYNC;
     config->rightAlignedStorage = tempChctr.B.RESPOS;
 
+    config->dataModificationMode = IfxVadc_getDataModificationMode(vadcG, config->resultRegister);
+    config->dataReductionControl = IfxVadc_getDataReductionControl(vadcG, config->resultRegister);
+    config->waitForRead          = (vadcG->RCR[config->resultRegister].B.WFR != 0) ? TRUE : FALSE;
+    config->extendedBoundary     = (config->boundaryMode != IfxVadc_BoundaryExtension_standard) ? vadcG->RES[config->boundaryMode].B.RESULT : 0;
+
     config->backgroundChannel   = ((IfxVadc_getAssignedChannels(vadcG)).U & (1 << channelIndex)) ? FALSE : TRUE;
     uint32                 channelServiceRequestNodePtr;
     /* Get Channel index */
@@ -318,6 +323,9 @@ void IfxVadc_Adc_getGroupConfig(IfxVadc_Adc_Group *group, IfxVadc_Adc_GroupConfi
 
     config->master                 = IfxVadc_Adc_getMasterId(group->groupId, IfxVadc_getMasterIndex(vadcG));
 
+    config->boundary[0]            = vadcG->BOUND.B.BOUNDARY0;
+    config->boundary[1]            = vadcG->BOUND.B.BOUNDARY1;
+
     config->disablePostCalibration = ((IfxVadc_getGlobalConfigValue(vadc)).U >> (IFX_VADC_GLOBCFG_DPCAL0_OFF + group->groupId)) & 0x1;
 }
 
@@ -347,6 +355,19 @@ IfxVadc_Status IfxVadc_Adc_initChannel(IfxVadc_Adc_Channel *channel, const IfxVa
         IfxVadc_setResultPosition(vadcG, channelIndex, config->rightAlignedStorage);
         IfxVadc_setBackgroundResultTarget(vadcG, channelIndex, config->globalResultUsage);
         IfxVadc_setBoundaryMode(vadcG, channelIndex, config->boundaryMode);
+
+        if (config->globalResultUsage == FALSE)
+        {
+            IfxVadc_setDataReduction(vadcG, config->resultRegister, config->dataModificationMode, config->dataReductionControl);
+            IfxVadc_configureWaitForReadMode(vadcG, config->resultRegister, config->waitForRead);
+        }
+    }
+
+    if (config->boundaryMode != IfxVadc_BoundaryExtension_standard)
+    {
+        IfxVadc_enableAccess(vadc, IfxVadc_Protection_resultRegisterGroup0 + groupIndex);
+        IfxVadc_setExtendedBoundary(vadcG, (IfxVadc_ChannelResult)config->boundaryMode, config->extendedBoundary);
+        IfxVadc_disableAccess(vadc, IfxVadc_Protection_resultRegisterGroup0 + groupIndex);
     }
 
     IfxVadc_enableAccess(vadc, IfxVadc_Protection_initGroup0 + groupIndex);
@@ -414,25 +435,29 @@ IfxVadc_Status IfxVadc_Adc_initChannel(IfxVadc_Adc_Channel *channel, const IfxVa
 void IfxVadc_Adc_initChannelConfig(IfxVadc_Adc_ChannelConfig *config, const IfxVadc_Adc_Group *group)
 {
     static const IfxVadc_Adc_ChannelConfig IfxVadc_Adc_defaultChannelConfig = {
-        .channelId           = IfxVadc_ChannelId_0,
-        .group               = NULL_PTR,
-        .inputClass          = IfxVadc_InputClasses_group0,
-        .reference           = IfxVadc_ChannelReference_standard,
-        .resultRegister      = IfxVadc_ChannelResult_0,
-        .globalResultUsage   = FALSE,
-        .lowerBoundary       = IfxVadc_BoundarySelection_group0,
-        .upperBoundary       = IfxVadc_BoundarySelection_group0,
-        .boundaryMode        = IfxVadc_BoundaryExtension_standard,
-        .limitCheck          = IfxVadc_LimitCheck_noCheck,
-        .synchonize          = FALSE,
-        .backgroundChannel   = FALSE,
-        .rightAlignedStorage = FALSE,
-        .resultPriority      = 0,
-        .resultSrcNr         = IfxVadc_SrcNr_group0,
-        .resultServProvider  = IfxSrc_Tos_cpu0,
-        .channelPriority     = 0,
-        .channelSrcNr        = IfxVadc_SrcNr_group0,
-        .channelServProvider = IfxSrc_Tos_cpu0
+        .channelId            = IfxVadc_ChannelId_0,
+        .group                = NULL_PTR,
+        .inputClass           = IfxVadc_InputClasses_group0,
+        .reference            = IfxVadc_ChannelReference_standard,
+        .resultRegister       = IfxVadc_ChannelResult_0,
+        .globalResultUsage    = FALSE,
+        .lowerBoundary        = IfxVadc_BoundarySelection_group0,
+        .upperBoundary        = IfxVadc_BoundarySelection_group0,
+        .boundaryMode         = IfxVadc_BoundaryExtension_standard,
+        .extendedBoundary     = 0,
+        .limitCheck           = IfxVadc_LimitCheck_noCheck,
+        .dataModificationMode = IfxVadc_DataModificationMode_standardDataReduction,
+        .dataReductionControl = 0,
+        .waitForRead          = FALSE,
+        .synchonize           = FALSE,
+        .backgroundChannel    = FALSE,
+        .rightAlignedStorage  = FALSE,
+        .resultPriority       = 0,
+        .resultSrcNr          = IfxVadc_SrcNr_group0,
+        .resultServProvider   = IfxSrc_Tos_cpu0,
+        .channelPriority      = 0,
+        .channelSrcNr         = IfxVadc_SrcNr_group0,
+        .channelServProvider  = IfxSrc_Tos_cpu0
     };
     *config       = IfxVadc_Adc_defaultChannelConfig;
     config->group = group;
@@ -658,6 +683,10 @@ IfxVadc_Status IfxVadc_Adc_initGroup(IfxVadc_Adc_Group *group, const IfxVadc_Adc
 
     IfxVadc_disableAccess(vadc, IfxVadc_Protection_initGroup0 + groupIndex);
 
+    IfxVadc_enableAccess(vadc, IfxVadc_Protection_resultRegisterGroup0 + groupIndex);
+    IfxVadc_setGroupBoundaries(vadcG, config->boundary[0], config->boundary[1]);
+    IfxVadc_disableAccess(vadc, IfxVadc_Protection_resultRegisterGroup0 + groupIndex);
+
     return status;
 }
 
@@ -703,6 +732,7 @@ void IfxVadc_Adc_initGroupConfig(IfxVadc_Adc_GroupConfig *config, IfxVadc_Adc *v
         .inputClass[0].sampleTime = 1.0e-6,                           /* Set sample time to 1us */
         .inputClass[1].resolution = IfxVadc_ChannelResolution_12bit,
         .inputClass[1].sampleTime = 1.0e-6,                           /* Set sample time to 1us */
+        .boundary                 = {0, 0xFFF},
     };
 
     *config                        = IfxVadc_Adc_defaultGroupConfig;
@@ -717,17 +747,32 @@ IfxVadc_Status IfxVadc_Adc_initModule(IfxVadc_Adc *vadc, const IfxVadc_Adc_Confi
 {
     IfxVadc_Status status  = IfxVadc_Status_noError;
     Ifx_VADC      *vadcSFR = config->vadc;
-    vadc->vadc = vadcSFR;
+    vadc->vadc                    = vadcSFR;
+    vadc->calibrationCallback     = config->calibrationCallback;
+    vadc->calibrationCallbackData = config->calibrationCallbackData;
+    vadc->calibrationPending      = FALSE;
     float32        analogFrequency;
     uint8          inputClassNum, groupNum;
+    uint32         accessMask = 1U << IfxVadc_Protection_globalConfig;
 
     /* Enable VADC kernel clock */
     IfxVadc_enableModule(vadcSFR);
-    IfxVadc_selectPowerSupplyVoltage(vadcSFR, config->supplyVoltage);
 
-    /* Set Analog Frequency */
-    if (IfxVadc_initializeFAdcI(vadcSFR, config->analogFrequency) == 0)
+    /* The protections are opened and closed each in one safety ENDINIT session */
+    if (config->startupCalibration == TRUE)
+    {
+        for (groupNum = 0; groupNum < IFXVADC_NUM_ADC_GROUPS; groupNum++)
+        {
+            accessMask |= 1U << (IfxVadc_Protection_initGroup0 + groupNum);
+        }
+    }
+
+    IfxVadc_enableAccessMask(vadcSFR, accessMask, 0);
+
+    /* Set supply voltage, analog and digital Frequency */
+    if (IfxVadc_initializeGlobalConfig(vadcSFR, config->supplyVoltage, config->analogFrequency, config->digitalFrequency) == 0)
     {
+        IfxVadc_disableAccessMask(vadcSFR, accessMask, 0);
         return IfxVadc_Status_notInitialised;
     }
     else
@@ -735,8 +780,16 @@ IfxVadc_Status IfxVadc_Adc_initModule(IfxVadc_Adc *vadc, const IfxVadc_Adc_Confi
         /* do nothing */
     }
 
-    /* Set digital Frequency */
-    IfxVadc_initializeFAdcD(vadcSFR, config->digitalFrequency);
+    if (config->startupCalibration == TRUE)
+    {
+        /* Ensure that all groups are enabled */
+        for (groupNum = 0; groupNum < IFXVADC_NUM_ADC_GROUPS; groupNum++)
+        {
+            IfxVadc_setAnalogConvertControl(&vadcSFR->G[groupNum], IfxVadc_AnalogConverterMode_normalOperation);
+        }
+    }
+
+    IfxVadc_disableAccessMask(vadcSFR, accessMask, 0);
 
     analogFrequency = IfxVadc_getAdcAnalogFrequency(vadcSFR);
 
@@ -749,19 +802,18 @@ IfxVadc_Status IfxVadc_Adc_initModule(IfxVadc_Adc *vadc, const IfxVadc_Adc_Confi
         IfxVadc_setGlobalSampleTime(vadcSFR, inputClassNum, analogFrequency, config->globalInputClass[inputClassNum].sampleTime);
     }
 
+    IfxVadc_setGlobalBoundaries(vadcSFR, config->globalBoundary[0], config->globalBoundary[1]);
+
     /* Start up calibration is requested */
     if (config->startupCalibration == TRUE)
     {
-        /* Ensure that all groups are enabled */
-        for (groupNum = 0; groupNum < IFXVADC_NUM_ADC_GROUPS; groupNum++)
+        IfxVadc_Adc_startCalibration(vadc);
+
+        if (config->waitForCalibration == TRUE)
         {
-            IfxVadc_enableAccess(vadcSFR, IfxVadc_Protection_initGroup0 + groupNum);
-            IfxVadc_setAnalogConvertControl(&vadcSFR->G[groupNum], IfxVadc_AnalogConverterMode_normalOperation);
-            IfxVadc_disableAccess(vadcSFR, IfxVadc_Protection_initGroup0 + groupNum);
+            while (IfxVadc_Adc_isCalibrationDone(vadc) == FALSE)
+            {}
         }
-
-        // execute calibration
-        IfxVadc_startupCalibration(vadcSFR);
     }
 
     return status;
@@ -780,7 +832,41 @@ void IfxVadc_Adc_initModuleConfig(IfxVadc_Adc_Config *config, Ifx_VADC *vadc)
     config->globalInputClass[1].resolution = IfxVadc_ChannelResolution_12bit;
     config->globalInputClass[1].sampleTime = 1.0e-6;
     config->startupCalibration             = FALSE;
+    config->waitForCalibration             = TRUE;
+    config->calibrationCallback            = NULL_PTR;
+    config->calibrationCallbackData        = NULL_PTR;
     config->supplyVoltage                  = IfxVadc_LowSupplyVoltageSelect_5V;
+    config->globalBoundary[0]              = 0;
+    config->globalBoundary[1]              = 0xFFF;
+}
+
+
+boolean IfxVadc_Adc_isCalibrationDone(IfxVadc_Adc *vadc)
+{
+    boolean done = IfxVadc_isStartupCalibrationDone(vadc->vadc);
+
+    if ((done == TRUE) && (vadc->calibrationPending == TRUE))
+    {
+        /* The end is reported once, also if the function is called from several contexts */
+        boolean interruptState = IfxCpu_disableInterrupts();
+        boolean report         = vadc->calibrationPending;
+        vadc->calibrationPending = FALSE;
+        IfxCpu_restoreInterrupts(interruptState);
+
+        if ((report == TRUE) && (vadc->calibrationCallback != NULL_PTR))
+        {
+            vadc->calibrationCallback(vadc->calibrationCallbackData);
+        }
+    }
+
+    return done;
+}
+
+
+void IfxVadc_Adc_startCalibration(IfxVadc_Adc *vadc)
+{
+    vadc->calibrationPending = TRUE;
+    IfxVadc_triggerStartupCalibration(vadc->vadc);
 }
 
 
@@ -821,3 +907,561 @@ void IfxVadc_Adc_initExternalMultiplexerMode(Ifx_VADC *vadc, const IfxVadc_Adc_E
 
     IfxVadc_configExternalMultiplexerMode(vadc, vadcG, emuxControl->mode, emuxControl->channels, emuxControl->startChannel, emuxControl->code, emuxControl->sampleTimeControl, emuxControl->channelSelectionStyle);
 }
+
+
+IfxVadc_Status IfxVadc_Adc_initQueueSequence(IfxVadc_Adc_QueueSequence *sequence, const IfxVadc_Adc_QueueSequenceConfig *config)
+{
+    Ifx_VADC            *vadc         = config->group->module.vadc;
+    Ifx_VADC_G          *vadcG        = config->group->group;
+    IfxVadc_GroupId      groupIndex   = config->group->groupId;
+    IfxVadc_GatingMode   savedGate    = IfxVadc_getQueueSlotGatingMode(vadcG);
+    IfxVadc_GatingSource gatingSource = IfxVadc_getQueueSlotGatingSource(vadcG);
+    boolean              dmaFed       = (config->dma != NULL_PTR) ? TRUE : FALSE;
+    uint32               options      = 0;
+    uint32               loaded       = config->count;
+    uint32               entryIx;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->count > 0) && (config->count <= 16383));
+
+    if (dmaFed == FALSE)
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, config->count <= IFXVADC_ADC_QUEUE_DEPTH);
+        options = IFXVADC_QUEUE_REFILL;
+    }
+    else
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, config->dmaChannelId > IfxDma_ChannelId_0); /* priority 0 does not trigger the DMA */
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->preload > 0) && (config->preload <= IFXVADC_ADC_QUEUE_DEPTH));
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((uint32)config->linkedList & 0x1FU) == 0); /* transaction sets are read on a 256 bit boundary */
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, IfxCpu_isAddressCachable(config->linkedList) == FALSE); /* the DMA bypasses the data cache */
+
+        for (entryIx = 0; entryIx < config->count; entryIx++)
+        {
+            /* each conversion requests the next entry, a refilled entry would be queued twice */
+            IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->entries[entryIx] & (IFXVADC_QUEUE_SOURCE_INTERRUPT | IFXVADC_QUEUE_REFILL)) == IFXVADC_QUEUE_SOURCE_INTERRUPT);
+        }
+
+        loaded = __minu(config->preload, config->count);
+    }
+
+    sequence->group  = vadcG;
+    sequence->dmaFed = dmaFed;
+
+    /* no conversion while the queue is loaded, the entries could be converted out of order */
+    IfxVadc_setQueueSlotGatingConfig(vadcG, gatingSource, IfxVadc_GatingMode_disabled);
+    IfxVadc_clearQueue(vadcG, TRUE);
+
+    if (dmaFed != FALSE)
+    {
+        /* DMA channel: one entry per source event, restarted on the first entry by the linked list */
+        uint32                   coreId = IfxCpu_getCoreId();
+        uint32                   first  = loaded % config->count;
+        IfxDma_Dma_ChannelConfig dmaConfig;
+        IfxDma_Dma_initChannelConfig(&dmaConfig, config->dma);
+
+        dmaConfig.channelId                        = config->dmaChannelId;
+        dmaConfig.sourceAddress                    = IFXCPU_GLB_ADDR_DSPR(coreId, &config->entries[first]);
+        dmaConfig.destinationAddress               = (uint32)&vadcG->QINR0.U;
+        dmaConfig.destinationAddressCircularRange  = IfxDma_ChannelIncrementCircular_none;
+        dmaConfig.destinationCircularBufferEnabled = TRUE;
+        dmaConfig.shadowAddress                    = IFXCPU_GLB_ADDR_DSPR(coreId, config->linkedList);
+        dmaConfig.shadowControl                    = IfxDma_ChannelShadow_linkedList;
+        dmaConfig.transferCount                    = config->count - first;
+        dmaConfig.moveSize                         = IfxDma_ChannelMoveSize_32bit;
+        dmaConfig.blockMode                        = IfxDma_ChannelMove_1;
+        dmaConfig.requestMode                      = IfxDma_ChannelRequestMode_oneTransferPerRequest;
+        dmaConfig.operationMode                    = IfxDma_ChannelOperationMode_continuous;
+        dmaConfig.hardwareRequestEnabled           = TRUE;
+
+        IfxDma_Dma_initChannel(&sequence->dmaChannel, &dmaConfig);
+
+        dmaConfig.sourceAddress = IFXCPU_GLB_ADDR_DSPR(coreId, &config->entries[0]);
+        dmaConfig.transferCount = config->count;
+        IfxDma_Dma_initLinkedListEntry((void *)config->linkedList, &dmaConfig);
+
+        /* queue source event, serviced by the DMA channel */
+        IfxVadc_enableAccess(vadc, IfxVadc_Protection_serviceGroup0 + groupIndex);
+        IfxVadc_setQueueSourceEventNodePointer(vadcG, config->sourceSrcNr);
+        IfxVadc_clearQueueSourceEvent(vadcG);
+        IfxVadc_disableAccess(vadc, IfxVadc_Protection_serviceGroup0 + groupIndex);
+
+        {
+            volatile Ifx_SRC_SRCR *src = IfxVadc_getSrcAddress(groupIndex, config->sourceSrcNr);
+
+            IfxSrc_init(src, IfxSrc_Tos_dma, (Ifx_Priority)config->dmaChannelId);
+            IfxSrc_enable(src);
+        }
+    }
+
+    for (entryIx = 0; entryIx < loaded; entryIx++)
+    {
+        uint32 entry = config->entries[entryIx];
+
+        IfxVadc_addToQueue(vadcG, (IfxVadc_ChannelId)(entry & IFX_VADC_G_QINR0_REQCHNR_MSK), (entry & ~IFX_VADC_G_QINR0_REQCHNR_MSK) | options);
+    }
+
+    IfxVadc_setQueueSlotGatingConfig(vadcG, gatingSource, savedGate);
+
+    return IfxVadc_Status_noError;
+}
+
+
+void IfxVadc_Adc_initQueueSequenceConfig(IfxVadc_Adc_QueueSequenceConfig *config, const IfxVadc_Adc_Group *group)
+{
+    static const IfxVadc_Adc_QueueSequenceConfig IfxVadc_Adc_defaultQueueSequenceConfig = {
+        .group        = NULL_PTR,
+        .entries      = NULL_PTR,
+        .count        = 0,
+        .preload      = IFXVADC_ADC_QUEUE_DEPTH,
+        .sourceSrcNr  = IfxVadc_SrcNr_group1,
+        .dma          = NULL_PTR,
+        .dmaChannelId = IfxDma_ChannelId_none,
+        .linkedList   = NULL_PTR
+    };
+    *config       = IfxVadc_Adc_defaultQueueSequenceConfig;
+    config->group = group;
+}
+
+
+void IfxVadc_Adc_stopQueueSequence(IfxVadc_Adc_QueueSequence *sequence)
+{
+    if (sequence->dmaFed != FALSE)
+    {
+        IfxDma_disableChannelTransaction(sequence->dmaChannel.dma, sequence->dmaChannel.channelId);
+    }
+
+    IfxVadc_clearQueue(sequence->group, TRUE);
+}
+
+
+const Ifx_VADC_RES *IfxVadc_Adc_getStreamBlock(IfxVadc_Adc_Stream *stream)
+{
+    const Ifx_VADC_RES *block = NULL_PTR;
+    uint32              blockCount;
+
+    if (stream->polled != FALSE)
+    {
+        if (IfxDma_Dma_getAndClearChannelInterrupt(&stream->dmaChannel) != FALSE)
+        {
+            stream->blockCount++;
+        }
+    }
+
+    blockCount = stream->blockCount;
+
+    if (blockCount != stream->readCount)
+    {
+        /* only the last filled block is still valid, the older ones are being overwritten */
+        stream->overrunCount += blockCount - stream->readCount - 1;
+        stream->readCount     = blockCount;
+        block                 = &stream->buffer[((blockCount - 1) & 1) * stream->blockSize];
+    }
+
+    return block;
+}
+
+
+IfxVadc_Status IfxVadc_Adc_initStream(IfxVadc_Adc_Stream *stream, const IfxVadc_Adc_StreamConfig *config)
+{
+    Ifx_VADC                       *vadc          = config->group->module.vadc;
+    Ifx_VADC_G                     *vadcG         = config->group->group;
+    IfxVadc_GroupId                 groupIndex    = config->group->groupId;
+    uint32                          bufferSize    = 2 * config->blockSize * sizeof(Ifx_VADC_RES);
+    IfxDma_ChannelIncrementCircular circularRange = IfxDma_ChannelIncrementCircular_2;
+    uint32                          regIx;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, config->dmaChannelId > IfxDma_ChannelId_0); /* priority 0 does not trigger the DMA */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->blockSize > 0) && (config->blockSize <= 4096) && ((config->blockSize & (config->blockSize - 1)) == 0));
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((uint32)config->buffer & (bufferSize - 1)) == 0);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, IfxCpu_isAddressCachable(config->buffer) == FALSE); /* the DMA bypasses the data cache */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->fifoSize > 0) && ((config->outputRegister + config->fifoSize) <= (IfxVadc_ChannelResult_15 + 1)));
+
+    /* the double buffer is the circular range of the destination address */
+    while ((1UL << circularRange) < bufferSize)
+    {
+        circularRange++;
+    }
+
+    stream->buffer       = config->buffer;
+    stream->blockSize    = config->blockSize;
+    stream->polled       = (config->blockPriority == 0) ? TRUE : FALSE;
+    stream->blockCount   = 0;
+    stream->readCount    = 0;
+    stream->overrunCount = 0;
+
+    /* DMA channel: one result per request, blockSize results per transaction, restarted on the other half */
+    {
+        IfxDma_Dma_ChannelConfig dmaConfig;
+        IfxDma_Dma_initChannelConfig(&dmaConfig, config->dma);
+
+        dmaConfig.channelId                        = config->dmaChannelId;
+        dmaConfig.sourceAddress                    = (uint32)&vadcG->RES[config->outputRegister].U;
+        dmaConfig.sourceAddressCircularRange       = IfxDma_ChannelIncrementCircular_none;
+        dmaConfig.sourceCircularBufferEnabled      = TRUE;
+        dmaConfig.destinationAddress               = IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), config->buffer);
+        dmaConfig.destinationAddressCircularRange  = circularRange;
+        dmaConfig.destinationCircularBufferEnabled = TRUE;
+        dmaConfig.transferCount                    = config->blockSize;
+        dmaConfig.moveSize                         = IfxDma_ChannelMoveSize_32bit;
+        dmaConfig.blockMode                        = IfxDma_ChannelMove_1;
+        dmaConfig.requestMode                      = IfxDma_ChannelRequestMode_oneTransferPerRequest;
+        dmaConfig.operationMode                    = IfxDma_ChannelOperationMode_continuous;
+        dmaConfig.hardwareRequestEnabled           = TRUE;
+
+        /* block ready: transfer count reaches 0 */
+        dmaConfig.channelInterruptEnabled       = TRUE;
+        dmaConfig.channelInterruptControl       = IfxDma_ChannelInterruptControl_thresholdLimitMatch;
+        dmaConfig.interruptRaiseThreshold       = 0;
+        dmaConfig.channelInterruptPriority      = config->blockPriority;
+        dmaConfig.channelInterruptTypeOfService = config->blockServProvider;
+
+        IfxDma_Dma_initChannel(&stream->dmaChannel, &dmaConfig);
+        IfxDma_Dma_clearChannelInterrupt(&stream->dmaChannel);
+    }
+
+    IfxVadc_enableAccess(vadc, IfxVadc_Protection_channelControl0 + groupIndex);
+
+    /* FIFO: each stage above the output stage copies its result to the next lower register */
+    IfxVadc_enableFifoMode(vadcG, config->outputRegister, IfxVadc_FifoMode_seperateResultRegister);
+
+    for (regIx = 1; regIx < config->fifoSize; regIx++)
+    {
+        IfxVadc_enableFifoMode(vadcG, (IfxVadc_ChannelResult)(config->outputRegister + regIx), IfxVadc_FifoMode_fifoStructure);
+    }
+
+    /* result event of the output stage, serviced by the DMA channel */
+    if (config->outputRegister < IfxVadc_ChannelResult_8)
+    {
+        IfxVadc_setResultNodeEventPointer0(vadcG, config->resultSrcNr, config->outputRegister);
+    }
+    else
+    {
+        IfxVadc_setResultNodeEventPointer1(vadcG, config->resultSrcNr, config->outputRegister);
+    }
+
+    {
+        volatile Ifx_SRC_SRCR *src = IfxVadc_getSrcAddress(groupIndex, config->resultSrcNr);
+
+        IfxVadc_enableServiceRequest(vadcG, config->outputRegister);
+        IfxVadc_clearAllResultRequests(vadcG);
+        IfxSrc_init(src, IfxSrc_Tos_dma, (Ifx_Priority)config->dmaChannelId);
+        IfxSrc_enable(src);
+    }
+
+    IfxVadc_disableAccess(vadc, IfxVadc_Protection_channelControl0 + groupIndex);
+
+    return IfxVadc_Status_noError;
+}
+
+
+void IfxVadc_Adc_initStreamConfig(IfxVadc_Adc_StreamConfig *config, const IfxVadc_Adc_Group *group)
+{
+    static const IfxVadc_Adc_StreamConfig IfxVadc_Adc_defaultStreamConfig = {
+        .group             = NULL_PTR,
+        .outputRegister    = IfxVadc_ChannelResult_0,
+        .fifoSize          = 1,
+        .resultSrcNr       = IfxVadc_SrcNr_group0,
+        .dma               = NULL_PTR,
+        .dmaChannelId      = IfxDma_ChannelId_none,
+        .buffer            = NULL_PTR,
+        .blockSize         = 0,
+        .blockPriority     = 0,
+        .blockServProvider = IfxSrc_Tos_cpu0
+    };
+    *config       = IfxVadc_Adc_defaultStreamConfig;
+    config->group = group;
+}
+
+
+void IfxVadc_Adc_stopStream(IfxVadc_Adc_Stream *stream)
+{
+    IfxDma_disableChannelTransaction(stream->dmaChannel.dma, stream->dmaChannel.channelId);
+    IfxDma_Dma_clearChannelInterrupt(&stream->dmaChannel);
+}
+
+
+const Ifx_VADC_RES *IfxVadc_Adc_getSyncScanFrame(IfxVadc_Adc_SyncScan *syncScan)
+{
+    const Ifx_VADC_RES *frame = NULL_PTR;
+    uint32              frameCount;
+
+    if (syncScan->polled != FALSE)
+    {
+        volatile Ifx_SRC_SRCR *src = IfxDma_Dma_getSrcPointer(&syncScan->dmaChannel);
+
+        if (IfxSrc_isRequested(src) != FALSE)
+        {
+            IfxSrc_clearRequest(src);
+            syncScan->frameCount++;
+        }
+    }
+
+    frameCount = syncScan->frameCount;
+
+    if (frameCount != syncScan->readCount)
+    {
+        /* the frame is overwritten at each trigger, only the last one is still valid */
+        syncScan->overrunCount += frameCount - syncScan->readCount - 1;
+        syncScan->readCount     = frameCount;
+        frame                   = syncScan->buffer;
+    }
+
+    return frame;
+}
+
+
+IfxVadc_Status IfxVadc_Adc_initSyncScan(IfxVadc_Adc_SyncScan *syncScan, const IfxVadc_Adc_SyncScanConfig *config)
+{
+    Ifx_VADC       *vadc             = config->master->module.vadc;
+    Ifx_VADC_G     *masterG          = config->master->group;
+    IfxVadc_GroupId masterGroupIndex = config->master->groupId;
+    uint8           groupCount       = 1 + config->slaveCount;
+    uint8           groupIx;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, config->dmaChannelId > IfxDma_ChannelId_0); /* priority 0 does not trigger the DMA */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, config->slaveCount <= IFXVADC_ADC_SYNCSCAN_MAX_SLAVES);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->resultCount > 0) && (config->resultCount <= (IfxVadc_ChannelResult_15 + 1)));
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, config->lastResultRegister < config->resultCount);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, ((uint32)config->linkedList & 0x1FU) == 0); /* transaction sets are read on a 256 bit boundary */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, IfxCpu_isAddressCachable(config->linkedList) == FALSE); /* the DMA bypasses the data cache */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, IfxCpu_isAddressCachable(config->buffer) == FALSE);
+
+    syncScan->buffer       = config->buffer;
+    syncScan->groupCount   = groupCount;
+    syncScan->resultCount  = config->resultCount;
+    syncScan->polled       = (config->framePriority == 0) ? TRUE : FALSE;
+    syncScan->frameCount   = 0;
+    syncScan->readCount    = 0;
+    syncScan->overrunCount = 0;
+
+    /* the master starts a synchronized conversion when all slaves are ready */
+    IfxVadc_enableAccess(vadc, IfxVadc_Protection_initGroup0 + masterGroupIndex);
+
+    for (groupIx = 0; groupIx < config->slaveCount; groupIx++)
+    {
+        IfxVadc_GroupId slaveGroupIndex = config->slaves[groupIx]->groupId;
+
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, IfxVadc_Adc_getMasterId(slaveGroupIndex, IfxVadc_getMasterIndex(config->slaves[groupIx]->group)) == masterGroupIndex);
+        IfxVadc_enableReadyInputEvaluation(masterG, IfxVadc_Adc_getMasterKernelIndex(masterGroupIndex, slaveGroupIndex));
+    }
+
+    IfxVadc_disableAccess(vadc, IfxVadc_Protection_initGroup0 + masterGroupIndex);
+
+    /* DMA linked list: one transaction set per group, started by one request for a complete frame */
+    {
+        uint32                   coreId = IfxCpu_getCoreId();
+        IfxDma_Dma_ChannelConfig dmaConfig;
+        IfxDma_Dma_initChannelConfig(&dmaConfig, config->dma);
+
+        dmaConfig.channelId                     = config->dmaChannelId;
+        dmaConfig.transferCount                 = config->resultCount;
+        dmaConfig.moveSize                      = IfxDma_ChannelMoveSize_32bit;
+        dmaConfig.blockMode                     = IfxDma_ChannelMove_1;
+        dmaConfig.requestMode                   = IfxDma_ChannelRequestMode_completeTransactionPerRequest;
+        dmaConfig.operationMode                 = IfxDma_ChannelOperationMode_continuous;
+        dmaConfig.hardwareRequestEnabled        = TRUE;
+        dmaConfig.shadowControl                 = IfxDma_ChannelShadow_linkedList;
+        dmaConfig.channelInterruptPriority      = config->framePriority;
+        dmaConfig.channelInterruptTypeOfService = config->frameServProvider;
+
+        for (groupIx = 0; groupIx < groupCount; groupIx++)
+        {
+            const IfxVadc_Adc_Group *group = (groupIx == 0) ? config->master : config->slaves[groupIx - 1];
+
+            dmaConfig.sourceAddress      = (uint32)&group->group->RES[0].U;
+            dmaConfig.destinationAddress = IFXCPU_GLB_ADDR_DSPR(coreId, &config->buffer[groupIx * config->resultCount]);
+            dmaConfig.shadowAddress      = IFXCPU_GLB_ADDR_DSPR(coreId, &config->linkedList[(groupIx + 1) % groupCount]);
+
+            if (groupIx == 0)
+            {
+                IfxDma_Dma_initChannel(&syncScan->dmaChannel, &dmaConfig);
+            }
+
+            IfxDma_Dma_initLinkedListEntry((void *)&config->linkedList[groupIx], &dmaConfig);
+
+            if (groupIx == 0)
+            {
+                /* frame end: interrupt when the master set is loaded again, which then waits for the next request */
+                config->linkedList[groupIx].CHCSR.B.SIT = 1;
+            }
+            else
+            {
+                /* the slave sets start as soon as they are loaded */
+                config->linkedList[groupIx].CHCSR.B.SCH = 1;
+            }
+        }
+
+        IfxSrc_clearRequest(IfxDma_Dma_getSrcPointer(&syncScan->dmaChannel));
+    }
+
+    /* result event of the last conversion of the master scan, serviced by the DMA channel */
+    IfxVadc_enableAccess(vadc, IfxVadc_Protection_channelControl0 + masterGroupIndex);
+
+    if (config->lastResultRegister < IfxVadc_ChannelResult_8)
+    {
+        IfxVadc_setResultNodeEventPointer0(masterG, config->resultSrcNr, config->lastResultRegister);
+    }
+    else
+    {
+        IfxVadc_setResultNodeEventPointer1(masterG, config->resultSrcNr, config->lastResultRegister);
+    }
+
+    {
+        volatile Ifx_SRC_SRCR *src = IfxVadc_getSrcAddress(masterGroupIndex, config->resultSrcNr);
+
+        IfxVadc_enableServiceRequest(masterG, config->lastResultRegister);
+        IfxVadc_clearAllResultRequests(masterG);
+        IfxSrc_init(src, IfxSrc_Tos_dma, (Ifx_Priority)config->dmaChannelId);
+        IfxSrc_enable(src);
+    }
+
+    IfxVadc_disableAccess(vadc, IfxVadc_Protection_channelControl0 + masterGroupIndex);
+
+    return IfxVadc_Status_noError;
+}
+
+
+void IfxVadc_Adc_initSyncScanConfig(IfxVadc_Adc_SyncScanConfig *config, const IfxVadc_Adc_Group *master)
+{
+    static const IfxVadc_Adc_SyncScanConfig IfxVadc_Adc_defaultSyncScanConfig = {
+        .master             = NULL_PTR,
+        .slaves             = {NULL_PTR},
+        .slaveCount         = 0,
+        .resultCount        = 1,
+        .lastResultRegister = IfxVadc_ChannelResult_0,
+        .resultSrcNr        = IfxVadc_SrcNr_group0,
+        .dma                = NULL_PTR,
+        .dmaChannelId       = IfxDma_ChannelId_none,
+        .linkedList         = NULL_PTR,
+        .buffer             = NULL_PTR,
+        .framePriority      = 0,
+        .frameServProvider  = IfxSrc_Tos_cpu0
+    };
+    *config        = IfxVadc_Adc_defaultSyncScanConfig;
+    config->master = master;
+}
+
+
+void IfxVadc_Adc_stopSyncScan(IfxVadc_Adc_SyncScan *syncScan)
+{
+    IfxDma_disableChannelTransaction(syncScan->dmaChannel.dma, syncScan->dmaChannel.channelId);
+    IfxSrc_clearRequest(IfxDma_Dma_getSrcPointer(&syncScan->dmaChannel));
+}
+
+
+IfxVadc_Status IfxVadc_Adc_initLimitMonitor(IfxVadc_Adc_LimitMonitor *monitor, const IfxVadc_Adc_LimitMonitorConfig *config)
+{
+    Ifx_VADC              *vadc       = config->group->module.vadc;
+    Ifx_VADC_G            *vadcG      = config->group->group;
+    IfxVadc_GroupId        groupIndex = config->group->groupId;
+    volatile Ifx_SRC_SRCR *src        = IfxVadc_getSrcAddress(groupIndex, config->srcNr);
+    uint32                 channelIx;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (config->channelMask != 0) && ((config->channelMask & ~0xFFU) == 0)); /* channels 0..7 */
+
+    monitor->group        = vadcG;
+    monitor->channelMask  = config->channelMask;
+    monitor->callback     = config->callback;
+    monitor->callbackData = config->callbackData;
+    monitor->dmaAction    = (config->dma != NULL_PTR) ? TRUE : FALSE;
+    monitor->eventCount   = 0;
+
+    IfxSrc_disable(src);
+
+    if (monitor->dmaAction != FALSE)
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, config->dmaChannelId > IfxDma_ChannelId_0); /* priority 0 does not trigger the DMA */
+
+        /* DMA channel: one write of the action value per channel event */
+        IfxDma_Dma_ChannelConfig dmaConfig;
+        IfxDma_Dma_initChannelConfig(&dmaConfig, config->dma);
+
+        dmaConfig.channelId                        = config->dmaChannelId;
+        dmaConfig.sourceAddress                    = IFXCPU_GLB_ADDR_DSPR(IfxCpu_getCoreId(), config->actionValue);
+        dmaConfig.sourceAddressCircularRange       = IfxDma_ChannelIncrementCircular_none;
+        dmaConfig.sourceCircularBufferEnabled      = TRUE;
+        dmaConfig.destinationAddress               = config->actionAddress;
+        dmaConfig.destinationAddressCircularRange  = IfxDma_ChannelIncrementCircular_none;
+        dmaConfig.destinationCircularBufferEnabled = TRUE;
+        dmaConfig.transferCount                    = 1;
+        dmaConfig.moveSize                         = IfxDma_ChannelMoveSize_32bit;
+        dmaConfig.blockMode                        = IfxDma_ChannelMove_1;
+        dmaConfig.requestMode                      = IfxDma_ChannelRequestMode_oneTransferPerRequest;
+        dmaConfig.operationMode                    = IfxDma_ChannelOperationMode_continuous;
+        dmaConfig.hardwareRequestEnabled           = TRUE;
+
+        IfxDma_Dma_initChannel(&monitor->dmaChannel, &dmaConfig);
+    }
+
+    /* channel events of the monitored channels, serviced by the CPU or the DMA channel */
+    IfxVadc_enableAccess(vadc, IfxVadc_Protection_serviceGroup0 + groupIndex);
+
+    for (channelIx = 0; channelIx < 8; channelIx++)
+    {
+        if ((config->channelMask & (1U << channelIx)) != 0)
+        {
+            IfxVadc_setChannelEventNodePointer0(vadcG, config->srcNr, (IfxVadc_ChannelId)channelIx);
+        }
+    }
+
+    IfxVadc_clearChannelEventFlags(vadcG, config->channelMask);
+    IfxVadc_disableAccess(vadc, IfxVadc_Protection_serviceGroup0 + groupIndex);
+
+    if (monitor->dmaAction != FALSE)
+    {
+        IfxSrc_init(src, IfxSrc_Tos_dma, (Ifx_Priority)config->dmaChannelId);
+    }
+    else
+    {
+        IfxSrc_init(src, config->servProvider, config->priority);
+    }
+
+    IfxSrc_enable(src);
+
+    return IfxVadc_Status_noError;
+}
+
+
+void IfxVadc_Adc_initLimitMonitorConfig(IfxVadc_Adc_LimitMonitorConfig *config, const IfxVadc_Adc_Group *group)
+{
+    static const IfxVadc_Adc_LimitMonitorConfig IfxVadc_Adc_defaultLimitMonitorConfig = {
+        .group         = NULL_PTR,
+        .channelMask   = 0,
+        .srcNr         = IfxVadc_SrcNr_group2,
+        .priority      = 0,
+        .servProvider  = IfxSrc_Tos_cpu0,
+        .callback      = NULL_PTR,
+        .callbackData  = NULL_PTR,
+        .dma           = NULL_PTR,
+        .dmaChannelId  = IfxDma_ChannelId_none,
+        .actionAddress = 0,
+        .actionValue   = NULL_PTR
+    };
+    *config       = IfxVadc_Adc_defaultLimitMonitorConfig;
+    config->group = group;
+}
+
+
+void IfxVadc_Adc_isrLimitMonitor(IfxVadc_Adc_LimitMonitor *monitor)
+{
+    Ifx_VADC_G *vadcG = monitor->group;
+    uint32      flags = IfxVadc_getChannelEventFlags(vadcG) & monitor->channelMask;
+    uint32      channelIx;
+
+    IfxVadc_clearChannelEventFlags(vadcG, flags);
+
+    for (channelIx = 0; flags != 0; channelIx++, flags >>= 1)
+    {
+        if ((flags & 1U) != 0)
+        {
+            monitor->eventCount++;
+
+            if (monitor->callback != NULL_PTR)
+            {
+                uint32 resultIdx = IfxVadc_getChannelControlConfig(vadcG, (IfxVadc_ChannelId)channelIx).B.RESREG;
+
+                monitor->callback(monitor->callbackData, (IfxVadc_ChannelId)channelIx, IfxVadc_getDebugResult(vadcG, resultIdx));
+            }
+        }
+    }
+}
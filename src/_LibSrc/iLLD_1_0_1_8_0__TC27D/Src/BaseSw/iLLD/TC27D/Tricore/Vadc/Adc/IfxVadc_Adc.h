@@ -58,6 +58,25 @@
  *     IfxVadc_Adc_initModule(&vadc, &adcConfig);
  * \endcode
  *
+ * With startupCalibration, IfxVadc_Adc_initModule() waits for the end of the startup calibration. The calibration
+ * can instead run while the rest of the system is initialised: IfxVadc_Adc_initModule() then returns after the start
+ * of the calibration, the end is polled with IfxVadc_Adc_isCalibrationDone(), which calls calibrationCallback once.
+ * The groups can be initialised during the calibration, only the users of a group wait for its calibration:
+ * \code
+ *     adcConfig.startupCalibration  = TRUE;
+ *     adcConfig.waitForCalibration  = FALSE;
+ *     adcConfig.calibrationCallback = &adcCalibrated;   // optional, void adcCalibrated(void *data)
+ *     IfxVadc_Adc_initModule(&vadc, &adcConfig);
+ *
+ *     // ... initialisation of the groups and of the other modules ...
+ *
+ *     // before the first conversion of the group
+ *     IfxVadc_Adc_waitGroupCalibration(&adcGroup);
+ *
+ *     // background loop, until it returns TRUE
+ *     IfxVadc_Adc_isCalibrationDone(&vadc);
+ * \endcode
+ *
  *
  * \subsection IfxLld_Vadc_Adc_GroupInitialisation Group Initialisation
  * The group initialisation can be done in the same function:
@@ -147,6 +166,54 @@
  *     }
  * \endcode
  *
+ * \subsection IfxLld_Vadc_Adc_QueueSequence Event Triggered Queue Sequence
+ * A measurement sequence is a table of queue entries, each one a channel with its options:
+ * - IFXVADC_QUEUE_EXTERNAL_TRIGGER: the entry waits for the trigger event of the queue (e.g. a CAN message received,
+ *   a GTM angle), else it is converted as soon as the previous one is done
+ * - IFXVADC_QUEUE_REFILL: the entry is written back to the queue after its conversion
+ * - IFXVADC_QUEUE_SOURCE_INTERRUPT: the queue source event is raised at the end of its conversion
+ *
+ * The trigger and the gate of the queue are selected by IfxVadc_Adc_GroupConfig.queueRequest.triggerConfig.
+ *
+ * A sequence of up to IFXVADC_ADC_QUEUE_DEPTH entries is kept in the queue by the refill: it is loaded once and
+ * repeated by the hardware. A longer sequence is fed by a DMA channel: the entries have IFXVADC_QUEUE_SOURCE_INTERRUPT,
+ * each queue source event writes the next entry into the queue input, the sequence restarts from its first entry
+ * through one linked list transaction set.
+ * In both cases no CPU action is required per conversion.
+ *
+ * To read the results with a DMA (see \ref IfxLld_Vadc_Adc_Stream) without losing one when the conversions follow
+ * each other closely, the channels can use the wait-for-read mode of their result register
+ * (IfxVadc_Adc_ChannelConfig.waitForRead).
+ * \code
+ *     // queue conversions started by the trigger input 0 of the group
+ *     adcGroupConfig.arbiter.requestSlotQueueEnabled                = TRUE;
+ *     adcGroupConfig.queueRequest.triggerConfig.triggerSource      = IfxVadc_TriggerSource_0;
+ *     adcGroupConfig.queueRequest.triggerConfig.triggerMode        = IfxVadc_TriggerMode_uponRisingEdge;
+ *     adcGroupConfig.queueRequest.triggerConfig.gatingMode         = IfxVadc_GatingMode_always;
+ *     IfxVadc_Adc_initGroup(&adcGroup, &adcGroupConfig);
+ *
+ *     // 2 channels sampled at each trigger event, then 10 channels without trigger
+ *     static const uint32 sequence[12] = {
+ *         IFXVADC_QUEUE_ENTRY(IfxVadc_ChannelId_0, IFXVADC_QUEUE_EXTERNAL_TRIGGER | IFXVADC_QUEUE_SOURCE_INTERRUPT),
+ *         IFXVADC_QUEUE_ENTRY(IfxVadc_ChannelId_1, IFXVADC_QUEUE_SOURCE_INTERRUPT),
+ *         // ...
+ *     };
+ *     IFX_ALIGN(32) Ifx_DMA_CH sequenceLinkedList;     // not data cached
+ *     IfxVadc_Adc_QueueSequence queueSequence;
+ *
+ *     IfxVadc_Adc_QueueSequenceConfig sequenceConfig;
+ *     IfxVadc_Adc_initQueueSequenceConfig(&sequenceConfig, &adcGroup);
+ *
+ *     sequenceConfig.entries      = sequence;
+ *     sequenceConfig.count        = 12;
+ *     sequenceConfig.preload      = 4;                // entries kept ahead of the conversion
+ *     sequenceConfig.dma          = &dma;             // NULL_PTR: refill by the queue, up to IFXVADC_ADC_QUEUE_DEPTH entries
+ *     sequenceConfig.dmaChannelId = IfxDma_ChannelId_3;
+ *     sequenceConfig.linkedList   = &sequenceLinkedList;
+ *
+ *     IfxVadc_Adc_initQueueSequence(&queueSequence, &sequenceConfig);
+ * \endcode
+ *
  * \subsection IfxLld_Vadc_Adc_AutoScan Auto Scan
  * Autoscan of 5 channels
  * \code
@@ -307,6 +374,186 @@
  *
  * \endcode
  *
+ * \subsection IfxLld_Vadc_Adc_Stream DMA Result Stream
+ * For a continuous capture, a DMA channel moves each result of a group result register into a double buffer:
+ * no CPU read is required per conversion. When one half of the buffer (a block of blockSize results) is filled,
+ * the DMA channel raises the "block ready" interrupt and continues with the other half. Each result keeps the
+ * channel number (RES.CHNR), several channels can share the stream.
+ *
+ * The result register can be the output stage of a FIFO of fifoSize result registers, which absorbs the DMA latency:
+ * the channels store their results into the input stage outputRegister + fifoSize - 1.
+ * \code
+ *     // double buffer, 2 blocks of 256 results, aligned to its size
+ *     #define STREAM_BLOCK_SIZE 256
+ *     IFX_ALIGN(2 * STREAM_BLOCK_SIZE * 4) Ifx_VADC_RES streamBuffer[2 * STREAM_BLOCK_SIZE];
+ *     IfxVadc_Adc_Stream stream;
+ *     IfxDma_Dma dma;
+ *
+ *     IfxDma_Dma_createModuleHandle(&dma, &MODULE_DMA);
+ *
+ *     IfxVadc_Adc_StreamConfig streamConfig;
+ *     IfxVadc_Adc_initStreamConfig(&streamConfig, &adcGroup);
+ *
+ *     streamConfig.outputRegister    = IfxVadc_ChannelResult_0;   // read by the DMA
+ *     streamConfig.fifoSize          = 4;                         // RES0..RES3, the channels store into RES3
+ *     streamConfig.dma               = &dma;
+ *     streamConfig.dmaChannelId      = IfxDma_ChannelId_1;
+ *     streamConfig.buffer            = streamBuffer;
+ *     streamConfig.blockSize         = STREAM_BLOCK_SIZE;
+ *     streamConfig.blockPriority     = ISR_PRIORITY_ADC_STREAM;   // 0: block end polled by IfxVadc_Adc_getStreamBlock()
+ *     streamConfig.blockServProvider = IfxSrc_Tos_cpu0;
+ *
+ *     IfxVadc_Adc_initStream(&stream, &streamConfig);
+ *
+ *     // block ready interrupt
+ *     IFX_INTERRUPT(adcStreamISR, 0, ISR_PRIORITY_ADC_STREAM)
+ *     {
+ *         IfxVadc_Adc_isrStream(&stream);
+ *     }
+ *
+ *     // background loop: process the last filled block before the DMA fills it again
+ *     const Ifx_VADC_RES *block = IfxVadc_Adc_getStreamBlock(&stream);
+ *     if (block != NULL_PTR)
+ *     {
+ *         for (i = 0; i < STREAM_BLOCK_SIZE; i++)
+ *         {
+ *             process(block[i].B.CHNR, block[i].B.RESULT);
+ *         }
+ *     }
+ * \endcode
+ *
+ * \subsection IfxLld_Vadc_Adc_SyncScan Synchronized Scan with DMA
+ * Up to 4 groups of the same synchronization cluster (on TC27x: G0..G3) sample at the same instant: the scan
+ * request source of the master group is started by a hardware trigger, e.g. a GTM TOM/ATOM channel at each PWM
+ * period, and each of its channels with the synchronize flag starts the conversion of the channel with the same
+ * number in all slave groups. The slave groups have no request source, their converter is controlled by the master.
+ *
+ * Each group stores its channels into the result registers 0..resultCount-1. At the end of the scan, the result event
+ * of the master result register written last starts a DMA linked list, one transaction per group, which copies all
+ * results into one frame: frame[g * resultCount + r] is the result register r of the group g (0: master).
+ * The CPU is interrupted once per frame, or polls the frame.
+ *
+ * The slave groups must be initialised before the master group:
+ * \code
+ *     #define SYNC_RESULTS 2
+ *     IfxVadc_Adc_Group     adcGroup[3];              // [0]: master G0, [1..2]: slaves G1, G2
+ *     IFX_ALIGN(32) Ifx_DMA_CH syncLinkedList[3];     // one transaction set per group, aligned to 256 bit
+ *     Ifx_VADC_RES          syncFrame[3 * SYNC_RESULTS];
+ *     IfxVadc_Adc_SyncScan  syncScan;
+ *
+ *     for (g = 2; g >= 0; g--)   // slaves first
+ *     {
+ *         IfxVadc_Adc_initGroupConfig(&adcGroupConfig, &vadc);
+ *         adcGroupConfig.groupId = (IfxVadc_GroupId)g;
+ *         adcGroupConfig.master  = IfxVadc_GroupId_0;
+ *
+ *         if (g == 0)
+ *         {
+ *             // scan started at each rising edge of the REQTR input connected to the GTM ADC0 trigger 0
+ *             adcGroupConfig.arbiter.requestSlotScanEnabled          = TRUE;
+ *             adcGroupConfig.scanRequest.autoscanEnabled             = FALSE;
+ *             adcGroupConfig.scanRequest.triggerConfig.triggerMode   = IfxVadc_TriggerMode_uponRisingEdge;
+ *             adcGroupConfig.scanRequest.triggerConfig.triggerSource = IfxVadc_TriggerSource_2;
+ *             adcGroupConfig.scanRequest.triggerConfig.gatingMode    = IfxVadc_GatingMode_always;
+ *         }
+ *
+ *         IfxVadc_Adc_initGroup(&adcGroup[g], &adcGroupConfig);
+ *
+ *         for (r = 0; r < SYNC_RESULTS; r++)
+ *         {
+ *             IfxVadc_Adc_initChannelConfig(&adcChannelConfig, &adcGroup[g]);
+ *             adcChannelConfig.channelId      = (IfxVadc_ChannelId)r;
+ *             adcChannelConfig.resultRegister = (IfxVadc_ChannelResult)r;
+ *             adcChannelConfig.synchonize     = (g == 0) ? TRUE : FALSE;
+ *             IfxVadc_Adc_initChannel(&adcChannel[g][r], &adcChannelConfig);
+ *         }
+ *     }
+ *
+ *     IfxVadc_Adc_setScan(&adcGroup[0], 0x3, 0x3);
+ *
+ *     IfxVadc_Adc_SyncScanConfig syncConfig;
+ *     IfxVadc_Adc_initSyncScanConfig(&syncConfig, &adcGroup[0]);
+ *
+ *     syncConfig.slaves[0]           = &adcGroup[1];
+ *     syncConfig.slaves[1]           = &adcGroup[2];
+ *     syncConfig.slaveCount          = 2;
+ *     syncConfig.resultCount         = SYNC_RESULTS;
+ *     syncConfig.lastResultRegister  = IfxVadc_ChannelResult_0;  // the scan converts the highest channel first
+ *     syncConfig.dma                 = &dma;
+ *     syncConfig.dmaChannelId        = IfxDma_ChannelId_2;
+ *     syncConfig.linkedList          = syncLinkedList;
+ *     syncConfig.buffer              = syncFrame;
+ *     syncConfig.framePriority       = ISR_PRIORITY_ADC_FRAME;   // 0: frame polled by IfxVadc_Adc_getSyncScanFrame()
+ *     syncConfig.frameServProvider   = IfxSrc_Tos_cpu0;
+ *
+ *     IfxVadc_Adc_initSyncScan(&syncScan, &syncConfig);
+ *
+ *     // route the PWM of TOM0 channel 7 to the group 0 trigger 0
+ *     IfxGtm_Trig_toVadc(&MODULE_GTM, IfxGtm_Trig_AdcGroup_0, IfxGtm_Trig_AdcTrig_0, IfxGtm_Trig_AdcTrigSource_tom0, IfxGtm_Trig_AdcTrigChannel_7);
+ *
+ *     // frame interrupt
+ *     IFX_INTERRUPT(adcFrameISR, 0, ISR_PRIORITY_ADC_FRAME)
+ *     {
+ *         IfxVadc_Adc_isrSyncScan(&syncScan);
+ *     }
+ *
+ *     // background loop: the frame is valid until the next trigger
+ *     const Ifx_VADC_RES *frame = IfxVadc_Adc_getSyncScanFrame(&syncScan);
+ * \endcode
+ *
+ * \subsection IfxLld_Vadc_Adc_StaticChannel Static Channel
+ *
+ * In a time critical loop, the result register of a channel can be described by a constant
+ * \ref IfxVadc_Adc_StaticChannel instead of the \ref IfxVadc_Adc_Channel handle in RAM. For a const object visible
+ * in the translation unit, \ref IfxVadc_Adc_getResultStatic() reads the result register at an address folded at
+ * compile time, without loading the group pointers of the handle. The channel is still initialised with
+ * \ref IfxVadc_Adc_initChannel(), the static channel must use the same group and result register.
+ *
+ * \code
+ *     static IFX_CONST IfxVadc_Adc_StaticChannel phaseCurrentU = IFXVADC_ADC_STATIC_CHANNEL(IfxVadc_GroupId_0, IfxVadc_ChannelResult_1);
+ *
+ *     Ifx_VADC_RES result = IfxVadc_Adc_getResultStatic(&phaseCurrentU);
+ * \endcode
+ *
+ * \subsection IfxLld_Vadc_Adc_LimitMonitor Limit Check Monitor
+ *
+ * Each result of a channel can be compared by the hardware against a lower and an upper boundary: the channel
+ * event is raised only when the result is in or out of the band (IfxVadc_Adc_ChannelConfig.limitCheck). The
+ * boundaries are selected per channel from the group boundaries (IfxVadc_Adc_GroupConfig.boundary), the global
+ * boundaries (IfxVadc_Adc_Config.globalBoundary), or a value held in a result register
+ * (IfxVadc_Adc_ChannelConfig.boundaryMode and extendedBoundary).
+ *
+ * A limit monitor services the channel events of several channels of a group:
+ * - with a callback, called by IfxVadc_Adc_isrLimitMonitor() for each channel with an event: only out of range
+ *   results reach the CPU
+ * - with a DMA action: each event makes a DMA channel write a value into a register, e.g. disable the outputs
+ *   of a GTM TOM for a hardware shutdown, without CPU latency
+ * \code
+ *     // overcurrent above 3500 on channels 2 and 3 of the group: boundary 1 as upper boundary
+ *     adcGroupConfig.boundary[0] = 0;
+ *     adcGroupConfig.boundary[1] = 3500;
+ *
+ *     adcChannelConfig.lowerBoundary = IfxVadc_BoundarySelection_group0;
+ *     adcChannelConfig.upperBoundary = IfxVadc_BoundarySelection_group1;
+ *     adcChannelConfig.limitCheck    = IfxVadc_LimitCheck_eventIfOutsideArea;
+ *
+ *     // disable the outputs 0..7 of TOM0 immediately
+ *     static const uint32 tomOff = 0x5555;
+ *     IfxVadc_Adc_LimitMonitor overcurrent;
+ *
+ *     IfxVadc_Adc_LimitMonitorConfig monitorConfig;
+ *     IfxVadc_Adc_initLimitMonitorConfig(&monitorConfig, &adcGroup);
+ *
+ *     monitorConfig.channelMask   = (1 << 2) | (1 << 3);
+ *     monitorConfig.srcNr         = IfxVadc_SrcNr_group2;
+ *     monitorConfig.dma           = &dma;     // NULL_PTR: interrupt with the priority monitorConfig.priority
+ *     monitorConfig.dmaChannelId  = IfxDma_ChannelId_7;
+ *     monitorConfig.actionAddress = (uint32)&GTM_TOM0_TGC0_OUTEN_STAT;
+ *     monitorConfig.actionValue   = &tomOff;
+ *
+ *     IfxVadc_Adc_initLimitMonitor(&overcurrent, &monitorConfig);
+ * \endcode
+ *
  * \defgroup IfxLld_Vadc_Adc Interface Driver
  * \ingroup IfxLld_Vadc
  * \defgroup IfxLld_Vadc_Adc_DataStructures Data Structures
@@ -331,6 +578,12 @@
  * \ingroup IfxLld_Vadc_Adc
  * \defgroup IfxLld_Vadc_Adc_Emux Emux Functions
  * \ingroup IfxLld_Vadc_Adc
+ * \defgroup IfxLld_Vadc_Adc_Stream DMA Result Stream Functions
+ * \ingroup IfxLld_Vadc_Adc
+ * \defgroup IfxLld_Vadc_Adc_SyncScan Synchronized Scan Functions
+ * \ingroup IfxLld_Vadc_Adc
+ * \defgroup IfxLld_Vadc_Adc_LimitMonitor Limit Check Monitor Functions
+ * \ingroup IfxLld_Vadc_Adc
  */
 
 #ifndef IFXVADC_ADC_H
@@ -341,14 +594,55 @@
 /******************************************************************************/
 
 #include "Vadc/Std/IfxVadc.h"
+#include "Dma/Dma/IfxDma_Dma.h"
 #include "_Utilities/Ifx_Assert.h"
 
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Maximal number of slave groups of a synchronized scan: one synchronization cluster has 4 groups
+ */
+#define IFXVADC_ADC_SYNCSCAN_MAX_SLAVES (3)
+
+/** \brief Initializer of a constant \ref IfxVadc_Adc_StaticChannel of the module VADC
+ */
+#define IFXVADC_ADC_STATIC_CHANNEL(groupId, resultReg) {&MODULE_VADC.G[(groupId)], (resultReg)}
+
+/** \brief Number of entries of the queue request source: the queue stages, the backup stage excluded
+ */
+#define IFXVADC_ADC_QUEUE_DEPTH (8)
+
+/** \brief Queue entry option: the queue source event is raised at the end of the conversion
+ */
+#define IFXVADC_QUEUE_SOURCE_INTERRUPT (1U << IFX_VADC_G_QINR0_ENSI_OFF)
+
+/** \brief Queue entry option: the conversion waits for the trigger event of the queue
+ */
+#define IFXVADC_QUEUE_EXTERNAL_TRIGGER (1U << IFX_VADC_G_QINR0_EXTR_OFF)
+
+/** \brief Queue entry of a sequence, see \ref IfxVadc_Adc_QueueSequenceConfig
+ */
+#define IFXVADC_QUEUE_ENTRY(channelId, options) ((uint32)(channelId) | (uint32)(options))
+
 /******************************************************************************/
 /*------------------------------Type Definitions------------------------------*/
 /******************************************************************************/
 
 typedef uint8 IfxVadc_Adc_SYNCTR_STSEL;
 
+/** \brief Limit check event callback, see \ref IfxVadc_Adc_isrLimitMonitor()
+ * \param data callbackData of the monitor
+ * \param channel channel with the event
+ * \param result result of the channel, read without clearing its valid flag
+ */
+typedef void (*IfxVadc_Adc_LimitCallback)(void *data, IfxVadc_ChannelId channel, Ifx_VADC_RESD result);
+
+/** \brief Startup calibration end callback, see \ref IfxVadc_Adc_isCalibrationDone()
+ * \param data calibrationCallbackData of the module configuration
+ */
+typedef void (*IfxVadc_Adc_CalibrationCallback)(void *data);
+
 /******************************************************************************/
 /*-----------------------------Data Structures--------------------------------*/
 /******************************************************************************/
@@ -359,7 +653,10 @@ typedef uint8 IfxVadc_Adc_SYNCTR_STSEL;
  */
 typedef struct
 {
-    Ifx_VADC *vadc;       /**< \brief Specifies the pointer to the VADC module registers */
+    Ifx_VADC                       *vadc;                       /**< \brief Specifies the pointer to the VADC module registers */
+    IfxVadc_Adc_CalibrationCallback calibrationCallback;        /**< \brief Called once at the end of the startup calibration, or NULL_PTR */
+    void                           *calibrationCallbackData;    /**< \brief Parameter of calibrationCallback */
+    volatile boolean                calibrationPending;         /**< \brief TRUE from the start of the startup calibration until its end is reported */
 } IfxVadc_Adc;
 
 /** \brief Gating/Trigger configuration structure
@@ -453,6 +750,14 @@ typedef struct
     IFX_CONST IfxVadc_Adc_Group *group;           /**< \brief Specifies the group of the channel */
 } IfxVadc_Adc_Channel;
 
+/** \brief Constant description of the result register of a channel, see \ref IfxLld_Vadc_Adc_StaticChannel
+ */
+typedef struct
+{
+    Ifx_VADC_G           *group;           /**< \brief Group registers of the channel */
+    IfxVadc_ChannelResult resultreg;       /**< \brief Result register allocated to the channel */
+} IfxVadc_Adc_StaticChannel;
+
 /** \brief Channel configuration structure
  */
 typedef struct
@@ -474,7 +779,11 @@ typedef struct
     IfxVadc_BoundarySelection    lowerBoundary;             /**< \brief Specifies lower boundary selection */
     IfxVadc_BoundarySelection    upperBoundary;             /**< \brief Specifies upper boundary selection */
     IfxVadc_BoundaryExtension    boundaryMode;              /**< \brief Specifies Standard mode of fast compare mode */
+    uint16                       extendedBoundary;          /**< \brief Boundary value written into the result register selected by boundaryMode, if boundaryMode is not standard */
     IfxVadc_LimitCheck           limitCheck;                /**< \brief Specifies boundary band selection upper/lower */
+    IfxVadc_DataModificationMode dataModificationMode;      /**< \brief Specifies the data modification mode of the group result register. The result register must not be shared with other channels */
+    uint8                        dataReductionControl;      /**< \brief Specifies the data reduction control, see IfxVadc_setDataReduction(). standardDataReduction: the result is the sum of (dataReductionControl + 1) conversions */
+    boolean                      waitForRead;               /**< \brief Specifies the wait-for-read mode of the group result register: a conversion is held until the previous result is read, e.g. by a DMA */
     IFX_CONST IfxVadc_Adc_Group *group;                     /**< \brief Specifies pointer to the IfxVadc_Adc_Group group handle */
 } IfxVadc_Adc_ChannelConfig;
 
@@ -489,8 +798,12 @@ typedef struct
     float32                 moduleFrequency;                                                /**< \brief module Frequency in Hz. */
     boolean                 startupCalibration;                                             /**< \brief Can be enabled to execute a startup calibration (disabled by default).
                                                                                              * Note that this option will also enable all converter groups.
-                                                                                             * If this isn't desired, don't use this option, but execute IfxVadc_Adc_startupCalibration() after all ADC groups have been initialized. */
+                                                                                             * If this isn't desired, don't use this option, but execute IfxVadc_Adc_startCalibration() after all ADC groups have been initialized. */
+    boolean                 waitForCalibration;                                             /**< \brief If TRUE (default), IfxVadc_Adc_initModule() waits for the end of the startup calibration. If FALSE, it returns while the calibration runs, see IfxVadc_Adc_isCalibrationDone() */
+    IfxVadc_Adc_CalibrationCallback calibrationCallback;                                    /**< \brief Called once at the end of the startup calibration, or NULL_PTR */
+    void                   *calibrationCallbackData;                                        /**< \brief Parameter of calibrationCallback */
     IfxVadc_LowSupplyVoltageSelect supplyVoltage;                                           /**< \brief Select Low Power Supply Voltage */
+    uint16                  globalBoundary[2];                                              /**< \brief Global boundary values 0 and 1 for limit checking, 12-bit */
 } IfxVadc_Adc_Config;
 
 /** \brief Emux Control Structure
@@ -523,8 +836,123 @@ typedef struct
     IfxVadc_Adc_BackgroundScanConfig backgroundScanRequest;                      /**< \brief Specifies back ground scan configuration */
     boolean                          disablePostCalibration;                     /**< \brief Specifies if calibration after conversion (post calibration) should be disabled */
     IfxVadc_Adc_ArbiterConfig        arbiter;                                    /**< \brief Arbiter configuration structure. */
+    uint16                           boundary[2];                                /**< \brief Group boundary values 0 and 1 for limit checking, 12-bit */
 } IfxVadc_Adc_GroupConfig;
 
+/** \brief Queue sequence handle
+ */
+typedef struct
+{
+    IfxDma_Dma_Channel dmaChannel;       /**< \brief DMA channel writing the entries into the queue input */
+    Ifx_VADC_G        *group;            /**< \brief Group registers of the queue */
+    boolean            dmaFed;           /**< \brief TRUE if the entries are written by the DMA, FALSE if they are refilled by the queue */
+} IfxVadc_Adc_QueueSequence;
+
+/** \brief Queue sequence configuration structure
+ */
+typedef struct
+{
+    IFX_CONST IfxVadc_Adc_Group *group;               /**< \brief Specifies pointer to the IfxVadc_Adc_Group group handle, with the queue request slot enabled */
+    const uint32                *entries;             /**< \brief Queue entries, see IFXVADC_QUEUE_ENTRY(). With a DMA: with IFXVADC_QUEUE_SOURCE_INTERRUPT, without IFXVADC_QUEUE_REFILL, located in the flash or not data cached */
+    uint16                       count;               /**< \brief Number of entries. Without DMA: max IFXVADC_ADC_QUEUE_DEPTH */
+    uint8                        preload;             /**< \brief Number of entries kept in the queue ahead of the conversion: 1 .. IFXVADC_ADC_QUEUE_DEPTH. Ignored without DMA */
+    IfxVadc_SrcNr                sourceSrcNr;         /**< \brief Service node of the queue source event, routed to the DMA */
+    IfxDma_Dma                  *dma;                 /**< \brief Specifies pointer to the IfxDma_Dma module handle. NULL_PTR: the entries are refilled by the queue */
+    IfxDma_ChannelId             dmaChannelId;        /**< \brief DMA channel, also the priority of the source event service request. Must not be 0 */
+    Ifx_DMA_CH                  *linkedList;          /**< \brief Transaction set restarting the sequence, aligned to 256 bit, not data cached */
+} IfxVadc_Adc_QueueSequenceConfig;
+
+/** \brief DMA result stream handle
+ */
+typedef struct
+{
+    IfxDma_Dma_Channel dmaChannel;         /**< \brief DMA channel moving the results */
+    Ifx_VADC_RES      *buffer;             /**< \brief Double buffer of 2 * blockSize results */
+    uint16             blockSize;          /**< \brief Number of results per block */
+    boolean            polled;             /**< \brief TRUE if the block end is polled by IfxVadc_Adc_getStreamBlock() */
+    volatile uint32    blockCount;         /**< \brief Number of blocks filled since the stream initialisation */
+    uint32             readCount;          /**< \brief Number of blocks returned or skipped by IfxVadc_Adc_getStreamBlock() */
+    uint32             overrunCount;       /**< \brief Number of blocks overwritten before they were read */
+} IfxVadc_Adc_Stream;
+
+/** \brief DMA result stream configuration structure
+ */
+typedef struct
+{
+    IFX_CONST IfxVadc_Adc_Group *group;                 /**< \brief Specifies pointer to the IfxVadc_Adc_Group group handle */
+    IfxVadc_ChannelResult        outputRegister;        /**< \brief Result register read by the DMA (output stage of the FIFO) */
+    uint8                        fifoSize;              /**< \brief Number of result registers of the FIFO, from outputRegister upwards. 1: no FIFO */
+    IfxVadc_SrcNr                resultSrcNr;           /**< \brief Service node of the result event, routed to the DMA */
+    IfxDma_Dma                  *dma;                   /**< \brief Specifies pointer to the IfxDma_Dma module handle */
+    IfxDma_ChannelId             dmaChannelId;          /**< \brief DMA channel, also the priority of the result service request. Must not be 0 */
+    Ifx_VADC_RES                *buffer;                /**< \brief Double buffer of 2 * blockSize results, aligned to its size in bytes */
+    uint16                       blockSize;             /**< \brief Number of results per block: power of 2, max 4096 */
+    Ifx_Priority                 blockPriority;         /**< \brief Interrupt priority of the block ready interrupt, if 0 the block end is polled by IfxVadc_Adc_getStreamBlock() */
+    IfxSrc_Tos                   blockServProvider;     /**< \brief Interrupt service provider for the block ready interrupt */
+} IfxVadc_Adc_StreamConfig;
+
+/** \brief Synchronized scan handle
+ */
+typedef struct
+{
+    IfxDma_Dma_Channel dmaChannel;         /**< \brief DMA channel copying the results */
+    Ifx_VADC_RES      *buffer;             /**< \brief Frame of groupCount * resultCount results */
+    uint8              groupCount;         /**< \brief Number of synchronized groups, master included */
+    uint8              resultCount;        /**< \brief Number of results per group */
+    boolean            polled;             /**< \brief TRUE if the frame end is polled by IfxVadc_Adc_getSyncScanFrame() */
+    volatile uint32    frameCount;         /**< \brief Number of frames copied since the initialisation */
+    uint32             readCount;          /**< \brief Number of frames returned or skipped by IfxVadc_Adc_getSyncScanFrame() */
+    uint32             overrunCount;       /**< \brief Number of frames overwritten before they were read */
+} IfxVadc_Adc_SyncScan;
+
+/** \brief Synchronized scan configuration structure
+ */
+typedef struct
+{
+    IFX_CONST IfxVadc_Adc_Group *master;                                    /**< \brief Master group, its scan request source is started by the hardware trigger */
+    IFX_CONST IfxVadc_Adc_Group *slaves[IFXVADC_ADC_SYNCSCAN_MAX_SLAVES];   /**< \brief Slave groups, initialised with master as master group */
+    uint8                        slaveCount;                                /**< \brief Number of slave groups */
+    uint8                        resultCount;                               /**< \brief Number of results per group, read from the result registers 0..resultCount-1 */
+    IfxVadc_ChannelResult        lastResultRegister;                        /**< \brief Master result register written by the last conversion of the scan, its event starts the DMA */
+    IfxVadc_SrcNr                resultSrcNr;                               /**< \brief Master service node of the result event, routed to the DMA */
+    IfxDma_Dma                  *dma;                                       /**< \brief Specifies pointer to the IfxDma_Dma module handle */
+    IfxDma_ChannelId             dmaChannelId;                              /**< \brief DMA channel, also the priority of the result service request. Must not be 0 */
+    Ifx_DMA_CH                  *linkedList;                                /**< \brief 1 + slaveCount transaction sets, aligned to 256 bit, located in the DSPR */
+    Ifx_VADC_RES                *buffer;                                    /**< \brief Frame of (1 + slaveCount) * resultCount results, located in the DSPR */
+    Ifx_Priority                 framePriority;                             /**< \brief Interrupt priority of the frame interrupt, if 0 the frame end is polled by IfxVadc_Adc_getSyncScanFrame() */
+    IfxSrc_Tos                   frameServProvider;                         /**< \brief Interrupt service provider for the frame interrupt */
+} IfxVadc_Adc_SyncScanConfig;
+
+/** \brief Limit check monitor handle
+ */
+typedef struct
+{
+    Ifx_VADC_G               *group;              /**< \brief Group registers of the channels */
+    uint32                    channelMask;        /**< \brief Channels serviced by the monitor */
+    IfxVadc_Adc_LimitCallback callback;           /**< \brief Callback of the channel events, or NULL_PTR */
+    void                     *callbackData;       /**< \brief Data passed to the callback */
+    IfxDma_Dma_Channel        dmaChannel;         /**< \brief DMA channel of the hardware action */
+    boolean                   dmaAction;          /**< \brief TRUE if the channel events are serviced by the DMA */
+    volatile uint32           eventCount;         /**< \brief Number of channel events serviced by IfxVadc_Adc_isrLimitMonitor() */
+} IfxVadc_Adc_LimitMonitor;
+
+/** \brief Limit check monitor configuration structure
+ */
+typedef struct
+{
+    IFX_CONST IfxVadc_Adc_Group *group;               /**< \brief Specifies pointer to the IfxVadc_Adc_Group group handle */
+    uint32                       channelMask;         /**< \brief Channels of the group, bit x for channel x. Initialised with their limitCheck and a channelPriority of 0 */
+    IfxVadc_SrcNr                srcNr;               /**< \brief Service node of the channel events */
+    Ifx_Priority                 priority;            /**< \brief Interrupt priority of the channel events, without DMA action */
+    IfxSrc_Tos                   servProvider;        /**< \brief Interrupt service provider of the channel events, without DMA action */
+    IfxVadc_Adc_LimitCallback    callback;            /**< \brief Callback of the channel events, or NULL_PTR */
+    void                        *callbackData;        /**< \brief Data passed to the callback */
+    IfxDma_Dma                  *dma;                 /**< \brief Specifies pointer to the IfxDma_Dma module handle. NULL_PTR: the channel events interrupt the CPU */
+    IfxDma_ChannelId             dmaChannelId;        /**< \brief DMA channel, also the priority of the channel event service request. Must not be 0 */
+    uint32                       actionAddress;       /**< \brief Register written by the DMA at each channel event */
+    const uint32                *actionValue;         /**< \brief Value written into actionAddress, located in the flash or not data cached */
+} IfxVadc_Adc_LimitMonitorConfig;
+
 /** \} */
 
 /** \addtogroup IfxLld_Vadc_Adc_Module
@@ -651,6 +1079,22 @@ IFX_EXTERN IfxVadc_Status IfxVadc_Adc_initModule(IfxVadc_Adc *vadc, const IfxVad
  */
 IFX_EXTERN void IfxVadc_Adc_initModuleConfig(IfxVadc_Adc_Config *config, Ifx_VADC *vadc);
 
+/** \brief Returns the end of the startup calibration, never waits
+ *
+ * At the first call after the end of the calibration, calibrationCallback is called from this function.
+ * \param vadc pointer to the VADC handle
+ * \return TRUE if the calibration of all groups is finished
+ */
+IFX_EXTERN boolean IfxVadc_Adc_isCalibrationDone(IfxVadc_Adc *vadc);
+
+/** \brief Starts the startup calibration without waiting for its end
+ *
+ * The groups to calibrate shall be in normal operation, see startupCalibration of \ref IfxVadc_Adc_Config.
+ * \param vadc pointer to the VADC handle
+ * \return None
+ */
+IFX_EXTERN void IfxVadc_Adc_startCalibration(IfxVadc_Adc *vadc);
+
 /** \} */
 
 /** \addtogroup IfxLld_Vadc_Adc_Group
@@ -785,6 +1229,18 @@ IFX_INLINE void IfxVadc_Adc_getGroupResult(IfxVadc_Adc_Group *group, Ifx_VADC_RE
  */
 IFX_INLINE Ifx_VADC *IfxVadc_Adc_getVadcFromGroup(const IfxVadc_Adc_Group *group);
 
+/** \brief Returns FALSE while the startup calibration of the group runs
+ * \param group pointer to the VADC group
+ * \return TRUE if the group is not being calibrated
+ */
+IFX_INLINE boolean IfxVadc_Adc_isGroupCalibrated(const IfxVadc_Adc_Group *group);
+
+/** \brief Waits for the end of the startup calibration of the group
+ * \param group pointer to the VADC group
+ * \return None
+ */
+IFX_INLINE void IfxVadc_Adc_waitGroupCalibration(const IfxVadc_Adc_Group *group);
+
 /******************************************************************************/
 /*-------------------------Global Function Prototypes-------------------------*/
 /******************************************************************************/
@@ -856,6 +1312,15 @@ IFX_INLINE void IfxVadc_Adc_configureWaitForReadMode(IfxVadc_Adc_Channel *channe
  */
 IFX_INLINE Ifx_VADC_RES IfxVadc_Adc_getResult(IfxVadc_Adc_Channel *channel);
 
+/** \brief Get conversion result of a static channel (Function does not care about the alignment)
+ * \param channel pointer to the static channel, a const object for the address to be folded at compile time
+ * \return Conversion result
+ *
+ * For coding example see: \ref IfxLld_Vadc_Adc_StaticChannel
+ *
+ */
+IFX_INLINE Ifx_VADC_RES IfxVadc_Adc_getResultStatic(const IfxVadc_Adc_StaticChannel *channel);
+
 /** \brief Get debug result (Function does not care about the alignment)
  * \param channel pointer to the VADC channel.
  * \return Debug Conversion result
@@ -1125,6 +1590,39 @@ IFX_INLINE IfxVadc_Status IfxVadc_Adc_getQueueStatus(IfxVadc_Adc_Group *group);
  */
 IFX_INLINE void IfxVadc_Adc_startQueue(IfxVadc_Adc_Group *group);
 
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Load a sequence into the queue of a group, and set up its DMA feed if the sequence has a DMA.
+ * The queue is flushed first, its gate is closed while it is loaded. Without DMA, all entries are written with
+ * IFXVADC_QUEUE_REFILL. With a DMA, the first preload entries are written, then the queue source event of each
+ * conversion writes the next entry.
+ * \param sequence pointer to the queue sequence handle
+ * \param config pointer to the queue sequence configuration
+ * \return IfxVadc_Status
+ *
+ * For coding example see: \ref IfxLld_Vadc_Adc_QueueSequence
+ *
+ */
+IFX_EXTERN IfxVadc_Status IfxVadc_Adc_initQueueSequence(IfxVadc_Adc_QueueSequence *sequence, const IfxVadc_Adc_QueueSequenceConfig *config);
+
+/** \brief Initialise buffer with default queue sequence configuration
+ * \param config pointer to the queue sequence configuration
+ * \param group pointer to the VADC group
+ * \return None
+ *
+ * For coding example see: \ref IfxLld_Vadc_Adc_QueueSequence
+ *
+ */
+IFX_EXTERN void IfxVadc_Adc_initQueueSequenceConfig(IfxVadc_Adc_QueueSequenceConfig *config, const IfxVadc_Adc_Group *group);
+
+/** \brief Stop the DMA feed of a sequence and flush the queue
+ * \param sequence pointer to the queue sequence handle
+ * \return None
+ */
+IFX_EXTERN void IfxVadc_Adc_stopQueueSequence(IfxVadc_Adc_QueueSequence *sequence);
+
 /** \} */
 
 /** \addtogroup IfxLld_Vadc_Adc_Emux
@@ -1150,6 +1648,170 @@ IFX_EXTERN void IfxVadc_Adc_initExternalMultiplexerMode(Ifx_VADC *vadc, const If
 
 /** \} */
 
+/** \addtogroup IfxLld_Vadc_Adc_Stream
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Block ready interrupt handler. Must be called from the interrupt with the priority blockPriority
+ * \param stream pointer to the stream handle
+ * \return None
+ *
+ * For coding example see: \ref IfxLld_Vadc_Adc_Stream
+ *
+ */
+IFX_INLINE void IfxVadc_Adc_isrStream(IfxVadc_Adc_Stream *stream);
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Returns the last filled block of the stream
+ *
+ * The block stays valid until the DMA completes the next block, i.e. for blockSize conversions.
+ * If more than one block has been filled since the last call, the older blocks are skipped and
+ * counted in overrunCount.
+ * With blockPriority = 0, the function must be called at least once per block.
+ * \param stream pointer to the stream handle
+ * \return pointer to blockSize results, or NULL_PTR if no block has been filled since the last call
+ *
+ * For coding example see: \ref IfxLld_Vadc_Adc_Stream
+ *
+ */
+IFX_EXTERN const Ifx_VADC_RES *IfxVadc_Adc_getStreamBlock(IfxVadc_Adc_Stream *stream);
+
+/** \brief Initialise the FIFO, the result service request and the DMA channel of a stream.
+ * The channels of the stream must store into the result register outputRegister + fifoSize - 1.
+ * \param stream pointer to the stream handle
+ * \param config pointer to the stream configuration
+ * \return IfxVadc_Status
+ *
+ * For coding example see: \ref IfxLld_Vadc_Adc_Stream
+ *
+ */
+IFX_EXTERN IfxVadc_Status IfxVadc_Adc_initStream(IfxVadc_Adc_Stream *stream, const IfxVadc_Adc_StreamConfig *config);
+
+/** \brief Initialise buffer with default stream configuration
+ * \param config pointer to the stream configuration
+ * \param group pointer to the VADC group
+ * \return None
+ *
+ * For coding example see: \ref IfxLld_Vadc_Adc_Stream
+ *
+ */
+IFX_EXTERN void IfxVadc_Adc_initStreamConfig(IfxVadc_Adc_StreamConfig *config, const IfxVadc_Adc_Group *group);
+
+/** \brief Stop the DMA transfers of a stream. The conversions are not stopped
+ * \param stream pointer to the stream handle
+ * \return None
+ */
+IFX_EXTERN void IfxVadc_Adc_stopStream(IfxVadc_Adc_Stream *stream);
+
+/** \} */
+
+/** \addtogroup IfxLld_Vadc_Adc_SyncScan
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Frame interrupt handler. Must be called from the interrupt with the priority framePriority
+ * \param syncScan pointer to the synchronized scan handle
+ * \return None
+ *
+ * For coding example see: \ref IfxLld_Vadc_Adc_SyncScan
+ *
+ */
+IFX_INLINE void IfxVadc_Adc_isrSyncScan(IfxVadc_Adc_SyncScan *syncScan);
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Returns the frame if it has been copied since the last call
+ *
+ * The frame stays valid until the next trigger of the master group. If more than one frame has been
+ * copied since the last call, the older frames are counted in overrunCount.
+ * \param syncScan pointer to the synchronized scan handle
+ * \return pointer to groupCount * resultCount results, or NULL_PTR if no frame has been copied since the last call
+ *
+ * For coding example see: \ref IfxLld_Vadc_Adc_SyncScan
+ *
+ */
+IFX_EXTERN const Ifx_VADC_RES *IfxVadc_Adc_getSyncScanFrame(IfxVadc_Adc_SyncScan *syncScan);
+
+/** \brief Initialise the synchronization, the result service request and the DMA linked list of a synchronized scan.
+ * The master and slave groups and their channels must be initialised before.
+ * \param syncScan pointer to the synchronized scan handle
+ * \param config pointer to the synchronized scan configuration
+ * \return IfxVadc_Status
+ *
+ * For coding example see: \ref IfxLld_Vadc_Adc_SyncScan
+ *
+ */
+IFX_EXTERN IfxVadc_Status IfxVadc_Adc_initSyncScan(IfxVadc_Adc_SyncScan *syncScan, const IfxVadc_Adc_SyncScanConfig *config);
+
+/** \brief Initialise buffer with default synchronized scan configuration
+ * \param config pointer to the synchronized scan configuration
+ * \param master pointer to the master group
+ * \return None
+ *
+ * For coding example see: \ref IfxLld_Vadc_Adc_SyncScan
+ *
+ */
+IFX_EXTERN void IfxVadc_Adc_initSyncScanConfig(IfxVadc_Adc_SyncScanConfig *config, const IfxVadc_Adc_Group *master);
+
+/** \brief Stop the DMA transfers of a synchronized scan. The conversions are not stopped
+ * \param syncScan pointer to the synchronized scan handle
+ * \return None
+ */
+IFX_EXTERN void IfxVadc_Adc_stopSyncScan(IfxVadc_Adc_SyncScan *syncScan);
+
+/** \} */
+
+/** \addtogroup IfxLld_Vadc_Adc_LimitMonitor
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Initialise the service node of the channel events of a limit monitor, and the DMA action if the monitor has a DMA.
+ * The channels must be initialised before, their channel event node pointer is overwritten.
+ * \param monitor pointer to the limit monitor handle
+ * \param config pointer to the limit monitor configuration
+ * \return IfxVadc_Status
+ *
+ * For coding example see: \ref IfxLld_Vadc_Adc_LimitMonitor
+ *
+ */
+IFX_EXTERN IfxVadc_Status IfxVadc_Adc_initLimitMonitor(IfxVadc_Adc_LimitMonitor *monitor, const IfxVadc_Adc_LimitMonitorConfig *config);
+
+/** \brief Initialise buffer with default limit monitor configuration
+ * \param config pointer to the limit monitor configuration
+ * \param group pointer to the VADC group
+ * \return None
+ *
+ * For coding example see: \ref IfxLld_Vadc_Adc_LimitMonitor
+ *
+ */
+IFX_EXTERN void IfxVadc_Adc_initLimitMonitorConfig(IfxVadc_Adc_LimitMonitorConfig *config, const IfxVadc_Adc_Group *group);
+
+/** \brief Channel event interrupt handler. Must be called from the interrupt with the priority of the monitor, without DMA action.
+ * Clears the channel event flags of the monitor and calls the callback for each of them.
+ * \param monitor pointer to the limit monitor handle
+ * \return None
+ *
+ * For coding example see: \ref IfxLld_Vadc_Adc_LimitMonitor
+ *
+ */
+IFX_EXTERN void IfxVadc_Adc_isrLimitMonitor(IfxVadc_Adc_LimitMonitor *monitor);
+
+/** \} */
+
 /******************************************************************************/
 /*---------------------Inline Function Implementations------------------------*/
 /******************************************************************************/
@@ -1221,6 +1883,9 @@ IFX_INLINE void IfxVadc_Adc_getModuleConfig(IfxVadc_Adc *vadc, IfxVadc_Adc_Confi
     config->globalInputClass[1].sampleTime = IfxVadc_getGlobalSampleTime(vadc->vadc, 1, config->analogFrequency);
     config->moduleFrequency                = IfxVadc_getAdcModuleFrequency();
     config->startupCalibration             = IfxVadc_getStartupCalibration(vadc->vadc);
+    config->waitForCalibration             = TRUE;
+    config->calibrationCallback            = vadc->calibrationCallback;
+    config->calibrationCallbackData        = vadc->calibrationCallbackData;
 }
 
 
@@ -1242,6 +1907,12 @@ IFX_INLINE Ifx_VADC_RES IfxVadc_Adc_getResultBasedOnRequestSource(IfxVadc_Adc_Gr
 }
 
 
+IFX_INLINE Ifx_VADC_RES IfxVadc_Adc_getResultStatic(const IfxVadc_Adc_StaticChannel *channel)
+{
+    return IfxVadc_getResult(channel->group, channel->resultreg);
+}
+
+
 IFX_INLINE IfxVadc_Status IfxVadc_Adc_getScanStatus(IfxVadc_Adc_Group *group)
 {
     return IfxVadc_getScanStatus(group->group);
@@ -1254,6 +1925,39 @@ IFX_INLINE Ifx_VADC *IfxVadc_Adc_getVadcFromGroup(const IfxVadc_Adc_Group *group
 }
 
 
+IFX_INLINE boolean IfxVadc_Adc_isGroupCalibrated(const IfxVadc_Adc_Group *group)
+{
+    boolean calibrated = TRUE;
+
+    if (group->groupId < IFXVADC_NUM_ADC_CAL_GROUPS)
+    {
+        calibrated = IfxVadc_getAdcCalibrationActiveState(group->module.vadc, (uint8)group->groupId) == 0;
+    }
+
+    return calibrated;
+}
+
+
+IFX_INLINE void IfxVadc_Adc_waitGroupCalibration(const IfxVadc_Adc_Group *group)
+{
+    while (IfxVadc_Adc_isGroupCalibrated(group) == FALSE)
+    {}
+}
+
+
+IFX_INLINE void IfxVadc_Adc_isrStream(IfxVadc_Adc_Stream *stream)
+{
+    IfxDma_Dma_clearChannelInterrupt(&stream->dmaChannel);
+    stream->blockCount++;
+}
+
+
+IFX_INLINE void IfxVadc_Adc_isrSyncScan(IfxVadc_Adc_SyncScan *syncScan)
+{
+    syncScan->frameCount++;
+}
+
+
 IFX_INLINE void IfxVadc_Adc_setBackgroundScan(IfxVadc_Adc *vadc, IfxVadc_Adc_Group *group, uint32 channels, uint32 mask)
 {
     IfxVadc_setBackgroundScan(vadc->vadc, group->groupId, channels, mask);
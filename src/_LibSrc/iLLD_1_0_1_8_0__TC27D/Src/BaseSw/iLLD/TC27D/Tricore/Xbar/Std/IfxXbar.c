@@ -0,0 +1,140 @@
+/**
+ * \file IfxXbar.c
+ * \brief XBAR  basic functionality
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "IfxXbar.h"
+
+/******************************************************************************/
+/*------------------------Private Variables/Constants-------------------------*/
+/******************************************************************************/
+
+/** \brief Master priorities of the presets, indexed by IfxXbar_PriorityPreset then IfxXbar_Master.
+ * Unused master numbers get the lowest priority
+ */
+static const uint8 IfxXbar_presetPriorities[3][IFXXBAR_NUM_MASTERS] = {
+    /* DMA, -, -, -, HSSL0, HSSL1, SFI, -, CPU1 DMI, CPU1 PMI, CPU2 DMI, CPU2 PMI, CPU0 DMI, CPU0 PMI */
+    {3, 7, 7, 7, 3, 3, 3, 7, 3, 3, 3, 3, 3, 3}, /* equal */
+    {0, 7, 7, 7, 1, 1, 2, 7, 3, 4, 3, 4, 3, 4}, /* dmaFirst */
+    {2, 7, 7, 7, 3, 3, 4, 7, 5, 6, 5, 6, 0, 1}  /* cpu0First */
+};
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+
+void IfxXbar_applyPreset(Ifx_XBAR *xbar, uint32 slaveMask, IfxXbar_PriorityPreset preset)
+{
+    IfxXbar_setPriorities(xbar, slaveMask, IfxXbar_presetPriorities[preset]);
+}
+
+
+void IfxXbar_enableErrorInterrupts(Ifx_XBAR *xbar, uint32 slaveMask, boolean enabled)
+{
+    uint32 slave;
+
+    slaveMask &= IFXXBAR_SLAVE_MASK;
+
+    for (slave = 0; slave < 16; slave++)
+    {
+        if ((slaveMask & (1U << slave)) != 0)
+        {
+            Ifx_XBAR_ARBITERD *arbiter = IfxXbar_getArbiterPointer(xbar, (IfxXbar_Slave)slave);
+            Ifx_XBAR_ARBCON    arbcon;
+
+            /* do not trigger the interrupts, nor acknowledge a pending capture */
+            arbcon.U          = arbiter->ARBCON.U;
+            arbcon.B.PRERREN  = enabled ? 1 : 0;
+            arbcon.B.SCERREN  = enabled ? 1 : 0;
+            arbcon.B.SETPRINT = 0;
+            arbcon.B.SETSCINT = 0;
+            arbcon.B.INTACK   = 0;
+            arbiter->ARBCON.U = arbcon.U;
+        }
+    }
+}
+
+
+boolean IfxXbar_getError(Ifx_XBAR *xbar, IfxXbar_Slave slave, IfxXbar_Error *error)
+{
+    Ifx_XBAR_ARBITERD *arbiter = IfxXbar_getArbiterPointer(xbar, slave);
+    uint32             flags   = (1U << slave) | (1U << (16 + slave));
+    boolean            flagged = (IfxXbar_getInterruptStatus(xbar) & flags) != 0;
+    Ifx_XBAR_ERR       err;
+
+    err.U                = arbiter->ERR.U;
+    error->address       = arbiter->ERRADDR.U;
+    error->transactionId = (uint8)err.B.TR_ID;
+    error->opcode        = (uint8)err.B.OPC;
+    error->read          = err.B.RD != 0;
+    error->write         = err.B.WR != 0;
+    error->supervisor    = err.B.SVM != 0;
+
+    if (flagged != FALSE)
+    {
+        IfxXbar_clearInterruptStatus(xbar, flags);
+        arbiter->ARBCON.B.INTACK = 1;
+    }
+
+    return flagged;
+}
+
+
+void IfxXbar_setPriorities(Ifx_XBAR *xbar, uint32 slaveMask, const uint8 *priorities)
+{
+    uint32 prioL = 0;
+    uint32 prioH = 0;
+    uint32 master;
+    uint32 slave;
+
+    for (master = 0; master < IFXXBAR_NUM_MASTERS; master++)
+    {
+        uint32 value = ((uint32)priorities[master] & IFXXBAR_PRIORITY_MASK) << ((master & 7U) * 4U);
+
+        if (master < 8)
+        {
+            prioL |= value;
+        }
+        else
+        {
+            prioH |= value;
+        }
+    }
+
+    slaveMask &= IFXXBAR_SLAVE_MASK;
+
+    for (slave = 0; slave < 16; slave++)
+    {
+        if ((slaveMask & (1U << slave)) != 0)
+        {
+            Ifx_XBAR_ARBITERD *arbiter = IfxXbar_getArbiterPointer(xbar, (IfxXbar_Slave)slave);
+
+            arbiter->PRIOL.U = prioL;
+            arbiter->PRIOH.U = prioH;
+        }
+    }
+}
@@ -0,0 +1,300 @@
+/**
+ * \file IfxXbar.h
+ * \brief XBAR  basic functionality
+ * \ingroup IfxLld_Xbar
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * Each SRI slave (memories, bridges) has its own arbiter. When several masters request the same slave,
+ * the arbiter grants the master with the highest priority (0 is the highest); masters with the same
+ * priority are served round robin. A master which is not granted for the starvation protection
+ * period is served before the others, which bounds the share of the bandwidth a high priority master
+ * can take from the low priority ones.
+ *
+ * The registers are written in supervisor mode.
+ *
+ * Usage example, DMA first on the LMU and the default slave, starvation protection after 64 cycles:
+ * \code
+ * IfxXbar_applyPreset(&MODULE_XBAR, (1U << IfxXbar_Slave_sci2) | (1U << IfxXbar_Slave_default), IfxXbar_PriorityPreset_dmaFirst);
+ * IfxXbar_setStarvationProtection(&MODULE_XBAR, IfxXbar_Slave_sci2, 64);
+ * IfxXbar_enableErrorInterrupts(&MODULE_XBAR, IFXXBAR_SLAVE_MASK, TRUE);
+ *
+ * // error handler
+ * IfxXbar_Error error;
+ * if (IfxXbar_getError(&MODULE_XBAR, IfxXbar_Slave_sci2, &error) != FALSE)
+ * {
+ *     // error.address, error.transactionId, ...
+ * }
+ * \endcode
+ *
+ * \defgroup IfxLld_Xbar_Std_Enum Enumerations
+ * \ingroup IfxLld_Xbar_Std
+ * \defgroup IfxLld_Xbar_Std_Struct Structures
+ * \ingroup IfxLld_Xbar_Std
+ * \defgroup IfxLld_Xbar_Std_Arbitration Arbitration Functions
+ * \ingroup IfxLld_Xbar_Std
+ * \defgroup IfxLld_Xbar_Std_Error Error Functions
+ * \ingroup IfxLld_Xbar_Std
+ */
+
+#ifndef IFXXBAR_H
+#define IFXXBAR_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "_Impl/IfxXbar_cfg.h"
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+#include "IfxXbar_reg.h"
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+
+/** \addtogroup IfxLld_Xbar_Std_Enum
+ * \{ */
+/** \brief Predefined master priorities
+ */
+typedef enum
+{
+    IfxXbar_PriorityPreset_equal     = 0, /**< \brief All masters with the same priority, round robin */
+    IfxXbar_PriorityPreset_dmaFirst  = 1, /**< \brief DMA, then HSSL, SPB masters, CPU data and CPU program accesses */
+    IfxXbar_PriorityPreset_cpu0First = 2  /**< \brief CPU0 data and program accesses, then DMA, HSSL, SPB masters and the other CPUs */
+} IfxXbar_PriorityPreset;
+
+/** \} */
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+
+/** \addtogroup IfxLld_Xbar_Std_Struct
+ * \{ */
+/** \brief Captured SRI error
+ */
+typedef struct
+{
+    uint32  address;           /**< \brief Address of the transaction */
+    uint8   transactionId;     /**< \brief Transaction ID, identifies the master */
+    uint8   opcode;            /**< \brief SRI operation code */
+    boolean read;              /**< \brief TRUE for a read transaction */
+    boolean write;             /**< \brief TRUE for a write transaction */
+    boolean supervisor;        /**< \brief TRUE for a supervisor mode transaction */
+} IfxXbar_Error;
+
+/** \} */
+
+/** \addtogroup IfxLld_Xbar_Std_Arbitration
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Returns the arbiter registers of a slave
+ * \param xbar Pointer to the XBAR module registers
+ * \param slave Slave
+ * \return Pointer to the arbiter registers, all arbiters have the layout of the default slave one
+ */
+IFX_INLINE Ifx_XBAR_ARBITERD *IfxXbar_getArbiterPointer(Ifx_XBAR *xbar, IfxXbar_Slave slave);
+
+/** \brief Returns the priority of a master at a slave
+ * \param xbar Pointer to the XBAR module registers
+ * \param slave Slave
+ * \param master Master
+ * \return Priority, 0 is the highest
+ */
+IFX_INLINE uint8 IfxXbar_getMasterPriority(Ifx_XBAR *xbar, IfxXbar_Slave slave, IfxXbar_Master master);
+
+/** \brief Sets the priority of a master at a slave
+ * \param xbar Pointer to the XBAR module registers
+ * \param slave Slave
+ * \param master Master
+ * \param priority Priority, 0 (highest) .. IFXXBAR_PRIORITY_LOW
+ * \return None
+ */
+IFX_INLINE void IfxXbar_setMasterPriority(Ifx_XBAR *xbar, IfxXbar_Slave slave, IfxXbar_Master master, uint8 priority);
+
+/** \brief Sets the starvation protection of a slave
+ * \param xbar Pointer to the XBAR module registers
+ * \param slave Slave
+ * \param cycles Number of arbitration cycles after which a waiting master is served, 0 .. 4095
+ * \return None
+ */
+IFX_INLINE void IfxXbar_setStarvationProtection(Ifx_XBAR *xbar, IfxXbar_Slave slave, uint16 cycles);
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Sets the master priorities of slaves to a preset
+ * \param xbar Pointer to the XBAR module registers
+ * \param slaveMask Slaves to configure, bit x for IfxXbar_Slave x
+ * \param preset Priorities to apply
+ * \return None
+ */
+IFX_EXTERN void IfxXbar_applyPreset(Ifx_XBAR *xbar, uint32 slaveMask, IfxXbar_PriorityPreset preset);
+
+/** \brief Sets the master priorities of slaves
+ * \param xbar Pointer to the XBAR module registers
+ * \param slaveMask Slaves to configure, bit x for IfxXbar_Slave x
+ * \param priorities Priority of each master, indexed by IfxXbar_Master, IFXXBAR_NUM_MASTERS entries
+ * \return None
+ */
+IFX_EXTERN void IfxXbar_setPriorities(Ifx_XBAR *xbar, uint32 slaveMask, const uint8 *priorities);
+
+/** \} */
+
+/** \addtogroup IfxLld_Xbar_Std_Error
+ * \{ */
+
+/******************************************************************************/
+/*-------------------------Inline Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Clears the arbiter interrupt status flags
+ * \param xbar Pointer to the XBAR module registers
+ * \param mask Flags to clear, see IfxXbar_getInterruptStatus()
+ * \return None
+ */
+IFX_INLINE void IfxXbar_clearInterruptStatus(Ifx_XBAR *xbar, uint32 mask);
+
+/** \brief Clears the transaction ID error status flags
+ * \param xbar Pointer to the XBAR module registers
+ * \param mask Flags to clear, see IfxXbar_getTransactionIdErrorStatus()
+ * \return None
+ */
+IFX_INLINE void IfxXbar_clearTransactionIdErrorStatus(Ifx_XBAR *xbar, uint32 mask);
+
+/** \brief Returns the arbiter interrupt status flags
+ * \param xbar Pointer to the XBAR module registers
+ * \return Starvation error of slave x at bit x, protocol error of slave x at bit 16 + x
+ */
+IFX_INLINE uint32 IfxXbar_getInterruptStatus(Ifx_XBAR *xbar);
+
+/** \brief Returns the transaction ID error status flags
+ * \param xbar Pointer to the XBAR module registers
+ * \return Error reported by slave x at bit x, by master x at bit 16 + x
+ */
+IFX_INLINE uint32 IfxXbar_getTransactionIdErrorStatus(Ifx_XBAR *xbar);
+
+/******************************************************************************/
+/*-------------------------Global Function Prototypes-------------------------*/
+/******************************************************************************/
+
+/** \brief Enables or disables the protocol and starvation error interrupts of slaves
+ * \param xbar Pointer to the XBAR module registers
+ * \param slaveMask Slaves to configure, bit x for IfxXbar_Slave x
+ * \param enabled TRUE to enable, FALSE to disable
+ * \return None
+ */
+IFX_EXTERN void IfxXbar_enableErrorInterrupts(Ifx_XBAR *xbar, uint32 slaveMask, boolean enabled);
+
+/** \brief Reads the error captured by the arbiter of a slave, then clears the slave status flags and
+ * releases the capture registers
+ * \param xbar Pointer to the XBAR module registers
+ * \param slave Slave
+ * \param error Returns the captured error
+ * \return Returns TRUE if a protocol or starvation error was flagged for the slave
+ */
+IFX_EXTERN boolean IfxXbar_getError(Ifx_XBAR *xbar, IfxXbar_Slave slave, IfxXbar_Error *error);
+
+/** \} */
+
+/******************************************************************************/
+/*---------------------Inline Function Implementations------------------------*/
+/******************************************************************************/
+
+IFX_INLINE void IfxXbar_clearInterruptStatus(Ifx_XBAR *xbar, uint32 mask)
+{
+    xbar->INTSAT.U = mask;
+}
+
+
+IFX_INLINE void IfxXbar_clearTransactionIdErrorStatus(Ifx_XBAR *xbar, uint32 mask)
+{
+    xbar->IDINTSAT.U = mask;
+}
+
+
+IFX_INLINE Ifx_XBAR_ARBITERD *IfxXbar_getArbiterPointer(Ifx_XBAR *xbar, IfxXbar_Slave slave)
+{
+    Ifx_XBAR_ARBITERD *arbiter;
+
+    if (slave == IfxXbar_Slave_default)
+    {
+        arbiter = &xbar->ARBITERD;
+    }
+    else
+    {
+        arbiter = (Ifx_XBAR_ARBITERD *)((uint32)&xbar->ARBITER0 + ((uint32)slave * 0x40U));
+    }
+
+    return arbiter;
+}
+
+
+IFX_INLINE uint32 IfxXbar_getInterruptStatus(Ifx_XBAR *xbar)
+{
+    return xbar->INTSAT.U;
+}
+
+
+IFX_INLINE uint8 IfxXbar_getMasterPriority(Ifx_XBAR *xbar, IfxXbar_Slave slave, IfxXbar_Master master)
+{
+    Ifx_XBAR_ARBITERD *arbiter = IfxXbar_getArbiterPointer(xbar, slave);
+    uint32             shift   = ((uint32)master & 7U) * 4U;
+    uint32             prio    = (master < 8) ? arbiter->PRIOL.U : arbiter->PRIOH.U;
+
+    return (uint8)((prio >> shift) & IFXXBAR_PRIORITY_MASK);
+}
+
+
+IFX_INLINE uint32 IfxXbar_getTransactionIdErrorStatus(Ifx_XBAR *xbar)
+{
+    return xbar->IDINTSAT.U;
+}
+
+
+IFX_INLINE void IfxXbar_setMasterPriority(Ifx_XBAR *xbar, IfxXbar_Slave slave, IfxXbar_Master master, uint8 priority)
+{
+    Ifx_XBAR_ARBITERD *arbiter = IfxXbar_getArbiterPointer(xbar, slave);
+    uint32             shift   = ((uint32)master & 7U) * 4U;
+    uint32             mask    = IFXXBAR_PRIORITY_MASK << shift;
+    uint32             value   = ((uint32)priority & IFXXBAR_PRIORITY_MASK) << shift;
+
+    if (master < 8)
+    {
+        arbiter->PRIOL.U = (arbiter->PRIOL.U & ~mask) | value;
+    }
+    else
+    {
+        arbiter->PRIOH.U = (arbiter->PRIOH.U & ~mask) | value;
+    }
+}
+
+
+IFX_INLINE void IfxXbar_setStarvationProtection(Ifx_XBAR *xbar, IfxXbar_Slave slave, uint16 cycles)
+{
+    IfxXbar_getArbiterPointer(xbar, slave)->ARBCON.B.SPC = cycles;
+}
+
+
+#endif /* IFXXBAR_H */
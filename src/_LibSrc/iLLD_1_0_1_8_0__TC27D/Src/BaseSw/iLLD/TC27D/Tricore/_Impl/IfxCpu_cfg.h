@@ -55,6 +55,10 @@
  */
 #define IFXCPU_CACHABLE_LMU_SEGMENT   (9)
 
+/** \brief Size of a data cache line in bytes
+ */
+#define IFXCPU_DCACHE_LINE_SIZE       (32)
+
 /** \brief All cores (coreIDs) mask. This macro can be defined by the user according to the number of core being enabled.
  * So that can be used for syncronisation among multiple cores. In case user didn't define this macro, by default this
  * mask will be generated for all the available cores of the device.
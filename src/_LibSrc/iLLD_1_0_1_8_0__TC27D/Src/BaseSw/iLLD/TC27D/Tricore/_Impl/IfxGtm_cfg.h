@@ -231,6 +231,30 @@ typedef enum
     IfxGtm_FeatureControl_enabled  = 3   /**< \brief enabled */
 } IfxGtm_FeatureControl;
 
+/** \brief Enum for MCS objects
+ */
+typedef enum
+{
+    IfxGtm_Mcs_0,  /**< \brief MCS object 0 */
+    IfxGtm_Mcs_1,  /**< \brief MCS object 1 */
+    IfxGtm_Mcs_2,  /**< \brief MCS object 2 */
+    IfxGtm_Mcs_3   /**< \brief MCS object 3 */
+} IfxGtm_Mcs;
+
+/** \brief Enum for MCS channels
+ */
+typedef enum
+{
+    IfxGtm_Mcs_Ch_0,     /**< \brief MCS channel 0  */
+    IfxGtm_Mcs_Ch_1,     /**< \brief MCS channel 1  */
+    IfxGtm_Mcs_Ch_2,     /**< \brief MCS channel 2  */
+    IfxGtm_Mcs_Ch_3,     /**< \brief MCS channel 3  */
+    IfxGtm_Mcs_Ch_4,     /**< \brief MCS channel 4  */
+    IfxGtm_Mcs_Ch_5,     /**< \brief MCS channel 5  */
+    IfxGtm_Mcs_Ch_6,     /**< \brief MCS channel 6  */
+    IfxGtm_Mcs_Ch_7      /**< \brief MCS channel 7  */
+} IfxGtm_Mcs_Ch;
+
 /** \brief Enum for TIM objects
  */
 typedef enum
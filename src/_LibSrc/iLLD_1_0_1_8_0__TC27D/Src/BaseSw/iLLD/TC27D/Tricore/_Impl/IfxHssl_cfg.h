@@ -52,6 +52,14 @@
 
 #define IFXHSSL_JTAG_ID_ADDRESS (0xF0000464u)
 
+#define IFXHSSL_STREAM_FRAME_SIZE (32)
+
+/** \brief Number of requests queued by a pipeline, in addition to one request in progress per channel
+ */
+#ifndef IFXHSSL_CFG_PIPELINE_REQUESTS
+#define IFXHSSL_CFG_PIPELINE_REQUESTS 8
+#endif
+
 /******************************************************************************/
 /*--------------------------------Enumerations--------------------------------*/
 /******************************************************************************/
@@ -47,6 +47,22 @@
 
 #define IFXI2C_NUM_MODULES (1)
 
+/** \brief Size of the transmit and of the receive FIFO in bytes
+ */
+#define IFXI2C_FIFO_SIZE   (32)
+
+/** \brief Number of transactions waiting in the queue of the interrupt driven transfers
+ */
+#ifndef IFXI2C_CFG_QUEUE_LENGTH
+#define IFXI2C_CFG_QUEUE_LENGTH 8
+#endif
+
+/** \brief Number of register blocks refreshed periodically by the interrupt driven transfers
+ */
+#ifndef IFXI2C_CFG_POLL_LENGTH
+#define IFXI2C_CFG_POLL_LENGTH  4
+#endif
+
 /******************************************************************************/
 /*--------------------------------Enumerations--------------------------------*/
 /******************************************************************************/
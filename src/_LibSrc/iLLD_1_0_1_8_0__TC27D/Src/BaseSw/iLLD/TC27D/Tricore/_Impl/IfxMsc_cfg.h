@@ -49,6 +49,12 @@
 
 #define IFXMSC_NUM_ENABLE_SELECT_LINES (4)
 
+/** \brief Number of downstream commands queued by the shadow image mode
+ */
+#ifndef IFXMSC_CFG_SHADOW_COMMANDS
+#define IFXMSC_CFG_SHADOW_COMMANDS     4
+#endif
+
 /******************************************************************************/
 /*--------------------------------Enumerations--------------------------------*/
 /******************************************************************************/
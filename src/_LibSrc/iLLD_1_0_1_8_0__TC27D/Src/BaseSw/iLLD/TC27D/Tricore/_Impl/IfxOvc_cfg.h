@@ -0,0 +1,68 @@
+/**
+ * \file IfxOvc_cfg.h
+ * \brief OVC on-chip implementation data
+ * \ingroup IfxLld_Ovc
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup IfxLld_Ovc OVC
+ * \ingroup IfxLld
+ * \defgroup IfxLld_Ovc_Impl Implementation
+ * \ingroup IfxLld_Ovc
+ * \defgroup IfxLld_Ovc_Std Standard Driver
+ * \ingroup IfxLld_Ovc
+ */
+
+#ifndef IFXOVC_CFG_H
+#define IFXOVC_CFG_H 1
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+
+#include "Cpu/Std/Ifx_Types.h"
+#include "IfxOvc_reg.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Number of OVC modules, one per CPU
+ */
+#define IFXOVC_NUM_MODULES     (3)
+
+/** \brief Number of overlay blocks per OVC module
+ */
+#define IFXOVC_NUM_BLOCKS      (32)
+
+/** \brief Minimal size of an overlay block in bytes
+ */
+#define IFXOVC_BLOCK_SIZE_MIN  (0x20UL)
+
+/** \brief Maximal size of an overlay block in bytes
+ */
+#define IFXOVC_BLOCK_SIZE_MAX  (0x20000UL)
+
+/******************************************************************************/
+/*-------------------Global Exported Variables/Constants----------------------*/
+/******************************************************************************/
+
+IFX_EXTERN IFX_CONST IfxModule_IndexMap IfxOvc_cfg_indexMap[IFXOVC_NUM_MODULES];
+
+#endif /* IFXOVC_CFG_H */
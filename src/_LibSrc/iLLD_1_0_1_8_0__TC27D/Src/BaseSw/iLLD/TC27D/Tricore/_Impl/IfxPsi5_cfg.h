@@ -62,6 +62,12 @@
 
 #define IFXPSI5_NUM_MODULES            (1)
 
+/** \brief Number of frames of the DMA receive ring of a channel, power of 2 from 2 to 4096
+ */
+#ifndef IFXPSI5_CFG_DMA_FRAMES
+#define IFXPSI5_CFG_DMA_FRAMES         16
+#endif
+
 /******************************************************************************/
 /*-------------------------------Enumerations---------------------------------*/
 /******************************************************************************/
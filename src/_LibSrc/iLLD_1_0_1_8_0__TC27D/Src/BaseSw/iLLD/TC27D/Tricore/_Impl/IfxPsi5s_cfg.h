@@ -72,4 +72,16 @@
 
         #define IFXPSI5S_NUM_MODULES                              (1)
 
+/** \brief Number of frames of the DMA receive ring shared by all channels, power of 2 from 2 to 4096
+ */
+#ifndef IFXPSI5S_CFG_DMA_FRAMES
+#define IFXPSI5S_CFG_DMA_FRAMES                                   64
+#endif
+
+/** \brief Number of valid frames kept in the DMA history of each channel, power of 2
+ */
+#ifndef IFXPSI5S_CFG_DMA_HISTORY
+#define IFXPSI5S_CFG_DMA_HISTORY                                  8
+#endif
+
 #endif /* IFXPSI5S_CFG_H */
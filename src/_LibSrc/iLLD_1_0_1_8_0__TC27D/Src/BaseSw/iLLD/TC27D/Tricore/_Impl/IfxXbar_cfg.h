@@ -0,0 +1,96 @@
+/**
+ * \file IfxXbar_cfg.h
+ * \brief XBAR on-chip implementation data
+ * \ingroup IfxLld_Xbar
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2018 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup IfxLld_Xbar XBAR
+ * \ingroup IfxLld
+ * \defgroup IfxLld_Xbar_Impl Implementation
+ * \ingroup IfxLld_Xbar
+ * \defgroup IfxLld_Xbar_Std Standard Driver
+ * \ingroup IfxLld_Xbar
+ */
+
+#ifndef IFXXBAR_CFG_H
+#define IFXXBAR_CFG_H 1
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+
+/** \brief Number of master priority fields (PRIOL, PRIOH), indexed by the master connection interface (MCI) number
+ */
+#define IFXXBAR_NUM_MASTERS   (14)
+
+/** \brief Width mask of a master priority field
+ */
+#define IFXXBAR_PRIORITY_MASK (0x7U)
+
+/** \brief Lowest priority, 0 is the highest
+ */
+#define IFXXBAR_PRIORITY_LOW  (7)
+
+/** \brief Mask of the implemented slaves, bit x for IfxXbar_Slave x
+ */
+#define IFXXBAR_SLAVE_MASK    (0x81D7U)
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+
+/** \addtogroup IfxLld_Xbar_Impl
+ * \{ */
+
+/** \brief SRI masters, by master connection interface (MCI) number\n
+ * Definition in Ifx_XBAR.ARBITERx.PRIOL / PRIOH, Ifx_XBAR.IDINTSAT.IDMCIx
+ */
+typedef enum
+{
+    IfxXbar_Master_dma     = 0,   /**< \brief DMA */
+    IfxXbar_Master_hssl0   = 4,   /**< \brief HSSL channel 0 */
+    IfxXbar_Master_hssl1   = 5,   /**< \brief HSSL channel 1 */
+    IfxXbar_Master_sfi     = 6,   /**< \brief SPB to SRI bridge: SPB masters (Ethernet, HSM, ...) */
+    IfxXbar_Master_cpu1Dmi = 8,   /**< \brief CPU1 data memory interface */
+    IfxXbar_Master_cpu1Pmi = 9,   /**< \brief CPU1 program memory interface */
+    IfxXbar_Master_cpu2Dmi = 10,  /**< \brief CPU2 data memory interface */
+    IfxXbar_Master_cpu2Pmi = 11,  /**< \brief CPU2 program memory interface */
+    IfxXbar_Master_cpu0Dmi = 12,  /**< \brief CPU0 data memory interface */
+    IfxXbar_Master_cpu0Pmi = 13   /**< \brief CPU0 program memory interface */
+} IfxXbar_Master;
+
+/** \brief SRI slaves, by slave connection interface (SCI) number, one arbiter each\n
+ * Definition in Ifx_XBAR.ARBITERx, Ifx_XBAR.INTSAT.SCSCIx / PRSCIx
+ */
+typedef enum
+{
+    IfxXbar_Slave_sci0    = 0,   /**< \brief SCI0 */
+    IfxXbar_Slave_sci1    = 1,   /**< \brief SCI1 */
+    IfxXbar_Slave_sci2    = 2,   /**< \brief SCI2 */
+    IfxXbar_Slave_sci4    = 4,   /**< \brief SCI4 */
+    IfxXbar_Slave_sci6    = 6,   /**< \brief SCI6 */
+    IfxXbar_Slave_sci7    = 7,   /**< \brief SCI7 */
+    IfxXbar_Slave_sci8    = 8,   /**< \brief SCI8 */
+    IfxXbar_Slave_default = 15   /**< \brief Default slave, accesses to unmapped addresses */
+} IfxXbar_Slave;
+
+/** \} */
+
+#endif /* IFXXBAR_CFG_H */
@@ -26,7 +26,7 @@
 
 #if (IFX_CFG_CIRCULARBUFFER_C)
 
-uint32 Ifx_CircularBuffer_get32(Ifx_CircularBuffer *buffer)
+IFX_HOT_CODE uint32 Ifx_CircularBuffer_get32(Ifx_CircularBuffer *buffer)
 {
     uint32 data = ((uint32 *)buffer->base)[buffer->index];
 
@@ -41,7 +41,7 @@ uint32 Ifx_CircularBuffer_get32(Ifx_CircularBuffer *buffer)
 }
 
 
-uint16 Ifx_CircularBuffer_get16(Ifx_CircularBuffer *buffer)
+IFX_HOT_CODE uint16 Ifx_CircularBuffer_get16(Ifx_CircularBuffer *buffer)
 {
     uint16 data = ((uint16 *)buffer->base)[buffer->index];
 
@@ -63,7 +63,7 @@ uint16 Ifx_CircularBuffer_get16(Ifx_CircularBuffer *buffer)
  *
  * \return None.
  */
-void Ifx_CircularBuffer_addDataIncr(Ifx_CircularBuffer *buffer, uint32 data)
+IFX_HOT_CODE void Ifx_CircularBuffer_addDataIncr(Ifx_CircularBuffer *buffer, uint32 data)
 {
     ((uint32 *)buffer->base)[buffer->index] = data;
     buffer->index                          += 4;
@@ -75,92 +75,108 @@ void Ifx_CircularBuffer_addDataIncr(Ifx_CircularBuffer *buffer, uint32 data)
 }
 
 
-void *Ifx_CircularBuffer_read8(Ifx_CircularBuffer *buffer, void *data, Ifx_SizeT count)
-{
-    uint8 *Dest = (uint8 *)data;
+#endif
 
-    do
+/** \brief Copy count bytes between linear memories
+ *
+ * Words aligned blocks are moved by 64 bit accesses (ld.d / st.d), the unaligned head and tail by bytes.
+ */
+IFX_HOT_CODE static void Ifx_CircularBuffer_copy(uint8 *dest, const uint8 *source, uint32 count)
+{
+    if ((((uint32)dest ^ (uint32)source) & 3U) == 0)
     {
-        count--;
-        *Dest = ((uint8 *)buffer->base)[buffer->index];
-        Dest  = &Dest[1];
-        buffer->index++;
+        while ((((uint32)dest & 3U) != 0) && (count > 0))
+        {
+            *dest++ = *source++;
+            count--;
+        }
+
+        while (count >= 8)
+        {
+            *(uint64 *)dest = *(const uint64 *)source;
+            dest           += 8;
+            source         += 8;
+            count          -= 8;
+        }
 
-        if (buffer->index >= buffer->length)
+        if (count >= 4)
         {
-            buffer->index = 0;
+            *(uint32 *)dest = *(const uint32 *)source;
+            dest           += 4;
+            source         += 4;
+            count          -= 4;
         }
-    } while (count > 0);
+    }
 
-    return Dest;
+    while (count > 0)
+    {
+        *dest++ = *source++;
+        count--;
+    }
 }
 
 
-void *Ifx_CircularBuffer_read32(Ifx_CircularBuffer *buffer, void *data, Ifx_SizeT count)
+/** \brief Copy count bytes from the circular buffer, in at most 2 linear segments */
+IFX_HOT_CODE static void Ifx_CircularBuffer_readBlock(Ifx_CircularBuffer *buffer, uint8 *data, uint32 count)
 {
-    uint32 *Dest = (uint32 *)data;
-    uint8  *base = buffer->base;
+    uint8 *base  = (uint8 *)buffer->base;
+    uint32 first = (uint32)buffer->length - buffer->index;
 
-    do
+    if (first > count)
     {
-        *Dest         = *((uint32 *)(&base[buffer->index]));
-        Dest          = &Dest[1];
-        buffer->index = buffer->index + 4;
-
-        if (buffer->index >= buffer->length)
-        {
-            buffer->index = 0;
-        }
-
-        count--;
-    } while (count > 0);
+        first = count;
+    }
 
-    return Dest;
+    Ifx_CircularBuffer_copy(data, &base[buffer->index], first);
+    Ifx_CircularBuffer_copy(&data[first], base, count - first);
+    Ifx_CircularBuffer_skip(buffer, (Ifx_SizeT)count);
 }
 
 
-const void *Ifx_CircularBuffer_write8(Ifx_CircularBuffer *buffer, const void *data, Ifx_SizeT count)
+/** \brief Copy count bytes to the circular buffer, in at most 2 linear segments */
+IFX_HOT_CODE static void Ifx_CircularBuffer_writeBlock(Ifx_CircularBuffer *buffer, const uint8 *data, uint32 count)
 {
-    const uint8 *source = (const uint8 *)data;
+    uint8 *base  = (uint8 *)buffer->base;
+    uint32 first = (uint32)buffer->length - buffer->index;
 
-    do
+    if (first > count)
     {
-        count--;
-        ((uint8 *)buffer->base)[buffer->index] = *source;
-        source                                 = &source[1];
-        buffer->index++;
+        first = count;
+    }
+
+    Ifx_CircularBuffer_copy(&base[buffer->index], data, first);
+    Ifx_CircularBuffer_copy(base, &data[first], count - first);
+    Ifx_CircularBuffer_skip(buffer, (Ifx_SizeT)count);
+}
 
-        if (buffer->index >= buffer->length)
-        {
-            buffer->index = 0;
-        }
-    } while (count > 0);
 
-    return source;
+IFX_HOT_CODE void *Ifx_CircularBuffer_read8(Ifx_CircularBuffer *buffer, void *data, Ifx_SizeT count)
+{
+    Ifx_CircularBuffer_readBlock(buffer, (uint8 *)data, (uint32)count);
+
+    return &((uint8 *)data)[count];
 }
 
 
-const void *Ifx_CircularBuffer_write32(Ifx_CircularBuffer *buffer, const void *data, Ifx_SizeT count)
+IFX_HOT_CODE void *Ifx_CircularBuffer_read32(Ifx_CircularBuffer *buffer, void *data, Ifx_SizeT count)
 {
-    const uint32 *source = (const uint32 *)data;
-    uint8        *base   = buffer->base;
+    Ifx_CircularBuffer_readBlock(buffer, (uint8 *)data, (uint32)count * 4);
 
-    do
-    {
-        *((uint32 *)(&base[buffer->index])) = *source;
-        source                              = &source[1];
-        buffer->index                       = buffer->index + 4;
+    return &((uint32 *)data)[count];
+}
 
-        if (buffer->index >= buffer->length)
-        {
-            buffer->index = 0;
-        }
 
-        count--;
-    } while (count > 0);
+IFX_HOT_CODE const void *Ifx_CircularBuffer_write8(Ifx_CircularBuffer *buffer, const void *data, Ifx_SizeT count)
+{
+    Ifx_CircularBuffer_writeBlock(buffer, (const uint8 *)data, (uint32)count);
 
-    return source;
+    return &((const uint8 *)data)[count];
 }
 
 
-#endif
+IFX_HOT_CODE const void *Ifx_CircularBuffer_write32(Ifx_CircularBuffer *buffer, const void *data, Ifx_SizeT count)
+{
+    Ifx_CircularBuffer_writeBlock(buffer, (const uint8 *)data, (uint32)count * 4);
+
+    return &((const uint32 *)data)[count];
+}
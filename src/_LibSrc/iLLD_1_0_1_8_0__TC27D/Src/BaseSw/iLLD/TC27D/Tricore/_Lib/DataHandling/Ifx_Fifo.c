@@ -23,8 +23,11 @@
  */
 
 //------------------------------------------------------------------------------
+#define IFX_ASSERT_MODULE FIFO
 #include "Ifx_Fifo.h"
+#if IFX_CFG_FIFO_HEAP
 #include <stdlib.h>
+#endif
 #include "Ifx_CircularBuffer.h"
 #include "_Utilities/Ifx_Assert.h"
 #include "Cpu/Std/IfxCpu.h"
@@ -46,19 +49,96 @@
  * the interrupt is not disabled in the IntfifoXXX() functions
  * This is valid is an OS is used.
  *
+ * SPSC mode (Ifx_Fifo_initSpsc()):
+ * - the writer only modifies shared.writeTotal, endIndex and eventReader(TRUE)
+ * - the reader only modifies shared.readTotal, startIndex and eventWriter(TRUE)
+ * - each side arms its own wait level (readerWaitx / writerWaitx) and polls the
+ * fill level directly, the event set by the other side is only a hint. A missed
+ * or spurious event does therefore not change the result
+ * - a __dsync() is executed between the buffer access and the counter update
+ *
+ * Overwrite mode (Ifx_Fifo_initOverwrite()):
+ * - the writer also modifies startIndex and shared.count to drop the oldest
+ * elements, with the interrupts disabled
+ * - the reader therefore copies the data with the interrupts disabled too
+ *
  */
 //------------------------------------------------------------------------------
+
+#if IFX_CFG_FIFO_STATISTICS
+/** Registry of the instrumented FIFOs
+ */
+static Ifx_Fifo_Statistics *Ifx_Fifo_statisticsList = NULL_PTR;
+#endif
+
 Ifx_Fifo *Ifx_Fifo_create(Ifx_SizeT size, Ifx_SizeT elementSize)
+{
+    Ifx_Fifo *fifo = NULL_PTR;
+    Ifx_Pool *pool = Ifx_Pool_getDefault();
+
+    if (pool != NULL_PTR)
+    {
+        fifo = Ifx_Fifo_createFromPool(pool, size, elementSize);
+    }
+    else
+    {
+#if IFX_CFG_FIFO_HEAP
+        size = Ifx_AlignOn32(size);                 /* data transfer is optimised for 32 bit access */
+
+        fifo = malloc(size + sizeof(Ifx_Fifo) + 8); /* +8 because of padding in case the pointer is not aligned on 64 */
+
+        if (IFX_VALIDATE(IFX_VERBOSE_LEVEL_ERROR, (fifo != NULL_PTR)))
+        {
+            fifo = Ifx_Fifo_init(fifo, size, elementSize);
+        }
+#else
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, FALSE); /* no default pool and no heap */
+#endif
+    }
+
+    return fifo;
+}
+
+
+Ifx_Fifo *Ifx_Fifo_createFromPool(Ifx_Pool *pool, Ifx_SizeT size, Ifx_SizeT elementSize)
 {
     Ifx_Fifo *fifo = NULL_PTR;
 
-    size = Ifx_AlignOn32(size);                 /* data transfer is optimised for 32 bit access */
+    size = Ifx_AlignOn32(size);                                  /* data transfer is optimised for 32 bit access */
 
-    fifo = malloc(size + sizeof(Ifx_Fifo) + 8); /* +8 because of padding in case the pointer is not aligned on 64 */
+    fifo = Ifx_Pool_alloc(pool, size + sizeof(Ifx_Fifo) + 8);   /* the block is aligned on 64 bit, +8 kept for Ifx_Fifo_init() */
 
     if (IFX_VALIDATE(IFX_VERBOSE_LEVEL_ERROR, (fifo != NULL_PTR)))
     {
-        fifo = Ifx_Fifo_init(fifo, size, elementSize);
+        fifo       = Ifx_Fifo_init(fifo, size, elementSize);
+        fifo->pool = pool;
+    }
+
+    return fifo;
+}
+
+
+Ifx_Fifo *Ifx_Fifo_createSpsc(Ifx_SizeT size, Ifx_SizeT elementSize)
+{
+    Ifx_Fifo *fifo = Ifx_Fifo_create(size, elementSize);
+
+    if (fifo != NULL_PTR)
+    {
+        fifo->mode = Ifx_Fifo_Mode_spsc;
+    }
+
+    return fifo;
+}
+
+
+Ifx_Fifo *Ifx_Fifo_createOverwrite(Ifx_SizeT size, Ifx_SizeT elementSize)
+{
+    Ifx_Fifo *fifo = Ifx_Fifo_create(size, elementSize);
+
+    if (fifo != NULL_PTR)
+    {
+        IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (fifo->size % elementSize) == 0);
+        fifo->mode = Ifx_Fifo_Mode_overwrite;
     }
 
     return fifo;
@@ -67,7 +147,16 @@ Ifx_Fifo *Ifx_Fifo_create(Ifx_SizeT size, Ifx_SizeT elementSize)
 
 void Ifx_Fifo_destroy(Ifx_Fifo *fifo)
 {
-    free(fifo);
+    if (fifo->pool != NULL_PTR)
+    {
+        Ifx_Pool_free(fifo->pool, fifo);
+    }
+    else
+    {
+#if IFX_CFG_FIFO_HEAP
+        free(fifo);
+#endif
+    }
 }
 
 
@@ -88,35 +177,432 @@ Ifx_Fifo *Ifx_Fifo_init(void *buffer, Ifx_SizeT size, Ifx_SizeT elementSize)
         fifo->shared.count       = 0;
         fifo->shared.maxcount    = 0;
         fifo->shared.readerWaitx = fifo->shared.writerWaitx = 0;
+        fifo->shared.writeTotal  = fifo->shared.readTotal = 0;
+        fifo->shared.lossCount   = 0;
         fifo->startIndex         = fifo->endIndex = 0;
         fifo->size               = size;
         fifo->elementSize        = elementSize;
+        fifo->mode               = Ifx_Fifo_Mode_locked;
+        fifo->pool               = NULL_PTR;
+        fifo->waitStrategy       = NULL_PTR;
+#if IFX_CFG_FIFO_STATISTICS
+        fifo->statistics         = NULL_PTR;
+#endif
     }
 
     return fifo;
 }
 
 
+Ifx_Fifo *Ifx_Fifo_initSpsc(void *buffer, Ifx_SizeT size, Ifx_SizeT elementSize)
+{
+    Ifx_Fifo *fifo = Ifx_Fifo_init(buffer, size, elementSize);
+
+    fifo->mode = Ifx_Fifo_Mode_spsc;
+
+    return fifo;
+}
+
+
+Ifx_Fifo *Ifx_Fifo_initOverwrite(void *buffer, Ifx_SizeT size, Ifx_SizeT elementSize)
+{
+    Ifx_Fifo *fifo = Ifx_Fifo_init(buffer, size, elementSize);
+
+    /* Elements must not be split by the ring end, so that whole elements are dropped */
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (fifo->size % elementSize) == 0);
+    fifo->mode = Ifx_Fifo_Mode_overwrite;
+
+    return fifo;
+}
+
+
+/** Body of the wait loops: busy loop by default
+ */
+IFX_HOT_CODE static void Ifx_Fifo_wait(Ifx_Fifo *fifo, Ifx_TickTime deadLine)
+{
+    const Ifx_Fifo_WaitStrategy *strategy = fifo->waitStrategy;
+
+    if (strategy != NULL_PTR)
+    {
+        strategy->wait(fifo, deadLine);
+    }
+}
+
+
+/** Called after an event is set
+ */
+IFX_HOT_CODE static void Ifx_Fifo_signal(Ifx_Fifo *fifo)
+{
+    const Ifx_Fifo_WaitStrategy *strategy = fifo->waitStrategy;
+
+    if ((strategy != NULL_PTR) && (strategy->signal != NULL_PTR))
+    {
+        strategy->signal(fifo);
+    }
+}
+
+
+/** Statistics: returns the start time of a wait
+ */
+IFX_HOT_CODE static Ifx_TickTime Ifx_Fifo_beginWait(Ifx_Fifo *fifo)
+{
+#if IFX_CFG_FIFO_STATISTICS
+    return (fifo->statistics != NULL_PTR) ? now() : 0;
+#else
+    (void)fifo;
+    return 0;
+#endif
+}
+
+
+/** Statistics: accumulates the time of a wait
+ */
+IFX_HOT_CODE static void Ifx_Fifo_endWait(Ifx_Fifo *fifo, Ifx_TickTime start, boolean writer)
+{
+#if IFX_CFG_FIFO_STATISTICS
+    Ifx_Fifo_Statistics *statistics = fifo->statistics;
+
+    if (statistics != NULL_PTR)
+    {
+        if (writer != FALSE)
+        {
+            statistics->writeWaitTime += now() - start;
+            statistics->writeWaitCount++;
+        }
+        else
+        {
+            statistics->readWaitTime += now() - start;
+            statistics->readWaitCount++;
+        }
+    }
+
+#else
+    (void)fifo;
+    (void)start;
+    (void)writer;
+#endif
+}
+
+
+/** Statistics: samples the fill level after a write
+ */
+IFX_HOT_CODE static void Ifx_Fifo_recordFill(Ifx_Fifo *fifo)
+{
+#if IFX_CFG_FIFO_STATISTICS
+    Ifx_Fifo_Statistics *statistics = fifo->statistics;
+
+    if (statistics != NULL_PTR)
+    {
+        uint32 bin = ((uint32)Ifx_Fifo_readCount(fifo) * IFX_CFG_FIFO_HISTOGRAM_BINS) / (uint32)fifo->size;
+        statistics->fillHistogram[__min(bin, IFX_CFG_FIFO_HISTOGRAM_BINS - 1)]++;
+    }
+
+#else
+    (void)fifo;
+#endif
+}
+
+
+/** Statistics: records an overflow event
+ */
+IFX_HOT_CODE static void Ifx_Fifo_recordOverflow(Ifx_Fifo *fifo)
+{
+#if IFX_CFG_FIFO_STATISTICS
+    Ifx_Fifo_Statistics *statistics = fifo->statistics;
+
+    if (statistics != NULL_PTR)
+    {
+        statistics->overflowTimes[statistics->overflowCount % IFX_CFG_FIFO_OVERFLOW_LOG] = now();
+        statistics->overflowCount++;
+    }
+
+#else
+    (void)fifo;
+#endif
+}
+
+
+/** SPSC mode: called by the writer after new data are published
+ */
+IFX_HOT_CODE static void Ifx_Fifo_signalReaderSpsc(Ifx_Fifo *fifo)
+{
+    sint32 level = fifo->shared.readerWaitx;
+
+    if ((level != 0) && (Ifx_Fifo_readCount(fifo) >= level))
+    {
+        fifo->eventReader = TRUE; /* Signal the reader */
+        Ifx_Fifo_signal(fifo);
+    }
+}
+
+
+/** SPSC mode: called by the reader after free space is published
+ */
+IFX_HOT_CODE static void Ifx_Fifo_signalWriterSpsc(Ifx_Fifo *fifo)
+{
+    sint32 level = fifo->shared.writerWaitx;
+
+    if ((level != 0) && (Ifx_Fifo_writeCount(fifo) >= level))
+    {
+        fifo->eventWriter = TRUE; /* Signal the writer */
+        Ifx_Fifo_signal(fifo);
+    }
+}
+
+
+/** SPSC mode: wait until the fifo contains at least level bytes
+ */
+IFX_HOT_CODE static boolean Ifx_Fifo_waitReadSpsc(Ifx_Fifo *fifo, Ifx_SizeT level, Ifx_TickTime deadLine)
+{
+    boolean      result;
+    Ifx_TickTime waitStart;
+
+    /* Disarm before clearing the event so that a writer using the previous level can not set it */
+    fifo->shared.readerWaitx = 0;
+    fifo->eventReader        = FALSE;
+    fifo->shared.readerWaitx = level;
+    __dsync();
+
+    waitStart = Ifx_Fifo_beginWait(fifo);
+
+    while ((Ifx_Fifo_readCount(fifo) < level) && (isDeadLine(deadLine) == FALSE))
+    {
+        Ifx_Fifo_wait(fifo, deadLine);
+    }
+
+    Ifx_Fifo_endWait(fifo, waitStart, FALSE);
+
+    result = Ifx_Fifo_readCount(fifo) >= level;
+
+    if (result != FALSE)
+    {
+        fifo->shared.readerWaitx = 0;
+        fifo->eventReader        = TRUE;
+    }
+
+    return result;
+}
+
+
+/** SPSC mode: wait until the fifo has at least level bytes free
+ */
+IFX_HOT_CODE static boolean Ifx_Fifo_waitWriteSpsc(Ifx_Fifo *fifo, Ifx_SizeT level, Ifx_TickTime deadLine)
+{
+    boolean      result;
+    Ifx_TickTime waitStart;
+
+    /* Disarm before clearing the event so that a reader using the previous level can not set it */
+    fifo->shared.writerWaitx = 0;
+    fifo->eventWriter        = FALSE;
+    fifo->shared.writerWaitx = level;
+    __dsync();
+
+    waitStart = Ifx_Fifo_beginWait(fifo);
+
+    while ((Ifx_Fifo_writeCount(fifo) < level) && (isDeadLine(deadLine) == FALSE))
+    {
+        Ifx_Fifo_wait(fifo, deadLine);
+    }
+
+    Ifx_Fifo_endWait(fifo, waitStart, TRUE);
+
+    result = Ifx_Fifo_writeCount(fifo) >= level;
+
+    if (result != FALSE)
+    {
+        fifo->shared.writerWaitx = 0;
+        fifo->eventWriter        = TRUE;
+    }
+
+    return result;
+}
+
+
+/** SPSC mode: release blockSize bytes, startIndex must already be updated
+ */
+IFX_HOT_CODE static void Ifx_Fifo_readEndSpsc(Ifx_Fifo *fifo, Ifx_SizeT blockSize)
+{
+    __dsync();  /* The data must be read before the space is released to the writer */
+    fifo->shared.readTotal += (uint32)blockSize;
+    Ifx_Fifo_signalWriterSpsc(fifo);
+}
+
+
+/** SPSC mode: publish blockSize bytes, endIndex must already be updated
+ */
+IFX_HOT_CODE static void Ifx_Fifo_endWriteSpsc(Ifx_Fifo *fifo, Ifx_SizeT blockSize)
+{
+    __dsync();  /* The data must be visible before they are published to the reader */
+    fifo->shared.writeTotal += (uint32)blockSize;
+    fifo->shared.maxcount    = __max(fifo->shared.maxcount, Ifx_Fifo_readCount(fifo));
+    Ifx_Fifo_recordFill(fifo);
+    Ifx_Fifo_signalReaderSpsc(fifo);
+}
+
+
+IFX_HOT_CODE static Ifx_SizeT Ifx_Fifo_readSpsc(Ifx_Fifo *fifo, void *data, Ifx_SizeT count, Ifx_TickTime timeout)
+{
+    Ifx_TickTime       DeadLine;
+    Ifx_SizeT          blockSize;
+    Ifx_CircularBuffer buffer;
+    boolean            Stop = FALSE;
+
+    buffer.base   = fifo->buffer;
+    buffer.length = (uint16)fifo->size;         /* size always fit into 16 bit */
+    buffer.index  = (uint16)fifo->startIndex;   /* startIndex always fit into size */
+    DeadLine      = getDeadLine(timeout);
+
+    do
+    {
+        blockSize  = __min(count, Ifx_Fifo_readCount(fifo));
+        blockSize -= blockSize % fifo->elementSize;
+
+        if (blockSize != 0)
+        {
+            /* read element from the buffer */
+            data             = Ifx_CircularBuffer_read8(&buffer, data, blockSize);
+            fifo->startIndex = buffer.index;
+            Ifx_Fifo_readEndSpsc(fifo, blockSize);
+            count           -= blockSize;
+        }
+
+        if ((Stop != FALSE) || (isDeadLine(DeadLine) != FALSE))
+        {
+            break;
+        }
+
+        if (count != 0)
+        {
+            /* If the function timeout, the maximum number of characters are read before returning */
+            Stop = Ifx_Fifo_waitReadSpsc(fifo, __min(count, fifo->size), DeadLine) == FALSE;
+        }
+    } while (count != 0);
+
+    return count;
+}
+
+
+IFX_HOT_CODE static Ifx_SizeT Ifx_Fifo_writeSpsc(Ifx_Fifo *fifo, const void *data, Ifx_SizeT count, Ifx_TickTime timeout)
+{
+    Ifx_TickTime       DeadLine;
+    Ifx_SizeT          blockSize;
+    Ifx_CircularBuffer buffer;
+    boolean            Stop = FALSE;
+
+    buffer.base   = fifo->buffer;
+    buffer.length = (uint16)fifo->size;     /* size always fit into 16 bit */
+    buffer.index  = (uint16)fifo->endIndex; /* endIndex always fit into size */
+    DeadLine      = getDeadLine(timeout);
+
+    do
+    {
+        blockSize  = __min(count, Ifx_Fifo_writeCount(fifo));
+        blockSize -= blockSize % fifo->elementSize;
+
+        if (blockSize != 0)
+        {
+            /* write element to the buffer */
+            data           = Ifx_CircularBuffer_write8(&buffer, data, blockSize);
+            fifo->endIndex = buffer.index;
+            Ifx_Fifo_endWriteSpsc(fifo, blockSize);
+            count         -= blockSize;
+        }
+
+        if ((Stop != FALSE) || (isDeadLine(DeadLine) != FALSE))
+        {
+            break;
+        }
+
+        if (count != 0)
+        {
+            /* If the function timeout, the maximum number of characters are written before returning */
+            Stop = Ifx_Fifo_waitWriteSpsc(fifo, __min(count, fifo->size), DeadLine) == FALSE;
+        }
+    } while (count != 0);
+
+    return count;
+}
+
+
+/** Overwrite mode: the data are copied with the interrupts disabled, as the writer may drop them at any time
+ */
+IFX_HOT_CODE static Ifx_SizeT Ifx_Fifo_readOverwrite(Ifx_Fifo *fifo, void *data, Ifx_SizeT count, Ifx_TickTime timeout)
+{
+    Ifx_TickTime       DeadLine;
+    Ifx_TickTime       waitStart;
+    Ifx_SizeT          blockSize;
+    Ifx_CircularBuffer buffer;
+    boolean            interruptState;
+    boolean            Stop = FALSE;
+
+    buffer.base   = fifo->buffer;
+    buffer.length = (uint16)fifo->size;     /* size always fit into 16 bit */
+    DeadLine      = getDeadLine(timeout);
+
+    do
+    {
+        interruptState = disableInterrupts();
+        blockSize      = __min(count, Ifx_Fifo_readCount(fifo));
+        blockSize     -= blockSize % fifo->elementSize;
+
+        if (blockSize != 0)
+        {
+            /* read element from the buffer, startIndex may have been moved by the writer */
+            buffer.index        = (uint16)fifo->startIndex;
+            data                = Ifx_CircularBuffer_read8(&buffer, data, blockSize);
+            fifo->startIndex    = buffer.index;
+            fifo->shared.count -= blockSize;
+            count              -= blockSize;
+        }
+
+        fifo->eventReader        = FALSE;
+        fifo->shared.readerWaitx = __min(count, fifo->size);
+        restoreInterrupts(interruptState);
+
+        if ((Stop != FALSE) || (isDeadLine(DeadLine) != FALSE))
+        {
+            break;
+        }
+
+        if (count != 0)
+        {
+            waitStart = Ifx_Fifo_beginWait(fifo);
+
+            while ((fifo->eventReader == FALSE) && (isDeadLine(DeadLine) == FALSE))
+            {
+                Ifx_Fifo_wait(fifo, DeadLine);
+            }
+
+            Ifx_Fifo_endWait(fifo, waitStart, FALSE);
+
+            Stop = (fifo->eventReader == FALSE);    /* If the function timeout, the maximum number of characters are read before returning */
+        }
+    } while (count != 0);
+
+    return count;
+}
+
+
 /**
  * param: count in bytes
  */
-static Ifx_SizeT Ifx_Fifo_beginRead(Ifx_Fifo *fifo, Ifx_SizeT count)
+IFX_HOT_CODE static Ifx_SizeT Ifx_Fifo_beginRead(Ifx_Fifo *fifo, Ifx_SizeT count)
 {
     boolean   interruptState;
     Ifx_SizeT blockSize;
 
-    interruptState           = IfxCpu_disableInterrupts();
+    interruptState           = disableInterrupts();
     blockSize                = __min(count, Ifx_Fifo_readCount(fifo));
     blockSize               -= blockSize % fifo->elementSize;
     fifo->eventReader        = FALSE;
     fifo->shared.readerWaitx = __min(count - blockSize, fifo->size);
-    IfxCpu_restoreInterrupts(interruptState);
+    restoreInterrupts(interruptState);
 
     return blockSize;
 }
 
 
-boolean Ifx_Fifo_canReadCount(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_TickTime timeout)
+IFX_HOT_CODE boolean Ifx_Fifo_canReadCount(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_TickTime timeout)
 {
     boolean result;
 
@@ -126,30 +612,41 @@ boolean Ifx_Fifo_canReadCount(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_TickTime time
     {                           /* Only complete elements can be read from the buffer */
         result = FALSE;
     }
+    else if (fifo->mode == Ifx_Fifo_Mode_spsc)
+    {
+        result = Ifx_Fifo_waitReadSpsc(fifo, __min(count, fifo->size), getDeadLine(timeout));
+    }
     else
     {
         boolean interruptState;
         sint32  waitCount;
         count          = __min(count, fifo->size);
-        interruptState = IfxCpu_disableInterrupts();
+        interruptState = disableInterrupts();
         waitCount      = count - Ifx_Fifo_readCount(fifo);
 
         if (waitCount <= 0)
         {
             fifo->shared.readerWaitx = 0;
             fifo->eventReader        = TRUE;
-            IfxCpu_restoreInterrupts(interruptState);
+            restoreInterrupts(interruptState);
             result                   = TRUE;
         }
         else
         {
             Ifx_TickTime DeadLine = getDeadLine(timeout);
+            Ifx_TickTime waitStart;
             fifo->eventReader        = FALSE;
             fifo->shared.readerWaitx = waitCount;
-            IfxCpu_restoreInterrupts(interruptState);
+            restoreInterrupts(interruptState);
+
+            waitStart = Ifx_Fifo_beginWait(fifo);
 
             while ((fifo->eventReader == FALSE) && (isDeadLine(DeadLine) == FALSE))
-            {}
+            {
+                Ifx_Fifo_wait(fifo, DeadLine);
+            }
+
+            Ifx_Fifo_endWait(fifo, waitStart, FALSE);
 
             result = fifo->eventReader == TRUE;
         }
@@ -162,12 +659,13 @@ boolean Ifx_Fifo_canReadCount(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_TickTime time
 /**
  * param: count in bytes
  */
-static Ifx_SizeT Ifx_Fifo_readEnd(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_SizeT blockSize)
+IFX_HOT_CODE static Ifx_SizeT Ifx_Fifo_readEnd(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_SizeT blockSize)
 {
     boolean interruptState;
+    boolean signal = FALSE;
 
     /* Set the shared values */
-    interruptState      = IfxCpu_disableInterrupts();
+    interruptState      = disableInterrupts();
 
     fifo->shared.count -= blockSize;
 
@@ -179,18 +677,25 @@ static Ifx_SizeT Ifx_Fifo_readEnd(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_SizeT blo
         {
             fifo->shared.writerWaitx = 0;
             fifo->eventWriter        = TRUE; /* Signal the writer */
+            signal                   = TRUE;
         }
     }
 
-    IfxCpu_restoreInterrupts(interruptState);
+    restoreInterrupts(interruptState);
+
+    if (signal != FALSE)
+    {
+        Ifx_Fifo_signal(fifo);
+    }
 
     return count - blockSize;
 }
 
 
-Ifx_SizeT Ifx_Fifo_read(Ifx_Fifo *fifo, void *data, Ifx_SizeT count, Ifx_TickTime timeout)
+IFX_HOT_CODE Ifx_SizeT Ifx_Fifo_read(Ifx_Fifo *fifo, void *data, Ifx_SizeT count, Ifx_TickTime timeout)
 {
     Ifx_TickTime       DeadLine;
+    Ifx_TickTime       waitStart;
     Ifx_SizeT          blockSize;
     Ifx_CircularBuffer buffer;
     boolean            Stop = FALSE;
@@ -198,7 +703,15 @@ Ifx_SizeT Ifx_Fifo_read(Ifx_Fifo *fifo, void *data, Ifx_SizeT count, Ifx_TickTim
     IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
     IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, data != NULL_PTR);
 
-    if (count != 0)
+    if ((count != 0) && (fifo->mode == Ifx_Fifo_Mode_spsc))
+    {
+        count = Ifx_Fifo_readSpsc(fifo, data, count, timeout);
+    }
+    else if ((count != 0) && (fifo->mode == Ifx_Fifo_Mode_overwrite))
+    {
+        count = Ifx_Fifo_readOverwrite(fifo, data, count, timeout);
+    }
+    else if (count != 0)
     {
         buffer.base   = fifo->buffer;
         buffer.length = (uint16)fifo->size;         /* size always fit into 16 bit */
@@ -223,8 +736,14 @@ Ifx_SizeT Ifx_Fifo_read(Ifx_Fifo *fifo, void *data, Ifx_SizeT count, Ifx_TickTim
 
             if (count != 0)
             {
+                waitStart = Ifx_Fifo_beginWait(fifo);
+
                 while ((fifo->eventReader == FALSE) && (isDeadLine(DeadLine) == FALSE))
-                {}
+                {
+                    Ifx_Fifo_wait(fifo, DeadLine);
+                }
+
+                Ifx_Fifo_endWait(fifo, waitStart, FALSE);
 
                 Stop = (fifo->eventReader == FALSE);    /* If the function timeout, the maximum number of characters are read before returning */
             }
@@ -240,41 +759,58 @@ Ifx_SizeT Ifx_Fifo_read(Ifx_Fifo *fifo, void *data, Ifx_SizeT count, Ifx_TickTim
 void Ifx_Fifo_clear(Ifx_Fifo *fifo)
 {
     boolean interruptState;
+    boolean signal = FALSE;
 
-    interruptState = IfxCpu_disableInterrupts();
+    interruptState = disableInterrupts();
 
-    if (fifo->shared.writerWaitx != 0)
+    if (fifo->mode == Ifx_Fifo_Mode_spsc)
+    {   /* Drop the available data on the reader side, the writer data are not modified */
+        Ifx_SizeT count = Ifx_Fifo_readCount(fifo);
+        fifo->startIndex = (Ifx_SizeT)((fifo->startIndex + count) % fifo->size);
+        Ifx_Fifo_readEndSpsc(fifo, count);
+    }
+    else
     {
-        fifo->shared.writerWaitx = 0;
-        fifo->eventWriter        = TRUE; /* Signal the writer */
+        if (fifo->shared.writerWaitx != 0)
+        {
+            fifo->shared.writerWaitx = 0;
+            fifo->eventWriter        = TRUE; /* Signal the writer */
+            signal                   = TRUE;
+        }
+
+        fifo->shared.count = 0;
+        fifo->startIndex   = fifo->endIndex;
     }
 
     fifo->eventReader        = FALSE;
     fifo->shared.readerWaitx = 0;
-    fifo->shared.count       = 0;
     fifo->shared.maxcount    = 0;
-    fifo->startIndex         = fifo->endIndex;
-    IfxCpu_restoreInterrupts(interruptState);
+    restoreInterrupts(interruptState);
+
+    if (signal != FALSE)
+    {
+        Ifx_Fifo_signal(fifo);
+    }
 }
 
 
-static Ifx_SizeT Ifx_Fifo_beginWrite(Ifx_Fifo *fifo, Ifx_SizeT count)
+IFX_HOT_CODE static Ifx_SizeT Ifx_Fifo_beginWrite(Ifx_Fifo *fifo, Ifx_SizeT count)
 {
     Ifx_SizeT blockSize;
     boolean   interruptState;
 
-    interruptState           = IfxCpu_disableInterrupts();
+    interruptState           = disableInterrupts();
     blockSize                = __min(count, fifo->size - Ifx_Fifo_readCount(fifo));
     blockSize               -= blockSize % fifo->elementSize;
     fifo->eventWriter        = FALSE;
     fifo->shared.writerWaitx = __min(count - blockSize, fifo->size);
-    IfxCpu_restoreInterrupts(interruptState);
+    restoreInterrupts(interruptState);
 
     return blockSize;
 }
 
 
-boolean Ifx_Fifo_canWriteCount(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_TickTime timeout)
+IFX_HOT_CODE boolean Ifx_Fifo_canWriteCount(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_TickTime timeout)
 {
     boolean result;
 
@@ -285,27 +821,38 @@ boolean Ifx_Fifo_canWriteCount(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_TickTime tim
     {                           /* Only complete elements can be written to the buffer */
         result = FALSE;
     }
+    else if (fifo->mode == Ifx_Fifo_Mode_spsc)
+    {
+        result = Ifx_Fifo_waitWriteSpsc(fifo, count, getDeadLine(timeout));
+    }
     else
     {
         boolean interruptState;
-        interruptState = IfxCpu_disableInterrupts();
+        interruptState = disableInterrupts();
 
         if ((fifo->size - Ifx_Fifo_readCount(fifo)) >= count)
         {
             fifo->shared.writerWaitx = 0;
             fifo->eventWriter        = TRUE;
-            IfxCpu_restoreInterrupts(interruptState);
+            restoreInterrupts(interruptState);
             result                   = TRUE;
         }
         else
         {
             Ifx_TickTime DeadLine = getDeadLine(timeout);
+            Ifx_TickTime waitStart;
             fifo->eventWriter        = FALSE;
             fifo->shared.writerWaitx = __max(0, count - (fifo->size - Ifx_Fifo_readCount(fifo)));
-            IfxCpu_restoreInterrupts(interruptState);
+            restoreInterrupts(interruptState);
+
+            waitStart = Ifx_Fifo_beginWait(fifo);
 
             while ((fifo->eventWriter == FALSE) && (isDeadLine(DeadLine) == FALSE))
-            {}
+            {
+                Ifx_Fifo_wait(fifo, DeadLine);
+            }
+
+            Ifx_Fifo_endWait(fifo, waitStart, TRUE);
 
             result = fifo->eventWriter == TRUE;
         }
@@ -315,12 +862,13 @@ boolean Ifx_Fifo_canWriteCount(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_TickTime tim
 }
 
 
-static Ifx_SizeT Ifx_Fifo_endWrite(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_SizeT blockSize)
+IFX_HOT_CODE static Ifx_SizeT Ifx_Fifo_endWrite(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_SizeT blockSize)
 {
     boolean interruptState;
+    boolean signal = FALSE;
 
     /* Set the shared values */
-    interruptState        = IfxCpu_disableInterrupts();
+    interruptState        = disableInterrupts();
 
     fifo->shared.count   += blockSize;
     fifo->shared.maxcount = __max(fifo->shared.maxcount, fifo->shared.count);   /* Update maximum value */
@@ -333,18 +881,78 @@ static Ifx_SizeT Ifx_Fifo_endWrite(Ifx_Fifo *fifo, Ifx_SizeT count, Ifx_SizeT bl
         {
             fifo->shared.readerWaitx = 0;
             fifo->eventReader        = TRUE; /* Signal the reader - a re-scheduling may occur at this point! */
+            signal                   = TRUE;
         }
     }
 
-    IfxCpu_restoreInterrupts(interruptState);
+    restoreInterrupts(interruptState);
+    Ifx_Fifo_recordFill(fifo);
+
+    if (signal != FALSE)
+    {
+        Ifx_Fifo_signal(fifo);
+    }
 
     return count - blockSize;
 }
 
 
-Ifx_SizeT Ifx_Fifo_write(Ifx_Fifo *fifo, const void *data, Ifx_SizeT count, Ifx_TickTime timeout)
+/** Overwrite mode: the oldest elements are dropped to make room for the new ones, never waits
+ */
+IFX_HOT_CODE static Ifx_SizeT Ifx_Fifo_writeOverwrite(Ifx_Fifo *fifo, const void *data, Ifx_SizeT count)
+{
+    Ifx_SizeT          blockSize;
+    Ifx_SizeT          dropSize;
+    Ifx_CircularBuffer buffer;
+    boolean            interruptState;
+
+    blockSize = count - (count % fifo->elementSize);
+
+    if (blockSize > fifo->size)
+    {
+        /* Only the newest elements fit into the buffer */
+        dropSize                = blockSize - fifo->size;
+        data                    = &((const uint8 *)data)[dropSize];
+        blockSize               = fifo->size;
+        fifo->shared.lossCount += dropSize;
+        Ifx_Fifo_recordOverflow(fifo);
+    }
+
+    if (blockSize != 0)
+    {
+        buffer.base    = fifo->buffer;
+        buffer.length  = (uint16)fifo->size;        /* size always fit into 16 bit */
+
+        interruptState = disableInterrupts();
+        dropSize       = __max(0, (sint32)blockSize - (sint32)Ifx_Fifo_writeCount(fifo));
+
+        if (dropSize != 0)
+        {
+            /* Advance the reader over the oldest elements */
+            buffer.index            = (uint16)fifo->startIndex;
+            Ifx_CircularBuffer_skip(&buffer, dropSize);
+            fifo->startIndex        = buffer.index;
+            fifo->shared.count     -= dropSize;
+            fifo->shared.lossCount += dropSize;
+            Ifx_Fifo_recordOverflow(fifo);
+        }
+
+        buffer.index   = (uint16)fifo->endIndex;
+        Ifx_CircularBuffer_write8(&buffer, data, blockSize);
+        fifo->endIndex = buffer.index;
+        restoreInterrupts(interruptState);
+
+        count          = Ifx_Fifo_endWrite(fifo, count, blockSize);
+    }
+
+    return count % fifo->elementSize;
+}
+
+
+IFX_HOT_CODE Ifx_SizeT Ifx_Fifo_write(Ifx_Fifo *fifo, const void *data, Ifx_SizeT count, Ifx_TickTime timeout)
 {
     Ifx_TickTime       DeadLine;
+    Ifx_TickTime       waitStart;
     Ifx_SizeT          blockSize;
     Ifx_CircularBuffer buffer;
     boolean            Stop = FALSE;
@@ -352,7 +960,15 @@ Ifx_SizeT Ifx_Fifo_write(Ifx_Fifo *fifo, const void *data, Ifx_SizeT count, Ifx_
     IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
     IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, data != NULL_PTR);
 
-    if (count != 0)
+    if ((count != 0) && (fifo->mode == Ifx_Fifo_Mode_spsc))
+    {
+        count = Ifx_Fifo_writeSpsc(fifo, data, count, timeout);
+    }
+    else if ((count != 0) && (fifo->mode == Ifx_Fifo_Mode_overwrite))
+    {
+        count = Ifx_Fifo_writeOverwrite(fifo, data, count);
+    }
+    else if (count != 0)
     {
         buffer.base   = fifo->buffer;
         buffer.length = (uint16)fifo->size;     /* size always fit into 16 bit */
@@ -377,8 +993,14 @@ Ifx_SizeT Ifx_Fifo_write(Ifx_Fifo *fifo, const void *data, Ifx_SizeT count, Ifx_
 
             if (count != 0)
             {
+                waitStart = Ifx_Fifo_beginWait(fifo);
+
                 while ((fifo->eventWriter == FALSE) && (isDeadLine(DeadLine) == FALSE))
-                {}
+                {
+                    Ifx_Fifo_wait(fifo, DeadLine);
+                }
+
+                Ifx_Fifo_endWait(fifo, waitStart, TRUE);
 
                 Stop = fifo->eventWriter == FALSE;  /* If the function timeout, the maximum number of characters are written before returning */
             }
@@ -387,8 +1009,177 @@ Ifx_SizeT Ifx_Fifo_write(Ifx_Fifo *fifo, const void *data, Ifx_SizeT count, Ifx_
         fifo->endIndex = buffer.index;
     }
 
+    if ((count >= fifo->elementSize) && (fifo->mode != Ifx_Fifo_Mode_overwrite))
+    {
+        /* Not all the elements could be written */
+        Ifx_Fifo_recordOverflow(fifo);
+    }
+
     return count;
 }
 
 
+IFX_HOT_CODE Ifx_SizeT Ifx_Fifo_reserveWrite(Ifx_Fifo *fifo, void **data, Ifx_SizeT *count)
+{
+    Ifx_CircularBuffer buffer;
+    Ifx_SizeT          freeCount;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (fifo->size % fifo->elementSize) == 0);
+
+    buffer.base   = fifo->buffer;
+    buffer.length = (uint16)fifo->size;     /* size always fit into 16 bit */
+    buffer.index  = (uint16)fifo->endIndex; /* endIndex always fit into size */
+
+    freeCount  = Ifx_Fifo_writeCount(fifo);
+    freeCount -= freeCount % fifo->elementSize;
+    *data      = Ifx_CircularBuffer_getPointer(&buffer);
+    *count     = __min(freeCount, Ifx_CircularBuffer_getLinearCount(&buffer));
+
+    return freeCount;
+}
+
+
+IFX_HOT_CODE void Ifx_Fifo_commitWrite(Ifx_Fifo *fifo, Ifx_SizeT count)
+{
+    Ifx_CircularBuffer buffer;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (count % fifo->elementSize) == 0);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, count <= Ifx_Fifo_writeCount(fifo));
+
+    if (count != 0)
+    {
+        buffer.base   = fifo->buffer;
+        buffer.length = (uint16)fifo->size;
+        buffer.index  = (uint16)fifo->endIndex;
+        Ifx_CircularBuffer_skip(&buffer, count);
+        fifo->endIndex = buffer.index;
+
+        if (fifo->mode == Ifx_Fifo_Mode_spsc)
+        {
+            Ifx_Fifo_endWriteSpsc(fifo, count);
+        }
+        else
+        {
+            Ifx_Fifo_endWrite(fifo, count, count);
+        }
+    }
+}
+
+
+IFX_HOT_CODE Ifx_SizeT Ifx_Fifo_peekRead(Ifx_Fifo *fifo, const void **data, Ifx_SizeT *count)
+{
+    Ifx_CircularBuffer buffer;
+    Ifx_SizeT          usedCount;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (fifo->size % fifo->elementSize) == 0);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo->mode != Ifx_Fifo_Mode_overwrite);
+
+    buffer.base   = fifo->buffer;
+    buffer.length = (uint16)fifo->size;         /* size always fit into 16 bit */
+    buffer.index  = (uint16)fifo->startIndex;   /* startIndex always fit into size */
+
+    usedCount  = Ifx_Fifo_readCount(fifo);
+    usedCount -= usedCount % fifo->elementSize;
+    *data      = Ifx_CircularBuffer_getPointer(&buffer);
+    *count     = __min(usedCount, Ifx_CircularBuffer_getLinearCount(&buffer));
+
+    return usedCount;
+}
+
+
+IFX_HOT_CODE void Ifx_Fifo_releaseRead(Ifx_Fifo *fifo, Ifx_SizeT count)
+{
+    Ifx_CircularBuffer buffer;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (count % fifo->elementSize) == 0);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, count <= Ifx_Fifo_readCount(fifo));
+
+    if (count != 0)
+    {
+        buffer.base   = fifo->buffer;
+        buffer.length = (uint16)fifo->size;
+        buffer.index  = (uint16)fifo->startIndex;
+        Ifx_CircularBuffer_skip(&buffer, count);
+        fifo->startIndex = buffer.index;
+
+        if (fifo->mode == Ifx_Fifo_Mode_spsc)
+        {
+            Ifx_Fifo_readEndSpsc(fifo, count);
+        }
+        else
+        {
+            Ifx_Fifo_readEnd(fifo, count, count);
+        }
+    }
+}
+
+
+#if IFX_CFG_FIFO_STATISTICS
+const Ifx_Fifo_Statistics *Ifx_Fifo_getStatisticsList(void)
+{
+    return Ifx_Fifo_statisticsList;
+}
+
+
+void Ifx_Fifo_registerStatistics(Ifx_Fifo *fifo, Ifx_Fifo_Statistics *statistics, const char *name)
+{
+    boolean interruptState;
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (fifo != NULL_PTR) && (statistics != NULL_PTR));
+
+    statistics->fifo = fifo;
+    statistics->name = name;
+    fifo->statistics = statistics;
+    Ifx_Fifo_resetStatistics(fifo);
+
+    interruptState          = disableInterrupts();
+    statistics->next        = Ifx_Fifo_statisticsList;
+    Ifx_Fifo_statisticsList = statistics;
+    restoreInterrupts(interruptState);
+}
+
+
+void Ifx_Fifo_resetStatistics(Ifx_Fifo *fifo)
+{
+    Ifx_Fifo_Statistics *statistics = fifo->statistics;
+    uint32               index;
+
+    if (statistics != NULL_PTR)
+    {
+        for (index = 0; index < IFX_CFG_FIFO_HISTOGRAM_BINS; index++)
+        {
+            statistics->fillHistogram[index] = 0;
+        }
+
+        for (index = 0; index < IFX_CFG_FIFO_OVERFLOW_LOG; index++)
+        {
+            statistics->overflowTimes[index] = 0;
+        }
+
+        statistics->readWaitTime   = 0;
+        statistics->writeWaitTime  = 0;
+        statistics->readWaitCount  = 0;
+        statistics->writeWaitCount = 0;
+        statistics->overflowCount  = 0;
+    }
+
+    fifo->shared.maxcount = 0;
+}
+
+
+#endif
+
+void Ifx_Fifo_setWaitStrategy(Ifx_Fifo *fifo, const Ifx_Fifo_WaitStrategy *strategy)
+{
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, fifo != NULL_PTR);
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (strategy == NULL_PTR) || (strategy->wait != NULL_PTR));
+
+    fifo->waitStrategy = strategy;
+}
+
+
 //------------------------------------------------------------------------------
@@ -25,6 +25,49 @@
  * This module implements the FIFO buffer functionality.
  * \ingroup IfxLld_lib_datahandling
  *
+ * A reader or a writer which waits with a timeout polls the FIFO in a busy loop by default. A wait
+ * strategy (\ref Ifx_Fifo_setWaitStrategy()) replaces the body of this loop, for example to block on an
+ * RTOS semaphore which is given by the signal function, or to yield a coroutine.
+ *
+ * A wait function setting the core in idle mode is left to the application: the core is only woken up by
+ * an interrupt, so the application shall provide one at the dead line (e.g. a STM compare) and a signal
+ * function raising a service request on the waiting core, which may run on another core than the signaling
+ * side.
+ *
+ * RTOS wait strategy example:
+ * \code
+ * static void fifoWait(Ifx_Fifo *fifo, Ifx_TickTime deadLine)
+ * {
+ *     rtosSemaphoreTake((RtosSemaphore *)fifo->waitStrategy->data, getTimeout(deadLine));
+ * }
+ *
+ * static void fifoSignal(Ifx_Fifo *fifo)
+ * {
+ *     rtosSemaphoreGive((RtosSemaphore *)fifo->waitStrategy->data);
+ * }
+ *
+ * static const Ifx_Fifo_WaitStrategy fifoWaitStrategy = {&fifoWait, &fifoSignal, &fifoSemaphore};
+ *
+ * Ifx_Fifo_setWaitStrategy(fifo, &fifoWaitStrategy);
+ * \endcode
+ *
+ * With IFX_CFG_FIFO_STATISTICS set to 1, a FIFO can be instrumented for capacity planning with
+ * \ref Ifx_Fifo_registerStatistics(): fill level histogram sampled after each write, time spent waiting by
+ * the reader and the writer, overflow events with their time stamps. The registered FIFOs are chained in a
+ * registry which lists all of them with their statistics:
+ * \code
+ * static Ifx_Fifo_Statistics ascRxStatistics;
+ * Ifx_Fifo_registerStatistics(asc.rx, &ascRxStatistics, "asc0.rx");
+ *
+ * // shell command
+ * const Ifx_Fifo_Statistics *statistics;
+ * for (statistics = Ifx_Fifo_getStatisticsList(); statistics != NULL_PTR; statistics = statistics->next)
+ * {
+ *     IfxStdIf_DPipe_print(io, "%s: size=%d max=%d overflows=%d" ENDL, statistics->name, statistics->fifo->size,
+ *         statistics->fifo->shared.maxcount, statistics->overflowCount);
+ * }
+ * \endcode
+ *
  */
 
 #ifndef IFX_FIFO_H
@@ -32,25 +75,102 @@
 //------------------------------------------------------------------------------
 #include "Ifx_Cfg.h"
 #include "Cpu/Std/IfxCpu_Intrinsics.h"
+#include "Ifx_Pool.h"
 //------------------------------------------------------------------------------
 
+#ifndef IFX_CFG_FIFO_HEAP
+#define IFX_CFG_FIFO_HEAP (1)    /**< \brief If 0, \ref Ifx_Fifo_create() only allocates from the default pool and the heap is not used */
+#endif
+
+#ifndef IFX_CFG_FIFO_STATISTICS
+#define IFX_CFG_FIFO_STATISTICS (0)    /**< \brief If 1, the FIFOs can be instrumented with \ref Ifx_Fifo_registerStatistics() */
+#endif
+
+#ifndef IFX_CFG_FIFO_HISTOGRAM_BINS
+#define IFX_CFG_FIFO_HISTOGRAM_BINS (8)    /**< \brief Number of bins of the fill level histogram, each bin covers size / IFX_CFG_FIFO_HISTOGRAM_BINS bytes */
+#endif
+
+#ifndef IFX_CFG_FIFO_OVERFLOW_LOG
+#define IFX_CFG_FIFO_OVERFLOW_LOG (4)    /**< \brief Number of overflow time stamps kept, the newest ones */
+#endif
+
+/** FIFO synchronisation mode
+ *
+ */
+typedef enum
+{
+    Ifx_Fifo_Mode_locked    = 0,    /**< \brief shared data are protected by disabling the interrupts (default) */
+    Ifx_Fifo_Mode_spsc      = 1,    /**< \brief single producer / single consumer, lock free. See \ref Ifx_Fifo_initSpsc() */
+    Ifx_Fifo_Mode_overwrite = 2     /**< \brief the writer never waits, the oldest data are dropped when the buffer is full. See \ref Ifx_Fifo_initOverwrite() */
+} Ifx_Fifo_Mode;
+
 /** Shared data of the FIFO
  *
  */
 typedef struct
 {
-    Ifx_SizeT count;            /**< \brief number of bytes contained in the buffer */
-    sint32    readerWaitx;      /**< \brief Number of bytes that the reader is waiting for. When the writer modify it to 0 the reader get signaled */
-    sint32    writerWaitx;      /**< \brief Number of byte that the writer expect to be free. When the reader modify it to 0 the reader get signaled */
-    Ifx_SizeT maxcount;         /**< \brief Highest value seen in the count */
+    Ifx_SizeT       count;          /**< \brief number of bytes contained in the buffer */
+    sint32          readerWaitx;    /**< \brief Number of bytes that the reader is waiting for. When the writer modify it to 0 the reader get signaled. In SPSC mode: fill level the reader is waiting for */
+    sint32          writerWaitx;    /**< \brief Number of byte that the writer expect to be free. When the reader modify it to 0 the reader get signaled. In SPSC mode: free space the writer is waiting for */
+    Ifx_SizeT       maxcount;       /**< \brief Highest value seen in the count */
+    volatile uint32 writeTotal;     /**< \brief SPSC mode: monotonic number of bytes written, modified by the writer only */
+    volatile uint32 readTotal;      /**< \brief SPSC mode: monotonic number of bytes read, modified by the reader only */
+    uint32          lossCount;      /**< \brief Overwrite mode: number of bytes dropped to make room for newer data */
 } Ifx_Fifo_Shared;
 
 /** \addtogroup IfxLld_lib_datahandling_fifo
  * \{ */
+
+typedef struct _Fifo Ifx_Fifo;
+
+/** FIFO statistics, see \ref Ifx_Fifo_registerStatistics()
+ *
+ */
+typedef struct Ifx_Fifo_Statistics_
+{
+    struct Ifx_Fifo_Statistics_ *next;                                           /**< \brief next registered FIFO, NULL_PTR for the last one */
+    Ifx_Fifo                    *fifo;                                           /**< \brief instrumented FIFO */
+    const char                  *name;                                           /**< \brief FIFO name */
+    uint32                       fillHistogram[IFX_CFG_FIFO_HISTOGRAM_BINS];     /**< \brief number of writes per fill level after the write, bin n for n * size / IFX_CFG_FIFO_HISTOGRAM_BINS bytes and above */
+    Ifx_TickTime                 readWaitTime;                                   /**< \brief total time spent by the reader waiting for data, in system timer ticks */
+    Ifx_TickTime                 writeWaitTime;                                  /**< \brief total time spent by the writer waiting for free space, in system timer ticks */
+    uint32                       readWaitCount;                                  /**< \brief number of reader waits */
+    uint32                       writeWaitCount;                                 /**< \brief number of writer waits */
+    uint32                       overflowCount;                                  /**< \brief number of writes which could not store all their data, or dropped old data in overwrite mode */
+    Ifx_TickTime                 overflowTimes[IFX_CFG_FIFO_OVERFLOW_LOG];       /**< \brief time stamps of the newest overflows, overflowTimes[(overflowCount - 1) % IFX_CFG_FIFO_OVERFLOW_LOG] is the last one */
+} Ifx_Fifo_Statistics;
+
+/** \brief Wait function of a wait strategy
+ *
+ * Called repeatedly by a waiting reader or writer, until the event is set or the dead line is over.
+ * The function may return before, it shall not wait after the dead line.
+ * \param fifo Pointer on the Fifo object
+ * \param deadLine Dead line of the wait, TIME_INFINITE if the wait has no timeout
+ */
+typedef void (*Ifx_Fifo_WaitFunction)(Ifx_Fifo *fifo, Ifx_TickTime deadLine);
+
+/** \brief Signal function of a wait strategy
+ *
+ * Called after the reader or the writer sets the event of the other side, with the interrupts enabled
+ * in the default mode.
+ * \param fifo Pointer on the Fifo object
+ */
+typedef void (*Ifx_Fifo_SignalFunction)(Ifx_Fifo *fifo);
+
+/** Wait strategy
+ *
+ */
+typedef struct
+{
+    Ifx_Fifo_WaitFunction   wait;       /**< \brief called in the wait loop */
+    Ifx_Fifo_SignalFunction signal;     /**< \brief called when an event is set, NULL_PTR if not used */
+    void                   *data;       /**< \brief strategy data, for example the semaphore */
+} Ifx_Fifo_WaitStrategy;
+
 /** Fifo object
  *
  */
-typedef struct _Fifo
+struct _Fifo
 {
     void            *buffer;                /**< \brief aligned on 64 bit boundary */
     Ifx_Fifo_Shared  shared;                /**< \brief  data shared between reader / writer */
@@ -60,7 +180,13 @@ typedef struct _Fifo
     Ifx_SizeT        elementSize;           /**< \brief minimum number of bytes (block) added / removed to / from the buffer */
     volatile boolean eventReader;           /**< \brief event set by the writer to signal the reader that the required data are available in the buffer */
     volatile boolean eventWriter;           /**< \brief event set by the reader to signal the writer that the required free space are available in the buffer */
-} Ifx_Fifo;
+    Ifx_Fifo_Mode    mode;                  /**< \brief synchronisation mode between the reader and the writer */
+    Ifx_Pool        *pool;                  /**< \brief pool the object is allocated from, NULL_PTR if allocated from the heap or not allocated */
+    const Ifx_Fifo_WaitStrategy *waitStrategy;  /**< \brief wait strategy, NULL_PTR for the busy loop (default) */
+#if IFX_CFG_FIFO_STATISTICS
+    Ifx_Fifo_Statistics *statistics;        /**< \brief statistics, NULL_PTR if not registered */
+#endif
+};
 
 /** \brief Indicates if the required number of bytes are available in the buffer
  *
@@ -96,7 +222,8 @@ IFX_EXTERN void Ifx_Fifo_clear(Ifx_Fifo *fifo);
 
 /** \brief Create a Fifo object
  *
- * The memory required for the object is allocated dynamically.
+ * The memory required for the object is allocated from the default pool of the calling CPU
+ * (\ref Ifx_Pool_setDefault()), or from the heap if no default pool is set and IFX_CFG_FIFO_HEAP is 1.
  *
  * \param size Specifies the FIFO buffer size in bytes
  * \param elementSize Specifies data element size in bytes. size must be bigger or equal to elemenntSize.
@@ -107,9 +234,49 @@ IFX_EXTERN void Ifx_Fifo_clear(Ifx_Fifo *fifo);
  */
 IFX_EXTERN Ifx_Fifo *Ifx_Fifo_create(Ifx_SizeT size, Ifx_SizeT elementSize);
 
+/** \brief Create a Fifo object in a memory pool
+ *
+ * \param pool Pointer on the pool object
+ * \param size Specifies the FIFO buffer size in bytes
+ * \param elementSize Specifies data element size in bytes. size must be bigger or equal to elemenntSize.
+ *
+ * \return returns a pointer to the FIFO object, NULL_PTR if the pool is exhausted
+ *
+ * \see Ifx_Fifo_destroy()
+ */
+IFX_EXTERN Ifx_Fifo *Ifx_Fifo_createFromPool(Ifx_Pool *pool, Ifx_SizeT size, Ifx_SizeT elementSize);
+
+/** \brief Create a lock free single producer / single consumer Fifo object
+ *
+ * Same as \ref Ifx_Fifo_create(), the returned object is initialized with \ref Ifx_Fifo_initSpsc()
+ *
+ * \param size Specifies the FIFO buffer size in bytes
+ * \param elementSize Specifies data element size in bytes. size must be bigger or equal to elemenntSize.
+ *
+ * \return returns a pointer to the FIFO object
+ *
+ * \see Ifx_Fifo_destroy()
+ */
+IFX_EXTERN Ifx_Fifo *Ifx_Fifo_createSpsc(Ifx_SizeT size, Ifx_SizeT elementSize);
+
+/** \brief Create an overwrite-oldest Fifo object
+ *
+ * Same as \ref Ifx_Fifo_create(), the returned object is initialized with \ref Ifx_Fifo_initOverwrite()
+ *
+ * \param size Specifies the FIFO buffer size in bytes
+ * \param elementSize Specifies data element size in bytes. size must be a multiple of elementSize.
+ *
+ * \return returns a pointer to the FIFO object
+ *
+ * \see Ifx_Fifo_destroy()
+ */
+IFX_EXTERN Ifx_Fifo *Ifx_Fifo_createOverwrite(Ifx_SizeT size, Ifx_SizeT elementSize);
+
 /** \brief Destroy the FIFO object
  *
  * This function must be called to destroy the fifo object when created with \ref Ifx_Fifo_create()
+ * or \ref Ifx_Fifo_createFromPool(). The memory of an object allocated from a pool is reused only if
+ * it is the last block of the pool, see \ref Ifx_Pool_free()
  *
  * \param fifo Pointer on the Fifo object
  * \return void
@@ -133,6 +300,51 @@ IFX_EXTERN void Ifx_Fifo_destroy(Ifx_Fifo *fifo);
  */
 IFX_EXTERN Ifx_Fifo *Ifx_Fifo_init(void *buffer, Ifx_SizeT size, Ifx_SizeT elementSize);
 
+/** \brief Initialize a lock free single producer / single consumer FIFO buffer object
+ *
+ * The reader and the writer only exchange the monotonic counters Ifx_Fifo_Shared.writeTotal and
+ * Ifx_Fifo_Shared.readTotal, each of them being modified by one side only. \ref Ifx_Fifo_read(),
+ * \ref Ifx_Fifo_write(), \ref Ifx_Fifo_canReadCount() and \ref Ifx_Fifo_canWriteCount() do not disable
+ * the interrupts in this mode, the wait and timeout semantics are unchanged.
+ *
+ * \param buffer Specifies the FIFO object address.
+ * \param size Specifies the FIFO buffer size in bytes
+ * \param elementSize Specifies data element size in bytes. size must be bigger or equal to elemenntSize.
+ *
+ * \return Returns a pointer on the FIFO object
+ *
+ * \note Only one reader and one writer are allowed. \ref Ifx_Fifo_clear() is the only function
+ * which disables the interrupts, when the reader and the writer run on different CPUs it must be
+ * called from the reader side.
+ *
+ * \see Ifx_Fifo_init()
+ */
+IFX_EXTERN Ifx_Fifo *Ifx_Fifo_initSpsc(void *buffer, Ifx_SizeT size, Ifx_SizeT elementSize);
+
+/** \brief Initialize an overwrite-oldest FIFO buffer object
+ *
+ * Intended for telemetry, trace or lossy reception where the newest data matter: \ref Ifx_Fifo_write()
+ * never waits and always stores the complete elements. When the buffer is full, the oldest elements are
+ * removed by advancing the reader index, and counted in Ifx_Fifo_Shared.lossCount (\ref Ifx_Fifo_getLossCount()).
+ * The newest size bytes are therefore always available to the reader.
+ *
+ * The writer and the reader exchange the data with the interrupts disabled, the reader copies the data
+ * inside its critical section so that they can not be overwritten during the copy. The wait and timeout
+ * semantics of the reader are unchanged.
+ *
+ * \param buffer Specifies the FIFO object address.
+ * \param size Specifies the FIFO buffer size in bytes
+ * \param elementSize Specifies data element size in bytes. size must be a multiple of elementSize.
+ *
+ * \return Returns a pointer on the FIFO object
+ *
+ * \note The reader and the writer must run on the same CPU. \ref Ifx_Fifo_peekRead() is not supported
+ * in this mode, as the data returned may be overwritten.
+ *
+ * \see Ifx_Fifo_init()
+ */
+IFX_EXTERN Ifx_Fifo *Ifx_Fifo_initOverwrite(void *buffer, Ifx_SizeT size, Ifx_SizeT elementSize);
+
 /** \brief Read data from a fifo and remove them from the buffer.
  *
  * Only complete elements are returned, if count is not a multiple of
@@ -152,6 +364,8 @@ IFX_EXTERN Ifx_SizeT Ifx_Fifo_read(Ifx_Fifo *fifo, void *data, Ifx_SizeT count,
  * Only complete elements are written to the buffer, if count is not a multiple of
  * elementSize then the incomplete element are not written to the buffer.
  *
+ * In overwrite mode the function never waits, the oldest elements are dropped if required.
+ *
  * \param fifo Pointer on the Fifo object
  * \param data Pointer to the data buffer to write into the Fifo
  * \param count in bytes
@@ -159,6 +373,107 @@ IFX_EXTERN Ifx_SizeT Ifx_Fifo_read(Ifx_Fifo *fifo, void *data, Ifx_SizeT count,
  */
 IFX_EXTERN Ifx_SizeT Ifx_Fifo_write(Ifx_Fifo *fifo, const void *data, Ifx_SizeT count, Ifx_TickTime timeout);
 
+/** \brief Reserve free space in the fifo to be written in place
+ *
+ * Returns the first contiguous free region after the last written data. When the free space wraps
+ * around the end of the buffer, the remaining part is returned by the next call, after
+ * \ref Ifx_Fifo_commitWrite(). The data become visible to the reader only when committed.
+ *
+ * The fifo size must be a multiple of the element size, else an element might be split by the ring end.
+ * Only one writer is allowed, the reserved region must not be modified by \ref Ifx_Fifo_write() before it is committed.
+ *
+ * \param fifo Pointer on the Fifo object
+ * \param data Returns the pointer to the reserved region
+ * \param count Returns the size of the reserved region in bytes, multiple of elementSize. 0 if the fifo is full
+ *
+ * \return Returns the total free space in bytes, which may be bigger than count
+ *
+ * \code
+ *     uint8     *frame;
+ *     Ifx_SizeT  length;
+ *
+ *     Ifx_Fifo_reserveWrite(fifo, (void **)&frame, &length);
+ *
+ *     if (length >= FRAME_SIZE)
+ *     {
+ *         buildFrame(frame);
+ *         Ifx_Fifo_commitWrite(fifo, FRAME_SIZE);
+ *     }
+ * \endcode
+ */
+IFX_EXTERN Ifx_SizeT Ifx_Fifo_reserveWrite(Ifx_Fifo *fifo, void **data, Ifx_SizeT *count);
+
+/** \brief Publish count bytes written in place to the reader
+ *
+ * \param fifo Pointer on the Fifo object
+ * \param count Number of bytes written, must be a multiple of elementSize and lower or equal to the count returned by \ref Ifx_Fifo_reserveWrite()
+ *
+ * \return void
+ */
+IFX_EXTERN void Ifx_Fifo_commitWrite(Ifx_Fifo *fifo, Ifx_SizeT count);
+
+/** \brief Get the data available in the fifo to be read in place
+ *
+ * Returns the first contiguous region of available data. When the data wrap around the end of the
+ * buffer, the remaining part is returned by the next call, after \ref Ifx_Fifo_releaseRead().
+ * The data are not removed from the fifo until they are released.
+ *
+ * The fifo size must be a multiple of the element size, else an element might be split by the ring end.
+ *
+ * \param fifo Pointer on the Fifo object
+ * \param data Returns the pointer to the available data
+ * \param count Returns the size of the region in bytes, multiple of elementSize. 0 if the fifo is empty
+ *
+ * \return Returns the total number of bytes available in the fifo, which may be bigger than count
+ */
+IFX_EXTERN Ifx_SizeT Ifx_Fifo_peekRead(Ifx_Fifo *fifo, const void **data, Ifx_SizeT *count);
+
+/** \brief Remove count bytes read in place from the fifo
+ *
+ * \param fifo Pointer on the Fifo object
+ * \param count Number of bytes to release, must be a multiple of elementSize and lower or equal to the count returned by \ref Ifx_Fifo_peekRead()
+ *
+ * \return void
+ */
+IFX_EXTERN void Ifx_Fifo_releaseRead(Ifx_Fifo *fifo, Ifx_SizeT count);
+
+#if IFX_CFG_FIFO_STATISTICS
+/** \brief Returns the first registered FIFO statistics, the others are chained with Ifx_Fifo_Statistics.next
+ *
+ * \return Returns the first registered statistics, NULL_PTR if none
+ */
+IFX_EXTERN const Ifx_Fifo_Statistics *Ifx_Fifo_getStatisticsList(void);
+
+/** \brief Instrument a FIFO and add it to the registry
+ *
+ * Shall be called during the initialisation, before the FIFO is used and from one CPU at a time.
+ * \param fifo Pointer on the Fifo object
+ * \param statistics Pointer on the statistics, reset by the function
+ * \param name FIFO name, shall remain valid
+ *
+ * \return void
+ */
+IFX_EXTERN void Ifx_Fifo_registerStatistics(Ifx_Fifo *fifo, Ifx_Fifo_Statistics *statistics, const char *name);
+
+/** \brief Reset the statistics of a FIFO, and its maximal fill level
+ *
+ * \param fifo Pointer on the Fifo object
+ *
+ * \return void
+ */
+IFX_EXTERN void Ifx_Fifo_resetStatistics(Ifx_Fifo *fifo);
+#endif
+
+/** \brief Set the wait strategy of the reader and the writer
+ *
+ * Shall be called before the FIFO is used by the reader and the writer.
+ * \param fifo Pointer on the Fifo object
+ * \param strategy Pointer on the wait strategy, NULL_PTR for the busy loop
+ *
+ * \return void
+ */
+IFX_EXTERN void Ifx_Fifo_setWaitStrategy(Ifx_Fifo *fifo, const Ifx_Fifo_WaitStrategy *strategy);
+
 /** \brief Empty the fifo
  *
  * \param fifo Pointer on the Fifo object
@@ -185,7 +500,18 @@ IFX_INLINE boolean Ifx_Fifo_flush(Ifx_Fifo *fifo, Ifx_TickTime timeout)
  */
 IFX_INLINE Ifx_SizeT Ifx_Fifo_readCount(Ifx_Fifo *fifo)
 {
-    return fifo->shared.count;
+    Ifx_SizeT count;
+
+    if (fifo->mode == Ifx_Fifo_Mode_spsc)
+    {
+        count = (Ifx_SizeT)(fifo->shared.writeTotal - fifo->shared.readTotal);
+    }
+    else
+    {
+        count = fifo->shared.count;
+    }
+
+    return count;
 }
 
 
@@ -205,6 +531,20 @@ IFX_INLINE Ifx_SizeT Ifx_Fifo_writeCount(Ifx_Fifo *fifo)
 }
 
 
+/** \brief Returns the number of bytes dropped in overwrite mode
+ *
+ * \param fifo Pointer on the Fifo object
+ *
+ * \return Returns the number of bytes removed by the writer to make room for newer data
+ *
+ * \see Ifx_Fifo_initOverwrite()
+ */
+IFX_INLINE uint32 Ifx_Fifo_getLossCount(Ifx_Fifo *fifo)
+{
+    return fifo->shared.lossCount;
+}
+
+
 /** \brief Indicates if the fifo is empty
  *
  * \param fifo Pointer on the Ifx_Fifo object
@@ -0,0 +1,248 @@
+/**
+ * \file Ifx_FifoMc.h
+ * \brief Multi-core FIFO buffer functions
+ * \ingroup IfxLld_lib_datahandling_fifomc
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup IfxLld_lib_datahandling_fifomc Multi-core FIFO
+ * This module implements a FIFO to exchange data between one writer CPU and one reader CPU.
+ *
+ * The FIFO object is split in two cache lines: the writer side is only modified by the
+ * writer CPU and the reader side is only modified by the reader CPU. No spinlock, mutex or
+ * interrupt lock is used. The only shared data are the monotonic byte counters of each side.
+ *
+ * The FIFO must be located in a memory which is visible by both CPUs without cache
+ * coherency issue: non cached LMU (segment 0xB) or a DSPR accessed through its global
+ * address. \ref Ifx_FifoMc_init() converts a local DSPR address into its global address,
+ * the returned pointer must be used by both CPUs.
+ *
+ * A waiting side polls the counter of the other side. In addition, a service request
+ * (e.g. a GPSR of the waiting CPU) can be registered with \ref Ifx_FifoMc_setReaderNotification()
+ * and \ref Ifx_FifoMc_setWriterNotification(): it is triggered by the other side when the
+ * armed level is reached, so that the waiting CPU can be woken up from an interrupt
+ * instead of polling.
+ *
+ * Usage example: data acquisition on CPU1, logging on CPU0
+ * \code
+ * // located in the non cached LMU by the linker file
+ * uint8 logFifoBuffer[IFX_FIFOMC_BUFFER_SIZE(1024)];
+ * Ifx_FifoMc *logFifo;
+ *
+ * // CPU0, before starting CPU1
+ * logFifo = Ifx_FifoMc_init(logFifoBuffer, 1024, sizeof(Sample));
+ *
+ * // CPU1
+ * Ifx_FifoMc_write(logFifo, &sample, sizeof(sample), TIME_NULL);
+ *
+ * // CPU0
+ * if (Ifx_FifoMc_canReadCount(logFifo, 16 * sizeof(Sample), TimeConst_1ms) != FALSE)
+ * {
+ *     Ifx_FifoMc_read(logFifo, samples, 16 * sizeof(Sample), TIME_NULL);
+ * }
+ * \endcode
+ *
+ * \ingroup IfxLld_lib_datahandling
+ *
+ */
+
+#ifndef IFX_FIFOMC_H
+#define IFX_FIFOMC_H 1
+//------------------------------------------------------------------------------
+#include "Ifx_Cfg.h"
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+#include "Src/Std/IfxSrc.h"
+//------------------------------------------------------------------------------
+
+/** \brief Data cache line size in bytes */
+#define IFX_FIFOMC_CACHE_LINE_SIZE (32)
+
+/** \brief Size in bytes of the memory required by \ref Ifx_FifoMc_init() for a FIFO of size bytes */
+#define IFX_FIFOMC_BUFFER_SIZE(size) (Ifx_AlignOn32(size) + sizeof(Ifx_FifoMc) + IFX_FIFOMC_CACHE_LINE_SIZE)
+
+/** \brief Maximum FIFO size in bytes, the buffer index and the highest count are 16 bit */
+#define IFX_FIFOMC_MAX_SIZE          (0xFFF8)
+
+/** \addtogroup IfxLld_lib_datahandling_fifomc
+ * \{ */
+
+/** Data owned by one side of the FIFO, padded to one cache line
+ *
+ */
+typedef struct
+{
+    volatile uint32        total;           /**< \brief monotonic number of bytes written (writer side) or read (reader side) */
+    volatile sint32        waitLevel;       /**< \brief fill level (reader) or free space (writer) this side is waiting for, 0 if not waiting */
+    volatile Ifx_SRC_SRCR *src;             /**< \brief service request triggered by the other side when waitLevel is reached, NULL_PTR if not used */
+    uint16                 index;           /**< \brief buffer index, used by this side only */
+    uint16                 maxcount;        /**< \brief writer side: highest value seen in the count */
+    uint32                 reserved[4];     /**< \brief padding to IFX_FIFOMC_CACHE_LINE_SIZE */
+} Ifx_FifoMc_Side;
+
+/** Multi-core Fifo object
+ *
+ */
+typedef struct
+{
+    Ifx_FifoMc_Side writer;                 /**< \brief modified by the writer CPU only */
+    Ifx_FifoMc_Side reader;                 /**< \brief modified by the reader CPU only */
+    void           *buffer;                 /**< \brief global address, aligned on 64 bit boundary */
+    Ifx_SizeT       size;                   /**< \brief multiple of 8 bit, max \ref IFX_FIFOMC_MAX_SIZE */
+    Ifx_SizeT       elementSize;            /**< \brief minimum number of bytes (block) added / removed to / from the buffer */
+} Ifx_FifoMc;
+
+/** \brief Initialize the multi-core FIFO buffer object
+ *
+ * \param buffer Specifies the FIFO object address. The size of this area must be at least \ref IFX_FIFOMC_BUFFER_SIZE(size)
+ * \param size Specifies the FIFO buffer size in bytes
+ * \param elementSize Specifies data element size in bytes. size must be bigger or equal to elemenntSize.
+ *
+ * \return Returns the global address of the FIFO object, to be used by the reader and the writer CPU
+ */
+IFX_EXTERN Ifx_FifoMc *Ifx_FifoMc_init(void *buffer, Ifx_SizeT size, Ifx_SizeT elementSize);
+
+/** \brief Indicates if the required number of bytes are available in the buffer
+ *
+ * Must be called by the reader CPU. Should not be called from an interrupt as this function may wait forever
+ * \param fifo Pointer on the Fifo object
+ * \param count in bytes
+ * \param timeout in system timer ticks
+ *
+ * \return TRUE if at least count bytes can be read from the buffer, else
+ * the reader notification is armed to be triggered when the buffer count is bigger or equal to the requested count
+ */
+IFX_EXTERN boolean Ifx_FifoMc_canReadCount(Ifx_FifoMc *fifo, Ifx_SizeT count, Ifx_TickTime timeout);
+
+/** \brief Indicates if there is enough free space to write the data in the buffer
+ *
+ * Must be called by the writer CPU. Should not be called from an interrupt as this function may wait forever
+ * \param fifo Pointer on the Fifo object
+ * \param count in bytes
+ * \param timeout in system timer ticks
+ *
+ * \return TRUE if at least count bytes can be written to the buffer, else
+ * the writer notification is armed to be triggered when the buffer free count is bigger or equal to the requested count
+ */
+IFX_EXTERN boolean Ifx_FifoMc_canWriteCount(Ifx_FifoMc *fifo, Ifx_SizeT count, Ifx_TickTime timeout);
+
+/** \brief Drop the data available in the fifo
+ *
+ * Must be called by the reader CPU.
+ * \param fifo Pointer on the Fifo object
+ *
+ * \return void
+ */
+IFX_EXTERN void Ifx_FifoMc_clear(Ifx_FifoMc *fifo);
+
+/** \brief Read data from a fifo and remove them from the buffer.
+ *
+ * Must be called by the reader CPU. Only complete elements are returned, if count is not a multiple of
+ * elementSize then the incomplete element is not read/removed from the buffer.
+ *
+ * \param fifo Pointer on the Fifo object
+ * \param data Pointer to the data buffer for storing values
+ * \param count in bytes
+ * \param timeout in system timer ticks
+ *
+ * \return return the number of byte that could not be read
+ */
+IFX_EXTERN Ifx_SizeT Ifx_FifoMc_read(Ifx_FifoMc *fifo, void *data, Ifx_SizeT count, Ifx_TickTime timeout);
+
+/** \brief Write data into a fifo.
+ *
+ * Must be called by the writer CPU. Only complete elements are written to the buffer, if count is not a multiple of
+ * elementSize then the incomplete element are not written to the buffer.
+ *
+ * \param fifo Pointer on the Fifo object
+ * \param data Pointer to the data buffer to write into the Fifo
+ * \param count in bytes
+ * \param timeout in system timer ticks
+ *
+ * \return return the number of byte that could not be written
+ */
+IFX_EXTERN Ifx_SizeT Ifx_FifoMc_write(Ifx_FifoMc *fifo, const void *data, Ifx_SizeT count, Ifx_TickTime timeout);
+
+/** \brief Returns the size of the data in the buffer in bytes
+ *
+ * \param fifo Pointer on the Fifo object
+ *
+ * \return Returns the size of the data in the buffer in bytes
+ */
+IFX_INLINE Ifx_SizeT Ifx_FifoMc_readCount(Ifx_FifoMc *fifo)
+{
+    return (Ifx_SizeT)(fifo->writer.total - fifo->reader.total);
+}
+
+
+/** \brief Returns the free size in bytes
+ *
+ * \param fifo Pointer on the Fifo object
+ *
+ * \return Returns the free size in bytes
+ */
+IFX_INLINE Ifx_SizeT Ifx_FifoMc_writeCount(Ifx_FifoMc *fifo)
+{
+    return (Ifx_SizeT)(fifo->size - Ifx_FifoMc_readCount(fifo));
+}
+
+
+/** \brief Indicates if the fifo is empty
+ *
+ * \param fifo Pointer on the Fifo object
+ *
+ * \retval TRUE is the buffer is empty
+ * \retval FALSE is the buffer is not empty
+ */
+IFX_INLINE boolean Ifx_FifoMc_isEmpty(Ifx_FifoMc *fifo)
+{
+    return (Ifx_FifoMc_readCount(fifo) != 0) ? FALSE : TRUE;
+}
+
+
+/** \brief Register the service request triggered by the writer when the level armed by the reader is reached
+ *
+ * Must be called by the reader CPU. The service request is typically a GPSR routed to the reader CPU.
+ * \param fifo Pointer on the Fifo object
+ * \param src Service request, NULL_PTR to disable the notification
+ *
+ * \return void
+ */
+IFX_INLINE void Ifx_FifoMc_setReaderNotification(Ifx_FifoMc *fifo, volatile Ifx_SRC_SRCR *src)
+{
+    fifo->reader.src = src;
+}
+
+
+/** \brief Register the service request triggered by the reader when the level armed by the writer is reached
+ *
+ * Must be called by the writer CPU. The service request is typically a GPSR routed to the writer CPU.
+ * \param fifo Pointer on the Fifo object
+ * \param src Service request, NULL_PTR to disable the notification
+ *
+ * \return void
+ */
+IFX_INLINE void Ifx_FifoMc_setWriterNotification(Ifx_FifoMc *fifo, volatile Ifx_SRC_SRCR *src)
+{
+    fifo->writer.src = src;
+}
+
+
+/**\}*/
+//------------------------------------------------------------------------------
+#endif
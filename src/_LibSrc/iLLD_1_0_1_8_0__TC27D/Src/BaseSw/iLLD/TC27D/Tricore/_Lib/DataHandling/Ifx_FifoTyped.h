@@ -0,0 +1,168 @@
+/**
+ * \file Ifx_FifoTyped.h
+ * \brief Typed FIFO of fixed size elements
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup IfxLld_lib_datahandling_fifotyped Typed FIFO
+ * This module implements FIFOs of fixed size elements, generated at compile time for one element type.
+ * \ingroup IfxLld_lib_datahandling
+ *
+ * \ref IFX_FIFO_DEFINE(name, type, depth) declares the FIFO type name and its inline functions:
+ * - void name_init(name *fifo): empties the FIFO.
+ * - boolean name_put(name *fifo, const type *element): adds one element, returns FALSE if the FIFO is full.
+ * - boolean name_get(name *fifo, type *element): removes one element, returns FALSE if the FIFO is empty.
+ * - Ifx_SizeT name_write(name *fifo, const type *elements, Ifx_SizeT count): adds up to count elements, returns
+ * the number of elements added.
+ * - Ifx_SizeT name_read(name *fifo, type *elements, Ifx_SizeT count): removes up to count elements, returns the
+ * number of elements removed.
+ * - Ifx_SizeT name_getCount(const name *fifo), Ifx_SizeT name_getFreeCount(const name *fifo): number of
+ * elements in the FIFO, number of elements which can be added.
+ *
+ * Unlike \ref Ifx_Fifo, which stays the byte FIFO of \ref IfxStdIf_DPipe, the element size and the depth are
+ * constants: the index is masked with depth - 1 (depth shall be a power of 2, checked at compile time), the
+ * elements are copied by structure assignment and no division is needed.
+ *
+ * The FIFO is lock free for a single producer and a single consumer, each side may run in a task, an interrupt
+ * or another CPU: the writer only modifies writeTotal, the reader only modifies readTotal. With several
+ * producers or consumers on the same side, the calls shall be protected, for example by disabling the
+ * interrupts. If the producer and the consumer run on different CPUs, the FIFO shall be located in a memory
+ * which is visible by both CPUs without cache coherency issue (non cached LMU, or global DSPR address).
+ *
+ * Usage example:
+ * \code
+ * typedef struct {uint32 id; uint8 data[8]; uint32 time;} CanFrame;
+ * IFX_FIFO_DEFINE(CanFrameFifo, CanFrame, 32)
+ *
+ * static CanFrameFifo rxFifo;
+ *
+ * CanFrameFifo_init(&rxFifo);
+ *
+ * // receive interrupt
+ * CanFrameFifo_put(&rxFifo, &frame);
+ *
+ * // background loop
+ * CanFrame frame;
+ * while (CanFrameFifo_get(&rxFifo, &frame) != FALSE)
+ * {
+ *     processFrame(&frame);
+ * }
+ * \endcode
+ *
+ */
+
+#ifndef IFX_FIFOTYPED_H
+#define IFX_FIFOTYPED_H 1
+//------------------------------------------------------------------------------
+#include "Ifx_Cfg.h"
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+//------------------------------------------------------------------------------
+
+/** \addtogroup IfxLld_lib_datahandling_fifotyped
+ * \{ */
+
+/** \brief Declare the typed FIFO name of depth elements of type, and its inline functions
+ *
+ * \param name Name of the FIFO type, prefix of its functions
+ * \param type Type of the elements
+ * \param depth Number of elements, power of 2
+ */
+#define IFX_FIFO_DEFINE(name, type, depth)                                                                \
+    typedef struct                                                                                        \
+    {                                                                                                     \
+        type            elements[depth];  /**< \brief elements */                                         \
+        volatile uint32 writeTotal;       /**< \brief elements written, modified by the writer only */    \
+        volatile uint32 readTotal;        /**< \brief elements read, modified by the reader only */       \
+    } name;                                                                                               \
+                                                                                                          \
+    typedef char name##_DepthCheck[((((depth) & ((depth) - 1)) == 0) && ((depth) > 0)) ? 1 : -1];         \
+                                                                                                          \
+    IFX_INLINE void name##_init(name *fifo)                                                               \
+    {                                                                                                     \
+        fifo->writeTotal = 0;                                                                             \
+        fifo->readTotal  = 0;                                                                             \
+    }                                                                                                     \
+                                                                                                          \
+    IFX_INLINE Ifx_SizeT name##_getCount(const name *fifo)                                                \
+    {                                                                                                     \
+        return (Ifx_SizeT)(fifo->writeTotal - fifo->readTotal);                                           \
+    }                                                                                                     \
+                                                                                                          \
+    IFX_INLINE Ifx_SizeT name##_getFreeCount(const name *fifo)                                            \
+    {                                                                                                     \
+        return (Ifx_SizeT)((depth) - (fifo->writeTotal - fifo->readTotal));                               \
+    }                                                                                                     \
+                                                                                                          \
+    IFX_INLINE Ifx_SizeT name##_write(name *fifo, const type *elements, Ifx_SizeT count)                  \
+    {                                                                                                     \
+        uint32    writeTotal = fifo->writeTotal;                                                          \
+        Ifx_SizeT freeCount  = (Ifx_SizeT)((depth) - (writeTotal - fifo->readTotal));                     \
+        Ifx_SizeT index;                                                                                  \
+                                                                                                          \
+        if (count > freeCount)                                                                            \
+        {                                                                                                 \
+            count = freeCount;                                                                            \
+        }                                                                                                 \
+                                                                                                          \
+        for (index = 0; index < count; index++)                                                           \
+        {                                                                                                 \
+            fifo->elements[(writeTotal + index) & ((depth) - 1)] = elements[index];                       \
+        }                                                                                                 \
+                                                                                                          \
+        __dsync();      /* The elements must be visible before they are published */                      \
+        fifo->writeTotal = writeTotal + count;                                                            \
+                                                                                                          \
+        return count;                                                                                     \
+    }                                                                                                     \
+                                                                                                          \
+    IFX_INLINE Ifx_SizeT name##_read(name *fifo, type *elements, Ifx_SizeT count)                         \
+    {                                                                                                     \
+        uint32    readTotal = fifo->readTotal;                                                            \
+        Ifx_SizeT available = (Ifx_SizeT)(fifo->writeTotal - readTotal);                                  \
+        Ifx_SizeT index;                                                                                  \
+                                                                                                          \
+        if (count > available)                                                                            \
+        {                                                                                                 \
+            count = available;                                                                            \
+        }                                                                                                 \
+                                                                                                          \
+        for (index = 0; index < count; index++)                                                           \
+        {                                                                                                 \
+            elements[index] = fifo->elements[(readTotal + index) & ((depth) - 1)];                        \
+        }                                                                                                 \
+                                                                                                          \
+        __dsync();      /* The elements must be read before they are released to the writer */            \
+        fifo->readTotal = readTotal + count;                                                              \
+                                                                                                          \
+        return count;                                                                                     \
+    }                                                                                                     \
+                                                                                                          \
+    IFX_INLINE boolean name##_put(name *fifo, const type *element)                                        \
+    {                                                                                                     \
+        return name##_write(fifo, element, 1) != 0;                                                       \
+    }                                                                                                     \
+                                                                                                          \
+    IFX_INLINE boolean name##_get(name *fifo, type *element)                                              \
+    {                                                                                                     \
+        return name##_read(fifo, element, 1) != 0;                                                        \
+    }
+
+/** \} */
+//------------------------------------------------------------------------------
+#endif
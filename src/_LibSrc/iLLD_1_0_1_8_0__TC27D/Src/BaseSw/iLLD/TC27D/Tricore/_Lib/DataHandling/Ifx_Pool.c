@@ -0,0 +1,109 @@
+/**
+ * \file Ifx_Pool.c
+ * \brief Static memory pool
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+//------------------------------------------------------------------------------
+#include "Ifx_Pool.h"
+#include "_Utilities/Ifx_Assert.h"
+#include "Cpu/Std/IfxCpu.h"
+//------------------------------------------------------------------------------
+/** Default pool of each CPU
+ */
+static Ifx_Pool *Ifx_Pool_default[IFXCPU_NUM_MODULES];
+//------------------------------------------------------------------------------
+void *Ifx_Pool_alloc(Ifx_Pool *pool, uint32 size)
+{
+    uint8  *block = NULL_PTR;
+    boolean interruptState;
+
+    size           = Ifx_AlignOn64(size);
+    interruptState = IfxCpu_disableInterrupts();
+
+    if (size <= (uint32)(pool->end - pool->next))
+    {
+        block      = pool->next;
+        pool->next = &block[size];
+        pool->last = block;
+        pool->peak = __max(pool->peak, (uint32)(pool->next - pool->start));
+    }
+    else
+    {
+        pool->failed++;
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+
+    return block;
+}
+
+
+void Ifx_Pool_free(Ifx_Pool *pool, void *block)
+{
+    boolean interruptState = IfxCpu_disableInterrupts();
+
+    if ((block != NULL_PTR) && (block == pool->last))
+    {
+        pool->next = pool->last;
+        pool->last = NULL_PTR;
+    }
+
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+
+Ifx_Pool *Ifx_Pool_getDefault(void)
+{
+    return Ifx_Pool_default[IfxCpu_getCoreIndex()];
+}
+
+
+void Ifx_Pool_init(Ifx_Pool *pool, void *buffer, uint32 size)
+{
+    uint32 start = Ifx_AlignOn64((uint32)buffer);
+
+    IFX_ASSERT(IFX_VERBOSE_LEVEL_ERROR, (buffer != NULL_PTR) && (size >= (start - (uint32)buffer)));
+
+    pool->start  = (uint8 *)start;
+    pool->end    = (uint8 *)(((uint32)buffer + size) & ~(uint32)(IFX_ALIGN_64 - 1));
+    pool->next   = pool->start;
+    pool->last   = NULL_PTR;
+    pool->peak   = 0;
+    pool->failed = 0;
+}
+
+
+void Ifx_Pool_reset(Ifx_Pool *pool)
+{
+    boolean interruptState = IfxCpu_disableInterrupts();
+
+    pool->next = pool->start;
+    pool->last = NULL_PTR;
+
+    IfxCpu_restoreInterrupts(interruptState);
+}
+
+
+void Ifx_Pool_setDefault(Ifx_Pool *pool)
+{
+    Ifx_Pool_default[IfxCpu_getCoreIndex()] = pool;
+}
@@ -0,0 +1,150 @@
+/**
+ * \file Ifx_Pool.h
+ * \brief Static memory pool
+ * \ingroup IfxLld_lib_datahandling_pool
+ *
+ * \version iLLD_1_0_1_8_0
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Infineon Technologies AG (Infineon) is supplying this file for use
+ * exclusively with Infineon's microcontroller products. This file can be freely
+ * distributed within development tools that are supporting such microcontroller
+ * products.
+ *
+ * THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ * OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * INFINEON SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ * OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ *
+ * \defgroup IfxLld_lib_datahandling_pool Memory pool
+ * This module implements a deterministic arena allocator, used instead of the heap.
+ * \ingroup IfxLld_lib_datahandling
+ *
+ * A pool is a static memory area from which the objects created at the initialisation (FIFOs of the
+ * drivers, buffers of the services) are allocated. The allocation is O(1): the blocks are taken one after
+ * the other, aligned on 64 bit, and are not freed individually. Only the last allocated block can be
+ * returned with \ref Ifx_Pool_free(), so that an object created and destroyed in turn does not consume the
+ * pool. \ref Ifx_Pool_reset() returns all blocks at once.
+ *
+ * Each CPU has a default pool, set with \ref Ifx_Pool_setDefault(). \ref Ifx_Fifo_create() allocates from
+ * the default pool of the calling CPU when it is set, else from the heap. With IFX_CFG_FIFO_HEAP set to 0,
+ * the heap is not used at all.
+ *
+ * The pool memory is placed with the linker, e.g. in the DSPR of the CPU using the objects, or in the LMU
+ * for objects shared between the CPUs:
+ * \code
+ * BEGIN_DATA_SECTION(.bss_cpu1)
+ * static uint64 cpu1PoolMemory[4096 / 8];
+ * END_DATA_SECTION
+ *
+ * static Ifx_Pool cpu1Pool;
+ *
+ * // on CPU1, before the drivers initialisation
+ * Ifx_Pool_init(&cpu1Pool, cpu1PoolMemory, sizeof(cpu1PoolMemory));
+ * Ifx_Pool_setDefault(&cpu1Pool);
+ *
+ * IfxAsclin_Asc_initModule(&asc, &ascConfig);   // the FIFOs are allocated from cpu1Pool
+ * \endcode
+ *
+ * The functions disable the interrupts during the allocation. A pool shall be used by one CPU only.
+ *
+ */
+
+#ifndef IFX_POOL_H
+#define IFX_POOL_H 1
+
+//---------------------------------------------------------------------------
+#include "Cpu/Std/IfxCpu_Intrinsics.h"
+//---------------------------------------------------------------------------
+
+/** \addtogroup IfxLld_lib_datahandling_pool
+ * \{
+ */
+/** Pool object
+ *
+ */
+typedef struct
+{
+    uint8 *start;           /**< \brief first byte of the pool, aligned on 64 bit */
+    uint8 *end;             /**< \brief first byte after the pool */
+    uint8 *next;            /**< \brief next free byte, aligned on 64 bit */
+    uint8 *last;            /**< \brief last allocated block, NULL_PTR if already freed */
+    uint32 peak;            /**< \brief highest number of allocated bytes */
+    uint32 failed;          /**< \brief number of failed allocations */
+} Ifx_Pool;
+
+/** \brief Allocate a block from the pool
+ *
+ * \param pool Pointer on the pool object
+ * \param size Specifies the block size in bytes
+ *
+ * \return Returns a pointer on the block, aligned on 64 bit, or NULL_PTR if the pool is exhausted
+ */
+IFX_EXTERN void *Ifx_Pool_alloc(Ifx_Pool *pool, uint32 size);
+
+/** \brief Return a block to the pool
+ *
+ * The memory is reused only if the block is the last allocated one, else it stays allocated until
+ * \ref Ifx_Pool_reset() is called.
+ *
+ * \param pool Pointer on the pool object
+ * \param block Pointer on the block
+ *
+ * \return void
+ */
+IFX_EXTERN void Ifx_Pool_free(Ifx_Pool *pool, void *block);
+
+/** \brief Return the default pool of the calling CPU
+ *
+ * \return Returns the pool set by \ref Ifx_Pool_setDefault() on the calling CPU, or NULL_PTR if none
+ */
+IFX_EXTERN Ifx_Pool *Ifx_Pool_getDefault(void);
+
+/** \brief Return the number of free bytes of the pool
+ *
+ * \param pool Pointer on the pool object
+ *
+ * \return Returns the number of free bytes
+ */
+IFX_INLINE uint32 Ifx_Pool_getFreeSize(const Ifx_Pool *pool)
+{
+    return (uint32)(pool->end - pool->next);
+}
+
+
+/** \brief Initialize the pool object
+ *
+ * \param pool Pointer on the pool object
+ * \param buffer Specifies the pool memory
+ * \param size Specifies the pool memory size in bytes
+ *
+ * \return void
+ */
+IFX_EXTERN void Ifx_Pool_init(Ifx_Pool *pool, void *buffer, uint32 size);
+
+/** \brief Return all the blocks to the pool
+ *
+ * The objects allocated from the pool shall not be used anymore.
+ *
+ * \param pool Pointer on the pool object
+ *
+ * \return void
+ */
+IFX_EXTERN void Ifx_Pool_reset(Ifx_Pool *pool);
+
+/** \brief Set the default pool of the calling CPU
+ *
+ * \param pool Pointer on the pool object, NULL_PTR to use the heap again
+ *
+ * \return void
+ */
+IFX_EXTERN void Ifx_Pool_setDefault(Ifx_Pool *pool);
+
+/** \}  */
+//------------------------------------------------------------------------------
+#endif
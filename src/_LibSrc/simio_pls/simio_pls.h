@@ -15,6 +15,10 @@
 #ifndef __SIMIO_H__
 #define __SIMIO_H__
 
+/* non blocking mode: the reads return immediately, the writes overwrite
+ * the oldest messages not yet read by the host, a message being the data
+ * of one SIMIO_Write() call. Whole messages are dropped, a message bigger
+ * than the buffer is dropped, see SIMIO_GetLostByteCount() */
 #define SIMIO_NONBLOCKINGMODE	0x0001
 
 void SIMIO_Init(unsigned int Mode);
@@ -25,4 +29,13 @@ unsigned int SIMIO_GetHTCharCount(void);
 unsigned char SIMIO_GetByteFromHost(void);
 void SIMIO_PutByteToHost(unsigned char Data);
 
+/* bulk transfers: Count bytes are copied with at most two memcpy() calls
+ * per buffer wrap.  SIMIO_Read() returns the number of bytes read, at least
+ * one in blocking mode. SIMIO_Write() returns Count */
+unsigned int SIMIO_Read(void *Data, unsigned int Count);
+unsigned int SIMIO_Write(const void *Data, unsigned int Count);
+
+/* number of bytes overwritten or dropped in non blocking mode */
+unsigned int SIMIO_GetLostByteCount(void);
+
 #endif  /* __SIMIO_H__ */
@@ -16,6 +16,7 @@
 #include "simio_pls.h"
 
 #include <stdio.h>
+#include <string.h>
 
 
 // ***********************************************************************
@@ -27,22 +28,46 @@
 #define EOF		(1)
 #endif /* EOF */
 
-#define SIMIO_TARGET_BUFFER_SIZE		1024
+/* buffer sizes in bytes, up to 65535. The host reads them from g_JtagSimioAccess */
+#ifndef SIMIO_HT_BUFFER_SIZE
+#define SIMIO_HT_BUFFER_SIZE		1024
+#endif /* SIMIO_HT_BUFFER_SIZE */
 
-typedef struct tagSimIOBuffer
+#ifndef SIMIO_TH_BUFFER_SIZE
+#define SIMIO_TH_BUFFER_SIZE		1024
+#endif /* SIMIO_TH_BUFFER_SIZE */
+
+#if (SIMIO_HT_BUFFER_SIZE > 65535) || (SIMIO_TH_BUFFER_SIZE > 65535)
+#error "simio buffer sizes are limited to 65535 bytes"
+#endif
+
+/* number of message start positions kept for the non blocking mode, a
+ * message is the data of one SIMIO_Write() call */
+#ifndef SIMIO_TH_MESSAGE_COUNT
+#define SIMIO_TH_MESSAGE_COUNT		32
+#endif /* SIMIO_TH_MESSAGE_COUNT */
+
+typedef struct tagSimIOHTBuffer
 {
 	unsigned short wReadIndex;
 	unsigned short wWriteIndex;
-	unsigned char byBuffer[SIMIO_TARGET_BUFFER_SIZE];
-} SIMIOBUFFER_t;
+	unsigned char byBuffer[SIMIO_HT_BUFFER_SIZE];
+} SIMIOHTBUFFER_t;
+
+typedef struct tagSimIOTHBuffer
+{
+	unsigned short wReadIndex;
+	unsigned short wWriteIndex;
+	unsigned char byBuffer[SIMIO_TH_BUFFER_SIZE];
+} SIMIOTHBUFFER_t;
 
 typedef struct tagJtagSimioAccess
 {
 	unsigned int dwSignature;
 	unsigned short wHTBufSize;
 	unsigned short wTHBufSize;
-	volatile SIMIOBUFFER_t *dwHTBufAddr;
-	volatile SIMIOBUFFER_t *dwTHBufAddr;
+	volatile SIMIOHTBUFFER_t *dwHTBufAddr;
+	volatile SIMIOTHBUFFER_t *dwTHBufAddr;
 } TJtagSimioAccess_t;
 
 #define JTAG_SIMIO_SIGNATURE	0x4741544A	/* "JTAG" */
@@ -52,10 +77,12 @@ typedef struct tagJtagSimioAccess
 //   PROTOTYPES OF INTERNAL FUNCTIONS
 //
 // ***********************************************************************
-static unsigned int simio_GetTHBufferSpace(void);
+static unsigned int simio_GetTHBufferSpace(unsigned int Count);
 static unsigned int simio_GetHTCharCount(void);
 static unsigned char simio_GetByteFromHost(void);
 static void simio_PutByteToHost(unsigned char Data);
+static unsigned int simio_ReadFromHost(unsigned char *Data, unsigned int Count);
+static unsigned int simio_WriteToHost(const unsigned char *Data, unsigned int Count);
 
 // ***********************************************************************
 //
@@ -63,19 +90,23 @@ static void simio_PutByteToHost(unsigned char Data);
 //
 // ***********************************************************************
 #pragma section ".data"
-static volatile SIMIOBUFFER_t simio_HTBuffer = { 0, 0, {0} };
-static volatile SIMIOBUFFER_t simio_THBuffer = { 0, 0, {0} };
+static volatile SIMIOHTBUFFER_t simio_HTBuffer = { 0, 0, {0} };
+static volatile SIMIOTHBUFFER_t simio_THBuffer = { 0, 0, {0} };
 
 TJtagSimioAccess_t g_JtagSimioAccess =
 {
 	.dwSignature = JTAG_SIMIO_SIGNATURE,
-	.wHTBufSize  = SIMIO_TARGET_BUFFER_SIZE,
-	.wTHBufSize  = SIMIO_TARGET_BUFFER_SIZE,
+	.wHTBufSize  = SIMIO_HT_BUFFER_SIZE,
+	.wTHBufSize  = SIMIO_TH_BUFFER_SIZE,
 	.dwHTBufAddr = &simio_HTBuffer,
 	.dwTHBufAddr = &simio_THBuffer
 };
 
 static unsigned int simio_NonBlockingMode = 0;
+static volatile unsigned int simio_LostByteCount = 0;
+static unsigned int simio_THWriteTotal = 0;	/* bytes written into the TH buffer, modulo 2^32 */
+static unsigned int simio_THMessageStart[SIMIO_TH_MESSAGE_COUNT];	/* simio_THWriteTotal at the message starts */
+static unsigned int simio_THMessageTotal = 0;
 #pragma section
 
 // ***********************************************************************
@@ -93,17 +124,20 @@ void SIMIO_Init(unsigned int Mode)
 
 // ***********************************************************************
 //
-//  Get free buffer space for output buffer (non blocking
+//  Get free buffer space for output buffer (non blocking)
+//  In non blocking mode, the oldest messages are dropped to make room for
+//  Count bytes with a single update of the read index. The read index is
+//  moved to the start of a message, so that no message is cut
 //
 // ***********************************************************************
-static unsigned int simio_GetTHBufferSpace(void)
+static unsigned int simio_GetTHBufferSpace(unsigned int Count)
 {
 	unsigned int uiBufferSpace;
 	unsigned short wReadIndex, wWriteIndex;
 
 	/* access through global structure so that it is not removed by linker */
-	wReadIndex  = g_JtagSimioAccess.dwHTBufAddr->wReadIndex;
-	wWriteIndex = g_JtagSimioAccess.dwHTBufAddr->wWriteIndex;
+	wReadIndex  = g_JtagSimioAccess.dwTHBufAddr->wReadIndex;
+	wWriteIndex = g_JtagSimioAccess.dwTHBufAddr->wWriteIndex;
 
 	if (wWriteIndex < wReadIndex)
 	{
@@ -111,22 +145,45 @@ static unsigned int simio_GetTHBufferSpace(void)
 	}
 	else
 	{
-		uiBufferSpace = wReadIndex + (SIMIO_TARGET_BUFFER_SIZE - 1 - wWriteIndex);
+		uiBufferSpace = wReadIndex + (SIMIO_TH_BUFFER_SIZE - 1 - wWriteIndex);
 	}
 	/* check for new space we set the readindex and losing old data */
 	if (simio_NonBlockingMode)
 	{
-		if (uiBufferSpace == 0)
+		if (Count > SIMIO_TH_BUFFER_SIZE - 1)
+		{
+			Count = SIMIO_TH_BUFFER_SIZE - 1;
+		}
+		if (uiBufferSpace < Count)
 		{
-			if (++wReadIndex >= SIMIO_TARGET_BUFFER_SIZE)
+			unsigned int uiUsed = SIMIO_TH_BUFFER_SIZE - 1 - uiBufferSpace;
+			unsigned int uiDrop = uiUsed;	/* all the data not read, up to the write index */
+			unsigned int uiIndex, uiMessage;
+
+			/* first message start, oldest first, which makes enough room */
+			uiMessage = (simio_THMessageTotal > SIMIO_TH_MESSAGE_COUNT) ? (simio_THMessageTotal - SIMIO_TH_MESSAGE_COUNT) : 0;
+			for (; uiMessage < simio_THMessageTotal; uiMessage++)
+			{
+				unsigned int uiAge = simio_THWriteTotal - simio_THMessageStart[uiMessage % SIMIO_TH_MESSAGE_COUNT];
+
+				/* uiAge >= uiUsed: message start already read by the host or dropped */
+				if ((uiAge < uiUsed) && ((uiBufferSpace + uiUsed - uiAge) >= Count))
+				{
+					uiDrop = uiUsed - uiAge;
+					break;
+				}
+			}
+
+			uiIndex = (unsigned int)wReadIndex + uiDrop;
+			if (uiIndex >= SIMIO_TH_BUFFER_SIZE)
 			{
-				wReadIndex = 0;
+				uiIndex -= SIMIO_TH_BUFFER_SIZE;
 			}
-			simio_THBuffer.wReadIndex = wReadIndex;
-			uiBufferSpace = 1;
-	  }
+			simio_THBuffer.wReadIndex = (unsigned short)uiIndex;
+			simio_LostByteCount += uiDrop;
+			uiBufferSpace += uiDrop;
+		}
 	}
-	/* we need 1 or more Bytes of space */
 	return uiBufferSpace;
 }
 
@@ -147,7 +204,7 @@ static unsigned int simio_GetHTCharCount(void)
 	}
 	else
 	{
-		return wWriteIndex + (SIMIO_TARGET_BUFFER_SIZE - wReadIndex);
+		return wWriteIndex + (SIMIO_HT_BUFFER_SIZE - wReadIndex);
 	}
 }
 
@@ -162,7 +219,7 @@ static unsigned char simio_GetByteFromHost(void)
 	unsigned char ucByte;
 	wReadIndex = simio_HTBuffer.wReadIndex;
 	ucByte = simio_HTBuffer.byBuffer[wReadIndex++];
-	if (wReadIndex >= SIMIO_TARGET_BUFFER_SIZE)
+	if (wReadIndex >= SIMIO_HT_BUFFER_SIZE)
 		wReadIndex = 0;
 	simio_HTBuffer.wReadIndex = wReadIndex;
 	return ucByte;
@@ -175,28 +232,93 @@ static unsigned char simio_GetByteFromHost(void)
 // ***********************************************************************
 static void simio_PutByteToHost(unsigned char Data)
 {
-	unsigned short wWriteIndex;
+	simio_WriteToHost(&Data, 1);
+}
 
-	if (simio_NonBlockingMode)
+// ***********************************************************************
+//
+//  Read up to Count bytes from HT transfer buffer (non blocking)
+//  The data is copied with at most two memcpy() calls
+//
+// ***********************************************************************
+static unsigned int simio_ReadFromHost(unsigned char *Data, unsigned int Count)
+{
+	unsigned int uiAvailable, uiChunk, uiIndex;
+	unsigned short wReadIndex;
+
+	uiAvailable = simio_GetHTCharCount();
+	if (Count > uiAvailable)
 	{
-		if (!simio_GetTHBufferSpace())
-		{
-			return; /* discard */
-		}
+		Count = uiAvailable;
 	}
-	else
+	wReadIndex = simio_HTBuffer.wReadIndex;
+	uiChunk = SIMIO_HT_BUFFER_SIZE - wReadIndex;
+	if (uiChunk > Count)
 	{
-		/* wait until buffer space is available */
-		while (!simio_GetTHBufferSpace())
-			;
+		uiChunk = Count;
 	}
-	wWriteIndex = simio_THBuffer.wWriteIndex;
-	simio_THBuffer.byBuffer[wWriteIndex++] = Data;
-	if (wWriteIndex >= SIMIO_TARGET_BUFFER_SIZE)
+	memcpy(Data, (const unsigned char *)&simio_HTBuffer.byBuffer[wReadIndex], uiChunk);
+	memcpy(Data + uiChunk, (const unsigned char *)&simio_HTBuffer.byBuffer[0], Count - uiChunk);
+	uiIndex = (unsigned int)wReadIndex + Count;
+	if (uiIndex >= SIMIO_HT_BUFFER_SIZE)
 	{
-		wWriteIndex = 0;
+		uiIndex -= SIMIO_HT_BUFFER_SIZE;
 	}
-	simio_THBuffer.wWriteIndex = wWriteIndex;
+	simio_HTBuffer.wReadIndex = (unsigned short)uiIndex;
+	return Count;
+}
+
+// ***********************************************************************
+//
+//  write Count bytes to TH transfer buffer
+//  blocking mode: wait until all data is written
+//  non blocking mode: the oldest messages are overwritten. A message
+//  bigger than the buffer is dropped
+//  The write index is updated once per copied block
+//
+// ***********************************************************************
+static unsigned int simio_WriteToHost(const unsigned char *Data, unsigned int Count)
+{
+	unsigned int uiWritten = 0;
+
+	if (simio_NonBlockingMode && (Count > SIMIO_TH_BUFFER_SIZE - 1))
+	{
+		simio_LostByteCount += Count;
+		return Count;
+	}
+	simio_THMessageStart[simio_THMessageTotal % SIMIO_TH_MESSAGE_COUNT] = simio_THWriteTotal;
+	simio_THMessageTotal++;
+	while (uiWritten < Count)
+	{
+		unsigned int uiSpace, uiBlock, uiChunk, uiIndex;
+		unsigned short wWriteIndex;
+
+		/* wait until buffer space is available */
+		while (0 == (uiSpace = simio_GetTHBufferSpace(Count - uiWritten)))
+			;
+		uiBlock = Count - uiWritten;
+		if (uiBlock > uiSpace)
+		{
+			uiBlock = uiSpace;
+		}
+		wWriteIndex = simio_THBuffer.wWriteIndex;
+		uiChunk = SIMIO_TH_BUFFER_SIZE - wWriteIndex;
+		if (uiChunk > uiBlock)
+		{
+			uiChunk = uiBlock;
+		}
+		memcpy((unsigned char *)&simio_THBuffer.byBuffer[wWriteIndex], Data + uiWritten, uiChunk);
+		memcpy((unsigned char *)&simio_THBuffer.byBuffer[0], Data + uiWritten + uiChunk, uiBlock - uiChunk);
+		uiIndex = (unsigned int)wWriteIndex + uiBlock;
+		if (uiIndex >= SIMIO_TH_BUFFER_SIZE)
+		{
+			uiIndex -= SIMIO_TH_BUFFER_SIZE;
+		}
+		simio_THBuffer.wWriteIndex = (unsigned short)uiIndex;
+		simio_THWriteTotal += uiBlock;
+		uiWritten += uiBlock;
+	}
+	return Count;
 }
 
 // ***********************************************************************
@@ -217,10 +339,7 @@ size_t read(int fd, void *buffer, size_t count)
 		/* wait for at least one byte */
 		while (0 == simio_GetHTCharCount())
 			;
-		for (; index < count && 0 != simio_GetHTCharCount(); index++, buf++)
-		{
-			*buf = simio_GetByteFromHost();
-		}
+		index = simio_ReadFromHost((unsigned char *)buf, count);
 	}
 	return index;
 }
@@ -237,11 +356,7 @@ size_t write(int fd, const void *buffer, size_t count)
 	index = 0;
 	if (fileno(stdout) == fd || fileno(stderr) == fd)
 	{
-		const char *buf = (const char *)buffer;
-		for (; index < count; index++, buf++)
-		{
-			simio_PutByteToHost(*buf);
-		}
+		index = simio_WriteToHost((const unsigned char *)buffer, count);
 	}
 	return index;
 }
@@ -272,3 +387,24 @@ void SIMIO_PutByteToHost(unsigned char Data)
 {
 	simio_PutByteToHost(Data);
 }
+
+unsigned int SIMIO_Read(void *Data, unsigned int Count)
+{
+	if (!simio_NonBlockingMode)
+	{
+		/* wait for data */
+		while (0 == SIMIO_GetHTCharCount())
+			;
+	}
+	return simio_ReadFromHost((unsigned char *)Data, Count);
+}
+
+unsigned int SIMIO_Write(const void *Data, unsigned int Count)
+{
+	return simio_WriteToHost((const unsigned char *)Data, Count);
+}
+
+unsigned int SIMIO_GetLostByteCount(void)
+{
+	return simio_LostByteCount;
+}